@@ -38,6 +38,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <string.h>
+#include <limits.h>
 
 #include "platform.h"
 #include "type_traits.h"
@@ -45,6 +46,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "functional.h"
 #include "utility.h"
+#include "nullptr.h"
 
 #if !defined(ETL_NO_STL)
   #include <algorithm>
@@ -67,6 +69,27 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TBuffer>
+  void merge_sort(TIterator first, TIterator last, TBuffer buffer);
+
+  template <typename TIterator, typename TBuffer, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBuffer buffer, TCompare compare);
+
+  template <typename TIterator, typename TBuffer>
+  void radix_sort(TIterator first, TIterator last, TBuffer scratch);
+
+  template <typename TIterator, typename TBuffer, typename TKeyFunction>
+  void radix_sort(TIterator first, TIterator last, TBuffer scratch, TKeyFunction key_fn);
+
+  template <typename T>
+  class ivector;
 }
 
 //*****************************************************************************
@@ -153,14 +176,77 @@ namespace etl
   }
 #endif
 
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// True if a range may be copied from TIterator1 to TIterator2 with memmove.
+    /// Both must be pointers to the same trivially copyable type.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_memmove_compatible
+    {
+      typedef typename etl::iterator_traits<TIterator1>::value_type value1_t;
+      typedef typename etl::iterator_traits<TIterator2>::value_type value2_t;
+
+      static const bool value = etl::is_pointer<TIterator1>::value &&
+                                etl::is_pointer<TIterator2>::value &&
+                                etl::is_same<typename etl::remove_cv<value1_t>::type, typename etl::remove_cv<value2_t>::type>::value &&
+                                etl::is_trivially_copyable<value1_t>::value;
+    };
+
+    //*************************************************************************
+    /// True if a range of TIterator1 may be compared with a range of TIterator2
+    /// using memcmp.
+    /// Both must be pointers to the same integral or pointer type, as padding,
+    /// and floating point zeros and NaNs, do not compare as bytes.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_memcmp_compatible
+    {
+      typedef typename etl::iterator_traits<TIterator1>::value_type value1_t;
+      typedef typename etl::iterator_traits<TIterator2>::value_type value2_t;
+      typedef typename etl::remove_cv<value1_t>::type               type1_t;
+
+      static const bool value = etl::is_pointer<TIterator1>::value &&
+                                etl::is_pointer<TIterator2>::value &&
+                                etl::is_same<type1_t, typename etl::remove_cv<value2_t>::type>::value &&
+                                (etl::is_integral<type1_t>::value || etl::is_pointer<type1_t>::value);
+    };
+
+    //*************************************************************************
+    /// True if TIterator is a pointer to a byte sized integral type, so that
+    /// the range may be searched with memchr or filled with memset.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_byte_pointer
+    {
+      typedef typename etl::remove_cv<typename etl::iterator_traits<TIterator>::value_type>::type value_t;
+
+      static const bool value = etl::is_pointer<TIterator>::value &&
+                                etl::is_integral<value_t>::value &&
+                                !etl::is_same<value_t, bool>::value &&
+                                (sizeof(value_t) == 1U);
+    };
+
+    //*************************************************************************
+    /// True if TIterator is a pointer to unsigned bytes, so that the range
+    /// may be ordered with memcmp.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_unsigned_byte_pointer
+    {
+      typedef typename etl::remove_cv<typename etl::iterator_traits<TIterator>::value_type>::type value_t;
+
+      static const bool value = is_byte_pointer<TIterator>::value && etl::is_unsigned<value_t>::value;
+    };
+  }
+
 #if defined(ETL_NO_STL)
   //***************************************************************************
   // copy
   // Pointer
   template <typename TIterator1, typename TIterator2>
-  typename etl::enable_if<etl::is_pointer<TIterator1>::value &&
-                             etl::is_pointer<TIterator2>::value &&
-                             etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
     typedef typename etl::iterator_traits<TIterator1>::value_type value_t;
@@ -173,9 +259,7 @@ namespace etl
 
   // Other iterator
   template <typename TIterator1, typename TIterator2>
-  typename etl::enable_if<!etl::is_pointer<TIterator1>::value ||
-                             !etl::is_pointer<TIterator2>::value ||
-                             !etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<!etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
     while (sb != se)
@@ -223,9 +307,7 @@ namespace etl
   // copy_n
   // Pointer
   template <typename TIterator1, typename TSize, typename TIterator2>
-  typename etl::enable_if<etl::is_pointer<TIterator1>::value &&
-                             etl::is_pointer<TIterator2>::value &&
-                             etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy_n(TIterator1 sb, TSize count, TIterator2 db)
   {
     typedef typename etl::iterator_traits<TIterator1>::value_type value_t;
@@ -235,9 +317,7 @@ namespace etl
 
   // Other iterator
   template <typename TIterator1, typename TSize, typename TIterator2>
-  typename etl::enable_if<!etl::is_pointer<TIterator1>::value ||
-                             !etl::is_pointer<TIterator2>::value ||
-                             !etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<!etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy_n(TIterator1 sb, TSize count, TIterator2 db)
   {
     while (count != 0)
@@ -268,9 +348,7 @@ namespace etl
   // copy_backward
   // Pointer
   template <typename TIterator1, typename TIterator2>
-  typename etl::enable_if<etl::is_pointer<TIterator1>::value &&
-    etl::is_pointer<TIterator2>::value &&
-    etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
   {
     typedef typename etl::iterator_traits<TIterator1>::value_type value_t;
@@ -282,9 +360,7 @@ namespace etl
 
   // Other iterator
   template <typename TIterator1, typename TIterator2>
-  typename etl::enable_if<!etl::is_pointer<TIterator1>::value ||
-    !etl::is_pointer<TIterator2>::value ||
-    !etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, TIterator2>::type
+  typename etl::enable_if<!etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
     copy_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
   {
     while (se != sb)
@@ -308,8 +384,18 @@ namespace etl
 #if defined(ETL_NO_STL)
   //***************************************************************************
   // move
+  // Pointer
   template <typename TIterator1, typename TIterator2>
-  TIterator2 move(TIterator1 sb, TIterator1 se, TIterator2 db)
+  typename etl::enable_if<etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
+    move(TIterator1 sb, TIterator1 se, TIterator2 db)
+  {
+    return etl::copy(sb, se, db);
+  }
+
+  // Other iterator
+  template <typename TIterator1, typename TIterator2>
+  typename etl::enable_if<!etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
+    move(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
     while (sb != se)
     {
@@ -378,8 +464,18 @@ namespace etl
 #if defined(ETL_NO_STL)
   //***************************************************************************
   // move_backward
+  // Pointer
   template <typename TIterator1, typename TIterator2>
-  TIterator2 move_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
+  typename etl::enable_if<etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
+    move_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
+  {
+    return etl::copy_backward(sb, se, de);
+  }
+
+  // Other iterator
+  template <typename TIterator1, typename TIterator2>
+  typename etl::enable_if<!etl::private_algorithm::is_memmove_compatible<TIterator1, TIterator2>::value, TIterator2>::type
+    move_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
   {
     while (sb != se)
     {
@@ -404,7 +500,7 @@ namespace etl
   TIterator2 move_backward(TIterator1 sb, TIterator1 se, TIterator2 de)
   {
     // Move not supported. Defer to copy_backward.
-    return std::copy_backward(sb, se, de);
+    return etl::copy_backward(sb, se, de);
   }
 #endif
 
@@ -600,6 +696,193 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// branchless_lower_bound
+  /// A lower_bound for random access iterators where the loop has no data
+  /// dependent branches. The comparison result selects the next base with a
+  /// conditional move, so there are no mispredictions when searching for keys
+  /// in a random order.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length == 0)
+    {
+      return first;
+    }
+
+    while (length > 1)
+    {
+      const difference_t half = length / 2;
+
+      first  += compare(first[half], value) ? half : 0;
+      length -= half;
+    }
+
+    return first + (compare(*first, value) ? 1 : 0);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_lower_bound(first, last, value, compare());
+  }
+
+  //***************************************************************************
+  /// branchless_upper_bound
+  /// An upper_bound for random access iterators where the loop has no data
+  /// dependent branches.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length == 0)
+    {
+      return first;
+    }
+
+    while (length > 1)
+    {
+      const difference_t half = length / 2;
+
+      first  += compare(value, first[half]) ? 0 : half;
+      length -= half;
+    }
+
+    return first + (compare(value, *first) ? 0 : 1);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_upper_bound(first, last, value, compare());
+  }
+
+  //***************************************************************************
+  /// eytzinger_layout
+  /// Copies a sorted range to 'o_first' in Eytzinger (breadth first) order.
+  /// The children of the element at index i are at 2i + 1 and 2i + 2.
+  /// Searching this layout with eytzinger_lower_bound touches the first levels
+  /// of the tree in the same few cache lines for every search. Suits tables
+  /// that are built once and then only searched.
+  ///\param i_first  The start of the sorted source range.
+  ///\param i_last   The end of the sorted source range.
+  ///\param o_first  The start of the destination, which may not overlap the source.
+  ///\return The end of the destination.
+  //***************************************************************************
+  template<typename TInputIterator, typename TOutputIterator>
+  TOutputIterator eytzinger_layout(TInputIterator i_first, TInputIterator i_last, TOutputIterator o_first)
+  {
+    typedef typename etl::iterator_traits<TOutputIterator>::difference_type difference_t;
+
+    const difference_t length = difference_t(etl::distance(i_first, i_last));
+
+    // An in-order walk of the implicit tree visits the slots in sorted order.
+    difference_t index = 0;
+
+    while ((2 * index) + 1 < length)
+    {
+      index = (2 * index) + 1;
+    }
+
+    while (i_first != i_last)
+    {
+      o_first[index] = *i_first;
+      ++i_first;
+
+      if ((2 * index) + 2 < length)
+      {
+        // Next is the leftmost slot of the right subtree.
+        index = (2 * index) + 2;
+
+        while ((2 * index) + 1 < length)
+        {
+          index = (2 * index) + 1;
+        }
+      }
+      else
+      {
+        // Next is the first ancestor that is reached from its left subtree.
+        while ((index > 0) && ((index % 2) == 0))
+        {
+          index = (index - 1) / 2;
+        }
+
+        index = (index - 1) / 2;
+      }
+    }
+
+    return o_first + length;
+  }
+
+  //***************************************************************************
+  /// eytzinger_lower_bound
+  /// Finds the first element not less than 'value' in a range laid out by
+  /// eytzinger_layout. The descent is branchless and prefetches the cache
+  /// line holding the descendants four levels below.
+  ///\return An iterator to the element, or 'last' if all are less than 'value'.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  TIterator eytzinger_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    const difference_t length = last - first;
+
+    difference_t index = 0;
+
+    while (index < length)
+    {
+      const difference_t prefetch = (16 * index) + 15;
+
+      if (prefetch < length)
+      {
+        ETL_PREFETCH(&first[prefetch]);
+      }
+
+      index = (2 * index) + 1 + (compare(first[index], value) ? 1 : 0);
+    }
+
+    // The result is the node where the search last turned left.
+    // Strip the trailing right turns (ones) and that left turn (zero) from the 1 based position.
+    difference_t position = index + 1;
+
+    while ((position & 1) != 0)
+    {
+      position >>= 1;
+    }
+
+    position >>= 1;
+
+    return (position == 0) ? last : first + (position - 1);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  TIterator eytzinger_lower_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::eytzinger_lower_bound(first, last, value, compare());
+  }
+
 #if defined(ETL_NO_STL)
   //***************************************************************************
   // find_if
@@ -635,7 +918,8 @@ namespace etl
   // find
   template <typename TIterator, typename T>
   ETL_NODISCARD
-  TIterator find(TIterator first, TIterator last, const T& value)
+  typename etl::enable_if<!etl::private_algorithm::is_byte_pointer<TIterator>::value, TIterator>::type
+    find(TIterator first, TIterator last, const T& value)
   {
     while (first != last)
     {
@@ -649,6 +933,29 @@ namespace etl
 
     return last;
   }
+
+  //***************************************************************************
+  // find
+  // Byte pointer
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::private_algorithm::is_byte_pointer<TIterator>::value, TIterator>::type
+    find(TIterator first, TIterator last, const T& value)
+  {
+    typedef typename etl::remove_cv<typename etl::iterator_traits<TIterator>::value_type>::type value_t;
+
+    const value_t byte = static_cast<value_t>(value);
+
+    // A value that the bytes cannot hold is never found.
+    if (!(byte == value) || (first == last))
+    {
+      return last;
+    }
+
+    const void* p = memchr(first, static_cast<unsigned char>(byte), size_t(last - first));
+
+    return (p == nullptr) ? last : first + (static_cast<const char*>(p) - reinterpret_cast<const char*>(first));
+  }
 #else
   //***************************************************************************
   // find
@@ -664,7 +971,7 @@ namespace etl
   //***************************************************************************
   // fill
   template<typename TIterator, typename TValue>
-  typename etl::enable_if<!(etl::is_same<char, TValue>::value || etl::is_same<unsigned char, TValue>::value) || !etl::is_pointer<TIterator>::value, void>::type
+  typename etl::enable_if<!etl::private_algorithm::is_byte_pointer<TIterator>::value, void>::type
     fill(TIterator first, TIterator last, const TValue& value)
   {
     while (first != last)
@@ -673,11 +980,16 @@ namespace etl
     }
   }
 
+  //***************************************************************************
+  // fill
+  // Byte pointer
   template<typename TIterator, typename TValue>
-  typename etl::enable_if<(etl::is_same<char, TValue>::value || etl::is_same<unsigned char, TValue>::value) && etl::is_pointer<TIterator>::value, void>::type
+  typename etl::enable_if<etl::private_algorithm::is_byte_pointer<TIterator>::value, void>::type
     fill(TIterator first, TIterator last, const TValue& value)
   {
-    memset(first, value, last - first);
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    memset(first, static_cast<unsigned char>(static_cast<value_t>(value)), size_t(last - first));
   }
 #else
   //***************************************************************************
@@ -693,7 +1005,7 @@ namespace etl
   //***************************************************************************
   // fill_n
   template<typename TIterator, typename TSize, typename TValue>
-  typename etl::enable_if<!(etl::is_same<char, TValue>::value || etl::is_same<unsigned char, TValue>::value) || !etl::is_pointer<TIterator>::value, TIterator>::type
+  typename etl::enable_if<!etl::private_algorithm::is_byte_pointer<TIterator>::value, TIterator>::type
     fill_n(TIterator first, TSize count, const TValue& value)
   {
     for (TSize i = 0; i < count; ++i)
@@ -704,11 +1016,18 @@ namespace etl
     return first;
   }
 
+  //***************************************************************************
+  // fill_n
+  // Byte pointer
   template<typename TIterator, typename TSize, typename TValue>
-  typename etl::enable_if<(etl::is_same<char, TValue>::value || etl::is_same<unsigned char, TValue>::value) && etl::is_pointer<TIterator>::value, void>::type
+  typename etl::enable_if<etl::private_algorithm::is_byte_pointer<TIterator>::value, TIterator>::type
     fill_n(TIterator first, TSize count, const TValue& value)
   {
-    memset(first, value, count);
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    memset(first, static_cast<unsigned char>(static_cast<value_t>(value)), size_t(count));
+
+    return first + count;
   }
 #else
   //***************************************************************************
@@ -725,7 +1044,9 @@ namespace etl
   // count
   template <typename TIterator, typename T>
   ETL_NODISCARD
-  typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  typename etl::enable_if<!(etl::is_pointer<TIterator>::value && etl::is_integral<typename etl::iterator_traits<TIterator>::value_type>::value),
+                          typename etl::iterator_traits<TIterator>::difference_type>::type
+    count(TIterator first, TIterator last, const T& value)
   {
     typename iterator_traits<TIterator>::difference_type n = 0;
 
@@ -741,6 +1062,38 @@ namespace etl
 
     return n;
   }
+
+  //***************************************************************************
+  // count
+  // Pointer to integral.
+  // Accumulates the comparisons without branching, so that the compiler may
+  // vectorise the loop.
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::is_pointer<TIterator>::value && etl::is_integral<typename etl::iterator_traits<TIterator>::value_type>::value,
+                          typename etl::iterator_traits<TIterator>::difference_type>::type
+    count(TIterator first, TIterator last, const T& value)
+  {
+    typedef typename etl::remove_cv<typename etl::iterator_traits<TIterator>::value_type>::type value_t;
+
+    const value_t v = static_cast<value_t>(value);
+
+    // A value that the elements cannot hold is never counted.
+    if (!(v == value))
+    {
+      return 0;
+    }
+
+    const size_t length = size_t(last - first);
+    size_t       n      = 0U;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      n += (first[i] == v) ? 1U : 0U;
+    }
+
+    return typename etl::iterator_traits<TIterator>::difference_type(n);
+  }
 #else
   //***************************************************************************
   // count
@@ -789,12 +1142,12 @@ namespace etl
   // equal
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
-  typename etl::enable_if<!etl::is_pointer<TIterator1>::value || !etl::is_pointer<TIterator2>::value || !etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, bool>::type
+  typename etl::enable_if<!etl::private_algorithm::is_memcmp_compatible<TIterator1, TIterator2>::value, bool>::type
     equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
     while (first1 != last1)
     {
-      if (*first1++ != *first2++)
+      if (!(*first1++ == *first2++))
       {
         return false;
       }
@@ -803,9 +1156,12 @@ namespace etl
     return true;
   }
 
+  //***************************************************************************
+  // equal
+  // Pointers to integral or pointer types.
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
-  typename etl::enable_if<etl::is_pointer<TIterator1>::value && etl::is_pointer<TIterator2>::value && etl::is_pod<typename etl::iterator_traits<TIterator1>::value_type>::value, bool>::type
+  typename etl::enable_if<etl::private_algorithm::is_memcmp_compatible<TIterator1, TIterator2>::value, bool>::type
     equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
     typedef typename etl::iterator_traits<TIterator1>::value_type value_t;
@@ -855,13 +1211,33 @@ namespace etl
   // lexicographical_compare
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
-  bool lexicographical_compare(TIterator1 first1, TIterator1 last1,
-                               TIterator2 first2, TIterator2 last2)
+  typename etl::enable_if<!(etl::private_algorithm::is_memcmp_compatible<TIterator1, TIterator2>::value &&
+                            etl::private_algorithm::is_unsigned_byte_pointer<TIterator1>::value), bool>::type
+    lexicographical_compare(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2)
   {
     typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
     return etl::lexicographical_compare(first1, last1, first2, last2, compare());
   }
+
+  //***************************************************************************
+  // lexicographical_compare
+  // Pointers to unsigned bytes.
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::private_algorithm::is_memcmp_compatible<TIterator1, TIterator2>::value &&
+                          etl::private_algorithm::is_unsigned_byte_pointer<TIterator1>::value, bool>::type
+    lexicographical_compare(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2)
+  {
+    const size_t length1 = size_t(last1 - first1);
+    const size_t length2 = size_t(last2 - first2);
+
+    const int result = memcmp(first1, first2, (length1 < length2) ? length1 : length2);
+
+    return (result < 0) || ((result == 0) && (length1 < length2));
+  }
 #else
   //***************************************************************************
   // lexicographical_compare
@@ -1010,12 +1386,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = first[parent];
+        first[value_index] = etl::move(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = value;
+      first[value_index] = etl::move(value);
     }
 
     // Adjust Heap Helper
@@ -1032,18 +1408,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = first[child2nd];
+        first[value_index] = etl::move(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = first[child2nd - 1];
+        first[value_index] = etl::move(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, value, compare);
+      push_heap(first, value_index, top_index, etl::move(value), compare);
     }
 
     // Is Heap Helper
@@ -1079,7 +1455,7 @@ namespace etl
     value_t value = etl::move(last[-1]);
     last[-1] = etl::move(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), value, compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
   }
 
   // Pop Heap
@@ -1098,7 +1474,7 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(*(last - 1)), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
   }
 
   // Push Heap
@@ -1126,7 +1502,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, *(first + parent), compare);
+      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -2351,7 +2727,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    etl::intro_sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -2361,7 +2737,7 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
@@ -2431,6 +2807,19 @@ namespace etl
     std::stable_sort(first, last);
   }
 #endif
+
+  //***************************************************************************
+  /// Sorts the elements, using a caller supplied scratch buffer.
+  /// Stable. O(N log N).
+  /// Uses user defined comparison.
+  ///\param buffer Scratch space for at least (last - first) / 2 elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBuffer buffer, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer, compare);
+  }
 }
 
 //*****************************************************************************
@@ -2708,6 +3097,77 @@ namespace etl
     return begin;
   }
 
+  //***************************************************************************
+  /// Like std::for_each but prefetches the element 'lookahead' places ahead of
+  /// the current one, for containers of linked nodes such as etl::list,
+  /// etl::map and etl::unordered_map.
+  /// Incrementing an iterator reads the node that it leaves, not the one that
+  /// it arrives at, so each node is fetched while the function is called for
+  /// the elements behind it.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TUnaryFunction>
+  TUnaryFunction for_each_prefetch(TIterator       begin,
+                                   const TIterator end,
+                                   TUnaryFunction  function,
+                                   size_t          lookahead = 4U)
+  {
+    TIterator ahead = begin;
+
+    if (ahead != end)
+    {
+      ETL_PREFETCH(&*ahead);
+    }
+
+    // Move ahead of the current element.
+    while ((lookahead != 0U) && (ahead != end))
+    {
+      ++ahead;
+      --lookahead;
+
+      if (ahead != end)
+      {
+        ETL_PREFETCH(&*ahead);
+      }
+    }
+
+    while (ahead != end)
+    {
+      function(*begin);
+      ++begin;
+      ++ahead;
+
+      if (ahead != end)
+      {
+        ETL_PREFETCH(&*ahead);
+      }
+    }
+
+    // The last elements have already been fetched.
+    while (begin != end)
+    {
+      function(*begin);
+      ++begin;
+    }
+
+    return function;
+  }
+
+  //***************************************************************************
+  /// Calls the function for each element of the container, prefetching the
+  /// element 'lookahead' places ahead of the current one.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TContainer,
+            typename TUnaryFunction>
+  TUnaryFunction for_each_prefetch(TContainer&    container,
+                                   TUnaryFunction function,
+                                   size_t         lookahead = 4U)
+  {
+    return etl::for_each_prefetch(container.begin(), container.end(), function, lookahead);
+  }
+
   //***************************************************************************
   /// A safer form of std::transform where the transform returns when the first
   /// range end is reached.
@@ -3059,6 +3519,1161 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  namespace private_sort
+  {
+    //*************************************************************************
+    /// Orders a pair of elements.
+    /// Arithmetic and pointer types are selected rather than swapped, which
+    /// compiles to conditional moves rather than branches.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void compare_exchange_pair(TIterator a, TIterator b, TCompare compare, etl::true_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      const value_t x    = *a;
+      const value_t y    = *b;
+      const bool    swap = compare(y, x);
+
+      *a = swap ? y : x;
+      *b = swap ? x : y;
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void compare_exchange_pair(TIterator a, TIterator b, TCompare compare, etl::false_type)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void compare_exchange(TIterator first, size_t i, size_t j, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+      typedef etl::integral_constant<bool, etl::is_arithmetic<value_t>::value || etl::is_pointer<value_t>::value> is_selectable;
+
+      private_sort::compare_exchange_pair(first + i, first + j, compare, is_selectable());
+    }
+
+    //*************************************************************************
+    /// Sorting networks with the fewest known comparators for up to 16
+    /// elements. The comparators of each line are independent.
+    //*************************************************************************
+    template <size_t N>
+    struct sorting_network;
+
+    template <>
+    struct sorting_network<0>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator, TCompare)
+      {
+      }
+    };
+
+    template <>
+    struct sorting_network<1>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator, TCompare)
+      {
+      }
+    };
+
+    template <>
+    struct sorting_network<2>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 1, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<3>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 2, compare);
+        compare_exchange(first, 0, 1, compare);
+        compare_exchange(first, 1, 2, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<4>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare);
+        compare_exchange(first, 1, 2, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<5>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 3, compare); compare_exchange(first, 1, 4, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 4, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare);
+        compare_exchange(first, 2, 3, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<6>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 5, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 2, 4, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare);
+        compare_exchange(first, 0, 3, compare); compare_exchange(first, 2, 5, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<7>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 6, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 4, compare); compare_exchange(first, 3, 6, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 3, 4, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 4, 6, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<8>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 7, compare);
+        compare_exchange(first, 0, 4, compare); compare_exchange(first, 1, 5, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 3, 7, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare);
+        compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 5, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 3, 6, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<9>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 3, compare); compare_exchange(first, 1, 7, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 4, 8, compare);
+        compare_exchange(first, 0, 7, compare); compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 8, compare); compare_exchange(first, 5, 6, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 7, 8, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 5, 7, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 6, 8, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<10>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 8, compare); compare_exchange(first, 1, 9, compare); compare_exchange(first, 2, 7, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 4, 6, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 4, compare); compare_exchange(first, 5, 8, compare); compare_exchange(first, 7, 9, compare);
+        compare_exchange(first, 0, 3, compare); compare_exchange(first, 2, 4, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 6, 9, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 8, 9, compare);
+        compare_exchange(first, 1, 5, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 8, compare); compare_exchange(first, 6, 7, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 7, 8, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<11>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 9, compare); compare_exchange(first, 1, 6, compare); compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 7, compare); compare_exchange(first, 5, 8, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 4, 10, compare); compare_exchange(first, 6, 9, compare); compare_exchange(first, 7, 8, compare);
+        compare_exchange(first, 1, 3, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 4, 7, compare); compare_exchange(first, 8, 10, compare);
+        compare_exchange(first, 0, 4, compare); compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 7, compare); compare_exchange(first, 5, 9, compare); compare_exchange(first, 6, 8, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 8, 9, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 8, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<12>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 8, compare); compare_exchange(first, 1, 7, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 3, 11, compare); compare_exchange(first, 4, 10, compare); compare_exchange(first, 5, 9, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 6, 9, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 10, 11, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 6, compare); compare_exchange(first, 5, 10, compare); compare_exchange(first, 9, 11, compare);
+        compare_exchange(first, 0, 3, compare); compare_exchange(first, 1, 2, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 8, 11, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 6, 8, compare); compare_exchange(first, 7, 10, compare);
+        compare_exchange(first, 1, 3, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 6, 9, compare); compare_exchange(first, 8, 10, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare);
+        compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 7, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 8, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<13>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 12, compare); compare_exchange(first, 1, 10, compare); compare_exchange(first, 2, 9, compare); compare_exchange(first, 3, 7, compare); compare_exchange(first, 5, 11, compare); compare_exchange(first, 6, 8, compare);
+        compare_exchange(first, 1, 6, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 11, compare); compare_exchange(first, 7, 9, compare); compare_exchange(first, 8, 10, compare);
+        compare_exchange(first, 0, 4, compare); compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 9, 10, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 9, compare); compare_exchange(first, 8, 11, compare); compare_exchange(first, 10, 12, compare);
+        compare_exchange(first, 0, 5, compare); compare_exchange(first, 3, 8, compare); compare_exchange(first, 4, 7, compare); compare_exchange(first, 6, 11, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 5, compare); compare_exchange(first, 6, 9, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 10, 11, compare);
+        compare_exchange(first, 1, 3, compare); compare_exchange(first, 2, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 6, 8, compare);
+        compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<14>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare); compare_exchange(first, 10, 11, compare); compare_exchange(first, 12, 13, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 4, 8, compare); compare_exchange(first, 5, 9, compare); compare_exchange(first, 10, 12, compare); compare_exchange(first, 11, 13, compare);
+        compare_exchange(first, 0, 4, compare); compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 7, compare); compare_exchange(first, 5, 8, compare); compare_exchange(first, 6, 10, compare); compare_exchange(first, 9, 13, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 0, 6, compare); compare_exchange(first, 1, 5, compare); compare_exchange(first, 3, 9, compare); compare_exchange(first, 4, 10, compare); compare_exchange(first, 7, 13, compare); compare_exchange(first, 8, 12, compare);
+        compare_exchange(first, 2, 10, compare); compare_exchange(first, 3, 11, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 7, 9, compare);
+        compare_exchange(first, 1, 3, compare); compare_exchange(first, 2, 8, compare); compare_exchange(first, 5, 11, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 10, 12, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 3, 5, compare); compare_exchange(first, 7, 11, compare); compare_exchange(first, 8, 10, compare); compare_exchange(first, 9, 12, compare);
+        compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 5, 8, compare); compare_exchange(first, 7, 10, compare); compare_exchange(first, 9, 11, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 6, 7, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<15>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 13, compare); compare_exchange(first, 1, 12, compare); compare_exchange(first, 3, 14, compare); compare_exchange(first, 4, 8, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 11, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 0, 5, compare); compare_exchange(first, 1, 7, compare); compare_exchange(first, 2, 9, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 6, 13, compare); compare_exchange(first, 8, 14, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 8, compare); compare_exchange(first, 7, 9, compare); compare_exchange(first, 10, 11, compare); compare_exchange(first, 12, 13, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 4, 10, compare); compare_exchange(first, 5, 11, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare); compare_exchange(first, 12, 14, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 12, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 8, 10, compare); compare_exchange(first, 9, 11, compare); compare_exchange(first, 13, 14, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 5, 8, compare); compare_exchange(first, 7, 10, compare); compare_exchange(first, 9, 13, compare); compare_exchange(first, 11, 14, compare);
+        compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 9, 12, compare); compare_exchange(first, 11, 13, compare);
+        compare_exchange(first, 3, 5, compare); compare_exchange(first, 6, 8, compare); compare_exchange(first, 7, 9, compare); compare_exchange(first, 10, 12, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 9, 10, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare);
+      }
+    };
+
+    template <>
+    struct sorting_network<16>
+    {
+      template <typename TIterator, typename TCompare>
+      static void sort(TIterator first, TCompare compare)
+      {
+        compare_exchange(first, 0, 13, compare); compare_exchange(first, 1, 12, compare); compare_exchange(first, 2, 15, compare); compare_exchange(first, 3, 14, compare); compare_exchange(first, 4, 8, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 11, compare); compare_exchange(first, 9, 10, compare);
+        compare_exchange(first, 0, 5, compare); compare_exchange(first, 1, 7, compare); compare_exchange(first, 2, 9, compare); compare_exchange(first, 3, 4, compare); compare_exchange(first, 6, 13, compare); compare_exchange(first, 8, 14, compare); compare_exchange(first, 10, 15, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 0, 1, compare); compare_exchange(first, 2, 3, compare); compare_exchange(first, 4, 5, compare); compare_exchange(first, 6, 8, compare); compare_exchange(first, 7, 9, compare); compare_exchange(first, 10, 11, compare); compare_exchange(first, 12, 13, compare); compare_exchange(first, 14, 15, compare);
+        compare_exchange(first, 0, 2, compare); compare_exchange(first, 1, 3, compare); compare_exchange(first, 4, 10, compare); compare_exchange(first, 5, 11, compare); compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare); compare_exchange(first, 12, 14, compare); compare_exchange(first, 13, 15, compare);
+        compare_exchange(first, 1, 2, compare); compare_exchange(first, 3, 12, compare); compare_exchange(first, 4, 6, compare); compare_exchange(first, 5, 7, compare); compare_exchange(first, 8, 10, compare); compare_exchange(first, 9, 11, compare); compare_exchange(first, 13, 14, compare);
+        compare_exchange(first, 1, 4, compare); compare_exchange(first, 2, 6, compare); compare_exchange(first, 5, 8, compare); compare_exchange(first, 7, 10, compare); compare_exchange(first, 9, 13, compare); compare_exchange(first, 11, 14, compare);
+        compare_exchange(first, 2, 4, compare); compare_exchange(first, 3, 6, compare); compare_exchange(first, 9, 12, compare); compare_exchange(first, 11, 13, compare);
+        compare_exchange(first, 3, 5, compare); compare_exchange(first, 6, 8, compare); compare_exchange(first, 7, 9, compare); compare_exchange(first, 10, 12, compare);
+        compare_exchange(first, 3, 4, compare); compare_exchange(first, 5, 6, compare); compare_exchange(first, 7, 8, compare); compare_exchange(first, 9, 10, compare); compare_exchange(first, 11, 12, compare);
+        compare_exchange(first, 6, 7, compare); compare_exchange(first, 8, 9, compare);
+      }
+    };
+
+    //*************************************************************************
+    /// Sorts up to 16 elements with the network for the size.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void network_sort(TIterator first, size_t n, TCompare compare)
+    {
+      switch (n)
+      {
+        case 2: sorting_network<2>::sort(first, compare); break;
+        case 3: sorting_network<3>::sort(first, compare); break;
+        case 4: sorting_network<4>::sort(first, compare); break;
+        case 5: sorting_network<5>::sort(first, compare); break;
+        case 6: sorting_network<6>::sort(first, compare); break;
+        case 7: sorting_network<7>::sort(first, compare); break;
+        case 8: sorting_network<8>::sort(first, compare); break;
+        case 9: sorting_network<9>::sort(first, compare); break;
+        case 10: sorting_network<10>::sort(first, compare); break;
+        case 11: sorting_network<11>::sort(first, compare); break;
+        case 12: sorting_network<12>::sort(first, compare); break;
+        case 13: sorting_network<13>::sort(first, compare); break;
+        case 14: sorting_network<14>::sort(first, compare); break;
+        case 15: sorting_network<15>::sort(first, compare); break;
+        case 16: sorting_network<16>::sort(first, compare); break;
+        default: break;
+      }
+    }
+  }
+
+  namespace private_sort
+  {
+    // Ranges up to this size are finished with an insertion sort, or a
+    // sorting network for intro_sort. No more than 16.
+    static ETL_CONST_OR_CONSTEXPR ptrdiff_t INSERTION_SORT_THRESHOLD = 16;
+
+    //*************************************************************************
+    /// Stable insertion sort for random access iterators.
+    /// Shifts the larger elements up rather than swapping.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void linear_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        value_t   value = *itr;
+        TIterator hole  = itr;
+
+        while ((hole != first) && compare(value, *(hole - 1)))
+        {
+          *hole = *(hole - 1);
+          --hole;
+        }
+
+        *hole = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the median of a, b and c to 'result'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void move_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          etl::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          etl::iter_swap(result, c);
+        }
+        else
+        {
+          etl::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        etl::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        etl::iter_swap(result, c);
+      }
+      else
+      {
+        etl::iter_swap(result, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot.
+    /// The median of three selection guarantees that the scans stop within
+    /// the range, so they have no bounds checks.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator unguarded_partition(TIterator first, TIterator last, TIterator pivot, TCompare compare)
+    {
+      while (true)
+      {
+        while (compare(*first, *pivot))
+        {
+          ++first;
+        }
+
+        --last;
+
+        while (compare(*pivot, *last))
+        {
+          --last;
+        }
+
+        if (!(first < last))
+        {
+          return first;
+        }
+
+        etl::iter_swap(first, last);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Quick sorts down to the insertion sort threshold, and finishes each
+    /// partition with a sorting network.
+    /// Switches to heap sort when the depth limit is reached.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, TDistance depth_limit, TCompare compare)
+    {
+      while ((last - first) > INSERTION_SORT_THRESHOLD)
+      {
+        if (depth_limit == 0)
+        {
+          etl::make_heap(first, last, compare);
+          etl::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator middle = first + ((last - first) / 2);
+        private_sort::move_median_to_first(first, first + 1, middle, last - 1, compare);
+
+        TIterator cut = private_sort::unguarded_partition(first + 1, last, first, compare);
+
+        private_sort::intro_sort_loop(cut, last, depth_limit, compare);
+        last = cut;
+      }
+
+      private_sort::network_sort(first, size_t(last - first), compare);
+    }
+
+    //*************************************************************************
+    /// Merge sorts [first, last) using 'buffer' to hold the left half.
+    //*************************************************************************
+    template <typename TIterator, typename TBuffer, typename TCompare>
+    void merge_sort_range(TIterator first, TIterator last, TBuffer buffer, TCompare compare)
+    {
+      if ((last - first) <= INSERTION_SORT_THRESHOLD)
+      {
+        private_sort::linear_insertion_sort(first, last, compare);
+        return;
+      }
+
+      TIterator middle = first + ((last - first) / 2);
+
+      private_sort::merge_sort_range(first, middle, buffer, compare);
+      private_sort::merge_sort_range(middle, last, buffer, compare);
+
+      // Already in order?
+      if (!compare(*middle, *(middle - 1)))
+      {
+        return;
+      }
+
+      TBuffer buffer_end = etl::copy(first, middle, buffer);
+      TBuffer left       = buffer;
+      TIterator right    = middle;
+      TIterator output   = first;
+
+      // Ties take the left element, to keep the sort stable.
+      while ((left != buffer_end) && (right != last))
+      {
+        if (compare(*right, *left))
+        {
+          *output++ = *right++;
+        }
+        else
+        {
+          *output++ = *left++;
+        }
+      }
+
+      etl::copy(left, buffer_end, output);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  /// Quick sort with a median of three pivot, switching to heap sort if the
+  /// recursion gets too deep, and finishing small ranges with sorting networks.
+  /// O(N log N) in the worst case. Not stable.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t depth_limit = 0;
+
+    for (difference_t n = last - first; n > 1; n /= 2)
+    {
+      depth_limit += 2;
+    }
+
+    private_sort::intro_sort_loop(first, last, depth_limit, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts N elements with a sorting network chosen at compile time.
+  /// The fewest comparators known for each size, with no loops, and
+  /// arithmetic and pointer types are exchanged without branches.
+  /// Not stable. N may be up to 16.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  void static_sort(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(N <= 16U, "static_sort supports up to 16 elements");
+
+    private_sort::sorting_network<N>::sort(first, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts N elements with a sorting network chosen at compile time.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  void static_sort(TIterator first)
+  {
+    etl::static_sort<N>(first, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts an array with a sorting network chosen at compile time.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T, size_t N, typename TCompare>
+  void static_sort(T (&data)[N], TCompare compare)
+  {
+    etl::static_sort<N>(data, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts an array with a sorting network chosen at compile time.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T, size_t N>
+  void static_sort(T (&data)[N])
+  {
+    etl::static_sort<N>(data, etl::less<T>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// O(N log N) in the worst case. Stable.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\param buffer Scratch space for at least (last - first) / 2 elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBuffer buffer, TCompare compare)
+  {
+    private_sort::merge_sort_range(first, last, buffer, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  ///\param buffer Scratch space for at least (last - first) / 2 elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer>
+  void merge_sort(TIterator first, TIterator last, TBuffer buffer)
+  {
+    etl::merge_sort(first, last, buffer, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// The default key, which is the value itself.
+    //*************************************************************************
+    template <typename T>
+    struct identity_key
+    {
+      typedef T result_type;
+
+      result_type operator ()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The type of key returned by the key function.
+    /// C++03 key functions must define 'result_type'.
+    //*************************************************************************
+#if ETL_CPP11_SUPPORTED
+    template <typename TKeyFunction, typename TValue>
+    struct key_type
+    {
+      typedef typename etl::decay<decltype(etl::declval<TKeyFunction>()(etl::declval<const TValue&>()))>::type type;
+    };
+#else
+    template <typename TKeyFunction, typename TValue>
+    struct key_type
+    {
+      typedef typename TKeyFunction::result_type type;
+    };
+#endif
+
+    //*************************************************************************
+    /// Extracts an 8 bit digit from a key.
+    /// Signed keys have the sign bit flipped so that negative values sort first.
+    //*************************************************************************
+    template <typename TKey>
+    size_t digit(TKey key, size_t shift)
+    {
+      typedef typename etl::make_unsigned<TKey>::type ukey_t;
+
+      const ukey_t SIGN_FLIP = etl::is_signed<TKey>::value ? ukey_t(ukey_t(1U) << ((sizeof(TKey) * CHAR_BIT) - 1U)) : ukey_t(0U);
+
+      return size_t((ukey_t(key) ^ SIGN_FLIP) >> shift) & 0xFFU;
+    }
+
+    //*************************************************************************
+    /// Distributes [first, last) into 'destination' by the digit at 'shift'.
+    /// Returns false, without moving anything, if every element has the same
+    /// digit, as the pass would not change the order.
+    //*************************************************************************
+    template <typename TKey, typename TSource, typename TDestination, typename TKeyFunction>
+    bool pass(TSource first, TSource last, TDestination destination, TKeyFunction key_fn, size_t shift)
+    {
+      size_t counts[256] = { 0 };
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[digit<TKey>(key_fn(*itr), shift)];
+      }
+
+      if (counts[digit<TKey>(key_fn(*first), shift)] == size_t(last - first))
+      {
+        return false;
+      }
+
+      // Convert the counts to the start offsets of each bucket.
+      size_t offset = 0U;
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        const size_t count = counts[i];
+        counts[i] = offset;
+        offset += count;
+      }
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        destination[counts[digit<TKey>(key_fn(*itr), shift)]++] = *itr;
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements by an integral key using an LSD radix sort.
+  /// Processes 8 bits of the key per pass, and skips passes where every key
+  /// has the same digit. O(N * sizeof(key)). Stable.
+  /// Requires random access iterators.
+  ///\param scratch Scratch space for at least (last - first) elements.
+  ///\param key_fn  Returns the integral key for an element.
+  ///               For C++03 it must define 'result_type'.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer, typename TKeyFunction>
+  void radix_sort(TIterator first, TIterator last, TBuffer scratch, TKeyFunction key_fn)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type              value_t;
+    typedef typename private_radix_sort::key_type<TKeyFunction, value_t>::type key_t;
+
+    ETL_STATIC_ASSERT(etl::is_integral<key_t>::value, "Radix sort keys must be integral");
+
+    const size_t length = size_t(last - first);
+
+    if (length < 2U)
+    {
+      return;
+    }
+
+    bool in_scratch = false;
+
+    for (size_t shift = 0U; shift < (sizeof(key_t) * CHAR_BIT); shift += 8U)
+    {
+      bool moved;
+
+      if (in_scratch)
+      {
+        moved = private_radix_sort::pass<key_t>(scratch, scratch + length, first, key_fn, shift);
+      }
+      else
+      {
+        moved = private_radix_sort::pass<key_t>(first, last, scratch, key_fn, shift);
+      }
+
+      if (moved)
+      {
+        in_scratch = !in_scratch;
+      }
+    }
+
+    if (in_scratch)
+    {
+      etl::copy(scratch, scratch + length, first);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral elements using an LSD radix sort.
+  ///\param scratch Scratch space for at least (last - first) elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer>
+  void radix_sort(TIterator first, TIterator last, TBuffer scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    etl::radix_sort(first, last, scratch, private_radix_sort::identity_key<value_t>());
+  }
+
+  namespace private_merge_k
+  {
+    //*************************************************************************
+    /// A loser tree over K sorted ranges.
+    /// The leaves are the heads of the ranges. Each internal node holds the
+    /// loser of the match played there and node 0 holds the overall winner,
+    /// so replacing the winner replays only the matches on its path to the
+    /// root; ceil(log2(K)) comparisons per element.
+    /// Exhausted ranges lose every match. Equal elements are taken from the
+    /// lower numbered range first, so the merge is stable.
+    //*************************************************************************
+    template <size_t K, typename TIterator, typename TCompare>
+    class loser_tree
+    {
+    public:
+
+      ETL_STATIC_ASSERT(K != 0U, "At least one range is required");
+
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      //*******************************
+      template <typename TRange>
+      loser_tree(const TRange (&ranges)[K], TCompare compare_)
+        : compare(compare_)
+      {
+        for (size_t i = 0U; i < K; ++i)
+        {
+          current[i] = ranges[i].begin();
+          last[i]    = ranges[i].end();
+        }
+
+        // Play the initial matches, bottom up.
+        // Nodes 1 to K - 1 are internal. Leaf K + i is range i.
+        size_t winner[K];
+
+        for (size_t node = K - 1U; node > 0U; --node)
+        {
+          const size_t left  = ((2U * node) >= K)      ? (2U * node) - K      : winner[2U * node];
+          const size_t right = ((2U * node + 1U) >= K) ? (2U * node + 1U) - K : winner[2U * node + 1U];
+
+          if (beats(right, left))
+          {
+            winner[node] = right;
+            tree[node]   = left;
+          }
+          else
+          {
+            winner[node] = left;
+            tree[node]   = right;
+          }
+        }
+
+        tree[0] = (K == 1U) ? 0U : winner[1];
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return current[tree[0]] == last[tree[0]];
+      }
+
+      //*******************************
+      const value_type& top() const
+      {
+        return *current[tree[0]];
+      }
+
+      //*******************************
+      void pop()
+      {
+        size_t winner = tree[0];
+
+        ++current[winner];
+
+        for (size_t node = (winner + K) / 2U; node > 0U; node /= 2U)
+        {
+          if (beats(tree[node], winner))
+          {
+            const size_t loser = winner;
+            winner     = tree[node];
+            tree[node] = loser;
+          }
+        }
+
+        tree[0] = winner;
+      }
+
+    private:
+
+      //*******************************
+      /// Does the head of range a come before the head of range b?
+      //*******************************
+      bool beats(size_t a, size_t b) const
+      {
+        if (current[a] == last[a])
+        {
+          return false;
+        }
+
+        if (current[b] == last[b])
+        {
+          return true;
+        }
+
+        // Ties go to the lower numbered range.
+        return (a < b) ? !compare(*current[b], *current[a]) : compare(*current[a], *current[b]);
+      }
+
+      TCompare  compare;
+      TIterator current[K];
+      TIterator last[K];
+      size_t    tree[K];
+    };
+  }
+
+  //***************************************************************************
+  /// Merges K sorted ranges into one sorted output range, using a loser tree.
+  /// The ranges may be any type with begin() and end(), such as
+  /// etl::array_view. The merge is stable, with equal elements taken from
+  /// the lower numbered range first.
+  /// Stops when the output range is full.
+  /// Returns an iterator to the end of the merged output.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t K, typename TRange, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge_k(const TRange (&ranges)[K],
+                          TOutputIterator o_begin,
+                          TOutputIterator o_end,
+                          TCompare        compare)
+  {
+    typedef typename TRange::const_iterator iterator_t;
+
+    private_merge_k::loser_tree<K, iterator_t, TCompare> tree(ranges, compare);
+
+    while ((o_begin != o_end) && !tree.empty())
+    {
+      *o_begin++ = tree.top();
+      tree.pop();
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Merges K sorted ranges into one sorted output range, using a loser tree.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t K, typename TRange, typename TOutputIterator>
+  TOutputIterator merge_k(const TRange (&ranges)[K],
+                          TOutputIterator o_begin,
+                          TOutputIterator o_end)
+  {
+    typedef typename etl::iterator_traits<typename TRange::const_iterator>::value_type value_t;
+
+    return etl::merge_k(ranges, o_begin, o_end, etl::less<value_t>());
+  }
+
+  //***************************************************************************
+  /// Merges K sorted ranges, appending to a vector, using a loser tree.
+  /// Returns false if the vector became full before all of the elements were
+  /// merged.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t K, typename TRange, typename T, typename TCompare>
+  bool merge_k(const TRange (&ranges)[K], etl::ivector<T>& output, TCompare compare)
+  {
+    typedef typename TRange::const_iterator iterator_t;
+
+    private_merge_k::loser_tree<K, iterator_t, TCompare> tree(ranges, compare);
+
+    while (!tree.empty())
+    {
+      if (output.full())
+      {
+        return false;
+      }
+
+      output.push_back(tree.top());
+      tree.pop();
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Merges K sorted ranges, appending to a vector, using a loser tree.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t K, typename TRange, typename T>
+  bool merge_k(const TRange (&ranges)[K], etl::ivector<T>& output)
+  {
+    typedef typename etl::iterator_traits<typename TRange::const_iterator>::value_type value_t;
+
+    return etl::merge_k(ranges, output, etl::less<value_t>());
+  }
+
+  namespace private_sort
+  {
+    //*************************************************************************
+    /// Compares indices by the elements that they refer to.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct index_compare
+    {
+      index_compare(TIterator first_, TCompare compare_)
+        : first(first_),
+          compare(compare_)
+      {
+      }
+
+      template <typename TIndex>
+      bool operator ()(TIndex lhs, TIndex rhs) const
+      {
+        return compare(first[lhs], first[rhs]);
+      }
+
+      TIterator first;
+      TCompare  compare;
+    };
+
+    //*************************************************************************
+    /// Compares indices by the elements that they refer to, and equal
+    /// elements by index, so that an unstable sort gives a stable order.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct stable_index_compare
+    {
+      stable_index_compare(TIterator first_, TCompare compare_)
+        : first(first_),
+          compare(compare_)
+      {
+      }
+
+      template <typename TIndex>
+      bool operator ()(TIndex lhs, TIndex rhs) const
+      {
+        if (compare(first[lhs], first[rhs]))
+        {
+          return true;
+        }
+
+        return !compare(first[rhs], first[lhs]) && (lhs < rhs);
+      }
+
+      TIterator first;
+      TCompare  compare;
+    };
+
+    //*************************************************************************
+    /// Fills the indices with 0 to (last - first - 1).
+    /// Returns the end of the indices.
+    //*************************************************************************
+    template <typename TIterator, typename TIndexIterator>
+    TIndexIterator fill_indices(TIterator first, TIterator last, TIndexIterator index_first)
+    {
+      typedef typename etl::iterator_traits<TIndexIterator>::value_type index_t;
+
+      const size_t n = size_t(etl::distance(first, last));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        index_first[i] = index_t(i);
+      }
+
+      return index_first + n;
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts indices to the elements, rather than the elements themselves.
+  /// On return index_first[i] is the position of the element that sorts to
+  /// position i. The elements are not moved; use etl::apply_permutation to
+  /// move each of them once, which is cheaper than sorting large elements.
+  /// The index type must be able to hold (last - first - 1), so uint16_t
+  /// indices will do for up to 65536 elements.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\param index_first The start of room for (last - first) indices.
+  ///\return The end of the indices.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TIndexIterator, typename TCompare>
+  TIndexIterator sort_indices(TIterator first, TIterator last, TIndexIterator index_first, TCompare compare)
+  {
+    TIndexIterator index_last = private_sort::fill_indices(first, last, index_first);
+
+    etl::sort(index_first, index_last, private_sort::index_compare<TIterator, TCompare>(first, compare));
+
+    return index_last;
+  }
+
+  //***************************************************************************
+  /// Sorts indices to the elements, rather than the elements themselves.
+  ///\param index_first The start of room for (last - first) indices.
+  ///\return The end of the indices.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TIndexIterator>
+  TIndexIterator sort_indices(TIterator first, TIterator last, TIndexIterator index_first)
+  {
+    return etl::sort_indices(first, last, index_first, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts indices to the elements, rather than the elements themselves.
+  /// Stable. Equal elements are ordered by index, so this is as fast as
+  /// etl::sort_indices and needs no scratch space.
+  /// Uses user defined comparison.
+  ///\param index_first The start of room for (last - first) indices.
+  ///\return The end of the indices.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TIndexIterator, typename TCompare>
+  TIndexIterator stable_sort_indices(TIterator first, TIterator last, TIndexIterator index_first, TCompare compare)
+  {
+    TIndexIterator index_last = private_sort::fill_indices(first, last, index_first);
+
+    etl::sort(index_first, index_last, private_sort::stable_index_compare<TIterator, TCompare>(first, compare));
+
+    return index_last;
+  }
+
+  //***************************************************************************
+  /// Sorts indices to the elements, rather than the elements themselves.
+  /// Stable.
+  ///\param index_first The start of room for (last - first) indices.
+  ///\return The end of the indices.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TIndexIterator>
+  TIndexIterator stable_sort_indices(TIterator first, TIterator last, TIndexIterator index_first)
+  {
+    return etl::stable_sort_indices(first, last, index_first, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Reorders the elements so that element i becomes the one that was at
+  /// index_first[i], as given by etl::sort_indices.
+  /// Follows each cycle of the permutation in place, so each element is moved
+  /// once, plus one temporary per cycle.
+  /// The indices are used to mark the elements that are in place, and are
+  /// left as 0 to (last - first - 1).
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TIndexIterator>
+  void apply_permutation(TIterator first, TIterator last, TIndexIterator index_first)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TIndexIterator>::value_type index_t;
+
+    const size_t n = size_t(etl::distance(first, last));
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      if (size_t(index_first[i]) != i)
+      {
+#if ETL_CPP11_SUPPORTED
+        value_t temp(etl::move(first[i]));
+#else
+        value_t temp(first[i]);
+#endif
+        size_t current = i;
+        size_t next    = size_t(index_first[i]);
+
+        while (next != i)
+        {
+#if ETL_CPP11_SUPPORTED
+          first[current] = etl::move(first[next]);
+#else
+          first[current] = first[next];
+#endif
+          index_first[current] = index_t(current);
+          current = next;
+          next    = size_t(index_first[current]);
+        }
+
+#if ETL_CPP11_SUPPORTED
+        first[current] = etl::move(temp);
+#else
+        first[current] = temp;
+#endif
+        index_first[current] = index_t(current);
+      }
+    }
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
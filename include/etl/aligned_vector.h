@@ -0,0 +1,275 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALIGNED_VECTOR_INCLUDED
+#define ETL_ALIGNED_VECTOR_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "vector.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "power.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+///\defgroup aligned_vector aligned_vector
+/// A fixed capacity vector whose data() is aligned to a chosen boundary and whose
+/// buffer is padded to a whole number of ALIGNMENT sized blocks.
+/// Intended for SIMD kernels that load a full vector width at a time.
+/// Alignments larger than the largest fundamental type require C++11.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A vector implementation that uses a fixed size, over aligned buffer.
+  /// The buffer is rounded up to a whole number of ALIGNMENT byte blocks, so a
+  /// kernel may process padded_size() elements without a scalar tail loop.
+  /// Elements in [size(), padded_size()) are not constructed unless
+  /// fill_padding() has been called.
+  ///\tparam T          The element type. sizeof(T) must divide ALIGNMENT.
+  ///\tparam MAX_SIZE_  The maximum number of elements that can be stored.
+  ///\tparam ALIGNMENT_ The alignment of data(), in bytes. Must be a power of 2.
+  ///\ingroup aligned_vector
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t ALIGNMENT_>
+  class aligned_vector : public etl::ivector<T>
+  {
+  public:
+
+    static const size_t MAX_SIZE  = MAX_SIZE_;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+
+    /// The number of elements in one ALIGNMENT sized block.
+    static const size_t BLOCK_SIZE = ALIGNMENT / sizeof(T);
+
+    /// The number of element slots in the buffer, including padding.
+    static const size_t PADDED_SIZE = ((MAX_SIZE + BLOCK_SIZE - 1) / BLOCK_SIZE) * BLOCK_SIZE;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<ALIGNMENT>::value, "Alignment must be a power of 2");
+    ETL_STATIC_ASSERT((ALIGNMENT % etl::alignment_of<T>::value) == 0, "Alignment must be a multiple of the alignment of T");
+    ETL_STATIC_ASSERT((ALIGNMENT % sizeof(T)) == 0, "The size of T must divide the alignment");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    aligned_vector()
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with size.
+    ///\param initial_size The initial size of the vector.
+    //*************************************************************************
+    explicit aligned_vector(size_t initial_size)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->initialise();
+      this->resize(initial_size);
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param initial_size  The initial size of the vector.
+    ///\param value        The value to fill the vector with.
+    //*************************************************************************
+    aligned_vector(size_t initial_size, typename etl::ivector<T>::parameter_t value)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->initialise();
+      this->resize(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    aligned_vector(TIterator first, TIterator last)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    aligned_vector(std::initializer_list<T> init)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    aligned_vector(const aligned_vector& other)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    aligned_vector& operator = (const aligned_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    aligned_vector(aligned_vector&& other)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      if (this != &other)
+      {
+        this->initialise();
+
+        typename etl::ivector<T>::iterator itr = other.begin();
+        while (itr != other.end())
+        {
+          this->push_back(etl::move(*itr));
+          ++itr;
+        }
+
+        other.initialise();
+      }
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    aligned_vector& operator = (aligned_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        typename etl::ivector<T>::iterator itr = rhs.begin();
+        while (itr != rhs.end())
+        {
+          this->push_back(etl::move(*itr));
+          ++itr;
+        }
+
+        rhs.initialise();
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~aligned_vector()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Returns the size rounded up to a whole number of blocks.
+    /// Never exceeds PADDED_SIZE.
+    //*************************************************************************
+    size_t padded_size() const
+    {
+      return ((this->size() + BLOCK_SIZE - 1) / BLOCK_SIZE) * BLOCK_SIZE;
+    }
+
+    //*************************************************************************
+    /// Writes 'value' to the padding slots in [size(), padded_size()), so that
+    /// a kernel reading whole blocks sees defined values in the tail.
+    /// The slots are not counted as elements and are not destroyed.
+    //*************************************************************************
+    void fill_padding(typename etl::ivector<T>::parameter_t value)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_destructible<T>::value, "fill_padding requires a trivially destructible type");
+
+      T* p_end     = reinterpret_cast<T*>(&buffer) + this->size();
+      T* p_padding = reinterpret_cast<T*>(&buffer) + padded_size();
+
+      while (p_end != p_padding)
+      {
+        ::new (p_end++) T(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    //*************************************************************************
+#ifdef ETL_IVECTOR_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      #if ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
+      ETL_ASSERT(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::vector_incompatible_type));
+      #endif
+
+      etl::ivector<T>::repair_buffer(reinterpret_cast<T*>(&buffer));
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(T) * PADDED_SIZE, ALIGNMENT>::type buffer;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ALIGNMENT_>
+  const size_t aligned_vector<T, MAX_SIZE_, ALIGNMENT_>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ALIGNMENT_>
+  const size_t aligned_vector<T, MAX_SIZE_, ALIGNMENT_>::ALIGNMENT;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ALIGNMENT_>
+  const size_t aligned_vector<T, MAX_SIZE_, ALIGNMENT_>::BLOCK_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ALIGNMENT_>
+  const size_t aligned_vector<T, MAX_SIZE_, ALIGNMENT_>::PADDED_SIZE;
+}
+
+#endif
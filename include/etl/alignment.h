@@ -192,6 +192,50 @@ namespace etl
     };
   };
 
+  //***************************************************************************
+  /// Storage for N objects of type T that are constructed and destroyed by
+  /// the owner.
+  /// From C++11 the address of the storage as a T*, given by get(), is a
+  /// constant expression, so that a container that points to its own storage
+  /// may have a constexpr constructor and be constant initialised.
+  ///\ingroup alignment
+  //***************************************************************************
+#if ETL_CPP11_SUPPORTED
+  template <typename T, const size_t N>
+  union uninitialized_buffer_of
+  {
+    constexpr uninitialized_buffer_of()
+      : unused()
+    {
+    }
+
+    ~uninitialized_buffer_of()
+    {
+    }
+
+    /// Gets the address of the first object.
+    static constexpr T* get(uninitialized_buffer_of& buffer)
+    {
+      return buffer.values;
+    }
+
+    char unused;
+    T    values[N];
+  };
+#else
+  template <typename T, const size_t N>
+  struct uninitialized_buffer_of
+  {
+    /// Gets the address of the first object.
+    static T* get(uninitialized_buffer_of& buffer)
+    {
+      return reinterpret_cast<T*>(&buffer.storage);
+    }
+
+    typename etl::aligned_storage<sizeof(T) * N, etl::alignment_of<T>::value>::type storage;
+  };
+#endif
+
   //***************************************************************************
   /// Aligned storage as
   ///\ingroup alignment
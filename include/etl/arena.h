@@ -0,0 +1,492 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARENA_INCLUDED
+#define ETL_ARENA_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+#include "pool.h"
+#include "alignment.h"
+#include "largest.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "nullptr.h"
+#include "utility.h"
+
+#undef ETL_FILE
+#define ETL_FILE "60"
+
+//*****************************************************************************
+///\defgroup arena arena
+/// A fixed capacity monotonic (bump) allocator.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for arena exceptions.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_exception : public exception
+  {
+  public:
+
+    arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the arena does not have enough free space.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_no_allocation : public arena_exception
+  {
+  public:
+
+    arena_no_allocation(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:allocation", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the arena is rewound to a mark beyond the
+  /// current allocation.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_invalid_mark : public arena_exception
+  {
+  public:
+
+    arena_invalid_mark(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:mark", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base of all arenas.
+  /// Allocation moves a pointer forward through the buffer. Nothing is freed
+  /// individually; the arena is rewound to an earlier mark or reset as a whole.
+  /// Destructors are not called by the arena. Objects that need them must be
+  /// destroyed by the user before the arena is rewound past them.
+  ///\ingroup arena
+  //***************************************************************************
+  class iarena
+  {
+  public:
+
+    typedef size_t size_type;
+    typedef size_t marker_type;
+
+    /// The alignment used when none is specified.
+    static const size_t DEFAULT_ALIGNMENT = etl::largest_alignment<int64_t, double, void*>::value;
+
+    //*************************************************************************
+    /// Allocate raw storage.
+    /// If asserts or exceptions are enabled and there is not enough free space an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    ///\param n         The number of bytes.
+    ///\param alignment The alignment of the storage. Must be a power of two.
+    //*************************************************************************
+    void* allocate(size_t n, size_t alignment = DEFAULT_ALIGNMENT)
+    {
+      const uintptr_t base    = reinterpret_cast<uintptr_t>(p_buffer);
+      const uintptr_t current = base + used;
+      const uintptr_t aligned = (current + (alignment - 1U)) & ~uintptr_t(alignment - 1U);
+      const size_t    start   = size_t(aligned - base);
+
+      if ((start > buffer_size) || (n > (buffer_size - start)))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::arena_no_allocation));
+        return nullptr;
+      }
+
+      used = start + n;
+
+      return p_buffer + start;
+    }
+
+    //*************************************************************************
+    /// Allocate uninitialised storage for n objects of type T.
+    /// If asserts or exceptions are enabled and there is not enough free space an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    /// The storage may be given to an external buffer container.
+    ///\code
+    /// etl::vector<int, 0> scratch(arena.allocate<int>(16), 16);
+    ///\endcode
+    //*************************************************************************
+    template <typename T>
+    T* allocate(size_t n = 1U)
+    {
+      return static_cast<T*>(allocate(n * sizeof(T), etl::alignment_of<T>::value));
+    }
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate storage for an object and create with default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 2 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 3 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 4 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object and create with variadic parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a mark for the current allocation position.
+    //*************************************************************************
+    marker_type mark() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Frees everything allocated since the mark was taken.
+    /// If asserts or exceptions are enabled and the mark is beyond the current
+    /// position then an etl::arena_invalid_mark is thrown.
+    //*************************************************************************
+    void rewind(marker_type marker)
+    {
+      ETL_ASSERT(marker <= used, ETL_ERROR(etl::arena_invalid_mark));
+
+      if (marker <= used)
+      {
+        used = marker;
+      }
+    }
+
+    //*************************************************************************
+    /// Frees everything.
+    //*************************************************************************
+    void reset()
+    {
+      used = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of bytes allocated, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// The total number of bytes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The total number of bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The number of free bytes, before any alignment padding.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - used;
+    }
+
+    //*************************************************************************
+    /// Checks if nothing is allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return used == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the arena contains the address.
+    //*************************************************************************
+    bool is_in_arena(const void* p) const
+    {
+      const char* p_char = static_cast<const char*>(p);
+
+      return (p_char >= p_buffer) && (p_char < (p_buffer + buffer_size));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iarena(char* p_buffer_, size_t buffer_size_)
+      : p_buffer(p_buffer_),
+        buffer_size(buffer_size_),
+        used(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_ARENA) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iarena()
+    {
+    }
+#else
+  protected:
+    ~iarena()
+    {
+    }
+#endif
+
+  private:
+
+    // Disable copy construction and assignment.
+    iarena(const iarena&);
+    iarena& operator =(const iarena&);
+
+    char* const  p_buffer;    ///< The storage.
+    const size_t buffer_size; ///< The number of bytes of storage.
+    size_t       used;        ///< The number of bytes allocated.
+  };
+
+  //***************************************************************************
+  /// An arena of BYTES bytes.
+  ///\ingroup arena
+  //***************************************************************************
+  template <const size_t BYTES, const size_t ALIGNMENT_ = etl::iarena::DEFAULT_ALIGNMENT>
+  class arena : public etl::iarena
+  {
+  public:
+
+    ETL_STATIC_ASSERT((BYTES > 0U), "Zero size arena");
+
+    static const size_t SIZE      = BYTES;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    arena()
+      : etl::iarena(reinterpret_cast<char*>(&buffer), BYTES)
+    {
+    }
+
+  private:
+
+    typename etl::aligned_storage<BYTES, ALIGNMENT_>::type buffer;
+  };
+
+  //***************************************************************************
+  /// Rewinds an arena to its position at construction when it leaves scope.
+  ///\code
+  /// void handle_request(etl::iarena& scratch)
+  /// {
+  ///   etl::arena_scope scope(scratch);
+  ///   Parsed* p_parsed = scratch.create<Parsed>();
+  ///   ...
+  /// } // Everything allocated in the function is freed here.
+  ///\endcode
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_scope
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit arena_scope(etl::iarena& arena_)
+      : arena(arena_),
+        marker(arena_.mark())
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~arena_scope()
+    {
+      arena.rewind(marker);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    arena_scope(const arena_scope&);
+    arena_scope& operator =(const arena_scope&);
+
+    etl::iarena&                    arena;
+    const etl::iarena::marker_type  marker;
+  };
+
+  //***************************************************************************
+  /// A pool of T whose storage is drawn from an arena.
+  /// May be given to containers that take an etl::ipool, such as
+  /// etl::indirect_vector<T, 0>.
+  /// If asserts or exceptions are enabled and the arena does not have enough
+  /// free space an etl::arena_no_allocation is thrown.
+  /// The pool must not be used after the arena is rewound past its storage.
+  ///\ingroup arena
+  //***************************************************************************
+  template <typename T>
+  class arena_pool : public etl::ipool
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param arena_    The arena that supplies the storage.
+    ///\param max_size_ The number of items in the pool.
+    //*************************************************************************
+    arena_pool(etl::iarena& arena_, size_t max_size_)
+      : etl::ipool(static_cast<char*>(arena_.allocate(max_size_ * ELEMENT_SIZE, etl::alignment_of<Element>::value)), ELEMENT_SIZE, uint32_t(max_size_))
+    {
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char* next;              ///< Pointer to the next free element.
+      char  value[sizeof(T)];  ///< Storage for value type.
+      typename etl::type_with_alignment<etl::alignment_of<T>::value>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+
+    // Should not be copied.
+    arena_pool(const arena_pool&);
+    arena_pool& operator =(const arena_pool&);
+  };
+}
+
+#undef ETL_FILE
+
+#endif
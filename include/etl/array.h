@@ -118,7 +118,7 @@ namespace etl
     /// Returns a reference to the value at index 'i'.
     ///\param i The index of the element to access.
     //*************************************************************************
-    reference at(size_t i)
+    ETL_CONSTEXPR14 reference at(size_t i)
     {
       ETL_ASSERT(i < SIZE, ETL_ERROR(array_out_of_range));
 
@@ -129,7 +129,7 @@ namespace etl
     /// Returns a const reference to the value at index 'i'.
     ///\param i The index of the element to access.
     //*************************************************************************
-    const_reference at(size_t i) const
+    ETL_CONSTEXPR14 const_reference at(size_t i) const
     {
       ETL_ASSERT(i < SIZE, ETL_ERROR(array_out_of_range));
 
@@ -141,7 +141,7 @@ namespace etl
     /// Returns a reference to the value at index 'i'.
     ///\param i The index of the element to access.
     //*************************************************************************
-    reference operator[](size_t i)
+    ETL_CONSTEXPR14 reference operator[](size_t i)
     {
       return _buffer[i];
     }
@@ -151,7 +151,7 @@ namespace etl
     /// Returns a const reference to the value at index 'i'.
     ///\param i The index of the element to access.
     //*************************************************************************
-    const_reference operator[](size_t i) const
+    ETL_CONSTEXPR const_reference operator[](size_t i) const
     {
       return _buffer[i];
     }
@@ -159,7 +159,7 @@ namespace etl
     //*************************************************************************
     /// Returns a reference to the first element.
     //*************************************************************************
-    reference front()
+    ETL_CONSTEXPR14 reference front()
     {
       return _buffer[0];
     }
@@ -167,7 +167,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the first element.
     //*************************************************************************
-    const_reference front() const
+    ETL_CONSTEXPR const_reference front() const
     {
       return _buffer[0];
     }
@@ -175,7 +175,7 @@ namespace etl
     //*************************************************************************
     /// Returns a reference to the last element.
     //*************************************************************************
-    reference back()
+    ETL_CONSTEXPR14 reference back()
     {
       return _buffer[SIZE - 1];
     }
@@ -183,7 +183,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the last element.
     //*************************************************************************
-    const_reference back() const
+    ETL_CONSTEXPR const_reference back() const
     {
       return _buffer[SIZE - 1];
     }
@@ -191,7 +191,7 @@ namespace etl
     //*************************************************************************
     /// Returns a pointer to the first element of the internal buffer.
     //*************************************************************************
-    pointer data()
+    ETL_CONSTEXPR14 pointer data()
     {
       return &_buffer[0];
     }
@@ -199,7 +199,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const pointer to the first element of the internal buffer.
     //*************************************************************************
-    const_pointer data() const
+    ETL_CONSTEXPR const_pointer data() const
     {
       return &_buffer[0];
     }
@@ -211,7 +211,7 @@ namespace etl
     //*************************************************************************
     /// Returns an iterator to the beginning of the array.
     //*************************************************************************
-    iterator begin()
+    ETL_CONSTEXPR14 iterator begin()
     {
       return &_buffer[0];
     }
@@ -219,7 +219,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator begin() const
+    ETL_CONSTEXPR const_iterator begin() const
     {
       return &_buffer[0];
     }
@@ -227,7 +227,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator cbegin() const
+    ETL_CONSTEXPR const_iterator cbegin() const
     {
       return begin();
     }
@@ -235,25 +235,25 @@ namespace etl
     //*************************************************************************
     /// Returns an iterator to the end of the array.
     //*************************************************************************
-    iterator end()
+    ETL_CONSTEXPR14 iterator end()
     {
-      return &_buffer[SIZE];
+      return _buffer + SIZE;
     }
 
     //*************************************************************************
     /// Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator end() const
+    ETL_CONSTEXPR const_iterator end() const
     {
-      return &_buffer[SIZE];
+      return _buffer + SIZE;
     }
 
     //*************************************************************************
     // Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator cend() const
+    ETL_CONSTEXPR const_iterator cend() const
     {
-      return &_buffer[SIZE];
+      return _buffer + SIZE;
     }
 
     //*************************************************************************
@@ -311,7 +311,7 @@ namespace etl
     //*************************************************************************
     /// Returns <b>true</b> if the array size is zero.
     //*************************************************************************
-    bool empty() const
+    ETL_CONSTEXPR bool empty() const
     {
       return (SIZE == 0);
     }
@@ -319,7 +319,7 @@ namespace etl
     //*************************************************************************
     /// Returns the size of the array.
     //*************************************************************************
-    size_t size() const
+    ETL_CONSTEXPR size_t size() const
     {
       return SIZE;
     }
@@ -327,7 +327,7 @@ namespace etl
     //*************************************************************************
     /// Returns the maximum possible size of the array.
     //*************************************************************************
-    size_t max_size() const
+    ETL_CONSTEXPR size_t max_size() const
     {
       return SIZE;
     }
@@ -640,6 +640,28 @@ namespace etl
     return !(lhs < rhs);
   }
 
+  //*************************************************************************
+  /// Sorts the array with a sorting network chosen at compile time.
+  /// Uses user defined comparison.
+  ///\param a       The array.
+  ///\param compare The comparison.
+  //*************************************************************************
+  template <typename T, size_t SIZE, typename TCompare>
+  void static_sort(etl::array<T, SIZE>& a, TCompare compare)
+  {
+    etl::static_sort<SIZE>(a.begin(), compare);
+  }
+
+  //*************************************************************************
+  /// Sorts the array with a sorting network chosen at compile time.
+  ///\param a The array.
+  //*************************************************************************
+  template <typename T, size_t SIZE>
+  void static_sort(etl::array<T, SIZE>& a)
+  {
+    etl::static_sort<SIZE>(a.begin(), etl::less<T>());
+  }
+
   //*************************************************************************
   /// Gets a reference to an element in the array.
   ///\tparam I The index.
@@ -649,7 +671,7 @@ namespace etl
   ///\return A reference to the element
   //*************************************************************************
   template <size_t I, typename T, size_t MAXN>
-  inline T& get(array<T, MAXN>& a)
+  inline ETL_CONSTEXPR14 T& get(array<T, MAXN>& a)
   {
     ETL_STATIC_ASSERT(I < MAXN, "Index out of bounds");
     return a[I];
@@ -664,7 +686,7 @@ namespace etl
   ///\return A const reference to the element
   //*************************************************************************
   template <size_t I, typename T, size_t MAXN>
-  inline const T& get(const array<T, MAXN>& a)
+  inline ETL_CONSTEXPR const T& get(const array<T, MAXN>& a)
   {
     ETL_STATIC_ASSERT(I < MAXN, "Index out of bounds");
     return a[I];
@@ -40,6 +40,9 @@ SOFTWARE.
 #elif defined(ETL_COMPILER_ARM6)
   #include "atomic/atomic_arm.h"
   #define ETL_HAS_ATOMIC 1
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__ATOMIC_RELAXED)
+  #include "atomic/atomic_gcc_atomic.h"
+  #define ETL_HAS_ATOMIC 1
 #elif defined(ETL_COMPILER_GCC)
   #include "atomic/atomic_gcc_sync.h"
   #define ETL_HAS_ATOMIC 1
@@ -47,4 +50,17 @@ SOFTWARE.
   #define ETL_HAS_ATOMIC 0
 #endif
 
+// Can a pointer and a tag be compared and exchanged as one unit?
+#if ETL_HAS_ATOMIC && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__SIZEOF_POINTER__)
+  #if (__SIZEOF_POINTER__ == 8) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 1
+  #elif (__SIZEOF_POINTER__ == 4) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 1
+  #endif
+#endif
+
+#if !defined(ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS)
+  #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 0
+#endif
+
 #endif
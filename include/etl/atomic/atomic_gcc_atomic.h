@@ -0,0 +1,808 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_GCC_ATOMIC_INCLUDED
+#define ETL_ATOMIC_GCC_ATOMIC_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+#include "../nullptr.h"
+#include "../char_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  // Atomic type for GCC and Clang compilers that support the builtin '__atomic' functions.
+  // Unlike the '__sync' back-end, every operation honours the requested memory order.
+  // Only integral and pointer types are supported.
+  //***************************************************************************
+
+  typedef enum memory_order
+  {
+    memory_order_relaxed = __ATOMIC_RELAXED,
+    memory_order_consume = __ATOMIC_CONSUME,
+    memory_order_acquire = __ATOMIC_ACQUIRE,
+    memory_order_release = __ATOMIC_RELEASE,
+    memory_order_acq_rel = __ATOMIC_ACQ_REL,
+    memory_order_seq_cst = __ATOMIC_SEQ_CST
+  } memory_order;
+
+  namespace private_atomic
+  {
+    //*************************************************************************
+    /// The strongest failure order permitted for a compare exchange
+    /// that was given a single order.
+    //*************************************************************************
+    inline etl::memory_order failure_order(etl::memory_order order)
+    {
+      return (order == etl::memory_order_acq_rel) ? etl::memory_order_acquire :
+             (order == etl::memory_order_release) ? etl::memory_order_relaxed :
+                                                    order;
+    }
+  }
+
+  //***************************************************************************
+  /// Memory fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    __atomic_thread_fence(order);
+  }
+
+  //***************************************************************************
+  /// Compiler only fence.
+  //***************************************************************************
+  inline void atomic_signal_fence(etl::memory_order order)
+  {
+    __atomic_signal_fence(order);
+  }
+
+  //***************************************************************************
+  /// Atomic flag.
+  //***************************************************************************
+  class atomic_flag
+  {
+  public:
+
+    atomic_flag()
+      : flag(false)
+    {
+    }
+
+    // Set the flag and return the previous state.
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_test_and_set(&flag, order);
+    }
+
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_test_and_set(&flag, order);
+    }
+
+    // Clear the flag.
+    void clear(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_clear(&flag, order);
+    }
+
+    void clear(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_clear(&flag, order);
+    }
+
+    // Read the flag.
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&flag, order);
+    }
+
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&flag, order);
+    }
+
+    // Wait until the flag is no longer equal to 'old'.
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while (test(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while (test(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the flag, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+
+  private:
+
+    atomic_flag(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&) volatile;
+
+    bool flag;
+  };
+
+  template <typename T>
+  class atomic
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral types are supported");
+
+    ETL_CONSTEXPR atomic()
+      : value(0)
+    {
+    }
+
+    ETL_CONSTEXPR atomic(T v)
+      : value(v)
+    {
+    }
+
+    // Assignment
+    T operator =(T v)
+    {
+      store(v);
+
+      return v;
+    }
+
+    T operator =(T v) volatile
+    {
+      store(v);
+
+      return v;
+    }
+
+    // Pre-increment
+    T operator ++()
+    {
+      return __atomic_add_fetch(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    T operator ++() volatile
+    {
+      return __atomic_add_fetch(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    // Post-increment
+    T operator ++(int)
+    {
+      return __atomic_fetch_add(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    T operator ++(int) volatile
+    {
+      return __atomic_fetch_add(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    // Pre-decrement
+    T operator --()
+    {
+      return __atomic_sub_fetch(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    T operator --() volatile
+    {
+      return __atomic_sub_fetch(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    // Post-decrement
+    T operator --(int)
+    {
+      return __atomic_fetch_sub(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    T operator --(int) volatile
+    {
+      return __atomic_fetch_sub(&value, 1, etl::memory_order_seq_cst);
+    }
+
+    // Add
+    T operator +=(T v)
+    {
+      return __atomic_add_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    T operator +=(T v) volatile
+    {
+      return __atomic_add_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    // Subtract
+    T operator -=(T v)
+    {
+      return __atomic_sub_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    T operator -=(T v) volatile
+    {
+      return __atomic_sub_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    // And
+    T operator &=(T v)
+    {
+      return __atomic_and_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    T operator &=(T v) volatile
+    {
+      return __atomic_and_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    // Or
+    T operator |=(T v)
+    {
+      return __atomic_or_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    T operator |=(T v) volatile
+    {
+      return __atomic_or_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    // Exclusive or
+    T operator ^=(T v)
+    {
+      return __atomic_xor_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    T operator ^=(T v) volatile
+    {
+      return __atomic_xor_fetch(&value, v, etl::memory_order_seq_cst);
+    }
+
+    // Conversion operator
+    operator T() const
+    {
+      return __atomic_load_n(&value, etl::memory_order_seq_cst);
+    }
+
+    operator T() const volatile
+    {
+      return __atomic_load_n(&value, etl::memory_order_seq_cst);
+    }
+
+    // Is lock free?
+    bool is_lock_free() const
+    {
+      return __atomic_always_lock_free(sizeof(T), 0);
+    }
+
+    bool is_lock_free() const volatile
+    {
+      return __atomic_always_lock_free(sizeof(T), 0);
+    }
+
+    // Store
+    void store(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    void store(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    // Load
+    T load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    T load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    // Fetch add
+    T fetch_add(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_add(&value, v, order);
+    }
+
+    T fetch_add(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_add(&value, v, order);
+    }
+
+    // Fetch subtract
+    T fetch_sub(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_sub(&value, v, order);
+    }
+
+    T fetch_sub(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_sub(&value, v, order);
+    }
+
+    // Fetch or
+    T fetch_or(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_or(&value, v, order);
+    }
+
+    T fetch_or(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_or(&value, v, order);
+    }
+
+    // Fetch and
+    T fetch_and(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_and(&value, v, order);
+    }
+
+    T fetch_and(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_and(&value, v, order);
+    }
+
+    // Fetch exclusive or
+    T fetch_xor(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_xor(&value, v, order);
+    }
+
+    T fetch_xor(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_xor(&value, v, order);
+    }
+
+    // Exchange
+    T exchange(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    T exchange(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    // Compare exchange weak
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    // Compare exchange strong
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while (__atomic_load_n(&value, order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while (__atomic_load_n(&value, order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+  private:
+
+    atomic& operator =(const atomic&);
+    atomic& operator =(const atomic&) volatile;
+
+    mutable T value;
+  };
+
+  template <typename T>
+  class atomic<T*>
+  {
+  public:
+
+    ETL_CONSTEXPR atomic()
+      : value(nullptr)
+    {
+    }
+
+    ETL_CONSTEXPR atomic(T* v)
+      : value(v)
+    {
+    }
+
+    // Assignment
+    T* operator =(T* v)
+    {
+      store(v);
+
+      return v;
+    }
+
+    T* operator =(T* v) volatile
+    {
+      store(v);
+
+      return v;
+    }
+
+    // Pre-increment
+    T* operator ++()
+    {
+      return __atomic_add_fetch(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator ++() volatile
+    {
+      return __atomic_add_fetch(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Post-increment
+    T* operator ++(int)
+    {
+      return __atomic_fetch_add(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator ++(int) volatile
+    {
+      return __atomic_fetch_add(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Pre-decrement
+    T* operator --()
+    {
+      return __atomic_sub_fetch(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator --() volatile
+    {
+      return __atomic_sub_fetch(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Post-decrement
+    T* operator --(int)
+    {
+      return __atomic_fetch_sub(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator --(int) volatile
+    {
+      return __atomic_fetch_sub(&value, sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Add
+    T* operator +=(ptrdiff_t v)
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator +=(ptrdiff_t v) volatile
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Subtract
+    T* operator -=(ptrdiff_t v)
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    T* operator -=(ptrdiff_t v) volatile
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), etl::memory_order_seq_cst);
+    }
+
+    // Conversion operator
+    operator T*() const
+    {
+      return __atomic_load_n(&value, etl::memory_order_seq_cst);
+    }
+
+    operator T*() const volatile
+    {
+      return __atomic_load_n(&value, etl::memory_order_seq_cst);
+    }
+
+    // Is lock free?
+    bool is_lock_free() const
+    {
+      return __atomic_always_lock_free(sizeof(T*), 0);
+    }
+
+    bool is_lock_free() const volatile
+    {
+      return __atomic_always_lock_free(sizeof(T*), 0);
+    }
+
+    // Store
+    void store(T* v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    void store(T* v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    // Load
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    // Fetch add
+    T* fetch_add(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), order);
+    }
+
+    T* fetch_add(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), order);
+    }
+
+    // Fetch subtract
+    T* fetch_sub(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), order);
+    }
+
+    T* fetch_sub(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), order);
+    }
+
+    // Exchange
+    T* exchange(T* v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    T* exchange(T* v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    // Compare exchange weak
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    // Compare exchange strong
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, etl::private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while (__atomic_load_n(&value, order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while (__atomic_load_n(&value, order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+  private:
+
+    atomic& operator =(const atomic&);
+    atomic& operator =(const atomic&) volatile;
+
+    mutable T* value;
+  };
+
+  typedef etl::atomic<char>                atomic_char;
+  typedef etl::atomic<signed char>         atomic_schar;
+  typedef etl::atomic<unsigned char>       atomic_uchar;
+  typedef etl::atomic<short>               atomic_short;
+  typedef etl::atomic<unsigned short>      atomic_ushort;
+  typedef etl::atomic<int>                 atomic_int;
+  typedef etl::atomic<unsigned int>        atomic_uint;
+  typedef etl::atomic<long>                atomic_long;
+  typedef etl::atomic<unsigned long>       atomic_ulong;
+  typedef etl::atomic<long long>           atomic_llong;
+  typedef etl::atomic<unsigned long long>  atomic_ullong;
+  typedef etl::atomic<wchar_t>             atomic_wchar_t;
+  typedef etl::atomic<char16_t>            atomic_char16_t;
+  typedef etl::atomic<char32_t>            atomic_char32_t;
+  typedef etl::atomic<uint8_t>             atomic_uint8_t;
+  typedef etl::atomic<int8_t>              atomic_int8_t;
+  typedef etl::atomic<uint16_t>            atomic_uint16_t;
+  typedef etl::atomic<int16_t>             atomic_int16_t;
+  typedef etl::atomic<uint32_t>            atomic_uint32_t;
+  typedef etl::atomic<int32_t>             atomic_int32_t;
+  typedef etl::atomic<uint64_t>            atomic_uint64_t;
+  typedef etl::atomic<int64_t>             atomic_int64_t;
+  typedef etl::atomic<int_least8_t>        atomic_int_least8_t;
+  typedef etl::atomic<uint_least8_t>       atomic_uint_least8_t;
+  typedef etl::atomic<int_least16_t>       atomic_int_least16_t;
+  typedef etl::atomic<uint_least16_t>      atomic_uint_least16_t;
+  typedef etl::atomic<int_least32_t>       atomic_int_least32_t;
+  typedef etl::atomic<uint_least32_t>      atomic_uint_least32_t;
+  typedef etl::atomic<int_least64_t>       atomic_int_least64_t;
+  typedef etl::atomic<uint_least64_t>      atomic_uint_least64_t;
+  typedef etl::atomic<int_fast8_t>         atomic_int_fast8_t;
+  typedef etl::atomic<uint_fast8_t>        atomic_uint_fast8_t;
+  typedef etl::atomic<int_fast16_t>        atomic_int_fast16_t;
+  typedef etl::atomic<uint_fast16_t>       atomic_uint_fast16_t;
+  typedef etl::atomic<int_fast32_t>        atomic_int_fast32_t;
+  typedef etl::atomic<uint_fast32_t>       atomic_uint_fast32_t;
+  typedef etl::atomic<int_fast64_t>        atomic_int_fast64_t;
+  typedef etl::atomic<uint_fast64_t>       atomic_uint_fast64_t;
+  typedef etl::atomic<intptr_t>            atomic_intptr_t;
+  typedef etl::atomic<uintptr_t>           atomic_uintptr_t;
+  typedef etl::atomic<size_t>              atomic_size_t;
+  typedef etl::atomic<ptrdiff_t>           atomic_ptrdiff_t;
+  typedef etl::atomic<intmax_t>            atomic_intmax_t;
+  typedef etl::atomic<uintmax_t>           atomic_uintmax_t;
+}
+
+#endif
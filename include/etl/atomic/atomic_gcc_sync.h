@@ -61,6 +61,106 @@ namespace etl
     memory_order_seq_cst
   } memory_order;
 
+  //***************************************************************************
+  /// Memory fence.
+  /// The '__sync' builtins only provide a full fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order)
+  {
+    __sync_synchronize();
+  }
+
+  //***************************************************************************
+  /// Atomic flag.
+  //***************************************************************************
+  class atomic_flag
+  {
+  public:
+
+    atomic_flag()
+      : flag(0)
+    {
+    }
+
+    // Set the flag and return the previous state.
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __sync_lock_test_and_set(&flag, 1) != 0;
+    }
+
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __sync_lock_test_and_set(&flag, 1) != 0;
+    }
+
+    // Clear the flag.
+    void clear(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __sync_lock_release(&flag);
+      __sync_synchronize();
+    }
+
+    void clear(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __sync_lock_release(&flag);
+      __sync_synchronize();
+    }
+
+    // Read the flag.
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __sync_fetch_and_add(&flag, 0) != 0;
+    }
+
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __sync_fetch_and_add(&flag, 0) != 0;
+    }
+
+    // Wait until the flag is no longer equal to 'old'.
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while (test(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while (test(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the flag, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+
+  private:
+
+    atomic_flag(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&) volatile;
+
+    mutable volatile char flag;
+  };
+
   template <typename T>
   class atomic
   {
@@ -68,12 +168,12 @@ namespace etl
 
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral types are supported");
 
-    atomic()
+    ETL_CONSTEXPR atomic()
       : value(0)
     {
     }
 
-    atomic(T v)
+    ETL_CONSTEXPR atomic(T v)
       : value(v)
     {
     }
@@ -428,6 +528,41 @@ namespace etl
       return true;
     }
 
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while (__sync_fetch_and_add(&value, 0) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while (__sync_fetch_and_add(&value, 0) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+
   private:
 
     atomic& operator =(const atomic&);
@@ -441,12 +576,12 @@ namespace etl
   {
   public:
 
-    atomic()
+    ETL_CONSTEXPR atomic()
       : value(nullptr)
     {
     }
 
-    atomic(T* v)
+    ETL_CONSTEXPR atomic(T* v)
       : value(v)
     {
     }
@@ -735,6 +870,41 @@ namespace etl
       return true;
     }
 
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      while ((T*)__sync_fetch_and_add(&value, 0) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      while ((T*)__sync_fetch_and_add(&value, 0) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    // Notify.
+    // Waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+    }
+
+    void notify_one() volatile
+    {
+    }
+
+    void notify_all()
+    {
+    }
+
+    void notify_all() volatile
+    {
+    }
+
   private:
 
     atomic& operator =(const atomic&);
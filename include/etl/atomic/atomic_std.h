@@ -52,17 +52,135 @@ namespace etl
   static const etl::memory_order memory_order_acq_rel = std::memory_order_acq_rel;
   static const etl::memory_order memory_order_seq_cst = std::memory_order_seq_cst;
 
+  //***************************************************************************
+  /// Memory fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    std::atomic_thread_fence(order);
+  }
+
+  //***************************************************************************
+  /// Atomic flag.
+  /// Built on std::atomic<bool> so that 'test' is available before C++20.
+  //***************************************************************************
+  class atomic_flag
+  {
+  public:
+
+    atomic_flag()
+      : flag(false)
+    {
+    }
+
+    // Set the flag and return the previous state.
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return flag.exchange(true, order);
+    }
+
+    bool test_and_set(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return flag.exchange(true, order);
+    }
+
+    // Clear the flag.
+    void clear(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      flag.store(false, order);
+    }
+
+    void clear(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      flag.store(false, order);
+    }
+
+    // Read the flag.
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return flag.load(order);
+    }
+
+    bool test(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return flag.load(order);
+    }
+
+    // Wait until the flag is no longer equal to 'old'.
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+#if defined(__cpp_lib_atomic_wait)
+      flag.wait(old, order);
+#else
+      while (flag.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    void wait(bool old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<const std::atomic<bool>&>(flag).wait(old, order);
+#else
+      while (flag.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    // Notify.
+    // Without library support waiters poll the flag, so there is nothing to wake.
+    void notify_one()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      flag.notify_one();
+#endif
+    }
+
+    void notify_one() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<bool>&>(flag).notify_one();
+#endif
+    }
+
+    void notify_all()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      flag.notify_all();
+#endif
+    }
+
+    void notify_all() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<bool>&>(flag).notify_all();
+#endif
+    }
+
+  private:
+
+    atomic_flag(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&);
+    atomic_flag& operator =(const atomic_flag&) volatile;
+
+    std::atomic<bool> flag;
+  };
+
   template <typename T>
   class atomic
   {
   public:
 
-    atomic()
+    ETL_CONSTEXPR atomic()
       : value(0)
     {
     }
 
-    atomic(T v)
+    ETL_CONSTEXPR atomic(T v)
       : value(v)
     {
     }
@@ -329,6 +447,61 @@ namespace etl
       return value.compare_exchange_strong(expected, desired, success, failure);
     }
 
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.wait(old, order);
+#else
+      while (value.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    void wait(T old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<const std::atomic<T>&>(value).wait(old, order);
+#else
+      while (value.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    // Notify.
+    // Without library support waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.notify_one();
+#endif
+    }
+
+    void notify_one() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<T>&>(value).notify_one();
+#endif
+    }
+
+    void notify_all()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.notify_all();
+#endif
+    }
+
+    void notify_all() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<T>&>(value).notify_all();
+#endif
+    }
+
   private:
 
     atomic& operator =(const atomic&);
@@ -342,12 +515,12 @@ namespace etl
   {
   public:
 
-    atomic()
+    ETL_CONSTEXPR atomic()
       : value(nullptr)
     {
     }
 
-    atomic(T* v)
+    ETL_CONSTEXPR atomic(T* v)
       : value(v)
     {
     }
@@ -548,6 +721,61 @@ namespace etl
       return value.compare_exchange_strong(expected, desired, success, failure);
     }
 
+    // Wait until the value is no longer equal to 'old'.
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.wait(old, order);
+#else
+      while (value.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    void wait(T* old, etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<const std::atomic<T*>&>(value).wait(old, order);
+#else
+      while (value.load(order) == old)
+      {
+        ETL_CPU_PAUSE();
+      }
+#endif
+    }
+
+    // Notify.
+    // Without library support waiters poll the value, so there is nothing to wake.
+    void notify_one()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.notify_one();
+#endif
+    }
+
+    void notify_one() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<T*>&>(value).notify_one();
+#endif
+    }
+
+    void notify_all()
+    {
+#if defined(__cpp_lib_atomic_wait)
+      value.notify_all();
+#endif
+    }
+
+    void notify_all() volatile
+    {
+#if defined(__cpp_lib_atomic_wait)
+      const_cast<std::atomic<T*>&>(value).notify_all();
+#endif
+    }
+
   private:
 
     atomic & operator =(const atomic&);
@@ -0,0 +1,718 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_POOL_INCLUDED
+#define ETL_ATOMIC_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "pool.h"
+#include "nullptr.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "utility.h"
+
+//*****************************************************************************
+///\defgroup atomic_pool atomic_pool
+/// A fixed capacity pool that may be shared between threads and interrupts
+/// without a lock.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base of all atomic pools.
+  /// The free items form a Treiber stack. Allocation pops from the stack and
+  /// release pushes back on to it, each with a single compare and swap of the
+  /// head. The head holds a 16 bit item index and a 16 bit tag that changes on
+  /// every update, so a head that was popped and pushed again between a read
+  /// and its compare and swap is not mistaken for the original (ABA).
+  /// The free list links are kept apart from the items, so a thread that
+  /// loses the race never reads an item that another thread is using.
+  /// Lock-free only where etl::atomic_uint32_t is, i.e. not on cores without
+  /// exclusive access instructions, such as the Cortex-M0.
+  /// Uses the pool exceptions from etl::ipool.
+  ///\ingroup atomic_pool
+  //***************************************************************************
+  class iatomic_pool
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const void* const p_object)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      reinterpret_cast<T*>((const_cast<void*>(p_object)))->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      release_item(static_cast<const char*>(p_object));
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to n items with a single compare and swap.
+    /// Does not assert when the pool runs out.
+    /// \param p_items Where to store the item addresses.
+    /// \param n       The maximum number of items to allocate.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    size_t allocate_batch(void** p_items, size_t n)
+    {
+      uint32_t old_head = head.load(etl::memory_order_acquire);
+      uint16_t index;
+      size_t   count;
+
+      do
+      {
+        count = 0U;
+        index = index_of(old_head);
+
+        // If another thread changes the free list during the walk then the
+        // links may be stale, but the tag will have changed and the exchange
+        // will fail.
+        while ((index != NO_ITEM) && (count < n))
+        {
+          p_items[count++] = p_buffer + (size_t(index) * ITEM_SIZE);
+          index = p_links[index].load(etl::memory_order_relaxed);
+        }
+
+        if (count == 0U)
+        {
+          return 0U;
+        }
+      } while (!head.compare_exchange_weak(old_head, next_head(old_head, index), etl::memory_order_acquire, etl::memory_order_acquire));
+
+      items_allocated.fetch_add(uint32_t(count), etl::memory_order_relaxed);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release n items in the pool with a single compare and swap.
+    /// If asserts or exceptions are enabled and an item does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown and no items are released.
+    /// \param p_items The item addresses.
+    /// \param n       The number of items to release.
+    //*************************************************************************
+    void release_batch(void* const* p_items, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if (!is_item_in_pool(static_cast<const char*>(p_items[i])))
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+          return;
+        }
+      }
+
+      // Chain the items together before publishing them.
+      const uint16_t first = index_of_item(static_cast<const char*>(p_items[0]));
+      uint16_t       last  = first;
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        const uint16_t index = index_of_item(static_cast<const char*>(p_items[i]));
+        p_links[last].store(index, etl::memory_order_relaxed);
+        last = index;
+      }
+
+      uint32_t old_head = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_links[last].store(index_of(old_head), etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(old_head, next_head(old_head, first), etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(uint32_t(n), etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Not to be called while any other thread or interrupt may use the pool.
+    //*************************************************************************
+    void release_all()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* p_object) const
+    {
+      return is_item_in_pool(static_cast<const char*>(p_object));
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return index_of(head.load(etl::memory_order_acquire)) == NO_ITEM;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// The derived class must call initialise() once its storage exists.
+    //*************************************************************************
+    iatomic_pool(char* p_buffer_, etl::atomic_uint16_t* p_links_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+        p_links(p_links_),
+        ITEM_SIZE(item_size_),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Links every item in to the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      for (uint32_t i = 0U; i < MAX_SIZE; ++i)
+      {
+        p_links[i].store(uint16_t(((i + 1U) < MAX_SIZE) ? (i + 1U) : NO_ITEM), etl::memory_order_relaxed);
+      }
+
+      items_allocated.store(0U, etl::memory_order_relaxed);
+      head.store(0U, etl::memory_order_release);
+    }
+
+  private:
+
+    static const uint16_t NO_ITEM  = 0xFFFFU; ///< The index that marks the end of the free list.
+    static const uint32_t TAG_STEP = 0x10000UL;
+
+    //*************************************************************************
+    /// The item index held in a head value.
+    //*************************************************************************
+    static uint16_t index_of(uint32_t head_value)
+    {
+      return uint16_t(head_value & 0xFFFFU);
+    }
+
+    //*************************************************************************
+    /// A new head value for the index with the next tag.
+    //*************************************************************************
+    static uint32_t next_head(uint32_t head_value, uint16_t index)
+    {
+      return ((head_value + TAG_STEP) & ~uint32_t(0xFFFFU)) | index;
+    }
+
+    //*************************************************************************
+    /// The index of an item in the buffer.
+    //*************************************************************************
+    uint16_t index_of_item(const char* p_value) const
+    {
+      return uint16_t((p_value - p_buffer) / ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Pop an item from the free list.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      uint32_t old_head = head.load(etl::memory_order_acquire);
+      uint16_t index;
+
+      do
+      {
+        index = index_of(old_head);
+
+        if (index == NO_ITEM)
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+          return nullptr;
+        }
+
+        // If another thread takes this item first then the link may be stale,
+        // but the tag will have changed and the exchange will fail.
+        const uint16_t next = p_links[index].load(etl::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(old_head, next_head(old_head, next), etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          break;
+        }
+      } while (true);
+
+      items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+
+      return p_buffer + (size_t(index) * ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Push an item back on to the free list.
+    //*************************************************************************
+    void release_item(const char* p_value)
+    {
+      // Does it belong to us?
+      ETL_ASSERT(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
+
+      const uint16_t index = index_of_item(p_value);
+
+      uint32_t old_head = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_links[index].store(index_of(old_head), etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(old_head, next_head(old_head, index), etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((ITEM_SIZE * MAX_SIZE) - ITEM_SIZE));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if defined(ETL_DEBUG)
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % ITEM_SIZE) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    iatomic_pool(const iatomic_pool&);
+    iatomic_pool& operator =(const iatomic_pool&);
+
+    char* const                 p_buffer;        ///< The item storage.
+    etl::atomic_uint16_t* const p_links;         ///< The index of the next free item, for each item.
+    etl::atomic_uint32_t        head;            ///< The tag and the index of the first free item.
+    etl::atomic_uint32_t        items_allocated; ///< The number of items allocated.
+
+    const uint32_t ITEM_SIZE;   ///< The size of allocated items.
+    const uint32_t MAX_SIZE;    ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iatomic_pool()
+    {
+    }
+#else
+  protected:
+    ~iatomic_pool()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated abstract atomic pool implementation that uses a fixed size pool.
+  ///\ingroup atomic_pool
+  //*************************************************************************
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_>
+  class generic_atomic_pool : public etl::iatomic_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT((SIZE_ > 0U), "Zero size pool");
+    ETL_STATIC_ASSERT((SIZE_ < 0xFFFFU), "Atomic pools are limited to 65534 items");
+
+    static const size_t SIZE      = SIZE_;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+    static const size_t TYPE_SIZE = TYPE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_atomic_pool()
+      : etl::iatomic_pool(reinterpret_cast<char*>(&buffer[0]), links, ELEMENT_SIZE, SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::allocate<U>();
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      iatomic_pool::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char      value[TYPE_SIZE_]; ///< Storage for value type.
+      typename  etl::type_with_alignment<ALIGNMENT_>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[SIZE];
+
+    ///< The free list links.
+    etl::atomic_uint16_t links[SIZE];
+
+    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+
+    // Should not be copied.
+    generic_atomic_pool(const generic_atomic_pool&);
+    generic_atomic_pool& operator =(const generic_atomic_pool&);
+  };
+
+  //*************************************************************************
+  /// A templated atomic pool implementation that uses a fixed size pool.
+  /// Objects may be allocated and released by several threads and interrupts
+  /// at the same time.
+  ///\code
+  /// etl::atomic_pool<Frame, 8> frames;
+  ///
+  /// // RX interrupt.
+  /// Frame* p_frame = frames.allocate<Frame>();
+  ///
+  /// // Worker thread.
+  /// frames.release(p_frame);
+  ///\endcode
+  ///\ingroup atomic_pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class atomic_pool : public etl::generic_atomic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_>
+  {
+  private:
+
+    typedef etl::generic_atomic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_> base_t;
+
+  public:
+
+    static const size_t SIZE      = base_t::SIZE;
+    static const size_t ALIGNMENT = base_t::ALIGNMENT;
+    static const size_t TYPE_SIZE = base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    atomic_pool()
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    atomic_pool(const atomic_pool&);
+    atomic_pool& operator =(const atomic_pool&);
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,189 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_TAGGED_PTR_INCLUDED
+#define ETL_ATOMIC_TAGGED_PTR_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+
+namespace etl
+{
+  //***************************************************************************
+  /// A pointer paired with a modification tag.
+  //***************************************************************************
+  template <typename T>
+  struct tagged_ptr
+  {
+    tagged_ptr()
+      : pointer(nullptr)
+      , tag(0)
+    {
+    }
+
+    tagged_ptr(T* pointer_, uintptr_t tag_)
+      : pointer(pointer_)
+      , tag(tag_)
+    {
+    }
+
+    friend bool operator ==(const tagged_ptr& lhs, const tagged_ptr& rhs)
+    {
+      return (lhs.pointer == rhs.pointer) && (lhs.tag == rhs.tag);
+    }
+
+    friend bool operator !=(const tagged_ptr& lhs, const tagged_ptr& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    T*        pointer;
+    uintptr_t tag;
+  };
+
+  //***************************************************************************
+  /// An atomic pointer and tag, updated with a double width compare exchange.
+  /// Every successful update increments the tag, so a pointer that has been
+  /// removed and replaced between a load and a compare exchange will not
+  /// match. This makes lock free free-lists immune to the ABA problem.
+  //***************************************************************************
+  template <typename T>
+  class atomic_tagged_ptr
+  {
+  public:
+
+    typedef etl::tagged_ptr<T> value_type;
+
+    atomic_tagged_ptr()
+    {
+      storage.parts.pointer = nullptr;
+      storage.parts.tag     = 0;
+    }
+
+    atomic_tagged_ptr(T* pointer)
+    {
+      storage.parts.pointer = pointer;
+      storage.parts.tag     = 0;
+    }
+
+    //*************************************************************************
+    /// Load the pointer and tag.
+    //*************************************************************************
+    value_type load() const
+    {
+      storage_t current;
+      current.raw = __sync_val_compare_and_swap(&storage.raw, raw_t(0), raw_t(0));
+
+      return value_type(current.parts.pointer, current.parts.tag);
+    }
+
+    //*************************************************************************
+    /// Store a new pointer, incrementing the tag.
+    //*************************************************************************
+    void store(T* pointer)
+    {
+      value_type expected = load();
+
+      while (!compare_exchange(expected, pointer))
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// If the current pointer and tag equal 'expected' then store 'desired'
+    /// with the next tag and return true. Otherwise load the current pointer
+    /// and tag into 'expected' and return false.
+    //*************************************************************************
+    bool compare_exchange(value_type& expected, T* desired)
+    {
+      storage_t old_value;
+      storage_t new_value;
+
+      old_value.parts.pointer = expected.pointer;
+      old_value.parts.tag     = expected.tag;
+      new_value.parts.pointer = desired;
+      new_value.parts.tag     = expected.tag + 1U;
+
+      storage_t previous;
+      previous.raw = __sync_val_compare_and_swap(&storage.raw, old_value.raw, new_value.raw);
+
+      if (previous.raw == old_value.raw)
+      {
+        return true;
+      }
+      else
+      {
+        expected = value_type(previous.parts.pointer, previous.parts.tag);
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Always lock free.
+    //*************************************************************************
+    bool is_lock_free() const
+    {
+      return true;
+    }
+
+  private:
+
+    atomic_tagged_ptr(const atomic_tagged_ptr&);
+    atomic_tagged_ptr& operator =(const atomic_tagged_ptr&);
+
+#if __SIZEOF_POINTER__ == 8
+    __extension__ typedef unsigned __int128 raw_t;
+#else
+    typedef uint64_t raw_t;
+#endif
+
+    struct parts_t
+    {
+      T*        pointer;
+      uintptr_t tag;
+    };
+
+    union storage_t
+    {
+      raw_t   raw;
+      parts_t parts;
+    };
+
+    mutable storage_t storage;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,367 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASE64_INCLUDED
+#define ETL_BASE64_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "array_view.h"
+#include "cstring.h"
+#include "vector.h"
+
+///\defgroup base64 base64
+/// Base64 encoding and decoding (RFC 4648), with padding.
+/// Three bytes are converted to four characters at a time through tables.
+/// Functions writing to an array_view return the number of elements written,
+/// or 0 if the output is too small or the input is invalid. As valid input
+/// that is not empty always produces output, 0 is never a valid result for it.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The number of characters needed to encode 'n' bytes.
+  ///\ingroup base64
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t base64_encoded_size(size_t n)
+  {
+    return ((n + 2U) / 3U) * 4U;
+  }
+
+  //***************************************************************************
+  /// The number of characters needed to encode N bytes, for sizing buffers.
+  ///\ingroup base64
+  //***************************************************************************
+  template <const size_t N>
+  struct base64_encoded_length
+  {
+    static const size_t value = ((N + 2U) / 3U) * 4U;
+  };
+
+  template <const size_t N>
+  const size_t base64_encoded_length<N>::value;
+
+  //***************************************************************************
+  /// The largest number of bytes that 'n' characters may decode to.
+  ///\ingroup base64
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t base64_max_decoded_size(size_t n)
+  {
+    return (n / 4U) * 3U;
+  }
+
+  namespace private_base64
+  {
+    //*************************************************************************
+    /// The tables.
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+      static const char    encode[64];
+      static const uint8_t decode[256];
+    };
+
+    template <typename T>
+    const char tables<T>::encode[64] =
+    {
+      'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+      'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+      'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+      'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+    };
+
+    // 0x80 marks characters that are not in the alphabet.
+    template <typename T>
+    const uint8_t tables<T>::decode[256] =
+    {
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,   62, 0x80, 0x80, 0x80,   63,
+        52,   53,   54,   55,   56,   57,   58,   59,   60,   61, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80,    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+        15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80,   26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+        41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+    };
+
+    //*************************************************************************
+    /// Encodes [begin, end) to 'out', which must be large enough.
+    //*************************************************************************
+    inline void encode(const uint8_t* begin, const uint8_t* end, char* out)
+    {
+      const char* table = tables<>::encode;
+
+      // Whole groups of three bytes.
+      while ((end - begin) >= 3)
+      {
+        const uint32_t group = (uint32_t(begin[0]) << 16) | (uint32_t(begin[1]) << 8) | uint32_t(begin[2]);
+
+        out[0] = table[(group >> 18) & 0x3FU];
+        out[1] = table[(group >> 12) & 0x3FU];
+        out[2] = table[(group >> 6)  & 0x3FU];
+        out[3] = table[group         & 0x3FU];
+
+        begin += 3;
+        out   += 4;
+      }
+
+      // The last one or two bytes, padded.
+      if (begin != end)
+      {
+        const bool     two   = ((end - begin) == 2);
+        const uint32_t group = (uint32_t(begin[0]) << 16) | (two ? (uint32_t(begin[1]) << 8) : 0U);
+
+        out[0] = table[(group >> 18) & 0x3FU];
+        out[1] = table[(group >> 12) & 0x3FU];
+        out[2] = two ? table[(group >> 6) & 0x3FU] : '=';
+        out[3] = '=';
+      }
+    }
+
+    //*************************************************************************
+    /// The number of bytes that [begin, end) decodes to, or 0 if the length
+    /// or padding is invalid.
+    //*************************************************************************
+    inline size_t decoded_size(const char* begin, const char* end)
+    {
+      const size_t n = size_t(end - begin);
+
+      if ((n == 0U) || ((n % 4U) != 0U))
+      {
+        return 0U;
+      }
+
+      const size_t padding = (end[-1] != '=') ? 0U : (end[-2] != '=') ? 1U : 2U;
+
+      return ((n / 4U) * 3U) - padding;
+    }
+
+    //*************************************************************************
+    /// Decodes [begin, end) to 'out', which must be large enough.
+    /// The length must be a multiple of four.
+    /// Returns false if a character is invalid.
+    //*************************************************************************
+    inline bool decode(const char* begin, const char* end, uint8_t* out)
+    {
+      const uint8_t* table = tables<>::decode;
+
+      const size_t padding = (end[-1] != '=') ? 0U : (end[-2] != '=') ? 1U : 2U;
+      const char*  last    = end - 4;
+
+      // Whole groups of four characters, other than the last.
+      // The invalid markers are combined, so there is one test per group.
+      while (begin != last)
+      {
+        const uint8_t a = table[uint8_t(begin[0])];
+        const uint8_t b = table[uint8_t(begin[1])];
+        const uint8_t c = table[uint8_t(begin[2])];
+        const uint8_t d = table[uint8_t(begin[3])];
+
+        if ((a | b | c | d) & 0x80U)
+        {
+          return false;
+        }
+
+        const uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+
+        out[0] = uint8_t(group >> 16);
+        out[1] = uint8_t(group >> 8);
+        out[2] = uint8_t(group);
+
+        begin += 4;
+        out   += 3;
+      }
+
+      // The last group, which may be padded.
+      const uint8_t a = table[uint8_t(begin[0])];
+      const uint8_t b = table[uint8_t(begin[1])];
+      const uint8_t c = (padding >= 2U) ? 0U : table[uint8_t(begin[2])];
+      const uint8_t d = (padding >= 1U) ? 0U : table[uint8_t(begin[3])];
+
+      if ((a | b | c | d) & 0x80U)
+      {
+        return false;
+      }
+
+      const uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+
+      out[0] = uint8_t(group >> 16);
+
+      if (padding < 2U)
+      {
+        out[1] = uint8_t(group >> 8);
+      }
+
+      if (padding < 1U)
+      {
+        out[2] = uint8_t(group);
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Encodes [begin, end) to 'out'.
+  /// Returns the number of characters written, or 0 if 'out' is too small.
+  ///\ingroup base64
+  //***************************************************************************
+  inline size_t base64_encode(const uint8_t* begin, const uint8_t* end, etl::array_view<char> out)
+  {
+    const size_t n = base64_encoded_size(size_t(end - begin));
+
+    if (n > out.size())
+    {
+      return 0U;
+    }
+
+    private_base64::encode(begin, end, out.data());
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Encodes 'data' to 'out'.
+  /// Returns the number of characters written, or 0 if 'out' is too small.
+  ///\ingroup base64
+  //***************************************************************************
+  inline size_t base64_encode(etl::array_view<const uint8_t> data, etl::array_view<char> out)
+  {
+    return base64_encode(data.data(), data.data() + data.size(), out);
+  }
+
+  //***************************************************************************
+  /// Encodes [begin, end), appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room.
+  ///\ingroup base64
+  //***************************************************************************
+  inline bool base64_encode(const uint8_t* begin, const uint8_t* end, etl::istring& out)
+  {
+    const size_t n = base64_encoded_size(size_t(end - begin));
+
+    if (!out.reserve_check(n))
+    {
+      return false;
+    }
+
+    const size_t start = out.size();
+
+    out.resize(start + n);
+    private_base64::encode(begin, end, out.data() + start);
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Encodes 'data', appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room.
+  ///\ingroup base64
+  //***************************************************************************
+  inline bool base64_encode(etl::array_view<const uint8_t> data, etl::istring& out)
+  {
+    return base64_encode(data.data(), data.data() + data.size(), out);
+  }
+
+  //***************************************************************************
+  /// Decodes [begin, end) to 'out'.
+  /// Returns the number of bytes written, or 0 if 'out' is too small or the
+  /// input is invalid.
+  ///\ingroup base64
+  //***************************************************************************
+  inline size_t base64_decode(const char* begin, const char* end, etl::array_view<uint8_t> out)
+  {
+    const size_t n = private_base64::decoded_size(begin, end);
+
+    if ((n == 0U) || (n > out.size()))
+    {
+      return 0U;
+    }
+
+    return private_base64::decode(begin, end, out.data()) ? n : 0U;
+  }
+
+  //***************************************************************************
+  /// Decodes 'text' to 'out'.
+  /// Returns the number of bytes written, or 0 if 'out' is too small or the
+  /// input is invalid.
+  ///\ingroup base64
+  //***************************************************************************
+  inline size_t base64_decode(etl::array_view<const char> text, etl::array_view<uint8_t> out)
+  {
+    return base64_decode(text.data(), text.data() + text.size(), out);
+  }
+
+  //***************************************************************************
+  /// Decodes [begin, end), appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room or the
+  /// input is invalid.
+  ///\ingroup base64
+  //***************************************************************************
+  inline bool base64_decode(const char* begin, const char* end, etl::ivector<uint8_t>& out)
+  {
+    if (begin == end)
+    {
+      return true;
+    }
+
+    const size_t n = private_base64::decoded_size(begin, end);
+
+    if ((n == 0U) || (n > (out.capacity() - out.size())))
+    {
+      return false;
+    }
+
+    const size_t start = out.size();
+
+    out.resize(start + n);
+
+    if (!private_base64::decode(begin, end, out.data() + start))
+    {
+      out.resize(start);
+      return false;
+    }
+
+    return true;
+  }
+}
+
+#endif
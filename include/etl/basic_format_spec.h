@@ -59,6 +59,7 @@ namespace etl
       , upper_case_(true)
       , left_justified_(false)
       , boolalpha_(false)
+      , shortest_(false)
       , fill_(typename TString::value_type(' '))
     {
 
@@ -248,6 +249,26 @@ namespace etl
       return boolalpha_;
     }
 
+    //***************************************************************************
+    /// Sets the shortest flag.
+    /// Floating point values are formatted with the fewest digits that read
+    /// back to the same value. The precision is ignored.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    basic_format_spec& shortest(bool s)
+    {
+      shortest_ = s;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the shortest flag.
+    //***************************************************************************
+    bool is_shortest() const
+    {
+      return shortest_;
+    }
+
   private:
 
     uint_least8_t base_;
@@ -256,6 +277,7 @@ namespace etl
     bool upper_case_;
     bool left_justified_;
     bool boolalpha_;
+    bool shortest_;
     typename TString::value_type fill_;
   };
 }
@@ -50,6 +50,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "exception.h"
 #include "memory.h"
+#include "private/string_search.h"
 
 #undef ETL_FILE
 #define ETL_FILE "27"
@@ -258,6 +259,7 @@ namespace etl
     string_base(size_t max_size_)
       : is_truncated(false)
       , clear_afer_use(false)
+      , has_overflow(false)
       , current_size(0)
       , CAPACITY(max_size_)
     {
@@ -272,10 +274,34 @@ namespace etl
 
     bool            is_truncated;   ///< Set to true if the operation truncated the string.
     bool            clear_afer_use; ///< Set to true if the string must be cleared after use.
+    bool            has_overflow;   ///< Set to true if the string can move to an overflow buffer.
     size_type       current_size;   ///< The current number of elements in the string.
-    const size_type CAPACITY;       ///< The maximum number of elements in the string.
+    size_type       CAPACITY;       ///< The maximum number of elements in the string. Only changes if the string moves to an overflow buffer.
   };
 
+  template <typename T, const size_t N>
+  class basic_string_concat;
+
+  template <typename T>
+  class ibasic_string;
+
+  namespace private_basic_string
+  {
+    //*************************************************************************
+    /// The function that moves a string to its overflow buffer.
+    /// Set by etl::ibasic_string_overflow, in string_hybrid.h, so that
+    /// ordinary strings do not depend on it.
+    //*************************************************************************
+    template <typename T>
+    struct overflow_hook
+    {
+      static bool (*p_grow)(etl::ibasic_string<T>&);
+    };
+
+    template <typename T>
+    bool (*overflow_hook<T>::p_grow)(etl::ibasic_string<T>&) = nullptr;
+  }
+
   //***************************************************************************
   /// The base class for specifically sized strings.
   /// Can be used as a reference type for all strings containing a specific type.
@@ -426,6 +452,8 @@ namespace etl
     //*********************************************************************
     void resize(size_t new_size, T value)
     {
+      grow(new_size);
+
       if (new_size > CAPACITY)
       {
         is_truncated = true;
@@ -595,7 +623,7 @@ namespace etl
     {
       initialise();
 
-      while ((*other != 0) && (current_size < CAPACITY))
+      while ((*other != 0) && ((current_size < CAPACITY) || grow(current_size + 1U)))
       {
         p_buffer[current_size++] = *other++;
       }
@@ -618,6 +646,7 @@ namespace etl
     void assign(const_pointer other, size_t length_)
     {
       initialise();
+      grow(length_);
 
       is_truncated = (length_ > CAPACITY);
 
@@ -633,6 +662,28 @@ namespace etl
       p_buffer[current_size] = 0;
     }
 
+    //*********************************************************************
+    /// Assigns a concatenation to the string, in a single pass.
+    /// Truncates if the string does not have enough free space.
+    /// A piece of the concatenation may be this string.
+    ///\param expression The concatenation.
+    //*********************************************************************
+    template <const size_t N>
+    void assign(const etl::basic_string_concat<T, N>& expression)
+    {
+      grow(expression.size());
+
+      is_truncated = (expression.size() > CAPACITY) || expression.truncated();
+
+#if defined(ETL_STRING_TRUNCATION_IS_ERROR)
+      ETL_ASSERT(is_truncated == false, ETL_ERROR(string_truncation))
+#endif
+
+      current_size = expression.copy(p_buffer, CAPACITY);
+      cleanup();
+      p_buffer[current_size] = 0;
+    }
+
     //*********************************************************************
     /// Assigns values to the string.
     /// If asserts or exceptions are enabled, emits string_iterator if the iterators are reversed.
@@ -650,7 +701,7 @@ namespace etl
 
       initialise();
 
-      while ((first != last) && (current_size != CAPACITY))
+      while ((first != last) && ((current_size != CAPACITY) || grow(current_size + 1U)))
       {
         p_buffer[current_size++] = *first++;
       }
@@ -673,6 +724,7 @@ namespace etl
     void assign(size_t n, T value)
     {
       initialise();
+      grow(n);
 
       is_truncated = (n > CAPACITY);
 
@@ -702,7 +754,7 @@ namespace etl
     //*********************************************************************
     void push_back(T value)
     {
-      if (current_size != CAPACITY)
+      if ((current_size != CAPACITY) || grow(current_size + 1U))
       {
         p_buffer[current_size++] = value;
         p_buffer[current_size]   = 0;
@@ -717,6 +769,59 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the string without checking the capacity.
+    /// The string must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(T value)
+    {
+      p_buffer[current_size++] = value;
+      p_buffer[current_size]   = 0;
+    }
+
+    //*********************************************************************
+    /// Appends characters to the string without checking the capacity.
+    /// The string must have room for the characters. See reserve_check.
+    ///\param str The characters to append.
+    ///\param n   The number of characters.
+    //*********************************************************************
+    void append_unchecked(const T* str, size_t n)
+    {
+      etl::copy_n(str, n, p_buffer + current_size);
+      current_size += n;
+      p_buffer[current_size] = 0;
+    }
+
+    //*********************************************************************
+    /// Checks once that n more characters will fit, so that the unchecked
+    /// functions may be used to add them.
+    /// If ETL_STRING_TRUNCATION_IS_ERROR is defined, emits string_truncation if they will not fit.
+    ///\param n The number of characters to be added.
+    ///\return <b>true</b> if the characters will fit.
+    //*********************************************************************
+    bool reserve_check(size_t n) const
+    {
+      const bool fits = (n <= available());
+
+#if defined(ETL_STRING_TRUNCATION_IS_ERROR)
+      ETL_ASSERT(fits, ETL_ERROR(string_truncation));
+#endif
+
+      return fits;
+    }
+
+    //*********************************************************************
+    /// As reserve_check(n) const.
+    /// A string with an overflow buffer moves to it if the characters will not fit.
+    //*********************************************************************
+    bool reserve_check(size_t n)
+    {
+      grow(current_size + n);
+
+      return static_cast<const ibasic_string&>(*this).reserve_check(n);
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the string.
     /// Does nothing if the string is empty.
@@ -749,6 +854,33 @@ namespace etl
       return *this;
     }
 
+    //*********************************************************************
+    /// Appends a concatenation to the string, in a single pass.
+    /// The free space is checked once for all of the pieces.
+    ///\param expression The concatenation.
+    //*********************************************************************
+    template <const size_t N>
+    ibasic_string& append(const etl::basic_string_concat<T, N>& expression)
+    {
+      grow(current_size + expression.size());
+
+      const size_t free_space = CAPACITY - current_size;
+
+      if ((expression.size() > free_space) || expression.truncated())
+      {
+        is_truncated = true;
+
+#if defined(ETL_STRING_TRUNCATION_IS_ERROR)
+        ETL_ALWAYS_ASSERT(ETL_ERROR(string_truncation));
+#endif
+      }
+
+      current_size += expression.copy(p_buffer + current_size, free_space);
+      p_buffer[current_size] = 0;
+
+      return *this;
+    }
+
     //*********************************************************************
     /// Appends to the string.
     ///\param str The string to append.
@@ -815,6 +947,8 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, T value)
     {
+      grow(current_size + 1U, position);
+
       // Quick hack, as iterators are pointers.
       iterator insert_position = const_cast<iterator>(position);
 
@@ -870,6 +1004,8 @@ namespace etl
         return;
       }
 
+      grow(current_size + n, position);
+
       // Quick hack, as iterators are pointers.
       iterator insert_position = const_cast<iterator>(position);
       const size_t start = etl::distance(cbegin(), position);
@@ -946,9 +1082,12 @@ namespace etl
         return;
       }
 
-      const size_t start = etl::distance(begin(), position);
       const size_t n = etl::distance(first, last);
 
+      grow(current_size + n, position);
+
+      const size_t start = etl::distance(begin(), position);
+
       // No effect.
       if (start >= CAPACITY)
       {
@@ -1200,21 +1339,7 @@ namespace etl
     //*********************************************************************
     size_t find(const ibasic_string<T>& str, size_t pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_in_buffer(str.data(), pos, str.size());
     }
 
     //*********************************************************************
@@ -1231,16 +1356,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_in_buffer(s, pos, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1258,16 +1374,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_in_buffer(s, pos, n);
     }
 
     //*********************************************************************
@@ -1277,16 +1384,15 @@ namespace etl
     //*********************************************************************
     size_t find(T c, size_t position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer pend = p_buffer + size();
+      const_pointer p    = private_string_search::find_char(p_buffer + position, pend, c);
+
+      return (p == pend) ? npos : size_t(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1736,14 +1842,13 @@ namespace etl
     {
       if (position < size())
       {
+        const private_string_search::char_set<T> set(s, n);
+
         for (size_t i = position; i < size(); ++i)
         {
-          for (size_t j = 0; j < n; ++j)
+          if (set.contains(p_buffer[i]))
           {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
+            return i;
           }
         }
       }
@@ -1758,18 +1863,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1805,18 +1899,17 @@ namespace etl
         return npos;
       }
 
+      const private_string_search::char_set<T> set(s, n);
+
       position = etl::min(position, size() - 1);
 
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        for (size_t j = 0; j < n; ++j)
+        if (set.contains(p_buffer[position]))
         {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
+          return position;
         }
 
         ++it;
@@ -1886,19 +1979,11 @@ namespace etl
     {
       if (position < size())
       {
+        const private_string_search::char_set<T> set(s, n);
+
         for (size_t i = position; i < size(); ++i)
         {
-          bool found = false;
-
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
+          if (!set.contains(p_buffer[i]))
           {
             return i;
           }
@@ -1962,23 +2047,15 @@ namespace etl
         return npos;
       }
 
+      const private_string_search::char_set<T> set(s, n);
+
       position = etl::min(position, size() - 1);
 
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
+        if (!set.contains(p_buffer[position]))
         {
           return position;
         }
@@ -2041,6 +2118,17 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    ibasic_string& operator = (const etl::basic_string_concat<T, N>& rhs)
+    {
+      assign(rhs);
+
+      return *this;
+    }
+
     //*************************************************************************
     /// += operator.
     //*************************************************************************
@@ -2071,6 +2159,17 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// += operator.
+    //*************************************************************************
+    template <const size_t N>
+    ibasic_string& operator += (const etl::basic_string_concat<T, N>& rhs)
+    {
+      append(rhs);
+
+      return *this;
+    }
+
 #ifdef ETL_ISTRING_REPAIR_ENABLE
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
@@ -2108,6 +2207,30 @@ namespace etl
       p_buffer = p_buffer_;
     }
 
+    //*************************************************************************
+    /// Moves the string to its overflow buffer if it has one and needs more
+    /// than its capacity.
+    ///\return <b>true</b> if the capacity was increased.
+    //*************************************************************************
+    bool grow(size_type required)
+    {
+      return has_overflow && (required > CAPACITY) && private_basic_string::overflow_hook<T>::p_grow(*this);
+    }
+
+    //*************************************************************************
+    /// As grow(required), and moves 'position' to the new buffer.
+    //*************************************************************************
+    template <typename TPointer>
+    void grow(size_type required, TPointer& position)
+    {
+      const size_t index = size_t(position - p_buffer);
+
+      if (grow(required))
+      {
+        position = p_buffer + index;
+      }
+    }
+
   private:
 
     //*************************************************************************
@@ -2150,6 +2273,22 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Find helper function
+    //*************************************************************************
+    size_t find_in_buffer(const_pointer s, size_t pos, size_t n) const
+    {
+      if ((pos > size()) || (n > (size() - pos)))
+      {
+        return npos;
+      }
+
+      const_pointer pend = p_buffer + size();
+      const_pointer p    = private_string_search::find_substring(p_buffer + pos, pend, s, n);
+
+      return (p == pend) ? npos : size_t(p - p_buffer);
+    }
+
     //*************************************************************************
     /// Clear the unused trailing portion of the string.
     //*************************************************************************
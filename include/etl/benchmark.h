@@ -0,0 +1,539 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "static_assert.h"
+
+#if defined(ETL_CPU_HAS_RDTSC)
+  #if defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+#endif
+
+#if defined(ETL_BENCHMARK_USE_LINUX_PERF)
+  #include <string.h>
+  #include <unistd.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+//*****************************************************************************
+///\defgroup benchmark benchmark
+/// Measures the cost of a routine in cycles, for worst case latency work on
+/// target hardware.
+/// Each call is timed individually with a cycle counter and stored in a fixed
+/// size buffer, from which the minimum, maximum, median and any percentile
+/// may be read. The cost of reading the counter is measured on construction
+/// and subtracted from every sample.
+///
+/// The cycle counter is a template parameter. A counter has a 'value_type',
+/// a 'start()' that enables it and a 'read()' that returns the current count.
+/// Supplied counters:
+///   cycle_counter_dwt        : ARMv7-M / ARMv8-M DWT->CYCCNT.
+///   cycle_counter_rdtsc      : x86 time stamp counter.
+///   cycle_counter_linux_perf : Linux perf_event CPU cycles.
+///                              Define ETL_BENCHMARK_USE_LINUX_PERF to enable.
+///   cycle_counter_function   : Wraps a user function, such as a hardware timer read.
+/// default_cycle_counter is chosen from the profile: the Linux perf counter
+/// if enabled, otherwise the DWT if ETL_CPU_HAS_DWT_CYCCNT is defined, otherwise
+/// the time stamp counter if ETL_CPU_HAS_RDTSC is defined.
+/// ETL_HAS_DEFAULT_CYCLE_COUNTER is 1 if there is a default.
+///\ingroup utilities
+//*****************************************************************************
+
+//*****************************************************************************
+// Stops the compiler moving the measured code across a counter read.
+//*****************************************************************************
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7)
+  #define ETL_BENCHMARK_BARRIER() __asm__ __volatile__("" : : : "memory")
+#elif defined(ETL_COMPILER_MICROSOFT)
+  #define ETL_BENCHMARK_BARRIER() _ReadWriteBarrier()
+#else
+  #define ETL_BENCHMARK_BARRIER()
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The ARMv7-M / ARMv8-M DWT cycle counter.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct cycle_counter_dwt
+  {
+    typedef uint32_t value_type;
+
+    static const char* unit()
+    {
+      return "cycles";
+    }
+
+    void start()
+    {
+      demcr()    |= 0x01000000UL; // TRCENA
+      lar()       = 0xC5ACCE55UL; // Unlock, needed on the Cortex-M7.
+      cyccnt()    = 0UL;
+      dwt_ctrl() |= 0x00000001UL; // CYCCNTENA
+    }
+
+    value_type read() const
+    {
+      ETL_BENCHMARK_BARRIER();
+      const value_type value = cyccnt();
+      ETL_BENCHMARK_BARRIER();
+
+      return value;
+    }
+
+  private:
+
+    static volatile uint32_t& dwt_ctrl() { return *reinterpret_cast<volatile uint32_t*>(0xE0001000UL); }
+    static volatile uint32_t& cyccnt()   { return *reinterpret_cast<volatile uint32_t*>(0xE0001004UL); }
+    static volatile uint32_t& lar()      { return *reinterpret_cast<volatile uint32_t*>(0xE0001FB0UL); }
+    static volatile uint32_t& demcr()    { return *reinterpret_cast<volatile uint32_t*>(0xE000EDFCUL); }
+  };
+
+#if defined(ETL_CPU_HAS_RDTSC)
+  //***************************************************************************
+  /// The x86 time stamp counter.
+  /// Counts at a fixed reference rate on modern processors, not core cycles.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct cycle_counter_rdtsc
+  {
+    typedef uint64_t value_type;
+
+    static const char* unit()
+    {
+      return "TSC ticks";
+    }
+
+    void start()
+    {
+    }
+
+    value_type read() const
+    {
+      // lfence stops earlier instructions being executed after the read.
+      ETL_BENCHMARK_BARRIER();
+      _mm_lfence();
+      const value_type value = __rdtsc();
+      _mm_lfence();
+      ETL_BENCHMARK_BARRIER();
+
+      return value;
+    }
+  };
+#endif
+
+#if defined(ETL_BENCHMARK_USE_LINUX_PERF)
+  //***************************************************************************
+  /// CPU cycles counted by the Linux perf_event interface, for user space only.
+  /// Each read is a system call; its cost is removed by the calibration but it
+  /// disturbs the caches more than the other counters.
+  /// is_valid() is false if the counter could not be opened, for example
+  /// because of the perf_event_paranoid setting.
+  ///\ingroup benchmark
+  //***************************************************************************
+  class cycle_counter_linux_perf
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    static const char* unit()
+    {
+      return "cycles";
+    }
+
+    cycle_counter_linux_perf()
+      : fd(-1)
+    {
+      perf_event_attr attributes;
+      memset(&attributes, 0, sizeof(attributes));
+
+      attributes.type           = PERF_TYPE_HARDWARE;
+      attributes.size           = sizeof(attributes);
+      attributes.config         = PERF_COUNT_HW_CPU_CYCLES;
+      attributes.disabled       = 1;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv     = 1;
+
+      fd = int(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    ~cycle_counter_linux_perf()
+    {
+      if (fd >= 0)
+      {
+        close(fd);
+      }
+    }
+
+    bool is_valid() const
+    {
+      return fd >= 0;
+    }
+
+    void start()
+    {
+      if (fd >= 0)
+      {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+
+    value_type read() const
+    {
+      value_type value = 0U;
+
+      ETL_BENCHMARK_BARRIER();
+
+      if (fd >= 0)
+      {
+        if (::read(fd, &value, sizeof(value)) != ssize_t(sizeof(value)))
+        {
+          value = 0U;
+        }
+      }
+
+      ETL_BENCHMARK_BARRIER();
+
+      return value;
+    }
+
+  private:
+
+    // Not copyable.
+    cycle_counter_linux_perf(const cycle_counter_linux_perf&) ETL_DELETE;
+    cycle_counter_linux_perf& operator =(const cycle_counter_linux_perf&) ETL_DELETE;
+
+    int fd;
+  };
+#endif
+
+  //***************************************************************************
+  /// A counter that calls a user supplied function, such as a free running
+  /// hardware timer read.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename T, T (*READ)()>
+  struct cycle_counter_function
+  {
+    typedef T value_type;
+
+    static const char* unit()
+    {
+      return "counts";
+    }
+
+    void start()
+    {
+    }
+
+    value_type read() const
+    {
+      ETL_BENCHMARK_BARRIER();
+      const value_type value = READ();
+      ETL_BENCHMARK_BARRIER();
+
+      return value;
+    }
+  };
+
+  //***************************************************************************
+  /// The default counter for the target.
+  ///\ingroup benchmark
+  //***************************************************************************
+#if defined(ETL_BENCHMARK_USE_LINUX_PERF)
+  typedef etl::cycle_counter_linux_perf default_cycle_counter;
+  #define ETL_HAS_DEFAULT_CYCLE_COUNTER 1
+#elif defined(ETL_CPU_HAS_DWT_CYCCNT)
+  typedef etl::cycle_counter_dwt default_cycle_counter;
+  #define ETL_HAS_DEFAULT_CYCLE_COUNTER 1
+#elif defined(ETL_CPU_HAS_RDTSC)
+  typedef etl::cycle_counter_rdtsc default_cycle_counter;
+  #define ETL_HAS_DEFAULT_CYCLE_COUNTER 1
+#else
+  struct default_cycle_counter;
+  #define ETL_HAS_DEFAULT_CYCLE_COUNTER 0
+#endif
+
+  //***************************************************************************
+  /// Times a routine, call by call.
+  ///\tparam SAMPLES  The number of samples that may be stored.
+  ///\tparam TCounter The cycle counter.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <const size_t SAMPLES, typename TCounter = etl::default_cycle_counter>
+  class benchmark
+  {
+  public:
+
+    ETL_STATIC_ASSERT(SAMPLES > 0U, "benchmark must store at least one sample");
+
+    typedef TCounter                      counter_type;
+    typedef typename TCounter::value_type value_type;
+    typedef size_t                        size_type;
+
+    static const size_t MAX_SAMPLES = SAMPLES;
+
+    //*************************************************************************
+    /// Starts the counter and measures the cost of reading it.
+    //*************************************************************************
+    benchmark()
+      : counter()
+      , sample_count(0U)
+      , read_overhead(0U)
+      , sorted(true)
+    {
+      counter.start();
+      calibrate();
+    }
+
+    //*************************************************************************
+    /// Calls the function 'warm_up' times without measuring, to settle the
+    /// caches and branch predictors, then measures it until the buffer is full.
+    //*************************************************************************
+    template <typename TFunction>
+    void run(TFunction function, size_t warm_up = 0U)
+    {
+      for (size_t i = 0U; i < warm_up; ++i)
+      {
+        function();
+      }
+
+      while (!full())
+      {
+        measure(function);
+      }
+    }
+
+    //*************************************************************************
+    /// Measures one call of the function.
+    /// The sample is discarded if the buffer is full.
+    //*************************************************************************
+    template <typename TFunction>
+    void measure(TFunction function)
+    {
+      const value_type begin = counter.read();
+      function();
+      const value_type end = counter.read();
+
+      add(value_type(end - begin));
+    }
+
+    //*************************************************************************
+    /// Brackets code that cannot be wrapped in a function.
+    /// Returns the start count, to be passed to stop().
+    //*************************************************************************
+    value_type start() const
+    {
+      return counter.read();
+    }
+
+    void stop(value_type begin)
+    {
+      const value_type end = counter.read();
+
+      add(value_type(end - begin));
+    }
+
+    //*************************************************************************
+    /// Discards the samples.
+    //*************************************************************************
+    void clear()
+    {
+      sample_count = 0U;
+      sorted       = true;
+    }
+
+    size_type size() const
+    {
+      return sample_count;
+    }
+
+    size_type max_size() const
+    {
+      return SAMPLES;
+    }
+
+    bool empty() const
+    {
+      return sample_count == 0U;
+    }
+
+    bool full() const
+    {
+      return sample_count == SAMPLES;
+    }
+
+    //*************************************************************************
+    /// The cost of a counter read, subtracted from every sample.
+    //*************************************************************************
+    value_type overhead() const
+    {
+      return read_overhead;
+    }
+
+    //*************************************************************************
+    /// The statistics. Each returns 0 if there are no samples.
+    /// Reading any of these sorts the samples.
+    //*************************************************************************
+    value_type min() const
+    {
+      return percentile(0U);
+    }
+
+    value_type max() const
+    {
+      return percentile(100U);
+    }
+
+    value_type median() const
+    {
+      return percentile(50U);
+    }
+
+    //*************************************************************************
+    /// A percentile, 0 to 100. Returns the sorted sample nearest to that
+    /// position, so 0 is the minimum and 100 the maximum.
+    //*************************************************************************
+    value_type percentile(size_t percent) const
+    {
+      if (sample_count == 0U)
+      {
+        return 0U;
+      }
+
+      sort();
+
+      percent = (percent > 100U) ? 100U : percent;
+
+      return samples[((percent * (sample_count - 1U)) + 50U) / 100U];
+    }
+
+    //*************************************************************************
+    /// The mean of the samples, rounded down.
+    //*************************************************************************
+    value_type mean() const
+    {
+      if (sample_count == 0U)
+      {
+        return 0U;
+      }
+
+      uint64_t total = 0U;
+
+      for (size_t i = 0U; i < sample_count; ++i)
+      {
+        total += samples[i];
+      }
+
+      return value_type(total / sample_count);
+    }
+
+    //*************************************************************************
+    /// The samples, in the order taken unless a statistic has been read.
+    //*************************************************************************
+    const value_type* data() const
+    {
+      return samples;
+    }
+
+    static const char* unit()
+    {
+      return TCounter::unit();
+    }
+
+  private:
+
+    //*************************************************************************
+    void add(value_type elapsed)
+    {
+      if (sample_count < SAMPLES)
+      {
+        samples[sample_count] = (elapsed > read_overhead) ? value_type(elapsed - read_overhead) : value_type(0U);
+        ++sample_count;
+        sorted = false;
+      }
+    }
+
+    //*************************************************************************
+    /// The overhead is the smallest difference between back to back reads.
+    //*************************************************************************
+    void calibrate()
+    {
+      value_type smallest = 0U;
+
+      for (size_t i = 0U; i < 32U; ++i)
+      {
+        const value_type begin = counter.read();
+        const value_type end   = counter.read();
+        const value_type cost  = value_type(end - begin);
+
+        if ((i == 0U) || (cost < smallest))
+        {
+          smallest = cost;
+        }
+      }
+
+      read_overhead = smallest;
+    }
+
+    //*************************************************************************
+    void sort() const
+    {
+      if (!sorted)
+      {
+        etl::sort(samples, samples + sample_count);
+        sorted = true;
+      }
+    }
+
+    TCounter           counter;
+    mutable value_type samples[SAMPLES];
+    size_t             sample_count;
+    value_type         read_overhead;
+    mutable bool       sorted;
+  };
+}
+
+#endif
@@ -47,6 +47,44 @@ SOFTWARE.
 
 #include "limits.h"
 
+//*****************************************************************************
+// Compiler intrinsics for the bit counting and reversal functions.
+// The GCC/Clang builtins may be used in constant expressions.
+// Inline assembler and the MSVC intrinsics may not, so they are only used when
+// the functions are not constexpr, or when the compiler can tell us that the
+// call is not being constant evaluated.
+//*****************************************************************************
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7)
+  #define ETL_BINARY_USE_GCC_BUILTINS
+#endif
+
+#if defined(__has_builtin)
+  #if __has_builtin(__builtin_bitreverse32)
+    #define ETL_BINARY_USE_BUILTIN_BITREVERSE
+  #endif
+#endif
+
+#if !ETL_CPP14_SUPPORTED || defined(ETL_FORCE_NO_ADVANCED_CPP)
+  #define ETL_BINARY_NOT_CONSTANT_EVALUATED() true
+#elif defined(ETL_IS_CONSTANT_EVALUATED)
+  #define ETL_BINARY_NOT_CONSTANT_EVALUATED() (!ETL_IS_CONSTANT_EVALUATED())
+#endif
+
+#if defined(ETL_BINARY_NOT_CONSTANT_EVALUATED)
+  #if defined(ETL_BINARY_USE_GCC_BUILTINS) && !defined(ETL_BINARY_USE_BUILTIN_BITREVERSE) && \
+      (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && defined(__ARM_FEATURE_CLZ)))
+    #define ETL_BINARY_USE_ARM_RBIT
+  #endif
+
+  #if defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64))
+    #include <intrin.h>
+    #define ETL_BINARY_USE_MSVC_BITSCAN
+    #if (defined(_M_IX86) || defined(_M_X64)) && defined(__AVX__)
+      #define ETL_BINARY_USE_MSVC_POPCNT
+    #endif
+  #endif
+#endif
+
 #undef ETL_FILE
 #define ETL_FILE "50"
 
@@ -128,6 +166,12 @@ namespace etl
 
     const size_t BITS = etl::integral_limits<typename etl::make_unsigned<T>::type>::bits;
     distance %= BITS;
+
+    if (distance == 0U)
+    {
+      return value;
+    }
+
     const size_t SHIFT = BITS - distance;
 
     return (value << distance) | (value >> SHIFT);
@@ -158,6 +202,12 @@ namespace etl
 
     const size_t BITS = etl::integral_limits<typename etl::make_unsigned<T>::type>::bits;
     distance %= BITS;
+
+    if (distance == 0U)
+    {
+      return value;
+    }
+
     const size_t SHIFT = BITS - distance;
 
     return (value >> distance) | (value << SHIFT);
@@ -312,45 +362,80 @@ namespace etl
     return TReturn((value ^ mask) - mask);
   }
 
+  namespace private_binary
+  {
+#if defined(ETL_BINARY_USE_ARM_RBIT)
+    //*************************************************************************
+    /// Reverses the bits with the ARM RBIT instruction.
+    //*************************************************************************
+    inline uint32_t arm_rbit(uint32_t value)
+    {
+      uint32_t result;
+  #if defined(__aarch64__)
+      __asm__("rbit %w0, %w1" : "=r"(result) : "r"(value));
+  #else
+      __asm__("rbit %0, %1" : "=r"(result) : "r"(value));
+  #endif
+      return result;
+    }
 
+    inline uint64_t arm_rbit(uint64_t value)
+    {
+  #if defined(__aarch64__)
+      uint64_t result;
+      __asm__("rbit %x0, %x1" : "=r"(result) : "r"(value));
+      return result;
+  #else
+      return (uint64_t(arm_rbit(uint32_t(value))) << 32) | arm_rbit(uint32_t(value >> 32));
+  #endif
+    }
+#endif
 
-  //***************************************************************************
-  /// Find the position of the first set bit.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  uint_least8_t first_set_bit_position(T value)
-  {
-    return count_trailing_zeros(value);
-  }
+#if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    //*************************************************************************
+    /// Index of the lowest set bit. The value must not be zero.
+    //*************************************************************************
+    inline uint_least8_t bit_scan_forward(uint32_t value)
+    {
+      unsigned long index;
+      _BitScanForward(&index, value);
+      return uint_least8_t(index);
+    }
 
-  //***************************************************************************
-  /// Find the position of the first clear bit.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  uint_least8_t first_clear_bit_position(T value)
-  {
-    value = ~value;
-    return count_trailing_zeros(value);
-  }
+    inline uint_least8_t bit_scan_forward(uint64_t value)
+    {
+  #if defined(_M_X64) || defined(_M_ARM64)
+      unsigned long index;
+      _BitScanForward64(&index, value);
+      return uint_least8_t(index);
+  #else
+      return (uint32_t(value) != 0U) ? bit_scan_forward(uint32_t(value))
+                                     : uint_least8_t(32U + bit_scan_forward(uint32_t(value >> 32)));
+  #endif
+    }
 
-  //***************************************************************************
-  /// Find the position of the first bit that is clear or set.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  uint_least8_t first_bit_position(bool state, T value)
-  {
-    if (!state)
+    //*************************************************************************
+    /// Index of the highest set bit. The value must not be zero.
+    //*************************************************************************
+    inline uint_least8_t bit_scan_reverse(uint32_t value)
     {
-      value = ~value;
+      unsigned long index;
+      _BitScanReverse(&index, value);
+      return uint_least8_t(index);
     }
 
-    return count_trailing_zeros(value);
+    inline uint_least8_t bit_scan_reverse(uint64_t value)
+    {
+  #if defined(_M_X64) || defined(_M_ARM64)
+      unsigned long index;
+      _BitScanReverse64(&index, value);
+      return uint_least8_t(index);
+  #else
+      return (uint32_t(value >> 32) != 0U) ? uint_least8_t(32U + bit_scan_reverse(uint32_t(value >> 32)))
+                                           : bit_scan_reverse(uint32_t(value));
+  #endif
+    }
+#endif
   }
 
   //***************************************************************************
@@ -538,16 +623,26 @@ namespace etl
   /// Reverse 8 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint8_t reverse_bits(uint8_t value)
+  inline ETL_CONSTEXPR14 uint8_t reverse_bits(uint8_t value)
   {
-    value = ((value & 0xAA) >> 1) | ((value & 0x55) << 1);
-    value = ((value & 0xCC) >> 2) | ((value & 0x33) << 2);
-    value = (value >> 4) | (value << 4);
+#if defined(ETL_BINARY_USE_BUILTIN_BITREVERSE)
+    return __builtin_bitreverse8(value);
+#else
+  #if defined(ETL_BINARY_USE_ARM_RBIT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint8_t(private_binary::arm_rbit(uint32_t(value)) >> 24);
+    }
+  #endif
+    value = uint8_t(((value & 0xAA) >> 1) | ((value & 0x55) << 1));
+    value = uint8_t(((value & 0xCC) >> 2) | ((value & 0x33) << 2));
+    value = uint8_t((value >> 4) | (value << 4));
 
     return value;
+#endif
   }
 
-  inline int8_t reverse_bits(int8_t value)
+  inline ETL_CONSTEXPR14 int8_t reverse_bits(int8_t value)
   {
     return int8_t(reverse_bits(uint8_t(value)));
   }
@@ -557,17 +652,27 @@ namespace etl
   /// Reverse 16 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint16_t reverse_bits(uint16_t value)
+  inline ETL_CONSTEXPR14 uint16_t reverse_bits(uint16_t value)
   {
-    value = ((value & 0xAAAA) >> 1) | ((value & 0x5555) << 1);
-    value = ((value & 0xCCCC) >> 2) | ((value & 0x3333) << 2);
-    value = ((value & 0xF0F0) >> 4) | ((value & 0x0F0F) << 4);
-    value = (value >> 8) | (value << 8);
+#if defined(ETL_BINARY_USE_BUILTIN_BITREVERSE)
+    return __builtin_bitreverse16(value);
+#else
+  #if defined(ETL_BINARY_USE_ARM_RBIT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint16_t(private_binary::arm_rbit(uint32_t(value)) >> 16);
+    }
+  #endif
+    value = uint16_t(((value & 0xAAAA) >> 1) | ((value & 0x5555) << 1));
+    value = uint16_t(((value & 0xCCCC) >> 2) | ((value & 0x3333) << 2));
+    value = uint16_t(((value & 0xF0F0) >> 4) | ((value & 0x0F0F) << 4));
+    value = uint16_t((value >> 8) | (value << 8));
 
     return value;
+#endif
   }
 
-  inline int16_t reverse_bits(int16_t value)
+  inline ETL_CONSTEXPR14 int16_t reverse_bits(int16_t value)
   {
     return int16_t(reverse_bits(uint16_t(value)));
   }
@@ -576,8 +681,17 @@ namespace etl
   /// Reverse 32 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint32_t reverse_bits(uint32_t value)
+  inline ETL_CONSTEXPR14 uint32_t reverse_bits(uint32_t value)
   {
+#if defined(ETL_BINARY_USE_BUILTIN_BITREVERSE)
+    return __builtin_bitreverse32(value);
+#else
+  #if defined(ETL_BINARY_USE_ARM_RBIT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return private_binary::arm_rbit(value);
+    }
+  #endif
     value = ((value & 0xAAAAAAAA) >>  1) | ((value & 0x55555555) <<  1);
     value = ((value & 0xCCCCCCCC) >>  2) | ((value & 0x33333333) <<  2);
     value = ((value & 0xF0F0F0F0) >>  4) | ((value & 0x0F0F0F0F) <<  4);
@@ -585,9 +699,10 @@ namespace etl
     value = (value >> 16) | (value << 16);
 
     return value;
+#endif
   }
 
-  inline int32_t reverse_bits(int32_t value)
+  inline ETL_CONSTEXPR14 int32_t reverse_bits(int32_t value)
   {
     return int32_t(reverse_bits(uint32_t(value)));
   }
@@ -596,8 +711,17 @@ namespace etl
   /// Reverse 64 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint64_t reverse_bits(uint64_t value)
+  inline ETL_CONSTEXPR14 uint64_t reverse_bits(uint64_t value)
   {
+#if defined(ETL_BINARY_USE_BUILTIN_BITREVERSE)
+    return __builtin_bitreverse64(value);
+#else
+  #if defined(ETL_BINARY_USE_ARM_RBIT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return private_binary::arm_rbit(value);
+    }
+  #endif
     value = ((value & 0xAAAAAAAAAAAAAAAA) >>  1) | ((value & 0x5555555555555555) <<  1);
     value = ((value & 0xCCCCCCCCCCCCCCCC) >>  2) | ((value & 0x3333333333333333) <<  2);
     value = ((value & 0xF0F0F0F0F0F0F0F0) >>  4) | ((value & 0x0F0F0F0F0F0F0F0F) <<  4);
@@ -606,9 +730,10 @@ namespace etl
     value = (value >> 32) | (value << 32);
 
     return value;
+#endif
   }
 
-  inline int64_t reverse_bits(int64_t value)
+  inline ETL_CONSTEXPR14 int64_t reverse_bits(int64_t value)
   {
     return int64_t(reverse_bits(uint64_t(value)));
   }
@@ -618,12 +743,12 @@ namespace etl
   ///\ingroup binary
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  inline uint8_t reverse_bytes(uint8_t value)
+  inline ETL_CONSTEXPR14 uint8_t reverse_bytes(uint8_t value)
   {
     return value;
   }
 
-  inline int8_t reverse_bytes(int8_t value)
+  inline ETL_CONSTEXPR14 int8_t reverse_bytes(int8_t value)
   {
     return value;
   }
@@ -633,14 +758,18 @@ namespace etl
   /// Reverse bytes 16 bit.
   ///\ingroup binary
   //***************************************************************************
-  inline uint16_t reverse_bytes(uint16_t value)
+  inline ETL_CONSTEXPR14 uint16_t reverse_bytes(uint16_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return __builtin_bswap16(value);
+#else
     value = (value >> 8) | (value << 8);
 
     return value;
+#endif
   }
 
-  inline int16_t reverse_bytes(int16_t value)
+  inline ETL_CONSTEXPR14 int16_t reverse_bytes(int16_t value)
   {
     return int16_t(reverse_bytes(uint16_t(value)));
   }
@@ -649,15 +778,19 @@ namespace etl
   /// Reverse bytes 32 bit.
   ///\ingroup binary
   //***************************************************************************
-  inline uint32_t reverse_bytes(uint32_t value)
+  inline ETL_CONSTEXPR14 uint32_t reverse_bytes(uint32_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return __builtin_bswap32(value);
+#else
     value = ((value & 0xFF00FF00) >> 8) | ((value & 0x00FF00FF) << 8);
     value = (value >> 16) | (value << 16);
 
     return value;
+#endif
   }
 
-  inline int32_t reverse_bytes(int32_t value)
+  inline ETL_CONSTEXPR14 int32_t reverse_bytes(int32_t value)
   {
     return int32_t(reverse_bytes(uint32_t(value)));
   }
@@ -666,16 +799,20 @@ namespace etl
   /// Reverse bytes 64 bit.
   ///\ingroup binary
   //***************************************************************************
-  inline uint64_t reverse_bytes(uint64_t value)
+  inline ETL_CONSTEXPR14 uint64_t reverse_bytes(uint64_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return __builtin_bswap64(value);
+#else
     value = ((value & 0xFF00FF00FF00FF00) >> 8)  | ((value & 0x00FF00FF00FF00FF) << 8);
     value = ((value & 0xFFFF0000FFFF0000) >> 16) | ((value & 0x0000FFFF0000FFFF) << 16);
     value = (value >> 32) | (value << 32);
 
     return value;
+#endif
   }
 
-  inline int64_t reverse_bytes(int64_t value)
+  inline ETL_CONSTEXPR14 int64_t reverse_bytes(int64_t value)
   {
     return int64_t(reverse_bytes(uint64_t(value)));
   }
@@ -765,41 +902,56 @@ namespace etl
   /// Count set bits. 8 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_bits(uint8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint8_t value)
   {
-    uint32_t count;
-
-    count = value - ((value >> 1) & 0x55);
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_popcount(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_POPCNT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(__popcnt(value));
+    }
+  #endif
+    uint32_t count = value - ((value >> 1) & 0x55);
     count = ((count >> 2) & 0x33) + (count & 0x33);
     count = ((count >> 4) + count) & 0x0F;
 
     return uint_least8_t(count);
+#endif
   }
 
-  inline uint_least8_t count_bits(int8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int8_t value)
   {
     return count_bits(uint8_t(value));
   }
-
 #endif
 
   //***************************************************************************
   /// Count set bits. 16 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_bits(uint16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint16_t value)
   {
-    uint32_t count;
-
-    count = value - ((value >> 1) & 0x5555);
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_popcount(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_POPCNT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(__popcnt16(value));
+    }
+  #endif
+    uint32_t count = value - ((value >> 1) & 0x5555);
     count = ((count >> 2) & 0x3333) + (count & 0x3333);
     count = ((count >> 4) + count) & 0x0F0F;
     count = ((count >> 8) + count) & 0x00FF;
 
-    return count;
+    return uint_least8_t(count);
+#endif
   }
 
-  inline uint_least8_t count_bits(int16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int16_t value)
   {
     return count_bits(uint16_t(value));
   }
@@ -808,20 +960,28 @@ namespace etl
   /// Count set bits. 32 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_bits(uint32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint32_t value)
   {
-    uint32_t count;
-
-    count = value - ((value >> 1) & 0x55555555);
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_popcountl(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_POPCNT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(__popcnt(value));
+    }
+  #endif
+    uint32_t count = value - ((value >> 1) & 0x55555555);
     count = ((count >> 2) & 0x33333333) + (count & 0x33333333);
     count = ((count >> 4)  + count) & 0x0F0F0F0F;
     count = ((count >> 8)  + count) & 0x00FF00FF;
     count = ((count >> 16) + count) & 0x0000FF;
 
     return uint_least8_t(count);
+#endif
   }
 
-  inline uint_least8_t count_bits(int32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int32_t value)
   {
     return count_bits(uint32_t(value));
   }
@@ -830,11 +990,18 @@ namespace etl
   /// Count set bits. 64 bits.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_bits(uint64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint64_t value)
   {
-    uint64_t count;
-
-    count = value - ((value >> 1) & 0x5555555555555555);
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_popcountll(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_POPCNT)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(__popcnt64(value));
+    }
+  #endif
+    uint64_t count = value - ((value >> 1) & 0x5555555555555555);
     count = ((count >> 2) & 0x3333333333333333) + (count & 0x3333333333333333);
     count = ((count >> 4)  + count) & 0x0F0F0F0F0F0F0F0F;
     count = ((count >> 8)  + count) & 0x00FF00FF00FF00FF;
@@ -842,9 +1009,10 @@ namespace etl
     count = ((count >> 32) + count) & 0x00000000FFFFFFFF;
 
     return uint_least8_t(count);
+#endif
   }
 
-  inline uint_least8_t count_bits(int64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int64_t value)
   {
     return count_bits(uint64_t(value));
   }
@@ -854,14 +1022,18 @@ namespace etl
   /// Parity. 8bits. 0 = even, 1 = odd
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t parity(uint8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint8_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_parity(value));
+#else
     value ^= value >> 4;
     value &= 0x0F;
     return (0x6996 >> value) & 1;
+#endif
   }
 
-  inline uint_least8_t parity(int8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int8_t value)
   {
     return parity(uint8_t(value));
   }
@@ -871,15 +1043,19 @@ namespace etl
   /// Parity. 16bits. 0 = even, 1 = odd
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t parity(uint16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint16_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_parity(value));
+#else
     value ^= value >> 8;
     value ^= value >> 4;
     value &= 0x0F;
     return (0x6996 >> value) & 1;
+#endif
   }
 
-  inline uint_least8_t parity(int16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int16_t value)
   {
     return parity(uint16_t(value));
   }
@@ -888,16 +1064,20 @@ namespace etl
   /// Parity. 32bits. 0 = even, 1 = odd
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t parity(uint32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint32_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_parityl(value));
+#else
     value ^= value >> 16;
     value ^= value >> 8;
     value ^= value >> 4;
     value &= 0x0F;
     return (0x6996 >> value) & 1;
+#endif
   }
 
-  inline uint_least8_t parity(int32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int32_t value)
   {
     return parity(uint32_t(value));
   }
@@ -906,38 +1086,53 @@ namespace etl
   /// Parity. 64bits. 0 = even, 1 = odd
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t parity(uint64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint64_t value)
   {
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_parityll(value));
+#else
     value ^= value >> 32;
     value ^= value >> 16;
     value ^= value >> 8;
     value ^= value >> 4;
     value &= 0x0F;
     return (0x69966996 >> value) & 1;
+#endif
   }
 
-  inline uint_least8_t parity(int64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int64_t value)
   {
     return parity(uint64_t(value));
   }
 
 #if ETL_8BIT_SUPPORT
   //***************************************************************************
-  /// Count trailing zeros. bit.
-  /// Uses a binary search.
+  /// Count trailing zeros. 8bit.
+  /// Returns 8 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_trailing_zeros(uint8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint8_t value)
   {
-    uint_least8_t count;
+    if (value == 0U)
+    {
+      return 8U;
+    }
 
-    if (value & 0x1)
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_ctz(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
     {
-      count = 0;
+      return uint_least8_t(private_binary::bit_scan_forward(value));
     }
-    else
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0x1) == 0)
     {
-      count = 1;
+      count = 1U;
 
       if ((value & 0xF) == 0)
       {
@@ -951,13 +1146,14 @@ namespace etl
         count += 2;
       }
 
-      count -= value & 0x1;
+      count -= uint_least8_t(value & 0x1);
     }
 
     return count;
+#endif
   }
 
-  inline uint_least8_t count_trailing_zeros(int8_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int8_t value)
   {
     return count_trailing_zeros(uint8_t(value));
   }
@@ -965,20 +1161,31 @@ namespace etl
 
   //***************************************************************************
   /// Count trailing zeros. 16bit.
-  /// Uses a binary search.
+  /// Returns 16 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_trailing_zeros(uint16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint16_t value)
   {
-    uint_least8_t count;
+    if (value == 0U)
+    {
+      return 16U;
+    }
 
-    if (value & 0x1)
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_ctz(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
     {
-      count = 0;
+      return uint_least8_t(private_binary::bit_scan_forward(value));
     }
-    else
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0x1) == 0)
     {
-      count = 1;
+      count = 1U;
 
       if ((value & 0xFF) == 0)
       {
@@ -998,33 +1205,45 @@ namespace etl
         count += 2;
       }
 
-      count -= value & 0x1;
+      count -= uint_least8_t(value & 0x1);
     }
 
     return count;
+#endif
   }
 
-  inline uint_least8_t count_trailing_zeros(int16_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int16_t value)
   {
     return count_trailing_zeros(uint16_t(value));
   }
 
   //***************************************************************************
   /// Count trailing zeros. 32bit.
-  /// Uses a binary search.
+  /// Returns 32 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_trailing_zeros(uint32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint32_t value)
   {
-    uint_least8_t count;
+    if (value == 0U)
+    {
+      return 32U;
+    }
 
-    if (value & 0x1)
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_ctzl(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
     {
-      count = 0;
+      return uint_least8_t(private_binary::bit_scan_forward(value));
     }
-    else
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0x1) == 0)
     {
-      count = 1;
+      count = 1U;
 
       if ((value & 0xFFFF) == 0)
       {
@@ -1050,75 +1269,380 @@ namespace etl
         count += 2;
       }
 
-      count -= value & 0x1;
+      count -= uint_least8_t(value & 0x1);
     }
 
     return count;
+#endif
   }
 
-  inline uint_least8_t count_trailing_zeros(int32_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int32_t value)
   {
     return count_trailing_zeros(uint32_t(value));
   }
 
   //***************************************************************************
   /// Count trailing zeros. 64bit.
-  /// Uses a binary search.
+  /// Returns 64 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
   ///\ingroup binary
   //***************************************************************************
-  inline uint_least8_t count_trailing_zeros(uint64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint64_t value)
   {
-      uint_least8_t count;
+    if (value == 0U)
+    {
+      return 64U;
+    }
+
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_ctzll(value));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(private_binary::bit_scan_forward(value));
+    }
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0x1) == 0)
+    {
+      count = 1U;
+
+      if ((value & 0xFFFFFFFF) == 0)
+      {
+        value >>= 32;
+        count += 32;
+      }
+
+      if ((value & 0xFFFF) == 0)
+      {
+        value >>= 16;
+        count += 16;
+      }
 
-      if (value & 0x1)
+      if ((value & 0xFF) == 0)
       {
-        count = 0;
+        value >>= 8;
+        count += 8;
       }
-      else
+
+      if ((value & 0xF) == 0)
       {
-        count = 1;
-
-        if ((value & 0xFFFFFFFF) == 0)
-        {
-          value >>= 32;
-          count += 32;
-        }
-
-        if ((value & 0xFFFF) == 0)
-        {
-          value >>= 16;
-          count += 16;
-        }
-
-        if ((value & 0xFF) == 0)
-        {
-          value >>= 8;
-          count += 8;
-        }
-
-        if ((value & 0xF) == 0)
-        {
-          value >>= 4;
-          count += 4;
-        }
-
-        if ((value & 0x3) == 0)
-        {
-          value >>= 2;
-          count += 2;
-        }
-
-        count -= value & 0x1;
+        value >>= 4;
+        count += 4;
       }
 
-      return count;
+      if ((value & 0x3) == 0)
+      {
+        value >>= 2;
+        count += 2;
+      }
+
+      count -= uint_least8_t(value & 0x1);
+    }
+
+    return count;
+#endif
   }
 
-  inline uint_least8_t count_trailing_zeros(int64_t value)
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int64_t value)
   {
     return count_trailing_zeros(uint64_t(value));
   }
 
+#if ETL_8BIT_SUPPORT
+  //***************************************************************************
+  /// Count leading zeros. 8bit.
+  /// Returns 8 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint8_t value)
+  {
+    if (value == 0U)
+    {
+      return 8U;
+    }
+
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_clz(value) - int((sizeof(unsigned int) - sizeof(uint8_t)) * 8U));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(7U - private_binary::bit_scan_reverse(value));
+    }
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0xF0) == 0)
+    {
+      value = uint8_t(value << 4);
+      count += 4;
+    }
+
+    if ((value & 0xC0) == 0)
+    {
+      value = uint8_t(value << 2);
+      count += 2;
+    }
+
+    if ((value & 0x80) == 0)
+    {
+      count += 1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int8_t value)
+  {
+    return count_leading_zeros(uint8_t(value));
+  }
+#endif
+
+  //***************************************************************************
+  /// Count leading zeros. 16bit.
+  /// Returns 16 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint16_t value)
+  {
+    if (value == 0U)
+    {
+      return 16U;
+    }
+
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_clz(value) - int((sizeof(unsigned int) - sizeof(uint16_t)) * 8U));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(15U - private_binary::bit_scan_reverse(value));
+    }
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0xFF00) == 0)
+    {
+      value = uint16_t(value << 8);
+      count += 8;
+    }
+
+    if ((value & 0xF000) == 0)
+    {
+      value = uint16_t(value << 4);
+      count += 4;
+    }
+
+    if ((value & 0xC000) == 0)
+    {
+      value = uint16_t(value << 2);
+      count += 2;
+    }
+
+    if ((value & 0x8000) == 0)
+    {
+      count += 1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int16_t value)
+  {
+    return count_leading_zeros(uint16_t(value));
+  }
+
+  //***************************************************************************
+  /// Count leading zeros. 32bit.
+  /// Returns 32 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint32_t value)
+  {
+    if (value == 0U)
+    {
+      return 32U;
+    }
+
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_clzl(value) - int((sizeof(unsigned long) - sizeof(uint32_t)) * 8U));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(31U - private_binary::bit_scan_reverse(value));
+    }
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0xFFFF0000) == 0)
+    {
+      value <<= 16;
+      count += 16;
+    }
+
+    if ((value & 0xFF000000) == 0)
+    {
+      value <<= 8;
+      count += 8;
+    }
+
+    if ((value & 0xF0000000) == 0)
+    {
+      value <<= 4;
+      count += 4;
+    }
+
+    if ((value & 0xC0000000) == 0)
+    {
+      value <<= 2;
+      count += 2;
+    }
+
+    if ((value & 0x80000000) == 0)
+    {
+      count += 1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int32_t value)
+  {
+    return count_leading_zeros(uint32_t(value));
+  }
+
+  //***************************************************************************
+  /// Count leading zeros. 64bit.
+  /// Returns 64 for a value of zero.
+  /// Uses a binary search when no intrinsic is available.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint64_t value)
+  {
+    if (value == 0U)
+    {
+      return 64U;
+    }
+
+#if defined(ETL_BINARY_USE_GCC_BUILTINS)
+    return uint_least8_t(__builtin_clzll(value) - int((sizeof(unsigned long long) - sizeof(uint64_t)) * 8U));
+#else
+  #if defined(ETL_BINARY_USE_MSVC_BITSCAN)
+    if (ETL_BINARY_NOT_CONSTANT_EVALUATED())
+    {
+      return uint_least8_t(63U - private_binary::bit_scan_reverse(value));
+    }
+  #endif
+    uint_least8_t count = 0U;
+
+    if ((value & 0xFFFFFFFF00000000) == 0)
+    {
+      value <<= 32;
+      count += 32;
+    }
+
+    if ((value & 0xFFFF000000000000) == 0)
+    {
+      value <<= 16;
+      count += 16;
+    }
+
+    if ((value & 0xFF00000000000000) == 0)
+    {
+      value <<= 8;
+      count += 8;
+    }
+
+    if ((value & 0xF000000000000000) == 0)
+    {
+      value <<= 4;
+      count += 4;
+    }
+
+    if ((value & 0xC000000000000000) == 0)
+    {
+      value <<= 2;
+      count += 2;
+    }
+
+    if ((value & 0x8000000000000000) == 0)
+    {
+      count += 1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int64_t value)
+  {
+    return count_leading_zeros(uint64_t(value));
+  }
+
+  //***************************************************************************
+  /// Integer base 2 log, rounded down.
+  /// The run time counterpart of etl::log2. ilog2(0) is 0, as for etl::log2.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t ilog2(uint32_t value)
+  {
+    return (value == 0U) ? 0U : uint_least8_t(31U - etl::count_leading_zeros(value));
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t ilog2(uint64_t value)
+  {
+    return (value == 0U) ? 0U : uint_least8_t(63U - etl::count_leading_zeros(value));
+  }
+
+  //***************************************************************************
+  /// Find the position of the first set bit.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_set_bit_position(T value)
+  {
+    return count_trailing_zeros(value);
+  }
+
+  //***************************************************************************
+  /// Find the position of the first clear bit.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_clear_bit_position(T value)
+  {
+    value = ~value;
+    return count_trailing_zeros(value);
+  }
+
+  //***************************************************************************
+  /// Find the position of the first bit that is clear or set.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_bit_position(bool state, T value)
+  {
+    if (!state)
+    {
+      value = ~value;
+    }
+
+    return count_trailing_zeros(value);
+  }
+
 #if ETL_8BIT_SUPPORT
   //*****************************************************************************
   /// Binary interleave
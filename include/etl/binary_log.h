@@ -0,0 +1,736 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BINARY_LOG_INCLUDED
+#define ETL_BINARY_LOG_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "char_traits.h"
+#include "cstring.h"
+#include "string_view.h"
+#include "format.h"
+
+///\defgroup binary_log binary_log
+/// A deferred logger. The producer copies a format id and the raw argument
+/// bytes into a lock free ring buffer; the text is formatted later by the consumer.
+/// Records are stored in the byte order of the producer.
+///\ingroup utilities
+
+#if ETL_HAS_ATOMIC && ETL_CPP11_SUPPORTED
+
+namespace etl
+{
+  namespace private_binary_log
+  {
+    /// The maximum number of arguments in a record.
+    static const size_t MAX_ARGUMENTS = 16U;
+
+    /// The size of the record header. A 16 bit id followed by a 16 bit payload length.
+    static const size_t HEADER_SIZE = 4U;
+
+    /// The maximum size of a record payload.
+    static const size_t MAX_PAYLOAD = 0xFFFFU;
+
+    //*************************************************************************
+    /// The argument tags.
+    /// Integral tags hold the size of the value in the lower nibble.
+    //*************************************************************************
+    enum
+    {
+      TAG_BOOL     = 0x01,
+      TAG_CHAR     = 0x02,
+      TAG_SIGNED   = 0x10,
+      TAG_UNSIGNED = 0x20,
+      TAG_FLOAT    = 0x34,
+      TAG_DOUBLE   = 0x38,
+      TAG_STRING   = 0x40,
+      TAG_POINTER  = 0x50
+    };
+
+    //*************************************************************************
+    /// The encoded sizes of the arguments.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value && !etl::is_same<T, char>::value, size_t>::type
+      encoded_size(const T&)
+    {
+      return 1U + sizeof(T);
+    }
+
+    inline size_t encoded_size(const bool&)
+    {
+      return 2U;
+    }
+
+    inline size_t encoded_size(const char&)
+    {
+      return 2U;
+    }
+
+    inline size_t encoded_size(const float&)
+    {
+      return 1U + sizeof(float);
+    }
+
+    inline size_t encoded_size(const double&)
+    {
+      return 1U + sizeof(double);
+    }
+
+    inline size_t encoded_size(const long double&)
+    {
+      return 1U + sizeof(double);
+    }
+
+    inline size_t encoded_size(const char* value)
+    {
+      return 3U + etl::strlen(value);
+    }
+
+    inline size_t encoded_size(char* value)
+    {
+      return 3U + etl::strlen(value);
+    }
+
+    inline size_t encoded_size(const etl::istring& value)
+    {
+      return 3U + value.size();
+    }
+
+    inline size_t encoded_size(const etl::string_view& value)
+    {
+      return 3U + value.size();
+    }
+
+    template <typename T>
+    size_t encoded_size(T* const&)
+    {
+      return 1U + sizeof(uintptr_t);
+    }
+
+    inline size_t payload_size()
+    {
+      return 0U;
+    }
+
+    template <typename T, typename... TRest>
+    size_t payload_size(const T& value, const TRest&... rest)
+    {
+      return encoded_size(value) + payload_size(rest...);
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup binary_log
+  /// The base of the binary log.
+  /// Supports one producer and one consumer. Neither side locks or allocates,
+  /// so 'write' may be called from an interrupt.
+  //***************************************************************************
+  class ibinary_log
+  {
+  public:
+
+    //*************************************************************************
+    /// Writes a record of the format id and arguments.
+    /// Call from the producer.
+    /// Returns false, and writes nothing, if there is not enough room.
+    //*************************************************************************
+    template <typename... TArgs>
+    bool write(uint16_t id, const TArgs&... args)
+    {
+      ETL_STATIC_ASSERT(sizeof...(TArgs) <= private_binary_log::MAX_ARGUMENTS, "Too many arguments");
+
+      const size_t payload = private_binary_log::payload_size(args...);
+
+      if (payload > private_binary_log::MAX_PAYLOAD)
+      {
+        return false;
+      }
+
+      size_t index = write_index.load(etl::memory_order_relaxed);
+
+      if ((private_binary_log::HEADER_SIZE + payload) > free_space(index, read_index.load(etl::memory_order_acquire)))
+      {
+        return false;
+      }
+
+      put_value(index, id);
+      put_value(index, uint16_t(payload));
+      encode(index, args...);
+
+      write_index.store(index, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the next record, or 0 if there are none.
+    /// Call from the consumer.
+    //*************************************************************************
+    size_t next_size() const
+    {
+      const size_t index = read_index.load(etl::memory_order_relaxed);
+
+      if (index == write_index.load(etl::memory_order_acquire))
+      {
+        return 0U;
+      }
+
+      uint8_t header[private_binary_log::HEADER_SIZE];
+      get(index, header, sizeof(header));
+
+      uint16_t payload;
+      memcpy(&payload, header + 2U, sizeof(payload));
+
+      return private_binary_log::HEADER_SIZE + payload;
+    }
+
+    //*************************************************************************
+    /// Copies the next record to 'record' and removes it from the log.
+    /// Call from the consumer.
+    /// Returns the size of the record, or 0 if there are none or it is larger
+    /// than 'max_size'. In that case the record is left in the log.
+    //*************************************************************************
+    size_t read(uint8_t* record, size_t max_size)
+    {
+      const size_t length = next_size();
+
+      if ((length == 0U) || (length > max_size))
+      {
+        return 0U;
+      }
+
+      const size_t index = read_index.load(etl::memory_order_relaxed);
+      get(index, record, length);
+
+      read_index.store(next_index(index, length), etl::memory_order_release);
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Removes all of the records.
+    /// Call from the consumer.
+    //*************************************************************************
+    void clear()
+    {
+      read_index.store(write_index.load(etl::memory_order_acquire), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Is the log empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return read_index.load(etl::memory_order_acquire) == write_index.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes used.
+    //*************************************************************************
+    size_t size() const
+    {
+      return capacity() - available();
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes free.
+    //*************************************************************************
+    size_t available() const
+    {
+      return free_space(write_index.load(etl::memory_order_acquire), read_index.load(etl::memory_order_acquire));
+    }
+
+    //*************************************************************************
+    /// Returns the capacity in bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return reserved - 1U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibinary_log(uint8_t* buffer_, size_t reserved_)
+      : buffer(buffer_),
+        reserved(reserved_),
+        write_index(0U),
+        read_index(0U)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The free space between the write and read indexes.
+    //*************************************************************************
+    size_t free_space(size_t write, size_t read) const
+    {
+      return (read > write) ? (read - write - 1U) : (reserved - (write - read) - 1U);
+    }
+
+    //*************************************************************************
+    /// Advances an index, wrapping at the end of the buffer.
+    //*************************************************************************
+    size_t next_index(size_t index, size_t n) const
+    {
+      index += n;
+
+      return (index >= reserved) ? (index - reserved) : index;
+    }
+
+    //*************************************************************************
+    /// Copies bytes to the buffer and advances the index.
+    //*************************************************************************
+    void put(size_t& index, const void* data, size_t n)
+    {
+      const size_t first = etl::min(n, reserved - index);
+
+      memcpy(buffer + index, data, first);
+      memcpy(buffer, static_cast<const uint8_t*>(data) + first, n - first);
+
+      index = next_index(index, n);
+    }
+
+    //*************************************************************************
+    /// Copies bytes from the buffer.
+    //*************************************************************************
+    void get(size_t index, void* data, size_t n) const
+    {
+      const size_t first = etl::min(n, reserved - index);
+
+      memcpy(data, buffer + index, first);
+      memcpy(static_cast<uint8_t*>(data) + first, buffer, n - first);
+    }
+
+    //*************************************************************************
+    /// Copies a value to the buffer.
+    //*************************************************************************
+    template <typename T>
+    void put_value(size_t& index, const T& value)
+    {
+      put(index, &value, sizeof(T));
+    }
+
+    void put_tag(size_t& index, int tag)
+    {
+      put_value(index, uint8_t(tag));
+    }
+
+    void put_text(size_t& index, const char* text, size_t length)
+    {
+      put_tag(index, private_binary_log::TAG_STRING);
+      put_value(index, uint16_t(length));
+      put(index, text, length);
+    }
+
+    //*************************************************************************
+    /// Encodes the arguments.
+    //*************************************************************************
+    void encode(size_t&)
+    {
+    }
+
+    template <typename T, typename... TRest>
+    void encode(size_t& index, const T& value, const TRest&... rest)
+    {
+      encode_value(index, value);
+      encode(index, rest...);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value && !etl::is_same<T, char>::value, void>::type
+      encode_value(size_t& index, const T& value)
+    {
+      put_tag(index, (etl::is_signed<T>::value ? private_binary_log::TAG_SIGNED : private_binary_log::TAG_UNSIGNED) | int(sizeof(T)));
+      put_value(index, value);
+    }
+
+    void encode_value(size_t& index, const bool& value)
+    {
+      put_tag(index, private_binary_log::TAG_BOOL);
+      put_value(index, uint8_t(value ? 1 : 0));
+    }
+
+    void encode_value(size_t& index, const char& value)
+    {
+      put_tag(index, private_binary_log::TAG_CHAR);
+      put_value(index, value);
+    }
+
+    void encode_value(size_t& index, const float& value)
+    {
+      put_tag(index, private_binary_log::TAG_FLOAT);
+      put_value(index, value);
+    }
+
+    void encode_value(size_t& index, const double& value)
+    {
+      put_tag(index, private_binary_log::TAG_DOUBLE);
+      put_value(index, value);
+    }
+
+    void encode_value(size_t& index, const long double& value)
+    {
+      encode_value(index, double(value));
+    }
+
+    void encode_value(size_t& index, const char* value)
+    {
+      put_text(index, value, etl::strlen(value));
+    }
+
+    void encode_value(size_t& index, char* value)
+    {
+      put_text(index, value, etl::strlen(value));
+    }
+
+    void encode_value(size_t& index, const etl::istring& value)
+    {
+      put_text(index, value.data(), value.size());
+    }
+
+    void encode_value(size_t& index, const etl::string_view& value)
+    {
+      put_text(index, value.data(), value.size());
+    }
+
+    template <typename T>
+    void encode_value(size_t& index, T* const& value)
+    {
+      put_tag(index, private_binary_log::TAG_POINTER);
+      put_value(index, reinterpret_cast<uintptr_t>(value));
+    }
+
+    // Disabled.
+    ibinary_log(const ibinary_log&) ETL_DELETE;
+    ibinary_log& operator =(const ibinary_log&) ETL_DELETE;
+
+    uint8_t*            buffer;      ///< The ring buffer.
+    const size_t        reserved;    ///< The size of the ring buffer.
+    etl::atomic<size_t> write_index; ///< Where the producer writes the next record.
+    etl::atomic<size_t> read_index;  ///< Where the consumer reads the next record.
+  };
+
+  //***************************************************************************
+  ///\ingroup binary_log
+  /// A binary log with a capacity of SIZE bytes.
+  //***************************************************************************
+  template <const size_t SIZE>
+  class binary_log : public etl::ibinary_log
+  {
+  public:
+
+    ETL_STATIC_ASSERT(SIZE > private_binary_log::HEADER_SIZE, "Size too small");
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    binary_log()
+      : ibinary_log(buffer, SIZE + 1U)
+    {
+    }
+
+  private:
+
+    uint8_t buffer[SIZE + 1U];
+  };
+
+  //***************************************************************************
+  ///\ingroup binary_log
+  /// Returns the format id of a record.
+  //***************************************************************************
+  inline uint16_t binary_log_id(const uint8_t* record)
+  {
+    uint16_t id;
+    memcpy(&id, record, sizeof(id));
+
+    return id;
+  }
+
+  namespace private_binary_log
+  {
+    //*************************************************************************
+    /// Storage for the decoded arguments.
+    //*************************************************************************
+    struct decoded_value
+    {
+      int64_t          i;
+      uint64_t         u;
+      float            f;
+      double           d;
+      bool             b;
+      char             c;
+      etl::string_view s;
+      const void*      p;
+    };
+
+    //*************************************************************************
+    /// Reads a value from the payload.
+    //*************************************************************************
+    template <typename T>
+    bool read_value(const uint8_t*& p, const uint8_t* end, T& value)
+    {
+      if (size_t(end - p) < sizeof(T))
+      {
+        return false;
+      }
+
+      memcpy(&value, p, sizeof(T));
+      p += sizeof(T);
+
+      return true;
+    }
+
+    template <typename TSigned, typename TUnsigned>
+    bool read_integral(const uint8_t*& p, const uint8_t* end, int tag, decoded_value& value, etl::private_format::argument& arg)
+    {
+      if ((tag & 0xF0) == TAG_SIGNED)
+      {
+        TSigned v;
+
+        if (!read_value(p, end, v))
+        {
+          return false;
+        }
+
+        value.i = v;
+        arg = etl::private_format::make_argument(value.i);
+      }
+      else
+      {
+        TUnsigned v;
+
+        if (!read_value(p, end, v))
+        {
+          return false;
+        }
+
+        value.u = v;
+        arg = etl::private_format::make_argument(value.u);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Decodes an argument.
+    //*************************************************************************
+    inline bool decode(const uint8_t*& p, const uint8_t* end, decoded_value& value, etl::private_format::argument& arg)
+    {
+      uint8_t tag;
+
+      if (!read_value(p, end, tag))
+      {
+        return false;
+      }
+
+      switch (tag)
+      {
+        case TAG_BOOL:
+        {
+          uint8_t v;
+
+          if (!read_value(p, end, v))
+          {
+            return false;
+          }
+
+          value.b = (v != 0U);
+          arg = etl::private_format::make_argument(value.b);
+          return true;
+        }
+
+        case TAG_CHAR:
+        {
+          if (!read_value(p, end, value.c))
+          {
+            return false;
+          }
+
+          arg = etl::private_format::make_argument(value.c);
+          return true;
+        }
+
+        case TAG_SIGNED | 1:
+        case TAG_UNSIGNED | 1:
+        {
+          return read_integral<int8_t, uint8_t>(p, end, tag, value, arg);
+        }
+
+        case TAG_SIGNED | 2:
+        case TAG_UNSIGNED | 2:
+        {
+          return read_integral<int16_t, uint16_t>(p, end, tag, value, arg);
+        }
+
+        case TAG_SIGNED | 4:
+        case TAG_UNSIGNED | 4:
+        {
+          return read_integral<int32_t, uint32_t>(p, end, tag, value, arg);
+        }
+
+        case TAG_SIGNED | 8:
+        case TAG_UNSIGNED | 8:
+        {
+          return read_integral<int64_t, uint64_t>(p, end, tag, value, arg);
+        }
+
+        case TAG_FLOAT:
+        {
+          if (!read_value(p, end, value.f))
+          {
+            return false;
+          }
+
+          arg = etl::private_format::make_argument(value.f);
+          return true;
+        }
+
+        case TAG_DOUBLE:
+        {
+          if (!read_value(p, end, value.d))
+          {
+            return false;
+          }
+
+          arg = etl::private_format::make_argument(value.d);
+          return true;
+        }
+
+        case TAG_STRING:
+        {
+          uint16_t length;
+
+          if (!read_value(p, end, length) || (size_t(end - p) < length))
+          {
+            return false;
+          }
+
+          value.s = etl::string_view(reinterpret_cast<const char*>(p), length);
+          p += length;
+          arg = etl::private_format::make_argument(value.s);
+          return true;
+        }
+
+        case TAG_POINTER:
+        {
+          uintptr_t v;
+
+          if (!read_value(p, end, v))
+          {
+            return false;
+          }
+
+          value.p = reinterpret_cast<const void*>(v);
+          arg = etl::private_format::make_argument(value.p);
+          return true;
+        }
+
+        default:
+        {
+          return false;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup binary_log
+  /// Appends the formatted text of a record to the string.
+  /// 'format' is the format string that the record's id refers to.
+  /// May be used by the consumer, or offline on a copy of the records.
+  /// Returns false, and appends nothing, if the record is malformed.
+  //***************************************************************************
+  inline bool binary_log_format(etl::istring& str, const char* format, const uint8_t* record, size_t length)
+  {
+    if (length < private_binary_log::HEADER_SIZE)
+    {
+      return false;
+    }
+
+    uint16_t payload;
+    memcpy(&payload, record + 2U, sizeof(payload));
+
+    if ((private_binary_log::HEADER_SIZE + payload) != length)
+    {
+      return false;
+    }
+
+    private_binary_log::decoded_value values[private_binary_log::MAX_ARGUMENTS];
+    private_format::argument          arguments[private_binary_log::MAX_ARGUMENTS];
+    size_t                            number_of_arguments = 0U;
+
+    const uint8_t* p   = record + private_binary_log::HEADER_SIZE;
+    const uint8_t* end = record + length;
+
+    while (p != end)
+    {
+      if ((number_of_arguments == private_binary_log::MAX_ARGUMENTS) ||
+          !private_binary_log::decode(p, end, values[number_of_arguments], arguments[number_of_arguments]))
+      {
+        return false;
+      }
+
+      ++number_of_arguments;
+    }
+
+    private_format::parser parser(format);
+    etl::format_segment    segment;
+
+    while (parser.next(segment))
+    {
+      private_format::write_segment(str, format, segment, arguments, number_of_arguments);
+    }
+
+    if (!parser.is_valid())
+    {
+      ETL_ALWAYS_ASSERT(ETL_ERROR(format_invalid));
+    }
+
+    return true;
+  }
+}
+
+#endif
+
+#endif
@@ -202,6 +202,35 @@ namespace etl
       return put_integral(value, width);
     }
 
+    //***************************************************************************
+    /// For arrays of integral types, each of the same width.
+    /// Nothing is written if there is not room for all of the values.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      put(const T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type value_t;
+
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        // Do we have enough bits?
+        if (bits_remaining >= (count * width))
+        {
+          for (size_t i = 0; i < count; ++i)
+          {
+            put_integral(static_cast<value_t>(values[i]), width);
+          }
+
+          success = true;
+        }
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// For floating point types
     //***************************************************************************
@@ -260,17 +289,9 @@ namespace etl
         // Do we have enough bits?
         if (bits_remaining >= width)
         {
-          value = 0;
-
-          // Get the bits from the stream.
-          while (width != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(etl::min(width, bits_in_byte));
-            unsigned char chunk = get_chunk(mask_width);
+          typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type value_t;
 
-            width -= mask_width;
-            value |= static_cast<T>(chunk) << width;
-          }
+          value = static_cast<T>(get_integral<value_t>(width));
 
           success = true;
         }
@@ -286,6 +307,43 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// For arrays of integral types, each of the same width.
+    /// Nothing is read if there are not enough bits for all of the values.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      get(T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type value_t;
+
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        // Do we have enough bits?
+        if (bits_remaining >= (count * width))
+        {
+          const bool sign_extend = etl::is_signed<T>::value && (width != (CHAR_BIT * sizeof(T)));
+
+          for (size_t i = 0; i < count; ++i)
+          {
+            values[i] = static_cast<T>(get_integral<value_t>(width));
+
+            if (sign_extend)
+            {
+              typedef typename etl::make_signed<T>::type ST;
+              values[i] = etl::sign_extend<ST, ST>(values[i], width);
+            }
+          }
+
+          success = true;
+        }
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// For floating point types
     //***************************************************************************
@@ -364,9 +422,11 @@ namespace etl
   private:
 
     //***************************************************************************
-    /// For unsigned integral types
+    /// For unsigned integral types.
+    /// Fills any partial char first, then stores whole chars directly.
     //***************************************************************************
-    bool put_integral(uint32_t value, uint_least8_t width)
+    template <typename TValue>
+    bool put_integral(TValue value, uint_least8_t width)
     {
       bool success = false;
 
@@ -375,18 +435,32 @@ namespace etl
         // Do we have enough bits?
         if (bits_remaining >= width)
         {
-          // Send the bits to the stream.
-          while (width != 0)
+          // Complete the current char.
+          if ((bits_in_byte != CHAR_BIT) && (width != 0))
           {
             unsigned char mask_width = static_cast<unsigned char>(etl::min(width, bits_in_byte));
             width -= mask_width;
-            uint32_t mask = ((uint32_t(1U) << mask_width) - 1U) << width;
+            TValue chunk = (value >> width) & ((TValue(1U) << mask_width) - 1U);
+
+            put_chunk(static_cast<unsigned char>(chunk << (bits_in_byte - mask_width)), mask_width);
+          }
 
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint32_t chunk = ((value & mask) >> width) << (bits_in_byte - mask_width);
+          // Whole chars.
+          while (width >= CHAR_BIT)
+          {
+            width -= CHAR_BIT;
+            pdata[byte_index++] = static_cast<unsigned char>(value >> width);
+            bits_remaining -= CHAR_BIT;
+          }
+
+          // The start of a new char.
+          if (width != 0)
+          {
+            TValue chunk = value & ((TValue(1U) << width) - 1U);
 
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
+            pdata[byte_index] = static_cast<unsigned char>(chunk << (CHAR_BIT - width));
+            bits_in_byte      = static_cast<unsigned char>(CHAR_BIT - width);
+            bits_remaining   -= width;
           }
 
           success = true;
@@ -397,36 +471,38 @@ namespace etl
     }
 
     //***************************************************************************
-    /// For unsigned integral types. 64bit
+    /// For unsigned integral types.
+    /// Reads any partial char first, then loads whole chars directly.
+    /// Assumes that there are enough bits remaining.
     //***************************************************************************
-    bool put_integral(uint64_t value, uint_least8_t width)
+    template <typename TValue>
+    TValue get_integral(uint_least8_t width)
     {
-      bool success = false;
+      TValue value = 0U;
 
-      if (pdata != nullptr)
+      // Complete the current char.
+      if ((bits_in_byte != CHAR_BIT) && (width != 0))
       {
-        // Do we have enough bits?
-        if (bits_remaining >= width)
-        {
-          // Send the bits to the stream.
-          while (width != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(etl::min(width, bits_in_byte));
-            width -= mask_width;
-            uint64_t mask = ((uint64_t(1U) << mask_width) - 1U) << width;
-
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint64_t chunk = ((value & mask) >> width) << (bits_in_byte - mask_width);
+        unsigned char mask_width = static_cast<unsigned char>(etl::min(width, bits_in_byte));
+        width -= mask_width;
+        value = get_chunk(mask_width);
+      }
 
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
-          }
+      // Whole chars.
+      while (width >= CHAR_BIT)
+      {
+        width -= CHAR_BIT;
+        value = (value << CHAR_BIT) | pdata[byte_index++];
+        bits_remaining -= CHAR_BIT;
+      }
 
-          success = true;
-        }
+      // The start of a new char.
+      if (width != 0)
+      {
+        value = (value << width) | get_chunk(static_cast<unsigned char>(width));
       }
 
-      return success;
+      return value;
     }
 
     //***************************************************************************
@@ -119,10 +119,14 @@ namespace etl
   protected:
 
     // The type used for each element in the array.
-#if !defined(ETL_BITSET_ELEMENT_TYPE)
-    typedef uint_least8_t element_t;
-#else
+    // 64 bit targets default to 64 bit elements, so that scans and bulk
+    // operations handle a machine word per step.
+#if defined(ETL_BITSET_ELEMENT_TYPE)
     typedef ETL_BITSET_ELEMENT_TYPE element_t;
+#elif ETL_PLATFORM_64BIT
+    typedef uint64_t element_t;
+#else
+    typedef uint_least8_t element_t;
 #endif
 
   public:
@@ -216,7 +220,7 @@ namespace etl
     //*************************************************************************
     /// The size of the bitset.
     //*************************************************************************
-    size_t size() const
+    ETL_CONSTEXPR14 size_t size() const
     {
       return NBITS;
     }
@@ -224,13 +228,13 @@ namespace etl
     //*************************************************************************
     /// Count the number of bits set.
     //*************************************************************************
-    size_t count() const
+    ETL_CONSTEXPR14 size_t count() const
     {
       size_t n = 0;
 
       for (size_t i = 0; i < SIZE; ++i)
       {
-        n += etl::count_bits(pdata[i]);
+        n += count_element(pdata[i]);
       }
 
       return n;
@@ -240,10 +244,10 @@ namespace etl
     /// Tests a bit at a position.
     /// Positions greater than the number of configured bits will return <b>false</b>.
     //*************************************************************************
-    bool test(size_t position) const
+    ETL_CONSTEXPR14 bool test(size_t position) const
     {
-      size_t    index;
-      element_t mask;
+      size_t    index = 0U;
+      element_t mask  = element_t(0);
 
       if (SIZE == 1)
       {
@@ -262,7 +266,7 @@ namespace etl
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    ibitset& set()
+    ETL_CONSTEXPR14 ibitset& set()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -277,10 +281,10 @@ namespace etl
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    ibitset& set(size_t position, bool value = true)
+    ETL_CONSTEXPR14 ibitset& set(size_t position, bool value = true)
     {
-      size_t    index;
-      element_t bit;
+      size_t    index = 0U;
+      element_t bit   = element_t(0);
 
       if (SIZE == 1)
       {
@@ -397,30 +401,33 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      T v = T(0);
+      // Assemble in the unsigned type, as shifting into the sign bit is undefined.
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      unsigned_t v = unsigned_t(0);
 
-      const bool OK = (sizeof(T) * CHAR_BIT) >= (SIZE * BITS_PER_ELEMENT);
+      const bool OK = (sizeof(T) * CHAR_BIT) >= NBITS;
 
       ETL_ASSERT(OK, ETL_ERROR(etl::bitset_type_too_small));
 
       if (OK)
       {
-        T shift = T(0);
+        size_t shift = 0;
 
         for (size_t i = 0; i < SIZE; ++i)
         {
-          v |= T(pdata[i]) << shift;
-          shift += T(BITS_PER_ELEMENT);
+          v |= unsigned_t(unsigned_t(pdata[i]) << shift);
+          shift += BITS_PER_ELEMENT;
         }
       }
 
-      return v;
+      return T(v);
     }
 
     //*************************************************************************
     /// Resets the bitset.
     //*************************************************************************
-    ibitset& reset()
+    ETL_CONSTEXPR14 ibitset& reset()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -433,10 +440,10 @@ namespace etl
     //*************************************************************************
     /// Reset the bit at the position.
     //*************************************************************************
-    ibitset& reset(size_t position)
+    ETL_CONSTEXPR14 ibitset& reset(size_t position)
     {
-      size_t       index;
-      element_t bit;
+      size_t    index = 0U;
+      element_t bit   = element_t(0);
 
       if (SIZE == 1)
       {
@@ -561,6 +568,11 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
+      if (position >= NBITS)
+      {
+        return ibitset::npos;
+      }
+
       // Where to start.
       size_t index;
       size_t bit;
@@ -576,51 +588,33 @@ namespace etl
         bit = position & (BITS_PER_ELEMENT - 1);
       }
 
-      element_t mask = 1 << bit;
+      // Search for set bits, inverting the elements if looking for clear ones.
+      const element_t invert = state ? ALL_CLEAR : ALL_SET;
+
+      // Ignore the bits before the start position.
+      element_t value = element_t(pdata[index] ^ invert) & element_t(ALL_SET << bit);
 
       // For each element in the bitset...
-      while (index < SIZE)
+      while (value == ALL_CLEAR)
       {
-        element_t value = pdata[index];
-
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
-        {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
+        if (++index == SIZE)
         {
-          position += BITS_PER_ELEMENT;
+          return ibitset::npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
-
-        ++index;
+        value = element_t(pdata[index] ^ invert);
       }
 
-      return ibitset::npos;
+      position = (index * BITS_PER_ELEMENT) + lowest_bit(value);
+
+      // The unused bits of the last element read as clear, so may be found when searching for clear bits.
+      return (position < NBITS) ? position : size_t(ibitset::npos);
     }
 
     //*************************************************************************
     /// Read [] operator.
     //*************************************************************************
-    bool operator[] (size_t position) const
+    ETL_CONSTEXPR14 bool operator[] (size_t position) const
     {
       return test(position);
     }
@@ -680,6 +674,7 @@ namespace etl
       if (SIZE == 1)
       {
         pdata[0] <<= shift;
+        pdata[0] &= TOP_MASK;
       }
       else
       {
@@ -754,7 +749,7 @@ namespace etl
     //*************************************************************************
     /// Initialise from an unsigned long long.
     //*************************************************************************
-    ibitset& initialise(unsigned long long value)
+    ETL_CONSTEXPR14 ibitset& initialise(unsigned long long value)
     {
       reset();
 
@@ -803,14 +798,22 @@ namespace etl
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
-    ibitset(size_t nbits_, size_t size_, element_t* pdata_)
-      : NBITS(nbits_),
+    ETL_CONSTEXPR ibitset(size_t nbits_, size_t size_, element_t* pdata_)
+      : TOP_MASK(top_mask(nbits_, size_)),
+        NBITS(nbits_),
         SIZE(size_),
         pdata(pdata_)
     {
-      size_t allocated_bits = SIZE * BITS_PER_ELEMENT;
-      size_t top_mask_shift = ((BITS_PER_ELEMENT - (allocated_bits - NBITS)) % BITS_PER_ELEMENT);
-      TOP_MASK = element_t(top_mask_shift == 0 ? ALL_SET : ~(ALL_SET << top_mask_shift));
+    }
+
+    //*************************************************************************
+    /// The mask of the used bits in the last element.
+    //*************************************************************************
+    static ETL_CONSTEXPR element_t top_mask(size_t nbits_, size_t size_)
+    {
+      return (((BITS_PER_ELEMENT - ((size_ * BITS_PER_ELEMENT) - nbits_)) % BITS_PER_ELEMENT) == 0)
+               ? ALL_SET
+               : element_t(~(ALL_SET << ((BITS_PER_ELEMENT - ((size_ * BITS_PER_ELEMENT) - nbits_)) % BITS_PER_ELEMENT)));
     }
 
     //*************************************************************************
@@ -825,6 +828,22 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Counts the set bits in an element.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t count_element(element_t value)
+    {
+      return size_t(etl::count_bits(value));
+    }
+
+    //*************************************************************************
+    /// The position of the lowest set bit in a non-zero element.
+    //*************************************************************************
+    static size_t lowest_bit(element_t value)
+    {
+      return size_t(etl::count_trailing_zeros(value));
+    }
+
     // Disable copy construction.
     ibitset(const ibitset&);
 
@@ -842,9 +861,14 @@ namespace etl
     }
 #else
   protected:
+#if ETL_CPP11_SUPPORTED
+    // Trivial, so that a bitset may be constexpr.
+    ~ibitset() = default;
+#else
     ~ibitset()
     {
     }
+#endif
 #endif
   };
 
@@ -870,26 +894,31 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    bitset()
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+    ETL_CONSTEXPR14 bitset()
+      : etl::ibitset(MAXN, ARRAY_SIZE, data),
+        data()
     {
-      reset();
     }
 
     //*************************************************************************
     /// Copy constructor.
     //*************************************************************************
-    bitset(const bitset<MAXN>& other)
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+    ETL_CONSTEXPR14 bitset(const bitset<MAXN>& other)
+      : etl::ibitset(MAXN, ARRAY_SIZE, data),
+        data()
     {
-      etl::copy_n(other.data, ARRAY_SIZE, data);
+      for (size_t i = 0U; i < ARRAY_SIZE; ++i)
+      {
+        data[i] = other.data[i];
+      }
     }
 
     //*************************************************************************
     /// Construct from a value.
     //*************************************************************************
-    bitset(unsigned long long value)
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+    ETL_CONSTEXPR14 bitset(unsigned long long value)
+      : etl::ibitset(MAXN, ARRAY_SIZE, data),
+        data()
     {
       initialise(value);
     }
@@ -906,7 +935,7 @@ namespace etl
     //*************************************************************************
     /// Set all of the bits.
     //*************************************************************************
-    bitset<MAXN>& set()
+    ETL_CONSTEXPR14 bitset<MAXN>& set()
     {
       etl::ibitset::set();
       return *this;
@@ -915,7 +944,7 @@ namespace etl
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    bitset<MAXN>& set(size_t position, bool value = true)
+    ETL_CONSTEXPR14 bitset<MAXN>& set(size_t position, bool value = true)
     {
       etl::ibitset::set(position, value);
       return *this;
@@ -979,7 +1008,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= (ARRAY_SIZE * BITS_PER_ELEMENT), "Type too small");
+      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= MAXN, "Type too small");
 
       return ibitset::value<T>();
     }
@@ -987,7 +1016,7 @@ namespace etl
     //*************************************************************************
     /// Reset all of the bits.
     //*************************************************************************
-    bitset<MAXN>& reset()
+    ETL_CONSTEXPR14 bitset<MAXN>& reset()
     {
       ibitset::reset();
       return *this;
@@ -996,7 +1025,7 @@ namespace etl
     //*************************************************************************
     /// Reset the bit at the position.
     //*************************************************************************
-    bitset<MAXN>& reset(size_t position)
+    ETL_CONSTEXPR14 bitset<MAXN>& reset(size_t position)
     {
       etl::ibitset::reset(position);
       return *this;
@@ -1127,6 +1156,90 @@ namespace etl
     element_t data[ARRAY_SIZE];
   };
 
+  //*************************************************************************
+  /// A bitset whose bits are kept in a buffer supplied by the user, so that
+  /// where it lives, and its size, are decided when it is constructed.
+  /// The buffer must be aligned to ALIGNMENT, hold buffer_size(nbits) bytes
+  /// and outlive the bitset.
+  ///\ingroup bitset
+  //*************************************************************************
+  class bitset_ext : public etl::ibitset
+  {
+  public:
+
+    typedef ibitset::element_t element_type;
+
+    static const size_t ALIGNMENT = etl::alignment_of<element_type>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    /// All of the bits are reset.
+    ///\param buffer The memory for the bits.
+    ///\param nbits  The number of bits.
+    //*************************************************************************
+    bitset_ext(void* buffer, size_t nbits)
+      : etl::ibitset(nbits, number_of_elements(nbits), static_cast<element_type*>(buffer))
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Construct from a value.
+    //*************************************************************************
+    bitset_ext(unsigned long long value, void* buffer, size_t nbits)
+      : etl::ibitset(nbits, number_of_elements(nbits), static_cast<element_type*>(buffer))
+    {
+      initialise(value);
+    }
+
+    //*************************************************************************
+    /// Construct from a string.
+    //*************************************************************************
+    bitset_ext(const char* text, void* buffer, size_t nbits)
+      : etl::ibitset(nbits, number_of_elements(nbits), static_cast<element_type*>(buffer))
+    {
+      ETL_ASSERT(text != 0, ETL_ERROR(bitset_nullptr));
+      set(text);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for nbits bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t nbits)
+    {
+      return number_of_elements(nbits) * sizeof(element_type);
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    bitset_ext& operator =(const ibitset& other)
+    {
+      etl::ibitset::operator =(other);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    bitset_ext& operator =(const bitset_ext& other)
+    {
+      etl::ibitset::operator =(other);
+      return *this;
+    }
+
+  private:
+
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t number_of_elements(size_t nbits)
+    {
+      return (nbits + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT;
+    }
+
+    // The buffer belongs to the user, so cannot be copied.
+    bitset_ext(const bitset_ext&);
+  };
+
   //***************************************************************************
   /// operator &
   ///\ingroup bitset
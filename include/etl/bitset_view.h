@@ -0,0 +1,516 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BITSET_VIEW_INCLUDED
+#define ETL_BITSET_VIEW_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "binary.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup bitset_view bitset_view
+/// A bitset over an externally owned array of unsigned words, such as a
+/// bit-packed buffer filled by DMA, so that it may be modified in place.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A view of a bitset held in external words.
+  /// Bit N is bit (N % bits per word) of word (N / bits per word).
+  /// Bits of the last word beyond size() are neither read nor written.
+  /// The bulk operations work a word at a time, in a loop that the compiler
+  /// is able to vectorise.
+  ///\tparam TElement The unsigned word type, such as uint32_t or uint64_t.
+  ///\ingroup bitset_view
+  //***************************************************************************
+  template <typename TElement>
+  class bitset_view
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TElement>::value && etl::is_unsigned<TElement>::value, "The element type must be an unsigned integral");
+
+    typedef TElement element_type;
+
+    static const element_type ALL_SET          = etl::integral_limits<element_type>::max;
+    static const element_type ALL_CLEAR        = 0;
+    static const size_t       BITS_PER_ELEMENT = etl::integral_limits<element_type>::bits;
+
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pdata_ The words of the bitset.
+    ///\param nbits_ The number of bits.
+    //*************************************************************************
+    bitset_view(element_type* pdata_, size_t nbits_)
+      : pdata(pdata_),
+        NBITS(nbits_),
+        SIZE((nbits_ + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT),
+        TOP_MASK(top_mask(nbits_))
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bits.
+    //*************************************************************************
+    size_t size() const
+    {
+      return NBITS;
+    }
+
+    //*************************************************************************
+    /// The number of words.
+    //*************************************************************************
+    size_t words() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// The words of the bitset.
+    //*************************************************************************
+    element_type* data()
+    {
+      return pdata;
+    }
+
+    //*************************************************************************
+    /// The words of the bitset.
+    //*************************************************************************
+    const element_type* data() const
+    {
+      return pdata;
+    }
+
+    //*************************************************************************
+    /// Count the number of bits set.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        n += size_t(etl::count_bits(word(i)));
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Tests a bit at a position.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      return (pdata[index_of(position)] & bit_of(position)) != 0;
+    }
+
+    //*************************************************************************
+    /// Read [] operator.
+    //*************************************************************************
+    bool operator [](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// Sets all of the bits.
+    //*************************************************************************
+    bitset_view& set()
+    {
+      if (SIZE != 0U)
+      {
+        for (size_t i = 0U; i < (SIZE - 1U); ++i)
+        {
+          pdata[i] = ALL_SET;
+        }
+
+        pdata[SIZE - 1U] |= TOP_MASK;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Sets the bit at the position.
+    //*************************************************************************
+    bitset_view& set(size_t position, bool value = true)
+    {
+      if (value)
+      {
+        pdata[index_of(position)] |= bit_of(position);
+      }
+      else
+      {
+        pdata[index_of(position)] &= element_type(~bit_of(position));
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Resets all of the bits.
+    //*************************************************************************
+    bitset_view& reset()
+    {
+      if (SIZE != 0U)
+      {
+        for (size_t i = 0U; i < (SIZE - 1U); ++i)
+        {
+          pdata[i] = ALL_CLEAR;
+        }
+
+        pdata[SIZE - 1U] &= element_type(~TOP_MASK);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Resets the bit at the position.
+    //*************************************************************************
+    bitset_view& reset(size_t position)
+    {
+      return set(position, false);
+    }
+
+    //*************************************************************************
+    /// Flips all of the bits.
+    //*************************************************************************
+    bitset_view& flip()
+    {
+      if (SIZE != 0U)
+      {
+        for (size_t i = 0U; i < (SIZE - 1U); ++i)
+        {
+          pdata[i] = element_type(~pdata[i]);
+        }
+
+        pdata[SIZE - 1U] ^= TOP_MASK;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flips the bit at the position.
+    //*************************************************************************
+    bitset_view& flip(size_t position)
+    {
+      pdata[index_of(position)] ^= bit_of(position);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Are all of the bits set?
+    //*************************************************************************
+    bool all() const
+    {
+      if (SIZE == 0U)
+      {
+        return true;
+      }
+
+      for (size_t i = 0U; i < (SIZE - 1U); ++i)
+      {
+        if (pdata[i] != ALL_SET)
+        {
+          return false;
+        }
+      }
+
+      return word(SIZE - 1U) == TOP_MASK;
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const
+    {
+      return !none();
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        if (word(i) != ALL_CLEAR)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_first(bool state) const
+    {
+      return find_next(state, 0U);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_next(bool state, size_t position) const
+    {
+      if (position >= NBITS)
+      {
+        return npos;
+      }
+
+      size_t index = index_of(position);
+
+      // Search for set bits, inverting the words if looking for clear ones.
+      const element_type invert = state ? ALL_CLEAR : ALL_SET;
+
+      // Ignore the bits before the start position.
+      element_type value = element_type(element_type(pdata[index] ^ invert) & element_type(ALL_SET << (position % BITS_PER_ELEMENT)));
+
+      while (value == ALL_CLEAR)
+      {
+        if (++index == SIZE)
+        {
+          return npos;
+        }
+
+        value = element_type(pdata[index] ^ invert);
+      }
+
+      position = (index * BITS_PER_ELEMENT) + size_t(etl::count_trailing_zeros(value));
+
+      // The bits of the last word beyond the view are not part of it.
+      return (position < NBITS) ? position : size_t(npos);
+    }
+
+    //*************************************************************************
+    /// this &= other, over the bits common to both.
+    //*************************************************************************
+    bitset_view& and_assign(const bitset_view& other)
+    {
+      const size_t n = common_size(other);
+
+      element_type*       p = pdata;
+      const element_type* q = other.pdata;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p[i] &= q[i];
+      }
+
+      apply_last(other, and_op());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// this |= other, over the bits common to both.
+    //*************************************************************************
+    bitset_view& or_assign(const bitset_view& other)
+    {
+      const size_t n = common_size(other);
+
+      element_type*       p = pdata;
+      const element_type* q = other.pdata;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p[i] |= q[i];
+      }
+
+      apply_last(other, or_op());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// this ^= other, over the bits common to both.
+    //*************************************************************************
+    bitset_view& xor_assign(const bitset_view& other)
+    {
+      const size_t n = common_size(other);
+
+      element_type*       p = pdata;
+      const element_type* q = other.pdata;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p[i] ^= q[i];
+      }
+
+      apply_last(other, xor_op());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// this &= ~other, over the bits common to both.
+    /// Clears the bits that are set in other.
+    //*************************************************************************
+    bitset_view& andnot_assign(const bitset_view& other)
+    {
+      const size_t n = common_size(other);
+
+      element_type*       p = pdata;
+      const element_type* q = other.pdata;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p[i] &= element_type(~q[i]);
+      }
+
+      apply_last(other, andnot_op());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Are the bits of the two views equal?
+    //*************************************************************************
+    friend bool operator ==(const bitset_view& lhs, const bitset_view& rhs)
+    {
+      if (lhs.NBITS != rhs.NBITS)
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < lhs.SIZE; ++i)
+      {
+        if (lhs.word(i) != rhs.word(i))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Are the bits of the two views not equal?
+    //*************************************************************************
+    friend bool operator !=(const bitset_view& lhs, const bitset_view& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    struct and_op    { element_type operator()(element_type a, element_type b) const { return element_type(a & b); } };
+    struct or_op     { element_type operator()(element_type a, element_type b) const { return element_type(a | b); } };
+    struct xor_op    { element_type operator()(element_type a, element_type b) const { return element_type(a ^ b); } };
+    struct andnot_op { element_type operator()(element_type a, element_type b) const { return element_type(a & ~b); } };
+
+    //*************************************************************************
+    /// The mask of the bits of the last word that are in a view of nbits_.
+    //*************************************************************************
+    static element_type top_mask(size_t nbits_)
+    {
+      const size_t used = nbits_ % BITS_PER_ELEMENT;
+
+      return (used == 0U) ? ALL_SET : element_type(~(ALL_SET << used));
+    }
+
+    //*************************************************************************
+    /// The word at the index, without the bits beyond the view.
+    //*************************************************************************
+    element_type word(size_t index) const
+    {
+      return (index == (SIZE - 1U)) ? element_type(pdata[index] & TOP_MASK) : pdata[index];
+    }
+
+    //*************************************************************************
+    static size_t index_of(size_t position)
+    {
+      return position / BITS_PER_ELEMENT;
+    }
+
+    //*************************************************************************
+    static element_type bit_of(size_t position)
+    {
+      return element_type(element_type(1) << (position % BITS_PER_ELEMENT));
+    }
+
+    //*************************************************************************
+    /// The number of whole words that may be combined without masking.
+    /// The last common word is handled by apply_last().
+    //*************************************************************************
+    size_t common_size(const bitset_view& other) const
+    {
+      const size_t n = (SIZE < other.SIZE) ? SIZE : other.SIZE;
+
+      return (n == 0U) ? 0U : n - 1U;
+    }
+
+    //*************************************************************************
+    /// Combines the last common word, leaving the bits outside of either view.
+    //*************************************************************************
+    template <typename TOperation>
+    void apply_last(const bitset_view& other, TOperation operation)
+    {
+      if ((SIZE != 0U) && (other.SIZE != 0U))
+      {
+        const size_t       index = ((SIZE < other.SIZE) ? SIZE : other.SIZE) - 1U;
+        const element_type mask  = top_mask((NBITS < other.NBITS) ? NBITS : other.NBITS);
+
+        pdata[index] = element_type((pdata[index] & element_type(~mask)) | (operation(pdata[index], other.pdata[index]) & mask));
+      }
+    }
+
+    element_type* pdata;
+    size_t        NBITS;
+    size_t        SIZE;
+    element_type  TOP_MASK;
+  };
+}
+
+#endif
@@ -38,6 +38,10 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "algorithm.h"
+#include "static_assert.h"
+
+#include <stdint.h>
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -56,6 +60,79 @@ namespace etl
         return 0;
       }
     };
+
+    //*************************************************************************
+    /// Derives a second hash from the first, for filters given only one hash.
+    /// The murmur3 32 bit finaliser.
+    //*************************************************************************
+    inline size_t derive_hash(size_t hash)
+    {
+      uint32_t h = uint32_t(etl::fold_bits<uint64_t, 32>(uint64_t(hash)));
+
+      h ^= h >> 16;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16;
+
+      return size_t(h);
+    }
+
+    //*************************************************************************
+    /// Spreads a hash over 64 bits.
+    /// The murmur3 64 bit finaliser.
+    //*************************************************************************
+    inline uint64_t mix_hash64(uint64_t hash)
+    {
+      hash ^= hash >> 33;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Kirsch-Mitzenmacher probing within one block.
+    /// The block is selected by the first hash. The probes are
+    /// slot(i) = (a + i.b) % SLOTS where 'a' is the rest of the first hash
+    /// and 'b' is the second hash, forced odd so that the probes are distinct.
+    //*************************************************************************
+    template <const size_t NUMBER_OF_BLOCKS, const size_t SLOTS>
+    class block_probe
+    {
+    public:
+
+      ETL_STATIC_ASSERT((SLOTS & (SLOTS - 1)) == 0, "SLOTS must be a power of 2");
+
+      block_probe(size_t hash1, size_t hash2)
+        : block(hash1 % NUMBER_OF_BLOCKS),
+          slot(hash1 / NUMBER_OF_BLOCKS),
+          step(hash2 | 1U)
+      {
+      }
+
+      /// The block to probe.
+      size_t get_block() const
+      {
+        return block;
+      }
+
+      /// The next slot in the block.
+      size_t next()
+      {
+        const size_t current = slot & (SLOTS - 1);
+        slot += step;
+        return current;
+      }
+
+    private:
+
+      size_t block;
+      size_t slot;
+      size_t step;
+    };
   }
 
   //***************************************************************************
@@ -184,6 +261,333 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// The filter is split into 512 bit (64 byte) blocks. Each key probes
+  /// NPROBES bits, all in the same block, so a lookup touches one block of
+  /// memory. Place the filter on a 64 byte boundary to make each block a
+  /// single cache line.
+  /// The probes are derived from two hashes by double hashing. If THash2 is
+  /// omitted the second hash is derived from the first.
+  ///\tparam DESIRED_WIDTH The desired number of bits. Rounded up to a whole number of blocks.
+  ///\tparam NPROBES       The number of bits probed per key.
+  ///\tparam THash1        The first hash generator class.
+  ///\tparam THash2        The second hash generator class. If omitted, uses the null hash.
+  /// The hash classes must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            const size_t NPROBES,
+            typename     THash1,
+            typename     THash2 = private_bloom_filter::null_hash>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+    typedef private_bloom_filter::null_hash null_hash;
+
+    static const size_t BLOCK_BITS     = 512U;
+    static const size_t BLOCK_ELEMENTS = BLOCK_BITS / 64U;
+
+  public:
+
+    ETL_STATIC_ASSERT(NPROBES > 0, "At least one probe is required");
+
+    enum
+    {
+      NUMBER_OF_BLOCKS = (DESIRED_WIDTH + BLOCK_BITS - 1) / BLOCK_BITS,
+      WIDTH            = NUMBER_OF_BLOCKS * BLOCK_BITS,
+      PROBES           = NPROBES
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      etl::fill_n(&blocks[0][0], size_t(NUMBER_OF_BLOCKS) * BLOCK_ELEMENTS, uint64_t(0U));
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      probe_t   probe = get_probe(key);
+      uint64_t* block = blocks[probe.get_block()];
+
+      for (size_t i = 0; i < NPROBES; ++i)
+      {
+        const size_t bit = probe.next();
+        block[bit / 64U] |= uint64_t(1U) << (bit % 64U);
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      probe_t         probe = get_probe(key);
+      const uint64_t* block = blocks[probe.get_block()];
+
+      for (size_t i = 0; i < NPROBES; ++i)
+      {
+        const size_t bit = probe.next();
+
+        if ((block[bit / 64U] & (uint64_t(1U) << (bit % 64U))) == 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0;
+
+      for (size_t i = 0; i < NUMBER_OF_BLOCKS; ++i)
+      {
+        for (size_t j = 0; j < BLOCK_ELEMENTS; ++j)
+        {
+          n += etl::count_bits(blocks[i][j]);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    typedef private_bloom_filter::block_probe<NUMBER_OF_BLOCKS, BLOCK_BITS> probe_t;
+
+    //***************************************************************************
+    /// Gets the probe sequence for the key.
+    //***************************************************************************
+    probe_t get_probe(parameter_t key) const
+    {
+      const size_t hash1 = THash1()(key);
+      const size_t hash2 = etl::is_same<THash2, null_hash>::value ? private_bloom_filter::derive_hash(hash1) : THash2()(key);
+
+      return probe_t(hash1, hash2);
+    }
+
+    /// The Bloom filter blocks.
+    uint64_t blocks[NUMBER_OF_BLOCKS][BLOCK_ELEMENTS];
+  };
+
+  //***************************************************************************
+  /// A counting Bloom filter, that supports removal of keys.
+  /// Each slot is an 8 bit counter. The counters are split into blocks of 64
+  /// (64 bytes) and each key probes NPROBES counters in the same block.
+  /// A counter that reaches 255 is saturated and is never decremented, so
+  /// that removals can never cause false negatives.
+  /// The probes are derived from two hashes by double hashing. If THash2 is
+  /// omitted the second hash is derived from the first.
+  ///\tparam DESIRED_WIDTH The desired number of counters. Rounded up to a whole number of blocks.
+  ///\tparam NPROBES       The number of counters probed per key.
+  ///\tparam THash1        The first hash generator class.
+  ///\tparam THash2        The second hash generator class. If omitted, uses the null hash.
+  /// The hash classes must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            const size_t NPROBES,
+            typename     THash1,
+            typename     THash2 = private_bloom_filter::null_hash>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+    typedef private_bloom_filter::null_hash null_hash;
+
+    static const size_t  BLOCK_SLOTS = 64U;
+    static const uint8_t SATURATED   = 255U;
+
+  public:
+
+    ETL_STATIC_ASSERT(NPROBES > 0, "At least one probe is required");
+
+    enum
+    {
+      NUMBER_OF_BLOCKS = (DESIRED_WIDTH + BLOCK_SLOTS - 1) / BLOCK_SLOTS,
+      WIDTH            = NUMBER_OF_BLOCKS * BLOCK_SLOTS,
+      PROBES           = NPROBES
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      etl::fill_n(&counters[0][0], size_t(NUMBER_OF_BLOCKS) * BLOCK_SLOTS, uint8_t(0U));
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      probe_t  probe = get_probe(key);
+      uint8_t* block = counters[probe.get_block()];
+
+      for (size_t i = 0; i < NPROBES; ++i)
+      {
+        uint8_t& counter = block[probe.next()];
+
+        if (counter != SATURATED)
+        {
+          ++counter;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Only remove keys that have been added, or other keys may be lost.
+    ///\param  key The key to remove.
+    ///\return <b>false</b> if the key was not in the filter, and nothing was changed.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      if (!exists(key))
+      {
+        return false;
+      }
+
+      probe_t  probe = get_probe(key);
+      uint8_t* block = counters[probe.get_block()];
+
+      for (size_t i = 0; i < NPROBES; ++i)
+      {
+        uint8_t& counter = block[probe.next()];
+
+        if (counter != SATURATED)
+        {
+          --counter;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      probe_t        probe = get_probe(key);
+      const uint8_t* block = counters[probe.get_block()];
+
+      for (size_t i = 0; i < NPROBES; ++i)
+      {
+        if (block[probe.next()] == 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of non-zero counters.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0;
+
+      for (size_t i = 0; i < NUMBER_OF_BLOCKS; ++i)
+      {
+        for (size_t j = 0; j < BLOCK_SLOTS; ++j)
+        {
+          n += (counters[i][j] != 0U) ? 1U : 0U;
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    typedef private_bloom_filter::block_probe<NUMBER_OF_BLOCKS, BLOCK_SLOTS> probe_t;
+
+    //***************************************************************************
+    /// Gets the probe sequence for the key.
+    //***************************************************************************
+    probe_t get_probe(parameter_t key) const
+    {
+      const size_t hash1 = THash1()(key);
+      const size_t hash2 = etl::is_same<THash2, null_hash>::value ? private_bloom_filter::derive_hash(hash1) : THash2()(key);
+
+      return probe_t(hash1, hash2);
+    }
+
+    /// The Bloom filter counters.
+    uint8_t counters[NUMBER_OF_BLOCKS][BLOCK_SLOTS];
+  };
 }
 
 #endif
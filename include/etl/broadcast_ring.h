@@ -0,0 +1,330 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BROADCAST_RING_INCLUDED
+#define ETL_BROADCAST_RING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "integral_limits.h"
+
+///\defgroup broadcast_ring broadcast_ring
+/// A single producer, multiple consumer ring where every consumer sees every value.
+/// Each consumer has its own cursor over the shared buffer, so a value is
+/// stored once however many consumers read it. The producer waits for the
+/// slowest consumer.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup broadcast_ring
+  /// The base of the broadcast ring.
+  ///\tparam T The type of value that the ring holds.
+  //***************************************************************************
+  template <typename T>
+  class ibroadcast_ring
+  {
+  public:
+
+    typedef T        value_type;      ///< The type stored in the ring.
+    typedef T&       reference;       ///< A reference to the type used in the ring.
+    typedef const T& const_reference; ///< A const reference to the type used in the ring.
+    typedef size_t   size_type;       ///< The type used for determining the size of the ring.
+
+    //*************************************************************************
+    /// A consumer's position in the ring.
+    /// Padded so that each consumer writes to its own cache line.
+    //*************************************************************************
+    struct cursor
+    {
+      etl::atomic<size_type> position;
+#if ETL_CACHE_LINE_SIZE > 0
+      char                   padding[ETL_CACHE_LINE_SIZE];
+#endif
+    };
+
+    //*************************************************************************
+    /// Push a value to the ring.
+    /// Call from the producer.
+    /// Returns false if the slowest consumer has not released the slot.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      const size_type position = write.load(etl::memory_order_relaxed);
+
+      if (!has_space(position))
+      {
+        return false;
+      }
+
+      p_buffer[position & mask] = value;
+
+      write.store(position + 1U, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the consumer's next value, without copying it,
+    /// or nullptr if there are none.
+    /// The value remains valid until the consumer calls pop.
+    /// Call from the consumer.
+    //*************************************************************************
+    const T* front(size_t consumer) const
+    {
+      const size_type position = p_cursors[consumer].position.load(etl::memory_order_relaxed);
+
+      if (position == write.load(etl::memory_order_acquire))
+      {
+        return nullptr;
+      }
+
+      return &p_buffer[position & mask];
+    }
+
+    //*************************************************************************
+    /// Copies the consumer's next value and moves past it.
+    /// Returns false if there are none.
+    /// Call from the consumer.
+    //*************************************************************************
+    bool pop(size_t consumer, reference value)
+    {
+      const T* p_value = front(consumer);
+
+      if (p_value == nullptr)
+      {
+        return false;
+      }
+
+      value = *p_value;
+
+      return pop(consumer);
+    }
+
+    //*************************************************************************
+    /// Moves the consumer past its next value.
+    /// Returns false if there are none.
+    /// Call from the consumer.
+    //*************************************************************************
+    bool pop(size_t consumer)
+    {
+      etl::atomic<size_type>& position = p_cursors[consumer].position;
+
+      const size_type current = position.load(etl::memory_order_relaxed);
+
+      if (current == write.load(etl::memory_order_acquire))
+      {
+        return false;
+      }
+
+      position.store(current + 1U, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// How many values are waiting for the consumer?
+    //*************************************************************************
+    size_type size(size_t consumer) const
+    {
+      const size_type position = p_cursors[consumer].position.load(etl::memory_order_acquire);
+
+      return write.load(etl::memory_order_acquire) - position;
+    }
+
+    //*************************************************************************
+    /// Are there no values waiting for the consumer?
+    //*************************************************************************
+    bool empty(size_t consumer) const
+    {
+      return size(consumer) == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the ring full?
+    /// Accurate from the producer.
+    //*************************************************************************
+    bool full() const
+    {
+      const size_type position = write.load(etl::memory_order_relaxed);
+
+      return (position - slowest()) == capacity();
+    }
+
+    //*************************************************************************
+    /// How many values can the ring hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return mask + 1U;
+    }
+
+    //*************************************************************************
+    /// How many values can the ring hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return mask + 1U;
+    }
+
+    //*************************************************************************
+    /// How many consumers read the ring.
+    //*************************************************************************
+    size_t consumers() const
+    {
+      return number_of_consumers;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    ibroadcast_ring(T* p_buffer_, cursor* p_cursors_, size_type max_size_, size_t number_of_consumers_)
+      : p_buffer(p_buffer_),
+        p_cursors(p_cursors_),
+        mask(max_size_ - 1U),
+        number_of_consumers(number_of_consumers_),
+        write(0U),
+        slowest_cache(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the consumers' starting positions.
+    /// Called by the derived class once its cursors have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < number_of_consumers; ++i)
+      {
+        p_cursors[i].position.store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The position of the slowest consumer.
+    //*************************************************************************
+    size_type slowest() const
+    {
+      const size_type position = write.load(etl::memory_order_relaxed);
+
+      size_type lag = 0U;
+
+      for (size_t i = 0U; i < number_of_consumers; ++i)
+      {
+        const size_type behind = position - p_cursors[i].position.load(etl::memory_order_acquire);
+
+        if (behind > lag)
+        {
+          lag = behind;
+        }
+      }
+
+      return position - lag;
+    }
+
+    //*************************************************************************
+    /// Is there room for the value at 'position'?
+    /// Only scans the consumers when the cached slowest position says the ring is full.
+    //*************************************************************************
+    bool has_space(size_type position)
+    {
+      if ((position - slowest_cache) == capacity())
+      {
+        slowest_cache = slowest();
+      }
+
+      return (position - slowest_cache) != capacity();
+    }
+
+    // Disable copy construction and assignment.
+    ibroadcast_ring(const ibroadcast_ring&) ETL_DELETE;
+    ibroadcast_ring& operator =(const ibroadcast_ring&) ETL_DELETE;
+
+    T*                     p_buffer;            ///< The shared values.
+    cursor*                p_cursors;           ///< The consumers' positions.
+    const size_type        mask;                ///< The size of the buffer minus one.
+    const size_t           number_of_consumers; ///< The number of cursors.
+    etl::atomic<size_type> write;               ///< The position of the next push.
+    size_type              slowest_cache;       ///< The producer's copy of the slowest position.
+  };
+
+  //***************************************************************************
+  ///\ingroup broadcast_ring
+  /// A broadcast ring with fixed capacity and number of consumers.
+  /// Consumers are identified by an index in the range [0, CONSUMERS).
+  ///\tparam T         The type this ring should support.
+  ///\tparam SIZE      The maximum capacity of the ring. Must be a power of two.
+  ///\tparam CONSUMERS The number of consumers.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, const size_t CONSUMERS>
+  class broadcast_ring : public etl::ibroadcast_ring<T>
+  {
+  private:
+
+    typedef etl::ibroadcast_ring<T> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(((SIZE != 0U) && ((SIZE & (SIZE - 1U)) == 0U)), "Size must be a power of two");
+    ETL_STATIC_ASSERT((CONSUMERS != 0U), "There must be at least one consumer");
+
+    static const size_t MAX_SIZE      = SIZE;
+    static const size_t MAX_CONSUMERS = CONSUMERS;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    broadcast_ring()
+      : base_t(buffer, cursors, SIZE, CONSUMERS)
+    {
+      base_t::initialise();
+    }
+
+  private:
+
+    T                       buffer[SIZE];       ///< The shared values.
+    typename base_t::cursor cursors[CONSUMERS]; ///< The consumers' positions.
+  };
+}
+
+#endif
+
+#endif
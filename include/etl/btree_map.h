@@ -0,0 +1,1684 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "pool.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "nullptr.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "63"
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, implemented as a B+tree.
+/// Elements are held, in order, in leaves of up to NODE_KEYS entries that are
+/// linked for iteration. Inner nodes hold only separator keys and child links,
+/// so a lookup touches a few compact nodes instead of one node per level of a
+/// binary tree.
+/// Has insertion, erasure and lookup of O(logN).
+/// Duplicate entries are not allowed.
+/// Iterators are invalidated by insertion and erasure.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public etl::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_bounds : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_map.
+  /// Can be used as a reference type for all btree_map containing a specific type.
+  ///\tparam NODE_KEYS_ The maximum number of entries in a node.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_KEYS_, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    typedef const key_type&    key_parameter_t;
+    typedef const mapped_type& mapped_parameter_t;
+
+    static const size_t NODE_KEYS = NODE_KEYS_;
+
+    ETL_STATIC_ASSERT(NODE_KEYS_ >= 3U, "btree_map nodes must hold at least 3 keys");
+
+  protected:
+
+    /// The fewest entries in a leaf, other than the root.
+    static const size_t MIN_LEAF_SIZE = (NODE_KEYS_ + 1U) / 2U;
+
+    /// The fewest keys in an inner node, other than the root.
+    static const size_t MIN_INNER_KEYS = NODE_KEYS_ / 2U;
+
+    //*************************************************************************
+    /// The common part of the nodes.
+    //*************************************************************************
+    struct node
+    {
+      size_t count;
+      bool   is_leaf;
+    };
+
+    //*************************************************************************
+    /// A leaf node, holding the elements.
+    /// Has room for one extra element, so that a full node can take an
+    /// insertion before it is split.
+    //*************************************************************************
+    struct leaf_node : public node
+    {
+      value_type* values()
+      {
+        return reinterpret_cast<value_type*>(&storage);
+      }
+
+      const value_type* values() const
+      {
+        return reinterpret_cast<const value_type*>(&storage);
+      }
+
+      leaf_node* p_previous;
+      leaf_node* p_next;
+      typename etl::aligned_storage<sizeof(value_type) * (NODE_KEYS_ + 1U), etl::alignment_of<value_type>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// An inner node, holding the separator keys and the child links.
+    /// children[i] holds the keys less than keys[i].
+    //*************************************************************************
+    struct inner_node : public node
+    {
+      key_type* keys()
+      {
+        return reinterpret_cast<key_type*>(&storage);
+      }
+
+      const key_type* keys() const
+      {
+        return reinterpret_cast<const key_type*>(&storage);
+      }
+
+      node* children[NODE_KEYS_ + 2U];
+      typename etl::aligned_storage<sizeof(key_type) * (NODE_KEYS_ + 1U), etl::alignment_of<key_type>::value>::type storage;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(nullptr),
+          p_leaf(nullptr),
+          index(0U)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_map(other.p_map),
+          p_leaf(other.p_leaf),
+          index(other.index)
+      {
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_map  = other.p_map;
+        p_leaf = other.p_leaf;
+        index  = other.index;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &p_leaf->values()[index];
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->p_next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (p_leaf == nullptr)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->p_previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(ibtree_map* p_map_, leaf_node* p_leaf_, size_t index_)
+        : p_map(p_map_),
+          p_leaf(p_leaf_),
+          index(index_)
+      {
+      }
+
+      ibtree_map* p_map;
+      leaf_node*  p_leaf;
+      size_t      index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+
+      const_iterator()
+        : p_map(nullptr),
+          p_leaf(nullptr),
+          index(0U)
+      {
+      }
+
+      const_iterator(const typename ibtree_map::iterator& other)
+        : p_map(other.p_map),
+          p_leaf(other.p_leaf),
+          index(other.index)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_map(other.p_map),
+          p_leaf(other.p_leaf),
+          index(other.index)
+      {
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_map  = other.p_map;
+        p_leaf = other.p_leaf;
+        index  = other.index;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_leaf->values()[index];
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->p_next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (p_leaf == nullptr)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->p_previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ibtree_map* p_map_, const leaf_node* p_leaf_, size_t index_)
+        : p_map(p_map_),
+          p_leaf(p_leaf_),
+          index(index_)
+      {
+      }
+
+      const ibtree_map* p_map;
+      const leaf_node*  p_leaf;
+      size_t            index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the btree_map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the btree_map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, nullptr, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the btree_map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, nullptr, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the btree_map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, nullptr, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the btree_map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the btree_map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      iterator i_element = lower_bound(key);
+
+      if ((i_element == end()) || compare(key, i_element->first))
+      {
+        i_element = insert(value_type(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      if (full())
+      {
+        iterator i_element = find(value.first);
+
+        if (i_element != end())
+        {
+          return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+        }
+
+        ETL_ASSERT(false, ETL_ERROR(btree_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (p_root == nullptr)
+      {
+        leaf_node* p_leaf = create_leaf();
+        p_root  = p_leaf;
+        p_first = p_leaf;
+        p_last  = p_leaf;
+      }
+
+      insert_result result;
+      result.p_split = nullptr;
+
+      insert_node(p_root, value, result);
+
+      // Grow a new root if the old one was split.
+      if (result.p_split != nullptr)
+      {
+        inner_node* p_new_root = create_inner();
+        p_new_root->children[0] = p_root;
+        add_child(p_new_root, 0U, result.p_split);
+        p_root = p_new_root;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, result.p_leaf, result.index), result.inserted);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      if (p_root == nullptr)
+      {
+        return 0U;
+      }
+
+      if (!erase_node(p_root, key))
+      {
+        return 0U;
+      }
+
+      // Shrink the tree if the root has been emptied.
+      if (p_root->count == 0U)
+      {
+        if (p_root->is_leaf)
+        {
+          leaf_pool.release(p_root);
+          p_root  = nullptr;
+          p_first = nullptr;
+          p_last  = nullptr;
+        }
+        else
+        {
+          node* p_old_root = p_root;
+          p_root = static_cast<inner_node*>(p_old_root)->children[0];
+          inner_pool.release(p_old_root);
+        }
+      }
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const_iterator i_next = i_element;
+      ++i_next;
+
+      // Rebalancing may move the following element, so find it again by key.
+      if (i_next == cend())
+      {
+        erase(key_type(i_element->first));
+        return end();
+      }
+      else
+      {
+        const key_type next_key = i_next->first;
+        erase(key_type(i_element->first));
+        return lower_bound(next_key);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the last erased one.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_t n = etl::distance(first, last);
+      iterator i_element(this, const_cast<leaf_node*>(first.p_leaf), first.index);
+
+      while (n-- != 0U)
+      {
+        i_element = erase(i_element);
+      }
+
+      return i_element;
+    }
+
+    //*************************************************************************
+    /// Clears the btree_map.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != nullptr)
+      {
+        release_node(p_root);
+      }
+
+      p_root       = nullptr;
+      p_first      = nullptr;
+      p_last       = nullptr;
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && compare(key, i_element->first))
+      {
+        i_element = end();
+      }
+
+      return i_element;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const_iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && compare(key, i_element->first))
+      {
+        i_element = end();
+      }
+
+      return i_element;
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      const_iterator i_element = static_cast<const ibtree_map&>(*this).lower_bound(key);
+
+      return iterator(this, const_cast<leaf_node*>(i_element.p_leaf), i_element.index);
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      if (p_root == nullptr)
+      {
+        return end();
+      }
+
+      const leaf_node* p_leaf = find_leaf(key);
+
+      return make_const_iterator(p_leaf, leaf_lower_bound(p_leaf, key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      const_iterator i_element = static_cast<const ibtree_map&>(*this).upper_bound(key);
+
+      return iterator(this, const_cast<leaf_node*>(i_element.p_leaf), i_element.index);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      if (p_root == nullptr)
+      {
+        return end();
+      }
+
+      const leaf_node* p_leaf = find_leaf(key);
+
+      return make_const_iterator(p_leaf, leaf_upper_bound(p_leaf, key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the btree_map.
+    ///\return The current size of the btree_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the btree_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the btree_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the btree_map.
+    ///\return The capacity of the btree_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the btree_map.
+    ///\return The maximum size of the btree_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_map(etl::ipool& leaf_pool_, etl::ipool& inner_pool_, size_t max_size_)
+      : p_root(nullptr),
+        p_first(nullptr),
+        p_last(nullptr),
+        current_size(0U),
+        MAX_SIZE(max_size_),
+        leaf_pool(leaf_pool_),
+        inner_pool(inner_pool_)
+    {
+    }
+
+  private:
+
+    //*********************************************************************
+    /// The result of inserting in to a sub-tree.
+    //*********************************************************************
+    struct insert_result
+    {
+      leaf_node* p_leaf;   ///< The leaf holding the element.
+      size_t     index;    ///< The index of the element in the leaf.
+      bool       inserted; ///< Was the element inserted?
+      node*      p_split;  ///< The new right sibling if the sub-tree root was split.
+    };
+
+    //*********************************************************************
+    /// Moves an object to uninitialised memory, destroying the original.
+    //*********************************************************************
+    template <typename T>
+    static void relocate(T* p_destination, T* p_source)
+    {
+#if ETL_CPP11_SUPPORTED
+      ::new (p_destination) T(etl::move(*p_source));
+#else
+      ::new (p_destination) T(*p_source);
+#endif
+      p_source->~T();
+    }
+
+    //*********************************************************************
+    /// Moves 'n' objects to uninitialised memory, destroying the originals.
+    /// The ranges may overlap.
+    //*********************************************************************
+    template <typename T>
+    static void relocate_n(T* p_destination, T* p_source, size_t n)
+    {
+      if (p_destination < p_source)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          relocate(p_destination + i, p_source + i);
+        }
+      }
+      else
+      {
+        while (n != 0U)
+        {
+          --n;
+          relocate(p_destination + n, p_source + n);
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Moves 'n' child links. The ranges may overlap.
+    //*********************************************************************
+    static void move_children(node** p_destination, node** p_source, size_t n)
+    {
+      if (p_destination < p_source)
+      {
+        etl::copy(p_source, p_source + n, p_destination);
+      }
+      else
+      {
+        etl::copy_backward(p_source, p_source + n, p_destination + n);
+      }
+    }
+
+    //*********************************************************************
+    /// The index of the first element in the leaf not less than the key.
+    //*********************************************************************
+    size_t leaf_lower_bound(const leaf_node* p_leaf, key_parameter_t key) const
+    {
+      const value_type* p_values = p_leaf->values();
+      size_t first = 0U;
+      size_t n     = p_leaf->count;
+
+      while (n > 0U)
+      {
+        const size_t half = n / 2U;
+
+        if (compare(p_values[first + half].first, key))
+        {
+          first += half + 1U;
+          n     -= half + 1U;
+        }
+        else
+        {
+          n = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************************************************
+    /// The index of the first element in the leaf greater than the key.
+    //*********************************************************************
+    size_t leaf_upper_bound(const leaf_node* p_leaf, key_parameter_t key) const
+    {
+      const value_type* p_values = p_leaf->values();
+      size_t first = 0U;
+      size_t n     = p_leaf->count;
+
+      while (n > 0U)
+      {
+        const size_t half = n / 2U;
+
+        if (!compare(key, p_values[first + half].first))
+        {
+          first += half + 1U;
+          n     -= half + 1U;
+        }
+        else
+        {
+          n = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************************************************
+    /// The index of the child of an inner node that may hold the key.
+    //*********************************************************************
+    size_t child_index(const inner_node* p_inner, key_parameter_t key) const
+    {
+      const key_type* p_keys = p_inner->keys();
+
+      return size_t(etl::upper_bound(p_keys, p_keys + p_inner->count, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// Finds the leaf that may hold the key.
+    //*********************************************************************
+    const leaf_node* find_leaf(key_parameter_t key) const
+    {
+      const node* p_node = p_root;
+
+      while (!p_node->is_leaf)
+      {
+        const inner_node* p_inner = static_cast<const inner_node*>(p_node);
+        p_node = p_inner->children[child_index(p_inner, key)];
+      }
+
+      return static_cast<const leaf_node*>(p_node);
+    }
+
+    //*********************************************************************
+    /// Makes an iterator for an index in a leaf, which may be one past its end.
+    //*********************************************************************
+    const_iterator make_const_iterator(const leaf_node* p_leaf, size_t index) const
+    {
+      if (index == p_leaf->count)
+      {
+        p_leaf = p_leaf->p_next;
+        index  = 0U;
+      }
+
+      return const_iterator(this, p_leaf, index);
+    }
+
+    //*********************************************************************
+    /// Creates an empty leaf.
+    //*********************************************************************
+    leaf_node* create_leaf()
+    {
+      leaf_node* p_leaf = leaf_pool.template allocate<leaf_node>();
+
+      p_leaf->count      = 0U;
+      p_leaf->is_leaf    = true;
+      p_leaf->p_previous = nullptr;
+      p_leaf->p_next     = nullptr;
+
+      return p_leaf;
+    }
+
+    //*********************************************************************
+    /// Creates an empty inner node.
+    //*********************************************************************
+    inner_node* create_inner()
+    {
+      inner_node* p_inner = inner_pool.template allocate<inner_node>();
+
+      p_inner->count   = 0U;
+      p_inner->is_leaf = false;
+
+      return p_inner;
+    }
+
+    //*********************************************************************
+    /// Destroys the contents of a sub-tree and returns its nodes to the pools.
+    //*********************************************************************
+    void release_node(node* p_node)
+    {
+      if (p_node->is_leaf)
+      {
+        leaf_node* p_leaf = static_cast<leaf_node*>(p_node);
+        etl::destroy(p_leaf->values(), p_leaf->values() + p_leaf->count);
+        leaf_pool.release(p_leaf);
+      }
+      else
+      {
+        inner_node* p_inner = static_cast<inner_node*>(p_node);
+
+        for (size_t i = 0U; i <= p_inner->count; ++i)
+        {
+          release_node(p_inner->children[i]);
+        }
+
+        etl::destroy(p_inner->keys(), p_inner->keys() + p_inner->count);
+        inner_pool.release(p_inner);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value in to the sub-tree rooted at p_node.
+    //*********************************************************************
+    void insert_node(node* p_node, const_reference value, insert_result& result)
+    {
+      if (p_node->is_leaf)
+      {
+        insert_leaf(static_cast<leaf_node*>(p_node), value, result);
+      }
+      else
+      {
+        inner_node* p_inner = static_cast<inner_node*>(p_node);
+        const size_t i = child_index(p_inner, value.first);
+
+        insert_node(p_inner->children[i], value, result);
+
+        if (result.p_split != nullptr)
+        {
+          node* p_split = result.p_split;
+          result.p_split = nullptr;
+
+          add_child(p_inner, i, p_split);
+
+          if (p_inner->count > NODE_KEYS)
+          {
+            result.p_split = split_inner(p_inner);
+          }
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value in to a leaf, splitting it if it overflows.
+    //*********************************************************************
+    void insert_leaf(leaf_node* p_leaf, const_reference value, insert_result& result)
+    {
+      value_type* p_values = p_leaf->values();
+      size_t index = leaf_lower_bound(p_leaf, value.first);
+
+      result.inserted = false;
+
+      if ((index == p_leaf->count) || compare(value.first, p_values[index].first))
+      {
+        relocate_n(p_values + index + 1U, p_values + index, p_leaf->count - index);
+        ::new (p_values + index) value_type(value);
+        ++p_leaf->count;
+        ++current_size;
+        result.inserted = true;
+
+        if (p_leaf->count > NODE_KEYS)
+        {
+          leaf_node* p_right = split_leaf(p_leaf);
+          result.p_split = p_right;
+
+          if (index >= p_leaf->count)
+          {
+            index -= p_leaf->count;
+            p_leaf = p_right;
+          }
+        }
+      }
+
+      result.p_leaf = p_leaf;
+      result.index  = index;
+    }
+
+    //*********************************************************************
+    /// Moves the upper half of a leaf to a new right sibling.
+    //*********************************************************************
+    leaf_node* split_leaf(leaf_node* p_leaf)
+    {
+      leaf_node* p_right = create_leaf();
+      const size_t mid = p_leaf->count / 2U;
+
+      relocate_n(p_right->values(), p_leaf->values() + mid, p_leaf->count - mid);
+      p_right->count = p_leaf->count - mid;
+      p_leaf->count  = mid;
+
+      p_right->p_previous = p_leaf;
+      p_right->p_next     = p_leaf->p_next;
+
+      if (p_leaf->p_next != nullptr)
+      {
+        p_leaf->p_next->p_previous = p_right;
+      }
+      else
+      {
+        p_last = p_right;
+      }
+
+      p_leaf->p_next = p_right;
+
+      return p_right;
+    }
+
+    //*********************************************************************
+    /// Moves the upper half of an inner node to a new right sibling.
+    /// The middle key is left constructed just past the end of the node's
+    /// keys, to be moved up to the parent by add_child.
+    //*********************************************************************
+    inner_node* split_inner(inner_node* p_inner)
+    {
+      inner_node* p_right = create_inner();
+      const size_t mid = p_inner->count / 2U;
+
+      p_right->count = p_inner->count - mid - 1U;
+      relocate_n(p_right->keys(), p_inner->keys() + mid + 1U, p_right->count);
+      move_children(p_right->children, p_inner->children + mid + 1U, p_right->count + 1U);
+      p_inner->count = mid;
+
+      return p_right;
+    }
+
+    //*********************************************************************
+    /// Adds the new right sibling of children[i] to an inner node.
+    //*********************************************************************
+    void add_child(inner_node* p_inner, size_t i, node* p_new)
+    {
+      node*     p_child = p_inner->children[i];
+      key_type* p_keys  = p_inner->keys();
+
+      relocate_n(p_keys + i + 1U, p_keys + i, p_inner->count - i);
+      move_children(p_inner->children + i + 2U, p_inner->children + i + 1U, p_inner->count - i);
+
+      if (p_child->is_leaf)
+      {
+        ::new (p_keys + i) key_type(static_cast<leaf_node*>(p_new)->values()[0].first);
+      }
+      else
+      {
+        relocate(p_keys + i, static_cast<inner_node*>(p_child)->keys() + p_child->count);
+      }
+
+      p_inner->children[i + 1U] = p_new;
+      ++p_inner->count;
+    }
+
+    //*********************************************************************
+    /// Erases a key from the sub-tree rooted at p_node.
+    /// Rebalances any child left with too few entries.
+    //*********************************************************************
+    bool erase_node(node* p_node, key_parameter_t key)
+    {
+      if (p_node->is_leaf)
+      {
+        leaf_node*  p_leaf   = static_cast<leaf_node*>(p_node);
+        value_type* p_values = p_leaf->values();
+        const size_t index   = leaf_lower_bound(p_leaf, key);
+
+        if ((index == p_leaf->count) || compare(key, p_values[index].first))
+        {
+          return false;
+        }
+
+        etl::destroy_at(p_values + index);
+        relocate_n(p_values + index, p_values + index + 1U, p_leaf->count - index - 1U);
+        --p_leaf->count;
+        --current_size;
+
+        return true;
+      }
+      else
+      {
+        inner_node* p_inner = static_cast<inner_node*>(p_node);
+        const size_t i = child_index(p_inner, key);
+
+        if (!erase_node(p_inner->children[i], key))
+        {
+          return false;
+        }
+
+        if (is_underfull(p_inner->children[i]))
+        {
+          rebalance(p_inner, i);
+        }
+
+        return true;
+      }
+    }
+
+    //*********************************************************************
+    /// Does the node have too few entries?
+    //*********************************************************************
+    static bool is_underfull(const node* p_node)
+    {
+      if (p_node->is_leaf)
+      {
+        return p_node->count < MIN_LEAF_SIZE;
+      }
+      else
+      {
+        return p_node->count < MIN_INNER_KEYS;
+      }
+    }
+
+    //*********************************************************************
+    /// Can the node give an entry to a sibling?
+    //*********************************************************************
+    static bool can_lend(const node* p_node)
+    {
+      if (p_node->is_leaf)
+      {
+        return p_node->count > MIN_LEAF_SIZE;
+      }
+      else
+      {
+        return p_node->count > MIN_INNER_KEYS;
+      }
+    }
+
+    //*********************************************************************
+    /// Refills children[i] from a sibling, or merges it with one.
+    //*********************************************************************
+    void rebalance(inner_node* p_parent, size_t i)
+    {
+      if ((i > 0U) && can_lend(p_parent->children[i - 1U]))
+      {
+        borrow_from_left(p_parent, i);
+      }
+      else if ((i < p_parent->count) && can_lend(p_parent->children[i + 1U]))
+      {
+        borrow_from_right(p_parent, i);
+      }
+      else if (i > 0U)
+      {
+        merge_children(p_parent, i - 1U);
+      }
+      else
+      {
+        merge_children(p_parent, i);
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the last entry of children[i - 1] to children[i].
+    //*********************************************************************
+    void borrow_from_left(inner_node* p_parent, size_t i)
+    {
+      key_type* p_separator = p_parent->keys() + i - 1U;
+
+      if (p_parent->children[i]->is_leaf)
+      {
+        leaf_node* p_left  = static_cast<leaf_node*>(p_parent->children[i - 1U]);
+        leaf_node* p_child = static_cast<leaf_node*>(p_parent->children[i]);
+
+        relocate_n(p_child->values() + 1U, p_child->values(), p_child->count);
+        relocate(p_child->values(), p_left->values() + p_left->count - 1U);
+        --p_left->count;
+        ++p_child->count;
+
+        *p_separator = p_child->values()[0].first;
+      }
+      else
+      {
+        inner_node* p_left  = static_cast<inner_node*>(p_parent->children[i - 1U]);
+        inner_node* p_child = static_cast<inner_node*>(p_parent->children[i]);
+
+        relocate_n(p_child->keys() + 1U, p_child->keys(), p_child->count);
+        move_children(p_child->children + 1U, p_child->children, p_child->count + 1U);
+        relocate(p_child->keys(), p_separator);
+        p_child->children[0] = p_left->children[p_left->count];
+        relocate(p_separator, p_left->keys() + p_left->count - 1U);
+        --p_left->count;
+        ++p_child->count;
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the first entry of children[i + 1] to children[i].
+    //*********************************************************************
+    void borrow_from_right(inner_node* p_parent, size_t i)
+    {
+      key_type* p_separator = p_parent->keys() + i;
+
+      if (p_parent->children[i]->is_leaf)
+      {
+        leaf_node* p_child = static_cast<leaf_node*>(p_parent->children[i]);
+        leaf_node* p_right = static_cast<leaf_node*>(p_parent->children[i + 1U]);
+
+        relocate(p_child->values() + p_child->count, p_right->values());
+        relocate_n(p_right->values(), p_right->values() + 1U, p_right->count - 1U);
+        ++p_child->count;
+        --p_right->count;
+
+        *p_separator = p_right->values()[0].first;
+      }
+      else
+      {
+        inner_node* p_child = static_cast<inner_node*>(p_parent->children[i]);
+        inner_node* p_right = static_cast<inner_node*>(p_parent->children[i + 1U]);
+
+        relocate(p_child->keys() + p_child->count, p_separator);
+        p_child->children[p_child->count + 1U] = p_right->children[0];
+        relocate(p_separator, p_right->keys());
+        relocate_n(p_right->keys(), p_right->keys() + 1U, p_right->count - 1U);
+        move_children(p_right->children, p_right->children + 1U, p_right->count);
+        ++p_child->count;
+        --p_right->count;
+      }
+    }
+
+    //*********************************************************************
+    /// Merges children[i + 1] in to children[i] and removes it from the parent.
+    //*********************************************************************
+    void merge_children(inner_node* p_parent, size_t i)
+    {
+      key_type* p_keys = p_parent->keys();
+
+      if (p_parent->children[i]->is_leaf)
+      {
+        leaf_node* p_left  = static_cast<leaf_node*>(p_parent->children[i]);
+        leaf_node* p_right = static_cast<leaf_node*>(p_parent->children[i + 1U]);
+
+        relocate_n(p_left->values() + p_left->count, p_right->values(), p_right->count);
+        p_left->count += p_right->count;
+
+        p_left->p_next = p_right->p_next;
+
+        if (p_right->p_next != nullptr)
+        {
+          p_right->p_next->p_previous = p_left;
+        }
+        else
+        {
+          p_last = p_left;
+        }
+
+        leaf_pool.release(p_right);
+
+        etl::destroy_at(p_keys + i);
+      }
+      else
+      {
+        inner_node* p_left  = static_cast<inner_node*>(p_parent->children[i]);
+        inner_node* p_right = static_cast<inner_node*>(p_parent->children[i + 1U]);
+
+        relocate(p_left->keys() + p_left->count, p_keys + i);
+        relocate_n(p_left->keys() + p_left->count + 1U, p_right->keys(), p_right->count);
+        move_children(p_left->children + p_left->count + 1U, p_right->children, p_right->count + 1U);
+        p_left->count += p_right->count + 1U;
+
+        inner_pool.release(p_right);
+      }
+
+      relocate_n(p_keys + i, p_keys + i + 1U, p_parent->count - i - 1U);
+      move_children(p_parent->children + i + 1U, p_parent->children + i + 2U, p_parent->count - i - 1U);
+      --p_parent->count;
+    }
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    node*        p_root;       ///< The root of the tree.
+    leaf_node*   p_first;      ///< The first leaf.
+    leaf_node*   p_last;       ///< The last leaf.
+    size_t       current_size; ///< The number of elements.
+    const size_t MAX_SIZE;     ///< The maximum number of elements.
+    etl::ipool&  leaf_pool;    ///< The pool of leaf nodes.
+    etl::ipool&  inner_pool;   ///< The pool of inner nodes.
+    key_compare  compare;      ///< The key comparison.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_KEYS, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, NODE_KEYS, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, NODE_KEYS, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_KEYS, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, NODE_KEYS, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, NODE_KEYS, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A btree_map implementation that uses fixed size pools of nodes.
+  /// The pools are sized for the worst case fill of the nodes.
+  ///\tparam TKey       The key type.
+  ///\tparam TValue     The value type.
+  ///\tparam MAX_SIZE_  The maximum number of elements that can be stored.
+  ///\tparam NODE_KEYS_ The maximum number of entries in a node. Default = 16
+  ///\tparam TCompare   The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t NODE_KEYS_ = 16U, typename TCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, NODE_KEYS_, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, NODE_KEYS_, TCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+  private:
+
+    // Every leaf but the root is at least half full, as is every inner node.
+    static const size_t MAX_LEAVES      = (MAX_SIZE_ / base_t::MIN_LEAF_SIZE) + 1U;
+    static const size_t MAX_INNER_NODES = (MAX_LEAVES / base_t::MIN_INNER_KEYS) + 1U;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    /// The pool of leaf nodes.
+    etl::pool<typename base_t::leaf_node, MAX_LEAVES> leaf_pool;
+
+    /// The pool of inner nodes.
+    etl::pool<typename base_t::inner_node, MAX_INNER_NODES> inner_pool;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
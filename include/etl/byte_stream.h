@@ -0,0 +1,463 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+Copyright(c) 2020 jwellbelove
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_STREAM_INCLUDED
+#define ETL_BYTE_STREAM_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "endianness.h"
+#include "algorithm.h"
+#include "array_view.h"
+#include "string_view.h"
+#include "static_assert.h"
+
+///\defgroup byte_stream byte_stream
+/// Endian aware reading and writing of values to and from a byte buffer.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Returns true if values must be byte reversed to match the stream.
+    //*************************************************************************
+    inline bool must_reverse(etl::endian stream_endianness)
+    {
+      return (stream_endianness != etl::endian::native) &&
+             (stream_endianness != etl::endianness::value());
+    }
+  }
+
+  //***************************************************************************
+  /// Writes integral and floating point values to a byte buffer in the
+  /// chosen endianness.
+  ///\ingroup byte_stream
+  //***************************************************************************
+  class byte_stream_writer
+  {
+  public:
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    byte_stream_writer(uint8_t* begin_, size_t length_, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(begin_),
+        pcurrent(begin_),
+        length(length_),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    byte_stream_writer(char* begin_, size_t length_, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(reinterpret_cast<uint8_t*>(begin_)),
+        pcurrent(reinterpret_cast<uint8_t*>(begin_)),
+        length(length_),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Construct from an array view.
+    //***************************************************************************
+    explicit byte_stream_writer(etl::array_view<uint8_t> view, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(view.data()),
+        pcurrent(view.data()),
+        length(view.size()),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Writes an integral or floating point value.
+    ///\return <b>false</b> if there is not enough room. Nothing is written.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+      write(T value)
+    {
+      bool success = (available() >= sizeof(T));
+
+      if (success)
+      {
+        to_bytes(value);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Writes an array of integral or floating point values.
+    ///\return <b>false</b> if there is not enough room for all of them. Nothing is written.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+      write(const T* values, size_t count)
+    {
+      bool success = ((available() / sizeof(T)) >= count);
+
+      if (success)
+      {
+        if ((sizeof(T) == 1U) || !reverse)
+        {
+          // The bytes can be copied as they are.
+          const uint8_t* pv = reinterpret_cast<const uint8_t*>(values);
+          pcurrent = etl::copy(pv, pv + (count * sizeof(T)), pcurrent);
+        }
+        else
+        {
+          for (size_t i = 0; i < count; ++i)
+          {
+            to_bytes(values[i]);
+          }
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Writes the characters of a string view. The length is not written.
+    ///\return <b>false</b> if there is not enough room. Nothing is written.
+    //***************************************************************************
+    bool write(const etl::string_view& view)
+    {
+      return write(view.data(), view.size());
+    }
+
+    //***************************************************************************
+    /// Reserves space in the stream for the caller to fill, such as a blob.
+    ///\return A view of the reserved space, or an empty view if there is not enough room.
+    //***************************************************************************
+    etl::array_view<uint8_t> reserve(size_t n)
+    {
+      if (available() >= n)
+      {
+        uint8_t* pbegin = pcurrent;
+        pcurrent += n;
+
+        return etl::array_view<uint8_t>(pbegin, pcurrent);
+      }
+
+      return etl::array_view<uint8_t>();
+    }
+
+    //***************************************************************************
+    /// Sets the write position back to the beginning of the buffer.
+    //***************************************************************************
+    void restart()
+    {
+      pcurrent = pdata;
+    }
+
+    //***************************************************************************
+    /// Returns a view of the bytes written.
+    //***************************************************************************
+    etl::array_view<uint8_t> used_data() const
+    {
+      return etl::array_view<uint8_t>(pdata, pcurrent);
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes written.
+    //***************************************************************************
+    size_t size_bytes() const
+    {
+      return size_t(pcurrent - pdata);
+    }
+
+    //***************************************************************************
+    /// Returns the size of the buffer.
+    //***************************************************************************
+    size_t capacity() const
+    {
+      return length;
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes still available.
+    //***************************************************************************
+    size_t available() const
+    {
+      return length - size_bytes();
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the buffer is full.
+    //***************************************************************************
+    bool full() const
+    {
+      return available() == 0U;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Copies the bytes of the value to the stream.
+    //***************************************************************************
+    template <typename T>
+    void to_bytes(T value)
+    {
+      const uint8_t* pv = reinterpret_cast<const uint8_t*>(&value);
+
+      if (reverse)
+      {
+        pcurrent = etl::reverse_copy(pv, pv + sizeof(T), pcurrent);
+      }
+      else
+      {
+        pcurrent = etl::copy(pv, pv + sizeof(T), pcurrent);
+      }
+    }
+
+    uint8_t* pdata;    ///< The start of the buffer.
+    uint8_t* pcurrent; ///< The write position.
+    size_t   length;   ///< The length of the buffer.
+    bool     reverse;  ///< Are the bytes of values reversed?
+  };
+
+  //***************************************************************************
+  /// Reads integral and floating point values from a byte buffer in the
+  /// chosen endianness.
+  /// Strings and blobs are returned as views into the buffer, without copying.
+  ///\ingroup byte_stream
+  //***************************************************************************
+  class byte_stream_reader
+  {
+  public:
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    byte_stream_reader(const uint8_t* begin_, size_t length_, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(begin_),
+        pcurrent(begin_),
+        length(length_),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    byte_stream_reader(const char* begin_, size_t length_, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(reinterpret_cast<const uint8_t*>(begin_)),
+        pcurrent(reinterpret_cast<const uint8_t*>(begin_)),
+        length(length_),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Construct from an array view.
+    //***************************************************************************
+    explicit byte_stream_reader(etl::array_view<const uint8_t> view, etl::endian stream_endianness_ = etl::endian::big)
+      : pdata(view.data()),
+        pcurrent(view.data()),
+        length(view.size()),
+        reverse(private_byte_stream::must_reverse(stream_endianness_))
+    {
+    }
+
+    //***************************************************************************
+    /// Reads an integral or floating point value.
+    ///\return <b>false</b> if there are not enough bytes. Nothing is read.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+      read(T& value)
+    {
+      bool success = (available() >= sizeof(T));
+
+      if (success)
+      {
+        value = from_bytes<T>();
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Reads an array of integral or floating point values.
+    ///\return <b>false</b> if there are not enough bytes for all of them. Nothing is read.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+      read(T* values, size_t count)
+    {
+      bool success = ((available() / sizeof(T)) >= count);
+
+      if (success)
+      {
+        if ((sizeof(T) == 1U) || !reverse)
+        {
+          // The bytes can be copied as they are.
+          const uint8_t* pend = pcurrent + (count * sizeof(T));
+          etl::copy(pcurrent, pend, reinterpret_cast<uint8_t*>(values));
+          pcurrent = pend;
+        }
+        else
+        {
+          for (size_t i = 0; i < count; ++i)
+          {
+            values[i] = from_bytes<T>();
+          }
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Returns a view of the next 'n' bytes, without copying.
+    ///\return <b>false</b> if there are not enough bytes. Nothing is read.
+    //***************************************************************************
+    bool read_view(etl::array_view<const uint8_t>& view, size_t n)
+    {
+      bool success = (available() >= n);
+
+      if (success)
+      {
+        view = etl::array_view<const uint8_t>(pcurrent, pcurrent + n);
+        pcurrent += n;
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Returns a view of the next 'n' characters, without copying.
+    ///\return <b>false</b> if there are not enough bytes. Nothing is read.
+    //***************************************************************************
+    bool read_view(etl::string_view& view, size_t n)
+    {
+      bool success = (available() >= n);
+
+      if (success)
+      {
+        view = etl::string_view(reinterpret_cast<const char*>(pcurrent), n);
+        pcurrent += n;
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Skips 'n' bytes.
+    ///\return <b>false</b> if there are not enough bytes. Nothing is skipped.
+    //***************************************************************************
+    bool skip(size_t n)
+    {
+      bool success = (available() >= n);
+
+      if (success)
+      {
+        pcurrent += n;
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Sets the read position back to the beginning of the buffer.
+    //***************************************************************************
+    void restart()
+    {
+      pcurrent = pdata;
+    }
+
+    //***************************************************************************
+    /// Returns a view of the bytes not yet read.
+    //***************************************************************************
+    etl::array_view<const uint8_t> free_data() const
+    {
+      return etl::array_view<const uint8_t>(pcurrent, pdata + length);
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes read.
+    //***************************************************************************
+    size_t size_bytes() const
+    {
+      return size_t(pcurrent - pdata);
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes still available.
+    //***************************************************************************
+    size_t available() const
+    {
+      return length - size_bytes();
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if all of the bytes have been read.
+    //***************************************************************************
+    bool empty() const
+    {
+      return available() == 0U;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Copies the bytes of the value from the stream.
+    //***************************************************************************
+    template <typename T>
+    T from_bytes()
+    {
+      T value;
+      uint8_t* pv = reinterpret_cast<uint8_t*>(&value);
+
+      if (reverse)
+      {
+        etl::reverse_copy(pcurrent, pcurrent + sizeof(T), pv);
+      }
+      else
+      {
+        etl::copy(pcurrent, pcurrent + sizeof(T), pv);
+      }
+
+      pcurrent += sizeof(T);
+
+      return value;
+    }
+
+    const uint8_t* pdata;    ///< The start of the buffer.
+    const uint8_t* pcurrent; ///< The read position.
+    size_t         length;   ///< The length of the buffer.
+    bool           reverse;  ///< Are the bytes of values reversed?
+  };
+}
+
+#endif
@@ -99,6 +99,7 @@ namespace etl
       : p_callback(nullptr),
         period(0),
         delta(etl::timer::state::INACTIVE),
+        slack(0U),
         id(etl::timer::id::NO_TIMER),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -117,6 +118,7 @@ namespace etl
       : p_callback(reinterpret_cast<void*>(p_callback_)),
         period(period_),
         delta(etl::timer::state::INACTIVE),
+        slack(0U),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -135,6 +137,7 @@ namespace etl
       : p_callback(reinterpret_cast<void*>(&callback_)),
         period(period_),
         delta(etl::timer::state::INACTIVE),
+        slack(0U),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -154,6 +157,7 @@ namespace etl
             : p_callback(reinterpret_cast<void*>(&callback_)),
               period(period_),
               delta(etl::timer::state::INACTIVE),
+              slack(0U),
               id(id_),
               previous(etl::timer::id::NO_TIMER),
               next(etl::timer::id::NO_TIMER),
@@ -182,6 +186,7 @@ namespace etl
     void*                 p_callback;
     uint32_t              period;
     uint32_t              delta;
+    uint32_t              slack;
     etl::timer::id::type  id;
     uint_least8_t         previous;
     uint_least8_t         next;
@@ -219,6 +224,71 @@ namespace etl
         return head == etl::timer::id::NO_TIMER;
       }
 
+      //*******************************
+      // Moves the expiry of a timer with slack to that of the first active
+      // timer that expires within its slack, so that they expire together.
+      //*******************************
+      void coalesce(etl::callback_timer_data& timer) const
+      {
+        if (timer.slack == 0U)
+        {
+          return;
+        }
+
+        uint32_t expiry = 0U;
+        etl::timer::id::type test_id = head;
+
+        while (test_id != etl::timer::id::NO_TIMER)
+        {
+          expiry += ptimers[test_id].delta;
+
+          if (expiry >= timer.delta)
+          {
+            if ((expiry - timer.delta) <= timer.slack)
+            {
+              timer.delta = expiry;
+            }
+
+            break;
+          }
+
+          test_id = ptimers[test_id].next;
+        }
+      }
+
+      //*******************************
+      // The ticks until the active timers must be processed.
+      // The earliest of the expiries plus slack.
+      //*******************************
+      uint32_t time_to_deadline() const
+      {
+        uint32_t deadline = etl::timer::state::INACTIVE;
+        uint32_t expiry   = 0U;
+        etl::timer::id::type test_id = head;
+
+        while (test_id != etl::timer::id::NO_TIMER)
+        {
+          const etl::callback_timer_data& test = ptimers[test_id];
+
+          expiry += test.delta;
+
+          // Later timers cannot be due sooner.
+          if (expiry >= deadline)
+          {
+            break;
+          }
+
+          if (test.slack < (deadline - expiry))
+          {
+            deadline = expiry + test.slack;
+          }
+
+          test_id = test.next;
+        }
+
+        return deadline;
+      }
+
       //*******************************
       // Inserts the timer at the correct delta position
       //*******************************
@@ -226,6 +296,8 @@ namespace etl
       {
         etl::callback_timer_data& timer = ptimers[id_];
 
+        coalesce(timer);
+
         if (head == etl::timer::id::NO_TIMER)
         {
           // No entries yet.
@@ -244,7 +316,9 @@ namespace etl
             etl::callback_timer_data& test = ptimers[test_id];
 
             // Find the correct place to insert.
-            if (timer.delta <= test.delta)
+            // Timers with slack go after others with the same expiry, so
+            // that those are reinserted first, and can be coalesced with.
+            if ((timer.delta < test.delta) || ((timer.delta == test.delta) && (timer.slack == 0U)))
             {
               if (test.id == head)
               {
@@ -328,6 +402,12 @@ namespace etl
         return ptimers[head];
       }
 
+      //*******************************
+      const etl::callback_timer_data& front() const
+      {
+        return ptimers[head];
+      }
+
       //*******************************
       etl::timer::id::type begin()
       {
@@ -528,6 +608,42 @@ namespace etl
       return enabled;
     }
 
+    //*******************************************
+    /// The number of ticks processed since construction.
+    /// A monotonic clock, for lazily updated state such as rate limiters.
+    /// Wraps at 2^32.
+    //*******************************************
+    uint32_t time() const
+    {
+      return ticks_elapsed;
+    }
+
+    //*******************************************
+    /// The number of ticks until the timers must next be processed, allowing
+    /// for any ticks recorded by tick_from_isr() that have not been processed.
+    /// This is the time of the next expiry, unless timers have slack, when it
+    /// is the earliest expiry plus slack; all of the timers that have expired
+    /// by then are processed together.
+    /// Returns etl::timer::state::INACTIVE if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      if (active_list.empty())
+      {
+        return etl::timer::state::INACTIVE;
+      }
+
+      uint32_t delta = active_list.time_to_deadline();
+
+#if ETL_HAS_ATOMIC
+      const uint32_t pending = pending_ticks.load();
+
+      delta = (pending < delta) ? (delta - pending) : 0U;
+#endif
+
+      return delta;
+    }
+
     //*******************************************
     /// Clears the timer of data.
     //*******************************************
@@ -557,6 +673,8 @@ namespace etl
       {
         if (ETL_TIMER_UPDATES_ENABLED)
         {
+          ticks_elapsed += count;
+
           // We have something to do?
           bool has_active = !active_list.empty();
 
@@ -615,6 +733,38 @@ namespace etl
       return false;
     }
 
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Records elapsed ticks, to be processed later by process().
+    /// No callbacks are called, so it is safe to call from an interrupt.
+    //*******************************************
+    void tick_from_isr(uint32_t count)
+    {
+      pending_ticks.fetch_add(count);
+    }
+
+    //*******************************************
+    /// Processes the ticks recorded by tick_from_isr(), calling the
+    /// callbacks of any timers that expire.
+    /// Call from thread context.
+    /// Returns true if the ticks were processed, false if not,
+    /// in which case they are kept for the next call.
+    //*******************************************
+    bool process()
+    {
+      const uint32_t count = pending_ticks.exchange(0U);
+
+      if (tick(count))
+      {
+        return true;
+      }
+
+      pending_ticks.fetch_add(count);
+
+      return false;
+    }
+#endif
+
     //*******************************************
     /// Starts a timer.
     //*******************************************
@@ -708,6 +858,30 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Sets the number of ticks that a timer may expire late.
+    /// A timer with slack expires with the first active timer that expires
+    /// within its slack, so that both are processed in the same tick, and
+    /// time_to_next() allows for the slack, so that fewer wake-ups are needed.
+    /// Takes effect when the timer is next started, or repeats.
+    //*******************************************
+    bool set_slack(etl::timer::id::type id_, uint32_t slack_)
+    {
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        etl::callback_timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          timer.slack = slack_;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
   protected:
 
     //*******************************************
@@ -721,6 +895,10 @@ namespace etl
         process_semaphore(0),
 #endif
         registered_timers(0),
+        ticks_elapsed(0U),
+#if ETL_HAS_ATOMIC
+        pending_ticks(0U),
+#endif
         MAX_TIMERS(MAX_TIMERS_)
     {
     }
@@ -738,6 +916,10 @@ namespace etl
     volatile etl::timer_semaphore_t process_semaphore;
 #endif
     volatile uint_least8_t registered_timers;
+    uint32_t ticks_elapsed;
+#if ETL_HAS_ATOMIC
+    etl::atomic<uint32_t> pending_ticks;
+#endif
 
   public:
 
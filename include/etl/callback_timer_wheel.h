@@ -0,0 +1,902 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "log.h"
+#include "timer.h"
+#include "atomic.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include "delegate.h"
+#endif
+
+///\defgroup callback_timer_wheel callback_timer_wheel
+/// A callback timer that holds its active timers in a hierarchical timing wheel.
+/// Starting and stopping a timer are O(1) and each tick is amortised O(1),
+/// whatever the number of active timers.
+/// The API is the same as etl::callback_timer, and it uses the same
+/// ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+/// configuration.
+///\ingroup utilities
+
+#if defined(ETL_IN_UNIT_TEST) && defined(ETL_NO_STL)
+  #define ETL_DISABLE_TIMER_UPDATES
+  #define ETL_ENABLE_TIMER_UPDATES
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+
+  #define ETL_DISABLE_TIMER_UPDATES (ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS)
+  #define ETL_ENABLE_TIMER_UPDATES  (ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+  #define ETL_TIMER_UPDATES_ENABLED true
+#endif
+
+namespace etl
+{
+  //*************************************************************************
+  /// The configuration of a timer wheel timer.
+  ///\tparam TIdTraits The timer id traits. etl::timer::id or etl::timer::large_id.
+  template <typename TIdTraits>
+  struct basic_callback_timer_wheel_data
+  {
+    typedef typename TIdTraits::type id_type;
+
+    enum callback_type
+    {
+      C_CALLBACK,
+      IFUNCTION,
+      DELEGATE
+    };
+
+    enum
+    {
+      NO_SLOT = 0xFFFF
+    };
+
+    //*******************************************
+    basic_callback_timer_wheel_data()
+      : p_callback(nullptr),
+        period(0),
+        expires(0),
+        id(id_type(TIdTraits::NO_TIMER)),
+        previous(id_type(TIdTraits::NO_TIMER)),
+        next(id_type(TIdTraits::NO_TIMER)),
+        slot(NO_SLOT),
+        repeating(true),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+    //*******************************************
+    /// C function callback
+    //*******************************************
+    basic_callback_timer_wheel_data(id_type  id_,
+                                    void     (*p_callback_)(),
+                                    uint32_t period_,
+                                    bool     repeating_)
+      : p_callback(reinterpret_cast<void*>(p_callback_)),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(id_type(TIdTraits::NO_TIMER)),
+        next(id_type(TIdTraits::NO_TIMER)),
+        slot(NO_SLOT),
+        repeating(repeating_),
+        cbk_type(C_CALLBACK)
+    {
+    }
+
+    //*******************************************
+    /// ETL function callback
+    //*******************************************
+    basic_callback_timer_wheel_data(id_type               id_,
+                                    etl::ifunction<void>& callback_,
+                                    uint32_t              period_,
+                                    bool                  repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(id_type(TIdTraits::NO_TIMER)),
+        next(id_type(TIdTraits::NO_TIMER)),
+        slot(NO_SLOT),
+        repeating(repeating_),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// ETL delegate callback
+    //*******************************************
+    basic_callback_timer_wheel_data(id_type                id_,
+                                    etl::delegate<void()>& callback_,
+                                    uint32_t               period_,
+                                    bool                   repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(id_type(TIdTraits::NO_TIMER)),
+        next(id_type(TIdTraits::NO_TIMER)),
+        slot(NO_SLOT),
+        repeating(repeating_),
+        cbk_type(DELEGATE)
+    {
+    }
+#endif
+
+    //*******************************************
+    /// Returns true if the timer is active.
+    //*******************************************
+    bool is_active() const
+    {
+      return slot != NO_SLOT;
+    }
+
+    void*         p_callback;
+    uint32_t      period;
+    uint32_t      expires;  ///< The tick count at which the timer expires.
+    id_type       id;
+    id_type       previous;
+    id_type       next;     ///< The next timer in the slot, or in the free list if unregistered.
+    uint16_t      slot;     ///< The wheel slot holding the timer, or NO_SLOT.
+    bool          repeating;
+    callback_type cbk_type;
+
+  private:
+
+    // Disabled.
+    basic_callback_timer_wheel_data(const basic_callback_timer_wheel_data& other);
+    basic_callback_timer_wheel_data& operator =(const basic_callback_timer_wheel_data& other);
+  };
+
+  typedef etl::basic_callback_timer_wheel_data<etl::timer::id>       callback_timer_wheel_data;
+  typedef etl::basic_callback_timer_wheel_data<etl::timer::large_id> callback_timer_wheel_large_data;
+
+  //***************************************************************************
+  /// Interface for callback timer wheel
+  /// Unregistered timers are held in a free list, so registration is O(1).
+  ///\tparam TIdTraits The timer id traits. etl::timer::id or etl::timer::large_id.
+  //***************************************************************************
+  template <typename TIdTraits>
+  class ibasic_callback_timer_wheel
+  {
+  public:
+
+    typedef typename TIdTraits::type                        id_type;
+    typedef etl::basic_callback_timer_wheel_data<TIdTraits> timer_data_t;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(void     (*p_callback_)(),
+                           uint32_t period_,
+                           bool     repeating_)
+    {
+      id_type id = allocate_timer();
+
+      if (id != id_type(TIdTraits::NO_TIMER))
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data_t(id, p_callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(etl::ifunction<void>& callback_,
+                           uint32_t              period_,
+                           bool                  repeating_)
+    {
+      id_type id = allocate_timer();
+
+      if (id != id_type(TIdTraits::NO_TIMER))
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data_t(id, callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(etl::delegate<void()>& callback_,
+                           uint32_t               period_,
+                           bool                   repeating_)
+    {
+      id_type id = allocate_timer();
+
+      if (id != id_type(TIdTraits::NO_TIMER))
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data_t(id, callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(id_type id_)
+    {
+      bool result = false;
+
+      if (id_ < MAX_TIMERS)
+      {
+        timer_data_t& timer = timer_array[id_];
+
+        if (timer.id != id_type(TIdTraits::NO_TIMER))
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            remove(timer);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data_t();
+          release_timer(id_);
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// The current tick count of the wheel.
+    /// A monotonic clock, for lazily updated state such as rate limiters.
+    /// Wraps at 2^32.
+    //*******************************************
+    uint32_t time() const
+    {
+      return now;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      for (id_type i = 0; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data_t();
+      }
+
+      initialise();
+      ETL_ENABLE_TIMER_UPDATES;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          // Timers started as 'immediate' expire now.
+          expire_slot(uint16_t(now & mask));
+
+          while (count != 0U)
+          {
+            if (active_timers == 0U)
+            {
+              // Nothing to do, so just move the time on.
+              now += count;
+              break;
+            }
+
+            ++now;
+            --count;
+
+            cascade();
+            expire_slot(uint16_t(now & mask));
+          }
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// A lower bound for the number of ticks until the next timer expires,
+    /// allowing for any ticks recorded by tick_from_isr() that have not been
+    /// processed. A timer in a higher level is counted as due when its slot
+    /// is cascaded, so the result may be early but is never late.
+    /// Returns etl::timer::state::INACTIVE if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      if (active_timers == 0U)
+      {
+        return etl::timer::state::INACTIVE;
+      }
+
+      uint64_t result = uint64_t(etl::timer::state::INACTIVE);
+
+      // Level 0 slots expire one tick apart.
+      for (uint32_t k = 0U; k < slots; ++k)
+      {
+        if (p_heads[(now + k) & mask] != id_type(TIdTraits::NO_TIMER))
+        {
+          result = k;
+          break;
+        }
+      }
+
+      // Higher level slots are cascaded when the levels below them wrap.
+      for (size_t level = 1U; level < levels; ++level)
+      {
+        const size_t shift = slot_bits * level;
+
+        for (uint64_t k = 1U; k <= slots; ++k)
+        {
+          const uint64_t index = uint64_t(now >> shift) + k;
+
+          if (p_heads[(level * slots) + size_t(index & mask)] != id_type(TIdTraits::NO_TIMER))
+          {
+            const uint64_t delta = (index << shift) - now;
+
+            if (delta < result)
+            {
+              result = delta;
+            }
+
+            break;
+          }
+        }
+      }
+
+      uint32_t delta = uint32_t(result);
+
+#if ETL_HAS_ATOMIC
+      const uint32_t pending = pending_ticks.load();
+
+      delta = (pending < delta) ? (delta - pending) : 0U;
+#endif
+
+      return delta;
+    }
+
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Records elapsed ticks, to be processed later by process().
+    /// No callbacks are called, so it is safe to call from an interrupt.
+    //*******************************************
+    void tick_from_isr(uint32_t count)
+    {
+      pending_ticks.fetch_add(count);
+    }
+
+    //*******************************************
+    /// Processes the ticks recorded by tick_from_isr(), calling the
+    /// callbacks of any timers that expire.
+    /// Call from thread context.
+    /// Returns true if the ticks were processed, false if not,
+    /// in which case they are kept for the next call.
+    //*******************************************
+    bool process()
+    {
+      const uint32_t count = pending_ticks.exchange(0U);
+
+      if (tick(count))
+      {
+        return true;
+      }
+
+      pending_ticks.fetch_add(count);
+
+      return false;
+    }
+#endif
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(id_type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        timer_data_t& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != id_type(TIdTraits::NO_TIMER))
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::INACTIVE)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              remove(timer);
+            }
+
+            timer.expires = now + (immediate_ ? 0U : timer.period);
+            insert(timer);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(id_type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        timer_data_t& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != id_type(TIdTraits::NO_TIMER))
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            remove(timer);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(id_type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(id_type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    ibasic_callback_timer_wheel(timer_data_t* const timer_array_,
+                                const id_type       MAX_TIMERS_,
+                                id_type* const      p_heads_,
+                                size_t              slot_bits_,
+                                size_t              levels_)
+      : timer_array(timer_array_),
+        p_heads(p_heads_),
+        slot_bits(slot_bits_),
+        slots(size_t(1U) << slot_bits_),
+        mask(uint32_t(slots - 1U)),
+        levels(levels_),
+        now(0U),
+        free_list(id_type(TIdTraits::NO_TIMER)),
+        active_timers(0U),
+        enabled(false),
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+#if ETL_HAS_ATOMIC
+        pending_ticks(0U),
+#endif
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+    //*******************************************
+    /// Empty the wheel and put all of the timers in the free list.
+    /// Called from the derived class, once the timers are constructed.
+    //*******************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < (levels * slots); ++i)
+      {
+        p_heads[i] = id_type(TIdTraits::NO_TIMER);
+      }
+
+      free_list = id_type(TIdTraits::NO_TIMER);
+
+      for (id_type i = MAX_TIMERS; i > 0U; --i)
+      {
+        release_timer(id_type(i - 1U));
+      }
+
+      active_timers     = 0U;
+      registered_timers = 0U;
+    }
+
+  private:
+
+    //*******************************************
+    /// Take a timer from the free list.
+    //*******************************************
+    id_type allocate_timer()
+    {
+      id_type id = free_list;
+
+      if (id != id_type(TIdTraits::NO_TIMER))
+      {
+        free_list = timer_array[id].next;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Return a timer to the free list.
+    //*******************************************
+    void release_timer(id_type id_)
+    {
+      timer_array[id_].next = free_list;
+      free_list = id_;
+    }
+
+    //*******************************************
+    /// Put the timer in the slot for its expiry time.
+    /// The level is the one whose slots span the time remaining.
+    //*******************************************
+    void insert(timer_data_t& timer)
+    {
+      const uint32_t remaining = timer.expires - now;
+
+      size_t level = 0U;
+
+      while (((level + 1U) < levels) && ((remaining >> (slot_bits * (level + 1U))) != 0U))
+      {
+        ++level;
+      }
+
+      const uint16_t slot = uint16_t((level * slots) + ((timer.expires >> (slot_bits * level)) & mask));
+
+      timer.slot     = slot;
+      timer.previous = id_type(TIdTraits::NO_TIMER);
+      timer.next     = p_heads[slot];
+
+      if (timer.next != id_type(TIdTraits::NO_TIMER))
+      {
+        timer_array[timer.next].previous = timer.id;
+      }
+
+      p_heads[slot] = timer.id;
+      ++active_timers;
+    }
+
+    //*******************************************
+    /// Take the timer out of its slot.
+    //*******************************************
+    void remove(timer_data_t& timer)
+    {
+      if (timer.previous == id_type(TIdTraits::NO_TIMER))
+      {
+        p_heads[timer.slot] = timer.next;
+      }
+      else
+      {
+        timer_array[timer.previous].next = timer.next;
+      }
+
+      if (timer.next != id_type(TIdTraits::NO_TIMER))
+      {
+        timer_array[timer.next].previous = timer.previous;
+      }
+
+      timer.previous = id_type(TIdTraits::NO_TIMER);
+      timer.next     = id_type(TIdTraits::NO_TIMER);
+      timer.slot     = timer_data_t::NO_SLOT;
+      --active_timers;
+    }
+
+    //*******************************************
+    /// When the lower levels wrap, move the timers in the current slot of
+    /// each higher level down to a lower one.
+    //*******************************************
+    void cascade()
+    {
+      for (size_t level = 1U; level < levels; ++level)
+      {
+        const size_t shift = slot_bits * level;
+
+        // Have the lower levels wrapped?
+        if ((now & ((uint32_t(1U) << shift) - 1U)) != 0U)
+        {
+          break;
+        }
+
+        const uint16_t slot = uint16_t((level * slots) + ((now >> shift) & mask));
+
+        id_type id = p_heads[slot];
+
+        while (id != id_type(TIdTraits::NO_TIMER))
+        {
+          timer_data_t& timer = timer_array[id];
+          id = timer.next;
+
+          remove(timer);
+          insert(timer);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Call the timers in a level 0 slot, which are all due now.
+    //*******************************************
+    void expire_slot(uint16_t slot)
+    {
+      // A callback may start or stop timers, so always take the head.
+      while (p_heads[slot] != id_type(TIdTraits::NO_TIMER))
+      {
+        timer_data_t& timer = timer_array[p_heads[slot]];
+
+        remove(timer);
+
+        if (timer.repeating)
+        {
+          // Reinsert the timer. A zero period would otherwise never leave this slot.
+          timer.expires = now + ((timer.period == 0U) ? 1U : timer.period);
+          insert(timer);
+        }
+
+        if (timer.p_callback != nullptr)
+        {
+          if (timer.cbk_type == timer_data_t::C_CALLBACK)
+          {
+            // Call the C callback.
+            reinterpret_cast<void(*)()>(timer.p_callback)();
+          }
+          else if (timer.cbk_type == timer_data_t::IFUNCTION)
+          {
+            // Call the function wrapper callback.
+            (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+          }
+#if ETL_CPP11_SUPPORTED
+          else if (timer.cbk_type == timer_data_t::DELEGATE)
+          {
+            // Call the delegate callback.
+            (*reinterpret_cast<etl::delegate<void()>*>(timer.p_callback))();
+          }
+#endif
+        }
+      }
+    }
+
+    // Disabled.
+    ibasic_callback_timer_wheel(const ibasic_callback_timer_wheel&);
+    ibasic_callback_timer_wheel& operator =(const ibasic_callback_timer_wheel&);
+
+    // The array of timer data structures.
+    timer_data_t* const timer_array;
+
+    // The head of the list of timers in each slot, level by level.
+    id_type* const p_heads;
+
+    const size_t   slot_bits;
+    const size_t   slots;
+    const uint32_t mask;
+    const size_t   levels;
+
+    // The current tick count.
+    uint32_t now;
+
+    // The head of the list of unregistered timers.
+    id_type free_list;
+
+    // The number of timers in the wheel.
+    id_type active_timers;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    volatile etl::timer_semaphore_t process_semaphore;
+#endif
+    volatile id_type registered_timers;
+#if ETL_HAS_ATOMIC
+    etl::atomic<uint32_t> pending_ticks;
+#endif
+
+  public:
+
+    const id_type MAX_TIMERS;
+  };
+
+  typedef etl::ibasic_callback_timer_wheel<etl::timer::id>       icallback_timer_wheel;
+  typedef etl::ibasic_callback_timer_wheel<etl::timer::large_id> icallback_timer_wheel_large;
+
+  //***************************************************************************
+  /// The callback timer wheel
+  ///\tparam MAX_TIMERS_ The maximum number of timers.
+  ///\tparam SLOTS_      The number of slots in each level of the wheel. A power of two.
+  ///                    Enough levels are used to cover a 32 bit period.
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_, const size_t SLOTS_ = 64U>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+    ETL_STATIC_ASSERT(((SLOTS_ >= 2U) && (SLOTS_ <= 256U) && ((SLOTS_ & (SLOTS_ - 1U)) == 0U)), "Slots must be a power of two from 2 to 256");
+
+    static const size_t SLOTS     = SLOTS_;
+    static const size_t SLOT_BITS = etl::log2<SLOTS_>::value;
+    static const size_t LEVELS    = (32U + SLOT_BITS - 1U) / SLOT_BITS;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, MAX_TIMERS_, heads, SLOT_BITS, LEVELS)
+    {
+      this->initialise();
+    }
+
+  private:
+
+    callback_timer_wheel_data timer_array[MAX_TIMERS_];
+    etl::timer::id::type      heads[LEVELS * SLOTS_];
+  };
+
+  //***************************************************************************
+  /// The callback timer wheel, for large numbers of timers.
+  /// Timer ids are etl::timer::large_id::type.
+  ///\tparam MAX_TIMERS_ The maximum number of timers.
+  ///\tparam SLOTS_      The number of slots in each level of the wheel. A power of two.
+  ///                    Enough levels are used to cover a 32 bit period.
+  //***************************************************************************
+  template <const uint32_t MAX_TIMERS_, const size_t SLOTS_ = 256U>
+  class callback_timer_wheel_large : public etl::icallback_timer_wheel_large
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ < uint32_t(etl::timer::large_id::NO_TIMER), "Too many timers");
+    ETL_STATIC_ASSERT(((SLOTS_ >= 2U) && (SLOTS_ <= 256U) && ((SLOTS_ & (SLOTS_ - 1U)) == 0U)), "Slots must be a power of two from 2 to 256");
+
+    static const size_t SLOTS     = SLOTS_;
+    static const size_t SLOT_BITS = etl::log2<SLOTS_>::value;
+    static const size_t LEVELS    = (32U + SLOT_BITS - 1U) / SLOT_BITS;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel_large()
+      : icallback_timer_wheel_large(timer_array, MAX_TIMERS_, heads, SLOT_BITS, LEVELS)
+    {
+      this->initialise();
+    }
+
+  private:
+
+    callback_timer_wheel_large_data timer_array[MAX_TIMERS_];
+    etl::timer::large_id::type      heads[LEVELS * SLOTS_];
+  };
+}
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
@@ -102,19 +102,19 @@ namespace etl
     typedef typename char_traits_types<T>::state_type state_type;
 
     //*************************************************************************
-    static bool eq(char_type a, char_type b)
+    static ETL_CONSTEXPR bool eq(char_type a, char_type b)
     {
       return a == b;
     }
 
     //*************************************************************************
-    static bool lt(char_type a, char_type b)
+    static ETL_CONSTEXPR bool lt(char_type a, char_type b)
     {
       return a < b;
     }
 
     //*************************************************************************
-    static size_t length(const char_type* str)
+    static ETL_CONSTEXPR14 size_t length(const char_type* str)
     {
       size_t count = 0;
 
@@ -130,7 +130,7 @@ namespace etl
     }
 
     //*************************************************************************
-    static void assign(char_type& r, const char_type& c)
+    static ETL_CONSTEXPR14 void assign(char_type& r, const char_type& c)
     {
       r = c;
     }
@@ -172,7 +172,7 @@ namespace etl
     }
 
     //*************************************************************************
-    static int compare(const char_type* s1, const char_type* s2, size_t count)
+    static ETL_CONSTEXPR14 int compare(const char_type* s1, const char_type* s2, size_t count)
     {
       for (size_t i = 0; i < count; ++i)
       {
@@ -193,7 +193,7 @@ namespace etl
     }
 
     //*************************************************************************
-    static const char_type* find(const char_type* p, size_t count, const char_type& ch)
+    static ETL_CONSTEXPR14 const char_type* find(const char_type* p, size_t count, const char_type& ch)
     {
       for (size_t i = 0; i < count; ++i)
       {
@@ -209,31 +209,31 @@ namespace etl
     }
 
     //*************************************************************************
-    static char_type to_char_type(int_type c)
+    static ETL_CONSTEXPR char_type to_char_type(int_type c)
     {
       return static_cast<char_type>(c);
     }
 
     //*************************************************************************
-    static int_type to_int_type(char_type c)
+    static ETL_CONSTEXPR int_type to_int_type(char_type c)
     {
       return static_cast<int_type>(c);
     }
 
     //*************************************************************************
-    static bool eq_int_type(int_type c1, int_type c2)
+    static ETL_CONSTEXPR bool eq_int_type(int_type c1, int_type c2)
     {
       return (c1 == c2);
     }
 
     //*************************************************************************
-    static int_type eof()
+    static ETL_CONSTEXPR int_type eof()
     {
       return -1;
     }
 
     //*************************************************************************
-    static int_type not_eof(int_type e)
+    static ETL_CONSTEXPR int_type not_eof(int_type e)
     {
       return (e == eof()) ? eof() - 1 : e;
     }
@@ -244,7 +244,7 @@ namespace etl
   /// Alternative strlen for all character types.
   //***************************************************************************
   template <typename T>
-  size_t strlen(const T* t)
+  ETL_CONSTEXPR14 size_t strlen(const T* t)
   {
     return etl::char_traits<T>::length(t);
   }
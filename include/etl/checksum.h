@@ -28,6 +28,7 @@ SOFTWARE.
 #define ETL_CHECKSUM_INCLUDED
 
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "binary.h"
@@ -38,11 +39,75 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Loads eight bytes. The byte order is irrelevant to the callers.
+    //*************************************************************************
+    inline uint64_t load64(const uint8_t* p)
+    {
+      uint64_t word;
+      memcpy(&word, p, sizeof(word));
+      return word;
+    }
+
+    //*************************************************************************
+    /// Sums the bytes in a contiguous block, eight at a time.
+    /// Bytes are accumulated in four 16 bit lanes, which are folded before
+    /// they can overflow.
+    //*************************************************************************
+    inline uint64_t sum_bytes(const uint8_t*& begin, const uint8_t* end)
+    {
+      const uint64_t LANE_MASK = 0x00FF00FF00FF00FFull;
+      const size_t   MAX_WORDS = 128U; // 128 * 2 * 255 fits in a 16 bit lane.
+
+      uint64_t total = 0U;
+
+      while (size_t(end - begin) >= sizeof(uint64_t))
+      {
+        uint64_t lanes = 0U;
+        size_t   words = 0U;
+
+        while ((words < MAX_WORDS) && (size_t(end - begin) >= sizeof(uint64_t)))
+        {
+          const uint64_t word = load64(begin);
+          lanes += (word & LANE_MASK) + ((word >> 8) & LANE_MASK);
+          begin += sizeof(uint64_t);
+          ++words;
+        }
+
+        total += (lanes & 0xFFFFU) + ((lanes >> 16) & 0xFFFFU) + ((lanes >> 32) & 0xFFFFU) + (lanes >> 48);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// XORs the bytes in a contiguous block, eight at a time.
+    //*************************************************************************
+    inline uint8_t xor_bytes(const uint8_t*& begin, const uint8_t* end)
+    {
+      uint64_t result = 0U;
+
+      while (size_t(end - begin) >= sizeof(uint64_t))
+      {
+        result ^= load64(begin);
+        begin  += sizeof(uint64_t);
+      }
+
+      result ^= (result >> 32);
+      result ^= (result >> 16);
+      result ^= (result >> 8);
+
+      return uint8_t(result);
+    }
+  }
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_sum
+  struct checksum_policy_sum : public etl::frame_check_sequence_block_tag
   {
     typedef T value_type;
 
@@ -56,6 +121,24 @@ namespace etl
       return sum + value;
     }
 
+    template <typename TIterator>
+    T add_block(T sum, TIterator begin, const TIterator end) const
+    {
+      while (begin != end)
+      {
+        sum = add(sum, *begin++);
+      }
+
+      return sum;
+    }
+
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      sum = T(sum + etl::private_checksum::sum_bytes(begin, end));
+
+      return add_block<const uint8_t*>(sum, begin, end);
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -90,7 +173,7 @@ namespace etl
   /// Standard XOR checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_xor
+  struct checksum_policy_xor : public etl::frame_check_sequence_block_tag
   {
     typedef T value_type;
 
@@ -104,6 +187,24 @@ namespace etl
       return sum ^ value;
     }
 
+    template <typename TIterator>
+    T add_block(T sum, TIterator begin, const TIterator end) const
+    {
+      while (begin != end)
+      {
+        sum = add(sum, *begin++);
+      }
+
+      return sum;
+    }
+
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      sum = add(sum, etl::private_checksum::xor_bytes(begin, end));
+
+      return add_block<const uint8_t*>(sum, begin, end);
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -138,7 +239,7 @@ namespace etl
   /// Parity checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_parity
+  struct checksum_policy_parity : public etl::frame_check_sequence_block_tag
   {
     typedef T value_type;
 
@@ -152,6 +253,25 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+    template <typename TIterator>
+    T add_block(T sum, TIterator begin, const TIterator end) const
+    {
+      while (begin != end)
+      {
+        sum = add(sum, *begin++);
+      }
+
+      return sum;
+    }
+
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      // The parity of the XOR of the bytes is the XOR of their parities.
+      sum = add(sum, etl::private_checksum::xor_bytes(begin, end));
+
+      return add_block<const uint8_t*>(sum, begin, end);
+    }
+
     inline T final(T sum) const
     {
       return sum;
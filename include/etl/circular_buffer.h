@@ -0,0 +1,935 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CIRCULAR_BUFFER_INCLUDED
+#define ETL_CIRCULAR_BUFFER_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+#include "array_view.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+
+#undef ETL_FILE
+#define ETL_FILE "64"
+
+//*****************************************************************************
+///\defgroup circular_buffer circular_buffer
+/// A fixed capacity ring buffer that overwrites the oldest value when full.
+/// The contents can be viewed as at most two contiguous array_views.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the circular_buffer.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_exception : public etl::exception
+  {
+  public:
+
+    circular_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the circular_buffer.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_empty : public etl::circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_empty(string_type file_name_, numeric_type line_number_)
+      : etl::circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:empty", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all circular_buffers.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Returns the number of values in the buffer.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the buffer is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the buffer is full.
+    /// A push to a full buffer overwrites the oldest value.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the buffer.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the buffer.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values that can be pushed before the oldest is overwritten.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    circular_buffer_base(size_type capacity_)
+      : out(0U),
+        current_size(0U),
+        CAPACITY(capacity_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~circular_buffer_base()
+    {
+    }
+
+    //*************************************************************************
+    /// Steps a buffer index forward by 0 <= n <= CAPACITY.
+    //*************************************************************************
+    size_type add_index(size_type index, size_type n) const
+    {
+      index += n;
+
+      return (index >= CAPACITY) ? index - CAPACITY : index;
+    }
+
+    size_type       out;          ///< The index of the oldest value.
+    size_type       current_size; ///< The number of values in the buffer.
+    const size_type CAPACITY;     ///< The maximum number of values in the buffer.
+    ETL_DECLARE_DEBUG_COUNT       ///< Internal debugging.
+  };
+
+  //***************************************************************************
+  /// The base class for circular_buffers of a particular type.
+  /// Can be used as a reference type for all circular_buffers containing a specific type.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  template <typename T>
+  class icircular_buffer : public etl::circular_buffer_base
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef ptrdiff_t         difference_type;
+
+  protected:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    /// Holds the position relative to the oldest value.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, T>
+    {
+    public:
+
+      friend class icircular_buffer;
+      friend class const_iterator;
+
+      iterator()
+        : p_buffer(0),
+          position(0U)
+      {
+      }
+
+      reference operator *() const
+      {
+        return (*p_buffer)[position];
+      }
+
+      pointer operator ->() const
+      {
+        return &(*p_buffer)[position];
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return (*p_buffer)[size_t(difference_type(position) + n)];
+      }
+
+      iterator& operator ++()
+      {
+        ++position;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++position;
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --position;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --position;
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        position = size_t(difference_type(position) + n);
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        position = size_t(difference_type(position) - n);
+        return *this;
+      }
+
+      friend iterator operator +(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(difference_type n, const iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend iterator operator -(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return difference_type(lhs.position) - difference_type(rhs.position);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position != rhs.position;
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position < rhs.position;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position > rhs.position;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position <= rhs.position;
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position >= rhs.position;
+      }
+
+    private:
+
+      iterator(icircular_buffer* p_buffer_, size_t position_)
+        : p_buffer(p_buffer_),
+          position(position_)
+      {
+      }
+
+      icircular_buffer* p_buffer;
+      size_t            position;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    /// Holds the position relative to the oldest value.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const T>
+    {
+    public:
+
+      friend class icircular_buffer;
+
+      const_iterator()
+        : p_buffer(0),
+          position(0U)
+      {
+      }
+
+      const_iterator(const typename icircular_buffer::iterator& other)
+        : p_buffer(other.p_buffer),
+          position(other.position)
+      {
+      }
+
+      const_reference operator *() const
+      {
+        return (*p_buffer)[position];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(*p_buffer)[position];
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return (*p_buffer)[size_t(difference_type(position) + n)];
+      }
+
+      const_iterator& operator ++()
+      {
+        ++position;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++position;
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --position;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --position;
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        position = size_t(difference_type(position) + n);
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        position = size_t(difference_type(position) - n);
+        return *this;
+      }
+
+      friend const_iterator operator +(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend const_iterator operator +(difference_type n, const const_iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend const_iterator operator -(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return difference_type(lhs.position) - difference_type(rhs.position);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position != rhs.position;
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position < rhs.position;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position > rhs.position;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position <= rhs.position;
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position >= rhs.position;
+      }
+
+    private:
+
+      const_iterator(const icircular_buffer* p_buffer_, size_t position_)
+        : p_buffer(p_buffer_),
+          position(position_)
+      {
+      }
+
+      const icircular_buffer* p_buffer;
+      size_t                  position;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the oldest value.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the oldest value.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the oldest value.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to one past the newest value.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to one past the newest value.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to one past the newest value.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the newest value.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the newest value.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the newest value.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to one before the oldest value.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to one before the oldest value.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to one before the oldest value.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at the index, counted from the oldest.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return p_buffer[add_index(out, index)];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at the index, counted from the oldest.
+    //*************************************************************************
+    const_reference operator [](size_t index) const
+    {
+      return p_buffer[add_index(out, index)];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the oldest value.
+    //*************************************************************************
+    reference front()
+    {
+      return p_buffer[out];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the oldest value.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return p_buffer[out];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the newest value.
+    //*************************************************************************
+    reference back()
+    {
+      return p_buffer[add_index(out, current_size - 1U)];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the newest value.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return p_buffer[add_index(out, current_size - 1U)];
+    }
+
+    //*************************************************************************
+    /// Returns a view of the oldest values, up to the end of the buffer memory.
+    //*************************************************************************
+    etl::array_view<T> array_one()
+    {
+      return etl::array_view<T>(p_buffer + out, first_segment_size());
+    }
+
+    //*************************************************************************
+    /// Returns a view of the oldest values, up to the end of the buffer memory.
+    //*************************************************************************
+    etl::array_view<const T> array_one() const
+    {
+      return etl::array_view<const T>(p_buffer + out, first_segment_size());
+    }
+
+    //*************************************************************************
+    /// Returns a view of the newest values that wrapped to the start of the
+    /// buffer memory. Empty if the values do not wrap.
+    //*************************************************************************
+    etl::array_view<T> array_two()
+    {
+      return etl::array_view<T>(p_buffer, current_size - first_segment_size());
+    }
+
+    //*************************************************************************
+    /// Returns a view of the newest values that wrapped to the start of the
+    /// buffer memory. Empty if the values do not wrap.
+    //*************************************************************************
+    etl::array_view<const T> array_two() const
+    {
+      return etl::array_view<const T>(p_buffer, current_size - first_segment_size());
+    }
+
+    //*************************************************************************
+    /// Adds a value after the newest.
+    /// If the buffer is full the oldest value is overwritten.
+    //*************************************************************************
+    void push(parameter_t value)
+    {
+      const size_t in = add_index(out, current_size % CAPACITY);
+
+      if (full())
+      {
+        p_buffer[in] = value;
+        out = add_index(out, 1U);
+      }
+      else
+      {
+        ::new (p_buffer + in) T(value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values after the newest.
+    /// If the buffer becomes full the oldest values are overwritten.
+    //*************************************************************************
+    template <typename TIterator>
+    void push(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        push(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value.
+    /// If asserts or exceptions are enabled, emits circular_buffer_empty if the buffer is empty.
+    //*************************************************************************
+    void pop()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_CONTAINER(!empty(), ETL_ERROR(circular_buffer_empty));
+#endif
+      etl::destroy_at(p_buffer + out);
+      out = add_index(out, 1U);
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// Removes the 'n' oldest values.
+    /// If asserts or exceptions are enabled, emits circular_buffer_empty if there are fewer than 'n' values.
+    //*************************************************************************
+    void pop(size_t n)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_CONTAINER(n <= current_size, ETL_ERROR(circular_buffer_empty));
+#endif
+      while (n-- != 0U)
+      {
+        pop();
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all values.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        current_size = 0U;
+        ETL_RESET_DEBUG_COUNT
+      }
+      else
+      {
+        while (current_size != 0U)
+        {
+          pop();
+        }
+      }
+
+      out = 0U;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    icircular_buffer& operator =(const icircular_buffer& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        push(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icircular_buffer(T* p_buffer_, size_t capacity_)
+      : circular_buffer_base(capacity_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The number of values from the oldest to the end of the buffer memory.
+    //*************************************************************************
+    size_t first_segment_size() const
+    {
+      return etl::min(current_size, size_t(CAPACITY - out));
+    }
+
+    // Disable copy construction.
+    icircular_buffer(const icircular_buffer&);
+
+    T* p_buffer; ///< The buffer memory.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_CIRCULAR_BUFFER) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~icircular_buffer()
+    {
+    }
+#else
+  protected:
+    ~icircular_buffer()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A circular_buffer with the capacity defined at compile time.
+  ///\tparam T         The type of value held.
+  ///\tparam MAX_SIZE_ The maximum number of values held.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class circular_buffer : public etl::icircular_buffer<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::circular_buffer is not valid");
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    circular_buffer()
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// Only the newest MAX_SIZE values are kept.
+    //*************************************************************************
+    template <typename TIterator>
+    circular_buffer(TIterator first, TIterator last)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->push(first, last);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    circular_buffer(const circular_buffer& other)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->push(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    circular_buffer& operator =(const circular_buffer& rhs)
+    {
+      etl::icircular_buffer<T>::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~circular_buffer()
+    {
+      this->clear();
+    }
+
+  private:
+
+    /// The buffer memory.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+  };
+
+  //***************************************************************************
+  /// A circular_buffer that uses an external buffer.
+  ///\tparam T The type of value held.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  template <typename T>
+  class circular_buffer<T, 0> : public etl::icircular_buffer<T>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    circular_buffer(void* buffer, size_t max_size)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// Only the newest max_size values are kept.
+    //*************************************************************************
+    template <typename TIterator>
+    circular_buffer(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+    {
+      this->push(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    circular_buffer& operator =(const circular_buffer& rhs)
+    {
+      etl::icircular_buffer<T>::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~circular_buffer()
+    {
+      this->clear();
+    }
+
+  private:
+
+    // Disable copy construction, as there is no buffer to copy in to.
+    circular_buffer(const circular_buffer&);
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,161 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CLOCK_CACHE_INCLUDED
+#define ETL_CLOCK_CACHE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "hash.h"
+#include "functional.h"
+#include "private/cache_base.h"
+
+namespace etl
+{
+  namespace private_cache
+  {
+    //*************************************************************************
+    /// A per-entry reference bit and its position on the clock face.
+    //*************************************************************************
+    struct clock_slot
+    {
+      size_t slot;
+      bool   referenced;
+    };
+  }
+
+  //***************************************************************************
+  /// A fixed capacity cache using the CLOCK (second chance) policy.
+  /// A hit only sets a bit, so reads are cheaper than for lru_cache, and
+  /// entries touched once by a scan are evicted before ones that are reused.
+  /// When full, the hand sweeps the entries, clearing set bits, and evicts
+  /// the first entry whose bit was already clear.
+  ///\ingroup cache
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type.
+  ///\tparam SIZE      The maximum number of cached entries.
+  ///\tparam THash     The hash functor for the key.
+  ///\tparam TKeyEqual The key equality functor.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class clock_cache : public etl::private_cache::cache_base<TKey, TValue, etl::private_cache::clock_slot, SIZE_, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_cache::cache_base<TKey, TValue, etl::private_cache::clock_slot, SIZE_, THash, TKeyEqual> base_t;
+    typedef typename base_t::entry_t entry_t;
+
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    clock_cache()
+      : hand(0U)
+      , free_count(SIZE)
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        slots[i]      = nullptr;
+        free_slots[i] = SIZE - 1U - i;
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes back any dirty values.
+    //*************************************************************************
+    ~clock_cache()
+    {
+      this->clear();
+    }
+
+  protected:
+
+    //*************************************************************************
+    virtual void on_insert(entry_t& e)
+    {
+      e.slot        = free_slots[--free_count];
+      e.referenced  = false;
+      slots[e.slot] = &e;
+    }
+
+    //*************************************************************************
+    virtual void on_hit(entry_t& e)
+    {
+      e.referenced = true;
+    }
+
+    //*************************************************************************
+    virtual void on_erase(entry_t& e)
+    {
+      slots[e.slot] = nullptr;
+      free_slots[free_count++] = e.slot;
+    }
+
+    //*************************************************************************
+    virtual entry_t& victim()
+    {
+      while (true)
+      {
+        entry_t* p_entry = slots[hand];
+
+        hand = (hand + 1U == SIZE) ? 0U : hand + 1U;
+
+        if (p_entry != nullptr)
+        {
+          if (!p_entry->referenced)
+          {
+            return *p_entry;
+          }
+
+          p_entry->referenced = false;
+        }
+      }
+    }
+
+  private:
+
+    // Should not be copied.
+    clock_cache(const clock_cache&);
+    clock_cache& operator =(const clock_cache&);
+
+    entry_t* slots[SIZE];      ///< The clock face.
+    size_t   free_slots[SIZE]; ///< A stack of the empty slots.
+    size_t   hand;
+    size_t   free_count;
+  };
+}
+
+#endif
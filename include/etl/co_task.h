@@ -0,0 +1,907 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CO_TASK_INCLUDED
+#define ETL_CO_TASK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && defined(__has_include)
+  #if __has_include(<coroutine>)
+    #define ETL_HAS_COROUTINES 1
+  #endif
+#endif
+
+#if defined(ETL_HAS_COROUTINES)
+
+#include <coroutine>
+
+#include "task.h"
+#include "pool.h"
+#include "arena.h"
+#include "callback_timer.h"
+#include "function.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "nullptr.h"
+
+///\defgroup co_task co_task
+/// C++20 coroutine tasks, run by an etl::co_scheduler.
+/// Coroutine frames are never allocated from the heap. Every coroutine that
+/// returns etl::co_task must take an etl::ico_frame_allocator& parameter; the
+/// frame is allocated from it. If the allocator is exhausted the coroutine
+/// returns an invalid co_task.
+///\code
+/// etl::co_task handler(etl::ico_frame_allocator& frames, connection& c)
+/// {
+///   for (;;)
+///   {
+///     packet p = co_await etl::co_pop(c.rx_queue);
+///     ...
+///     co_await etl::co_delay(timers, 10U);
+///   }
+/// }
+///
+/// scheduler.spawn(handler(frames, c));
+///\endcode
+/// etl::co_scheduler is an etl::task, so it may be added to an etl::scheduler.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for coroutine frame allocators.
+  ///\ingroup co_task
+  //***************************************************************************
+  class ico_frame_allocator
+  {
+  public:
+
+    /// The alignment of the returned storage.
+    static const size_t FRAME_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    //*************************************************************************
+    /// Allocates 'size' bytes aligned to FRAME_ALIGNMENT.
+    /// Returns nullptr if there is no space.
+    //*************************************************************************
+    virtual void* allocate(size_t size) = 0;
+
+    //*************************************************************************
+    /// Frees storage returned by allocate.
+    //*************************************************************************
+    virtual void deallocate(void* p, size_t size) = 0;
+
+  protected:
+
+    ~ico_frame_allocator()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Allocates coroutine frames from an etl::ipool.
+  /// The pool's items must be at least as large as the largest frame and
+  /// aligned to ico_frame_allocator::FRAME_ALIGNMENT.
+  ///\ingroup co_task
+  //***************************************************************************
+  class co_pool_allocator : public etl::ico_frame_allocator
+  {
+  public:
+
+    explicit co_pool_allocator(etl::ipool& pool_)
+      : pool(pool_)
+    {
+    }
+
+    void* allocate(size_t size) override
+    {
+      void* p = nullptr;
+
+      if (size <= pool.item_size())
+      {
+        pool.allocate_batch(&p, 1U);
+      }
+
+      return p;
+    }
+
+    void deallocate(void* p, size_t) override
+    {
+      pool.release(p);
+    }
+
+  private:
+
+    etl::ipool& pool;
+  };
+
+  //***************************************************************************
+  /// Allocates coroutine frames from an etl::iarena.
+  /// Frames are not freed individually; the arena is rewound or reset by the
+  /// user once the coroutines using it have finished.
+  ///\ingroup co_task
+  //***************************************************************************
+  class co_arena_allocator : public etl::ico_frame_allocator
+  {
+  public:
+
+    explicit co_arena_allocator(etl::iarena& arena_)
+      : arena(arena_)
+    {
+    }
+
+    void* allocate(size_t size) override
+    {
+      if (arena.available() < (size + FRAME_ALIGNMENT))
+      {
+        return nullptr;
+      }
+
+      return arena.allocate(size, FRAME_ALIGNMENT);
+    }
+
+    void deallocate(void*, size_t) override
+    {
+    }
+
+  private:
+
+    etl::iarena& arena;
+  };
+
+  class co_scheduler;
+
+  namespace private_co_task
+  {
+    //*************************************************************************
+    /// A suspended coroutine waiting for a condition.
+    /// Held in the scheduler's intrusive lists, so there is no limit on the
+    /// number of coroutines.
+    //*************************************************************************
+    class wait_node
+    {
+    public:
+
+      wait_node()
+        : p_next(nullptr)
+        , handle()
+      {
+      }
+
+      //***********************************
+      /// Returns true when the coroutine may be resumed.
+      //***********************************
+      virtual bool poll() = 0;
+
+      wait_node*              p_next;
+      std::coroutine_handle<> handle;
+
+    protected:
+
+      ~wait_node()
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// A node that is always ready.
+    //*************************************************************************
+    class ready_node : public wait_node
+    {
+    public:
+
+      bool poll() override
+      {
+        return true;
+      }
+    };
+
+    //*************************************************************************
+    /// Finds the frame allocator among the coroutine's arguments.
+    //*************************************************************************
+    template <typename T>
+    struct is_allocator : etl::integral_constant<bool, etl::is_base_of<etl::ico_frame_allocator, T>::value && !etl::is_const<T>::value>
+    {
+    };
+
+    template <typename... TArgs>
+    struct has_allocator : etl::false_type
+    {
+    };
+
+    template <typename T, typename... TRest>
+    struct has_allocator<T, TRest...>
+      : etl::integral_constant<bool, is_allocator<T>::value || has_allocator<TRest...>::value>
+    {
+    };
+
+    template <typename T>
+    etl::ico_frame_allocator* select_allocator(T& value, etl::true_type)
+    {
+      return &value;
+    }
+
+    template <typename T>
+    etl::ico_frame_allocator* select_allocator(T&, etl::false_type)
+    {
+      return nullptr;
+    }
+
+    inline etl::ico_frame_allocator* find_allocator()
+    {
+      return nullptr;
+    }
+
+    template <typename T, typename... TRest>
+    etl::ico_frame_allocator* find_allocator(T& first, TRest&... rest)
+    {
+      etl::ico_frame_allocator* p_allocator = select_allocator(first, etl::integral_constant<bool, is_allocator<T>::value>());
+
+      return (p_allocator != nullptr) ? p_allocator : find_allocator(rest...);
+    }
+  }
+
+  //***************************************************************************
+  /// A coroutine task.
+  /// Created suspended; runs when given to etl::co_scheduler::spawn.
+  /// A task that is never spawned is destroyed with its co_task.
+  ///\ingroup co_task
+  //***************************************************************************
+  class co_task
+  {
+  public:
+
+    class promise_type;
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    //*************************************************************************
+    /// The coroutine promise.
+    //*************************************************************************
+    class promise_type
+    {
+    public:
+
+      promise_type()
+        : p_scheduler(nullptr)
+      {
+      }
+
+      //***********************************
+      /// Allocates the frame from the first etl::ico_frame_allocator argument.
+      /// The allocator is stored ahead of the frame so that it can be freed.
+      //***********************************
+      template <typename... TArgs>
+      static void* operator new(size_t size, TArgs&... args) noexcept
+      {
+        static_assert(private_co_task::has_allocator<TArgs...>::value, "etl::co_task coroutines must take an etl::ico_frame_allocator& parameter");
+
+        etl::ico_frame_allocator* p_allocator = private_co_task::find_allocator(args...);
+
+        char* p_block = static_cast<char*>(p_allocator->allocate(size + HEADER_SIZE));
+
+        if (p_block == nullptr)
+        {
+          return nullptr;
+        }
+
+        *reinterpret_cast<etl::ico_frame_allocator**>(p_block) = p_allocator;
+
+        return p_block + HEADER_SIZE;
+      }
+
+      static void operator delete(void* p, size_t size) noexcept
+      {
+        char* p_block = static_cast<char*>(p) - HEADER_SIZE;
+
+        (*reinterpret_cast<etl::ico_frame_allocator**>(p_block))->deallocate(p_block, size + HEADER_SIZE);
+      }
+
+      static co_task get_return_object_on_allocation_failure() noexcept
+      {
+        return co_task();
+      }
+
+      co_task get_return_object() noexcept
+      {
+        return co_task(handle_type::from_promise(*this));
+      }
+
+      std::suspend_always initial_suspend() noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //***********************************
+      /// Destroys the frame and tells the scheduler.
+      //***********************************
+      struct final_awaiter
+      {
+        bool await_ready() noexcept
+        {
+          return false;
+        }
+
+        void await_suspend(handle_type handle) noexcept;
+
+        void await_resume() noexcept
+        {
+        }
+      };
+
+      final_awaiter final_suspend() noexcept
+      {
+        return final_awaiter();
+      }
+
+      void return_void()
+      {
+      }
+
+      void unhandled_exception()
+      {
+#if defined(ETL_THROW_EXCEPTIONS)
+        throw;
+#endif
+      }
+
+      etl::co_scheduler*          p_scheduler;
+      private_co_task::ready_node start_node;
+
+    private:
+
+      static const size_t HEADER_SIZE = etl::ico_frame_allocator::FRAME_ALIGNMENT;
+    };
+
+    //*************************************************************************
+    /// Constructs an invalid task.
+    //*************************************************************************
+    co_task()
+      : handle()
+    {
+    }
+
+    co_task(co_task&& other)
+      : handle(other.handle)
+    {
+      other.handle = handle_type();
+    }
+
+    co_task& operator =(co_task&& other)
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle       = other.handle;
+        other.handle = handle_type();
+      }
+
+      return *this;
+    }
+
+    co_task(const co_task&) = delete;
+    co_task& operator =(const co_task&) = delete;
+
+    ~co_task()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Returns false if the frame could not be allocated, or the task has
+    /// been given to a scheduler.
+    //*************************************************************************
+    bool valid() const
+    {
+      return static_cast<bool>(handle);
+    }
+
+  private:
+
+    friend class etl::co_scheduler;
+
+    explicit co_task(handle_type handle_)
+      : handle(handle_)
+    {
+    }
+
+    handle_type release()
+    {
+      handle_type h = handle;
+      handle = handle_type();
+
+      return h;
+    }
+
+    void destroy()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle = handle_type();
+      }
+    }
+
+    handle_type handle;
+  };
+
+  //***************************************************************************
+  /// Runs coroutine tasks.
+  /// As an etl::task, task_request_work() polls the waiting coroutines and
+  /// returns the number that are ready; task_process_work() resumes them.
+  /// Coroutines that become ready while others are resumed run on the next
+  /// call.
+  ///\ingroup co_task
+  //***************************************************************************
+  class co_scheduler : public etl::task
+  {
+  public:
+
+    explicit co_scheduler(etl::task_priority_t priority = 0U)
+      : etl::task(priority)
+      , p_waiting(nullptr)
+      , pp_waiting_tail(&p_waiting)
+      , p_ready_head(nullptr)
+      , p_ready_tail(nullptr)
+      , ready_count(0U)
+      , task_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destroys any coroutines that have not finished.
+    //*************************************************************************
+    ~co_scheduler()
+    {
+      clear();
+    }
+
+    co_scheduler(const co_scheduler&) = delete;
+    co_scheduler& operator =(const co_scheduler&) = delete;
+
+    //*************************************************************************
+    /// Takes ownership of a task and makes it ready to run.
+    /// Returns false if the task is invalid.
+    //*************************************************************************
+    bool spawn(co_task&& task)
+    {
+      if (!task.valid())
+      {
+        return false;
+      }
+
+      co_task::handle_type handle = task.release();
+
+      co_task::promise_type& promise = handle.promise();
+      promise.p_scheduler       = this;
+      promise.start_node.handle = handle;
+
+      make_ready(promise.start_node);
+      ++task_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Polls the waiting coroutines and returns the number that are ready.
+    //*************************************************************************
+    uint32_t task_request_work() const override
+    {
+      private_co_task::wait_node** pp_node = &p_waiting;
+
+      while (*pp_node != nullptr)
+      {
+        private_co_task::wait_node* p_node = *pp_node;
+
+        if (p_node->poll())
+        {
+          *pp_node = p_node->p_next;
+
+          if (pp_waiting_tail == &p_node->p_next)
+          {
+            pp_waiting_tail = pp_node;
+          }
+
+          make_ready(*p_node);
+        }
+        else
+        {
+          pp_node = &p_node->p_next;
+        }
+      }
+
+      return uint32_t(ready_count);
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutines that are ready.
+    //*************************************************************************
+    void task_process_work() override
+    {
+      private_co_task::wait_node* p_node = p_ready_head;
+
+      p_ready_head = nullptr;
+      p_ready_tail = nullptr;
+      ready_count  = 0U;
+
+      while (p_node != nullptr)
+      {
+        private_co_task::wait_node* p_next = p_node->p_next;
+        p_node->p_next = nullptr;
+
+        // The node may not be used after this; it lives in the frame.
+        p_node->handle.resume();
+
+        p_node = p_next;
+      }
+    }
+
+    //*************************************************************************
+    /// Runs until no coroutine is ready.
+    /// Returns the number of rounds of resumption.
+    //*************************************************************************
+    size_t run_until_idle()
+    {
+      size_t rounds = 0U;
+
+      while (task_request_work() > 0U)
+      {
+        task_process_work();
+        ++rounds;
+      }
+
+      return rounds;
+    }
+
+    //*************************************************************************
+    /// Destroys all unfinished coroutines.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_list(p_waiting);
+      destroy_list(p_ready_head);
+
+      pp_waiting_tail = &p_waiting;
+      p_ready_tail    = nullptr;
+      ready_count  = 0U;
+      task_count   = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of unfinished coroutines.
+    //*************************************************************************
+    size_t size() const
+    {
+      return task_count;
+    }
+
+    bool empty() const
+    {
+      return task_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a suspended coroutine's node to the end of the waiting list.
+    /// Used by awaitables.
+    //*************************************************************************
+    void wait(private_co_task::wait_node& node)
+    {
+      node.p_next      = nullptr;
+      *pp_waiting_tail = &node;
+      pp_waiting_tail  = &node.p_next;
+    }
+
+    //*************************************************************************
+    /// Called when a coroutine finishes.
+    //*************************************************************************
+    void task_finished()
+    {
+      --task_count;
+    }
+
+  private:
+
+    void make_ready(private_co_task::wait_node& node) const
+    {
+      node.p_next = nullptr;
+
+      if (p_ready_tail == nullptr)
+      {
+        p_ready_head = &node;
+      }
+      else
+      {
+        p_ready_tail->p_next = &node;
+      }
+
+      p_ready_tail = &node;
+      ++ready_count;
+    }
+
+    static void destroy_list(private_co_task::wait_node*& p_head)
+    {
+      while (p_head != nullptr)
+      {
+        private_co_task::wait_node* p_node = p_head;
+        p_head = p_node->p_next;
+        p_node->handle.destroy();
+      }
+    }
+
+    mutable private_co_task::wait_node*  p_waiting;
+    mutable private_co_task::wait_node** pp_waiting_tail;
+    mutable private_co_task::wait_node*  p_ready_head;
+    mutable private_co_task::wait_node*  p_ready_tail;
+    mutable size_t                       ready_count;
+    size_t                               task_count;
+  };
+
+  //***************************************************************************
+  inline void co_task::promise_type::final_awaiter::await_suspend(handle_type handle) noexcept
+  {
+    etl::co_scheduler* p_scheduler = handle.promise().p_scheduler;
+
+    handle.destroy();
+
+    if (p_scheduler != nullptr)
+    {
+      p_scheduler->task_finished();
+    }
+  }
+
+  namespace private_co_task
+  {
+    //*************************************************************************
+    /// Base for awaitables that wait on a condition.
+    //*************************************************************************
+    class awaiter_base : public wait_node
+    {
+    public:
+
+      void await_suspend(etl::co_task::handle_type handle_)
+      {
+        handle = handle_;
+        handle_.promise().p_scheduler->wait(*this);
+      }
+
+    protected:
+
+      ~awaiter_base()
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Waits until a value can be popped from a source with bool pop(T&).
+    //*************************************************************************
+    template <typename TSource, typename T>
+    class pop_awaiter : public awaiter_base
+    {
+    public:
+
+      explicit pop_awaiter(TSource& source_)
+        : source(source_)
+        , value()
+      {
+      }
+
+      pop_awaiter(const pop_awaiter&) = delete;
+      pop_awaiter& operator =(const pop_awaiter&) = delete;
+
+      bool await_ready()
+      {
+        return source.pop(value);
+      }
+
+      T await_resume()
+      {
+        return etl::move(value);
+      }
+
+      bool poll() override
+      {
+        return source.pop(value);
+      }
+
+    private:
+
+      TSource& source;
+      T        value;
+    };
+
+    //*************************************************************************
+    /// Gives way to the other ready coroutines.
+    //*************************************************************************
+    class suspend_awaiter : public awaiter_base
+    {
+    public:
+
+      bool await_ready()
+      {
+        return false;
+      }
+
+      void await_resume()
+      {
+      }
+
+      bool poll() override
+      {
+        return true;
+      }
+    };
+
+    //*************************************************************************
+    /// Waits for a one shot callback timer.
+    //*************************************************************************
+    class delay_awaiter : public wait_node
+    {
+    public:
+
+      delay_awaiter(etl::icallback_timer& timers_, uint32_t ticks_)
+        : timers(timers_)
+        , ticks(ticks_)
+        , id(etl::timer::id::NO_TIMER)
+        , expired(false)
+        , callback(*this, &delay_awaiter::on_timeout)
+      {
+      }
+
+      delay_awaiter(const delay_awaiter&) = delete;
+      delay_awaiter& operator =(const delay_awaiter&) = delete;
+
+      //***********************************
+      /// Stops the timer if the coroutine is destroyed while waiting.
+      //***********************************
+      ~delay_awaiter()
+      {
+        release_timer();
+      }
+
+      bool await_ready()
+      {
+        return ticks == 0U;
+      }
+
+      //***********************************
+      /// Does not suspend if no timer is free.
+      //***********************************
+      bool await_suspend(etl::co_task::handle_type handle_)
+      {
+        id = timers.register_timer(callback, ticks, false);
+
+        if (id == etl::timer::id::NO_TIMER)
+        {
+          return false;
+        }
+
+        timers.start(id);
+
+        handle = handle_;
+        handle_.promise().p_scheduler->wait(*this);
+
+        return true;
+      }
+
+      //***********************************
+      /// Returns false if no timer was free.
+      //***********************************
+      bool await_resume()
+      {
+        const bool result = (ticks == 0U) || expired;
+
+        release_timer();
+
+        return result;
+      }
+
+      bool poll() override
+      {
+        return expired;
+      }
+
+    private:
+
+      void on_timeout()
+      {
+        expired = true;
+      }
+
+      void release_timer()
+      {
+        if (id != etl::timer::id::NO_TIMER)
+        {
+          timers.unregister_timer(id);
+          id = etl::timer::id::NO_TIMER;
+        }
+      }
+
+      etl::icallback_timer&                  timers;
+      uint32_t                               ticks;
+      etl::timer::id::type                   id;
+      bool                                   expired;
+      etl::function<delay_awaiter, void>     callback;
+    };
+  }
+
+  //***************************************************************************
+  /// Waits for a value from a queue, such as etl::queue_spsc_atomic.
+  ///\code
+  /// int value = co_await etl::co_pop(queue);
+  ///\endcode
+  ///\ingroup co_task
+  //***************************************************************************
+  template <typename TQueue>
+  private_co_task::pop_awaiter<TQueue, typename TQueue::value_type> co_pop(TQueue& queue)
+  {
+    return private_co_task::pop_awaiter<TQueue, typename TQueue::value_type>(queue);
+  }
+
+  //***************************************************************************
+  /// Waits for a message from an etl::message_inbox.
+  /// Returns the inbox's item_type, holding the sender and the message.
+  ///\code
+  /// auto item = co_await etl::co_receive(inbox);
+  /// const etl::imessage& message = item.get();
+  ///\endcode
+  ///\ingroup co_task
+  //***************************************************************************
+  template <typename TInbox>
+  private_co_task::pop_awaiter<TInbox, typename TInbox::item_type> co_receive(TInbox& inbox)
+  {
+    return private_co_task::pop_awaiter<TInbox, typename TInbox::item_type>(inbox);
+  }
+
+  //***************************************************************************
+  /// Waits for 'ticks' of an etl::icallback_timer, using one of its timers.
+  /// Evaluates to false, without waiting, if no timer is free.
+  ///\ingroup co_task
+  //***************************************************************************
+  inline private_co_task::delay_awaiter co_delay(etl::icallback_timer& timers, uint32_t ticks)
+  {
+    return private_co_task::delay_awaiter(timers, ticks);
+  }
+
+  //***************************************************************************
+  /// Gives way to the other ready coroutines until the next round.
+  ///\ingroup co_task
+  //***************************************************************************
+  inline private_co_task::suspend_awaiter co_suspend()
+  {
+    return private_co_task::suspend_awaiter();
+  }
+}
+
+#endif
+
+#endif
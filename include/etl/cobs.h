@@ -0,0 +1,335 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COBS_INCLUDED
+#define ETL_COBS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "private/framing_common.h"
+
+///\defgroup cobs COBS framing
+/// Consistent Overhead Byte Stuffing. Frames are delimited by zero bytes
+/// and encoding adds at most one byte in 254. An optional frame check
+/// sequence, such as etl::crc16_x25, is appended to each frame, least
+/// significant byte first, and is calculated in the same pass as the stuffing.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// A COBS encoder.
+  /// Each frame is begun with begin(), given data with any number of calls to
+  /// add(), and ended with end(), or encoded in one go with encode().
+  /// Up to 254 bytes are held until the length of their block is known.
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup cobs
+  //***************************************************************************
+  template <typename TFrameCheck = etl::no_frame_check>
+  class cobs_encoder
+  {
+  public:
+
+    static const size_t FCS_SIZE = private_framing::fcs_size<TFrameCheck>::value;
+    static const size_t MAX_BLOCK = 254U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cobs_encoder()
+      : block_size(0U)
+      , after_full_block(false)
+    {
+    }
+
+    //*************************************************************************
+    /// The largest possible encoding of 'n' bytes, including the delimiter
+    /// and frame check sequence.
+    //*************************************************************************
+    static size_t max_encoded_size(size_t n)
+    {
+      const size_t m = n + FCS_SIZE;
+
+      return m + (m / MAX_BLOCK) + 2U;
+    }
+
+    //*************************************************************************
+    /// Starts a frame.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator begin(TOutputIterator out)
+    {
+      fcs.reset();
+      block_size       = 0U;
+      after_full_block = false;
+
+      return out;
+    }
+
+    //*************************************************************************
+    /// Adds data to the frame. May be called any number of times.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator add(const uint8_t* begin, const uint8_t* end, TOutputIterator out)
+    {
+      return stuff(begin, end, out, true);
+    }
+
+    //*************************************************************************
+    /// Ends the frame, appending the frame check sequence and delimiter.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator end(TOutputIterator out)
+    {
+      uint8_t trailer[FCS_SIZE + 1U];
+
+      private_framing::store_fcs(fcs.value(), trailer, FCS_SIZE);
+
+      out = stuff(trailer, trailer + FCS_SIZE, out, false);
+
+      // A full block at the end of the frame needs no empty block after it.
+      if ((block_size != 0U) || !after_full_block)
+      {
+        out = write_block(out, uint8_t(block_size + 1U));
+      }
+
+      *out++ = 0U;
+
+      return out;
+    }
+
+    //*************************************************************************
+    /// Encodes a whole frame.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator encode(const uint8_t* begin_, const uint8_t* end_, TOutputIterator out)
+    {
+      out = begin(out);
+      out = add(begin_, end_, out);
+
+      return end(out);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds runs of non-zero bytes to the block, writing it out when a zero
+    /// ends it or it is full.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator stuff(const uint8_t* begin, const uint8_t* end, TOutputIterator out, bool check)
+    {
+      while (begin != end)
+      {
+        const size_t   space = MAX_BLOCK - block_size;
+        const uint8_t* limit = (size_t(end - begin) > space) ? begin + space : end;
+        const uint8_t* zero  = private_framing::find_byte(begin, limit, 0U);
+
+        if (check)
+        {
+          fcs.add(begin, zero);
+        }
+
+        etl::copy(begin, zero, block + block_size);
+        block_size += size_t(zero - begin);
+        begin       = zero;
+
+        if (block_size == MAX_BLOCK)
+        {
+          out = write_block(out, 0xFFU);
+        }
+        else if (begin != end)
+        {
+          // A zero.
+          if (check)
+          {
+            fcs.add(*begin);
+          }
+
+          ++begin;
+          out = write_block(out, uint8_t(block_size + 1U));
+        }
+      }
+
+      return out;
+    }
+
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator write_block(TOutputIterator out, uint8_t code)
+    {
+      *out++           = code;
+      out              = etl::copy(block, block + block_size, out);
+      block_size       = 0U;
+      after_full_block = (code == 0xFFU);
+
+      return out;
+    }
+
+    TFrameCheck fcs;
+    size_t      block_size;
+    bool        after_full_block;
+    uint8_t     block[MAX_BLOCK];
+  };
+
+  //***************************************************************************
+  /// A COBS decoder.
+  /// Received data may be passed in chunks of any size to decode().
+  /// Decoded data is written straight to the user's buffer.
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup cobs
+  //***************************************************************************
+  template <typename TFrameCheck = etl::no_frame_check>
+  class cobs_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer for decoded frames.
+    ///\param capacity The size of the buffer, including the frame check sequence.
+    //*************************************************************************
+    cobs_decoder(uint8_t* buffer, size_t capacity)
+      : frame(buffer, capacity)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Decodes data until the end of a frame or the end of the data.
+    /// Returns a pointer to the first byte not used. If status() is then
+    /// not INCOMPLETE, a frame has ended; the next call starts a new one.
+    /// Zero bytes between frames are skipped.
+    //*************************************************************************
+    const uint8_t* decode(const uint8_t* begin, const uint8_t* end)
+    {
+      if (current != framing_status::INCOMPLETE)
+      {
+        reset();
+      }
+
+      while (begin != end)
+      {
+        if (remaining == 0U)
+        {
+          const uint8_t code = *begin++;
+
+          if (code == 0U)
+          {
+            if (started)
+            {
+              current = frame.finish();
+              return begin;
+            }
+          }
+          else
+          {
+            if (zero_pending)
+            {
+              frame.append(uint8_t(0U));
+            }
+
+            remaining    = size_t(code - 1U);
+            zero_pending = (code != 0xFFU);
+            started      = true;
+          }
+        }
+        else
+        {
+          const uint8_t* limit = (size_t(end - begin) > remaining) ? begin + remaining : end;
+          const uint8_t* zero  = private_framing::find_byte(begin, limit, 0U);
+
+          frame.append(begin, zero);
+          remaining -= size_t(zero - begin);
+          begin      = zero;
+
+          if (begin != limit)
+          {
+            // The frame ended part way through a block.
+            current = framing_status::FORMAT_ERROR;
+            return ++begin;
+          }
+        }
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Discards any partly decoded frame.
+    //*************************************************************************
+    void reset()
+    {
+      frame.clear();
+      current      = framing_status::INCOMPLETE;
+      remaining    = 0U;
+      zero_pending = false;
+      started      = false;
+    }
+
+    //*************************************************************************
+    /// The state of the current frame.
+    //*************************************************************************
+    framing_status::enum_type status() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// The decoded data, without the frame check sequence.
+    //*************************************************************************
+    const uint8_t* data() const
+    {
+      return frame.data();
+    }
+
+    //*************************************************************************
+    /// The size of the decoded data, without the frame check sequence.
+    /// Only meaningful once status() is COMPLETE.
+    //*************************************************************************
+    size_t size() const
+    {
+      return frame.size();
+    }
+
+  private:
+
+    private_framing::frame_buffer<TFrameCheck> frame;
+    framing_status::enum_type                  current;
+    size_t                                     remaining;
+    bool                                       zero_pending;
+    bool                                       started;
+  };
+}
+
+#endif
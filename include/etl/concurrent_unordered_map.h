@@ -0,0 +1,632 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+#define ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex/spinlock.h"
+#include "hash.h"
+#include "functional.h"
+#include "power.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup concurrent_unordered_map concurrent_unordered_map
+/// A fixed capacity hash map that may be shared between threads.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup concurrent_unordered_map
+  /// A hash map for many threads, that does not allocate.
+  /// The keys are divided between STRIPES independent open addressed tables,
+  /// each with its own write lock and sequence counter, on its own cache line.
+  /// Writers to different stripes do not contend.
+  /// Readers take no lock and write no shared memory. They probe the table
+  /// and copy the value, then retry if a write to the stripe overlapped,
+  /// as with etl::seqlock.
+  /// Keys and values are held in atomic words, so that a read that races a
+  /// write is well defined before it is discarded.
+  /// Each stripe holds up to MAX_SIZE / STRIPES elements, rounded up.
+  /// Insertion fails, rather than asserts, when the key's stripe is full.
+  ///\tparam TKey      A trivially copyable key type.
+  ///\tparam TMapped   A trivially copyable mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\tparam STRIPES_  The number of independently locked stripes.
+  ///\tparam TLock     The write lock. Any type with lock() and unlock(),
+  ///                  such as etl::spinlock or etl::ticket_lock.
+  //***************************************************************************
+  template <typename TKey,
+            typename TMapped,
+            const size_t MAX_SIZE_,
+            const size_t STRIPES_  = 8U,
+            typename THash         = etl::hash<TKey>,
+            typename TKeyEqual     = etl::equal_to<TKey>,
+            typename TLock         = etl::spinlock>
+  class concurrent_unordered_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TKey>::value,    "The key must be trivially copyable");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TMapped>::value, "The mapped type must be trivially copyable");
+    ETL_STATIC_ASSERT(STRIPES_ > 0U,                              "There must be at least one stripe");
+
+    typedef TKey      key_type;
+    typedef TMapped   mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+    typedef size_t    size_type;
+
+    static const size_t MAX_SIZE     = MAX_SIZE_;
+    static const size_t STRIPES      = STRIPES_;
+    static const size_t STRIPE_SIZE  = (MAX_SIZE_ + STRIPES_ - 1U) / STRIPES_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    concurrent_unordered_map()
+    {
+      for (size_t s = 0U; s < STRIPES; ++s)
+      {
+        stripe_t& stripe = stripes[s];
+
+        stripe.sequence.store(0U, etl::memory_order_relaxed);
+        stripe.count.store(0U, etl::memory_order_relaxed);
+
+        for (size_t i = 0U; i < SLOTS; ++i)
+        {
+          stripe.slots[i].tag.store(EMPTY, etl::memory_order_relaxed);
+        }
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Finds the value for the key, without locking.
+    ///\param key   The key to find.
+    ///\param value Set to a copy of the value, if the key is found.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    bool find(const key_type& key, mapped_type& value) const
+    {
+      const size_t    hash   = key_hash_function(key);
+      const stripe_t& stripe = stripes[hash % STRIPES];
+      const word_t    tag    = make_tag(hash);
+
+      while (true)
+      {
+        const uint32_t before = stripe.sequence.load(etl::memory_order_acquire);
+
+        if ((before & 1U) == 0U)
+        {
+          value_words_t copy;
+          size_t        index;
+          const bool    found = probe(stripe, key, tag, index);
+
+          if (found)
+          {
+            load_words(stripe.slots[index].value, copy.words, VALUE_WORDS);
+          }
+
+          etl::atomic_thread_fence(etl::memory_order_acquire);
+
+          if (stripe.sequence.load(etl::memory_order_relaxed) == before)
+          {
+            if (found)
+            {
+              memcpy(&value, copy.words, sizeof(mapped_type));
+            }
+
+            return found;
+          }
+        }
+
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key, without locking.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      const size_t    hash   = key_hash_function(key);
+      const stripe_t& stripe = stripes[hash % STRIPES];
+      const word_t    tag    = make_tag(hash);
+
+      while (true)
+      {
+        const uint32_t before = stripe.sequence.load(etl::memory_order_acquire);
+
+        if ((before & 1U) == 0U)
+        {
+          size_t     index;
+          const bool found = probe(stripe, key, tag, index);
+
+          etl::atomic_thread_fence(etl::memory_order_acquire);
+
+          if (stripe.sequence.load(etl::memory_order_relaxed) == before)
+          {
+            return found;
+          }
+        }
+
+        ETL_CPU_PAUSE();
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts the key and value, if the key is not already in the map.
+    ///\return <b>true</b> if inserted, <b>false</b> if the key was already in
+    /// the map or its stripe was full.
+    //*************************************************************************
+    bool insert(const key_type& key, const mapped_type& value)
+    {
+      const size_t hash   = key_hash_function(key);
+      stripe_t&    stripe = stripes[hash % STRIPES];
+      const word_t tag    = make_tag(hash);
+
+      stripe.lock.lock();
+
+      bool   inserted = false;
+      size_t index;
+
+      if (!probe(stripe, key, tag, index) && (stripe.count.load(etl::memory_order_relaxed) < STRIPE_SIZE))
+      {
+        const uint32_t s = begin_write(stripe);
+        store_new(stripe, index, tag, key, value);
+        end_write(stripe, s);
+
+        inserted = true;
+      }
+
+      stripe.lock.unlock();
+
+      return inserted;
+    }
+
+    //*************************************************************************
+    /// Inserts the key and value, or assigns the value if the key is already
+    /// in the map.
+    ///\return <b>true</b> if the key is now in the map, <b>false</b> if its
+    /// stripe was full.
+    //*************************************************************************
+    bool insert_or_assign(const key_type& key, const mapped_type& value)
+    {
+      const size_t hash   = key_hash_function(key);
+      stripe_t&    stripe = stripes[hash % STRIPES];
+      const word_t tag    = make_tag(hash);
+
+      stripe.lock.lock();
+
+      bool   success = true;
+      size_t index;
+
+      if (probe(stripe, key, tag, index))
+      {
+        const uint32_t s = begin_write(stripe);
+        store_words(stripe.slots[index].value, &value, sizeof(mapped_type), VALUE_WORDS);
+        end_write(stripe, s);
+      }
+      else if (stripe.count.load(etl::memory_order_relaxed) < STRIPE_SIZE)
+      {
+        const uint32_t s = begin_write(stripe);
+        store_new(stripe, index, tag, key, value);
+        end_write(stripe, s);
+      }
+      else
+      {
+        success = false;
+      }
+
+      stripe.lock.unlock();
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Changes the value for the key with a read-modify-write that no other
+    /// writer can interleave.
+    ///\param modifier Called as modifier(mapped_type&) with a copy of the value.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    template <typename TModifier>
+    bool update(const key_type& key, TModifier modifier)
+    {
+      const size_t hash   = key_hash_function(key);
+      stripe_t&    stripe = stripes[hash % STRIPES];
+      const word_t tag    = make_tag(hash);
+
+      stripe.lock.lock();
+
+      size_t     index;
+      const bool found = probe(stripe, key, tag, index);
+
+      if (found)
+      {
+        slot_t& slot = stripe.slots[index];
+
+        value_words_t copy;
+        load_words(slot.value, copy.words, VALUE_WORDS);
+
+        mapped_type value;
+        memcpy(&value, copy.words, sizeof(mapped_type));
+
+        modifier(value);
+
+        const uint32_t s = begin_write(stripe);
+        store_words(slot.value, &value, sizeof(mapped_type), VALUE_WORDS);
+        end_write(stripe, s);
+      }
+
+      stripe.lock.unlock();
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Erases the key.
+    /// Later entries of the probe sequence are shifted back, so that no
+    /// deleted markers build up.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    bool erase(const key_type& key)
+    {
+      const size_t hash   = key_hash_function(key);
+      stripe_t&    stripe = stripes[hash % STRIPES];
+      const word_t tag    = make_tag(hash);
+
+      stripe.lock.lock();
+
+      size_t     index;
+      const bool found = probe(stripe, key, tag, index);
+
+      if (found)
+      {
+        const uint32_t s = begin_write(stripe);
+        remove(stripe, index);
+        stripe.count.store(stripe.count.load(etl::memory_order_relaxed) - 1U, etl::memory_order_relaxed);
+        end_write(stripe, s);
+      }
+
+      stripe.lock.unlock();
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Erases all of the elements.
+    /// Each stripe is cleared atomically, but not all stripes at once.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < STRIPES; ++i)
+      {
+        stripe_t& stripe = stripes[i];
+
+        stripe.lock.lock();
+
+        const uint32_t s = begin_write(stripe);
+
+        for (size_t j = 0U; j < SLOTS; ++j)
+        {
+          stripe.slots[j].tag.store(EMPTY, etl::memory_order_relaxed);
+        }
+
+        stripe.count.store(0U, etl::memory_order_relaxed);
+
+        end_write(stripe, s);
+
+        stripe.lock.unlock();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of elements.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < STRIPES; ++i)
+      {
+        n += stripes[i].count.load(etl::memory_order_relaxed);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Is the map empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// The maximum number of elements.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return STRIPES * STRIPE_SIZE;
+    }
+
+    //*************************************************************************
+    /// The number of writes to the key's stripe.
+    /// Lets a reader check for a change without copying the value.
+    //*************************************************************************
+    uint32_t version(const key_type& key) const
+    {
+      return stripes[key_hash_function(key) % STRIPES].sequence.load(etl::memory_order_acquire) / 2U;
+    }
+
+  private:
+
+    typedef uint32_t word_t;
+
+    static const size_t KEY_WORDS   = (sizeof(TKey) + sizeof(word_t) - 1U) / sizeof(word_t);
+    static const size_t VALUE_WORDS = (sizeof(TMapped) + sizeof(word_t) - 1U) / sizeof(word_t);
+
+    // The load factor of a full stripe is no more than 0.5.
+    static const size_t SLOTS = etl::power_of_2_round_up<2U * STRIPE_SIZE>::value;
+    static const size_t MASK  = SLOTS - 1U;
+
+    static const word_t EMPTY = 0U;
+
+    //*************************************************************************
+    /// A slot of a stripe.
+    /// The tag is zero when empty, otherwise the home slot of the key,
+    /// shifted up, with the low bit set.
+    //*************************************************************************
+    struct slot_t
+    {
+      etl::atomic<word_t> tag;
+      etl::atomic<word_t> key[KEY_WORDS];
+      etl::atomic<word_t> value[VALUE_WORDS];
+    };
+
+    //*************************************************************************
+    /// An independently locked table.
+    //*************************************************************************
+    struct stripe_t
+    {
+      etl::atomic<uint32_t> sequence; ///< Odd while a write is in progress.
+      etl::atomic<uint32_t> count;
+      TLock                 lock;
+      slot_t                slots[SLOTS];
+#if ETL_CACHE_LINE_SIZE > 0
+      char                  padding[ETL_CACHE_LINE_SIZE];
+#endif
+    };
+
+    //*************************************************************************
+    /// Suitably aligned copies of the words of a key or value.
+    //*************************************************************************
+    union key_words_t
+    {
+      word_t words[KEY_WORDS];
+      typename etl::type_with_alignment<etl::alignment_of<TKey>::value>::type dummy;
+    };
+
+    union value_words_t
+    {
+      word_t words[VALUE_WORDS];
+      typename etl::type_with_alignment<etl::alignment_of<TMapped>::value>::type dummy;
+    };
+
+    //*************************************************************************
+    /// The tag for a hash.
+    //*************************************************************************
+    static word_t make_tag(size_t hash)
+    {
+      return word_t(((hash / STRIPES) & MASK) << 1U) | 1U;
+    }
+
+    //*************************************************************************
+    /// The home slot for a tag.
+    //*************************************************************************
+    static size_t home_slot(word_t tag)
+    {
+      return size_t(tag >> 1U);
+    }
+
+    //*************************************************************************
+    static void load_words(const etl::atomic<word_t>* source, word_t* destination, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        destination[i] = source[i].load(etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    static void store_words(etl::atomic<word_t>* destination, const void* source, size_t size, size_t n)
+    {
+      word_t copy[(KEY_WORDS > VALUE_WORDS) ? KEY_WORDS : VALUE_WORDS] = { 0U };
+
+      memcpy(copy, source, size);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        destination[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Searches the stripe for the key.
+    /// Sets index to the slot of the key or, if the key is not present, to
+    /// the empty slot that ends the probe sequence.
+    /// May be called without the lock, when the result is validated by the
+    /// sequence counter.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    bool probe(const stripe_t& stripe, const key_type& key, word_t tag, size_t& index) const
+    {
+      index = home_slot(tag);
+
+      for (size_t n = 0U; n < SLOTS; ++n)
+      {
+        const word_t slot_tag = stripe.slots[index].tag.load(etl::memory_order_relaxed);
+
+        if (slot_tag == EMPTY)
+        {
+          return false;
+        }
+
+        if (slot_tag == tag)
+        {
+          key_words_t copy;
+          load_words(stripe.slots[index].key, copy.words, KEY_WORDS);
+
+          if (key_equal_function(key, *reinterpret_cast<const key_type*>(copy.words)))
+          {
+            return true;
+          }
+        }
+
+        index = (index + 1U) & MASK;
+      }
+
+      // Only seen by a reader that raced a writer; the sequence check discards it.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Starts a write to the stripe. Returns the sequence to pass to end_write.
+    //*************************************************************************
+    static uint32_t begin_write(stripe_t& stripe)
+    {
+      const uint32_t s = stripe.sequence.load(etl::memory_order_relaxed);
+
+      stripe.sequence.store(s + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      return s;
+    }
+
+    //*************************************************************************
+    static void end_write(stripe_t& stripe, uint32_t s)
+    {
+      stripe.sequence.store(s + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Fills an empty slot.
+    //*************************************************************************
+    static void store_new(stripe_t& stripe, size_t index, word_t tag, const key_type& key, const mapped_type& value)
+    {
+      slot_t& slot = stripe.slots[index];
+
+      store_words(slot.key,   &key,   sizeof(key_type),    KEY_WORDS);
+      store_words(slot.value, &value, sizeof(mapped_type), VALUE_WORDS);
+      slot.tag.store(tag, etl::memory_order_relaxed);
+
+      stripe.count.store(stripe.count.load(etl::memory_order_relaxed) + 1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Empties a slot, shifting back any later entries that would otherwise
+    /// become unreachable.
+    //*************************************************************************
+    static void remove(stripe_t& stripe, size_t hole)
+    {
+      size_t index = hole;
+
+      while (true)
+      {
+        index = (index + 1U) & MASK;
+
+        slot_t&      slot = stripe.slots[index];
+        const word_t tag  = slot.tag.load(etl::memory_order_relaxed);
+
+        if (tag == EMPTY)
+        {
+          break;
+        }
+
+        const size_t home = home_slot(tag);
+
+        // Can the entry move to the hole? Not if its home is cyclically in (hole, index].
+        const bool stays = (hole <= index) ? ((hole < home) && (home <= index))
+                                           : ((hole < home) || (home <= index));
+
+        if (!stays)
+        {
+          copy_slot(stripe.slots[hole], slot);
+          hole = index;
+        }
+      }
+
+      stripe.slots[hole].tag.store(EMPTY, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    static void copy_slot(slot_t& destination, const slot_t& source)
+    {
+      for (size_t i = 0U; i < KEY_WORDS; ++i)
+      {
+        destination.key[i].store(source.key[i].load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+      }
+
+      for (size_t i = 0U; i < VALUE_WORDS; ++i)
+      {
+        destination.value[i].store(source.value[i].load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+      }
+
+      destination.tag.store(source.tag.load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+    }
+
+    // Disabled.
+    concurrent_unordered_map(const concurrent_unordered_map&);
+    concurrent_unordered_map& operator =(const concurrent_unordered_map&);
+
+    stripe_t stripes[STRIPES];
+
+    hasher    key_hash_function;
+    key_equal key_equal_function;
+  };
+}
+
+#endif
+#endif
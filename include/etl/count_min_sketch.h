@@ -0,0 +1,245 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COUNT_MIN_SKETCH_INCLUDED
+#define ETL_COUNT_MIN_SKETCH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+///\defgroup count_min_sketch count_min_sketch
+/// A count-min sketch estimates how often each key has been seen, in a
+/// fixed DEPTH x WIDTH table of counters, however many keys there are.
+/// Estimates are never low. With a total count of N, an estimate is more
+/// than e.N / WIDTH too high with a probability of at most e^-DEPTH.
+///\ingroup containers
+
+namespace etl
+{
+  namespace private_count_min_sketch
+  {
+    //*************************************************************************
+    /// The murmur3 64 bit finaliser.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t hash)
+    {
+      hash ^= hash >> 33;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33;
+
+      return hash;
+    }
+  }
+
+  //***************************************************************************
+  /// A count-min sketch with conservative update.
+  /// Each row is indexed by a different hash, derived from the one THash
+  /// result by double hashing. An add only raises the counters that are
+  /// below the new estimate, which reduces the over-estimate of keys that
+  /// share counters with frequent ones.
+  /// Counters saturate rather than wrap.
+  ///\tparam WIDTH    The number of counters in each row.
+  ///\tparam DEPTH    The number of rows.
+  ///\tparam THash    The hash functor. Must define 'argument_type'.
+  ///\tparam TCounter The counter type.
+  ///\ingroup count_min_sketch
+  //***************************************************************************
+  template <const size_t WIDTH_, const size_t DEPTH_, typename THash, typename TCounter = uint32_t>
+  class count_min_sketch
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(WIDTH_ > 0U, "WIDTH must be greater than zero");
+    ETL_STATIC_ASSERT(DEPTH_ > 0U, "DEPTH must be greater than zero");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TCounter>::value, "TCounter must be unsigned");
+
+    static const size_t WIDTH = WIDTH_;
+    static const size_t DEPTH = DEPTH_;
+
+    typedef TCounter counter_type;
+    typedef THash    hasher;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    count_min_sketch()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Zeroes all of the counters.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t row = 0U; row < DEPTH; ++row)
+      {
+        for (size_t column = 0U; column < WIDTH; ++column)
+        {
+          counters[row][column] = 0U;
+        }
+      }
+
+      total_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds 'count' occurrences of the key.
+    ///\return The new estimate for the key.
+    //*************************************************************************
+    counter_type add(parameter_t key, counter_type count = 1U)
+    {
+      size_t columns[DEPTH];
+      get_columns(key, columns);
+
+      const counter_type target = saturating_add(minimum(columns), count);
+
+      for (size_t row = 0U; row < DEPTH; ++row)
+      {
+        counter_type& counter = counters[row][columns[row]];
+        counter = (counter < target) ? target : counter;
+      }
+
+      total_count = saturating_add(total_count, count);
+
+      return target;
+    }
+
+    //*************************************************************************
+    /// Estimates the number of occurrences of the key.
+    //*************************************************************************
+    counter_type estimate(parameter_t key) const
+    {
+      size_t columns[DEPTH];
+      get_columns(key, columns);
+
+      return minimum(columns);
+    }
+
+    //*************************************************************************
+    /// The total of all counts added.
+    //*************************************************************************
+    counter_type total() const
+    {
+      return total_count;
+    }
+
+    //*************************************************************************
+    /// Adds the counters of another sketch.
+    /// The result never under-estimates, though a merge of conservatively
+    /// updated sketches may over-estimate more than one sketch would have.
+    //*************************************************************************
+    void merge(const count_min_sketch& other)
+    {
+      for (size_t row = 0U; row < DEPTH; ++row)
+      {
+        for (size_t column = 0U; column < WIDTH; ++column)
+        {
+          counters[row][column] = saturating_add(counters[row][column], other.counters[row][column]);
+        }
+      }
+
+      total_count = saturating_add(total_count, other.total_count);
+    }
+
+    //*************************************************************************
+    /// Halves every counter, to age old counts.
+    //*************************************************************************
+    void decay()
+    {
+      for (size_t row = 0U; row < DEPTH; ++row)
+      {
+        for (size_t column = 0U; column < WIDTH; ++column)
+        {
+          counters[row][column] >>= 1;
+        }
+      }
+
+      total_count >>= 1;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The column of the key in each row. Row i uses a + i.b.
+    //*************************************************************************
+    void get_columns(parameter_t key, size_t* columns) const
+    {
+      const uint64_t h = private_count_min_sketch::mix(static_cast<uint64_t>(hash(key)));
+      const uint32_t a = uint32_t(h);
+      const uint32_t b = uint32_t(h >> 32) | 1U;
+
+      for (size_t row = 0U; row < DEPTH; ++row)
+      {
+        columns[row] = size_t((a + (uint32_t(row) * b)) % WIDTH);
+      }
+    }
+
+    //*************************************************************************
+    counter_type minimum(const size_t* columns) const
+    {
+      counter_type result = counters[0][columns[0]];
+
+      for (size_t row = 1U; row < DEPTH; ++row)
+      {
+        const counter_type value = counters[row][columns[row]];
+        result = (value < result) ? value : result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    static counter_type saturating_add(counter_type a, counter_type b)
+    {
+      const counter_type sum = counter_type(a + b);
+
+      return (sum < a) ? etl::integral_limits<counter_type>::max : sum;
+    }
+
+    THash        hash;
+    counter_type counters[DEPTH][WIDTH];
+    counter_type total_count;
+  };
+}
+
+#endif
@@ -0,0 +1,363 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CPU_FEATURES_INCLUDED
+#define ETL_CPU_FEATURES_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+
+///\defgroup cpu_features cpu_features
+/// Run time detection of instruction set extensions, and selection of the
+/// best implementation of a function for the processor that is running.
+/// The features that the compiler targets are always reported.
+/// Detection uses 'cpuid' on x86 and getauxval(AT_HWCAP) on ARM Linux.
+/// Define ETL_NO_CPU_DISPATCH to report only the compile time features, so
+/// that the selection is fixed, as is required by many embedded targets.
+///\ingroup utilities
+
+#if !defined(ETL_NO_CPU_DISPATCH)
+  #if (defined(__x86_64__) || defined(__i386__)) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+    #include <cpuid.h>
+    #define ETL_CPU_DISPATCH_X86
+  #elif (defined(_M_X64) || defined(_M_IX86)) && defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+    #define ETL_CPU_DISPATCH_X86
+  #elif defined(__linux__) && (defined(__aarch64__) || defined(__arm__))
+    #include <sys/auxv.h>
+    #define ETL_CPU_DISPATCH_ARM_LINUX
+  #endif
+#endif
+
+//*****************************************************************************
+/// Marks a function as compiled for an instruction set extension, so that it
+/// may be selected at run time when the rest of the code is not.
+/// Only GCC and Clang on x86 need this.
+//*****************************************************************************
+#if defined(ETL_CPU_DISPATCH_X86) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+  #define ETL_TARGET_FEATURE(features) __attribute__((target(features)))
+#else
+  #define ETL_TARGET_FEATURE(features)
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Instruction set extensions.
+  ///\ingroup cpu_features
+  //***************************************************************************
+  class cpu_features
+  {
+  public:
+
+    enum
+    {
+      NONE      = 0x0000U,
+      // x86
+      SSE2      = 0x0001U,
+      SSE42     = 0x0002U,
+      POPCNT    = 0x0004U,
+      PCLMULQDQ = 0x0008U,
+      AVX       = 0x0010U,
+      AVX2      = 0x0020U,
+      BMI1      = 0x0040U,
+      BMI2      = 0x0080U,
+      // ARM
+      ARM_NEON  = 0x0100U,
+      ARM_CRC32 = 0x0200U,
+      ARM_PMULL = 0x0400U
+    };
+
+    //*************************************************************************
+    /// The features that the compiler may use in any of the code.
+    //*************************************************************************
+    static uint32_t compile_time()
+    {
+      uint32_t features = NONE;
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+      features |= SSE2;
+#endif
+#if defined(__SSE4_2__) || defined(ETL_CPU_HAS_SSE42_CRC32)
+      features |= SSE42;
+#endif
+#if defined(__POPCNT__)
+      features |= POPCNT;
+#endif
+#if defined(__PCLMUL__)
+      features |= PCLMULQDQ;
+#endif
+#if defined(__AVX__)
+      features |= AVX;
+#endif
+#if defined(__AVX2__)
+      features |= AVX2;
+#endif
+#if defined(__BMI__)
+      features |= BMI1;
+#endif
+#if defined(__BMI2__)
+      features |= BMI2;
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+      features |= ARM_NEON;
+#endif
+#if defined(ETL_CPU_HAS_ARM_CRC32)
+      features |= ARM_CRC32;
+#endif
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+      features |= ARM_PMULL;
+#endif
+
+      return features;
+    }
+
+    //*************************************************************************
+    /// Queries the processor for its features.
+    /// Always includes the compile time features.
+    //*************************************************************************
+    static uint32_t detect()
+    {
+      return compile_time() | detect_run_time();
+    }
+
+    //*************************************************************************
+    /// The features of the processor, detected on the first call.
+    //*************************************************************************
+    static uint32_t get()
+    {
+      static const uint32_t features = detect();
+
+      return features;
+    }
+
+    //*************************************************************************
+    /// Does the processor have all of the features?
+    //*************************************************************************
+    static bool has(uint32_t required)
+    {
+      return (get() & required) == required;
+    }
+
+  private:
+
+#if defined(ETL_CPU_DISPATCH_X86)
+    //*************************************************************************
+    /// Executes 'cpuid'.
+    //*************************************************************************
+    static void cpuid(uint32_t leaf, uint32_t (&registers)[4])
+    {
+  #if defined(ETL_COMPILER_MICROSOFT)
+      int values[4];
+      __cpuidex(values, int(leaf), 0);
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        registers[i] = uint32_t(values[i]);
+      }
+  #else
+      __cpuid_count(leaf, 0U, registers[0], registers[1], registers[2], registers[3]);
+  #endif
+    }
+
+    //*************************************************************************
+    /// Does the operating system save the AVX registers?
+    //*************************************************************************
+    static bool os_saves_avx()
+    {
+  #if defined(ETL_COMPILER_MICROSOFT)
+      const uint64_t xcr0 = _xgetbv(0);
+  #else
+      uint32_t low;
+      uint32_t high;
+      __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0U));
+      const uint64_t xcr0 = (uint64_t(high) << 32) | low;
+  #endif
+
+      // The SSE and AVX state.
+      return (xcr0 & 0x06U) == 0x06U;
+    }
+
+    //*************************************************************************
+    static uint32_t detect_run_time()
+    {
+      uint32_t features = NONE;
+      uint32_t registers[4]; // eax, ebx, ecx, edx
+
+      cpuid(0U, registers);
+      const uint32_t max_leaf = registers[0];
+
+      if (max_leaf >= 1U)
+      {
+        cpuid(1U, registers);
+
+        const uint32_t ecx = registers[2];
+        const uint32_t edx = registers[3];
+
+        features |= ((edx & (1UL << 26)) != 0U) ? uint32_t(SSE2)      : uint32_t(NONE);
+        features |= ((ecx & (1UL << 20)) != 0U) ? uint32_t(SSE42)     : uint32_t(NONE);
+        features |= ((ecx & (1UL << 23)) != 0U) ? uint32_t(POPCNT)    : uint32_t(NONE);
+        features |= ((ecx & (1UL << 1))  != 0U) ? uint32_t(PCLMULQDQ) : uint32_t(NONE);
+
+        // AVX needs the OSXSAVE flag and the operating system support.
+        const bool avx = ((ecx & (1UL << 28)) != 0U) && ((ecx & (1UL << 27)) != 0U) && os_saves_avx();
+
+        features |= avx ? uint32_t(AVX) : uint32_t(NONE);
+
+        if (max_leaf >= 7U)
+        {
+          cpuid(7U, registers);
+
+          const uint32_t ebx = registers[1];
+
+          features |= (avx && ((ebx & (1UL << 5)) != 0U)) ? uint32_t(AVX2) : uint32_t(NONE);
+          features |= ((ebx & (1UL << 3)) != 0U)          ? uint32_t(BMI1) : uint32_t(NONE);
+          features |= ((ebx & (1UL << 8)) != 0U)          ? uint32_t(BMI2) : uint32_t(NONE);
+        }
+      }
+
+      return features;
+    }
+#elif defined(ETL_CPU_DISPATCH_ARM_LINUX)
+    //*************************************************************************
+    static uint32_t detect_run_time()
+    {
+      uint32_t features = NONE;
+
+  #if defined(__aarch64__)
+      const unsigned long hwcap = getauxval(AT_HWCAP);
+
+      // HWCAP_ASIMD, HWCAP_PMULL, HWCAP_CRC32
+      features |= ((hwcap & (1UL << 1)) != 0U) ? uint32_t(ARM_NEON)  : uint32_t(NONE);
+      features |= ((hwcap & (1UL << 4)) != 0U) ? uint32_t(ARM_PMULL) : uint32_t(NONE);
+      features |= ((hwcap & (1UL << 7)) != 0U) ? uint32_t(ARM_CRC32) : uint32_t(NONE);
+  #else
+      const unsigned long hwcap  = getauxval(AT_HWCAP);
+      const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+
+      // HWCAP_NEON, HWCAP2_PMULL, HWCAP2_CRC32
+      features |= ((hwcap  & (1UL << 12)) != 0U) ? uint32_t(ARM_NEON)  : uint32_t(NONE);
+      features |= ((hwcap2 & (1UL << 1))  != 0U) ? uint32_t(ARM_PMULL) : uint32_t(NONE);
+      features |= ((hwcap2 & (1UL << 4))  != 0U) ? uint32_t(ARM_CRC32) : uint32_t(NONE);
+  #endif
+
+      return features;
+    }
+#else
+    //*************************************************************************
+    static uint32_t detect_run_time()
+    {
+      return NONE;
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// An implementation of a function and the features that it requires.
+  ///\ingroup cpu_features
+  //***************************************************************************
+  template <typename TFunction>
+  struct cpu_dispatch_candidate
+  {
+    uint32_t  required;
+    TFunction function;
+  };
+
+  //***************************************************************************
+  /// Selects, once, the first candidate whose required features are all
+  /// present. The candidates should be in order of preference, ending with a
+  /// portable one that requires etl::cpu_features::NONE.
+  /// Usually a function local static, so that the selection is made on first use.
+  ///\tparam TFunction The function pointer type.
+  ///\ingroup cpu_features
+  //***************************************************************************
+  template <typename TFunction>
+  class cpu_dispatch
+  {
+  public:
+
+    typedef TFunction                          function_type;
+    typedef cpu_dispatch_candidate<TFunction>  candidate_type;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Selects from the candidates using the features of the processor.
+    //*************************************************************************
+    template <size_t N>
+    explicit cpu_dispatch(const candidate_type (&candidates)[N])
+      : function(select(candidates, N, etl::cpu_features::get()))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Selects from the candidates using the supplied features.
+    //*************************************************************************
+    template <size_t N>
+    cpu_dispatch(const candidate_type (&candidates)[N], uint32_t features)
+      : function(select(candidates, N, features))
+    {
+    }
+
+    //*************************************************************************
+    /// The selected function.
+    //*************************************************************************
+    function_type get() const
+    {
+      return function;
+    }
+
+    //*************************************************************************
+    /// Selects the first candidate whose features are all present.
+    /// Returns nullptr if there are none.
+    //*************************************************************************
+    static function_type select(const candidate_type* candidates, size_t size, uint32_t features)
+    {
+      for (size_t i = 0U; i < size; ++i)
+      {
+        if ((features & candidates[i].required) == candidates[i].required)
+        {
+          return candidates[i].function;
+        }
+      }
+
+      return nullptr;
+    }
+
+  private:
+
+    function_type function;
+  };
+}
+
+#endif
@@ -0,0 +1,262 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_INCLUDED
+#define ETL_CRC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "frame_check_sequence.h"
+#include "private/crc_slicing.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup crc_generic Generic parameterised CRC calculation
+/// A CRC defined by the Rocksoft model parameters.
+/// The lookup table is generated at compile time for C++14 and above,
+/// otherwise it is generated on first use.
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Returns a mask for the lowest 'WIDTH' bits.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH>
+    struct width_mask
+    {
+      static ETL_CONST_OR_CONSTEXPR T value = T(((WIDTH < (sizeof(T) * CHAR_BIT)) ? ((uint64_t(1U) << (WIDTH % 64U)) - 1U) : ~uint64_t(0U)));
+    };
+  }
+
+  //***************************************************************************
+  /// A lookup table for a CRC of arbitrary width.
+  ///\tparam T          The CRC value type.
+  ///\tparam WIDTH      The number of bits in the CRC.
+  ///\tparam POLY       The polynomial, in normal (non-reflected) form.
+  ///\tparam REFLECT    Whether the input is reflected.
+  ///\tparam TABLE_SIZE 256 for a byte table or 16 for a nibble table.
+  //***************************************************************************
+  template <typename T, const size_t WIDTH, const T POLY, const bool REFLECT, const size_t TABLE_SIZE>
+  struct crc_table
+  {
+    ETL_STATIC_ASSERT((TABLE_SIZE == 256U) || (TABLE_SIZE == 16U), "Table size must be 16 or 256");
+
+    static ETL_CONST_OR_CONSTEXPR size_t BITS = (TABLE_SIZE == 256U) ? 8U : 4U;
+    static ETL_CONST_OR_CONSTEXPR T      MASK = etl::private_crc::width_mask<T, WIDTH>::value;
+
+    //*************************************************************************
+    /// Generates the table.
+    //*************************************************************************
+    ETL_CONSTEXPR14 crc_table()
+      : table()
+    {
+      const T top_bit        = T(T(1U) << (WIDTH - 1U));
+      const T reflected_poly = etl::private_crc::reflect<T>(POLY, WIDTH);
+
+      for (size_t i = 0U; i < TABLE_SIZE; ++i)
+      {
+        T crc = 0;
+
+        if (REFLECT)
+        {
+          crc = T(i);
+
+          for (size_t bit = 0U; bit < BITS; ++bit)
+          {
+            crc = (crc & 1U) ? T((crc >> 1) ^ reflected_poly) : T(crc >> 1);
+          }
+        }
+        else
+        {
+          crc = T(T(i) << (WIDTH - BITS));
+
+          for (size_t bit = 0U; bit < BITS; ++bit)
+          {
+            crc = (crc & top_bit) ? T(T(crc << 1) ^ POLY) : T(crc << 1);
+          }
+        }
+
+        table[i] = T(crc & MASK);
+      }
+    }
+
+    T table[TABLE_SIZE];
+  };
+
+  //***************************************************************************
+  /// Table and add value for a CRC of arbitrary width.
+  //***************************************************************************
+  template <typename T, const size_t WIDTH, const T POLY, const bool REFLECT, const size_t TABLE_SIZE>
+  class crc_table_generic
+  {
+  public:
+
+    typedef etl::crc_table<T, WIDTH, POLY, REFLECT, TABLE_SIZE> table_type;
+
+    static ETL_CONST_OR_CONSTEXPR T MASK = etl::private_crc::width_mask<T, WIDTH>::value;
+
+    //*************************************************************************
+    T add(T crc, uint8_t value) const
+    {
+      if (TABLE_SIZE == 256U)
+      {
+        return add_bits<8U>(crc, value);
+      }
+      else
+      {
+        if (REFLECT)
+        {
+          crc = add_bits<4U>(crc, uint8_t(value & 0x0FU));
+          return add_bits<4U>(crc, uint8_t(value >> 4));
+        }
+        else
+        {
+          crc = add_bits<4U>(crc, uint8_t(value >> 4));
+          return add_bits<4U>(crc, uint8_t(value & 0x0FU));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the table.
+    //*************************************************************************
+    static const table_type& tables()
+    {
+      static ETL_CONSTEXPR14 const table_type t;
+
+      return t;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the lowest 'BITS' bits of the value.
+    //*************************************************************************
+    template <const size_t BITS>
+    T add_bits(T crc, uint8_t value) const
+    {
+      const table_type& t = tables();
+
+      if (REFLECT)
+      {
+        return T((crc >> BITS) ^ t.table[(crc ^ value) & (TABLE_SIZE - 1U)]);
+      }
+      else
+      {
+        return T((T(crc << BITS) ^ t.table[((crc >> (WIDTH - BITS)) ^ value) & (TABLE_SIZE - 1U)]) & MASK);
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// Generic CRC policy.
+  //***************************************************************************
+  template <const size_t WIDTH, const uint64_t POLY, const uint64_t INITIAL, const bool REF_IN, const bool REF_OUT, const uint64_t XOR_OUT, const size_t TABLE_SIZE>
+  struct crc_policy
+    : public etl::crc_table_generic<typename etl::smallest_uint_for_bits<WIDTH>::type,
+                                    WIDTH,
+                                    typename etl::smallest_uint_for_bits<WIDTH>::type(POLY),
+                                    REF_IN,
+                                    TABLE_SIZE>
+  {
+    typedef typename etl::smallest_uint_for_bits<WIDTH>::type value_type;
+
+    ETL_STATIC_ASSERT((WIDTH >= 8U) && (WIDTH <= 64U), "CRC width must be between 8 and 64 bits");
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_type initial() const
+    {
+      return REF_IN ? etl::private_crc::reflect<value_type>(value_type(INITIAL), WIDTH) : value_type(INITIAL & MASK);
+    }
+
+    //*************************************************************************
+    value_type final(value_type crc) const
+    {
+      if (REF_IN != REF_OUT)
+      {
+        crc = etl::private_crc::reflect<value_type>(crc, WIDTH);
+      }
+
+      return value_type((crc ^ value_type(XOR_OUT)) & MASK);
+    }
+
+  private:
+
+    static ETL_CONST_OR_CONSTEXPR value_type MASK = etl::private_crc::width_mask<value_type, WIDTH>::value;
+  };
+
+  //*************************************************************************
+  /// Generic CRC.
+  ///\tparam WIDTH      The number of bits in the CRC, 8 to 64.
+  ///\tparam POLY       The polynomial, in normal (non-reflected) form.
+  ///\tparam INITIAL    The initial value.
+  ///\tparam REF_IN     Whether input bytes are reflected.
+  ///\tparam REF_OUT    Whether the result is reflected.
+  ///\tparam XOR_OUT    The value to XOR with the result.
+  ///\tparam TABLE_SIZE 256 for a byte table, or 16 for a smaller nibble table.
+  //*************************************************************************
+  template <const size_t WIDTH, const uint64_t POLY, const uint64_t INITIAL, const bool REF_IN, const bool REF_OUT, const uint64_t XOR_OUT, const size_t TABLE_SIZE = 256U>
+  class crc : public etl::frame_check_sequence<etl::crc_policy<WIDTH, POLY, INITIAL, REF_IN, REF_OUT, XOR_OUT, TABLE_SIZE> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
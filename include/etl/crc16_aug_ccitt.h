@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc16_poly_0x1021_.h"
+#include "private/crc_slicing.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -44,6 +45,13 @@ SOFTWARE.
 namespace etl
 {
   typedef crc16_poly_0x1021<0x1D0FU, 0x0000U, false> crc16_aug_ccitt;
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint16_t, 0x1021U, 0x1D0FU, 0x0000U, false, 4U> crc16_aug_ccitt_slice4;
+  typedef crc_slicing<uint16_t, 0x1021U, 0x1D0FU, 0x0000U, false, 8U> crc16_aug_ccitt_slice8;
+  typedef crc_slicing<uint16_t, 0x1021U, 0x1D0FU, 0x0000U, false, 16U> crc16_aug_ccitt_slice16;
 }
 
 #endif
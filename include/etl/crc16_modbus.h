@@ -35,6 +35,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc16_poly_0x8005.h"
+#include "private/crc_slicing.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,6 +47,13 @@ SOFTWARE.
 namespace etl
 {
   typedef crc16_poly_0x8005<0xFFFFU, 0x0000U, true> crc16_modbus;
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint16_t, 0x8005U, 0xFFFFU, 0x0000U, true, 4U> crc16_modbus_slice4;
+  typedef crc_slicing<uint16_t, 0x8005U, 0xFFFFU, 0x0000U, true, 8U> crc16_modbus_slice8;
+  typedef crc_slicing<uint16_t, 0x8005U, 0xFFFFU, 0x0000U, true, 16U> crc16_modbus_slice16;
 }
 
 #endif
@@ -33,6 +33,8 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc32_poly_0x04c11db7.h"
+#include "private/crc_slicing.h"
+#include "private/crc32_hardware.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -43,7 +45,21 @@ SOFTWARE.
 
 namespace etl
 {
-  typedef crc32_poly_0x04c11db7<0xFFFFFFFFU, 0xFFFFFFFFU, true> crc32;
+  typedef crc32_poly_0x04c11db7<0xFFFFFFFFU, 0xFFFFFFFFU, true> crc32_table;
+
+#if defined(ETL_HAS_HARDWARE_CRC32)
+  typedef crc32_poly_0x04c11db7_hardware<0xFFFFFFFFU, 0xFFFFFFFFU> crc32_hardware;
+  typedef crc32_hardware crc32;
+#else
+  typedef crc32_table crc32;
+#endif
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 4U> crc32_slice4;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 8U> crc32_slice8;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 16U> crc32_slice16;
 }
 
 #endif
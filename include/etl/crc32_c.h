@@ -33,6 +33,8 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc32_poly_0x1edc6f41.h"
+#include "private/crc_slicing.h"
+#include "private/crc32_hardware.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -43,7 +45,26 @@ SOFTWARE.
 
 namespace etl
 {
-  typedef crc32_poly_0x1edc6f41<0xFFFFFFFFU, 0xFFFFFFFFU, true> crc32_c;
+  typedef crc32_poly_0x1edc6f41<0xFFFFFFFFU, 0xFFFFFFFFU, true> crc32_c_table;
+
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+  typedef crc32_poly_0x1edc6f41_hardware<0xFFFFFFFFU, 0xFFFFFFFFU> crc32_c_hardware;
+  typedef crc32_c_hardware crc32_c;
+#else
+  typedef crc32_c_table crc32_c;
+#endif
+
+  //***************************************************************************
+  /// Selects the SSE4.2 instructions or the table at run time.
+  //***************************************************************************
+  typedef crc32_poly_0x1edc6f41_dispatch<0xFFFFFFFFU, 0xFFFFFFFFU> crc32_c_dispatch;
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint32_t, 0x1EDC6F41U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 4U> crc32_c_slice4;
+  typedef crc_slicing<uint32_t, 0x1EDC6F41U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 8U> crc32_c_slice8;
+  typedef crc_slicing<uint32_t, 0x1EDC6F41U, 0xFFFFFFFFU, 0xFFFFFFFFU, true, 16U> crc32_c_slice16;
 }
 
 #endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc32_poly_0x04c11db7.h"
+#include "private/crc_slicing.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -44,6 +45,13 @@ SOFTWARE.
 namespace etl
 {
   typedef crc32_poly_0x04c11db7<0xFFFFFFFFU, 0x00000000U, false> crc32_mpeg2;
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0x00000000U, false, 4U> crc32_mpeg2_slice4;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0x00000000U, false, 8U> crc32_mpeg2_slice8;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, 0x00000000U, false, 16U> crc32_mpeg2_slice16;
 }
 
 #endif
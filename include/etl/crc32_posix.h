@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc32_poly_0x04c11db7.h"
+#include "private/crc_slicing.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -44,6 +45,13 @@ SOFTWARE.
 namespace etl
 {
   typedef crc32_poly_0x04c11db7<0x00000000U, 0xFFFFFFFFU, false> crc32_posix;
+
+  //***************************************************************************
+  /// Slicing-by-N variants. Process 4, 8 or 16 bytes per iteration.
+  //***************************************************************************
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0x00000000U, 0xFFFFFFFFU, false, 4U> crc32_posix_slice4;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0x00000000U, 0xFFFFFFFFU, false, 8U> crc32_posix_slice8;
+  typedef crc_slicing<uint32_t, 0x04C11DB7U, 0x00000000U, 0xFFFFFFFFU, false, 16U> crc32_posix_slice16;
 }
 
 #endif
@@ -0,0 +1,185 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_COMBINE_INCLUDED
+#define ETL_CRC_COMBINE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "iterator.h"
+
+///\defgroup crc_combine Combining CRCs of consecutive blocks
+/// Calculates the CRC of a concatenation from the CRCs of its parts, using
+/// GF(2) matrix operations in O(log(length)) time.
+/// Usable with any CRC built on frame_check_sequence where the policy's
+/// final() is an XOR, optionally combined with a bit reflection.
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Multiplies the GF(2) matrix by the vector.
+    //*************************************************************************
+    template <typename T>
+    T gf2_matrix_times(const T* matrix, T vector)
+    {
+      T result = 0;
+
+      while (vector != 0)
+      {
+        if (vector & 1U)
+        {
+          result ^= *matrix;
+        }
+
+        vector = T(vector >> 1);
+        ++matrix;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Squares the GF(2) matrix.
+    //*************************************************************************
+    template <typename T>
+    void gf2_matrix_square(T* square, const T* matrix)
+    {
+      const size_t WIDTH = sizeof(T) * CHAR_BIT;
+
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        square[i] = gf2_matrix_times(matrix, matrix[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Applies the CRC register transformation for 'length' zero bytes.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename TPolicy::value_type crc_shift_zeros(const TPolicy& policy, typename TPolicy::value_type crc, size_t length)
+    {
+      typedef typename TPolicy::value_type value_type;
+
+      const size_t WIDTH = sizeof(value_type) * CHAR_BIT;
+
+      value_type odd[WIDTH];
+      value_type even[WIDTH];
+
+      // The operator for one zero byte. Adding a zero byte is linear in the register.
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        odd[i] = policy.add(value_type(value_type(1U) << i), 0U);
+      }
+
+      value_type* current = odd;
+      value_type* next    = even;
+
+      while (length != 0U)
+      {
+        if (length & 1U)
+        {
+          crc = gf2_matrix_times(current, crc);
+        }
+
+        length >>= 1;
+
+        if (length != 0U)
+        {
+          gf2_matrix_square(next, current);
+
+          value_type* temp = current;
+          current = next;
+          next    = temp;
+        }
+      }
+
+      return crc;
+    }
+  }
+
+  //***************************************************************************
+  /// Combines the CRCs of two consecutive blocks.
+  ///\tparam TCrc     The CRC type. e.g. etl::crc32
+  ///\param  crc_a    The CRC of the first block.
+  ///\param  crc_b    The CRC of the second block.
+  ///\param  length_b The length of the second block in bytes.
+  ///\return The CRC of the first block followed by the second.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    typedef typename TCrc::policy_type policy_type;
+    typedef typename TCrc::value_type  value_type;
+
+    const policy_type policy = policy_type();
+
+    const value_type xor_out = policy.final(0U);
+    const value_type initial = policy.initial();
+
+    // The output transformation, less the XOR, is linear and its own inverse.
+    const value_type register_a = value_type(policy.final(value_type(crc_a ^ xor_out)) ^ xor_out);
+
+    const value_type shifted = etl::private_crc::crc_shift_zeros(policy, value_type(register_a ^ initial), length_b);
+
+    return value_type(policy.final(shifted) ^ xor_out ^ crc_b);
+  }
+
+  //***************************************************************************
+  /// Calculates the CRC of a sequence of fragments without copying them into
+  /// one contiguous buffer.
+  ///\tparam TCrc   The CRC type. e.g. etl::crc32
+  ///\param  begin  The first fragment. Each fragment must supply begin() and end().
+  ///\param  end    One past the last fragment.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  template <typename TCrc, typename TFragmentIterator>
+  typename TCrc::value_type crc_gather(TFragmentIterator begin, const TFragmentIterator end)
+  {
+    TCrc crc;
+
+    while (begin != end)
+    {
+      crc.add(begin->begin(), begin->end());
+      ++begin;
+    }
+
+    return crc.value();
+  }
+}
+
+#endif
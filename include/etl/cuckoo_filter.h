@@ -0,0 +1,366 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include "power.h"
+#include "static_assert.h"
+#include "bloom_filter.h"
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A filter that, unlike a Bloom filter, can remove keys.
+/// Each key stores a fingerprint in one of two buckets of four. A query
+/// reads at most two buckets. With 8 bit fingerprints the false positive
+/// rate is about 3%; each extra bit halves it.
+/// See Fan, Andersen, Kaminsky and Mitzenmacher, "Cuckoo Filter: Practically
+/// Better Than Bloom".
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A cuckoo filter.
+  /// Only remove keys that were added, or other keys may be lost.
+  /// A key added twice takes two entries and must be removed twice.
+  ///\tparam MAX_KEYS     The number of keys to size the filter for.
+  ///\tparam THash        The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam TFingerprint The fingerprint type. Each extra bit halves the false positive rate.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <const size_t MAX_KEYS,
+            typename     THash,
+            typename     TFingerprint = uint8_t>
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    static const size_t   MAX_KICKS        = 500U;
+    static const uint32_t EMPTY            = 0U;
+    static const size_t   FINGERPRINT_BITS = sizeof(TFingerprint) * 8U;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_KEYS > 0, "At least one key is required");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TFingerprint>::value, "The fingerprint must be unsigned");
+    ETL_STATIC_ASSERT(sizeof(TFingerprint) <= 4U, "The fingerprint must be no more than 32 bits");
+
+    enum
+    {
+      BUCKET_SIZE       = 4U,
+      // Sized for a load of 95%, which four slot buckets reach reliably.
+      NUMBER_OF_BUCKETS = etl::power_of_2_round_up<((MAX_KEYS * 100U) + 379U) / 380U>::value,
+      CAPACITY          = NUMBER_OF_BUCKETS * BUCKET_SIZE
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    /// If both buckets are full, entries are moved to their other bucket to
+    /// make room. If that fails, the last entry moved is kept aside and the
+    /// filter is full.
+    ///\param  key The key to add.
+    ///\return <b>false</b> if the filter was already full.
+    //*************************************************************************
+    bool add(parameter_t key)
+    {
+      if (full())
+      {
+        return false;
+      }
+
+      const uint64_t     hash        = get_hash(key);
+      const TFingerprint fingerprint = get_fingerprint(hash);
+      const size_t       index1      = size_t(hash) & (NUMBER_OF_BUCKETS - 1U);
+      const size_t       index2      = alternate_index(index1, fingerprint);
+
+      ++key_count;
+
+      if (insert(index1, fingerprint) || insert(index2, fingerprint))
+      {
+        return true;
+      }
+
+      kick(((next_random() & 1U) == 0U) ? index1 : index2, fingerprint);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may have been added.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const uint64_t     hash        = get_hash(key);
+      const TFingerprint fingerprint = get_fingerprint(hash);
+      const size_t       index1      = size_t(hash) & (NUMBER_OF_BUCKETS - 1U);
+      const size_t       index2      = alternate_index(index1, fingerprint);
+
+      return contains(index1, fingerprint) ||
+             contains(index2, fingerprint) ||
+             (has_victim && (victim_fingerprint == fingerprint) && ((victim_index == index1) || (victim_index == index2)));
+    }
+
+    //*************************************************************************
+    /// Removes a key from the filter.
+    ///\param  key The key to remove.
+    ///\return <b>true</b> if an entry for the key was found and removed.
+    //*************************************************************************
+    bool remove(parameter_t key)
+    {
+      const uint64_t     hash        = get_hash(key);
+      const TFingerprint fingerprint = get_fingerprint(hash);
+      const size_t       index1      = size_t(hash) & (NUMBER_OF_BUCKETS - 1U);
+      const size_t       index2      = alternate_index(index1, fingerprint);
+
+      if (erase(index1, fingerprint) || erase(index2, fingerprint))
+      {
+        --key_count;
+
+        // There is now room for the entry kept aside.
+        if (has_victim)
+        {
+          has_victim = false;
+
+          if (!insert(victim_index, victim_fingerprint))
+          {
+            kick(victim_index, victim_fingerprint);
+          }
+        }
+
+        return true;
+      }
+
+      if (has_victim && (victim_fingerprint == fingerprint) && ((victim_index == index1) || (victim_index == index2)))
+      {
+        --key_count;
+        has_victim = false;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all keys.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(&buckets[0][0], size_t(CAPACITY), TFingerprint(EMPTY));
+      key_count          = 0U;
+      has_victim         = false;
+      victim_index       = 0U;
+      victim_fingerprint = TFingerprint(EMPTY);
+      random_state       = 0x2545F491UL;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys in the filter.
+    //*************************************************************************
+    size_t size() const
+    {
+      return key_count;
+    }
+
+    //*************************************************************************
+    /// Returns true if the filter has no keys.
+    //*************************************************************************
+    bool empty() const
+    {
+      return key_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if the filter cannot take another key.
+    //*************************************************************************
+    bool full() const
+    {
+      return has_victim;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys the filter was sized for.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_KEYS;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprint slots.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of slots used.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return (100U * key_count) / CAPACITY;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves entries to their other bucket until one finds an empty slot.
+    /// If none does, the last entry moved is kept aside.
+    //*************************************************************************
+    void kick(size_t index, TFingerprint fingerprint)
+    {
+      for (size_t i = 0U; i < MAX_KICKS; ++i)
+      {
+        const size_t slot = next_random() & (BUCKET_SIZE - 1U);
+
+        const TFingerprint evicted = buckets[index][slot];
+        buckets[index][slot] = fingerprint;
+        fingerprint = evicted;
+
+        index = alternate_index(index, fingerprint);
+
+        if (insert(index, fingerprint))
+        {
+          return;
+        }
+      }
+
+      has_victim         = true;
+      victim_index       = index;
+      victim_fingerprint = fingerprint;
+    }
+
+    //*************************************************************************
+    bool insert(size_t index, TFingerprint fingerprint)
+    {
+      for (size_t slot = 0U; slot < BUCKET_SIZE; ++slot)
+      {
+        if (buckets[index][slot] == TFingerprint(EMPTY))
+        {
+          buckets[index][slot] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    bool erase(size_t index, TFingerprint fingerprint)
+    {
+      for (size_t slot = 0U; slot < BUCKET_SIZE; ++slot)
+      {
+        if (buckets[index][slot] == fingerprint)
+        {
+          buckets[index][slot] = TFingerprint(EMPTY);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    bool contains(size_t index, TFingerprint fingerprint) const
+    {
+      const TFingerprint* bucket = buckets[index];
+
+      return (bucket[0] == fingerprint) || (bucket[1] == fingerprint) ||
+             (bucket[2] == fingerprint) || (bucket[3] == fingerprint);
+    }
+
+    //*************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix_hash64(uint64_t(THash()(key)));
+    }
+
+    //*************************************************************************
+    /// The fingerprint is taken from the top bits, which the bucket index does not use.
+    /// Zero marks an empty slot, so is not a fingerprint.
+    //*************************************************************************
+    static TFingerprint get_fingerprint(uint64_t hash)
+    {
+      const TFingerprint fingerprint = TFingerprint(hash >> (64U - FINGERPRINT_BITS));
+
+      return (fingerprint == TFingerprint(EMPTY)) ? TFingerprint(1U) : fingerprint;
+    }
+
+    //*************************************************************************
+    /// The other bucket for a fingerprint. Applying it twice gives the first bucket.
+    //*************************************************************************
+    static size_t alternate_index(size_t index, TFingerprint fingerprint)
+    {
+      return (index ^ size_t(uint32_t(fingerprint) * 0x5BD1E995UL)) & (NUMBER_OF_BUCKETS - 1U);
+    }
+
+    //*************************************************************************
+    /// xorshift32, to choose the entry to move.
+    //*************************************************************************
+    uint32_t next_random()
+    {
+      random_state ^= random_state << 13;
+      random_state ^= random_state >> 17;
+      random_state ^= random_state << 5;
+
+      return random_state;
+    }
+
+    TFingerprint buckets[NUMBER_OF_BUCKETS][BUCKET_SIZE];
+    size_t       key_count;
+    bool         has_victim;
+    size_t       victim_index;
+    TFingerprint victim_fingerprint;
+    uint32_t     random_state;
+  };
+}
+
+#endif
@@ -0,0 +1,221 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DEBOUNCE_BANK_INCLUDED
+#define ETL_DEBOUNCE_BANK_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "static_assert.h"
+#include "smallest.h"
+#include "log.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Debounces up to 64 lines at once with vertical counters.
+  /// Each line has a count held as one bit in each of a set of 'bit plane' words,
+  /// so a whole port is processed per sample with a few bitwise operations and
+  /// no per line branches.
+  /// The timing of set, clear and hold matches etl::debounce<VALID_COUNT, HOLD_COUNT>.
+  ///\tparam N           The number of lines. 1 to 64.
+  ///\tparam VALID_COUNT The number of identical samples needed to change state.
+  ///\tparam HOLD_COUNT  The number of further set samples needed to be 'held'. 0 to disable.
+  //***************************************************************************
+  template <const size_t N, const uint16_t VALID_COUNT, const uint16_t HOLD_COUNT = 0>
+  class debounce_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT((N > 0) && (N <= 64), "N must be 1 to 64");
+    ETL_STATIC_ASSERT(VALID_COUNT > 0, "VALID_COUNT must be greater than zero");
+
+    typedef typename etl::smallest_uint_for_bits<N>::type mask_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial_state The initial debounced state of the lines.
+    //*************************************************************************
+    debounce_bank(mask_type initial_state = 0)
+    {
+      reset(initial_state);
+    }
+
+    //*************************************************************************
+    /// Resets all of the counters and sets the debounced state.
+    ///\param initial_state The debounced state of the lines.
+    //*************************************************************************
+    void reset(mask_type initial_state = 0)
+    {
+      state_mask   = initial_state & ALL_LINES;
+      changed_mask = 0;
+      held_mask    = 0;
+      new_held     = 0;
+
+      for (size_t i = 0; i < VALID_BITS; ++i)
+      {
+        valid_count[i] = 0;
+      }
+
+      for (size_t i = 0; i < HOLD_BITS; ++i)
+      {
+        hold_count[i] = 0;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for every line.
+    ///\param sample The new sample. Bit 'n' is line 'n'.
+    ///\return The mask of lines that changed between set and clear.
+    //*************************************************************************
+    mask_type add(mask_type sample)
+    {
+      sample &= ALL_LINES;
+
+      // Lines whose sample disagrees with their debounced state count up; the others restart.
+      const mask_type differ  = sample ^ state_mask;
+      const mask_type toggled = count_to(valid_count, VALID_BITS, differ, ALL_LINES, VALID_COUNT);
+
+      state_mask  ^= toggled;
+      changed_mask = toggled;
+
+      if (HOLD_COUNT != 0)
+      {
+        // Set lines that are still seeing set samples count towards 'held'.
+        const mask_type holding = state_mask & sample & ~toggled;
+
+        new_held   = count_to(hold_count, HOLD_BITS, holding, mask_type(~held_mask), HOLD_COUNT);
+        held_mask |= new_held;
+        held_mask &= state_mask;
+      }
+
+      return toggled;
+    }
+
+    //*************************************************************************
+    /// The debounced state of every line.
+    //*************************************************************************
+    mask_type state() const
+    {
+      return state_mask;
+    }
+
+    //*************************************************************************
+    /// The lines that changed state on the last sample.
+    //*************************************************************************
+    mask_type changed() const
+    {
+      return changed_mask;
+    }
+
+    //*************************************************************************
+    /// The lines that changed from clear to set on the last sample.
+    //*************************************************************************
+    mask_type pressed() const
+    {
+      return changed_mask & state_mask;
+    }
+
+    //*************************************************************************
+    /// The lines that changed from set to clear on the last sample.
+    //*************************************************************************
+    mask_type released() const
+    {
+      return changed_mask & ~state_mask;
+    }
+
+    //*************************************************************************
+    /// The lines that are in the held state.
+    //*************************************************************************
+    mask_type held() const
+    {
+      return held_mask;
+    }
+
+    //*************************************************************************
+    /// The lines that became held on the last sample.
+    //*************************************************************************
+    mask_type newly_held() const
+    {
+      return new_held;
+    }
+
+  private:
+
+    static const mask_type ALL_LINES  = mask_type(~mask_type(0)) >> ((sizeof(mask_type) * 8U) - N);
+    static const size_t    VALID_BITS = etl::log2<VALID_COUNT>::value + 1U;
+    static const size_t    HOLD_BITS  = (HOLD_COUNT == 0) ? 1U : etl::log2<HOLD_COUNT>::value + 1U;
+
+    //*************************************************************************
+    /// Increments the vertical counters for the lines in 'increment' and
+    /// clears the others.
+    /// Returns the lines, of those in 'enable', that reached 'target'.
+    /// Those counters restart from zero.
+    //*************************************************************************
+    static mask_type count_to(mask_type* planes, size_t bits, mask_type increment, mask_type enable, uint16_t target)
+    {
+      increment &= enable;
+
+      mask_type carry   = increment;
+      mask_type reached = increment;
+
+      for (size_t i = 0; i < bits; ++i)
+      {
+        mask_type plane = planes[i] & increment;
+        mask_type next  = plane & carry;
+
+        plane ^= carry;
+        carry  = next;
+
+        reached &= ((target >> i) & 1U) ? plane : mask_type(~plane);
+
+        planes[i] = plane;
+      }
+
+      for (size_t i = 0; i < bits; ++i)
+      {
+        planes[i] &= ~reached;
+      }
+
+      return reached;
+    }
+
+    mask_type state_mask;
+    mask_type changed_mask;
+    mask_type held_mask;
+    mask_type new_held;
+    mask_type valid_count[VALID_BITS];
+    mask_type hold_count[HOLD_BITS];
+  };
+}
+
+#endif
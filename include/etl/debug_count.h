@@ -61,7 +61,7 @@ namespace etl
   {
   public:
 
-    inline debug_count()
+    inline ETL_CONSTEXPR debug_count()
       : count(0)
     {
     }
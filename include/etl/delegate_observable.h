@@ -0,0 +1,302 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DELEGATE_OBSERVABLE_INCLUDED
+#define ETL_DELEGATE_OBSERVABLE_INCLUDED
+
+//*****************************************************************************
+///\defgroup delegate_observable delegate_observable
+/// An observable that notifies a list of etl::delegate callbacks rather than
+/// calling virtual 'notification' functions on observer objects.
+///
+/// The callback list is double buffered in the style of RCU (read-copy-update).
+/// Notification reads the published list without locking.
+/// add/remove/clear build the new list in the other buffer and then publish it.
+/// Notification never waits for a subscriber; a subscriber waits only
+/// for notifications still reading the buffer that it is about to overwrite.
+/// Subscribers are serialised between themselves.
+///\ingroup patterns
+//*****************************************************************************
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "delegate.h"
+#include "atomic.h"
+#include "observer.h"
+#include "error_handler.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <typename TSignature, const size_t MAX_OBSERVERS_>
+  class delegate_observable;
+
+  //*********************************************************************
+  /// The object that is being observed.
+  ///\tparam TParams       The notification parameter types.
+  ///\tparam MAX_OBSERVERS The maximum number of observers that can be accomodated.
+  ///\ingroup delegate_observable
+  //*********************************************************************
+  template <typename... TParams, const size_t MAX_OBSERVERS_>
+  class delegate_observable<void(TParams...), MAX_OBSERVERS_>
+  {
+  public:
+
+    typedef size_t size_type;
+    typedef etl::delegate<void(TParams...)> delegate_type;
+
+    static const size_t MAX_OBSERVERS = MAX_OBSERVERS_;
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    delegate_observable()
+      : active(0U)
+      , writer(false)
+    {
+      count[0] = 0U;
+      count[1] = 0U;
+      readers[0].store(0U);
+      readers[1].store(0U);
+    }
+
+    //*****************************************************************
+    /// Add an observer to the list.
+    /// If asserts or exceptions are enabled then an etl::observer_list_full
+    /// is emitted if the observer list is already full.
+    /// Safe to call while another thread is notifying.
+    ///\param observer The observer's delegate.
+    //*****************************************************************
+    void add_observer(const delegate_type& observer)
+    {
+      lock_writer();
+
+      const size_t current = active.load();
+      const size_t next    = current ^ 1U;
+
+      // Already there?
+      if (find(current, observer) == count[current])
+      {
+        if (count[current] == MAX_OBSERVERS)
+        {
+          unlock_writer();
+          ETL_ASSERT(false, ETL_ERROR(etl::observer_list_full));
+          return;
+        }
+
+        wait_for_readers(next);
+        copy(current, next);
+        observers[next][count[next]++] = observer;
+        active.store(next);
+      }
+
+      unlock_writer();
+    }
+
+    //*****************************************************************
+    /// Remove a particular observer from the list.
+    /// Safe to call while another thread is notifying.
+    /// A notification that started before the call may still reach the observer.
+    ///\param observer The observer's delegate.
+    ///\return <b>true</b> if the observer was removed, <b>false</b> if not.
+    //*****************************************************************
+    bool remove_observer(const delegate_type& observer)
+    {
+      lock_writer();
+
+      const size_t current = active.load();
+      const size_t next    = current ^ 1U;
+      const size_t index   = find(current, observer);
+      const bool   found   = (index != count[current]);
+
+      if (found)
+      {
+        wait_for_readers(next);
+
+        size_t n = 0U;
+
+        for (size_t i = 0U; i < count[current]; ++i)
+        {
+          if (i != index)
+          {
+            observers[next][n++] = observers[current][i];
+          }
+        }
+
+        count[next] = n;
+        active.store(next);
+      }
+
+      unlock_writer();
+
+      return found;
+    }
+
+    //*****************************************************************
+    /// Clear all observers from the list.
+    /// Safe to call while another thread is notifying.
+    //*****************************************************************
+    void clear_observers()
+    {
+      lock_writer();
+
+      const size_t next = active.load() ^ 1U;
+
+      wait_for_readers(next);
+      count[next] = 0U;
+      active.store(next);
+
+      unlock_writer();
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    size_type number_of_observers() const
+    {
+      return count[active.load()];
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers.
+    /// Lock free. May be called from several threads at once.
+    ///\param params The notification parameters.
+    //*****************************************************************
+    void notify_observers(TParams... params)
+    {
+      const size_t current = enter_reader();
+
+      const delegate_type* p_observer = observers[current];
+      const delegate_type* p_end      = p_observer + count[current];
+
+      while (p_observer != p_end)
+      {
+        (*p_observer)(params...);
+        ++p_observer;
+      }
+
+      readers[current].fetch_sub(1U);
+    }
+
+  protected:
+
+    ~delegate_observable()
+    {
+    }
+
+  private:
+
+    //*****************************************************************
+    /// Registers a reader against the published buffer.
+    /// Retries if the buffer was swapped before the registration was visible,
+    /// as a subscriber may already be rewriting it.
+    //*****************************************************************
+    size_t enter_reader()
+    {
+      while (true)
+      {
+        const size_t current = active.load();
+
+        readers[current].fetch_add(1U);
+
+        if (active.load() == current)
+        {
+          return current;
+        }
+
+        readers[current].fetch_sub(1U);
+      }
+    }
+
+    //*****************************************************************
+    /// Waits for notifications still reading the unpublished buffer.
+    //*****************************************************************
+    void wait_for_readers(size_t buffer)
+    {
+      while (readers[buffer].load() != 0U)
+      {
+      }
+    }
+
+    //*****************************************************************
+    void lock_writer()
+    {
+      while (writer.exchange(true))
+      {
+      }
+    }
+
+    //*****************************************************************
+    void unlock_writer()
+    {
+      writer.store(false);
+    }
+
+    //*****************************************************************
+    size_t find(size_t buffer, const delegate_type& observer) const
+    {
+      size_t i = 0U;
+
+      while ((i < count[buffer]) && (observers[buffer][i] != observer))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*****************************************************************
+    void copy(size_t from, size_t to)
+    {
+      for (size_t i = 0U; i < count[from]; ++i)
+      {
+        observers[to][i] = observers[from][i];
+      }
+
+      count[to] = count[from];
+    }
+
+    // Disable copy construction and assignment.
+    delegate_observable(const delegate_observable&) ETL_DELETE;
+    delegate_observable& operator =(const delegate_observable&) ETL_DELETE;
+
+    delegate_type       observers[2][MAX_OBSERVERS];
+    size_t              count[2];
+    etl::atomic<size_t> readers[2];
+    etl::atomic<size_t> active;
+    etl::atomic<bool>   writer;
+  };
+}
+
+#endif
+
+#endif
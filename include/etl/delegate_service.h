@@ -152,6 +152,81 @@ namespace etl
     /// Lookup table of delegates.
     etl::array<etl::delegate<void(size_t)>, RANGE> lookup;
   };
+
+  //***************************************************************************
+  /// A delegate service where the handlers are bound at compile time.
+  /// The handler table is a constexpr array of function pointers, so it may be
+  /// placed in read only memory, and call<ID>() and vector<ID>() resolve to a
+  /// direct, inlinable, call of the handler.
+  /// \tparam OFFSET    The lowest delegate id value.
+  /// \tparam UNHANDLED The handler called for ids that are out of range.
+  /// \tparam HANDLERS  The handlers for ids OFFSET to OFFSET + sizeof...(HANDLERS) - 1.
+  //***************************************************************************
+  template <const size_t OFFSET, void (*UNHANDLED)(size_t), void (*... HANDLERS)(size_t)>
+  class static_delegate_service
+  {
+  public:
+
+    typedef void (*handler_type)(size_t);
+
+    static ETL_CONSTEXPR const size_t RANGE = sizeof...(HANDLERS);
+
+    //*************************************************************************
+    /// Executes the handler for the id.
+    /// Compile time assert if the id is out of range.
+    /// \tparam ID The id of the handler.
+    //*************************************************************************
+    template <const size_t ID>
+    static void call()
+    {
+      ETL_STATIC_ASSERT(ID < (OFFSET + RANGE), "Callback Id out of range");
+      ETL_STATIC_ASSERT(ID >= OFFSET,          "Callback Id out of range");
+
+      ETL_CONSTEXPR const handler_type handler = table[ID - OFFSET];
+
+      handler(ID);
+    }
+
+    //*************************************************************************
+    /// Executes the handler for the id.
+    /// Calls the 'unhandled' handler if the id is out of range.
+    /// \param id Id of the handler.
+    //*************************************************************************
+    static void call(const size_t id)
+    {
+      if ((id >= OFFSET) && (id < (OFFSET + RANGE)))
+      {
+        table[id - OFFSET](id);
+      }
+      else
+      {
+        UNHANDLED(id);
+      }
+    }
+
+    //*************************************************************************
+    /// A parameterless entry point for the id, suitable for placing directly
+    /// in a hardware interrupt vector table.
+    /// \tparam ID The id of the handler.
+    //*************************************************************************
+    template <const size_t ID>
+    static void vector()
+    {
+      call<ID>();
+    }
+
+  private:
+
+    /// Lookup table of handlers.
+    static ETL_CONSTEXPR const handler_type table[RANGE] = { HANDLERS... };
+  };
+
+  template <const size_t OFFSET, void (*UNHANDLED)(size_t), void (*... HANDLERS)(size_t)>
+  ETL_CONSTEXPR const size_t static_delegate_service<OFFSET, UNHANDLED, HANDLERS...>::RANGE;
+
+  template <const size_t OFFSET, void (*UNHANDLED)(size_t), void (*... HANDLERS)(size_t)>
+  ETL_CONSTEXPR const typename static_delegate_service<OFFSET, UNHANDLED, HANDLERS...>::handler_type
+    static_delegate_service<OFFSET, UNHANDLED, HANDLERS...>::table[static_delegate_service<OFFSET, UNHANDLED, HANDLERS...>::RANGE];
 }
 
 #endif
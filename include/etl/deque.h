@@ -203,7 +203,8 @@ namespace etl
     deque_base(size_t max_size_, size_t buffer_size_)
       : current_size(0),
         CAPACITY(max_size_),
-        BUFFER_SIZE(buffer_size_)
+        BUFFER_SIZE(buffer_size_),
+        BUFFER_MASK(((buffer_size_ & (buffer_size_ - 1U)) == 0U) ? buffer_size_ - 1U : 0U)
     {
     }
 
@@ -217,6 +218,7 @@ namespace etl
     size_type       current_size; ///< The current number of elements in the deque.
     const size_type CAPACITY;     ///< The maximum number of elements in the deque.
     const size_type BUFFER_SIZE;  ///< The number of elements in the buffer.
+    const size_type BUFFER_MASK;  ///< BUFFER_SIZE - 1 if BUFFER_SIZE is a power of two, otherwise 0.
     ETL_DECLARE_DEBUG_COUNT       ///< Internal debugging.
   };
 
@@ -251,6 +253,14 @@ namespace etl
     {
     };
 
+    // Can a range be copied to the buffer as raw memory?
+    template <typename TIterator>
+    struct is_bulk_copyable : public etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                                                  etl::is_same<typename etl::iterator_traits<TIterator>::value_type, T>::value &&
+                                                                  etl::is_trivially_copyable<T>::value>
+    {
+    };
+
   public:
 
     //*************************************************************************
@@ -279,7 +289,7 @@ namespace etl
       //***************************************************
       iterator& operator ++()
       {
-        index = (static_cast<size_t>(index) == p_deque->BUFFER_SIZE - 1) ? 0 : index + 1;
+        index = p_deque->add_index(index, 1);
 
         return *this;
       }
@@ -288,7 +298,7 @@ namespace etl
       iterator operator ++(int)
       {
         iterator previous(*this);
-        index = (static_cast<size_t>(index) == p_deque->BUFFER_SIZE - 1) ? 0 : index + 1;
+        index = p_deque->add_index(index, 1);
 
         return previous;
       }
@@ -298,8 +308,7 @@ namespace etl
       {
         if (offset > 0)
         {
-          index += offset;
-          index = (static_cast<size_t>(index) > p_deque->BUFFER_SIZE - 1) ? index - p_deque->BUFFER_SIZE : index;
+          index = p_deque->add_index(index, offset);
         }
         else if (offset < 0)
         {
@@ -314,8 +323,7 @@ namespace etl
       {
         if (offset > 0)
         {
-          index -= offset;
-          index = (index < 0) ? index + p_deque->BUFFER_SIZE : index;
+          index = p_deque->subtract_index(index, offset);
         }
         else if (offset < 0)
         {
@@ -328,7 +336,7 @@ namespace etl
       //***************************************************
       iterator& operator --()
       {
-        index = (index == 0) ? p_deque->BUFFER_SIZE - 1 : index - 1;
+        index = p_deque->subtract_index(index, 1);
 
         return *this;
       }
@@ -337,7 +345,7 @@ namespace etl
       iterator operator --(int)
       {
         iterator previous(*this);
-        index = (index == 0) ? p_deque->BUFFER_SIZE - 1 : index - 1;
+        index = p_deque->subtract_index(index, 1);
 
         return previous;
       }
@@ -475,7 +483,7 @@ namespace etl
       //***************************************************
       const_iterator& operator ++()
       {
-        index = (static_cast<size_t>(index) == p_deque->BUFFER_SIZE - 1) ? 0 : index + 1;
+        index = p_deque->add_index(index, 1);
 
         return *this;
       }
@@ -484,7 +492,7 @@ namespace etl
       const_iterator operator ++(int)
       {
         const_iterator previous(*this);
-        index = (static_cast<size_t>(index) == p_deque->BUFFER_SIZE - 1) ? 0 : index + 1;
+        index = p_deque->add_index(index, 1);
 
         return previous;
       }
@@ -494,8 +502,7 @@ namespace etl
       {
         if (offset > 0)
         {
-          index += offset;
-          index = (static_cast<size_t>(index) > p_deque->BUFFER_SIZE - 1) ? index - p_deque->BUFFER_SIZE : index;
+          index = p_deque->add_index(index, offset);
         }
         else if (offset < 0)
         {
@@ -510,8 +517,7 @@ namespace etl
       {
         if (offset > 0)
         {
-          index -= offset;
-          index = (index < 0) ? static_cast<size_t>(index) + p_deque->BUFFER_SIZE : index;
+          index = p_deque->subtract_index(index, offset);
         }
         else if (offset < 0)
         {
@@ -524,7 +530,7 @@ namespace etl
       //***************************************************
       const_iterator& operator --()
       {
-        index = (index == 0) ? p_deque->BUFFER_SIZE - 1 : index - 1;
+        index = p_deque->subtract_index(index, 1);
 
         return *this;
       }
@@ -533,7 +539,7 @@ namespace etl
       const_iterator operator --(int)
       {
         const_iterator previous(*this);
-        index = (index == 0) ? p_deque->BUFFER_SIZE - 1 : index - 1;
+        index = p_deque->subtract_index(index, 1);
 
         return previous;
       }
@@ -648,10 +654,7 @@ namespace etl
     {
       initialise();
 
-      while (range_begin != range_end)
-      {
-        push_back(*range_begin++);
-      }
+      assign_range(range_begin, range_end, etl::integral_constant<bool, is_bulk_copyable<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -662,7 +665,7 @@ namespace etl
     //*************************************************************************
     void assign(size_type n, const value_type& value)
     {
-      ETL_ASSERT(n <= CAPACITY, ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(n <= CAPACITY, ETL_ERROR(deque_full));
 
       initialise();
 
@@ -683,7 +686,7 @@ namespace etl
     //*************************************************************************
     reference at(size_t index)
     {
-      ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
+      ETL_ASSERT_CONTAINER(index < current_size, ETL_ERROR(deque_out_of_bounds));
 
       iterator result(_begin);
       result += index;
@@ -698,7 +701,7 @@ namespace etl
     //*************************************************************************
     const_reference at(size_t index) const
     {
-      ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
+      ETL_ASSERT_CONTAINER(index < current_size, ETL_ERROR(deque_out_of_bounds));
 
       iterator result(_begin);
       result += index;
@@ -880,7 +883,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       if (insert_position == begin())
       {
@@ -933,7 +936,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       if (insert_position == begin())
       {
@@ -987,7 +990,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       void* p;
 
@@ -1054,7 +1057,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       void* p;
 
@@ -1119,7 +1122,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       void* p;
 
@@ -1184,7 +1187,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       void* p;
 
@@ -1249,7 +1252,7 @@ namespace etl
     {
       iterator position(insert_position.index, *this, p_buffer);
 
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 
       void* p;
 
@@ -1316,7 +1319,7 @@ namespace etl
     {
       iterator position;
 
-      ETL_ASSERT((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
 
       if (insert_position == begin())
       {
@@ -1427,20 +1430,17 @@ namespace etl
 
       difference_type n = etl::distance(range_begin, range_end);
 
-      ETL_ASSERT((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
 
       if (insert_position == begin())
       {
-        create_element_front(n, range_begin);
+        create_elements_front(range_begin, n, etl::integral_constant<bool, is_bulk_copyable<TIterator>::value>());
 
         position = _begin;
       }
       else if (insert_position == end())
       {
-        for (difference_type i = 0; i < n; ++i)
-        {
-          create_element_back(*range_begin++);
-        }
+        create_elements_back(range_begin, n, etl::integral_constant<bool, is_bulk_copyable<TIterator>::value>());
 
         position = _end - n;
       }
@@ -1526,7 +1526,7 @@ namespace etl
     {
       iterator position(erase_position.index, *this, p_buffer);
 
-      ETL_ASSERT(distance(position) <= difference_type(current_size), ETL_ERROR(deque_out_of_bounds));
+      ETL_ASSERT_CONTAINER(distance(position) <= difference_type(current_size), ETL_ERROR(deque_out_of_bounds));
 
       if (position == _begin)
       {
@@ -1567,7 +1567,7 @@ namespace etl
     {
       iterator position(range_begin.index, *this, p_buffer);
 
-      ETL_ASSERT((distance(range_begin) <= difference_type(current_size)) && (distance(range_end) <= difference_type(current_size)), ETL_ERROR(deque_out_of_bounds));
+      ETL_ASSERT_CONTAINER((distance(range_begin) <= difference_type(current_size)) && (distance(range_end) <= difference_type(current_size)), ETL_ERROR(deque_out_of_bounds));
 
       // How many to erase?
       size_t length = etl::distance(range_begin, range_end);
@@ -1632,9 +1632,9 @@ namespace etl
     void push_back(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-      create_element_back(item);
+      push_back_unchecked(item);
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -1646,9 +1646,9 @@ namespace etl
     void push_back(rvalue_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-      create_element_back(etl::move(item));
+      push_back_unchecked(etl::move(item));
     }
 #endif
 
@@ -1661,13 +1661,9 @@ namespace etl
     void emplace_back(Args && ... args)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-
-      ::new (&(*_end)) T(etl::forward<Args>(args)...);
-      ++_end;
-      ++current_size;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(etl::forward<Args>(args)...);
     }
 
 #else
@@ -1680,13 +1676,9 @@ namespace etl
     void emplace_back(const T1& value1)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-
-      ::new (&(*_end)) T(value1);
-      ++_end;
-      ++current_size;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1);
     }
 
     //*************************************************************************
@@ -1697,13 +1689,9 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-
-      ::new (&(*_end)) T(value1, value2);
-      ++_end;
-      ++current_size;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1, value2);
     }
 
     //*************************************************************************
@@ -1714,13 +1702,9 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
-
-      ::new (&(*_end)) T(value1, value2, value3);
-      ++_end;
-      ++current_size;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1, value2, value3);
     }
 
     //*************************************************************************
@@ -1731,9 +1715,96 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
+#endif
+      emplace_back_unchecked(value1, value2, value3, value4);
+    }
+#endif
+
+    //*************************************************************************
+    /// Adds an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back_unchecked(const_reference item)
+    {
+      create_element_back(item);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back_unchecked(rvalue_reference item)
+    {
+      create_element_back(etl::move(item));
+    }
 #endif
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back_unchecked(Args && ... args)
+    {
+      ::new (&(*_end)) T(etl::forward<Args>(args)...);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+#else
+
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    //*************************************************************************
+    template <typename T1>
+    void emplace_back_unchecked(const T1& value1)
+    {
+      ::new (&(*_end)) T(value1);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    void emplace_back_unchecked(const T1& value1, const T2& value2)
+    {
+      ::new (&(*_end)) T(value1, value2);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    void emplace_back_unchecked(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ::new (&(*_end)) T(value1, value2, value3);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque without checking the capacity.
+    /// The deque must not be full. See reserve_check.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    void emplace_back_unchecked(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
       ::new (&(*_end)) T(value1, value2, value3, value4);
       ++_end;
       ++current_size;
@@ -1741,13 +1812,28 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Checks once that n more items will fit, so that the unchecked
+    /// functions may be used to add them.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if they will not fit.
+    ///\param n The number of items to be added.
+    ///\return <b>true</b> if the items will fit.
+    //*************************************************************************
+    bool reserve_check(size_t n) const
+    {
+      const bool fits = (n <= available());
+      ETL_ASSERT_CONTAINER(fits, ETL_ERROR(deque_full));
+
+      return fits;
+    }
+
     //*************************************************************************
     /// Removes the oldest item from the deque.
     //*************************************************************************
     void pop_back()
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
+      ETL_ASSERT_CONTAINER(!empty(), ETL_ERROR(deque_empty));
 #endif
       destroy_element_back();
     }
@@ -1760,7 +1846,7 @@ namespace etl
     void push_front(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
       create_element_front(item);
     }
@@ -1774,7 +1860,7 @@ namespace etl
     void push_front(rvalue_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
       create_element_front(etl::move(item));
     }
@@ -1789,7 +1875,7 @@ namespace etl
     void emplace_front(Args && ... args)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
 
       --_begin;
@@ -1808,7 +1894,7 @@ namespace etl
     void emplace_front(const T1& value1)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
 
       --_begin;
@@ -1825,7 +1911,7 @@ namespace etl
     void emplace_front(const T1& value1, const T2& value2)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
 
       --_begin;
@@ -1842,7 +1928,7 @@ namespace etl
     void emplace_front(const T1& value1, const T2& value2, const T3& value3)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
 
       --_begin;
@@ -1859,7 +1945,7 @@ namespace etl
     void emplace_front(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(deque_full));
 #endif
 
       --_begin;
@@ -1875,7 +1961,7 @@ namespace etl
     void pop_front()
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
+      ETL_ASSERT_CONTAINER(!empty(), ETL_ERROR(deque_empty));
 #endif
       destroy_element_front();
     }
@@ -1888,7 +1974,7 @@ namespace etl
     //*************************************************************************
     void resize(size_t new_size, const value_type& value = value_type())
     {
-      ETL_ASSERT(new_size <= CAPACITY, ETL_ERROR(deque_out_of_bounds));
+      ETL_ASSERT_CONTAINER(new_size <= CAPACITY, ETL_ERROR(deque_out_of_bounds));
 
       // Make it smaller?
       if (new_size < current_size)
@@ -2052,31 +2138,105 @@ namespace etl
     template <typename TIterator>
     void create_element_front(size_t n, TIterator from)
     {
-      if (n == 0)
+      _begin -= n;
+
+      iterator item = _begin;
+
+      while (n-- != 0U)
       {
-        return;
+        ::new (&(*item++)) T(*from);
+        ++from;
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
       }
+    }
 
-      if (!empty())
+    //*********************************************************************
+    /// Creates 'n' elements at the front from a contiguous range of
+    /// trivially copyable values, copying at most two buffer segments.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_elements_front(TIterator from, size_t n, etl::true_type)
+    {
+      _begin -= n;
+      copy_to_buffer(_begin.index, from, n);
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n)
+    }
+
+    //*********************************************************************
+    /// Creates 'n' elements at the front from a range.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_elements_front(TIterator from, size_t n, etl::false_type)
+    {
+      create_element_front(n, from);
+    }
+
+    //*********************************************************************
+    /// Creates 'n' elements at the back from a contiguous range of
+    /// trivially copyable values, copying at most two buffer segments.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_elements_back(TIterator from, size_t n, etl::true_type)
+    {
+      copy_to_buffer(_end.index, from, n);
+      _end += n;
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n)
+    }
+
+    //*********************************************************************
+    /// Creates 'n' elements at the back from a range.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_elements_back(TIterator from, size_t n, etl::false_type)
+    {
+      while (n-- != 0U)
       {
-        --_begin;
-        --n;
+        create_element_back(*from);
+        ++from;
       }
+    }
 
-      if (n > 0)
+    //*********************************************************************
+    /// Assigns a contiguous range of trivially copyable values to an empty deque.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator range_begin, TIterator range_end, etl::true_type)
+    {
+      const size_t n = size_t(range_end - range_begin);
+
+      ETL_ASSERT_CONTAINER(n <= CAPACITY, ETL_ERROR(deque_full));
+
+      if (n <= CAPACITY)
       {
-        _begin -= n;
+        create_elements_back(range_begin, n, etl::true_type());
       }
+    }
 
-      iterator item = _begin;
-
-      do
+    //*********************************************************************
+    /// Assigns a range to an empty deque.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator range_begin, TIterator range_end, etl::false_type)
+    {
+      while (range_begin != range_end)
       {
-        ::new (&(*item++)) T(*from);
-        ++from;
-        ++current_size;
-        ETL_INCREMENT_DEBUG_COUNT
-      } while (n-- != 0);
+        push_back(*range_begin++);
+      }
+    }
+
+    //*********************************************************************
+    /// Copies 'n' values to the buffer, starting at the index provided and
+    /// wrapping to the start of the buffer.
+    //*********************************************************************
+    void copy_to_buffer(difference_type index, const T* p_source, size_t n)
+    {
+      const size_t n_first = etl::min(n, size_t(BUFFER_SIZE - size_t(index)));
+
+      etl::copy(p_source, p_source + n_first, p_buffer + index);
+      etl::copy(p_source + n_first, p_source + n, p_buffer);
     }
 
     //*********************************************************************
@@ -2158,6 +2318,42 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT
     }
 
+    //*************************************************************************
+    /// Steps a buffer index forward by 0 <= offset <= BUFFER_SIZE, wrapping
+    /// at the end of the buffer. Masks when the buffer size is a power of two.
+    //*************************************************************************
+    difference_type add_index(difference_type index, difference_type offset) const
+    {
+      index += offset;
+
+      if (BUFFER_MASK != 0U)
+      {
+        return difference_type(size_t(index) & BUFFER_MASK);
+      }
+      else
+      {
+        return (size_t(index) >= BUFFER_SIZE) ? index - difference_type(BUFFER_SIZE) : index;
+      }
+    }
+
+    //*************************************************************************
+    /// Steps a buffer index back by 0 <= offset <= BUFFER_SIZE, wrapping
+    /// at the start of the buffer. Masks when the buffer size is a power of two.
+    //*************************************************************************
+    difference_type subtract_index(difference_type index, difference_type offset) const
+    {
+      index -= offset;
+
+      if (BUFFER_MASK != 0U)
+      {
+        return difference_type(size_t(index) & BUFFER_MASK);
+      }
+      else
+      {
+        return (index < 0) ? index + difference_type(BUFFER_SIZE) : index;
+      }
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
@@ -2178,16 +2374,8 @@ namespace etl
     {
       const difference_type index = other.get_index();
       const difference_type reference_index = other.get_deque()._begin.index;
-      const size_t buffer_size = other.get_deque().BUFFER_SIZE;
 
-      if (index < reference_index)
-      {
-        return buffer_size + index - reference_index;
-      }
-      else
-      {
-        return index - reference_index;
-      }
+      return other.get_deque().subtract_index(index, reference_index);
     }
 
     // Disable copy construction.
@@ -2364,7 +2552,7 @@ namespace etl
     void repair()
     {
 #if ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
-      ETL_ASSERT(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::deque_incompatible_type));
+      ETL_ASSERT_CONTAINER(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::deque_incompatible_type));
 #endif
 
       etl::ideque<T>::repair_buffer(reinterpret_cast<T*>(&buffer[0]));
@@ -2376,6 +2564,103 @@ namespace etl
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[BUFFER_SIZE];
   };
 
+  //***************************************************************************
+  /// A fixed capacity double ended queue that uses a buffer supplied by the caller.
+  /// The deque uses one more element than its maximum size, so the buffer
+  /// must hold max_size + 1 elements; see buffer_size(). It must be aligned
+  /// for T and outlive the deque.
+  ///\tparam T The type of items this deque holds.
+  ///\ingroup deque
+  //***************************************************************************
+  template <typename T>
+  class deque_ext : public etl::ideque<T>
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef size_t   size_type;
+    typedef typename etl::iterator_traits<pointer>::difference_type difference_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size + 1 elements.
+    ///\param max_size The capacity of the deque.
+    //*************************************************************************
+    deque_ext(void* buffer, size_t max_size)
+      : etl::ideque<T>(reinterpret_cast<T*>(buffer), max_size, max_size + 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    deque_ext(TIterator begin_, TIterator end_, void* buffer, size_t max_size)
+      : etl::ideque<T>(reinterpret_cast<T*>(buffer), max_size, max_size + 1U)
+    {
+      this->assign(begin_, end_);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a count and value.
+    //*************************************************************************
+    deque_ext(size_t n, const_reference value, void* buffer, size_t max_size)
+      : etl::ideque<T>(reinterpret_cast<T*>(buffer), max_size, max_size + 1U)
+    {
+      this->assign(n, value);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size elements.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return (max_size + 1U) * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~deque_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    deque_ext& operator =(const deque_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The external buffer does not move, so there is nothing to do.
+    //*************************************************************************
+#ifdef ETL_IDEQUE_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+    }
+
+  private:
+
+    // Disable copy construction, as there is no buffer to copy in to.
+    deque_ext(const deque_ext&);
+  };
+
   //***************************************************************************
   /// Equal operator.
   ///\param lhs  Reference to the _begin deque.
@@ -0,0 +1,406 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DIGITAL_FILTER_INCLUDED
+#define ETL_DIGITAL_FILTER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "array_view.h"
+#include "circular_buffer.h"
+#include "fixed_point.h"
+#include "scaled_rounding.h"
+#include "static_assert.h"
+
+///\defgroup digital_filter digital_filter
+/// Fixed order FIR and biquad IIR filters for floating point and
+/// etl::fixed_point samples.
+/// Fixed point filters accumulate exact products in 64 bits and round once,
+/// saturating to the range of the sample format. The coefficient format may
+/// differ from the sample format, to allow coefficients with magnitudes
+/// greater than one.
+/// Blocks may be read from an etl::icircular_buffer; each of its contiguous
+/// segments is processed in turn, so the inner loops contain no modulo
+/// arithmetic.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_digital_filter
+  {
+    //*************************************************************************
+    /// Multiply accumulate for floating point and other arithmetic types.
+    //*************************************************************************
+    template <typename TSample, typename TCoefficient>
+    struct mac_traits
+    {
+      typedef TSample accumulator_type;
+
+      static accumulator_type zero()
+      {
+        return accumulator_type(0);
+      }
+
+      static void add(accumulator_type& accumulator, TCoefficient coefficient, TSample sample)
+      {
+        accumulator += coefficient * sample;
+      }
+
+      static void subtract(accumulator_type& accumulator, TCoefficient coefficient, TSample sample)
+      {
+        accumulator -= coefficient * sample;
+      }
+
+      static TSample result(accumulator_type accumulator)
+      {
+        return accumulator;
+      }
+    };
+
+    //*************************************************************************
+    /// Multiply accumulate for fixed point.
+    /// Raw products carry SAMPLE_FRAC + COEFF_FRAC fractional bits and are
+    /// summed exactly, then rounded back to the sample format.
+    //*************************************************************************
+    template <size_t SAMPLE_INT, size_t SAMPLE_FRAC, size_t COEFF_INT, size_t COEFF_FRAC>
+    struct mac_traits<etl::fixed_point<SAMPLE_INT, SAMPLE_FRAC>, etl::fixed_point<COEFF_INT, COEFF_FRAC> >
+    {
+      typedef etl::fixed_point<SAMPLE_INT, SAMPLE_FRAC> sample_type;
+      typedef etl::fixed_point<COEFF_INT, COEFF_FRAC>   coefficient_type;
+      typedef int64_t                                    accumulator_type;
+
+      static accumulator_type zero()
+      {
+        return 0;
+      }
+
+      static void add(accumulator_type& accumulator, coefficient_type coefficient, sample_type sample)
+      {
+        accumulator += accumulator_type(coefficient.raw()) * accumulator_type(sample.raw());
+      }
+
+      static void subtract(accumulator_type& accumulator, coefficient_type coefficient, sample_type sample)
+      {
+        accumulator -= accumulator_type(coefficient.raw()) * accumulator_type(sample.raw());
+      }
+
+      static sample_type result(accumulator_type accumulator)
+      {
+        const accumulator_type value = etl::round_half_up_unscaled<coefficient_type::SCALING>(accumulator);
+
+        if (value > accumulator_type(sample_type::RAW_MAX))
+        {
+          return sample_type::max();
+        }
+        else if (value < accumulator_type(sample_type::RAW_MIN))
+        {
+          return sample_type::min();
+        }
+        else
+        {
+          return sample_type::from_raw(typename sample_type::value_type(value));
+        }
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A fixed order FIR filter.
+  /// y[n] = sum(h[k] * x[n - k]) for k in 0 to TAPS - 1.
+  /// The delay line is held twice over, so the window of the last TAPS
+  /// samples is always contiguous.
+  ///\tparam TSample      The sample type.
+  ///\tparam TAPS         The number of coefficients.
+  ///\tparam TCoefficient The coefficient type.
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename TSample, const size_t TAPS, typename TCoefficient = TSample>
+  class fir_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(TAPS > 0U, "FIR filter must have at least one tap");
+
+    typedef TSample      sample_type;
+    typedef TCoefficient coefficient_type;
+
+    static const size_t ORDER = TAPS - 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param coefficients TAPS coefficients. coefficients[0] applies to the newest sample.
+    //*************************************************************************
+    explicit fir_filter(const TCoefficient* coefficients)
+    {
+      set_coefficients(coefficients);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients. The delay line is unchanged.
+    //*************************************************************************
+    void set_coefficients(const TCoefficient* coefficients)
+    {
+      for (size_t i = 0U; i < TAPS; ++i)
+      {
+        h[i] = coefficients[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the delay line.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < (2U * TAPS); ++i)
+      {
+        history[i] = TSample();
+      }
+
+      index = 0U;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TSample process(TSample sample)
+    {
+      index = (index == 0U) ? (TAPS - 1U) : (index - 1U);
+
+      history[index]        = sample;
+      history[index + TAPS] = sample;
+
+      const TSample* window = history + index;
+
+      typename mac_t::accumulator_type accumulator = mac_t::zero();
+
+      for (size_t k = 0U; k < TAPS; ++k)
+      {
+        mac_t::add(accumulator, h[k], window[k]);
+      }
+
+      return mac_t::result(accumulator);
+    }
+
+    //*************************************************************************
+    /// Filters a block. Input and output may be the same memory.
+    /// Processes the length of the shorter view and returns it.
+    //*************************************************************************
+    size_t process(etl::array_view<const TSample> input, etl::array_view<TSample> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = process(input[i]);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Filters the samples in a circular buffer, oldest first.
+    /// The buffer is not modified.
+    /// Processes the smaller of the buffer size and the output length and returns it.
+    //*************************************************************************
+    size_t process(const etl::icircular_buffer<TSample>& input, etl::array_view<TSample> output)
+    {
+      const size_t n1 = process(input.array_one(), output);
+      const size_t n2 = process(input.array_two(), etl::array_view<TSample>(output.data() + n1, output.size() - n1));
+
+      return n1 + n2;
+    }
+
+  private:
+
+    typedef private_digital_filter::mac_traits<TSample, TCoefficient> mac_t;
+
+    TCoefficient h[TAPS];
+    TSample      history[2U * TAPS];
+    size_t       index;
+  };
+
+  template <typename TSample, const size_t TAPS, typename TCoefficient>
+  const size_t fir_filter<TSample, TAPS, TCoefficient>::ORDER;
+
+  //***************************************************************************
+  /// Coefficients for a biquad section, normalised so that a0 is 1.
+  /// H(z) = (b0 + b1.z^-1 + b2.z^-2) / (1 + a1.z^-1 + a2.z^-2)
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename TCoefficient>
+  struct biquad_coefficients
+  {
+    TCoefficient b0;
+    TCoefficient b1;
+    TCoefficient b2;
+    TCoefficient a1;
+    TCoefficient a2;
+  };
+
+  //***************************************************************************
+  /// A cascade of STAGES second order IIR sections in direct form I.
+  /// Direct form I keeps the state in the sample format, which avoids
+  /// internal overflow for fixed point samples.
+  ///\tparam TSample      The sample type.
+  ///\tparam STAGES       The number of second order sections.
+  ///\tparam TCoefficient The coefficient type.
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename TSample, const size_t STAGES = 1U, typename TCoefficient = TSample>
+  class biquad_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(STAGES > 0U, "Biquad filter must have at least one stage");
+
+    typedef TSample                                   sample_type;
+    typedef TCoefficient                              coefficient_type;
+    typedef etl::biquad_coefficients<TCoefficient>    coefficients_type;
+
+    static const size_t ORDER = 2U * STAGES;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param coefficients STAGES sets of coefficients, first stage first.
+    //*************************************************************************
+    explicit biquad_filter(const coefficients_type* coefficients)
+    {
+      set_coefficients(coefficients);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients. The state is unchanged.
+    //*************************************************************************
+    void set_coefficients(const coefficients_type* coefficients)
+    {
+      for (size_t s = 0U; s < STAGES; ++s)
+      {
+        stages[s].c = coefficients[s];
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the state.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t s = 0U; s < STAGES; ++s)
+      {
+        stages[s].x1 = TSample();
+        stages[s].x2 = TSample();
+        stages[s].y1 = TSample();
+        stages[s].y2 = TSample();
+      }
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TSample process(TSample sample)
+    {
+      for (size_t s = 0U; s < STAGES; ++s)
+      {
+        stage& st = stages[s];
+
+        typename mac_t::accumulator_type accumulator = mac_t::zero();
+
+        mac_t::add(accumulator, st.c.b0, sample);
+        mac_t::add(accumulator, st.c.b1, st.x1);
+        mac_t::add(accumulator, st.c.b2, st.x2);
+        mac_t::subtract(accumulator, st.c.a1, st.y1);
+        mac_t::subtract(accumulator, st.c.a2, st.y2);
+
+        const TSample y = mac_t::result(accumulator);
+
+        st.x2 = st.x1;
+        st.x1 = sample;
+        st.y2 = st.y1;
+        st.y1 = y;
+
+        sample = y;
+      }
+
+      return sample;
+    }
+
+    //*************************************************************************
+    /// Filters a block. Input and output may be the same memory.
+    /// Processes the length of the shorter view and returns it.
+    //*************************************************************************
+    size_t process(etl::array_view<const TSample> input, etl::array_view<TSample> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = process(input[i]);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Filters the samples in a circular buffer, oldest first.
+    /// The buffer is not modified.
+    /// Processes the smaller of the buffer size and the output length and returns it.
+    //*************************************************************************
+    size_t process(const etl::icircular_buffer<TSample>& input, etl::array_view<TSample> output)
+    {
+      const size_t n1 = process(input.array_one(), output);
+      const size_t n2 = process(input.array_two(), etl::array_view<TSample>(output.data() + n1, output.size() - n1));
+
+      return n1 + n2;
+    }
+
+  private:
+
+    typedef private_digital_filter::mac_traits<TSample, TCoefficient> mac_t;
+
+    struct stage
+    {
+      coefficients_type c;
+      TSample           x1;
+      TSample           x2;
+      TSample           y1;
+      TSample           y2;
+    };
+
+    stage stages[STAGES];
+  };
+
+  template <typename TSample, const size_t STAGES, typename TCoefficient>
+  const size_t biquad_filter<TSample, STAGES, TCoefficient>::ORDER;
+}
+
+#endif
@@ -0,0 +1,171 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DOUBLE_BUFFER_INCLUDED
+#define ETL_DOUBLE_BUFFER_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup double_buffer double_buffer
+/// Hands whole frames from one producer to one consumer.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup double_buffer
+  /// Two buffers of T shared by one producer and one consumer.
+  /// The producer fills the back buffer and publishes it, which swaps it with
+  /// the front buffer, unless the consumer is reading the front buffer.
+  /// Neither side ever waits; a publish during a read fails and may be retried.
+  /// Use etl::triple_buffer if the producer must always be able to publish.
+  ///\code
+  /// // Producer
+  /// fill(buffer.back());
+  /// buffer.publish();
+  ///
+  /// // Consumer
+  /// const Frame* p_frame = buffer.acquire();
+  /// if (p_frame != nullptr)
+  /// {
+  ///   use(*p_frame);
+  ///   buffer.release();
+  /// }
+  ///\endcode
+  //***************************************************************************
+  template <typename T>
+  class double_buffer
+  {
+  public:
+
+    typedef T value_type;
+
+    double_buffer()
+      : state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// The buffer that the producer fills.
+    /// Only to be called by the producer.
+    //*************************************************************************
+    T& back()
+    {
+      return buffers[back_index(state.load(etl::memory_order_relaxed))];
+    }
+
+    //*************************************************************************
+    /// Makes the back buffer the front buffer.
+    /// Only to be called by the producer.
+    ///\return <b>true</b> if published, <b>false</b> if the consumer is reading
+    /// the front buffer. The back buffer is unchanged if <b>false</b>.
+    //*************************************************************************
+    bool publish()
+    {
+      uint32_t current = state.load(etl::memory_order_relaxed);
+
+      while ((current & READING) == 0U)
+      {
+        const uint32_t swapped = ((current & FRONT) ^ FRONT) | FRESH;
+
+        if (state.compare_exchange_weak(current, swapped, etl::memory_order_acq_rel, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Starts reading the front buffer, if a new one has been published.
+    /// Only to be called by the consumer.
+    ///\return A pointer to the front buffer, or nullptr if there is nothing new.
+    /// Call release() when done with a non-null result.
+    //*************************************************************************
+    const T* acquire()
+    {
+      uint32_t current = state.load(etl::memory_order_relaxed);
+
+      while ((current & FRESH) != 0U)
+      {
+        if (state.compare_exchange_weak(current, (current & FRONT) | READING, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          return &buffers[current & FRONT];
+        }
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Finishes reading the front buffer.
+    /// Only to be called by the consumer, after a successful acquire().
+    //*************************************************************************
+    void release()
+    {
+      state.fetch_and(~READING, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Checks if a new front buffer has been published and not yet acquired.
+    //*************************************************************************
+    bool fresh() const
+    {
+      return (state.load(etl::memory_order_acquire) & FRESH) != 0U;
+    }
+
+  private:
+
+    static const uint32_t FRONT   = 0x01U; ///< The index of the front buffer.
+    static const uint32_t FRESH   = 0x02U; ///< The front buffer has not been acquired.
+    static const uint32_t READING = 0x04U; ///< The consumer is reading the front buffer.
+
+    static uint32_t back_index(uint32_t s)
+    {
+      return (s & FRONT) ^ FRONT;
+    }
+
+    // Disabled.
+    double_buffer(const double_buffer&);
+    double_buffer& operator =(const double_buffer&);
+
+    T                     buffers[2];
+    etl::atomic<uint32_t> state;
+  };
+}
+
+#endif
+#endif
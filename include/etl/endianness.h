@@ -31,14 +31,22 @@ SOFTWARE.
 #ifndef ETL_ENDIAN_INCLUDED
 #define ETL_ENDIAN_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "enum_type.h"
 #include "binary.h"
+#include "array_view.h"
 
 ///\defgroup endian endian
-/// Constants & utilities for endianess
+/// Constants & utilities for endianess.
+/// Whole buffers may be converted with byteswap_range, hton_range and ntoh_range.
+/// The loops are written so that the compiler can vectorise them; GCC and Clang
+/// turn them into SSSE3 / NEON byte shuffles when those are enabled.
+/// endian_integer (be_uint32_t etc.) stores a value in a fixed byte order and
+/// converts on access, so that protocol structures may be overlaid on buffers.
 ///\ingroup utilities
 
 namespace etl
@@ -192,6 +200,242 @@ namespace etl
       return host;
     }
   }
+
+  namespace private_endian
+  {
+    //*************************************************************************
+    /// Returns true if the host is little endian.
+    /// Resolved at compile time where the compiler tells us the byte order.
+    //*************************************************************************
+    inline bool host_is_little()
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+      return (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__);
+#elif defined(ETL_COMPILER_MICROSOFT)
+      return true;
+#else
+      return (etl::endianness::value() == etl::endian::little);
+#endif
+    }
+
+    //*************************************************************************
+    /// Returns true if values stored in 'order' must be swapped on this host.
+    //*************************************************************************
+    inline bool needs_swap(etl::endian::enum_type order)
+    {
+      return (order != etl::endian::native) && ((order == etl::endian::little) != host_is_little());
+    }
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each element in the range, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void byteswap_range(T* begin, T* end)
+  {
+    while (begin != end)
+    {
+      *begin = etl::reverse_bytes(*begin);
+      ++begin;
+    }
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each element in the range, writing to destination.
+  /// The source and destination may be the same, but must not partially overlap.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void byteswap_range(const T* begin, const T* end, T* destination)
+  {
+    while (begin != end)
+    {
+      *destination = etl::reverse_bytes(*begin);
+      ++begin;
+      ++destination;
+    }
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each element in the view, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void byteswap_range(etl::array_view<T> view)
+  {
+    etl::byteswap_range(view.data(), view.data() + view.size());
+  }
+
+  //***************************************************************************
+  /// Converts a range from host to network order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void hton_range(T* begin, T* end)
+  {
+    if (private_endian::host_is_little())
+    {
+      etl::byteswap_range(begin, end);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts a range from host to network order, writing to destination.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void hton_range(const T* begin, const T* end, T* destination)
+  {
+    if (private_endian::host_is_little())
+    {
+      etl::byteswap_range(begin, end, destination);
+    }
+    else if (begin != destination)
+    {
+      memmove(destination, begin, sizeof(T) * size_t(end - begin));
+    }
+  }
+
+  //***************************************************************************
+  /// Converts a view from host to network order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void hton_range(etl::array_view<T> view)
+  {
+    etl::hton_range(view.data(), view.data() + view.size());
+  }
+
+  //***************************************************************************
+  /// Converts a range from network to host order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void ntoh_range(T* begin, T* end)
+  {
+    etl::hton_range(begin, end);
+  }
+
+  //***************************************************************************
+  /// Converts a range from network to host order, writing to destination.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void ntoh_range(const T* begin, const T* end, T* destination)
+  {
+    etl::hton_range(begin, end, destination);
+  }
+
+  //***************************************************************************
+  /// Converts a view from network to host order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  void ntoh_range(etl::array_view<T> view)
+  {
+    etl::hton_range(view.data(), view.data() + view.size());
+  }
+
+  //***************************************************************************
+  /// An integer stored in a fixed byte order.
+  /// The storage is a byte array, so the type has an alignment of 1 and may be
+  /// overlaid on a received buffer at any offset. The value is converted to and
+  /// from host order when it is accessed.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, etl::endian::enum_type ENDIAN>
+  class endian_integer
+  {
+  public:
+
+    typedef T value_type;
+
+#if ETL_CPP11_SUPPORTED
+    endian_integer() = default;
+#else
+    endian_integer()
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Construct from a host order value.
+    //*************************************************************************
+    endian_integer(T value)
+    {
+      store(value);
+    }
+
+    //*************************************************************************
+    /// Assign from a host order value.
+    //*************************************************************************
+    endian_integer& operator =(T value)
+    {
+      store(value);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the value in host order.
+    //*************************************************************************
+    operator T() const
+    {
+      return value();
+    }
+
+    //*************************************************************************
+    /// Gets the value in host order.
+    //*************************************************************************
+    T value() const
+    {
+      T result;
+      memcpy(&result, bytes, sizeof(T));
+
+      if (private_endian::needs_swap(ENDIAN))
+      {
+        result = etl::reverse_bytes(result);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the stored bytes.
+    //*************************************************************************
+    const unsigned char* data() const
+    {
+      return bytes;
+    }
+
+  private:
+
+    void store(T value)
+    {
+      if (private_endian::needs_swap(ENDIAN))
+      {
+        value = etl::reverse_bytes(value);
+      }
+
+      memcpy(bytes, &value, sizeof(T));
+    }
+
+    unsigned char bytes[sizeof(T)];
+  };
+
+  typedef etl::endian_integer<uint16_t, etl::endian::big>    be_uint16_t;
+  typedef etl::endian_integer<uint32_t, etl::endian::big>    be_uint32_t;
+  typedef etl::endian_integer<uint64_t, etl::endian::big>    be_uint64_t;
+  typedef etl::endian_integer<int16_t,  etl::endian::big>    be_int16_t;
+  typedef etl::endian_integer<int32_t,  etl::endian::big>    be_int32_t;
+  typedef etl::endian_integer<int64_t,  etl::endian::big>    be_int64_t;
+
+  typedef etl::endian_integer<uint16_t, etl::endian::little> le_uint16_t;
+  typedef etl::endian_integer<uint32_t, etl::endian::little> le_uint32_t;
+  typedef etl::endian_integer<uint64_t, etl::endian::little> le_uint64_t;
+  typedef etl::endian_integer<int16_t,  etl::endian::little> le_int16_t;
+  typedef etl::endian_integer<int32_t,  etl::endian::little> le_int32_t;
+  typedef etl::endian_integer<int64_t,  etl::endian::little> le_int64_t;
 }
 
 #endif
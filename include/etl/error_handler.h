@@ -37,6 +37,8 @@ SOFTWARE.
 ///\ingroup utilities
 
 #include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
 
 #include "platform.h"
 #include "exception.h"
@@ -54,6 +56,19 @@ namespace etl
 
     template <class dummy>
     etl::ifunction<const etl::exception&>* wrapper<dummy>::p_ifunction = nullptr;
+
+    template <class dummy>
+    struct assert_wrapper
+    {
+      static void (*p_callback)(const char* file, int line);
+      static size_t failures;
+    };
+
+    template <class dummy>
+    void (*assert_wrapper<dummy>::p_callback)(const char* file, int line) = nullptr;
+
+    template <class dummy>
+    size_t assert_wrapper<dummy>::failures = 0U;
   }
 
   //***************************************************************************
@@ -100,61 +115,233 @@ namespace etl
     /// Sends the exception error to the user's handler function.
     ///\param e The exception error.
     //*****************************************************************************
-    static void error(const etl::exception& e)
+    ETL_COLD ETL_NOINLINE static void error(const etl::exception& e)
     {
       if (private_error_handler::wrapper<void>::p_ifunction != nullptr)
       {
         (*private_error_handler::wrapper<void>::p_ifunction)(e);
       }
     }
+
+    //*****************************************************************************
+    /// Sets the function called by ETL_ASSERT_LEVEL_CALLBACK checks.
+    /// No exception is constructed; only the file and line are passed.
+    ///\param p_callback The function, or nullptr for none.
+    //*****************************************************************************
+    static void set_assert_callback(void (*p_callback)(const char* file, int line))
+    {
+      private_error_handler::assert_wrapper<void>::p_callback = p_callback;
+    }
+
+    //*****************************************************************************
+    /// The number of failed ETL_ASSERT_LEVEL_COUNT and ETL_ASSERT_LEVEL_CALLBACK checks.
+    /// The count is not atomic.
+    //*****************************************************************************
+    static size_t assert_failures()
+    {
+      return private_error_handler::assert_wrapper<void>::failures;
+    }
+
+    //*****************************************************************************
+    /// Sets the failed check count to zero.
+    //*****************************************************************************
+    static void clear_assert_failures()
+    {
+      private_error_handler::assert_wrapper<void>::failures = 0U;
+    }
+
+    //*****************************************************************************
+    /// Counts a failed check.
+    //*****************************************************************************
+    ETL_COLD static void assert_count()
+    {
+      ++private_error_handler::assert_wrapper<void>::failures;
+    }
+
+    //*****************************************************************************
+    /// Counts a failed check and calls the assert callback, if set.
+    //*****************************************************************************
+    ETL_COLD ETL_NOINLINE static void assert_callback(const char* file, int line)
+    {
+      ++private_error_handler::assert_wrapper<void>::failures;
+
+      if (private_error_handler::assert_wrapper<void>::p_callback != nullptr)
+      {
+        private_error_handler::assert_wrapper<void>::p_callback(file, line);
+      }
+    }
   };
+
+#if defined(ETL_THROW_EXCEPTIONS)
+  namespace private_error_handler
+  {
+    //*************************************************************************
+    /// The file and line of a failed check, tagged with the exception type.
+    /// ETL_ERROR makes one of these, so that the exception is only built if the
+    /// check fails. Converts to the exception for code that uses ETL_ERROR directly.
+    //*************************************************************************
+    template <typename TException>
+    struct error_site
+    {
+      error_site(const char* file_, int line_)
+        : file(file_)
+        , line(line_)
+      {
+      }
+
+      operator TException() const
+      {
+        return TException(file, line);
+      }
+
+      const char* file;
+      int         line;
+    };
+
+    //*************************************************************************
+    /// Builds and throws the exception, out of line, so that only the file,
+    /// line and a call are left in the function that checks.
+    /// The message is set by the exception type.
+    //*************************************************************************
+    template <typename TException>
+    ETL_COLD ETL_NOINLINE ETL_NORETURN void raise(error_site<TException> site)
+    {
+      const TException e(site.file, site.line);
+
+  #if defined(ETL_LOG_ERRORS)
+      etl::error_handler::error(e);
+  #endif
+      throw e;
+    }
+  }
+#endif
 }
 
 //***************************************************************************
-/// Asserts a condition.
-/// Versions of the macro that return a constant value of 'true' will allow the compiler to optimise away
-/// any 'if' statements that it is contained within.
-/// If ETL_NO_CHECKS is defined then no runtime checks are executed at all.
-/// If asserts or exceptions are enabled then the error is thrown if the assert fails. The return value is always 'true'.
-/// If ETL_LOG_ERRORS is defined then the error is logged if the assert fails. The return value is the value of the boolean test.
-/// Otherwise 'assert' is called. The return value is always 'true'.
+/// Assertion levels.
+/// ETL_ASSERT_LEVEL selects the level for all checks. The default is ETL_ASSERT_LEVEL_ERROR,
+/// or ETL_ASSERT_LEVEL_NONE if ETL_NO_CHECKS is defined.
+/// ETL_CONTAINER_ASSERT_LEVEL overrides it for vector, deque, queue, stack and circular_buffer.
+/// Only the ERROR level constructs the exception object.
+/// NONE     : The condition is not checked.
+/// TRAP     : A failed check stops the program.
+/// COUNT    : A failed check is counted. See etl::error_handler::assert_failures.
+/// CALLBACK : A failed check is counted and the file and line sent to the function set with
+///            etl::error_handler::set_assert_callback.
+/// ERROR    : A failed check is sent to the exception, error handler or 'assert' as below.
 ///\ingroup error_handler
 //***************************************************************************
-#if defined(ETL_NO_CHECKS)
-  #define ETL_ASSERT(b, e)                                                                 // Does nothing.
-  #define ETL_ALWAYS_ASSERT(e)                                                             // Does nothing.
-#elif defined(ETL_THROW_EXCEPTIONS)
-  #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e));}}     // If the condition fails, calls the error handler then throws an exception.
-    #define ETL_ALWAYS_ASSERT(e) {etl::error_handler::error((e)); throw((e));}             // Calls the error handler then throws an exception.
+#define ETL_ASSERT_LEVEL_NONE     0
+#define ETL_ASSERT_LEVEL_TRAP     1
+#define ETL_ASSERT_LEVEL_COUNT    2
+#define ETL_ASSERT_LEVEL_CALLBACK 3
+#define ETL_ASSERT_LEVEL_ERROR    4
+
+#if !defined(ETL_ASSERT_LEVEL)
+  #if defined(ETL_NO_CHECKS)
+    #define ETL_ASSERT_LEVEL ETL_ASSERT_LEVEL_NONE
   #else
-    #define ETL_ASSERT(b, e) {if (!(b)) {throw((e));}}                                     // If the condition fails, throws an exception.
-    #define ETL_ALWAYS_ASSERT(e) {throw((e));}                                             // Throws an exception.
+    #define ETL_ASSERT_LEVEL ETL_ASSERT_LEVEL_ERROR
   #endif
+#endif
+
+#if !defined(ETL_CONTAINER_ASSERT_LEVEL)
+  #define ETL_CONTAINER_ASSERT_LEVEL ETL_ASSERT_LEVEL
+#endif
+
+#if defined(ETL_VERBOSE_ERRORS)
+  #define ETL_ASSERT_FILE __FILE__
+#else
+  #define ETL_ASSERT_FILE ""
+#endif
+
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_TRAP() __builtin_trap()
+#else
+  #define ETL_TRAP() abort()
+#endif
+
+//***************************************************************************
+/// Raises an error for the ERROR level.
+/// If asserts or exceptions are enabled then the error is thrown if the assert fails.
+/// If ETL_LOG_ERRORS is defined then the error is logged if the assert fails.
+/// Otherwise 'assert' is called.
+//***************************************************************************
+#if defined(ETL_THROW_EXCEPTIONS)
+  // If ETL_LOG_ERRORS is defined then the error handler is called before the exception is thrown.
+  #define ETL_ASSERT_RAISE(b, e) {if (ETL_UNLIKELY(!(b))) {etl::private_error_handler::raise((e));}}      // If the condition fails, throws an exception.
+  #define ETL_ALWAYS_ASSERT_RAISE(e) {etl::private_error_handler::raise((e));}                            // Throws an exception.
 #else
   #if defined(ETL_LOG_ERRORS)
     #if defined(NDEBUG)
-      #define ETL_ASSERT(b, e) {if(!(b)) {etl::error_handler::error((e));}}                // If the condition fails, calls the error handler
-      #define ETL_ALWAYS_ASSERT(e) {etl::error_handler::error((e));}                       // Calls the error handler
+      #define ETL_ASSERT_RAISE(b, e) {if (ETL_UNLIKELY(!(b))) {etl::error_handler::error((e));}}               // If the condition fails, calls the error handler
+      #define ETL_ALWAYS_ASSERT_RAISE(e) {etl::error_handler::error((e));}                                    // Calls the error handler
     #else
-      #define ETL_ASSERT(b, e) {if(!(b)) {etl::error_handler::error((e)); assert(false);}} // If the condition fails, calls the error handler then asserts.
-      #define ETL_ALWAYS_ASSERT(e) {etl::error_handler::error((e)); assert(false);}        // Calls the error handler then asserts.
+      #define ETL_ASSERT_RAISE(b, e) {if (ETL_UNLIKELY(!(b))) {etl::error_handler::error((e)); assert(false);}} // If the condition fails, calls the error handler then asserts.
+      #define ETL_ALWAYS_ASSERT_RAISE(e) {etl::error_handler::error((e)); assert(false);}                     // Calls the error handler then asserts.
     #endif
   #else
     #if defined(NDEBUG)
-      #define ETL_ASSERT(b, e)                                                             // Does nothing.
-      #define ETL_ALWAYS_ASSERT(e)                                                         // Does nothing.
+      #define ETL_ASSERT_RAISE(b, e)                                                                        // Does nothing.
+      #define ETL_ALWAYS_ASSERT_RAISE(e)                                                                    // Does nothing.
     #else
-      #define ETL_ASSERT(b, e) assert((b))                                                 // If the condition fails, asserts.
-      #define ETL_ALWAYS_ASSERT(e) assert(false)                                           // Asserts.
+      #define ETL_ASSERT_RAISE(b, e) assert((b))                                                            // If the condition fails, asserts.
+      #define ETL_ALWAYS_ASSERT_RAISE(e) assert(false)                                                      // Asserts.
     #endif
   #endif
 #endif
 
-#if defined(ETL_VERBOSE_ERRORS)
-  #define ETL_ERROR(e) (e(__FILE__, __LINE__)) // Make an exception with the file name and line number.
+//***************************************************************************
+/// Asserts a condition at a level.
+/// 'level' must be one of the ETL_ASSERT_LEVEL_xxx values, or a macro that expands to one.
+/// The exception 'e' is only evaluated at the ERROR level.
+///\ingroup error_handler
+//***************************************************************************
+#define ETL_ASSERT_AT_LEVEL(level, b, e)   ETL_ASSERT_AT_LEVEL_I(level, b, e)
+#define ETL_ASSERT_AT_LEVEL_I(level, b, e) ETL_ASSERT_AT_LEVEL_##level(b, e)
+#define ETL_ASSERT_AT_LEVEL_0(b, e)                                                                     // Does nothing.
+#define ETL_ASSERT_AT_LEVEL_1(b, e) {if (ETL_UNLIKELY(!(b))) {ETL_TRAP();}}                                // If the condition fails, stops.
+#define ETL_ASSERT_AT_LEVEL_2(b, e) {if (ETL_UNLIKELY(!(b))) {etl::error_handler::assert_count();}}        // If the condition fails, counts it.
+#define ETL_ASSERT_AT_LEVEL_3(b, e) {if (ETL_UNLIKELY(!(b))) {etl::error_handler::assert_callback(ETL_ASSERT_FILE, __LINE__);}} // If the condition fails, calls the callback.
+#define ETL_ASSERT_AT_LEVEL_4(b, e) ETL_ASSERT_RAISE(b, e)                                              // If the condition fails, raises the error.
+
+#define ETL_ALWAYS_ASSERT_AT_LEVEL(level, e)   ETL_ALWAYS_ASSERT_AT_LEVEL_I(level, e)
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_I(level, e) ETL_ALWAYS_ASSERT_AT_LEVEL_##level(e)
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_0(e)                                                                 // Does nothing.
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_1(e) {ETL_TRAP();}                                                   // Stops.
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_2(e) {etl::error_handler::assert_count();}                           // Counts it.
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_3(e) {etl::error_handler::assert_callback(ETL_ASSERT_FILE, __LINE__);} // Calls the callback.
+#define ETL_ALWAYS_ASSERT_AT_LEVEL_4(e) ETL_ALWAYS_ASSERT_RAISE(e)                                      // Raises the error.
+
+//***************************************************************************
+/// Asserts a condition.
+/// Versions of the macro that return a constant value of 'true' will allow the compiler to optimise away
+/// any 'if' statements that it is contained within.
+///\ingroup error_handler
+//***************************************************************************
+#define ETL_ASSERT(b, e)     ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL, b, e)
+#define ETL_ALWAYS_ASSERT(e) ETL_ALWAYS_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL, e)
+
+//***************************************************************************
+/// Asserts a condition in a container.
+///\ingroup error_handler
+//***************************************************************************
+#define ETL_ASSERT_CONTAINER(b, e)     ETL_ASSERT_AT_LEVEL(ETL_CONTAINER_ASSERT_LEVEL, b, e)
+#define ETL_ALWAYS_ASSERT_CONTAINER(e) ETL_ALWAYS_ASSERT_AT_LEVEL(ETL_CONTAINER_ASSERT_LEVEL, e)
+
+#if defined(ETL_THROW_EXCEPTIONS)
+  // The exception is built by etl::private_error_handler::raise, if the check fails.
+  #if defined(ETL_VERBOSE_ERRORS)
+    #define ETL_ERROR(e) (etl::private_error_handler::error_site<e>(__FILE__, __LINE__)) // Make an error site with the file name and line number.
+  #else
+    #define ETL_ERROR(e) (etl::private_error_handler::error_site<e>("", __LINE__))       // Make an error site with the line number.
+  #endif
 #else
-  #define ETL_ERROR(e) (e("", __LINE__))       // Make an exception with the line number.
+  #if defined(ETL_VERBOSE_ERRORS)
+    #define ETL_ERROR(e) (e(__FILE__, __LINE__)) // Make an exception with the file name and line number.
+  #else
+    #define ETL_ERROR(e) (e("", __LINE__))       // Make an exception with the line number.
+  #endif
 #endif
 
 #if defined(ETL_VERBOSE_ERRORS)
@@ -0,0 +1,370 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_LOOP_INCLUDED
+#define ETL_EVENT_LOOP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "vector.h"
+#include "function.h"
+#include "binary.h"
+#include "timer.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#undef ETL_FILE
+#define ETL_FILE "74"
+
+///\defgroup event_loop event_loop
+/// A single threaded main loop that multiplexes event bits, queue readiness
+/// and timer deadlines.
+/// Handlers are called in priority order, one per pass, highest first.
+/// A handler is ready when its event bit has been set, by set_event(), or
+/// while the queue it was added with is not empty.
+/// The loop processes the ticks that timers have recorded with
+/// tick_from_isr() on every pass. When nothing is ready, the sleep callback
+/// is called with the number of ticks until the next timer deadline, or
+/// etl::timer::state::INACTIVE if there is none, so that the core may sleep
+/// until then (tickless idle). The sleep callback should return early on any
+/// interrupt, and must record the ticks that passed with tick_from_isr().
+///\ingroup utilities
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for event_loop.
+  ///\ingroup event_loop
+  //***************************************************************************
+  class event_loop_exception : public etl::exception
+  {
+  public:
+
+    event_loop_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// 'Full' exception, for too many handlers or timers.
+  ///\ingroup event_loop
+  //***************************************************************************
+  class event_loop_full : public etl::event_loop_exception
+  {
+  public:
+
+    event_loop_full(string_type file_name_, numeric_type line_number_)
+      : etl::event_loop_exception(ETL_ERROR_TEXT("event_loop:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Event loop.
+  /// The index of a handler is the order in which it was added, with zero
+  /// being the highest priority.
+  ///\tparam MAX_HANDLERS_ The maximum number of handlers. No more than 32.
+  ///\tparam MAX_TIMERS_   The maximum number of timers.
+  ///\ingroup event_loop
+  //***************************************************************************
+  template <size_t MAX_HANDLERS_, size_t MAX_TIMERS_ = 1U>
+  class event_loop
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_HANDLERS_ <= 32U, "No more than 32 handlers");
+
+    enum
+    {
+      MAX_HANDLERS = MAX_HANDLERS_,
+      MAX_TIMERS   = MAX_TIMERS_
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    event_loop()
+      : event_mask(0U),
+        p_sleep_callback(nullptr),
+        exit_requested(false)
+    {
+    }
+
+    //*******************************************
+    /// Adds a handler that is called when its event is set.
+    /// Returns the index of the handler, for set_event().
+    //*******************************************
+    size_t add_handler(etl::ifunction<void>& handler)
+    {
+      ETL_ASSERT(!handlers.full(), ETL_ERROR(etl::event_loop_full));
+
+      handler_data data = { &handler, nullptr, nullptr };
+      handlers.push_back(data);
+
+      return handlers.size() - 1U;
+    }
+
+    //*******************************************
+    /// Adds a handler that is called while the queue is not empty, as well as
+    /// when its event is set. The handler should pop from the queue.
+    /// The queue may be any with an empty() member function.
+    /// Returns the index of the handler, for set_event().
+    //*******************************************
+    template <typename TQueue>
+    size_t add_queue_handler(const TQueue& queue, etl::ifunction<void>& handler)
+    {
+      ETL_ASSERT(!handlers.full(), ETL_ERROR(etl::event_loop_full));
+
+      handler_data data = { &handler, &event_loop::template queue_has_data<TQueue>, &queue };
+      handlers.push_back(data);
+
+      return handlers.size() - 1U;
+    }
+
+    //*******************************************
+    /// Adds a timer, whose ticks are processed on every pass and whose next
+    /// deadline bounds the sleep time.
+    /// The timer may be any with process() and time_to_next() member
+    /// functions, such as etl::callback_timer or etl::callback_timer_wheel.
+    //*******************************************
+    template <typename TTimer>
+    void add_timer(TTimer& timer)
+    {
+      ETL_ASSERT(!timers.full(), ETL_ERROR(etl::event_loop_full));
+
+      timer_data data = { &event_loop::template process_timer<TTimer>, &event_loop::template timer_time_to_next<TTimer>, &timer };
+      timers.push_back(data);
+    }
+
+    //*******************************************
+    /// Sets the callback that is called when there is nothing to do.
+    /// It is passed the number of ticks until the next timer deadline.
+    //*******************************************
+    void set_sleep_callback(etl::ifunction<uint32_t>& callback)
+    {
+      p_sleep_callback = &callback;
+    }
+
+    //*******************************************
+    /// Marks a handler as ready.
+    /// May be called from an interrupt.
+    //*******************************************
+    void set_event(size_t index)
+    {
+      if (index < MAX_HANDLERS)
+      {
+        event_mask.fetch_or(uint32_t(1U) << index, etl::memory_order_release);
+      }
+    }
+
+    //*******************************************
+    /// Gets the mask of ready handlers.
+    /// Bit N is set if handler index N is ready.
+    //*******************************************
+    uint32_t get_ready_mask() const
+    {
+      uint32_t mask = event_mask.load(etl::memory_order_acquire);
+
+      for (size_t index = 0U; index < handlers.size(); ++index)
+      {
+        const handler_data& handler = handlers[index];
+
+        if ((handler.p_poll != nullptr) && handler.p_poll(handler.p_object))
+        {
+          mask |= uint32_t(1U) << index;
+        }
+      }
+
+      return mask;
+    }
+
+    //*******************************************
+    /// Are any handlers ready?
+    //*******************************************
+    bool has_ready_handlers() const
+    {
+      return get_ready_mask() != 0U;
+    }
+
+    //*******************************************
+    /// The number of ticks until the earliest timer deadline.
+    /// Returns etl::timer::state::INACTIVE if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      uint32_t result = etl::timer::state::INACTIVE;
+
+      for (size_t i = 0U; i < timers.size(); ++i)
+      {
+        const uint32_t delta = timers[i].p_time_to_next(timers[i].p_timer);
+
+        if (delta < result)
+        {
+          result = delta;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Makes one pass of the loop.
+    /// Processes the timers and calls the highest priority ready handler.
+    /// Returns true if a handler was called.
+    //*******************************************
+    bool run_once()
+    {
+      for (size_t i = 0U; i < timers.size(); ++i)
+      {
+        timers[i].p_process(timers[i].p_timer);
+      }
+
+      const uint32_t mask = get_ready_mask();
+
+      if (mask == 0U)
+      {
+        return false;
+      }
+
+      const size_t   index = etl::count_trailing_zeros(mask);
+      const uint32_t bit   = uint32_t(1U) << index;
+
+      // Clear before calling, so that an event raised while the handler runs is kept.
+      event_mask.fetch_and(~bit, etl::memory_order_acq_rel);
+
+      if (index < handlers.size())
+      {
+        (*handlers[index].p_handler)();
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Runs the loop until exit() is called.
+    /// Calls the sleep callback whenever a pass finds nothing to do.
+    //*******************************************
+    void run()
+    {
+      exit_requested = false;
+
+      while (!exit_requested)
+      {
+        if (!run_once() && !exit_requested && (p_sleep_callback != nullptr))
+        {
+          if (!has_ready_handlers())
+          {
+            (*p_sleep_callback)(time_to_next());
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Stops run() at the end of the current pass.
+    //*******************************************
+    void exit()
+    {
+      exit_requested = true;
+    }
+
+    //*******************************************
+    /// The number of handlers.
+    //*******************************************
+    size_t size() const
+    {
+      return handlers.size();
+    }
+
+  private:
+
+    //*******************************************
+    template <typename TQueue>
+    static bool queue_has_data(const void* p_queue)
+    {
+      return !static_cast<const TQueue*>(p_queue)->empty();
+    }
+
+    //*******************************************
+    template <typename TTimer>
+    static void process_timer(void* p_timer)
+    {
+      static_cast<TTimer*>(p_timer)->process();
+    }
+
+    //*******************************************
+    template <typename TTimer>
+    static uint32_t timer_time_to_next(const void* p_timer)
+    {
+      return static_cast<const TTimer*>(p_timer)->time_to_next();
+    }
+
+    struct handler_data
+    {
+      etl::ifunction<void>* p_handler;
+      bool                  (*p_poll)(const void*);
+      const void*           p_object;
+    };
+
+    struct timer_data
+    {
+      void     (*p_process)(void*);
+      uint32_t (*p_time_to_next)(const void*);
+      void*    p_timer;
+    };
+
+    // Disabled.
+    event_loop(const event_loop&);
+    event_loop& operator =(const event_loop&);
+
+    etl::vector<handler_data, MAX_HANDLERS> handlers;
+    etl::vector<timer_data, MAX_TIMERS>     timers;
+
+    etl::atomic<uint32_t> event_mask;
+
+    etl::ifunction<uint32_t>* p_sleep_callback;
+
+    volatile bool exit_requested;
+  };
+}
+
+#endif
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,220 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_SCHEDULER_INCLUDED
+#define ETL_EVENT_SCHEDULER_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "vector.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "binary.h"
+#include "task.h"
+#include "scheduler.h"
+#include "function.h"
+
+///\defgroup event_scheduler event_scheduler
+/// A scheduler that only calls tasks that have signalled that they are ready.
+/// Tasks, or the interrupts that feed them, call set_task_ready() to set the
+/// task's bit in a ready mask. The scheduler runs the highest priority ready
+/// task, and calls the idle callback when no task is ready, rather than polling
+/// task_request_work() on every task.
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Event driven scheduler.
+  /// The index of a task is its position in the priority ordered task list,
+  /// with zero being the highest priority. Indexes are fixed once all of the
+  /// tasks have been added.
+  /// The idle callback is where the core should sleep (i.e. WFI or a futex
+  /// wait). It must not sleep if has_ready_tasks() has become true.
+  ///\tparam MAX_TASKS_ The maximum number of tasks. No more than 32.
+  //***************************************************************************
+  template <size_t MAX_TASKS_>
+  class event_scheduler : public etl::ischeduler
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TASKS_ <= 32U, "No more than 32 tasks");
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    event_scheduler()
+      : ischeduler(task_list),
+        ready_mask(0U)
+    {
+    }
+
+    //*******************************************
+    /// Mark a task as ready by index.
+    /// May be called from an interrupt.
+    //*******************************************
+    void set_task_ready(size_t index)
+    {
+      if (index < MAX_TASKS)
+      {
+        ready_mask.fetch_or(uint32_t(1U) << index, etl::memory_order_release);
+      }
+    }
+
+    //*******************************************
+    /// Mark a task as ready.
+    /// Searches the task list, so prefer the index overload from interrupts.
+    //*******************************************
+    void set_task_ready(const etl::task& task)
+    {
+      set_task_ready(get_task_index(task));
+    }
+
+    //*******************************************
+    /// Get the index of a task.
+    /// Returns MAX_TASKS if the task has not been added.
+    //*******************************************
+    size_t get_task_index(const etl::task& task) const
+    {
+      for (size_t index = 0U; index < task_list.size(); ++index)
+      {
+        if (task_list[index] == &task)
+        {
+          return index;
+        }
+      }
+
+      return MAX_TASKS;
+    }
+
+    //*******************************************
+    /// Are any tasks ready?
+    //*******************************************
+    bool has_ready_tasks() const
+    {
+      return ready_mask.load(etl::memory_order_acquire) != 0U;
+    }
+
+    //*******************************************
+    /// Get the mask of ready tasks.
+    /// Bit N is set if task index N is ready.
+    //*******************************************
+    uint32_t get_ready_mask() const
+    {
+      return ready_mask.load(etl::memory_order_acquire);
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    /// Calls the highest priority ready task to process work once per pass.
+    /// A task that still has work afterwards stays ready.
+    //*******************************************
+    void start()
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      scheduler_running = true;
+
+      while (!scheduler_exit)
+      {
+        if (scheduler_running)
+        {
+          bool idle = schedule_ready_task();
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+  private:
+
+    //*******************************************
+    /// Run the highest priority ready task.
+    /// Returns true if no task was ready.
+    //*******************************************
+    bool schedule_ready_task()
+    {
+      const uint32_t mask = ready_mask.load(etl::memory_order_acquire);
+
+      if (mask == 0U)
+      {
+        return true;
+      }
+
+      const size_t   index = etl::count_trailing_zeros(mask);
+      const uint32_t bit   = uint32_t(1U) << index;
+
+      // Clear before processing, so that a signal raised while the task runs is kept.
+      ready_mask.fetch_and(~bit, etl::memory_order_acq_rel);
+
+      if (index < task_list.size())
+      {
+        etl::task& task = *(task_list[index]);
+
+        if (task.task_request_work() > 0)
+        {
+          task.task_process_work();
+
+          if (task.task_request_work() > 0)
+          {
+            ready_mask.fetch_or(bit, etl::memory_order_release);
+          }
+        }
+      }
+
+      return false;
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+
+    etl::atomic<uint32_t> ready_mask;
+  };
+}
+
+#endif
+
+#endif
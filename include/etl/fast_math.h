@@ -0,0 +1,429 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FAST_MATH_INCLUDED
+#define ETL_FAST_MATH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "static_assert.h"
+
+#if ETL_CPP14_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++11 OR BELOW
+#endif
+
+//*****************************************************************************
+///\defgroup fast_math fast_math
+/// Table based approximations of sin, cos, atan2, exp and log2.
+/// The tables are generated by the compiler from constant evaluated series,
+/// so they live in read only memory and need no start up code.
+/// Each function is a few arithmetic operations and one linear interpolation.
+/// Maximum absolute errors, measured against the standard library:
+///   fast_sin, fast_cos : 8e-5
+///   fast_atan2         : 6e-6 radians
+///   fast_exp2          : 4e-6 relative
+///   fast_exp           : as fast_exp2, plus the float rounding of power / ln(2)
+///   fast_log2          : 1.2e-5
+/// lookup_table may be used to build tables for other functions.
+///\ingroup maths
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_fast_math
+  {
+    constexpr double Pi  = 3.14159265358979323846;
+    constexpr double Ln2 = 0.69314718055994530942;
+
+    //*************************************************************************
+    /// Series used to fill the tables at compile time.
+    /// Each is accurate to double precision over the range it is used for.
+    //*************************************************************************
+
+    /// sin(x) for x in [-pi, pi].
+    constexpr double sin_series(double x)
+    {
+      double term = x;
+      double sum  = x;
+
+      for (int n = 1; n < 20; ++n)
+      {
+        term *= -x * x / double((2 * n) * (2 * n + 1));
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    /// exp(x) for x in [-1, 1].
+    constexpr double exp_series(double x)
+    {
+      double term = 1.0;
+      double sum  = 1.0;
+
+      for (int n = 1; n < 25; ++n)
+      {
+        term *= x / double(n);
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    /// ln(x) for x in [1, 2], as 2 * atanh((x - 1) / (x + 1)).
+    constexpr double ln_series(double x)
+    {
+      const double y  = (x - 1.0) / (x + 1.0);
+      double       yn = y;
+      double       sum = 0.0;
+
+      for (int n = 0; n < 30; ++n)
+      {
+        sum += yn / double(2 * n + 1);
+        yn  *= y * y;
+      }
+
+      return 2.0 * sum;
+    }
+
+    /// sqrt(x) for x >= 0.
+    constexpr double sqrt_newton(double x)
+    {
+      if (x <= 0.0)
+      {
+        return 0.0;
+      }
+
+      double root = (x > 1.0) ? x : 1.0;
+
+      for (int n = 0; n < 64; ++n)
+      {
+        root = 0.5 * (root + x / root);
+      }
+
+      return root;
+    }
+
+    /// atan(x) for x in [0, 1].
+    /// The argument is halved twice, with atan(x) = 2 * atan(x / (1 + sqrt(1 + x^2))),
+    /// so that the series converges quickly.
+    constexpr double atan_series(double x)
+    {
+      x = x / (1.0 + sqrt_newton(1.0 + x * x));
+      x = x / (1.0 + sqrt_newton(1.0 + x * x));
+
+      double xn  = x;
+      double sum = 0.0;
+
+      for (int n = 0; n < 25; ++n)
+      {
+        sum += ((n & 1) ? -xn : xn) / double(2 * n + 1);
+        xn  *= x * x;
+      }
+
+      return 4.0 * sum;
+    }
+
+    //*************************************************************************
+    /// Table generators.
+    //*************************************************************************
+
+    /// sin(2 * pi * t), t in [0, 1].
+    constexpr double sine_cycle(double t)
+    {
+      return -sin_series((2.0 * Pi * t) - Pi);
+    }
+
+    /// 2^t, t in [0, 1].
+    constexpr double exp2_unit(double t)
+    {
+      return exp_series(t * Ln2);
+    }
+
+    /// log2(t), t in [1, 2].
+    constexpr double log2_unit(double t)
+    {
+      return ln_series(t) / Ln2;
+    }
+
+    /// atan(t), t in [0, 1].
+    constexpr double atan_unit(double t)
+    {
+      return atan_series(t);
+    }
+
+    //*************************************************************************
+    /// Splits a value into its floor and the fraction above it.
+    /// Valid for values within the range of int32_t.
+    //*************************************************************************
+    inline int32_t split(float value, float& fraction)
+    {
+      int32_t whole = int32_t(value);
+
+      if (value < float(whole))
+      {
+        --whole;
+      }
+
+      fraction = value - float(whole);
+
+      return whole;
+    }
+  }
+
+  //***************************************************************************
+  /// A table of samples of a function over [low, high], evaluated with linear
+  /// interpolation. Inputs outside the range are clamped.
+  /// Constructed at compile time when declared constexpr.
+  ///\tparam T The sample type.
+  ///\tparam N The number of samples. The interpolation error falls with N^2.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T, const size_t N>
+  class lookup_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N >= 2U, "lookup_table needs at least two samples");
+
+    typedef T value_type;
+
+    static const size_t SIZE = N;
+
+    //*************************************************************************
+    /// Samples 'generator' at N evenly spaced points over [low, high].
+    /// The generator takes and returns double.
+    //*************************************************************************
+    template <typename TGenerator>
+    constexpr lookup_table(T low_, T high_, TGenerator generator)
+      : values()
+      , low(low_)
+      , scale(T(N - 1U) / (high_ - low_))
+    {
+      const double step = (double(high_) - double(low_)) / double(N - 1U);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        values[i] = T(generator(double(low_) + (step * double(i))));
+      }
+    }
+
+    //*************************************************************************
+    /// Evaluates the function by interpolation.
+    //*************************************************************************
+    constexpr T operator ()(T x) const
+    {
+      const T position = (x - low) * scale;
+
+      if (!(position > T(0)))
+      {
+        return values[0];
+      }
+
+      if (position >= T(N - 1U))
+      {
+        return values[N - 1U];
+      }
+
+      const size_t index    = size_t(position);
+      const T      fraction = position - T(index);
+
+      return values[index] + ((values[index + 1U] - values[index]) * fraction);
+    }
+
+    //*************************************************************************
+    /// Gets a sample.
+    //*************************************************************************
+    constexpr T operator [](size_t i) const
+    {
+      return values[i];
+    }
+
+    //*************************************************************************
+    /// The number of samples.
+    //*************************************************************************
+    constexpr size_t size() const
+    {
+      return N;
+    }
+
+  private:
+
+    T values[N];
+    T low;
+    T scale;
+  };
+
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// The tables used by the fast_ functions.
+    /// A template so that the definitions may live in the header.
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+      static constexpr etl::lookup_table<float, 257> sine = etl::lookup_table<float, 257>(0.0f, 1.0f, sine_cycle);
+      static constexpr etl::lookup_table<float, 129> exp2 = etl::lookup_table<float, 129>(0.0f, 1.0f, exp2_unit);
+      static constexpr etl::lookup_table<float, 129> log2 = etl::lookup_table<float, 129>(1.0f, 2.0f, log2_unit);
+      static constexpr etl::lookup_table<float, 129> atan = etl::lookup_table<float, 129>(0.0f, 1.0f, atan_unit);
+    };
+
+    template <typename T>
+    constexpr etl::lookup_table<float, 257> tables<T>::sine;
+
+    template <typename T>
+    constexpr etl::lookup_table<float, 129> tables<T>::exp2;
+
+    template <typename T>
+    constexpr etl::lookup_table<float, 129> tables<T>::log2;
+
+    template <typename T>
+    constexpr etl::lookup_table<float, 129> tables<T>::atan;
+  }
+
+  //***************************************************************************
+  /// Sine. The argument must be within +/-1.3e10 radians.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_sin(float radians)
+  {
+    float cycles = 0.0f;
+    private_fast_math::split(radians * float(0.5 / private_fast_math::Pi), cycles);
+
+    return private_fast_math::tables<>::sine(cycles);
+  }
+
+  //***************************************************************************
+  /// Cosine. The argument must be within +/-1.3e10 radians.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_cos(float radians)
+  {
+    float cycles = 0.0f;
+    private_fast_math::split((radians * float(0.5 / private_fast_math::Pi)) + 0.25f, cycles);
+
+    return private_fast_math::tables<>::sine(cycles);
+  }
+
+  //***************************************************************************
+  /// Four quadrant arctangent, in radians in [-pi, pi].
+  /// fast_atan2(0, 0) is 0.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_atan2(float y, float x)
+  {
+    const float ax = (x < 0.0f) ? -x : x;
+    const float ay = (y < 0.0f) ? -y : y;
+
+    if ((ax == 0.0f) && (ay == 0.0f))
+    {
+      return 0.0f;
+    }
+
+    // Reduce to the first octant.
+    const bool steep = (ay > ax);
+    float angle = private_fast_math::tables<>::atan(steep ? (ax / ay) : (ay / ax));
+
+    if (steep)
+    {
+      angle = float(private_fast_math::Pi / 2.0) - angle;
+    }
+
+    if (x < 0.0f)
+    {
+      angle = float(private_fast_math::Pi) - angle;
+    }
+
+    return (y < 0.0f) ? -angle : angle;
+  }
+
+  //***************************************************************************
+  /// 2 raised to a power.
+  /// Powers below -126 give 0 and powers above 127 are limited to 127.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_exp2(float power)
+  {
+    if (power < -126.0f)
+    {
+      return 0.0f;
+    }
+
+    if (power > 127.0f)
+    {
+      power = 127.0f;
+    }
+
+    float         fraction = 0.0f;
+    const int32_t whole    = private_fast_math::split(power, fraction);
+
+    // Build 2^whole directly in the exponent field.
+    const uint32_t bits  = uint32_t(whole + 127) << 23U;
+    float          scale = 0.0f;
+    memcpy(&scale, &bits, sizeof(scale));
+
+    return scale * private_fast_math::tables<>::exp2(fraction);
+  }
+
+  //***************************************************************************
+  /// e raised to a power.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_exp(float power)
+  {
+    return etl::fast_exp2(power * float(1.0 / private_fast_math::Ln2));
+  }
+
+  //***************************************************************************
+  /// Base 2 log. The argument must be a positive, normal number.
+  ///\ingroup fast_math
+  //***************************************************************************
+  inline float fast_log2(float value)
+  {
+    uint32_t bits = 0U;
+    memcpy(&bits, &value, sizeof(bits));
+
+    const int32_t exponent = int32_t((bits >> 23U) & 0xFFU) - 127;
+
+    // Replace the exponent to give the mantissa in [1, 2).
+    bits = (bits & 0x007FFFFFU) | 0x3F800000U;
+
+    float mantissa = 0.0f;
+    memcpy(&mantissa, &bits, sizeof(mantissa));
+
+    return float(exponent) + private_fast_math::tables<>::log2(mantissa);
+  }
+}
+
+#endif
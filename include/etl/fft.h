@@ -0,0 +1,297 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FFT_INCLUDED
+#define ETL_FFT_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "array.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup fft fft
+/// In-place radix-2/4 FFT over split real and imaginary etl::arrays.
+/// Pairs of radix-2 stages are fused into radix-4 butterflies, with a single
+/// radix-2 stage first when log2(N) is odd.
+/// The quarter wave sine table is computed at compile time.
+///\ingroup maths
+
+namespace etl
+{
+#if ETL_CPP11_SUPPORTED
+
+  namespace private_fft
+  {
+    //*************************************************************************
+    /// Compile time index sequence, built with logarithmic recursion depth.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <typename TFirst, typename TSecond>
+    struct concatenate;
+
+    template <size_t... First, size_t... Second>
+    struct concatenate<index_sequence<First...>, index_sequence<Second...> >
+    {
+      typedef index_sequence<First..., (sizeof...(First) + Second)...> type;
+    };
+
+    template <size_t N>
+    struct make_index_sequence
+    {
+      typedef typename concatenate<typename make_index_sequence<N / 2U>::type,
+                                   typename make_index_sequence<N - (N / 2U)>::type>::type type;
+    };
+
+    template <>
+    struct make_index_sequence<0U>
+    {
+      typedef index_sequence<> type;
+    };
+
+    template <>
+    struct make_index_sequence<1U>
+    {
+      typedef index_sequence<0U> type;
+    };
+
+    //*************************************************************************
+    /// Compile time sine for angles in the range 0 to pi/2, by Taylor series.
+    //*************************************************************************
+    inline constexpr double sine_series(double x2, double term, size_t n)
+    {
+      return (n == 16U) ? 0.0 : term + sine_series(x2, -term * x2 / double(((2U * n) + 2U) * ((2U * n) + 3U)), n + 1U);
+    }
+
+    inline constexpr double sine(double x)
+    {
+      return sine_series(x * x, x, 0U);
+    }
+
+    //*************************************************************************
+    /// sin(2.pi.k / N) for k in 0 to N / 4.
+    //*************************************************************************
+    template <typename T, size_t N, typename TSequence = typename make_index_sequence<(N / 4U) + 1U>::type>
+    struct quarter_sine_table;
+
+    template <typename T, size_t N, size_t... Indexes>
+    struct quarter_sine_table<T, N, index_sequence<Indexes...> >
+    {
+      static constexpr T values[sizeof...(Indexes)] = { T(sine((6.283185307179586476925286766559 * double(Indexes)) / double(N)))... };
+    };
+
+    template <typename T, size_t N, size_t... Indexes>
+    constexpr T quarter_sine_table<T, N, index_sequence<Indexes...> >::values[sizeof...(Indexes)];
+
+    //*************************************************************************
+    /// The twiddle factor W(N, k) = cos(2.pi.k / N) - i.sin(2.pi.k / N)
+    /// for k in 0 to N / 2.
+    //*************************************************************************
+    template <typename T, size_t N>
+    inline void twiddle(size_t k, T& w_real, T& w_imag)
+    {
+      typedef quarter_sine_table<T, N> table;
+
+      static const size_t QUARTER = N / 4U;
+
+      if (k <= QUARTER)
+      {
+        w_real =  table::values[QUARTER - k];
+        w_imag = -table::values[k];
+      }
+      else
+      {
+        w_real = -table::values[k - QUARTER];
+        w_imag = -table::values[(2U * QUARTER) - k];
+      }
+    }
+
+    //*************************************************************************
+    /// Reorders the elements into bit reversed index order.
+    //*************************************************************************
+    template <typename T, size_t N>
+    void bit_reverse(T* real, T* imag)
+    {
+      size_t j = 0U;
+
+      for (size_t i = 0U; i < (N - 1U); ++i)
+      {
+        if (i < j)
+        {
+          T t = real[i]; real[i] = real[j]; real[j] = t;
+          t   = imag[i]; imag[i] = imag[j]; imag[j] = t;
+        }
+
+        size_t bit = N >> 1U;
+
+        while ((j & bit) != 0U)
+        {
+          j ^= bit;
+          bit >>= 1U;
+        }
+
+        j |= bit;
+      }
+    }
+
+    //*************************************************************************
+    /// Forward transform of bit reversed data.
+    //*************************************************************************
+    template <typename T, size_t N>
+    void transform(T* real, T* imag)
+    {
+      size_t log2_n = 0U;
+
+      for (size_t n = N; n > 1U; n >>= 1U)
+      {
+        ++log2_n;
+      }
+
+      size_t m = 1U;
+
+      // A radix-2 stage when log2(N) is odd.
+      if ((log2_n & 1U) != 0U)
+      {
+        for (size_t i = 0U; i < N; i += 2U)
+        {
+          const T ar = real[i];
+          const T ai = imag[i];
+          const T br = real[i + 1U];
+          const T bi = imag[i + 1U];
+
+          real[i]      = ar + br;
+          imag[i]      = ai + bi;
+          real[i + 1U] = ar - br;
+          imag[i + 1U] = ai - bi;
+        }
+
+        m = 2U;
+      }
+
+      // Radix-4 stages, each fusing the radix-2 stages of length 2m and 4m.
+      for (; m < N; m *= 4U)
+      {
+        const size_t step2 = N / (2U * m);
+        const size_t step4 = N / (4U * m);
+
+        for (size_t base = 0U; base < N; base += (4U * m))
+        {
+          for (size_t j = 0U; j < m; ++j)
+          {
+            T w2r, w2i, w4r, w4i;
+            twiddle<T, N>(j * step2, w2r, w2i);
+            twiddle<T, N>(j * step4, w4r, w4i);
+
+            const size_t a = base + j;
+            const size_t b = a + m;
+            const size_t c = b + m;
+            const size_t d = c + m;
+
+            // Length 2m butterflies on (a, b) and (c, d).
+            const T tbr = (real[b] * w2r) - (imag[b] * w2i);
+            const T tbi = (real[b] * w2i) + (imag[b] * w2r);
+            const T tdr = (real[d] * w2r) - (imag[d] * w2i);
+            const T tdi = (real[d] * w2i) + (imag[d] * w2r);
+
+            const T a1r = real[a] + tbr;
+            const T a1i = imag[a] + tbi;
+            const T b1r = real[a] - tbr;
+            const T b1i = imag[a] - tbi;
+            const T c1r = real[c] + tdr;
+            const T c1i = imag[c] + tdi;
+            const T d1r = real[c] - tdr;
+            const T d1i = imag[c] - tdi;
+
+            // Length 4m butterflies on (a, c) with W(4m, j) and (b, d) with W(4m, j + m) = -i.W(4m, j).
+            const T tcr = (c1r * w4r) - (c1i * w4i);
+            const T tci = (c1r * w4i) + (c1i * w4r);
+            const T ter = (d1r * w4i) + (d1i * w4r);
+            const T tei = (d1i * w4i) - (d1r * w4r);
+
+            real[a] = a1r + tcr;
+            imag[a] = a1i + tci;
+            real[c] = a1r - tcr;
+            imag[c] = a1i - tci;
+            real[b] = b1r + ter;
+            imag[b] = b1i + tei;
+            real[d] = b1r - ter;
+            imag[d] = b1i - tei;
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// In-place forward FFT.
+  /// X[k] = sum(x[n].exp(-2.pi.i.k.n / N))
+  ///\tparam N A power of 2, at least 4.
+  ///\ingroup fft
+  //***************************************************************************
+  template <typename T, size_t N>
+  void fft(etl::array<T, N>& real, etl::array<T, N>& imag)
+  {
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "FFT requires a floating point type");
+    ETL_STATIC_ASSERT((N >= 4U) && ((N & (N - 1U)) == 0U), "FFT size must be a power of 2, at least 4");
+
+    private_fft::bit_reverse<T, N>(real.data(), imag.data());
+    private_fft::transform<T, N>(real.data(), imag.data());
+  }
+
+  //***************************************************************************
+  /// In-place inverse FFT, scaled by 1 / N.
+  /// Uses the identity ifft(x) = swap(fft(swap(x))) / N, where swap exchanges
+  /// the real and imaginary parts.
+  ///\tparam N A power of 2, at least 4.
+  ///\ingroup fft
+  //***************************************************************************
+  template <typename T, size_t N>
+  void ifft(etl::array<T, N>& real, etl::array<T, N>& imag)
+  {
+    etl::fft(imag, real);
+
+    const T scale = T(1) / T(N);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      real[i] *= scale;
+      imag[i] *= scale;
+    }
+  }
+
+#endif
+}
+
+#endif
@@ -0,0 +1,483 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_POINT_INCLUDED
+#define ETL_FIXED_POINT_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "scaled_rounding.h"
+#include "array_view.h"
+#include "numeric_kernels.h"
+
+///\defgroup fixed_point fixed_point
+/// A signed Q format fixed point number, with INT_BITS integer bits, FRAC_BITS
+/// fractional bits and a sign bit, held in the smallest integral type that fits.
+/// Products and quotients are rounded to nearest, with halves rounded away from
+/// zero, using etl::round_half_up_unscaled.
+/// The plain operators wrap in the storage type; add_sat, sub_sat and mul_sat
+/// clamp to the range of the Q format.
+/// The array forms of add_sat, sub_sat and mul_sat are vectorised for 16 bit
+/// formats when numeric_kernels.h enables SIMD.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// Fixed point number.
+  ///\tparam INT_BITS_  The number of integral bits, not including the sign.
+  ///\tparam FRAC_BITS_ The number of fractional bits.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <const size_t INT_BITS_, const size_t FRAC_BITS_>
+  class fixed_point
+  {
+  public:
+
+    static const size_t INT_BITS  = INT_BITS_;
+    static const size_t FRAC_BITS = FRAC_BITS_;
+    static const size_t BITS      = INT_BITS + FRAC_BITS + 1U;
+
+    ETL_STATIC_ASSERT(BITS <= 32U, "Fixed point formats are limited to 32 bits");
+    ETL_STATIC_ASSERT((FRAC_BITS > 0U) && (FRAC_BITS <= 30U), "Fractional bits must be in the range 1 to 30");
+
+    typedef typename etl::smallest_int_for_bits<BITS>::type      value_type;
+    typedef typename etl::smallest_int_for_bits<BITS * 2U>::type wide_type;
+
+    static const size_t     SCALING = size_t(1U) << FRAC_BITS;
+    static const wide_type  ONE     = wide_type(1) << FRAC_BITS;
+    static const value_type RAW_MAX = value_type((wide_type(1) << (BITS - 1U)) - 1);
+    static const value_type RAW_MIN = value_type(-RAW_MAX - 1);
+
+    //*************************************************************************
+    /// Default constructor. Zero.
+    //*************************************************************************
+    ETL_CONSTEXPR fixed_point()
+      : raw_value(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an integral value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR explicit fixed_point(T value, typename etl::enable_if<etl::is_integral<T>::value, int>::type = 0)
+      : raw_value(value_type(wide_type(value) * ONE))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a floating point value, rounding to nearest.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit fixed_point(double value)
+      : raw_value(value_type((value * double(ONE)) + ((value < 0.0) ? -0.5 : 0.5)))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from the raw Q format value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point from_raw(value_type raw_value_)
+    {
+      return fixed_point(raw_value_, raw_tag());
+    }
+
+    //*************************************************************************
+    /// The raw Q format value.
+    //*************************************************************************
+    ETL_CONSTEXPR value_type raw() const
+    {
+      return raw_value;
+    }
+
+    //*************************************************************************
+    /// The largest and smallest representable values.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point max()
+    {
+      return from_raw(value_type(RAW_MAX));
+    }
+
+    static ETL_CONSTEXPR fixed_point min()
+    {
+      return from_raw(value_type(RAW_MIN));
+    }
+
+    //*************************************************************************
+    /// Conversions.
+    /// to_int rounds to nearest, with halves rounded away from zero.
+    //*************************************************************************
+    ETL_CONSTEXPR14 wide_type to_int() const
+    {
+      return etl::round_half_up_unscaled<SCALING>(wide_type(raw_value));
+    }
+
+    ETL_CONSTEXPR double to_double() const
+    {
+      return double(raw_value) / double(ONE);
+    }
+
+    ETL_CONSTEXPR float to_float() const
+    {
+      return float(to_double());
+    }
+
+    //*************************************************************************
+    /// Clamps a wide raw value to the range of the Q format.
+    //*************************************************************************
+    static ETL_CONSTEXPR value_type saturate(wide_type value)
+    {
+      return (value > wide_type(RAW_MAX)) ? value_type(RAW_MAX) : ((value < wide_type(RAW_MIN)) ? value_type(RAW_MIN) : value_type(value));
+    }
+
+    //*************************************************************************
+    /// Rounds a wide raw product back to the Q format scaling.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 wide_type rescale_product(wide_type product)
+    {
+      return etl::round_half_up_unscaled<SCALING>(product);
+    }
+
+    //*************************************************************************
+    /// Arithmetic.
+    //*************************************************************************
+    friend ETL_CONSTEXPR fixed_point operator +(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(value_type(wide_type(lhs.raw_value) + rhs.raw_value));
+    }
+
+    friend ETL_CONSTEXPR fixed_point operator -(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(value_type(wide_type(lhs.raw_value) - rhs.raw_value));
+    }
+
+    friend ETL_CONSTEXPR fixed_point operator -(const fixed_point& value)
+    {
+      return from_raw(value_type(-wide_type(value.raw_value)));
+    }
+
+    friend ETL_CONSTEXPR14 fixed_point operator *(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(value_type(rescale_product(wide_type(lhs.raw_value) * rhs.raw_value)));
+    }
+
+    friend ETL_CONSTEXPR14 fixed_point operator /(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      const wide_type numerator   = wide_type(lhs.raw_value) * ONE;
+      const wide_type denominator = rhs.raw_value;
+      const wide_type half        = denominator / 2;
+
+      // Round to nearest, with halves away from zero.
+      return from_raw(value_type(((numerator < 0) == (denominator < 0)) ? (numerator + half) / denominator
+                                                                        : (numerator - half) / denominator));
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator +=(const fixed_point& rhs)
+    {
+      *this = *this + rhs;
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator -=(const fixed_point& rhs)
+    {
+      *this = *this - rhs;
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator *=(const fixed_point& rhs)
+    {
+      *this = *this * rhs;
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator /=(const fixed_point& rhs)
+    {
+      *this = *this / rhs;
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Comparisons.
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value == rhs.raw_value;
+    }
+
+    friend ETL_CONSTEXPR bool operator !=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value != rhs.raw_value;
+    }
+
+    friend ETL_CONSTEXPR bool operator <(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value < rhs.raw_value;
+    }
+
+    friend ETL_CONSTEXPR bool operator <=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value <= rhs.raw_value;
+    }
+
+    friend ETL_CONSTEXPR bool operator >(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value > rhs.raw_value;
+    }
+
+    friend ETL_CONSTEXPR bool operator >=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.raw_value >= rhs.raw_value;
+    }
+
+  private:
+
+    struct raw_tag
+    {
+    };
+
+    ETL_CONSTEXPR fixed_point(value_type raw_value_, raw_tag)
+      : raw_value(raw_value_)
+    {
+    }
+
+    value_type raw_value;
+  };
+
+  //***************************************************************************
+  /// Saturating arithmetic.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <const size_t INT_BITS, const size_t FRAC_BITS>
+  ETL_CONSTEXPR fixed_point<INT_BITS, FRAC_BITS> add_sat(const fixed_point<INT_BITS, FRAC_BITS>& lhs, const fixed_point<INT_BITS, FRAC_BITS>& rhs)
+  {
+    typedef fixed_point<INT_BITS, FRAC_BITS> fixed_t;
+    typedef typename fixed_t::wide_type      wide_t;
+
+    return fixed_t::from_raw(fixed_t::saturate(wide_t(lhs.raw()) + rhs.raw()));
+  }
+
+  template <const size_t INT_BITS, const size_t FRAC_BITS>
+  ETL_CONSTEXPR fixed_point<INT_BITS, FRAC_BITS> sub_sat(const fixed_point<INT_BITS, FRAC_BITS>& lhs, const fixed_point<INT_BITS, FRAC_BITS>& rhs)
+  {
+    typedef fixed_point<INT_BITS, FRAC_BITS> fixed_t;
+    typedef typename fixed_t::wide_type      wide_t;
+
+    return fixed_t::from_raw(fixed_t::saturate(wide_t(lhs.raw()) - rhs.raw()));
+  }
+
+  template <const size_t INT_BITS, const size_t FRAC_BITS>
+  ETL_CONSTEXPR14 fixed_point<INT_BITS, FRAC_BITS> mul_sat(const fixed_point<INT_BITS, FRAC_BITS>& lhs, const fixed_point<INT_BITS, FRAC_BITS>& rhs)
+  {
+    typedef fixed_point<INT_BITS, FRAC_BITS> fixed_t;
+    typedef typename fixed_t::wide_type      wide_t;
+
+    return fixed_t::from_raw(fixed_t::saturate(fixed_t::rescale_product(wide_t(lhs.raw()) * rhs.raw())));
+  }
+
+  namespace private_numeric_kernels
+  {
+    //*************************************************************************
+    /// Fixed point arrays use the saturating kernels.
+    //*************************************************************************
+    template <const size_t INT_BITS, const size_t FRAC_BITS>
+    struct is_saturable<etl::fixed_point<INT_BITS, FRAC_BITS> > : etl::true_type
+    {
+    };
+
+    //*************************************************************************
+    /// When the Q format fills its storage, saturation at the format range is
+    /// saturation at the storage range, so the integral kernels apply.
+    //*************************************************************************
+    template <const size_t INT_BITS, const size_t FRAC_BITS>
+    struct add_sat_kernel<etl::fixed_point<INT_BITS, FRAC_BITS> >
+    {
+      typedef etl::fixed_point<INT_BITS, FRAC_BITS> fixed_t;
+      typedef typename fixed_t::value_type          value_t;
+
+      static void run(const fixed_t* p1, const fixed_t* p2, fixed_t* p_out, size_t n)
+      {
+        if (fixed_t::BITS == size_t(etl::integral_limits<value_t>::bits))
+        {
+          add_sat_kernel<value_t>::run(reinterpret_cast<const value_t*>(p1), reinterpret_cast<const value_t*>(p2), reinterpret_cast<value_t*>(p_out), n);
+        }
+        else
+        {
+          for (size_t i = 0U; i < n; ++i)
+          {
+            p_out[i] = etl::add_sat(p1[i], p2[i]);
+          }
+        }
+      }
+    };
+
+    template <const size_t INT_BITS, const size_t FRAC_BITS>
+    struct sub_sat_kernel<etl::fixed_point<INT_BITS, FRAC_BITS> >
+    {
+      typedef etl::fixed_point<INT_BITS, FRAC_BITS> fixed_t;
+      typedef typename fixed_t::value_type          value_t;
+
+      static void run(const fixed_t* p1, const fixed_t* p2, fixed_t* p_out, size_t n)
+      {
+        if (fixed_t::BITS == size_t(etl::integral_limits<value_t>::bits))
+        {
+          sub_sat_kernel<value_t>::run(reinterpret_cast<const value_t*>(p1), reinterpret_cast<const value_t*>(p2), reinterpret_cast<value_t*>(p_out), n);
+        }
+        else
+        {
+          for (size_t i = 0U; i < n; ++i)
+          {
+            p_out[i] = etl::sub_sat(p1[i], p2[i]);
+          }
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Saturating multiply. Vectorised for 16 bit formats.
+    //*************************************************************************
+    template <typename TFixed, const bool SIMD = (TFixed::BITS == 16U)>
+    struct mul_sat_kernel
+    {
+      static void run(const TFixed* p1, const TFixed* p2, TFixed* p_out, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p_out[i] = etl::mul_sat(p1[i], p2[i]);
+        }
+      }
+    };
+
+#if defined(ETL_NUMERIC_KERNELS_SSE2)
+    template <typename TFixed>
+    struct mul_sat_kernel<TFixed, true>
+    {
+      // Rounds a 32 bit product to nearest, halves away from zero.
+      static __m128i rescale(__m128i product)
+      {
+        const __m128i sign      = _mm_srai_epi32(product, 31);
+        __m128i       magnitude = _mm_sub_epi32(_mm_xor_si128(product, sign), sign);
+
+        magnitude = _mm_srli_epi32(_mm_add_epi32(magnitude, _mm_set1_epi32(int32_t(TFixed::SCALING / 2U))), int(TFixed::FRAC_BITS));
+
+        return _mm_sub_epi32(_mm_xor_si128(magnitude, sign), sign);
+      }
+
+      static void run(const TFixed* p1, const TFixed* p2, TFixed* p_out, size_t n)
+      {
+        const int16_t* p_lhs = reinterpret_cast<const int16_t*>(p1);
+        const int16_t* p_rhs = reinterpret_cast<const int16_t*>(p2);
+        int16_t*       p_res = reinterpret_cast<int16_t*>(p_out);
+
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          const __m128i a  = load(p_lhs + i);
+          const __m128i b  = load(p_rhs + i);
+          const __m128i lo = _mm_mullo_epi16(a, b);
+          const __m128i hi = _mm_mulhi_epi16(a, b);
+
+          const __m128i result = _mm_packs_epi32(rescale(_mm_unpacklo_epi16(lo, hi)), rescale(_mm_unpackhi_epi16(lo, hi)));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(p_res + i), result);
+        }
+
+        mul_sat_kernel<TFixed, false>::run(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+#elif defined(ETL_NUMERIC_KERNELS_NEON)
+    template <typename TFixed>
+    struct mul_sat_kernel<TFixed, true>
+    {
+      // Rounds a 32 bit product to nearest, halves away from zero.
+      static int32x4_t rescale(int32x4_t product)
+      {
+        const int32x4_t sign      = vshrq_n_s32(product, 31);
+        int32x4_t       magnitude = vsubq_s32(veorq_s32(product, sign), sign);
+
+        magnitude = vshrq_n_s32(vaddq_s32(magnitude, vdupq_n_s32(int32_t(TFixed::SCALING / 2U))), TFixed::FRAC_BITS);
+
+        return vsubq_s32(veorq_s32(magnitude, sign), sign);
+      }
+
+      static void run(const TFixed* p1, const TFixed* p2, TFixed* p_out, size_t n)
+      {
+        const int16_t* p_lhs = reinterpret_cast<const int16_t*>(p1);
+        const int16_t* p_rhs = reinterpret_cast<const int16_t*>(p2);
+        int16_t*       p_res = reinterpret_cast<int16_t*>(p_out);
+
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          const int16x8_t a = vld1q_s16(p_lhs + i);
+          const int16x8_t b = vld1q_s16(p_rhs + i);
+
+          const int32x4_t low  = rescale(vmull_s16(vget_low_s16(a),  vget_low_s16(b)));
+          const int32x4_t high = rescale(vmull_s16(vget_high_s16(a), vget_high_s16(b)));
+
+          vst1q_s16(p_res + i, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+        }
+
+        mul_sat_kernel<TFixed, false>::run(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// Multiplies the paired fixed point elements of the input views, clamping to
+  /// the range of the format, and writes the results to <b>output</b>.
+  /// Processes the length of the shortest view and returns it.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <typename T1, typename T2, const size_t INT_BITS, const size_t FRAC_BITS>
+  size_t mul_sat(const etl::array_view<T1>& view1, const etl::array_view<T2>& view2, etl::array_view<etl::fixed_point<INT_BITS, FRAC_BITS> > output)
+  {
+    typedef etl::fixed_point<INT_BITS, FRAC_BITS> value_type;
+
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T1>::type>::value), "Views must have the same element type");
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T2>::type>::value), "Views must have the same element type");
+
+    size_t n = (view1.size() < view2.size()) ? view1.size() : view2.size();
+    n = (n < output.size()) ? n : output.size();
+
+    private_numeric_kernels::mul_sat_kernel<value_type>::run(view1.data(), view2.data(), output.data(), n);
+
+    return n;
+  }
+}
+
+#endif
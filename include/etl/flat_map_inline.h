@@ -0,0 +1,1195 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MAP_INLINE_INCLUDED
+#define ETL_FLAT_MAP_INLINE_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "nullptr.h"
+#include "private/flat_inline.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "61"
+
+//*****************************************************************************
+///\defgroup flat_map_inline flat_map_inline
+/// A flat_map with the capacity defined at compile time that stores the keys
+/// and the mapped values in two parallel arrays.
+/// Lookups binary search the packed key array and never touch the values.
+/// Has insertion of O(N) and lookup of O(logN).
+/// Duplicate entries are not allowed.
+/// Iterators and references are invalidated by insertion and erasure.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_map_inline.
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  class flat_map_inline_exception : public etl::exception
+  {
+  public:
+
+    flat_map_inline_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_map_inline.
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  class flat_map_inline_full : public etl::flat_map_inline_exception
+  {
+  public:
+
+    flat_map_inline_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_map_inline_exception(ETL_ERROR_TEXT("flat_map_inline:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the flat_map_inline.
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  class flat_map_inline_out_of_bounds : public etl::flat_map_inline_exception
+  {
+  public:
+
+    flat_map_inline_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::flat_map_inline_exception(ETL_ERROR_TEXT("flat_map_inline:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_map_inline.
+  /// Can be used as a reference type for all flat_map_inline containing a specific type.
+  /// As keys and values are stored apart, iterators return a proxy holding
+  /// references to the key and the value, with members 'first' and 'second'.
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class iflat_map_inline
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    typedef const key_type&    key_parameter_t;
+    typedef const mapped_type& mapped_parameter_t;
+
+    //*************************************************************************
+    /// A reference to an element.
+    //*************************************************************************
+    struct reference
+    {
+      reference(const key_type& first_, mapped_type& second_)
+        : first(first_),
+          second(second_)
+      {
+      }
+
+      operator value_type() const
+      {
+        return value_type(first, second);
+      }
+
+      const key_type& first;
+      mapped_type&    second;
+    };
+
+    //*************************************************************************
+    /// A const reference to an element.
+    //*************************************************************************
+    struct const_reference
+    {
+      const_reference(const key_type& first_, const mapped_type& second_)
+        : first(first_),
+          second(second_)
+      {
+      }
+
+      const_reference(const reference& other)
+        : first(other.first),
+          second(other.second)
+      {
+      }
+
+      operator value_type() const
+      {
+        return value_type(first, second);
+      }
+
+      const key_type&    first;
+      const mapped_type& second;
+    };
+
+    //*************************************************************************
+    /// Holds a reference for operator ->.
+    //*************************************************************************
+    template <typename TReference>
+    class arrow_proxy
+    {
+    public:
+
+      explicit arrow_proxy(const TReference& reference_)
+        : ref(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &ref;
+      }
+
+    private:
+
+      TReference ref;
+    };
+
+    typedef arrow_proxy<reference>       pointer;
+    typedef arrow_proxy<const_reference> const_pointer;
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, pointer, reference>
+    {
+    public:
+
+      friend class iflat_map_inline;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(nullptr),
+          index(0U)
+      {
+      }
+
+      reference operator *() const
+      {
+        return reference(p_map->p_keys[index], p_map->p_values[index]);
+      }
+
+      pointer operator ->() const
+      {
+        return pointer(operator *());
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return *(*this + n);
+      }
+
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return *this;
+      }
+
+      friend iterator operator +(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(difference_type n, const iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend iterator operator -(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return difference_type(lhs.index) - difference_type(rhs.index);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      iterator(iflat_map_inline* p_map_, size_t index_)
+        : p_map(p_map_),
+          index(index_)
+      {
+      }
+
+      iflat_map_inline* p_map;
+      size_t            index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class iflat_map_inline;
+
+      const_iterator()
+        : p_map(nullptr),
+          index(0U)
+      {
+      }
+
+      const_iterator(const typename iflat_map_inline::iterator& other)
+        : p_map(other.p_map),
+          index(other.index)
+      {
+      }
+
+      const_reference operator *() const
+      {
+        return const_reference(p_map->p_keys[index], p_map->p_values[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return const_pointer(operator *());
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return *(*this + n);
+      }
+
+      const_iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return *this;
+      }
+
+      friend const_iterator operator +(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend const_iterator operator +(difference_type n, const const_iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend const_iterator operator -(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return difference_type(lhs.index) - difference_type(rhs.index);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      const_iterator(const iflat_map_inline* p_map_, size_t index_)
+        : p_map(p_map_),
+          index(index_)
+      {
+      }
+
+      const iflat_map_inline* p_map;
+      size_t                  index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the flat_map_inline.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the flat_map_inline.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the flat_map_inline.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the flat_map_inline.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the flat_map_inline.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the flat_map_inline.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the reverse beginning of the flat_map_inline.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the flat_map_inline.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the end + 1 of the flat_map_inline.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the flat_map_inline.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the flat_map_inline.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the flat_map_inline.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::flat_map_inline_full
+    /// if the key is not present and the flat_map_inline is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      if (!is_match(index, key))
+      {
+        insert_at(index, key, mapped_type());
+      }
+
+      return p_values[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::flat_map_inline_out_of_bounds
+    /// if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+      ETL_ASSERT(is_match(index, key), ETL_ERROR(flat_map_inline_out_of_bounds));
+
+      return p_values[index];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::flat_map_inline_out_of_bounds
+    /// if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const size_t index = lower_index(key);
+      ETL_ASSERT(is_match(index, key), ETL_ERROR(flat_map_inline_out_of_bounds));
+
+      return p_values[index];
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_map_inline.
+    /// If asserts or exceptions are enabled, emits flat_map_inline_full if the
+    /// flat_map_inline does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_map_inline.
+    /// If asserts or exceptions are enabled, emits flat_map_inline_full if the
+    /// flat_map_inline is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      return insert(value.first, value.second);
+    }
+
+    //*********************************************************************
+    /// Inserts a key and a value to the flat_map_inline.
+    /// If asserts or exceptions are enabled, emits flat_map_inline_full if the
+    /// flat_map_inline is already full.
+    ///\param key   The key to insert.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(key_parameter_t key, mapped_parameter_t value)
+    {
+      const size_t index = lower_index(key);
+
+      if (is_match(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      const bool inserted = insert_at(index, key, value);
+
+      return ETL_OR_STD::pair<iterator, bool>(inserted ? iterator(this, index) : end(), inserted);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_map_inline.
+    /// If asserts or exceptions are enabled, emits flat_map_inline_full if the
+    /// flat_map_inline is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_map_inline.
+    /// If asserts or exceptions are enabled, emits flat_map_inline_full if the
+    /// flat_map_inline does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      if (!is_match(index, key))
+      {
+        return 0U;
+      }
+
+      erase_at(index, 1U);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      erase_at(i_element.index, 1U);
+
+      return iterator(this, i_element.index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      erase_at(first.index, last.index - first.index);
+
+      return iterator(this, first.index);
+    }
+
+    //*************************************************************************
+    /// Clears the flat_map_inline.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_keys, p_keys + current_size);
+      etl::destroy(p_values, p_values + current_size);
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      return is_match(index, key) ? iterator(this, index) : end();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t index = lower_index(key);
+
+      return is_match(index, key) ? const_iterator(this, index) : end();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return is_match(lower_index(key), key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(this, lower_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(this, lower_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(this, upper_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(this, upper_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// The sorted array of keys.
+    //*************************************************************************
+    const key_type* keys() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// The array of values, in the same order as the keys.
+    //*************************************************************************
+    mapped_type* values()
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// The array of values, in the same order as the keys.
+    //*************************************************************************
+    const mapped_type* values() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_map_inline& operator = (const iflat_map_inline& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the flat_map_inline.
+    ///\return The current size of the flat_map_inline.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the flat_map_inline.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the flat_map_inline.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the flat_map_inline.
+    ///\return The capacity of the flat_map_inline.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the flat_map_inline.
+    ///\return The maximum size of the flat_map_inline.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_map_inline(key_type* p_keys_, mapped_type* p_values_, size_t max_size_)
+      : p_keys(p_keys_),
+        p_values(p_values_),
+        current_size(0U),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    //*********************************************************************
+    /// Copies the contents of another flat_map_inline, which is already sorted.
+    //*********************************************************************
+    void copy_from(const iflat_map_inline& other)
+    {
+      clear();
+
+      ETL_ASSERT(other.size() <= MAX_SIZE, ETL_ERROR(flat_map_inline_full));
+
+      const size_t n = etl::min(other.size(), MAX_SIZE);
+
+      etl::uninitialized_copy(other.p_keys, other.p_keys + n, p_keys);
+      etl::uninitialized_copy(other.p_values, other.p_values + n, p_values);
+
+      current_size = n;
+    }
+
+  private:
+
+    //*********************************************************************
+    /// The index of the first key not less than 'key'.
+    /// Only the key array is searched.
+    //*********************************************************************
+    size_t lower_index(key_parameter_t key) const
+    {
+      return size_t(etl::branchless_lower_bound(p_keys, p_keys + current_size, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than 'key'.
+    //*********************************************************************
+    size_t upper_index(key_parameter_t key) const
+    {
+      return size_t(etl::branchless_upper_bound(p_keys, p_keys + current_size, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// Checks if the key at the lower bound index matches.
+    //*********************************************************************
+    bool is_match(size_t index, key_parameter_t key) const
+    {
+      return (index != current_size) && !compare(key, p_keys[index]);
+    }
+
+    //*********************************************************************
+    /// Inserts a new key and value at index.
+    //*********************************************************************
+    bool insert_at(size_t index, key_parameter_t key, mapped_parameter_t value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(flat_map_inline_full));
+
+      if (full())
+      {
+        return false;
+      }
+
+      if (index == current_size)
+      {
+        ::new (p_keys + index) key_type(key);
+        ::new (p_values + index) mapped_type(value);
+      }
+      else
+      {
+        private_flat_inline::open_gap(p_keys, index, current_size);
+        private_flat_inline::open_gap(p_values, index, current_size);
+        p_keys[index]   = key;
+        p_values[index] = value;
+      }
+
+      ++current_size;
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Erases n elements at index.
+    //*********************************************************************
+    void erase_at(size_t index, size_t n)
+    {
+      private_flat_inline::close_gap(p_keys, index, n, current_size);
+      private_flat_inline::close_gap(p_values, index, n, current_size);
+      current_size -= n;
+    }
+
+    // Disable copy construction.
+    iflat_map_inline(const iflat_map_inline&);
+
+    key_type*    p_keys;       ///< The sorted keys.
+    mapped_type* p_values;     ///< The values, in the same order as the keys.
+    size_t       current_size; ///< The number of elements.
+    const size_t MAX_SIZE;     ///< The maximum number of elements.
+    key_compare  compare;      ///< The key comparison.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_map_inline()
+    {
+    }
+#else
+  protected:
+    ~iflat_map_inline()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_map_inline.
+  ///\param rhs Reference to the second flat_map_inline.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::iflat_map_inline<TKey, TMapped, TKeyCompare>& lhs, const etl::iflat_map_inline<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_map_inline.
+  ///\param rhs Reference to the second flat_map_inline.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::iflat_map_inline<TKey, TMapped, TKeyCompare>& lhs, const etl::iflat_map_inline<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A flat_map_inline implementation that uses a fixed size buffer.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The value type.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\ingroup flat_map_inline
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class flat_map_inline : public etl::iflat_map_inline<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::iflat_map_inline<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    flat_map_inline()
+      : base_t(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_map_inline(const flat_map_inline& other)
+      : base_t(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map_inline(TIterator first, TIterator last)
+      : base_t(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_map_inline(std::initializer_list<typename base_t::value_type> init)
+      : base_t(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_map_inline()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_map_inline& operator = (const flat_map_inline& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The key array.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE_, etl::alignment_of<TKey>::value>::type keys_buffer;
+
+    /// The value array.
+    typename etl::aligned_storage<sizeof(TValue) * MAX_SIZE_, etl::alignment_of<TValue>::value>::type values_buffer;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
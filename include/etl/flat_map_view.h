@@ -0,0 +1,411 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MAP_VIEW_INCLUDED
+#define ETL_FLAT_MAP_VIEW_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "array_view.h"
+#include "table_image.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#undef ETL_FILE
+#define ETL_FILE "70"
+
+//*****************************************************************************
+///\defgroup flat_map_view flat_map_view
+/// A read only map over a sorted array of key/value records that it does not
+/// own. The records may be a const array in flash, or a table image that
+/// was built offline and memory mapped, so a large lookup table is usable
+/// at start up without being rebuilt.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// Exception base for flat_map_view
+  //***************************************************************************
+  class flat_map_view_exception : public etl::exception
+  {
+  public:
+
+    flat_map_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// The exception thrown when 'at' is called with a key not in the map.
+  //***************************************************************************
+  class flat_map_view_out_of_bounds : public etl::flat_map_view_exception
+  {
+  public:
+
+    flat_map_view_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : flat_map_view_exception(ETL_ERROR_TEXT("flat_map_view:bounds", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A read only view of a sorted array of key/value records.
+  /// The records must be sorted by key and the keys must be unique.
+  ///\ingroup flat_map_view
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam TKeyCompare The key comparison functor.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class flat_map_view
+  {
+  public:
+
+    //*************************************************************************
+    /// A key/value record.
+    /// An aggregate, so that a table may be written as a const initialised
+    /// array, and trivially copyable if TKey and TMapped are, so that it may
+    /// be stored in a table image.
+    //*************************************************************************
+    struct value_type
+    {
+      TKey    first;
+      TMapped second;
+    };
+
+    typedef TKey                                         key_type;
+    typedef TMapped                                      mapped_type;
+    typedef TKeyCompare                                  key_compare;
+    typedef const value_type&                            const_reference;
+    typedef const value_type*                            const_pointer;
+    typedef const value_type*                            const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                       size_type;
+
+  private:
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor. An empty, invalid, view.
+    //*************************************************************************
+    flat_map_view()
+      : p_begin(nullptr)
+      , p_end(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and a count.
+    //*************************************************************************
+    flat_map_view(const value_type* p_records, size_t count)
+      : p_begin(p_records)
+      , p_end(p_records + count)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a C array.
+    //*************************************************************************
+    template <const size_t ARRAY_SIZE>
+    explicit flat_map_view(const value_type (&records)[ARRAY_SIZE])
+      : p_begin(records)
+      , p_end(records + ARRAY_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an array view.
+    //*************************************************************************
+    explicit flat_map_view(const etl::array_view<const value_type>& records)
+      : p_begin(records.data())
+      , p_end(records.data() + records.size())
+    {
+    }
+
+    //*************************************************************************
+    /// Creates a view of a table image, in place.
+    /// Returns an invalid view if the image is not valid.
+    //*************************************************************************
+    static flat_map_view from_image(const void* image, size_t length, uint32_t type_id = 0U)
+    {
+      return flat_map_view(etl::table_image_view<value_type>(image, length, type_id));
+    }
+
+    //*************************************************************************
+    /// Writes a range of sorted key/value pairs, such as the contents of an
+    /// etl::flat_map, as a table image.
+    /// Returns the size of the image, or 0 if it did not fit in the buffer or
+    /// the range was not sorted by unique keys.
+    //*************************************************************************
+    template <typename TIterator>
+    static size_t write_image(void* buffer, size_t length, TIterator first, TIterator last, uint32_t type_id = 0U)
+    {
+      etl::table_image_writer<value_type> writer(buffer, length, type_id);
+      key_compare compare;
+      bool        is_first = true;
+      value_type  previous;
+
+      while (first != last)
+      {
+        value_type record;
+        record.first  = first->first;
+        record.second = first->second;
+
+        if ((!is_first && !compare(previous.first, record.first)) || !writer.push_back(record))
+        {
+          return 0U;
+        }
+
+        previous = record;
+        is_first = false;
+        ++first;
+      }
+
+      return writer.finish();
+    }
+
+    //*************************************************************************
+    /// Checks that the view refers to some records.
+    /// False for a default constructed view or a rejected image.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return p_begin != nullptr;
+    }
+
+    //*************************************************************************
+    /// Checks that the records are sorted by unique keys.
+    /// O(N). Intended for a debug check after mapping an image.
+    //*************************************************************************
+    bool is_sorted() const
+    {
+      key_compare compare;
+
+      for (const_iterator itr = p_begin; (itr != p_end) && ((itr + 1) != p_end); ++itr)
+      {
+        if (!compare(itr->first, (itr + 1)->first))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first record.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first record.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the records.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the records.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last record.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(p_end);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first record.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(p_begin);
+    }
+
+    //*************************************************************************
+    /// Gets the mapped value for a key.
+    /// If asserts or exceptions are enabled, emits an etl::flat_map_view_out_of_bounds
+    /// if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(flat_map_view_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Finds a key.
+    /// Returns end() if not found.
+    //*************************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      if ((itr != end()) && !compare.comp(key, itr->first))
+      {
+        return itr;
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Counts the records with the key. 0 or 1.
+    //*************************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Finds the first record whose key is not less than the key.
+    //*************************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return etl::branchless_lower_bound(p_begin, p_end, key, compare);
+    }
+
+    //*************************************************************************
+    /// Finds the first record whose key is greater than the key.
+    //*************************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return etl::branchless_upper_bound(p_begin, p_end, key, compare);
+    }
+
+    //*************************************************************************
+    /// Finds the range of records with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Gets the number of records.
+    //*************************************************************************
+    size_type size() const
+    {
+      return static_cast<size_type>(p_end - p_begin);
+    }
+
+    //*************************************************************************
+    /// Checks if there are no records.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_begin == p_end;
+    }
+
+    //*************************************************************************
+    /// Gets the records.
+    //*************************************************************************
+    const value_type* data() const
+    {
+      return p_begin;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// How to compare records and keys.
+    //*************************************************************************
+    class Compare
+    {
+    public:
+
+      bool operator ()(const value_type& element, key_parameter_t key) const
+      {
+        return comp(element.first, key);
+      }
+
+      bool operator ()(key_parameter_t key, const value_type& element) const
+      {
+        return comp(key, element.first);
+      }
+
+      key_compare comp;
+    };
+
+    const value_type* p_begin;
+    const value_type* p_end;
+    Compare           compare;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
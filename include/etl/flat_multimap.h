@@ -336,6 +336,39 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_multimap.
+    /// The values are merged in one pass, rather than inserted one at a time,
+    /// so adding K values to N is O(N + K).
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG_COUNT)
+      const size_t initial_size = size();
+#endif
+
+      refmap_t::merge_sorted(first, last, create_node(storage));
+
+      ETL_ADD_DEBUG_COUNT(size() - initial_size)
+    }
+
+    //*********************************************************************
+    /// Merges copies of the elements of another flat_multimap into this one.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param other The flat_multimap to merge.
+    //*********************************************************************
+    void merge(const iflat_multimap& other)
+    {
+      if (&other != this)
+      {
+        insert_sorted(other.begin(), other.end());
+      }
+    }
+
     //*************************************************************************
     /// Emplaces a value to the map.
     //*************************************************************************
@@ -740,6 +773,31 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Creates a copy of an element in the storage.
+    //*********************************************************************
+    class create_node
+    {
+    public:
+
+      explicit create_node(storage_t& storage_)
+        : storage(storage_)
+      {
+      }
+
+      template <typename TValue>
+      value_type* operator ()(const TValue& value) const
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(value);
+        return pvalue;
+      }
+
+    private:
+
+      storage_t& storage;
+    };
+
     // Disable copy construction.
     iflat_multimap(const iflat_multimap&);
 
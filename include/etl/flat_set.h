@@ -314,6 +314,40 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_set.
+    /// The values are merged in one pass, rather than inserted one at a time,
+    /// so adding K values to N is O(N + K).
+    /// Elements already in the flat_set, or repeated in the range, are not added.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG_COUNT)
+      const size_t initial_size = size();
+#endif
+
+      refset_t::merge_sorted(first, last, create_node(storage));
+
+      ETL_ADD_DEBUG_COUNT(size() - initial_size)
+    }
+
+    //*********************************************************************
+    /// Merges copies of the elements of another flat_set into this one.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param other The flat_set to merge.
+    //*********************************************************************
+    void merge(const iflat_set& other)
+    {
+      if (&other != this)
+      {
+        insert_sorted(other.begin(), other.end());
+      }
+    }
+
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -777,6 +811,31 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Creates a copy of an element in the storage.
+    //*********************************************************************
+    class create_node
+    {
+    public:
+
+      explicit create_node(storage_t& storage_)
+        : storage(storage_)
+      {
+      }
+
+      template <typename TValue>
+      value_type* operator ()(const TValue& value) const
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(value);
+        return pvalue;
+      }
+
+    private:
+
+      storage_t& storage;
+    };
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
@@ -944,6 +1003,101 @@ namespace etl
     // The vector that stores pointers to the nodes.
     etl::vector<node_t*, MAX_SIZE> lookup;
   };
+
+  //***************************************************************************
+  /// A flat_set implementation whose lookup table and elements are kept in
+  /// one buffer supplied by the user, so that where the set lives is decided
+  /// when it is constructed.
+  /// The buffer must be aligned to ALIGNMENT, hold buffer_size(max_size)
+  /// bytes and outlive the flat_set.
+  ///\ingroup flat_set
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T> >
+  class flat_set_ext : public etl::iflat_set<T, TCompare>
+  {
+  private:
+
+    typedef typename etl::iflat_set<T, TCompare>::value_type node_t;
+    typedef etl::pool_ext<node_t> pool_type;
+
+    static const size_t POINTER_ALIGNMENT = etl::alignment_of<node_t*>::value;
+
+  public:
+
+    static const size_t ALIGNMENT = (pool_type::ALIGNMENT > POINTER_ALIGNMENT) ? pool_type::ALIGNMENT : POINTER_ALIGNMENT;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for the lookup table and the elements.
+    ///\param max_size The maximum number of elements.
+    //*************************************************************************
+    flat_set_ext(void* buffer, size_t max_size)
+      : etl::iflat_set<T, TCompare>(lookup, storage),
+        storage(static_cast<char*>(buffer) + storage_offset(max_size), max_size),
+        lookup(buffer, max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::iflat_set<T, TCompare>(lookup, storage),
+        storage(static_cast<char*>(buffer) + storage_offset(max_size), max_size),
+        lookup(buffer, max_size)
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size elements.
+    //*************************************************************************
+    static size_t buffer_size(size_t max_size)
+    {
+      return storage_offset(max_size) + pool_type::buffer_size(max_size);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_set_ext()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_set_ext& operator = (const flat_set_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The elements follow the lookup table.
+    //*************************************************************************
+    static size_t storage_offset(size_t max_size)
+    {
+      return (((max_size * sizeof(node_t*)) + pool_type::ALIGNMENT - 1U) / pool_type::ALIGNMENT) * pool_type::ALIGNMENT;
+    }
+
+    // The buffer belongs to the user, so cannot be copied.
+    flat_set_ext(const flat_set_ext&);
+
+    /// The pool of nodes, in the user's buffer.
+    pool_type storage;
+
+    /// The vector that stores pointers to the nodes, in the user's buffer.
+    etl::vector<node_t*, 0> lookup;
+  };
 }
 
 #undef ETL_FILE
@@ -0,0 +1,655 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_SET_INLINE_INCLUDED
+#define ETL_FLAT_SET_INLINE_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/flat_inline.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "62"
+
+//*****************************************************************************
+///\defgroup flat_set_inline flat_set_inline
+/// A flat_set with the capacity defined at compile time that stores the keys
+/// directly in one sorted contiguous array.
+/// Has insertion of O(N) and lookup of O(logN).
+/// Duplicate entries are not allowed.
+/// Iterators and pointers are invalidated by insertion and erasure.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_set_inline.
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  class flat_set_inline_exception : public etl::exception
+  {
+  public:
+
+    flat_set_inline_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_set_inline.
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  class flat_set_inline_full : public etl::flat_set_inline_exception
+  {
+  public:
+
+    flat_set_inline_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_set_inline_exception(ETL_ERROR_TEXT("flat_set_inline:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_set_inline.
+  /// Can be used as a reference type for all flat_set_inline containing a specific type.
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class iflat_set_inline
+  {
+  public:
+
+    typedef T                 key_type;
+    typedef T                 value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    // The elements are the keys, so they may not be modified through an iterator.
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    typedef const value_type& parameter_t;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the flat_set_inline.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the flat_set_inline.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the flat_set_inline.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the flat_set_inline.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the flat_set_inline.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the flat_set_inline.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the flat_set_inline.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the flat_set_inline.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the sorted array of elements.
+    //*************************************************************************
+    const value_type* data() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_set_inline.
+    /// If asserts or exceptions are enabled, emits flat_set_inline_full if the
+    /// flat_set_inline does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_set_inline.
+    /// If asserts or exceptions are enabled, emits flat_set_inline_full if the
+    /// flat_set_inline is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(parameter_t value)
+    {
+      const size_t index = lower_index(value);
+
+      if (is_match(index, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(p_buffer + index, false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(flat_set_inline_full));
+
+      if (full())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (index == current_size)
+      {
+        ::new (p_buffer + index) value_type(value);
+      }
+      else
+      {
+        private_flat_inline::open_gap(p_buffer, index, current_size);
+        p_buffer[index] = value;
+      }
+
+      ++current_size;
+
+      return ETL_OR_STD::pair<iterator, bool>(p_buffer + index, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_set_inline.
+    /// If asserts or exceptions are enabled, emits flat_set_inline_full if the
+    /// flat_set_inline is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, parameter_t value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_set_inline.
+    /// If asserts or exceptions are enabled, emits flat_set_inline_full if the
+    /// flat_set_inline does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      if (!is_match(index, key))
+      {
+        return 0U;
+      }
+
+      erase_at(index, 1U);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const size_t index = size_t(i_element - p_buffer);
+
+      erase_at(index, 1U);
+
+      return p_buffer + index;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_t index = size_t(first - p_buffer);
+
+      erase_at(index, size_t(last - first));
+
+      return p_buffer + index;
+    }
+
+    //*************************************************************************
+    /// Clears the flat_set_inline.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_buffer, p_buffer + current_size);
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(parameter_t key) const
+    {
+      const size_t index = lower_index(key);
+
+      return is_match(index, key) ? p_buffer + index : end();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(parameter_t key) const
+    {
+      return is_match(lower_index(key), key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(parameter_t key) const
+    {
+      return p_buffer + lower_index(key);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(parameter_t key) const
+    {
+      return etl::branchless_upper_bound(begin(), end(), key, compare);
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_set_inline& operator = (const iflat_set_inline& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the flat_set_inline.
+    ///\return The current size of the flat_set_inline.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the flat_set_inline.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the flat_set_inline.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the flat_set_inline.
+    ///\return The capacity of the flat_set_inline.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the flat_set_inline.
+    ///\return The maximum size of the flat_set_inline.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_set_inline(value_type* p_buffer_, size_t max_size_)
+      : p_buffer(p_buffer_),
+        current_size(0U),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    //*********************************************************************
+    /// Copies the contents of another flat_set_inline, which is already sorted.
+    //*********************************************************************
+    void copy_from(const iflat_set_inline& other)
+    {
+      clear();
+
+      ETL_ASSERT(other.size() <= MAX_SIZE, ETL_ERROR(flat_set_inline_full));
+
+      const size_t n = etl::min(other.size(), MAX_SIZE);
+
+      etl::uninitialized_copy(other.p_buffer, other.p_buffer + n, p_buffer);
+
+      current_size = n;
+    }
+
+  private:
+
+    //*********************************************************************
+    /// The index of the first element not less than 'key'.
+    //*********************************************************************
+    size_t lower_index(parameter_t key) const
+    {
+      return size_t(etl::branchless_lower_bound(begin(), end(), key, compare) - p_buffer);
+    }
+
+    //*********************************************************************
+    /// Checks if the element at the lower bound index matches.
+    //*********************************************************************
+    bool is_match(size_t index, parameter_t key) const
+    {
+      return (index != current_size) && !compare(key, p_buffer[index]);
+    }
+
+    //*********************************************************************
+    /// Erases n elements at index.
+    //*********************************************************************
+    void erase_at(size_t index, size_t n)
+    {
+      private_flat_inline::close_gap(p_buffer, index, n, current_size);
+      current_size -= n;
+    }
+
+    // Disable copy construction.
+    iflat_set_inline(const iflat_set_inline&);
+
+    value_type*  p_buffer;     ///< The sorted elements.
+    size_t       current_size; ///< The number of elements.
+    const size_t MAX_SIZE;     ///< The maximum number of elements.
+    key_compare  compare;      ///< The key comparison.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_set_inline()
+    {
+    }
+#else
+  protected:
+    ~iflat_set_inline()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_set_inline.
+  ///\param rhs Reference to the second flat_set_inline.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator ==(const etl::iflat_set_inline<T, TKeyCompare>& lhs, const etl::iflat_set_inline<T, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_set_inline.
+  ///\param rhs Reference to the second flat_set_inline.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator !=(const etl::iflat_set_inline<T, TKeyCompare>& lhs, const etl::iflat_set_inline<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A flat_set_inline implementation that uses a fixed size buffer.
+  ///\tparam T        The value type.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<T>
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\ingroup flat_set_inline
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class flat_set_inline : public etl::iflat_set_inline<T, TCompare>
+  {
+  private:
+
+    typedef etl::iflat_set_inline<T, TCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    flat_set_inline()
+      : base_t(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_set_inline(const flat_set_inline& other)
+      : base_t(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set_inline(TIterator first, TIterator last)
+      : base_t(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_set_inline(std::initializer_list<T> init)
+      : base_t(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_set_inline()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_set_inline& operator = (const flat_set_inline& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The element array.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,247 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FOOTPRINT_INCLUDED
+#define ETL_FOOTPRINT_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "type_traits.h"
+
+///\defgroup footprint footprint
+/// Compile time memory footprint of container instantiations.
+///\ingroup utilities
+
+namespace etl
+{
+  template <typename T, const size_t SIZE_, int LAYOUT_>
+  class pool;
+
+  //***************************************************************************
+  /// The element type and capacity of a container.
+  /// The default uses the container's value_type and MAX_SIZE.
+  /// Specialise for containers that do not have them.
+  ///\ingroup footprint
+  //***************************************************************************
+  template <typename TContainer>
+  struct footprint_traits
+  {
+    typedef typename TContainer::value_type value_type;
+
+    static const size_t CAPACITY = TContainer::MAX_SIZE;
+  };
+
+  //***************************************************************************
+  /// The element type and capacity of a pool.
+  ///\ingroup footprint
+  //***************************************************************************
+  template <typename T, const size_t SIZE_, int LAYOUT_>
+  struct footprint_traits<etl::pool<T, SIZE_, LAYOUT_> >
+  {
+    typedef T value_type;
+
+    static const size_t CAPACITY = SIZE_;
+  };
+
+  namespace private_footprint
+  {
+    //*************************************************************************
+    /// The container type with double the capacity, for the common template
+    /// forms. 'void' if the form is not known.
+    //*************************************************************************
+    template <typename TContainer>
+    struct doubled
+    {
+      typedef void type;
+    };
+
+    // string<N>
+    template <template <size_t> class TContainer, size_t N>
+    struct doubled<TContainer<N> >
+    {
+      typedef TContainer<N * 2U> type;
+    };
+
+    // vector<T, N>, list<T, N>, deque<T, N>, pool<T, N> ...
+    template <template <typename, size_t> class TContainer, typename T, size_t N>
+    struct doubled<TContainer<T, N> >
+    {
+      typedef TContainer<T, N * 2U> type;
+    };
+
+    // queue<T, N, MEMORY_MODEL> ...
+    template <template <typename, size_t, size_t> class TContainer, typename T, size_t N, size_t M>
+    struct doubled<TContainer<T, N, M> >
+    {
+      typedef TContainer<T, N * 2U, M> type;
+    };
+
+    // set<T, N, TCompare>, flat_set<T, N, TCompare> ...
+    template <template <typename, size_t, typename> class TContainer, typename T, size_t N, typename T2>
+    struct doubled<TContainer<T, N, T2> >
+    {
+      typedef TContainer<T, N * 2U, T2> type;
+    };
+
+    // map<TKey, TValue, N, TCompare>, flat_map<TKey, TValue, N, TCompare> ...
+    template <template <typename, typename, size_t, typename> class TContainer, typename TKey, typename TValue, size_t N, typename T3>
+    struct doubled<TContainer<TKey, TValue, N, T3> >
+    {
+      typedef TContainer<TKey, TValue, N * 2U, T3> type;
+    };
+
+    // unordered_map<TKey, TValue, N, BUCKETS, THash, TKeyEqual, TNodeHash>
+    template <template <typename, typename, size_t, size_t, typename, typename, typename> class TContainer,
+              typename TKey, typename TValue, size_t N, size_t BUCKETS, typename T4, typename T5, typename T6>
+    struct doubled<TContainer<TKey, TValue, N, BUCKETS, T4, T5, T6> >
+    {
+      typedef TContainer<TKey, TValue, N * 2U, BUCKETS * 2U, T4, T5, T6> type;
+    };
+
+    //*************************************************************************
+    /// The bytes used for each element, found from the growth in size when
+    /// the capacity is doubled.
+    //*************************************************************************
+    template <typename TContainer, typename TDoubled, size_t CAPACITY>
+    struct bytes_per_element
+    {
+      static const size_t value = (CAPACITY == 0U) ? 0U : (sizeof(TDoubled) - sizeof(TContainer)) / CAPACITY;
+    };
+
+    //*************************************************************************
+    /// The form is not known, so share all of the size between the elements.
+    //*************************************************************************
+    template <typename TContainer, size_t CAPACITY>
+    struct bytes_per_element<TContainer, void, CAPACITY>
+    {
+      static const size_t value = (CAPACITY == 0U) ? 0U : sizeof(TContainer) / CAPACITY;
+    };
+  }
+
+  //***************************************************************************
+  /// The memory footprint of a container instantiation.
+  ///\code
+  /// typedef etl::footprint<etl::list<char, 32> > list_footprint;
+  ///
+  /// list_footprint::STORAGE;              // The bytes taken by the container.
+  /// list_footprint::OVERHEAD_PER_ELEMENT; // Bytes used for each element beyond the element itself.
+  ///\endcode
+  /// The per element figures are exact for the common container forms, such as
+  /// vector<T, N>, map<K, V, N> and unordered_map<K, V, N, B>. For other forms
+  /// the whole overhead is shared between the elements.
+  ///\ingroup footprint
+  //***************************************************************************
+  template <typename TContainer>
+  struct footprint
+  {
+    typedef typename etl::footprint_traits<TContainer>::value_type value_type;
+
+    /// The bytes taken by the container, including its storage.
+    static const size_t STORAGE = sizeof(TContainer);
+
+    /// The alignment of the container.
+    static const size_t ALIGNMENT = etl::alignment_of<TContainer>::value;
+
+    /// The maximum number of elements.
+    static const size_t CAPACITY = etl::footprint_traits<TContainer>::CAPACITY;
+
+    /// The size of one element.
+    static const size_t ELEMENT_SIZE = sizeof(value_type);
+
+    /// The bytes needed for the elements alone.
+    static const size_t PAYLOAD = CAPACITY * ELEMENT_SIZE;
+
+    /// The bytes that are not element storage: links, buckets, padding and the container's own members.
+    static const size_t OVERHEAD = STORAGE - PAYLOAD;
+
+  private:
+
+    typedef typename etl::private_footprint::doubled<TContainer>::type doubled_t;
+
+    static const size_t BYTES_PER_ELEMENT = etl::private_footprint::bytes_per_element<TContainer, doubled_t, CAPACITY>::value;
+
+  public:
+
+    /// The overhead for each element, such as node links and bucket shares.
+    static const size_t OVERHEAD_PER_ELEMENT = (BYTES_PER_ELEMENT > ELEMENT_SIZE) ? BYTES_PER_ELEMENT - ELEMENT_SIZE : 0U;
+
+    /// The overhead that does not depend on the capacity, such as the container's own members.
+    static const size_t FIXED_OVERHEAD = OVERHEAD - (OVERHEAD_PER_ELEMENT * CAPACITY);
+
+    /// The percentage of the storage that holds elements.
+    static const size_t EFFICIENCY = (STORAGE == 0U) ? 0U : (PAYLOAD * 100U) / STORAGE;
+
+  private:
+
+    static const size_t POINTER_ALIGNMENT = etl::alignment_of<void*>::value;
+    static const size_t ELEMENT_REMAINDER = ELEMENT_SIZE % POINTER_ALIGNMENT;
+    static const bool   IS_NODE_BASED     = (OVERHEAD_PER_ELEMENT >= sizeof(void*));
+
+  public:
+
+    /// An estimate of the alignment padding added to each element of a node based
+    /// container, where the element shares a node with pointer aligned links.
+    /// Zero for containers that store the elements contiguously.
+    static const size_t NODE_PADDING = (IS_NODE_BASED && (ELEMENT_REMAINDER != 0U)) ? POINTER_ALIGNMENT - ELEMENT_REMAINDER : 0U;
+  };
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::STORAGE;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::ALIGNMENT;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::CAPACITY;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::ELEMENT_SIZE;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::PAYLOAD;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::OVERHEAD;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::OVERHEAD_PER_ELEMENT;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::FIXED_OVERHEAD;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::EFFICIENCY;
+
+  template <typename TContainer>
+  const size_t footprint<TContainer>::NODE_PADDING;
+}
+
+#endif
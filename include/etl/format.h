@@ -0,0 +1,685 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "cstring.h"
+#include "string_view.h"
+#include "format_spec.h"
+#include "to_string.h"
+
+#undef ETL_FILE
+#define ETL_FILE "56"
+
+//*****************************************************************************
+///\defgroup format format
+/// Formats values into an etl::istring, without printf.
+/// The format strings are a subset of the std::format syntax.
+/// {[index][:[[fill]align][0][width][.precision][type]]}
+/// align     '<' left, '>' right.
+/// type      'd' decimal, 'b' binary, 'o' octal, 'x' / 'X' hex,
+///           'f' fixed point floating, 's' text, 'c' character.
+/// Floating point values without a precision or type are formatted with the
+/// shortest text that reads back to the same value.
+/// '{{' and '}}' are literal braces.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup format
+  /// Exception base for format.
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup format
+  /// The format string is invalid.
+  //***************************************************************************
+  class format_invalid : public etl::format_exception
+  {
+  public:
+
+    format_invalid(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:invalid", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup format
+  /// A field refers to an argument that does not exist.
+  //***************************************************************************
+  class format_argument : public etl::format_exception
+  {
+  public:
+
+    format_argument(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:argument", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A segment of a format string.
+  /// Literal text, optionally followed by a replacement field.
+  ///\ingroup format
+  //***************************************************************************
+  struct format_segment
+  {
+    ETL_CONSTEXPR format_segment()
+      : text_begin(0U),
+        text_length(0U),
+        has_argument(false),
+        index(0U),
+        fill(' '),
+        align(0),
+        width(0U),
+        precision(0U),
+        has_precision(false),
+        type(0)
+    {
+    }
+
+    size_t        text_begin;    ///< The offset of the literal text.
+    size_t        text_length;   ///< The length of the literal text.
+    bool          has_argument;  ///< Is there a replacement field?
+    uint_least8_t index;         ///< The index of the argument.
+    char          fill;          ///< The fill character.
+    char          align;         ///< '<', '>' or 0 for the default.
+    uint_least8_t width;         ///< The minimum width.
+    uint_least8_t precision;     ///< The precision, if has_precision is set.
+    bool          has_precision; ///< Was a precision given?
+    char          type;          ///< The presentation type or 0 for the default.
+  };
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Splits a format string into segments.
+    //*************************************************************************
+    class parser
+    {
+    public:
+
+      ETL_CONSTEXPR14 explicit parser(const char* text_)
+        : text(text_),
+          position(0U),
+          next_index(0U),
+          valid(true)
+      {
+      }
+
+      //***********************************************************************
+      /// Gets the next segment.
+      /// Returns false at the end of the text, or if the text is invalid.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool next(etl::format_segment& segment)
+      {
+        if (!valid || (text[position] == 0))
+        {
+          return false;
+        }
+
+        segment = etl::format_segment();
+        segment.text_begin = position;
+
+        while (text[position] != 0)
+        {
+          const char c = text[position];
+
+          if ((c == '{') || (c == '}'))
+          {
+            if (text[position + 1] == c)
+            {
+              // An escaped brace. Keep one of them in the text.
+              segment.text_length = position + 1U - segment.text_begin;
+              position += 2U;
+              return true;
+            }
+
+            segment.text_length = position - segment.text_begin;
+
+            if (c == '}')
+            {
+              valid = false;
+              return false;
+            }
+
+            ++position;
+            valid = parse_field(segment);
+
+            return valid;
+          }
+
+          ++position;
+        }
+
+        segment.text_length = position - segment.text_begin;
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Is the format string valid, so far?
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool is_valid() const
+      {
+        return valid;
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Parses a number, if there is one.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool parse_number(uint_least8_t& value)
+      {
+        bool     found  = false;
+        uint32_t number = 0U;
+
+        while ((text[position] >= '0') && (text[position] <= '9'))
+        {
+          number = (number * 10U) + uint32_t(text[position] - '0');
+          found  = true;
+          ++position;
+
+          if (number > 255U)
+          {
+            valid = false;
+            return false;
+          }
+        }
+
+        if (found)
+        {
+          value = uint_least8_t(number);
+        }
+
+        return found;
+      }
+
+      //***********************************************************************
+      /// Parses a replacement field, after the '{'.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool parse_field(etl::format_segment& segment)
+      {
+        segment.has_argument = true;
+
+        if (!parse_number(segment.index))
+        {
+          segment.index = next_index;
+        }
+
+        if (!valid)
+        {
+          return false;
+        }
+
+        next_index = uint_least8_t(segment.index + 1U);
+
+        if (text[position] == ':')
+        {
+          ++position;
+
+          // Fill and align.
+          if ((text[position] != 0) && ((text[position + 1] == '<') || (text[position + 1] == '>')))
+          {
+            segment.fill  = text[position];
+            segment.align = text[position + 1];
+            position += 2U;
+          }
+          else if ((text[position] == '<') || (text[position] == '>'))
+          {
+            segment.align = text[position];
+            ++position;
+          }
+
+          // Zero padding.
+          if ((text[position] == '0') && (segment.align == 0))
+          {
+            segment.fill  = '0';
+            segment.align = '>';
+            ++position;
+          }
+
+          parse_number(segment.width);
+
+          if (text[position] == '.')
+          {
+            ++position;
+            segment.has_precision = parse_number(segment.precision);
+
+            if (!segment.has_precision)
+            {
+              return false;
+            }
+          }
+
+          const char type = text[position];
+
+          if ((type == 'd') || (type == 'b') || (type == 'o') || (type == 'x') || (type == 'X') ||
+              (type == 'f') || (type == 's') || (type == 'c'))
+          {
+            segment.type = type;
+            ++position;
+          }
+        }
+
+        if (!valid || (text[position] != '}'))
+        {
+          return false;
+        }
+
+        ++position;
+
+        return true;
+      }
+
+      const char*   text;
+      size_t        position;
+      uint_least8_t next_index;
+      bool          valid;
+    };
+
+    //*************************************************************************
+    /// Makes the format spec for a segment.
+    //*************************************************************************
+    inline etl::format_spec make_spec(const etl::format_segment& segment, bool left_by_default)
+    {
+      etl::format_spec spec;
+
+      spec.width(segment.width).fill(segment.fill);
+
+      if ((segment.align == '<') || ((segment.align == 0) && left_by_default))
+      {
+        spec.left();
+      }
+      else
+      {
+        spec.right();
+      }
+
+      switch (segment.type)
+      {
+        case 'b': spec.binary();                   break;
+        case 'o': spec.octal();                    break;
+        case 'x': spec.hex().upper_case(false);    break;
+        case 'X': spec.hex().upper_case(true);     break;
+        default:  spec.decimal();                  break;
+      }
+
+      return spec;
+    }
+
+    //*************************************************************************
+    /// Appends text, with alignment and truncation to the precision.
+    //*************************************************************************
+    inline void format_text(etl::istring& str, const char* text, size_t length, const etl::format_segment& segment)
+    {
+      if (segment.has_precision && (segment.precision < length))
+      {
+        length = segment.precision;
+      }
+
+      const size_t fill_length = (segment.width > length) ? (segment.width - length) : 0U;
+
+      if (segment.align == '>')
+      {
+        str.append(fill_length, segment.fill);
+        str.append(text, length);
+      }
+      else
+      {
+        str.append(text, length);
+        str.append(fill_length, segment.fill);
+      }
+    }
+
+    //*************************************************************************
+    /// For integrals.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value && !etl::is_same<T, char>::value, void>::type
+      format_value(etl::istring& str, const T& value, const etl::format_segment& segment)
+    {
+      etl::to_string(value, str, make_spec(segment, false), true);
+    }
+
+    //*************************************************************************
+    /// For floating point.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, void>::type
+      format_value(etl::istring& str, const T& value, const etl::format_segment& segment)
+    {
+      etl::format_spec spec = make_spec(segment, false);
+
+      if (segment.has_precision || (segment.type == 'f'))
+      {
+        spec.precision(segment.has_precision ? segment.precision : 6U);
+      }
+      else
+      {
+        spec.shortest(true);
+      }
+
+      etl::to_string(value, str, spec, true);
+    }
+
+    //*************************************************************************
+    /// For bool.
+    //*************************************************************************
+    inline void format_value(etl::istring& str, const bool& value, const etl::format_segment& segment)
+    {
+      if ((segment.type == 0) || (segment.type == 's'))
+      {
+        format_text(str, value ? "true" : "false", value ? 4U : 5U, segment);
+      }
+      else
+      {
+        format_value(str, int(value), segment);
+      }
+    }
+
+    //*************************************************************************
+    /// For char.
+    //*************************************************************************
+    inline void format_value(etl::istring& str, const char& value, const etl::format_segment& segment)
+    {
+      if ((segment.type == 0) || (segment.type == 'c'))
+      {
+        format_text(str, &value, 1U, segment);
+      }
+      else
+      {
+        format_value(str, int(value), segment);
+      }
+    }
+
+    //*************************************************************************
+    /// For text.
+    //*************************************************************************
+    inline void format_value(etl::istring& str, const char* value, const etl::format_segment& segment)
+    {
+      format_text(str, value, etl::strlen(value), segment);
+    }
+
+    inline void format_value(etl::istring& str, char* value, const etl::format_segment& segment)
+    {
+      format_text(str, value, etl::strlen(value), segment);
+    }
+
+    inline void format_value(etl::istring& str, const etl::istring& value, const etl::format_segment& segment)
+    {
+      format_text(str, value.data(), value.size(), segment);
+    }
+
+    inline void format_value(etl::istring& str, const etl::string_view& value, const etl::format_segment& segment)
+    {
+      format_text(str, value.data(), value.size(), segment);
+    }
+
+    //*************************************************************************
+    /// For pointers. Formatted as hex.
+    //*************************************************************************
+    template <typename T>
+    void format_value(etl::istring& str, T* const& value, const etl::format_segment& segment)
+    {
+      etl::format_spec spec = make_spec(segment, false);
+
+      if (segment.type == 0)
+      {
+        spec.hex().upper_case(false);
+      }
+
+      etl::to_string(reinterpret_cast<uintptr_t>(value), str, spec, true);
+    }
+
+    //*************************************************************************
+    /// A type erased reference to an argument.
+    //*************************************************************************
+    struct argument
+    {
+      typedef void (*format_t)(etl::istring&, const void*, const etl::format_segment&);
+
+      argument()
+        : pvalue(nullptr),
+          format(nullptr)
+      {
+      }
+
+      argument(const void* pvalue_, format_t format_)
+        : pvalue(pvalue_),
+          format(format_)
+      {
+      }
+
+      const void* pvalue;
+      format_t    format;
+    };
+
+    //*************************************************************************
+    /// Formats an argument of type T.
+    //*************************************************************************
+    template <typename T>
+    void format_erased(etl::istring& str, const void* pvalue, const etl::format_segment& segment)
+    {
+      format_value(str, *static_cast<const T*>(pvalue), segment);
+    }
+
+    //*************************************************************************
+    /// Makes the type erased argument.
+    //*************************************************************************
+    template <typename T>
+    argument make_argument(const T& value)
+    {
+      return argument(&value, &format_erased<T>);
+    }
+
+    //*************************************************************************
+    /// Appends a segment.
+    //*************************************************************************
+    inline void write_segment(etl::istring& str,
+                              const char* text,
+                              const etl::format_segment& segment,
+                              const argument* arguments,
+                              size_t number_of_arguments)
+    {
+      str.append(text + segment.text_begin, segment.text_length);
+
+      if (segment.has_argument)
+      {
+        if (segment.index < number_of_arguments)
+        {
+          const argument& arg = arguments[segment.index];
+          arg.format(str, arg.pvalue, segment);
+        }
+        else
+        {
+          ETL_ALWAYS_ASSERT(ETL_ERROR(format_argument));
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// A format string that is split into segments when it is constructed.
+  /// When declared constexpr (C++14) the parsing is done by the compiler.
+  ///\tparam MAX_SEGMENTS The maximum number of segments. Each replacement
+  /// field and each escaped brace ends a segment.
+  ///\ingroup format
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS>
+  class format_string
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit format_string(const char* text_)
+      : text(text_),
+        number_of_segments(0U),
+        valid(true),
+        segments()
+    {
+      private_format::parser parser(text_);
+      etl::format_segment segment;
+
+      while (parser.next(segment))
+      {
+        if (number_of_segments == MAX_SEGMENTS)
+        {
+          valid = false;
+          break;
+        }
+
+        segments[number_of_segments++] = segment;
+      }
+
+      valid = valid && parser.is_valid();
+    }
+
+    //*************************************************************************
+    /// Returns the format text.
+    //*************************************************************************
+    ETL_CONSTEXPR const char* c_str() const
+    {
+      return text;
+    }
+
+    //*************************************************************************
+    /// Returns the number of segments.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return number_of_segments;
+    }
+
+    //*************************************************************************
+    /// Returns true if the format text was valid.
+    //*************************************************************************
+    ETL_CONSTEXPR bool is_valid() const
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    /// Returns a segment.
+    //*************************************************************************
+    ETL_CONSTEXPR const etl::format_segment& operator [](size_t i) const
+    {
+      return segments[i];
+    }
+
+  private:
+
+    const char*         text;
+    size_t              number_of_segments;
+    bool                valid;
+    etl::format_segment segments[MAX_SEGMENTS];
+  };
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Appends the formatted arguments to the string, using a pre-parsed format.
+  ///\ingroup format
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS, typename... TArgs>
+  etl::istring& format_to(etl::istring& str, const etl::format_string<MAX_SEGMENTS>& format, const TArgs&... args)
+  {
+    const private_format::argument arguments[] = { private_format::make_argument(args)..., private_format::argument() };
+
+    if (format.is_valid())
+    {
+      for (size_t i = 0U; i < format.size(); ++i)
+      {
+        private_format::write_segment(str, format.c_str(), format[i], arguments, sizeof...(TArgs));
+      }
+    }
+    else
+    {
+      ETL_ALWAYS_ASSERT(ETL_ERROR(format_invalid));
+    }
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to the string.
+  /// The format is parsed as it is written.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  etl::istring& format_to(etl::istring& str, const char* format, const TArgs&... args)
+  {
+    const private_format::argument arguments[] = { private_format::make_argument(args)..., private_format::argument() };
+
+    private_format::parser parser(format);
+    etl::format_segment    segment;
+
+    while (parser.next(segment))
+    {
+      private_format::write_segment(str, format, segment, arguments, sizeof...(TArgs));
+    }
+
+    if (!parser.is_valid())
+    {
+      ETL_ALWAYS_ASSERT(ETL_ERROR(format_invalid));
+    }
+
+    return str;
+  }
+#endif
+}
+
+#undef ETL_FILE
+
+#endif
@@ -1355,6 +1355,9 @@ namespace etl
 
       while (i_item != end())
       {
+        // Fetch the next node while the predicate is called.
+        ETL_PREFETCH(i_item.p_node->next);
+
         if (predicate(*i_item))
         {
           i_item = erase_after(i_last_item);
@@ -1432,6 +1435,7 @@ namespace etl
           while (p_first != nullptr)
           {
             p_next = p_first->next;                                 // Remember the next node.
+            ETL_PREFETCH(p_next);                                   // Fetch it while this one is destroyed.
             destroy_data_node(static_cast<data_node_t&>(*p_first)); // Destroy the pool object.
             p_first = p_next;                                       // Move to the next node.
           }
@@ -28,6 +28,7 @@ SOFTWARE.
 #define ETL_FRAME_CHECK_SEQUENCE_INCLUDED
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "platform.h"
 #include "static_assert.h"
@@ -43,6 +44,19 @@ ETL_STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support target
 
 namespace etl
 {
+  //***************************************************************************
+  /// Policies that derive from this tag supply an 'add_block' member that
+  /// processes a whole range in one call.
+  /// template <typename TIterator>
+  /// value_type add_block(value_type fcs, TIterator begin, const TIterator end) const;
+  /// Contiguous ranges are passed as 'const uint8_t*', so a policy may also
+  /// supply a non-template pointer overload that reads a word at a time.
+  ///\ingroup frame_check_sequence
+  //***************************************************************************
+  struct frame_check_sequence_block_tag
+  {
+  };
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
   ///\tparam TPolicy The type used to enact the policy.
@@ -98,10 +112,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin++);
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_base_of<etl::frame_check_sequence_block_tag, policy_type>::value>());
     }
 
     //*************************************************************************
@@ -128,11 +139,141 @@ namespace etl
       return policy.final(frame_check);
     }
 
+    //*************************************************************************
+    /// Calculates the FCS of several independent buffers.
+    /// Four buffers are processed together, interleaved byte by byte, so that
+    /// their calculations overlap rather than waiting on each other.
+    /// \param buffers Pointers to the start of each buffer.
+    /// \param lengths The length of each buffer.
+    /// \param results Receives the FCS of each buffer.
+    /// \param count   The number of buffers.
+    //*************************************************************************
+    static void add_multi(const uint8_t* const buffers[], const size_t lengths[], value_type results[], size_t count)
+    {
+      const policy_type policy = policy_type();
+
+      size_t i = 0U;
+
+      for (; (count - i) >= MULTI_LANES; i += MULTI_LANES)
+      {
+        const uint8_t* p0 = buffers[i];
+        const uint8_t* p1 = buffers[i + 1U];
+        const uint8_t* p2 = buffers[i + 2U];
+        const uint8_t* p3 = buffers[i + 3U];
+
+        value_type fcs0 = policy.initial();
+        value_type fcs1 = fcs0;
+        value_type fcs2 = fcs0;
+        value_type fcs3 = fcs0;
+
+        size_t common = lengths[i];
+        common = (lengths[i + 1U] < common) ? lengths[i + 1U] : common;
+        common = (lengths[i + 2U] < common) ? lengths[i + 2U] : common;
+        common = (lengths[i + 3U] < common) ? lengths[i + 3U] : common;
+
+        for (size_t j = 0U; j < common; ++j)
+        {
+          fcs0 = policy.add(fcs0, p0[j]);
+          fcs1 = policy.add(fcs1, p1[j]);
+          fcs2 = policy.add(fcs2, p2[j]);
+          fcs3 = policy.add(fcs3, p3[j]);
+        }
+
+        // The remainder of the longer buffers.
+        results[i]      = finish_multi(policy, fcs0, p0 + common, p0 + lengths[i]);
+        results[i + 1U] = finish_multi(policy, fcs1, p1 + common, p1 + lengths[i + 1U]);
+        results[i + 2U] = finish_multi(policy, fcs2, p2 + common, p2 + lengths[i + 2U]);
+        results[i + 3U] = finish_multi(policy, fcs3, p3 + common, p3 + lengths[i + 3U]);
+      }
+
+      for (; i < count; ++i)
+      {
+        results[i] = finish_multi(policy, policy.initial(), buffers[i], buffers[i] + lengths[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Calculates the FCS of N independent buffers.
+    //*************************************************************************
+    template <size_t N>
+    static void add_multi(const uint8_t* const (&buffers)[N], const size_t (&lengths)[N], value_type (&results)[N])
+    {
+      add_multi(buffers, lengths, results, N);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Gets the policy, allowing derived classes to configure it.
+    //*************************************************************************
+    policy_type& get_policy()
+    {
+      return policy;
+    }
+
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range using the policy's block function.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      add_block(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Passes a non-contiguous range to the policy's block function.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_block(TIterator begin, const TIterator end, etl::false_type)
+    {
+      frame_check = policy.add_block(frame_check, begin, end);
+    }
+
+    //*************************************************************************
+    /// Passes a contiguous range to the policy's block function as uint8_t pointers,
+    /// allowing the policy to select a word-at-a-time implementation.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_block(TPointer begin, const TPointer end, etl::true_type)
+    {
+      frame_check = policy.add_block(frame_check, reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+    }
+
+    //*************************************************************************
+    /// Adds the rest of a buffer for add_multi, and returns the final value.
+    //*************************************************************************
+    static value_type finish_multi(const policy_type& policy, value_type fcs, const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        fcs = policy.add(fcs, *begin++);
+      }
+
+      return policy.final(fcs);
+    }
+
+    static const size_t MULTI_LANES = 4U;
+
     value_type  frame_check;
     policy_type policy;
   };
+
+  template <typename TPolicy>
+  const size_t frame_check_sequence<TPolicy>::MULTI_LANES;
 }
 
 #endif
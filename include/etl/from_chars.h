@@ -0,0 +1,515 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROM_CHARS_INCLUDED
+#define ETL_FROM_CHARS_INCLUDED
+
+///\ingroup string
+
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "limits.h"
+#include "enum_type.h"
+#include "string_view.h"
+#include "format_spec.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a from_chars conversion.
+  ///\ingroup string
+  //***************************************************************************
+  struct from_chars_status
+  {
+    enum enum_type
+    {
+      valid,
+      invalid_argument,
+      result_out_of_range
+    };
+
+    ETL_DECLARE_ENUM_TYPE(from_chars_status, int)
+    ETL_ENUM_TYPE(valid,               "valid")
+    ETL_ENUM_TYPE(invalid_argument,    "invalid_argument")
+    ETL_ENUM_TYPE(result_out_of_range, "result_out_of_range")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a from_chars conversion.
+  /// 'ptr' points to the first character not used by the conversion.
+  /// If the status is not 'valid' the value is left unchanged.
+  ///\ingroup string
+  //***************************************************************************
+  struct from_chars_result
+  {
+    const char*            ptr;
+    etl::from_chars_status status;
+  };
+
+  namespace private_from_chars
+  {
+    //*************************************************************************
+    /// Returns the value of a digit in any base up to 36, or 36 if the
+    /// character is not a digit.
+    //*************************************************************************
+    inline uint32_t digit_value(char c)
+    {
+      if ((c >= '0') && (c <= '9'))
+      {
+        return uint32_t(c - '0');
+      }
+      else if ((c >= 'a') && (c <= 'z'))
+      {
+        return uint32_t(c - 'a') + 10U;
+      }
+      else if ((c >= 'A') && (c <= 'Z'))
+      {
+        return uint32_t(c - 'A') + 10U;
+      }
+
+      return 36U;
+    }
+
+    //*************************************************************************
+    /// Loads 8 characters, the first in the lowest byte.
+    //*************************************************************************
+    inline uint64_t load_8(const char* p)
+    {
+      uint64_t chunk = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        chunk = (chunk << 8U) | uint8_t(p[i]);
+      }
+
+      return chunk;
+    }
+
+    //*************************************************************************
+    /// Returns true if all 8 characters in the chunk are decimal digits.
+    //*************************************************************************
+    inline bool is_8_digits(uint64_t chunk)
+    {
+      return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+               (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) == 0x3333333333333333ULL);
+    }
+
+    //*************************************************************************
+    /// Converts 8 decimal digits to their value, using SWAR arithmetic.
+    //*************************************************************************
+    inline uint32_t parse_8_digits(uint64_t chunk)
+    {
+      const uint64_t MASK = 0x000000FF000000FFULL;
+      const uint64_t MUL1 = 100U + (1000000ULL << 32U);
+      const uint64_t MUL2 = 1U + (10000ULL << 32U);
+
+      chunk -= 0x3030303030303030ULL;
+      chunk  = (chunk * 10U) + (chunk >> 8U); // Pairs of digits.
+      chunk  = (((chunk & MASK) * MUL1) + (((chunk >> 16U) & MASK) * MUL2)) >> 32U;
+
+      return uint32_t(chunk);
+    }
+
+    //*************************************************************************
+    /// Parses an unsigned magnitude up to 'limit'.
+    /// Returns a pointer past the last digit. 'digits' is false if none were found.
+    //*************************************************************************
+    template <typename TValue>
+    const char* parse_magnitude(const char* first, const char* last, uint32_t base, TValue limit,
+                                TValue& magnitude, bool& digits, bool& overflow)
+    {
+      const char* p = first;
+
+      magnitude = 0U;
+      overflow  = false;
+
+      if (base == 10U)
+      {
+        // Eight digits at a time, while the result cannot overflow.
+        while (((last - p) >= 8) && is_8_digits(load_8(p)))
+        {
+          const uint32_t chunk = parse_8_digits(load_8(p));
+
+          if ((chunk > limit) || (magnitude > ((limit - chunk) / 100000000U)))
+          {
+            break;
+          }
+
+          magnitude = (magnitude * 100000000U) + chunk;
+          p += 8;
+        }
+      }
+
+      while (p != last)
+      {
+        const uint32_t digit = digit_value(*p);
+
+        if (digit >= base)
+        {
+          break;
+        }
+
+        if (!overflow)
+        {
+          if (magnitude > ((limit - digit) / base))
+          {
+            overflow = true;
+          }
+          else
+          {
+            magnitude = (magnitude * base) + digit;
+          }
+        }
+
+        ++p;
+      }
+
+      digits = (p != first);
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// For integral types.
+    //*************************************************************************
+    template <typename T>
+    etl::from_chars_result from_chars_integral(const char* first, const char* last, T& value, uint32_t base)
+    {
+      typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type magnitude_t;
+
+      etl::from_chars_result result = { first, etl::from_chars_status::invalid_argument };
+
+      if ((base < 2U) || (base > 36U))
+      {
+        return result;
+      }
+
+      const char* p = first;
+
+      bool negative = false;
+
+      if (etl::is_signed<T>::value && (p != last) && (*p == '-'))
+      {
+        negative = true;
+        ++p;
+      }
+
+      // The largest magnitude that is representable.
+      const magnitude_t limit = negative ? magnitude_t(magnitude_t(etl::integral_limits<T>::max) + 1U)
+                                         : magnitude_t(etl::integral_limits<T>::max);
+
+      magnitude_t magnitude;
+      bool        digits;
+      bool        overflow;
+
+      p = parse_magnitude(p, last, base, limit, magnitude, digits, overflow);
+
+      if (digits)
+      {
+        result.ptr = p;
+
+        if (overflow)
+        {
+          result.status = etl::from_chars_status::result_out_of_range;
+        }
+        else
+        {
+          value = negative ? T(magnitude_t(0U) - magnitude) : T(magnitude);
+          result.status = etl::from_chars_status::valid;
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Returns true if the characters at p match the lower case text.
+    //*************************************************************************
+    inline bool match_text(const char* p, const char* last, const char* text)
+    {
+      while (*text != 0)
+      {
+        if ((p == last) || ((*p | 0x20) != *text))
+        {
+          return false;
+        }
+
+        ++p;
+        ++text;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Scales a value by 10^exponent.
+    //*************************************************************************
+    inline double scale_pow10(double value, int exponent)
+    {
+      static const double powers[] =
+      {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+      };
+
+      if (exponent < 0)
+      {
+        int n = -exponent;
+
+        while ((n > 22) && (value != 0.0))
+        {
+          value /= 1e22;
+          n     -= 22;
+        }
+
+        return (n > 22) ? value : value / powers[n];
+      }
+      else
+      {
+        int n = exponent;
+
+        while ((n > 22) && !isinf(value))
+        {
+          value *= 1e22;
+          n     -= 22;
+        }
+
+        return (n > 22) ? value : value * powers[n];
+      }
+    }
+
+    //*************************************************************************
+    /// For floating point types.
+    /// Accepts an optional '-', decimal digits with an optional '.', an
+    /// optional exponent, "inf", "infinity" and "nan".
+    /// The conversion is exact when there are no more than 15 significant
+    /// digits and the decimal exponent is in the range -22 to 22.
+    /// Otherwise it is within a few units in the last place.
+    //*************************************************************************
+    template <typename T>
+    etl::from_chars_result from_chars_floating_point(const char* first, const char* last, T& value)
+    {
+      etl::from_chars_result result = { first, etl::from_chars_status::invalid_argument };
+
+      const char* p = first;
+
+      bool negative = false;
+
+      if ((p != last) && (*p == '-'))
+      {
+        negative = true;
+        ++p;
+      }
+
+      // inf, infinity and nan.
+      if (match_text(p, last, "inf"))
+      {
+        p += match_text(p, last, "infinity") ? 8 : 3;
+
+        value         = negative ? -etl::numeric_limits<T>::infinity() : etl::numeric_limits<T>::infinity();
+        result.ptr    = p;
+        result.status = etl::from_chars_status::valid;
+
+        return result;
+      }
+
+      if (match_text(p, last, "nan"))
+      {
+        value         = etl::numeric_limits<T>::quiet_NaN();
+        result.ptr    = p + 3;
+        result.status = etl::from_chars_status::valid;
+
+        return result;
+      }
+
+      // The significant digits, up to 19 of them.
+      uint64_t significand      = 0U;
+      int      significant      = 0;
+      int      decimal_exponent = 0;
+      bool     digits           = false;
+
+      while ((p != last) && (*p >= '0') && (*p <= '9'))
+      {
+        digits = true;
+
+        if (significant < 19)
+        {
+          significand = (significand * 10U) + uint32_t(*p - '0');
+          significant += (significand != 0U) ? 1 : 0;
+        }
+        else
+        {
+          ++decimal_exponent;
+        }
+
+        ++p;
+      }
+
+      if ((p != last) && (*p == '.'))
+      {
+        ++p;
+
+        while ((p != last) && (*p >= '0') && (*p <= '9'))
+        {
+          digits = true;
+
+          if (significant < 19)
+          {
+            significand = (significand * 10U) + uint32_t(*p - '0');
+            significant += (significand != 0U) ? 1 : 0;
+            --decimal_exponent;
+          }
+
+          ++p;
+        }
+      }
+
+      if (!digits)
+      {
+        return result;
+      }
+
+      // The exponent. Only used if it is followed by at least one digit.
+      if ((p != last) && ((*p == 'e') || (*p == 'E')))
+      {
+        const char* pe = p + 1;
+
+        bool negative_exponent = false;
+
+        if ((pe != last) && ((*pe == '-') || (*pe == '+')))
+        {
+          negative_exponent = (*pe == '-');
+          ++pe;
+        }
+
+        if ((pe != last) && (*pe >= '0') && (*pe <= '9'))
+        {
+          int exponent = 0;
+
+          while ((pe != last) && (*pe >= '0') && (*pe <= '9'))
+          {
+            if (exponent < 100000)
+            {
+              exponent = (exponent * 10) + (*pe - '0');
+            }
+
+            ++pe;
+          }
+
+          decimal_exponent += negative_exponent ? -exponent : exponent;
+          p = pe;
+        }
+      }
+
+      result.ptr = p;
+
+      const double d = (significand == 0U) ? 0.0 : scale_pow10(double(significand), decimal_exponent);
+
+      // Out of range if the value overflowed or underflowed to zero.
+      if (isinf(d) || (etl::numeric_limits<T>::max() < d) || ((significand != 0U) && (T(d) == T(0))))
+      {
+        result.status = etl::from_chars_status::result_out_of_range;
+      }
+      else
+      {
+        value         = negative ? -T(d) : T(d);
+        result.status = etl::from_chars_status::valid;
+      }
+
+      return result;
+    }
+  }
+
+  //***************************************************************************
+  /// Converts the characters in [first, last) to an integral value.
+  ///\param base The base, from 2 to 36.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result>::type
+    from_chars(const char* first, const char* last, T& value, uint32_t base = 10U)
+  {
+    return private_from_chars::from_chars_integral(first, last, value, base);
+  }
+
+  //***************************************************************************
+  /// Converts the characters in [first, last) to a floating point value.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result>::type
+    from_chars(const char* first, const char* last, T& value)
+  {
+    return private_from_chars::from_chars_floating_point(first, last, value);
+  }
+
+  //***************************************************************************
+  /// Converts the characters in the view to an integral value.
+  ///\param base The base, from 2 to 36.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result>::type
+    from_chars(const etl::string_view& view, T& value, uint32_t base = 10U)
+  {
+    return private_from_chars::from_chars_integral(view.data(), view.data() + view.size(), value, base);
+  }
+
+  //***************************************************************************
+  /// Converts the characters in the view to an integral value.
+  /// The base is taken from the format spec.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result>::type
+    from_chars(const etl::string_view& view, T& value, const etl::format_spec& format)
+  {
+    return private_from_chars::from_chars_integral(view.data(), view.data() + view.size(), value, format.get_base());
+  }
+
+  //***************************************************************************
+  /// Converts the characters in the view to a floating point value.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result>::type
+    from_chars(const etl::string_view& view, T& value)
+  {
+    return private_from_chars::from_chars_floating_point(view.data(), view.data() + view.size(), value);
+  }
+}
+
+#endif
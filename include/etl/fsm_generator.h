@@ -74,6 +74,12 @@ cog.outl("//********************************************************************
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "queue.h"
+#include "private/queued_message.h"
+
+#if defined(ETL_FSM_TRACE)
+  #include "fsm_trace.h"
+#endif
 
 #undef ETL_FILE
 #define ETL_FILE "34"
@@ -83,6 +89,7 @@ cog.outl("//********************************************************************
 namespace etl
 {
   class fsm;
+  class ifsm_deferred_queue;
 
   /// Allow alternative type for state id.
 #if !defined(ETL_FSM_STATE_ID_TYPE)
@@ -164,6 +171,31 @@ namespace etl
       return state_id;
     }
 
+    //*******************************************
+    /// Sets the parent state.
+    /// Events that this state does not handle are passed to the parent.
+    //*******************************************
+    void set_parent(etl::ifsm_state& parent)
+    {
+      p_parent = &parent;
+    }
+
+    //*******************************************
+    /// Does this state have a parent?
+    //*******************************************
+    bool has_parent() const
+    {
+      return p_parent != nullptr;
+    }
+
+    //*******************************************
+    /// Gets the parent state.
+    //*******************************************
+    etl::ifsm_state& get_parent() const
+    {
+      return *p_parent;
+    }
+
   protected:
 
     //*******************************************
@@ -171,7 +203,8 @@ namespace etl
     //*******************************************
     ifsm_state(etl::fsm_state_id_t state_id_)
       : state_id(state_id_),
-        p_context(nullptr)
+        p_context(nullptr),
+        p_parent(nullptr)
     {
     }
 
@@ -188,6 +221,23 @@ namespace etl
       return *p_context;
     }
 
+    //*******************************************
+    /// Passes an unhandled event to the parent state.
+    /// If the parent returns its own id then the FSM stays in this state.
+    //*******************************************
+    etl::fsm_state_id_t process_event_in_parent(etl::imessage_router& source, const etl::imessage& message)
+    {
+      etl::fsm_state_id_t new_state_id = p_parent->process_event(source, message);
+
+      return (new_state_id == p_parent->get_state_id()) ? state_id : new_state_id;
+    }
+
+    //*******************************************
+    /// Passes on the result of on_event_unknown.
+    /// Counts the event if router statistics are enabled.
+    //*******************************************
+    etl::fsm_state_id_t count_unknown_event(const etl::imessage& message, etl::fsm_state_id_t new_state_id) const;
+
   private:
 
     virtual fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message) = 0;
@@ -207,16 +257,76 @@ namespace etl
     // A pointer to the FSM context.
     etl::fsm* p_context;
 
+    // A pointer to the parent state.
+    etl::ifsm_state* p_parent;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
   };
 
+  //***************************************************************************
+  /// Interface class for the queue of deferred FSM events.
+  //***************************************************************************
+  class ifsm_deferred_queue
+  {
+  public:
+
+    /// Allows ifsm_deferred_queue functions to be private.
+    friend class etl::fsm;
+
+    //*******************************************
+    /// Gets the number of deferred events.
+    //*******************************************
+    virtual size_t size() const = 0;
+
+    //*******************************************
+    /// Gets the maximum number of deferred events.
+    //*******************************************
+    virtual size_t max_size() const = 0;
+
+    //*******************************************
+    /// Checks if there are no deferred events.
+    //*******************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*******************************************
+    /// Discards the deferred events.
+    //*******************************************
+    virtual void clear() = 0;
+
+  protected:
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~ifsm_deferred_queue()
+    {
+    }
+
+    //*******************************************
+    /// Passes a deferred event back to the FSM.
+    /// Returns true if the state changed.
+    //*******************************************
+    static bool dispatch(etl::fsm& context, etl::imessage_router& source, const etl::imessage& message);
+
+  private:
+
+    virtual bool push(etl::imessage_router& source, const etl::imessage& message) = 0;
+    virtual bool dispatch_front(etl::fsm& context) = 0;
+  };
+
   //***************************************************************************
   /// The FSM class.
   //***************************************************************************
   class fsm : public etl::imessage_router
   {
+    /// Allows deferred events to be passed back.
+    friend class etl::ifsm_deferred_queue;
+
   public:
 
     //*******************************************
@@ -224,7 +334,12 @@ namespace etl
     //*******************************************
     fsm(etl::message_router_id_t id)
       : imessage_router(id),
-        p_state(nullptr)
+        p_state(nullptr),
+        p_deferred_queue(nullptr),
+        replaying_deferred(false)
+#if defined(ETL_FSM_TRACE)
+        , p_trace(nullptr)
+#endif
     {
     }
 
@@ -246,6 +361,44 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Sets the queue for deferred events.
+    //*******************************************
+    void set_deferred_queue(etl::ifsm_deferred_queue& deferred_queue)
+    {
+      p_deferred_queue = &deferred_queue;
+    }
+
+#if defined(ETL_FSM_TRACE)
+    //*******************************************
+    /// Sets the trace that records state transitions.
+    //*******************************************
+    void set_trace(etl::ifsm_trace& trace)
+    {
+      p_trace = &trace;
+    }
+
+    //*******************************************
+    /// Stops recording state transitions.
+    //*******************************************
+    void clear_trace()
+    {
+      p_trace = nullptr;
+    }
+#endif
+
+    //*******************************************
+    /// Defers an event until the FSM next changes state.
+    /// Called by a state's event handler.
+    /// The event is copied, and is passed to the new state after the state change.
+    /// An event that is still unwanted may be deferred again.
+    /// Returns false if there is no deferred queue or it is full.
+    //*******************************************
+    bool defer(etl::imessage_router& source, const etl::imessage& message)
+    {
+      return (p_deferred_queue != nullptr) && p_deferred_queue->push(source, message);
+    }
+
     //*******************************************
     /// Starts the FSM.
     /// Can only be called once.
@@ -301,26 +454,34 @@ namespace etl
     //*******************************************
     void receive(etl::imessage_router& source, const etl::imessage& message)
     {
-        etl::fsm_state_id_t next_state_id = p_state->process_event(source, message);
-        ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+      ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(message.message_id)
+      ETL_MESSAGE_TRACE_POINT(message, Dispatch)
 
-        etl::ifsm_state* p_next_state = state_list[next_state_id];
+      if (process_message(source, message))
+      {
+        replay_deferred();
+      }
+    }
 
-        // Have we changed state?
-        if (p_next_state != p_state)
-        {
-          do
-          {
-            p_state->on_exit_state();
-            p_state = p_next_state;
+    using imessage_router::receive_batch;
 
-            next_state_id = p_state->on_enter_state();
-            ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    //*******************************************
+    void receive_batch(etl::imessage_router& source, const etl::message_batch& batch)
+    {
+      for (size_t i = 0U; i < batch.size(); ++i)
+      {
+        const etl::imessage& message = batch[i];
 
-            p_next_state = state_list[next_state_id];
+        ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(message.message_id)
+        ETL_MESSAGE_TRACE_POINT(message, Dispatch)
 
-          } while (p_next_state != p_state); // Have we changed state again?
+        if (process_message(source, message))
+        {
+          replay_deferred();
         }
+      }
     }
 
     using imessage_router::accepts;
@@ -381,6 +542,11 @@ namespace etl
       }
 
       p_state = nullptr;
+
+      if (p_deferred_queue != nullptr)
+      {
+        p_deferred_queue->clear();
+      }
     }
 
     //********************************************
@@ -391,11 +557,243 @@ namespace etl
 
   private:
 
-    etl::ifsm_state*    p_state;          ///< A pointer to the current state.
-    etl::ifsm_state**   state_list;       ///< The list of added states.
-    etl::fsm_state_id_t number_of_states; ///< The number of states.
+    //*******************************************
+    /// Passes the message to the current state.
+    /// Returns true if the state changed.
+    //*******************************************
+    bool process_message(etl::imessage_router& source, const etl::imessage& message)
+    {
+#if defined(ETL_FSM_TRACE)
+      const etl::fsm_trace_timestamp_t start = (p_trace != nullptr) ? p_trace->timestamp() : 0;
+      const etl::fsm_state_id_t        state_from = p_state->get_state_id();
+#endif
+
+      etl::fsm_state_id_t next_state_id = p_state->process_event(source, message);
+      ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+
+      etl::ifsm_state* p_next_state = state_list[next_state_id];
+
+      // Have we changed state?
+      if (p_next_state != p_state)
+      {
+        do
+        {
+          p_state->on_exit_state();
+          p_state = p_next_state;
+
+          next_state_id = p_state->on_enter_state();
+          ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+
+          p_next_state = state_list[next_state_id];
+
+        } while (p_next_state != p_state); // Have we changed state again?
+
+#if defined(ETL_FSM_TRACE)
+        if (p_trace != nullptr)
+        {
+          p_trace->record(state_from, p_state->get_state_id(), message.message_id, start);
+        }
+#endif
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Passes each deferred event to the new state, oldest first.
+    /// Repeats while the deferred events cause further state changes.
+    //*******************************************
+    void replay_deferred()
+    {
+      if ((p_deferred_queue != nullptr) && !replaying_deferred)
+      {
+        replaying_deferred = true;
+
+        bool state_changed;
+
+        do
+        {
+          state_changed = false;
+
+          size_t count = p_deferred_queue->size();
+
+          while (count-- != 0U)
+          {
+            state_changed = p_deferred_queue->dispatch_front(*this) || state_changed;
+          }
+        } while (state_changed && !p_deferred_queue->empty());
+
+        replaying_deferred = false;
+      }
+    }
+
+    etl::ifsm_state*          p_state;            ///< A pointer to the current state.
+    etl::ifsm_state**         state_list;         ///< The list of added states.
+    etl::fsm_state_id_t       number_of_states;   ///< The number of states.
+    etl::ifsm_deferred_queue* p_deferred_queue;   ///< The queue of deferred events, if any.
+    bool                      replaying_deferred; ///< Set while deferred events are being passed back.
+#if defined(ETL_FSM_TRACE)
+    etl::ifsm_trace*          p_trace;            ///< The trace of state transitions, if any.
+#endif
   };
 
+  //***************************************************************************
+  inline bool ifsm_deferred_queue::dispatch(etl::fsm& context, etl::imessage_router& source, const etl::imessage& message)
+  {
+    return context.process_message(source, message);
+  }
+
+  //***************************************************************************
+  inline etl::fsm_state_id_t ifsm_state::count_unknown_event(const etl::imessage& message, etl::fsm_state_id_t new_state_id) const
+  {
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+    etl::imessage_router_statistics* p_statistics = p_context->get_statistics();
+
+    if (p_statistics != nullptr)
+    {
+      p_statistics->record_unknown(message.message_id);
+    }
+#else
+    (void)message;
+#endif
+
+    return new_state_id;
+  }
+
+  //***************************************************************************
+  /// A queue for deferred FSM events.
+  ///\tparam TPacket A message packet type that can hold every deferred event,
+  ///                such as the message_packet of a message router.
+  ///\tparam SIZE    The maximum number of deferred events.
+  //***************************************************************************
+  template <typename TPacket, const size_t SIZE>
+  class fsm_deferred_queue : public etl::ifsm_deferred_queue
+  {
+  public:
+
+    //*******************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    size_t max_size() const
+    {
+      return SIZE;
+    }
+
+    //*******************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+  private:
+
+    typedef etl::private_message::queued_message<TPacket> item_type;
+
+    //*******************************************
+    bool push(etl::imessage_router& source, const etl::imessage& message)
+    {
+      if (queue.full())
+      {
+        return false;
+      }
+
+      queue.push(item_type(source.is_null_router() ? nullptr : &source, message));
+
+      return true;
+    }
+
+    //*******************************************
+    bool dispatch_front(etl::fsm& context)
+    {
+      // Copied out, so that the event may be deferred again.
+      item_type item(queue.front());
+      queue.pop();
+
+      return dispatch(context, item.sender(), item.get());
+    }
+
+    etl::queue<item_type, SIZE> queue;
+  };
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_STATE_FORCE_CPP03)
+  //***************************************************************************
+  /// The definition for any number of message types.
+  /// Only the types given are instantiated.
+  //***************************************************************************
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_state : public ifsm_state
+  {
+  public:
+
+    enum
+    {
+      STATE_ID = STATE_ID_
+    };
+
+    fsm_state()
+      : ifsm_state(STATE_ID)
+    {
+    }
+
+  protected:
+
+    ~fsm_state()
+    {
+    }
+
+    inline TContext& get_fsm_context() const
+    {
+      return static_cast<TContext&>(ifsm_state::get_fsm_context());
+    }
+
+  private:
+
+    //*******************************************
+    /// Calls on_event for the message type with the event's id.
+    //*******************************************
+    template <typename... TTypes>
+    struct event_dispatcher
+    {
+      static bool dispatch(TDerived&, etl::imessage_router&, const etl::imessage&, etl::fsm_state_id_t&)
+      {
+        return false;
+      }
+    };
+
+    template <typename T1, typename... TRest>
+    struct event_dispatcher<T1, TRest...>
+    {
+      static bool dispatch(TDerived& state, etl::imessage_router& source, const etl::imessage& message, etl::fsm_state_id_t& new_state_id)
+      {
+        if (message.message_id == T1::ID)
+        {
+          new_state_id = state.on_event(source, static_cast<const T1&>(message));
+          return true;
+        }
+
+        return event_dispatcher<TRest...>::dispatch(state, source, message, new_state_id);
+      }
+    };
+
+    etl::fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message)
+    {
+      etl::fsm_state_id_t new_state_id;
+
+      if (!event_dispatcher<TMessageTypes...>::dispatch(*static_cast<TDerived*>(this), source, message, new_state_id))
+      {
+        new_state_id = has_parent() ? process_event_in_parent(source, message) : count_unknown_event(message, static_cast<TDerived*>(this)->on_event_unknown(source, message));
+      }
+
+      return new_state_id;
+    }
+  };
+#else
   /*[[[cog
   import cog
   ################################################
@@ -451,7 +849,7 @@ namespace etl
       cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(source, static_cast<const T%d&>(message));" % n)
       cog.outl(" break;")
   cog.out("      default:")
-  cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event_unknown(source, message);")
+  cog.out(" new_state_id = has_parent() ? process_event_in_parent(source, message) : count_unknown_event(message, static_cast<TDerived*>(this)->on_event_unknown(source, message));")
   cog.outl(" break;")
   cog.outl("    }")
   cog.outl("")
@@ -528,7 +926,7 @@ namespace etl
           cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(source, static_cast<const T%d&>(message));" % n)
           cog.outl(" break;")
       cog.out("      default:")
-      cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event_unknown(source, message);")
+      cog.out(" new_state_id = has_parent() ? process_event_in_parent(source, message) : count_unknown_event(message, static_cast<TDerived*>(this)->on_event_unknown(source, message));")
       cog.outl(" break;")
       cog.outl("    }")
       cog.outl("")
@@ -577,11 +975,12 @@ namespace etl
   cog.outl("")
   cog.outl("  etl::fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message)")
   cog.outl("  {")
-  cog.outl("    return static_cast<TDerived*>(this)->on_event_unknown(source, message);")
+  cog.outl("    return has_parent() ? process_event_in_parent(source, message) : count_unknown_event(message, static_cast<TDerived*>(this)->on_event_unknown(source, message));")
   cog.outl("  }")
   cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
@@ -0,0 +1,275 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_TRACE_INCLUDED
+#define ETL_FSM_TRACE_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+#include "algorithm.h"
+
+#include "private/minmax_push.h"
+
+///\defgroup fsm_trace fsm_trace
+/// A record of the state transitions of etl::fsm and etl::state_chart.
+/// Tracing is only compiled in when ETL_FSM_TRACE is defined.
+/// Without it, the state machines have no trace members and no trace calls.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  /// Allow alternative type for trace timestamps, such as a 64 bit cycle count.
+#if !defined(ETL_FSM_TRACE_TIMESTAMP_TYPE)
+    typedef uint32_t fsm_trace_timestamp_t;
+#else
+    typedef ETL_FSM_TRACE_TIMESTAMP_TYPE fsm_trace_timestamp_t;
+#endif
+
+  //***************************************************************************
+  /// A traced state transition.
+  ///\ingroup fsm_trace
+  //***************************************************************************
+  struct fsm_trace_record
+  {
+    int                        state_from; ///< The state before the event.
+    int                        state_to;   ///< The state after the event.
+    int                        message_id; ///< The message or event id.
+    etl::fsm_trace_timestamp_t timestamp;  ///< The time that the event was received.
+    etl::fsm_trace_timestamp_t duration;   ///< The time from receiving the event to entering the new state.
+  };
+
+  //***************************************************************************
+  /// Interface for the transition trace.
+  /// A ring buffer that overwrites the oldest records when it is full.
+  /// The buffer has one more slot than the capacity, so that the slot being
+  /// written never holds a record that a reader may be copying.
+  /// Records are written by the thread that runs the state machines and may be
+  /// copied out by any thread without locking.
+  /// Several state machines may share a trace if they run on the same thread.
+  ///\ingroup fsm_trace
+  //***************************************************************************
+  class ifsm_trace
+  {
+  public:
+
+    /// The user supplied timestamp source, such as a cycle counter.
+    typedef etl::fsm_trace_timestamp_t (*timestamp_function_t)();
+
+    //*************************************************************************
+    /// Gets the current timestamp.
+    //*************************************************************************
+    etl::fsm_trace_timestamp_t timestamp() const
+    {
+      return p_timestamp();
+    }
+
+    //*************************************************************************
+    /// Records a transition.
+    /// Only to be called from the state machine thread.
+    ///\param state_from The state before the event.
+    ///\param state_to   The state after the event.
+    ///\param message_id The message or event id.
+    ///\param start      The timestamp taken when the event was received.
+    //*************************************************************************
+    void record(int state_from, int state_to, int message_id, etl::fsm_trace_timestamp_t start)
+    {
+      const etl::fsm_trace_timestamp_t finish = p_timestamp();
+      const size_t index = write_count.load(etl::memory_order_relaxed);
+
+      fsm_trace_record& item = p_buffer[index % (trace_capacity + 1U)];
+
+      item.state_from = state_from;
+      item.state_to   = state_to;
+      item.message_id = message_id;
+      item.timestamp  = start;
+      item.duration   = finish - start;
+
+      write_count.store(index + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Copies the most recent records, oldest first.
+    /// Records that are overwritten while they are being copied are discarded.
+    ///\param p_destination Where to copy the records.
+    ///\param max_records   The maximum number of records to copy.
+    ///\return The number of records copied.
+    //*************************************************************************
+    size_t copy(etl::fsm_trace_record* p_destination, size_t max_records) const
+    {
+      const size_t end   = write_count.load(etl::memory_order_acquire);
+      const size_t count = etl::min(end, etl::min(trace_capacity, max_records));
+
+      const size_t first = end - count;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        p_destination[i] = p_buffer[(first + i) % (trace_capacity + 1U)];
+      }
+
+      // Did the writer catch up with the records that were being copied?
+      // The slot after the latest record may be in the middle of being written.
+      const size_t latest       = write_count.load(etl::memory_order_acquire);
+      const size_t oldest_valid = (latest > trace_capacity) ? (latest - trace_capacity) : 0U;
+
+      if (first >= oldest_valid)
+      {
+        return count;
+      }
+
+      const size_t lost = etl::min(oldest_valid - first, count);
+
+      for (size_t i = lost; i < count; ++i)
+      {
+        p_destination[i - lost] = p_destination[i];
+      }
+
+      return count - lost;
+    }
+
+    //*************************************************************************
+    /// The total number of records written since construction or clear().
+    /// If larger than capacity() then older records have been overwritten.
+    //*************************************************************************
+    size_t written() const
+    {
+      return write_count.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// The number of records currently held.
+    //*************************************************************************
+    size_t size() const
+    {
+      return etl::min(written(), trace_capacity);
+    }
+
+    //*************************************************************************
+    /// Checks if no records are held.
+    //*************************************************************************
+    bool empty() const
+    {
+      return written() == 0U;
+    }
+
+    //*************************************************************************
+    /// The maximum number of records held.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return trace_capacity;
+    }
+
+    //*************************************************************************
+    /// Discards all records.
+    /// Not to be called while a traced state machine is processing an event.
+    //*************************************************************************
+    void clear()
+    {
+      write_count.store(0U, etl::memory_order_release);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// The buffer must hold capacity_ + 1 records.
+    //*************************************************************************
+    ifsm_trace(etl::fsm_trace_record* p_buffer_, size_t capacity_, timestamp_function_t p_timestamp_)
+      : p_buffer(p_buffer_),
+        trace_capacity(capacity_),
+        p_timestamp(p_timestamp_),
+        write_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ifsm_trace()
+    {
+    }
+
+  private:
+
+    // Disabled.
+    ifsm_trace(const ifsm_trace&);
+    ifsm_trace& operator =(const ifsm_trace&);
+
+    etl::fsm_trace_record* p_buffer;       ///< The record storage.
+    const size_t           trace_capacity; ///< The number of records that may be held.
+    timestamp_function_t   p_timestamp;    ///< The timestamp source.
+    etl::atomic_size_t     write_count;    ///< The number of records written.
+  };
+
+  //***************************************************************************
+  /// A transition trace of SIZE records.
+  ///\code
+  /// etl::fsm_trace_timestamp_t cycles() { return DWT->CYCCNT; }
+  ///
+  /// etl::fsm_trace<32> trace(cycles);
+  /// motor_control.set_trace(trace);
+  ///\endcode
+  ///\ingroup fsm_trace
+  //***************************************************************************
+  template <const size_t SIZE>
+  class fsm_trace : public etl::ifsm_trace
+  {
+  public:
+
+    ETL_STATIC_ASSERT((SIZE > 0U), "Zero size trace");
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_timestamp_ The timestamp source.
+    //*************************************************************************
+    explicit fsm_trace(timestamp_function_t p_timestamp_)
+      : etl::ifsm_trace(buffer, SIZE, p_timestamp_)
+    {
+    }
+
+  private:
+
+    etl::fsm_trace_record buffer[SIZE + 1U];
+  };
+}
+
+#endif
+
+#include "private/minmax_pop.h"
+
+#endif
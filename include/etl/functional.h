@@ -154,6 +154,81 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent specialisations.
+  /// Compare arguments of any types that support the operator.
+  //***************************************************************************
+  template <>
+  struct less<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs < rhs;
+    }
+  };
+
+  //***************************************************************************
+  template <>
+  struct greater<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs > rhs;
+    }
+  };
+
+  //***************************************************************************
+  template <>
+  struct equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
+  //***************************************************************************
+  template <>
+  struct not_equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs != rhs;
+    }
+  };
+
+  //***************************************************************************
+  /// Determines if a function object is transparent, i.e. it defines the
+  /// nested type 'is_transparent' and accepts arguments of different types.
+  //***************************************************************************
+  template <typename T>
+  struct is_transparent
+  {
+  private:
+
+    typedef char yes;
+    typedef struct { char c[2]; } no;
+
+    template <typename U> static yes test(typename U::is_transparent*);
+    template <typename U> static no  test(...);
+
+  public:
+
+    static const bool value = (sizeof(test<T>(0)) == sizeof(yes));
+  };
+
   //***************************************************************************
 
   template <typename TArgumentType, typename TResultType>
@@ -0,0 +1,983 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FUTURE_INCLUDED
+#define ETL_FUTURE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "array.h"
+#include "pool.h"
+#include "task.h"
+#include "alignment.h"
+#include "inplace_function.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "nullptr.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#if ETL_CPP11_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "73"
+
+//*****************************************************************************
+///\defgroup future future
+/// A promise and future pair whose shared state is allocated from a fixed
+/// size etl::future_pool. Nothing is allocated from the heap.
+/// A continuation attached with then() runs when the promise is fulfilled,
+/// either inline or later from an etl::future_executor, which is an
+/// etl::task and so may be run by an etl::scheduler.
+/// If a promise is destroyed without a value, its future is broken; plain
+/// continuations are not called, and chained futures are broken in turn.
+/// Promises, futures and executors are not thread safe; use them from one
+/// thread of execution.
+///\ingroup utilities
+//*****************************************************************************
+
+/// The inline storage for a continuation, including the captured callable.
+#if !defined(ETL_FUTURE_CONTINUATION_SIZE)
+  #define ETL_FUTURE_CONTINUATION_SIZE (6U * sizeof(void*))
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for future exceptions.
+  ///\ingroup future
+  //***************************************************************************
+  class future_exception : public etl::exception
+  {
+  public:
+
+    future_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception emitted when a future_pool has no free states.
+  ///\ingroup future
+  //***************************************************************************
+  class future_pool_full : public etl::future_exception
+  {
+  public:
+
+    future_pool_full(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:pool full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception emitted when the value of a future is read before it is ready.
+  ///\ingroup future
+  //***************************************************************************
+  class future_not_ready : public etl::future_exception
+  {
+  public:
+
+    future_not_ready(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:not ready", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception emitted when an invalid future or promise is used.
+  ///\ingroup future
+  //***************************************************************************
+  class future_no_state : public etl::future_exception
+  {
+  public:
+
+    future_no_state(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:no state", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  class ifuture_executor;
+
+  namespace private_future
+  {
+    //*************************************************************************
+    /// The type independent part of the shared state.
+    /// Also the node by which executors queue continuations.
+    //*************************************************************************
+    class state_base
+    {
+    public:
+
+      enum status_type
+      {
+        Pending,
+        Ready,
+        Broken
+      };
+
+      //***********************************
+      /// Runs the continuation.
+      //***********************************
+      virtual void run() = 0;
+
+      //***********************************
+      void add_reference()
+      {
+        ++reference_count;
+      }
+
+      //***********************************
+      void release_reference()
+      {
+        if (--reference_count == 0U)
+        {
+          destroy();
+        }
+      }
+
+      bool is_pending() const
+      {
+        return status == Pending;
+      }
+
+      bool is_ready() const
+      {
+        return status == Ready;
+      }
+
+      bool is_broken() const
+      {
+        return status == Broken;
+      }
+
+      //***********************************
+      /// Marks the state broken and dispatches the continuation.
+      //***********************************
+      void set_broken()
+      {
+        if (status == Pending)
+        {
+          status = Broken;
+          dispatch();
+        }
+      }
+
+      state_base* p_next;
+
+    protected:
+
+      state_base()
+        : p_next(nullptr)
+        , status(Pending)
+        , reference_count(0U)
+        , p_executor(nullptr)
+        , has_continuation(false)
+      {
+      }
+
+      ~state_base()
+      {
+      }
+
+      //***********************************
+      /// Returns the state to its pool.
+      //***********************************
+      virtual void destroy() = 0;
+
+      //***********************************
+      /// Runs the continuation inline, or posts it to the executor.
+      /// Defined after ifuture_executor.
+      //***********************************
+      void dispatch();
+
+      status_type            status;
+      size_t                 reference_count;
+      etl::ifuture_executor* p_executor;
+      bool                   has_continuation;
+    };
+
+    //*************************************************************************
+    /// The shared state for a value of type T.
+    //*************************************************************************
+    template <typename T>
+    class shared_state : public state_base
+    {
+    public:
+
+      typedef etl::inplace_function<void(shared_state&), ETL_FUTURE_CONTINUATION_SIZE> continuation_type;
+
+      explicit shared_state(etl::ipool& pool_)
+        : pool(pool_)
+        , constructed(false)
+        , join_failed(false)
+        , join_remaining(0U)
+      {
+      }
+
+      ~shared_state()
+      {
+        if (constructed)
+        {
+          value().~T();
+        }
+      }
+
+      T& value()
+      {
+        return *storage.template get_address<T>();
+      }
+
+      //***********************************
+      /// Stores the value and dispatches the continuation.
+      //***********************************
+      template <typename U>
+      bool set_value(U&& new_value)
+      {
+        if (status != Pending)
+        {
+          return false;
+        }
+
+        if (constructed)
+        {
+          value() = etl::forward<U>(new_value);
+        }
+        else
+        {
+          ::new (storage.template get_address<T>()) T(etl::forward<U>(new_value));
+          constructed = true;
+        }
+
+        status = Ready;
+        dispatch();
+
+        return true;
+      }
+
+      //***********************************
+      /// Sets the continuation. Dispatches it at once if the state is complete.
+      //***********************************
+      void set_continuation(const continuation_type& continuation_, etl::ifuture_executor* p_executor_)
+      {
+        continuation     = continuation_;
+        p_executor       = p_executor_;
+        has_continuation = true;
+
+        if (status != Pending)
+        {
+          dispatch();
+        }
+      }
+
+      void run() override
+      {
+        continuation_type c(etl::move(continuation));
+        c(*this);
+      }
+
+      //***********************************
+      /// Default constructs the value, to be filled in by parts.
+      /// 'parts' calls to join_part() complete the state.
+      //***********************************
+      void begin_join(size_t parts)
+      {
+        ::new (storage.template get_address<T>()) T();
+        constructed    = true;
+        join_remaining = parts;
+
+        if (parts == 0U)
+        {
+          status = Ready;
+        }
+      }
+
+      //***********************************
+      /// Records that one part of a join is complete.
+      //***********************************
+      void join_part(bool ok)
+      {
+        if (!ok)
+        {
+          join_failed = true;
+        }
+
+        if (--join_remaining == 0U)
+        {
+          status = join_failed ? Broken : Ready;
+          dispatch();
+        }
+      }
+
+    private:
+
+      void destroy() override
+      {
+        etl::ipool& p = pool;
+        this->~shared_state();
+        p.release(this);
+      }
+
+      etl::ipool&                                                     pool;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+      bool                                                            constructed;
+      bool                                                            join_failed;
+      size_t                                                          join_remaining;
+      continuation_type                                               continuation;
+    };
+  }
+
+  //***************************************************************************
+  /// Runs continuations posted by futures.
+  ///\ingroup future
+  //***************************************************************************
+  class ifuture_executor
+  {
+  public:
+
+    //*************************************************************************
+    /// Queues a state whose continuation is to be run.
+    //*************************************************************************
+    virtual void post(private_future::state_base& state) = 0;
+
+  protected:
+
+    ~ifuture_executor()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Queues continuations and runs them when its etl::scheduler calls it.
+  /// The queue is intrusive, so there is no limit on the number of
+  /// continuations waiting.
+  ///\ingroup future
+  //***************************************************************************
+  class future_executor : public etl::ifuture_executor, public etl::task
+  {
+  public:
+
+    explicit future_executor(etl::task_priority_t priority = 0U)
+      : etl::task(priority)
+      , p_head(nullptr)
+      , p_tail(nullptr)
+      , count(0U)
+    {
+    }
+
+    future_executor(const future_executor&) = delete;
+    future_executor& operator =(const future_executor&) = delete;
+
+    //*************************************************************************
+    /// Queues a state. Keeps it alive until its continuation has run.
+    //*************************************************************************
+    void post(private_future::state_base& state) override
+    {
+      state.add_reference();
+      state.p_next = nullptr;
+
+      if (p_tail == nullptr)
+      {
+        p_head = &state;
+      }
+      else
+      {
+        p_tail->p_next = &state;
+      }
+
+      p_tail = &state;
+      ++count;
+    }
+
+    //*************************************************************************
+    /// The number of continuations waiting.
+    //*************************************************************************
+    uint32_t task_request_work() const override
+    {
+      return uint32_t(count);
+    }
+
+    //*************************************************************************
+    /// Runs the continuations that are waiting.
+    /// Continuations posted while running are run on the next call.
+    //*************************************************************************
+    void task_process_work() override
+    {
+      private_future::state_base* p_state = p_head;
+
+      p_head = nullptr;
+      p_tail = nullptr;
+      count  = 0U;
+
+      while (p_state != nullptr)
+      {
+        private_future::state_base* p_next = p_state->p_next;
+        p_state->p_next = nullptr;
+
+        p_state->run();
+        p_state->release_reference();
+
+        p_state = p_next;
+      }
+    }
+
+    //*************************************************************************
+    /// Runs continuations until none are waiting.
+    //*************************************************************************
+    void run_all()
+    {
+      while (count != 0U)
+      {
+        task_process_work();
+      }
+    }
+
+    size_t size() const
+    {
+      return count;
+    }
+
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+  private:
+
+    private_future::state_base* p_head;
+    private_future::state_base* p_tail;
+    size_t                      count;
+  };
+
+  //***************************************************************************
+  inline void private_future::state_base::dispatch()
+  {
+    if (has_continuation)
+    {
+      has_continuation = false;
+
+      if (p_executor != nullptr)
+      {
+        p_executor->post(*this);
+      }
+      else
+      {
+        run();
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// The interface to a pool of shared states for futures of type T.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T>
+  class ifuture_pool
+  {
+  public:
+
+    typedef private_future::shared_state<T> state_type;
+
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    size_t max_size() const
+    {
+      return pool.max_size();
+    }
+
+    size_t available() const
+    {
+      return pool.available();
+    }
+
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    bool full() const
+    {
+      return pool.full();
+    }
+
+    //*************************************************************************
+    /// Creates a shared state, or returns nullptr if the pool is full.
+    //*************************************************************************
+    state_type* create()
+    {
+      void* p = nullptr;
+
+      if (pool.allocate_batch(&p, 1U) == 0U)
+      {
+        return nullptr;
+      }
+
+      return ::new (p) state_type(pool);
+    }
+
+  protected:
+
+    explicit ifuture_pool(etl::ipool& pool_)
+      : pool(pool_)
+    {
+    }
+
+    ~ifuture_pool()
+    {
+    }
+
+  private:
+
+    etl::ipool& pool;
+  };
+
+  //***************************************************************************
+  /// A pool of SIZE shared states for futures of type T.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class future_pool : public etl::ifuture_pool<T>
+  {
+  public:
+
+    future_pool()
+      : etl::ifuture_pool<T>(states)
+    {
+    }
+
+    future_pool(const future_pool&) = delete;
+    future_pool& operator =(const future_pool&) = delete;
+
+  private:
+
+    etl::pool<private_future::shared_state<T>, SIZE> states;
+  };
+
+  template <typename T>
+  class future;
+
+  template <typename T>
+  class promise;
+
+  template <typename T, size_t N>
+  etl::future<etl::array<T, N> > when_all(etl::array<etl::future<T>, N>&, etl::ifuture_pool<etl::array<T, N> >&);
+
+  //***************************************************************************
+  /// The receiving side of a promise.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T>
+  class future
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructs an invalid future.
+    //*************************************************************************
+    future()
+      : p_state(nullptr)
+    {
+    }
+
+    future(future&& other)
+      : p_state(other.p_state)
+    {
+      other.p_state = nullptr;
+    }
+
+    future& operator =(future&& other)
+    {
+      if (this != &other)
+      {
+        release();
+        p_state       = other.p_state;
+        other.p_state = nullptr;
+      }
+
+      return *this;
+    }
+
+    future(const future&) = delete;
+    future& operator =(const future&) = delete;
+
+    ~future()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    /// Returns true if the future has a shared state.
+    //*************************************************************************
+    bool valid() const
+    {
+      return p_state != nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns true if the promise has been fulfilled.
+    //*************************************************************************
+    bool is_ready() const
+    {
+      return (p_state != nullptr) && p_state->is_ready();
+    }
+
+    //*************************************************************************
+    /// Returns true if the promise was destroyed without a value.
+    //*************************************************************************
+    bool is_broken() const
+    {
+      return (p_state != nullptr) && p_state->is_broken();
+    }
+
+    //*************************************************************************
+    /// Gets the value.
+    /// If asserts or exceptions are enabled, emits etl::future_not_ready if
+    /// the value is not ready.
+    //*************************************************************************
+    T& get()
+    {
+      ETL_ASSERT(is_ready(), ETL_ERROR(etl::future_not_ready));
+
+      return p_state->value();
+    }
+
+    const T& get() const
+    {
+      ETL_ASSERT(is_ready(), ETL_ERROR(etl::future_not_ready));
+
+      return p_state->value();
+    }
+
+    //*************************************************************************
+    /// Calls 'callable' with the value once the promise is fulfilled.
+    /// Not called if the promise is broken.
+    /// Runs inline if 'p_executor' is null, otherwise from the executor.
+    /// The future is invalid afterwards.
+    //*************************************************************************
+    template <typename TCallable>
+    void then(TCallable callable, etl::ifuture_executor* p_executor = nullptr)
+    {
+      ETL_ASSERT(valid(), ETL_ERROR(etl::future_no_state));
+
+      if (!valid())
+      {
+        return;
+      }
+
+      state_type* p = p_state;
+      p_state = nullptr;
+
+      // The continuation takes over the future's reference.
+      p->set_continuation([callable](state_type& state) mutable
+                          {
+                            if (state.is_ready())
+                            {
+                              callable(state.value());
+                            }
+
+                            state.release_reference();
+                          }, p_executor);
+    }
+
+    //*************************************************************************
+    /// Returns a future for the result of 'callable', which is called with
+    /// the value once the promise is fulfilled. The shared state of the new
+    /// future is taken from 'pool'.
+    /// If this promise is broken, the new future is broken.
+    /// If 'pool' is full, the new future is invalid.
+    /// Runs inline if 'p_executor' is null, otherwise from the executor.
+    /// The future is invalid afterwards.
+    //*************************************************************************
+    template <typename U, typename TCallable>
+    etl::future<U> then(etl::ifuture_pool<U>& pool, TCallable callable, etl::ifuture_executor* p_executor = nullptr)
+    {
+      etl::promise<U> next(pool);
+      etl::future<U>  result = next.get_future();
+
+      ETL_ASSERT(valid(), ETL_ERROR(etl::future_no_state));
+
+      if (valid() && next.valid())
+      {
+        typename etl::promise<U>::state_type* p_next = next.detach();
+
+        state_type* p = p_state;
+        p_state = nullptr;
+
+        p->set_continuation([callable, p_next](state_type& state) mutable
+                            {
+                              if (state.is_ready())
+                              {
+                                p_next->set_value(callable(state.value()));
+                              }
+                              else
+                              {
+                                p_next->set_broken();
+                              }
+
+                              p_next->release_reference();
+                              state.release_reference();
+                            }, p_executor);
+      }
+
+      return result;
+    }
+
+  private:
+
+    typedef private_future::shared_state<T> state_type;
+
+    friend class etl::promise<T>;
+
+    template <typename U, size_t N>
+    friend etl::future<etl::array<U, N> > etl::when_all(etl::array<etl::future<U>, N>&, etl::ifuture_pool<etl::array<U, N> >&);
+
+    explicit future(state_type* p_state_)
+      : p_state(p_state_)
+    {
+      p_state->add_reference();
+    }
+
+    void release()
+    {
+      if (p_state != nullptr)
+      {
+        p_state->release_reference();
+        p_state = nullptr;
+      }
+    }
+
+    state_type* p_state;
+  };
+
+  //***************************************************************************
+  /// The sending side of a future.
+  /// If destroyed without a value, the future is broken.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T>
+  class promise
+  {
+  public:
+
+    typedef private_future::shared_state<T> state_type;
+
+    //*************************************************************************
+    /// Creates the shared state in 'pool'.
+    /// If asserts or exceptions are enabled, emits etl::future_pool_full if
+    /// the pool is full; otherwise the promise is invalid.
+    //*************************************************************************
+    explicit promise(etl::ifuture_pool<T>& pool)
+      : p_state(pool.create())
+      , future_retrieved(false)
+    {
+      ETL_ASSERT(p_state != nullptr, ETL_ERROR(etl::future_pool_full));
+
+      if (p_state != nullptr)
+      {
+        p_state->add_reference();
+      }
+    }
+
+    promise(promise&& other)
+      : p_state(other.p_state)
+      , future_retrieved(other.future_retrieved)
+    {
+      other.p_state = nullptr;
+    }
+
+    promise& operator =(promise&& other)
+    {
+      if (this != &other)
+      {
+        release();
+        p_state          = other.p_state;
+        future_retrieved = other.future_retrieved;
+        other.p_state    = nullptr;
+      }
+
+      return *this;
+    }
+
+    promise(const promise&) = delete;
+    promise& operator =(const promise&) = delete;
+
+    //*************************************************************************
+    /// Breaks the promise if no value was set.
+    //*************************************************************************
+    ~promise()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    /// Returns true if the promise has a shared state.
+    //*************************************************************************
+    bool valid() const
+    {
+      return p_state != nullptr;
+    }
+
+    //*************************************************************************
+    /// Gets the future. Returns an invalid future if the promise is invalid
+    /// or the future has already been retrieved.
+    //*************************************************************************
+    etl::future<T> get_future()
+    {
+      if ((p_state == nullptr) || future_retrieved)
+      {
+        return etl::future<T>();
+      }
+
+      future_retrieved = true;
+
+      return etl::future<T>(p_state);
+    }
+
+    //*************************************************************************
+    /// Fulfils the promise. Inline continuations run before this returns.
+    /// Returns false if the promise is invalid or already fulfilled.
+    //*************************************************************************
+    bool set_value(const T& value)
+    {
+      return (p_state != nullptr) && p_state->set_value(value);
+    }
+
+    bool set_value(T&& value)
+    {
+      return (p_state != nullptr) && p_state->set_value(etl::move(value));
+    }
+
+  private:
+
+    template <typename U>
+    friend class etl::future;
+
+    template <typename U, size_t N>
+    friend etl::future<etl::array<U, N> > etl::when_all(etl::array<etl::future<U>, N>&, etl::ifuture_pool<etl::array<U, N> >&);
+
+    //***********************************
+    /// Hands the promise's reference to the caller.
+    //***********************************
+    state_type* detach()
+    {
+      state_type* p = p_state;
+      p_state = nullptr;
+
+      return p;
+    }
+
+    void release()
+    {
+      if (p_state != nullptr)
+      {
+        p_state->set_broken();
+        p_state->release_reference();
+        p_state = nullptr;
+      }
+    }
+
+    state_type* p_state;
+    bool        future_retrieved;
+  };
+
+  //***************************************************************************
+  /// Returns a future for the values of all of the futures, in order.
+  /// It is broken if any of them is invalid or broken. The futures are
+  /// invalid afterwards. The shared state is taken from 'pool'; if it is
+  /// full, the returned future is invalid.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T, size_t N>
+  etl::future<etl::array<T, N> > when_all(etl::array<etl::future<T>, N>& futures, etl::ifuture_pool<etl::array<T, N> >& pool)
+  {
+    typedef etl::array<T, N>                        result_type;
+    typedef private_future::shared_state<result_type> result_state_type;
+    typedef private_future::shared_state<T>           part_state_type;
+
+    etl::promise<result_type> all(pool);
+    etl::future<result_type>  result = all.get_future();
+
+    if (!all.valid())
+    {
+      return result;
+    }
+
+    result_state_type* p_all = all.detach();
+
+    p_all->begin_join(N);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      part_state_type* p_part = futures[i].p_state;
+      futures[i].p_state = nullptr;
+
+      if (p_part == nullptr)
+      {
+        p_all->join_part(false);
+      }
+      else
+      {
+        p_all->add_reference();
+
+        p_part->set_continuation([p_all, i](part_state_type& part)
+                                 {
+                                   if (part.is_ready())
+                                   {
+                                     p_all->value()[i] = part.value();
+                                   }
+
+                                   p_all->join_part(part.is_ready());
+                                   p_all->release_reference();
+                                   part.release_reference();
+                                 }, nullptr);
+      }
+    }
+
+    p_all->release_reference();
+
+    return result;
+  }
+}
+
+#undef ETL_FILE
+
+#endif
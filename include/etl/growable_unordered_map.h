@@ -0,0 +1,754 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_GROWABLE_UNORDERED_MAP_INCLUDED
+#define ETL_GROWABLE_UNORDERED_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "unordered_map.h"
+#include "alignment.h"
+#include "iterator.h"
+#include "utility.h"
+#include "pool.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "error_handler.h"
+
+///\defgroup growable_unordered_map growable_unordered_map
+/// An unordered_map in user supplied buffers, that may be moved to larger
+/// buffers at run time without a pause to rehash every element.
+/// After migrate_to() the elements are moved a few buckets at a time, on
+/// each insert, or by calls to migrate_step(). Until then, look ups search
+/// both tables.
+///\ingroup containers
+
+namespace etl
+{
+  namespace private_growable_unordered_map
+  {
+    //*************************************************************************
+    /// Iterates the elements of the table being migrated from, followed by
+    /// the elements of the table being migrated to.
+    //*************************************************************************
+    template <typename TTableIterator, typename TTable, typename TValue>
+    class chained_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TValue>
+    {
+    public:
+
+      template <typename UTableIterator, typename UTable, typename UValue>
+      friend class chained_iterator;
+
+      //*********************************
+      chained_iterator()
+        : pnext(nullptr)
+      {
+      }
+
+      //*********************************
+      /// Iterates from itr_ to end_, then through the table pnext_, if not null.
+      //*********************************
+      chained_iterator(TTableIterator itr_, TTableIterator end_, TTable* pnext_)
+        : itr(itr_),
+          itr_end(end_),
+          pnext(pnext_)
+      {
+        next_table();
+      }
+
+      //*********************************
+      /// Converts an iterator to a const_iterator.
+      //*********************************
+      template <typename UTableIterator, typename UTable, typename UValue>
+      chained_iterator(const chained_iterator<UTableIterator, UTable, UValue>& other)
+        : itr(other.itr),
+          itr_end(other.itr_end),
+          pnext(other.pnext)
+      {
+      }
+
+      //*********************************
+      chained_iterator& operator ++()
+      {
+        ++itr;
+        next_table();
+
+        return *this;
+      }
+
+      //*********************************
+      chained_iterator operator ++(int)
+      {
+        chained_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      TValue& operator *()
+      {
+        return *itr;
+      }
+
+      //*********************************
+      const TValue& operator *() const
+      {
+        return *itr;
+      }
+
+      //*********************************
+      TValue* operator ->()
+      {
+        return &(*itr);
+      }
+
+      //*********************************
+      const TValue* operator ->() const
+      {
+        return &(*itr);
+      }
+
+      //*********************************
+      friend bool operator == (const chained_iterator& lhs, const chained_iterator& rhs)
+      {
+        return lhs.itr == rhs.itr;
+      }
+
+      //*********************************
+      friend bool operator != (const chained_iterator& lhs, const chained_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*********************************
+      /// Is the iterator in the table being migrated from?
+      //*********************************
+      bool in_previous_table() const
+      {
+        return pnext != nullptr;
+      }
+
+      //*********************************
+      TTableIterator get_table_iterator() const
+      {
+        return itr;
+      }
+
+    private:
+
+      //*********************************
+      /// Moves on to the next table at the end of the first.
+      //*********************************
+      void next_table()
+      {
+        if ((pnext != nullptr) && (itr == itr_end))
+        {
+          itr     = pnext->begin();
+          itr_end = pnext->end();
+          pnext   = nullptr;
+        }
+      }
+
+      TTableIterator itr;
+      TTableIterator itr_end;
+      TTable*        pnext;
+    };
+  }
+
+  //***************************************************************************
+  /// An unordered_map that can grow in to new buffers at run time.
+  /// Elements are moved to the new table a bounded number of buckets at a
+  /// time, so that no single call pays for the whole rehash.
+  /// The buffers of the previous table may be reused once is_migrating()
+  /// returns false.
+  /// Iterators are invalidated by inserts and calls to migrate_step() while
+  /// a migration is in progress.
+  ///\ingroup growable_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
+  class growable_unordered_map
+  {
+  public:
+
+    typedef etl::unordered_map<TKey, TValue, 0, 0, THash, TKeyEqual, TNodeHash> table_type;
+
+    typedef typename table_type::value_type      value_type;
+    typedef typename table_type::key_type        key_type;
+    typedef typename table_type::mapped_type     mapped_type;
+    typedef typename table_type::hasher          hasher;
+    typedef typename table_type::key_equal       key_equal;
+    typedef typename table_type::reference       reference;
+    typedef typename table_type::const_reference const_reference;
+    typedef typename table_type::pointer         pointer;
+    typedef typename table_type::const_pointer   const_pointer;
+    typedef typename table_type::size_type       size_type;
+    typedef typename table_type::pool_type       pool_type;
+    typedef typename table_type::bucket_type     bucket_type;
+    typedef typename table_type::occupancy_type  occupancy_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    typedef private_growable_unordered_map::chained_iterator<typename table_type::iterator, table_type, value_type>                   iterator;
+    typedef private_growable_unordered_map::chained_iterator<typename table_type::const_iterator, const table_type, const value_type> const_iterator;
+
+    //*************************************************************************
+    /// The buffers for one table.
+    //*************************************************************************
+    struct buffers
+    {
+      etl::ipool*     pnode_pool;        ///< A pool of pool_type.
+      bucket_type*    pbuckets;          ///< The buckets.
+      size_t          number_of_buckets; ///< The number of buckets.
+      occupancy_type* poccupied;         ///< table_type::occupancy_size(number_of_buckets) elements.
+    };
+
+    //*************************************************************************
+    /// Statically sized buffers, to be placed wherever the user chooses.
+    //*************************************************************************
+    template <const size_t MAX_SIZE, const size_t MAX_BUCKETS>
+    class storage
+    {
+    public:
+
+      //*********************************
+      buffers get()
+      {
+        buffers b = { &node_pool, buckets, MAX_BUCKETS, occupied };
+
+        return b;
+      }
+
+    private:
+
+      etl::pool<pool_type, MAX_SIZE> node_pool;
+      bucket_type                    buckets[MAX_BUCKETS];
+      occupancy_type                 occupied[etl::private_unordered::bucket_occupancy::elements<MAX_BUCKETS>::value];
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial          The buffers for the first table.
+    ///\param buckets_per_step The number of buckets migrated by each insert.
+    //*************************************************************************
+    explicit growable_unordered_map(const buffers& initial, size_t buckets_per_step_ = 1U)
+      : ptable(create(0U, initial)),
+        pprevious(nullptr),
+        migrate_index(0U),
+        buckets_per_step(buckets_per_step_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~growable_unordered_map()
+    {
+      finish_migration();
+      ptable->~table_type();
+    }
+
+    //*************************************************************************
+    /// Starts moving the elements to the new buffers.
+    /// Returns false, and does nothing, if a migration is already in progress
+    /// or the new pool does not have room for the current elements.
+    //*************************************************************************
+    bool migrate_to(const buffers& next)
+    {
+      if (is_migrating() || (next.pnode_pool->available() < size()))
+      {
+        return false;
+      }
+
+      pprevious     = ptable;
+      ptable        = create((ptable == slot(0U)) ? 1U : 0U, next);
+      migrate_index = 0U;
+
+      if (pprevious->empty())
+      {
+        finish_migration();
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the elements of up to max_buckets buckets of the previous table.
+    /// Returns true if the migration is still in progress.
+    //*************************************************************************
+    bool migrate_step(size_t max_buckets)
+    {
+      if (is_migrating())
+      {
+        const size_t number_of_buckets = pprevious->bucket_count();
+
+        while ((max_buckets != 0U) && (migrate_index < number_of_buckets) && !pprevious->empty())
+        {
+          migrate_bucket(migrate_index++);
+          --max_buckets;
+        }
+
+        if (pprevious->empty())
+        {
+          finish_migration();
+        }
+      }
+
+      return is_migrating();
+    }
+
+    //*************************************************************************
+    /// Completes any migration in progress.
+    //*************************************************************************
+    void migrate_all()
+    {
+      migrate_step(etl::integral_limits<size_t>::max);
+    }
+
+    //*************************************************************************
+    /// Is a migration in progress?
+    //*************************************************************************
+    bool is_migrating() const
+    {
+      return pprevious != nullptr;
+    }
+
+    //*************************************************************************
+    /// Sets the number of buckets migrated by each insert.
+    //*************************************************************************
+    void set_buckets_per_step(size_t buckets_per_step_)
+    {
+      buckets_per_step = buckets_per_step_;
+    }
+
+    //*************************************************************************
+    /// Gets the number of buckets migrated by each insert.
+    //*************************************************************************
+    size_t get_buckets_per_step() const
+    {
+      return buckets_per_step;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      if (is_migrating())
+      {
+        return iterator(pprevious->begin(), pprevious->end(), ptable);
+      }
+
+      return iterator(ptable->begin(), ptable->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return cbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      const table_type* pconst_table = ptable;
+
+      if (is_migrating())
+      {
+        const table_type* pconst_previous = pprevious;
+
+        return const_iterator(pconst_previous->begin(), pconst_previous->end(), pconst_table);
+      }
+
+      return const_iterator(pconst_table->begin(), pconst_table->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(ptable->end(), ptable->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return cend();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      const table_type* pconst_table = ptable;
+
+      return const_iterator(pconst_table->end(), pconst_table->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if the key is not already in the map.
+    /// Migrates the next buckets_per_step buckets first.
+    /// If asserts or exceptions are enabled, emits etl::unordered_map_full if
+    /// the map is full.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      migrate_step(buckets_per_step);
+
+      iterator itr = find(value.first);
+
+      if (itr != end())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::unordered_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(ptable->insert(value).first, ptable->end(), nullptr), true);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Inserts a value, if the key is not already in the map.
+    /// Migrates the next buckets_per_step buckets first.
+    /// If asserts or exceptions are enabled, emits etl::unordered_map_full if
+    /// the map is full.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      migrate_step(buckets_per_step);
+
+      iterator itr = find(value.first);
+
+      if (itr != end())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::unordered_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(ptable->insert(etl::move(value)).first, ptable->end(), nullptr), true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns a reference to the value for the key, inserting a default
+    /// value if the key is not in the map.
+    //*************************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      iterator itr = find(key);
+
+      if (itr == end())
+      {
+        itr = insert(value_type(key, mapped_type())).first;
+      }
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value for the key.
+    /// If asserts or exceptions are enabled, emits etl::unordered_map_out_of_range
+    /// if the key is not in the map.
+    //*************************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(etl::unordered_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value for the key.
+    /// If asserts or exceptions are enabled, emits etl::unordered_map_out_of_range
+    /// if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(etl::unordered_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    /// The key is hashed once for both tables.
+    //*************************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t hash = ptable->hash_function()(key);
+
+      typename table_type::iterator itr = ptable->find(key, hash);
+
+      if ((itr == ptable->end()) && is_migrating())
+      {
+        typename table_type::iterator iprevious = pprevious->find(key, hash);
+
+        if (iprevious != pprevious->end())
+        {
+          return iterator(iprevious, pprevious->end(), ptable);
+        }
+      }
+
+      return iterator(itr, ptable->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    /// The key is hashed once for both tables.
+    //*************************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const table_type* pconst_table = ptable;
+
+      const size_t hash = pconst_table->hash_function()(key);
+
+      typename table_type::const_iterator itr = pconst_table->find(key, hash);
+
+      if ((itr == pconst_table->end()) && is_migrating())
+      {
+        const table_type* pconst_previous = pprevious;
+
+        typename table_type::const_iterator iprevious = pconst_previous->find(key, hash);
+
+        if (iprevious != pconst_previous->end())
+        {
+          return const_iterator(iprevious, pconst_previous->end(), pconst_table);
+        }
+      }
+
+      return const_iterator(itr, pconst_table->end(), nullptr);
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key. 0 or 1.
+    //*************************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Erases the element with the key.
+    /// Returns the number of elements erased. 0 or 1.
+    //*************************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_t n = ptable->erase(key);
+
+      if ((n == 0U) && is_migrating())
+      {
+        n = pprevious->erase(key);
+
+        if (pprevious->empty())
+        {
+          finish_migration();
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Erases all of the elements, and completes any migration.
+    //*************************************************************************
+    void clear()
+    {
+      finish_migration();
+      ptable->clear();
+    }
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return ptable->size() + (is_migrating() ? pprevious->size() : 0U);
+    }
+
+    //*************************************************************************
+    /// Is the map empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// The maximum number of elements, in the current buffers.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return ptable->max_size();
+    }
+
+    //*************************************************************************
+    /// The number of elements that may be inserted.
+    /// Room is kept for the elements that have still to be migrated.
+    //*************************************************************************
+    size_t available() const
+    {
+      const size_t pending = is_migrating() ? pprevious->size() : 0U;
+      const size_t free    = ptable->available();
+
+      return (free > pending) ? (free - pending) : 0U;
+    }
+
+    //*************************************************************************
+    /// Is the map full?
+    //*************************************************************************
+    bool full() const
+    {
+      return available() == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of buckets, in the current buffers.
+    //*************************************************************************
+    size_type bucket_count() const
+    {
+      return ptable->bucket_count();
+    }
+
+    //*************************************************************************
+    /// The load factor, size / bucket_count, for the current buffers.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<sizeof(table_type), etl::alignment_of<table_type>::value>::type table_storage_t;
+
+    //*************************************************************************
+    /// Gets the address of a table slot.
+    //*************************************************************************
+    table_type* slot(size_t index)
+    {
+      return tables[index].template get_address<table_type>();
+    }
+
+    //*************************************************************************
+    /// Constructs a table in a slot.
+    //*************************************************************************
+    table_type* create(size_t index, const buffers& b)
+    {
+      return ::new (slot(index)) table_type(*b.pnode_pool, b.pbuckets, b.number_of_buckets, b.poccupied);
+    }
+
+    //*************************************************************************
+    /// Moves the elements of one bucket of the previous table.
+    /// Each is hashed once, and moved in to a node of the new pool.
+    //*************************************************************************
+    void migrate_bucket(size_t index)
+    {
+      while (pprevious->begin(index) != pprevious->end(index))
+      {
+        value_type&  value = pprevious->begin(index)->key_value_pair;
+        const size_t hash  = pprevious->hash_function()(value.first);
+
+        typename table_type::iterator itr = pprevious->find(value.first, hash);
+
+#if ETL_CPP11_SUPPORTED
+        ptable->insert(etl::move(value));
+#else
+        ptable->insert(value);
+#endif
+        pprevious->erase(itr);
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys the previous table, so that its buffers may be reused.
+    //*************************************************************************
+    void finish_migration()
+    {
+      if (is_migrating())
+      {
+        pprevious->~table_type();
+        pprevious = nullptr;
+      }
+    }
+
+    // Disabled.
+    growable_unordered_map(const growable_unordered_map&);
+    growable_unordered_map& operator =(const growable_unordered_map&);
+
+    /// Storage for the current and previous tables.
+    table_storage_t tables[2];
+
+    /// The table that elements are inserted in to.
+    table_type* ptable;
+
+    /// The table being migrated from, or null.
+    table_type* pprevious;
+
+    /// The next bucket of the previous table to migrate.
+    size_t migrate_index;
+
+    /// The number of buckets migrated by each insert.
+    size_t buckets_per_step;
+  };
+}
+
+#endif
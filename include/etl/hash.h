@@ -40,6 +40,7 @@ SOFTWARE.
 #include "fnv_1.h"
 #include "type_traits.h"
 #include "static_assert.h"
+#include "smallest.h"
 
 ///\defgroup hash Standard hash calculations
 ///\ingroup maths
@@ -82,8 +83,218 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+
+    //*************************************************************************
+    /// Selects the word size of the string hash.
+    /// Defaults to the size of size_t. Define ETL_HASH_STRING_32BIT or
+    /// ETL_HASH_STRING_64BIT to override.
+    //*************************************************************************
+#if defined(ETL_HASH_STRING_32BIT)
+    typedef etl::false_type string_hash_is_64;
+#elif defined(ETL_HASH_STRING_64BIT)
+    typedef etl::true_type string_hash_is_64;
+#else
+    typedef etl::integral_constant<bool, (sizeof(size_t) >= sizeof(uint64_t))> string_hash_is_64;
+#endif
+
+    //*************************************************************************
+    /// Assembles a word from consecutive characters.
+    /// The bytes of each character are taken low byte first, so the result
+    /// does not depend on the endianness of the platform.
+    //*************************************************************************
+    template <typename TWord, typename TChar>
+    ETL_CONSTEXPR14 TWord string_hash_load(const TChar* text, size_t count)
+    {
+      typedef typename etl::smallest_uint_for_bits<CHAR_BIT * sizeof(TChar)>::type char_type;
+
+      TWord word = 0;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        word |= TWord(char_type(text[i])) << (i * CHAR_BIT * sizeof(TChar));
+      }
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Leaves the words of the string hash unchanged.
+    /// Other folds map equivalent characters in a word to the same value.
+    //*************************************************************************
+    struct string_hash_no_fold
+    {
+      template <typename TWord>
+      ETL_CONSTEXPR TWord operator ()(TWord word) const
+      {
+        return word;
+      }
+    };
+
+    //*************************************************************************
+    /// 32 bit word at a time string hash, based on MurmurHash2.
+    //*************************************************************************
+    template <typename TChar, typename TFold>
+    ETL_CONSTEXPR14 uint32_t string_hash_32(const TChar* text, size_t length, TFold fold)
+    {
+      ETL_STATIC_ASSERT(sizeof(TChar) <= sizeof(uint32_t), "Character type too large");
+
+      const uint32_t M = 0x5BD1E995UL;
+      const size_t   CHARS_PER_WORD = sizeof(uint32_t) / sizeof(TChar);
+
+      uint32_t h = 0x9747B28CUL ^ uint32_t(length * sizeof(TChar));
+
+      while (length >= CHARS_PER_WORD)
+      {
+        uint32_t k = fold(string_hash_load<uint32_t>(text, CHARS_PER_WORD));
+
+        k *= M;
+        k ^= k >> 24;
+        k *= M;
+        h *= M;
+        h ^= k;
+
+        text   += CHARS_PER_WORD;
+        length -= CHARS_PER_WORD;
+      }
+
+      if (length != 0)
+      {
+        h ^= fold(string_hash_load<uint32_t>(text, length));
+        h *= M;
+      }
+
+      h ^= h >> 13;
+      h *= M;
+      h ^= h >> 15;
+
+      return h;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14 uint32_t string_hash_32(const TChar* text, size_t length)
+    {
+      return string_hash_32(text, length, string_hash_no_fold());
+    }
+
+    //*************************************************************************
+    /// 64 bit word at a time string hash, based on MurmurHash64A.
+    //*************************************************************************
+    template <typename TChar, typename TFold>
+    ETL_CONSTEXPR14 uint64_t string_hash_64(const TChar* text, size_t length, TFold fold)
+    {
+      ETL_STATIC_ASSERT(sizeof(TChar) <= sizeof(uint64_t), "Character type too large");
+
+      const uint64_t M = 0xC6A4A7935BD1E995ULL;
+      const size_t   CHARS_PER_WORD = sizeof(uint64_t) / sizeof(TChar);
+
+      uint64_t h = 0x9747B28CULL ^ (uint64_t(length * sizeof(TChar)) * M);
+
+      while (length >= CHARS_PER_WORD)
+      {
+        uint64_t k = fold(string_hash_load<uint64_t>(text, CHARS_PER_WORD));
+
+        k *= M;
+        k ^= k >> 47;
+        k *= M;
+        h ^= k;
+        h *= M;
+
+        text   += CHARS_PER_WORD;
+        length -= CHARS_PER_WORD;
+      }
+
+      if (length != 0)
+      {
+        h ^= fold(string_hash_load<uint64_t>(text, length));
+        h *= M;
+      }
+
+      h ^= h >> 47;
+      h *= M;
+      h ^= h >> 47;
+
+      return h;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14 uint64_t string_hash_64(const TChar* text, size_t length)
+    {
+      return string_hash_64(text, length, string_hash_no_fold());
+    }
+
+    //*************************************************************************
+    /// String hash using 64 bit words.
+    //*************************************************************************
+    template <typename TChar, typename TFold>
+    ETL_CONSTEXPR14 size_t string_hash(const TChar* text, size_t length, etl::true_type, TFold fold)
+    {
+      const uint64_t h = string_hash_64(text, length, fold);
+
+      return (sizeof(size_t) >= sizeof(uint64_t)) ? size_t(h) : size_t(h ^ (h >> 32));
+    }
+
+    //*************************************************************************
+    /// String hash using 32 bit words.
+    //*************************************************************************
+    template <typename TChar, typename TFold>
+    ETL_CONSTEXPR14 size_t string_hash(const TChar* text, size_t length, etl::false_type, TFold fold)
+    {
+      const uint32_t h = string_hash_32(text, length, fold);
+
+      return (sizeof(size_t) >= sizeof(uint32_t)) ? size_t(h) : size_t(h ^ (h >> 16));
+    }
+
+    //*************************************************************************
+    /// Hash a range of bytes with a frame check sequence hash.
+    //*************************************************************************
+    template <typename THasher>
+    size_t hash_bytes_using(const uint8_t* begin, const uint8_t* end)
+    {
+      return static_cast<size_t>(THasher(begin, end).value());
+    }
+  }
+
+  //***************************************************************************
+  /// Hashes a sequence of characters.
+  /// This is the hash used by etl::hash for the string and string_view types
+  /// and may be evaluated at compile time from C++14.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename TChar>
+  ETL_CONSTEXPR14 size_t hash_string(const TChar* text, size_t length)
+  {
+    return etl::private_hash::string_hash(text, length, etl::private_hash::string_hash_is_64(), etl::private_hash::string_hash_no_fold());
+  }
+
+  //***************************************************************************
+  /// Hashes a string literal, excluding the terminating null.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename TChar, const size_t SIZE>
+  ETL_CONSTEXPR14 size_t hash_string(const TChar (&text)[SIZE])
+  {
+    return etl::hash_string(text, SIZE - 1);
   }
 
+  //***************************************************************************
+  /// Transparent hash for character containers.
+  /// Accepts any type with data() and size(), such as the string and
+  /// string_view types, and gives the same result as etl::hash for each.
+  ///\ingroup hash
+  //***************************************************************************
+  struct string_hash
+  {
+    typedef void is_transparent;
+
+    template <typename TText>
+    ETL_CONSTEXPR14 size_t operator ()(const TText& text) const
+    {
+      return etl::hash_string(text.data(), text.size());
+    }
+  };
+
   //***************************************************************************
   /// Generic declaration for etl::hash
   ///\ingroup hash
@@ -99,7 +310,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(bool), "size_t smaller than type");
 
-    size_t operator ()(bool v) const
+    ETL_CONSTEXPR size_t operator ()(bool v) const
     {
       return static_cast<size_t>(v);
     }
@@ -114,7 +325,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(char), "size_t smaller than type");
 
-    size_t operator ()(char v) const
+    ETL_CONSTEXPR size_t operator ()(char v) const
     {
       return static_cast<size_t>(v);
     }
@@ -129,7 +340,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(signed char), "size_t smaller than type");
 
-    size_t operator ()(signed char v) const
+    ETL_CONSTEXPR size_t operator ()(signed char v) const
     {
       return static_cast<size_t>(v);
     }
@@ -144,7 +355,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(unsigned char), "size_t smaller than type");
 
-    size_t operator ()(unsigned char v) const
+    ETL_CONSTEXPR size_t operator ()(unsigned char v) const
     {
       return static_cast<size_t>(v);
     }
@@ -159,7 +370,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(wchar_t), "size_t smaller than type");
 
-    size_t operator ()(wchar_t v) const
+    ETL_CONSTEXPR size_t operator ()(wchar_t v) const
     {
       return static_cast<size_t>(v);
     }
@@ -174,7 +385,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(short), "size_t smaller than type");
 
-    size_t operator ()(short v) const
+    ETL_CONSTEXPR size_t operator ()(short v) const
     {
       return static_cast<size_t>(v);
     }
@@ -189,7 +400,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(unsigned short), "size_t smaller than type");
 
-    size_t operator ()(unsigned short v) const
+    ETL_CONSTEXPR size_t operator ()(unsigned short v) const
     {
       return static_cast<size_t>(v);
     }
@@ -204,7 +415,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(int), "size_t smaller than type");
 
-    size_t operator ()(int v) const
+    ETL_CONSTEXPR size_t operator ()(int v) const
     {
       return static_cast<size_t>(v);
     }
@@ -219,7 +430,7 @@ namespace etl
   {
     ETL_STATIC_ASSERT(sizeof(size_t) >= sizeof(unsigned int), "size_t smaller than type");
 
-    size_t operator ()(unsigned int v) const
+    ETL_CONSTEXPR size_t operator ()(unsigned int v) const
     {
       return static_cast<size_t>(v);
     }
@@ -232,7 +443,7 @@ namespace etl
   template<>
   struct hash<long>
   {
-    size_t operator ()(long v) const
+    ETL_CONSTEXPR14 size_t operator ()(long v) const
     {
       // If it's the same size as a size_t.
       if (sizeof(size_t) >= sizeof(v))
@@ -254,7 +465,7 @@ namespace etl
   template<>
   struct hash<long long>
   {
-    size_t operator ()(long long v) const
+    ETL_CONSTEXPR14 size_t operator ()(long long v) const
     {
       // If it's the same size as a size_t.
       if (sizeof(size_t) >= sizeof(v))
@@ -276,7 +487,7 @@ namespace etl
   template<>
   struct hash<unsigned long>
   {
-    size_t  operator ()(unsigned long v) const
+    ETL_CONSTEXPR14 size_t operator ()(unsigned long v) const
     {
       // If it's the same size as a size_t.
       if (sizeof(size_t) >= sizeof(v))
@@ -298,7 +509,7 @@ namespace etl
   template<>
   struct hash<unsigned long long>
   {
-    size_t  operator ()(unsigned long long v) const
+    ETL_CONSTEXPR14 size_t operator ()(unsigned long long v) const
     {
       // If it's the same size as a size_t.
       if (sizeof(size_t) >= sizeof(v))
@@ -432,6 +643,26 @@ namespace etl
       }
     }
   };
+
+  //***************************************************************************
+  /// Hash function object that uses a frame check sequence hash, such as
+  /// etl::xxhash64 or etl::wyhash, in place of the default calculation.
+  /// May be used as the hash type of the unordered containers.
+  /// This generic declaration hashes the bytes of arithmetic and pointer
+  /// types. The string and string_view headers supply specialisations.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename THasher, typename T>
+  struct hash_using
+  {
+    ETL_STATIC_ASSERT(etl::is_arithmetic<T>::value || etl::is_pointer<T>::value, "Type not supported");
+
+    size_t operator ()(const T& v) const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&v);
+      return private_hash::hash_bytes_using<THasher>(p, p + sizeof(v));
+    }
+  };
 }
 
 #endif
@@ -0,0 +1,115 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HDLC_INCLUDED
+#define ETL_HDLC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "crc16_x25.h"
+#include "private/framing_common.h"
+#include "private/escape_framing.h"
+
+///\defgroup hdlc HDLC framing
+/// Asynchronous HDLC-like framing (RFC 1662), as used by PPP. Frames are
+/// delimited by 0x7E and the flag and escape bytes are escaped with 0x7D.
+/// The frame check sequence, by default the 16 bit FCS (etl::crc16_x25), is
+/// appended least significant byte first, and is calculated in the same pass
+/// as the escaping. Address and control fields are left to the user.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// The HDLC special bytes.
+    //*************************************************************************
+    struct hdlc_traits
+    {
+      enum
+      {
+        DELIMITER = 0x7EU,
+        ESCAPE    = 0x7DU
+      };
+
+      static uint8_t escape(uint8_t value)
+      {
+        return uint8_t(value ^ 0x20U);
+      }
+
+      static bool unescape(uint8_t value, uint8_t& result)
+      {
+        result = uint8_t(value ^ 0x20U);
+
+        return true;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// An HDLC encoder.
+  /// Each frame is begun with begin(), given data with any number of calls to
+  /// add(), and ended with end(), or encoded in one go with encode().
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup hdlc
+  //***************************************************************************
+  template <typename TFrameCheck = etl::crc16_x25>
+  class hdlc_encoder : public private_framing::escape_encoder<private_framing::hdlc_traits, TFrameCheck>
+  {
+  };
+
+  //***************************************************************************
+  /// An HDLC decoder.
+  /// Received data may be passed in chunks of any size to decode().
+  /// An escape followed by a flag aborts the frame, reported as FORMAT_ERROR.
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup hdlc
+  //***************************************************************************
+  template <typename TFrameCheck = etl::crc16_x25>
+  class hdlc_decoder : public private_framing::escape_decoder<private_framing::hdlc_traits, TFrameCheck>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer for decoded frames.
+    ///\param capacity The size of the buffer, including the frame check sequence.
+    //*************************************************************************
+    hdlc_decoder(uint8_t* buffer, size_t capacity)
+      : private_framing::escape_decoder<private_framing::hdlc_traits, TFrameCheck>(buffer, capacity)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,321 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HEX_INCLUDED
+#define ETL_HEX_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "array_view.h"
+#include "cstring.h"
+#include "vector.h"
+
+///\defgroup hex hex
+/// Hexadecimal encoding and decoding of byte sequences, two characters per
+/// byte, through tables. Decoding accepts either case.
+/// Functions writing to an array_view return the number of elements written,
+/// or 0 if the output is too small or the input is invalid. As valid input
+/// that is not empty always produces output, 0 is never a valid result for it.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The number of characters needed to encode 'n' bytes.
+  ///\ingroup hex
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t hex_encoded_size(size_t n)
+  {
+    return n * 2U;
+  }
+
+  //***************************************************************************
+  /// The number of characters needed to encode N bytes, for sizing buffers.
+  ///\ingroup hex
+  //***************************************************************************
+  template <const size_t N>
+  struct hex_encoded_length
+  {
+    static const size_t value = N * 2U;
+  };
+
+  template <const size_t N>
+  const size_t hex_encoded_length<N>::value;
+
+  //***************************************************************************
+  /// The number of bytes that 'n' characters decode to.
+  ///\ingroup hex
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t hex_decoded_size(size_t n)
+  {
+    return n / 2U;
+  }
+
+  namespace private_hex
+  {
+    //*************************************************************************
+    /// The tables.
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+      static const char    lower[16];
+      static const char    upper[16];
+      static const uint8_t decode[256];
+    };
+
+    template <typename T>
+    const char tables<T>::lower[16] =
+    {
+      '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+    };
+
+    template <typename T>
+    const char tables<T>::upper[16] =
+    {
+      '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    };
+
+    // 0x80 marks characters that are not hex digits.
+    template <typename T>
+    const uint8_t tables<T>::decode[256] =
+    {
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+         0,    1,    2,    3,    4,    5,    6,    7,    8,    9, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80,   10,   11,   12,   13,   14,   15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80,   10,   11,   12,   13,   14,   15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+    };
+
+    //*************************************************************************
+    /// Encodes [begin, end) to 'out', which must be large enough.
+    //*************************************************************************
+    inline void encode(const uint8_t* begin, const uint8_t* end, char* out, bool uppercase)
+    {
+      const char* table = uppercase ? tables<>::upper : tables<>::lower;
+
+      while (begin != end)
+      {
+        const uint8_t value = *begin++;
+
+        out[0] = table[value >> 4];
+        out[1] = table[value & 0x0FU];
+        out   += 2;
+      }
+    }
+
+    //*************************************************************************
+    /// Decodes [begin, end) to 'out', which must be large enough.
+    /// The length must be even.
+    /// Returns false if a character is invalid.
+    //*************************************************************************
+    inline bool decode(const char* begin, const char* end, uint8_t* out)
+    {
+      const uint8_t* table = tables<>::decode;
+
+      // The invalid markers are combined, so there is one test per four bytes.
+      while ((end - begin) >= 8)
+      {
+        const uint8_t h0 = table[uint8_t(begin[0])];
+        const uint8_t l0 = table[uint8_t(begin[1])];
+        const uint8_t h1 = table[uint8_t(begin[2])];
+        const uint8_t l1 = table[uint8_t(begin[3])];
+        const uint8_t h2 = table[uint8_t(begin[4])];
+        const uint8_t l2 = table[uint8_t(begin[5])];
+        const uint8_t h3 = table[uint8_t(begin[6])];
+        const uint8_t l3 = table[uint8_t(begin[7])];
+
+        if ((h0 | l0 | h1 | l1 | h2 | l2 | h3 | l3) & 0x80U)
+        {
+          return false;
+        }
+
+        out[0] = uint8_t((h0 << 4) | l0);
+        out[1] = uint8_t((h1 << 4) | l1);
+        out[2] = uint8_t((h2 << 4) | l2);
+        out[3] = uint8_t((h3 << 4) | l3);
+
+        begin += 8;
+        out   += 4;
+      }
+
+      while (begin != end)
+      {
+        const uint8_t h = table[uint8_t(begin[0])];
+        const uint8_t l = table[uint8_t(begin[1])];
+
+        if ((h | l) & 0x80U)
+        {
+          return false;
+        }
+
+        *out++ = uint8_t((h << 4) | l);
+        begin += 2;
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Encodes [begin, end) to 'out'.
+  /// Returns the number of characters written, or 0 if 'out' is too small.
+  ///\ingroup hex
+  //***************************************************************************
+  inline size_t hex_encode(const uint8_t* begin, const uint8_t* end, etl::array_view<char> out, bool uppercase = false)
+  {
+    const size_t n = hex_encoded_size(size_t(end - begin));
+
+    if (n > out.size())
+    {
+      return 0U;
+    }
+
+    private_hex::encode(begin, end, out.data(), uppercase);
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Encodes 'data' to 'out'.
+  /// Returns the number of characters written, or 0 if 'out' is too small.
+  ///\ingroup hex
+  //***************************************************************************
+  inline size_t hex_encode(etl::array_view<const uint8_t> data, etl::array_view<char> out, bool uppercase = false)
+  {
+    return hex_encode(data.data(), data.data() + data.size(), out, uppercase);
+  }
+
+  //***************************************************************************
+  /// Encodes [begin, end), appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room.
+  ///\ingroup hex
+  //***************************************************************************
+  inline bool hex_encode(const uint8_t* begin, const uint8_t* end, etl::istring& out, bool uppercase = false)
+  {
+    const size_t n = hex_encoded_size(size_t(end - begin));
+
+    if (!out.reserve_check(n))
+    {
+      return false;
+    }
+
+    const size_t start = out.size();
+
+    out.resize(start + n);
+    private_hex::encode(begin, end, out.data() + start, uppercase);
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Encodes 'data', appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room.
+  ///\ingroup hex
+  //***************************************************************************
+  inline bool hex_encode(etl::array_view<const uint8_t> data, etl::istring& out, bool uppercase = false)
+  {
+    return hex_encode(data.data(), data.data() + data.size(), out, uppercase);
+  }
+
+  //***************************************************************************
+  /// Decodes [begin, end) to 'out'.
+  /// Returns the number of bytes written, or 0 if 'out' is too small or the
+  /// input is invalid.
+  ///\ingroup hex
+  //***************************************************************************
+  inline size_t hex_decode(const char* begin, const char* end, etl::array_view<uint8_t> out)
+  {
+    const size_t length = size_t(end - begin);
+    const size_t n      = hex_decoded_size(length);
+
+    if (((length % 2U) != 0U) || (n > out.size()))
+    {
+      return 0U;
+    }
+
+    return private_hex::decode(begin, end, out.data()) ? n : 0U;
+  }
+
+  //***************************************************************************
+  /// Decodes 'text' to 'out'.
+  /// Returns the number of bytes written, or 0 if 'out' is too small or the
+  /// input is invalid.
+  ///\ingroup hex
+  //***************************************************************************
+  inline size_t hex_decode(etl::array_view<const char> text, etl::array_view<uint8_t> out)
+  {
+    return hex_decode(text.data(), text.data() + text.size(), out);
+  }
+
+  //***************************************************************************
+  /// Decodes [begin, end), appending to 'out'.
+  /// Returns false, leaving 'out' unchanged, if it does not have room or the
+  /// input is invalid.
+  ///\ingroup hex
+  //***************************************************************************
+  inline bool hex_decode(const char* begin, const char* end, etl::ivector<uint8_t>& out)
+  {
+    const size_t length = size_t(end - begin);
+    const size_t n      = hex_decoded_size(length);
+
+    if (((length % 2U) != 0U) || (n > (out.capacity() - out.size())))
+    {
+      return false;
+    }
+
+    const size_t start = out.size();
+
+    out.resize(start + n);
+
+    if (!private_hex::decode(begin, end, out.data() + start))
+    {
+      out.resize(start);
+      return false;
+    }
+
+    return true;
+  }
+}
+
+#endif
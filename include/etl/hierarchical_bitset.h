@@ -0,0 +1,599 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HIERARCHICAL_BITSET_INCLUDED
+#define ETL_HIERARCHICAL_BITSET_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "binary.h"
+
+//*****************************************************************************
+///\defgroup hierarchical_bitset hierarchical_bitset
+/// A bitset with a summary level, for fast searches of large bitsets.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //*************************************************************************
+  /// The base class for etl::hierarchical_bitset
+  /// Each 64 bit word of the bitset has a bit in two summaries: one set while
+  /// the word has any bit set, the other while the word has any bit clear.
+  /// A search for either state is a ctz on the summary followed by a ctz on
+  /// the word it selects.
+  ///\ingroup hierarchical_bitset
+  //*************************************************************************
+  class ihierarchical_bitset
+  {
+  public:
+
+    typedef uint64_t element_t;
+
+    static const element_t ALL_SET          = etl::integral_limits<element_t>::max;
+    static const element_t ALL_CLEAR        = 0;
+    static const size_t    BITS_PER_ELEMENT = etl::integral_limits<element_t>::bits;
+
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+
+    //*************************************************************************
+    /// The size of the bitset.
+    //*************************************************************************
+    size_t size() const
+    {
+      return NBITS;
+    }
+
+    //*************************************************************************
+    /// Count the number of bits set.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        n += count_element(pdata[i]);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Are all the bits set?
+    //*************************************************************************
+    bool all() const
+    {
+      return !summary_any(pnot_full);
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const
+    {
+      return summary_any(pnot_empty);
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const
+    {
+      return !any();
+    }
+
+    //*************************************************************************
+    /// Tests a bit at a position.
+    /// Positions greater than the number of configured bits will return <b>false</b>.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      if (position >= NBITS)
+      {
+        return false;
+      }
+
+      return (pdata[position / BITS_PER_ELEMENT] & bit(position)) != 0;
+    }
+
+    //*************************************************************************
+    /// Read [] operator.
+    //*************************************************************************
+    bool operator [](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// Set all of the bits.
+    //*************************************************************************
+    ihierarchical_bitset& set()
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        pdata[i] = ALL_SET;
+      }
+
+      pdata[SIZE - 1] &= TOP_MASK;
+
+      update_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& set(size_t position, bool value = true)
+    {
+      if (position < NBITS)
+      {
+        const size_t index = position / BITS_PER_ELEMENT;
+
+        if (value)
+        {
+          pdata[index] |= bit(position);
+        }
+        else
+        {
+          pdata[index] &= ~bit(position);
+        }
+
+        update_summaries(index);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Resets all of the bits.
+    //*************************************************************************
+    ihierarchical_bitset& reset()
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        pdata[i] = ALL_CLEAR;
+      }
+
+      update_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& reset(size_t position)
+    {
+      return set(position, false);
+    }
+
+    //*************************************************************************
+    /// Flip all of the bits.
+    //*************************************************************************
+    ihierarchical_bitset& flip()
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        pdata[i] = ~pdata[i];
+      }
+
+      pdata[SIZE - 1] &= TOP_MASK;
+
+      update_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flip the bit at the position.
+    //*************************************************************************
+    ihierarchical_bitset& flip(size_t position)
+    {
+      if (position < NBITS)
+      {
+        const size_t index = position / BITS_PER_ELEMENT;
+
+        pdata[index] ^= bit(position);
+
+        update_summaries(index);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_first(bool state) const
+    {
+      return find_next(state, 0);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_next(bool state, size_t position) const
+    {
+      if (position >= NBITS)
+      {
+        return ihierarchical_bitset::npos;
+      }
+
+      size_t index = position / BITS_PER_ELEMENT;
+
+      // Anything left in this element?
+      element_t value = in_state(index, state) & (ALL_SET << (position % BITS_PER_ELEMENT));
+
+      if (value == ALL_CLEAR)
+      {
+        // Ask the summary for the next element with a bit in the state.
+        index = find_next_element(state ? pnot_empty : pnot_full, index + 1);
+
+        if (index == size_t(ihierarchical_bitset::npos))
+        {
+          return ihierarchical_bitset::npos;
+        }
+
+        value = in_state(index, state);
+      }
+
+      return (index * BITS_PER_ELEMENT) + lowest_bit(value);
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    ihierarchical_bitset& operator =(const ihierarchical_bitset& other)
+    {
+      if (this != &other)
+      {
+        etl::copy_n(other.pdata, SIZE, pdata);
+        etl::copy_n(other.pnot_empty, SUMMARY_SIZE, pnot_empty);
+        etl::copy_n(other.pnot_full, SUMMARY_SIZE, pnot_full);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ihierarchical_bitset(size_t nbits_, size_t size_, element_t* pdata_, size_t summary_size_, element_t* pnot_empty_, element_t* pnot_full_)
+      : NBITS(nbits_),
+        SIZE(size_),
+        SUMMARY_SIZE(summary_size_),
+        TOP_MASK(((nbits_ % BITS_PER_ELEMENT) == 0) ? ALL_SET : ~(ALL_SET << (nbits_ % BITS_PER_ELEMENT))),
+        pdata(pdata_),
+        pnot_empty(pnot_empty_),
+        pnot_full(pnot_full_)
+    {
+    }
+
+    //*************************************************************************
+    /// Compare bitsets.
+    //*************************************************************************
+    static bool is_equal(const ihierarchical_bitset& lhs, const ihierarchical_bitset& rhs)
+    {
+      return etl::equal(lhs.pdata, lhs.pdata + lhs.SIZE, rhs.pdata);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The mask for the bit at the position, within its element.
+    //*************************************************************************
+    static element_t bit(size_t position)
+    {
+      return element_t(1) << (position % BITS_PER_ELEMENT);
+    }
+
+    //*************************************************************************
+    /// The used bits of the element.
+    //*************************************************************************
+    element_t used_mask(size_t index) const
+    {
+      return (index == (SIZE - 1)) ? TOP_MASK : element_t(ALL_SET);
+    }
+
+    //*************************************************************************
+    /// The element, with the bits in the requested state set.
+    //*************************************************************************
+    element_t in_state(size_t index, bool state) const
+    {
+      return state ? pdata[index] : element_t(~pdata[index] & used_mask(index));
+    }
+
+    //*************************************************************************
+    /// Updates the summary bits for one element.
+    //*************************************************************************
+    void update_summaries(size_t index)
+    {
+      const size_t    summary_index = index / BITS_PER_ELEMENT;
+      const element_t summary_bit   = bit(index);
+
+      if (pdata[index] != ALL_CLEAR)
+      {
+        pnot_empty[summary_index] |= summary_bit;
+      }
+      else
+      {
+        pnot_empty[summary_index] &= ~summary_bit;
+      }
+
+      if (pdata[index] != used_mask(index))
+      {
+        pnot_full[summary_index] |= summary_bit;
+      }
+      else
+      {
+        pnot_full[summary_index] &= ~summary_bit;
+      }
+    }
+
+    //*************************************************************************
+    /// Rebuilds both summaries.
+    //*************************************************************************
+    void update_summaries()
+    {
+      for (size_t i = 0; i < SUMMARY_SIZE; ++i)
+      {
+        pnot_empty[i] = ALL_CLEAR;
+        pnot_full[i]  = ALL_CLEAR;
+      }
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        update_summaries(i);
+      }
+    }
+
+    //*************************************************************************
+    /// Is any bit set in the summary?
+    //*************************************************************************
+    bool summary_any(const element_t* psummary) const
+    {
+      for (size_t i = 0; i < SUMMARY_SIZE; ++i)
+      {
+        if (psummary[i] != ALL_CLEAR)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Finds the index of the next element at or after 'index' flagged in the summary.
+    //*************************************************************************
+    size_t find_next_element(const element_t* psummary, size_t index) const
+    {
+      if (index >= SIZE)
+      {
+        return ihierarchical_bitset::npos;
+      }
+
+      size_t    summary_index = index / BITS_PER_ELEMENT;
+      element_t value         = psummary[summary_index] & (ALL_SET << (index % BITS_PER_ELEMENT));
+
+      while (value == ALL_CLEAR)
+      {
+        if (++summary_index == SUMMARY_SIZE)
+        {
+          return ihierarchical_bitset::npos;
+        }
+
+        value = psummary[summary_index];
+      }
+
+      return (summary_index * BITS_PER_ELEMENT) + lowest_bit(value);
+    }
+
+    //*************************************************************************
+    /// Counts the set bits in an element.
+    //*************************************************************************
+    static size_t count_element(element_t value)
+    {
+      return size_t(etl::count_bits(value));
+    }
+
+    //*************************************************************************
+    /// The position of the lowest set bit in a non-zero element.
+    //*************************************************************************
+    static size_t lowest_bit(element_t value)
+    {
+      return size_t(etl::count_trailing_zeros(value));
+    }
+
+    // Disable copy construction.
+    ihierarchical_bitset(const ihierarchical_bitset&);
+
+    const size_t    NBITS;
+    const size_t    SIZE;
+    const size_t    SUMMARY_SIZE;
+    const element_t TOP_MASK;
+    element_t*      pdata;
+    element_t*      pnot_empty;
+    element_t*      pnot_full;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_HIERARCHICAL_BITSET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ihierarchical_bitset()
+    {
+    }
+#else
+  protected:
+    ~ihierarchical_bitset()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A bitset with a summary level, for fast searches of large bitsets.
+  ///\tparam MAXN The number of bits.
+  ///\ingroup hierarchical_bitset
+  //*************************************************************************
+  template <const size_t MAXN>
+  class hierarchical_bitset : public etl::ihierarchical_bitset
+  {
+    static const size_t ARRAY_SIZE   = (MAXN + BITS_PER_ELEMENT - 1) / BITS_PER_ELEMENT;
+    static const size_t SUMMARY_SIZE = (ARRAY_SIZE + BITS_PER_ELEMENT - 1) / BITS_PER_ELEMENT;
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    hierarchical_bitset()
+      : etl::ihierarchical_bitset(MAXN, ARRAY_SIZE, data, SUMMARY_SIZE, not_empty, not_full)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    hierarchical_bitset(const hierarchical_bitset<MAXN>& other)
+      : etl::ihierarchical_bitset(MAXN, ARRAY_SIZE, data, SUMMARY_SIZE, not_empty, not_full)
+    {
+      ihierarchical_bitset::operator =(other);
+    }
+
+    //*************************************************************************
+    /// operator =
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& operator =(const hierarchical_bitset<MAXN>& other)
+    {
+      ihierarchical_bitset::operator =(other);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set all of the bits.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& set()
+    {
+      ihierarchical_bitset::set();
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& set(size_t position, bool value = true)
+    {
+      ihierarchical_bitset::set(position, value);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset all of the bits.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& reset()
+    {
+      ihierarchical_bitset::reset();
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& reset(size_t position)
+    {
+      ihierarchical_bitset::reset(position);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flip all of the bits.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& flip()
+    {
+      ihierarchical_bitset::flip();
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flip the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset<MAXN>& flip(size_t position)
+    {
+      ihierarchical_bitset::flip(position);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// operator ==
+    //*************************************************************************
+    friend bool operator ==(const hierarchical_bitset<MAXN>& lhs, const hierarchical_bitset<MAXN>& rhs)
+    {
+      return etl::ihierarchical_bitset::is_equal(lhs, rhs);
+    }
+
+  private:
+
+    element_t data[ARRAY_SIZE];
+    element_t not_empty[SUMMARY_SIZE];
+    element_t not_full[SUMMARY_SIZE];
+  };
+
+  //***************************************************************************
+  /// operator !=
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  template <const size_t MAXN>
+  bool operator !=(const hierarchical_bitset<MAXN>& lhs, const hierarchical_bitset<MAXN>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
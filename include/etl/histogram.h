@@ -0,0 +1,349 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HISTOGRAM_INCLUDED
+#define ETL_HISTOGRAM_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "binary.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup histogram histogram
+/// A log-linear histogram of unsigned values, as used for latency
+/// measurements.
+/// Values below 2^PRECISION each have their own bucket. Above that, every
+/// power of two range is split into 2^PRECISION equal buckets, so a value
+/// is reported to within 1 part in 2^PRECISION of its true value.
+/// The bucket index is found with a leading zero count, so recording is O(1)
+/// and is a relaxed atomic increment, safe from any number of threads and
+/// from interrupts.
+///\ingroup utilities
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_histogram
+  {
+    //*************************************************************************
+    /// The number of bits needed to represent VALUE.
+    //*************************************************************************
+    template <const uint64_t VALUE>
+    struct bit_width
+    {
+      static const size_t value = 1U + bit_width<(VALUE >> 1U)>::value;
+    };
+
+    template <>
+    struct bit_width<0U>
+    {
+      static const size_t value = 0U;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup histogram
+  /// A fixed size, lock-free log-linear histogram.
+  ///\tparam MAX_VALUE The largest value tracked. Larger values are recorded as MAX_VALUE.
+  ///\tparam PRECISION The number of bits of each value that are kept. Default 3, within 12.5%.
+  ///\tparam TCount    The type of the bucket counts.
+  //***************************************************************************
+  template <const uint64_t MAX_VALUE, const size_t PRECISION = 3U, typename TCount = uint32_t>
+  class histogram
+  {
+  private:
+
+    static const size_t VALUE_BITS = private_histogram::bit_width<MAX_VALUE>::value;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_VALUE > 0U, "histogram MAX_VALUE must be greater than zero");
+    ETL_STATIC_ASSERT((PRECISION > 0U) && (PRECISION < 16U), "histogram PRECISION must be 1 to 15");
+
+    typedef typename etl::conditional<(VALUE_BITS > 32U), uint64_t, uint32_t>::type value_type;
+    typedef TCount                                                                  count_type;
+    typedef size_t                                                                  size_type;
+
+    static const size_t SUB_BUCKETS = size_t(1U) << PRECISION;
+    static const size_t GROUPS      = (VALUE_BITS > PRECISION) ? (VALUE_BITS - PRECISION + 1U) : 1U;
+    static const size_t BUCKETS     = GROUPS * SUB_BUCKETS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    histogram()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Records a value.
+    //*************************************************************************
+    void record(value_type value)
+    {
+      if (value > MAX_VALUE)
+      {
+        value = value_type(MAX_VALUE);
+      }
+
+      counts[index_of(value)].fetch_add(1U, etl::memory_order_relaxed);
+      total.fetch_add(1U, etl::memory_order_relaxed);
+      value_sum.fetch_add(value, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Records a range of values, such as the samples of an etl::benchmark.
+    //*************************************************************************
+    template <typename TIterator>
+    void record(TIterator begin, TIterator end)
+    {
+      while (begin != end)
+      {
+        record(value_type(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the counts of another histogram to this one.
+    /// Used to take a snapshot, into an empty histogram, or to combine the
+    /// histograms of several threads or cores.
+    //*************************************************************************
+    void merge(const histogram& other)
+    {
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        counts[i].fetch_add(other.bucket(i), etl::memory_order_relaxed);
+      }
+
+      total.fetch_add(other.count(), etl::memory_order_relaxed);
+      value_sum.fetch_add(other.sum(), etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Sets every count to zero. Not atomic with respect to recorders.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        counts[i].store(0U, etl::memory_order_relaxed);
+      }
+
+      total.store(0U, etl::memory_order_relaxed);
+      value_sum.store(0U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of values recorded.
+    //*************************************************************************
+    count_type count() const
+    {
+      return total.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The sum of the values recorded.
+    //*************************************************************************
+    value_type sum() const
+    {
+      return value_sum.load(etl::memory_order_relaxed);
+    }
+
+    bool empty() const
+    {
+      return count() == 0U;
+    }
+
+    //*************************************************************************
+    /// The value at the percentile, 0 to 100.
+    //*************************************************************************
+    value_type percentile(size_t percent) const
+    {
+      return quantile(percent, 100U);
+    }
+
+    //*************************************************************************
+    /// The value at the quantile numerator / denominator.
+    /// For example, quantile(999, 1000) for the 99.9th percentile.
+    /// Returns the highest value that is in the same bucket as the quantile,
+    /// or 0 if the histogram is empty.
+    //*************************************************************************
+    value_type quantile(uint64_t numerator, uint64_t denominator) const
+    {
+      const uint64_t n = count();
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      uint64_t rank = ((n * numerator) + denominator - 1U) / denominator;
+
+      if (rank == 0U)
+      {
+        rank = 1U;
+      }
+
+      uint64_t cumulative = 0U;
+
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        cumulative += bucket(i);
+
+        if (cumulative >= rank)
+        {
+          return highest_in_bucket(i);
+        }
+      }
+
+      return value_type(MAX_VALUE);
+    }
+
+    //*************************************************************************
+    /// The lowest value that is in the same bucket as the smallest recorded.
+    //*************************************************************************
+    value_type min() const
+    {
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        if (bucket(i) != 0U)
+        {
+          return lowest_in_bucket(i);
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The highest value that is in the same bucket as the largest recorded.
+    //*************************************************************************
+    value_type max() const
+    {
+      for (size_t i = BUCKETS; i > 0U; --i)
+      {
+        if (bucket(i - 1U) != 0U)
+        {
+          return highest_in_bucket(i - 1U);
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The buckets, for export.
+    //*************************************************************************
+    size_type buckets() const
+    {
+      return BUCKETS;
+    }
+
+    count_type bucket(size_t i) const
+    {
+      return counts[i].load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The bucket that a value is counted in.
+    //*************************************************************************
+    static size_t index_of(value_type value)
+    {
+      if (value < SUB_BUCKETS)
+      {
+        return size_t(value);
+      }
+
+      const size_t msb   = (sizeof(value_type) * 8U) - 1U - etl::count_leading_zeros(value);
+      const size_t shift = msb - PRECISION;
+
+      return ((shift + 1U) << PRECISION) + size_t((value >> shift) - SUB_BUCKETS);
+    }
+
+    //*************************************************************************
+    /// The range of values counted in a bucket.
+    //*************************************************************************
+    static value_type lowest_in_bucket(size_t i)
+    {
+      const size_t group    = i >> PRECISION;
+      const size_t mantissa = i & (SUB_BUCKETS - 1U);
+
+      if (group == 0U)
+      {
+        return value_type(mantissa);
+      }
+
+      return value_type(SUB_BUCKETS + mantissa) << (group - 1U);
+    }
+
+    static value_type highest_in_bucket(size_t i)
+    {
+      const size_t group = i >> PRECISION;
+
+      value_type highest = lowest_in_bucket(i);
+
+      if (group != 0U)
+      {
+        highest += (value_type(1U) << (group - 1U)) - 1U;
+      }
+
+      return (highest > MAX_VALUE) ? value_type(MAX_VALUE) : highest;
+    }
+
+  private:
+
+    // Disabled.
+    histogram(const histogram&);
+    histogram& operator =(const histogram&);
+
+    etl::atomic<count_type> counts[BUCKETS];
+    etl::atomic<count_type> total;
+    etl::atomic<value_type> value_sum;
+  };
+
+  template <const uint64_t MAX_VALUE, const size_t PRECISION, typename TCount>
+  const size_t histogram<MAX_VALUE, PRECISION, TCount>::SUB_BUCKETS;
+
+  template <const uint64_t MAX_VALUE, const size_t PRECISION, typename TCount>
+  const size_t histogram<MAX_VALUE, PRECISION, TCount>::GROUPS;
+
+  template <const uint64_t MAX_VALUE, const size_t PRECISION, typename TCount>
+  const size_t histogram<MAX_VALUE, PRECISION, TCount>::BUCKETS;
+}
+
+#endif // ETL_HAS_ATOMIC
+
+#endif
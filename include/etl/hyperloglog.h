@@ -0,0 +1,330 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HYPERLOGLOG_INCLUDED
+#define ETL_HYPERLOGLOG_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "binary.h"
+#include "static_assert.h"
+
+///\defgroup hyperloglog hyperloglog
+/// A HyperLogLog estimator of the number of distinct values seen.
+/// Uses 2^PRECISION bytes, whatever the number of values. The standard error
+/// of the estimate is about 1.04 / sqrt(2^PRECISION), 1.6% for a precision
+/// of 12.
+///\ingroup containers
+
+namespace etl
+{
+  namespace private_hyperloglog
+  {
+    //*************************************************************************
+    /// The murmur3 64 bit finaliser.
+    /// Spreads the bits of hashes that are narrower than 64 bits, or weak.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t hash)
+    {
+      hash ^= hash >> 33;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// 2^-rank for each possible register value.
+    //*************************************************************************
+    template <typename T = void>
+    struct inverse_powers
+    {
+      static const double table[65];
+    };
+
+    template <typename T>
+    const double inverse_powers<T>::table[65] =
+    {
+      1.0 / 1.0,
+      1.0 / 2.0,
+      1.0 / 4.0,
+      1.0 / 8.0,
+      1.0 / 16.0,
+      1.0 / 32.0,
+      1.0 / 64.0,
+      1.0 / 128.0,
+      1.0 / 256.0,
+      1.0 / 512.0,
+      1.0 / 1024.0,
+      1.0 / 2048.0,
+      1.0 / 4096.0,
+      1.0 / 8192.0,
+      1.0 / 16384.0,
+      1.0 / 32768.0,
+      1.0 / 65536.0,
+      1.0 / 131072.0,
+      1.0 / 262144.0,
+      1.0 / 524288.0,
+      1.0 / 1048576.0,
+      1.0 / 2097152.0,
+      1.0 / 4194304.0,
+      1.0 / 8388608.0,
+      1.0 / 16777216.0,
+      1.0 / 33554432.0,
+      1.0 / 67108864.0,
+      1.0 / 134217728.0,
+      1.0 / 268435456.0,
+      1.0 / 536870912.0,
+      1.0 / 1073741824.0,
+      1.0 / 2147483648.0,
+      1.0 / 4294967296.0,
+      1.0 / 8589934592.0,
+      1.0 / 17179869184.0,
+      1.0 / 34359738368.0,
+      1.0 / 68719476736.0,
+      1.0 / 137438953472.0,
+      1.0 / 274877906944.0,
+      1.0 / 549755813888.0,
+      1.0 / 1099511627776.0,
+      1.0 / 2199023255552.0,
+      1.0 / 4398046511104.0,
+      1.0 / 8796093022208.0,
+      1.0 / 17592186044416.0,
+      1.0 / 35184372088832.0,
+      1.0 / 70368744177664.0,
+      1.0 / 140737488355328.0,
+      1.0 / 281474976710656.0,
+      1.0 / 562949953421312.0,
+      1.0 / 1125899906842624.0,
+      1.0 / 2251799813685248.0,
+      1.0 / 4503599627370496.0,
+      1.0 / 9007199254740992.0,
+      1.0 / 18014398509481984.0,
+      1.0 / 36028797018963968.0,
+      1.0 / 72057594037927936.0,
+      1.0 / 144115188075855872.0,
+      1.0 / 288230376151711744.0,
+      1.0 / 576460752303423488.0,
+      1.0 / 1152921504606846976.0,
+      1.0 / 2305843009213693952.0,
+      1.0 / 4611686018427387904.0,
+      1.0 / 9223372036854775808.0,
+      1.0 / 18446744073709551616.0
+    };
+  }
+
+  //***************************************************************************
+  /// A HyperLogLog distinct value estimator.
+  /// Each value is hashed; the top PRECISION bits of the hash select a
+  /// register, which keeps the longest run of leading zeros seen in the
+  /// rest. Sketches with the same precision and hash may be merged, so
+  /// several producers can each keep a sketch, combined when read.
+  ///\tparam PRECISION The log2 of the number of registers. 4 to 16.
+  ///\tparam THash     The hash functor. Must define 'argument_type'.
+  ///\ingroup hyperloglog
+  //***************************************************************************
+  template <const size_t PRECISION_, typename THash>
+  class hyperloglog
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((PRECISION_ >= 4U) && (PRECISION_ <= 16U), "PRECISION must be from 4 to 16");
+
+    static const size_t PRECISION = PRECISION_;
+    static const size_t REGISTERS = size_t(1U) << PRECISION_;
+
+    typedef THash hasher;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    hyperloglog()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Forgets all values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < REGISTERS; ++i)
+      {
+        registers[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    void add(parameter_t value)
+    {
+      add_hash(static_cast<uint64_t>(hash(value)));
+    }
+
+    //*************************************************************************
+    /// Adds a value that has already been hashed with THash.
+    //*************************************************************************
+    void add_hash(uint64_t value_hash)
+    {
+      const uint64_t h    = private_hyperloglog::mix(value_hash);
+      const size_t   i    = size_t(h >> (64U - PRECISION));
+      const uint64_t rest = (h << PRECISION) | (uint64_t(1U) << (PRECISION - 1U)); // The guard bit caps the rank.
+      const uint8_t  rank = uint8_t(etl::count_leading_zeros(rest) + 1U);
+
+      registers[i] = (rank > registers[i]) ? rank : registers[i];
+    }
+
+    //*************************************************************************
+    /// Merges in the values of another sketch.
+    /// The result is as if all of the values had been added to this one.
+    //*************************************************************************
+    void merge(const hyperloglog& other)
+    {
+      for (size_t i = 0U; i < REGISTERS; ++i)
+      {
+        registers[i] = (other.registers[i] > registers[i]) ? other.registers[i] : registers[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Estimates the number of distinct values added.
+    /// The loop over the registers has no branches, so may be vectorised.
+    //*************************************************************************
+    double estimate() const
+    {
+      const double* inverse = private_hyperloglog::inverse_powers<>::table;
+
+      double sum   = 0.0;
+      size_t zeros = 0U;
+
+      for (size_t i = 0U; i < REGISTERS; ++i)
+      {
+        sum   += inverse[registers[i]];
+        zeros += (registers[i] == 0U) ? 1U : 0U;
+      }
+
+      const double m   = double(REGISTERS);
+      const double raw = alpha() * m * m / sum;
+
+      // Linear counting is more accurate while many registers are empty.
+      if ((raw <= (2.5 * m)) && (zeros != 0U))
+      {
+        return m * ::log(m / double(zeros));
+      }
+
+      return raw;
+    }
+
+    //*************************************************************************
+    /// The estimate rounded to the nearest integer.
+    //*************************************************************************
+    size_t count() const
+    {
+      return size_t(estimate() + 0.5);
+    }
+
+    //*************************************************************************
+    /// True if no values have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      for (size_t i = 0U; i < REGISTERS; ++i)
+      {
+        if (registers[i] != 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The expected relative standard error of the estimate.
+    //*************************************************************************
+    static double standard_error()
+    {
+      return 1.04 / ::sqrt(double(REGISTERS));
+    }
+
+    //*************************************************************************
+    /// The registers, for storing or sending a sketch.
+    //*************************************************************************
+    const uint8_t* data() const
+    {
+      return registers;
+    }
+
+    //*************************************************************************
+    /// The registers, for restoring a sketch.
+    //*************************************************************************
+    uint8_t* data()
+    {
+      return registers;
+    }
+
+    //*************************************************************************
+    /// The size of the registers in bytes.
+    //*************************************************************************
+    static size_t size_bytes()
+    {
+      return REGISTERS;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The bias correction constant.
+    //*************************************************************************
+    static double alpha()
+    {
+      return (REGISTERS == 16U) ? 0.673 :
+             (REGISTERS == 32U) ? 0.697 :
+             (REGISTERS == 64U) ? 0.709 :
+                                  0.7213 / (1.0 + (1.079 / double(REGISTERS)));
+    }
+
+    THash   hash;
+    uint8_t registers[REGISTERS];
+  };
+}
+
+#endif
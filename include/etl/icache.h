@@ -0,0 +1,238 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ICACHE_INCLUDED
+#define ETL_ICACHE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "delegate.h"
+
+///\defgroup cache cache
+/// Fixed capacity caches in front of a slower backing store.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A snapshot of the activity of a cache.
+  ///\ingroup cache
+  //***************************************************************************
+  struct cache_statistics
+  {
+    uint32_t hits;        ///< The number of reads and writes that found the key in the cache.
+    uint32_t misses;      ///< The number of reads and writes that did not.
+    uint32_t evictions;   ///< The number of entries evicted to make room for another.
+    uint32_t loads;       ///< The number of values read from the store.
+    uint32_t write_backs; ///< The number of values written to the store.
+  };
+
+  //***************************************************************************
+  /// The base class for all caches.
+  /// Values missing from the cache are read from the store through the read
+  /// delegate. Changed values are written to the store through the write
+  /// delegate, either immediately ('write through') or later ('write back').
+  /// In write back mode the dirty values are written when they are evicted,
+  /// when flush() is called, or in a batch once the number of dirty entries
+  /// reaches the write back limit.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue>
+  class icache
+  {
+  public:
+
+    typedef TKey   key_type;
+    typedef TValue value_type;
+    typedef size_t size_type;
+
+    typedef etl::delegate<bool(const TKey&, TValue&)>       read_delegate_t;  ///< Returns false if the store does not contain the key.
+    typedef etl::delegate<void(const TKey&, const TValue&)> write_delegate_t;
+
+    //*************************************************************************
+    /// Sets the function that reads from the store.
+    //*************************************************************************
+    void set_read_function(const read_delegate_t& reader)
+    {
+      read_store = reader;
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes to the store.
+    //*************************************************************************
+    void set_write_function(const write_delegate_t& writer)
+    {
+      write_store = writer;
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag.
+    /// Switching to write through flushes any dirty values.
+    //*************************************************************************
+    void set_write_through(bool write_through_)
+    {
+      if (write_through_ && !write_through)
+      {
+        flush();
+      }
+
+      write_through = write_through_;
+    }
+
+    //*************************************************************************
+    /// Gets the 'write through' flag.
+    //*************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+    //*************************************************************************
+    /// Sets the number of dirty entries that triggers a flush in write back
+    /// mode. Zero, the default, only writes back on eviction or flush().
+    //*************************************************************************
+    void set_write_back_limit(size_t limit)
+    {
+      write_back_limit = limit;
+
+      if ((write_back_limit != 0U) && (dirty_count >= write_back_limit))
+      {
+        flush();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of dirty entries that triggers a flush.
+    //*************************************************************************
+    size_t get_write_back_limit() const
+    {
+      return write_back_limit;
+    }
+
+    //*************************************************************************
+    /// Gets the number of entries waiting to be written back.
+    //*************************************************************************
+    size_t dirty_size() const
+    {
+      return dirty_count;
+    }
+
+    //*************************************************************************
+    /// Gets a snapshot of the activity of the cache.
+    //*************************************************************************
+    etl::cache_statistics get_statistics() const
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      statistics.hits        = 0U;
+      statistics.misses      = 0U;
+      statistics.evictions   = 0U;
+      statistics.loads       = 0U;
+      statistics.write_backs = 0U;
+    }
+
+    virtual const TValue* read(const TKey& key) = 0;              ///< Reads from the cache. May read from the store using read_store. Returns nullptr if not found.
+    virtual void write(const TKey& key, const TValue& value) = 0; ///< Writes to the cache. May write to the store using write_store.
+    virtual void flush() = 0;                                     ///< Writes all changed values to the store.
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// By default, 'write_through' is set to true.
+    //*************************************************************************
+    icache()
+      : write_through(true)
+      , write_back_limit(0U)
+      , dirty_count(0U)
+    {
+      clear_statistics();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Derived caches must flush, as the base cannot call flush() here.
+    //*************************************************************************
+    virtual ~icache()
+    {
+    }
+
+    //*************************************************************************
+    /// Reads a value from the store, if there is a reader.
+    //*************************************************************************
+    bool load(const TKey& key, TValue& value)
+    {
+      if (read_store.is_valid() && read_store(key, value))
+      {
+        ++statistics.loads;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Writes a value to the store, if there is a writer.
+    //*************************************************************************
+    void store(const TKey& key, const TValue& value)
+    {
+      if (write_store.is_valid())
+      {
+        write_store(key, value);
+        ++statistics.write_backs;
+      }
+    }
+
+    bool     write_through;    ///< If true, changed values are written to the store immediately.
+    size_t   write_back_limit; ///< The number of dirty entries that triggers a flush. 0 for none.
+    size_t   dirty_count;      ///< The number of entries not yet written to the store.
+
+    etl::cache_statistics statistics;
+
+  private:
+
+    read_delegate_t  read_store;  ///< A function that will read a value from the store into the cache.
+    write_delegate_t write_store; ///< A function that will write a value from the cache into the store.
+
+    // Should not be copied.
+    icache(const icache&);
+    icache& operator =(const icache&);
+  };
+}
+
+#endif
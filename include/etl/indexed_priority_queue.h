@@ -0,0 +1,693 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+
+#undef ETL_FILE
+#define ETL_FILE "65"
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A fixed capacity priority queue that returns a handle for each value.
+/// The handle can be used to change the priority of, or remove, a value that
+/// is not at the top of the queue, in O(log n).
+/// Values stay where they were constructed; only their handles move in the heap.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for indexed_priority_queue exceptions.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public etl::exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is empty.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_empty : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_empty(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a value in the queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_invalid_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:invalid handle", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// The base for all indexed priority queues that contain a particular type.
+  /// The heap is an array of handles. Every handle has a slot for its value
+  /// and records its position in the heap. The handles after the last heap
+  /// position are the free ones.
+  ///\tparam T        The type of value held.
+  ///\tparam TCompare The comparison. The greatest value is at the top.
+  ///\tparam ARITY    The number of children of each heap node.
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class iindexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT((ARITY >= 2U), "A heap must have at least two children per node");
+
+    typedef T        value_type;
+    typedef TCompare compare_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&      rvalue_reference;
+#endif
+    typedef size_t   size_type;
+    typedef size_t   handle_type;
+
+    //*************************************************************************
+    /// Gets the highest priority value.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_empty if the queue is empty.
+    //*************************************************************************
+    const_reference top() const
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(indexed_priority_queue_empty));
+#endif
+      return p_values[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_empty if the queue is empty.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(indexed_priority_queue_empty));
+#endif
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Gets the value for the handle.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Checks if the handle refers to a value in the queue.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < CAPACITY) && (p_position[handle] < current_size);
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (p_values + handle) T(value);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      sift_up(current_size++);
+
+      return handle;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type push(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (p_values + handle) T(etl::move(value));
+      ETL_INCREMENT_DEBUG_COUNT
+
+      sift_up(current_size++);
+
+      return handle;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_empty if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(indexed_priority_queue_empty));
+#endif
+      remove_at(0U);
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value, assigns it to destination and
+    /// removes it from the queue.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+#if ETL_CPP11_SUPPORTED
+      destination = etl::move(p_values[top_handle()]);
+#else
+      destination = top();
+#endif
+      pop();
+    }
+
+    //*************************************************************************
+    /// Changes the value for the handle and restores the heap order.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      p_values[handle] = value;
+      restore(p_position[handle]);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Changes the value for the handle and restores the heap order.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void update(handle_type handle, rvalue_reference value)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      p_values[handle] = etl::move(value);
+      restore(p_position[handle]);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value for the handle.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      remove_at(p_position[handle]);
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the queue.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Removes all values.
+    /// All handles become free.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        current_size = 0U;
+        ETL_RESET_DEBUG_COUNT
+      }
+      else
+      {
+        while (current_size != 0U)
+        {
+          remove_at(current_size - 1U);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The handles of the copied values are kept.
+    //*************************************************************************
+    iindexed_priority_queue& operator =(const iindexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        clone(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_values_, handle_type* p_heap_, size_type* p_position_, size_t capacity_)
+      : p_values(p_values_),
+        p_heap(p_heap_),
+        p_position(p_position_),
+        current_size(0U),
+        CAPACITY(capacity_)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Makes every handle free.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_heap[i]     = i;
+        p_position[i] = i;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes this a copy of the other queue, keeping its handles.
+    //*************************************************************************
+    void clone(const iindexed_priority_queue& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(indexed_priority_queue_full));
+
+      clear();
+      initialise();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+        ::new (p_values + handle) T(other.p_values[handle]);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        place(i, handle);
+      }
+
+      complete_clone(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the values of the other queue in to this one, keeping their
+    /// handles. The other queue is left empty.
+    //*************************************************************************
+    void move_clone(iindexed_priority_queue& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(indexed_priority_queue_full));
+
+      clear();
+      initialise();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+        ::new (p_values + handle) T(etl::move(other.p_values[handle]));
+        ETL_INCREMENT_DEBUG_COUNT
+
+        place(i, handle);
+      }
+
+      complete_clone(other);
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Puts the handle at the heap position, swapping out the handle that was there.
+    //*************************************************************************
+    void place(size_t index, handle_type handle)
+    {
+      const size_t      old_index  = p_position[handle];
+      const handle_type old_handle = p_heap[index];
+
+      p_heap[old_index]      = old_handle;
+      p_position[old_handle] = old_index;
+
+      p_heap[index]      = handle;
+      p_position[handle] = index;
+    }
+
+    //*************************************************************************
+    /// Completes a clone once the values have been placed.
+    //*************************************************************************
+    void complete_clone(const iindexed_priority_queue& other)
+    {
+      current_size = other.current_size;
+      compare      = other.compare;
+    }
+
+    //*************************************************************************
+    /// Destroys the value at the heap position and restores the heap order.
+    //*************************************************************************
+    void remove_at(size_t index)
+    {
+      const handle_type handle = p_heap[index];
+
+      etl::destroy_at(p_values + handle);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      // Move the last handle in to the hole and free the removed one.
+      --current_size;
+      place(index, p_heap[current_size]);
+
+      if (index < current_size)
+      {
+        restore(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Restores the heap order after the value at the position changed.
+    //*************************************************************************
+    void restore(size_t index)
+    {
+      if ((index > 0U) && compare(p_values[p_heap[(index - 1U) / ARITY]], p_values[p_heap[index]]))
+      {
+        sift_up(index);
+      }
+      else
+      {
+        sift_down(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the handle at the position towards the top.
+    //*************************************************************************
+    void sift_up(size_t index)
+    {
+      const handle_type handle = p_heap[index];
+      const_reference   value  = p_values[handle];
+
+      while (index > 0U)
+      {
+        const size_t parent = (index - 1U) / ARITY;
+
+        if (!compare(p_values[p_heap[parent]], value))
+        {
+          break;
+        }
+
+        p_heap[index] = p_heap[parent];
+        p_position[p_heap[index]] = index;
+        index = parent;
+      }
+
+      p_heap[index]      = handle;
+      p_position[handle] = index;
+    }
+
+    //*************************************************************************
+    /// Moves the handle at the position towards the bottom.
+    //*************************************************************************
+    void sift_down(size_t index)
+    {
+      const handle_type handle = p_heap[index];
+      const_reference   value  = p_values[handle];
+
+      while (true)
+      {
+        size_t child = (index * ARITY) + 1U;
+
+        if (child >= current_size)
+        {
+          break;
+        }
+
+        const size_t end = etl::min(child + ARITY, current_size);
+
+        size_t best = child;
+
+        for (++child; child < end; ++child)
+        {
+          if (compare(p_values[p_heap[best]], p_values[p_heap[child]]))
+          {
+            best = child;
+          }
+        }
+
+        if (!compare(value, p_values[p_heap[best]]))
+        {
+          break;
+        }
+
+        p_heap[index] = p_heap[best];
+        p_position[p_heap[index]] = index;
+        index = best;
+      }
+
+      p_heap[index]      = handle;
+      p_position[handle] = index;
+    }
+
+    // Disable copy construction.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+
+    T*           p_values;     ///< The value for each handle.
+    handle_type* p_heap;       ///< The handles in heap order, followed by the free handles.
+    size_type*   p_position;   ///< The heap position of each handle.
+    size_type    current_size; ///< The number of values in the queue.
+    const size_type CAPACITY;  ///< The maximum number of values in the queue.
+    TCompare     compare;
+
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INDEXED_PRIORITY_QUEUE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iindexed_priority_queue()
+    {
+    }
+#else
+  protected:
+    ~iindexed_priority_queue()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// An indexed priority queue with the capacity defined at compile time.
+  ///\tparam T         The type of value held.
+  ///\tparam MAX_SIZE_ The maximum number of values held.
+  ///\tparam TCompare  The comparison. The greatest value is at the top.
+  ///\tparam ARITY     The number of children of each heap node.
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, ARITY>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::indexed_priority_queue is not valid");
+
+    typedef etl::iindexed_priority_queue<T, TCompare, ARITY> base_t;
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base_t(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other)
+      : base_t(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+      base_t::clone(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    indexed_priority_queue(indexed_priority_queue&& other)
+      : base_t(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+      base_t::move_clone(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(const indexed_priority_queue& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(indexed_priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The value memory.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+
+    /// The handles in heap order.
+    typename base_t::handle_type heap[MAX_SIZE_];
+
+    /// The heap position of each handle.
+    typename base_t::size_type position[MAX_SIZE_];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
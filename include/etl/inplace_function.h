@@ -0,0 +1,450 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INPLACE_FUNCTION_INCLUDED
+#define ETL_INPLACE_FUNCTION_INCLUDED
+
+#include <stddef.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "largest.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#if ETL_CPP11_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "68"
+
+//*****************************************************************************
+///\defgroup inplace_function inplace_function
+/// An owning callable wrapper with fixed inline capture storage.
+/// Never allocates. Calls are dispatched through a single function pointer.
+/// Copy, move and destruction of the stored callable go through a second,
+/// 'manager', function pointer that is not on the call path.
+/// Stored callables must be copy constructible.
+///\ingroup utilities
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for inplace_function exceptions.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  class inplace_function_exception : public exception
+  {
+  public:
+
+    inplace_function_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an empty inplace_function is called.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  class inplace_function_uninitialised : public inplace_function_exception
+  {
+  public:
+
+    inplace_function_uninitialised(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:uninitialised", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_inplace_function
+  {
+    //*************************************************************************
+    /// The stored type for a callable. Functions are stored as pointers.
+    //*************************************************************************
+    template <typename T>
+    struct stored_type
+    {
+      typedef typename etl::decay<T>::type type;
+    };
+
+    template <typename TReturn, typename... TParams>
+    struct stored_type<TReturn(TParams...)>
+    {
+      typedef TReturn(*type)(TParams...);
+    };
+
+    template <typename TReturn, typename... TParams>
+    struct stored_type<TReturn(&)(TParams...)>
+    {
+      typedef TReturn(*type)(TParams...);
+    };
+
+    //*************************************************************************
+    /// Null function pointers give an empty inplace_function.
+    //*************************************************************************
+    template <typename T>
+    bool is_null(const T&)
+    {
+      return false;
+    }
+
+    template <typename TReturn, typename... TParams>
+    bool is_null(TReturn(* const& p)(TParams...))
+    {
+      return p == nullptr;
+    }
+
+    //*************************************************************************
+    /// The operations performed by the manager function.
+    //*************************************************************************
+    enum operation
+    {
+      Copy,
+      Move,
+      Destroy
+    };
+  }
+
+  /// The default inline storage. Enough for a few captured pointers.
+  static const size_t inplace_function_default_capacity  = 4U * sizeof(void*);
+  static const size_t inplace_function_default_alignment = etl::largest_alignment<void*, double, int64_t>::value;
+
+  template <typename TSignature,
+            const size_t CAPACITY_  = inplace_function_default_capacity,
+            const size_t ALIGNMENT_ = inplace_function_default_alignment>
+  class inplace_function;
+
+  //***************************************************************************
+  /// An owning callable with CAPACITY bytes of inline storage.
+  ///\tparam TReturn   The return type.
+  ///\tparam TParams   The parameter types.
+  ///\tparam CAPACITY  The size of the inline storage.
+  ///\tparam ALIGNMENT The alignment of the inline storage.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  template <typename TReturn, typename... TParams, const size_t CAPACITY_, const size_t ALIGNMENT_>
+  class inplace_function<TReturn(TParams...), CAPACITY_, ALIGNMENT_>
+  {
+  public:
+
+    static const size_t CAPACITY  = CAPACITY_;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+
+    //*************************************************************************
+    /// Default constructor. Empty.
+    //*************************************************************************
+    inplace_function()
+      : invoker(nullptr)
+      , manager(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct empty from nullptr.
+    //*************************************************************************
+    inplace_function(std::nullptr_t)
+      : invoker(nullptr)
+      , manager(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a callable, which is copied or moved into the inline storage.
+    //*************************************************************************
+    template <typename TCallable,
+              typename = typename etl::enable_if<!etl::is_same<typename etl::decay<TCallable>::type, inplace_function>::value>::type>
+    inplace_function(TCallable&& callable)
+      : invoker(nullptr)
+      , manager(nullptr)
+    {
+      emplace(etl::forward<TCallable>(callable));
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inplace_function(const inplace_function& other)
+      : invoker(other.invoker)
+      , manager(other.manager)
+    {
+      if (manager != nullptr)
+      {
+        manager(private_inplace_function::Copy, &storage, const_cast<void*>(static_cast<const void*>(&other.storage)));
+      }
+    }
+
+    //*************************************************************************
+    /// Move constructor. Leaves 'other' empty.
+    //*************************************************************************
+    inplace_function(inplace_function&& other)
+      : invoker(other.invoker)
+      , manager(other.manager)
+    {
+      if (manager != nullptr)
+      {
+        manager(private_inplace_function::Move, &storage, &other.storage);
+      }
+
+      other.invoker = nullptr;
+      other.manager = nullptr;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inplace_function()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    inplace_function& operator =(const inplace_function& rhs)
+    {
+      if (this != &rhs)
+      {
+        clear();
+
+        if (rhs.manager != nullptr)
+        {
+          rhs.manager(private_inplace_function::Copy, &storage, const_cast<void*>(static_cast<const void*>(&rhs.storage)));
+        }
+
+        invoker = rhs.invoker;
+        manager = rhs.manager;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment. Leaves 'rhs' empty.
+    //*************************************************************************
+    inplace_function& operator =(inplace_function&& rhs)
+    {
+      if (this != &rhs)
+      {
+        clear();
+
+        if (rhs.manager != nullptr)
+        {
+          rhs.manager(private_inplace_function::Move, &storage, &rhs.storage);
+        }
+
+        invoker = rhs.invoker;
+        manager = rhs.manager;
+
+        rhs.invoker = nullptr;
+        rhs.manager = nullptr;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign nullptr. Becomes empty.
+    //*************************************************************************
+    inplace_function& operator =(std::nullptr_t)
+    {
+      clear();
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a callable.
+    //*************************************************************************
+    template <typename TCallable,
+              typename = typename etl::enable_if<!etl::is_same<typename etl::decay<TCallable>::type, inplace_function>::value>::type>
+    inplace_function& operator =(TCallable&& callable)
+    {
+      clear();
+      emplace(etl::forward<TCallable>(callable));
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Call the stored callable.
+    /// If asserts or exceptions are enabled then an etl::inplace_function_uninitialised
+    /// is emitted if the function is empty.
+    //*************************************************************************
+    TReturn operator()(TParams... params) const
+    {
+      ETL_ASSERT(invoker != nullptr, ETL_ERROR(inplace_function_uninitialised));
+
+      return invoker(const_cast<void*>(static_cast<const void*>(&storage)), etl::forward<TParams>(params)...);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if a callable is stored.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return invoker != nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if a callable is stored.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// Destroys the stored callable.
+    //*************************************************************************
+    void clear()
+    {
+      if (manager != nullptr)
+      {
+        manager(private_inplace_function::Destroy, &storage, nullptr);
+      }
+
+      invoker = nullptr;
+      manager = nullptr;
+    }
+
+    //*************************************************************************
+    /// Swaps with another inplace_function.
+    //*************************************************************************
+    void swap(inplace_function& other)
+    {
+      inplace_function temp(etl::move(other));
+      other = etl::move(*this);
+      *this = etl::move(temp);
+    }
+
+  private:
+
+    typedef TReturn (*invoker_type)(void* object, TParams&&... params);
+    typedef void    (*manager_type)(private_inplace_function::operation op, void* destination, void* source);
+
+    //*************************************************************************
+    /// Constructs the callable in the inline storage.
+    //*************************************************************************
+    template <typename TCallable>
+    void emplace(TCallable&& callable)
+    {
+      typedef typename private_inplace_function::stored_type<TCallable>::type stored_t;
+
+      ETL_STATIC_ASSERT(sizeof(stored_t) <= CAPACITY, "Callable is too large for the inline storage");
+      ETL_STATIC_ASSERT((ALIGNMENT % etl::alignment_of<stored_t>::value) == 0, "Callable has incompatible alignment");
+
+      if (!private_inplace_function::is_null(callable))
+      {
+        ::new (static_cast<void*>(&storage)) stored_t(etl::forward<TCallable>(callable));
+        invoker = &invoke<stored_t>;
+        manager = &manage<stored_t>;
+      }
+    }
+
+    //*************************************************************************
+    /// Calls the stored callable.
+    //*************************************************************************
+    template <typename TStored>
+    static TReturn invoke(void* object, TParams&&... params)
+    {
+      return (*static_cast<TStored*>(object))(etl::forward<TParams>(params)...);
+    }
+
+    //*************************************************************************
+    /// Copies, moves or destroys the stored callable.
+    //*************************************************************************
+    template <typename TStored>
+    static void manage(private_inplace_function::operation op, void* destination, void* source)
+    {
+      switch (op)
+      {
+        case private_inplace_function::Copy:
+        {
+          ::new (destination) TStored(*static_cast<const TStored*>(source));
+          break;
+        }
+
+        case private_inplace_function::Move:
+        {
+          TStored* p = static_cast<TStored*>(source);
+          ::new (destination) TStored(etl::move(*p));
+          p->~TStored();
+          break;
+        }
+
+        case private_inplace_function::Destroy:
+        default:
+        {
+          static_cast<TStored*>(destination)->~TStored();
+          break;
+        }
+      }
+    }
+
+    invoker_type invoker;
+    manager_type manager;
+    typename etl::aligned_storage<CAPACITY, ALIGNMENT>::type storage;
+  };
+
+  //***************************************************************************
+  /// Swaps two inplace_functions.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  template <typename TSignature, const size_t CAPACITY, const size_t ALIGNMENT>
+  void swap(etl::inplace_function<TSignature, CAPACITY, ALIGNMENT>& lhs, etl::inplace_function<TSignature, CAPACITY, ALIGNMENT>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  //***************************************************************************
+  /// Compare with nullptr.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  template <typename TSignature, const size_t CAPACITY, const size_t ALIGNMENT>
+  bool operator ==(const etl::inplace_function<TSignature, CAPACITY, ALIGNMENT>& lhs, std::nullptr_t)
+  {
+    return !lhs.is_valid();
+  }
+
+  template <typename TSignature, const size_t CAPACITY, const size_t ALIGNMENT>
+  bool operator !=(const etl::inplace_function<TSignature, CAPACITY, ALIGNMENT>& lhs, std::nullptr_t)
+  {
+    return lhs.is_valid();
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,583 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTERVAL_MAP_INCLUDED
+#define ETL_INTERVAL_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "vector.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#undef ETL_FILE
+#define ETL_FILE "72"
+
+//*****************************************************************************
+///\defgroup interval_map interval_map
+/// A fixed capacity map from half open intervals [low, high) to values.
+/// Intervals may overlap. They are kept in a flat array sorted by their low
+/// keys, which is searched as an implicit binary tree. Each node of the tree
+/// is augmented with the highest high key below it, so that stabbing and
+/// overlap queries take O(log n + k) for k results.
+/// Insertion and erasure are O(n), so it suits data that is read more
+/// often than it is changed, such as address maps and schedules.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// Exception base for interval_map
+  //***************************************************************************
+  class interval_map_exception : public etl::exception
+  {
+  public:
+
+    interval_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// The exception thrown when inserting into a full map.
+  //***************************************************************************
+  class interval_map_full : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_full(string_type file_name_, numeric_type line_number_)
+      : interval_map_exception(ETL_ERROR_TEXT("interval_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// The exception thrown when inserting an interval whose low key is not
+  /// less than its high key.
+  //***************************************************************************
+  class interval_map_empty_interval : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_empty_interval(string_type file_name_, numeric_type line_number_)
+      : interval_map_exception(ETL_ERROR_TEXT("interval_map:empty interval", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A map of up to MAX_SIZE intervals to values.
+  ///\ingroup interval_map
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam MAX_SIZE_   The maximum number of intervals.
+  ///\tparam TKeyCompare The key comparison functor.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class interval_map
+  {
+  public:
+
+    //*************************************************************************
+    /// An interval and its value.
+    //*************************************************************************
+    struct value_type
+    {
+      TKey    low;
+      TKey    high;
+      TMapped value;
+    };
+
+    typedef TKey              key_type;
+    typedef TMapped           mapped_type;
+    typedef TKeyCompare       key_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef size_t            size_type;
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Inserts an interval. Intervals with equal low keys are kept in the
+    /// order that they were inserted.
+    /// Emits interval_map_full if the map is full, or
+    /// interval_map_empty_interval if low is not less than high, and
+    /// returns end() if the error handler returns.
+    //*************************************************************************
+    const_iterator insert(const TKey& low, const TKey& high, const TMapped& value)
+    {
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(interval_map_full));
+      ETL_ASSERT_CONTAINER(compare(low, high), ETL_ERROR(interval_map_empty_interval));
+
+      if (full() || !compare(low, high))
+      {
+        return end();
+      }
+
+      value_type entry = { low, high, value };
+
+      typename entries_t::iterator position = etl::upper_bound(entries.begin(), entries.end(), entry, low_compare(compare));
+      const size_t index = size_t(etl::distance(entries.begin(), position));
+
+      entries.insert(position, entry);
+      rebuild();
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Erases an interval.
+    /// Returns the iterator following it.
+    //*************************************************************************
+    const_iterator erase(const_iterator position)
+    {
+      const size_t index = size_t(etl::distance(begin(), position));
+
+      entries.erase(entries.begin() + index);
+      rebuild();
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Erases every interval that is exactly [low, high).
+    /// Returns the number erased.
+    //*************************************************************************
+    size_t erase(const TKey& low, const TKey& high)
+    {
+      typename entries_t::iterator itr = entries.begin();
+      size_t erased = 0U;
+
+      while (itr != entries.end())
+      {
+        if (equal_keys(itr->low, low) && equal_keys(itr->high, high))
+        {
+          itr = entries.erase(itr);
+          ++erased;
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      rebuild();
+
+      return erased;
+    }
+
+    //*************************************************************************
+    /// Erases every interval.
+    //*************************************************************************
+    void clear()
+    {
+      entries.clear();
+      max_high.clear();
+    }
+
+    //*************************************************************************
+    /// Finds the interval, with the lowest low key, that contains 'key'.
+    /// Returns end() if there is none.
+    //*************************************************************************
+    const_iterator find(const TKey& key) const
+    {
+      const_iterator result = end();
+      first_match    action(result);
+
+      stab(0U, size(), key, action);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Checks whether any interval contains 'key'.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// The number of intervals that contain 'key'.
+    //*************************************************************************
+    size_t count(const TKey& key) const
+    {
+      counter c;
+
+      stab(0U, size(), key, c);
+
+      return c.n;
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with each interval that contains 'key', in order of
+    /// their low keys.
+    /// Returns the number of intervals.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_containing(const TKey& key, TFunction function) const
+    {
+      visitor<TFunction> v(function);
+
+      stab(0U, size(), key, v);
+
+      return v.n;
+    }
+
+    //*************************************************************************
+    /// Checks whether any interval overlaps [low, high).
+    //*************************************************************************
+    bool overlaps(const TKey& low, const TKey& high) const
+    {
+      const_iterator result = end();
+      first_match    action(result);
+
+      overlap(0U, size(), low, high, action);
+
+      return result != end();
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with each interval that overlaps [low, high), in
+    /// order of their low keys.
+    /// Returns the number of intervals.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_overlapping(const TKey& low, const TKey& high, TFunction function) const
+    {
+      visitor<TFunction> v(function);
+
+      overlap(0U, size(), low, high, v);
+
+      return v.n;
+    }
+
+    //*************************************************************************
+    /// Iterators over the intervals, in order of their low keys.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return entries.data();
+    }
+
+    const_iterator end() const
+    {
+      return entries.data() + entries.size();
+    }
+
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// The number of intervals.
+    //*************************************************************************
+    size_t size() const
+    {
+      return entries.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether there are no intervals.
+    //*************************************************************************
+    bool empty() const
+    {
+      return entries.empty();
+    }
+
+    //*************************************************************************
+    /// Checks whether no more intervals may be inserted.
+    //*************************************************************************
+    bool full() const
+    {
+      return entries.full();
+    }
+
+    //*************************************************************************
+    /// The maximum number of intervals.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The maximum number of intervals.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The number of intervals that may still be inserted.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+  private:
+
+    typedef etl::vector<value_type, MAX_SIZE> entries_t;
+
+    //*************************************************************************
+    /// Orders entries by their low keys.
+    //*************************************************************************
+    struct low_compare
+    {
+      explicit low_compare(const TKeyCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return compare(lhs.low, rhs.low);
+      }
+
+      TKeyCompare compare;
+    };
+
+    //*************************************************************************
+    /// Query actions. Each returns false to stop the search.
+    //*************************************************************************
+    struct counter
+    {
+      counter()
+        : n(0U)
+      {
+      }
+
+      bool operator ()(const value_type&)
+      {
+        ++n;
+        return true;
+      }
+
+      size_t n;
+    };
+
+    template <typename TFunction>
+    struct visitor
+    {
+      explicit visitor(TFunction& function_)
+        : function(function_)
+        , n(0U)
+      {
+      }
+
+      bool operator ()(const value_type& entry)
+      {
+        function(entry);
+        ++n;
+        return true;
+      }
+
+      TFunction& function;
+      size_t     n;
+    };
+
+    struct first_match
+    {
+      explicit first_match(const_iterator& result_)
+        : result(result_)
+      {
+      }
+
+      bool operator ()(const value_type& entry)
+      {
+        result = &entry;
+        return false;
+      }
+
+      const_iterator& result;
+    };
+
+    //*************************************************************************
+    bool equal_keys(const TKey& lhs, const TKey& rhs) const
+    {
+      return !compare(lhs, rhs) && !compare(rhs, lhs);
+    }
+
+    //*************************************************************************
+    /// Recalculates the highest high key below each node of the implicit
+    /// tree. The node for the range [first, last) is at its midpoint.
+    //*************************************************************************
+    void rebuild()
+    {
+      max_high.resize(entries.size(), TKey());
+      rebuild(0U, entries.size());
+    }
+
+    const TKey* rebuild(size_t first, size_t last)
+    {
+      if (first == last)
+      {
+        return nullptr;
+      }
+
+      const size_t middle = first + ((last - first) / 2U);
+
+      const TKey* highest = &entries[middle].high;
+      const TKey* left    = rebuild(first, middle);
+      const TKey* right   = rebuild(middle + 1U, last);
+
+      if ((left != nullptr) && compare(*highest, *left))
+      {
+        highest = left;
+      }
+
+      if ((right != nullptr) && compare(*highest, *right))
+      {
+        highest = right;
+      }
+
+      max_high[middle] = *highest;
+
+      return &max_high[middle];
+    }
+
+    //*************************************************************************
+    /// Applies 'action' to the intervals in [first, last) containing 'key',
+    /// in order. Returns false if the action stopped the search.
+    //*************************************************************************
+    template <typename TAction>
+    bool stab(size_t first, size_t last, const TKey& key, TAction& action) const
+    {
+      if (first == last)
+      {
+        return true;
+      }
+
+      const size_t middle = first + ((last - first) / 2U);
+
+      // Every interval below ends at or before the key.
+      if (!compare(key, max_high[middle]))
+      {
+        return true;
+      }
+
+      if (!stab(first, middle, key, action))
+      {
+        return false;
+      }
+
+      const value_type& entry = entries[middle];
+
+      // This, and every interval to the right, starts after the key.
+      if (compare(key, entry.low))
+      {
+        return true;
+      }
+
+      if (compare(key, entry.high) && !action(entry))
+      {
+        return false;
+      }
+
+      return stab(middle + 1U, last, key, action);
+    }
+
+    //*************************************************************************
+    /// Applies 'action' to the intervals in [first, last) overlapping
+    /// [low, high), in order. Returns false if the action stopped the search.
+    //*************************************************************************
+    template <typename TAction>
+    bool overlap(size_t first, size_t last, const TKey& low, const TKey& high, TAction& action) const
+    {
+      if (first == last)
+      {
+        return true;
+      }
+
+      const size_t middle = first + ((last - first) / 2U);
+
+      // Every interval below ends at or before low.
+      if (!compare(low, max_high[middle]))
+      {
+        return true;
+      }
+
+      if (!overlap(first, middle, low, high, action))
+      {
+        return false;
+      }
+
+      const value_type& entry = entries[middle];
+
+      // This, and every interval to the right, starts at or after high.
+      if (!compare(entry.low, high))
+      {
+        return true;
+      }
+
+      if (compare(low, entry.high) && !action(entry))
+      {
+        return false;
+      }
+
+      return overlap(middle + 1U, last, low, high, action);
+    }
+
+    entries_t                     entries;
+    etl::vector<TKey, MAX_SIZE_>  max_high; ///< The highest high key of the subtree at each node.
+    TKeyCompare                   compare;
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare>
+  const size_t interval_map<TKey, TMapped, MAX_SIZE_, TKeyCompare>::MAX_SIZE;
+}
+
+#undef ETL_FILE
+
+#endif
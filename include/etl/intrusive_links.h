@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_INTRUSIVE_LINKS_INCLUDED
 
 #include <assert.h>
+#include <stdint.h>
 
 #include "platform.h"
 #include "nullptr.h"
@@ -500,6 +501,9 @@ namespace etl
 
   //***************************************************************************
   /// A binary tree link.
+  /// 'etl_balance' holds the AVL balance factor, the height of the right
+  /// subtree minus the height of the left, when used by the intrusive
+  /// ordered containers.
   //***************************************************************************
   template <const size_t ID_>
   struct tree_link
@@ -511,9 +515,10 @@ namespace etl
 
       void clear()
       {
-        etl_parent = nullptr;
-        etl_left   = nullptr;
-        etl_right  = nullptr;
+        etl_parent  = nullptr;
+        etl_left    = nullptr;
+        etl_right   = nullptr;
+        etl_balance = 0;
       }
 
       bool is_linked() const
@@ -521,9 +526,10 @@ namespace etl
         return (etl_parent != nullptr) || (etl_left != nullptr) || (etl_right != nullptr);
       }
 
-      tree_link* etl_parent;
-      tree_link* etl_left;
-      tree_link* etl_right;
+      tree_link*   etl_parent;
+      tree_link*   etl_left;
+      tree_link*   etl_right;
+      int_least8_t etl_balance;
   };
 
   // Reference, Reference
@@ -0,0 +1,183 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_LOCKFREE_STACK_INCLUDED
+#define ETL_INTRUSIVE_LOCKFREE_STACK_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "atomic.h"
+#include "atomic_tagged_ptr.h"
+#include "intrusive_links.h"
+#include "private/atomic_link.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_stack
+  /// A lock free intrusive stack. Stores elements derived from etl::forward_link.
+  /// Any number of threads may push and pop concurrently.
+  /// No storage is used other than the link in each element.
+  ///
+  /// 'pop' requires ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS, as the top pointer is
+  /// tagged to guard against the ABA problem. 'push' and 'pop_all' are always
+  /// available and are ABA safe without it.
+  ///
+  /// An element that has been popped may be pushed again, but its storage must
+  /// remain valid for the lifetime of the stack, as a concurrent 'pop' may still
+  /// read its link. Elements allocated from an etl::pool satisfy this.
+  /// \tparam TValue The type of value that the stack holds.
+  /// \tparam TLink  The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_lockfree_stack
+  {
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_lockfree_stack()
+      : p_top()
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the stack.
+    ///\param value The value to push to the stack.
+    //*************************************************************************
+    void push(link_type& value)
+    {
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+      etl::tagged_ptr<link_type> top = p_top.load();
+
+      do
+      {
+        etl::private_atomic_link::store_next(value, top.pointer, etl::private_atomic_link::relaxed);
+      } while (!p_top.compare_exchange(top, &value));
+#else
+      link_type* top = p_top.load(etl::memory_order_relaxed);
+
+      do
+      {
+        etl::private_atomic_link::store_next(value, top, etl::private_atomic_link::relaxed);
+      } while (!p_top.compare_exchange_weak(top, &value, etl::memory_order_release, etl::memory_order_relaxed));
+#endif
+    }
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+    //*************************************************************************
+    /// Removes the value at the top of the stack.
+    ///\return A pointer to the value, or nullptr if the stack was empty.
+    //*************************************************************************
+    pointer pop()
+    {
+      etl::tagged_ptr<link_type> top = p_top.load();
+
+      while (top.pointer != nullptr)
+      {
+        link_type* p_next = etl::private_atomic_link::load_next(*top.pointer, etl::private_atomic_link::relaxed);
+
+        if (p_top.compare_exchange(top, p_next))
+        {
+          etl::private_atomic_link::store_next(*top.pointer, static_cast<link_type*>(nullptr), etl::private_atomic_link::relaxed);
+          return static_cast<pointer>(top.pointer);
+        }
+      }
+
+      return nullptr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes every value from the stack in one atomic step.
+    ///\return A pointer to the link of the most recently pushed value, or
+    /// nullptr if the stack was empty. The values remain chained through
+    /// 'etl_next' in last in, first out order.
+    //*************************************************************************
+    link_type* pop_all()
+    {
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+      etl::tagged_ptr<link_type> top = p_top.load();
+
+      while ((top.pointer != nullptr) && !p_top.compare_exchange(top, nullptr))
+      {
+      }
+
+      return top.pointer;
+#else
+      return p_top.exchange(nullptr, etl::memory_order_acquire);
+#endif
+    }
+
+    //*************************************************************************
+    /// Checks if the stack is in the empty state.
+    /// This is a snapshot, and may change immediately if other threads are active.
+    //*************************************************************************
+    bool empty() const
+    {
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+      return p_top.load().pointer == nullptr;
+#else
+      return p_top.load(etl::memory_order_acquire) == nullptr;
+#endif
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_lockfree_stack(const intrusive_lockfree_stack&);
+    intrusive_lockfree_stack& operator = (const intrusive_lockfree_stack& rhs);
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+    etl::atomic_tagged_ptr<link_type> p_top; ///< The current top of the stack, with its modification tag.
+#else
+    mutable etl::atomic<link_type*>   p_top; ///< The current top of the stack.
+#endif
+  };
+}
+
+#endif
+#endif
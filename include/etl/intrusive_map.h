@@ -0,0 +1,177 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_MAP_INCLUDED
+#define ETL_INTRUSIVE_MAP_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "intrusive_links.h"
+#include "private/intrusive_tree.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// An intrusive ordered map of values with unique keys.
+  /// The key is part of the value, and is returned by TKeyOf.
+  /// Elements are linked directly through an etl::tree_link base and kept in
+  /// a balanced tree, so insert and remove are O(log n) with no allocation.
+  ///\ingroup intrusive_map
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The type of value that the map holds.
+  ///\tparam TLink    The etl::tree_link type that the value is derived from.
+  ///\tparam TKeyOf   A functor that returns the key of a value.
+  ///\tparam TCompare The key ordering functor.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TLink, typename TKeyOf, typename TCompare = etl::less<TKey> >
+  class intrusive_map : public etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::key_of<TKey, TKeyOf>, TCompare>
+  {
+  private:
+
+    typedef etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::key_of<TKey, TKeyOf>, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::iterator   iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_map(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Links the value if no element has an equal key.
+    ///\return An iterator to the element with the key, and true if 'value' was linked.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      return base_t::insert_unique(value);
+    }
+
+    //*************************************************************************
+    /// Links a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        base_t::insert_unique(*first++);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_map(const intrusive_map&);
+    intrusive_map& operator =(const intrusive_map&);
+  };
+
+  //***************************************************************************
+  /// An intrusive ordered map that allows equal keys.
+  /// Values with equal keys are kept in the order that they were inserted.
+  ///\ingroup intrusive_map
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The type of value that the map holds.
+  ///\tparam TLink    The etl::tree_link type that the value is derived from.
+  ///\tparam TKeyOf   A functor that returns the key of a value.
+  ///\tparam TCompare The key ordering functor.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TLink, typename TKeyOf, typename TCompare = etl::less<TKey> >
+  class intrusive_multimap : public etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::key_of<TKey, TKeyOf>, TCompare>
+  {
+  private:
+
+    typedef etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::key_of<TKey, TKeyOf>, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::iterator   iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_multimap()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_multimap(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Links the value after any elements with an equal key.
+    ///\return An iterator to the value.
+    //*************************************************************************
+    iterator insert(value_type& value)
+    {
+      return base_t::insert_equal(value);
+    }
+
+    //*************************************************************************
+    /// Links a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        base_t::insert_equal(*first++);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_multimap(const intrusive_multimap&);
+    intrusive_multimap& operator =(const intrusive_multimap&);
+  };
+}
+
+#endif
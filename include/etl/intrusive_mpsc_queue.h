@@ -0,0 +1,180 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+#define ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "atomic.h"
+#include "intrusive_links.h"
+#include "private/atomic_link.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_queue
+  /// A lock free intrusive multiple producer, single consumer queue.
+  /// Stores elements derived from etl::forward_link.
+  /// Based on Dmitry Vyukov's intrusive MPSC node based queue.
+  /// Any number of threads may push. Only one thread may pop.
+  /// 'push' is wait free. No storage is used other than the link in each
+  /// element and one stub link in the queue.
+  /// \tparam TValue The type of value that the queue holds.
+  /// \tparam TLink  The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_mpsc_queue
+  {
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_mpsc_queue()
+      : p_head(&stub)
+      , p_tail(&stub)
+    {
+      stub.clear();
+    }
+
+    //*************************************************************************
+    /// Adds a value to the back of the queue.
+    /// May be called from any thread.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(link_type& value)
+    {
+      etl::private_atomic_link::store_next(value, static_cast<link_type*>(nullptr), etl::private_atomic_link::relaxed);
+
+      link_type* p_previous = p_head.exchange(&value, etl::memory_order_acq_rel);
+
+      // Between the exchange and this store the queue is briefly disconnected.
+      etl::private_atomic_link::store_next(*p_previous, &value, etl::private_atomic_link::release);
+    }
+
+    //*************************************************************************
+    /// Removes the value at the front of the queue.
+    /// Must only be called from the consumer thread.
+    ///\return A pointer to the value, or nullptr if the queue is empty or
+    /// a concurrent push has not yet completed.
+    //*************************************************************************
+    pointer pop()
+    {
+      link_type* p_current = p_tail;
+      link_type* p_next    = etl::private_atomic_link::load_next(*p_current, etl::private_atomic_link::acquire);
+
+      // Skip over the stub.
+      if (p_current == &stub)
+      {
+        if (p_next == nullptr)
+        {
+          return nullptr;
+        }
+
+        p_tail    = p_next;
+        p_current = p_next;
+        p_next    = etl::private_atomic_link::load_next(*p_next, etl::private_atomic_link::acquire);
+      }
+
+      if (p_next != nullptr)
+      {
+        return unlink(p_current, p_next);
+      }
+
+      // A producer has exchanged the head but not yet linked it.
+      if (p_current != p_head.load(etl::memory_order_acquire))
+      {
+        return nullptr;
+      }
+
+      // The last value is being removed, so re-insert the stub behind it.
+      push(stub);
+
+      p_next = etl::private_atomic_link::load_next(*p_current, etl::private_atomic_link::acquire);
+
+      if (p_next != nullptr)
+      {
+        return unlink(p_current, p_next);
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is in the empty state.
+    /// Accurate from the consumer thread.
+    /// 'Not empty' is a guess from a producer thread.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_head.load(etl::memory_order_acquire) == &stub;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Advances the tail past 'p_current' and returns it as a value.
+    //*************************************************************************
+    pointer unlink(link_type* p_current, link_type* p_next)
+    {
+      p_tail = p_next;
+      etl::private_atomic_link::store_next(*p_current, static_cast<link_type*>(nullptr), etl::private_atomic_link::relaxed);
+
+      return static_cast<pointer>(p_current);
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_mpsc_queue(const intrusive_mpsc_queue&);
+    intrusive_mpsc_queue& operator = (const intrusive_mpsc_queue& rhs);
+
+    mutable etl::atomic<link_type*> p_head; ///< The most recently pushed link. Shared by the producers.
+    link_type*                      p_tail; ///< The next link to pop. Owned by the consumer.
+    link_type                       stub;   ///< Keeps the queue non-empty, so that push never touches the tail.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,388 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_PTR_INCLUDED
+#define ETL_INTRUSIVE_PTR_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "utility.h"
+#include "nullptr.h"
+
+///\defgroup intrusive_ptr intrusive_ptr
+/// A shared pointer to an object that holds its own reference count.
+/// The object's type must have the free functions
+/// void intrusive_ptr_add_ref(const T*) and void intrusive_ptr_release(const T*),
+/// found by argument dependent lookup, such as those supplied by deriving
+/// from etl::intrusive_reference_counted.
+///\ingroup memory
+
+namespace etl
+{
+  //***************************************************************************
+  /// A reference count for objects used by a single thread.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  class reference_counter
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    reference_counter()
+      : count(0U)
+    {
+    }
+
+    void set_reference_count(value_type value)
+    {
+      count = value;
+    }
+
+    void increment()
+    {
+      ++count;
+    }
+
+    /// Returns the new count.
+    value_type decrement()
+    {
+      return --count;
+    }
+
+    value_type get_reference_count() const
+    {
+      return count;
+    }
+
+  private:
+
+    value_type count;
+  };
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A reference count for objects shared between threads.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  class atomic_reference_counter
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    atomic_reference_counter()
+      : count(0U)
+    {
+    }
+
+    void set_reference_count(value_type value)
+    {
+      count.store(value, etl::memory_order_relaxed);
+    }
+
+    void increment()
+    {
+      count.fetch_add(1U, etl::memory_order_relaxed);
+    }
+
+    /// Returns the new count.
+    /// The last release synchronises with all of the others, so that the
+    /// object may be safely destroyed.
+    value_type decrement()
+    {
+      return count.fetch_sub(1U, etl::memory_order_acq_rel) - 1U;
+    }
+
+    value_type get_reference_count() const
+    {
+      return count.load(etl::memory_order_relaxed);
+    }
+
+  private:
+
+    etl::atomic<value_type> count;
+  };
+#endif
+
+  //***************************************************************************
+  /// A base for objects that are shared by etl::intrusive_ptr.
+  /// When the last reference is released, the derived class's
+  /// on_last_release() is called, which should destroy the object, for
+  /// example by returning it to its pool.
+  ///\tparam TDerived The derived type.
+  ///\tparam TCounter etl::reference_counter or etl::atomic_reference_counter.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename TDerived, typename TCounter = etl::reference_counter>
+  class intrusive_reference_counted
+  {
+  public:
+
+    typedef TCounter counter_type;
+
+    //*************************************************************************
+    /// The number of intrusive_ptr that refer to this object.
+    //*************************************************************************
+    typename counter_type::value_type use_count() const
+    {
+      return counter.get_reference_count();
+    }
+
+    //*************************************************************************
+    friend void intrusive_ptr_add_ref(const TDerived* p)
+    {
+      static_cast<const intrusive_reference_counted*>(p)->counter.increment();
+    }
+
+    //*************************************************************************
+    friend void intrusive_ptr_release(const TDerived* p)
+    {
+      if (static_cast<const intrusive_reference_counted*>(p)->counter.decrement() == 0U)
+      {
+        const_cast<TDerived*>(p)->on_last_release();
+      }
+    }
+
+  protected:
+
+    intrusive_reference_counted()
+    {
+    }
+
+    // A copy has its own count.
+    intrusive_reference_counted(const intrusive_reference_counted&)
+    {
+    }
+
+    intrusive_reference_counted& operator =(const intrusive_reference_counted&)
+    {
+      return *this;
+    }
+
+    ~intrusive_reference_counted()
+    {
+    }
+
+  private:
+
+    mutable counter_type counter;
+  };
+
+  //***************************************************************************
+  /// A shared pointer to an object with an intrusive reference count.
+  ///\tparam T The pointed to type.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename T>
+  class intrusive_ptr
+  {
+  public:
+
+    typedef T  element_type;
+    typedef T* pointer;
+    typedef T& reference;
+
+    //*************************************************************************
+    intrusive_ptr()
+      : p(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Takes a reference to the object.
+    /// If add_ref is false, the pointer adopts a reference already held.
+    //*************************************************************************
+    intrusive_ptr(pointer p_, bool add_ref = true)
+      : p(p_)
+    {
+      if ((p != nullptr) && add_ref)
+      {
+        intrusive_ptr_add_ref(p);
+      }
+    }
+
+    //*************************************************************************
+    intrusive_ptr(const intrusive_ptr& other)
+      : p(other.p)
+    {
+      if (p != nullptr)
+      {
+        intrusive_ptr_add_ref(p);
+      }
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer to a derived type.
+    //*************************************************************************
+    template <typename U>
+    intrusive_ptr(const intrusive_ptr<U>& other)
+      : p(other.get())
+    {
+      if (p != nullptr)
+      {
+        intrusive_ptr_add_ref(p);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    intrusive_ptr(intrusive_ptr&& other)
+      : p(other.p)
+    {
+      other.p = nullptr;
+    }
+#endif
+
+    //*************************************************************************
+    ~intrusive_ptr()
+    {
+      if (p != nullptr)
+      {
+        intrusive_ptr_release(p);
+      }
+    }
+
+    //*************************************************************************
+    intrusive_ptr& operator =(const intrusive_ptr& other)
+    {
+      intrusive_ptr(other).swap(*this);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    intrusive_ptr& operator =(intrusive_ptr&& other)
+    {
+      intrusive_ptr(etl::move(other)).swap(*this);
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    intrusive_ptr& operator =(pointer p_)
+    {
+      intrusive_ptr(p_).swap(*this);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Releases the reference.
+    //*************************************************************************
+    void reset()
+    {
+      intrusive_ptr().swap(*this);
+    }
+
+    //*************************************************************************
+    /// Releases the reference and takes one to the new object.
+    //*************************************************************************
+    void reset(pointer p_, bool add_ref = true)
+    {
+      intrusive_ptr(p_, add_ref).swap(*this);
+    }
+
+    //*************************************************************************
+    /// Gives up the reference without releasing it.
+    //*************************************************************************
+    pointer detach()
+    {
+      pointer value = p;
+      p = nullptr;
+
+      return value;
+    }
+
+    //*************************************************************************
+    pointer get() const
+    {
+      return p;
+    }
+
+    //*************************************************************************
+    reference operator *() const
+    {
+      return *p;
+    }
+
+    //*************************************************************************
+    pointer operator ->() const
+    {
+      return p;
+    }
+
+    //*************************************************************************
+    operator bool() const
+    {
+      return (p != nullptr);
+    }
+
+    //*************************************************************************
+    void swap(intrusive_ptr& other)
+    {
+      pointer temp = p;
+      p       = other.p;
+      other.p = temp;
+    }
+
+  private:
+
+    pointer p;
+  };
+
+  //***************************************************************************
+  template <typename T, typename U>
+  bool operator ==(const etl::intrusive_ptr<T>& lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs.get() == rhs.get();
+  }
+
+  //***************************************************************************
+  template <typename T, typename U>
+  bool operator !=(const etl::intrusive_ptr<T>& lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs.get() != rhs.get();
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void swap(etl::intrusive_ptr<T>& lhs, etl::intrusive_ptr<T>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+}
+
+#endif
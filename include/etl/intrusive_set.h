@@ -0,0 +1,172 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_SET_INCLUDED
+#define ETL_INTRUSIVE_SET_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "intrusive_links.h"
+#include "private/intrusive_tree.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// An intrusive ordered set of unique values.
+  /// Elements are linked directly through an etl::tree_link base and kept in
+  /// a balanced tree, so insert and remove are O(log n) with no allocation.
+  ///\ingroup intrusive_set
+  ///\tparam TValue   The type of value that the set holds.
+  ///\tparam TLink    The etl::tree_link type that the value is derived from.
+  ///\tparam TCompare The ordering functor.
+  //***************************************************************************
+  template <typename TValue, typename TLink = etl::tree_link<0>, typename TCompare = etl::less<TValue> >
+  class intrusive_set : public etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::identity_key<TValue>, TCompare>
+  {
+  private:
+
+    typedef etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::identity_key<TValue>, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::iterator   iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_set(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Links the value if no equal value is present.
+    ///\return An iterator to the equal element, and true if 'value' was linked.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      return base_t::insert_unique(value);
+    }
+
+    //*************************************************************************
+    /// Links a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        base_t::insert_unique(*first++);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_set(const intrusive_set&);
+    intrusive_set& operator =(const intrusive_set&);
+  };
+
+  //***************************************************************************
+  /// An intrusive ordered set that allows equal values.
+  /// Equal values are kept in the order that they were inserted.
+  ///\ingroup intrusive_set
+  ///\tparam TValue   The type of value that the set holds.
+  ///\tparam TLink    The etl::tree_link type that the value is derived from.
+  ///\tparam TCompare The ordering functor.
+  //***************************************************************************
+  template <typename TValue, typename TLink = etl::tree_link<0>, typename TCompare = etl::less<TValue> >
+  class intrusive_multiset : public etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::identity_key<TValue>, TCompare>
+  {
+  private:
+
+    typedef etl::iintrusive_tree<TValue, TLink, etl::private_intrusive_tree::identity_key<TValue>, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::iterator   iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_multiset()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_multiset(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Links the value after any equal values.
+    ///\return An iterator to the value.
+    //*************************************************************************
+    iterator insert(value_type& value)
+    {
+      return base_t::insert_equal(value);
+    }
+
+    //*************************************************************************
+    /// Links a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        base_t::insert_equal(*first++);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_multiset(const intrusive_multiset&);
+    intrusive_multiset& operator =(const intrusive_multiset&);
+  };
+}
+
+#endif
@@ -0,0 +1,669 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_UNORDERED_SET_INCLUDED
+#define ETL_INTRUSIVE_UNORDERED_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "functional.h"
+#include "utility.h"
+#include "iterator.h"
+#include "intrusive_links.h"
+#include "intrusive_forward_list.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// An intrusive hash set, of unique keys, that links the caller's objects
+  /// directly into its buckets. No storage is allocated.
+  /// One object may be a member of several sets at once, each indexing it by
+  /// a different key, provided that each set uses a different link.
+  /// Can be used as a reference type for all intrusive_unordered_sets
+  /// containing a specific type.
+  ///\ingroup intrusive_unordered_set
+  ///\tparam TValue    The type of value that the set holds.
+  ///\tparam TLink     The etl::forward_link type that the value is derived from.
+  ///\tparam THash     The hash functor for the key.
+  ///\tparam TKeyOf    A functor that returns the key of a value.
+  ///                  Must define 'key_type'.
+  ///\tparam TKeyEqual The key equality functor.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename THash, typename TKeyOf, typename TKeyEqual = etl::equal_to<typename TKeyOf::key_type> >
+  class iintrusive_unordered_set
+  {
+  public:
+
+    typedef TLink                       link_type;
+    typedef TValue                      value_type;
+    typedef typename TKeyOf::key_type   key_type;
+    typedef THash                       hasher;
+    typedef TKeyOf                      key_of;
+    typedef TKeyEqual                   key_equal;
+    typedef value_type&                 reference;
+    typedef const value_type&           const_reference;
+    typedef value_type*                 pointer;
+    typedef const value_type*           const_pointer;
+    typedef size_t                      size_type;
+
+    typedef etl::intrusive_forward_list<TValue, TLink> bucket_t;
+
+    typedef typename bucket_t::iterator       local_iterator;
+    typedef typename bucket_t::const_iterator local_const_iterator;
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TValue>
+    {
+    public:
+
+      friend class iintrusive_unordered_set;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pbucket(nullptr)
+        , pbuckets_end(nullptr)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        ++inode;
+
+        if (inode == pbucket->end())
+        {
+          next_occupied(pbucket + 1);
+        }
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      reference operator *()
+      {
+        return *inode;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *inode;
+      }
+
+      //*********************************
+      pointer operator ->()
+      {
+        return &(*inode);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(*inode);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.pbucket == rhs.pbucket) && ((lhs.pbucket == lhs.pbuckets_end) || (lhs.inode == rhs.inode));
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(bucket_t* pbucket_, bucket_t* pbuckets_end_, local_iterator inode_)
+        : pbucket(pbucket_)
+        , pbuckets_end(pbuckets_end_)
+        , inode(inode_)
+      {
+      }
+
+      //*********************************
+      void next_occupied(bucket_t* pbucket_)
+      {
+        pbucket = pbucket_;
+
+        while ((pbucket != pbuckets_end) && pbucket->empty())
+        {
+          ++pbucket;
+        }
+
+        if (pbucket != pbuckets_end)
+        {
+          inode = pbucket->begin();
+        }
+      }
+
+      bucket_t*      pbucket;
+      bucket_t*      pbuckets_end;
+      local_iterator inode;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const TValue>
+    {
+    public:
+
+      friend class iintrusive_unordered_set;
+
+      //*********************************
+      const_iterator()
+        : pbucket(nullptr)
+        , pbuckets_end(nullptr)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iintrusive_unordered_set::iterator& other)
+        : pbucket(other.pbucket)
+        , pbuckets_end(other.pbuckets_end)
+        , inode(other.inode)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        ++inode;
+
+        if (inode == pbucket->end())
+        {
+          next_occupied(pbucket + 1);
+        }
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *inode;
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(*inode);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.pbucket == rhs.pbucket) && ((lhs.pbucket == lhs.pbuckets_end) || (lhs.inode == rhs.inode));
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const bucket_t* pbucket_, const bucket_t* pbuckets_end_, local_const_iterator inode_)
+        : pbucket(pbucket_)
+        , pbuckets_end(pbuckets_end_)
+        , inode(inode_)
+      {
+      }
+
+      //*********************************
+      void next_occupied(const bucket_t* pbucket_)
+      {
+        pbucket = pbucket_;
+
+        while ((pbucket != pbuckets_end) && pbucket->empty())
+        {
+          ++pbucket;
+        }
+
+        if (pbucket != pbuckets_end)
+        {
+          inode = pbucket->begin();
+        }
+      }
+
+      const bucket_t*      pbucket;
+      const bucket_t*      pbuckets_end;
+      local_const_iterator inode;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*********************************************************************
+    iterator begin()
+    {
+      iterator itr(pbuckets, pbuckets + number_of_buckets, local_iterator());
+      itr.next_occupied(pbuckets);
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      const_iterator itr(pbuckets, pbuckets + number_of_buckets, local_const_iterator());
+      itr.next_occupied(pbuckets);
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the set.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pbuckets + number_of_buckets, pbuckets + number_of_buckets, local_iterator());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pbuckets + number_of_buckets, pbuckets + number_of_buckets, local_const_iterator());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the bucket.
+    //*********************************************************************
+    local_iterator begin(size_t i)
+    {
+      return pbuckets[i].begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the bucket.
+    //*********************************************************************
+    local_const_iterator begin(size_t i) const
+    {
+      return pbuckets[i].cbegin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the bucket.
+    //*********************************************************************
+    local_iterator end(size_t i)
+    {
+      return pbuckets[i].end();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the bucket.
+    //*********************************************************************
+    local_const_iterator end(size_t i) const
+    {
+      return pbuckets[i].cend();
+    }
+
+    //*********************************************************************
+    /// Returns the bucket index for the key.
+    //*********************************************************************
+    size_type get_bucket_index(const key_type& key) const
+    {
+      return hash_function()(key) % number_of_buckets;
+    }
+
+    //*********************************************************************
+    /// Returns the size of the bucket for the key.
+    //*********************************************************************
+    size_type bucket_size(const key_type& key) const
+    {
+      return pbuckets[get_bucket_index(key)].size();
+    }
+
+    //*********************************************************************
+    /// Returns the number of buckets.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_buckets;
+    }
+
+    //*********************************************************************
+    /// Links a value into the set.
+    /// If a value with an equal key is already present the set is unchanged.
+    ///\param value The value to link. Must not already be linked by this link type.
+    ///\return An iterator to the value with the key, and true if 'value' was linked.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      const key_type& key = key_of()(value);
+      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+
+      local_iterator inode = find_in_bucket(*pbucket, key);
+
+      if (inode != pbucket->end())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(pbucket, pbuckets + number_of_buckets, inode), false);
+      }
+
+      inode = pbucket->insert_after(pbucket->before_begin(), value);
+      ++current_size;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(pbucket, pbuckets + number_of_buckets, inode), true);
+    }
+
+    //*********************************************************************
+    /// Unlinks the value with the key.
+    ///\return The number of values unlinked, 0 or 1.
+    //*********************************************************************
+    size_t erase(const key_type& key)
+    {
+      bucket_t& bucket = pbuckets[get_bucket_index(key)];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator inode     = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        if (key_eq()(key_of()(*inode), key))
+        {
+          bucket.erase_after(iprevious);
+          --current_size;
+          return 1U;
+        }
+
+        iprevious = inode++;
+      }
+
+      return 0U;
+    }
+
+    //*********************************************************************
+    /// Unlinks the value at the position.
+    ///\return An iterator to the next value.
+    //*********************************************************************
+    iterator erase(const_iterator position)
+    {
+      bucket_t* pbucket = pbuckets + (position.pbucket - pbuckets);
+
+      local_iterator iprevious = pbucket->before_begin();
+      local_iterator inode     = pbucket->begin();
+
+      while (&(*inode) != &(*position))
+      {
+        iprevious = inode++;
+      }
+
+      iterator inext(pbucket, pbuckets + number_of_buckets, inode);
+      ++inext;
+
+      pbucket->erase_after(iprevious);
+      --current_size;
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Unlinks every value.
+    //*********************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < number_of_buckets; ++i)
+      {
+        pbuckets[i].clear();
+      }
+
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the value with the key.
+    ///\return An iterator to the value, or end() if not found.
+    //*********************************************************************
+    iterator find(const key_type& key)
+    {
+      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+
+      local_iterator inode = find_in_bucket(*pbucket, key);
+
+      if (inode == pbucket->end())
+      {
+        return end();
+      }
+
+      return iterator(pbucket, pbuckets + number_of_buckets, inode);
+    }
+
+    //*********************************************************************
+    /// Finds the value with the key.
+    ///\return A const_iterator to the value, or end() if not found.
+    //*********************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+
+      local_iterator inode = find_in_bucket(*pbucket, key);
+
+      if (inode == pbucket->end())
+      {
+        return end();
+      }
+
+      return const_iterator(pbucket, pbuckets + number_of_buckets, inode);
+    }
+
+    //*********************************************************************
+    /// Counts the values with the key.
+    ///\return 0 or 1.
+    //*********************************************************************
+    size_t count(const key_type& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Returns the number of values in the set.
+    //*********************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*********************************************************************
+    /// Checks if the set is empty.
+    //*********************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*********************************************************************
+    /// Returns the load factor = size / bucket_count.
+    //*********************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*********************************************************************
+    /// Returns the function that hashes the keys.
+    //*********************************************************************
+    hasher hash_function() const
+    {
+      return hasher();
+    }
+
+    //*********************************************************************
+    /// Returns the function that compares the keys.
+    //*********************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal();
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iintrusive_unordered_set(bucket_t* pbuckets_, size_t number_of_buckets_)
+      : pbuckets(pbuckets_)
+      , number_of_buckets(number_of_buckets_)
+      , current_size(0U)
+    {
+    }
+
+    //*********************************************************************
+    /// Destructor.
+    //*********************************************************************
+    ~iintrusive_unordered_set()
+    {
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Finds the key in the bucket.
+    //*********************************************************************
+    local_iterator find_in_bucket(bucket_t& bucket, const key_type& key) const
+    {
+      local_iterator inode = bucket.begin();
+
+      while ((inode != bucket.end()) && !key_eq()(key_of()(*inode), key))
+      {
+        ++inode;
+      }
+
+      return inode;
+    }
+
+    // Disable copy construction and assignment.
+    iintrusive_unordered_set(const iintrusive_unordered_set&);
+    iintrusive_unordered_set& operator =(const iintrusive_unordered_set&);
+
+    bucket_t* pbuckets;
+    size_t    number_of_buckets;
+    size_t    current_size;
+  };
+
+  //***************************************************************************
+  /// An intrusive hash set with a fixed number of buckets.
+  ///\ingroup intrusive_unordered_set
+  ///\tparam TValue    The type of value that the set holds.
+  ///\tparam TLink     The etl::forward_link type that the value is derived from.
+  ///\tparam THash     The hash functor for the key.
+  ///\tparam TKeyOf    A functor that returns the key of a value.
+  ///                  Must define 'key_type'.
+  ///\tparam BUCKETS   The number of buckets.
+  ///\tparam TKeyEqual The key equality functor.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename THash, typename TKeyOf, const size_t BUCKETS_, typename TKeyEqual = etl::equal_to<typename TKeyOf::key_type> >
+  class intrusive_unordered_set : public etl::iintrusive_unordered_set<TValue, TLink, THash, TKeyOf, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iintrusive_unordered_set<TValue, TLink, THash, TKeyOf, TKeyEqual> base;
+
+  public:
+
+    static const size_t BUCKETS = BUCKETS_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_unordered_set()
+      : base(buckets, BUCKETS)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_unordered_set(TIterator first, TIterator last)
+      : base(buckets, BUCKETS)
+    {
+      while (first != last)
+      {
+        base::insert(*first++);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_unordered_set(const intrusive_unordered_set&);
+    intrusive_unordered_set& operator =(const intrusive_unordered_set&);
+
+    typename base::bucket_t buckets[BUCKETS];
+  };
+}
+
+#endif
@@ -33,18 +33,70 @@ SOFTWARE.
 
 ///\defgroup io_port io port
 /// IO port access
+/// The burst read and write functions may be given a DMA engine.
+/// The engine must supply these member functions:
+/// <b>bool read(volatile const T* port, T* buffer, size_t n)</b>
+/// <b>bool write(volatile T* port, const T* buffer, size_t n)</b>
+/// Each returns <b>true</b> if it accepted the transfer, or <b>false</b> if it
+/// declined it, for example if it was busy or 'n' was too small to be worthwhile.
+/// A declined transfer is performed by the CPU.
 ///\ingroup utilities
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "platform.h"
 #include "nullptr.h"
 #include "iterator.h"
 
-#include "iterator.h"
-
 namespace etl
 {
+  namespace private_io_port
+  {
+    //*************************************************************************
+    /// Reads 'n' values from a port. Every value is a separate volatile access.
+    //*************************************************************************
+    template <typename T>
+    void burst_read(volatile const T* port, T* buffer, size_t n)
+    {
+      while (n >= 4U)
+      {
+        buffer[0] = *port;
+        buffer[1] = *port;
+        buffer[2] = *port;
+        buffer[3] = *port;
+        buffer += 4U;
+        n      -= 4U;
+      }
+
+      while (n-- != 0U)
+      {
+        *buffer++ = *port;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes 'n' values to a port. Every value is a separate volatile access.
+    //*************************************************************************
+    template <typename T>
+    void burst_write(volatile T* port, const T* buffer, size_t n)
+    {
+      while (n >= 4U)
+      {
+        *port = buffer[0];
+        *port = buffer[1];
+        *port = buffer[2];
+        *port = buffer[3];
+        buffer += 4U;
+        n      -= 4U;
+      }
+
+      while (n-- != 0U)
+      {
+        *port = *buffer++;
+      }
+    }
+  }
   //***************************************************************************
   /// Read write port.
   //***************************************************************************
@@ -119,6 +171,38 @@ namespace etl
       return reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Burst read of 'n' values in to 'buffer'.
+    void read(T* buffer, size_t n) const
+    {
+      private_io_port::burst_read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n);
+    }
+
+    /// Burst read of 'n' values in to 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void read(T* buffer, size_t n, TDma& dma) const
+    {
+      if (!dma.read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n))
+      {
+        private_io_port::burst_read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n);
+      }
+    }
+
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(reinterpret_cast<pointer>(ADDRESS), buffer, n))
+      {
+        private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+      }
+    }
+
   private:
 
     /// Disabled.
@@ -180,6 +264,22 @@ namespace etl
       return reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Burst read of 'n' values in to 'buffer'.
+    void read(T* buffer, size_t n) const
+    {
+      private_io_port::burst_read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n);
+    }
+
+    /// Burst read of 'n' values in to 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void read(T* buffer, size_t n, TDma& dma) const
+    {
+      if (!dma.read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n))
+      {
+        private_io_port::burst_read(reinterpret_cast<const_pointer>(ADDRESS), buffer, n);
+      }
+    }
+
   private:
 
     /// Write disabled.
@@ -244,6 +344,22 @@ namespace etl
       return reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(reinterpret_cast<pointer>(ADDRESS), buffer, n))
+      {
+        private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+      }
+    }
+
   private:
 
     /// Read disabled.
@@ -323,6 +439,32 @@ namespace etl
       return reinterpret_cast<pointer>(ADDRESS);
     }
 
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+
+      if (n != 0U)
+      {
+        shadow_value = buffer[n - 1U];
+      }
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(reinterpret_cast<pointer>(ADDRESS), buffer, n))
+      {
+        private_io_port::burst_write(reinterpret_cast<pointer>(ADDRESS), buffer, n);
+      }
+
+      if (n != 0U)
+      {
+        shadow_value = buffer[n - 1U];
+      }
+    }
+
   private:
 
     /// Disabled.
@@ -437,6 +579,38 @@ namespace etl
       return *this;
     }
 
+    /// Burst read of 'n' values in to 'buffer'.
+    void read(T* buffer, size_t n) const
+    {
+      private_io_port::burst_read(address, buffer, n);
+    }
+
+    /// Burst read of 'n' values in to 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void read(T* buffer, size_t n, TDma& dma) const
+    {
+      if (!dma.read(address, buffer, n))
+      {
+        private_io_port::burst_read(address, buffer, n);
+      }
+    }
+
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(address, buffer, n);
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(address, buffer, n))
+      {
+        private_io_port::burst_write(address, buffer, n);
+      }
+    }
+
   private:
 
     pointer address;
@@ -523,6 +697,22 @@ namespace etl
       return *this;
     }
 
+    /// Burst read of 'n' values in to 'buffer'.
+    void read(T* buffer, size_t n) const
+    {
+      private_io_port::burst_read(address, buffer, n);
+    }
+
+    /// Burst read of 'n' values in to 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void read(T* buffer, size_t n, TDma& dma) const
+    {
+      if (!dma.read(address, buffer, n))
+      {
+        private_io_port::burst_read(address, buffer, n);
+      }
+    }
+
   private:
 
     /// Write disabled.
@@ -618,6 +808,22 @@ namespace etl
       return *this;
     }
 
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(address, buffer, n);
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(address, buffer, n))
+      {
+        private_io_port::burst_write(address, buffer, n);
+      }
+    }
+
   private:
 
     /// Read disabled.
@@ -799,6 +1005,32 @@ namespace etl
       return *this;
     }
 
+    /// Burst write of 'n' values from 'buffer'.
+    void write(const T* buffer, size_t n)
+    {
+      private_io_port::burst_write(address, buffer, n);
+
+      if (n != 0U)
+      {
+        shadow_value = buffer[n - 1U];
+      }
+    }
+
+    /// Burst write of 'n' values from 'buffer', offered to a DMA engine first.
+    template <typename TDma>
+    void write(const T* buffer, size_t n, TDma& dma)
+    {
+      if (!dma.write(address, buffer, n))
+      {
+        private_io_port::burst_write(address, buffer, n);
+      }
+
+      if (n != 0U)
+      {
+        shadow_value = buffer[n - 1U];
+      }
+    }
+
   private:
 
     T       shadow_value;
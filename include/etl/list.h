@@ -1319,6 +1319,9 @@ namespace etl
 
       while (iValue != end())
       {
+        // Fetch the next node while the predicate is called.
+        ETL_PREFETCH(iValue.p_node->next);
+
         if (predicate(*iValue))
         {
           iValue = erase(iValue);
@@ -1818,8 +1821,10 @@ namespace etl
 
             while (p_first != p_last)
             {
+              node_t* p_next = p_first->next;                         // Remember the next node.
+              ETL_PREFETCH(p_next);                                   // Fetch it while this one is destroyed.
               destroy_data_node(static_cast<data_node_t&>(*p_first)); // Destroy the current node.
-              p_first = p_first->next;                                // Move to the next node.
+              p_first = p_next;                                       // Move to the next node.
             }
           }
         }
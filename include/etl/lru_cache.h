@@ -0,0 +1,123 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LRU_CACHE_INCLUDED
+#define ETL_LRU_CACHE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "hash.h"
+#include "functional.h"
+#include "intrusive_links.h"
+#include "intrusive_list.h"
+#include "private/cache_base.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity, least recently used, cache.
+  /// Reads and writes are O(1). When full, the entry that has gone longest
+  /// without a read or write is evicted.
+  ///\ingroup cache
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type.
+  ///\tparam SIZE      The maximum number of cached entries.
+  ///\tparam THash     The hash functor for the key.
+  ///\tparam TKeyEqual The key equality functor.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::private_cache::cache_base<TKey, TValue, etl::bidirectional_link<1>, SIZE_, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_cache::cache_base<TKey, TValue, etl::bidirectional_link<1>, SIZE_, THash, TKeyEqual> base_t;
+    typedef typename base_t::entry_t entry_t;
+
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lru_cache()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes back any dirty values.
+    //*************************************************************************
+    ~lru_cache()
+    {
+      this->clear();
+    }
+
+  protected:
+
+    //*************************************************************************
+    virtual void on_insert(entry_t& e)
+    {
+      recency.push_front(e);
+    }
+
+    //*************************************************************************
+    virtual void on_hit(entry_t& e)
+    {
+      recency.erase(typename recency_t::iterator(e));
+      recency.push_front(e);
+    }
+
+    //*************************************************************************
+    virtual void on_erase(entry_t& e)
+    {
+      recency.erase(typename recency_t::iterator(e));
+    }
+
+    //*************************************************************************
+    virtual entry_t& victim()
+    {
+      return recency.back();
+    }
+
+  private:
+
+    typedef etl::intrusive_list<entry_t, etl::bidirectional_link<1> > recency_t;
+
+    // Should not be copied.
+    lru_cache(const lru_cache&);
+    lru_cache& operator =(const lru_cache&);
+
+    recency_t recency; ///< Most recently used at the front.
+  };
+}
+
+#endif
@@ -0,0 +1,354 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LZ4_INCLUDED
+#define ETL_LZ4_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "array_view.h"
+#include "static_assert.h"
+
+///\defgroup lz4 lz4
+/// Compression and decompression in the LZ4 block format, without
+/// allocation. The output of lz4_compress may be decompressed by any LZ4
+/// block decoder, and lz4_decompress accepts any valid LZ4 block.
+/// Frames, checksums and dictionaries are not supported.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The largest possible compressed size of 'n' bytes.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t lz4_compress_bound(size_t n)
+  {
+    return n + (n / 255U) + 16U;
+  }
+
+  //***************************************************************************
+  /// The work buffer for lz4_compress, supplied by the caller so that it may
+  /// be static or shared. It holds 2^HASH_BITS positions; more finds more
+  /// matches at the cost of memory and of clearing it for each block.
+  ///\tparam HASH_BITS From 8 to 16. The default of 12 uses 16k bytes.
+  ///\ingroup lz4
+  //***************************************************************************
+  template <const size_t HASH_BITS_ = 12U>
+  struct lz4_hash_table
+  {
+    ETL_STATIC_ASSERT((HASH_BITS_ >= 8U) && (HASH_BITS_ <= 16U), "HASH_BITS must be from 8 to 16");
+
+    static const size_t HASH_BITS = HASH_BITS_;
+    static const size_t SIZE      = size_t(1U) << HASH_BITS_;
+
+    uint32_t positions[SIZE];
+  };
+
+  namespace private_lz4
+  {
+    static const size_t MIN_MATCH     = 4U;
+    static const size_t LAST_LITERALS = 5U;  // The last bytes must be literals.
+    static const size_t MF_LIMIT      = 12U; // The last match must start before this many bytes from the end.
+    static const size_t MAX_DISTANCE  = 65535U;
+
+    //*************************************************************************
+    inline uint32_t read32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Knuth's multiplicative hash of four bytes.
+    //*************************************************************************
+    template <size_t HASH_BITS>
+    uint32_t hash_sequence(uint32_t sequence)
+    {
+      return uint32_t(sequence * 2654435761U) >> (32U - HASH_BITS);
+    }
+
+    //*************************************************************************
+    /// Writes a length of 15 or more as a run of extension bytes.
+    //*************************************************************************
+    inline uint8_t* write_length(uint8_t* op, size_t length)
+    {
+      while (length >= 255U)
+      {
+        *op++   = 255U;
+        length -= 255U;
+      }
+
+      *op++ = uint8_t(length);
+
+      return op;
+    }
+
+    //*************************************************************************
+    /// Writes literals and, if 'match_length' is not zero, a match.
+    /// Returns nullptr if there is not enough room.
+    //*************************************************************************
+    inline uint8_t* write_sequence(uint8_t* op, uint8_t* oend, const uint8_t* literals, size_t literal_length, size_t offset, size_t match_length)
+    {
+      const size_t match_code = (match_length != 0U) ? match_length - MIN_MATCH : 0U;
+
+      // The token, the extension bytes for lengths of 15 or more, the literals and the offset.
+      const size_t needed = 1U + ((literal_length + 240U) / 255U) + literal_length + ((match_length != 0U) ? (2U + ((match_code + 240U) / 255U)) : 0U);
+
+      if (needed > size_t(oend - op))
+      {
+        return nullptr;
+      }
+
+      uint8_t* token = op++;
+      *token = uint8_t(((literal_length >= 15U) ? 15U : literal_length) << 4);
+
+      if (literal_length >= 15U)
+      {
+        op = write_length(op, literal_length - 15U);
+      }
+
+      if (literal_length != 0U)
+      {
+        memcpy(op, literals, literal_length);
+        op += literal_length;
+      }
+
+      if (match_length != 0U)
+      {
+        *op++ = uint8_t(offset);
+        *op++ = uint8_t(offset >> 8);
+
+        *token |= uint8_t((match_code >= 15U) ? 15U : match_code);
+
+        if (match_code >= 15U)
+        {
+          op = write_length(op, match_code - 15U);
+        }
+      }
+
+      return op;
+    }
+
+    //*************************************************************************
+    /// Reads the extension bytes of a length.
+    /// Returns false if the input ends first.
+    //*************************************************************************
+    inline bool read_length(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+    {
+      uint8_t b;
+
+      do
+      {
+        if (ip == iend)
+        {
+          return false;
+        }
+
+        b       = *ip++;
+        length += b;
+      } while (b == 255U);
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Compresses 'source' in to 'destination' as one LZ4 block.
+  /// Returns the compressed size, or 0 if 'destination' is too small.
+  /// A destination of lz4_compress_bound(source.size()) is always enough.
+  ///\ingroup lz4
+  //***************************************************************************
+  template <const size_t HASH_BITS>
+  size_t lz4_compress(etl::array_view<const uint8_t> source, etl::array_view<uint8_t> destination, etl::lz4_hash_table<HASH_BITS>& work)
+  {
+    const uint8_t* const src  = source.data();
+    const uint8_t* const iend = src + source.size();
+    uint8_t*       const dst  = destination.data();
+    uint8_t*       const oend = dst + destination.size();
+
+    const uint8_t* ip     = src;
+    const uint8_t* anchor = src;
+    uint8_t*       op     = dst;
+
+    if (source.size() > private_lz4::MF_LIMIT)
+    {
+      memset(work.positions, 0, sizeof(work.positions));
+
+      const uint8_t* const mf_limit    = iend - private_lz4::MF_LIMIT;
+      const uint8_t* const match_limit = iend - private_lz4::LAST_LITERALS;
+
+      while (ip < mf_limit)
+      {
+        const uint32_t sequence = private_lz4::read32(ip);
+        const uint32_t h        = private_lz4::hash_sequence<HASH_BITS>(sequence);
+        const uint8_t* match    = src + work.positions[h];
+
+        work.positions[h] = uint32_t(ip - src);
+
+        if ((match < ip) && (size_t(ip - match) <= private_lz4::MAX_DISTANCE) && (private_lz4::read32(match) == sequence))
+        {
+          // Extend backwards over literals.
+          while ((ip > anchor) && (match > src) && (ip[-1] == match[-1]))
+          {
+            --ip;
+            --match;
+          }
+
+          // Extend forwards.
+          size_t length = private_lz4::MIN_MATCH;
+
+          while (((ip + length) < match_limit) && (ip[length] == match[length]))
+          {
+            ++length;
+          }
+
+          op = private_lz4::write_sequence(op, oend, anchor, size_t(ip - anchor), size_t(ip - match), length);
+
+          if (op == nullptr)
+          {
+            return 0U;
+          }
+
+          ip    += length;
+          anchor = ip;
+        }
+        else
+        {
+          // Step faster through data that does not compress.
+          ip += 1U + (size_t(ip - anchor) >> 6);
+        }
+      }
+    }
+
+    // The remaining bytes are literals.
+    op = private_lz4::write_sequence(op, oend, anchor, size_t(iend - anchor), 0U, 0U);
+
+    return (op == nullptr) ? 0U : size_t(op - dst);
+  }
+
+  //***************************************************************************
+  /// Decompresses the LZ4 block 'source' in to 'destination'.
+  /// Returns the decompressed size, or 0 if the block is empty, malformed or
+  /// 'destination' is too small. Malformed input never reads or writes out
+  /// of bounds.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline size_t lz4_decompress(etl::array_view<const uint8_t> source, etl::array_view<uint8_t> destination)
+  {
+    const uint8_t*       ip   = source.data();
+    const uint8_t* const iend = ip + source.size();
+    uint8_t* const       dst  = destination.data();
+    uint8_t*             op   = dst;
+    uint8_t* const       oend = dst + destination.size();
+
+    while (ip != iend)
+    {
+      const uint8_t token = *ip++;
+
+      // Literals.
+      size_t literal_length = size_t(token >> 4);
+
+      if ((literal_length == 15U) && !private_lz4::read_length(ip, iend, literal_length))
+      {
+        return 0U;
+      }
+
+      if ((literal_length > size_t(iend - ip)) || (literal_length > size_t(oend - op)))
+      {
+        return 0U;
+      }
+
+      memcpy(op, ip, literal_length);
+      ip += literal_length;
+      op += literal_length;
+
+      // The last sequence has no match.
+      if (ip == iend)
+      {
+        return size_t(op - dst);
+      }
+
+      // Match.
+      if ((iend - ip) < 2)
+      {
+        return 0U;
+      }
+
+      const size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+      ip += 2;
+
+      if ((offset == 0U) || (offset > size_t(op - dst)))
+      {
+        return 0U;
+      }
+
+      size_t match_length = size_t(token & 0x0FU);
+
+      if ((match_length == 15U) && !private_lz4::read_length(ip, iend, match_length))
+      {
+        return 0U;
+      }
+
+      match_length += private_lz4::MIN_MATCH;
+
+      if (match_length > size_t(oend - op))
+      {
+        return 0U;
+      }
+
+      const uint8_t* match = op - offset;
+
+      if (offset >= match_length)
+      {
+        memcpy(op, match, match_length);
+        op += match_length;
+      }
+      else
+      {
+        // Overlapping, so repeats the last 'offset' bytes.
+        for (size_t i = 0U; i < match_length; ++i)
+        {
+          *op++ = *match++;
+        }
+      }
+    }
+
+    // A block must end with literals.
+    return 0U;
+  }
+}
+
+#endif
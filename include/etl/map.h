@@ -51,6 +51,7 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "iterator.h"
 #include "utility.h"
+#include "private/node_handle.h"
 
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
   #include <initializer_list>
@@ -205,6 +206,9 @@ namespace etl
       Node() :
         weight(uint_least8_t(kNeither)),
         dir(uint_least8_t(kNeither))
+#if defined(ETL_MAP_ORDER_STATISTICS)
+        , size(1U)
+#endif
       {
       }
 
@@ -222,17 +226,23 @@ namespace etl
         dir = uint_least8_t(kNeither);
         children[0] = nullptr;
         children[1] = nullptr;
+#if defined(ETL_MAP_ORDER_STATISTICS)
+        size = 1U;
+#endif
       }
 
       Node*   children[2];
       uint_least8_t weight;
       uint_least8_t dir;
+#if defined(ETL_MAP_ORDER_STATISTICS)
+      size_t size; ///< The number of nodes in the subtree rooted here.
+#endif
     };
 
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
-    map_base(size_type max_size_)
+    ETL_CONSTEXPR map_base(size_type max_size_)
       : current_size(0)
       , CAPACITY(max_size_)
       , root_node(nullptr)
@@ -310,6 +320,53 @@ namespace etl
       }
     }
 
+#if defined(ETL_MAP_ORDER_STATISTICS)
+    //*************************************************************************
+    /// The number of nodes in the subtree rooted at the node provided.
+    //*************************************************************************
+    static size_t subtree_size(const Node* node)
+    {
+      return (node != nullptr) ? node->size : 0U;
+    }
+
+    //*************************************************************************
+    /// Recount the node provided from the sizes of its children.
+    //*************************************************************************
+    static void update_size(Node* node)
+    {
+      node->size = 1U + subtree_size(node->children[kLeft]) + subtree_size(node->children[kRight]);
+    }
+
+    //*************************************************************************
+    /// Find the node at the position provided, in key order.
+    //*************************************************************************
+    const Node* find_index_node(size_t index) const
+    {
+      const Node* node = root_node;
+
+      while (node != nullptr)
+      {
+        const size_t left_size = subtree_size(node->children[kLeft]);
+
+        if (index < left_size)
+        {
+          node = node->children[kLeft];
+        }
+        else if (index == left_size)
+        {
+          break;
+        }
+        else
+        {
+          index -= left_size + 1U;
+          node = node->children[kRight];
+        }
+      }
+
+      return node;
+    }
+
+#endif
     //*************************************************************************
     /// Rotate two nodes at the position provided the to balance the tree
     //*************************************************************************
@@ -332,6 +389,11 @@ namespace etl
       position->children[dir] = new_root->children[1 - dir];
       // New root now becomes parent of current position
       new_root->children[1 - dir] = position;
+#if defined(ETL_MAP_ORDER_STATISTICS)
+      // Recount the moved subtrees, lowest first.
+      update_size(position);
+      update_size(new_root);
+#endif
       // Clear weight factor from current position
       position->weight = uint_least8_t(kNeither);
       // Newly detached right now becomes current position
@@ -359,6 +421,10 @@ namespace etl
 
       // Capture new root (either E or D depending on dir)
       Node* new_root = position->children[dir]->children[1 - dir];
+#if defined(ETL_MAP_ORDER_STATISTICS)
+      // Capture B or C, which stays below the new root
+      Node* child = position->children[dir];
+#endif
       // Set weight factor for B or C based on F or G existing and being a different than dir
       position->children[dir]->weight = third != uint_least8_t(kNeither) && third != dir ? dir : uint_least8_t(kNeither);
 
@@ -374,6 +440,12 @@ namespace etl
       position->children[dir] = new_root->children[1 - dir];
       // Attach current root to new roots right tree
       new_root->children[1 - dir] = position;
+#if defined(ETL_MAP_ORDER_STATISTICS)
+      // Recount the moved subtrees, lowest first.
+      update_size(child);
+      update_size(position);
+      update_size(new_root);
+#endif
       // Replace current position with new root
       position = new_root;
       // Clear weight factor for new current position
@@ -451,6 +523,9 @@ namespace etl
       swap->children[kLeft] = detached->children[kLeft];
       swap->children[kRight] = detached->children[kRight];
       swap->weight = detached->weight;
+#if defined(ETL_MAP_ORDER_STATISTICS)
+      swap->size = detached->size;
+#endif
     }
 
     size_type current_size;   ///< The number of the used nodes.
@@ -476,6 +551,7 @@ namespace etl
     typedef const value_type&              const_reference;
 #if ETL_CPP11_SUPPORTED
     typedef value_type&&                   rvalue_reference;
+    typedef etl::node_handle<value_type, imap> node_type;
 #endif
     typedef value_type*                    pointer;
     typedef const value_type*              const_pointer;
@@ -1142,6 +1218,107 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_reference value)
+    {
+      return insert(value);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The position hint is ignored.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator, const key_type& key, Args && ... args)
+    {
+      return emplace(key, etl::forward<Args>(args)...).first;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the map starting at the position recommended.
     /// If asserts or exceptions are enabled, emits map_full if the map is already full.
@@ -1254,6 +1431,81 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Unlinks the element at the position from the map and returns a
+    /// handle that owns its node. The node is not destroyed or released.
+    ///\param position The position of the element to extract.
+    //*********************************************************************
+    node_type extract(const_iterator position)
+    {
+      return extract((*position).first);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element with the key from the map and returns a handle
+    /// that owns its node. Returns an empty handle if the key is not found.
+    ///\param key The key of the element to extract.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      Node* found = unlink_node(root_node, key);
+
+      if (found == nullptr)
+      {
+        return node_type();
+      }
+
+      ETL_DECREMENT_DEBUG_COUNT
+
+      Data_Node& node = imap::data_cast(*found);
+
+      return node_type(&node.value, &node, p_node_pool);
+    }
+
+    //*********************************************************************
+    /// Inserts the node owned by the handle.
+    /// If the node came from the pool used by this map it is relinked
+    /// without copying, otherwise its value is moved in to a new node.
+    /// If the key already exists the handle keeps its node.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param handle The node handle.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(node_type&& handle)
+    {
+      if (handle.empty())
+      {
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      iterator i_element = find(handle.value().first);
+
+      if (i_element != end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node* p_node;
+
+      if (handle.get_pool() == p_node_pool)
+      {
+        p_node = static_cast<Data_Node*>(handle.release());
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+      else
+      {
+        p_node = &allocate_data_node(etl::move(handle.value()));
+        handle = node_type();
+      }
+
+      Node* inserted_node = insert_node(root_node, *p_node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), true);
+    }
+#endif
+
     //*********************************************************************
     /// Returns an iterator pointing to the first element in the container
     /// whose key is not considered to go before the key provided or end()
@@ -1298,6 +1550,54 @@ namespace etl
       return const_iterator(*this, find_upper_node(root_node, key));
     }
 
+#if defined(ETL_MAP_ORDER_STATISTICS)
+    //*************************************************************************
+    /// Counts the elements ordered before the key provided. O(logN)
+    ///\param key The key to rank.
+    ///\return The number of elements with keys less than the key.
+    //*************************************************************************
+    size_type rank(key_parameter_t key) const
+    {
+      size_type result = 0U;
+      const Node* node = root_node;
+
+      while (node != nullptr)
+      {
+        if (node_comp(imap::data_cast(*node), key))
+        {
+          result += 1U + subtree_size(node->children[kLeft]);
+          node = node->children[kRight];
+        }
+        else
+        {
+          node = node->children[kLeft];
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the element at the position provided, in key order. O(logN)
+    ///\param index The zero based position.
+    ///\return An iterator to the element, or end() if index >= size().
+    //*************************************************************************
+    iterator select(size_type index)
+    {
+      return iterator(*this, const_cast<Node*>(find_index_node(index)));
+    }
+
+    //*************************************************************************
+    /// Gets the element at the position provided, in key order. O(logN)
+    ///\param index The zero based position.
+    ///\return A const_iterator to the element, or end() if index >= size().
+    //*************************************************************************
+    const_iterator select(size_type index) const
+    {
+      return const_iterator(*this, find_index_node(index));
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -1356,10 +1656,20 @@ namespace etl
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
-    imap(etl::ipool& node_pool, size_t max_size_)
+    ETL_CONSTEXPR imap(etl::ipool& node_pool, size_t max_size_)
       : etl::map_base(max_size_)
       , p_node_pool(&node_pool)
+      , kcompare()
+      , vcompare()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_node_pool() const
     {
+      return *p_node_pool;
     }
 
     //*************************************************************************
@@ -1777,6 +2087,17 @@ namespace etl
           }
         }
 
+#if defined(ETL_MAP_ORDER_STATISTICS)
+        // Count the new node in each subtree on the path down to it
+        if (found == &node)
+        {
+          for (Node* path_node = position; path_node != found; path_node = path_node->children[path_node->dir])
+          {
+            ++path_node->size;
+          }
+        }
+
+#endif
         // Was a critical node found that should be checked for balance?
         if (critical_node)
         {
@@ -1952,6 +2273,23 @@ namespace etl
     /// provided
     //*************************************************************************
     Node* remove_node(Node*& position, key_parameter_t key)
+    {
+      Node* found = unlink_node(position, key);
+
+      if (found)
+      {
+        // Destroy the node removed
+        destroy_data_node(imap::data_cast(*found));
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Unlink the node whose key matches the key provided from the tree.
+    /// The node is neither destroyed nor released.
+    //*************************************************************************
+    Node* unlink_node(Node*& position, key_parameter_t key)
     {
       // Step 1: Find the target node that matches the key provided, the
       // replacement node (might be the same as target node), and the critical
@@ -2016,6 +2354,19 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
+#if defined(ETL_MAP_ORDER_STATISTICS)
+        // Uncount the removal from each subtree on the path down to the
+        // replacement node, including the replacement itself, whose place
+        // will be taken by its only child. Sizes then already describe the
+        // final tree when the rotations below recount their nodes.
+        for (Node* path_node = position; path_node != replace; path_node = path_node->children[path_node->dir])
+        {
+          --path_node->size;
+        }
+
+        --replace->size;
+
+#endif
         // Step 2: Update weights from critical node to replacement parent node
         while (balance)
         {
@@ -2127,14 +2478,8 @@ namespace etl
           }
         }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = imap::data_cast(*found);
-
         // One less.
         --current_size;
-
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
       } // if(found)
 
         // Return node found (might be nullptr)
@@ -2173,10 +2518,9 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    map()
+    ETL_CONSTEXPR map()
       : etl::imap<TKey, TValue, TCompare>(node_pool, MAX_SIZE)
     {
-      this->initialise();
     }
 
     //*************************************************************************
@@ -2285,6 +2629,193 @@ namespace etl
     etl::pool<typename etl::imap<TKey, TValue, TCompare>::Data_Node, MAX_SIZE> node_pool;
   };
 
+  //*************************************************************************
+  /// A templated map implementation that uses a pool supplied by the user.
+  /// Maps that share a pool can pass elements between each other as node
+  /// handles without reallocating them.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare>
+  class map<TKey, TValue, 0, TCompare> : public etl::imap<TKey, TValue, TCompare>
+  {
+  public:
+
+    typedef typename etl::imap<TKey, TValue, TCompare>::Data_Node pool_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit map(etl::ipool& node_pool)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, node_pool.max_size())
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same pool as the other map.
+    //*************************************************************************
+    map(const map& other)
+      : etl::imap<TKey, TValue, TCompare>(other.get_node_pool(), other.max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    /// Uses the same pool as the other map, so the nodes are relinked.
+    //*************************************************************************
+    map(map&& other)
+      : etl::imap<TKey, TValue, TCompare>(other.get_node_pool(), other.max_size())
+    {
+      if (this != &other)
+      {
+        while (!other.empty())
+        {
+          this->insert(other.extract(other.begin()));
+        }
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    map(TIterator first, TIterator last, etl::ipool& node_pool)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, node_pool.max_size())
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~map()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    map& operator = (const map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    map& operator = (map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+
+        while (!rhs.empty())
+        {
+          this->insert(rhs.extract(rhs.begin()));
+        }
+      }
+
+      return *this;
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated map implementation whose nodes are kept in a buffer
+  /// supplied by the user, so that where the map lives is decided when it
+  /// is constructed.
+  /// The buffer must be aligned to ALIGNMENT, hold buffer_size(max_size)
+  /// bytes and outlive the map.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class map_ext : public etl::imap<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::pool_ext<typename etl::imap<TKey, TValue, TCompare>::Data_Node> pool_type;
+
+  public:
+
+    static const size_t ALIGNMENT = pool_type::ALIGNMENT;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for the nodes.
+    ///\param max_size The maximum number of elements.
+    //*************************************************************************
+    map_ext(void* buffer, size_t max_size)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, max_size),
+        node_pool(buffer, max_size)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    map_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, max_size),
+        node_pool(buffer, max_size)
+    {
+      this->initialise();
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size elements.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return pool_type::buffer_size(max_size);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~map_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    map_ext& operator = (const map_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // The buffer belongs to the user, so cannot be copied.
+    map_ext(const map_ext&);
+
+    /// The pool of data nodes, in the user's buffer.
+    pool_type node_pool;
+  };
+
   //***************************************************************************
   /// Equal operator.
   ///\param lhs Reference to the first lookup.
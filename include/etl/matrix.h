@@ -0,0 +1,784 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MATRIX_INCLUDED
+#define ETL_MATRIX_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "array.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+///\defgroup matrix matrix
+/// Small fixed size matrices and vectors, stored row major.
+/// All sizes are compile time constants, so the loops are fully unrolled by
+/// the compiler and dot products are unrolled by template recursion.
+/// Define ETL_USE_SSE2 or ETL_USE_NEON in the profile to vectorise float
+/// matrix products and element-wise operations where the column count or
+/// size is a multiple of 4. The SIMD paths sum in the same order as the
+/// portable loops.
+///\ingroup numeric
+
+#if defined(ETL_USE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_MATRIX_SSE2
+  #include <emmintrin.h>
+#elif defined(ETL_USE_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_MATRIX_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_matrix
+  {
+    //*************************************************************************
+    /// The alignment of the element storage.
+    /// 16 bytes when the storage is a whole number of SIMD registers.
+    //*************************************************************************
+    template <typename T, size_t SIZE>
+    struct storage_alignment
+    {
+      static const size_t value = (((sizeof(T) * SIZE) % 16U) == 0U) ? 16U : etl::alignment_of<T>::value;
+    };
+
+    //*************************************************************************
+    /// Dot product of N elements, unrolled by template recursion.
+    /// Sums in index order.
+    //*************************************************************************
+    template <size_t N>
+    struct dot
+    {
+      template <typename T>
+      static T run(const T* a, size_t a_stride, const T* b, size_t b_stride, T sum)
+      {
+        return dot<N - 1U>::run(a + a_stride, a_stride, b + b_stride, b_stride, sum + (*a * *b));
+      }
+    };
+
+    template <>
+    struct dot<0U>
+    {
+      template <typename T>
+      static T run(const T*, size_t, const T*, size_t, T sum)
+      {
+        return sum;
+      }
+    };
+
+    template <typename T>
+    T absolute(T value)
+    {
+      return (value < T(0)) ? -value : value;
+    }
+
+    //*************************************************************************
+    /// Portable kernels. Specialised below for the SIMD paths.
+    //*************************************************************************
+    template <typename T, size_t R, size_t K, size_t C, bool VECTORISE = false>
+    struct multiply_kernel
+    {
+      static void run(const T* a, const T* b, T* out)
+      {
+        for (size_t i = 0U; i < R; ++i)
+        {
+          for (size_t j = 0U; j < C; ++j)
+          {
+            out[(i * C) + j] = dot<K>::run(a + (i * K), 1U, b + j, C, T(0));
+          }
+        }
+      }
+    };
+
+    template <typename T, size_t SIZE, bool VECTORISE = false>
+    struct elementwise_kernel
+    {
+      static void add(const T* a, const T* b, T* out)
+      {
+        for (size_t i = 0U; i < SIZE; ++i)
+        {
+          out[i] = a[i] + b[i];
+        }
+      }
+
+      static void subtract(const T* a, const T* b, T* out)
+      {
+        for (size_t i = 0U; i < SIZE; ++i)
+        {
+          out[i] = a[i] - b[i];
+        }
+      }
+
+      static void scale(const T* a, T s, T* out)
+      {
+        for (size_t i = 0U; i < SIZE; ++i)
+        {
+          out[i] = a[i] * s;
+        }
+      }
+    };
+
+#if defined(ETL_MATRIX_SSE2) || defined(ETL_MATRIX_NEON)
+
+  #if defined(ETL_MATRIX_SSE2)
+    typedef __m128 float4_t;
+
+    inline float4_t load(const float* p)               { return _mm_loadu_ps(p); }
+    inline void     store(float* p, float4_t v)        { _mm_storeu_ps(p, v); }
+    inline float4_t splat(float s)                     { return _mm_set1_ps(s); }
+    inline float4_t add(float4_t a, float4_t b)        { return _mm_add_ps(a, b); }
+    inline float4_t subtract(float4_t a, float4_t b)   { return _mm_sub_ps(a, b); }
+    inline float4_t multiply(float4_t a, float4_t b)   { return _mm_mul_ps(a, b); }
+  #else
+    typedef float32x4_t float4_t;
+
+    inline float4_t load(const float* p)               { return vld1q_f32(p); }
+    inline void     store(float* p, float4_t v)        { vst1q_f32(p, v); }
+    inline float4_t splat(float s)                     { return vdupq_n_f32(s); }
+    inline float4_t add(float4_t a, float4_t b)        { return vaddq_f32(a, b); }
+    inline float4_t subtract(float4_t a, float4_t b)   { return vsubq_f32(a, b); }
+    inline float4_t multiply(float4_t a, float4_t b)   { return vmulq_f32(a, b); }
+  #endif
+
+    //*************************************************************************
+    /// Each group of 4 result columns is the sum over k of a(i, k) times
+    /// row k of b, so every output lane accumulates in k order.
+    //*************************************************************************
+    template <size_t R, size_t K, size_t C>
+    struct multiply_kernel<float, R, K, C, true>
+    {
+      static void run(const float* a, const float* b, float* out)
+      {
+        for (size_t i = 0U; i < R; ++i)
+        {
+          for (size_t j = 0U; j < C; j += 4U)
+          {
+            float4_t sum = splat(0.0f);
+
+            for (size_t k = 0U; k < K; ++k)
+            {
+              sum = add(sum, multiply(splat(a[(i * K) + k]), load(b + (k * C) + j)));
+            }
+
+            store(out + (i * C) + j, sum);
+          }
+        }
+      }
+    };
+
+    template <size_t SIZE>
+    struct elementwise_kernel<float, SIZE, true>
+    {
+      static void add(const float* a, const float* b, float* out)
+      {
+        for (size_t i = 0U; i < SIZE; i += 4U)
+        {
+          store(out + i, private_matrix::add(load(a + i), load(b + i)));
+        }
+      }
+
+      static void subtract(const float* a, const float* b, float* out)
+      {
+        for (size_t i = 0U; i < SIZE; i += 4U)
+        {
+          store(out + i, private_matrix::subtract(load(a + i), load(b + i)));
+        }
+      }
+
+      static void scale(const float* a, float s, float* out)
+      {
+        const float4_t vs = splat(s);
+
+        for (size_t i = 0U; i < SIZE; i += 4U)
+        {
+          store(out + i, multiply(load(a + i), vs));
+        }
+      }
+    };
+
+    template <typename T, size_t N>
+    struct is_vectorisable : etl::integral_constant<bool, etl::is_same<T, float>::value && ((N % 4U) == 0U)>
+    {
+    };
+#else
+    template <typename T, size_t N>
+    struct is_vectorisable : etl::false_type
+    {
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// A fixed size R x C matrix, stored row major.
+  /// Default constructed matrices are zero.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t R, size_t C>
+  class matrix
+  {
+  public:
+
+    ETL_STATIC_ASSERT((R > 0U) && (C > 0U), "Matrix dimensions must be non-zero");
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef size_t   size_type;
+
+    static const size_t ROWS      = R;
+    static const size_t COLUMNS   = C;
+    static const size_t SIZE      = R * C;
+    static const size_t ALIGNMENT = private_matrix::storage_alignment<T, R * C>::value;
+
+    //*************************************************************************
+    /// Constructs a zero matrix.
+    //*************************************************************************
+    matrix()
+    {
+      fill(T(0));
+    }
+
+    //*************************************************************************
+    /// Constructs from SIZE values in row major order.
+    //*************************************************************************
+    explicit matrix(const T* values)
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        elements[i] = values[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from an etl::multi_array<T, R, C>.
+    //*************************************************************************
+    explicit matrix(const etl::array<etl::array<T, C>, R>& values)
+    {
+      for (size_t r = 0U; r < R; ++r)
+      {
+        for (size_t c = 0U; c < C; ++c)
+        {
+          elements[(r * C) + c] = values[r][c];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// A matrix with every element set to 'value'.
+    //*************************************************************************
+    static matrix filled(T value)
+    {
+      matrix result;
+      result.fill(value);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The identity matrix.
+    //*************************************************************************
+    static matrix identity()
+    {
+      ETL_STATIC_ASSERT(R == C, "Identity requires a square matrix");
+
+      matrix result;
+
+      for (size_t i = 0U; i < R; ++i)
+      {
+        result(i, i) = T(1);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Sets every element to 'value'.
+    //*************************************************************************
+    void fill(T value)
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        elements[i] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Element access.
+    //*************************************************************************
+    reference operator ()(size_t r, size_t c)
+    {
+      return elements[(r * C) + c];
+    }
+
+    const_reference operator ()(size_t r, size_t c) const
+    {
+      return elements[(r * C) + c];
+    }
+
+    //*************************************************************************
+    /// Copies the elements to an etl::multi_array<T, R, C>.
+    //*************************************************************************
+    void copy_to(etl::array<etl::array<T, C>, R>& values) const
+    {
+      for (size_t r = 0U; r < R; ++r)
+      {
+        for (size_t c = 0U; c < C; ++c)
+        {
+          values[r][c] = elements[(r * C) + c];
+        }
+      }
+    }
+
+    pointer data()
+    {
+      return elements;
+    }
+
+    const_pointer data() const
+    {
+      return elements;
+    }
+
+    static ETL_CONSTEXPR size_t rows()
+    {
+      return R;
+    }
+
+    static ETL_CONSTEXPR size_t columns()
+    {
+      return C;
+    }
+
+    static ETL_CONSTEXPR size_t size()
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Element-wise arithmetic.
+    //*************************************************************************
+    matrix& operator +=(const matrix& rhs)
+    {
+      private_matrix::elementwise_kernel<T, SIZE, private_matrix::is_vectorisable<T, SIZE>::value>::add(elements, rhs.elements, elements);
+
+      return *this;
+    }
+
+    matrix& operator -=(const matrix& rhs)
+    {
+      private_matrix::elementwise_kernel<T, SIZE, private_matrix::is_vectorisable<T, SIZE>::value>::subtract(elements, rhs.elements, elements);
+
+      return *this;
+    }
+
+    matrix& operator *=(T s)
+    {
+      private_matrix::elementwise_kernel<T, SIZE, private_matrix::is_vectorisable<T, SIZE>::value>::scale(elements, s, elements);
+
+      return *this;
+    }
+
+    matrix operator -() const
+    {
+      matrix result(*this);
+      result *= T(-1);
+
+      return result;
+    }
+
+    friend matrix operator +(matrix lhs, const matrix& rhs)
+    {
+      return lhs += rhs;
+    }
+
+    friend matrix operator -(matrix lhs, const matrix& rhs)
+    {
+      return lhs -= rhs;
+    }
+
+    friend matrix operator *(matrix lhs, T s)
+    {
+      return lhs *= s;
+    }
+
+    friend matrix operator *(T s, matrix rhs)
+    {
+      return rhs *= s;
+    }
+
+    friend bool operator ==(const matrix& lhs, const matrix& rhs)
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        if (!(lhs.elements[i] == rhs.elements[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    friend bool operator !=(const matrix& lhs, const matrix& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+#if ETL_CPP11_SUPPORTED
+    alignas(ALIGNMENT) T elements[SIZE];
+#else
+    T elements[SIZE];
+#endif
+  };
+
+  template <typename T, size_t R, size_t C>
+  const size_t matrix<T, R, C>::ROWS;
+
+  template <typename T, size_t R, size_t C>
+  const size_t matrix<T, R, C>::COLUMNS;
+
+  template <typename T, size_t R, size_t C>
+  const size_t matrix<T, R, C>::SIZE;
+
+  template <typename T, size_t R, size_t C>
+  const size_t matrix<T, R, C>::ALIGNMENT;
+
+  //***************************************************************************
+  /// A fixed size column vector.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t N>
+  class vec : public etl::matrix<T, N, 1U>
+  {
+  public:
+
+    typedef etl::matrix<T, N, 1U> base_t;
+
+    //*************************************************************************
+    /// Constructs a zero vector.
+    //*************************************************************************
+    vec()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from N values.
+    //*************************************************************************
+    explicit vec(const T* values)
+      : base_t(values)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from an N x 1 matrix, such as the result of arithmetic.
+    //*************************************************************************
+    vec(const base_t& other)
+      : base_t(other)
+    {
+    }
+
+    vec(T x, T y)
+    {
+      ETL_STATIC_ASSERT(N == 2U, "Constructor requires a 2 element vector");
+      (*this)[0] = x;
+      (*this)[1] = y;
+    }
+
+    vec(T x, T y, T z)
+    {
+      ETL_STATIC_ASSERT(N == 3U, "Constructor requires a 3 element vector");
+      (*this)[0] = x;
+      (*this)[1] = y;
+      (*this)[2] = z;
+    }
+
+    vec(T x, T y, T z, T w)
+    {
+      ETL_STATIC_ASSERT(N == 4U, "Constructor requires a 4 element vector");
+      (*this)[0] = x;
+      (*this)[1] = y;
+      (*this)[2] = z;
+      (*this)[3] = w;
+    }
+
+    typename base_t::reference operator [](size_t i)
+    {
+      return this->data()[i];
+    }
+
+    typename base_t::const_reference operator [](size_t i) const
+    {
+      return this->data()[i];
+    }
+  };
+
+  //***************************************************************************
+  /// Matrix product.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t R, size_t K, size_t C>
+  etl::matrix<T, R, C> operator *(const etl::matrix<T, R, K>& lhs, const etl::matrix<T, K, C>& rhs)
+  {
+    etl::matrix<T, R, C> result;
+
+    private_matrix::multiply_kernel<T, R, K, C, private_matrix::is_vectorisable<T, C>::value>::run(lhs.data(), rhs.data(), result.data());
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Matrix vector product.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t R, size_t C>
+  etl::vec<T, R> operator *(const etl::matrix<T, R, C>& lhs, const etl::vec<T, C>& rhs)
+  {
+    etl::vec<T, R> result;
+
+    private_matrix::multiply_kernel<T, R, C, 1U>::run(lhs.data(), rhs.data(), result.data());
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Transpose.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t R, size_t C>
+  etl::matrix<T, C, R> transpose(const etl::matrix<T, R, C>& m)
+  {
+    etl::matrix<T, C, R> result;
+
+    for (size_t r = 0U; r < R; ++r)
+    {
+      for (size_t c = 0U; c < C; ++c)
+      {
+        result(c, r) = m(r, c);
+      }
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Dot product.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t N>
+  T dot(const etl::vec<T, N>& lhs, const etl::vec<T, N>& rhs)
+  {
+    return private_matrix::dot<N>::run(lhs.data(), 1U, rhs.data(), 1U, T(0));
+  }
+
+  //***************************************************************************
+  /// Cross product.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T>
+  etl::vec<T, 3U> cross(const etl::vec<T, 3U>& lhs, const etl::vec<T, 3U>& rhs)
+  {
+    return etl::vec<T, 3U>((lhs[1] * rhs[2]) - (lhs[2] * rhs[1]),
+                           (lhs[2] * rhs[0]) - (lhs[0] * rhs[2]),
+                           (lhs[0] * rhs[1]) - (lhs[1] * rhs[0]));
+  }
+
+  //***************************************************************************
+  /// Determinant.
+  /// Closed form for 1 x 1 to 3 x 3, Gaussian elimination with partial
+  /// pivoting for larger sizes.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T>
+  T determinant(const etl::matrix<T, 1U, 1U>& m)
+  {
+    return m(0, 0);
+  }
+
+  template <typename T>
+  T determinant(const etl::matrix<T, 2U, 2U>& m)
+  {
+    return (m(0, 0) * m(1, 1)) - (m(0, 1) * m(1, 0));
+  }
+
+  template <typename T>
+  T determinant(const etl::matrix<T, 3U, 3U>& m)
+  {
+    return (m(0, 0) * ((m(1, 1) * m(2, 2)) - (m(1, 2) * m(2, 1)))) -
+           (m(0, 1) * ((m(1, 0) * m(2, 2)) - (m(1, 2) * m(2, 0)))) +
+           (m(0, 2) * ((m(1, 0) * m(2, 1)) - (m(1, 1) * m(2, 0))));
+  }
+
+  template <typename T, size_t N>
+  T determinant(const etl::matrix<T, N, N>& m)
+  {
+    etl::matrix<T, N, N> a(m);
+    T det = T(1);
+
+    for (size_t col = 0U; col < N; ++col)
+    {
+      size_t pivot = col;
+
+      for (size_t r = col + 1U; r < N; ++r)
+      {
+        if (private_matrix::absolute(a(r, col)) > private_matrix::absolute(a(pivot, col)))
+        {
+          pivot = r;
+        }
+      }
+
+      if (a(pivot, col) == T(0))
+      {
+        return T(0);
+      }
+
+      if (pivot != col)
+      {
+        for (size_t c = 0U; c < N; ++c)
+        {
+          T t = a(col, c);
+          a(col, c)   = a(pivot, c);
+          a(pivot, c) = t;
+        }
+
+        det = -det;
+      }
+
+      det = det * a(col, col);
+
+      for (size_t r = col + 1U; r < N; ++r)
+      {
+        const T factor = a(r, col) / a(col, col);
+
+        for (size_t c = col; c < N; ++c)
+        {
+          a(r, c) = a(r, c) - (factor * a(col, c));
+        }
+      }
+    }
+
+    return det;
+  }
+
+  //***************************************************************************
+  /// Inverse.
+  /// Closed form for 2 x 2, Gauss-Jordan elimination with partial pivoting
+  /// for other sizes.
+  /// Returns false, leaving 'result' unspecified, if the matrix is singular.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T>
+  bool inverse(const etl::matrix<T, 2U, 2U>& m, etl::matrix<T, 2U, 2U>& result)
+  {
+    const T det = determinant(m);
+
+    if (det == T(0))
+    {
+      return false;
+    }
+
+    result(0, 0) =  m(1, 1) / det;
+    result(0, 1) = -m(0, 1) / det;
+    result(1, 0) = -m(1, 0) / det;
+    result(1, 1) =  m(0, 0) / det;
+
+    return true;
+  }
+
+  template <typename T, size_t N>
+  bool inverse(const etl::matrix<T, N, N>& m, etl::matrix<T, N, N>& result)
+  {
+    etl::matrix<T, N, N> a(m);
+    result = etl::matrix<T, N, N>::identity();
+
+    for (size_t col = 0U; col < N; ++col)
+    {
+      size_t pivot = col;
+
+      for (size_t r = col + 1U; r < N; ++r)
+      {
+        if (private_matrix::absolute(a(r, col)) > private_matrix::absolute(a(pivot, col)))
+        {
+          pivot = r;
+        }
+      }
+
+      if (a(pivot, col) == T(0))
+      {
+        return false;
+      }
+
+      if (pivot != col)
+      {
+        for (size_t c = 0U; c < N; ++c)
+        {
+          T t = a(col, c);
+          a(col, c)   = a(pivot, c);
+          a(pivot, c) = t;
+
+          t = result(col, c);
+          result(col, c)   = result(pivot, c);
+          result(pivot, c) = t;
+        }
+      }
+
+      const T scale = T(1) / a(col, col);
+
+      for (size_t c = 0U; c < N; ++c)
+      {
+        a(col, c)      = a(col, c) * scale;
+        result(col, c) = result(col, c) * scale;
+      }
+
+      for (size_t r = 0U; r < N; ++r)
+      {
+        if (r != col)
+        {
+          const T factor = a(r, col);
+
+          for (size_t c = 0U; c < N; ++c)
+          {
+            a(r, c)      = a(r, c) - (factor * a(col, c));
+            result(r, c) = result(r, c) - (factor * result(col, c));
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+}
+
+#endif
@@ -0,0 +1,853 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MDSPAN_INCLUDED
+#define ETL_MDSPAN_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "array.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+///\defgroup mdspan mdspan
+/// Non-owning multi-dimensional views over contiguous or strided memory.
+/// Extents may be fixed at compile time or supplied at run time, so index
+/// arithmetic over fixed dimensions reduces to constants.
+///\ingroup containers
+
+namespace etl
+{
+#if ETL_CPP11_SUPPORTED
+
+  //***************************************************************************
+  /// Marks an extent whose value is supplied at run time.
+  //***************************************************************************
+  static const size_t dynamic_extent = etl::integral_limits<size_t>::max;
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// Counts the number of dynamic extents in a list.
+    //*************************************************************************
+    inline ETL_CONSTEXPR size_t count_dynamic()
+    {
+      return 0U;
+    }
+
+    template <typename... TRest>
+    inline ETL_CONSTEXPR size_t count_dynamic(size_t extent, TRest... rest)
+    {
+      return (extent == etl::dynamic_extent ? 1U : 0U) + count_dynamic(rest...);
+    }
+
+    //*************************************************************************
+    /// The product of a list of extents.
+    //*************************************************************************
+    inline ETL_CONSTEXPR size_t product()
+    {
+      return 1U;
+    }
+
+    template <typename... TRest>
+    inline ETL_CONSTEXPR size_t product(size_t extent, TRest... rest)
+    {
+      return extent * product(rest...);
+    }
+
+    //*************************************************************************
+    /// Gets the Nth value of a list of extents.
+    //*************************************************************************
+    template <size_t N, size_t E, size_t... ERest>
+    struct nth_extent
+    {
+      static const size_t value = nth_extent<N - 1U, ERest...>::value;
+    };
+
+    template <size_t E, size_t... ERest>
+    struct nth_extent<0U, E, ERest...>
+    {
+      static const size_t value = E;
+    };
+  }
+
+  //***************************************************************************
+  /// The extents of a multi-dimensional view.
+  /// Each extent is either a compile time constant or etl::dynamic_extent.
+  /// Only the dynamic extents are stored.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <size_t... Extents>
+  class extents
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(Extents) > 0U, "extents must have a rank of at least 1");
+
+    static const size_t RANK         = sizeof...(Extents);
+    static const size_t RANK_DYNAMIC = private_mdspan::count_dynamic(Extents...);
+
+    //*************************************************************************
+    /// Gets the compile time extent of dimension N.
+    //*************************************************************************
+    template <size_t N>
+    struct static_extent_of
+    {
+      ETL_STATIC_ASSERT(N < sizeof...(Extents), "Dimension out of range");
+      static const size_t value = private_mdspan::nth_extent<N, Extents...>::value;
+    };
+
+    //*************************************************************************
+    /// Default constructor. Dynamic extents are zero.
+    //*************************************************************************
+    extents()
+      : dynamic_values()
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from the dynamic extents, in order.
+    //*************************************************************************
+    template <typename... TSizes>
+    explicit extents(size_t first, TSizes... rest)
+      : dynamic_values{ first, static_cast<size_t>(rest)... }
+    {
+      ETL_STATIC_ASSERT((sizeof...(TSizes) + 1U) == RANK_DYNAMIC, "Incorrect number of dynamic extents");
+    }
+
+    //*************************************************************************
+    /// Construct from a list of all RANK extents.
+    /// Only the values of the dynamic extents are used.
+    //*************************************************************************
+    static extents from_all(const size_t* all)
+    {
+      extents result;
+
+      size_t d = 0U;
+
+      for (size_t r = 0U; r < RANK; ++r)
+      {
+        if (static_extent(r) == etl::dynamic_extent)
+        {
+          result.dynamic_values[d++] = all[r];
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The number of dimensions.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t rank()
+    {
+      return RANK;
+    }
+
+    //*************************************************************************
+    /// The number of dynamic dimensions.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t rank_dynamic()
+    {
+      return RANK_DYNAMIC;
+    }
+
+    //*************************************************************************
+    /// The compile time extent of dimension r, or etl::dynamic_extent.
+    //*************************************************************************
+    static size_t static_extent(size_t r)
+    {
+      static ETL_CONSTEXPR size_t values[] = { Extents... };
+
+      return values[r];
+    }
+
+    //*************************************************************************
+    /// The extent of dimension r.
+    //*************************************************************************
+    size_t extent(size_t r) const
+    {
+      const size_t e = static_extent(r);
+
+      return (e == etl::dynamic_extent) ? dynamic_values[dynamic_index(r)] : e;
+    }
+
+    //*************************************************************************
+    /// The product of all of the extents.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t n = 1U;
+
+      for (size_t r = 0U; r < RANK; ++r)
+      {
+        n *= extent(r);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    template <size_t... OtherExtents>
+    bool operator ==(const etl::extents<OtherExtents...>& other) const
+    {
+      if (RANK != other.rank())
+      {
+        return false;
+      }
+
+      for (size_t r = 0U; r < RANK; ++r)
+      {
+        if (extent(r) != other.extent(r))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    template <size_t... OtherExtents>
+    bool operator !=(const etl::extents<OtherExtents...>& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The index into dynamic_values for dimension r.
+    //*************************************************************************
+    static size_t dynamic_index(size_t r)
+    {
+      size_t d = 0U;
+
+      for (size_t i = 0U; i < r; ++i)
+      {
+        if (static_extent(i) == etl::dynamic_extent)
+        {
+          ++d;
+        }
+      }
+
+      return d;
+    }
+
+    size_t dynamic_values[RANK_DYNAMIC > 0U ? RANK_DYNAMIC : 1U];
+  };
+
+  template <size_t... Extents>
+  const size_t extents<Extents...>::RANK;
+
+  template <size_t... Extents>
+  const size_t extents<Extents...>::RANK_DYNAMIC;
+
+  template <size_t... Extents>
+  template <size_t N>
+  const size_t extents<Extents...>::static_extent_of<N>::value;
+
+  namespace private_mdspan
+  {
+    template <size_t N, size_t... Extents>
+    struct make_dextents
+    {
+      typedef typename make_dextents<N - 1U, etl::dynamic_extent, Extents...>::type type;
+    };
+
+    template <size_t... Extents>
+    struct make_dextents<0U, Extents...>
+    {
+      typedef etl::extents<Extents...> type;
+    };
+  }
+
+  //***************************************************************************
+  /// Extents of rank N where every extent is dynamic.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <size_t N>
+  using dextents = typename private_mdspan::make_dextents<N>::type;
+
+  //***************************************************************************
+  /// Row major layout. The last index varies fastest.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_right
+  {
+    template <typename TExtents>
+    class mapping
+    {
+    public:
+
+      typedef TExtents extents_type;
+
+      mapping()
+        : ext()
+      {
+      }
+
+      mapping(const extents_type& ext_)
+        : ext(ext_)
+      {
+      }
+
+      const extents_type& extents() const
+      {
+        return ext;
+      }
+
+      //***********************************************************************
+      /// The offset of the element at the indices.
+      //***********************************************************************
+      size_t offset(const size_t* indices) const
+      {
+        size_t result = 0U;
+
+        for (size_t r = 0U; r < extents_type::RANK; ++r)
+        {
+          result = (result * ext.extent(r)) + indices[r];
+        }
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// The distance between elements in dimension r.
+      //***********************************************************************
+      size_t stride(size_t r) const
+      {
+        size_t result = 1U;
+
+        for (size_t i = r + 1U; i < extents_type::RANK; ++i)
+        {
+          result *= ext.extent(i);
+        }
+
+        return result;
+      }
+
+      size_t required_span_size() const
+      {
+        return ext.size();
+      }
+
+      static ETL_CONSTEXPR bool is_contiguous()
+      {
+        return true;
+      }
+
+    private:
+
+      extents_type ext;
+    };
+  };
+
+  //***************************************************************************
+  /// Column major layout. The first index varies fastest.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_left
+  {
+    template <typename TExtents>
+    class mapping
+    {
+    public:
+
+      typedef TExtents extents_type;
+
+      mapping()
+        : ext()
+      {
+      }
+
+      mapping(const extents_type& ext_)
+        : ext(ext_)
+      {
+      }
+
+      const extents_type& extents() const
+      {
+        return ext;
+      }
+
+      //***********************************************************************
+      /// The offset of the element at the indices.
+      //***********************************************************************
+      size_t offset(const size_t* indices) const
+      {
+        size_t result = 0U;
+
+        for (size_t r = extents_type::RANK; r > 0U; --r)
+        {
+          result = (result * ext.extent(r - 1U)) + indices[r - 1U];
+        }
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// The distance between elements in dimension r.
+      //***********************************************************************
+      size_t stride(size_t r) const
+      {
+        size_t result = 1U;
+
+        for (size_t i = 0U; i < r; ++i)
+        {
+          result *= ext.extent(i);
+        }
+
+        return result;
+      }
+
+      size_t required_span_size() const
+      {
+        return ext.size();
+      }
+
+      static ETL_CONSTEXPR bool is_contiguous()
+      {
+        return true;
+      }
+
+    private:
+
+      extents_type ext;
+    };
+  };
+
+  //***************************************************************************
+  /// Layout with an explicit stride for each dimension.
+  /// Used for row, column and sub-block slices.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_stride
+  {
+    template <typename TExtents>
+    class mapping
+    {
+    public:
+
+      typedef TExtents extents_type;
+
+      mapping()
+        : ext()
+        , strides()
+      {
+      }
+
+      //***********************************************************************
+      /// Construct from extents and a list of RANK strides.
+      //***********************************************************************
+      mapping(const extents_type& ext_, const size_t* strides_)
+        : ext(ext_)
+      {
+        for (size_t r = 0U; r < extents_type::RANK; ++r)
+        {
+          strides[r] = strides_[r];
+        }
+      }
+
+      //***********************************************************************
+      /// Construct from any other mapping with the same extents type.
+      //***********************************************************************
+      template <typename TMapping>
+      explicit mapping(const TMapping& other)
+        : ext(other.extents())
+      {
+        for (size_t r = 0U; r < extents_type::RANK; ++r)
+        {
+          strides[r] = other.stride(r);
+        }
+      }
+
+      const extents_type& extents() const
+      {
+        return ext;
+      }
+
+      //***********************************************************************
+      /// The offset of the element at the indices.
+      //***********************************************************************
+      size_t offset(const size_t* indices) const
+      {
+        size_t result = 0U;
+
+        for (size_t r = 0U; r < extents_type::RANK; ++r)
+        {
+          result += indices[r] * strides[r];
+        }
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// The distance between elements in dimension r.
+      //***********************************************************************
+      size_t stride(size_t r) const
+      {
+        return strides[r];
+      }
+
+      size_t required_span_size() const
+      {
+        size_t result = 1U;
+
+        for (size_t r = 0U; r < extents_type::RANK; ++r)
+        {
+          if (ext.extent(r) == 0U)
+          {
+            return 0U;
+          }
+
+          result += (ext.extent(r) - 1U) * strides[r];
+        }
+
+        return result;
+      }
+
+      bool is_contiguous() const
+      {
+        return required_span_size() == ext.size();
+      }
+
+    private:
+
+      extents_type ext;
+      size_t       strides[extents_type::RANK];
+    };
+  };
+
+  //***************************************************************************
+  /// A non-owning multi-dimensional view.
+  ///\tparam T        The element type. May be const.
+  ///\tparam TExtents An etl::extents type.
+  ///\tparam TLayout  etl::layout_right, etl::layout_left or etl::layout_stride.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, typename TExtents, typename TLayout = etl::layout_right>
+  class mdspan
+  {
+  public:
+
+    typedef T                                          element_type;
+    typedef T                                          value_type;
+    typedef T&                                         reference;
+    typedef T*                                         pointer;
+    typedef size_t                                     size_type;
+    typedef TExtents                                   extents_type;
+    typedef TLayout                                    layout_type;
+    typedef typename TLayout::template mapping<TExtents> mapping_type;
+
+    static const size_t RANK = TExtents::RANK;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    mdspan()
+      : p_data(nullptr)
+      , map()
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and the dynamic extents.
+    //*************************************************************************
+    template <typename... TSizes>
+    explicit mdspan(pointer p_data_, TSizes... dynamic_sizes)
+      : p_data(p_data_)
+      , map(extents_type(static_cast<size_t>(dynamic_sizes)...))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and extents.
+    //*************************************************************************
+    mdspan(pointer p_data_, const extents_type& ext)
+      : p_data(p_data_)
+      , map(ext)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and a mapping.
+    //*************************************************************************
+    mdspan(pointer p_data_, const mapping_type& map_)
+      : p_data(p_data_)
+      , map(map_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a view of a compatible element type, such as
+    /// mdspan<const T> from mdspan<T>.
+    //*************************************************************************
+    template <typename U>
+    mdspan(const mdspan<U, TExtents, TLayout>& other)
+      : p_data(other.data())
+      , map(other.mapping())
+    {
+    }
+
+    //*************************************************************************
+    /// Access the element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    reference operator ()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == RANK, "Incorrect number of indices");
+
+      const size_t idx[] = { static_cast<size_t>(indices)... };
+
+      return p_data[map.offset(idx)];
+    }
+
+    //*************************************************************************
+    /// Access the element at the indices held in an array.
+    //*************************************************************************
+    reference operator [](const etl::array<size_t, RANK>& indices) const
+    {
+      return p_data[map.offset(indices.data())];
+    }
+
+    pointer data() const
+    {
+      return p_data;
+    }
+
+    const mapping_type& mapping() const
+    {
+      return map;
+    }
+
+    const extents_type& extents() const
+    {
+      return map.extents();
+    }
+
+    static ETL_CONSTEXPR size_t rank()
+    {
+      return RANK;
+    }
+
+    static ETL_CONSTEXPR size_t rank_dynamic()
+    {
+      return TExtents::RANK_DYNAMIC;
+    }
+
+    static size_t static_extent(size_t r)
+    {
+      return TExtents::static_extent(r);
+    }
+
+    size_t extent(size_t r) const
+    {
+      return map.extents().extent(r);
+    }
+
+    size_t stride(size_t r) const
+    {
+      return map.stride(r);
+    }
+
+    //*************************************************************************
+    /// The number of elements in the view.
+    //*************************************************************************
+    size_t size() const
+    {
+      return map.extents().size();
+    }
+
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    bool is_contiguous() const
+    {
+      return map.is_contiguous();
+    }
+
+  private:
+
+    pointer      p_data;
+    mapping_type map;
+  };
+
+  template <typename T, typename TExtents, typename TLayout>
+  const size_t mdspan<T, TExtents, TLayout>::RANK;
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// Unwraps a nested etl::array into its element type and extents.
+    //*************************************************************************
+    template <typename T, size_t... Extents>
+    struct multi_array_traits
+    {
+      typedef T                        value_type;
+      typedef etl::extents<Extents...> extents_type;
+
+      static const size_t SIZE = product(Extents...);
+
+      static T* first(T& t)
+      {
+        return &t;
+      }
+
+      static const T* first(const T& t)
+      {
+        return &t;
+      }
+    };
+
+    template <typename T, size_t N, size_t... Extents>
+    struct multi_array_traits<etl::array<T, N>, Extents...> : public multi_array_traits<T, Extents..., N>
+    {
+      typedef multi_array_traits<T, Extents..., N> base_t;
+
+      static typename base_t::value_type* first(etl::array<T, N>& a)
+      {
+        return base_t::first(a[0]);
+      }
+
+      static const typename base_t::value_type* first(const etl::array<T, N>& a)
+      {
+        return base_t::first(a[0]);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Makes a row major view over an etl::multi_array, with all extents fixed
+  /// at compile time.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t N>
+  etl::mdspan<typename private_mdspan::multi_array_traits<etl::array<T, N> >::value_type,
+              typename private_mdspan::multi_array_traits<etl::array<T, N> >::extents_type>
+    make_mdspan(etl::array<T, N>& a)
+  {
+    typedef private_mdspan::multi_array_traits<etl::array<T, N> > traits;
+    typedef typename traits::value_type   value_type;
+    typedef typename traits::extents_type extents_type;
+
+    ETL_STATIC_ASSERT(sizeof(a) == (sizeof(value_type) * traits::SIZE), "multi_array is not contiguous");
+
+    return etl::mdspan<value_type, extents_type>(traits::first(a));
+  }
+
+  //***************************************************************************
+  /// Makes a row major view over a const etl::multi_array.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t N>
+  etl::mdspan<const typename private_mdspan::multi_array_traits<etl::array<T, N> >::value_type,
+              typename private_mdspan::multi_array_traits<etl::array<T, N> >::extents_type>
+    make_mdspan(const etl::array<T, N>& a)
+  {
+    typedef private_mdspan::multi_array_traits<etl::array<T, N> > traits;
+    typedef typename traits::value_type   value_type;
+    typedef typename traits::extents_type extents_type;
+
+    return etl::mdspan<const value_type, extents_type>(traits::first(a));
+  }
+
+  //***************************************************************************
+  /// A view of row 'r' of a rank 2 view.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t E0, size_t E1, typename TLayout>
+  etl::mdspan<T, etl::extents<E1>, etl::layout_stride>
+    row(const etl::mdspan<T, etl::extents<E0, E1>, TLayout>& m, size_t r)
+  {
+    typedef etl::extents<E1> extents_type;
+
+    const size_t all[]     = { m.extent(1) };
+    const size_t strides[] = { m.stride(1) };
+
+    typename etl::layout_stride::template mapping<extents_type> map(extents_type::from_all(all), strides);
+
+    return etl::mdspan<T, extents_type, etl::layout_stride>(m.data() + (r * m.stride(0)), map);
+  }
+
+  //***************************************************************************
+  /// A view of column 'c' of a rank 2 view.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t E0, size_t E1, typename TLayout>
+  etl::mdspan<T, etl::extents<E0>, etl::layout_stride>
+    column(const etl::mdspan<T, etl::extents<E0, E1>, TLayout>& m, size_t c)
+  {
+    typedef etl::extents<E0> extents_type;
+
+    const size_t all[]     = { m.extent(0) };
+    const size_t strides[] = { m.stride(0) };
+
+    typename etl::layout_stride::template mapping<extents_type> map(extents_type::from_all(all), strides);
+
+    return etl::mdspan<T, extents_type, etl::layout_stride>(m.data() + (c * m.stride(1)), map);
+  }
+
+  //***************************************************************************
+  /// A view of the block starting at 'offsets' with extents 'sizes'.
+  /// The block must lie within the source view.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, typename TExtents, typename TLayout>
+  etl::mdspan<T, etl::dextents<TExtents::RANK>, etl::layout_stride>
+    subspan(const etl::mdspan<T, TExtents, TLayout>& m,
+            const etl::array<size_t, TExtents::RANK>& offsets,
+            const etl::array<size_t, TExtents::RANK>& sizes)
+  {
+    typedef etl::dextents<TExtents::RANK> extents_type;
+
+    size_t strides[TExtents::RANK];
+
+    for (size_t r = 0U; r < TExtents::RANK; ++r)
+    {
+      strides[r] = m.stride(r);
+    }
+
+    typename etl::layout_stride::template mapping<extents_type> map(extents_type::from_all(sizes.data()), strides);
+
+    return etl::mdspan<T, extents_type, etl::layout_stride>(m.data() + m.mapping().offset(offsets.data()), map);
+  }
+
+#endif
+}
+
+#endif
@@ -63,6 +63,36 @@ namespace etl
     }
   };
 
+#if defined(ETL_MESSAGE_TRACE)
+  /// Allow alternative type for trace timestamps, such as a 64 bit cycle count.
+  #if !defined(ETL_MESSAGE_TRACE_TIMESTAMP_TYPE)
+    typedef uint32_t message_trace_timestamp_t;
+  #else
+    typedef ETL_MESSAGE_TRACE_TIMESTAMP_TYPE message_trace_timestamp_t;
+  #endif
+
+  typedef uint32_t message_trace_id_t;
+
+  //***************************************************************************
+  /// The trace context carried by a message when ETL_MESSAGE_TRACE is defined.
+  /// Copied with the message, so a queued copy keeps the trace of the original.
+  /// See etl::message_trace.
+  //***************************************************************************
+  struct message_trace_context
+  {
+    message_trace_context()
+      : id(0U),
+        begin(0U),
+        last(0U)
+    {
+    }
+
+    etl::message_trace_id_t        id;    ///< Zero until the trace begins.
+    etl::message_trace_timestamp_t begin; ///< The time that the trace began.
+    etl::message_trace_timestamp_t last;  ///< The time of the latest trace point.
+  };
+#endif
+
   //***************************************************************************
   class imessage
   {
@@ -75,14 +105,24 @@ namespace etl
 
     const etl::message_id_t message_id;
 
+#if defined(ETL_MESSAGE_TRACE)
+    /// Mutable, as messages are passed on by const reference.
+    mutable etl::message_trace_context trace;
+#endif
+
 #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
     virtual ~imessage()
     {
     }
+#else
+#if ETL_CPP11_SUPPORTED
+    // Trivial, so that messages with trivial members are trivially destructible.
+    ~imessage() = default;
 #else
     ~imessage()
     {
     }
+#endif
 #endif
   };
 
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
 
 #undef ETL_FILE
 #define ETL_FILE "39"
@@ -108,6 +109,7 @@ namespace etl
                                                                 compare_router_id());
 
           router_list.insert(irouter, &router);
+          rebuild_index();
         }
       }
 
@@ -131,6 +133,7 @@ namespace etl
                                                                                                compare_router_id());
 
         router_list.erase(range.first, range.second);
+        rebuild_index();
       }
     }
 
@@ -144,6 +147,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        rebuild_index();
       }
     }
 
@@ -174,6 +178,9 @@ namespace etl
                  etl::message_router_id_t destination_router_id,
                  const etl::imessage&     message)
     {
+      ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(message.message_id)
+      ETL_MESSAGE_TRACE_POINT(message, Publish)
+
       switch (destination_router_id)
       {
         //*****************************
@@ -187,6 +194,30 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
+          if ((p_index != nullptr) && (size_t(message.message_id) < index_ids))
+          {
+            // Only the routers that accept the message.
+            const uint32_t* p_mask = p_index + (size_t(message.message_id) * index_words);
+
+            for (size_t word = 0U; word < index_words; ++word)
+            {
+              uint32_t mask = p_mask[word];
+
+              while (mask != 0U)
+              {
+                const size_t position = (word * 32U) + etl::count_trailing_zeros(mask);
+                mask &= (mask - 1U);
+
+                if (position < router_list.size())
+                {
+                  router_list[position]->receive(source, destination_router_id, message);
+                }
+              }
+            }
+
+            break;
+          }
+
           router_list_t::iterator irouter = router_list.begin();
 
           // Broadcast to everyone.
@@ -248,6 +279,19 @@ namespace etl
       }
     }
 
+    using imessage_router::receive_batch;
+
+    //*******************************************
+    /// Broadcasts a batch of messages, in order.
+    //*******************************************
+    void receive_batch(etl::imessage_router& source, const etl::message_batch& batch)
+    {
+      for (size_t i = 0U; i < batch.size(); ++i)
+      {
+        imessage_bus::receive(source, etl::imessage_router::ALL_MESSAGE_ROUTERS, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -268,7 +312,8 @@ namespace etl
     //*******************************************
     void clear()
     {
-      return router_list.clear();
+      router_list.clear();
+      rebuild_index();
     }
 
     //********************************************
@@ -284,10 +329,54 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(nullptr),
+        index_ids(0U),
+        index_words(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with an index of the routers that accept each message id.
+    /// The index holds one bit per router for each of the ids in [0, index_ids_).
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t index_ids_, size_t index_words_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        index_ids(index_ids_),
+        index_words(index_words_)
     {
     }
 
+    //*******************************************
+    /// Record which routers accept each indexed message id.
+    /// Routers are assumed to accept the same ids for as long as they are subscribed.
+    //*******************************************
+    void rebuild_index()
+    {
+      if (p_index != nullptr)
+      {
+        for (size_t i = 0U; i < (index_ids * index_words); ++i)
+        {
+          p_index[i] = 0U;
+        }
+
+        for (size_t position = 0U; position < router_list.size(); ++position)
+        {
+          const etl::imessage_router& router = *router_list[position];
+
+          for (size_t id = 0U; id < index_ids; ++id)
+          {
+            if (router.accepts(etl::message_id_t(id)))
+            {
+              p_index[(id * index_words) + (position / 32U)] |= (uint32_t(1U) << (position % 32U));
+            }
+          }
+        }
+      }
+    }
+
   private:
 
     //*******************************************
@@ -307,12 +396,19 @@ namespace etl
     };
 
     router_list_t& router_list;
+    uint32_t*      p_index;
+    size_t         index_ids;
+    size_t         index_words;
   };
 
   //***************************************************************************
   /// The message bus
+  ///\tparam MAX_ROUTERS_     The maximum number of subscribed routers.
+  ///\tparam MAX_MESSAGE_IDS_ If not zero, broadcasts of message ids below this
+  ///                         are only delivered to the routers that accept them,
+  ///                         using an index built when routers subscribe.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_MESSAGE_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
   public:
@@ -321,13 +417,20 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_bus()
-      : imessage_bus(router_list)
+      : imessage_bus(router_list, (MAX_MESSAGE_IDS_ == 0U) ? nullptr : index, MAX_MESSAGE_IDS_, INDEX_WORDS)
     {
+      this->rebuild_index();
     }
 
   private:
 
+    enum
+    {
+      INDEX_WORDS = (MAX_ROUTERS_ + 31U) / 32U
+    };
+
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    uint32_t index[(MAX_MESSAGE_IDS_ == 0U) ? 1U : (MAX_MESSAGE_IDS_ * INDEX_WORDS)];
   };
 
   //***************************************************************************
@@ -0,0 +1,268 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_INBOX_INCLUDED
+#define ETL_MESSAGE_INBOX_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "nullptr.h"
+#include "queue_spsc_atomic.h"
+#include "queue_mpmc_atomic.h"
+#include "private/queued_message.h"
+
+///\defgroup message_inbox message_inbox
+/// A queue that decouples a message router from the thread that sends to it.
+///\ingroup messaging
+
+namespace etl
+{
+  //***************************************************************************
+  /// Inbox policy for a single posting thread.
+  /// Uses etl::queue_spsc_atomic.
+  ///\ingroup message_inbox
+  //***************************************************************************
+  struct message_inbox_spsc
+  {
+    template <typename T, size_t SIZE>
+    struct queue
+    {
+      typedef etl::queue_spsc_atomic<T, SIZE> type;
+    };
+  };
+
+  //***************************************************************************
+  /// Inbox policy for several posting threads.
+  /// Uses etl::queue_mpmc_atomic. SIZE must be a power of two.
+  ///\ingroup message_inbox
+  //***************************************************************************
+  struct message_inbox_mpsc
+  {
+    template <typename T, size_t SIZE>
+    struct queue
+    {
+      typedef etl::queue_mpmc_atomic<T, SIZE> type;
+    };
+  };
+
+  //***************************************************************************
+  /// An inbox for a message router.
+  /// Subscribe the inbox to a message bus, or send to it, in place of the router.
+  /// Messages that the router accepts are copied to a queue without blocking and
+  /// are delivered when the router's own thread calls process().
+  /// The sender is passed on to the router unless it was a null router.
+  ///\tparam TRouter The router that will handle the messages.
+  ///\tparam SIZE    The number of messages that may be waiting.
+  ///\tparam TPolicy etl::message_inbox_spsc or etl::message_inbox_mpsc.
+  ///\ingroup message_inbox
+  //***************************************************************************
+  template <typename TRouter, size_t SIZE, typename TPolicy = etl::message_inbox_spsc>
+  class message_inbox : public etl::imessage_router
+  {
+  public:
+
+    typedef TRouter                                                 router_type;
+    typedef typename TRouter::message_packet                        message_packet;
+    typedef etl::private_message::queued_message<message_packet>   item_type;
+    typedef typename TPolicy::template queue<item_type, SIZE>::type queue_type;
+    typedef typename queue_type::size_type                          size_type;
+
+    //*******************************************
+    /// Constructor.
+    /// The inbox takes the router id of the router.
+    //*******************************************
+    message_inbox(TRouter& router_)
+      : imessage_router(router_.get_message_router_id()),
+        router(router_),
+        overflow_count(0U)
+    {
+    }
+
+    //*******************************************
+    void receive(const etl::imessage& message)
+    {
+      post(etl::null_message_router::instance(), message);
+    }
+
+    //*******************************************
+    void receive(etl::imessage_router& source, const etl::imessage& message)
+    {
+      post(source, message);
+    }
+
+    //*******************************************
+    void receive(etl::imessage_router& source, etl::message_router_id_t destination_router_id, const etl::imessage& message)
+    {
+      if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
+      {
+        post(source, message);
+      }
+    }
+
+    //*******************************************
+    /// Queues a copy of the message if the router accepts it.
+    /// Never blocks.
+    /// Returns false if the message was accepted but the inbox was full.
+    /// May be called from the posting thread(s) only.
+    //*******************************************
+    bool post(etl::imessage_router& source, const etl::imessage& message)
+    {
+      if (!router.accepts(message.message_id))
+      {
+        return true;
+      }
+
+      etl::imessage_router* p_sender = source.is_null_router() ? nullptr : &source;
+
+      ETL_MESSAGE_TRACE_POINT(message, Enqueue)
+
+      if (queue.emplace(p_sender, message))
+      {
+        return true;
+      }
+
+      ++overflow_count;
+
+      return false;
+    }
+
+    //*******************************************
+    /// Delivers every waiting message to the router.
+    /// Call from the router's own thread.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t process()
+    {
+      size_t count = 0U;
+
+      while (process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Delivers the oldest waiting message to the router.
+    /// Call from the router's own thread.
+    /// Returns false if the inbox was empty.
+    //*******************************************
+    bool process_one()
+    {
+      item_type item;
+
+      if (!queue.pop(item))
+      {
+        return false;
+      }
+
+      ETL_MESSAGE_TRACE_POINT(item.get(), Dequeue)
+
+      router.receive(item.sender(), item.get());
+
+      return true;
+    }
+
+    //*******************************************
+    /// Removes the oldest waiting message without delivering it.
+    /// Call from the router's own thread.
+    /// Returns false if the inbox was empty.
+    //*******************************************
+    bool pop(item_type& item)
+    {
+      return queue.pop(item);
+    }
+
+    //*******************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return router.accepts(id);
+    }
+
+    //*******************************************
+    bool is_null_router() const
+    {
+      return false;
+    }
+
+    //*******************************************
+    /// The router that messages are delivered to.
+    //*******************************************
+    TRouter& get_router()
+    {
+      return router;
+    }
+
+    //*******************************************
+    /// Is the inbox empty?
+    /// Accurate only when called from the router's thread.
+    //*******************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// The maximum number of waiting messages.
+    //*******************************************
+    size_type capacity() const
+    {
+      return queue.capacity();
+    }
+
+    //*******************************************
+    /// The number of messages dropped because the inbox was full.
+    //*******************************************
+    size_t get_overflow_count() const
+    {
+      return overflow_count.load();
+    }
+
+  private:
+
+    TRouter&           router;
+    queue_type         queue;
+    etl::atomic_size_t overflow_count;
+  };
+}
+
+#endif
+
+#endif
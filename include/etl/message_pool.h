@@ -0,0 +1,667 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_POOL_INCLUDED
+#define ETL_MESSAGE_POOL_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "message.h"
+#include "pool.h"
+#include "largest.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "nullptr.h"
+#include "utility.h"
+
+#undef ETL_FILE
+#define ETL_FILE "59"
+
+///\defgroup message_pool message_pool
+/// A pool of messages, shared through reference counted handles.
+/// A handle is the size of a pointer, so queuing a message costs a pointer
+/// rather than a copy of the largest message type.
+/// The pool and the handles are not thread safe.
+///\ingroup messaging
+
+namespace etl
+{
+  class imessage_pool;
+
+  //***************************************************************************
+  /// Base exception class for message_pool.
+  //***************************************************************************
+  class message_pool_exception : public etl::exception
+  {
+  public:
+
+    message_pool_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// No slab can hold the message.
+  //***************************************************************************
+  class message_pool_cannot_create : public etl::message_pool_exception
+  {
+  public:
+
+    message_pool_cannot_create(string_type file_name_, numeric_type line_number_)
+      : message_pool_exception(ETL_ERROR_TEXT("message_pool:cannot create", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The message was not created by the pool.
+  //***************************************************************************
+  class message_pool_not_in_pool : public etl::message_pool_exception
+  {
+  public:
+
+    message_pool_not_in_pool(string_type file_name_, numeric_type line_number_)
+      : message_pool_exception(ETL_ERROR_TEXT("message_pool:not in pool", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_message_pool
+  {
+    //*************************************************************************
+    /// Placed at the start of each block, before the message.
+    //*************************************************************************
+    struct block_header
+    {
+      etl::imessage*      p_message;
+      etl::imessage_pool* p_pool;
+      void              (*p_destroy)(etl::imessage&);
+      uint32_t            count;
+      uint_least8_t       slab;
+    };
+
+    //*************************************************************************
+    /// Messages may not have virtual destructors, so each block remembers how
+    /// to destroy its message.
+    //*************************************************************************
+    template <typename TMessage>
+    void destroy_message(etl::imessage& message)
+    {
+      static_cast<TMessage&>(message).~TMessage();
+    }
+
+    //*************************************************************************
+    /// A slab of COUNT blocks.
+    //*************************************************************************
+    template <const size_t BLOCK_SIZE, const size_t ALIGNMENT, const size_t COUNT>
+    class slab : public etl::generic_pool<BLOCK_SIZE, ALIGNMENT, COUNT>
+    {
+    public:
+
+      etl::ipool* get()
+      {
+        return this;
+      }
+    };
+
+    //*************************************************************************
+    /// An unused slab.
+    //*************************************************************************
+    template <const size_t BLOCK_SIZE, const size_t ALIGNMENT>
+    class slab<BLOCK_SIZE, ALIGNMENT, 0U>
+    {
+    public:
+
+      etl::ipool* get()
+      {
+        return nullptr;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A reference counted handle to a pooled message.
+  /// The message is returned to its pool when the last handle is destroyed.
+  /// The message is shared, so only const access is given.
+  ///\ingroup message_pool
+  //***************************************************************************
+  class message_ptr
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor. Holds no message.
+    //*************************************************************************
+    message_ptr()
+      : p_header(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Shares the message.
+    //*************************************************************************
+    message_ptr(const message_ptr& other)
+      : p_header(other.p_header)
+    {
+      acquire();
+    }
+
+    //*************************************************************************
+    /// Assignment. Shares the message.
+    //*************************************************************************
+    message_ptr& operator =(const message_ptr& other)
+    {
+      // Acquire first, in case both share the same message.
+      private_message_pool::block_header* p_other = other.p_header;
+
+      if (p_other != nullptr)
+      {
+        ++p_other->count;
+      }
+
+      release();
+      p_header = p_other;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~message_ptr()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    /// Releases the message.
+    //*************************************************************************
+    void reset()
+    {
+      release();
+      p_header = nullptr;
+    }
+
+    //*************************************************************************
+    /// Does the handle hold a message?
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return p_header != nullptr;
+    }
+
+    //*************************************************************************
+    /// Gets the message.
+    //*************************************************************************
+    const etl::imessage& get() const
+    {
+      return *p_header->p_message;
+    }
+
+    //*************************************************************************
+    const etl::imessage& operator *() const
+    {
+      return *p_header->p_message;
+    }
+
+    //*************************************************************************
+    const etl::imessage* operator ->() const
+    {
+      return p_header->p_message;
+    }
+
+    //*************************************************************************
+    /// The number of handles that share the message.
+    //*************************************************************************
+    size_t use_count() const
+    {
+      return (p_header == nullptr) ? 0U : size_t(p_header->count);
+    }
+
+  private:
+
+    friend class etl::imessage_pool;
+
+    //*************************************************************************
+    /// Takes the first reference to a new block, or another to a shared one.
+    //*************************************************************************
+    explicit message_ptr(private_message_pool::block_header* p_header_)
+      : p_header(p_header_)
+    {
+      acquire();
+    }
+
+    //*************************************************************************
+    void acquire()
+    {
+      if (p_header != nullptr)
+      {
+        ++p_header->count;
+      }
+    }
+
+    //*************************************************************************
+    inline void release();
+
+    private_message_pool::block_header* p_header;
+  };
+
+  //***************************************************************************
+  /// Interface for a message pool.
+  ///\ingroup message_pool
+  //***************************************************************************
+  class imessage_pool
+  {
+  public:
+
+    /// The maximum number of size classes.
+    static const size_t MAX_SLABS = 4U;
+
+    /// The alignment of every message in the pool.
+    static const size_t ALIGNMENT = etl::largest_alignment<void*, int64_t, double>::value;
+
+    /// The offset of the message from the start of its block.
+    static const size_t PAYLOAD_OFFSET = ((sizeof(private_message_pool::block_header) + ALIGNMENT - 1U) / ALIGNMENT) * ALIGNMENT;
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Creates a message. Default constructor.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::message_ptr create()
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage();
+      }
+
+      return etl::message_ptr(p_header);
+    }
+
+    //*************************************************************************
+    /// Creates a message. One parameter constructor.
+    //*************************************************************************
+    template <typename TMessage, typename TP1>
+    etl::message_ptr create(const TP1& p1)
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage(p1);
+      }
+
+      return etl::message_ptr(p_header);
+    }
+
+    //*************************************************************************
+    /// Creates a message. Two parameter constructor.
+    //*************************************************************************
+    template <typename TMessage, typename TP1, typename TP2>
+    etl::message_ptr create(const TP1& p1, const TP2& p2)
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage(p1, p2);
+      }
+
+      return etl::message_ptr(p_header);
+    }
+
+    //*************************************************************************
+    /// Creates a message. Three parameter constructor.
+    //*************************************************************************
+    template <typename TMessage, typename TP1, typename TP2, typename TP3>
+    etl::message_ptr create(const TP1& p1, const TP2& p2, const TP3& p3)
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage(p1, p2, p3);
+      }
+
+      return etl::message_ptr(p_header);
+    }
+
+    //*************************************************************************
+    /// Creates a message. Four parameter constructor.
+    //*************************************************************************
+    template <typename TMessage, typename TP1, typename TP2, typename TP3, typename TP4>
+    etl::message_ptr create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage(p1, p2, p3, p4);
+      }
+
+      return etl::message_ptr(p_header);
+    }
+#else
+    //*************************************************************************
+    /// Creates a message. Variadic parameter constructor.
+    //*************************************************************************
+    template <typename TMessage, typename... Args>
+    etl::message_ptr create(Args&&... args)
+    {
+      private_message_pool::block_header* p_header = allocate<TMessage>();
+
+      if (p_header != nullptr)
+      {
+        p_header->p_message = ::new (payload(p_header)) TMessage(etl::forward<Args>(args)...);
+      }
+
+      return etl::message_ptr(p_header);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets another handle to a message that was created by the pool.
+    /// Allows a router that was passed a pooled message by a message bus to
+    /// keep it without making a copy.
+    //*************************************************************************
+    etl::message_ptr share(const etl::imessage& message)
+    {
+      private_message_pool::block_header* p_header = find_header(message);
+
+      ETL_ASSERT(p_header != nullptr, ETL_ERROR(etl::message_pool_not_in_pool));
+
+      return etl::message_ptr(p_header);
+    }
+
+    //*************************************************************************
+    /// Checks if the message was created by the pool.
+    //*************************************************************************
+    bool is_in_pool(const etl::imessage& message) const
+    {
+      return find_header(message) != nullptr;
+    }
+
+    //*************************************************************************
+    /// The number of messages in the pool.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < MAX_SLABS; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          n += slabs[i]->size();
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The maximum number of messages in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < MAX_SLABS; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          n += slabs[i]->max_size();
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no messages in the pool.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of free blocks that can hold a message of the size.
+    //*************************************************************************
+    size_t available(size_t message_size) const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < MAX_SLABS; ++i)
+      {
+        if ((slabs[i] != nullptr) && (message_size <= payload_sizes[i]))
+        {
+          n += slabs[i]->available();
+        }
+      }
+
+      return n;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imessage_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~imessage_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the slabs, smallest first.
+    /// Slabs that are not used are nullptr.
+    //*************************************************************************
+    void set_slabs(etl::ipool* p_slab1, size_t size1,
+                   etl::ipool* p_slab2, size_t size2,
+                   etl::ipool* p_slab3, size_t size3,
+                   etl::ipool* p_slab4, size_t size4)
+    {
+      slabs[0] = p_slab1;
+      slabs[1] = p_slab2;
+      slabs[2] = p_slab3;
+      slabs[3] = p_slab4;
+
+      payload_sizes[0] = size1;
+      payload_sizes[1] = size2;
+      payload_sizes[2] = size3;
+      payload_sizes[3] = size4;
+    }
+
+  private:
+
+    friend class etl::message_ptr;
+
+    //*************************************************************************
+    /// Takes a block from the smallest slab that can hold the message and has
+    /// a free block.
+    //*************************************************************************
+    template <typename TMessage>
+    private_message_pool::block_header* allocate()
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+      ETL_STATIC_ASSERT((etl::alignment_of<TMessage>::value <= ALIGNMENT), "Message has incompatible alignment");
+
+      for (size_t i = 0U; i < MAX_SLABS; ++i)
+      {
+        if ((slabs[i] != nullptr) && (sizeof(TMessage) <= payload_sizes[i]) && !slabs[i]->full())
+        {
+          private_message_pool::block_header* p_header = ::new (slabs[i]->template allocate<char>()) private_message_pool::block_header;
+
+          p_header->p_message = nullptr;
+          p_header->p_pool    = this;
+          p_header->p_destroy = &private_message_pool::destroy_message<TMessage>;
+          p_header->count     = 0U;
+          p_header->slab      = uint_least8_t(i);
+
+          return p_header;
+        }
+      }
+
+      ETL_ASSERT(false, ETL_ERROR(etl::message_pool_cannot_create));
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Destroys the message and returns the block to its slab.
+    //*************************************************************************
+    void release(private_message_pool::block_header& header)
+    {
+      header.p_destroy(*header.p_message);
+      slabs[header.slab]->release(&header);
+    }
+
+    //*************************************************************************
+    /// Gets the header of a pooled message, or nullptr.
+    //*************************************************************************
+    private_message_pool::block_header* find_header(const etl::imessage& message) const
+    {
+      const char* p_block = reinterpret_cast<const char*>(&message) - PAYLOAD_OFFSET;
+
+      for (size_t i = 0U; i < MAX_SLABS; ++i)
+      {
+        if ((slabs[i] != nullptr) && slabs[i]->is_in_pool(p_block))
+        {
+          return reinterpret_cast<private_message_pool::block_header*>(const_cast<char*>(p_block));
+        }
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    static void* payload(private_message_pool::block_header* p_header)
+    {
+      return reinterpret_cast<char*>(p_header) + PAYLOAD_OFFSET;
+    }
+
+    // Disabled.
+    imessage_pool(const imessage_pool&);
+    imessage_pool& operator =(const imessage_pool&);
+
+    etl::ipool* slabs[MAX_SLABS];         ///< The slabs, smallest first.
+    size_t      payload_sizes[MAX_SLABS]; ///< The largest message that each slab can hold.
+  };
+
+  //***************************************************************************
+  inline void message_ptr::release()
+  {
+    if ((p_header != nullptr) && (--p_header->count == 0U))
+    {
+      p_header->p_pool->release(*p_header);
+    }
+  }
+
+  //***************************************************************************
+  /// A message pool with up to four size classes.
+  /// Each size class is a slab of fixed size blocks, so a small message does
+  /// not take a block sized for the largest message.
+  /// A message is created in the smallest slab that can hold it. If that slab
+  /// is full then the next larger slab is used.
+  ///\code
+  /// // 32 messages of up to 16 bytes and 4 of up to 256 bytes.
+  /// etl::message_pool<16, 32, 256, 4> pool;
+  ///
+  /// etl::message_ptr p = pool.create<Data>(payload);
+  /// queue.push(p);
+  /// bus.receive(*p);
+  ///\endcode
+  ///\tparam SIZE1  The largest message in the first slab.
+  ///\tparam COUNT1 The number of messages in the first slab.
+  ///\tparam SIZEn  The largest message in slab n. Must be larger than the previous slab.
+  ///\tparam COUNTn The number of messages in slab n. Zero if unused.
+  ///\ingroup message_pool
+  //***************************************************************************
+  template <const size_t SIZE1,      const size_t COUNT1,
+            const size_t SIZE2 = 0U, const size_t COUNT2 = 0U,
+            const size_t SIZE3 = 0U, const size_t COUNT3 = 0U,
+            const size_t SIZE4 = 0U, const size_t COUNT4 = 0U>
+  class message_pool : public etl::imessage_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT((COUNT1 > 0U), "The first slab may not be empty");
+    ETL_STATIC_ASSERT(((COUNT2 == 0U) || (SIZE2 > SIZE1)), "Slabs must be in increasing size");
+    ETL_STATIC_ASSERT(((COUNT3 == 0U) || ((COUNT2 > 0U) && (SIZE3 > SIZE2))), "Slabs must be in increasing size");
+    ETL_STATIC_ASSERT(((COUNT4 == 0U) || ((COUNT3 > 0U) && (SIZE4 > SIZE3))), "Slabs must be in increasing size");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    message_pool()
+    {
+      this->set_slabs(slab1.get(), SIZE1,
+                      slab2.get(), SIZE2,
+                      slab3.get(), SIZE3,
+                      slab4.get(), SIZE4);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// All handles must have been released.
+    //*************************************************************************
+    ~message_pool()
+    {
+    }
+
+  private:
+
+    private_message_pool::slab<PAYLOAD_OFFSET + SIZE1, ALIGNMENT, COUNT1> slab1;
+    private_message_pool::slab<PAYLOAD_OFFSET + SIZE2, ALIGNMENT, COUNT2> slab2;
+    private_message_pool::slab<PAYLOAD_OFFSET + SIZE3, ALIGNMENT, COUNT3> slab3;
+    private_message_pool::slab<PAYLOAD_OFFSET + SIZE4, ALIGNMENT, COUNT4> slab4;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -58,6 +58,10 @@ cog.outl("//********************************************************************
 // python -m cogapp -d -e -omessage_router.h -DHandlers=16 message_router_generator.h
 //
 // See generate.bat
+//
+// The generated handlers are only used for C++03, or if
+// ETL_MESSAGE_ROUTER_FORCE_CPP03 is defined. Otherwise the variadic
+// message_router is used, which has no limit on the number of messages.
 //***************************************************************************
 
 #ifndef ETL_MESSAGE_ROUTER_INCLUDED
@@ -75,6 +79,26 @@ cog.outl("//********************************************************************
 #include "largest.h"
 #include "nullptr.h"
 
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+  #include "message_router_statistics.h"
+
+  #define ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(id)  etl::message_router_statistics_scope etl_statistics_scope(this->get_statistics(), etl::message_id_t(id));
+  #define ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED  etl_statistics_scope.forwarded();
+  #define ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN    etl_statistics_scope.unknown();
+#else
+  #define ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(id)
+  #define ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED
+  #define ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN
+#endif
+
+#if defined(ETL_MESSAGE_TRACE)
+  #include "message_trace.h"
+
+  #define ETL_MESSAGE_TRACE_POINT(message, point)  etl::message_trace::record((message), etl::message_trace_point::point, this->get_message_router_id());
+#else
+  #define ETL_MESSAGE_TRACE_POINT(message, point)
+#endif
+
 #undef ETL_FILE
 #define ETL_FILE "35"
 
@@ -106,6 +130,51 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// A view of an array of message packets, for delivery as a batch.
+  /// The element type may be any that returns its message from get(), from
+  /// storage at a fixed offset, such as a message router's message_packet.
+  //***************************************************************************
+  class message_batch
+  {
+  public:
+
+    //********************************************
+    template <typename TPacket>
+    message_batch(const TPacket* p_first, size_t n)
+      : p_data(reinterpret_cast<const char*>(p_first)),
+        stride(sizeof(TPacket)),
+        offset((n == 0U) ? 0U : size_t(reinterpret_cast<const char*>(&p_first->get()) - reinterpret_cast<const char*>(p_first))),
+        count(n)
+    {
+    }
+
+    //********************************************
+    const etl::imessage& operator [](size_t i) const
+    {
+      return *reinterpret_cast<const etl::imessage*>(p_data + (i * stride) + offset);
+    }
+
+    //********************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //********************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+  private:
+
+    const char* p_data;
+    size_t      stride;
+    size_t      offset;
+    size_t      count;
+  };
+
   //***************************************************************************
   class imessage_router
   {
@@ -118,6 +187,32 @@ namespace etl
     virtual bool accepts(etl::message_id_t id) const = 0;
     virtual bool is_null_router() const = 0;
 
+    //********************************************
+    /// Receives a batch of messages, in order.
+    /// Routers may override this to avoid a virtual call for each message.
+    //********************************************
+    virtual void receive_batch(imessage_router& source, const etl::message_batch& batch)
+    {
+      for (size_t i = 0U; i < batch.size(); ++i)
+      {
+        receive(source, batch[i]);
+      }
+    }
+
+    //********************************************
+    /// Receives a batch of messages, with a null router as the source.
+    //********************************************
+    void receive_batch(const etl::message_batch& batch);
+
+    //********************************************
+    /// Receives an array of message packets.
+    //********************************************
+    template <typename TPacket>
+    void receive_batch(const TPacket* p_first, size_t n)
+    {
+      receive_batch(etl::message_batch(p_first, n));
+    }
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -148,6 +243,30 @@ namespace etl
       return (successor != nullptr);
     }
 
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+    //********************************************
+    /// Sets the statistics that record the messages dispatched.
+    //********************************************
+    void set_statistics(etl::imessage_router_statistics& statistics)
+    {
+      p_statistics = &statistics;
+    }
+
+    //********************************************
+    /// Stops recording statistics.
+    //********************************************
+    void clear_statistics()
+    {
+      p_statistics = nullptr;
+    }
+
+    //********************************************
+    etl::imessage_router_statistics* get_statistics() const
+    {
+      return p_statistics;
+    }
+#endif
+
     enum
     {
       NULL_MESSAGE_ROUTER = 255,
@@ -161,6 +280,9 @@ namespace etl
     imessage_router(etl::message_router_id_t id_)
       : successor(nullptr),
         message_router_id(id_)
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+        , p_statistics(nullptr)
+#endif
     {
     }
 
@@ -168,6 +290,9 @@ namespace etl
                     imessage_router&         successor_)
       : successor(&successor_),
         message_router_id(id_)
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+        , p_statistics(nullptr)
+#endif
     {
     }
 
@@ -180,6 +305,10 @@ namespace etl
     etl::imessage_router* successor;
 
     etl::message_router_id_t  message_router_id;
+
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+    etl::imessage_router_statistics* p_statistics; ///< The dispatch statistics, if any.
+#endif
   };
 
   //***************************************************************************
@@ -230,6 +359,12 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  inline void imessage_router::receive_batch(const etl::message_batch& batch)
+  {
+    receive_batch(etl::null_message_router::instance(), batch);
+  }
+
   //***************************************************************************
   /// Send a message to a router.
   /// Sets the 'sender' to etl::null_message_router type.
@@ -250,6 +385,467 @@ namespace etl
     destination.receive(source, message);
   }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  /// The largest id range that is dispatched with a dense table.
+  /// Message types with ids spread wider than this are dispatched by comparison.
+  //***************************************************************************
+#if !defined(ETL_MESSAGE_ROUTER_MAX_TABLE_SIZE)
+  #define ETL_MESSAGE_ROUTER_MAX_TABLE_SIZE 256
+#endif
+
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// The lowest message id.
+    //*************************************************************************
+    template <typename T1, typename... TRest>
+    struct min_id
+    {
+      static const size_t value = (size_t(T1::ID) < min_id<TRest...>::value) ? size_t(T1::ID) : min_id<TRest...>::value;
+    };
+
+    template <typename T1>
+    struct min_id<T1>
+    {
+      static const size_t value = size_t(T1::ID);
+    };
+
+    //*************************************************************************
+    /// The highest message id.
+    //*************************************************************************
+    template <typename T1, typename... TRest>
+    struct max_id
+    {
+      static const size_t value = (size_t(T1::ID) > max_id<TRest...>::value) ? size_t(T1::ID) : max_id<TRest...>::value;
+    };
+
+    template <typename T1>
+    struct max_id<T1>
+    {
+      static const size_t value = size_t(T1::ID);
+    };
+
+    //*************************************************************************
+    /// The message type with the id, or void if there is none.
+    //*************************************************************************
+    template <size_t ID, typename... TTypes>
+    struct type_from_id
+    {
+      typedef void type;
+    };
+
+    template <size_t ID, typename T1, typename... TRest>
+    struct type_from_id<ID, T1, TRest...>
+    {
+      typedef typename etl::conditional<(size_t(T1::ID) == ID), T1, typename type_from_id<ID, TRest...>::type>::type type;
+    };
+
+    //*************************************************************************
+    /// Is T one of the types?
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct is_one_of_types : etl::integral_constant<bool, false>
+    {
+    };
+
+    template <typename T, typename T1, typename... TRest>
+    struct is_one_of_types<T, T1, TRest...> : etl::integral_constant<bool, etl::is_same<T, T1>::value || is_one_of_types<T, TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Are all of the message types trivially destructible?
+    //*************************************************************************
+    template <typename... TTypes>
+    struct all_trivially_destructible : etl::integral_constant<bool, true>
+    {
+    };
+
+    template <typename T1, typename... TRest>
+    struct all_trivially_destructible<T1, TRest...>
+      : etl::integral_constant<bool, etl::is_trivially_destructible<T1>::value && all_trivially_destructible<TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Are all of the message ids different?
+    //*************************************************************************
+    template <typename... TTypes>
+    struct ids_are_unique : etl::integral_constant<bool, true>
+    {
+    };
+
+    template <typename T1, typename... TRest>
+    struct ids_are_unique<T1, TRest...>
+      : etl::integral_constant<bool, etl::is_same<typename type_from_id<size_t(T1::ID), TRest...>::type, void>::value && ids_are_unique<TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// A sequence of table indexes.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <size_t N, size_t... Indexes>
+    struct make_index_sequence : make_index_sequence<N - 1U, N - 1U, Indexes...>
+    {
+    };
+
+    template <size_t... Indexes>
+    struct make_index_sequence<0U, Indexes...>
+    {
+      typedef index_sequence<Indexes...> type;
+    };
+  }
+
+  //***************************************************************************
+  /// The definition for any number of message types.
+  /// Receiving, accepts() and the message packet look up the message id in a
+  /// table built at compile time, indexed by the id's offset from the lowest id.
+  //***************************************************************************
+  template <typename TDerived, typename... TMessageTypes>
+  class message_router : public imessage_router
+  {
+  private:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) > 0U, "There must be at least one message type");
+    ETL_STATIC_ASSERT(private_message_router::ids_are_unique<TMessageTypes...>::value, "Message ids must be unique");
+
+    static const size_t MIN_ID = private_message_router::min_id<TMessageTypes...>::value;
+    static const size_t MAX_ID = private_message_router::max_id<TMessageTypes...>::value;
+    static const size_t RANGE  = MAX_ID - MIN_ID + 1U;
+    static const bool   DENSE  = (RANGE <= ETL_MESSAGE_ROUTER_MAX_TABLE_SIZE);
+
+    typedef void (*receive_t)(TDerived& router, etl::imessage_router& source, const etl::imessage& msg);
+    typedef void (*construct_t)(void* p, const etl::imessage& msg);
+    typedef void (*destroy_t)(etl::imessage* pmsg);
+
+    //**********************************************
+    /// The operations for one message type.
+    //**********************************************
+    template <typename T, typename TDummy = void>
+    struct handler_for
+    {
+      static void receive(TDerived& router, etl::imessage_router& source, const etl::imessage& msg)
+      {
+        router.on_receive(source, static_cast<const T&>(msg));
+      }
+
+      static void construct(void* p, const etl::imessage& msg)
+      {
+        ::new (p) T(static_cast<const T&>(msg));
+      }
+
+      static void destroy(etl::imessage* pmsg)
+      {
+        static_cast<T*>(pmsg)->~T();
+      }
+
+      static ETL_CONSTEXPR receive_t   get_receive()   { return &receive; }
+      static ETL_CONSTEXPR construct_t get_construct() { return &construct; }
+      static ETL_CONSTEXPR destroy_t   get_destroy()   { return &destroy; }
+    };
+
+    //**********************************************
+    /// An id that no message type has.
+    //**********************************************
+    template <typename TDummy>
+    struct handler_for<void, TDummy>
+    {
+      static ETL_CONSTEXPR receive_t   get_receive()   { return nullptr; }
+      static ETL_CONSTEXPR construct_t get_construct() { return nullptr; }
+      static ETL_CONSTEXPR destroy_t   get_destroy()   { return nullptr; }
+    };
+
+    //**********************************************
+    /// Selects one of the operations.
+    //**********************************************
+    struct receive_operation
+    {
+      typedef receive_t type;
+
+      template <typename T>
+      static ETL_CONSTEXPR type get() { return handler_for<T>::get_receive(); }
+    };
+
+    struct construct_operation
+    {
+      typedef construct_t type;
+
+      template <typename T>
+      static ETL_CONSTEXPR type get() { return handler_for<T>::get_construct(); }
+    };
+
+    struct destroy_operation
+    {
+      typedef destroy_t type;
+
+      template <typename T>
+      static ETL_CONSTEXPR type get() { return handler_for<T>::get_destroy(); }
+    };
+
+    //**********************************************
+    /// Find the operation using the dense table, indexed by id - MIN_ID.
+    /// The table is a constant, so needs no run time initialisation.
+    //**********************************************
+    template <typename TOperation, size_t... Indexes>
+    static typename TOperation::type find_in_table(size_t id, private_message_router::index_sequence<Indexes...>)
+    {
+      static const typename TOperation::type table[] =
+      {
+        TOperation::template get<typename private_message_router::type_from_id<MIN_ID + Indexes, TMessageTypes...>::type>()...
+      };
+
+      return ((id >= MIN_ID) && (id <= MAX_ID)) ? table[id - MIN_ID] : nullptr;
+    }
+
+    //**********************************************
+    template <typename TOperation>
+    static typename TOperation::type find(size_t id, etl::integral_constant<bool, true>)
+    {
+      return find_in_table<TOperation>(id, typename private_message_router::make_index_sequence<DENSE ? RANGE : 1U>::type());
+    }
+
+    //**********************************************
+    /// Find the operation by comparison, for sparse ids.
+    //**********************************************
+    template <typename TOperation>
+    static typename TOperation::type find(size_t id, etl::integral_constant<bool, false>)
+    {
+      return search<TOperation, TMessageTypes...>(id);
+    }
+
+    //**********************************************
+    template <typename TOperation, typename T1, typename... TRest>
+    static typename etl::enable_if<(sizeof...(TRest) != 0U), typename TOperation::type>::type search(size_t id)
+    {
+      return (id == size_t(T1::ID)) ? TOperation::template get<T1>() : search<TOperation, TRest...>(id);
+    }
+
+    //**********************************************
+    template <typename TOperation, typename T1, typename... TRest>
+    static typename etl::enable_if<(sizeof...(TRest) == 0U), typename TOperation::type>::type search(size_t id)
+    {
+      return (id == size_t(T1::ID)) ? TOperation::template get<T1>() : nullptr;
+    }
+
+    //**********************************************
+    template <typename TOperation>
+    static typename TOperation::type find(size_t id)
+    {
+      return find<TOperation>(id, etl::integral_constant<bool, DENSE>());
+    }
+
+  public:
+
+    //**********************************************
+    class message_packet
+    {
+    public:
+
+      //********************************************
+      explicit message_packet(const etl::imessage& msg)
+      {
+        construct_t p_construct = find<construct_operation>(msg.message_id);
+
+        if (p_construct != nullptr)
+        {
+          p_construct(data, msg);
+        }
+        else
+        {
+          ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+        }
+      }
+
+      //********************************************
+      template <typename T>
+      explicit message_packet(const T& msg)
+      {
+        ETL_STATIC_ASSERT((private_message_router::is_one_of_types<T, TMessageTypes...>::value), "Unsupported type for this message packet");
+
+        void* p = data;
+        ::new (p) T(static_cast<const T&>(msg));
+      }
+
+      //********************************************
+      ~message_packet()
+      {
+  #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
+        static_cast<etl::imessage*>(data)->~imessage();
+  #else
+        destroy(etl::integral_constant<bool, TRIVIALLY_DESTRUCTIBLE>());
+  #endif
+      }
+
+      //********************************************
+      etl::imessage& get()
+      {
+        return *static_cast<etl::imessage*>(data);
+      }
+
+      //********************************************
+      const etl::imessage& get() const
+      {
+        return *static_cast<const etl::imessage*>(data);
+      }
+
+      enum
+      {
+        SIZE      = etl::largest<TMessageTypes...>::size,
+        ALIGNMENT = etl::largest<TMessageTypes...>::alignment
+      };
+
+      /// If true, the destructor does not look up the message type.
+      static const bool TRIVIALLY_DESTRUCTIBLE = private_message_router::all_trivially_destructible<TMessageTypes...>::value;
+
+    private:
+
+      //********************************************
+      /// Every message type is trivially destructible, so there is nothing to do.
+      //********************************************
+      void destroy(etl::true_type)
+      {
+      }
+
+      //********************************************
+      void destroy(etl::false_type)
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+        destroy_t p_destroy = find<destroy_operation>(pmsg->message_id);
+
+        assert(p_destroy != nullptr);
+
+        if (p_destroy != nullptr)
+        {
+          p_destroy(pmsg);
+        }
+      }
+
+      typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    };
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_)
+      : imessage_router(id_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    void receive(const etl::imessage& msg)
+    {
+      receive(etl::null_message_router::instance(), msg);
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, etl::message_router_id_t destination_router_id, const etl::imessage& msg)
+    {
+      if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
+      {
+        receive(source, msg);
+      }
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage& msg)
+    {
+      ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(msg.message_id)
+      ETL_MESSAGE_TRACE_POINT(msg, Dispatch)
+
+      receive_t p_receive = find<receive_operation>(msg.message_id);
+
+      if (p_receive != nullptr)
+      {
+        p_receive(*static_cast<TDerived*>(this), source, msg);
+      }
+      else
+      {
+        if (has_successor())
+        {
+          ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED
+          get_successor().receive(source, msg);
+        }
+        else
+        {
+          ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN
+          static_cast<TDerived*>(this)->on_receive_unknown(source, msg);
+        }
+      }
+    }
+
+    using imessage_router::receive_batch;
+
+    //**********************************************
+    /// Receives a batch of messages, in order.
+    /// The handlers are called directly, and the table is only searched
+    /// when the message id differs from that of the previous message.
+    //**********************************************
+    void receive_batch(etl::imessage_router& source, const etl::message_batch& batch)
+    {
+      TDerived& derived = *static_cast<TDerived*>(this);
+
+      receive_t         p_receive = nullptr;
+      etl::message_id_t last_id   = etl::message_id_t(0);
+
+      for (size_t i = 0U; i < batch.size(); ++i)
+      {
+        const etl::imessage& msg = batch[i];
+
+        ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(msg.message_id)
+        ETL_MESSAGE_TRACE_POINT(msg, Dispatch)
+
+        if ((i == 0U) || (msg.message_id != last_id))
+        {
+          last_id   = msg.message_id;
+          p_receive = find<receive_operation>(last_id);
+        }
+
+        if (p_receive != nullptr)
+        {
+          p_receive(derived, source, msg);
+        }
+        else if (has_successor())
+        {
+          ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED
+          get_successor().receive(source, msg);
+        }
+        else
+        {
+          ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN
+          derived.on_receive_unknown(source, msg);
+        }
+      }
+    }
+
+    using imessage_router::accepts;
+
+    //**********************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return find<receive_operation>(id) != nullptr;
+    }
+
+    //********************************************
+    bool is_null_router() const
+    {
+      return false;
+    }
+  };
+#else
+
   /*[[[cog
       import cog
       ################################################
@@ -390,6 +986,9 @@ namespace etl
       cog.outl("  {")
       cog.outl("    const etl::message_id_t id = msg.message_id;")
       cog.outl("")
+      cog.outl("    ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(id)")
+      cog.outl("    ETL_MESSAGE_TRACE_POINT(msg, Dispatch)")
+      cog.outl("")
       cog.outl("    switch (id)")
       cog.outl("    {")
       for n in range(1, int(Handlers) + 1):
@@ -400,10 +999,12 @@ namespace etl
       cog.outl("      {")
       cog.outl("         if (has_successor())")
       cog.outl("         {")
+      cog.outl("           ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED")
       cog.outl("           get_successor().receive(source, msg);")
       cog.outl("         }")
       cog.outl("         else")
       cog.outl("         {")
+      cog.outl("           ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN")
       cog.outl("           static_cast<TDerived*>(this)->on_receive_unknown(source, msg);")
       cog.outl("         }")
       cog.outl("         break;")
@@ -590,6 +1191,9 @@ namespace etl
           cog.outl("  {")
           cog.outl("    const size_t id = msg.message_id;")
           cog.outl("")
+          cog.outl("    ETL_MESSAGE_ROUTER_STATISTICS_BEGIN(id)")
+          cog.outl("    ETL_MESSAGE_TRACE_POINT(msg, Dispatch)")
+          cog.outl("")
           cog.outl("    switch (id)")
           cog.outl("    {")
           for t in range(1, n + 1):
@@ -600,10 +1204,12 @@ namespace etl
           cog.outl("      {")
           cog.outl("         if (has_successor())")
           cog.outl("         {")
+          cog.outl("           ETL_MESSAGE_ROUTER_STATISTICS_FORWARDED")
           cog.outl("           get_successor().receive(source, msg);")
           cog.outl("         }")
           cog.outl("         else")
           cog.outl("         {")
+          cog.outl("           ETL_MESSAGE_ROUTER_STATISTICS_UNKNOWN")
           cog.outl("           static_cast<TDerived*>(this)->on_receive_unknown(source, msg);")
           cog.outl("         }")
           cog.outl("         break;")
@@ -639,6 +1245,7 @@ namespace etl
           cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
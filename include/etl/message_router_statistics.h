@@ -0,0 +1,306 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ROUTER_STATISTICS_INCLUDED
+#define ETL_MESSAGE_ROUTER_STATISTICS_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "message_types.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+///\defgroup message_router_statistics message_router_statistics
+/// Per message id dispatch counts and handler times for etl::message_router,
+/// etl::message_bus and etl::fsm.
+/// Statistics are only compiled in when ETL_MESSAGE_ROUTER_STATISTICS is
+/// defined. Without it, the routers have no statistics members and no
+/// statistics calls.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  /// Allow alternative type for the handler times, such as a 64 bit cycle count.
+#if !defined(ETL_MESSAGE_ROUTER_STATISTICS_TIMESTAMP_TYPE)
+    typedef uint32_t message_router_timestamp_t;
+#else
+    typedef ETL_MESSAGE_ROUTER_STATISTICS_TIMESTAMP_TYPE message_router_timestamp_t;
+#endif
+
+  //***************************************************************************
+  /// Interface for router statistics.
+  /// Written by the thread that runs the router; may be read by any thread.
+  /// Ids at or above max_ids() are only counted in overflow().
+  ///\ingroup message_router_statistics
+  //***************************************************************************
+  class imessage_router_statistics
+  {
+  public:
+
+    /// The user supplied timestamp source, such as a cycle counter.
+    typedef etl::message_router_timestamp_t (*timestamp_function_t)();
+
+    //*************************************************************************
+    /// Gets the current timestamp.
+    //*************************************************************************
+    etl::message_router_timestamp_t timestamp() const
+    {
+      return p_timestamp();
+    }
+
+    //*************************************************************************
+    /// Records a message dispatched by the router.
+    ///\param id    The message id.
+    ///\param start The timestamp taken when the message was received.
+    //*************************************************************************
+    void record(etl::message_id_t id, etl::message_router_timestamp_t start)
+    {
+      const etl::message_router_timestamp_t duration = p_timestamp() - start;
+
+      if (size_t(id) < n_ids)
+      {
+        add(p_counts[id], 1U);
+        add(p_times[id], duration);
+      }
+      else
+      {
+        add(overflow_count, 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Records a message that was passed to on_receive_unknown or on_event_unknown.
+    //*************************************************************************
+    void record_unknown(etl::message_id_t)
+    {
+      add(unknown_count, 1U);
+    }
+
+    //*************************************************************************
+    /// The number of messages with the id that the router dispatched.
+    /// Includes unknown messages. Excludes messages passed to a successor.
+    //*************************************************************************
+    uint32_t received(etl::message_id_t id) const
+    {
+      return (size_t(id) < n_ids) ? p_counts[id].load(etl::memory_order_relaxed) : 0U;
+    }
+
+    //*************************************************************************
+    /// The total handler time for messages with the id.
+    //*************************************************************************
+    etl::message_router_timestamp_t time(etl::message_id_t id) const
+    {
+      return (size_t(id) < n_ids) ? p_times[id].load(etl::memory_order_relaxed) : 0U;
+    }
+
+    //*************************************************************************
+    /// The number of messages that no handler accepted.
+    //*************************************************************************
+    uint32_t unknown() const
+    {
+      return unknown_count.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of messages with ids of max_ids() or more.
+    //*************************************************************************
+    uint32_t overflow() const
+    {
+      return overflow_count.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of ids that are counted individually.
+    //*************************************************************************
+    size_t max_ids() const
+    {
+      return n_ids;
+    }
+
+    //*************************************************************************
+    /// Sets all of the statistics to zero.
+    /// Not to be called while the router is dispatching.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < n_ids; ++i)
+      {
+        p_counts[i].store(0U, etl::memory_order_relaxed);
+        p_times[i].store(0U, etl::memory_order_relaxed);
+      }
+
+      unknown_count.store(0U, etl::memory_order_relaxed);
+      overflow_count.store(0U, etl::memory_order_relaxed);
+    }
+
+  protected:
+
+    typedef etl::atomic<uint32_t>                        count_t;
+    typedef etl::atomic<etl::message_router_timestamp_t> duration_t;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imessage_router_statistics(count_t* p_counts_, duration_t* p_times_, size_t n_ids_, timestamp_function_t p_timestamp_)
+      : p_counts(p_counts_),
+        p_times(p_times_),
+        n_ids(n_ids_),
+        p_timestamp(p_timestamp_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~imessage_router_statistics()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Only the router thread writes, so a load and store is enough.
+    //*************************************************************************
+    template <typename T, typename U>
+    static void add(etl::atomic<T>& value, U n)
+    {
+      value.store(T(value.load(etl::memory_order_relaxed) + n), etl::memory_order_relaxed);
+    }
+
+    // Disabled.
+    imessage_router_statistics(const imessage_router_statistics&);
+    imessage_router_statistics& operator =(const imessage_router_statistics&);
+
+    count_t*             p_counts;       ///< The number of messages per id.
+    duration_t*          p_times;        ///< The total handler time per id.
+    const size_t         n_ids;          ///< The number of ids counted.
+    timestamp_function_t p_timestamp;    ///< The timestamp source.
+    count_t              unknown_count;  ///< The number of unknown messages.
+    count_t              overflow_count; ///< The number of messages with ids beyond n_ids.
+  };
+
+  //***************************************************************************
+  /// Statistics for message ids 0 to MAX_IDS - 1.
+  ///\code
+  /// etl::message_router_timestamp_t cycles() { return DWT->CYCCNT; }
+  ///
+  /// etl::message_router_statistics<32> statistics(cycles);
+  /// router.set_statistics(statistics);
+  ///\endcode
+  ///\ingroup message_router_statistics
+  //***************************************************************************
+  template <const size_t MAX_IDS>
+  class message_router_statistics : public etl::imessage_router_statistics
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_IDS > 0U), "Zero size statistics");
+
+    static const size_t MAX_SIZE = MAX_IDS;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_timestamp_ The timestamp source.
+    //*************************************************************************
+    explicit message_router_statistics(timestamp_function_t p_timestamp_)
+      : etl::imessage_router_statistics(counts, times, MAX_IDS, p_timestamp_)
+    {
+      clear();
+    }
+
+  private:
+
+    count_t     counts[MAX_IDS];
+    duration_t  times[MAX_IDS];
+  };
+
+  //***************************************************************************
+  /// Times one dispatch and records it when it goes out of scope.
+  /// Used by the routers; does nothing if the statistics pointer is null.
+  ///\ingroup message_router_statistics
+  //***************************************************************************
+  class message_router_statistics_scope
+  {
+  public:
+
+    message_router_statistics_scope(etl::imessage_router_statistics* p_statistics_, etl::message_id_t id_)
+      : p_statistics(p_statistics_),
+        id(id_),
+        start((p_statistics_ != nullptr) ? p_statistics_->timestamp() : 0U)
+    {
+    }
+
+    ~message_router_statistics_scope()
+    {
+      if (p_statistics != nullptr)
+      {
+        p_statistics->record(id, start);
+      }
+    }
+
+    //*************************************************************************
+    /// The message was passed to a successor, which will count it.
+    //*************************************************************************
+    void forwarded()
+    {
+      p_statistics = nullptr;
+    }
+
+    //*************************************************************************
+    /// The message was passed to on_receive_unknown.
+    //*************************************************************************
+    void unknown()
+    {
+      if (p_statistics != nullptr)
+      {
+        p_statistics->record_unknown(id);
+      }
+    }
+
+  private:
+
+    // Disabled.
+    message_router_statistics_scope(const message_router_statistics_scope&);
+    message_router_statistics_scope& operator =(const message_router_statistics_scope&);
+
+    etl::imessage_router_statistics*      p_statistics;
+    const etl::message_id_t               id;
+    const etl::message_router_timestamp_t start;
+  };
+}
+
+#endif
+
+#endif
@@ -90,6 +90,7 @@ namespace etl
         p_router(nullptr),
         period(0),
         delta(etl::timer::state::INACTIVE),
+        slack(0U),
         destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS),
         id(etl::timer::id::NO_TIMER),
         previous(etl::timer::id::NO_TIMER),
@@ -109,6 +110,7 @@ namespace etl
         p_router(&irouter_),
         period(period_),
         delta(etl::timer::state::INACTIVE),
+        slack(0U),
         destination_router_id(destination_router_id_),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
@@ -137,6 +139,7 @@ namespace etl
     etl::imessage_router*    p_router;
     uint32_t                 period;
     uint32_t                 delta;
+    uint32_t                 slack;
     etl::message_router_id_t destination_router_id;
     etl::timer::id::type     id;
     uint_least8_t            previous;
@@ -174,6 +177,71 @@ namespace etl
         return head == etl::timer::id::NO_TIMER;
       }
 
+      //*******************************
+      // Moves the expiry of a timer with slack to that of the first active
+      // timer that expires within its slack, so that they expire together.
+      //*******************************
+      void coalesce(etl::message_timer_data& timer) const
+      {
+        if (timer.slack == 0U)
+        {
+          return;
+        }
+
+        uint32_t expiry = 0U;
+        etl::timer::id::type test_id = head;
+
+        while (test_id != etl::timer::id::NO_TIMER)
+        {
+          expiry += ptimers[test_id].delta;
+
+          if (expiry >= timer.delta)
+          {
+            if ((expiry - timer.delta) <= timer.slack)
+            {
+              timer.delta = expiry;
+            }
+
+            break;
+          }
+
+          test_id = ptimers[test_id].next;
+        }
+      }
+
+      //*******************************
+      // The ticks until the active timers must be processed.
+      // The earliest of the expiries plus slack.
+      //*******************************
+      uint32_t time_to_deadline() const
+      {
+        uint32_t deadline = etl::timer::state::INACTIVE;
+        uint32_t expiry   = 0U;
+        etl::timer::id::type test_id = head;
+
+        while (test_id != etl::timer::id::NO_TIMER)
+        {
+          const etl::message_timer_data& test = ptimers[test_id];
+
+          expiry += test.delta;
+
+          // Later timers cannot be due sooner.
+          if (expiry >= deadline)
+          {
+            break;
+          }
+
+          if (test.slack < (deadline - expiry))
+          {
+            deadline = expiry + test.slack;
+          }
+
+          test_id = test.next;
+        }
+
+        return deadline;
+      }
+
       //*******************************
       // Inserts the timer at the correct delta position
       //*******************************
@@ -181,6 +249,8 @@ namespace etl
       {
         etl::message_timer_data& timer = ptimers[id_];
 
+        coalesce(timer);
+
         if (head == etl::timer::id::NO_TIMER)
         {
           // No entries yet.
@@ -199,7 +269,9 @@ namespace etl
             etl::message_timer_data& test = ptimers[test_id];
 
             // Find the correct place to insert.
-            if (timer.delta <= test.delta)
+            // Timers with slack go after others with the same expiry, so
+            // that those are reinserted first, and can be coalesced with.
+            if ((timer.delta < test.delta) || ((timer.delta == test.delta) && (timer.slack == 0U)))
             {
               if (test.id == head)
               {
@@ -423,6 +495,18 @@ namespace etl
       return enabled;
     }
 
+    //*******************************************
+    /// The number of ticks until the timers must next be processed.
+    /// This is the time of the next expiry, unless timers have slack, when it
+    /// is the earliest expiry plus slack; all of the timers that have expired
+    /// by then are processed together.
+    /// Returns etl::timer::state::INACTIVE if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      return active_list.time_to_deadline();
+    }
+
     //*******************************************
     /// Clears the timer of data.
     //*******************************************
@@ -473,6 +557,10 @@ namespace etl
 
               if (timer.p_router != nullptr)
               {
+#if defined(ETL_MESSAGE_TRACE)
+                // Each timeout is a new trace.
+                etl::message_trace::begin(*(timer.p_message), timer.p_router->get_message_router_id());
+#endif
                 static etl::null_message_router nmr;
                 timer.p_router->receive(nmr, timer.destination_router_id, *(timer.p_message));
               }
@@ -587,6 +675,30 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Sets the number of ticks that a timer may expire late.
+    /// A timer with slack expires with the first active timer that expires
+    /// within its slack, so that both are processed in the same tick, and
+    /// time_to_next() allows for the slack, so that fewer wake-ups are needed.
+    /// Takes effect when the timer is next started, or repeats.
+    //*******************************************
+    bool set_slack(etl::timer::id::type id_, uint32_t slack_)
+    {
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        etl::message_timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          timer.slack = slack_;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
   protected:
 
     //*******************************************
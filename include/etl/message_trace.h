@@ -0,0 +1,301 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TRACE_INCLUDED
+#define ETL_MESSAGE_TRACE_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "function.h"
+#include "message.h"
+#include "message_types.h"
+#include "nullptr.h"
+
+///\defgroup message_trace message_trace
+/// Follows a message from its source, through message buses, inboxes and
+/// timers, to the routers and state machines that handle it.
+/// Tracing is only compiled in when ETL_MESSAGE_TRACE is defined.
+/// Without it, messages have no trace context and there are no trace calls.
+///\ingroup containers
+
+#if defined(ETL_MESSAGE_TRACE)
+
+#if !ETL_HAS_ATOMIC
+  #error ETL_MESSAGE_TRACE requires atomics
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The points at which a message is traced.
+  ///\ingroup message_trace
+  //***************************************************************************
+  struct message_trace_point
+  {
+    enum enum_type
+    {
+      Begin,    ///< The trace began, at the source or when a message timer fired.
+      Publish,  ///< A message bus received the message.
+      Enqueue,  ///< A message inbox queued a copy of the message.
+      Dequeue,  ///< A message inbox took the copy from its queue.
+      Dispatch  ///< A message router or state machine received the message.
+    };
+  };
+
+  //***************************************************************************
+  /// Sent to the trace hook at each trace point.
+  ///\ingroup message_trace
+  //***************************************************************************
+  struct message_trace_event
+  {
+    //*************************************************************************
+    /// The time since the trace began.
+    //*************************************************************************
+    etl::message_trace_timestamp_t since_begin() const
+    {
+      return now - begin;
+    }
+
+    //*************************************************************************
+    /// The time since the previous trace point, such as the time spent in a
+    /// queue for Dequeue.
+    //*************************************************************************
+    etl::message_trace_timestamp_t since_previous() const
+    {
+      return now - previous;
+    }
+
+    const etl::imessage*                p_message; ///< The message, or the queued copy of it.
+    etl::message_trace_id_t             id;        ///< The trace id.
+    etl::message_trace_point::enum_type point;     ///< Where the message is.
+    etl::message_router_id_t            router_id; ///< The bus, inbox, router or destination at the point.
+    etl::message_trace_timestamp_t      begin;     ///< The time that the trace began.
+    etl::message_trace_timestamp_t      previous;  ///< The time of the previous trace point.
+    etl::message_trace_timestamp_t      now;       ///< The time of this trace point.
+  };
+
+  namespace private_message_trace
+  {
+    template <class dummy>
+    struct wrapper
+    {
+      static etl::message_trace_timestamp_t (*p_timestamp)();
+      static etl::ifunction<const etl::message_trace_event&>* p_hook;
+      static etl::atomic<etl::message_trace_id_t> next_id;
+    };
+
+    template <class dummy>
+    etl::message_trace_timestamp_t (*wrapper<dummy>::p_timestamp)() = nullptr;
+
+    template <class dummy>
+    etl::ifunction<const etl::message_trace_event&>* wrapper<dummy>::p_hook = nullptr;
+
+    template <class dummy>
+    etl::atomic<etl::message_trace_id_t> wrapper<dummy>::next_id(1U);
+  }
+
+  //***************************************************************************
+  /// Stamps messages with a trace id and timestamp and reports each trace
+  /// point to a user hook.
+  /// A message's trace begins when begin() is called, such as in the receive
+  /// interrupt, or else at its first trace point.
+  /// Set the timestamp source and hook before messages are sent.
+  ///\code
+  /// etl::message_trace_timestamp_t cycles() { return DWT->CYCCNT; }
+  ///
+  /// etl::histogram<100000> latency;
+  /// etl::message_trace_latency<etl::histogram<100000> > hook(latency);
+  ///
+  /// etl::message_trace::set_timestamp(cycles);
+  /// etl::message_trace::set_hook(hook);
+  ///
+  /// // In the receive interrupt.
+  /// etl::message_trace::begin(rx_message);
+  /// inbox.receive(rx_message);
+  ///\endcode
+  ///\ingroup message_trace
+  //***************************************************************************
+  class message_trace
+  {
+  public:
+
+    typedef etl::message_trace_timestamp_t (*timestamp_function_t)();
+    typedef etl::ifunction<const etl::message_trace_event&> hook_type;
+
+    /// The router id for a point with no router. The same as etl::imessage_router::NULL_MESSAGE_ROUTER.
+    static const etl::message_router_id_t NO_ROUTER = 255U;
+
+    //*************************************************************************
+    /// Sets the timestamp source, such as a cycle counter.
+    /// Without one, every timestamp is zero.
+    //*************************************************************************
+    static void set_timestamp(timestamp_function_t p_timestamp)
+    {
+      private_message_trace::wrapper<void>::p_timestamp = p_timestamp;
+    }
+
+    //*************************************************************************
+    /// Sets the hook that receives each trace point.
+    /// Called on the thread of the bus, inbox, router or timer at the point.
+    //*************************************************************************
+    static void set_hook(hook_type& hook)
+    {
+      private_message_trace::wrapper<void>::p_hook = &hook;
+    }
+
+    //*************************************************************************
+    /// Removes the hook.
+    //*************************************************************************
+    static void clear_hook()
+    {
+      private_message_trace::wrapper<void>::p_hook = nullptr;
+    }
+
+    //*************************************************************************
+    /// Gets the current timestamp.
+    //*************************************************************************
+    static etl::message_trace_timestamp_t timestamp()
+    {
+      timestamp_function_t p_timestamp = private_message_trace::wrapper<void>::p_timestamp;
+
+      return (p_timestamp != nullptr) ? p_timestamp() : etl::message_trace_timestamp_t(0U);
+    }
+
+    //*************************************************************************
+    /// Begins a new trace for the message, with a new id.
+    ///\param router_id The source, if it has a router id.
+    //*************************************************************************
+    static void begin(const etl::imessage& message, etl::message_router_id_t router_id = NO_ROUTER)
+    {
+      etl::message_trace_id_t id = private_message_trace::wrapper<void>::next_id.fetch_add(1U, etl::memory_order_relaxed);
+
+      // Zero means 'not begun'.
+      if (id == 0U)
+      {
+        id = private_message_trace::wrapper<void>::next_id.fetch_add(1U, etl::memory_order_relaxed);
+      }
+
+      const etl::message_trace_timestamp_t now = timestamp();
+
+      message.trace.id    = id;
+      message.trace.begin = now;
+      message.trace.last  = now;
+
+      report(message, etl::message_trace_point::Begin, router_id, now, now);
+    }
+
+    //*************************************************************************
+    /// Records that the message reached a trace point.
+    /// Begins the trace if it has not begun.
+    //*************************************************************************
+    static void record(const etl::imessage& message, etl::message_trace_point::enum_type point, etl::message_router_id_t router_id)
+    {
+      if (message.trace.id == 0U)
+      {
+        begin(message, router_id);
+      }
+
+      const etl::message_trace_timestamp_t now      = timestamp();
+      const etl::message_trace_timestamp_t previous = message.trace.last;
+
+      message.trace.last = now;
+
+      report(message, point, router_id, previous, now);
+    }
+
+  private:
+
+    //*************************************************************************
+    static void report(const etl::imessage&                message,
+                       etl::message_trace_point::enum_type point,
+                       etl::message_router_id_t            router_id,
+                       etl::message_trace_timestamp_t      previous,
+                       etl::message_trace_timestamp_t      now)
+    {
+      hook_type* p_hook = private_message_trace::wrapper<void>::p_hook;
+
+      if (p_hook != nullptr)
+      {
+        const etl::message_trace_event event = { &message, message.trace.id, point, router_id, message.trace.begin, previous, now };
+
+        (*p_hook)(event);
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// A trace hook that records latencies at one trace point in a histogram,
+  /// such as an etl::histogram.
+  ///\tparam THistogram Has record(value).
+  ///\ingroup message_trace
+  //***************************************************************************
+  template <typename THistogram>
+  class message_trace_latency : public etl::ifunction<const etl::message_trace_event&>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param histogram_  Where the latencies are recorded.
+    ///\param point_      The trace point that is recorded.
+    ///\param from_begin_ If true, the time since the trace began, otherwise the time since the previous trace point.
+    //*************************************************************************
+    explicit message_trace_latency(THistogram&                         histogram_,
+                                   etl::message_trace_point::enum_type point_      = etl::message_trace_point::Dispatch,
+                                   bool                                from_begin_ = true)
+      : histogram(histogram_),
+        point(point_),
+        from_begin(from_begin_)
+    {
+    }
+
+    //*************************************************************************
+    void operator ()(const etl::message_trace_event& event) const
+    {
+      if (event.point == point)
+      {
+        histogram.record(from_begin ? event.since_begin() : event.since_previous());
+      }
+    }
+
+  private:
+
+    THistogram&                               histogram;
+    const etl::message_trace_point::enum_type point;
+    const bool                                from_begin;
+  };
+}
+
+#endif
+
+#endif
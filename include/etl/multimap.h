@@ -1261,6 +1261,107 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*************************************************************************
+    iterator emplace(const_reference value)
+    {
+      return insert(value);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const key_type& key, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// The position hint is ignored.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator, const key_type& key, Args && ... args)
+    {
+      return emplace(key, etl::forward<Args>(args)...);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*************************************************************************
+    template <typename T1>
+    iterator emplace(const key_type& key, const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    iterator emplace(const key_type& key, const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multimap.
+    /// The mapped value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace(const key_type& key, const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value.first) key_type(key);
+      ::new ((void*)&node.value.second) mapped_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the multimap starting at the position recommended.
     /// If asserts or exceptions are enabled, emits map_full if the multimap is already full.
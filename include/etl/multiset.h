@@ -1245,6 +1245,109 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// The value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits multiset_full if the multiset is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// The position hint is ignored.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator, Args && ... args)
+    {
+      return emplace(etl::forward<Args>(args)...);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// If asserts or exceptions are enabled, emits multiset_full if the multiset is already full.
+    //*************************************************************************
+    template <typename T1>
+    iterator emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// If asserts or exceptions are enabled, emits multiset_full if the multiset is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    iterator emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// If asserts or exceptions are enabled, emits multiset_full if the multiset is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// If asserts or exceptions are enabled, emits multiset_full if the multiset is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the multiset starting at the position recommended.
     /// If asserts or exceptions are enabled, emits set_full if the multiset is already full.
@@ -37,6 +37,8 @@ SOFTWARE.
 #include "ihash.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "type_traits.h"
+#include "iterator.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -84,19 +86,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -122,19 +112,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -147,7 +125,96 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8);
+      add_byte(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+    //*************************************************************************
+    /// Calculates the hash of several independent buffers.
+    /// Four buffers are processed together, interleaved block by block, so
+    /// that their calculations overlap rather than waiting on each other.
+    /// \param buffers Pointers to the start of each buffer.
+    /// \param lengths The length of each buffer.
+    /// \param results Receives the hash of each buffer.
+    /// \param count   The number of buffers.
+    /// \param seed    The seed value. Default = 0.
+    //*************************************************************************
+    static void add_multi(const uint8_t* const buffers[], const size_t lengths[], value_type results[], size_t count, value_type seed_ = 0)
+    {
+      size_t i = 0U;
+
+      for (; (count - i) >= MULTI_LANES; i += MULTI_LANES)
+      {
+        const uint8_t* p0 = buffers[i];
+        const uint8_t* p1 = buffers[i + 1U];
+        const uint8_t* p2 = buffers[i + 2U];
+        const uint8_t* p3 = buffers[i + 3U];
+
+        value_type hash0 = seed_;
+        value_type hash1 = seed_;
+        value_type hash2 = seed_;
+        value_type hash3 = seed_;
+
+        size_t common = lengths[i];
+        common = (lengths[i + 1U] < common) ? lengths[i + 1U] : common;
+        common = (lengths[i + 2U] < common) ? lengths[i + 2U] : common;
+        common = (lengths[i + 3U] < common) ? lengths[i + 3U] : common;
+        common -= common % FULL_BLOCK;
+
+        for (size_t j = 0U; j < common; j += FULL_BLOCK)
+        {
+          hash0 = mix_block(hash0, read_block(p0 + j));
+          hash1 = mix_block(hash1, read_block(p1 + j));
+          hash2 = mix_block(hash2, read_block(p2 + j));
+          hash3 = mix_block(hash3, read_block(p3 + j));
+        }
+
+        // The remainder of each buffer.
+        results[i]      = finish_multi(hash0, p0 + common, p0 + lengths[i],      lengths[i]);
+        results[i + 1U] = finish_multi(hash1, p1 + common, p1 + lengths[i + 1U], lengths[i + 1U]);
+        results[i + 2U] = finish_multi(hash2, p2 + common, p2 + lengths[i + 2U], lengths[i + 2U]);
+        results[i + 3U] = finish_multi(hash3, p3 + common, p3 + lengths[i + 3U], lengths[i + 3U]);
+      }
+
+      for (; i < count; ++i)
+      {
+        results[i] = finish_multi(seed_, buffers[i], buffers[i] + lengths[i], lengths[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Calculates the hash of N independent buffers.
+    //*************************************************************************
+    template <size_t N>
+    static void add_multi(const uint8_t* const (&buffers)[N], const size_t (&lengths)[N], value_type (&results)[N], value_type seed_ = 0)
+    {
+      add_multi(buffers, lengths, results, N, seed_);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a single byte.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8);
 
       if (++block_fill_count == FULL_BLOCK)
       {
@@ -159,6 +226,245 @@ namespace etl
       ++char_count;
     }
 
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, reading whole 32 bit blocks directly.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p  = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* pe = reinterpret_cast<const uint8_t*>(end);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0) && (p != pe))
+      {
+        add_byte(*p++);
+      }
+
+      while (size_t(pe - p) >= FULL_BLOCK)
+      {
+        // Little endian assembly, independent of the platform's byte order.
+        block = read_block(p);
+        add_block();
+        block       = 0;
+        p          += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      while (p != pe)
+      {
+        add_byte(*p++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block()
+    {
+      hash = mix_block(hash, block);
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        hash = mix_final(hash, block, char_count);
+
+        is_finalised = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the hash with a filled block added.
+    //*************************************************************************
+    static value_type mix_block(value_type hash_, value_type block_)
+    {
+      block_ *= CONSTANT1;
+      block_ = rotate_left(block_, SHIFT1);
+      block_ *= CONSTANT2;
+
+      hash_ ^= block_;
+      hash_ = rotate_left(hash_, SHIFT2);
+      return (hash_ * MULTIPLY) + ADD;
+    }
+
+    //*************************************************************************
+    /// Returns the final hash, from the partially filled last block and the
+    /// total number of bytes.
+    //*************************************************************************
+    static value_type mix_final(value_type hash_, value_type block_, size_t char_count_)
+    {
+      block_ *= CONSTANT1;
+      block_ = rotate_left(block_, SHIFT1);
+      block_ *= CONSTANT2;
+
+      hash_ ^= block_;
+      hash_ ^= char_count_;
+      hash_ ^= (hash_ >> 16);
+      hash_ *= 0x85EBCA6B;
+      hash_ ^= (hash_ >> 13);
+      hash_ *= 0xC2B2AE35;
+      hash_ ^= (hash_ >> 16);
+
+      return hash_;
+    }
+
+    //*************************************************************************
+    /// Reads a little endian block.
+    //*************************************************************************
+    static value_type read_block(const uint8_t* p)
+    {
+      return value_type(uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24));
+    }
+
+    //*************************************************************************
+    /// Hashes the rest of a buffer for add_multi.
+    //*************************************************************************
+    static value_type finish_multi(value_type hash_, const uint8_t* p, const uint8_t* pe, size_t length)
+    {
+      while (size_t(pe - p) >= FULL_BLOCK)
+      {
+        hash_ = mix_block(hash_, read_block(p));
+        p += FULL_BLOCK;
+      }
+
+      value_type block_ = 0;
+
+      for (size_t shift = 0U; p != pe; shift += 8U)
+      {
+        block_ |= value_type(*p++) << shift;
+      }
+
+      return mix_final(hash_, block_, length);
+    }
+
+    bool       is_finalised;
+    uint8_t    block_fill_count;
+    size_t     char_count;
+    value_type block;
+    value_type hash;
+    value_type seed;
+
+    static const size_t     MULTI_LANES = 4U;
+    static const uint8_t    FULL_BLOCK  = 4;
+    static const value_type CONSTANT1   = 0xCC9E2D51;
+    static const value_type CONSTANT2   = 0x1B873593;
+    static const value_type SHIFT1      = 15;
+    static const value_type SHIFT2      = 13;
+    static const value_type MULTIPLY    = 5;
+    static const value_type ADD         = 0xE6546B64;
+  };
+
+  //***************************************************************************
+  /// Calculates the 128 bit murmur3 hash, x64 variant (MurmurHash3_x64_128).
+  /// The result is two 64 bit hashes, suitable for double hashing.
+  /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_128
+  {
+  public:
+
+    //*************************************************************************
+    /// The 128 bit result.
+    //*************************************************************************
+    struct value_type
+    {
+      uint64_t h1;
+      uint64_t h2;
+
+      friend bool operator ==(const value_type& lhs, const value_type& rhs)
+      {
+        return (lhs.h1 == rhs.h1) && (lhs.h2 == rhs.h2);
+      }
+
+      friend bool operator !=(const value_type& lhs, const value_type& rhs)
+      {
+        return !(lhs == rhs);
+      }
+    };
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      hash.h1          = seed;
+      hash.h2          = seed;
+      char_count       = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_byte(value_);
+    }
+
     //*************************************************************************
     /// Gets the hash value.
     //*************************************************************************
@@ -179,17 +485,118 @@ namespace etl
   private:
 
     //*************************************************************************
-    /// Adds a filled block to the hash.
+    /// Reads eight bytes, little endian.
     //*************************************************************************
-    void add_block()
+    static uint64_t get_block(const uint8_t* p)
     {
-      block *= CONSTANT1;
-      block = rotate_left(block, SHIFT1);
-      block *= CONSTANT2;
+      return  uint64_t(p[0])        | (uint64_t(p[1]) << 8)  |
+             (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+             (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) |
+             (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
 
-      hash ^= block;
-      hash = rotate_left(hash, SHIFT2);
-      hash = (hash * MULTIPLY) + ADD;
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= C1;
+      k1  = etl::rotate_left(k1, 31);
+      k1 *= C2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= C2;
+      k2  = etl::rotate_left(k2, 33);
+      k2 *= C1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    static uint64_t fmix(uint64_t k)
+    {
+      k ^= k >> 33;
+      k *= 0xFF51AFD7ED558CCDull;
+      k ^= k >> 33;
+      k *= 0xC4CEB9FE1A85EC53ull;
+      k ^= k >> 33;
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Adds a 16 byte block to the hash.
+    //*************************************************************************
+    void add_block(const uint8_t* p)
+    {
+      hash.h1 ^= mix_k1(get_block(p));
+      hash.h1  = etl::rotate_left(hash.h1, 27);
+      hash.h1 += hash.h2;
+      hash.h1  = (hash.h1 * 5U) + 0x52DCE729U;
+
+      hash.h2 ^= mix_k2(get_block(p + 8));
+      hash.h2  = etl::rotate_left(hash.h2, 31);
+      hash.h2 += hash.h1;
+      hash.h2  = (hash.h2 * 5U) + 0x38495AB5U;
+    }
+
+    //*************************************************************************
+    /// Adds a single byte.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block[block_fill_count] = value_;
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block);
+        block_fill_count = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, reading whole blocks directly.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p  = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* pe = reinterpret_cast<const uint8_t*>(end);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0) && (p != pe))
+      {
+        add_byte(*p++);
+      }
+
+      while (size_t(pe - p) >= FULL_BLOCK)
+      {
+        add_block(p);
+        p          += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      while (p != pe)
+      {
+        add_byte(*p++);
+      }
     }
 
     //*************************************************************************
@@ -199,36 +606,55 @@ namespace etl
     {
       if (!is_finalised)
       {
-        block *= CONSTANT1;
-        block = rotate_left(block, SHIFT1);
-        block *= CONSTANT2;
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
 
-        hash ^= block;
-        hash ^= char_count;
-        hash ^= (hash >> 16);
-        hash *= 0x85EBCA6B;
-        hash ^= (hash >> 13);
-        hash *= 0xC2B2AE35;
-        hash ^= (hash >> 16);
+        for (size_t i = block_fill_count; i > 8U; --i)
+        {
+          k2 ^= uint64_t(block[i - 1U]) << ((i - 9U) * 8U);
+        }
+
+        for (size_t i = (block_fill_count > 8U) ? 8U : block_fill_count; i > 0U; --i)
+        {
+          k1 ^= uint64_t(block[i - 1U]) << ((i - 1U) * 8U);
+        }
+
+        if (block_fill_count > 8U)
+        {
+          hash.h2 ^= mix_k2(k2);
+        }
+
+        if (block_fill_count > 0U)
+        {
+          hash.h1 ^= mix_k1(k1);
+        }
+
+        hash.h1 ^= uint64_t(char_count);
+        hash.h2 ^= uint64_t(char_count);
+
+        hash.h1 += hash.h2;
+        hash.h2 += hash.h1;
+
+        hash.h1 = fmix(hash.h1);
+        hash.h2 = fmix(hash.h2);
+
+        hash.h1 += hash.h2;
+        hash.h2 += hash.h1;
 
         is_finalised = true;
       }
     }
 
+    static const size_t   FULL_BLOCK = 16U;
+    static const uint64_t C1 = 0x87C37B91114253D5ull;
+    static const uint64_t C2 = 0x4CF5AD432745937Full;
+
     bool       is_finalised;
     uint8_t    block_fill_count;
     size_t     char_count;
-    value_type block;
+    uint8_t    block[FULL_BLOCK];
     value_type hash;
-    value_type seed;
-
-    static const uint8_t    FULL_BLOCK = 4;
-    static const value_type CONSTANT1  = 0xCC9E2D51;
-    static const value_type CONSTANT2  = 0x1B873593;
-    static const value_type SHIFT1     = 15;
-    static const value_type SHIFT2     = 13;
-    static const value_type MULTIPLY   = 5;
-    static const value_type ADD        = 0xE6546B64;
+    uint32_t   seed;
   };
 }
 
@@ -44,4 +44,10 @@ SOFTWARE.
   #define ETL_HAS_MUTEX 0
 #endif
 
+// Spinning locks built on etl::atomic.
+#include "mutex/spinlock.h"
+#include "mutex/ticket_lock.h"
+#include "mutex/shared_mutex.h"
+#include "mutex/seqlock.h"
+
 #endif
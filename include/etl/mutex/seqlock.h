@@ -0,0 +1,186 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_INCLUDED
+#define ETL_SEQLOCK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A sequence lock holding a value of type T.
+  /// Readers never block the writer. A read that overlaps a write is retried.
+  /// Suits small values that are read far more often than they are written.
+  /// There must be one writer at a time; guard write() with a lock if there are more.
+  /// The value is held in atomic words, so that a read that races a write is
+  /// well defined before it is discarded.
+  ///\tparam T A trivially copyable type.
+  //***************************************************************************
+  template <typename T>
+  class seqlock
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    seqlock()
+      : sequence(0U)
+    {
+      store(T());
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param value The initial value.
+    //*************************************************************************
+    explicit seqlock(const T& value)
+      : sequence(0U)
+    {
+      store(value);
+    }
+
+    //*************************************************************************
+    /// Writes a new value.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      const uint32_t s = sequence.load(etl::memory_order_relaxed);
+
+      // Odd while the write is in progress.
+      sequence.store(s + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      store(value);
+
+      sequence.store(s + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Reads the value, retrying until no write overlaps the read.
+    //*************************************************************************
+    T read() const
+    {
+      T value;
+
+      while (!try_read(value))
+      {
+        ETL_CPU_PAUSE();
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to read the value.
+    ///\param value Set to the value if the read succeeds.
+    ///\return <b>true</b> if no write overlapped the read.
+    //*************************************************************************
+    bool try_read(T& value) const
+    {
+      const uint32_t before = sequence.load(etl::memory_order_acquire);
+
+      if ((before & 1U) != 0U)
+      {
+        return false;
+      }
+
+      word_t copy[WORDS];
+
+      for (size_t i = 0U; i < WORDS; ++i)
+      {
+        copy[i] = words[i].load(etl::memory_order_relaxed);
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      if (sequence.load(etl::memory_order_relaxed) != before)
+      {
+        return false;
+      }
+
+      memcpy(&value, copy, sizeof(T));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The sequence number. Even when no write is in progress.
+    //*************************************************************************
+    uint32_t sequence_number() const
+    {
+      return sequence.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    typedef uint32_t word_t;
+
+    static const size_t WORDS = (sizeof(T) + sizeof(word_t) - 1U) / sizeof(word_t);
+
+    //*************************************************************************
+    /// Copies the value to the words.
+    //*************************************************************************
+    void store(const T& value)
+    {
+      word_t copy[WORDS] = { 0U };
+
+      memcpy(copy, &value, sizeof(T));
+
+      for (size_t i = 0U; i < WORDS; ++i)
+      {
+        words[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    // Disabled.
+    seqlock(const seqlock&);
+    seqlock& operator =(const seqlock&);
+
+    etl::atomic<uint32_t> sequence;     ///< Odd while a write is in progress.
+    etl::atomic<word_t>   words[WORDS]; ///< The value.
+  };
+}
+
+#endif
+#endif
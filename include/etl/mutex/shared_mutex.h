@@ -0,0 +1,167 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARED_MUTEX_INCLUDED
+#define ETL_SHARED_MUTEX_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "spinlock.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A spinning reader-writer lock.
+  /// Any number of readers may hold the lock together; a writer holds it alone.
+  /// A waiting writer stops new readers from taking the lock, so that writers
+  /// are not starved by a stream of readers.
+  //***************************************************************************
+  class shared_mutex
+  {
+  public:
+
+    shared_mutex()
+      : state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks for writing.
+    //*************************************************************************
+    void lock()
+    {
+      etl::spin_backoff<> backoff;
+
+      uint32_t current = state.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        if ((current & (WRITER | READERS)) == 0U)
+        {
+          // Free. Take it, clearing any waiting flag.
+          if (state.compare_exchange_weak(current, WRITER, etl::memory_order_acquire, etl::memory_order_relaxed))
+          {
+            return;
+          }
+        }
+        else if ((current & WRITER_WAITING) == 0U)
+        {
+          // Held. Stop new readers.
+          state.compare_exchange_weak(current, current | WRITER_WAITING, etl::memory_order_relaxed, etl::memory_order_relaxed);
+        }
+        else
+        {
+          backoff.pause();
+          current = state.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Locks for writing, if there are no readers or writer.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t current = state.load(etl::memory_order_relaxed);
+
+      return ((current & (WRITER | READERS)) == 0U) &&
+             state.compare_exchange_strong(current, WRITER, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Unlocks for writing.
+    //*************************************************************************
+    void unlock()
+    {
+      state.fetch_sub(WRITER, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Locks for reading.
+    //*************************************************************************
+    void lock_shared()
+    {
+      etl::spin_backoff<> backoff;
+
+      while (!try_lock_shared())
+      {
+        backoff.pause();
+      }
+    }
+
+    //*************************************************************************
+    /// Locks for reading, if there is no writer, waiting or holding the lock.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock_shared()
+    {
+      uint32_t current = state.load(etl::memory_order_relaxed);
+
+      while ((current & (WRITER | WRITER_WAITING)) == 0U)
+      {
+        if (state.compare_exchange_weak(current, current + 1U, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Unlocks for reading.
+    //*************************************************************************
+    void unlock_shared()
+    {
+      state.fetch_sub(1U, etl::memory_order_release);
+    }
+
+  private:
+
+    static const uint32_t WRITER         = 0x80000000UL;
+    static const uint32_t WRITER_WAITING = 0x40000000UL;
+    static const uint32_t READERS        = 0x3FFFFFFFUL;
+
+    // Disabled.
+    shared_mutex(const shared_mutex&);
+    shared_mutex& operator =(const shared_mutex&);
+
+    etl::atomic<uint32_t> state; ///< The writer flags and the reader count.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,148 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPINLOCK_INCLUDED
+#define ETL_SPINLOCK_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// Exponential backoff for spinning threads.
+  /// Each call to pause() spins for twice as long as the last, up to MAX_SPINS.
+  //***************************************************************************
+  template <const uint32_t MAX_SPINS = 64U>
+  class spin_backoff
+  {
+  public:
+
+    spin_backoff()
+      : spins(1U)
+    {
+    }
+
+    //*************************************************************************
+    /// Spins, then doubles the next spin.
+    //*************************************************************************
+    void pause()
+    {
+      for (uint32_t i = 0U; i < spins; ++i)
+      {
+        ETL_CPU_PAUSE();
+      }
+
+      if (spins < MAX_SPINS)
+      {
+        spins *= 2U;
+      }
+    }
+
+    //*************************************************************************
+    /// Starts again from the shortest spin.
+    //*************************************************************************
+    void reset()
+    {
+      spins = 1U;
+    }
+
+  private:
+
+    uint32_t spins;
+  };
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A test and test-and-set spinlock with exponential backoff.
+  /// For short critical sections, where an OS mutex costs more than the wait.
+  /// Not fair; see ticket_lock.
+  //***************************************************************************
+  class spinlock
+  {
+  public:
+
+    spinlock()
+      : flag(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks, spinning while another thread holds the lock.
+    //*************************************************************************
+    void lock()
+    {
+      etl::spin_backoff<> backoff;
+
+      while (flag.exchange(1U, etl::memory_order_acquire) != 0U)
+      {
+        // Wait on a read, so that the cache line is not written while it is held.
+        while (flag.load(etl::memory_order_relaxed) != 0U)
+        {
+          backoff.pause();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Locks, if it is not held.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock()
+    {
+      return (flag.load(etl::memory_order_relaxed) == 0U) &&
+             (flag.exchange(1U, etl::memory_order_acquire) == 0U);
+    }
+
+    //*************************************************************************
+    /// Unlocks.
+    //*************************************************************************
+    void unlock()
+    {
+      flag.store(0U, etl::memory_order_release);
+    }
+
+  private:
+
+    // Disabled.
+    spinlock(const spinlock&);
+    spinlock& operator =(const spinlock&);
+
+    etl::atomic<uint32_t> flag;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,112 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TICKET_LOCK_INCLUDED
+#define ETL_TICKET_LOCK_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "spinlock.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A fair spinlock. Threads take the lock in the order that they asked for it.
+  /// A waiting thread backs off in proportion to the number of threads ahead of it.
+  //***************************************************************************
+  class ticket_lock
+  {
+  public:
+
+    ticket_lock()
+      : next(0U),
+        serving(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Takes a ticket and waits for it to be served.
+    //*************************************************************************
+    void lock()
+    {
+      const uint32_t ticket = next.fetch_add(1U, etl::memory_order_relaxed);
+
+      uint32_t current = serving.load(etl::memory_order_acquire);
+
+      while (current != ticket)
+      {
+        uint32_t ahead = ticket - current;
+
+        while (ahead-- != 0U)
+        {
+          ETL_CPU_PAUSE();
+        }
+
+        current = serving.load(etl::memory_order_acquire);
+      }
+    }
+
+    //*************************************************************************
+    /// Locks, if it is not held and no thread is waiting.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t ticket = serving.load(etl::memory_order_acquire);
+
+      return next.compare_exchange_strong(ticket, ticket + 1U, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Unlocks, serving the next ticket.
+    //*************************************************************************
+    void unlock()
+    {
+      serving.store(serving.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+  private:
+
+    // Disabled.
+    ticket_lock(const ticket_lock&);
+    ticket_lock& operator =(const ticket_lock&);
+
+    etl::atomic<uint32_t> next;    ///< The next ticket to be issued.
+    etl::atomic<uint32_t> serving; ///< The ticket that holds the lock.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,497 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_NUMA_POOL_SET_INCLUDED
+#define ETL_NUMA_POOL_SET_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex/spinlock.h"
+#include "pool.h"
+#include "alignment.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#if defined(__linux__) && !defined(ETL_NO_NUMA_DETECTION)
+  #include <unistd.h>
+  #include <sys/syscall.h>
+  #if defined(SYS_getcpu)
+    #define ETL_NUMA_DETECTION_LINUX
+  #endif
+#endif
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup numa_pool_set numa_pool_set
+/// A set of pools, one per NUMA node, that allocates from the node of the
+/// calling thread, so that the items and the pool's free list stay in local memory.
+/// Detection uses getcpu() on Linux. Define ETL_NO_NUMA_DETECTION to treat
+/// every thread as being on node 0.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup numa_pool_set
+  /// The NUMA node of the processor that the calling thread is running on.
+  /// The thread may be moved at any time, so this is a hint.
+  /// Returns 0 if it cannot be detected.
+  //***************************************************************************
+  inline size_t numa_current_node()
+  {
+#if defined(ETL_NUMA_DETECTION_LINUX)
+    unsigned cpu  = 0U;
+    unsigned node = 0U;
+
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+    {
+      return size_t(node);
+    }
+#endif
+
+    return 0U;
+  }
+
+  //***************************************************************************
+  ///\ingroup numa_pool_set
+  /// The base of the NUMA pool sets.
+  /// Each node's region starts with its pool's control block and lock, on
+  /// their own cache lines, followed by the items, so that a thread that
+  /// allocates and releases on its own node touches no remote memory.
+  /// When the local node is exhausted the other nodes are tried in turn,
+  /// and the lending node counts the allocation.
+  /// Allocation returns nullptr, rather than asserts, when every node is exhausted.
+  ///\tparam T     The type of the items.
+  ///\tparam NODES The number of NUMA nodes.
+  ///\tparam TLock The lock for each node. Any type with lock() and unlock(),
+  ///              such as etl::spinlock or etl::ticket_lock.
+  //***************************************************************************
+  template <typename T, const size_t NODES, typename TLock>
+  class inuma_pool_set
+  {
+  public:
+
+    ETL_STATIC_ASSERT(NODES > 0U, "At least one node is required");
+
+    typedef T      value_type;
+    typedef T*     pointer;
+    typedef size_t size_type;
+
+    static const size_t NUMBER_OF_NODES = NODES;
+
+  private:
+
+    //*************************************************************************
+    /// The control block at the start of each node's region.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t(void* p_items, size_t max_items)
+        : pool(p_items, max_items),
+          lent(0U)
+      {
+      }
+
+      TLock              lock;
+      etl::pool_ext<T>   pool;
+      size_t             lent; ///< Allocations made for other nodes.
+    };
+
+    static const size_t LINE = (ETL_CACHE_LINE_SIZE > 0) ? size_t(ETL_CACHE_LINE_SIZE) : 1U;
+
+  public:
+
+    /// The alignment required of each node's region.
+    static const size_t ALIGNMENT = (etl::alignment_of<node_t>::value > etl::pool_ext<T>::ALIGNMENT) ? etl::alignment_of<node_t>::value
+                                                                                                     : etl::pool_ext<T>::ALIGNMENT;
+
+  private:
+
+    // The control block is padded to whole cache lines, rounded to the item alignment.
+    static const size_t UNIT = (LINE > ALIGNMENT) ? LINE : ALIGNMENT;
+
+  public:
+
+    /// The bytes at the start of each region for the control block.
+    static const size_t HEADER_SIZE = ((sizeof(node_t) + UNIT - 1U) / UNIT) * UNIT;
+
+    //*************************************************************************
+    /// The number of bytes needed for a node's region of max_items items.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_items)
+    {
+      return HEADER_SIZE + etl::pool_ext<T>::buffer_size(max_items);
+    }
+
+    //*************************************************************************
+    /// Allocates an item from the calling thread's node, or from another if
+    /// that node is exhausted.
+    /// Returns nullptr if every node is exhausted.
+    //*************************************************************************
+    T* allocate()
+    {
+      return allocate(etl::numa_current_node());
+    }
+
+    //*************************************************************************
+    /// Allocates an item from the node, or from another if that node is exhausted.
+    /// Returns nullptr if every node is exhausted.
+    //*************************************************************************
+    T* allocate(size_t node)
+    {
+      node %= NODES;
+
+      T* p = try_allocate_from(node, false);
+
+      for (size_t i = 1U; (p == nullptr) && (i < NODES); ++i)
+      {
+        p = try_allocate_from((node + i) % NODES, true);
+      }
+
+      return p;
+    }
+
+#if ETL_CPP11_SUPPORTED && !ETL_POOL_CPP03_CODE && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocates and constructs an item on the calling thread's node.
+    /// Returns nullptr if every node is exhausted.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocates and default constructs an item on the calling thread's node.
+    /// Returns nullptr if every node is exhausted.
+    //*************************************************************************
+    T* create()
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocates and copy constructs an item on the calling thread's node.
+    /// Returns nullptr if every node is exhausted.
+    //*************************************************************************
+    T* create(const T& value)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        ::new (p) T(value);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the item and returns it to the node that it came from.
+    //*************************************************************************
+    void destroy(const T* p_object)
+    {
+      if (p_object != nullptr)
+      {
+        p_object->~T();
+        release(p_object);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the item to the node that it came from.
+    /// Items that do not belong to the set are ignored.
+    //*************************************************************************
+    void release(const void* p_object)
+    {
+      const size_t node = node_of(p_object);
+
+      if (node != NODES)
+      {
+        node_t& n = *nodes[node];
+
+        n.lock.lock();
+        n.pool.release(p_object);
+        n.lock.unlock();
+      }
+    }
+
+    //*************************************************************************
+    /// The node that the item belongs to, or NUMBER_OF_NODES if none.
+    //*************************************************************************
+    size_t node_of(const void* p_object) const
+    {
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        if (nodes[i]->pool.is_in_pool(p_object))
+        {
+          return i;
+        }
+      }
+
+      return NODES;
+    }
+
+    //*************************************************************************
+    /// The number of allocated items on the node.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size(size_t node) const
+    {
+      return nodes[node]->pool.size();
+    }
+
+    //*************************************************************************
+    /// The number of free items on the node.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available(size_t node) const
+    {
+      return nodes[node]->pool.available();
+    }
+
+    //*************************************************************************
+    /// The number of items that the node has lent to threads on other nodes.
+    //*************************************************************************
+    size_t lent(size_t node) const
+    {
+      return nodes[node]->lent;
+    }
+
+    //*************************************************************************
+    /// The number of allocated items.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        n += size(i);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The number of free items.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        n += available(i);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The number of items on each node.
+    //*************************************************************************
+    size_t max_size_per_node() const
+    {
+      return nodes[0]->pool.max_size();
+    }
+
+    //*************************************************************************
+    /// The number of items on all nodes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return NODES * max_size_per_node();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    inuma_pool_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inuma_pool_set()
+    {
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        nodes[i]->~node_t();
+      }
+    }
+
+    //*************************************************************************
+    /// Builds each node's control block at the start of its region.
+    //*************************************************************************
+    void initialise(void* const* buffers, size_t max_items)
+    {
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        char* p_region = static_cast<char*>(buffers[i]);
+
+        nodes[i] = ::new (p_region) node_t(p_region + HEADER_SIZE, max_items);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    T* try_allocate_from(size_t node, bool is_remote)
+    {
+      node_t& n = *nodes[node];
+      T* p = nullptr;
+
+      n.lock.lock();
+
+      if (!n.pool.full())
+      {
+        p = n.pool.template allocate<T>();
+
+        if (is_remote)
+        {
+          ++n.lent;
+        }
+      }
+
+      n.lock.unlock();
+
+      return p;
+    }
+
+    // Disabled.
+    inuma_pool_set(const inuma_pool_set&);
+    inuma_pool_set& operator =(const inuma_pool_set&);
+
+    node_t* nodes[NODES];
+  };
+
+  //***************************************************************************
+  ///\ingroup numa_pool_set
+  /// A NUMA pool set with internal storage, MAX_ITEMS per node.
+  /// The pages of the internal storage are placed by the operating system,
+  /// usually on the node of the thread that first writes them, so this is
+  /// for targets with a fixed memory map, or for testing. Use
+  /// etl::numa_pool_set<T, 0, NODES> with per-node buffers for real placement.
+  //***************************************************************************
+  template <typename T, const size_t MAX_ITEMS, const size_t NODES, typename TLock = etl::spinlock>
+  class numa_pool_set : public etl::inuma_pool_set<T, NODES, TLock>
+  {
+  private:
+
+    typedef etl::inuma_pool_set<T, NODES, TLock> base_t;
+
+    static const size_t LINE = (ETL_CACHE_LINE_SIZE > 0) ? size_t(ETL_CACHE_LINE_SIZE) : 1U;
+
+    // Each region is padded to whole cache lines, so that regions do not share a line.
+    static const size_t REGION_SIZE = ((base_t::HEADER_SIZE + (MAX_ITEMS * etl::pool_ext<T>::ITEM_SIZE) + LINE - 1U) / LINE) * LINE;
+
+  public:
+
+    static const size_t MAX_SIZE_PER_NODE = MAX_ITEMS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    numa_pool_set()
+    {
+      void* buffers[NODES];
+
+      for (size_t i = 0U; i < NODES; ++i)
+      {
+        buffers[i] = &regions[i];
+      }
+
+      this->initialise(buffers, MAX_ITEMS);
+    }
+
+  private:
+
+    typename etl::aligned_storage<REGION_SIZE, base_t::ALIGNMENT>::type regions[NODES];
+  };
+
+  //***************************************************************************
+  ///\ingroup numa_pool_set
+  /// A NUMA pool set with a caller supplied region for each node, such as
+  /// memory from numa_alloc_onnode(), that holds buffer_size(max_items) bytes
+  /// and is aligned to ALIGNMENT.
+  ///\code
+  /// typedef etl::numa_pool_set<Packet, 0, 2> Pools;
+  ///
+  /// void* const regions[2] = { numa_alloc_onnode(Pools::buffer_size(1000), 0),
+  ///                            numa_alloc_onnode(Pools::buffer_size(1000), 1) };
+  /// Pools pools(regions, 1000);
+  ///\endcode
+  //***************************************************************************
+  template <typename T, const size_t NODES, typename TLock>
+  class numa_pool_set<T, 0U, NODES, TLock> : public etl::inuma_pool_set<T, NODES, TLock>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffers   The region for each node.
+    ///\param max_items The number of items in each region.
+    //*************************************************************************
+    numa_pool_set(void* const (&buffers)[NODES], size_t max_items)
+    {
+      this->initialise(buffers, max_items);
+    }
+  };
+}
+
+#endif
+#endif
@@ -54,6 +54,105 @@ namespace etl
       *first++ = value++;
     }
   }
+
+  //***************************************************************************
+  /// accumulate
+  /// Sums the values in the range, starting with <b>init</b>.
+  ///\param first An iterator to the first element.
+  ///\param last  An iterator to the last + 1 element.
+  ///\param init  The initial value.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T accumulate(TIterator first, TIterator last, T init)
+  {
+    while (first != last)
+    {
+      init = init + *first++;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// accumulate
+  /// Folds the values in the range with <b>operation</b>, starting with <b>init</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T accumulate(TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      init = operation(init, *first++);
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// inner_product
+  /// Sums the products of the pairs of elements, starting with <b>init</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T>
+  T inner_product(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init)
+  {
+    while (first1 != last1)
+    {
+      init = init + (*first1++ * *first2++);
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// inner_product
+  /// Folds the pairs of elements combined with <b>product</b> using <b>sum</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TSum, typename TProduct>
+  T inner_product(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TSum sum, TProduct product)
+  {
+    while (first1 != last1)
+    {
+      init = sum(init, product(*first1++, *first2++));
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// Applies <b>transform</b> to each element and folds the results with <b>reduce</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(TIterator first, TIterator last, T init, TReduce reduce, TTransform transform)
+  {
+    while (first != last)
+    {
+      init = reduce(init, transform(*first++));
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// Applies <b>transform</b> to each pair of elements and folds the results with <b>reduce</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TReduce reduce, TTransform transform)
+  {
+    while (first1 != last1)
+    {
+      init = reduce(init, transform(*first1++, *first2++));
+    }
+
+    return init;
+  }
 }
 
 #endif
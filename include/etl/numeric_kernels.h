@@ -0,0 +1,787 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_NUMERIC_KERNELS_INCLUDED
+#define ETL_NUMERIC_KERNELS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "array_view.h"
+#include "numeric.h"
+#include "limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+
+///\defgroup numeric_kernels numeric_kernels
+/// Numeric kernels over etl::array_view, vectorised for int16_t, int32_t and float.
+/// Define ETL_USE_SSE2 or ETL_USE_NEON in the profile to enable the SIMD paths.
+/// They are only used when the compiler also targets that instruction set;
+/// otherwise, and for all other element types, portable loops are used.
+/// The SIMD float paths sum in a different order to the portable loop, so
+/// results may differ in the last bits. Float data must not contain NaNs.
+///\ingroup numeric
+
+#if defined(ETL_USE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_NUMERIC_KERNELS_SSE2
+  #include <emmintrin.h>
+#elif defined(ETL_USE_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_NUMERIC_KERNELS_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_numeric_kernels
+  {
+    //*************************************************************************
+    /// The element types accepted by the saturating kernels.
+    //*************************************************************************
+    template <typename T>
+    struct is_saturable : etl::integral_constant<bool, etl::is_integral<T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Scalar helpers, also used for the tails of the SIMD kernels.
+    //*************************************************************************
+    template <typename T>
+    void minmax_scalar(const T* p, size_t n, T& minimum, T& maximum)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        minimum = (p[i] < minimum) ? p[i] : minimum;
+        maximum = (maximum < p[i]) ? p[i] : maximum;
+      }
+    }
+
+    template <typename T>
+    T add_sat_scalar(T a, T b)
+    {
+      if (b > T(0))
+      {
+        return (a > T(etl::numeric_limits<T>::max() - b)) ? etl::numeric_limits<T>::max() : T(a + b);
+      }
+      else
+      {
+        return (a < T(etl::numeric_limits<T>::min() - b)) ? etl::numeric_limits<T>::min() : T(a + b);
+      }
+    }
+
+    template <typename T>
+    void add_sat_scalar(const T* p1, const T* p2, T* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = add_sat_scalar(p1[i], p2[i]);
+      }
+    }
+
+    template <typename T>
+    T sub_sat_scalar(T a, T b)
+    {
+      if (b > T(0))
+      {
+        return (a < T(etl::numeric_limits<T>::min() + b)) ? etl::numeric_limits<T>::min() : T(a - b);
+      }
+      else
+      {
+        return (a > T(etl::numeric_limits<T>::max() + b)) ? etl::numeric_limits<T>::max() : T(a - b);
+      }
+    }
+
+    template <typename T>
+    void sub_sat_scalar(const T* p1, const T* p2, T* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = sub_sat_scalar(p1[i], p2[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Portable kernels. Specialised below for the SIMD paths.
+    //*************************************************************************
+    template <typename T, typename TAccumulator>
+    struct accumulate_kernel
+    {
+      static TAccumulator run(const T* p, size_t n, TAccumulator sum)
+      {
+        return etl::accumulate(p, p + n, sum);
+      }
+    };
+
+    template <typename T, typename TAccumulator>
+    struct inner_product_kernel
+    {
+      static TAccumulator run(const T* p1, const T* p2, size_t n, TAccumulator sum)
+      {
+        return etl::inner_product(p1, p1 + n, p2, sum);
+      }
+    };
+
+    template <typename T>
+    struct minmax_kernel
+    {
+      static void run(const T* p, size_t n, T& minimum, T& maximum)
+      {
+        minmax_scalar(p, n, minimum, maximum);
+      }
+    };
+
+    template <typename T>
+    struct add_sat_kernel
+    {
+      static void run(const T* p1, const T* p2, T* p_out, size_t n)
+      {
+        add_sat_scalar(p1, p2, p_out, n);
+      }
+    };
+
+    template <typename T>
+    struct sub_sat_kernel
+    {
+      static void run(const T* p1, const T* p2, T* p_out, size_t n)
+      {
+        sub_sat_scalar(p1, p2, p_out, n);
+      }
+    };
+
+#if defined(ETL_NUMERIC_KERNELS_SSE2)
+    //*************************************************************************
+    /// SSE2 kernels.
+    //*************************************************************************
+    inline int32_t horizontal_sum(__m128i v)
+    {
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+      return _mm_cvtsi128_si32(v);
+    }
+
+    inline float horizontal_sum(__m128 v)
+    {
+      v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+      v = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+      return _mm_cvtss_f32(v);
+    }
+
+    inline __m128i load(const void* p)
+    {
+      return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    template <>
+    struct accumulate_kernel<int16_t, int32_t>
+    {
+      static int32_t run(const int16_t* p, size_t n, int32_t sum)
+      {
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i       acc  = _mm_setzero_si128();
+        size_t        i    = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          acc = _mm_add_epi32(acc, _mm_madd_epi16(load(p + i), ones));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct accumulate_kernel<int32_t, int32_t>
+    {
+      static int32_t run(const int32_t* p, size_t n, int32_t sum)
+      {
+        __m128i acc = _mm_setzero_si128();
+        size_t  i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = _mm_add_epi32(acc, load(p + i));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct accumulate_kernel<float, float>
+    {
+      static float run(const float* p, size_t n, float sum)
+      {
+        __m128 acc = _mm_setzero_ps();
+        size_t i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct inner_product_kernel<int16_t, int32_t>
+    {
+      static int32_t run(const int16_t* p1, const int16_t* p2, size_t n, int32_t sum)
+      {
+        __m128i acc = _mm_setzero_si128();
+        size_t  i   = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          acc = _mm_add_epi32(acc, _mm_madd_epi16(load(p1 + i), load(p2 + i)));
+        }
+
+        return etl::inner_product(p1 + i, p1 + n, p2 + i, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct inner_product_kernel<float, float>
+    {
+      static float run(const float* p1, const float* p2, size_t n, float sum)
+      {
+        __m128 acc = _mm_setzero_ps();
+        size_t i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(p1 + i), _mm_loadu_ps(p2 + i)));
+        }
+
+        return etl::inner_product(p1 + i, p1 + n, p2 + i, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct minmax_kernel<int16_t>
+    {
+      static void run(const int16_t* p, size_t n, int16_t& minimum, int16_t& maximum)
+      {
+        __m128i vmin = _mm_set1_epi16(minimum);
+        __m128i vmax = _mm_set1_epi16(maximum);
+        size_t  i    = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          const __m128i v = load(p + i);
+          vmin = _mm_min_epi16(vmin, v);
+          vmax = _mm_max_epi16(vmax, v);
+        }
+
+        int16_t lanes_min[8];
+        int16_t lanes_max[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes_min), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes_max), vmax);
+
+        minmax_scalar(lanes_min, 8U, minimum, maximum);
+        minmax_scalar(lanes_max, 8U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct minmax_kernel<int32_t>
+    {
+      static void run(const int32_t* p, size_t n, int32_t& minimum, int32_t& maximum)
+      {
+        __m128i vmin = _mm_set1_epi32(minimum);
+        __m128i vmax = _mm_set1_epi32(maximum);
+        size_t  i    = 0U;
+
+        // SSE2 has no 32 bit min/max, so select with a comparison mask.
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          const __m128i v = load(p + i);
+
+          __m128i mask = _mm_cmplt_epi32(v, vmin);
+          vmin = _mm_or_si128(_mm_and_si128(mask, v), _mm_andnot_si128(mask, vmin));
+
+          mask = _mm_cmpgt_epi32(v, vmax);
+          vmax = _mm_or_si128(_mm_and_si128(mask, v), _mm_andnot_si128(mask, vmax));
+        }
+
+        int32_t lanes_min[4];
+        int32_t lanes_max[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes_min), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes_max), vmax);
+
+        minmax_scalar(lanes_min, 4U, minimum, maximum);
+        minmax_scalar(lanes_max, 4U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct minmax_kernel<float>
+    {
+      static void run(const float* p, size_t n, float& minimum, float& maximum)
+      {
+        __m128 vmin = _mm_set1_ps(minimum);
+        __m128 vmax = _mm_set1_ps(maximum);
+        size_t i    = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          const __m128 v = _mm_loadu_ps(p + i);
+          vmin = _mm_min_ps(vmin, v);
+          vmax = _mm_max_ps(vmax, v);
+        }
+
+        float lanes_min[4];
+        float lanes_max[4];
+        _mm_storeu_ps(lanes_min, vmin);
+        _mm_storeu_ps(lanes_max, vmax);
+
+        minmax_scalar(lanes_min, 4U, minimum, maximum);
+        minmax_scalar(lanes_max, 4U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct add_sat_kernel<int16_t>
+    {
+      static void run(const int16_t* p1, const int16_t* p2, int16_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(p_out + i), _mm_adds_epi16(load(p1 + i), load(p2 + i)));
+        }
+
+        add_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+
+    template <>
+    struct sub_sat_kernel<int16_t>
+    {
+      static void run(const int16_t* p1, const int16_t* p2, int16_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(p_out + i), _mm_subs_epi16(load(p1 + i), load(p2 + i)));
+        }
+
+        sub_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+
+#elif defined(ETL_NUMERIC_KERNELS_NEON)
+    //*************************************************************************
+    /// NEON kernels.
+    //*************************************************************************
+    inline int32_t horizontal_sum(int32x4_t v)
+    {
+      return vgetq_lane_s32(v, 0) + vgetq_lane_s32(v, 1) + vgetq_lane_s32(v, 2) + vgetq_lane_s32(v, 3);
+    }
+
+    inline float horizontal_sum(float32x4_t v)
+    {
+      return (vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1)) + (vgetq_lane_f32(v, 2) + vgetq_lane_f32(v, 3));
+    }
+
+    template <>
+    struct accumulate_kernel<int16_t, int32_t>
+    {
+      static int32_t run(const int16_t* p, size_t n, int32_t sum)
+      {
+        int32x4_t acc = vdupq_n_s32(0);
+        size_t    i   = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          acc = vpadalq_s16(acc, vld1q_s16(p + i));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct accumulate_kernel<int32_t, int32_t>
+    {
+      static int32_t run(const int32_t* p, size_t n, int32_t sum)
+      {
+        int32x4_t acc = vdupq_n_s32(0);
+        size_t    i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = vaddq_s32(acc, vld1q_s32(p + i));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct accumulate_kernel<float, float>
+    {
+      static float run(const float* p, size_t n, float sum)
+      {
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        size_t      i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = vaddq_f32(acc, vld1q_f32(p + i));
+        }
+
+        return etl::accumulate(p + i, p + n, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct inner_product_kernel<int16_t, int32_t>
+    {
+      static int32_t run(const int16_t* p1, const int16_t* p2, size_t n, int32_t sum)
+      {
+        int32x4_t acc = vdupq_n_s32(0);
+        size_t    i   = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          const int16x8_t a = vld1q_s16(p1 + i);
+          const int16x8_t b = vld1q_s16(p2 + i);
+          acc = vmlal_s16(acc, vget_low_s16(a),  vget_low_s16(b));
+          acc = vmlal_s16(acc, vget_high_s16(a), vget_high_s16(b));
+        }
+
+        return etl::inner_product(p1 + i, p1 + n, p2 + i, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct inner_product_kernel<int32_t, int32_t>
+    {
+      static int32_t run(const int32_t* p1, const int32_t* p2, size_t n, int32_t sum)
+      {
+        int32x4_t acc = vdupq_n_s32(0);
+        size_t    i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = vmlaq_s32(acc, vld1q_s32(p1 + i), vld1q_s32(p2 + i));
+        }
+
+        return etl::inner_product(p1 + i, p1 + n, p2 + i, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct inner_product_kernel<float, float>
+    {
+      static float run(const float* p1, const float* p2, size_t n, float sum)
+      {
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        size_t      i   = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          acc = vmlaq_f32(acc, vld1q_f32(p1 + i), vld1q_f32(p2 + i));
+        }
+
+        return etl::inner_product(p1 + i, p1 + n, p2 + i, sum + horizontal_sum(acc));
+      }
+    };
+
+    template <>
+    struct minmax_kernel<int16_t>
+    {
+      static void run(const int16_t* p, size_t n, int16_t& minimum, int16_t& maximum)
+      {
+        int16x8_t vmin = vdupq_n_s16(minimum);
+        int16x8_t vmax = vdupq_n_s16(maximum);
+        size_t    i    = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          const int16x8_t v = vld1q_s16(p + i);
+          vmin = vminq_s16(vmin, v);
+          vmax = vmaxq_s16(vmax, v);
+        }
+
+        int16_t lanes_min[8];
+        int16_t lanes_max[8];
+        vst1q_s16(lanes_min, vmin);
+        vst1q_s16(lanes_max, vmax);
+
+        minmax_scalar(lanes_min, 8U, minimum, maximum);
+        minmax_scalar(lanes_max, 8U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct minmax_kernel<int32_t>
+    {
+      static void run(const int32_t* p, size_t n, int32_t& minimum, int32_t& maximum)
+      {
+        int32x4_t vmin = vdupq_n_s32(minimum);
+        int32x4_t vmax = vdupq_n_s32(maximum);
+        size_t    i    = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          const int32x4_t v = vld1q_s32(p + i);
+          vmin = vminq_s32(vmin, v);
+          vmax = vmaxq_s32(vmax, v);
+        }
+
+        int32_t lanes_min[4];
+        int32_t lanes_max[4];
+        vst1q_s32(lanes_min, vmin);
+        vst1q_s32(lanes_max, vmax);
+
+        minmax_scalar(lanes_min, 4U, minimum, maximum);
+        minmax_scalar(lanes_max, 4U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct minmax_kernel<float>
+    {
+      static void run(const float* p, size_t n, float& minimum, float& maximum)
+      {
+        float32x4_t vmin = vdupq_n_f32(minimum);
+        float32x4_t vmax = vdupq_n_f32(maximum);
+        size_t      i    = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          const float32x4_t v = vld1q_f32(p + i);
+          vmin = vminq_f32(vmin, v);
+          vmax = vmaxq_f32(vmax, v);
+        }
+
+        float lanes_min[4];
+        float lanes_max[4];
+        vst1q_f32(lanes_min, vmin);
+        vst1q_f32(lanes_max, vmax);
+
+        minmax_scalar(lanes_min, 4U, minimum, maximum);
+        minmax_scalar(lanes_max, 4U, minimum, maximum);
+        minmax_scalar(p + i, n - i, minimum, maximum);
+      }
+    };
+
+    template <>
+    struct add_sat_kernel<int16_t>
+    {
+      static void run(const int16_t* p1, const int16_t* p2, int16_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          vst1q_s16(p_out + i, vqaddq_s16(vld1q_s16(p1 + i), vld1q_s16(p2 + i)));
+        }
+
+        add_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+
+    template <>
+    struct add_sat_kernel<int32_t>
+    {
+      static void run(const int32_t* p1, const int32_t* p2, int32_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          vst1q_s32(p_out + i, vqaddq_s32(vld1q_s32(p1 + i), vld1q_s32(p2 + i)));
+        }
+
+        add_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+
+    template <>
+    struct sub_sat_kernel<int16_t>
+    {
+      static void run(const int16_t* p1, const int16_t* p2, int16_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 8U) <= n; i += 8U)
+        {
+          vst1q_s16(p_out + i, vqsubq_s16(vld1q_s16(p1 + i), vld1q_s16(p2 + i)));
+        }
+
+        sub_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+
+    template <>
+    struct sub_sat_kernel<int32_t>
+    {
+      static void run(const int32_t* p1, const int32_t* p2, int32_t* p_out, size_t n)
+      {
+        size_t i = 0U;
+
+        for (; (i + 4U) <= n; i += 4U)
+        {
+          vst1q_s32(p_out + i, vqsubq_s32(vld1q_s32(p1 + i), vld1q_s32(p2 + i)));
+        }
+
+        sub_sat_scalar(p1 + i, p2 + i, p_out + i, n - i);
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// Sums the elements of the view, starting with <b>init</b>.
+  /// Vectorised for int16_t with an int32_t accumulator, int32_t and float.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T, typename TAccumulator>
+  TAccumulator accumulate(const etl::array_view<T>& view, TAccumulator init)
+  {
+    typedef typename etl::remove_cv<T>::type value_type;
+
+    return private_numeric_kernels::accumulate_kernel<value_type, TAccumulator>::run(view.data(), view.size(), init);
+  }
+
+  //***************************************************************************
+  /// Sums the products of the paired elements of the views, starting with <b>init</b>.
+  /// Only the length of the shorter view is used.
+  /// Vectorised for int16_t with an int32_t accumulator and float, and for
+  /// int32_t on NEON.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T1, typename T2, typename TAccumulator>
+  TAccumulator inner_product(const etl::array_view<T1>& view1, const etl::array_view<T2>& view2, TAccumulator init)
+  {
+    typedef typename etl::remove_cv<T1>::type value_type;
+
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T2>::type>::value), "Views must have the same element type");
+
+    const size_t n = (view1.size() < view2.size()) ? view1.size() : view2.size();
+
+    return private_numeric_kernels::inner_product_kernel<value_type, TAccumulator>::run(view1.data(), view2.data(), n, init);
+  }
+
+  //***************************************************************************
+  /// Applies <b>transform</b> to each element of the view and folds the
+  /// results with <b>reduce</b>. Not vectorised, as the operations are opaque.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T, typename TAccumulator, typename TReduce, typename TTransform>
+  TAccumulator transform_reduce(const etl::array_view<T>& view, TAccumulator init, TReduce reduce, TTransform transform)
+  {
+    return etl::transform_reduce(view.begin(), view.end(), init, reduce, transform);
+  }
+
+  //***************************************************************************
+  /// Finds the smallest and largest element values of the view in one pass.
+  /// Returns a pair of default constructed values if the view is empty.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T>
+  ETL_OR_STD::pair<typename etl::remove_cv<T>::type, typename etl::remove_cv<T>::type> minmax_value(const etl::array_view<T>& view)
+  {
+    typedef typename etl::remove_cv<T>::type value_type;
+
+    value_type minimum = value_type();
+    value_type maximum = value_type();
+
+    if (!view.empty())
+    {
+      minimum = view[0];
+      maximum = view[0];
+      private_numeric_kernels::minmax_kernel<value_type>::run(view.data() + 1, view.size() - 1U, minimum, maximum);
+    }
+
+    return ETL_OR_STD::pair<value_type, value_type>(minimum, maximum);
+  }
+
+  //***************************************************************************
+  /// Adds the paired elements of the input views, clamping to the range of the
+  /// element type, and writes the results to <b>output</b>.
+  /// Processes the length of the shortest view and returns it.
+  /// Vectorised for int16_t, and for int32_t on NEON.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T1, typename T2, typename TOut>
+  size_t add_sat(const etl::array_view<T1>& view1, const etl::array_view<T2>& view2, etl::array_view<TOut> output)
+  {
+    typedef TOut value_type;
+
+    ETL_STATIC_ASSERT(private_numeric_kernels::is_saturable<value_type>::value, "Saturated add requires an integral type");
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T1>::type>::value), "Views must have the same element type");
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T2>::type>::value), "Views must have the same element type");
+
+    size_t n = (view1.size() < view2.size()) ? view1.size() : view2.size();
+    n = (n < output.size()) ? n : output.size();
+
+    private_numeric_kernels::add_sat_kernel<value_type>::run(view1.data(), view2.data(), output.data(), n);
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Subtracts the paired elements of the input views, clamping to the range
+  /// of the element type, and writes the results to <b>output</b>.
+  /// Processes the length of the shortest view and returns it.
+  /// Vectorised for int16_t, and for int32_t on NEON.
+  ///\ingroup numeric_kernels
+  //***************************************************************************
+  template <typename T1, typename T2, typename TOut>
+  size_t sub_sat(const etl::array_view<T1>& view1, const etl::array_view<T2>& view2, etl::array_view<TOut> output)
+  {
+    typedef TOut value_type;
+
+    ETL_STATIC_ASSERT(private_numeric_kernels::is_saturable<value_type>::value, "Saturated subtract requires an integral type");
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T1>::type>::value), "Views must have the same element type");
+    ETL_STATIC_ASSERT((etl::is_same<value_type, typename etl::remove_cv<T2>::type>::value), "Views must have the same element type");
+
+    size_t n = (view1.size() < view2.size()) ? view1.size() : view2.size();
+    n = (n < output.size()) ? n : output.size();
+
+    private_numeric_kernels::sub_sat_kernel<value_type>::run(view1.data(), view2.data(), output.data(), n);
+
+    return n;
+  }
+}
+
+#endif
@@ -0,0 +1,187 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ONLINE_STATISTICS_INCLUDED
+#define ETL_ONLINE_STATISTICS_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup online_statistics online_statistics
+/// Mean, variance, minimum and maximum of every sample added, using Welford's
+/// online algorithm. Numerically stable and O(1) per sample, with no history.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// Online statistics.
+  /// \tparam T The floating point sample type.
+  //***************************************************************************
+  template <typename T>
+  class online_statistics
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "Online statistics require a floating point type");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    online_statistics()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    //*************************************************************************
+    void clear()
+    {
+      sample_count  = 0U;
+      running_mean  = T(0);
+      m2            = T(0);
+      minimum_value = T(0);
+      maximum_value = T(0);
+    }
+
+    //*************************************************************************
+    /// Adds a new sample.
+    /// \param value The value to add.
+    //*************************************************************************
+    void add(T value)
+    {
+      ++sample_count;
+
+      const T delta = value - running_mean;
+      running_mean += delta / T(sample_count);
+      m2           += delta * (value - running_mean);
+
+      if ((sample_count == 1U) || (value < minimum_value))
+      {
+        minimum_value = value;
+      }
+
+      if ((sample_count == 1U) || (maximum_value < value))
+      {
+        maximum_value = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Combines the statistics of another set of samples with these.
+    /// Allows partial statistics to be gathered separately.
+    //*************************************************************************
+    void merge(const online_statistics& other)
+    {
+      if (other.sample_count == 0U)
+      {
+        return;
+      }
+
+      if (sample_count == 0U)
+      {
+        *this = other;
+        return;
+      }
+
+      const size_t total = sample_count + other.sample_count;
+      const T      delta = other.running_mean - running_mean;
+
+      running_mean += delta * (T(other.sample_count) / T(total));
+      m2           += other.m2 + (delta * delta * ((T(sample_count) * T(other.sample_count)) / T(total)));
+      sample_count  = total;
+
+      minimum_value = (other.minimum_value < minimum_value) ? other.minimum_value : minimum_value;
+      maximum_value = (maximum_value < other.maximum_value) ? other.maximum_value : maximum_value;
+    }
+
+    //*************************************************************************
+    /// The number of samples added.
+    //*************************************************************************
+    size_t count() const
+    {
+      return sample_count;
+    }
+
+    //*************************************************************************
+    /// The mean of the samples.
+    //*************************************************************************
+    T mean() const
+    {
+      return running_mean;
+    }
+
+    //*************************************************************************
+    /// The population variance of the samples.
+    //*************************************************************************
+    T variance() const
+    {
+      return (sample_count == 0U) ? T(0) : m2 / T(sample_count);
+    }
+
+    //*************************************************************************
+    /// The sample variance of the samples.
+    //*************************************************************************
+    T sample_variance() const
+    {
+      return (sample_count < 2U) ? T(0) : m2 / T(sample_count - 1U);
+    }
+
+    //*************************************************************************
+    /// The smallest sample, or zero if empty.
+    //*************************************************************************
+    T minimum() const
+    {
+      return minimum_value;
+    }
+
+    //*************************************************************************
+    /// The largest sample, or zero if empty.
+    //*************************************************************************
+    T maximum() const
+    {
+      return maximum_value;
+    }
+
+  private:
+
+    size_t sample_count;
+    T      running_mean;
+    T      m2;
+    T      minimum_value;
+    T      maximum_value;
+  };
+}
+
+#endif
@@ -0,0 +1,563 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_ALGORITHM_INCLUDED
+#define ETL_PARALLEL_ALGORITHM_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "numeric.h"
+#include "iterator.h"
+#include "functional.h"
+#include "alignment.h"
+#include "utility.h"
+#include "parallel_executor.h"
+
+///\defgroup parallel_algorithm parallel_algorithm
+/// Execution policy overloads of for_each, transform, reduce, count_if and sort.
+/// etl::execution::par(executor) splits a random access range into chunks that
+/// are processed by an etl::parallel_executor. etl::execution::seq runs the
+/// sequential algorithm. Nothing is allocated; the per chunk state lives on the
+/// caller's stack, so the number of chunks is limited to
+/// ETL_PARALLEL_ALGORITHM_MAX_CHUNKS, which may be defined in the profile.
+///\ingroup algorithm
+
+#if ETL_HAS_ATOMIC
+
+#if !defined(ETL_PARALLEL_ALGORITHM_MAX_CHUNKS)
+  #define ETL_PARALLEL_ALGORITHM_MAX_CHUNKS 32
+#endif
+
+namespace etl
+{
+  namespace execution
+  {
+    //*************************************************************************
+    /// Run the algorithm sequentially on the calling thread.
+    //*************************************************************************
+    struct sequenced_policy
+    {
+    };
+
+    static const sequenced_policy seq = sequenced_policy();
+
+    //*************************************************************************
+    /// Run the algorithm in chunks on a parallel executor.
+    //*************************************************************************
+    class parallel_policy
+    {
+    public:
+
+      parallel_policy(etl::iparallel_executor& executor_, size_t chunks_)
+        : p_executor(&executor_),
+          chunks((chunks_ == 0U) ? 1U : ((chunks_ > ETL_PARALLEL_ALGORITHM_MAX_CHUNKS) ? ETL_PARALLEL_ALGORITHM_MAX_CHUNKS : chunks_))
+      {
+      }
+
+      etl::iparallel_executor& get_executor() const
+      {
+        return *p_executor;
+      }
+
+      /// The number of chunks to split a range into.
+      size_t get_chunks() const
+      {
+        return chunks;
+      }
+
+    private:
+
+      etl::iparallel_executor* p_executor;
+      size_t                   chunks;
+    };
+
+    //*************************************************************************
+    /// A parallel policy with one chunk per worker plus one for the caller.
+    //*************************************************************************
+    inline parallel_policy par(etl::iparallel_executor& executor)
+    {
+      return parallel_policy(executor, executor.number_of_workers() + 1U);
+    }
+
+    //*************************************************************************
+    /// A parallel policy with the given number of chunks.
+    //*************************************************************************
+    inline parallel_policy par(etl::iparallel_executor& executor, size_t chunks)
+    {
+      return parallel_policy(executor, chunks);
+    }
+  }
+
+  namespace private_parallel_algorithm
+  {
+    //*************************************************************************
+    /// Splits 'length' elements into 'chunks' near equal parts.
+    //*************************************************************************
+    struct chunking
+    {
+      chunking(size_t length_, size_t chunks_)
+        : length(length_),
+          chunks((chunks_ < length_) ? chunks_ : length_)
+      {
+      }
+
+      /// The offset of the first element of chunk 'i'. begin(chunks) == length.
+      size_t begin(size_t i) const
+      {
+        const size_t quotient  = length / chunks;
+        const size_t remainder = length % chunks;
+
+        return (quotient * i) + ((i < remainder) ? i : remainder);
+      }
+
+      size_t length;
+      size_t chunks;
+    };
+
+    //*************************************************************************
+    template <typename T>
+    struct plus
+    {
+      T operator ()(const T& lhs, const T& rhs) const
+      {
+        return lhs + rhs;
+      }
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    class for_each_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      for_each_job(TIterator first_, const chunking& chunks_, const TFunction& function_)
+        : first(first_),
+          chunks(chunks_),
+          function(function_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        TFunction f(function);
+
+        TIterator itr = first + chunks.begin(i);
+        TIterator end = first + chunks.begin(i + 1U);
+
+        while (itr != end)
+        {
+          f(*itr++);
+        }
+      }
+
+    private:
+
+      TIterator        first;
+      chunking         chunks;
+      const TFunction& function;
+    };
+
+    //*************************************************************************
+    template <typename TIteratorIn, typename TIteratorOut, typename TOperation>
+    class transform_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      transform_job(TIteratorIn first_, TIteratorOut d_first_, const chunking& chunks_, const TOperation& operation_)
+        : first(first_),
+          d_first(d_first_),
+          chunks(chunks_),
+          operation(operation_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        const size_t begin = chunks.begin(i);
+        etl::transform(first + begin, first + chunks.begin(i + 1U), d_first + begin, operation);
+      }
+
+    private:
+
+      TIteratorIn       first;
+      TIteratorOut      d_first;
+      chunking          chunks;
+      const TOperation& operation;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate, typename TCount>
+    class count_if_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      count_if_job(TIterator first_, const chunking& chunks_, const TPredicate& predicate_, TCount* p_counts_)
+        : first(first_),
+          chunks(chunks_),
+          predicate(predicate_),
+          p_counts(p_counts_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        p_counts[i] = etl::count_if(first + chunks.begin(i), first + chunks.begin(i + 1U), predicate);
+      }
+
+    private:
+
+      TIterator         first;
+      chunking          chunks;
+      const TPredicate& predicate;
+      TCount*           p_counts;
+    };
+
+    //*************************************************************************
+    /// Each chunk is folded starting from its first element, so no identity
+    /// value is needed. The partial results are constructed in place.
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TOperation>
+    class reduce_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      reduce_job(TIterator first_, const chunking& chunks_, const TOperation& operation_, T* p_partials_)
+        : first(first_),
+          chunks(chunks_),
+          operation(operation_),
+          p_partials(p_partials_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        TIterator begin = first + chunks.begin(i);
+        TIterator end   = first + chunks.begin(i + 1U);
+
+        T partial = *begin;
+        partial = etl::accumulate(++begin, end, partial, operation);
+
+        ::new (p_partials + i) T(partial);
+      }
+
+    private:
+
+      TIterator         first;
+      chunking          chunks;
+      const TOperation& operation;
+      T*                p_partials;
+    };
+
+    //*************************************************************************
+    /// Merges two sorted adjacent ranges without a buffer.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_in_place(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length1 = middle - first;
+      const difference_type length2 = last - middle;
+
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          using ETL_OR_STD::swap; // Allow ADL
+          swap(*first, *middle);
+        }
+
+        return;
+      }
+
+      TIterator cut1;
+      TIterator cut2;
+
+      if (length1 > length2)
+      {
+        cut1 = first + (length1 / 2);
+        cut2 = etl::lower_bound(middle, last, *cut1, compare);
+      }
+      else
+      {
+        cut2 = middle + (length2 / 2);
+        cut1 = etl::upper_bound(first, middle, *cut2, compare);
+      }
+
+      const TIterator new_middle = cut1 + (cut2 - middle);
+      etl::rotate(cut1, middle, cut2);
+
+      merge_in_place(first, cut1, new_middle, compare);
+      merge_in_place(new_middle, cut2, last, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    class sort_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      sort_job(TIterator first_, const chunking& chunks_, const TCompare& compare_)
+        : first(first_),
+          chunks(chunks_),
+          compare(compare_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        etl::sort(first + chunks.begin(i), first + chunks.begin(i + 1U), compare);
+      }
+
+    private:
+
+      TIterator       first;
+      chunking        chunks;
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Merges pairs of sorted runs, each 'width' chunks long.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    class merge_job : public etl::ifunction<size_t>
+    {
+    public:
+
+      merge_job(TIterator first_, const chunking& chunks_, size_t width_, const TCompare& compare_)
+        : first(first_),
+          chunks(chunks_),
+          width(width_),
+          compare(compare_)
+      {
+      }
+
+      void operator ()(size_t i) const
+      {
+        const size_t lower  = i * 2U * width;
+        const size_t middle = lower + width;
+        const size_t upper  = ((middle + width) < chunks.chunks) ? (middle + width) : chunks.chunks;
+
+        merge_in_place(first + chunks.begin(lower), first + chunks.begin(middle), first + chunks.begin(upper), compare);
+      }
+
+    private:
+
+      TIterator       first;
+      chunking        chunks;
+      size_t          width;
+      const TCompare& compare;
+    };
+  }
+
+  //***************************************************************************
+  /// Sequenced policy overloads.
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TFunction function)
+  {
+    while (first != last)
+    {
+      function(*first++);
+    }
+  }
+
+  template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
+  TIteratorOut transform(const etl::execution::sequenced_policy&, TIteratorIn first, TIteratorIn last, TIteratorOut d_first, TUnaryOperation operation)
+  {
+    return etl::transform(first, last, d_first, operation);
+  }
+
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::sequenced_policy&, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    return etl::accumulate(first, last, init, operation);
+  }
+
+  template <typename TIterator, typename T>
+  T reduce(const etl::execution::sequenced_policy&, TIterator first, TIterator last, T init)
+  {
+    return etl::accumulate(first, last, init);
+  }
+
+  template <typename TIterator, typename TUnaryPredicate>
+  typename etl::iterator_traits<TIterator>::difference_type count_if(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    return etl::count_if(first, last, predicate);
+  }
+
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TCompare compare)
+  {
+    etl::sort(first, last, compare);
+  }
+
+  template <typename TIterator>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last)
+  {
+    etl::sort(first, last);
+  }
+
+  //***************************************************************************
+  /// Calls 'function' for each element, in parallel.
+  /// Each chunk uses its own copy of 'function'.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TFunction function)
+  {
+    const private_parallel_algorithm::chunking chunks(size_t(etl::distance(first, last)), policy.get_chunks());
+
+    private_parallel_algorithm::for_each_job<TIterator, TFunction> job(first, chunks, function);
+    policy.get_executor().run(job, chunks.chunks);
+  }
+
+  //***************************************************************************
+  /// Transforms the elements, in parallel.
+  /// 'operation' is shared between the chunks, so must be thread safe.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
+  TIteratorOut transform(const etl::execution::parallel_policy& policy, TIteratorIn first, TIteratorIn last, TIteratorOut d_first, TUnaryOperation operation)
+  {
+    const private_parallel_algorithm::chunking chunks(size_t(etl::distance(first, last)), policy.get_chunks());
+
+    private_parallel_algorithm::transform_job<TIteratorIn, TIteratorOut, TUnaryOperation> job(first, d_first, chunks, operation);
+    policy.get_executor().run(job, chunks.chunks);
+
+    return d_first + chunks.length;
+  }
+
+  //***************************************************************************
+  /// Folds the elements with 'operation', in parallel.
+  /// 'operation' must be associative. The chunk results are combined in order,
+  /// so it need not be commutative.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    const private_parallel_algorithm::chunking chunks(size_t(etl::distance(first, last)), policy.get_chunks());
+
+    typename etl::aligned_storage<sizeof(T) * ETL_PARALLEL_ALGORITHM_MAX_CHUNKS, etl::alignment_of<T>::value>::type buffer;
+    T* p_partials = reinterpret_cast<T*>(&buffer);
+
+    private_parallel_algorithm::reduce_job<TIterator, T, TBinaryOperation> job(first, chunks, operation, p_partials);
+    policy.get_executor().run(job, chunks.chunks);
+
+    for (size_t i = 0U; i < chunks.chunks; ++i)
+    {
+      init = operation(init, p_partials[i]);
+      p_partials[i].~T();
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// Sums the elements, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(policy, first, last, init, private_parallel_algorithm::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Counts the elements that satisfy 'predicate', in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  typename etl::iterator_traits<TIterator>::difference_type count_if(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type count_t;
+
+    const private_parallel_algorithm::chunking chunks(size_t(etl::distance(first, last)), policy.get_chunks());
+
+    count_t counts[ETL_PARALLEL_ALGORITHM_MAX_CHUNKS];
+
+    private_parallel_algorithm::count_if_job<TIterator, TUnaryPredicate, count_t> job(first, chunks, predicate, counts);
+    policy.get_executor().run(job, chunks.chunks);
+
+    count_t count = 0;
+
+    for (size_t i = 0U; i < chunks.chunks; ++i)
+    {
+      count += counts[i];
+    }
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, in parallel.
+  /// The chunks are sorted, then adjacent runs are merged in place in rounds,
+  /// each round merging its pairs in parallel. Not stable.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TCompare compare)
+  {
+    const private_parallel_algorithm::chunking chunks(size_t(etl::distance(first, last)), policy.get_chunks());
+
+    private_parallel_algorithm::sort_job<TIterator, TCompare> job(first, chunks, compare);
+    policy.get_executor().run(job, chunks.chunks);
+
+    for (size_t width = 1U; width < chunks.chunks; width *= 2U)
+    {
+      const size_t pairs = (chunks.chunks - width + (2U * width) - 1U) / (2U * width);
+
+      private_parallel_algorithm::merge_job<TIterator, TCompare> merge(first, chunks, width, compare);
+      policy.get_executor().run(merge, pairs);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last)
+  {
+    etl::sort(policy, first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,212 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_EXECUTOR_INCLUDED
+#define ETL_PARALLEL_EXECUTOR_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+
+///\defgroup parallel_executor parallel_executor
+/// A fork/join executor that shares the chunks of one job between a fixed set
+/// of worker threads. As with the parallel scheduler, it does not create
+/// threads; each worker thread calls worker() or, for a custom loop, run_once().
+/// The thread calling run() processes chunks too, and returns when every chunk
+/// has completed. Only one thread may call run() at a time, and it must not be
+/// a worker thread. Nothing is allocated.
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Parallel executor base.
+  //***************************************************************************
+  class iparallel_executor
+  {
+  public:
+
+    typedef etl::ifunction<size_t> job_type;
+
+    //*******************************************
+    /// Run 'job' for each chunk index in [0, chunks) and wait for them all.
+    //*******************************************
+    void run(const job_type& job, size_t chunks)
+    {
+      if (chunks == 0U)
+      {
+        return;
+      }
+
+      next_chunk.store(0U);
+      chunk_count.store(chunks);
+      remaining.store(chunks);
+      p_job.store(&job);
+
+      run_once();
+
+      while (remaining.load() != 0U)
+      {
+        // Wait for the workers to finish their chunks.
+      }
+
+      // Withdraw the job and wait for any worker that may still refer to it.
+      p_job.store(nullptr);
+
+      while (participants.load() != 0U)
+      {
+      }
+    }
+
+    //*******************************************
+    /// Run a worker until exit_executor() is called.
+    /// Call from the thread dedicated to the worker.
+    //*******************************************
+    void worker()
+    {
+      while (!executor_exit.load())
+      {
+        run_once();
+      }
+    }
+
+    //*******************************************
+    /// Process chunks of the current job until none are left.
+    /// Returns true if there was nothing to do.
+    //*******************************************
+    bool run_once()
+    {
+      bool idle = true;
+
+      participants.fetch_add(1U);
+
+      const job_type* p_current = p_job.load();
+
+      if (p_current != nullptr)
+      {
+        const size_t chunks = chunk_count.load();
+        size_t chunk = next_chunk.fetch_add(1U);
+
+        while (chunk < chunks)
+        {
+          (*p_current)(chunk);
+          remaining.fetch_sub(1U);
+          idle = false;
+
+          chunk = next_chunk.fetch_add(1U);
+        }
+      }
+
+      participants.fetch_sub(1U);
+
+      return idle;
+    }
+
+    //*******************************************
+    /// Force all of the workers to exit.
+    //*******************************************
+    void exit_executor()
+    {
+      executor_exit.store(true);
+    }
+
+    //*******************************************
+    /// The number of worker threads, not including the caller of run().
+    //*******************************************
+    size_t number_of_workers() const
+    {
+      return workers;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit iparallel_executor(size_t workers_)
+      : workers(workers_)
+    {
+      p_job.store(nullptr);
+      next_chunk.store(0U);
+      chunk_count.store(0U);
+      remaining.store(0U);
+      participants.store(0U);
+      executor_exit.store(false);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    iparallel_executor(const iparallel_executor&) ETL_DELETE;
+    iparallel_executor& operator =(const iparallel_executor&) ETL_DELETE;
+
+    etl::atomic<const job_type*> p_job;
+    etl::atomic<size_t>          next_chunk;
+    etl::atomic<size_t>          chunk_count;
+    etl::atomic<size_t>          remaining;
+    etl::atomic<size_t>          participants;
+    etl::atomic<bool>            executor_exit;
+    const size_t                 workers;
+  };
+
+  //***************************************************************************
+  /// Parallel executor.
+  ///\tparam WORKERS_ The number of worker threads.
+  //***************************************************************************
+  template <size_t WORKERS_>
+  class parallel_executor : public etl::iparallel_executor
+  {
+  public:
+
+    ETL_STATIC_ASSERT(WORKERS_ > 0U, "Must have at least one worker");
+
+    enum
+    {
+      WORKERS = WORKERS_
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    parallel_executor()
+      : iparallel_executor(WORKERS)
+    {
+    }
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,487 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_SCHEDULER_INCLUDED
+#define ETL_PARALLEL_SCHEDULER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "task.h"
+#include "scheduler.h"
+#include "function.h"
+#include "power.h"
+#include "work_stealing_deque.h"
+
+#undef ETL_FILE
+#define ETL_FILE "58"
+
+///\defgroup parallel_scheduler parallel_scheduler
+/// A scheduler that shares a set of tasks between a number of worker threads.
+/// The scheduler does not create threads; each worker thread calls worker(index)
+/// or, for a custom loop, run_once(index).
+/// Each worker claims tasks that have work into its own work stealing deque and,
+/// when it has none, steals from the other workers.
+/// A task is only ever processed by one worker at a time, but its
+/// task_request_work() may be called from any worker, so it must be thread safe.
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// 'Worker index' exception.
+  //***************************************************************************
+  class parallel_scheduler_worker_index_exception : public etl::scheduler_exception
+  {
+  public:
+
+    parallel_scheduler_worker_index_exception(string_type file_name_, numeric_type line_number_)
+      : etl::scheduler_exception(ETL_ERROR_TEXT("parallel_scheduler:worker index", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The statistics for one worker.
+  //***************************************************************************
+  struct parallel_scheduler_statistics
+  {
+    uint32_t busy_count;  ///< The number of times the worker processed a task.
+    uint32_t idle_count;  ///< The number of times the worker found nothing to do.
+    uint32_t steal_count; ///< The number of tasks stolen from other workers.
+  };
+
+  //***************************************************************************
+  /// Parallel scheduler base.
+  //***************************************************************************
+  class iparallel_scheduler
+  {
+  public:
+
+    //*******************************************
+    /// Set the idle callback.
+    /// Called with the index of the worker that is idle.
+    //*******************************************
+    void set_idle_callback(etl::ifunction<size_t>& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback.
+    /// Called with the index of the worker on each pass.
+    //*******************************************
+    void set_watchdog_callback(etl::ifunction<size_t>& callback)
+    {
+      p_watchdog_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the running state for the scheduler.
+    //*******************************************
+    void set_scheduler_running(bool scheduler_running_)
+    {
+      scheduler_running.store(scheduler_running_);
+    }
+
+    //*******************************************
+    /// Get the running state for the scheduler.
+    //*******************************************
+    bool scheduler_is_running() const
+    {
+      return scheduler_running.load();
+    }
+
+    //*******************************************
+    /// Force all of the workers to exit.
+    //*******************************************
+    void exit_scheduler()
+    {
+      scheduler_exit.store(true);
+    }
+
+    //*******************************************
+    /// Add a task.
+    /// Add to the task list in priority order.
+    /// Must not be called while any worker is running.
+    //*******************************************
+    void add_task(etl::task& task)
+    {
+      ETL_ASSERT(task_count < max_tasks, ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+
+      if (task_count < max_tasks)
+      {
+        // Find the insertion point, in descending priority order.
+        size_t index = 0U;
+
+        while ((index < task_count) && (p_entries[index].p_task->get_task_priority() >= task.get_task_priority()))
+        {
+          ++index;
+        }
+
+        for (size_t i = task_count; i > index; --i)
+        {
+          p_entries[i].p_task = p_entries[i - 1U].p_task;
+        }
+
+        p_entries[index].p_task = &task;
+        ++task_count;
+
+        for (size_t i = 0U; i < task_count; ++i)
+        {
+          p_entries[i].claimed.store(false);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Add a task list.
+    /// Adds to the tasks to the internal task list in priority order.
+    /// Input order is ignored.
+    //*******************************************
+    template <typename TSize>
+    void add_task_list(etl::task** p_tasks, TSize size)
+    {
+      for (TSize i = 0; i < size; ++i)
+      {
+        ETL_ASSERT((p_tasks[i] != nullptr), ETL_ERROR(etl::scheduler_null_task_exception));
+        add_task(*(p_tasks[i]));
+      }
+    }
+
+    //*******************************************
+    /// Run a worker until exit_scheduler() is called.
+    /// Call from the thread dedicated to the worker.
+    //*******************************************
+    void worker(size_t index)
+    {
+      ETL_ASSERT(task_count > 0U, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      scheduler_running.store(true);
+
+      while (!scheduler_exit.load())
+      {
+        if (scheduler_running.load())
+        {
+          run_once(index);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Run one pass of a worker.
+    /// Processes at most one task.
+    /// Returns true if the worker was idle.
+    //*******************************************
+    bool run_once(size_t index)
+    {
+      ETL_ASSERT(index < workers, ETL_ERROR(etl::parallel_scheduler_worker_index_exception));
+
+      if (index >= workers)
+      {
+        return true;
+      }
+
+      deque_t&   deque    = *p_deques[index];
+      counters&  counter  = p_counters[index];
+      task_entry* p_entry = nullptr;
+
+      bool found = deque.pop(p_entry);
+
+      if (!found)
+      {
+        claim_tasks(deque);
+        found = deque.pop(p_entry);
+      }
+
+      if (!found)
+      {
+        found = steal(index, p_entry);
+
+        if (found)
+        {
+          counter.steal_count.fetch_add(1U, etl::memory_order_relaxed);
+        }
+      }
+
+      if (found)
+      {
+        p_entry->p_task->task_process_work();
+        p_entry->claimed.store(false, etl::memory_order_release);
+        counter.busy_count.fetch_add(1U, etl::memory_order_relaxed);
+      }
+      else
+      {
+        counter.idle_count.fetch_add(1U, etl::memory_order_relaxed);
+      }
+
+      if (p_watchdog_callback)
+      {
+        (*p_watchdog_callback)(index);
+      }
+
+      if (!found && p_idle_callback)
+      {
+        (*p_idle_callback)(index);
+      }
+
+      return !found;
+    }
+
+    //*******************************************
+    /// Get the statistics for a worker.
+    //*******************************************
+    etl::parallel_scheduler_statistics get_statistics(size_t index) const
+    {
+      ETL_ASSERT(index < workers, ETL_ERROR(etl::parallel_scheduler_worker_index_exception));
+
+      etl::parallel_scheduler_statistics statistics = { 0U, 0U, 0U };
+
+      if (index < workers)
+      {
+        statistics.busy_count  = p_counters[index].busy_count.load(etl::memory_order_relaxed);
+        statistics.idle_count  = p_counters[index].idle_count.load(etl::memory_order_relaxed);
+        statistics.steal_count = p_counters[index].steal_count.load(etl::memory_order_relaxed);
+      }
+
+      return statistics;
+    }
+
+    //*******************************************
+    /// Get the utilisation of a worker, as a percentage of its passes that
+    /// processed a task.
+    //*******************************************
+    uint32_t get_utilisation(size_t index) const
+    {
+      const etl::parallel_scheduler_statistics statistics = get_statistics(index);
+
+      const uint64_t passes = uint64_t(statistics.busy_count) + statistics.idle_count;
+
+      return (passes == 0U) ? 0U : uint32_t((uint64_t(statistics.busy_count) * 100U) / passes);
+    }
+
+    //*******************************************
+    /// Clear the statistics for all workers.
+    //*******************************************
+    void clear_statistics()
+    {
+      for (size_t i = 0U; i < workers; ++i)
+      {
+        p_counters[i].busy_count.store(0U, etl::memory_order_relaxed);
+        p_counters[i].idle_count.store(0U, etl::memory_order_relaxed);
+        p_counters[i].steal_count.store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// The number of workers.
+    //*******************************************
+    size_t number_of_workers() const
+    {
+      return workers;
+    }
+
+    //*******************************************
+    /// The number of tasks.
+    //*******************************************
+    size_t number_of_tasks() const
+    {
+      return task_count;
+    }
+
+  protected:
+
+    //*******************************************
+    /// A task and whether a worker has claimed it.
+    //*******************************************
+    struct task_entry
+    {
+      etl::task*        p_task;
+      etl::atomic<bool> claimed;
+    };
+
+    //*******************************************
+    /// The per worker counters.
+    //*******************************************
+    struct counters
+    {
+      etl::atomic<uint32_t> busy_count;
+      etl::atomic<uint32_t> idle_count;
+      etl::atomic<uint32_t> steal_count;
+#if ETL_CACHE_LINE_SIZE > 0
+      char padding[ETL_CACHE_LINE_SIZE];
+#endif
+    };
+
+    typedef etl::iwork_stealing_deque<task_entry*> deque_t;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    iparallel_scheduler(task_entry* p_entries_, size_t max_tasks_, deque_t** p_deques_, counters* p_counters_, size_t workers_)
+      : p_idle_callback(nullptr),
+        p_watchdog_callback(nullptr),
+        p_entries(p_entries_),
+        max_tasks(max_tasks_),
+        task_count(0U),
+        p_deques(p_deques_),
+        p_counters(p_counters_),
+        workers(workers_)
+    {
+    }
+
+    //*******************************************
+    /// Initialise the state held in the derived class.
+    //*******************************************
+    void initialise()
+    {
+      scheduler_running.store(false);
+      scheduler_exit.store(false);
+      clear_statistics();
+    }
+
+  private:
+
+    //*******************************************
+    /// Claim the unclaimed tasks that have work.
+    /// They are pushed lowest priority first, so that the highest
+    /// priority task is popped first.
+    //*******************************************
+    void claim_tasks(deque_t& deque)
+    {
+      for (size_t i = task_count; i > 0U; --i)
+      {
+        task_entry& entry = p_entries[i - 1U];
+
+        if (!entry.claimed.load(etl::memory_order_relaxed) && (entry.p_task->task_request_work() > 0U))
+        {
+          bool expected = false;
+
+          if (entry.claimed.compare_exchange_strong(expected, true, etl::memory_order_acquire))
+          {
+            if (!deque.push(&entry))
+            {
+              entry.claimed.store(false, etl::memory_order_release);
+            }
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Try to steal a task from the other workers.
+    //*******************************************
+    bool steal(size_t index, task_entry*& p_entry)
+    {
+      for (size_t offset = 1U; offset < workers; ++offset)
+      {
+        const size_t victim = (index + offset) % workers;
+
+        if (p_deques[victim]->steal(p_entry))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // Disable copy construction and assignment.
+    iparallel_scheduler(const iparallel_scheduler&) ETL_DELETE;
+    iparallel_scheduler& operator =(const iparallel_scheduler&) ETL_DELETE;
+
+    etl::atomic<bool>       scheduler_running;
+    etl::atomic<bool>       scheduler_exit;
+    etl::ifunction<size_t>* p_idle_callback;
+    etl::ifunction<size_t>* p_watchdog_callback;
+    task_entry*             p_entries;
+    const size_t            max_tasks;
+    size_t                  task_count;
+    deque_t**               p_deques;
+    counters*               p_counters;
+    const size_t            workers;
+  };
+
+  //***************************************************************************
+  /// Parallel scheduler.
+  ///\tparam MAX_TASKS_ The maximum number of tasks.
+  ///\tparam WORKERS_   The number of worker threads.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t WORKERS_>
+  class parallel_scheduler : public etl::iparallel_scheduler
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TASKS_ > 0U, "Must have at least one task");
+    ETL_STATIC_ASSERT(WORKERS_ > 0U, "Must have at least one worker");
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+      WORKERS   = WORKERS_
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    parallel_scheduler()
+      : iparallel_scheduler(entries, MAX_TASKS, deque_list, worker_counters, WORKERS)
+    {
+      for (size_t i = 0U; i < WORKERS; ++i)
+      {
+        deque_list[i] = &deques[i];
+      }
+
+      this->initialise();
+    }
+
+  private:
+
+    // Each task is in at most one deque, so each deque must be able to hold them all.
+    typedef etl::work_stealing_deque<task_entry*, etl::power_of_2_round_up<MAX_TASKS>::value> worker_deque_t;
+
+    task_entry     entries[MAX_TASKS];
+    worker_deque_t deques[WORKERS];
+    deque_t*       deque_list[WORKERS];
+    counters       worker_counters[WORKERS];
+  };
+}
+
+#endif
+
+#undef ETL_FILE
+
+#endif
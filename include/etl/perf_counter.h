@@ -0,0 +1,537 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERF_COUNTER_INCLUDED
+#define ETL_PERF_COUNTER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+///\defgroup perf_counter perf_counter
+/// Named event counters and histograms for instrumenting hot paths in
+/// production code.
+/// Each metric is split into shards, one per core or thread, each on its own
+/// cache line, so concurrent writers do not contend. Writes are relaxed atomic
+/// adds. Readers sum the shards without locking, so a snapshot taken while
+/// writers are active is approximate but never torn.
+/// Metrics may be added to an etl::perf_registry, which can be walked to export
+/// them, for example as Prometheus text.
+///\ingroup utilities
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+/// The type of the counts. Defaults to uint32_t, which every target supports
+/// atomically. Define as uint64_t where 64 bit atomics are available.
+//*****************************************************************************
+#if !defined(ETL_PERF_COUNTER_TYPE)
+  #define ETL_PERF_COUNTER_TYPE uint32_t
+#endif
+
+//*****************************************************************************
+/// The default number of shards.
+//*****************************************************************************
+#if !defined(ETL_PERF_COUNTER_SHARDS)
+  #define ETL_PERF_COUNTER_SHARDS 1
+#endif
+
+//*****************************************************************************
+/// Selects the shard written to when one is not given. Define as an
+/// expression returning the current core or thread index.
+//*****************************************************************************
+#if !defined(ETL_PERF_COUNTER_SHARD)
+  #define ETL_PERF_COUNTER_SHARD() 0U
+#endif
+
+//*****************************************************************************
+/// Instrumentation hooks, compiled in when ETL_PERF_COUNTERS is defined.
+//*****************************************************************************
+#if defined(ETL_PERF_COUNTERS)
+  #define ETL_PERF_COUNTER_INCREMENT(counter)         (counter).increment()
+  #define ETL_PERF_COUNTER_ADD(counter, n)            (counter).add(n)
+  #define ETL_PERF_HISTOGRAM_RECORD(histogram, value) (histogram).record(value)
+#else
+  #define ETL_PERF_COUNTER_INCREMENT(counter)
+  #define ETL_PERF_COUNTER_ADD(counter, n)
+  #define ETL_PERF_HISTOGRAM_RECORD(histogram, value)
+#endif
+
+namespace etl
+{
+  namespace private_perf_counter
+  {
+    //*************************************************************************
+    /// The number of atomics in each shard, rounded up to whole cache lines.
+    //*************************************************************************
+    template <typename TAtomic, const size_t COUNT>
+    struct shard_stride
+    {
+#if ETL_CACHE_LINE_SIZE > 0
+      static const size_t bytes      = COUNT * sizeof(TAtomic);
+      static const size_t line_bytes = ((bytes + ETL_CACHE_LINE_SIZE - 1U) / ETL_CACHE_LINE_SIZE) * ETL_CACHE_LINE_SIZE;
+      static const size_t value      = (line_bytes + sizeof(TAtomic) - 1U) / sizeof(TAtomic);
+#else
+      static const size_t value = COUNT;
+#endif
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// The base of all metrics.
+  //***************************************************************************
+  class iperf_metric
+  {
+  public:
+
+    typedef ETL_PERF_COUNTER_TYPE value_type;
+    typedef size_t                size_type;
+
+    enum kind_type
+    {
+      COUNTER,
+      HISTOGRAM
+    };
+
+    //*************************************************************************
+    /// The name given on construction.
+    //*************************************************************************
+    const char* name() const
+    {
+      return metric_name;
+    }
+
+    //*************************************************************************
+    /// Whether this is an iperf_counter or an iperf_histogram.
+    //*************************************************************************
+    kind_type kind() const
+    {
+      return metric_kind;
+    }
+
+    //*************************************************************************
+    /// The next metric in the registry, or nullptr.
+    //*************************************************************************
+    const iperf_metric* next() const
+    {
+      return p_next;
+    }
+
+    //*************************************************************************
+    /// The number of shards.
+    //*************************************************************************
+    size_type shards() const
+    {
+      return n_shards;
+    }
+
+  protected:
+
+    typedef etl::atomic<value_type> atomic_type;
+
+    iperf_metric(const char* name_, kind_type kind_, atomic_type* p_atomics_, size_type n_shards_, size_type stride_)
+      : metric_name(name_)
+      , metric_kind(kind_)
+      , p_next(nullptr)
+      , p_atomics(p_atomics_)
+      , n_shards(n_shards_)
+      , stride(stride_)
+    {
+    }
+
+    ~iperf_metric()
+    {
+    }
+
+    //*************************************************************************
+    /// The atomic at 'index' in the shard.
+    //*************************************************************************
+    atomic_type& at(size_type shard, size_type index) const
+    {
+      return p_atomics[((shard % n_shards) * stride) + index];
+    }
+
+    //*************************************************************************
+    /// The sum of the atomic at 'index' across all shards.
+    //*************************************************************************
+    value_type sum_shards(size_type index) const
+    {
+      value_type total = 0U;
+
+      for (size_type shard = 0U; shard < n_shards; ++shard)
+      {
+        total += at(shard, index).load(etl::memory_order_relaxed);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Sets every atomic to zero.
+    //*************************************************************************
+    void clear_shards()
+    {
+      for (size_type i = 0U; i < (n_shards * stride); ++i)
+      {
+        p_atomics[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    friend class perf_registry;
+
+    // Disabled.
+    iperf_metric(const iperf_metric&);
+    iperf_metric& operator =(const iperf_metric&);
+
+    const char*     metric_name;
+    const kind_type metric_kind;
+    iperf_metric*   p_next;
+    atomic_type*    p_atomics;
+    const size_type n_shards;
+    const size_type stride;
+  };
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// The interface to a counter of any number of shards.
+  //***************************************************************************
+  class iperf_counter : public iperf_metric
+  {
+  public:
+
+    //*************************************************************************
+    /// Adds one to the counter.
+    //*************************************************************************
+    void increment()
+    {
+      at(ETL_PERF_COUNTER_SHARD(), 0U).fetch_add(1U, etl::memory_order_relaxed);
+    }
+
+    void increment(size_type shard)
+    {
+      at(shard, 0U).fetch_add(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Adds n to the counter.
+    //*************************************************************************
+    void add(value_type n)
+    {
+      at(ETL_PERF_COUNTER_SHARD(), 0U).fetch_add(n, etl::memory_order_relaxed);
+    }
+
+    void add(value_type n, size_type shard)
+    {
+      at(shard, 0U).fetch_add(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The total over all shards.
+    //*************************************************************************
+    value_type value() const
+    {
+      return sum_shards(0U);
+    }
+
+    //*************************************************************************
+    /// The count in one shard.
+    //*************************************************************************
+    value_type value(size_type shard) const
+    {
+      return at(shard, 0U).load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Sets the counter to zero. Not atomic with respect to writers.
+    //*************************************************************************
+    void reset()
+    {
+      clear_shards();
+    }
+
+  protected:
+
+    iperf_counter(const char* name_, atomic_type* p_atomics_, size_type n_shards_, size_type stride_)
+      : iperf_metric(name_, COUNTER, p_atomics_, n_shards_, stride_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// A counter.
+  ///\tparam SHARDS The number of shards. Each occupies a cache line.
+  //***************************************************************************
+  template <const size_t SHARDS = ETL_PERF_COUNTER_SHARDS>
+  class perf_counter : public etl::iperf_counter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(SHARDS > 0U, "perf_counter must have at least one shard");
+
+    static const size_t MAX_SHARDS = SHARDS;
+
+    //*************************************************************************
+    /// Constructor. The name must remain valid for the life of the counter.
+    //*************************************************************************
+    explicit perf_counter(const char* name_)
+      : iperf_counter(name_, atomics, SHARDS, STRIDE)
+    {
+      reset();
+    }
+
+  private:
+
+    static const size_t STRIDE = private_perf_counter::shard_stride<atomic_type, 1U>::value;
+
+    atomic_type atomics[SHARDS * STRIDE];
+  };
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// The interface to a histogram of any number of buckets and shards.
+  /// Bucket i counts the values <= bound(i) and > bound(i - 1).
+  /// The last bucket, at index bounds(), counts the values above every bound.
+  //***************************************************************************
+  class iperf_histogram : public iperf_metric
+  {
+  public:
+
+    //*************************************************************************
+    /// Records a value.
+    //*************************************************************************
+    void record(value_type value)
+    {
+      record(value, ETL_PERF_COUNTER_SHARD());
+    }
+
+    void record(value_type value, size_type shard)
+    {
+      size_type bucket = 0U;
+
+      while ((bucket < n_bounds) && (value > p_bounds[bucket]))
+      {
+        ++bucket;
+      }
+
+      at(shard, bucket).fetch_add(1U, etl::memory_order_relaxed);
+      at(shard, n_bounds + 1U).fetch_add(value, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of bounds. There are bounds() + 1 buckets.
+    //*************************************************************************
+    size_type bounds() const
+    {
+      return n_bounds;
+    }
+
+    //*************************************************************************
+    /// The upper bound of bucket i.
+    //*************************************************************************
+    value_type bound(size_type i) const
+    {
+      return p_bounds[i];
+    }
+
+    //*************************************************************************
+    /// The count in bucket i, over all shards. Not cumulative.
+    //*************************************************************************
+    value_type bucket(size_type i) const
+    {
+      return sum_shards(i);
+    }
+
+    //*************************************************************************
+    /// The number of values recorded.
+    //*************************************************************************
+    value_type count() const
+    {
+      value_type total = 0U;
+
+      for (size_type i = 0U; i <= n_bounds; ++i)
+      {
+        total += bucket(i);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// The sum of the values recorded.
+    //*************************************************************************
+    value_type sum() const
+    {
+      return sum_shards(n_bounds + 1U);
+    }
+
+    //*************************************************************************
+    /// Sets every bucket to zero. Not atomic with respect to writers.
+    //*************************************************************************
+    void reset()
+    {
+      clear_shards();
+    }
+
+  protected:
+
+    iperf_histogram(const char* name_, const value_type* p_bounds_, size_type n_bounds_, atomic_type* p_atomics_, size_type n_shards_, size_type stride_)
+      : iperf_metric(name_, HISTOGRAM, p_atomics_, n_shards_, stride_)
+      , p_bounds(p_bounds_)
+      , n_bounds(n_bounds_)
+    {
+    }
+
+  private:
+
+    const value_type* p_bounds;
+    const size_type   n_bounds;
+  };
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// A histogram.
+  ///\tparam BOUNDS The number of bucket upper bounds. There is one more bucket
+  ///               for values above the last bound.
+  ///\tparam SHARDS The number of shards.
+  //***************************************************************************
+  template <const size_t BOUNDS, const size_t SHARDS = ETL_PERF_COUNTER_SHARDS>
+  class perf_histogram : public etl::iperf_histogram
+  {
+  public:
+
+    ETL_STATIC_ASSERT(BOUNDS > 0U, "perf_histogram must have at least one bound");
+    ETL_STATIC_ASSERT(SHARDS > 0U, "perf_histogram must have at least one shard");
+
+    static const size_t MAX_BOUNDS = BOUNDS;
+    static const size_t MAX_SHARDS = SHARDS;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The bounds must be in ascending order. They are copied.
+    /// The name must remain valid for the life of the histogram.
+    //*************************************************************************
+    perf_histogram(const char* name_, const value_type (&bounds_)[BOUNDS])
+      : iperf_histogram(name_, upper_bounds, BOUNDS, atomics, SHARDS, STRIDE)
+    {
+      for (size_t i = 0U; i < BOUNDS; ++i)
+      {
+        upper_bounds[i] = bounds_[i];
+      }
+
+      reset();
+    }
+
+  private:
+
+    // The buckets, then the sum.
+    static const size_t STRIDE = private_perf_counter::shard_stride<atomic_type, BOUNDS + 2U>::value;
+
+    value_type  upper_bounds[BOUNDS];
+    atomic_type atomics[SHARDS * STRIDE];
+  };
+
+  //***************************************************************************
+  ///\ingroup perf_counter
+  /// A list of metrics for export.
+  /// Metrics may be added from any thread, without locks. They cannot be
+  /// removed, so must outlive the registry's readers.
+  //***************************************************************************
+  class perf_registry
+  {
+  public:
+
+    perf_registry()
+      : head(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a metric. Each metric may be added to one registry, once.
+    //*************************************************************************
+    void add(iperf_metric& metric)
+    {
+      iperf_metric* p_head = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        metric.p_next = p_head;
+      } while (!head.compare_exchange_weak(p_head, &metric, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// The most recently added metric, or nullptr.
+    /// Follow iperf_metric::next() for the others.
+    //*************************************************************************
+    const iperf_metric* first() const
+    {
+      return head.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Calls visitor(const etl::iperf_counter&) or
+    /// visitor(const etl::iperf_histogram&) for each metric.
+    //*************************************************************************
+    template <typename TVisitor>
+    void for_each(TVisitor& visitor) const
+    {
+      for (const iperf_metric* p_metric = first(); p_metric != nullptr; p_metric = p_metric->next())
+      {
+        if (p_metric->kind() == iperf_metric::COUNTER)
+        {
+          visitor(static_cast<const iperf_counter&>(*p_metric));
+        }
+        else
+        {
+          visitor(static_cast<const iperf_histogram&>(*p_metric));
+        }
+      }
+    }
+
+  private:
+
+    // Disabled.
+    perf_registry(const perf_registry&);
+    perf_registry& operator =(const perf_registry&);
+
+    mutable etl::atomic<iperf_metric*> head;
+  };
+}
+
+#endif // ETL_HAS_ATOMIC
+
+#endif
@@ -0,0 +1,476 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERFECT_HASH_MAP_INCLUDED
+#define ETL_PERFECT_HASH_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "string_view.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#if ETL_CPP11_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "69"
+
+//*****************************************************************************
+///\defgroup perfect_hash_map perfect_hash_map
+/// A read only map, built from a fixed list of keys, that uses a minimal
+/// perfect hash. Each key is hashed once and each lookup makes one key
+/// comparison.
+/// The table is built by 'hash and displace': keys are grouped into buckets
+/// by their hash and each bucket is given a displacement that sends all of
+/// its keys to free slots. A lookup reads the bucket's displacement and goes
+/// straight to the slot.
+/// On C++14 and above the map may be declared 'constexpr', in which case the
+/// table is built by the compiler and may be placed in read only memory.
+/// Duplicate keys are a compile error in a constant expression and raise
+/// perfect_hash_map_duplicate_key at run time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for perfect_hash_map exceptions.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  class perfect_hash_map_exception : public exception
+  {
+  public:
+
+    perfect_hash_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when 'at' is called with a key not in the map.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  class perfect_hash_map_out_of_range : public perfect_hash_map_exception
+  {
+  public:
+
+    perfect_hash_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : perfect_hash_map_exception(ETL_ERROR_TEXT("perfect_hash_map:range", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the key list contains a duplicate.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  class perfect_hash_map_duplicate_key : public perfect_hash_map_exception
+  {
+  public:
+
+    perfect_hash_map_duplicate_key(string_type file_name_, numeric_type line_number_)
+      : perfect_hash_map_exception(ETL_ERROR_TEXT("perfect_hash_map:duplicate", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_perfect_hash
+  {
+    //*************************************************************************
+    /// 64 bit finaliser. Spreads every input bit over the whole result.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 uint64_t mix(uint64_t value)
+    {
+      value ^= value >> 33;
+      value *= 0xFF51AFD7ED558CCDULL;
+      value ^= value >> 33;
+      value *= 0xC4CEB9FE1A85EC53ULL;
+      value ^= value >> 33;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Maps the top 32 bits of a hash on to [0, n) without a division.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t reduce(uint64_t hash, size_t n)
+    {
+      return size_t(((hash >> 32) * uint64_t(n)) >> 32);
+    }
+
+    //*************************************************************************
+    /// The slot for a key hash, given its bucket's displacement.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t slot(uint64_t hash, uint32_t displacement, size_t n)
+    {
+      return reduce(mix(hash ^ (uint64_t(displacement) * 0x9E3779B97F4A7C15ULL)), n);
+    }
+
+    //*************************************************************************
+    /// FNV-1a over a character sequence.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint64_t fnv_1a(const T* text, size_t length)
+    {
+      uint64_t hash = 0xCBF29CE484222325ULL;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        hash ^= uint64_t(text[i]);
+        hash *= 0x00000100000001B3ULL;
+      }
+
+      return hash;
+    }
+  }
+
+  //***************************************************************************
+  /// Hash and equality for perfect_hash_map keys.
+  /// The default handles integral and enum keys.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  template <typename TKey>
+  struct perfect_hash_traits
+  {
+    static ETL_CONSTEXPR14 uint64_t hash(const TKey& key)
+    {
+      return private_perfect_hash::mix(static_cast<uint64_t>(key));
+    }
+
+    static ETL_CONSTEXPR14 bool equal(const TKey& lhs, const TKey& rhs)
+    {
+      return lhs == rhs;
+    }
+  };
+
+  //***************************************************************************
+  /// Null terminated string keys. Compared by content.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  template <>
+  struct perfect_hash_traits<const char*>
+  {
+    static ETL_CONSTEXPR14 uint64_t hash(const char* key)
+    {
+      size_t length = 0U;
+
+      while (key[length] != 0)
+      {
+        ++length;
+      }
+
+      return private_perfect_hash::mix(private_perfect_hash::fnv_1a(key, length));
+    }
+
+    static ETL_CONSTEXPR14 bool equal(const char* lhs, const char* rhs)
+    {
+      while ((*lhs != 0) && (*lhs == *rhs))
+      {
+        ++lhs;
+        ++rhs;
+      }
+
+      return (*lhs == *rhs);
+    }
+  };
+
+  //***************************************************************************
+  /// String view keys. Compared by content.
+  /// May only be used in constant expressions from C++17.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  struct perfect_hash_traits<etl::basic_string_view<T, TTraits> >
+  {
+    typedef etl::basic_string_view<T, TTraits> key_type;
+
+    static ETL_CONSTEXPR14 uint64_t hash(const key_type& key)
+    {
+      return private_perfect_hash::mix(private_perfect_hash::fnv_1a(key.data(), key.size()));
+    }
+
+    static ETL_CONSTEXPR14 bool equal(const key_type& lhs, const key_type& rhs)
+    {
+      if (lhs.size() != rhs.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < lhs.size(); ++i)
+      {
+        if (lhs.data()[i] != rhs.data()[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+  };
+
+  //***************************************************************************
+  /// A read only map with a minimal perfect hash.
+  ///\tparam TKey    The key type.
+  ///\tparam TMapped The mapped type. Must be default constructible.
+  ///\tparam N       The number of entries.
+  ///\tparam TTraits Supplies 'hash' and 'equal' for the key type.
+  ///\ingroup perfect_hash_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t N, typename TTraits = etl::perfect_hash_traits<TKey> >
+  class perfect_hash_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N > 0U, "perfect_hash_map must have at least one entry");
+
+    typedef TKey    key_type;
+    typedef TMapped mapped_type;
+    typedef size_t  size_type;
+
+    //*************************************************************************
+    /// An entry in the map.
+    //*************************************************************************
+    struct value_type
+    {
+      key_type    first;
+      mapped_type second;
+    };
+
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+
+    static const size_t MAX_SIZE = N;
+    static const size_t BUCKETS  = (N + 1U) / 2U;
+
+    //*************************************************************************
+    /// Builds the map from a list of entries.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit perfect_hash_map(const value_type (&list)[N])
+      : entries()
+      , displacement()
+    {
+      uint64_t hashes[N]            = {};
+      size_t   bucket_size[BUCKETS] = {};
+      size_t   start[BUCKETS + 1U]  = {};
+      size_t   members[N]           = {};
+      bool     used[N]              = {};
+      size_t   largest              = 0U;
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        hashes[i] = TTraits::hash(list[i].first);
+        ++bucket_size[private_perfect_hash::reduce(hashes[i], BUCKETS)];
+      }
+
+      // Lay the members of each bucket out contiguously.
+      for (size_t b = 0U; b < BUCKETS; ++b)
+      {
+        start[b + 1U] = start[b] + bucket_size[b];
+        largest       = (bucket_size[b] > largest) ? bucket_size[b] : largest;
+      }
+
+      {
+        size_t fill[BUCKETS] = {};
+
+        for (size_t i = 0U; i < N; ++i)
+        {
+          const size_t b = private_perfect_hash::reduce(hashes[i], BUCKETS);
+          members[start[b] + fill[b]] = i;
+          ++fill[b];
+        }
+      }
+
+      // Place the largest buckets first, while there are most free slots.
+      for (size_t s = largest; s > 0U; --s)
+      {
+        for (size_t b = 0U; b < BUCKETS; ++b)
+        {
+          if (bucket_size[b] == s)
+          {
+            place_bucket(list, hashes, members + start[b], s, used, b);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the entry for a key.
+    ///\return An iterator to the entry, or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const
+    {
+      const uint64_t hash   = TTraits::hash(key);
+      const size_t   bucket = private_perfect_hash::reduce(hash, BUCKETS);
+      const size_t   index  = private_perfect_hash::slot(hash, displacement[bucket], N);
+
+      return TTraits::equal(entries[index].first, key) ? &entries[index] : end();
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Gets the value for a key.
+    /// Emits perfect_hash_map_out_of_range if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(perfect_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Iterators over the entries, in slot order.
+    //*************************************************************************
+    ETL_CONSTEXPR const_iterator begin() const
+    {
+      return entries;
+    }
+
+    ETL_CONSTEXPR const_iterator cbegin() const
+    {
+      return entries;
+    }
+
+    ETL_CONSTEXPR const_iterator end() const
+    {
+      return entries + N;
+    }
+
+    ETL_CONSTEXPR const_iterator cend() const
+    {
+      return entries + N;
+    }
+
+    //*************************************************************************
+    /// The number of entries.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type size() const
+    {
+      return N;
+    }
+
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return N;
+    }
+
+    ETL_CONSTEXPR bool empty() const
+    {
+      return false;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds a displacement that sends every key in the bucket to a free slot.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void place_bucket(const value_type (&list)[N],
+                                      const uint64_t (&hashes)[N],
+                                      const size_t* bucket_members,
+                                      size_t        bucket_size,
+                                      bool          (&used)[N],
+                                      size_t        bucket)
+    {
+      // Keys with the same hash can never be separated.
+      for (size_t i = 0U; i < bucket_size; ++i)
+      {
+        for (size_t j = i + 1U; j < bucket_size; ++j)
+        {
+          if (hashes[bucket_members[i]] == hashes[bucket_members[j]])
+          {
+            ETL_ALWAYS_ASSERT(ETL_ERROR(perfect_hash_map_duplicate_key));
+            return;
+          }
+        }
+      }
+
+      for (uint32_t d = 0U; ; ++d)
+      {
+        size_t placed = 0U;
+
+        while (placed < bucket_size)
+        {
+          const size_t index = private_perfect_hash::slot(hashes[bucket_members[placed]], d, N);
+
+          if (used[index])
+          {
+            break;
+          }
+
+          used[index] = true;
+          ++placed;
+        }
+
+        if (placed == bucket_size)
+        {
+          displacement[bucket] = d;
+
+          for (size_t i = 0U; i < bucket_size; ++i)
+          {
+            const size_t member = bucket_members[i];
+            entries[private_perfect_hash::slot(hashes[member], d, N)] = list[member];
+          }
+
+          return;
+        }
+
+        // Release the slots taken by this attempt.
+        while (placed > 0U)
+        {
+          --placed;
+          used[private_perfect_hash::slot(hashes[bucket_members[placed]], d, N)] = false;
+        }
+      }
+    }
+
+    value_type entries[N];
+    uint32_t   displacement[BUCKETS];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
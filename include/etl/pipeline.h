@@ -0,0 +1,438 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PIPELINE_INCLUDED
+#define ETL_PIPELINE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "queue_spsc_atomic.h"
+#include "memory_model.h"
+#include "task.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+//*****************************************************************************
+///\defgroup pipeline pipeline
+/// A chain of processing stages, connected by bounded etl::queue_spsc_atomic
+/// queues.
+/// Each stage is a functor declaring an input_type and an output_type, with
+/// a function call operator of the form
+///   bool operator()(const input_type& in, output_type& out);
+/// that returns false to drop the item.
+/// A stage consumes no more items than its output queue can accept, so a
+/// stalled stage fills its input queue and push() eventually fails; the
+/// back-pressure reaches the producer without anything being dropped.
+/// Stages are run with process<FIRST, LAST>(). The stages in the range are
+/// fused, passing items between them directly, so a range may be run on one
+/// thread while other ranges run on other threads. Each queue must have
+/// exactly one thread pushing to it and one thread popping from it.
+/// Items are transferred in batches of up to BATCH_SIZE, and the item types
+/// must be default constructible.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A convenience base for pipeline stages.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename TInput, typename TOutput>
+  struct pipeline_stage
+  {
+    typedef TInput  input_type;
+    typedef TOutput output_type;
+  };
+
+  namespace private_pipeline
+  {
+    //*************************************************************************
+    /// The stage at index I and the queue in front of it.
+    /// The last node holds only the output queue.
+    //*************************************************************************
+    template <size_t I, size_t QUEUE_SIZE, size_t MEMORY_MODEL, typename TOutput, typename... TStages>
+    struct node;
+
+    template <size_t I, size_t QUEUE_SIZE, size_t MEMORY_MODEL, typename TOutput, typename THead, typename... TTail>
+    struct node<I, QUEUE_SIZE, MEMORY_MODEL, TOutput, THead, TTail...> : public node<I + 1, QUEUE_SIZE, MEMORY_MODEL, TOutput, TTail...>
+    {
+      typedef node<I + 1, QUEUE_SIZE, MEMORY_MODEL, TOutput, TTail...>                  next_type;
+      typedef THead                                                                     stage_type;
+      typedef etl::queue_spsc_atomic<typename THead::input_type, QUEUE_SIZE, MEMORY_MODEL> queue_type;
+
+      ETL_STATIC_ASSERT((etl::is_same<typename THead::output_type, typename next_type::queue_type::value_type>::value), "Stage output type does not match the next stage input type");
+
+      stage_type stage;
+      queue_type queue;
+    };
+
+    template <size_t I, size_t QUEUE_SIZE, size_t MEMORY_MODEL, typename TOutput>
+    struct node<I, QUEUE_SIZE, MEMORY_MODEL, TOutput>
+    {
+      typedef etl::queue_spsc_atomic<TOutput, QUEUE_SIZE, MEMORY_MODEL> queue_type;
+
+      queue_type queue;
+    };
+
+    //*************************************************************************
+    /// Finds the node type at index I.
+    //*************************************************************************
+    template <size_t I, typename TNode>
+    struct node_at
+    {
+      typedef typename node_at<I - 1U, typename TNode::next_type>::type type;
+    };
+
+    template <typename TNode>
+    struct node_at<0U, TNode>
+    {
+      typedef TNode type;
+    };
+
+    //*************************************************************************
+    /// The output type of the last stage.
+    //*************************************************************************
+    template <typename... TStages>
+    struct last_output;
+
+    template <typename TStage>
+    struct last_output<TStage>
+    {
+      typedef typename TStage::output_type type;
+    };
+
+    template <typename THead, typename... TTail>
+    struct last_output<THead, TTail...>
+    {
+      typedef typename last_output<TTail...>::type type;
+    };
+
+    //*************************************************************************
+    /// Passes one item through the stages I to LAST inclusive.
+    //*************************************************************************
+    template <size_t I, size_t LAST, typename TRoot, bool IS_LAST = (I == LAST)>
+    struct chain
+    {
+      typedef typename node_at<I, TRoot>::type node_type;
+      typedef typename node_type::stage_type   stage_type;
+
+      template <typename TOut>
+      static bool run(TRoot& root, const typename stage_type::input_type& in, TOut& out)
+      {
+        typename stage_type::output_type intermediate;
+
+        return static_cast<node_type&>(root).stage(in, intermediate) &&
+               chain<I + 1U, LAST, TRoot>::run(root, intermediate, out);
+      }
+    };
+
+    template <size_t I, size_t LAST, typename TRoot>
+    struct chain<I, LAST, TRoot, true>
+    {
+      typedef typename node_at<I, TRoot>::type node_type;
+      typedef typename node_type::stage_type   stage_type;
+
+      static bool run(TRoot& root, const typename stage_type::input_type& in, typename stage_type::output_type& out)
+      {
+        return static_cast<node_type&>(root).stage(in, out);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A pipeline of stages connected by SPSC queues.
+  ///\tparam QUEUE_SIZE   The capacity of each queue.
+  ///\tparam BATCH_SIZE   The maximum number of items moved in one transfer.
+  ///\tparam TStages      The stage functor types, in order.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <size_t QUEUE_SIZE, size_t BATCH_SIZE, typename... TStages>
+  class pipeline
+  {
+  private:
+
+    ETL_STATIC_ASSERT(sizeof...(TStages) != 0U, "A pipeline requires at least one stage");
+    ETL_STATIC_ASSERT(BATCH_SIZE != 0U, "The batch size must not be zero");
+
+    // The smallest memory model that can index the queues.
+    static const size_t MEMORY_MODEL = (QUEUE_SIZE < 255U)   ? etl::memory_model::MEMORY_MODEL_SMALL :
+                                       (QUEUE_SIZE < 65535U) ? etl::memory_model::MEMORY_MODEL_MEDIUM :
+                                                               etl::memory_model::MEMORY_MODEL_LARGE;
+
+    typedef typename private_pipeline::last_output<TStages...>::type                           last_output_type;
+    typedef private_pipeline::node<0U, QUEUE_SIZE, MEMORY_MODEL, last_output_type, TStages...> root_type;
+
+  public:
+
+    static const size_t STAGES         = sizeof...(TStages);
+    static const size_t MAX_BATCH_SIZE = BATCH_SIZE;
+
+    /// The type of the stage at index I.
+    template <size_t I>
+    struct stage_type
+    {
+      ETL_STATIC_ASSERT(I < sizeof...(TStages), "Stage index out of range");
+      typedef typename private_pipeline::node_at<I, root_type>::type::stage_type type;
+    };
+
+    /// The type of the queue at index I.
+    /// Queue I is in front of stage I. Queue STAGES is the output queue.
+    template <size_t I>
+    struct queue_type
+    {
+      ETL_STATIC_ASSERT(I <= sizeof...(TStages), "Queue index out of range");
+      typedef typename private_pipeline::node_at<I, root_type>::type::queue_type type;
+    };
+
+    typedef typename stage_type<0U>::type::input_type input_type;
+    typedef last_output_type                          output_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    pipeline()
+    {
+    }
+
+    //*************************************************************************
+    /// Pushes an item to the input queue.
+    /// Returns false if the input queue is full.
+    //*************************************************************************
+    bool push(const input_type& value)
+    {
+      return input_queue().push(value);
+    }
+
+    //*************************************************************************
+    /// Pushes up to n items to the input queue.
+    /// Returns the number pushed.
+    //*************************************************************************
+    size_t push(const input_type* p_values, size_t n)
+    {
+      return input_queue().push(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Pops an item from the output queue.
+    /// Returns false if the output queue is empty.
+    //*************************************************************************
+    bool pop(output_type& value)
+    {
+      return output_queue().pop(value);
+    }
+
+    //*************************************************************************
+    /// Pops up to n items from the output queue.
+    /// Returns the number popped.
+    //*************************************************************************
+    size_t pop(output_type* p_values, size_t n)
+    {
+      return output_queue().pop(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Runs one batch through the stages FIRST to LAST inclusive.
+    /// Items are taken from queue FIRST and the results pushed to queue
+    /// LAST + 1. No more items are taken than queue LAST + 1 can accept.
+    /// Returns the number of items taken.
+    //*************************************************************************
+    template <size_t FIRST, size_t LAST = FIRST>
+    size_t process()
+    {
+      ETL_STATIC_ASSERT(FIRST <= LAST, "Empty stage range");
+      ETL_STATIC_ASSERT(LAST < sizeof...(TStages), "Stage index out of range");
+
+      typedef typename queue_type<FIRST>::type        in_queue_type;
+      typedef typename queue_type<LAST + 1U>::type    out_queue_type;
+      typedef typename in_queue_type::value_type      in_type;
+      typedef typename out_queue_type::value_type     out_type;
+
+      out_queue_type& out_queue = queue<LAST + 1U>();
+
+      size_t n = out_queue.available();
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      n = (n < BATCH_SIZE) ? n : BATCH_SIZE;
+
+      in_type  inputs[BATCH_SIZE];
+      out_type outputs[BATCH_SIZE];
+
+      const size_t count = queue<FIRST>().pop(inputs, n);
+
+      size_t produced = 0U;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (private_pipeline::chain<FIRST, LAST, root_type>::run(nodes, inputs[i], outputs[produced]))
+        {
+          ++produced;
+        }
+      }
+
+      // Cannot fail, as the space was checked before the items were taken.
+      out_queue.push(outputs, produced);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Runs batches through the stages FIRST to LAST until no more progress
+    /// can be made. Returns the number of items taken.
+    //*************************************************************************
+    template <size_t FIRST, size_t LAST = FIRST>
+    size_t drain()
+    {
+      size_t total = 0U;
+      size_t count;
+
+      while ((count = process<FIRST, LAST>()) != 0U)
+      {
+        total += count;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Gets the stage at index I.
+    //*************************************************************************
+    template <size_t I>
+    typename stage_type<I>::type& stage()
+    {
+      return static_cast<typename private_pipeline::node_at<I, root_type>::type&>(nodes).stage;
+    }
+
+    template <size_t I>
+    const typename stage_type<I>::type& stage() const
+    {
+      return static_cast<const typename private_pipeline::node_at<I, root_type>::type&>(nodes).stage;
+    }
+
+    //*************************************************************************
+    /// Gets the queue at index I.
+    //*************************************************************************
+    template <size_t I>
+    typename queue_type<I>::type& queue()
+    {
+      return static_cast<typename private_pipeline::node_at<I, root_type>::type&>(nodes).queue;
+    }
+
+    template <size_t I>
+    const typename queue_type<I>::type& queue() const
+    {
+      return static_cast<const typename private_pipeline::node_at<I, root_type>::type&>(nodes).queue;
+    }
+
+    //*************************************************************************
+    /// The input and output queues.
+    //*************************************************************************
+    typename queue_type<0U>::type& input_queue()
+    {
+      return queue<0U>();
+    }
+
+    typename queue_type<sizeof...(TStages)>::type& output_queue()
+    {
+      return queue<sizeof...(TStages)>();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    pipeline(const pipeline&) ETL_DELETE;
+    pipeline& operator =(const pipeline&) ETL_DELETE;
+
+    root_type nodes;
+  };
+
+  template <size_t QUEUE_SIZE, size_t BATCH_SIZE, typename... TStages>
+  const size_t pipeline<QUEUE_SIZE, BATCH_SIZE, TStages...>::STAGES;
+
+  template <size_t QUEUE_SIZE, size_t BATCH_SIZE, typename... TStages>
+  const size_t pipeline<QUEUE_SIZE, BATCH_SIZE, TStages...>::MAX_BATCH_SIZE;
+
+  //***************************************************************************
+  /// An etl::task that runs the stages FIRST to LAST of a pipeline, so that a
+  /// range of stages may be driven by an etl::scheduler.
+  /// The work score is the number of items waiting in queue FIRST.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename TPipeline, size_t FIRST, size_t LAST = FIRST>
+  class pipeline_task : public etl::task
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pipeline_task(TPipeline& pipeline_, etl::task_priority_t priority)
+      : task(priority)
+      , pl(pipeline_)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of items waiting.
+    //*************************************************************************
+    uint32_t task_request_work() const override
+    {
+      return uint32_t(pl.template queue<FIRST>().size());
+    }
+
+    //*************************************************************************
+    /// Runs one batch.
+    //*************************************************************************
+    void task_process_work() override
+    {
+      pl.template process<FIRST, LAST>();
+    }
+
+  private:
+
+    TPipeline& pl;
+  };
+}
+
+#endif
+
+#endif
@@ -59,6 +59,9 @@ SOFTWARE.
   #include "profiles/determine_compiler_language_support.h"
 #endif
 
+// Figure out which instruction set extensions are available.
+#include "profiles/determine_cpu_features.h"
+
 #if defined(ETL_FORCE_EXPLICIT_STRING_CONVERSION_FROM_CHAR)
 #define ETL_EXPLICIT_STRING_FROM_CHAR explicit
 #else
@@ -101,6 +104,84 @@ SOFTWARE.
   #define ETL_NODISCARD
 #endif
 
+// Hint that the memory at an address is about to be read.
+// May be defined in the profile, as the intrinsic for another compiler or
+// as nothing to disable prefetching.
+#if !defined(ETL_PREFETCH)
+  #if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    #define ETL_PREFETCH(address) __builtin_prefetch(address)
+  #else
+    #define ETL_PREFETCH(address)
+  #endif
+#endif
+
+// Hint to the CPU that the thread is spinning, waiting for another thread.
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))
+  #define ETL_CPU_PAUSE() __builtin_ia32_pause()
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+  #define ETL_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+  #define ETL_CPU_PAUSE()
+#endif
+
+// Hint the expected result of a condition, such as an error check.
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_LIKELY(b)   __builtin_expect(!!(b), 1)
+  #define ETL_UNLIKELY(b) __builtin_expect(!!(b), 0)
+#else
+  #define ETL_LIKELY(b)   (b)
+  #define ETL_UNLIKELY(b) (b)
+#endif
+
+// Marks a function that is rarely called, such as an error path, so that it
+// and the branches that lead to it are kept out of the hot code.
+// GCC is also told not to clone it, so that each error path has one copy, not one per translation unit.
+#if defined(ETL_COMPILER_GCC) && !defined(__clang__)
+  #define ETL_NOINLINE __attribute__((noinline, noclone))
+  #define ETL_COLD     __attribute__((cold))
+  #define ETL_NORETURN __attribute__((noreturn))
+#elif defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_NOINLINE __attribute__((noinline))
+  #define ETL_COLD     __attribute__((cold))
+  #define ETL_NORETURN __attribute__((noreturn))
+#elif defined(ETL_COMPILER_MICROSOFT)
+  #define ETL_NOINLINE __declspec(noinline)
+  #define ETL_COLD
+  #define ETL_NORETURN __declspec(noreturn)
+#else
+  #define ETL_NOINLINE
+  #define ETL_COLD
+  #define ETL_NORETURN
+#endif
+
+// Is the call being constant evaluated?
+// Only defined where the compiler can tell, so that a constexpr function may
+// use a faster run time path, such as memchr, that is not constexpr.
+#if defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+    #define ETL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #endif
+#endif
+
+#if !defined(ETL_IS_CONSTANT_EVALUATED) && defined(ETL_COMPILER_MICROSOFT) && defined(_MSC_VER) && (_MSC_VER >= 1925)
+  #define ETL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+// The size of a cache line, used to keep data shared between threads apart.
+// Define as 0 in the profile for targets without a data cache.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
+// Requires a variable with static storage to be constant initialised.
+// Only checked from C++20; earlier, a constexpr constructor gives the same
+// initialisation without the check.
+#if defined(__cpp_constinit)
+  #define ETL_CONSTINIT constinit
+#else
+  #define ETL_CONSTINIT
+#endif
+
 // Sort out namespaces for STL/No STL options.
 #include "private/choose_namespace.h"
 
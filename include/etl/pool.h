@@ -46,6 +46,7 @@ SOFTWARE.
 #include "nullptr.h"
 #include "alignment.h"
 #include "static_assert.h"
+#include "power.h"
 #include "algorithm.h"
 
 #undef ETL_FILE
@@ -113,6 +114,20 @@ namespace etl
     {}
   };
 
+  //***************************************************************************
+  /// A snapshot of the usage of a pool.
+  /// Only collected when ETL_POOL_STATISTICS is defined.
+  ///\ingroup pool
+  //***************************************************************************
+  struct pool_statistics
+  {
+    size_t   size;        ///< The number of items allocated.
+    size_t   max_size;    ///< The maximum number of items.
+    size_t   high_water;  ///< The largest number of items allocated at one time.
+    uint32_t allocations; ///< The number of successful allocations.
+    uint32_t failures;    ///< The number of allocations from an empty pool.
+  };
+
   //***************************************************************************
   ///\ingroup pool
   //***************************************************************************
@@ -259,6 +274,40 @@ namespace etl
       release_item((char*)p_object);
     }
 
+    //*************************************************************************
+    /// Allocate storage for up to n items.
+    /// Does not assert when the pool runs out.
+    /// \param p_items Where to store the item addresses.
+    /// \param n       The maximum number of items to allocate.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    size_t allocate_batch(void** p_items, size_t n)
+    {
+      size_t count = 0U;
+
+      while ((count < n) && !full())
+      {
+        p_items[count++] = allocate_item();
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release n items in the pool.
+    /// If asserts or exceptions are enabled and an item does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_items The item addresses.
+    /// \param n       The number of items to release.
+    //*************************************************************************
+    void release_batch(void* const* p_items, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        release_item(static_cast<char*>(p_items[i]));
+      }
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
     //*************************************************************************
@@ -296,6 +345,14 @@ namespace etl
       return MAX_SIZE;
     }
 
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t item_size() const
+    {
+      return ITEM_SIZE;
+    }
+
     //*************************************************************************
     /// Returns the number of free items in the pool.
     //*************************************************************************
@@ -330,18 +387,70 @@ namespace etl
       return items_allocated == MAX_SIZE;
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets a snapshot of the usage of the pool.
+    /// The statistics are kept across release_all().
+    //*************************************************************************
+    etl::pool_statistics get_statistics() const
+    {
+      etl::pool_statistics statistics;
+
+      statistics.size        = items_allocated;
+      statistics.max_size    = MAX_SIZE;
+      statistics.high_water  = items_high_water;
+      statistics.allocations = allocation_count;
+      statistics.failures    = failure_count;
+
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Records an allocation that failed because the pool was full.
+    /// For users of the pool that check full() rather than allocating.
+    //*************************************************************************
+    void record_failure()
+    {
+      ++failure_count;
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    /// The high water mark restarts from the current number of items.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      items_high_water = items_allocated;
+      allocation_count = 0U;
+      failure_count    = 0U;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
     /// Constructor
-    //*************************************************************************
-    ipool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+    /// \param items_per_stripe_ If more than one, consecutive items are taken
+    /// from consecutive stripes of this many items, rather than from
+    /// consecutive slots. The buffer must have room for a whole number of
+    /// stripes.
+    /// The free list is built as items are allocated, so a pool with a
+    /// constant buffer address may be constant initialised.
+    //*************************************************************************
+    ETL_CONSTEXPR ipool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_, uint32_t items_per_stripe_ = 1U)
       : p_buffer(p_buffer_),
         p_next(p_buffer_),
         items_allocated(0),
         items_initialised(0),
         ITEM_SIZE(item_size_),
-        MAX_SIZE(max_size_)
+        MAX_SIZE(max_size_),
+        ITEMS_PER_STRIPE(items_per_stripe_),
+        STRIPES((max_size_ + items_per_stripe_ - 1U) / items_per_stripe_)
+#if defined(ETL_POOL_STATISTICS)
+        , items_high_water(0)
+        , allocation_count(0U)
+        , failure_count(0U)
+#endif
     {
     }
 
@@ -360,8 +469,8 @@ namespace etl
         // Initialise another one if necessary.
         if (items_initialised < MAX_SIZE)
         {
-          char* p = p_buffer + (items_initialised * ITEM_SIZE);
-          char* np = p + ITEM_SIZE;
+          char* p = p_buffer + (slot(items_initialised) * ITEM_SIZE);
+          char* np = p_buffer + (slot(items_initialised + 1U) * ITEM_SIZE);
           *reinterpret_cast<char**>(p) = np;
           ++items_initialised;
         }
@@ -370,6 +479,16 @@ namespace etl
         p_value = p_next;
 
         ++items_allocated;
+
+#if defined(ETL_POOL_STATISTICS)
+        ++allocation_count;
+
+        if (items_allocated > items_high_water)
+        {
+          items_high_water = items_allocated;
+        }
+#endif
+
         if (items_allocated != MAX_SIZE)
         {
           // Set up the pointer to the next free item
@@ -383,6 +502,9 @@ namespace etl
       }
       else
       {
+#if defined(ETL_POOL_STATISTICS)
+        record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
@@ -413,6 +535,20 @@ namespace etl
       --items_allocated;
     }
 
+    //*************************************************************************
+    /// The slot of the nth item to be initialised.
+    /// When striped, consecutive items are a stripe apart.
+    //*************************************************************************
+    uint32_t slot(uint32_t n) const
+    {
+      if (ITEMS_PER_STRIPE == 1U)
+      {
+        return n;
+      }
+
+      return ((n % STRIPES) * ITEMS_PER_STRIPE) + (n / STRIPES);
+    }
+
     //*************************************************************************
     /// Check if the item belongs to this pool.
     //*************************************************************************
@@ -420,7 +556,7 @@ namespace etl
     {
       // Within the range of the buffer?
       intptr_t distance = p - p_buffer;
-      bool is_within_range = (distance >= 0) && (distance <= intptr_t((ITEM_SIZE * MAX_SIZE) - ITEM_SIZE));
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((ITEM_SIZE * STRIPES * ITEMS_PER_STRIPE) - ITEM_SIZE));
 
       // Modulus and division can be slow on some architectures, so only do this in debug.
 #if defined(ETL_DEBUG)
@@ -443,8 +579,16 @@ namespace etl
     uint32_t  items_allocated;   ///< The number of items allocated.
     uint32_t  items_initialised; ///< The number of items initialised.
 
-    const uint32_t ITEM_SIZE;    ///< The size of allocated items.
-    const uint32_t MAX_SIZE;    ///< The maximum number of objects that can be allocated.
+    const uint32_t ITEM_SIZE;        ///< The size of allocated items.
+    const uint32_t MAX_SIZE;         ///< The maximum number of objects that can be allocated.
+    const uint32_t ITEMS_PER_STRIPE; ///< The number of items in a stripe.
+    const uint32_t STRIPES;          ///< The number of stripes.
+
+#if defined(ETL_POOL_STATISTICS)
+    uint32_t items_high_water;  ///< The largest number of items allocated at one time.
+    uint32_t allocation_count;  ///< The number of successful allocations.
+    uint32_t failure_count;     ///< The number of allocations from an empty pool.
+#endif
 
     //*************************************************************************
     /// Destructor.
@@ -462,24 +606,88 @@ namespace etl
 #endif
   };
 
+  //*************************************************************************
+  /// The layout of the items in a pool.
+  /// Packed:     Items are contiguous.
+  /// Cache_Line: Each item is padded and aligned to ETL_CACHE_LINE_SIZE, so
+  ///             that no two items share a cache line.
+  /// Striped:    Items are aligned so that none straddle a cache line, and
+  ///             consecutive allocations are taken from different cache lines
+  ///             until every line has been used once.
+  /// If ETL_CACHE_LINE_SIZE is 0 then all layouts are the same as Packed.
+  ///\ingroup pool
+  //*************************************************************************
+  struct pool_layout
+  {
+    enum enum_type
+    {
+      Packed,
+      Cache_Line,
+      Striped
+    };
+  };
+
+  namespace private_pool
+  {
+    //*************************************************************************
+    /// Calculates the size and arrangement of the items for a layout.
+    //*************************************************************************
+    template <size_t ELEMENT_SIZE_, size_t SIZE_, int LAYOUT_>
+    struct layout
+    {
+      static const size_t LINE = ETL_CACHE_LINE_SIZE;
+
+      static const bool IS_ALIGNED = (LAYOUT_ != etl::pool_layout::Packed) && (LINE != 0U);
+
+      static const size_t LINE_ROUNDED = (LINE == 0U) ? ELEMENT_SIZE_ : ((ELEMENT_SIZE_ + LINE - 1U) / LINE) * LINE;
+
+      // Striped items are rounded up to a power of 2, so that a whole number fit in a line.
+      static const size_t ITEM_SIZE = !IS_ALIGNED                                ? ELEMENT_SIZE_ :
+                                      (LAYOUT_ == etl::pool_layout::Cache_Line)  ? LINE_ROUNDED :
+                                      (ELEMENT_SIZE_ >= LINE)                    ? LINE_ROUNDED :
+                                      size_t(etl::power_of_2_round_up<ELEMENT_SIZE_>::value);
+
+      static const size_t ITEMS_PER_STRIPE = ((LAYOUT_ == etl::pool_layout::Striped) && IS_ALIGNED && (ITEM_SIZE < LINE)) ? LINE / ITEM_SIZE : 1U;
+
+      static const size_t SLOTS = ((SIZE_ + ITEMS_PER_STRIPE - 1U) / ITEMS_PER_STRIPE) * ITEMS_PER_STRIPE;
+
+      // Room to align the start of the buffer to a cache line.
+      static const size_t BUFFER_SIZE = (SLOTS * ITEM_SIZE) + (IS_ALIGNED ? LINE : 0U);
+    };
+  }
+
   //*************************************************************************
   /// A templated abstract pool implementation that uses a fixed size pool.
+  ///\tparam LAYOUT_ The layout of the items. See etl::pool_layout.
   ///\ingroup pool
   //*************************************************************************
-  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_>
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_, int LAYOUT_ = etl::pool_layout::Packed>
   class generic_pool : public etl::ipool
   {
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char*     next;              ///< Pointer to the next free element.
+      char      value[TYPE_SIZE_]; ///< Storage for value type.
+      typename  etl::type_with_alignment<ALIGNMENT_>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    typedef private_pool::layout<sizeof(Element), SIZE_, LAYOUT_> layout_t;
+
   public:
 
     static const size_t SIZE      = SIZE_;
     static const size_t ALIGNMENT = ALIGNMENT_;
     static const size_t TYPE_SIZE = TYPE_SIZE_;
+    static const int    LAYOUT    = LAYOUT_;
 
     //*************************************************************************
     /// Constructor
     //*************************************************************************
-    generic_pool()
-      : etl::ipool(reinterpret_cast<char*>(&buffer[0]), ELEMENT_SIZE, SIZE)
+    ETL_CONSTEXPR generic_pool()
+      : etl::ipool(get_aligned_buffer(buffer.data), ELEMENT_SIZE, SIZE, layout_t::ITEMS_PER_STRIPE)
     {
     }
 
@@ -591,18 +799,44 @@ namespace etl
 
   private:
 
-    // The pool element.
-    union Element
+    //*************************************************************************
+    /// Gets the start of the buffer, aligned to a cache line if required by
+    /// the layout.
+    //*************************************************************************
+    static ETL_CONSTEXPR char* get_aligned_buffer(char* p)
     {
-      char*     next;              ///< Pointer to the next free element.
-      char      value[TYPE_SIZE_]; ///< Storage for value type.
-      typename  etl::type_with_alignment<ALIGNMENT_>::type dummy; ///< Dummy item to get correct alignment.
+      return layout_t::IS_ALIGNED ? align_to_line(p) : p;
+    }
+
+    //*************************************************************************
+    static char* align_to_line(char* p)
+    {
+      const uintptr_t mask = uintptr_t(layout_t::LINE - 1U);
+
+      return p + ((layout_t::LINE - (reinterpret_cast<uintptr_t>(p) & mask)) & mask);
+    }
+
+    static const size_t ELEMENTS = (layout_t::BUFFER_SIZE + sizeof(Element) - 1U) / sizeof(Element);
+
+    //*************************************************************************
+    /// The memory for the pool of objects.
+    /// A union, so that the address of 'data' is a constant expression.
+    //*************************************************************************
+    union storage_t
+    {
+      ETL_CONSTEXPR storage_t()
+        : unused()
+      {
+      }
+
+      char    unused;
+      char    data[ELEMENTS * sizeof(Element)];
+      Element elements[ELEMENTS]; ///< For the alignment.
     };
 
-    ///< The memory for the pool of objects.
-    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[SIZE];
+    storage_t buffer;
 
-    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+    static const uint32_t ELEMENT_SIZE = uint32_t(layout_t::ITEM_SIZE);
 
     // Should not be copied.
     generic_pool(const generic_pool&);
@@ -611,25 +845,27 @@ namespace etl
 
   //*************************************************************************
   /// A templated pool implementation that uses a fixed size pool.
+  ///\tparam LAYOUT_ The layout of the items. See etl::pool_layout.
   ///\ingroup pool
   //*************************************************************************
-  template <typename T, const size_t SIZE_>
-  class pool : public etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_>
+  template <typename T, const size_t SIZE_, int LAYOUT_ = etl::pool_layout::Packed>
+  class pool : public etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_, LAYOUT_>
   {
   private:
 
-    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_> base_t;
+    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_, LAYOUT_> base_t;
 
   public:
 
     static const size_t SIZE      = base_t::SIZE;
     static const size_t ALIGNMENT = base_t::ALIGNMENT;
     static const size_t TYPE_SIZE = base_t::TYPE_SIZE;
+    static const int    LAYOUT    = base_t::LAYOUT;
 
     //*************************************************************************
     /// Constructor
     //*************************************************************************
-    pool()
+    ETL_CONSTEXPR pool()
     {
     }
 
@@ -748,6 +984,85 @@ namespace etl
     pool(const pool&);
     pool& operator =(const pool&);
   };
+
+  //*************************************************************************
+  /// A pool that uses storage supplied by the caller, so that where the
+  /// items live, such as a NUMA node or a DMA capable region, is decided
+  /// when the pool is constructed.
+  /// The buffer must be aligned for T and hold buffer_size(max_size) bytes.
+  ///\ingroup pool
+  //*************************************************************************
+  template <typename T>
+  class pool_ext : public etl::ipool
+  {
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char* next;              ///< Pointer to the next free element.
+      char  value[sizeof(T)];  ///< Storage for value type.
+      typename etl::type_with_alignment<etl::alignment_of<T>::value>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+  public:
+
+    static const size_t ALIGNMENT = etl::alignment_of<Element>::value;
+    static const size_t TYPE_SIZE = sizeof(T);
+    static const size_t ITEM_SIZE = sizeof(Element);
+
+    //*************************************************************************
+    /// Constructor
+    /// \param buffer    The storage for the items.
+    /// \param max_size_ The number of items that the buffer holds.
+    //*************************************************************************
+    pool_ext(void* buffer, size_t max_size_)
+      : etl::ipool(static_cast<char*>(buffer), uint32_t(ITEM_SIZE), uint32_t(max_size_))
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of storage needed for max_size_ items.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size_)
+    {
+      return max_size_ * ITEM_SIZE;
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool::allocate<U>();
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      ipool::release(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_ext(const pool_ext&);
+    pool_ext& operator =(const pool_ext&);
+  };
 }
 
 #undef ETL_FILE
@@ -0,0 +1,375 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_CACHE_INCLUDED
+#define ETL_POOL_CACHE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+#include "pool.h"
+#include "function.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "utility.h"
+
+//*****************************************************************************
+///\defgroup pool_cache pool_cache
+/// A per-thread cache of items in front of a shared pool.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A per-thread cache (magazine) of free items from a shared pool.
+  /// Each thread or interrupt that uses the shared pool owns its own cache.
+  /// Allocation and release only touch the cache, except when it is empty or
+  /// full, when BATCH_SIZE items are moved to or from the shared pool at once.
+  /// The cache holds up to 2 x BATCH_SIZE items, so a thread that alternately
+  /// allocates and releases does not go back to the shared pool every time.
+  ///
+  /// TPool is the shared pool type, such as etl::atomic_pool or etl::pool.
+  /// An etl::atomic_pool may be used without a lock.
+  /// Other pools must be given lock and unlock callbacks, which are only called
+  /// when items are moved to or from the shared pool.
+  ///\code
+  /// etl::atomic_pool<Message, 64> messages;
+  ///
+  /// // In each thread.
+  /// etl::pool_cache<etl::atomic_pool<Message, 64>, 8> cache(messages);
+  /// Message* p_message = cache.create<Message>();
+  /// cache.destroy<Message>(p_message);
+  ///\endcode
+  ///\ingroup pool_cache
+  //***************************************************************************
+  template <typename TPool, const size_t BATCH_SIZE_>
+  class pool_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT((BATCH_SIZE_ > 0U), "Zero batch size");
+
+    static const size_t BATCH_SIZE = BATCH_SIZE_;
+    static const size_t MAX_SIZE   = 2U * BATCH_SIZE_;
+    static const size_t ALIGNMENT  = TPool::ALIGNMENT;
+    static const size_t TYPE_SIZE  = TPool::TYPE_SIZE;
+
+    typedef TPool  pool_type;
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Constructor for a shared pool that needs no lock.
+    //*************************************************************************
+    explicit pool_cache(TPool& pool_)
+      : pool(pool_),
+        p_lock(nullptr),
+        p_unlock(nullptr),
+        count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor for a shared pool that must be locked.
+    //*************************************************************************
+    pool_cache(TPool& pool_, const etl::ifunction<void>& lock_, const etl::ifunction<void>& unlock_)
+      : pool(pool_),
+        p_lock(&lock_),
+        p_unlock(&unlock_),
+        count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns the cached items to the shared pool.
+    //*************************************************************************
+    ~pool_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return static_cast<U*>(allocate_item());
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate storage for an object and create with default.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 2 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 3 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 4 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the object is not a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object.
+    /// The object may have been allocated by any cache of the same shared pool.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// shared pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      if (!pool.is_in_pool(p_object))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_object_not_in_pool));
+        return;
+      }
+
+      if (count == MAX_SIZE)
+      {
+        // Return the least recently used half.
+        release_to_pool(&items[0], BATCH_SIZE);
+        etl::copy(&items[BATCH_SIZE], &items[MAX_SIZE], &items[0]);
+        count = BATCH_SIZE;
+      }
+
+      items[count++] = const_cast<void*>(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the shared pool.
+    //*************************************************************************
+    void flush()
+    {
+      release_to_pool(&items[0], count);
+      count = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of free items held by the cache.
+    //*************************************************************************
+    size_t cached() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of free items held by the cache.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The shared pool.
+    //*************************************************************************
+    TPool& get_pool()
+    {
+      return pool;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item, refilling the cache if it is empty.
+    //*************************************************************************
+    void* allocate_item()
+    {
+      if (count == 0U)
+      {
+        lock();
+        count = pool.allocate_batch(&items[0], BATCH_SIZE);
+        unlock();
+
+        if (count == 0U)
+        {
+          ETL_ASSERT(false, ETL_ERROR(etl::pool_no_allocation));
+          return nullptr;
+        }
+      }
+
+      return items[--count];
+    }
+
+    //*************************************************************************
+    /// Return n items to the shared pool.
+    //*************************************************************************
+    void release_to_pool(void* const* p_items, size_t n)
+    {
+      if (n != 0U)
+      {
+        lock();
+        pool.release_batch(p_items, n);
+        unlock();
+      }
+    }
+
+    //*************************************************************************
+    void lock()
+    {
+      if (p_lock != nullptr)
+      {
+        (*p_lock)();
+      }
+    }
+
+    //*************************************************************************
+    void unlock()
+    {
+      if (p_unlock != nullptr)
+      {
+        (*p_unlock)();
+      }
+    }
+
+    // Should not be copied.
+    pool_cache(const pool_cache&);
+    pool_cache& operator =(const pool_cache&);
+
+    TPool&                        pool;            ///< The shared pool.
+    const etl::ifunction<void>*   p_lock;          ///< The callback that locks the shared pool, if any.
+    const etl::ifunction<void>*   p_unlock;        ///< The callback that unlocks the shared pool, if any.
+    void*                         items[MAX_SIZE]; ///< The cached free items.
+    size_t                        count;           ///< The number of cached free items.
+  };
+}
+
+#endif
@@ -0,0 +1,425 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_SHARED_PTR_INCLUDED
+#define ETL_POOL_SHARED_PTR_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "pool.h"
+#include "intrusive_ptr.h"
+#include "alignment.h"
+#include "utility.h"
+#include "nullptr.h"
+
+#include <new>
+
+///\defgroup pool_shared_ptr pool_shared_ptr
+/// A shared pointer whose reference count and object are allocated together
+/// from one item of an etl::ipool, and returned to it on the last release.
+/// The pool's items must be at least as large as
+/// etl::pool_shared_ptr<T, TCounter>::block_type.
+///\ingroup memory
+
+namespace etl
+{
+  namespace private_pool_shared_ptr
+  {
+    //*************************************************************************
+    /// The control block, at the start of the pool item.
+    //*************************************************************************
+    template <typename TCounter>
+    struct header
+    {
+      TCounter    counter;
+      etl::ipool* p_pool;
+      void        (*p_destroy)(header*);
+    };
+
+    //*************************************************************************
+    /// A pool item, holding the control block and the object.
+    //*************************************************************************
+    template <typename T, typename TCounter>
+    struct block
+    {
+      header<TCounter> control;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+
+      //***********************************
+      T* object()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+
+      //***********************************
+      static void destroy(header<TCounter>* p_header)
+      {
+        block*      p_block = reinterpret_cast<block*>(p_header);
+        etl::ipool* p_pool  = p_header->p_pool;
+
+        p_block->object()->~T();
+        p_block->control.~header<TCounter>();
+        p_pool->release(p_block);
+      }
+    };
+
+    //*************************************************************************
+    /// Builds a pointer from a constructed block.
+    //*************************************************************************
+    struct factory
+    {
+      template <typename TPointer, typename TBlock>
+      static TPointer make(etl::ipool& pool, TBlock* p_block)
+      {
+        p_block->control.p_pool    = &pool;
+        p_block->control.p_destroy = &TBlock::destroy;
+        p_block->control.counter.set_reference_count(1U);
+
+        return TPointer(&p_block->control, p_block->object());
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A shared pointer to an object in a pool.
+  /// May point to a base of the allocated type, so that, for example,
+  /// different message types from one pool may be shared as
+  /// etl::pool_shared_ptr<const etl::imessage>.
+  ///\tparam T        The pointed to type.
+  ///\tparam TCounter etl::reference_counter, or etl::atomic_reference_counter
+  ///                 if the object is shared between threads.
+  ///\ingroup pool_shared_ptr
+  //***************************************************************************
+  template <typename T, typename TCounter = etl::reference_counter>
+  class pool_shared_ptr
+  {
+  private:
+
+    typedef private_pool_shared_ptr::header<TCounter> header_t;
+
+  public:
+
+    typedef T        element_type;
+    typedef T*       pointer;
+    typedef T&       reference;
+    typedef TCounter counter_type;
+
+    /// The pool item type, for sizing the pool.
+    typedef private_pool_shared_ptr::block<typename etl::remove_cv<T>::type, TCounter> block_type;
+
+    //*************************************************************************
+    pool_shared_ptr()
+      : p_header(nullptr),
+        p_object(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    pool_shared_ptr(const pool_shared_ptr& other)
+      : p_header(other.p_header),
+        p_object(other.p_object)
+    {
+      add_ref();
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer to a derived type.
+    //*************************************************************************
+    template <typename U>
+    pool_shared_ptr(const pool_shared_ptr<U, TCounter>& other)
+      : p_header(other.p_header),
+        p_object(other.p_object)
+    {
+      add_ref();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    pool_shared_ptr(pool_shared_ptr&& other)
+      : p_header(other.p_header),
+        p_object(other.p_object)
+    {
+      other.p_header = nullptr;
+      other.p_object = nullptr;
+    }
+#endif
+
+    //*************************************************************************
+    ~pool_shared_ptr()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    pool_shared_ptr& operator =(const pool_shared_ptr& other)
+    {
+      pool_shared_ptr(other).swap(*this);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    pool_shared_ptr& operator =(pool_shared_ptr&& other)
+    {
+      pool_shared_ptr(etl::move(other)).swap(*this);
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the reference.
+    /// The object is destroyed and returned to its pool if this was the last.
+    //*************************************************************************
+    void reset()
+    {
+      pool_shared_ptr().swap(*this);
+    }
+
+    //*************************************************************************
+    pointer get() const
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    reference operator *() const
+    {
+      return *p_object;
+    }
+
+    //*************************************************************************
+    pointer operator ->() const
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    operator bool() const
+    {
+      return (p_object != nullptr);
+    }
+
+    //*************************************************************************
+    /// The number of pointers that share the object.
+    //*************************************************************************
+    typename counter_type::value_type use_count() const
+    {
+      return (p_header != nullptr) ? p_header->counter.get_reference_count() : 0U;
+    }
+
+    //*************************************************************************
+    void swap(pool_shared_ptr& other)
+    {
+      header_t* temp_header = p_header;
+      pointer   temp_object = p_object;
+
+      p_header = other.p_header;
+      p_object = other.p_object;
+
+      other.p_header = temp_header;
+      other.p_object = temp_object;
+    }
+
+  private:
+
+    template <typename U, typename TC>
+    friend class pool_shared_ptr;
+
+    friend struct private_pool_shared_ptr::factory;
+
+    //*************************************************************************
+    pool_shared_ptr(header_t* p_header_, pointer p_object_)
+      : p_header(p_header_),
+        p_object(p_object_)
+    {
+    }
+
+    //*************************************************************************
+    void add_ref()
+    {
+      if (p_header != nullptr)
+      {
+        p_header->counter.increment();
+      }
+    }
+
+    //*************************************************************************
+    void release()
+    {
+      if ((p_header != nullptr) && (p_header->counter.decrement() == 0U))
+      {
+        p_header->p_destroy(p_header);
+      }
+    }
+
+    header_t* p_header;
+    pointer   p_object;
+  };
+
+  //***************************************************************************
+  template <typename T, typename U, typename TCounter>
+  bool operator ==(const etl::pool_shared_ptr<T, TCounter>& lhs, const etl::pool_shared_ptr<U, TCounter>& rhs)
+  {
+    return lhs.get() == rhs.get();
+  }
+
+  //***************************************************************************
+  template <typename T, typename U, typename TCounter>
+  bool operator !=(const etl::pool_shared_ptr<T, TCounter>& lhs, const etl::pool_shared_ptr<U, TCounter>& rhs)
+  {
+    return lhs.get() != rhs.get();
+  }
+
+  //***************************************************************************
+  template <typename T, typename TCounter>
+  void swap(etl::pool_shared_ptr<T, TCounter>& lhs, etl::pool_shared_ptr<T, TCounter>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  namespace private_pool_shared_ptr
+  {
+    //*************************************************************************
+    /// Allocates a block for a T, if there is room in the pool.
+    //*************************************************************************
+    template <typename T, typename TCounter>
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* allocate(etl::ipool& pool)
+    {
+      typedef typename etl::pool_shared_ptr<T, TCounter>::block_type block_t;
+
+      if (pool.full() || (pool.item_size() < sizeof(block_t)))
+      {
+        return nullptr;
+      }
+
+      block_t* p_block = pool.allocate<block_t>();
+      ::new (&p_block->control) header<TCounter>();
+
+      return p_block;
+    }
+  }
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Creates an object in the pool, shared by the returned pointer.
+  /// Returns an empty pointer if the pool is full or its items are too small.
+  ///\ingroup pool_shared_ptr
+  //***************************************************************************
+  template <typename T, typename TCounter = etl::reference_counter, typename... TArgs>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared(etl::ipool& pool, TArgs&&... args)
+  {
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* p_block = private_pool_shared_ptr::allocate<T, TCounter>(pool);
+
+    if (p_block == nullptr)
+    {
+      return etl::pool_shared_ptr<T, TCounter>();
+    }
+
+    ::new (&p_block->storage) T(etl::forward<TArgs>(args)...);
+
+    return private_pool_shared_ptr::factory::make<etl::pool_shared_ptr<T, TCounter> >(pool, p_block);
+  }
+#else
+  //***************************************************************************
+  /// Creates an object in the pool, shared by the returned pointer.
+  /// Returns an empty pointer if the pool is full or its items are too small.
+  /// For C++03 the counter type must be specified.
+  ///\ingroup pool_shared_ptr
+  //***************************************************************************
+  template <typename T, typename TCounter>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared(etl::ipool& pool)
+  {
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* p_block = private_pool_shared_ptr::allocate<T, TCounter>(pool);
+
+    if (p_block == nullptr)
+    {
+      return etl::pool_shared_ptr<T, TCounter>();
+    }
+
+    ::new (&p_block->storage) T();
+
+    return private_pool_shared_ptr::factory::make<etl::pool_shared_ptr<T, TCounter> >(pool, p_block);
+  }
+
+  //***************************************************************************
+  template <typename T, typename TCounter, typename T1>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared(etl::ipool& pool, const T1& value1)
+  {
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* p_block = private_pool_shared_ptr::allocate<T, TCounter>(pool);
+
+    if (p_block == nullptr)
+    {
+      return etl::pool_shared_ptr<T, TCounter>();
+    }
+
+    ::new (&p_block->storage) T(value1);
+
+    return private_pool_shared_ptr::factory::make<etl::pool_shared_ptr<T, TCounter> >(pool, p_block);
+  }
+
+  //***************************************************************************
+  template <typename T, typename TCounter, typename T1, typename T2>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared(etl::ipool& pool, const T1& value1, const T2& value2)
+  {
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* p_block = private_pool_shared_ptr::allocate<T, TCounter>(pool);
+
+    if (p_block == nullptr)
+    {
+      return etl::pool_shared_ptr<T, TCounter>();
+    }
+
+    ::new (&p_block->storage) T(value1, value2);
+
+    return private_pool_shared_ptr::factory::make<etl::pool_shared_ptr<T, TCounter> >(pool, p_block);
+  }
+
+  //***************************************************************************
+  template <typename T, typename TCounter, typename T1, typename T2, typename T3>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3)
+  {
+    typename etl::pool_shared_ptr<T, TCounter>::block_type* p_block = private_pool_shared_ptr::allocate<T, TCounter>(pool);
+
+    if (p_block == nullptr)
+    {
+      return etl::pool_shared_ptr<T, TCounter>();
+    }
+
+    ::new (&p_block->storage) T(value1, value2, value3);
+
+    return private_pool_shared_ptr::factory::make<etl::pool_shared_ptr<T, TCounter> >(pool, p_block);
+  }
+#endif
+}
+
+#endif
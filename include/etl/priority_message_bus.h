@@ -0,0 +1,376 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIORITY_MESSAGE_BUS_INCLUDED
+#define ETL_PRIORITY_MESSAGE_BUS_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "message_inbox.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "private/queued_message.h"
+
+///\defgroup priority_message_bus priority_message_bus
+/// A message bus that queues messages in priority lanes and delivers them
+/// to its subscribers when process() is called.
+/// Messages are copied into the message packet type of the bus, which must be
+/// able to hold every message that is sent to it.
+///\ingroup messaging
+
+namespace etl
+{
+  //***************************************************************************
+  /// The default lane selector. Every message is in lane 0.
+  ///\ingroup priority_message_bus
+  //***************************************************************************
+  struct message_priority_none
+  {
+    size_t operator()(const etl::imessage&) const
+    {
+      return 0U;
+    }
+  };
+
+  namespace private_priority_message_bus
+  {
+    //*************************************************************************
+    /// A queued message and its destination.
+    //*************************************************************************
+    template <typename TPacket>
+    struct lane_item
+    {
+      lane_item()
+        : destination(etl::imessage_router::ALL_MESSAGE_ROUTERS)
+      {
+      }
+
+      lane_item(etl::imessage_router* p_sender, etl::message_router_id_t destination_, const etl::imessage& msg)
+        : message(p_sender, msg),
+          destination(destination_)
+      {
+      }
+
+      etl::private_message::queued_message<TPacket> message;
+      etl::message_router_id_t                      destination;
+    };
+  }
+
+  //***************************************************************************
+  /// A message bus with priority lanes.
+  /// Sending to the bus selects a lane, with 0 being the highest priority, and
+  /// copies the message into it without blocking. process() delivers the
+  /// queued messages to the subscribers, from the thread that owns them.
+  /// Lanes are drained either in strict priority order, or weighted fair,
+  /// where each non-empty lane in turn may deliver up to its weight of messages.
+  /// Each lane may have a depth limit below its capacity, beyond which
+  /// messages are dropped and counted.
+  ///\tparam TPacket     The message packet type, such as Router::message_packet.
+  ///\tparam MAX_ROUTERS The maximum number of subscribed routers.
+  ///\tparam LANES       The number of priority lanes.
+  ///\tparam LANE_SIZE   The capacity of each lane.
+  ///\tparam TPolicy     etl::message_inbox_spsc or etl::message_inbox_mpsc, for
+  ///                    one or several sending threads.
+  ///\tparam TPriority   Selects the lane of a message from the message.
+  ///\ingroup priority_message_bus
+  //***************************************************************************
+  template <typename TPacket,
+            uint_least8_t MAX_ROUTERS,
+            size_t LANES,
+            size_t LANE_SIZE,
+            typename TPolicy   = etl::message_inbox_spsc,
+            typename TPriority = etl::message_priority_none>
+  class priority_message_bus : public etl::message_bus<MAX_ROUTERS>
+  {
+  private:
+
+    typedef etl::message_bus<MAX_ROUTERS> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(LANES != 0U, "At least one lane is required");
+
+    typedef private_priority_message_bus::lane_item<TPacket>       item_type;
+    typedef typename TPolicy::template queue<item_type, LANE_SIZE>::type queue_type;
+
+    enum drain_mode
+    {
+      Strict,
+      Weighted_Fair
+    };
+
+    using base_t::receive;
+    using base_t::receive_batch;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    priority_message_bus(drain_mode mode_ = Strict, const TPriority& priority_ = TPriority())
+      : mode(mode_),
+        priority(priority_),
+        current_lane(LANES - 1U),
+        credit(0U)
+    {
+      for (size_t i = 0U; i < LANES; ++i)
+      {
+        weights[i]        = 1U;
+        limits[i]         = LANE_SIZE;
+        overflow_count[i] = 0U;
+      }
+    }
+
+    //*******************************************
+    /// Queues the message in the lane chosen by the priority selector.
+    //*******************************************
+    void receive(etl::imessage_router&    source,
+                 etl::message_router_id_t destination_router_id,
+                 const etl::imessage&     message)
+    {
+      post(source, destination_router_id, message, priority(message));
+    }
+
+    //*******************************************
+    /// Queues each message of the batch in the lane chosen by the priority selector.
+    //*******************************************
+    void receive_batch(etl::imessage_router& source, const etl::message_batch& batch)
+    {
+      for (size_t i = 0U; i < batch.size(); ++i)
+      {
+        post(source, etl::imessage_router::ALL_MESSAGE_ROUTERS, batch[i], priority(batch[i]));
+      }
+    }
+
+    //*******************************************
+    /// Queues the message in the given lane.
+    /// Never blocks.
+    /// Returns false if the lane was at its limit and the message was dropped.
+    //*******************************************
+    bool post(etl::imessage_router&    source,
+              etl::message_router_id_t destination_router_id,
+              const etl::imessage&     message,
+              size_t                   lane)
+    {
+      if (destination_router_id == etl::imessage_router::NULL_MESSAGE_ROUTER)
+      {
+        return true;
+      }
+
+      lane = (lane < LANES) ? lane : (LANES - 1U);
+
+      etl::imessage_router* p_sender = source.is_null_router() ? nullptr : &source;
+
+      if ((size_t(lanes[lane].size()) < limits[lane]) && lanes[lane].emplace(p_sender, destination_router_id, message))
+      {
+        return true;
+      }
+
+      ++overflow_count[lane];
+
+      return false;
+    }
+
+    //*******************************************
+    /// Queues a broadcast message in the given lane.
+    //*******************************************
+    bool post(const etl::imessage& message, size_t lane)
+    {
+      return post(etl::null_message_router::instance(), etl::imessage_router::ALL_MESSAGE_ROUTERS, message, lane);
+    }
+
+    //*******************************************
+    /// Delivers the next message, as chosen by the drain mode.
+    /// Call from the subscribers' thread.
+    /// Returns false if all of the lanes were empty.
+    //*******************************************
+    bool process_one()
+    {
+      item_type item;
+
+      if (!next(item))
+      {
+        return false;
+      }
+
+      base_t::receive(item.message.sender(), item.destination, item.message.get());
+
+      return true;
+    }
+
+    //*******************************************
+    /// Delivers up to max_count messages.
+    /// Call from the subscribers' thread.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t process(size_t max_count = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      while ((count < max_count) && process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Sets the drain mode.
+    //*******************************************
+    void set_drain_mode(drain_mode mode_)
+    {
+      mode         = mode_;
+      current_lane = LANES - 1U;
+      credit       = 0U;
+    }
+
+    //*******************************************
+    /// Sets the number of messages a lane may deliver in its turn, when the
+    /// drain mode is Weighted_Fair. A weight of zero is treated as one.
+    //*******************************************
+    void set_lane_weight(size_t lane, size_t weight)
+    {
+      if (lane < LANES)
+      {
+        weights[lane] = (weight == 0U) ? 1U : weight;
+      }
+    }
+
+    //*******************************************
+    /// Sets the maximum depth of a lane.
+    /// Clamped to the lane capacity.
+    //*******************************************
+    void set_lane_limit(size_t lane, size_t limit)
+    {
+      if (lane < LANES)
+      {
+        limits[lane] = (limit < LANE_SIZE) ? limit : LANE_SIZE;
+      }
+    }
+
+    //*******************************************
+    /// The number of messages waiting in a lane.
+    /// Due to concurrency, this is a guess.
+    //*******************************************
+    size_t lane_size(size_t lane) const
+    {
+      return (lane < LANES) ? size_t(lanes[lane].size()) : 0U;
+    }
+
+    //*******************************************
+    /// The number of messages dropped from a lane.
+    //*******************************************
+    size_t get_overflow_count(size_t lane) const
+    {
+      return (lane < LANES) ? overflow_count[lane].load() : 0U;
+    }
+
+    //*******************************************
+    /// Are all of the lanes empty?
+    /// Accurate only when called from the subscribers' thread.
+    //*******************************************
+    bool empty() const
+    {
+      for (size_t i = 0U; i < LANES; ++i)
+      {
+        if (!lanes[i].empty())
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+  private:
+
+    //*******************************************
+    /// Takes the next message from the lanes.
+    //*******************************************
+    bool next(item_type& item)
+    {
+      if (mode == Strict)
+      {
+        for (size_t i = 0U; i < LANES; ++i)
+        {
+          if (lanes[i].pop(item))
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      // Weighted fair. The current lane keeps its turn until its credit is
+      // used or it is empty.
+      for (size_t i = 0U; i <= LANES; ++i)
+      {
+        if ((credit != 0U) && lanes[current_lane].pop(item))
+        {
+          --credit;
+          return true;
+        }
+
+        current_lane = (current_lane + 1U) % LANES;
+        credit       = weights[current_lane];
+      }
+
+      return false;
+    }
+
+    // Disabled.
+    priority_message_bus(const priority_message_bus&);
+    priority_message_bus& operator =(const priority_message_bus&);
+
+    drain_mode         mode;
+    TPriority          priority;
+    size_t             current_lane;
+    size_t             credit;
+    size_t             weights[LANES];
+    size_t             limits[LANES];
+    etl::atomic_size_t overflow_count[LANES];
+    queue_type         lanes[LANES];
+  };
+}
+
+#endif
+
+#endif
@@ -41,9 +41,10 @@ SOFTWARE.
 #include "container.h"
 #include "vector.h"
 #include "type_traits.h"
-#include "parameter_type.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "static_assert.h"
+#include "iterator.h"
 
 #undef ETL_FILE
 #define ETL_FILE "12"
@@ -99,6 +100,185 @@ namespace etl
     }
   };
 
+  namespace private_priority_queue
+  {
+#if ETL_CPP11_SUPPORTED
+    template <typename T>
+    typename etl::remove_reference<T>::type&& heap_move(T& value)
+    {
+      return etl::move(value);
+    }
+#else
+    template <typename T>
+    T& heap_move(T& value)
+    {
+      return value;
+    }
+#endif
+
+    //*************************************************************************
+    /// Heap operations for a heap where each node has ARITY children.
+    /// Wider heaps are shallower, so a pop visits fewer levels, and the
+    /// children of a node are adjacent in memory.
+    //*************************************************************************
+    template <const size_t ARITY>
+    struct heap
+    {
+      ETL_STATIC_ASSERT((ARITY >= 2U), "A heap must have at least two children per node");
+
+      //***********************************************************************
+      /// Moves the hole down from 'hole' until 'value' can be placed in it.
+      //***********************************************************************
+      template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+      static void sift_down(TIterator first, TDistance length, TDistance hole, TValue& value, TCompare compare)
+      {
+        while (true)
+        {
+          TDistance child = (hole * TDistance(ARITY)) + 1;
+
+          if (child >= length)
+          {
+            break;
+          }
+
+          const TDistance end = etl::min(TDistance(child + TDistance(ARITY)), length);
+
+          TDistance best = child;
+
+          for (++child; child < end; ++child)
+          {
+            if (compare(first[best], first[child]))
+            {
+              best = child;
+            }
+          }
+
+          if (!compare(value, first[best]))
+          {
+            break;
+          }
+
+          first[hole] = heap_move(first[best]);
+          hole = best;
+        }
+
+        first[hole] = heap_move(value);
+      }
+
+      //***********************************************************************
+      /// Pushes the value at last - 1 in to the heap [first, last - 1).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+
+        difference_type hole = (last - first) - 1;
+
+        if (hole <= 0)
+        {
+          return;
+        }
+
+        value_type value(heap_move(first[hole]));
+
+        while (hole > 0)
+        {
+          const difference_type parent = (hole - 1) / difference_type(ARITY);
+
+          if (!compare(first[parent], value))
+          {
+            break;
+          }
+
+          first[hole] = heap_move(first[parent]);
+          hole = parent;
+        }
+
+        first[hole] = heap_move(value);
+      }
+
+      //***********************************************************************
+      /// Moves the top of the heap to last - 1 and restores the heap [first, last - 1).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+
+        const difference_type length = (last - first) - 1;
+
+        if (length <= 0)
+        {
+          return;
+        }
+
+        value_type value(heap_move(first[length]));
+        first[length] = heap_move(first[0]);
+        sift_down(first, length, difference_type(0), value, compare);
+      }
+
+      //***********************************************************************
+      /// Arranges [first, last) as a heap.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+
+        const difference_type length = last - first;
+
+        if (length < 2)
+        {
+          return;
+        }
+
+        difference_type parent = (length - 2) / difference_type(ARITY);
+
+        while (true)
+        {
+          value_type value(heap_move(first[parent]));
+          sift_down(first, length, parent, value, compare);
+
+          if (parent == 0)
+          {
+            break;
+          }
+
+          --parent;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Binary heaps use the library heap algorithms.
+    //*************************************************************************
+    template <>
+    struct heap<2U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::push_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::pop_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::make_heap(first, last, compare);
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup queue
   ///\brief This is the base for all priority queues that contain a particular type.
@@ -114,8 +294,9 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam ARITY The number of children of each heap node.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare = etl::less<T> >
+  template <typename T, typename TContainer, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
   class ipriority_queue
   {
   public:
@@ -125,14 +306,13 @@ namespace etl
     typedef TCompare              compare_type;       ///< The comparison type.
     typedef T&                    reference;          ///< A reference to the type used in the queue.
     typedef const T&              const_reference;    ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                   rvalue_reference;   ///< An rvalue reference to the type used in the queue.
+#endif
     typedef typename TContainer::size_type size_type; ///< The type used for determining the size of the queue.
     typedef typename etl::iterator_traits<typename TContainer::iterator>::difference_type difference_type;
 
-  private:
-
-    typedef typename etl::parameter_type<T>::type parameter_t;
-
-  public:
+    static const size_t HEAP_ARITY = ARITY; ///< The number of children of each heap node.
 
     //*************************************************************************
     /// Gets a reference to the highest priority value in the priority queue.<br>
@@ -158,15 +338,33 @@ namespace etl
     /// is the priority queue is already full.
     ///\param value The value to push to the queue.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
       ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
 
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
+
+      // Put element at end
+      container.push_back(etl::move(value));
+      // Make elements in container into heap
+      heap_t::push(container.begin(), container.end(), compare);
     }
+#endif
 
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_PRIORITY_QUEUE_FORCE_CPP03)
     //*************************************************************************
@@ -183,7 +381,7 @@ namespace etl
       // Put element at end
       container.emplace_back(etl::forward<Args>(args)...);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 #else
     //*************************************************************************
@@ -200,7 +398,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -217,7 +415,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -234,7 +432,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -251,7 +449,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -275,7 +473,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      etl::make_heap(container.begin(), container.end(), compare);
+      heap_t::make(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -285,7 +483,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      etl::pop_heap(container.begin(), container.end(), compare);
+      heap_t::pop(container.begin(), container.end(), compare);
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -296,7 +494,11 @@ namespace etl
     //*************************************************************************
     void pop_into(reference destination)
     {
+#if ETL_CPP11_SUPPORTED
+      destination = etl::move(top());
+#else
       destination = top();
+#endif
       pop();
     }
 
@@ -361,6 +563,27 @@ namespace etl
       assign(other.container.cbegin(), other.container.cend());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Make this a moved clone of the supplied priority queue.
+    /// The elements are already in heap order, so are moved as they are.
+    //*************************************************************************
+    void move_clone(ipriority_queue&& other)
+    {
+      container.clear();
+
+      typename TContainer::iterator itr = other.container.begin();
+
+      while (itr != other.container.end())
+      {
+        container.push_back(etl::move(*itr));
+        ++itr;
+      }
+
+      other.container.clear();
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -370,6 +593,8 @@ namespace etl
 
   private:
 
+    typedef etl::private_priority_queue::heap<ARITY> heap_t;
+
     // Disable copy construction.
     ipriority_queue(const ipriority_queue&);
 
@@ -379,15 +604,20 @@ namespace etl
     TCompare compare;
   };
 
+  template <typename T, typename TContainer, typename TCompare, const size_t ARITY>
+  const size_t ipriority_queue<T, TContainer, TCompare, ARITY>::HEAP_ARITY;
+
   //***************************************************************************
   ///\ingroup priority_queue
   /// A fixed capacity priority queue.
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam ARITY The number of children of each heap node. 4 reduces the
+  /// depth of the heap, which makes pop faster for larger queues.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type>, const size_t ARITY = 2U>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, ARITY>
   {
   public:
 
@@ -399,7 +629,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
     }
 
@@ -407,11 +637,22 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    priority_queue(priority_queue&& rhs)
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
+    {
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move_clone(etl::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -420,9 +661,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::assign(first, last);
     }
 
     //*************************************************************************
@@ -430,7 +671,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clear();
     }
 
     //*************************************************************************
@@ -440,11 +681,26 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
       }
 
       return *this;
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    priority_queue& operator = (priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move_clone(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
   };
 }
 
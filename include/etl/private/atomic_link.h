@@ -0,0 +1,94 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_LINK_INCLUDED
+#define ETL_ATOMIC_LINK_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+namespace etl
+{
+  namespace private_atomic_link
+  {
+    //*************************************************************************
+    /// Atomic access to the plain 'etl_next' pointer of an intrusive link,
+    /// so that links may be shared between threads without extra storage.
+    //*************************************************************************
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    template <typename TLink>
+    TLink* load_next(const TLink& link, int order)
+    {
+      return static_cast<TLink*>(__atomic_load_n(&link.etl_next, order));
+    }
+
+    template <typename TLink>
+    void store_next(TLink& link, TLink* next, int order)
+    {
+      __atomic_store_n(&link.etl_next, next, order);
+    }
+
+    static const int relaxed = __ATOMIC_RELAXED;
+    static const int acquire = __ATOMIC_ACQUIRE;
+    static const int release = __ATOMIC_RELEASE;
+#else
+    // Aligned pointer accesses are assumed to be indivisible.
+    template <typename TLink>
+    TLink* load_next(const TLink& link, int order)
+    {
+      TLink* next = static_cast<TLink*>(*static_cast<TLink* const volatile*>(&link.etl_next));
+
+      if (order != 0)
+      {
+        etl::atomic_thread_fence(etl::memory_order_seq_cst);
+      }
+
+      return next;
+    }
+
+    template <typename TLink>
+    void store_next(TLink& link, TLink* next, int order)
+    {
+      if (order != 0)
+      {
+        etl::atomic_thread_fence(etl::memory_order_seq_cst);
+      }
+
+      *static_cast<TLink* volatile*>(&link.etl_next) = next;
+    }
+
+    static const int relaxed = 0;
+    static const int acquire = 1;
+    static const int release = 2;
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,350 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CACHE_BASE_INCLUDED
+#define ETL_CACHE_BASE_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../icache.h"
+#include "../pool.h"
+#include "../hash.h"
+#include "../functional.h"
+#include "../intrusive_links.h"
+#include "../intrusive_unordered_set.h"
+
+namespace etl
+{
+  namespace private_cache
+  {
+    //*************************************************************************
+    /// A cached key/value pair.
+    /// Linked into the key index through forward_link<0>. The replacement
+    /// policy keeps its own state in TPolicy.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TPolicy>
+    struct entry : public etl::forward_link<0>, public TPolicy
+    {
+      entry(const TKey& key_, const TValue& value_)
+        : key(key_)
+        , value(value_)
+        , dirty(false)
+      {
+        etl::forward_link<0>::clear();
+      }
+
+      const TKey key;
+      TValue     value;
+      bool       dirty;
+    };
+
+    //*************************************************************************
+    /// Returns the key of an entry, for the index.
+    //*************************************************************************
+    template <typename TEntry, typename TKey>
+    struct entry_key
+    {
+      typedef TKey key_type;
+
+      const TKey& operator ()(const TEntry& e) const
+      {
+        return e.key;
+      }
+    };
+
+    //*************************************************************************
+    /// The common part of the fixed capacity caches.
+    /// Entries are allocated from an internal pool and indexed by key in an
+    /// intrusive hash set, giving O(1) lookup. The derived class decides
+    /// which entry to evict when the cache is full.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TPolicy, const size_t SIZE, typename THash, typename TKeyEqual>
+    class cache_base : public etl::icache<TKey, TValue>
+    {
+    private:
+
+      typedef etl::icache<TKey, TValue> base_t;
+
+    public:
+
+      typedef private_cache::entry<TKey, TValue, TPolicy> entry_t;
+
+      //***********************************************************************
+      /// Reads a value.
+      /// On a miss the value is loaded from the store, evicting another entry
+      /// if the cache is full.
+      /// TValue must be default constructible for a load.
+      /// Returns nullptr if the key is in neither the cache nor the store.
+      /// The pointer is valid until the next modifying call.
+      //***********************************************************************
+      virtual const TValue* read(const TKey& key)
+      {
+        entry_t* p_entry = find_entry(key);
+
+        if (p_entry != nullptr)
+        {
+          ++this->statistics.hits;
+          on_hit(*p_entry);
+
+          return &p_entry->value;
+        }
+
+        ++this->statistics.misses;
+
+        TValue value;
+
+        if (this->load(key, value))
+        {
+          return &insert_entry(key, value).value;
+        }
+
+        return nullptr;
+      }
+
+      //***********************************************************************
+      /// Writes a value.
+      /// Written to the store now if write through, otherwise marked dirty.
+      //***********************************************************************
+      virtual void write(const TKey& key, const TValue& value)
+      {
+        entry_t* p_entry = find_entry(key);
+
+        if (p_entry != nullptr)
+        {
+          ++this->statistics.hits;
+          p_entry->value = value;
+          on_hit(*p_entry);
+        }
+        else
+        {
+          ++this->statistics.misses;
+          p_entry = &insert_entry(key, value);
+        }
+
+        changed(*p_entry);
+      }
+
+      //***********************************************************************
+      /// Writes all dirty values to the store.
+      //***********************************************************************
+      virtual void flush()
+      {
+        typename index_t::iterator itr = index.begin();
+
+        while (itr != index.end())
+        {
+          if (itr->dirty)
+          {
+            write_back(*itr);
+          }
+
+          ++itr;
+        }
+      }
+
+      //***********************************************************************
+      /// Checks if the key is in the cache.
+      /// Does not count as an access.
+      //***********************************************************************
+      bool contains(const TKey& key) const
+      {
+        return index.find(key) != index.end();
+      }
+
+      //***********************************************************************
+      /// Removes the key from the cache, writing it back first if dirty.
+      /// Returns true if it was in the cache.
+      //***********************************************************************
+      bool erase(const TKey& key)
+      {
+        entry_t* p_entry = find_entry(key);
+
+        if (p_entry != nullptr)
+        {
+          if (p_entry->dirty)
+          {
+            write_back(*p_entry);
+          }
+
+          remove_entry(*p_entry);
+
+          return true;
+        }
+
+        return false;
+      }
+
+      //***********************************************************************
+      /// Writes back all dirty values and empties the cache.
+      //***********************************************************************
+      void clear()
+      {
+        flush();
+
+        while (!index.empty())
+        {
+          remove_entry(*index.begin());
+        }
+      }
+
+      //***********************************************************************
+      /// Gets the number of cached entries.
+      //***********************************************************************
+      size_t size() const
+      {
+        return index.size();
+      }
+
+      //***********************************************************************
+      /// Gets the maximum number of cached entries.
+      //***********************************************************************
+      size_t capacity() const
+      {
+        return SIZE;
+      }
+
+      //***********************************************************************
+      /// Checks if the cache is empty.
+      //***********************************************************************
+      bool empty() const
+      {
+        return index.empty();
+      }
+
+      //***********************************************************************
+      /// Checks if the cache is full.
+      //***********************************************************************
+      bool full() const
+      {
+        return index.size() == SIZE;
+      }
+
+    protected:
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      cache_base()
+      {
+      }
+
+      //***********************************************************************
+      /// Destructor.
+      /// The derived class must call clear(), while its policy still exists.
+      //***********************************************************************
+      ~cache_base()
+      {
+      }
+
+      virtual void     on_insert(entry_t& e) = 0; ///< A new entry has been added.
+      virtual void     on_hit(entry_t& e)    = 0; ///< An entry has been read or written.
+      virtual void     on_erase(entry_t& e)  = 0; ///< An entry is about to be removed.
+      virtual entry_t& victim()              = 0; ///< Chooses the entry to evict from a full cache.
+
+    private:
+
+      typedef etl::intrusive_unordered_set<entry_t, etl::forward_link<0>, THash, entry_key<entry_t, TKey>, SIZE, TKeyEqual> index_t;
+
+      //***********************************************************************
+      entry_t* find_entry(const TKey& key)
+      {
+        typename index_t::iterator itr = index.find(key);
+
+        return (itr == index.end()) ? nullptr : &(*itr);
+      }
+
+      //***********************************************************************
+      entry_t& insert_entry(const TKey& key, const TValue& value)
+      {
+        if (full())
+        {
+          entry_t& old = victim();
+
+          if (old.dirty)
+          {
+            write_back(old);
+          }
+
+          ++this->statistics.evictions;
+          remove_entry(old);
+        }
+
+        entry_t* p_entry = entries.template create<entry_t>(key, value);
+
+        index.insert(*p_entry);
+        on_insert(*p_entry);
+
+        return *p_entry;
+      }
+
+      //***********************************************************************
+      void remove_entry(entry_t& e)
+      {
+        on_erase(e);
+        index.erase(e.key);
+        entries.template destroy<entry_t>(&e);
+      }
+
+      //***********************************************************************
+      void changed(entry_t& e)
+      {
+        if (this->write_through)
+        {
+          this->store(e.key, e.value);
+        }
+        else if (!e.dirty)
+        {
+          e.dirty = true;
+          ++this->dirty_count;
+
+          if ((this->write_back_limit != 0U) && (this->dirty_count >= this->write_back_limit))
+          {
+            flush();
+          }
+        }
+      }
+
+      //***********************************************************************
+      void write_back(entry_t& e)
+      {
+        this->store(e.key, e.value);
+        e.dirty = false;
+        --this->dirty_count;
+      }
+
+      etl::pool<entry_t, SIZE> entries;
+      index_t                  index;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,483 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC32_HARDWARE_INCLUDED
+#define ETL_CRC32_HARDWARE_INCLUDED
+
+#include <stdint.h>
+
+#include <string.h>
+
+#include "../platform.h"
+#include "../frame_check_sequence.h"
+#include "../iterator.h"
+#include "../cpu_features.h"
+#include "crc32_poly_0x1edc6f41.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup crc32_hardware Hardware accelerated 32 bit CRC calculation
+/// Uses the SSE4.2 or ARMv8 CRC32 instructions when the profile advertises them.
+/// The 'dispatch' variants select the SSE4.2 instructions at run time, when
+/// the profile does not advertise them, falling back to the table.
+/// Define ETL_NO_HARDWARE_CRC to always use the table versions.
+///\ingroup crc
+
+#if !defined(ETL_NO_HARDWARE_CRC)
+  #if defined(ETL_CPU_HAS_ARM_CRC32)
+    #include <arm_acle.h>
+    #define ETL_HAS_HARDWARE_CRC32_C
+    #define ETL_HAS_HARDWARE_CRC32
+  #elif defined(ETL_CPU_HAS_SSE42_CRC32)
+    #include <nmmintrin.h>
+    #define ETL_HAS_HARDWARE_CRC32_C
+  #elif defined(ETL_CPU_DISPATCH_X86)
+    #include <nmmintrin.h>
+    #define ETL_HAS_DISPATCHED_CRC32_C
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Assembles eight bytes, least significant first.
+    //*************************************************************************
+    inline uint64_t assemble_le64(const uint8_t* block)
+    {
+      return  uint64_t(block[0])        | (uint64_t(block[1]) << 8)  |
+             (uint64_t(block[2]) << 16) | (uint64_t(block[3]) << 24) |
+             (uint64_t(block[4]) << 32) | (uint64_t(block[5]) << 40) |
+             (uint64_t(block[6]) << 48) | (uint64_t(block[7]) << 56);
+    }
+
+    //*************************************************************************
+    /// Adds a range, eight bytes at a time, using the supplied instruction set.
+    //*************************************************************************
+    template <typename TInstructions, typename TIterator>
+    uint32_t hardware_add_block(uint32_t crc, TIterator begin, const TIterator end)
+    {
+      uint8_t block[8];
+
+      while (begin != end)
+      {
+        size_t count = 0U;
+
+        while ((count < 8U) && (begin != end))
+        {
+          block[count++] = static_cast<uint8_t>(*begin++);
+        }
+
+        if (count == 8U)
+        {
+          crc = TInstructions::add64(crc, assemble_le64(block));
+        }
+        else
+        {
+          for (size_t i = 0U; i < count; ++i)
+          {
+            crc = TInstructions::add8(crc, block[i]);
+          }
+        }
+      }
+
+      return crc;
+    }
+
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+    //*************************************************************************
+    /// CRC32-C instructions.
+    //*************************************************************************
+    struct crc32_c_instructions
+    {
+      static uint32_t add8(uint32_t crc, uint8_t value)
+      {
+  #if defined(ETL_CPU_HAS_ARM_CRC32)
+        return __crc32cb(crc, value);
+  #else
+        return _mm_crc32_u8(crc, value);
+  #endif
+      }
+
+      static uint32_t add64(uint32_t crc, uint64_t value)
+      {
+  #if defined(ETL_CPU_HAS_ARM_CRC32)
+        return __crc32cd(crc, value);
+  #elif defined(__x86_64__) || defined(_M_X64)
+        return uint32_t(_mm_crc32_u64(crc, value));
+  #else
+        crc = _mm_crc32_u32(crc, uint32_t(value));
+        return _mm_crc32_u32(crc, uint32_t(value >> 32));
+  #endif
+      }
+    };
+#endif
+
+    typedef uint32_t (*crc32_block_function_t)(uint32_t crc, const uint8_t* begin, const uint8_t* end);
+
+    //*************************************************************************
+    /// CRC32-C of a block, using the table.
+    //*************************************************************************
+    inline uint32_t crc32_c_table_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+    {
+      const etl::crc32_table_poly_0x1edc6f41_reflected table = etl::crc32_table_poly_0x1edc6f41_reflected();
+
+      while (begin != end)
+      {
+        crc = table.add(crc, *begin++);
+      }
+
+      return crc;
+    }
+
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+    //*************************************************************************
+    /// CRC32-C of a block, using the instructions the profile advertises.
+    //*************************************************************************
+    inline uint32_t crc32_c_hardware_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+    {
+      return hardware_add_block<crc32_c_instructions>(crc, begin, end);
+    }
+#elif defined(ETL_HAS_DISPATCHED_CRC32_C)
+    //*************************************************************************
+    /// CRC32-C of a block, using the SSE4.2 instructions.
+    /// Only called when the processor has them.
+    //*************************************************************************
+    ETL_TARGET_FEATURE("sse4.2")
+    inline uint32_t crc32_c_sse42_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+    {
+      while ((end - begin) >= 8)
+      {
+        uint64_t value;
+        memcpy(&value, begin, sizeof(value));
+
+  #if defined(__x86_64__) || defined(_M_X64)
+        crc = uint32_t(_mm_crc32_u64(crc, value));
+  #else
+        crc = _mm_crc32_u32(crc, uint32_t(value));
+        crc = _mm_crc32_u32(crc, uint32_t(value >> 32));
+  #endif
+        begin += 8;
+      }
+
+      while (begin != end)
+      {
+        crc = _mm_crc32_u8(crc, *begin++);
+      }
+
+      return crc;
+    }
+#endif
+
+    //*************************************************************************
+    /// The CRC32-C block function for this processor, selected on first use.
+    //*************************************************************************
+    inline crc32_block_function_t crc32_c_block_function()
+    {
+      static const etl::cpu_dispatch_candidate<crc32_block_function_t> candidates[] =
+      {
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+        { etl::cpu_features::NONE,  &crc32_c_hardware_block },
+#elif defined(ETL_HAS_DISPATCHED_CRC32_C)
+        { etl::cpu_features::SSE42, &crc32_c_sse42_block },
+#endif
+        { etl::cpu_features::NONE,  &crc32_c_table_block }
+      };
+
+      static const etl::cpu_dispatch<crc32_block_function_t> dispatch(candidates);
+
+      return dispatch.get();
+    }
+
+#if defined(ETL_HAS_HARDWARE_CRC32)
+    //*************************************************************************
+    /// CRC32 instructions.
+    //*************************************************************************
+    struct crc32_instructions
+    {
+      static uint32_t add8(uint32_t crc, uint8_t value)
+      {
+        return __crc32b(crc, value);
+      }
+
+      static uint32_t add64(uint32_t crc, uint64_t value)
+      {
+        return __crc32d(crc, value);
+      }
+    };
+#endif
+  }
+
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+  //***************************************************************************
+  /// Hardware add value for reflected poly 0x1EDC6F41.
+  //***************************************************************************
+  class crc32_hardware_poly_0x1edc6f41_reflected : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    //*************************************************************************
+    uint32_t add(uint32_t crc, uint8_t value) const
+    {
+      return etl::private_crc::crc32_c_instructions::add8(crc, value);
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t add_block(uint32_t crc, TIterator begin, const TIterator end) const
+    {
+      return etl::private_crc::hardware_add_block<etl::private_crc::crc32_c_instructions>(crc, begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Hardware CRC32 Poly 0x1EDC6F41 reflected policy.
+  //***************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  struct crc32_policy_hardware_poly_0x1edc6f41 : public crc32_hardware_poly_0x1edc6f41_reflected
+  {
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    ETL_CONSTEXPR uint32_t initial() const
+    {
+      return INITIAL;
+    }
+
+    //*************************************************************************
+    uint32_t final(uint32_t crc) const
+    {
+      return crc ^ XOR_OUT;
+    }
+  };
+
+  //*************************************************************************
+  /// Hardware CRC32 Poly 0x1EDC6F41 reflected.
+  //*************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  class crc32_poly_0x1edc6f41_hardware : public etl::frame_check_sequence<etl::crc32_policy_hardware_poly_0x1edc6f41<INITIAL, XOR_OUT> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_poly_0x1edc6f41_hardware()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_poly_0x1edc6f41_hardware(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+#endif
+
+#if defined(ETL_HAS_HARDWARE_CRC32)
+  //***************************************************************************
+  /// Hardware add value for reflected poly 0x04C11DB7.
+  //***************************************************************************
+  class crc32_hardware_poly_0x04c11db7_reflected : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    //*************************************************************************
+    uint32_t add(uint32_t crc, uint8_t value) const
+    {
+      return etl::private_crc::crc32_instructions::add8(crc, value);
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t add_block(uint32_t crc, TIterator begin, const TIterator end) const
+    {
+      return etl::private_crc::hardware_add_block<etl::private_crc::crc32_instructions>(crc, begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Hardware CRC32 Poly 0x04C11DB7 reflected policy.
+  //***************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  struct crc32_policy_hardware_poly_0x04c11db7 : public crc32_hardware_poly_0x04c11db7_reflected
+  {
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    ETL_CONSTEXPR uint32_t initial() const
+    {
+      return INITIAL;
+    }
+
+    //*************************************************************************
+    uint32_t final(uint32_t crc) const
+    {
+      return crc ^ XOR_OUT;
+    }
+  };
+
+  //*************************************************************************
+  /// Hardware CRC32 Poly 0x04C11DB7 reflected.
+  //*************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  class crc32_poly_0x04c11db7_hardware : public etl::frame_check_sequence<etl::crc32_policy_hardware_poly_0x04c11db7<INITIAL, XOR_OUT> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_poly_0x04c11db7_hardware()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_poly_0x04c11db7_hardware(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+#endif
+
+  //***************************************************************************
+  /// Run time dispatched add value for reflected poly 0x1EDC6F41.
+  //***************************************************************************
+  class crc32_dispatch_poly_0x1edc6f41_reflected : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    //*************************************************************************
+    uint32_t add(uint32_t crc, uint8_t value) const
+    {
+      return etl::crc32_table_poly_0x1edc6f41_reflected().add(crc, value);
+    }
+
+    //*************************************************************************
+    uint32_t add_block(uint32_t crc, const uint8_t* begin, const uint8_t* end) const
+    {
+      return etl::private_crc::crc32_c_block_function()(crc, begin, end);
+    }
+
+    //*************************************************************************
+    /// Copies the range to a local buffer, a chunk at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t add_block(uint32_t crc, TIterator begin, const TIterator end) const
+    {
+      const etl::private_crc::crc32_block_function_t function = etl::private_crc::crc32_c_block_function();
+
+      uint8_t chunk[64];
+
+      while (begin != end)
+      {
+        size_t count = 0U;
+
+        while ((count < sizeof(chunk)) && (begin != end))
+        {
+          chunk[count++] = static_cast<uint8_t>(*begin++);
+        }
+
+        crc = function(crc, chunk, chunk + count);
+      }
+
+      return crc;
+    }
+  };
+
+  //***************************************************************************
+  /// Run time dispatched CRC32 Poly 0x1EDC6F41 reflected policy.
+  //***************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  struct crc32_policy_dispatch_poly_0x1edc6f41 : public crc32_dispatch_poly_0x1edc6f41_reflected
+  {
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    ETL_CONSTEXPR uint32_t initial() const
+    {
+      return INITIAL;
+    }
+
+    //*************************************************************************
+    uint32_t final(uint32_t crc) const
+    {
+      return crc ^ XOR_OUT;
+    }
+  };
+
+  //*************************************************************************
+  /// Run time dispatched CRC32 Poly 0x1EDC6F41 reflected.
+  //*************************************************************************
+  template <const uint32_t INITIAL, const uint32_t XOR_OUT>
+  class crc32_poly_0x1edc6f41_dispatch : public etl::frame_check_sequence<etl::crc32_policy_dispatch_poly_0x1edc6f41<INITIAL, XOR_OUT> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_poly_0x1edc6f41_dispatch()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_poly_0x1edc6f41_dispatch(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
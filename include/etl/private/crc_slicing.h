@@ -0,0 +1,346 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_SLICING_INCLUDED
+#define ETL_CRC_SLICING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+#include "../frame_check_sequence.h"
+#include "../iterator.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup crc_slicing Slicing-by-N CRC calculation
+/// Processes several bytes per iteration using N lookup tables.
+/// The tables are generated at compile time for C++14 and above,
+/// otherwise they are generated on first use.
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Reverses the lowest 'WIDTH' bits of the value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 T reflect(T value, size_t width)
+    {
+      T result = 0;
+
+      for (size_t i = 0U; i < width; ++i)
+      {
+        result = T((result << 1) | (value & 1U));
+        value = T(value >> 1);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Shifts right, returning zero if the shift is not less than the width of the type.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 T safe_shift_right(T value, size_t shift)
+    {
+      return (shift < (sizeof(T) * CHAR_BIT)) ? T(value >> shift) : T(0);
+    }
+
+    //*************************************************************************
+    /// Shifts left, returning zero if the shift is not less than the width of the type.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 T safe_shift_left(T value, size_t shift)
+    {
+      return (shift < (sizeof(T) * CHAR_BIT)) ? T(value << shift) : T(0);
+    }
+  }
+
+  //***************************************************************************
+  /// A set of 'SLICES' 256 entry tables for slicing-by-N CRC calculation.
+  /// table[0] is the standard byte-wise table.
+  /// table[n] is the CRC of a byte followed by 'n' zero bytes.
+  ///\tparam T       The CRC value type.
+  ///\tparam POLY    The polynomial, in normal (non-reflected) form.
+  ///\tparam REFLECT Whether the CRC is reflected.
+  ///\tparam SLICES  The number of tables.
+  //***************************************************************************
+  template <typename T, const T POLY, const bool REFLECT, const size_t SLICES>
+  struct crc_slicing_table
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<T>::value, "Signed CRC type not supported");
+    ETL_STATIC_ASSERT(SLICES > 0U, "Number of slices must be greater than zero");
+
+    static ETL_CONST_OR_CONSTEXPR size_t WIDTH = sizeof(T) * CHAR_BIT;
+
+    //*************************************************************************
+    /// Generates the tables.
+    //*************************************************************************
+    ETL_CONSTEXPR14 crc_slicing_table()
+      : table()
+    {
+      const T top_bit = T(T(1U) << (WIDTH - 1U));
+      const T reflected_poly = etl::private_crc::reflect<T>(POLY, WIDTH);
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        T crc = 0;
+
+        if (REFLECT)
+        {
+          crc = T(i);
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            crc = (crc & 1U) ? T((crc >> 1) ^ reflected_poly) : T(crc >> 1);
+          }
+        }
+        else
+        {
+          crc = T(T(i) << (WIDTH - 8U));
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            crc = (crc & top_bit) ? T(T(crc << 1) ^ POLY) : T(crc << 1);
+          }
+        }
+
+        table[0][i] = crc;
+      }
+
+      for (size_t slice = 1U; slice < SLICES; ++slice)
+      {
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          const T previous = table[slice - 1U][i];
+
+          if (REFLECT)
+          {
+            table[slice][i] = T(etl::private_crc::safe_shift_right<T>(previous, 8U) ^ table[0][previous & 0xFFU]);
+          }
+          else
+          {
+            table[slice][i] = T(etl::private_crc::safe_shift_left<T>(previous, 8U) ^ table[0][(previous >> (WIDTH - 8U)) & 0xFFU]);
+          }
+        }
+      }
+    }
+
+    T table[SLICES][256];
+  };
+
+  //***************************************************************************
+  /// Slicing-by-N table and add value.
+  /// Derives from frame_check_sequence_block_tag so that frame_check_sequence
+  /// passes whole ranges to add_block.
+  //***************************************************************************
+  template <typename T, const T POLY, const bool REFLECT, const size_t SLICES>
+  class crc_table_slicing : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    typedef etl::crc_slicing_table<T, POLY, REFLECT, SLICES> table_type;
+
+    static ETL_CONST_OR_CONSTEXPR size_t WIDTH  = sizeof(T) * CHAR_BIT;
+    static ETL_CONST_OR_CONSTEXPR size_t BYTES  = sizeof(T);
+
+    //*************************************************************************
+    /// Adds a single byte.
+    //*************************************************************************
+    T add(T crc, uint8_t value) const
+    {
+      const table_type& t = tables();
+
+      if (REFLECT)
+      {
+        return T(etl::private_crc::safe_shift_right<T>(crc, 8U) ^ t.table[0][(crc ^ value) & 0xFFU]);
+      }
+      else
+      {
+        return T(etl::private_crc::safe_shift_left<T>(crc, 8U) ^ t.table[0][((crc >> (WIDTH - 8U)) ^ value) & 0xFFU]);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, 'SLICES' bytes at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    T add_block(T crc, TIterator begin, const TIterator end) const
+    {
+      uint8_t block[SLICES];
+
+      while (begin != end)
+      {
+        size_t count = 0U;
+
+        while ((count < SLICES) && (begin != end))
+        {
+          block[count++] = static_cast<uint8_t>(*begin++);
+        }
+
+        if (count == SLICES)
+        {
+          crc = add_slice(crc, block);
+        }
+        else
+        {
+          for (size_t i = 0U; i < count; ++i)
+          {
+            crc = add(crc, block[i]);
+          }
+        }
+      }
+
+      return crc;
+    }
+
+    //*************************************************************************
+    /// Gets the tables.
+    //*************************************************************************
+    static const table_type& tables()
+    {
+      static ETL_CONSTEXPR14 const table_type t;
+
+      return t;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds exactly 'SLICES' bytes.
+    //*************************************************************************
+    T add_slice(T crc, const uint8_t* block) const
+    {
+      const table_type& t = tables();
+
+      T result;
+
+      if (REFLECT)
+      {
+        result = etl::private_crc::safe_shift_right<T>(crc, 8U * SLICES);
+
+        for (size_t i = 0U; i < SLICES; ++i)
+        {
+          uint8_t index = block[i];
+
+          if (i < BYTES)
+          {
+            index ^= uint8_t(crc >> (8U * i));
+          }
+
+          result ^= t.table[SLICES - 1U - i][index];
+        }
+      }
+      else
+      {
+        result = etl::private_crc::safe_shift_left<T>(crc, 8U * SLICES);
+
+        for (size_t i = 0U; i < SLICES; ++i)
+        {
+          uint8_t index = block[i];
+
+          if (i < BYTES)
+          {
+            index ^= uint8_t(crc >> (WIDTH - 8U - (8U * i)));
+          }
+
+          result ^= t.table[SLICES - 1U - i][index];
+        }
+      }
+
+      return result;
+    }
+  };
+
+  //***************************************************************************
+  /// Slicing-by-N CRC policy.
+  //***************************************************************************
+  template <typename T, const T POLY, const T INITIAL, const T XOR_OUT, const bool REFLECT, const size_t SLICES>
+  struct crc_policy_slicing : public etl::crc_table_slicing<T, POLY, REFLECT, SLICES>
+  {
+    typedef T value_type;
+
+    //*************************************************************************
+    ETL_CONSTEXPR T initial() const
+    {
+      return INITIAL;
+    }
+
+    //*************************************************************************
+    T final(T crc) const
+    {
+      return crc ^ XOR_OUT;
+    }
+  };
+
+  //*************************************************************************
+  /// Slicing-by-N CRC.
+  ///\tparam T       The CRC value type.
+  ///\tparam POLY    The polynomial, in normal (non-reflected) form.
+  ///\tparam INITIAL The initial value.
+  ///\tparam XOR_OUT The value to XOR with the result.
+  ///\tparam REFLECT Whether the CRC is reflected.
+  ///\tparam SLICES  The number of bytes processed per iteration.
+  //*************************************************************************
+  template <typename T, const T POLY, const T INITIAL, const T XOR_OUT, const bool REFLECT, const size_t SLICES>
+  class crc_slicing : public etl::frame_check_sequence<etl::crc_policy_slicing<T, POLY, INITIAL, XOR_OUT, REFLECT, SLICES> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_slicing()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc_slicing(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,288 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ESCAPE_FRAMING_INCLUDED
+#define ETL_ESCAPE_FRAMING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "framing_common.h"
+
+namespace etl
+{
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// An encoder for framing that delimits frames with a flag byte and
+    /// escapes flag and escape bytes in the data, such as SLIP and HDLC.
+    /// Runs of bytes that need no escape are found four bytes at a time and
+    /// copied and checked together.
+    ///\tparam TTraits     Defines DELIMITER, ESCAPE and 'uint8_t escape(uint8_t)'.
+    ///\tparam TFrameCheck The frame check sequence appended to each frame.
+    //*************************************************************************
+    template <typename TTraits, typename TFrameCheck>
+    class escape_encoder
+    {
+    public:
+
+      static const size_t FCS_SIZE = fcs_size<TFrameCheck>::value;
+
+      //***********************************************************************
+      /// The largest possible encoding of 'n' bytes, including the delimiters
+      /// and frame check sequence.
+      //***********************************************************************
+      static size_t max_encoded_size(size_t n)
+      {
+        return 2U + (2U * (n + FCS_SIZE));
+      }
+
+      //***********************************************************************
+      /// Starts a frame.
+      //***********************************************************************
+      template <typename TOutputIterator>
+      TOutputIterator begin(TOutputIterator out)
+      {
+        fcs.reset();
+        *out++ = uint8_t(TTraits::DELIMITER);
+
+        return out;
+      }
+
+      //***********************************************************************
+      /// Adds data to the frame. May be called any number of times.
+      //***********************************************************************
+      template <typename TOutputIterator>
+      TOutputIterator add(const uint8_t* begin, const uint8_t* end, TOutputIterator out)
+      {
+        return stuff(begin, end, out, true);
+      }
+
+      //***********************************************************************
+      /// Ends the frame, appending the frame check sequence.
+      //***********************************************************************
+      template <typename TOutputIterator>
+      TOutputIterator end(TOutputIterator out)
+      {
+        uint8_t trailer[FCS_SIZE + 1U];
+
+        store_fcs(fcs.value(), trailer, FCS_SIZE);
+
+        out    = stuff(trailer, trailer + FCS_SIZE, out, false);
+        *out++ = uint8_t(TTraits::DELIMITER);
+
+        return out;
+      }
+
+      //***********************************************************************
+      /// Encodes a whole frame.
+      //***********************************************************************
+      template <typename TOutputIterator>
+      TOutputIterator encode(const uint8_t* begin_, const uint8_t* end_, TOutputIterator out)
+      {
+        out = begin(out);
+        out = add(begin_, end_, out);
+
+        return end(out);
+      }
+
+    private:
+
+      //***********************************************************************
+      template <typename TOutputIterator>
+      TOutputIterator stuff(const uint8_t* begin, const uint8_t* end, TOutputIterator out, bool check)
+      {
+        while (begin != end)
+        {
+          const uint8_t* special = find_either(begin, end, uint8_t(TTraits::DELIMITER), uint8_t(TTraits::ESCAPE));
+
+          if (check)
+          {
+            fcs.add(begin, special);
+          }
+
+          out   = etl::copy(begin, special, out);
+          begin = special;
+
+          if (begin != end)
+          {
+            if (check)
+            {
+              fcs.add(*begin);
+            }
+
+            *out++ = uint8_t(TTraits::ESCAPE);
+            *out++ = TTraits::escape(*begin++);
+          }
+        }
+
+        return out;
+      }
+
+      TFrameCheck fcs;
+    };
+
+    //*************************************************************************
+    /// A decoder for framing that delimits frames with a flag byte and
+    /// escapes flag and escape bytes in the data, such as SLIP and HDLC.
+    /// Data may be passed in chunks of any size, such as from an interrupt.
+    /// Decoded data is written straight to the user's buffer.
+    ///\tparam TTraits     Defines DELIMITER, ESCAPE and 'bool unescape(uint8_t, uint8_t&)'.
+    ///\tparam TFrameCheck The frame check sequence at the end of each frame.
+    //*************************************************************************
+    template <typename TTraits, typename TFrameCheck>
+    class escape_decoder
+    {
+    public:
+
+      //***********************************************************************
+      /// Constructor.
+      ///\param buffer   The buffer for decoded frames.
+      ///\param capacity The size of the buffer, including the frame check sequence.
+      //***********************************************************************
+      escape_decoder(uint8_t* buffer, size_t capacity)
+        : frame(buffer, capacity)
+      {
+        reset();
+      }
+
+      //***********************************************************************
+      /// Decodes data until the end of a frame or the end of the data.
+      /// Returns a pointer to the first byte not used. If status() is then
+      /// not INCOMPLETE, a frame has ended; the next call starts a new one.
+      /// Empty frames, such as from back to back delimiters, are skipped.
+      //***********************************************************************
+      const uint8_t* decode(const uint8_t* begin, const uint8_t* end)
+      {
+        if (current != framing_status::INCOMPLETE)
+        {
+          reset();
+        }
+
+        while (begin != end)
+        {
+          if (escaped)
+          {
+            escaped = false;
+
+            const uint8_t value = *begin++;
+
+            if (value == TTraits::DELIMITER)
+            {
+              // An aborted frame.
+              current = framing_status::FORMAT_ERROR;
+              return begin;
+            }
+
+            uint8_t unescaped;
+
+            if (TTraits::unescape(value, unescaped))
+            {
+              frame.append(unescaped);
+            }
+            else
+            {
+              invalid = true;
+            }
+          }
+          else
+          {
+            const uint8_t* special = find_either(begin, end, uint8_t(TTraits::DELIMITER), uint8_t(TTraits::ESCAPE));
+
+            frame.append(begin, special);
+            begin = special;
+
+            if (begin != end)
+            {
+              if (*begin++ == TTraits::ESCAPE)
+              {
+                escaped = true;
+              }
+              else if (invalid || !frame.empty())
+              {
+                current = invalid ? framing_status::FORMAT_ERROR : frame.finish();
+                return begin;
+              }
+            }
+          }
+        }
+
+        return end;
+      }
+
+      //***********************************************************************
+      /// Discards any partly decoded frame.
+      //***********************************************************************
+      void reset()
+      {
+        frame.clear();
+        current = framing_status::INCOMPLETE;
+        escaped = false;
+        invalid = false;
+      }
+
+      //***********************************************************************
+      /// The state of the current frame.
+      //***********************************************************************
+      framing_status::enum_type status() const
+      {
+        return current;
+      }
+
+      //***********************************************************************
+      /// The decoded data, without the frame check sequence.
+      //***********************************************************************
+      const uint8_t* data() const
+      {
+        return frame.data();
+      }
+
+      //***********************************************************************
+      /// The size of the decoded data, without the frame check sequence.
+      /// Only meaningful once status() is COMPLETE.
+      //***********************************************************************
+      size_t size() const
+      {
+        return frame.size();
+      }
+
+    private:
+
+      frame_buffer<TFrameCheck> frame;
+      framing_status::enum_type current;
+      bool                      escaped;
+      bool                      invalid;
+    };
+  }
+}
+
+#endif
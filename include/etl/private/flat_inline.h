@@ -0,0 +1,77 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_FLAT_INLINE_INCLUDED
+#define ETL_FLAT_INLINE_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../memory.h"
+#include "../utility.h"
+
+namespace etl
+{
+  namespace private_flat_inline
+  {
+    //*************************************************************************
+    /// Opens a gap at 'index' in an array of 'size' constructed items.
+    /// The slot at 'size' must be uninitialised.
+    /// The gap is left holding a moved from item, ready to be assigned.
+    //*************************************************************************
+    template <typename T>
+    void open_gap(T* p, size_t index, size_t size)
+    {
+#if ETL_CPP11_SUPPORTED
+      ::new (p + size) T(etl::move(p[size - 1U]));
+#else
+      ::new (p + size) T(p[size - 1U]);
+#endif
+      etl::move_backward(p + index, p + size - 1U, p + size);
+    }
+
+    //*************************************************************************
+    /// Closes a gap of 'n' items at 'index' in an array of 'size' constructed
+    /// items, and destroys the unused items at the end.
+    //*************************************************************************
+    template <typename T>
+    void close_gap(T* p, size_t index, size_t n, size_t size)
+    {
+      etl::move(p + index + n, p + size, p + index);
+      etl::destroy(p + size - n, p + size);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,177 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MERGE_INCLUDED
+#define ETL_FLAT_MERGE_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../nullptr.h"
+
+namespace etl
+{
+  namespace private_flat_merge
+  {
+    //*************************************************************************
+    /// Compares map elements by key.
+    //*************************************************************************
+    template <typename TKeyCompare>
+    struct first_compare
+    {
+      template <typename T1, typename T2>
+      bool operator ()(const T1& lhs, const T2& rhs) const
+      {
+        return compare(lhs.first, rhs.first);
+      }
+
+      TKeyCompare compare;
+    };
+
+    //*************************************************************************
+    /// Stores the address of an element, for the reference containers.
+    //*************************************************************************
+    template <typename TValue>
+    struct address_of
+    {
+      TValue* operator ()(TValue& value) const
+      {
+        return &value;
+      }
+    };
+
+    //*************************************************************************
+    /// Counts the elements of the sorted range [first, last) that a merge
+    /// into the sorted lookup would add.
+    /// For unique containers, elements already in the lookup or repeated in
+    /// the range are not counted.
+    //*************************************************************************
+    template <typename TLookup, typename TIterator, typename TCompare>
+    size_t count_new(const TLookup& lookup, TIterator first, TIterator last, TCompare compare, bool unique)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type input_t;
+
+      if (!unique)
+      {
+        return size_t(etl::distance(first, last));
+      }
+
+      const size_t   size       = lookup.size();
+      size_t         index      = 0U;
+      size_t         count      = 0U;
+      const input_t* p_previous = nullptr;
+
+      while (first != last)
+      {
+        const input_t& value = *first;
+
+        if ((p_previous == nullptr) || compare(*p_previous, value))
+        {
+          while ((index < size) && compare(*lookup[index], value))
+          {
+            ++index;
+          }
+
+          if ((index == size) || compare(value, *lookup[index]))
+          {
+            ++count;
+          }
+        }
+
+        p_previous = &value;
+        ++first;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Merges the sorted range [first, last) into the sorted lookup.
+    /// 'n_new' is the result of count_new and must fit in the lookup.
+    /// The existing pointers are moved up by 'n_new' in one step, and then
+    /// merged forward with the range, so each element moves once.
+    /// Equal elements keep the existing ones first.
+    /// 'create' returns the pointer to store for an element of the range.
+    //*************************************************************************
+    template <typename TLookup, typename TIterator, typename TCompare, typename TCreate>
+    void merge(TLookup& lookup, TIterator first, TIterator last, size_t n_new, TCompare compare, bool unique, TCreate create)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type input_t;
+
+      if (n_new == 0U)
+      {
+        return;
+      }
+
+      const size_t size = lookup.size() + n_new;
+
+      lookup.resize(size);
+      etl::move_backward(lookup.begin(), lookup.end() - n_new, lookup.end());
+
+      size_t         read       = n_new;
+      size_t         write      = 0U;
+      const input_t* p_previous = nullptr;
+
+      while (first != last)
+      {
+        const input_t& value = *first;
+
+        // Skip repeats in the range.
+        if (unique && (p_previous != nullptr) && !compare(*p_previous, value))
+        {
+          ++first;
+          continue;
+        }
+
+        p_previous = &value;
+
+        // Existing elements that go before this one.
+        while ((read < size) && (unique ? compare(*lookup[read], value) : !compare(value, *lookup[read])))
+        {
+          lookup[write++] = lookup[read++];
+        }
+
+        // Skip elements already present.
+        if (!unique || (read == size) || compare(value, *lookup[read]))
+        {
+          lookup[write++] = create(*first);
+        }
+
+        ++first;
+      }
+
+      // The remaining existing elements are already in place.
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,314 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FRAMING_COMMON_INCLUDED
+#define ETL_FRAMING_COMMON_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../algorithm.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// The state of a framing decoder.
+    //***************************************************************************
+  struct framing_status
+  {
+    enum enum_type
+    {
+      INCOMPLETE,   ///< More data is needed to complete the frame.
+      COMPLETE,     ///< A frame has been decoded and its frame check sequence is correct.
+      FCS_ERROR,    ///< A frame has been decoded but its frame check sequence is wrong.
+      FORMAT_ERROR, ///< The frame was not correctly encoded.
+      BUFFER_FULL   ///< The frame was too large for the buffer.
+    };
+  };
+
+  //***************************************************************************
+  /// A frame check that does nothing, for frames without a trailer.
+    //***************************************************************************
+  class no_frame_check
+  {
+  public:
+
+    typedef uint8_t value_type;
+
+    void reset()
+    {
+    }
+
+    template <typename TIterator>
+    void add(TIterator, TIterator)
+    {
+    }
+
+    void add(uint8_t)
+    {
+    }
+
+    value_type value()
+    {
+      return 0U;
+    }
+  };
+
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// The number of bytes of the frame check sequence in a frame.
+    //*************************************************************************
+    template <typename TFrameCheck>
+    struct fcs_size
+    {
+      static const size_t value = sizeof(typename TFrameCheck::value_type);
+    };
+
+    template <>
+    struct fcs_size<etl::no_frame_check>
+    {
+      static const size_t value = 0U;
+    };
+
+    //*************************************************************************
+    /// Finds the first 'a' in [begin, end), using memchr.
+    //*************************************************************************
+    inline const uint8_t* find_byte(const uint8_t* begin, const uint8_t* end, uint8_t a)
+    {
+      const void* p = memchr(begin, a, size_t(end - begin));
+
+      return (p == nullptr) ? end : static_cast<const uint8_t*>(p);
+    }
+
+    //*************************************************************************
+    /// Finds the first 'a' or 'b' in [begin, end).
+    /// Tests four bytes at a time for either value.
+    //*************************************************************************
+    inline const uint8_t* find_either(const uint8_t* begin, const uint8_t* end, uint8_t a, uint8_t b)
+    {
+      const uint32_t ones  = 0x01010101UL;
+      const uint32_t highs = 0x80808080UL;
+      const uint32_t fa    = ones * a;
+      const uint32_t fb    = ones * b;
+
+      while ((end - begin) >= 4)
+      {
+        uint32_t word;
+        memcpy(&word, begin, sizeof(word));
+
+        const uint32_t xa = word ^ fa;
+        const uint32_t xb = word ^ fb;
+
+        if ((((xa - ones) & ~xa) | ((xb - ones) & ~xb)) & highs)
+        {
+          break;
+        }
+
+        begin += 4;
+      }
+
+      while ((begin != end) && (*begin != a) && (*begin != b))
+      {
+        ++begin;
+      }
+
+      return begin;
+    }
+
+    //*************************************************************************
+    /// Writes the frame check sequence, least significant byte first.
+    //*************************************************************************
+    template <typename TValue>
+    void store_fcs(TValue value, uint8_t* p, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p[i] = uint8_t(value);
+        value = TValue(value >> 8U);
+      }
+    }
+
+    //*************************************************************************
+    /// Reads the frame check sequence, least significant byte first.
+    //*************************************************************************
+    template <typename TValue>
+    TValue load_fcs(const uint8_t* p, size_t n)
+    {
+      TValue value = 0U;
+
+      for (size_t i = n; i != 0U; --i)
+      {
+        value = TValue((value << 8U) | p[i - 1U]);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The decoded frame, written in to a buffer supplied by the user.
+    /// The frame check is calculated as the data is stored, trailing by the
+    /// size of the trailer, so that the trailer is not included.
+    //*************************************************************************
+    template <typename TFrameCheck>
+    class frame_buffer
+    {
+    public:
+
+      static const size_t FCS_SIZE = fcs_size<TFrameCheck>::value;
+
+      //***********************************************************************
+      frame_buffer(uint8_t* buffer_, size_t capacity_)
+        : buffer(buffer_)
+        , capacity(capacity_)
+      {
+        clear();
+      }
+
+      //***********************************************************************
+      /// Starts a new frame.
+      //***********************************************************************
+      void clear()
+      {
+        length     = 0U;
+        checked    = 0U;
+        overflowed = false;
+        fcs.reset();
+      }
+
+      //***********************************************************************
+      /// Appends a run of bytes.
+      //***********************************************************************
+      void append(const uint8_t* begin, const uint8_t* end)
+      {
+        const size_t n = size_t(end - begin);
+
+        if (n > (capacity - length))
+        {
+          overflowed = true;
+        }
+
+        if (!overflowed)
+        {
+          memcpy(buffer + length, begin, n);
+          length += n;
+          check();
+        }
+      }
+
+      //***********************************************************************
+      /// Appends a byte.
+      //***********************************************************************
+      void append(uint8_t value)
+      {
+        if (length == capacity)
+        {
+          overflowed = true;
+        }
+
+        if (!overflowed)
+        {
+          buffer[length++] = value;
+          check();
+        }
+      }
+
+      //***********************************************************************
+      /// True if nothing has been stored since the last clear.
+      //***********************************************************************
+      bool empty() const
+      {
+        return (length == 0U) && !overflowed;
+      }
+
+      //***********************************************************************
+      /// Ends the frame and checks the trailer.
+      /// On success, the trailer is removed from the frame.
+      //***********************************************************************
+      framing_status::enum_type finish()
+      {
+        if (overflowed)
+        {
+          return framing_status::BUFFER_FULL;
+        }
+
+        if (length < FCS_SIZE)
+        {
+          return framing_status::FORMAT_ERROR;
+        }
+
+        length -= FCS_SIZE;
+
+        typedef typename TFrameCheck::value_type value_type;
+
+        const value_type expected = load_fcs<value_type>(buffer + length, FCS_SIZE);
+
+        return (fcs.value() == expected) ? framing_status::COMPLETE : framing_status::FCS_ERROR;
+      }
+
+      //***********************************************************************
+      const uint8_t* data() const
+      {
+        return buffer;
+      }
+
+      //***********************************************************************
+      size_t size() const
+      {
+        return length;
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Adds the bytes that can no longer be part of the trailer.
+      //***********************************************************************
+      void check()
+      {
+        if (length > (checked + FCS_SIZE))
+        {
+          fcs.add(buffer + checked, buffer + length - FCS_SIZE);
+          checked = length - FCS_SIZE;
+        }
+      }
+
+      uint8_t* const buffer;
+      const size_t   capacity;
+      size_t         length;
+      size_t         checked;
+      bool           overflowed;
+      TFrameCheck    fcs;
+    };
+  }
+}
+
+#endif
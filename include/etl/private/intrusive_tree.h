@@ -0,0 +1,1036 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_TREE_INCLUDED
+#define ETL_INTRUSIVE_TREE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../functional.h"
+#include "../utility.h"
+#include "../iterator.h"
+#include "../intrusive_links.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base for the intrusive ordered containers.
+  /// An AVL tree of etl::tree_link, with parent pointers so that any linked
+  /// element can be removed, and iterated from, without a search.
+  ///\tparam TLink The etl::tree_link type that the values are derived from.
+  //***************************************************************************
+  template <typename TLink>
+  class intrusive_tree_base
+  {
+  public:
+
+    // Link typedef.
+    typedef TLink link_type;
+
+    //*************************************************************************
+    /// Unlinks every element.
+    /// The links of the elements are not cleared.
+    //*************************************************************************
+    void clear()
+    {
+      p_root       = nullptr;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_root == nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_tree_base()
+      : p_root(nullptr)
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_tree_base()
+    {
+    }
+
+    //*************************************************************************
+    /// The left-most link of the subtree.
+    //*************************************************************************
+    static link_type* first_in(link_type* p_link)
+    {
+      while (p_link->etl_left != nullptr)
+      {
+        p_link = p_link->etl_left;
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// The right-most link of the subtree.
+    //*************************************************************************
+    static link_type* last_in(link_type* p_link)
+    {
+      while (p_link->etl_right != nullptr)
+      {
+        p_link = p_link->etl_right;
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// The in-order successor, or nullptr.
+    //*************************************************************************
+    static link_type* next_link(link_type* p_link)
+    {
+      if (p_link->etl_right != nullptr)
+      {
+        return first_in(p_link->etl_right);
+      }
+
+      link_type* p_parent = p_link->etl_parent;
+
+      while ((p_parent != nullptr) && (p_link == p_parent->etl_right))
+      {
+        p_link   = p_parent;
+        p_parent = p_parent->etl_parent;
+      }
+
+      return p_parent;
+    }
+
+    //*************************************************************************
+    /// The in-order predecessor, or nullptr.
+    //*************************************************************************
+    static link_type* previous_link(link_type* p_link)
+    {
+      if (p_link->etl_left != nullptr)
+      {
+        return last_in(p_link->etl_left);
+      }
+
+      link_type* p_parent = p_link->etl_parent;
+
+      while ((p_parent != nullptr) && (p_link == p_parent->etl_left))
+      {
+        p_link   = p_parent;
+        p_parent = p_parent->etl_parent;
+      }
+
+      return p_parent;
+    }
+
+    //*************************************************************************
+    /// The first link, or nullptr if empty.
+    //*************************************************************************
+    link_type* first_link() const
+    {
+      return (p_root == nullptr) ? nullptr : first_in(p_root);
+    }
+
+    //*************************************************************************
+    /// The last link, or nullptr if empty.
+    //*************************************************************************
+    link_type* last_link() const
+    {
+      return (p_root == nullptr) ? nullptr : last_in(p_root);
+    }
+
+    //*************************************************************************
+    /// Links a new leaf below 'p_parent', or as the root if 'p_parent' is nullptr,
+    /// then restores the balance.
+    //*************************************************************************
+    void link_leaf(link_type* p_parent, bool is_left, link_type& link)
+    {
+      link.clear();
+      link.etl_parent = p_parent;
+
+      if (p_parent == nullptr)
+      {
+        p_root = &link;
+      }
+      else if (is_left)
+      {
+        p_parent->etl_left = &link;
+      }
+      else
+      {
+        p_parent->etl_right = &link;
+      }
+
+      ++current_size;
+
+      // Retrace towards the root until a subtree's height is unchanged.
+      link_type* p_child = &link;
+
+      while (p_parent != nullptr)
+      {
+        p_parent->etl_balance += (p_child == p_parent->etl_left) ? -1 : 1;
+
+        if (p_parent->etl_balance == 0)
+        {
+          break;
+        }
+
+        if ((p_parent->etl_balance == 2) || (p_parent->etl_balance == -2))
+        {
+          rebalance(p_parent);
+          break;
+        }
+
+        p_child  = p_parent;
+        p_parent = p_parent->etl_parent;
+      }
+    }
+
+    //*************************************************************************
+    /// Unlinks an element, then restores the balance.
+    //*************************************************************************
+    void unlink(link_type& link)
+    {
+      link_type* p_retrace;
+      bool       from_left;
+
+      if ((link.etl_left != nullptr) && (link.etl_right != nullptr))
+      {
+        // Replace the link with its successor, which has no left child.
+        link_type* p_successor = first_in(link.etl_right);
+
+        if (p_successor->etl_parent == &link)
+        {
+          p_retrace = p_successor;
+          from_left = false;
+        }
+        else
+        {
+          p_retrace = p_successor->etl_parent;
+          from_left = true;
+
+          p_retrace->etl_left = p_successor->etl_right;
+
+          if (p_successor->etl_right != nullptr)
+          {
+            p_successor->etl_right->etl_parent = p_retrace;
+          }
+
+          p_successor->etl_right           = link.etl_right;
+          link.etl_right->etl_parent       = p_successor;
+        }
+
+        p_successor->etl_left            = link.etl_left;
+        link.etl_left->etl_parent        = p_successor;
+        p_successor->etl_balance         = link.etl_balance;
+        replace_child(link.etl_parent, &link, p_successor);
+      }
+      else
+      {
+        link_type* p_child = (link.etl_left != nullptr) ? link.etl_left : link.etl_right;
+
+        p_retrace = link.etl_parent;
+        from_left = (p_retrace != nullptr) && (p_retrace->etl_left == &link);
+
+        replace_child(p_retrace, &link, p_child);
+      }
+
+      link.clear();
+      --current_size;
+
+      // Retrace towards the root until a subtree's height is unchanged.
+      while (p_retrace != nullptr)
+      {
+        p_retrace->etl_balance += from_left ? 1 : -1;
+
+        if ((p_retrace->etl_balance == 1) || (p_retrace->etl_balance == -1))
+        {
+          break;
+        }
+
+        if (p_retrace->etl_balance != 0)
+        {
+          link_type* p_sibling = (p_retrace->etl_balance > 0) ? p_retrace->etl_right : p_retrace->etl_left;
+          const bool height_unchanged = (p_sibling->etl_balance == 0);
+
+          p_retrace = rebalance(p_retrace);
+
+          if (height_unchanged)
+          {
+            break;
+          }
+        }
+
+        link_type* p_child = p_retrace;
+        p_retrace = p_retrace->etl_parent;
+        from_left = (p_retrace != nullptr) && (p_retrace->etl_left == p_child);
+      }
+    }
+
+    link_type* p_root;       ///< The root of the tree.
+    size_t     current_size; ///< The number of linked elements.
+
+  private:
+
+    //*************************************************************************
+    /// Points the parent, or the root, at the replacement child.
+    //*************************************************************************
+    void replace_child(link_type* p_parent, link_type* p_old, link_type* p_new)
+    {
+      if (p_new != nullptr)
+      {
+        p_new->etl_parent = p_parent;
+      }
+
+      if (p_parent == nullptr)
+      {
+        p_root = p_new;
+      }
+      else if (p_parent->etl_left == p_old)
+      {
+        p_parent->etl_left = p_new;
+      }
+      else
+      {
+        p_parent->etl_right = p_new;
+      }
+    }
+
+    //*************************************************************************
+    /// Rotates the right child of 'p_link' into its place.
+    //*************************************************************************
+    link_type* rotate_left(link_type* p_link)
+    {
+      link_type* p_pivot = p_link->etl_right;
+
+      p_link->etl_right = p_pivot->etl_left;
+
+      if (p_pivot->etl_left != nullptr)
+      {
+        p_pivot->etl_left->etl_parent = p_link;
+      }
+
+      replace_child(p_link->etl_parent, p_link, p_pivot);
+
+      p_pivot->etl_left  = p_link;
+      p_link->etl_parent = p_pivot;
+
+      p_link->etl_balance  = int_least8_t(p_link->etl_balance - 1 - ((p_pivot->etl_balance > 0) ? p_pivot->etl_balance : 0));
+      p_pivot->etl_balance = int_least8_t(p_pivot->etl_balance - 1 + ((p_link->etl_balance < 0) ? p_link->etl_balance : 0));
+
+      return p_pivot;
+    }
+
+    //*************************************************************************
+    /// Rotates the left child of 'p_link' into its place.
+    //*************************************************************************
+    link_type* rotate_right(link_type* p_link)
+    {
+      link_type* p_pivot = p_link->etl_left;
+
+      p_link->etl_left = p_pivot->etl_right;
+
+      if (p_pivot->etl_right != nullptr)
+      {
+        p_pivot->etl_right->etl_parent = p_link;
+      }
+
+      replace_child(p_link->etl_parent, p_link, p_pivot);
+
+      p_pivot->etl_right = p_link;
+      p_link->etl_parent = p_pivot;
+
+      p_link->etl_balance  = int_least8_t(p_link->etl_balance + 1 - ((p_pivot->etl_balance < 0) ? p_pivot->etl_balance : 0));
+      p_pivot->etl_balance = int_least8_t(p_pivot->etl_balance + 1 + ((p_link->etl_balance > 0) ? p_link->etl_balance : 0));
+
+      return p_pivot;
+    }
+
+    //*************************************************************************
+    /// Rebalances a subtree with a balance factor of +/-2.
+    ///\return The new root of the subtree.
+    //*************************************************************************
+    link_type* rebalance(link_type* p_link)
+    {
+      if (p_link->etl_balance > 0)
+      {
+        if (p_link->etl_right->etl_balance < 0)
+        {
+          rotate_right(p_link->etl_right);
+        }
+
+        return rotate_left(p_link);
+      }
+      else
+      {
+        if (p_link->etl_left->etl_balance > 0)
+        {
+          rotate_left(p_link->etl_left);
+        }
+
+        return rotate_right(p_link);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_tree_base(const intrusive_tree_base&);
+    intrusive_tree_base& operator =(const intrusive_tree_base&);
+  };
+
+  namespace private_intrusive_tree
+  {
+    //*************************************************************************
+    /// The key of a set element is the element.
+    //*************************************************************************
+    template <typename TValue>
+    struct identity_key
+    {
+      typedef TValue key_type;
+
+      const TValue& operator()(const TValue& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Adds the key type to a map's key functor.
+    //*************************************************************************
+    template <typename TKey, typename TKeyOf>
+    struct key_of : public TKeyOf
+    {
+      typedef TKey key_type;
+    };
+  }
+
+  //***************************************************************************
+  /// The typed interface shared by the intrusive ordered containers.
+  ///\tparam TValue   The type of value that the tree holds.
+  ///\tparam TLink    The etl::tree_link type that the value is derived from.
+  ///\tparam TKeyOf   A functor that returns the key of a value. Must define 'key_type'.
+  ///\tparam TCompare The key ordering functor.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename TKeyOf, typename TCompare>
+  class iintrusive_tree : public etl::intrusive_tree_base<TLink>
+  {
+  private:
+
+    typedef etl::intrusive_tree_base<TLink> base_t;
+
+  public:
+
+    typedef TLink                     link_type;
+    typedef TValue                    value_type;
+    typedef typename TKeyOf::key_type key_type;
+    typedef TKeyOf                    key_of;
+    typedef TCompare                  key_compare;
+    typedef value_type&               reference;
+    typedef const value_type&         const_reference;
+    typedef value_type*               pointer;
+    typedef const value_type*         const_pointer;
+    typedef size_t                    size_type;
+
+    class const_iterator;
+
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iintrusive_tree;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(nullptr)
+        , p_link(nullptr)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_link = base_t::next_link(p_link);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_link = (p_link == nullptr) ? p_tree->last_link() : base_t::previous_link(p_link);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        operator--();
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return *static_cast<pointer>(p_link);
+      }
+
+      pointer operator ->() const
+      {
+        return static_cast<pointer>(p_link);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_link == rhs.p_link;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(const iintrusive_tree* p_tree_, link_type* p_link_)
+        : p_tree(p_tree_)
+        , p_link(p_link_)
+      {
+      }
+
+      const iintrusive_tree* p_tree;
+      link_type*             p_link;
+    };
+
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iintrusive_tree;
+
+      const_iterator()
+        : p_tree(nullptr)
+        , p_link(nullptr)
+      {
+      }
+
+      const_iterator(const typename iintrusive_tree::iterator& other)
+        : p_tree(other.p_tree)
+        , p_link(other.p_link)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        p_link = base_t::next_link(p_link);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        p_link = (p_link == nullptr) ? p_tree->last_link() : base_t::previous_link(p_link);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        operator--();
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return *static_cast<const_pointer>(p_link);
+      }
+
+      const_pointer operator ->() const
+      {
+        return static_cast<const_pointer>(p_link);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_link == rhs.p_link;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const iintrusive_tree* p_tree_, link_type* p_link_)
+        : p_tree(p_tree_)
+        , p_link(p_link_)
+      {
+      }
+
+      const iintrusive_tree* p_tree;
+      link_type*             p_link;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, this->first_link());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, this->first_link());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, nullptr);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, nullptr);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the first element. Undefined behaviour if empty.
+    //*************************************************************************
+    reference front()
+    {
+      return *begin();
+    }
+
+    //*************************************************************************
+    /// Gets the first element. Undefined behaviour if empty.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *begin();
+    }
+
+    //*************************************************************************
+    /// Gets the last element. Undefined behaviour if empty.
+    //*************************************************************************
+    reference back()
+    {
+      return *static_cast<pointer>(this->last_link());
+    }
+
+    //*************************************************************************
+    /// Gets the last element. Undefined behaviour if empty.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return *static_cast<const_pointer>(this->last_link());
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to a linked element.
+    //*************************************************************************
+    iterator iterator_to(value_type& value)
+    {
+      return iterator(this, &static_cast<link_type&>(value));
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to a linked element.
+    //*************************************************************************
+    const_iterator iterator_to(const value_type& value) const
+    {
+      return const_iterator(this, const_cast<link_type*>(&static_cast<const link_type&>(value)));
+    }
+
+    //*************************************************************************
+    /// Finds an element with the key.
+    ///\return An iterator to the element, or end() if not found.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !key_compare()(key, key_of()(*itr))) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Finds an element with the key.
+    ///\return A const_iterator to the element, or end() if not found.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !key_compare()(key, key_of()(*itr))) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      size_t n = 0U;
+
+      for (const_iterator itr = lower_bound(key); (itr != end()) && !key_compare()(key, key_of()(*itr)); ++itr)
+      {
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets the first element not ordered before the key.
+    //*************************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return iterator(this, lower_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Gets the first element not ordered before the key.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(this, lower_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Gets the first element ordered after the key.
+    //*************************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      return iterator(this, upper_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Gets the first element ordered after the key.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(this, upper_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Gets the range of elements with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Gets the range of elements with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Unlinks the element at the position.
+    ///\return An iterator to the next element.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      link_type* p_link = position.p_link;
+      iterator   next(this, base_t::next_link(p_link));
+
+      this->unlink(*p_link);
+
+      return next;
+    }
+
+    //*************************************************************************
+    /// Unlinks the elements in the range.
+    ///\return An iterator to the next element.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(this, last.p_link);
+    }
+
+    //*************************************************************************
+    /// Unlinks the elements with the key.
+    ///\return The number of elements unlinked.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      size_t n = 0U;
+
+      iterator itr = lower_bound(key);
+
+      while ((itr != end()) && !key_compare()(key, key_of()(*itr)))
+      {
+        itr = erase(itr);
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Unlinks the element.
+    //*************************************************************************
+    void remove(value_type& value)
+    {
+      this->unlink(value);
+    }
+
+    //*************************************************************************
+    /// Returns the key ordering functor.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iintrusive_tree()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iintrusive_tree()
+    {
+    }
+
+    //*************************************************************************
+    /// Links the value if no element has an equal key.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_unique(value_type& value)
+    {
+      const key_type& key = key_of()(value);
+
+      link_type* p_parent = nullptr;
+      link_type* p_link   = this->p_root;
+      bool       is_left  = true;
+
+      while (p_link != nullptr)
+      {
+        p_parent = p_link;
+
+        const key_type& link_key = key_of()(*static_cast<const_pointer>(p_link));
+
+        if (key_compare()(key, link_key))
+        {
+          is_left = true;
+          p_link  = p_link->etl_left;
+        }
+        else if (key_compare()(link_key, key))
+        {
+          is_left = false;
+          p_link  = p_link->etl_right;
+        }
+        else
+        {
+          return ETL_OR_STD::pair<iterator, bool>(iterator(this, p_link), false);
+        }
+      }
+
+      this->link_leaf(p_parent, is_left, value);
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, &static_cast<link_type&>(value)), true);
+    }
+
+    //*************************************************************************
+    /// Links the value after any elements with an equal key.
+    //*************************************************************************
+    iterator insert_equal(value_type& value)
+    {
+      const key_type& key = key_of()(value);
+
+      link_type* p_parent = nullptr;
+      link_type* p_link   = this->p_root;
+      bool       is_left  = true;
+
+      while (p_link != nullptr)
+      {
+        p_parent = p_link;
+        is_left  = key_compare()(key, key_of()(*static_cast<const_pointer>(p_link)));
+        p_link   = is_left ? p_link->etl_left : p_link->etl_right;
+      }
+
+      this->link_leaf(p_parent, is_left, value);
+
+      return iterator(this, &static_cast<link_type&>(value));
+    }
+
+  private:
+
+    //*************************************************************************
+    link_type* lower_bound_link(const key_type& key) const
+    {
+      link_type* p_result = nullptr;
+      link_type* p_link   = this->p_root;
+
+      while (p_link != nullptr)
+      {
+        if (key_compare()(key_of()(*static_cast<const_pointer>(p_link)), key))
+        {
+          p_link = p_link->etl_right;
+        }
+        else
+        {
+          p_result = p_link;
+          p_link   = p_link->etl_left;
+        }
+      }
+
+      return p_result;
+    }
+
+    //*************************************************************************
+    link_type* upper_bound_link(const key_type& key) const
+    {
+      link_type* p_result = nullptr;
+      link_type* p_link   = this->p_root;
+
+      while (p_link != nullptr)
+      {
+        if (key_compare()(key, key_of()(*static_cast<const_pointer>(p_link))))
+        {
+          p_result = p_link;
+          p_link   = p_link->etl_left;
+        }
+        else
+        {
+          p_link = p_link->etl_right;
+        }
+      }
+
+      return p_result;
+    }
+  };
+}
+
+#endif
@@ -345,6 +345,16 @@ namespace etl
       base_t::push_back(value);
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(parameter_t value)
+    {
+      base_t::push_back_unchecked(value);
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the vector.
     /// Does nothing if the vector is empty.
@@ -756,6 +766,16 @@ namespace etl
       base_t::push_back(const_cast<T*>(value));
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(parameter_t value)
+    {
+      base_t::push_back_unchecked(const_cast<T*>(value));
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the vector.
     /// Does nothing if the vector is empty.
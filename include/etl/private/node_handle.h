@@ -0,0 +1,223 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_NODE_HANDLE_INCLUDED
+#define ETL_NODE_HANDLE_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../pool.h"
+#include "../type_traits.h"
+#include "../nullptr.h"
+
+///\ingroup containers
+/// A handle that owns a node extracted from a pool backed container.
+/// While the handle is alive the node stays allocated from its pool.
+/// Inserting the handle in to a container that uses the same pool
+/// relinks the node without copying or reallocating the value.
+
+#if ETL_CPP11_SUPPORTED
+
+namespace etl
+{
+  //***************************************************************************
+  /// The node handle.
+  ///\tparam TValue The value type stored in the node.
+  ///\tparam TOwner The container interface that creates and consumes handles.
+  //***************************************************************************
+  template <typename TValue, typename TOwner>
+  class node_handle
+  {
+  public:
+
+    typedef TValue value_type;
+
+    //*************************************************************************
+    /// Constructs an empty handle.
+    //*************************************************************************
+    node_handle()
+      : p_value(nullptr)
+      , p_node(nullptr)
+      , p_pool(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    node_handle(node_handle&& other)
+      : p_value(other.p_value)
+      , p_node(other.p_node)
+      , p_pool(other.p_pool)
+    {
+      other.p_value = nullptr;
+      other.p_node  = nullptr;
+      other.p_pool  = nullptr;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    /// Any node currently owned is destroyed first.
+    //*************************************************************************
+    node_handle& operator =(node_handle&& rhs)
+    {
+      if (this != &rhs)
+      {
+        destroy();
+
+        p_value = rhs.p_value;
+        p_node  = rhs.p_node;
+        p_pool  = rhs.p_pool;
+
+        rhs.p_value = nullptr;
+        rhs.p_node  = nullptr;
+        rhs.p_pool  = nullptr;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Destroys the value and releases the node back to its pool.
+    //*************************************************************************
+    ~node_handle()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the handle does not own a node.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_node == nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the handle owns a node.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return p_node != nullptr;
+    }
+
+    //*************************************************************************
+    /// The value held in the node.
+    //*************************************************************************
+    value_type& value() const
+    {
+      return *p_value;
+    }
+
+    //*************************************************************************
+    /// The key of a key/mapped pair.
+    /// May be modified before the handle is inserted.
+    //*************************************************************************
+    template <typename T = TValue>
+    typename etl::remove_const<typename T::first_type>::type& key() const
+    {
+      return const_cast<typename etl::remove_const<typename T::first_type>::type&>(p_value->first);
+    }
+
+    //*************************************************************************
+    /// The mapped value of a key/mapped pair.
+    //*************************************************************************
+    template <typename T = TValue>
+    typename T::second_type& mapped() const
+    {
+      return p_value->second;
+    }
+
+    //*************************************************************************
+    /// The pool that the node was allocated from.
+    //*************************************************************************
+    etl::ipool* get_pool() const
+    {
+      return p_pool;
+    }
+
+  private:
+
+    friend TOwner;
+
+    //*************************************************************************
+    /// Takes ownership of a node that has been unlinked from a container.
+    //*************************************************************************
+    node_handle(value_type* p_value_, void* p_node_, etl::ipool* p_pool_)
+      : p_value(p_value_)
+      , p_node(p_node_)
+      , p_pool(p_pool_)
+    {
+    }
+
+    //*************************************************************************
+    /// Gives up ownership of the node, returning it.
+    //*************************************************************************
+    void* release()
+    {
+      void* p = p_node;
+
+      p_value = nullptr;
+      p_node  = nullptr;
+      p_pool  = nullptr;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Destroys the value and returns the node to its pool.
+    //*************************************************************************
+    void destroy()
+    {
+      if (p_node != nullptr)
+      {
+        p_value->~value_type();
+        p_pool->release(p_node);
+
+        p_value = nullptr;
+        p_node  = nullptr;
+        p_pool  = nullptr;
+      }
+    }
+
+    node_handle(const node_handle&) ETL_DELETE;
+    node_handle& operator =(const node_handle&) ETL_DELETE;
+
+    value_type*  p_value; ///< The value in the node.
+    void*        p_node;  ///< The node, as allocated from the pool.
+    etl::ipool*  p_pool;  ///< The pool that owns the node.
+  };
+}
+
+#endif
+
+#endif
@@ -377,6 +377,31 @@ namespace etl
       *p_end++ = value;
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(value_type value)
+    {
+      *p_end++ = value;
+    }
+
+    //*********************************************************************
+    /// Checks once that n more values will fit, so that push_back_unchecked
+    /// may be used to add them.
+    /// If asserts or exceptions are enabled, emits vector_full if they will not fit.
+    ///\param n The number of values to be added.
+    ///\return <b>true</b> if the values will fit.
+    //*********************************************************************
+    bool reserve_check(size_t n) const
+    {
+      const bool fits = (n <= available());
+      ETL_ASSERT(fits, ETL_ERROR(vector_full));
+
+      return fits;
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the vector.
     /// Does nothing if the vector is empty.
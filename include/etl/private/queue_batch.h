@@ -0,0 +1,104 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_BATCH_INCLUDED
+#define ETL_QUEUE_BATCH_INCLUDED
+
+#include <stddef.h>
+#include <string.h>
+
+#include <new>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+namespace etl
+{
+  namespace private_queue_batch
+  {
+    //*************************************************************************
+    /// Constructs n items in uninitialised queue storage.
+    //*************************************************************************
+    template <typename T>
+    void copy_in(T* p_destination, const T* p_source, size_t n, etl::true_type /*is_trivially_copyable*/)
+    {
+      if (n != 0U)
+      {
+        memcpy(static_cast<void*>(p_destination), p_source, n * sizeof(T));
+      }
+    }
+
+    template <typename T>
+    void copy_in(T* p_destination, const T* p_source, size_t n, etl::false_type /*is_trivially_copyable*/)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ::new (static_cast<void*>(p_destination + i)) T(p_source[i]);
+      }
+    }
+
+    template <typename T>
+    void copy_in(T* p_destination, const T* p_source, size_t n)
+    {
+      copy_in(p_destination, p_source, n, etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+    }
+
+    //*************************************************************************
+    /// Moves n items out of queue storage and destroys the originals.
+    //*************************************************************************
+    template <typename T>
+    void copy_out(T* p_destination, T* p_source, size_t n, etl::true_type /*is_trivially_copyable*/)
+    {
+      if (n != 0U)
+      {
+        memcpy(static_cast<void*>(p_destination), p_source, n * sizeof(T));
+      }
+    }
+
+    template <typename T>
+    void copy_out(T* p_destination, T* p_source, size_t n, etl::false_type /*is_trivially_copyable*/)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_destination[i] = etl::move(p_source[i]);
+        p_source[i].~T();
+      }
+    }
+
+    template <typename T>
+    void copy_out(T* p_destination, T* p_source, size_t n)
+    {
+      copy_out(p_destination, p_source, n, etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,144 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_MESSAGE_INCLUDED
+#define ETL_QUEUED_MESSAGE_INCLUDED
+
+#include <new>
+
+#include "../platform.h"
+#include "../message.h"
+#include "../message_router.h"
+#include "../alignment.h"
+#include "../nullptr.h"
+
+namespace etl
+{
+  namespace private_message
+  {
+    //*************************************************************************
+    /// A message waiting to be delivered.
+    /// Holds the sender and a copy of the message in a message packet.
+    /// Message packets may not be assigned, so copies are made by constructing
+    /// a new packet from the stored message.
+    //*************************************************************************
+    template <typename TPacket>
+    class queued_message
+    {
+    public:
+
+      //***********************************
+      queued_message()
+        : p_sender(nullptr),
+          valid(false)
+      {
+      }
+
+      //***********************************
+      queued_message(etl::imessage_router* p_sender_, const etl::imessage& message)
+        : p_sender(p_sender_),
+          valid(false)
+      {
+        create(message);
+      }
+
+      //***********************************
+      queued_message(const queued_message& other)
+        : p_sender(other.p_sender),
+          valid(false)
+      {
+        if (other.valid)
+        {
+          create(other.get());
+        }
+      }
+
+      //***********************************
+      queued_message& operator =(const queued_message& other)
+      {
+        if (this != &other)
+        {
+          destroy();
+          p_sender = other.p_sender;
+
+          if (other.valid)
+          {
+            create(other.get());
+          }
+        }
+
+        return *this;
+      }
+
+      //***********************************
+      ~queued_message()
+      {
+        destroy();
+      }
+
+      //***********************************
+      etl::imessage_router& sender() const
+      {
+        return (p_sender == nullptr) ? static_cast<etl::imessage_router&>(etl::null_message_router::instance()) : *p_sender;
+      }
+
+      //***********************************
+      const etl::imessage& get() const
+      {
+        return static_cast<const TPacket*>(storage)->get();
+      }
+
+    private:
+
+      //***********************************
+      void create(const etl::imessage& message)
+      {
+        ::new (static_cast<TPacket*>(storage)) TPacket(message);
+        valid = true;
+      }
+
+      //***********************************
+      void destroy()
+      {
+        if (valid)
+        {
+          static_cast<TPacket*>(storage)->~TPacket();
+          valid = false;
+        }
+      }
+
+      etl::imessage_router* p_sender;
+      typename etl::aligned_storage<sizeof(TPacket), etl::alignment_of<TPacket>::value>::type storage;
+      bool valid;
+    };
+  }
+}
+
+#endif
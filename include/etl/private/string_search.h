@@ -0,0 +1,226 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../algorithm.h"
+
+// The byte searches use memchr at run time, which is not constexpr.
+// They are constexpr only where the compiler can tell that a call is being
+// constant evaluated, and then search with a loop.
+#if ETL_CPP14_SUPPORTED && !defined(ETL_FORCE_NO_ADVANCED_CPP) && defined(ETL_IS_CONSTANT_EVALUATED)
+  #define ETL_STRING_SEARCH_CONSTEXPR14 constexpr
+  #define ETL_STRING_SEARCH_NOT_CONSTANT_EVALUATED() (!ETL_IS_CONSTANT_EVALUATED())
+#else
+  #define ETL_STRING_SEARCH_CONSTEXPR14
+  #define ETL_STRING_SEARCH_NOT_CONSTANT_EVALUATED() true
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Finds the first occurrence of a character in [first, last).
+    /// Returns last if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_char(const T* first, const T* last, T c)
+    {
+      while ((first != last) && !(*first == c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of a byte in [first, last), using memchr
+    /// when not constant evaluated.
+    //*************************************************************************
+    template <typename T>
+    ETL_STRING_SEARCH_CONSTEXPR14 const T* find_byte(const T* first, const T* last, T c)
+    {
+      if (ETL_STRING_SEARCH_NOT_CONSTANT_EVALUATED())
+      {
+        const void* p = memchr(first, c, size_t(last - first));
+
+        return (p == nullptr) ? last : static_cast<const T*>(p);
+      }
+
+      return find_char<T>(first, last, c);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of a char in [first, last).
+    //*************************************************************************
+    inline ETL_STRING_SEARCH_CONSTEXPR14 const char* find_char(const char* first, const char* last, char c)
+    {
+      return find_byte(first, last, c);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of a signed char in [first, last).
+    //*************************************************************************
+    inline ETL_STRING_SEARCH_CONSTEXPR14 const signed char* find_char(const signed char* first, const signed char* last, signed char c)
+    {
+      return find_byte(first, last, c);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of an unsigned char in [first, last).
+    //*************************************************************************
+    inline ETL_STRING_SEARCH_CONSTEXPR14 const unsigned char* find_char(const unsigned char* first, const unsigned char* last, unsigned char c)
+    {
+      return find_byte(first, last, c);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the n characters at s in [first, last).
+    /// Candidates are found by searching for the first character, then
+    /// rejected early by checking the last.
+    /// Returns last if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_STRING_SEARCH_CONSTEXPR14 const T* find_substring(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 0U)
+      {
+        return first;
+      }
+
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      // One past the last position that the substring could start.
+      const T* const pend = last - n + 1;
+      const T        head = s[0];
+      const T        tail = s[n - 1];
+
+      while (first != pend)
+      {
+        first = find_char(first, pend, head);
+
+        if (first == pend)
+        {
+          break;
+        }
+
+        if (first[n - 1] == tail)
+        {
+          size_t i = 1U;
+
+          while ((i < n) && (first[i] == s[i]))
+          {
+            ++i;
+          }
+
+          if (i == n)
+          {
+            return first;
+          }
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of characters, for the find_first_of family.
+    /// Wide characters are tested against each member of the set.
+    //*************************************************************************
+    template <typename T, const bool IS_BYTE = (sizeof(T) == 1U)>
+    class char_set
+    {
+    public:
+
+      char_set(const T* s_, size_t n_)
+        : s(s_),
+          n(n_)
+      {
+      }
+
+      bool contains(T c) const
+      {
+        return etl::find(s, s + n, c) != (s + n);
+      }
+
+    private:
+
+      const T* s;
+      size_t   n;
+    };
+
+    //*************************************************************************
+    /// A set of byte sized characters, as a 256 bit lookup table.
+    //*************************************************************************
+    template <typename T>
+    class char_set<T, true>
+    {
+    public:
+
+      char_set(const T* s, size_t n)
+      {
+        memset(table, 0, sizeof(table));
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const uint8_t c = static_cast<uint8_t>(s[i]);
+          table[c >> 3U] |= uint8_t(1U << (c & 7U));
+        }
+      }
+
+      bool contains(T c) const
+      {
+        const uint8_t uc = static_cast<uint8_t>(c);
+
+        return (table[uc >> 3U] & (1U << (uc & 7U))) != 0U;
+      }
+
+    private:
+
+      uint8_t table[32];
+    };
+  }
+}
+
+#endif
@@ -45,6 +45,9 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "../iterator.h"
 #include "../limits.h"
+#include "to_string_shortest.h"
+
+#include <limits.h>
 
 namespace etl
 {
@@ -132,8 +135,22 @@ namespace etl
                       const etl::basic_format_spec<TIString>& format,
                       const bool append)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type      type;
+      typedef typename TIString::iterator        iterator;
+      typedef typename etl::make_unsigned<T>::type utype;
+
+      // Pairs of decimal digits, 00 to 99.
+      static const char decimal_pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
 
       const bool negative = etl::is_negative(value);
 
@@ -144,30 +161,61 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
-      {
-        str.push_back(type('0'));
-      }
-      else
+      // Work with the magnitude, which is always representable unsigned.
+      utype magnitude = negative ? utype(utype(0) - utype(value)) : utype(value);
+
+      // The digits are written backwards from the end of the buffer, so that
+      // no reversal is needed. Large enough for base 2 and a sign.
+      type  buffer[(CHAR_BIT * sizeof(T)) + 1];
+      type* const pend = buffer + (sizeof(buffer) / sizeof(type));
+      type* p          = pend;
+
+      const uint32_t base = format.get_base();
+
+      if (base == 10U)
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
+        // Two digits at a time.
+        while (magnitude >= utype(100U))
         {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
+          const uint32_t index = uint32_t(magnitude % utype(100U)) * 2U;
+          magnitude /= utype(100U);
+
+          *--p = type(decimal_pairs[index + 1U]);
+          *--p = type(decimal_pairs[index]);
         }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10) && negative)
+        if (magnitude >= utype(10U))
         {
-          str.push_back(type('-'));
+          const uint32_t index = uint32_t(magnitude) * 2U;
+
+          *--p = type(decimal_pairs[index + 1U]);
+          *--p = type(decimal_pairs[index]);
         }
+        else
+        {
+          *--p = type('0' + uint32_t(magnitude));
+        }
+
+        if (negative)
+        {
+          *--p = type('-');
+        }
+      }
+      else
+      {
+        const type alpha = format.is_upper_case() ? type('A') : type('a');
+
+        do
+        {
+          const uint32_t remainder = uint32_t(magnitude % utype(base));
+          magnitude /= utype(base);
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+          *--p = (remainder > 9U) ? type(alpha + (remainder - 10U)) : type('0' + remainder);
+        } while (magnitude != 0U);
       }
 
+      str.insert(str.end(), p, pend);
+
       etl::private_to_string::add_alignment(str, start, format);
     }
 
@@ -238,6 +286,10 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_floating_point_shortest(value, str);
+      }
       else
       {
         // Make sure we format the two halves correctly.
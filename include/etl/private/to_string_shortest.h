@@ -0,0 +1,553 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_STRING_SHORTEST_INCLUDED
+#define ETL_TO_STRING_SHORTEST_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../limits.h"
+#include "../type_traits.h"
+
+namespace etl
+{
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// Shortest round trip formatting of float and double, using Grisu2.
+    /// Produces the digits of a decimal value that reads back to the same
+    /// binary value. This is very nearly always the shortest such value.
+    /// Florian Loitsch, "Printing Floating-Point Numbers Quickly and
+    /// Accurately with Integers", PLDI 2010.
+    //*************************************************************************
+    namespace shortest
+    {
+      //***********************************************************************
+      /// A floating point value with a 64 bit significand.
+      /// value = f * 2^e
+      //***********************************************************************
+      struct diy_fp
+      {
+        diy_fp(uint64_t f_, int e_)
+          : f(f_),
+            e(e_)
+        {
+        }
+
+        uint64_t f;
+        int      e;
+      };
+
+      //***********************************************************************
+      /// x - y. The exponents must be the same and x.f >= y.f.
+      //***********************************************************************
+      inline diy_fp subtract(const diy_fp& x, const diy_fp& y)
+      {
+        return diy_fp(x.f - y.f, x.e);
+      }
+
+      //***********************************************************************
+      /// x * y, rounded to the upper 64 bits of the product.
+      //***********************************************************************
+      inline diy_fp multiply(const diy_fp& x, const diy_fp& y)
+      {
+        const uint64_t x_lo = x.f & 0xFFFFFFFFU;
+        const uint64_t x_hi = x.f >> 32U;
+        const uint64_t y_lo = y.f & 0xFFFFFFFFU;
+        const uint64_t y_hi = y.f >> 32U;
+
+        const uint64_t p0 = x_lo * y_lo;
+        const uint64_t p1 = x_lo * y_hi;
+        const uint64_t p2 = x_hi * y_lo;
+        const uint64_t p3 = x_hi * y_hi;
+
+        uint64_t q = (p0 >> 32U) + (p1 & 0xFFFFFFFFU) + (p2 & 0xFFFFFFFFU);
+        q += uint64_t(1U) << 31U; // Round.
+
+        const uint64_t h = p3 + (p2 >> 32U) + (p1 >> 32U) + (q >> 32U);
+
+        return diy_fp(h, x.e + y.e + 64);
+      }
+
+      //***********************************************************************
+      /// Shifts the significand up until the top bit is set.
+      //***********************************************************************
+      inline diy_fp normalise(diy_fp x)
+      {
+        while ((x.f >> 63U) == 0U)
+        {
+          x.f <<= 1U;
+          --x.e;
+        }
+
+        return x;
+      }
+
+      //***********************************************************************
+      /// Sets the exponent to e, which must not be greater than x.e.
+      //***********************************************************************
+      inline diy_fp normalise_to(const diy_fp& x, int e)
+      {
+        return diy_fp(x.f << (x.e - e), e);
+      }
+
+      //***********************************************************************
+      /// The value and its rounding boundaries.
+      //***********************************************************************
+      struct boundaries
+      {
+        boundaries(const diy_fp& w_, const diy_fp& minus_, const diy_fp& plus_)
+          : w(w_),
+            minus(minus_),
+            plus(plus_)
+        {
+        }
+
+        diy_fp w;
+        diy_fp minus;
+        diy_fp plus;
+      };
+
+      //***********************************************************************
+      /// Gets the bits of a float or double.
+      //***********************************************************************
+      inline uint64_t get_bits(float value)
+      {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        return bits;
+      }
+
+      inline uint64_t get_bits(double value)
+      {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        return bits;
+      }
+
+      //***********************************************************************
+      /// Computes the normalised value and the boundaries m- and m+, halfway
+      /// to the neighbouring values. The value must be positive and finite.
+      //***********************************************************************
+      template <typename T>
+      boundaries compute_boundaries(T value)
+      {
+        const int      PRECISION  = etl::numeric_limits<T>::digits; // Includes the hidden bit.
+        const int      BIAS       = etl::numeric_limits<T>::max_exponent - 1 + (PRECISION - 1);
+        const int      MIN_EXP    = 1 - BIAS;
+        const uint64_t HIDDEN_BIT = uint64_t(1U) << (PRECISION - 1);
+
+        const uint64_t bits = get_bits(value);
+        const uint64_t E    = bits >> (PRECISION - 1);
+        const uint64_t F    = bits & (HIDDEN_BIT - 1U);
+
+        const diy_fp v = (E == 0U) ? diy_fp(F, MIN_EXP)
+                                   : diy_fp(F + HIDDEN_BIT, int(E) - BIAS);
+
+        // The lower boundary is closer if the significand is a power of 2.
+        const bool lower_is_closer = (F == 0U) && (E > 1U);
+
+        const diy_fp m_plus  = diy_fp((2U * v.f) + 1U, v.e - 1);
+        const diy_fp m_minus = lower_is_closer ? diy_fp((4U * v.f) - 1U, v.e - 2)
+                                               : diy_fp((2U * v.f) - 1U, v.e - 1);
+
+        const diy_fp w_plus  = normalise(m_plus);
+        const diy_fp w_minus = normalise_to(m_minus, w_plus.e);
+
+        return boundaries(normalise(v), w_minus, w_plus);
+      }
+
+      //***********************************************************************
+      /// A cached power of ten. 10^k = f * 2^e
+      //***********************************************************************
+      struct cached_power
+      {
+        uint64_t f;
+        int      e;
+        int      k;
+      };
+
+      //***********************************************************************
+      /// Gets a power of ten, c = 10^-k, so that the exponent of w * c is in
+      /// the range [ALPHA, GAMMA]. This lets the digits be generated with
+      /// 32 bit integral and 64 bit fractional parts.
+      //***********************************************************************
+      inline cached_power get_cached_power(int e)
+      {
+        static const int ALPHA         = -60;
+        static const int MIN_DEC_EXP   = -300;
+        static const int DEC_EXP_STEP  = 8;
+
+        static const cached_power powers[] =
+        {
+          { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+          { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+          { 0xBE5691EF416BD60CULL, -1007, -284 },
+          { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+          { 0xD3515C2831559A83ULL,  -954, -268 },
+          { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+          { 0xEA9C227723EE8BCBULL,  -901, -252 },
+          { 0xAECC49914078536DULL,  -874, -244 },
+          { 0x823C12795DB6CE57ULL,  -847, -236 },
+          { 0xC21094364DFB5637ULL,  -821, -228 },
+          { 0x9096EA6F3848984FULL,  -794, -220 },
+          { 0xD77485CB25823AC7ULL,  -768, -212 },
+          { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+          { 0xEF340A98172AACE5ULL,  -715, -196 },
+          { 0xB23867FB2A35B28EULL,  -688, -188 },
+          { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+          { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+          { 0x936B9FCEBB25C996ULL,  -608, -164 },
+          { 0xDBAC6C247D62A584ULL,  -582, -156 },
+          { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+          { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+          { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+          { 0x87625F056C7C4A8BULL,  -475, -124 },
+          { 0xC9BCFF6034C13053ULL,  -449, -116 },
+          { 0x964E858C91BA2655ULL,  -422, -108 },
+          { 0xDFF9772470297EBDULL,  -396, -100 },
+          { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+          { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+          { 0xB94470938FA89BCFULL,  -316,  -76 },
+          { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+          { 0xCDB02555653131B6ULL,  -263,  -60 },
+          { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+          { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+          { 0xAA242499697392D3ULL,  -183,  -36 },
+          { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+          { 0xBCE5086492111AEBULL,  -130,  -20 },
+          { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+          { 0xD1B71758E219652CULL,   -77,   -4 },
+          { 0x9C40000000000000ULL,   -50,    4 },
+          { 0xE8D4A51000000000ULL,   -24,   12 },
+          { 0xAD78EBC5AC620000ULL,     3,   20 },
+          { 0x813F3978F8940984ULL,    30,   28 },
+          { 0xC097CE7BC90715B3ULL,    56,   36 },
+          { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+          { 0xD5D238A4ABE98068ULL,   109,   52 },
+          { 0x9F4F2726179A2245ULL,   136,   60 },
+          { 0xED63A231D4C4FB27ULL,   162,   68 },
+          { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+          { 0x83C7088E1AAB65DBULL,   216,   84 },
+          { 0xC45D1DF942711D9AULL,   242,   92 },
+          { 0x924D692CA61BE758ULL,   269,  100 },
+          { 0xDA01EE641A708DEAULL,   295,  108 },
+          { 0xA26DA3999AEF774AULL,   322,  116 },
+          { 0xF209787BB47D6B85ULL,   348,  124 },
+          { 0xB454E4A179DD1877ULL,   375,  132 },
+          { 0x865B86925B9BC5C2ULL,   402,  140 },
+          { 0xC83553C5C8965D3DULL,   428,  148 },
+          { 0x952AB45CFA97A0B3ULL,   455,  156 },
+          { 0xDE469FBD99A05FE3ULL,   481,  164 },
+          { 0xA59BC234DB398C25ULL,   508,  172 },
+          { 0xF6C69A72A3989F5CULL,   534,  180 },
+          { 0xB7DCBF5354E9BECEULL,   561,  188 },
+          { 0x88FCF317F22241E2ULL,   588,  196 },
+          { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+          { 0x98165AF37B2153DFULL,   641,  212 },
+          { 0xE2A0B5DC971F303AULL,   667,  220 },
+          { 0xA8D9D1535CE3B396ULL,   694,  228 },
+          { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+          { 0xBB764C4CA7A44410ULL,   747,  244 },
+          { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+          { 0xD01FEF10A657842CULL,   800,  260 },
+          { 0x9B10A4E5E9913129ULL,   827,  268 },
+          { 0xE7109BFBA19C0C9DULL,   853,  276 },
+          { 0xAC2820D9623BF429ULL,   880,  284 },
+          { 0x80444B5E7AA7CF85ULL,   907,  292 },
+          { 0xBF21E44003ACDD2DULL,   933,  300 },
+          { 0x8E679C2F5E44FF8FULL,   960,  308 },
+          { 0xD433179D9C8CB841ULL,   986,  316 },
+          { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+          { 0xEB96BF6EBADF77D9ULL,  1039,  332 },
+          { 0xAF87023B9BF0EE6BULL,  1066,  340 }
+        };
+
+        // k = ceil((ALPHA - e - 1) * log10(2))
+        const int f = ALPHA - e - 1;
+        const int k = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+
+        const int index = (-MIN_DEC_EXP + k + (DEC_EXP_STEP - 1)) / DEC_EXP_STEP;
+
+        return powers[index];
+      }
+
+      //***********************************************************************
+      /// Finds the largest power of ten that is not greater than n.
+      /// Returns the number of decimal digits in n.
+      //***********************************************************************
+      inline int find_largest_pow10(uint32_t n, uint32_t& pow10)
+      {
+        int digits = 10;
+        pow10 = 1000000000U;
+
+        while ((digits > 1) && (n < pow10))
+        {
+          pow10 /= 10U;
+          --digits;
+        }
+
+        return digits;
+      }
+
+      //***********************************************************************
+      /// Moves the last digit closer to the exact value, while it stays in
+      /// the rounding interval.
+      //***********************************************************************
+      inline void round_weed(char* buffer, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+      {
+        while ((rest < dist) &&
+               ((delta - rest) >= ten_k) &&
+               (((rest + ten_k) < dist) || ((dist - rest) > (rest + ten_k - dist))))
+        {
+          --buffer[length - 1];
+          rest += ten_k;
+        }
+      }
+
+      //***********************************************************************
+      /// Generates the digits of the shortest value in [m_minus, m_plus].
+      //***********************************************************************
+      inline void generate_digits(char* buffer, int& length, int& decimal_exponent,
+                                  const diy_fp& m_minus, const diy_fp& w, const diy_fp& m_plus)
+      {
+        uint64_t delta = subtract(m_plus, m_minus).f;
+        uint64_t dist  = subtract(m_plus, w).f;
+
+        const diy_fp one(uint64_t(1U) << -m_plus.e, m_plus.e);
+
+        uint32_t p1 = uint32_t(m_plus.f >> -one.e);
+        uint64_t p2 = m_plus.f & (one.f - 1U);
+
+        // The integral part.
+        uint32_t pow10;
+        int n = find_largest_pow10(p1, pow10);
+
+        while (n > 0)
+        {
+          const uint32_t d = p1 / pow10;
+          p1 %= pow10;
+          buffer[length++] = char('0' + d);
+          --n;
+
+          const uint64_t rest = (uint64_t(p1) << -one.e) + p2;
+
+          if (rest <= delta)
+          {
+            decimal_exponent += n;
+            round_weed(buffer, length, dist, delta, rest, uint64_t(pow10) << -one.e);
+            return;
+          }
+
+          pow10 /= 10U;
+        }
+
+        // The fractional part.
+        int m = 0;
+
+        while (true)
+        {
+          p2 *= 10U;
+          const uint64_t d = p2 >> -one.e;
+          p2 &= (one.f - 1U);
+          buffer[length++] = char('0' + d);
+          ++m;
+
+          delta *= 10U;
+          dist  *= 10U;
+
+          if (p2 <= delta)
+          {
+            break;
+          }
+        }
+
+        decimal_exponent -= m;
+        round_weed(buffer, length, dist, delta, p2, one.f);
+      }
+
+      //***********************************************************************
+      /// Gets the shortest digits for a positive, finite value.
+      /// value = digits * 10^decimal_exponent
+      /// The buffer must hold at least 17 characters.
+      //***********************************************************************
+      template <typename T>
+      void get_digits(T value, char* buffer, int& length, int& decimal_exponent)
+      {
+        const boundaries   b      = compute_boundaries(value);
+        const cached_power cached = get_cached_power(b.plus.e);
+        const diy_fp       c_minus_k(cached.f, cached.e);
+
+        const diy_fp w       = multiply(b.w, c_minus_k);
+        const diy_fp w_minus = multiply(b.minus, c_minus_k);
+        const diy_fp w_plus  = multiply(b.plus, c_minus_k);
+
+        // Shrink the interval by one unit in the last place, to allow for the
+        // rounding of the multiplications.
+        const diy_fp m_minus(w_minus.f + 1U, w_minus.e);
+        const diy_fp m_plus(w_plus.f - 1U, w_plus.e);
+
+        length           = 0;
+        decimal_exponent = -cached.k;
+
+        generate_digits(buffer, length, decimal_exponent, m_minus, w, m_plus);
+      }
+    }
+
+    //***************************************************************************
+    /// Helper function for shortest round trip floating point.
+    /// Uses fixed notation for decimal exponents from -6 to 20, otherwise
+    /// scientific notation.
+    /// long double is formatted via double.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point_shortest(T value, TIString& str)
+    {
+      typedef typename TIString::value_type type;
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type value_t;
+
+      const value_t v = value_t(value);
+
+      // 17 digits, sign, point, exponent and padding zeros.
+      type  output[48];
+      type* p = output;
+
+      // Test the sign bit, so that -0 is negative.
+      if ((shortest::get_bits(v) >> ((sizeof(value_t) * 8U) - 1U)) != 0U)
+      {
+        *p++ = type('-');
+      }
+
+      if (v == value_t(0))
+      {
+        *p++ = type('0');
+      }
+      else
+      {
+        char digits[20];
+        int  length;
+        int  decimal_exponent;
+
+        shortest::get_digits(v < value_t(0) ? -v : v, digits, length, decimal_exponent);
+
+        // The position of the decimal point, relative to the first digit.
+        const int point = length + decimal_exponent;
+
+        if ((decimal_exponent >= 0) && (point <= 21))
+        {
+          // An integral value. digits followed by zeros.
+          for (int i = 0; i < length; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+
+          for (int i = 0; i < decimal_exponent; ++i)
+          {
+            *p++ = type('0');
+          }
+        }
+        else if ((point > 0) && (point <= 21))
+        {
+          // ddd.ddd
+          for (int i = 0; i < length; ++i)
+          {
+            if (i == point)
+            {
+              *p++ = type('.');
+            }
+
+            *p++ = type(digits[i]);
+          }
+        }
+        else if ((point > -6) && (point <= 0))
+        {
+          // 0.000ddd
+          *p++ = type('0');
+          *p++ = type('.');
+
+          for (int i = point; i < 0; ++i)
+          {
+            *p++ = type('0');
+          }
+
+          for (int i = 0; i < length; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+        }
+        else
+        {
+          // d.ddde+xx
+          *p++ = type(digits[0]);
+
+          if (length > 1)
+          {
+            *p++ = type('.');
+
+            for (int i = 1; i < length; ++i)
+            {
+              *p++ = type(digits[i]);
+            }
+          }
+
+          int exponent = point - 1;
+
+          *p++ = type('e');
+          *p++ = (exponent < 0) ? type('-') : type('+');
+
+          exponent = (exponent < 0) ? -exponent : exponent;
+
+          if (exponent >= 100)
+          {
+            *p++ = type('0' + (exponent / 100));
+            exponent %= 100;
+            *p++ = type('0' + (exponent / 10));
+          }
+          else if (exponent >= 10)
+          {
+            *p++ = type('0' + (exponent / 10));
+          }
+
+          *p++ = type('0' + (exponent % 10));
+        }
+      }
+
+      str.insert(str.end(), output, p);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,212 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_BUCKET_OCCUPANCY_INCLUDED
+#define ETL_UNORDERED_BUCKET_OCCUPANCY_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../type_traits.h"
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// One bit per bucket, set while the bucket holds at least one node.
+    /// Lets the unordered containers step straight to the next occupied
+    /// bucket, so full scans cost in proportion to size() rather than to
+    /// the number of buckets.
+    //*************************************************************************
+    class bucket_occupancy
+    {
+    public:
+
+      typedef uint32_t element_t;
+
+      static const size_t BITS_PER_ELEMENT = 32U;
+
+      //*******************************
+      /// The number of elements needed for NBUCKETS buckets.
+      //*******************************
+      template <const size_t NBUCKETS>
+      struct elements
+      {
+        static const size_t value = (NBUCKETS + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT;
+      };
+
+      //*******************************
+      bucket_occupancy(element_t* pdata_, size_t number_of_buckets_)
+        : pdata(pdata_),
+          number_of_buckets(number_of_buckets_)
+      {
+      }
+
+      //*******************************
+      /// The number of buckets tracked.
+      //*******************************
+      size_t size() const
+      {
+        return number_of_buckets;
+      }
+
+      //*******************************
+      /// Marks the bucket as occupied.
+      //*******************************
+      void set(size_t index)
+      {
+        pdata[index / BITS_PER_ELEMENT] |= element_t(1U) << (index % BITS_PER_ELEMENT);
+      }
+
+      //*******************************
+      /// Marks the bucket as empty.
+      //*******************************
+      void reset(size_t index)
+      {
+        pdata[index / BITS_PER_ELEMENT] &= ~(element_t(1U) << (index % BITS_PER_ELEMENT));
+      }
+
+      //*******************************
+      /// Marks all of the buckets as empty.
+      //*******************************
+      void reset()
+      {
+        memset(pdata, 0, ((number_of_buckets + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT) * sizeof(element_t));
+      }
+
+      //*******************************
+      /// Returns the index of the first occupied bucket at or after 'index',
+      /// or the number of buckets if there are none.
+      //*******************************
+      size_t find_next(size_t index) const
+      {
+        if (index >= number_of_buckets)
+        {
+          return number_of_buckets;
+        }
+
+        size_t    word  = index / BITS_PER_ELEMENT;
+        element_t value = pdata[word] & (~element_t(0U) << (index % BITS_PER_ELEMENT));
+
+        const size_t words = (number_of_buckets + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT;
+
+        while (value == 0U)
+        {
+          if (++word == words)
+          {
+            return number_of_buckets;
+          }
+
+          value = pdata[word];
+        }
+
+        return (word * BITS_PER_ELEMENT) + lowest(value);
+      }
+
+    private:
+
+      //*******************************
+      static size_t lowest(element_t value)
+      {
+        return size_t(etl::count_trailing_zeros(value));
+      }
+
+      element_t*   pdata;
+      const size_t number_of_buckets;
+    };
+
+    //*************************************************************************
+    /// The layout of one buffer that holds the buckets, the occupancy flags
+    /// and the nodes of an unordered container, in that order.
+    //*************************************************************************
+    template <typename TBucket, const size_t NODE_SIZE, const size_t NODE_ALIGNMENT>
+    struct buffer_layout
+    {
+      typedef bucket_occupancy::element_t element_t;
+
+      static const size_t BUCKET_ALIGNMENT    = etl::alignment_of<TBucket>::value;
+      static const size_t OCCUPANCY_ALIGNMENT = etl::alignment_of<element_t>::value;
+      static const size_t LARGER_ALIGNMENT    = (BUCKET_ALIGNMENT > OCCUPANCY_ALIGNMENT) ? BUCKET_ALIGNMENT : OCCUPANCY_ALIGNMENT;
+
+      /// The alignment required of the buffer.
+      static const size_t ALIGNMENT = (LARGER_ALIGNMENT > NODE_ALIGNMENT) ? LARGER_ALIGNMENT : NODE_ALIGNMENT;
+
+      //*******************************
+      static size_t round_up(size_t n, size_t alignment)
+      {
+        return ((n + alignment - 1U) / alignment) * alignment;
+      }
+
+      //*******************************
+      static size_t occupancy_offset(size_t number_of_buckets)
+      {
+        return round_up(number_of_buckets * sizeof(TBucket), OCCUPANCY_ALIGNMENT);
+      }
+
+      //*******************************
+      static size_t nodes_offset(size_t number_of_buckets)
+      {
+        const size_t elements = (number_of_buckets + bucket_occupancy::BITS_PER_ELEMENT - 1U) / bucket_occupancy::BITS_PER_ELEMENT;
+
+        return round_up(occupancy_offset(number_of_buckets) + (elements * sizeof(element_t)), NODE_ALIGNMENT);
+      }
+
+      //*******************************
+      static size_t size(size_t max_size, size_t number_of_buckets)
+      {
+        return nodes_offset(number_of_buckets) + (max_size * NODE_SIZE);
+      }
+
+      //*******************************
+      static TBucket* buckets(void* buffer)
+      {
+        return static_cast<TBucket*>(buffer);
+      }
+
+      //*******************************
+      static element_t* occupancy(void* buffer, size_t number_of_buckets)
+      {
+        return reinterpret_cast<element_t*>(static_cast<char*>(buffer) + occupancy_offset(number_of_buckets));
+      }
+
+      //*******************************
+      static void* nodes(void* buffer, size_t number_of_buckets)
+      {
+        return static_cast<char*>(buffer) + nodes_offset(number_of_buckets);
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,123 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_NODE_HASH_INCLUDED
+#define ETL_UNORDERED_NODE_HASH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+
+///\ingroup containers
+/// Policies that select what, if anything, the nodes of the unordered
+/// containers remember of their key's hash.
+/// A bucket walk checks the stored value before calling the key comparison,
+/// so keys that are expensive to compare are only compared when they are
+/// likely to match.
+
+namespace etl
+{
+  //***************************************************************************
+  /// Nodes store nothing. Every key in the bucket is compared.
+  /// The default.
+  //***************************************************************************
+  struct unordered_node_hash_none
+  {
+    struct storage
+    {
+      void store_hash(size_t)
+      {
+      }
+
+      bool hash_may_match(size_t) const
+      {
+        return true;
+      }
+    };
+  };
+
+  //***************************************************************************
+  /// Nodes store the full hash value.
+  /// Only keys with an identical hash are compared.
+  //***************************************************************************
+  struct unordered_node_hash_full
+  {
+    struct storage
+    {
+      void store_hash(size_t hash_)
+      {
+        hash = hash_;
+      }
+
+      bool hash_may_match(size_t hash_) const
+      {
+        return hash == hash_;
+      }
+
+      size_t hash;
+    };
+  };
+
+  //***************************************************************************
+  /// Nodes store an 8 bit tag folded from every byte of the hash.
+  /// Rejects roughly 255 out of 256 non-matching keys for one byte per node.
+  //***************************************************************************
+  struct unordered_node_hash_tag
+  {
+    struct storage
+    {
+      void store_hash(size_t hash_)
+      {
+        tag = make_tag(hash_);
+      }
+
+      bool hash_may_match(size_t hash_) const
+      {
+        return tag == make_tag(hash_);
+      }
+
+      static uint8_t make_tag(size_t hash_)
+      {
+        // The low bits are shared by every node in a bucket, so fold in the rest.
+        for (size_t shift = (sizeof(size_t) * 8U) / 2U; shift >= 8U; shift /= 2U)
+        {
+          hash_ ^= (hash_ >> shift);
+        }
+
+        return uint8_t(hash_);
+      }
+
+      uint8_t tag;
+    };
+  };
+}
+
+#endif
@@ -150,7 +150,7 @@ namespace etl
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
-    vector_base(size_t max_size_)
+    ETL_CONSTEXPR vector_base(size_t max_size_)
       : CAPACITY(max_size_)
     {
     }
@@ -0,0 +1,71 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DETERMINE_CPU_FEATURES_H_INCLUDED
+#define ETL_DETERMINE_CPU_FEATURES_H_INCLUDED
+
+//*****************************************************************************
+// Instruction set extensions advertised by the compiler for the target.
+// A profile may define any of these explicitly.
+// Define ETL_NO_CPU_FEATURE_DETECTION to disable automatic detection.
+//*****************************************************************************
+#if !defined(ETL_NO_CPU_FEATURE_DETECTION)
+
+  // SSE4.2 'crc32' instruction (CRC32-C).
+  #if !defined(ETL_CPU_HAS_SSE42_CRC32)
+    #if defined(__SSE4_2__) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__))
+      #define ETL_CPU_HAS_SSE42_CRC32
+    #endif
+  #endif
+
+  // ARMv8 CRC32 extension (CRC32 and CRC32-C).
+  #if !defined(ETL_CPU_HAS_ARM_CRC32)
+    #if defined(__ARM_FEATURE_CRC32)
+      #define ETL_CPU_HAS_ARM_CRC32
+    #endif
+  #endif
+
+  // ARMv7-M / ARMv8-M DWT cycle counter.
+  #if !defined(ETL_CPU_HAS_DWT_CYCCNT)
+    #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+      #define ETL_CPU_HAS_DWT_CYCCNT
+    #endif
+  #endif
+
+  // x86 time stamp counter.
+  #if !defined(ETL_CPU_HAS_RDTSC)
+    #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+      #define ETL_CPU_HAS_RDTSC
+    #endif
+  #endif
+
+#endif
+
+#endif
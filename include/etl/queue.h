@@ -268,6 +268,7 @@ namespace etl
     using base_t::current_size;
     using base_t::full;
     using base_t::empty;
+    using base_t::available;
     using base_t::add_in;
     using base_t::del_out;
 
@@ -315,7 +316,7 @@ namespace etl
     void push(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(value);
       add_in();
@@ -330,13 +331,52 @@ namespace etl
     void push(rvalue_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(etl::move(value));
       add_in();
     }
 #endif
 
+    //*************************************************************************
+    /// Adds a value to the queue without checking the capacity.
+    /// The queue must not be full. See reserve_check.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push_unchecked(const_reference value)
+    {
+      ::new (&p_buffer[in]) T(value);
+      add_in();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds a value to the queue without checking the capacity.
+    /// The queue must not be full. See reserve_check.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push_unchecked(rvalue_reference value)
+    {
+      ::new (&p_buffer[in]) T(etl::move(value));
+      add_in();
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks once that n more values will fit, so that push_unchecked
+    /// may be used to add them.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if they will not fit.
+    ///\param n The number of values to be added.
+    ///\return <b>true</b> if the values will fit.
+    //*************************************************************************
+    bool reserve_check(size_type n) const
+    {
+      const bool fits = (n <= available());
+      ETL_ASSERT_CONTAINER(fits, ETL_ERROR(queue_full));
+
+      return fits;
+    }
+
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_FORCE_CPP03)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -347,7 +387,7 @@ namespace etl
     void emplace(Args && ... args)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(etl::forward<Args>(args)...);
       add_in();
@@ -362,7 +402,7 @@ namespace etl
     void emplace(const T1& value1)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(value1);
       add_in();
@@ -377,7 +417,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(value1, value2);
       add_in();
@@ -392,7 +432,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2, const T3& value3)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(value1, value2, value3);
       add_in();
@@ -407,7 +447,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(queue_full));
 #endif
       ::new (&p_buffer[in]) T(value1, value2, value3, value4);
       add_in();
@@ -444,7 +484,7 @@ namespace etl
     void pop()
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!empty(), ETL_ERROR(queue_empty));
+      ETL_ASSERT_CONTAINER(!empty(), ETL_ERROR(queue_empty));
 #endif
       p_buffer[out].~T();
       del_out();
@@ -663,6 +703,70 @@ namespace etl
     /// The uninitialised buffer of T used in the queue.
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[SIZE];
   };
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// A fixed capacity queue that uses a buffer supplied by the caller.
+  /// The buffer must be aligned for T, hold max_size values and outlive the queue.
+  /// This queue does not support concurrent access by different threads.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_ext : public etl::iqueue<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    queue_ext(void* buffer, size_type max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return max_size * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_ext()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    queue_ext& operator = (const queue_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction, as there is no buffer to copy in to.
+    queue_ext(const queue_ext&);
+  };
 }
 
 #undef ETL_FILE
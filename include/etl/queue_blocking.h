@@ -0,0 +1,405 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_BLOCKING_INCLUDED
+#define ETL_QUEUE_BLOCKING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "utility.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_NO_STL)
+  #include <atomic>
+#endif
+
+///\defgroup queue_blocking queue_blocking
+/// Adds waiting push and pop functions to a queue, using a wait policy.
+/// A policy supplies a token, wait and notify function for each of 'data' and 'space'.
+/// A waiter takes a token, retries the queue, then waits on the token, so a
+/// notification between the retry and the wait is not lost.
+/// Waits may return early; the queue is always retried.
+///\ingroup containers
+
+#if ETL_CPP11_SUPPORTED
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue_blocking
+  /// A wait policy that spins for SPIN_COUNT iterations, and then calls YIELD,
+  /// if supplied, before the queue is retried.
+  //***************************************************************************
+  template <const size_t SPIN_COUNT = 64U, void (*YIELD)() = nullptr>
+  class queue_wait_spin_yield
+  {
+  public:
+
+    typedef int token_type;
+
+    token_type data_token() const
+    {
+      return 0;
+    }
+
+    token_type space_token() const
+    {
+      return 0;
+    }
+
+    void wait_data(token_type)
+    {
+      wait();
+    }
+
+    void wait_space(token_type)
+    {
+      wait();
+    }
+
+    void notify_data()
+    {
+    }
+
+    void notify_space()
+    {
+    }
+
+  private:
+
+    static void wait()
+    {
+      volatile size_t spins = 0U;
+
+      while (spins < SPIN_COUNT)
+      {
+        spins = spins + 1U;
+      }
+
+      if (YIELD != nullptr)
+      {
+        YIELD();
+      }
+    }
+  };
+
+#if !defined(ETL_NO_STL) && defined(__cpp_lib_atomic_wait)
+  //***************************************************************************
+  ///\ingroup queue_blocking
+  /// A wait policy that blocks with std::atomic wait and notify (C++20).
+  /// The tokens are counts of the notifications.
+  //***************************************************************************
+  class queue_wait_atomic
+  {
+  public:
+
+    typedef uint32_t token_type;
+
+    queue_wait_atomic()
+      : data(0U),
+        space(0U)
+    {
+    }
+
+    token_type data_token() const
+    {
+      return data.load(std::memory_order_acquire);
+    }
+
+    token_type space_token() const
+    {
+      return space.load(std::memory_order_acquire);
+    }
+
+    void wait_data(token_type token)
+    {
+      data.wait(token, std::memory_order_acquire);
+    }
+
+    void wait_space(token_type token)
+    {
+      space.wait(token, std::memory_order_acquire);
+    }
+
+    void notify_data()
+    {
+      data.fetch_add(1U, std::memory_order_release);
+      data.notify_all();
+    }
+
+    void notify_space()
+    {
+      space.fetch_add(1U, std::memory_order_release);
+      space.notify_all();
+    }
+
+  private:
+
+    std::atomic<token_type> data;
+    std::atomic<token_type> space;
+  };
+#endif
+
+  //***************************************************************************
+  ///\ingroup queue_blocking
+  /// A wait policy that calls user supplied functions, such as RTOS
+  /// semaphore 'take' and 'give'. A counting semaphore for each of 'data'
+  /// and 'space' will not lose notifications.
+  //***************************************************************************
+  class queue_wait_delegate
+  {
+  public:
+
+    typedef int token_type;
+
+    queue_wait_delegate(const etl::ifunction<void>& wait_data_,
+                        const etl::ifunction<void>& notify_data_,
+                        const etl::ifunction<void>& wait_space_,
+                        const etl::ifunction<void>& notify_space_)
+      : wait_data_function(wait_data_),
+        notify_data_function(notify_data_),
+        wait_space_function(wait_space_),
+        notify_space_function(notify_space_)
+    {
+    }
+
+    token_type data_token() const
+    {
+      return 0;
+    }
+
+    token_type space_token() const
+    {
+      return 0;
+    }
+
+    void wait_data(token_type)
+    {
+      wait_data_function();
+    }
+
+    void wait_space(token_type)
+    {
+      wait_space_function();
+    }
+
+    void notify_data()
+    {
+      notify_data_function();
+    }
+
+    void notify_space()
+    {
+      notify_space_function();
+    }
+
+  private:
+
+    const etl::ifunction<void>& wait_data_function;    ///< Waits for a value to be pushed.
+    const etl::ifunction<void>& notify_data_function;  ///< Signals that a value was pushed.
+    const etl::ifunction<void>& wait_space_function;   ///< Waits for a value to be popped.
+    const etl::ifunction<void>& notify_space_function; ///< Signals that a value was popped.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_blocking
+  /// A queue with waiting push and pop functions.
+  /// The policy is notified by every push and pop. The batch and zero copy
+  /// functions of the queue are hidden as they do not notify; they may still
+  /// be reached through 'TQueue::'.
+  ///\tparam TQueue The queue type, such as etl::queue_spsc_atomic<int, 10>
+  ///               or etl::queue_mpmc_atomic<int, 16>.
+  ///\tparam TWait  The wait policy.
+  //***************************************************************************
+  template <typename TQueue, typename TWait = etl::queue_wait_spin_yield<> >
+  class queue_blocking : public TQueue
+  {
+  public:
+
+    typedef typename TQueue::value_type       value_type;
+    typedef typename TQueue::reference        reference;
+    typedef typename TQueue::const_reference  const_reference;
+    typedef typename TQueue::rvalue_reference rvalue_reference;
+    typedef typename TQueue::size_type        size_type;
+    typedef TWait                             wait_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    queue_blocking()
+      : TQueue(),
+        policy()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from a wait policy.
+    //*************************************************************************
+    explicit queue_blocking(const TWait& policy_)
+      : TQueue(),
+        policy(policy_)
+    {
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      return notify_data(TQueue::push(value));
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      return notify_data(TQueue::push(etl::move(value)));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      return notify_data(TQueue::emplace(etl::forward<Args>(args)...));
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue, waiting while it is full.
+    //*************************************************************************
+    void push_wait(const_reference value)
+    {
+      while (true)
+      {
+        typename TWait::token_type token = policy.space_token();
+
+        if (TQueue::push(value))
+        {
+          break;
+        }
+
+        policy.wait_space(token);
+      }
+
+      policy.notify_data();
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Returns false if the queue is empty.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      return notify_space(TQueue::pop(value));
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Returns false if the queue is empty.
+    //*************************************************************************
+    bool pop(rvalue_reference value)
+    {
+      return notify_space(TQueue::pop(etl::move(value)));
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    /// Returns false if the queue is empty.
+    //*************************************************************************
+    bool pop()
+    {
+      return notify_space(TQueue::pop());
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting while it is empty.
+    //*************************************************************************
+    void pop_wait(reference value)
+    {
+      while (true)
+      {
+        typename TWait::token_type token = policy.data_token();
+
+        if (TQueue::pop(value))
+        {
+          break;
+        }
+
+        policy.wait_data(token);
+      }
+
+      policy.notify_space();
+    }
+
+    //*************************************************************************
+    /// Gets the wait policy.
+    //*************************************************************************
+    TWait& get_wait_policy()
+    {
+      return policy;
+    }
+
+  private:
+
+    bool notify_data(bool pushed)
+    {
+      if (pushed)
+      {
+        policy.notify_data();
+      }
+
+      return pushed;
+    }
+
+    bool notify_space(bool popped)
+    {
+      if (popped)
+      {
+        policy.notify_space();
+      }
+
+      return popped;
+    }
+
+    TWait policy; ///< The wait policy.
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,658 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "nullptr.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#undef ETL_FILE
+#define ETL_FILE "57"
+
+namespace etl
+{
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : write_index(0),
+        read_index(0),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    etl::atomic<size_type> write_index; ///< The position of the next push.
+    etl::atomic<size_type> read_index;  ///< The position of the next pop.
+    const size_type MAX_SIZE;           ///< The maximum number of items in the queue.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and consumers without locks.
+  /// Each slot has a sequence number that tells a producer or consumer whether the
+  /// slot is ready for it, so only the position counters are contended.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::write_index;
+    using base_t::read_index;
+    using base_t::MAX_SIZE;
+
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    struct cell
+    {
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(etl::move(value));
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(etl::forward<Args>(args)...);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      cell*     p_cell = acquire_push_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+        p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      cell*     p_cell = acquire_pop_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        T& item = *reinterpret_cast<T*>(&p_cell->value);
+
+        value = item;
+        item.~T();
+        p_cell->sequence.store(size_type(position + MAX_SIZE), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(rvalue_reference value)
+    {
+      size_type position;
+      cell*     p_cell = acquire_pop_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        T& item = *reinterpret_cast<T*>(&p_cell->value);
+
+        value = etl::move(item);
+        item.~T();
+        p_cell->sequence.store(size_type(position + MAX_SIZE), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      cell*     p_cell = acquire_pop_cell(position);
+
+      if (p_cell != nullptr)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+        p_cell->sequence.store(size_type(position + MAX_SIZE), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// A snapshot that may be out of date if other threads are active.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// A snapshot that may be out of date if other threads are active.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// A snapshot that may be out of date if other threads are active.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_type read  = read_index.load(etl::memory_order_acquire);
+      const size_type write = write_index.load(etl::memory_order_acquire);
+      const size_type count = size_type(write - read);
+
+      return (count > MAX_SIZE) ? MAX_SIZE : count;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// A snapshot that may be out of date if other threads are active.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the initial sequence numbers.
+    /// Called by the derived class once its cells have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    //*************************************************************************
+    /// Claims the cell for the next push.
+    /// Returns nullptr if the queue is full.
+    //*************************************************************************
+    cell* acquire_push_cell(size_type& position)
+    {
+      position = write_index.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell& c = p_cells[position & (MAX_SIZE - 1U)];
+
+        const difference_type difference = difference_type(size_type(c.sequence.load(etl::memory_order_acquire) - position));
+
+        if (difference == 0)
+        {
+          // The cell is free. Try to claim it.
+          if (write_index.compare_exchange_weak(position, size_type(position + 1U), etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The cell still holds the value from the previous lap.
+          return nullptr;
+        }
+        else
+        {
+          // Another producer claimed it first.
+          position = write_index.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the cell for the next pop.
+    /// Returns nullptr if the queue is empty.
+    //*************************************************************************
+    cell* acquire_pop_cell(size_type& position)
+    {
+      position = read_index.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell& c = p_cells[position & (MAX_SIZE - 1U)];
+
+        const difference_type difference = difference_type(size_type(c.sequence.load(etl::memory_order_acquire) - size_type(position + 1U)));
+
+        if (difference == 0)
+        {
+          // The cell holds a value. Try to claim it.
+          if (read_index.compare_exchange_weak(position, size_type(position + 1U), etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The cell has not been written yet.
+          return nullptr;
+        }
+        else
+        {
+          // Another consumer claimed it first.
+          position = read_index.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&);
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&);
+
+    cell* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of two.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((SIZE <= ((etl::integral_limits<size_type>::max / 2U) + 1U)), "Size too large for memory model");
+    ETL_STATIC_ASSERT(((SIZE != 0U) && ((SIZE & (SIZE - 1U)) == 0U)), "Size must be a power of two");
+
+    static const size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(buffer, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The cells used in the queue_mpmc_atomic.
+    typename base_t::cell buffer[MAX_SIZE];
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue that uses a buffer supplied by the caller.
+  /// The buffer must be aligned to ALIGNMENT, hold buffer_size(max_size) bytes
+  /// and outlive the queue. max_size must be a power of two.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_ext : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename base_t::cell                    cell_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    static const size_t ALIGNMENT = etl::alignment_of<cell_t>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for the cells.
+    ///\param max_size The maximum number of values held. Must be a power of two.
+    //*************************************************************************
+    queue_mpmc_atomic_ext(void* buffer, size_type max_size)
+      : base_t(static_cast<cell_t*>(buffer), max_size),
+        p_cells(static_cast<cell_t*>(buffer))
+    {
+      // The cells hold atomics, so are constructed in place.
+      for (size_type i = 0U; i < max_size; ++i)
+      {
+        ::new (&p_cells[i]) cell_t();
+      }
+
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return max_size * sizeof(cell_t);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic_ext()
+    {
+      base_t::clear();
+
+      for (size_type i = 0U; i < this->max_size(); ++i)
+      {
+        p_cells[i].~cell_t();
+      }
+    }
+
+  private:
+
+    queue_mpmc_atomic_ext(const queue_mpmc_atomic_ext&) ETL_DELETE;
+    queue_mpmc_atomic_ext& operator = (const queue_mpmc_atomic_ext&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    queue_mpmc_atomic_ext(queue_mpmc_atomic_ext&&) = delete;
+    queue_mpmc_atomic_ext& operator = (queue_mpmc_atomic_ext&&) = delete;
+#endif
+
+    cell_t* p_cells;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
+#endif
@@ -46,6 +46,7 @@ SOFTWARE.
 #include "memory_model.h"
 #include "integral_limits.h"
 #include "utility.h"
+#include "queue_telemetry.h"
 
 #undef ETL_FILE
 #define ETL_FILE "48"
@@ -133,8 +134,8 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_mpmc_mutex holds.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_mpmc_mutex : public queue_mpmc_mutex_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none, typename TMutex = etl::mutex>
+  class iqueue_mpmc_mutex : public queue_mpmc_mutex_base<MEMORY_MODEL>, private TTelemetry
   {
   private:
 
@@ -381,6 +382,19 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// The telemetry policy, for reading the statistics.
+    //*************************************************************************
+    const TTelemetry& telemetry() const
+    {
+      return *this;
+    }
+
+    TTelemetry& telemetry()
+    {
+      return *this;
+    }
+
   protected:
 
     //*************************************************************************
@@ -403,14 +417,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 
@@ -424,14 +442,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 #endif
@@ -448,14 +470,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 #else
@@ -469,14 +495,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 
@@ -490,14 +520,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 
@@ -511,14 +545,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 
@@ -532,14 +570,18 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
-
         ++current_size;
 
+        TTelemetry::on_push(write_index, current_size);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
         return true;
       }
 
       // Queue is full.
+      TTelemetry::on_push_failed();
+
       return false;
     }
 #endif
@@ -558,6 +600,8 @@ namespace etl
       value = p_buffer[read_index];
       p_buffer[read_index].~T();
 
+      TTelemetry::on_pop(read_index);
+
       read_index = get_next_index(read_index, MAX_SIZE);
 
       --current_size;
@@ -580,6 +624,8 @@ namespace etl
       value = etl::move(p_buffer[read_index]);
       p_buffer[read_index].~T();
 
+      TTelemetry::on_pop(read_index);
+
       read_index = get_next_index(read_index, MAX_SIZE);
 
       --current_size;
@@ -601,6 +647,8 @@ namespace etl
 
       p_buffer[read_index].~T();
 
+      TTelemetry::on_pop(read_index);
+
       read_index = get_next_index(read_index, MAX_SIZE);
 
       --current_size;
@@ -614,7 +662,7 @@ namespace etl
 
     T* p_buffer; ///< The internal buffer.
 
-    mutable etl::mutex access; ///< The object that locks/unlocks access.
+    mutable TMutex access; ///< The object that locks/unlocks access.
   };
 
   //***************************************************************************
@@ -624,19 +672,22 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TTelemetry   The telemetry policy. See queue_telemetry.h.
+  /// \tparam TMutex       The lock. etl::mutex, or a spinning lock such as etl::spinlock for short critical sections.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_mpmc_mutex : public etl::iqueue_mpmc_mutex<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none, typename TMutex = etl::mutex>
+  class queue_mpmc_mutex : public etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TTelemetry, TMutex>
   {
   private:
 
-    typedef etl::iqueue_mpmc_mutex<T, MEMORY_MODEL> base_t;
+    typedef etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TTelemetry, TMutex> base_t;
 
   public:
 
     typedef typename base_t::size_type size_type;
 
     ETL_STATIC_ASSERT((SIZE <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+    ETL_STATIC_ASSERT((SIZE <= TTelemetry::MAX_SLOTS), "Telemetry has too few slots for the queue");
 
     static const size_type MAX_SIZE = size_type(SIZE);
 
@@ -669,6 +720,64 @@ namespace etl
     /// The uninitialised buffer of T used in the queue_mpmc_mutex.
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
   };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity mpmc queue that uses a buffer supplied by the caller.
+  /// The buffer must be aligned for T, hold max_size values and outlive the queue.
+  /// max_size must not exceed the telemetry's MAX_SLOTS.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TTelemetry   The telemetry policy. See queue_telemetry.h.
+  /// \tparam TMutex       The lock. etl::mutex, or a spinning lock such as etl::spinlock for short critical sections.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none, typename TMutex = etl::mutex>
+  class queue_mpmc_mutex_ext : public etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TTelemetry, TMutex>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TTelemetry, TMutex> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    queue_mpmc_mutex_ext(void* buffer, size_type max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return max_size * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_mutex_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_mutex_ext(const queue_mpmc_mutex_ext&) ETL_DELETE;
+    queue_mpmc_mutex_ext& operator = (const queue_mpmc_mutex_ext&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    queue_mpmc_mutex_ext(queue_mpmc_mutex_ext&&) = delete;
+    queue_mpmc_mutex_ext& operator = (queue_mpmc_mutex_ext&&) = delete;
+#endif
+  };
 }
 
 #undef ETL_FILE
@@ -43,6 +43,9 @@ SOFTWARE.
 #include "memory_model.h"
 #include "integral_limits.h"
 #include "utility.h"
+#include "array_view.h"
+#include "private/queue_batch.h"
+#include "queue_telemetry.h"
 
 #undef ETL_FILE
 #define ETL_FILE "47"
@@ -76,7 +79,7 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      size_type next_index = get_next_index(write.load(etl::memory_order_acquire), RESERVED);
+      size_type next_index = get_next_index(write.load(etl::memory_order_acquire));
 
       return (next_index == read.load(etl::memory_order_acquire));
     }
@@ -98,7 +101,7 @@ namespace etl
       }
       else
       {
-        n = RESERVED - read_index + write_index - 1;
+        n = RESERVED - read_index + write_index;
       }
 
       return n;
@@ -131,21 +134,65 @@ namespace etl
 
   protected:
 
-    queue_spsc_atomic_base(size_type reserved_)
+    ETL_CONSTEXPR queue_spsc_atomic_base(size_type reserved_)
       : write(0),
+        read_cache(0),
+#if ETL_CACHE_LINE_SIZE > 0
+        padding1(),
+#endif
         read(0),
-        RESERVED(reserved_)
+        write_cache(0),
+#if ETL_CACHE_LINE_SIZE > 0
+        padding2(),
+#endif
+        RESERVED(reserved_),
+        INDEX_MASK(((reserved_ & (reserved_ - 1U)) == 0U) ? size_type(reserved_ - 1U) : size_type(0U))
+    {
+    }
+
+    //*************************************************************************
+    /// Is there room for the next push?
+    /// Only reloads 'read' when the cached copy says the queue is full.
+    /// Called from the 'push' thread.
+    //*************************************************************************
+    bool has_space(size_type next_index)
+    {
+      if (next_index == read_cache)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+      }
+
+      return (next_index != read_cache);
+    }
+
+    //*************************************************************************
+    /// Is there an item to pop?
+    /// Only reloads 'write' when the cached copy says the queue is empty.
+    /// Called from the 'pop' thread.
+    //*************************************************************************
+    bool has_data(size_type read_index)
     {
+      if (read_index == write_cache)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+      }
+
+      return (read_index != write_cache);
     }
 
     //*************************************************************************
     /// Calculate the next index.
+    /// Masks when the buffer size is a power of two.
     //*************************************************************************
-    static size_type get_next_index(size_type index, size_type maximum)
+    size_type get_next_index(size_type index) const
     {
       ++index;
 
-      if (index == maximum)
+      if (INDEX_MASK != 0U)
+      {
+        index &= INDEX_MASK;
+      }
+      else if (index == RESERVED)
       {
         index = 0;
       }
@@ -153,9 +200,19 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    // The indexes written by each thread are kept on separate cache lines.
+    etl::atomic<size_type> write;       ///< Where to input new data.
+    size_type              read_cache;  ///< The 'push' thread's copy of 'read'.
+#if ETL_CACHE_LINE_SIZE > 0
+    char                   padding1[ETL_CACHE_LINE_SIZE];
+#endif
+    etl::atomic<size_type> read;        ///< Where to get the oldest data.
+    size_type              write_cache; ///< The 'pop' thread's copy of 'write'.
+#if ETL_CACHE_LINE_SIZE > 0
+    char                   padding2[ETL_CACHE_LINE_SIZE];
+#endif
+    const size_type RESERVED;           ///< The maximum number of items in the queue.
+    const size_type INDEX_MASK;         ///< RESERVED - 1 if RESERVED is a power of two, otherwise 0.
 
   private:
 
@@ -186,8 +243,8 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_spsc_atomic holds.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>, private TTelemetry
   {
   private:
 
@@ -207,6 +264,10 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::has_space;
+    using base_t::has_data;
+    using base_t::read_cache;
+    using base_t::write_cache;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -214,18 +275,22 @@ namespace etl
     bool push(const_reference value)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 
@@ -236,18 +301,22 @@ namespace etl
     bool push(rvalue_reference value)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index = get_next_index(write_index, RESERVED);
+      size_type next_index = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 #endif
@@ -261,18 +330,22 @@ namespace etl
     bool emplace(Args&&... args)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 #else
@@ -284,18 +357,22 @@ namespace etl
     bool emplace(const T1& value1)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 
@@ -307,18 +384,22 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 
@@ -330,18 +411,22 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2, const T3& value3)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 
@@ -353,18 +438,22 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
+        telemetry_push(write_index, next_index);
+
         write.store(next_index, etl::memory_order_release);
 
         return true;
       }
 
       // Queue is full.
+      telemetry_push_failed();
+
       return false;
     }
 #endif
@@ -376,17 +465,19 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      size_type next_index = get_next_index(read_index, RESERVED);
+      size_type next_index = get_next_index(read_index);
 
       value = p_buffer[read_index];
       p_buffer[read_index].~T();
 
+      telemetry_pop(read_index);
+
       read.store(next_index, etl::memory_order_release);
 
       return true;
@@ -396,21 +487,23 @@ namespace etl
     //*************************************************************************
     /// Pop a value from the queue.
     //*************************************************************************
-      bool pop(rvalue_reference value)
+    bool pop(rvalue_reference value)
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      size_type next_index = get_next_index(read_index, RESERVED);
+      size_type next_index = get_next_index(read_index);
 
       value = etl::move(p_buffer[read_index]);
       p_buffer[read_index].~T();
 
+      telemetry_pop(read_index);
+
       read.store(next_index, etl::memory_order_release);
 
       return true;
@@ -424,21 +517,160 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      size_type next_index = get_next_index(read_index, RESERVED);
+      size_type next_index = get_next_index(read_index);
 
       p_buffer[read_index].~T();
 
+      telemetry_pop(read_index);
+
       read.store(next_index, etl::memory_order_release);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// The values are copied in at most two contiguous blocks and published
+    /// with a single store.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      size_t free = get_free(write_index, read_cache);
+
+      if (free < n)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+        free = get_free(write_index, read_cache);
+      }
+
+      const size_t count = (n < free) ? n : free;
+      const size_t first = (count < size_t(RESERVED - write_index)) ? count : size_t(RESERVED - write_index);
+
+      private_queue_batch::copy_in(p_buffer + write_index, p_values, first);
+      private_queue_batch::copy_in(p_buffer, p_values + first, count - first);
+
+      telemetry_push(write_index, count, n);
+
+      if (count != 0U)
+      {
+        write.store(size_type((first == size_t(RESERVED - write_index)) ? (count - first) : (write_index + count)), etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue.
+    /// The values are copied out in at most two contiguous blocks and
+    /// released with a single store.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      size_t used = get_used(write_cache, read_index);
+
+      if (used < n)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+        used = get_used(write_cache, read_index);
+      }
+
+      const size_t count = (n < used) ? n : used;
+      const size_t first = (count < size_t(RESERVED - read_index)) ? count : size_t(RESERVED - read_index);
+
+      private_queue_batch::copy_out(p_values, p_buffer + read_index, first);
+      private_queue_batch::copy_out(p_values + first, p_buffer, count - first);
+
+      telemetry_pop(read_index, count);
+
+      if (count != 0U)
+      {
+        read.store(size_type((first == size_t(RESERVED - read_index)) ? (count - first) : (read_index + count)), etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns a view of up to n contiguous free slots, for the producer to
+    /// write into directly. The view may be shorter than n, or empty.
+    /// The values are not visible to the consumer until write_commit is called.
+    /// Only for trivially copyable types.
+    //*************************************************************************
+    etl::array_view<T> write_reserve(size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Zero copy access requires a trivially copyable type");
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      size_t free = get_free(write_index, read_cache);
+
+      if (free < n)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+        free = get_free(write_index, read_cache);
+      }
+
+      const size_t contiguous = (free < size_t(RESERVED - write_index)) ? free : size_t(RESERVED - write_index);
+
+      return etl::array_view<T>(p_buffer + write_index, (n < contiguous) ? n : contiguous);
+    }
+
+    //*************************************************************************
+    /// Publishes the first n slots of the view returned by write_reserve.
+    //*************************************************************************
+    void write_commit(size_t n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      telemetry_push(write_index, n, n);
+
+      write.store(size_type((n == size_t(RESERVED - write_index)) ? 0U : (write_index + n)), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the contiguous values at the front of the queue, for
+    /// the consumer to read in place. The view may be empty.
+    /// The slots are not reused until read_release is called.
+    /// Only for trivially copyable types.
+    //*************************************************************************
+    etl::array_view<const T> read_acquire()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Zero copy access requires a trivially copyable type");
+
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      write_cache = write.load(etl::memory_order_acquire);
+
+      const size_t used       = get_used(write_cache, read_index);
+      const size_t contiguous = (used < size_t(RESERVED - read_index)) ? used : size_t(RESERVED - read_index);
+
+      return etl::array_view<const T>(p_buffer + read_index, contiguous);
+    }
+
+    //*************************************************************************
+    /// Releases the first n values of the view returned by read_acquire.
+    //*************************************************************************
+    void read_release(size_t n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      telemetry_pop(read_index, n);
+
+      read.store(size_type((n == size_t(RESERVED - read_index)) ? 0U : (read_index + n)), etl::memory_order_release);
+    }
+
     //*************************************************************************
     /// Clear the queue.
     /// Must be called from thread that pops the queue or when there is no
@@ -452,12 +684,25 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// The telemetry policy, for reading the statistics.
+    //*************************************************************************
+    const TTelemetry& telemetry() const
+    {
+      return *this;
+    }
+
+    TTelemetry& telemetry()
+    {
+      return *this;
+    }
+
   protected:
 
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
-    iqueue_spsc_atomic(T* p_buffer_, size_type reserved_)
+    ETL_CONSTEXPR iqueue_spsc_atomic(T* p_buffer_, size_type reserved_)
       : base_t(reserved_),
         p_buffer(p_buffer_)
     {
@@ -465,6 +710,77 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// The number of items between the read and write indexes.
+    //*************************************************************************
+    size_t get_used(size_type write_index, size_type read_index) const
+    {
+      return (write_index >= read_index) ? size_t(write_index - read_index) : size_t(RESERVED - read_index + write_index);
+    }
+
+    //*************************************************************************
+    /// The number of free slots between the write and read indexes.
+    //*************************************************************************
+    size_t get_free(size_type write_index, size_type read_index) const
+    {
+      return size_t(RESERVED - 1U) - get_used(write_index, read_index);
+    }
+
+    //*************************************************************************
+    /// The telemetry hooks. The 'ENABLED' tests are constant, so these
+    /// compile to nothing for etl::queue_telemetry_none.
+    //*************************************************************************
+    void telemetry_push(size_type write_index, size_type next_index)
+    {
+      if (TTelemetry::ENABLED)
+      {
+        TTelemetry::on_push(write_index, get_used(next_index, read.load(etl::memory_order_acquire)));
+      }
+    }
+
+    void telemetry_push(size_type write_index, size_t count, size_t requested)
+    {
+      if (TTelemetry::ENABLED)
+      {
+        const size_type read_index = read.load(etl::memory_order_acquire);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const size_type next_index = get_next_index(write_index);
+
+          TTelemetry::on_push(write_index, get_used(next_index, read_index));
+          write_index = next_index;
+        }
+
+        if (count < requested)
+        {
+          TTelemetry::on_push_failed();
+        }
+      }
+    }
+
+    void telemetry_push_failed()
+    {
+      TTelemetry::on_push_failed();
+    }
+
+    void telemetry_pop(size_type read_index)
+    {
+      TTelemetry::on_pop(read_index);
+    }
+
+    void telemetry_pop(size_type read_index, size_t count)
+    {
+      if (TTelemetry::ENABLED)
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          TTelemetry::on_pop(read_index);
+          read_index = get_next_index(read_index);
+        }
+      }
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator =(const iqueue_spsc_atomic&) ETL_DELETE;
@@ -484,13 +800,14 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TTelemetry   The telemetry policy. See queue_telemetry.h.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL, TTelemetry>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, TTelemetry> base_t;
 
   public:
 
@@ -503,14 +820,15 @@ namespace etl
   public:
 
     ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max - 1)), "Size too large for memory model");
+    ETL_STATIC_ASSERT((RESERVED_SIZE <= TTelemetry::MAX_SLOTS), "Telemetry has too few slots for the queue");
 
     static const size_type MAX_SIZE = size_type(SIZE);
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    queue_spsc_atomic()
-      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE)
+    ETL_CONSTEXPR queue_spsc_atomic()
+      : base_t(buffer_t::get(buffer), RESERVED_SIZE)
     {
     }
 
@@ -524,8 +842,63 @@ namespace etl
 
   private:
 
+    typedef etl::uninitialized_buffer_of<T, RESERVED_SIZE> buffer_t;
+
     /// The uninitialised buffer of T used in the queue_spsc.
-    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[RESERVED_SIZE];
+    buffer_t buffer;
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc
+  /// A fixed capacity spsc queue that uses a buffer supplied by the caller.
+  /// The queue keeps one slot empty, so the buffer must hold max_size + 1
+  /// values; see buffer_size(). It must be aligned for T and outlive the queue.
+  /// max_size + 1 must not exceed the telemetry's MAX_SLOTS.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TTelemetry   The telemetry policy. See queue_telemetry.h.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TTelemetry = etl::queue_telemetry_none>
+  class queue_spsc_atomic_ext : public iqueue_spsc_atomic<T, MEMORY_MODEL, TTelemetry>
+  {
+  private:
+
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, TTelemetry> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size + 1 values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    queue_spsc_atomic_ext(void* buffer, size_type max_size)
+      : base_t(reinterpret_cast<T*>(buffer), size_type(max_size + 1U))
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return (max_size + 1U) * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_spsc_atomic_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_spsc_atomic_ext(const queue_spsc_atomic_ext&) ETL_DELETE;
+    queue_spsc_atomic_ext& operator = (const queue_spsc_atomic_ext&) ETL_DELETE;
   };
 }
 
@@ -42,6 +42,8 @@ SOFTWARE.
 #include "memory_model.h"
 #include "integral_limits.h"
 #include "utility.h"
+#include "array_view.h"
+#include "private/queue_batch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "46"
@@ -120,6 +122,64 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue from an ISR.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push_from_isr(const T* p_values, size_t n)
+    {
+      return push_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue from an ISR.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop_from_isr(T* p_values, size_t n)
+    {
+      return pop_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Returns a view of up to n contiguous free slots, for the producer to
+    /// write into directly. The view may be shorter than n, or empty.
+    /// The values are not visible to the consumer until write_commit is called.
+    /// Called from ISR.
+    //*************************************************************************
+    etl::array_view<T> write_reserve_from_isr(size_t n)
+    {
+      return write_reserve_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first n slots of the view returned by write_reserve.
+    /// Called from ISR.
+    //*************************************************************************
+    void write_commit_from_isr(size_t n)
+    {
+      write_commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the contiguous values at the front of the queue, for
+    /// the consumer to read in place. The view may be empty.
+    /// The slots are not reused until read_release is called.
+    /// Called from ISR.
+    //*************************************************************************
+    etl::array_view<const T> read_acquire_from_isr()
+    {
+      return read_acquire_implementation();
+    }
+
+    //*************************************************************************
+    /// Releases the first n values of the view returned by read_acquire.
+    /// Called from ISR.
+    //*************************************************************************
+    void read_release_from_isr(size_t n)
+    {
+      read_release_implementation(n);
+    }
+
     //*************************************************************************
     /// How much free space available in the queue.
     /// Called from ISR.
@@ -190,7 +250,8 @@ namespace etl
         write_index(0),
         read_index(0),
         current_size(0),
-        MAX_SIZE(max_size_)
+        MAX_SIZE(max_size_),
+        INDEX_MASK(((max_size_ & (max_size_ - 1U)) == 0U) ? size_type(max_size_ - 1U) : size_type(0U))
     {
     }
 
@@ -203,7 +264,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -224,7 +285,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -249,7 +310,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -271,7 +332,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -293,7 +354,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -315,7 +376,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -337,7 +398,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -364,7 +425,7 @@ namespace etl
       value = p_buffer[read_index];
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
@@ -386,7 +447,7 @@ namespace etl
       value = etl::move(p_buffer[read_index]);
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
@@ -407,21 +468,105 @@ namespace etl
 
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// The values are copied in at most two contiguous blocks.
+    //*************************************************************************
+    size_t push_implementation(const T* p_values, size_t n)
+    {
+      const size_t count = (n < size_t(MAX_SIZE - current_size)) ? n : size_t(MAX_SIZE - current_size);
+      const size_t first = (count < size_t(MAX_SIZE - write_index)) ? count : size_t(MAX_SIZE - write_index);
+
+      private_queue_batch::copy_in(p_buffer + write_index, p_values, first);
+      private_queue_batch::copy_in(p_buffer, p_values + first, count - first);
+
+      write_index = size_type((first == size_t(MAX_SIZE - write_index)) ? (count - first) : (write_index + count));
+      current_size += size_type(count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue.
+    /// The values are copied out in at most two contiguous blocks.
+    //*************************************************************************
+    size_t pop_implementation(T* p_values, size_t n)
+    {
+      const size_t count = (n < size_t(current_size)) ? n : size_t(current_size);
+      const size_t first = (count < size_t(MAX_SIZE - read_index)) ? count : size_t(MAX_SIZE - read_index);
+
+      private_queue_batch::copy_out(p_values, p_buffer + read_index, first);
+      private_queue_batch::copy_out(p_values + first, p_buffer, count - first);
+
+      read_index = size_type((first == size_t(MAX_SIZE - read_index)) ? (count - first) : (read_index + count));
+      current_size -= size_type(count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns a view of up to n contiguous free slots.
+    //*************************************************************************
+    etl::array_view<T> write_reserve_implementation(size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Zero copy access requires a trivially copyable type");
+
+      const size_t free       = size_t(MAX_SIZE - current_size);
+      const size_t contiguous = (free < size_t(MAX_SIZE - write_index)) ? free : size_t(MAX_SIZE - write_index);
+
+      return etl::array_view<T>(p_buffer + write_index, (n < contiguous) ? n : contiguous);
+    }
+
+    //*************************************************************************
+    /// Publishes n reserved slots.
+    //*************************************************************************
+    void write_commit_implementation(size_t n)
+    {
+      write_index = size_type((n == size_t(MAX_SIZE - write_index)) ? 0U : (write_index + n));
+      current_size += size_type(n);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the contiguous values at the front of the queue.
+    //*************************************************************************
+    etl::array_view<const T> read_acquire_implementation() const
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Zero copy access requires a trivially copyable type");
+
+      const size_t contiguous = (size_t(current_size) < size_t(MAX_SIZE - read_index)) ? size_t(current_size) : size_t(MAX_SIZE - read_index);
+
+      return etl::array_view<const T>(p_buffer + read_index, contiguous);
+    }
+
+    //*************************************************************************
+    /// Releases n acquired values.
+    //*************************************************************************
+    void read_release_implementation(size_t n)
+    {
+      read_index = size_type((n == size_t(MAX_SIZE - read_index)) ? 0U : (read_index + n));
+      current_size -= size_type(n);
+    }
+
     //*************************************************************************
     /// Calculate the next index.
+    /// Masks when the buffer size is a power of two.
     //*************************************************************************
-    static size_type get_next_index(size_type index, size_type maximum)
+    size_type get_next_index(size_type index) const
     {
       ++index;
 
-      if (index == maximum)
+      if (INDEX_MASK != 0U)
+      {
+        index &= INDEX_MASK;
+      }
+      else if (index == MAX_SIZE)
       {
         index = 0;
       }
@@ -434,6 +579,7 @@ namespace etl
     size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
     const size_type MAX_SIZE; ///< The maximum number of items in the queue.
+    const size_type INDEX_MASK; ///< MAX_SIZE - 1 if MAX_SIZE is a power of two, otherwise 0.
 
   private:
 
@@ -637,6 +783,92 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      TAccess::lock();
+
+      size_t result = this->push_implementation(p_values, n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t n)
+    {
+      TAccess::lock();
+
+      size_t result = this->pop_implementation(p_values, n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Returns a view of up to n contiguous free slots, for the producer to
+    /// write into directly. The view may be shorter than n, or empty.
+    /// The values are not visible to the consumer until write_commit is called.
+    //*************************************************************************
+    etl::array_view<T> write_reserve(size_t n)
+    {
+      TAccess::lock();
+
+      etl::array_view<T> result = this->write_reserve_implementation(n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes the first n slots of the view returned by write_reserve.
+    //*************************************************************************
+    void write_commit(size_t n)
+    {
+      TAccess::lock();
+
+      this->write_commit_implementation(n);
+
+      TAccess::unlock();
+    }
+
+    //*************************************************************************
+    /// Returns a view of the contiguous values at the front of the queue, for
+    /// the consumer to read in place. The view may be empty.
+    /// The slots are not reused until read_release is called.
+    //*************************************************************************
+    etl::array_view<const T> read_acquire()
+    {
+      TAccess::lock();
+
+      etl::array_view<const T> result = this->read_acquire_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Releases the first n values of the view returned by read_acquire.
+    //*************************************************************************
+    void read_release(size_t n)
+    {
+      TAccess::lock();
+
+      this->read_release_implementation(n);
+
+      TAccess::unlock();
+    }
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
@@ -785,6 +1017,62 @@ namespace etl
     /// The uninitialised buffer of T used in the queue_spsc_isr.
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
   };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc
+  /// A fixed capacity spsc queue that uses a buffer supplied by the caller.
+  /// The buffer must be aligned for T, hold max_size values and outlive the queue.
+  /// \tparam T            The type this queue should support.
+  /// \tparam TAccess      The type that will lock and unlock interrupts.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, typename TAccess, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_spsc_isr_ext : public etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    queue_spsc_isr_ext(void* buffer, size_type max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return max_size * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_spsc_isr_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_spsc_isr_ext(const queue_spsc_isr_ext&);
+    queue_spsc_isr_ext& operator = (const queue_spsc_isr_ext&);
+
+#if ETL_CPP11_SUPPORTED
+    queue_spsc_isr_ext(queue_spsc_isr_ext&&) = delete;
+    queue_spsc_isr_ext& operator =(queue_spsc_isr_ext&&) = delete;
+#endif
+  };
 }
 
 #undef ETL_FILE
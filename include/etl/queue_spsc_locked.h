@@ -43,6 +43,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "function.h"
 #include "utility.h"
+#include "private/queue_batch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "54"
@@ -121,6 +122,24 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue from an unlocked context.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push_from_unlocked(const T* p_values, size_t n)
+    {
+      return push_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue from an unlocked context.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop_from_unlocked(T* p_values, size_t n)
+    {
+      return pop_implementation(p_values, n);
+    }
+
     //*************************************************************************
     /// How much free space available in the queue.
     /// Called from ISR.
@@ -191,7 +210,8 @@ namespace etl
         write_index(0),
         read_index(0),
         current_size(0),
-        MAX_SIZE(max_size_)
+        MAX_SIZE(max_size_),
+        INDEX_MASK(((max_size_ & (max_size_ - 1U)) == 0U) ? size_type(max_size_ - 1U) : size_type(0U))
     {
     }
 
@@ -204,7 +224,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -225,7 +245,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -250,7 +270,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -272,7 +292,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -294,7 +314,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -316,7 +336,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -338,7 +358,7 @@ namespace etl
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write_index = get_next_index(write_index);
 
         ++current_size;
 
@@ -365,7 +385,7 @@ namespace etl
       value = p_buffer[read_index];
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
@@ -387,7 +407,7 @@ namespace etl
       value = etl::move(p_buffer[read_index]);
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
@@ -408,21 +428,62 @@ namespace etl
 
       p_buffer[read_index].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read_index = get_next_index(read_index);
 
       --current_size;
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// The values are copied in at most two contiguous blocks.
+    //*************************************************************************
+    size_t push_implementation(const T* p_values, size_t n)
+    {
+      const size_t count = (n < size_t(MAX_SIZE - current_size)) ? n : size_t(MAX_SIZE - current_size);
+      const size_t first = (count < size_t(MAX_SIZE - write_index)) ? count : size_t(MAX_SIZE - write_index);
+
+      private_queue_batch::copy_in(p_buffer + write_index, p_values, first);
+      private_queue_batch::copy_in(p_buffer, p_values + first, count - first);
+
+      write_index = size_type((first == size_t(MAX_SIZE - write_index)) ? (count - first) : (write_index + count));
+      current_size += size_type(count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue.
+    /// The values are copied out in at most two contiguous blocks.
+    //*************************************************************************
+    size_t pop_implementation(T* p_values, size_t n)
+    {
+      const size_t count = (n < size_t(current_size)) ? n : size_t(current_size);
+      const size_t first = (count < size_t(MAX_SIZE - read_index)) ? count : size_t(MAX_SIZE - read_index);
+
+      private_queue_batch::copy_out(p_values, p_buffer + read_index, first);
+      private_queue_batch::copy_out(p_values + first, p_buffer, count - first);
+
+      read_index = size_type((first == size_t(MAX_SIZE - read_index)) ? (count - first) : (read_index + count));
+      current_size -= size_type(count);
+
+      return count;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
+    /// Masks when the buffer size is a power of two.
     //*************************************************************************
-    static size_type get_next_index(size_type index, size_type maximum)
+    size_type get_next_index(size_type index) const
     {
       ++index;
 
-      if (index == maximum)
+      if (INDEX_MASK != 0U)
+      {
+        index &= INDEX_MASK;
+      }
+      else if (index == MAX_SIZE)
       {
         index = 0;
       }
@@ -435,6 +496,7 @@ namespace etl
     size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
     const size_type MAX_SIZE; ///< The maximum number of items in the queue.
+    const size_type INDEX_MASK; ///< MAX_SIZE - 1 if MAX_SIZE is a power of two, otherwise 0.
 
   private:
 
@@ -634,6 +696,36 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      lock();
+
+      size_t result = this->push_implementation(p_values, n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to n values from the queue.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t n)
+    {
+      lock();
+
+      size_t result = this->pop_implementation(p_values, n);
+
+      unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
@@ -786,6 +878,64 @@ namespace etl
     /// The uninitialised buffer of T used in the queue_spsc_locked.
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
   };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc
+  /// A fixed capacity spsc queue that uses a buffer supplied by the caller.
+  /// The buffer must be aligned for T, hold max_size values and outlive the queue.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_spsc_locked_ext : public etl::iqueue_spsc_locked<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_spsc_locked<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for max_size values.
+    ///\param max_size The maximum number of values held.
+    //*************************************************************************
+    queue_spsc_locked_ext(void* buffer,
+                          size_type max_size,
+                          const etl::ifunction<void>& lock,
+                          const etl::ifunction<void>& unlock)
+      : base_t(reinterpret_cast<T*>(buffer), max_size, lock, unlock)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size values.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return max_size * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_spsc_locked_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_spsc_locked_ext(const queue_spsc_locked_ext&) ETL_DELETE;
+    queue_spsc_locked_ext& operator = (const queue_spsc_locked_ext&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    queue_spsc_locked_ext(queue_spsc_locked_ext&&) = delete;
+    queue_spsc_locked_ext& operator =(queue_spsc_locked_ext&&) = delete;
+#endif
+  };
 }
 
 #undef ETL_FILE
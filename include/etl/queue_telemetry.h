@@ -0,0 +1,275 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_TELEMETRY_INCLUDED
+#define ETL_QUEUE_TELEMETRY_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "integral_limits.h"
+
+///\defgroup queue_telemetry queue_telemetry
+/// Policies that record how a queue is used, so that its capacity can be
+/// chosen from measurements.
+/// The queues call the policy's hooks from push and pop. The default,
+/// etl::queue_telemetry_none, has empty hooks, no state and is an empty base,
+/// so it costs nothing.
+/// The hooks are called by the producer and the consumer. The statistics may
+/// be read from any thread.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue_telemetry
+  /// No telemetry.
+  //***************************************************************************
+  class queue_telemetry_none
+  {
+  public:
+
+    static const bool   ENABLED   = false;
+    static const size_t MAX_SLOTS = etl::integral_limits<size_t>::max;
+
+    void on_push(size_t /*slot*/, size_t /*size*/)
+    {
+    }
+
+    void on_push_failed()
+    {
+    }
+
+    void on_pop(size_t /*slot*/)
+    {
+    }
+  };
+}
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue_telemetry
+  /// Counts pushes, pops and failed pushes, and tracks the high water mark.
+  //***************************************************************************
+  class queue_telemetry
+  {
+  public:
+
+    static const bool   ENABLED   = true;
+    static const size_t MAX_SLOTS = etl::integral_limits<size_t>::max;
+
+    queue_telemetry()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Called by the producer after a push. 'size' is the size after the push.
+    //*************************************************************************
+    void on_push(size_t /*slot*/, size_t size)
+    {
+      push_count.fetch_add(1U, etl::memory_order_relaxed);
+
+      // Only the producer writes the mark, so no compare-exchange is needed.
+      if (size > high_water.load(etl::memory_order_relaxed))
+      {
+        high_water.store(size, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Called by the producer when a push finds the queue full.
+    //*************************************************************************
+    void on_push_failed()
+    {
+      failure_count.fetch_add(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Called by the consumer after a pop.
+    //*************************************************************************
+    void on_pop(size_t /*slot*/)
+    {
+      pop_count.fetch_add(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The largest number of items that the queue has held.
+    //*************************************************************************
+    size_t high_water_mark() const
+    {
+      return high_water.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of pushes that failed because the queue was full.
+    //*************************************************************************
+    uint32_t push_failures() const
+    {
+      return failure_count.load(etl::memory_order_relaxed);
+    }
+
+    uint32_t pushes() const
+    {
+      return push_count.load(etl::memory_order_relaxed);
+    }
+
+    uint32_t pops() const
+    {
+      return pop_count.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Clears the statistics. Not atomic with respect to the queue's users.
+    //*************************************************************************
+    void reset()
+    {
+      high_water.store(0U, etl::memory_order_relaxed);
+      failure_count.store(0U, etl::memory_order_relaxed);
+      push_count.store(0U, etl::memory_order_relaxed);
+      pop_count.store(0U, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    etl::atomic<size_t>   high_water;
+    etl::atomic<uint32_t> failure_count;
+    etl::atomic<uint32_t> push_count;
+    etl::atomic<uint32_t> pop_count;
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_telemetry
+  /// As queue_telemetry, and also measures how long items wait in the queue.
+  /// Each slot is time stamped on push and the stamp is compared on pop.
+  ///\tparam CAPACITY The capacity of the queue.
+  ///\tparam TCounter The time source. Has a value_type and a value_type read() const,
+  ///                 as the etl::benchmark cycle counters do.
+  //***************************************************************************
+  template <const size_t CAPACITY, typename TCounter>
+  class queue_telemetry_latency : public etl::queue_telemetry
+  {
+  public:
+
+    typedef typename TCounter::value_type value_type;
+
+    /// An spsc queue uses one more slot than its capacity.
+    static const size_t MAX_SLOTS = CAPACITY + 1U;
+
+    queue_telemetry_latency()
+      : time_source()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Called by the producer after a push, before the item is published.
+    //*************************************************************************
+    void on_push(size_t slot, size_t size)
+    {
+      queue_telemetry::on_push(slot, size);
+      stamps[slot] = time_source.read();
+    }
+
+    //*************************************************************************
+    /// Called by the consumer after a pop.
+    //*************************************************************************
+    void on_pop(size_t slot)
+    {
+      const value_type latency = value_type(time_source.read() - stamps[slot]);
+
+      queue_telemetry::on_pop(slot);
+
+      latency_total.store(value_type(latency_total.load(etl::memory_order_relaxed) + latency), etl::memory_order_relaxed);
+
+      if (latency > latency_max.load(etl::memory_order_relaxed))
+      {
+        latency_max.store(latency, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// The longest time that an item waited.
+    //*************************************************************************
+    value_type max_latency() const
+    {
+      return latency_max.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The total time that popped items waited.
+    //*************************************************************************
+    value_type total_latency() const
+    {
+      return latency_total.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The mean time that popped items waited.
+    //*************************************************************************
+    value_type mean_latency() const
+    {
+      const uint32_t n = pops();
+
+      return (n == 0U) ? value_type(0U) : value_type(total_latency() / n);
+    }
+
+    //*************************************************************************
+    /// The time source, for example to start a hardware counter.
+    //*************************************************************************
+    TCounter& counter()
+    {
+      return time_source;
+    }
+
+    void reset()
+    {
+      queue_telemetry::reset();
+      latency_max.store(0U, etl::memory_order_relaxed);
+      latency_total.store(0U, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    TCounter                time_source;
+    etl::atomic<value_type> latency_max;
+    etl::atomic<value_type> latency_total;
+    value_type              stamps[MAX_SLOTS];
+  };
+}
+
+#endif // ETL_HAS_ATOMIC
+
+#endif
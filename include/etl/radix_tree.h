@@ -0,0 +1,963 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_TREE_INCLUDED
+#define ETL_RADIX_TREE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "pool.h"
+#include "optional.h"
+#include "string_view.h"
+#include "smallest.h"
+#include "binary.h"
+#include "static_assert.h"
+
+///\defgroup radix_tree radix_tree
+/// Fixed capacity radix trees, for exact and longest prefix match lookups in
+/// time proportional to the length of the key, rather than the number of keys.
+/// radix_tree maps strings, such as topics, to values. Each edge is labelled
+/// with a run of characters, stored in a fixed size character arena.
+/// bit_radix_tree maps bit prefixes, such as IPv4 or IPv6 routes, to values.
+/// Nodes are allocated from an etl::pool. Characters of erased keys are not
+/// returned to the arena until the tree is cleared.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A radix tree of string keys, with up to NODES nodes and CHARS characters
+  /// of edge labels. A tree of n keys uses at most 2n - 1 nodes, and at most
+  /// the total length of the keys in characters.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  template <typename TValue, const size_t NODES, const size_t CHARS>
+  class radix_tree
+  {
+  public:
+
+    typedef TValue value_type;
+    typedef typename etl::smallest_uint_for_value<CHARS>::type offset_type;
+
+    static const size_t MAX_NODES = NODES;
+    static const size_t MAX_CHARS = CHARS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    radix_tree()
+      : used(0U)
+      , count(0U)
+    {
+      root.first_child  = nullptr;
+      root.next_sibling = nullptr;
+      root.offset       = 0U;
+      root.length       = 0U;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_tree()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Inserts a key, or replaces the value of an existing key.
+    /// Returns false, leaving the tree unchanged, if there is no room.
+    //*************************************************************************
+    bool insert(etl::string_view key, const TValue& value)
+    {
+      node*  n = &root;
+      size_t i = 0U;
+
+      while (i != key.size())
+      {
+        node* previous;
+        node* child = find_child(n, key[i], previous);
+
+        if (child == nullptr)
+        {
+          // A new leaf for the rest of the key.
+          const size_t rest = key.size() - i;
+
+          if (node_pool.full() || (rest > (CHARS - used)))
+          {
+            return false;
+          }
+
+          node* leaf = create_node(store(key.data() + i, rest), rest);
+          leaf->value = value;
+          link(n, previous, leaf);
+          ++count;
+
+          return true;
+        }
+
+        const size_t common = common_length(child, key, i);
+
+        if (common != child->length)
+        {
+          // Split the edge where the key leaves it.
+          const size_t rest = key.size() - i - common;
+
+          if ((node_pool.available() < ((rest == 0U) ? 1U : 2U)) || (rest > (CHARS - used)))
+          {
+            return false;
+          }
+
+          node* middle = create_node(child->offset, common);
+
+          middle->next_sibling = child->next_sibling;
+          middle->first_child  = child;
+          child->next_sibling  = nullptr;
+          child->offset        = offset_type(child->offset + common);
+          child->length        = offset_type(child->length - common);
+
+          if (previous == nullptr)
+          {
+            n->first_child = middle;
+          }
+          else
+          {
+            previous->next_sibling = middle;
+          }
+
+          child = middle;
+        }
+
+        n  = child;
+        i += common;
+      }
+
+      if (!n->value)
+      {
+        ++count;
+      }
+
+      n->value = value;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the value of a key, or nullptr.
+    //*************************************************************************
+    TValue* find(etl::string_view key)
+    {
+      return const_cast<TValue*>(static_cast<const radix_tree&>(*this).find(key));
+    }
+
+    //*************************************************************************
+    /// Finds the value of a key, or nullptr.
+    //*************************************************************************
+    const TValue* find(etl::string_view key) const
+    {
+      const node* n = &root;
+      size_t      i = 0U;
+
+      while (i != key.size())
+      {
+        n = match_child(n, key, i);
+
+        if (n == nullptr)
+        {
+          return nullptr;
+        }
+
+        i += n->length;
+      }
+
+      return n->value ? &*n->value : nullptr;
+    }
+
+    //*************************************************************************
+    /// Checks whether the tree contains a key.
+    //*************************************************************************
+    bool contains(etl::string_view key) const
+    {
+      return find(key) != nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest key that is a prefix of 'key', or
+    /// nullptr. 'length' is set to the length of that key.
+    //*************************************************************************
+    const TValue* longest_prefix_match(etl::string_view key, size_t& length) const
+    {
+      const node*   n    = &root;
+      const TValue* best = nullptr;
+      size_t        i    = 0U;
+
+      length = 0U;
+
+      while (n != nullptr)
+      {
+        if (n->value)
+        {
+          best   = &*n->value;
+          length = i;
+        }
+
+        if (i == key.size())
+        {
+          break;
+        }
+
+        n = match_child(n, key, i);
+
+        if (n != nullptr)
+        {
+          i += n->length;
+        }
+      }
+
+      return best;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest key that is a prefix of 'key', or nullptr.
+    //*************************************************************************
+    const TValue* longest_prefix_match(etl::string_view key) const
+    {
+      size_t length;
+
+      return longest_prefix_match(key, length);
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest key that is a prefix of 'key', or nullptr.
+    //*************************************************************************
+    TValue* longest_prefix_match(etl::string_view key)
+    {
+      size_t length;
+
+      return const_cast<TValue*>(static_cast<const radix_tree&>(*this).longest_prefix_match(key, length));
+    }
+
+    //*************************************************************************
+    /// Erases a key.
+    /// Returns false if it was not found.
+    //*************************************************************************
+    bool erase(etl::string_view key)
+    {
+      TValue* p_value = find(key);
+
+      if (p_value == nullptr)
+      {
+        return false;
+      }
+
+      // Find the node again, for access to its optional.
+      node*  n = &root;
+      size_t i = 0U;
+
+      while (i != key.size())
+      {
+        n  = const_cast<node*>(match_child(n, key, i));
+        i += n->length;
+      }
+
+      n->value.reset();
+      --count;
+
+      // Remove the nodes along the key that no longer lead to a value.
+      while (remove_empty_leaf(key))
+      {
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases every key.
+    //*************************************************************************
+    void clear()
+    {
+      // Splice each child list into the sibling chain, then release the chain.
+      node* n = root.first_child;
+
+      while (n != nullptr)
+      {
+        if (n->first_child != nullptr)
+        {
+          node* last = n->first_child;
+
+          while (last->next_sibling != nullptr)
+          {
+            last = last->next_sibling;
+          }
+
+          last->next_sibling = n->next_sibling;
+          n->next_sibling    = n->first_child;
+          n->first_child     = nullptr;
+        }
+
+        node* next = n->next_sibling;
+        node_pool.template destroy<node>(n);
+        n = next;
+      }
+
+      root.first_child = nullptr;
+      root.value.reset();
+      used  = 0U;
+      count = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of keys.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks whether there are no keys.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of nodes in use.
+    //*************************************************************************
+    size_t nodes_used() const
+    {
+      return node_pool.size();
+    }
+
+    //*************************************************************************
+    /// The number of label characters in use.
+    //*************************************************************************
+    size_t chars_used() const
+    {
+      return used;
+    }
+
+  private:
+
+    struct node
+    {
+      node()
+        : first_child(nullptr)
+        , next_sibling(nullptr)
+        , offset(0U)
+        , length(0U)
+      {
+      }
+
+      node*                 first_child;  ///< Children are ordered by the first character of their labels.
+      node*                 next_sibling;
+      offset_type           offset;       ///< The edge label in the arena.
+      offset_type           length;
+      etl::optional<TValue> value;
+    };
+
+    //*************************************************************************
+    unsigned char first_char(const node* n) const
+    {
+      return static_cast<unsigned char>(arena[n->offset]);
+    }
+
+    //*************************************************************************
+    /// Finds the child whose label starts with 'c', and the child before
+    /// where it is or would be.
+    //*************************************************************************
+    node* find_child(node* n, char c, node*& previous) const
+    {
+      const unsigned char uc    = static_cast<unsigned char>(c);
+      node*               child = n->first_child;
+
+      previous = nullptr;
+
+      while ((child != nullptr) && (first_char(child) < uc))
+      {
+        previous = child;
+        child    = child->next_sibling;
+      }
+
+      return ((child != nullptr) && (first_char(child) == uc)) ? child : nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the child whose whole label matches the key from 'i'.
+    //*************************************************************************
+    const node* match_child(const node* n, etl::string_view key, size_t i) const
+    {
+      node* previous;
+      const node* child = find_child(const_cast<node*>(n), key[i], previous);
+
+      if ((child == nullptr) ||
+          (child->length > (key.size() - i)) ||
+          (memcmp(arena + child->offset, key.data() + i, child->length) != 0))
+      {
+        return nullptr;
+      }
+
+      return child;
+    }
+
+    //*************************************************************************
+    /// The number of characters of the label that match the key from 'i'.
+    //*************************************************************************
+    size_t common_length(const node* n, etl::string_view key, size_t i) const
+    {
+      const size_t limit = etl::min(size_t(n->length), key.size() - i);
+      size_t       common = 0U;
+
+      while ((common < limit) && (arena[n->offset + common] == key[i + common]))
+      {
+        ++common;
+      }
+
+      return common;
+    }
+
+    //*************************************************************************
+    size_t store(const char* text, size_t length)
+    {
+      const size_t offset = used;
+
+      memcpy(arena + used, text, length);
+      used += length;
+
+      return offset;
+    }
+
+    //*************************************************************************
+    node* create_node(size_t offset, size_t length)
+    {
+      node* n = node_pool.template create<node>();
+
+      n->offset = offset_type(offset);
+      n->length = offset_type(length);
+
+      return n;
+    }
+
+    //*************************************************************************
+    void link(node* parent, node* previous, node* child)
+    {
+      if (previous == nullptr)
+      {
+        child->next_sibling = parent->first_child;
+        parent->first_child = child;
+      }
+      else
+      {
+        child->next_sibling    = previous->next_sibling;
+        previous->next_sibling = child;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the deepest node along the key, if it has no value and no
+    /// children. Returns true if one was removed.
+    //*************************************************************************
+    bool remove_empty_leaf(etl::string_view key)
+    {
+      node*  parent   = nullptr;
+      node*  previous = nullptr;
+      node*  n        = &root;
+      size_t i        = 0U;
+
+      while (i != key.size())
+      {
+        node* p;
+        node* child = find_child(n, key[i], p);
+
+        if ((child == nullptr) || (common_length(child, key, i) != child->length))
+        {
+          break;
+        }
+
+        parent   = n;
+        previous = p;
+        n        = child;
+        i       += child->length;
+      }
+
+      if ((parent == nullptr) || n->value || (n->first_child != nullptr))
+      {
+        return false;
+      }
+
+      if (previous == nullptr)
+      {
+        parent->first_child = n->next_sibling;
+      }
+      else
+      {
+        previous->next_sibling = n->next_sibling;
+      }
+
+      node_pool.template destroy<node>(n);
+
+      return true;
+    }
+
+    node                  root;
+    etl::pool<node, NODES> node_pool;
+    char                  arena[CHARS];
+    size_t                used;
+    size_t                count;
+
+    // Should not be copied.
+    radix_tree(const radix_tree&);
+    radix_tree& operator =(const radix_tree&);
+  };
+
+  template <typename TValue, const size_t NODES, const size_t CHARS>
+  const size_t radix_tree<TValue, NODES, CHARS>::MAX_NODES;
+
+  template <typename TValue, const size_t NODES, const size_t CHARS>
+  const size_t radix_tree<TValue, NODES, CHARS>::MAX_CHARS;
+
+  //***************************************************************************
+  /// A path compressed binary radix tree of bit prefixes of up to KEY_BITS
+  /// bits, with up to NODES nodes. A tree of n prefixes uses at most 2n - 1
+  /// nodes.
+  /// Keys are arrays of KEY_BITS / 8 bytes, most significant bit first, as
+  /// IPv4 and IPv6 addresses are in network byte order.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  template <typename TValue, const size_t NODES, const size_t KEY_BITS>
+  class bit_radix_tree
+  {
+  public:
+
+    ETL_STATIC_ASSERT((KEY_BITS % 8U) == 0U, "KEY_BITS must be a multiple of 8");
+
+    typedef TValue value_type;
+
+    static const size_t MAX_NODES = NODES;
+    static const size_t KEY_BYTES = KEY_BITS / 8U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    bit_radix_tree()
+      : p_root(nullptr)
+      , count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~bit_radix_tree()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Inserts the first 'length' bits of 'key', or replaces the value of an
+    /// existing prefix. Returns false, leaving the tree unchanged, if there is
+    /// no room, or the length is greater than KEY_BITS.
+    //*************************************************************************
+    bool insert(const uint8_t* key, size_t length, const TValue& value)
+    {
+      if (length > KEY_BITS)
+      {
+        return false;
+      }
+
+      node** link = &p_root;
+
+      while (*link != nullptr)
+      {
+        node* n = *link;
+        const size_t common = common_bits(n->key, key, etl::min(size_t(n->length), length));
+
+        if (common < n->length)
+        {
+          // The key leaves, or ends within, the edge to n.
+          if (common == length)
+          {
+            if (node_pool.full())
+            {
+              return false;
+            }
+
+            node* above = create_node(key, length);
+            above->value = value;
+            above->child[bit(n->key, length)] = n;
+            *link = above;
+          }
+          else
+          {
+            if (node_pool.available() < 2U)
+            {
+              return false;
+            }
+
+            node* branch = create_node(key, common);
+            node* leaf   = create_node(key, length);
+            leaf->value = value;
+            branch->child[bit(key, common)]    = leaf;
+            branch->child[bit(n->key, common)] = n;
+            *link = branch;
+          }
+
+          ++count;
+
+          return true;
+        }
+
+        if (n->length == length)
+        {
+          if (!n->value)
+          {
+            ++count;
+          }
+
+          n->value = value;
+
+          return true;
+        }
+
+        link = &n->child[bit(key, n->length)];
+      }
+
+      if (node_pool.full())
+      {
+        return false;
+      }
+
+      node* leaf = create_node(key, length);
+      leaf->value = value;
+      *link = leaf;
+      ++count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the first 'length' bits of 'key', or nullptr.
+    //*************************************************************************
+    TValue* find(const uint8_t* key, size_t length)
+    {
+      node** link = find_link(key, length);
+
+      return (link == nullptr) ? nullptr : &*(*link)->value;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the first 'length' bits of 'key', or nullptr.
+    //*************************************************************************
+    const TValue* find(const uint8_t* key, size_t length) const
+    {
+      return const_cast<bit_radix_tree*>(this)->find(key, length);
+    }
+
+    //*************************************************************************
+    /// Checks whether the tree contains a prefix.
+    //*************************************************************************
+    bool contains(const uint8_t* key, size_t length) const
+    {
+      return find(key, length) != nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest prefix of the KEY_BITS bits of 'key',
+    /// or nullptr. 'length' is set to the length of that prefix.
+    //*************************************************************************
+    const TValue* longest_prefix_match(const uint8_t* key, size_t& length) const
+    {
+      const node*   n    = p_root;
+      const TValue* best = nullptr;
+
+      length = 0U;
+
+      while ((n != nullptr) && (common_bits(n->key, key, n->length) == n->length))
+      {
+        if (n->value)
+        {
+          best   = &*n->value;
+          length = n->length;
+        }
+
+        if (n->length == KEY_BITS)
+        {
+          break;
+        }
+
+        n = n->child[bit(key, n->length)];
+      }
+
+      return best;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest prefix of the KEY_BITS bits of 'key',
+    /// or nullptr.
+    //*************************************************************************
+    const TValue* longest_prefix_match(const uint8_t* key) const
+    {
+      size_t length;
+
+      return longest_prefix_match(key, length);
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest prefix of the KEY_BITS bits of 'key',
+    /// or nullptr.
+    //*************************************************************************
+    TValue* longest_prefix_match(const uint8_t* key)
+    {
+      size_t length;
+
+      return const_cast<TValue*>(static_cast<const bit_radix_tree&>(*this).longest_prefix_match(key, length));
+    }
+
+    //*************************************************************************
+    /// Erases the first 'length' bits of 'key'.
+    /// Returns false if it was not found.
+    //*************************************************************************
+    bool erase(const uint8_t* key, size_t length)
+    {
+      node** parent_link = nullptr;
+      node** link        = &p_root;
+
+      while ((*link != nullptr) && ((*link)->length < length))
+      {
+        if (common_bits((*link)->key, key, (*link)->length) != (*link)->length)
+        {
+          return false;
+        }
+
+        parent_link = link;
+        link        = &(*link)->child[bit(key, (*link)->length)];
+      }
+
+      node* n = *link;
+
+      if ((n == nullptr) || (n->length != length) || !n->value || (common_bits(n->key, key, length) != length))
+      {
+        return false;
+      }
+
+      n->value.reset();
+      --count;
+
+      // Remove the node if it no longer branches, then its parent, if that
+      // no longer branches and has no value.
+      if ((n->child[0] == nullptr) || (n->child[1] == nullptr))
+      {
+        *link = (n->child[0] != nullptr) ? n->child[0] : n->child[1];
+        node_pool.template destroy<node>(n);
+
+        if ((*link == nullptr) && (parent_link != nullptr))
+        {
+          node* parent = *parent_link;
+
+          if (!parent->value)
+          {
+            *parent_link = (parent->child[0] != nullptr) ? parent->child[0] : parent->child[1];
+            node_pool.template destroy<node>(parent);
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases every prefix.
+    //*************************************************************************
+    void clear()
+    {
+      // Rotate left children up until there are none, releasing as we go.
+      node* n = p_root;
+
+      while (n != nullptr)
+      {
+        if (n->child[0] != nullptr)
+        {
+          node* left = n->child[0];
+          n->child[0]    = left->child[1];
+          left->child[1] = n;
+          n = left;
+        }
+        else
+        {
+          node* right = n->child[1];
+          node_pool.template destroy<node>(n);
+          n = right;
+        }
+      }
+
+      p_root = nullptr;
+      count  = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of prefixes.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks whether there are no prefixes.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of nodes in use.
+    //*************************************************************************
+    size_t nodes_used() const
+    {
+      return node_pool.size();
+    }
+
+  private:
+
+    struct node
+    {
+      node()
+        : length(0U)
+      {
+        child[0] = nullptr;
+        child[1] = nullptr;
+      }
+
+      node*                 child[2];
+      uint8_t               key[KEY_BYTES]; ///< The prefix, with the bits after it cleared.
+      typename etl::smallest_uint_for_value<KEY_BITS>::type length;
+      etl::optional<TValue> value;
+    };
+
+    //*************************************************************************
+    /// Bit 'i' of a key, counting from the most significant bit.
+    //*************************************************************************
+    static size_t bit(const uint8_t* key, size_t i)
+    {
+      return (key[i >> 3U] >> (7U - (i & 7U))) & 1U;
+    }
+
+    //*************************************************************************
+    /// The number of leading bits, up to 'limit', that two keys share.
+    //*************************************************************************
+    static size_t common_bits(const uint8_t* a, const uint8_t* b, size_t limit)
+    {
+      size_t i = 0U;
+
+      while (i < limit)
+      {
+        const uint8_t difference = uint8_t(a[i >> 3U] ^ b[i >> 3U]);
+
+        if (difference != 0U)
+        {
+          return etl::min(limit, (i & ~size_t(7U)) + etl::count_leading_zeros(difference));
+        }
+
+        i = (i & ~size_t(7U)) + 8U;
+      }
+
+      return limit;
+    }
+
+    //*************************************************************************
+    node* create_node(const uint8_t* key, size_t length)
+    {
+      node* n = node_pool.template create<node>();
+
+      const size_t whole = length / 8U;
+      const size_t part  = length % 8U;
+
+      memset(n->key, 0, KEY_BYTES);
+      memcpy(n->key, key, whole);
+
+      if (part != 0U)
+      {
+        n->key[whole] = uint8_t(key[whole] & uint8_t(0xFFU << (8U - part)));
+      }
+
+      n->length = typename etl::smallest_uint_for_value<KEY_BITS>::type(length);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The link to the node with a value for the prefix, or nullptr.
+    //*************************************************************************
+    node** find_link(const uint8_t* key, size_t length)
+    {
+      node** link = &p_root;
+
+      while ((*link != nullptr) && ((*link)->length <= length))
+      {
+        node* n = *link;
+
+        if (common_bits(n->key, key, n->length) != n->length)
+        {
+          return nullptr;
+        }
+
+        if (n->length == length)
+        {
+          return n->value ? link : nullptr;
+        }
+
+        link = &n->child[bit(key, n->length)];
+      }
+
+      return nullptr;
+    }
+
+    node*                  p_root;
+    etl::pool<node, NODES> node_pool;
+    size_t                 count;
+
+    // Should not be copied.
+    bit_radix_tree(const bit_radix_tree&);
+    bit_radix_tree& operator =(const bit_radix_tree&);
+  };
+
+  template <typename TValue, const size_t NODES, const size_t KEY_BITS>
+  const size_t bit_radix_tree<TValue, NODES, KEY_BITS>::MAX_NODES;
+
+  template <typename TValue, const size_t NODES, const size_t KEY_BITS>
+  const size_t bit_radix_tree<TValue, NODES, KEY_BITS>::KEY_BYTES;
+}
+
+#endif
@@ -35,9 +35,255 @@ SOFTWARE.
 
 #include "platform.h"
 #include "binary.h"
+#include "static_assert.h"
+#include "type_traits.h"
 
 namespace etl
 {
+  namespace private_random
+  {
+    //*************************************************************************
+    /// 64 x 64 -> 128 bit multiply. Returns the high half, low half in 'low'.
+    //*************************************************************************
+    inline uint64_t multiply_high(uint64_t a, uint64_t b, uint64_t& low)
+    {
+#if defined(__SIZEOF_INT128__)
+      __uint128_t r = a;
+      r *= b;
+      low = uint64_t(r);
+      return uint64_t(r >> 64);
+#else
+      const uint64_t ha = a >> 32;
+      const uint64_t hb = b >> 32;
+      const uint64_t la = uint32_t(a);
+      const uint64_t lb = uint32_t(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+      const uint64_t t   = rl + (rm0 << 32);
+
+      uint64_t c = (t < rl) ? 1U : 0U;
+
+      low = t + (rm1 << 32);
+
+      c += (low < t) ? 1U : 0U;
+
+      return rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Rotates left. Valid for a distance of zero.
+    //*************************************************************************
+    inline uint64_t rotl64(uint64_t value, unsigned distance)
+    {
+      return (value << (distance & 63U)) | (value >> ((0U - distance) & 63U));
+    }
+
+    //*************************************************************************
+    /// Rotates right. Valid for a distance of zero.
+    //*************************************************************************
+    inline uint64_t rotr64(uint64_t value, unsigned distance)
+    {
+      return (value >> (distance & 63U)) | (value << ((0U - distance) & 63U));
+    }
+
+    //*************************************************************************
+    /// Maps a 32 bit generator on to the inclusive range [low, high].
+    /// Lemire's multiply-shift method. Unbiased, and the only division is
+    /// on the rarely taken rejection path.
+    /// https://arxiv.org/abs/1805.10941
+    //*************************************************************************
+    template <typename TGenerator>
+    uint32_t range32(TGenerator& generator, uint32_t low, uint32_t high)
+    {
+      const uint32_t s = high - low + 1U;
+
+      // The full 32 bit range?
+      if (s == 0U)
+      {
+        return generator();
+      }
+
+      uint64_t m = uint64_t(generator()) * s;
+      uint32_t l = uint32_t(m);
+
+      if (l < s)
+      {
+        const uint32_t threshold = (0U - s) % s;
+
+        while (l < threshold)
+        {
+          m = uint64_t(generator()) * s;
+          l = uint32_t(m);
+        }
+      }
+
+      return low + uint32_t(m >> 32);
+    }
+
+    //*************************************************************************
+    /// Maps a 64 bit generator on to the inclusive range [low, high].
+    /// Lemire's multiply-shift method.
+    //*************************************************************************
+    template <typename TGenerator>
+    uint64_t range64(TGenerator& generator, uint64_t low, uint64_t high)
+    {
+      const uint64_t s = high - low + 1U;
+
+      // The full 64 bit range?
+      if (s == 0U)
+      {
+        return generator();
+      }
+
+      uint64_t l;
+      uint64_t h = multiply_high(generator(), s, l);
+
+      if (l < s)
+      {
+        const uint64_t threshold = (0U - s) % s;
+
+        while (l < threshold)
+        {
+          h = multiply_high(generator(), s, l);
+        }
+      }
+
+      return low + h;
+    }
+
+    //*************************************************************************
+    /// The SplitMix64 step. Used to expand seeds.
+    //*************************************************************************
+    inline uint64_t splitmix64(uint64_t& state)
+    {
+      uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+    }
+
+    //*************************************************************************
+    /// Common interface for the non-virtual 64 bit engines.
+    /// TEngine must supply 'uint64_t operator()()'.
+    //*************************************************************************
+    template <typename TEngine>
+    class random64_base
+    {
+    public:
+
+      typedef uint64_t result_type;
+
+      //***********************************************************************
+      /// Get a random number in a specified inclusive 32 bit range.
+      //***********************************************************************
+      uint32_t range(uint32_t low, uint32_t high)
+      {
+        upper32 generator(engine());
+        return range32(generator, low, high);
+      }
+
+      //***********************************************************************
+      /// Get a random number in a specified inclusive 64 bit range.
+      //***********************************************************************
+      uint64_t range64(uint64_t low, uint64_t high)
+      {
+        return private_random::range64(engine(), low, high);
+      }
+
+      //***********************************************************************
+      /// Fills 'n' unsigned integers with random bits.
+      /// Values narrower than 64 bits are unpacked from each 64 bit output.
+      //***********************************************************************
+      template <typename T>
+      void generate(T* out, size_t n)
+      {
+        ETL_STATIC_ASSERT(etl::is_integral<T>::value && etl::is_unsigned<T>::value, "Not an unsigned integral type");
+        ETL_STATIC_ASSERT(sizeof(T) <= sizeof(uint64_t), "Type is wider than 64 bits");
+
+        const size_t PER_OUTPUT = sizeof(uint64_t) / sizeof(T);
+        const size_t SHIFT      = (sizeof(T) * 8U) % 64U;
+
+        TEngine& e = engine();
+
+        while (n >= PER_OUTPUT)
+        {
+          uint64_t value = e();
+
+          for (size_t i = 0U; i < PER_OUTPUT; ++i)
+          {
+            *out++ = T(value);
+            value  = (SHIFT == 0U) ? value : (value >> SHIFT);
+          }
+
+          n -= PER_OUTPUT;
+        }
+
+        if (n != 0U)
+        {
+          uint64_t value = e();
+
+          while (n-- != 0U)
+          {
+            *out++ = T(value);
+            value  = (SHIFT == 0U) ? value : (value >> SHIFT);
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Fills 'n' values in the inclusive range [low, high].
+      //***********************************************************************
+      void generate(uint32_t* out, size_t n, uint32_t low, uint32_t high)
+      {
+        upper32 generator(engine());
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          out[i] = range32(generator, low, high);
+        }
+      }
+
+    protected:
+
+      random64_base()
+      {
+      }
+
+      ~random64_base()
+      {
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Takes the upper, higher quality, half of each output.
+      //***********************************************************************
+      struct upper32
+      {
+        explicit upper32(TEngine& e_)
+          : e(e_)
+        {
+        }
+
+        uint32_t operator()()
+        {
+          return uint32_t(e() >> 32);
+        }
+
+        TEngine& e;
+      };
+
+      TEngine& engine()
+      {
+        return static_cast<TEngine&>(*this);
+      }
+    };
+  }
+
 #if defined(ETL_POLYMORPHIC_RANDOM)
   //***************************************************************************
   /// The base for all 32 bit random number generators.
@@ -139,12 +385,7 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
-
-        return n;
+        return private_random::range32(*this, low, high);
       }
 
     private:
@@ -208,12 +449,7 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
-
-      return n;
+      return private_random::range32(*this, low, high);
     }
 
   private:
@@ -284,12 +520,7 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
-
-        return n;
+        return private_random::range32(*this, low, high);
       }
 
     private:
@@ -367,12 +598,7 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
-
-        return n;
+        return private_random::range32(*this, low, high);
       }
 
     private:
@@ -436,12 +662,7 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
-
-      return n;
+      return private_random::range32(*this, low, high);
     }
 
   private:
@@ -503,12 +724,7 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
-
-      return n;
+      return private_random::range32(*this, low, high);
     }
 
   private:
@@ -571,12 +787,7 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
-
-      return n;
+      return private_random::range32(*this, low, high);
     }
 
   private:
@@ -585,6 +796,240 @@ namespace etl
     uint8_t value;
   };
 #endif
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// Uses the SplitMix64 algorithm.
+  /// Non-virtual. Very fast, with a 2^64 period. Also used to seed the others.
+  /// https://prng.di.unimi.it/splitmix64.c
+  //***************************************************************************
+  class random_splitmix64 : public private_random::random64_base<random_splitmix64>
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_splitmix64()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint64_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_splitmix64(uint64_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint64_t seed)
+    {
+      state = seed;
+    }
+
+    //***************************************************************************
+    /// Get the next random_splitmix64 number.
+    //***************************************************************************
+    uint64_t operator()()
+    {
+      return private_random::splitmix64(state);
+    }
+
+  private:
+
+    uint64_t state;
+  };
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// Uses the xoshiro256** algorithm.
+  /// Non-virtual, with a 2^256 - 1 period.
+  /// https://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro256 : public private_random::random64_base<random_xoshiro256>
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro256()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint64_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro256(uint64_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is expanded from the seed with SplitMix64, so it is never all zero.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint64_t seed)
+    {
+      state[0] = private_random::splitmix64(seed);
+      state[1] = private_random::splitmix64(seed);
+      state[2] = private_random::splitmix64(seed);
+      state[3] = private_random::splitmix64(seed);
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro256 number.
+    //***************************************************************************
+    uint64_t operator()()
+    {
+      const uint64_t result = private_random::rotl64(state[1] * 5U, 7U) * 9U;
+      const uint64_t t      = state[1] << 17;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = private_random::rotl64(state[3], 45U);
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Advances the sequence by 2^128 calls.
+    /// Used to create non-overlapping sequences for parallel use.
+    //***************************************************************************
+    void jump()
+    {
+      static const uint64_t JUMP[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+      uint64_t s[4] = { 0U, 0U, 0U, 0U };
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        for (unsigned b = 0U; b < 64U; ++b)
+        {
+          if ((JUMP[i] & (uint64_t(1U) << b)) != 0U)
+          {
+            s[0] ^= state[0];
+            s[1] ^= state[1];
+            s[2] ^= state[2];
+            s[3] ^= state[3];
+          }
+
+          operator()();
+        }
+      }
+
+      state[0] = s[0];
+      state[1] = s[1];
+      state[2] = s[2];
+      state[3] = s[3];
+    }
+
+  private:
+
+    uint64_t state[4];
+  };
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// Uses the PCG XSL RR 128/64 algorithm (pcg64).
+  /// Non-virtual, with a 2^128 period.
+  /// https://www.pcg-random.org/
+  //***************************************************************************
+  class random_pcg64 : public private_random::random64_base<random_pcg64>
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_pcg64()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint64_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_pcg64(uint64_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint64_t seed)
+    {
+      state_high = 0U;
+      state_low  = 0U;
+      step();
+
+      state_low += seed;
+      state_high += (state_low < seed) ? 1U : 0U;
+      step();
+    }
+
+    //***************************************************************************
+    /// Get the next random_pcg64 number.
+    //***************************************************************************
+    uint64_t operator()()
+    {
+      step();
+
+      return private_random::rotr64(state_high ^ state_low, unsigned(state_high >> 58));
+    }
+
+  private:
+
+    //***************************************************************************
+    /// state = (state * multiplier) + increment, modulo 2^128.
+    //***************************************************************************
+    void step()
+    {
+      uint64_t low;
+      uint64_t high = private_random::multiply_high(state_low, MULTIPLIER_LOW, low);
+
+      high += (state_low * MULTIPLIER_HIGH) + (state_high * MULTIPLIER_LOW);
+
+      state_low  = low + INCREMENT_LOW;
+      state_high = high + INCREMENT_HIGH + ((state_low < low) ? 1U : 0U);
+    }
+
+    static const uint64_t MULTIPLIER_HIGH = 0x2360ED051FC65DA4ULL;
+    static const uint64_t MULTIPLIER_LOW  = 0x4385DF649FCCF645ULL;
+    static const uint64_t INCREMENT_HIGH  = 0x5851F42D4C957F2DULL;
+    static const uint64_t INCREMENT_LOW   = 0x14057B7EF767814FULL;
+
+    uint64_t state_high;
+    uint64_t state_low;
+  };
 }
 
 #endif
@@ -0,0 +1,415 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RATE_LIMITER_INCLUDED
+#define ETL_RATE_LIMITER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "static_assert.h"
+
+///\defgroup rate_limiter rate_limiter
+/// Token bucket and sliding window rate limiters.
+/// Time is a monotonic uint32_t tick count, such as icallback_timer::time().
+/// State is brought up to date lazily, when a limiter is used, so idle
+/// limiters cost nothing per tick. Elapsed time is found by unsigned
+/// subtraction, so wrapping of the tick count is handled, as long as a
+/// limiter is not left unused for 2^32 ticks.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_rate_limiter
+  {
+    //*************************************************************************
+    /// The state of one token bucket.
+    //*************************************************************************
+    struct bucket
+    {
+      uint32_t tokens;
+      uint32_t last;
+    };
+
+    //*************************************************************************
+    /// The refill rate and size of a token bucket.
+    //*************************************************************************
+    struct bucket_config
+    {
+      uint32_t capacity;
+      uint32_t tokens_per_period;
+      uint32_t period;
+    };
+
+    //*************************************************************************
+    /// Adds the tokens earned since the bucket was last refilled.
+    /// Only whole periods are counted, so no fraction of a token is lost.
+    //*************************************************************************
+    inline void refill(bucket& b, const bucket_config& config, uint32_t now)
+    {
+      const uint32_t elapsed = now - b.last;
+
+      if (elapsed < config.period)
+      {
+        return;
+      }
+
+      const uint32_t periods = elapsed / config.period;
+      const uint64_t tokens  = uint64_t(b.tokens) + (uint64_t(periods) * config.tokens_per_period);
+
+      if (tokens >= config.capacity)
+      {
+        // A full bucket earns nothing more, so the clock may restart now.
+        b.tokens = config.capacity;
+        b.last   = now;
+      }
+      else
+      {
+        b.tokens = uint32_t(tokens);
+        b.last  += periods * config.period;
+      }
+    }
+
+    //*************************************************************************
+    /// Takes 'n' tokens, if there are enough.
+    //*************************************************************************
+    inline bool try_consume(bucket& b, const bucket_config& config, uint32_t now, uint32_t n)
+    {
+      refill(b, config, now);
+
+      if (b.tokens >= n)
+      {
+        b.tokens -= n;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// The number of ticks until 'n' tokens will be available.
+    /// Returns UINT32_MAX if 'n' is more than the capacity.
+    //*************************************************************************
+    inline uint32_t ticks_until(bucket& b, const bucket_config& config, uint32_t now, uint32_t n)
+    {
+      if ((n > config.capacity) || (config.tokens_per_period == 0U))
+      {
+        return (n <= b.tokens) ? 0U : UINT32_MAX;
+      }
+
+      refill(b, config, now);
+
+      if (b.tokens >= n)
+      {
+        return 0U;
+      }
+
+      const uint32_t needed  = n - b.tokens;
+      const uint32_t periods = (needed + config.tokens_per_period - 1U) / config.tokens_per_period;
+
+      return (periods * config.period) - (now - b.last);
+    }
+  }
+
+  //***************************************************************************
+  /// A token bucket.
+  /// Holds up to 'capacity' tokens, earning 'tokens_per_period' every
+  /// 'period' ticks. Each use takes one or more tokens, so bursts of up to
+  /// 'capacity' are allowed within a long term average rate.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class token_bucket
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor. The bucket starts full.
+    ///\param capacity          The maximum number of tokens.
+    ///\param tokens_per_period The tokens earned each period.
+    ///\param period            The period in ticks. Must be greater than zero.
+    ///\param now               The current tick count.
+    //*************************************************************************
+    token_bucket(uint32_t capacity, uint32_t tokens_per_period, uint32_t period, uint32_t now)
+    {
+      config.capacity          = capacity;
+      config.tokens_per_period = tokens_per_period;
+      config.period            = period;
+
+      reset(now);
+    }
+
+    //*************************************************************************
+    /// Takes 'n' tokens, if there are enough.
+    /// Returns true if they were taken.
+    //*************************************************************************
+    bool try_consume(uint32_t now, uint32_t n = 1U)
+    {
+      return private_rate_limiter::try_consume(state, config, now, n);
+    }
+
+    //*************************************************************************
+    /// The number of tokens available now.
+    //*************************************************************************
+    uint32_t available(uint32_t now)
+    {
+      private_rate_limiter::refill(state, config, now);
+
+      return state.tokens;
+    }
+
+    //*************************************************************************
+    /// The number of ticks until 'n' tokens will be available.
+    /// Returns UINT32_MAX if they never will be.
+    //*************************************************************************
+    uint32_t ticks_until(uint32_t now, uint32_t n = 1U)
+    {
+      return private_rate_limiter::ticks_until(state, config, now, n);
+    }
+
+    //*************************************************************************
+    /// Fills the bucket.
+    //*************************************************************************
+    void reset(uint32_t now)
+    {
+      state.tokens = config.capacity;
+      state.last   = now;
+    }
+
+    //*************************************************************************
+    /// The maximum number of tokens.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return config.capacity;
+    }
+
+  private:
+
+    private_rate_limiter::bucket_config config;
+    private_rate_limiter::bucket        state;
+  };
+
+  //***************************************************************************
+  /// A bank of token buckets sharing one rate, such as one per destination.
+  /// Each bucket is eight bytes and is only touched when it is used.
+  ///\tparam SIZE The number of buckets.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  template <const size_t SIZE_>
+  class rate_limiter_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT(SIZE_ > 0U, "SIZE must be greater than zero");
+
+    static const size_t SIZE = SIZE_;
+
+    //*************************************************************************
+    /// Constructor. All of the buckets start full.
+    ///\param capacity          The maximum number of tokens in each bucket.
+    ///\param tokens_per_period The tokens earned each period.
+    ///\param period            The period in ticks. Must be greater than zero.
+    ///\param now               The current tick count.
+    //*************************************************************************
+    rate_limiter_bank(uint32_t capacity, uint32_t tokens_per_period, uint32_t period, uint32_t now)
+    {
+      config.capacity          = capacity;
+      config.tokens_per_period = tokens_per_period;
+      config.period            = period;
+
+      reset_all(now);
+    }
+
+    //*************************************************************************
+    /// Takes 'n' tokens from bucket 'index', if there are enough.
+    /// Returns true if they were taken.
+    //*************************************************************************
+    bool try_consume(size_t index, uint32_t now, uint32_t n = 1U)
+    {
+      return private_rate_limiter::try_consume(buckets[index], config, now, n);
+    }
+
+    //*************************************************************************
+    /// The number of tokens available now in bucket 'index'.
+    //*************************************************************************
+    uint32_t available(size_t index, uint32_t now)
+    {
+      private_rate_limiter::refill(buckets[index], config, now);
+
+      return buckets[index].tokens;
+    }
+
+    //*************************************************************************
+    /// The number of ticks until 'n' tokens will be available in bucket 'index'.
+    /// Returns UINT32_MAX if they never will be.
+    //*************************************************************************
+    uint32_t ticks_until(size_t index, uint32_t now, uint32_t n = 1U)
+    {
+      return private_rate_limiter::ticks_until(buckets[index], config, now, n);
+    }
+
+    //*************************************************************************
+    /// Fills bucket 'index'.
+    //*************************************************************************
+    void reset(size_t index, uint32_t now)
+    {
+      buckets[index].tokens = config.capacity;
+      buckets[index].last   = now;
+    }
+
+    //*************************************************************************
+    /// Fills all of the buckets.
+    //*************************************************************************
+    void reset_all(uint32_t now)
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        reset(i, now);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of buckets.
+    //*************************************************************************
+    size_t size() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// The maximum number of tokens in each bucket.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return config.capacity;
+    }
+
+  private:
+
+    private_rate_limiter::bucket_config config;
+    private_rate_limiter::bucket        buckets[SIZE];
+  };
+
+  //***************************************************************************
+  /// A sliding window rate limiter.
+  /// Allows up to 'limit' uses in any window of 'window' ticks. The count for
+  /// the sliding window is estimated from the counts in the current and the
+  /// previous fixed windows, weighted by their overlap, so it needs no
+  /// per-use history.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class sliding_window_limiter
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param limit  The maximum number of uses in a window.
+    ///\param window The length of the window in ticks. Must be greater than zero.
+    ///\param now    The current tick count.
+    //*************************************************************************
+    sliding_window_limiter(uint32_t limit_, uint32_t window_, uint32_t now)
+      : limit(limit_)
+      , window(window_)
+    {
+      reset(now);
+    }
+
+    //*************************************************************************
+    /// Records 'n' uses, if they are within the limit.
+    /// Returns true if they were recorded.
+    //*************************************************************************
+    bool try_acquire(uint32_t now, uint32_t n = 1U)
+    {
+      const uint64_t used = estimate(now);
+
+      if ((used + n) <= limit)
+      {
+        current_count += n;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// The estimated number of uses in the window ending now.
+    //*************************************************************************
+    uint32_t count(uint32_t now)
+    {
+      const uint64_t used = estimate(now);
+
+      return (used > UINT32_MAX) ? UINT32_MAX : uint32_t(used);
+    }
+
+    //*************************************************************************
+    /// Forgets all uses.
+    //*************************************************************************
+    void reset(uint32_t now)
+    {
+      window_start   = now;
+      current_count  = 0U;
+      previous_count = 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves the fixed windows on to 'now' and estimates the sliding count.
+    //*************************************************************************
+    uint64_t estimate(uint32_t now)
+    {
+      uint32_t elapsed = now - window_start;
+
+      if (elapsed >= window)
+      {
+        const uint32_t windows = elapsed / window;
+
+        previous_count = (windows == 1U) ? current_count : 0U;
+        current_count  = 0U;
+        window_start  += windows * window;
+        elapsed       -= windows * window;
+      }
+
+      const uint32_t overlap = window - elapsed;
+
+      return ((uint64_t(previous_count) * overlap) / window) + current_count;
+    }
+
+    const uint32_t limit;
+    const uint32_t window;
+    uint32_t       window_start;
+    uint32_t       current_count;
+    uint32_t       previous_count;
+  };
+}
+
+#endif
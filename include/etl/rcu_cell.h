@@ -0,0 +1,355 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RCU_CELL_INCLUDED
+#define ETL_RCU_CELL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup rcu_cell rcu_cell
+/// Read-copy-update of a value, such as a container, that is rebuilt from
+/// time to time and read very often.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup rcu_cell
+  /// Holds COPIES instances of T, one of which is published to readers.
+  /// A writer rebuilds an unpublished copy and publishes it with one atomic
+  /// store. Readers never wait for a writer, and see either the old or the
+  /// new copy in full.
+  /// Each copy has a count of the readers that hold it, on its own cache
+  /// line. A copy is only given to the writer once it is unpublished and no
+  /// reader holds it, so with more copies the writer waits less for slow readers.
+  /// There must be one writer at a time; guard the updates with a lock if there are more.
+  ///\code
+  /// etl::rcu_cell<Routes, 3> routes;
+  ///
+  /// // Reader
+  /// {
+  ///   etl::rcu_cell<Routes, 3>::read_guard guard(routes);
+  ///   guard->find(address);
+  /// }
+  ///
+  /// // Writer
+  /// Routes& next = routes.begin_update();
+  /// rebuild(next);
+  /// routes.publish();
+  ///\endcode
+  ///\tparam T      The type of the value.
+  ///\tparam COPIES The number of instances. At least 2.
+  //***************************************************************************
+  template <typename T, const size_t COPIES = 2U>
+  class rcu_cell
+  {
+  public:
+
+    ETL_STATIC_ASSERT(COPIES >= 2U, "At least two copies are required");
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Holds the published copy for reading, for the lifetime of the guard.
+    //*************************************************************************
+    class read_guard
+    {
+    public:
+
+      //*******************************
+      explicit read_guard(const rcu_cell& cell_)
+        : cell(cell_),
+          index(cell_.acquire())
+      {
+      }
+
+      //*******************************
+      ~read_guard()
+      {
+        cell.release(index);
+      }
+
+      //*******************************
+      const T& get() const
+      {
+        return cell.copies[index];
+      }
+
+      //*******************************
+      const T& operator *() const
+      {
+        return get();
+      }
+
+      //*******************************
+      const T* operator ->() const
+      {
+        return &get();
+      }
+
+    private:
+
+      // Disabled.
+      read_guard(const read_guard&);
+      read_guard& operator =(const read_guard&);
+
+      const rcu_cell& cell;
+      const size_t    index;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    rcu_cell()
+      : published(0U),
+        writing(COPIES)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param value The initial published value.
+    //*************************************************************************
+    explicit rcu_cell(const T& value)
+      : published(0U),
+        writing(COPIES)
+    {
+      copies[0] = value;
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Calls reader(const T&) with the published copy, held for the call.
+    //*************************************************************************
+    template <typename TReader>
+    void read(TReader reader) const
+    {
+      read_guard guard(*this);
+
+      reader(guard.get());
+    }
+
+    //*************************************************************************
+    /// Gets an unpublished copy that no reader holds, for the writer to rebuild.
+    /// Returns nullptr if every unpublished copy is still held by a reader.
+    ///\param copy_published If true, the copy is first assigned the published value.
+    //*************************************************************************
+    T* try_begin_update(bool copy_published = false)
+    {
+      if (writing == COPIES)
+      {
+        const size_t current = published.load(etl::memory_order_relaxed);
+
+        for (size_t i = 1U; i < COPIES; ++i)
+        {
+          const size_t candidate = (current + i) % COPIES;
+
+          if (readers[candidate].count.load(etl::memory_order_seq_cst) == 0U)
+          {
+            writing = candidate;
+            break;
+          }
+        }
+
+        if (writing == COPIES)
+        {
+          return nullptr;
+        }
+
+        if (copy_published)
+        {
+          copies[writing] = copies[current];
+        }
+      }
+
+      return &copies[writing];
+    }
+
+    //*************************************************************************
+    /// Gets an unpublished copy that no reader holds, for the writer to rebuild.
+    /// Spins while every unpublished copy is still held by a reader.
+    ///\param copy_published If true, the copy is first assigned the published value.
+    //*************************************************************************
+    T& begin_update(bool copy_published = false)
+    {
+      T* p = try_begin_update(copy_published);
+
+      while (p == nullptr)
+      {
+        ETL_CPU_PAUSE();
+        p = try_begin_update(copy_published);
+      }
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Publishes the copy from begin_update().
+    /// New readers see it. Readers of the old copy continue undisturbed.
+    //*************************************************************************
+    void publish()
+    {
+      if (writing != COPIES)
+      {
+        published.store(writing, etl::memory_order_seq_cst);
+        writing = COPIES;
+        ++publish_count;
+      }
+    }
+
+    //*************************************************************************
+    /// Abandons the copy from begin_update() without publishing it.
+    //*************************************************************************
+    void cancel_update()
+    {
+      writing = COPIES;
+    }
+
+    //*************************************************************************
+    /// Rebuilds and publishes a copy.
+    /// Calls writer(T&) with the copy from begin_update().
+    //*************************************************************************
+    template <typename TWriter>
+    void update(TWriter writer, bool copy_published = false)
+    {
+      writer(begin_update(copy_published));
+      publish();
+    }
+
+    //*************************************************************************
+    /// The published copy, as seen by the writer.
+    /// Not for readers, as it does not hold the copy.
+    //*************************************************************************
+    const T& published_value() const
+    {
+      return copies[published.load(etl::memory_order_relaxed)];
+    }
+
+    //*************************************************************************
+    /// The number of times that a copy has been published.
+    //*************************************************************************
+    uint32_t version() const
+    {
+      return publish_count;
+    }
+
+    //*************************************************************************
+    /// The number of readers that hold a copy.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    uint32_t reader_count() const
+    {
+      uint32_t n = 0U;
+
+      for (size_t i = 0U; i < COPIES; ++i)
+      {
+        n += readers[i].count.load(etl::memory_order_relaxed);
+      }
+
+      return n;
+    }
+
+  private:
+
+    //*************************************************************************
+    void initialise()
+    {
+      publish_count = 0U;
+
+      for (size_t i = 0U; i < COPIES; ++i)
+      {
+        readers[i].count.store(0U, etl::memory_order_relaxed);
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+    }
+
+    //*************************************************************************
+    /// Counts a reader in to the published copy.
+    /// The copy is checked again after counting in, in case the writer took
+    /// it between the load and the increment.
+    //*************************************************************************
+    size_t acquire() const
+    {
+      while (true)
+      {
+        const size_t index = published.load(etl::memory_order_seq_cst);
+
+        readers[index].count.fetch_add(1U, etl::memory_order_seq_cst);
+
+        if (published.load(etl::memory_order_seq_cst) == index)
+        {
+          return index;
+        }
+
+        readers[index].count.fetch_sub(1U, etl::memory_order_release);
+      }
+    }
+
+    //*************************************************************************
+    void release(size_t index) const
+    {
+      readers[index].count.fetch_sub(1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// A count of readers, on its own cache line.
+    //*************************************************************************
+    struct reader_counter
+    {
+      etl::atomic<uint32_t> count;
+#if ETL_CACHE_LINE_SIZE > 0
+      char                  padding[ETL_CACHE_LINE_SIZE];
+#endif
+    };
+
+    // Disabled.
+    rcu_cell(const rcu_cell&);
+    rcu_cell& operator =(const rcu_cell&);
+
+    T                      copies[COPIES];
+    mutable reader_counter readers[COPIES];
+    etl::atomic<size_t>    published;
+    size_t                 writing;       ///< The index of the copy being rebuilt, or COPIES.
+    uint32_t               publish_count; ///< Only accessed by the writer.
+  };
+}
+
+#endif
+#endif
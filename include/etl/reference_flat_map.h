@@ -42,6 +42,7 @@ SOFTWARE.
 #include "exception.h"
 #include "static_assert.h"
 #include "iterator.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "30"
@@ -344,6 +345,16 @@ namespace etl
         return comp(key, element.first);
       }
 
+      bool operator ()(const value_type* element, key_type key) const
+      {
+        return comp(element->first, key);
+      }
+
+      bool operator ()(key_type key, const value_type* element) const
+      {
+        return comp(key, element->first);
+      }
+
       key_compare comp;
     };
 
@@ -579,6 +590,34 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_map.
+    /// The values are merged in one pass, rather than inserted one at a time.
+    /// Elements already in the reference_flat_map, or repeated in the range, are not added.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      merge_sorted(first, last, private_flat_merge::address_of<value_type>());
+    }
+
+    //*********************************************************************
+    /// Merges the elements of another reference_flat_map into this one.
+    /// This one refers to the other's elements, which stay where they are.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param other The reference_flat_map to merge.
+    //*********************************************************************
+    void merge(ireference_flat_map& other)
+    {
+      if (&other != this)
+      {
+        insert_sorted(other.begin(), other.end());
+      }
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -693,7 +732,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_lower_bound(lookup.begin(), lookup.end(), key, compare));
     }
 
     //*********************************************************************
@@ -703,7 +742,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(etl::branchless_lower_bound(lookup.cbegin(), lookup.cend(), key, compare));
     }
 
     //*********************************************************************
@@ -713,7 +752,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_upper_bound(lookup.begin(), lookup.end(), key, compare));
     }
 
     //*********************************************************************
@@ -723,7 +762,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return const_iterator(etl::branchless_upper_bound(lookup.cbegin(), lookup.cend(), key, compare));
     }
 
     //*********************************************************************
@@ -733,9 +772,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
-
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*********************************************************************
@@ -745,9 +782,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
-
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*************************************************************************
@@ -814,6 +849,23 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Merges a sorted range into the lookup.
+    ///\param create Returns the pointer to store for each new element.
+    //*********************************************************************
+    template <typename TIterator, typename TCreate>
+    void merge_sorted(TIterator first, TIterator last, TCreate create)
+    {
+      const size_t n_new = private_flat_merge::count_new(lookup, first, last, private_flat_merge::first_compare<TKeyCompare>(), true);
+
+      ETL_ASSERT(n_new <= lookup.available(), ETL_ERROR(flat_map_full));
+
+      if (n_new <= lookup.available())
+      {
+        private_flat_merge::merge(lookup, first, last, n_new, private_flat_merge::first_compare<TKeyCompare>(), true, create);
+      }
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_map.
     ///\param i_element The place to insert.
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "debug_count.h"
 #include "vector.h"
 #include "iterator.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "31"
@@ -319,6 +320,16 @@ namespace etl
         return comp(key, element.first);
       }
 
+      bool operator ()(const value_type* element, key_type key) const
+      {
+        return comp(element->first, key);
+      }
+
+      bool operator ()(key_type key, const value_type* element) const
+      {
+        return comp(key, element->first);
+      }
+
       key_compare comp;
     };
 
@@ -498,6 +509,33 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_multimap.
+    /// The values are merged in one pass, rather than inserted one at a time.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the reference_flat_multimap does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      merge_sorted(first, last, private_flat_merge::address_of<value_type>());
+    }
+
+    //*********************************************************************
+    /// Merges the elements of another reference_flat_multimap into this one.
+    /// This one refers to the other's elements, which stay where they are.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the reference_flat_multimap does not have enough free space.
+    ///\param other The reference_flat_multimap to merge.
+    //*********************************************************************
+    void merge(ireference_flat_multimap& other)
+    {
+      if (&other != this)
+      {
+        insert_sorted(other.begin(), other.end());
+      }
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -615,7 +653,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_lower_bound(lookup.begin(), lookup.end(), key, compare));
     }
 
     //*********************************************************************
@@ -625,7 +663,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(etl::branchless_lower_bound(lookup.cbegin(), lookup.cend(), key, compare));
     }
 
     //*********************************************************************
@@ -635,7 +673,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_upper_bound(lookup.begin(), lookup.end(), key, compare));
     }
 
     //*********************************************************************
@@ -645,7 +683,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return const_iterator(etl::branchless_upper_bound(lookup.cbegin(), lookup.cend(), key, compare));
     }
 
     //*********************************************************************
@@ -655,9 +693,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
-
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*********************************************************************
@@ -667,9 +703,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
-
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*************************************************************************
@@ -736,6 +770,23 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Merges a sorted range into the lookup.
+    ///\param create Returns the pointer to store for each new element.
+    //*********************************************************************
+    template <typename TIterator, typename TCreate>
+    void merge_sorted(TIterator first, TIterator last, TCreate create)
+    {
+      const size_t n_new = private_flat_merge::count_new(lookup, first, last, private_flat_merge::first_compare<TKeyCompare>(), false);
+
+      ETL_ASSERT(n_new <= lookup.available(), ETL_ERROR(flat_multimap_full));
+
+      if (n_new <= lookup.available())
+      {
+        private_flat_merge::merge(lookup, first, last, n_new, private_flat_merge::first_compare<TKeyCompare>(), false, create);
+      }
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_multimap.
     ///\param i_element The place to insert.
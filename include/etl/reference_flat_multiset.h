@@ -45,6 +45,7 @@ SOFTWARE.
 #include "pool.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "33"
@@ -314,6 +315,26 @@ namespace etl
 
     typedef typename etl::parameter_type<T>::type parameter_t;
 
+    //*********************************************************************
+    /// How to compare the elements in the lookup with keys.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* element, parameter_t key) const
+      {
+        return comp(*element, key);
+      }
+
+      bool operator ()(parameter_t key, const value_type* element) const
+      {
+        return comp(key, *element);
+      }
+
+      key_compare comp;
+    };
+
   public:
 
     typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
@@ -462,7 +483,7 @@ namespace etl
 
       ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_multiset_full));
 
-      iterator i_element = etl::lower_bound(begin(), end(), value, compare);
+      iterator i_element = lower_bound(value);
 
       if (i_element == end())
       {
@@ -509,6 +530,33 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_multiset.
+    /// The values are merged in one pass, rather than inserted one at a time.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      merge_sorted(first, last, private_flat_merge::address_of<value_type>());
+    }
+
+    //*********************************************************************
+    /// Merges the elements of another reference_flat_multiset into this one.
+    /// This one refers to the other's elements, which stay where they are.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param other The reference_flat_multiset to merge.
+    //*********************************************************************
+    void merge(ireference_flat_multiset& other)
+    {
+      if (&other != this)
+      {
+        insert_sorted(other.begin(), other.end());
+      }
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -566,7 +614,7 @@ namespace etl
     //*********************************************************************
     iterator find(parameter_t key)
     {
-      iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      iterator itr = lower_bound(key);
 
       if (itr != end())
       {
@@ -590,7 +638,7 @@ namespace etl
     //*********************************************************************
     const_iterator find(parameter_t key) const
     {
-      const_iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      const_iterator itr = lower_bound(key);
 
       if (itr != end())
       {
@@ -626,7 +674,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_lower_bound(lookup.begin(), lookup.end(), key, LookupCompare()));
     }
 
     //*********************************************************************
@@ -636,7 +684,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(etl::branchless_lower_bound(lookup.cbegin(), lookup.cend(), key, LookupCompare()));
     }
 
     //*********************************************************************
@@ -646,7 +694,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(etl::branchless_upper_bound(lookup.begin(), lookup.end(), key, LookupCompare()));
     }
 
     //*********************************************************************
@@ -656,7 +704,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(parameter_t key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(etl::branchless_upper_bound(lookup.cbegin(), lookup.cend(), key, LookupCompare()));
     }
 
     //*********************************************************************
@@ -666,7 +714,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(parameter_t key)
     {
-      return etl::equal_range(begin(), end(), key, compare);
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*********************************************************************
@@ -676,7 +724,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(parameter_t key) const
     {
-      return etl::equal_range(begin(), end(), key, compare);
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
     }
 
     //*************************************************************************
@@ -743,6 +791,23 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Merges a sorted range into the lookup.
+    ///\param create Returns the pointer to store for each new element.
+    //*********************************************************************
+    template <typename TIterator, typename TCreate>
+    void merge_sorted(TIterator first, TIterator last, TCreate create)
+    {
+      const size_t n_new = private_flat_merge::count_new(lookup, first, last, TKeyCompare(), false);
+
+      ETL_ASSERT(n_new <= lookup.available(), ETL_ERROR(flat_multiset_full));
+
+      if (n_new <= lookup.available())
+      {
+        private_flat_merge::merge(lookup, first, last, n_new, TKeyCompare(), false, create);
+      }
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_set.
     ///\param i_element The place to insert.
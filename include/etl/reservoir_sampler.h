@@ -0,0 +1,190 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RESERVOIR_SAMPLER_INCLUDED
+#define ETL_RESERVOIR_SAMPLER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "vector.h"
+#include "random.h"
+#include "parameter_type.h"
+
+///\defgroup reservoir_sampler reservoir_sampler
+/// Keeps a uniform random sample of a stream of values in fixed memory.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A reservoir sampler.
+  /// After any number of values have been added, each has had the same
+  /// chance of being in the sample (Vitter's algorithm R).
+  ///\tparam T       The type of the values.
+  ///\tparam SIZE    The number of values in the sample.
+  ///\tparam TRandom The random number generator. One of the generators in random.h.
+  ///\ingroup reservoir_sampler
+  //***************************************************************************
+  template <typename T, const size_t SIZE_, typename TRandom = etl::random_xorshift>
+  class reservoir_sampler
+  {
+  private:
+
+    typedef etl::vector<T, SIZE_> sample_t;
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    typedef T                                  value_type;
+    typedef typename sample_t::const_iterator  const_iterator;
+    typedef TRandom                            random_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    reservoir_sampler()
+      : n_seen(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor with a seed for the random number generator.
+    //*************************************************************************
+    explicit reservoir_sampler(uint32_t seed)
+      : n_seen(0U)
+      , random(seed)
+    {
+    }
+
+    //*************************************************************************
+    /// Offers a value to the sample.
+    /// Returns true if it was kept.
+    //*************************************************************************
+    bool add(parameter_t value)
+    {
+      ++n_seen;
+
+      if (sample.size() < SIZE)
+      {
+        sample.push_back(value);
+        return true;
+      }
+
+      const uint32_t i = random.range(0U, n_seen - 1U);
+
+      if (i < SIZE)
+      {
+        sample[i] = value;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Forgets the sample, for the start of a new interval.
+    //*************************************************************************
+    void clear()
+    {
+      sample.clear();
+      n_seen = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values offered since the last clear.
+    //*************************************************************************
+    uint32_t seen() const
+    {
+      return n_seen;
+    }
+
+    //*************************************************************************
+    /// The number of values in the sample.
+    //*************************************************************************
+    size_t size() const
+    {
+      return sample.size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of values in the sample.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// True if the sample is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return sample.empty();
+    }
+
+    //*************************************************************************
+    /// The values in the sample, in no particular order.
+    //*************************************************************************
+    const T& operator [](size_t i) const
+    {
+      return sample[i];
+    }
+
+    const_iterator begin() const
+    {
+      return sample.begin();
+    }
+
+    const_iterator end() const
+    {
+      return sample.end();
+    }
+
+    //*************************************************************************
+    /// The random number generator.
+    //*************************************************************************
+    random_type& generator()
+    {
+      return random;
+    }
+
+  private:
+
+    sample_t    sample;
+    uint32_t    n_seen;
+    random_type random;
+  };
+}
+
+#endif
@@ -0,0 +1,230 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RETAINED_INCLUDED
+#define ETL_RETAINED_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "crc32_c.h"
+
+///\defgroup retained retained
+/// Keeps a container in memory that survives a warm reset, such as a
+/// 'noinit' section of RAM, so that its state may be adopted after a
+/// watchdog reset rather than rebuilt.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup retained
+  /// Holds a fixed capacity container, such as an etl::vector, etl::deque,
+  /// etl::flat_map or etl::unordered_map, with a header that records a check
+  /// of its bytes.
+  /// Has a trivial constructor, so that an instance in a section that is not
+  /// initialised at start up keeps its contents across a reset.
+  /// On start up, validate_and_adopt() checks the header and the CRC and
+  /// either adopts the container as it was or constructs a new one.
+  /// After a change, seal() records a new CRC. A reset part way through a
+  /// change leaves a CRC that does not match, and the container is rebuilt.
+  /// The containers hold absolute pointers, so the state is only adopted at
+  /// the address that it was sealed at. The elements must not hold pointers
+  /// to memory that is not retained.
+  /// Use a type id that changes with the firmware, so that state written by
+  /// a different build, whose layout may differ, is not adopted.
+  ///\code
+  /// __attribute__((section(".noinit"))) etl::retained<Routes> routes;
+  ///
+  /// if (!routes.validate_and_adopt(FIRMWARE_ID))
+  /// {
+  ///   rebuild(*routes);
+  ///   routes.seal();
+  /// }
+  ///\endcode
+  ///\tparam TContainer The container type. Default constructed when not adopted.
+  ///\tparam TCrc       The CRC used to check the container, such as etl::crc32_c.
+  //***************************************************************************
+  template <typename TContainer, typename TCrc = etl::crc32_c>
+  class retained
+  {
+  public:
+
+    typedef TContainer                  container_type;
+    typedef typename TCrc::value_type   crc_type;
+
+    static const uint32_t MAGIC = 0x524C5445UL; ///< 'ETLR' when read in the writer's byte order.
+
+    //*************************************************************************
+    /// Adopts the container if it is valid, otherwise default constructs a
+    /// new one and seals it.
+    /// Returns true if the container was adopted.
+    ///\param type_id Chosen by the user to tell builds and layouts apart.
+    //*************************************************************************
+    bool validate_and_adopt(uint32_t type_id = 0U)
+    {
+      if (is_valid(type_id))
+      {
+        return true;
+      }
+
+      header.magic = 0U;
+      ::new (static_cast<void*>(&storage)) TContainer();
+
+      header.type_id = type_id;
+      seal();
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Is the container valid to adopt?
+    /// Checks the header and then the CRC of the container.
+    //*************************************************************************
+    bool is_valid(uint32_t type_id = 0U) const
+    {
+      return (header.magic   == MAGIC)               &&
+             (header.size    == sizeof(TContainer))  &&
+             (header.type_id == type_id)             &&
+             (header.address == reinterpret_cast<uintptr_t>(this)) &&
+             (header.crc     == checksum());
+    }
+
+    //*************************************************************************
+    /// Records the CRC of the container, after a change.
+    //*************************************************************************
+    void seal()
+    {
+      header.magic   = 0U;
+      header.size    = uint32_t(sizeof(TContainer));
+      header.address = reinterpret_cast<uintptr_t>(this);
+      header.crc     = checksum();
+      header.magic   = MAGIC;
+    }
+
+    //*************************************************************************
+    /// Marks the container as not valid to adopt, before a change.
+    /// Not needed for correctness, as a change without seal() leaves a CRC
+    /// that does not match, but makes the next check fail on the header.
+    //*************************************************************************
+    void unseal()
+    {
+      header.magic = 0U;
+    }
+
+    //*************************************************************************
+    /// Destroys the container.
+    /// It will not be adopted again.
+    //*************************************************************************
+    void destroy()
+    {
+      header.magic = 0U;
+      get().~TContainer();
+    }
+
+    //*************************************************************************
+    /// Gets the container.
+    /// Only valid after validate_and_adopt().
+    //*************************************************************************
+    TContainer& get()
+    {
+      return *reinterpret_cast<TContainer*>(&storage);
+    }
+
+    //*************************************************************************
+    /// Gets the container.
+    /// Only valid after validate_and_adopt().
+    //*************************************************************************
+    const TContainer& get() const
+    {
+      return *reinterpret_cast<const TContainer*>(&storage);
+    }
+
+    //*************************************************************************
+    TContainer& operator *()
+    {
+      return get();
+    }
+
+    //*************************************************************************
+    const TContainer& operator *() const
+    {
+      return get();
+    }
+
+    //*************************************************************************
+    TContainer* operator ->()
+    {
+      return &get();
+    }
+
+    //*************************************************************************
+    const TContainer* operator ->() const
+    {
+      return &get();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The CRC of the bytes of the container.
+    //*************************************************************************
+    crc_type checksum() const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&storage);
+
+      TCrc crc;
+      crc.add(p, p + sizeof(TContainer));
+
+      return crc.value();
+    }
+
+    //*************************************************************************
+    /// The record of the sealed state.
+    //*************************************************************************
+    struct header_t
+    {
+      uint32_t  magic;
+      uint32_t  type_id;
+      uint32_t  size;
+      crc_type  crc;
+      uintptr_t address;
+    };
+
+    header_t header;
+    typename etl::aligned_storage<sizeof(TContainer), etl::alignment_of<TContainer>::value>::type storage;
+  };
+}
+
+#endif
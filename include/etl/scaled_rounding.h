@@ -31,6 +31,7 @@ SOFTWARE.
 #ifndef ETL_SCALED_ROUNDING_INCLUDED
 #define ETL_SCALED_ROUNDING_INCLUDED
 
+#include "platform.h"
 #include "static_assert.h"
 #include "type_traits.h"
 #include "absolute.h"
@@ -65,7 +66,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_ceiling_unscaled(T value)
+  ETL_CONSTEXPR14 T round_ceiling_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -86,7 +87,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_ceiling_scaled(T value)
+  ETL_CONSTEXPR14 T round_ceiling_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -99,7 +100,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_floor_unscaled(T value)
+  ETL_CONSTEXPR14 T round_floor_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -120,7 +121,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_floor_scaled(T value)
+  ETL_CONSTEXPR14 T round_floor_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -134,7 +135,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_up_unscaled(T value)
+  ETL_CONSTEXPR14 T round_half_up_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     ETL_STATIC_ASSERT((((SCALING / 2U) * 2U) == SCALING), "Scaling must be divisible by 2");
@@ -157,7 +158,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_up_scaled(T value)
+  ETL_CONSTEXPR14 T round_half_up_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -171,7 +172,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_down_unscaled(T value)
+  ETL_CONSTEXPR14 T round_half_down_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     ETL_STATIC_ASSERT((((SCALING / 2U) * 2U) == SCALING), "Scaling must be divisible by 2");
@@ -194,7 +195,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_down_scaled(T value)
+  ETL_CONSTEXPR14 T round_half_down_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -207,7 +208,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_zero_unscaled(T value)
+  ETL_CONSTEXPR14 T round_zero_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -221,7 +222,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_zero_scaled(T value)
+  ETL_CONSTEXPR14 T round_zero_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -234,7 +235,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_infinity_unscaled(T value)
+  ETL_CONSTEXPR14 T round_infinity_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -255,7 +256,7 @@ namespace etl
   /// \return Ccaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_infinity_scaled(T value)
+  ETL_CONSTEXPR14 T round_infinity_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -269,7 +270,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_even_unscaled(T value)
+  ETL_CONSTEXPR14 T round_half_even_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -300,7 +301,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_even_scaled(T value)
+  ETL_CONSTEXPR14 T round_half_even_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -314,7 +315,7 @@ namespace etl
   /// \return Unscaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_odd_unscaled(T value)
+  ETL_CONSTEXPR14 T round_half_odd_unscaled(T value)
   {
     ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Type must be an integral");
     typedef typename scaled_rounding_t<T>::type scale_t;
@@ -345,7 +346,7 @@ namespace etl
   /// \return Scaled, rounded integral.
   //***************************************************************************
   template <const size_t SCALING, typename T>
-  T round_half_odd_scaled(T value)
+  ETL_CONSTEXPR14 T round_half_odd_scaled(T value)
   {
     typedef typename scaled_rounding_t<T>::type scale_t;
 
@@ -32,6 +32,7 @@ SOFTWARE.
 #include <stdint.h>
 
 #include "platform.h"
+#include "algorithm.h"
 #include "vector.h"
 #include "nullptr.h"
 #include "error_handler.h"
@@ -219,6 +220,148 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Earliest Deadline First.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Calls the released task whose deadline is soonest, once per release.
+  /// A released task that reports no work completes its job without being called.
+  /// All of the tasks must be etl::deadline_task.
+  /// The task list is kept as two heaps, so choosing a task is O(log N):
+  /// the waiting tasks, by release time, at the front, and the released
+  /// tasks, by deadline, at the back in reverse order.
+  ///\tparam TClock Has 'static etl::deadline_task::time_type now()', returning the tick count.
+  //***************************************************************************
+  template <typename TClock>
+  struct scheduler_policy_earliest_deadline_first
+  {
+    scheduler_policy_earliest_deadline_first()
+      : number_of_tasks(0U),
+        number_waiting(0U),
+        deadline_misses(0U)
+    {
+    }
+
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      etl::deadline_task::time_type now = TClock::now();
+
+      // Tasks added since the last call reorder the list.
+      if (task_list.size() != number_of_tasks)
+      {
+        rebuild(task_list, now);
+      }
+
+      // Release the jobs that are due.
+      while ((number_waiting != 0U) && !etl::deadline_task::is_before(now, get(task_list[0]).get_release_time()))
+      {
+        etl::pop_heap(task_list.begin(), task_list.begin() + number_waiting, later_release());
+        --number_waiting;
+        etl::push_heap(task_list.rbegin(), task_list.rend() - number_waiting, later_deadline());
+      }
+
+      if (number_waiting == number_of_tasks)
+      {
+        return true;
+      }
+
+      // Take the released task with the earliest deadline.
+      etl::pop_heap(task_list.rbegin(), task_list.rend() - number_waiting, later_deadline());
+
+      etl::deadline_task& task = get(task_list[number_waiting]);
+      bool idle = true;
+
+      if (task.task_request_work() > 0)
+      {
+        task.task_process_work();
+        idle = false;
+        now  = TClock::now();
+      }
+
+      if (task.complete_job(now))
+      {
+        ++deadline_misses;
+      }
+
+      // Wait for the next release.
+      ++number_waiting;
+      etl::push_heap(task_list.begin(), task_list.begin() + number_waiting, later_release());
+
+      return idle;
+    }
+
+    //*******************************************
+    /// Get the number of jobs, of all tasks, that finished after their deadline.
+    //*******************************************
+    uint32_t get_deadline_misses() const
+    {
+      return deadline_misses;
+    }
+
+  private:
+
+    //*******************************************
+    static etl::deadline_task& get(etl::task* p_task)
+    {
+      return *static_cast<etl::deadline_task*>(p_task);
+    }
+
+    //*******************************************
+    /// Heap order for the waiting tasks; the earliest release at the top.
+    //*******************************************
+    struct later_release
+    {
+      bool operator()(etl::task* lhs, etl::task* rhs) const
+      {
+        return etl::deadline_task::is_before(get(rhs).get_release_time(), get(lhs).get_release_time());
+      }
+    };
+
+    //*******************************************
+    /// Heap order for the released tasks; the earliest deadline, then the
+    /// highest priority, at the top.
+    //*******************************************
+    struct later_deadline
+    {
+      bool operator()(etl::task* lhs, etl::task* rhs) const
+      {
+        const etl::deadline_task::time_type lhs_deadline = get(lhs).get_absolute_deadline();
+        const etl::deadline_task::time_type rhs_deadline = get(rhs).get_absolute_deadline();
+
+        if (lhs_deadline == rhs_deadline)
+        {
+          return lhs->get_task_priority() < rhs->get_task_priority();
+        }
+
+        return etl::deadline_task::is_before(rhs_deadline, lhs_deadline);
+      }
+    };
+
+    //*******************************************
+    /// Splits the list in to waiting and released tasks, and builds the heaps.
+    //*******************************************
+    void rebuild(etl::ivector<etl::task*>& task_list, etl::deadline_task::time_type now)
+    {
+      number_of_tasks = task_list.size();
+      number_waiting  = 0U;
+
+      for (size_t index = 0U; index < number_of_tasks; ++index)
+      {
+        if (etl::deadline_task::is_before(now, get(task_list[index]).get_release_time()))
+        {
+          etl::iter_swap(task_list.begin() + index, task_list.begin() + number_waiting);
+          ++number_waiting;
+        }
+      }
+
+      etl::make_heap(task_list.begin(), task_list.begin() + number_waiting, later_release());
+      etl::make_heap(task_list.rbegin(), task_list.rend() - number_waiting, later_deadline());
+    }
+
+    size_t   number_of_tasks;
+    size_t   number_waiting;
+    uint32_t deadline_misses;
+  };
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -392,6 +535,14 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Get the scheduler policy, for its statistics.
+    //*******************************************
+    const TSchedulerPolicy& get_policy() const
+    {
+      return *this;
+    }
+
   private:
 
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
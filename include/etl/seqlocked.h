@@ -0,0 +1,152 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCKED_INCLUDED
+#define ETL_SEQLOCKED_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex/spinlock.h"
+#include "mutex/seqlock.h"
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup seqlocked seqlocked
+/// A value published by writers and copied by readers without locks.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup seqlocked
+  /// Holds a trivially copyable value, such as a configuration struct, that is
+  /// written rarely and read often by many threads.
+  /// Readers take consistent copies without writing to any shared memory, so
+  /// readers do not contend with each other and never block a writer.
+  /// Writers are serialised with a spinlock held on a separate cache line.
+  ///\code
+  /// etl::seqlocked<Config> config;
+  ///
+  /// config.store(new_config); // Writer
+  /// Config c = config.load(); // Readers
+  ///\endcode
+  ///\tparam T A trivially copyable type.
+  //***************************************************************************
+  template <typename T>
+  class seqlocked
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    seqlocked()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param value The initial value.
+    //*************************************************************************
+    explicit seqlocked(const T& value)
+      : data(value)
+    {
+    }
+
+    //*************************************************************************
+    /// Publishes a new value.
+    //*************************************************************************
+    void store(const T& value)
+    {
+      write_lock.lock();
+      data.write(value);
+      write_lock.unlock();
+    }
+
+    //*************************************************************************
+    /// Changes the value with a read-modify-write that no other writer can interleave.
+    ///\param modifier Called as modifier(T&) with a copy of the current value.
+    //*************************************************************************
+    template <typename TModifier>
+    void modify(TModifier modifier)
+    {
+      write_lock.lock();
+
+      T value = data.read();
+      modifier(value);
+      data.write(value);
+
+      write_lock.unlock();
+    }
+
+    //*************************************************************************
+    /// Gets a consistent copy of the value.
+    //*************************************************************************
+    T load() const
+    {
+      return data.read();
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to copy the value.
+    ///\return <b>true</b> if the copy is consistent, <b>false</b> if it overlapped a write.
+    //*************************************************************************
+    bool try_load(T& value) const
+    {
+      return data.try_read(value);
+    }
+
+    //*************************************************************************
+    /// The number of values published, to let a reader check for a change
+    /// without copying the value.
+    //*************************************************************************
+    uint32_t version() const
+    {
+      return data.sequence_number() / 2U;
+    }
+
+  private:
+
+    // Disabled.
+    seqlocked(const seqlocked&);
+    seqlocked& operator =(const seqlocked&);
+
+    etl::seqlock<T> data;
+#if ETL_CACHE_LINE_SIZE > 0
+    char            padding[ETL_CACHE_LINE_SIZE];
+#endif
+    etl::spinlock   write_lock;
+  };
+}
+
+#endif
+#endif
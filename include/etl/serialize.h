@@ -0,0 +1,584 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SERIALIZE_INCLUDED
+#define ETL_SERIALIZE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "bit_stream.h"
+#include "byte_stream.h"
+#include "string_view.h"
+#include "array_view.h"
+#include "basic_string.h"
+#include "vector.h"
+#include "map.h"
+#include "variant.h"
+
+///\defgroup serialize serialize
+/// Allocation free serialisation of values and ETL containers to and from
+/// an etl::byte_stream_writer / etl::byte_stream_reader or an etl::bit_stream.
+/// Scalars are written in the byte order of the stream. Lengths are written
+/// as unsigned LEB128 varints. Arrays of arithmetic values, and the
+/// characters of strings, are copied in bulk; the byte streams copy them
+/// with a single memory copy when the byte order matches.
+/// Every function returns false if the stream runs out of room, or the data
+/// does not fit the destination. The stream position is then unspecified.
+/// Other types are supported by declaring serialize and deserialize
+/// overloads for them, in etl or in the namespace of the type.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_serialize
+  {
+    //*************************************************************************
+    /// Types that may be copied as a block of scalars.
+    /// bool is excluded, as not every byte value is a valid bool.
+    //*************************************************************************
+    template <typename T>
+    struct is_bulk : etl::integral_constant<bool, etl::is_arithmetic<T>::value && !etl::is_same<T, bool>::value>
+    {
+    };
+
+    //*************************************************************************
+    // Scalars.
+    //*************************************************************************
+    template <typename T>
+    bool put(etl::byte_stream_writer& stream, T value)
+    {
+      return stream.write(value);
+    }
+
+    inline bool put(etl::byte_stream_writer& stream, bool value)
+    {
+      return stream.write(static_cast<uint8_t>(value ? 1U : 0U));
+    }
+
+    template <typename T>
+    bool put(etl::bit_stream& stream, T value)
+    {
+      return stream.put(value);
+    }
+
+    template <typename T>
+    bool get(etl::byte_stream_reader& stream, T& value)
+    {
+      return stream.read(value);
+    }
+
+    inline bool get(etl::byte_stream_reader& stream, bool& value)
+    {
+      uint8_t byte;
+
+      if (!stream.read(byte))
+      {
+        return false;
+      }
+
+      value = (byte != 0U);
+
+      return true;
+    }
+
+    template <typename T>
+    bool get(etl::bit_stream& stream, T& value)
+    {
+      return stream.get(value);
+    }
+
+    //*************************************************************************
+    // Blocks of scalars.
+    //*************************************************************************
+    template <typename T>
+    bool put_block(etl::byte_stream_writer& stream, const T* values, size_t count)
+    {
+      return stream.write(values, count);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      put_block(etl::bit_stream& stream, const T* values, size_t count)
+    {
+      return stream.put(values, count);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, bool>::type
+      put_block(etl::bit_stream& stream, const T* values, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (!stream.put(values[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    template <typename T>
+    bool get_block(etl::byte_stream_reader& stream, T* values, size_t count)
+    {
+      return stream.read(values, count);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      get_block(etl::bit_stream& stream, T* values, size_t count)
+    {
+      return stream.get(values, count);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, bool>::type
+      get_block(etl::bit_stream& stream, T* values, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (!stream.get(values[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes a length, or any unsigned value, as an unsigned LEB128 varint.
+  /// Values below 128 take one byte.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream>
+  bool serialize_varint(TStream& stream, uint64_t value)
+  {
+    while (value >= 0x80U)
+    {
+      if (!private_serialize::put(stream, static_cast<uint8_t>(value | 0x80U)))
+      {
+        return false;
+      }
+
+      value >>= 7;
+    }
+
+    return private_serialize::put(stream, static_cast<uint8_t>(value));
+  }
+
+  //***************************************************************************
+  /// Reads an unsigned LEB128 varint.
+  /// Returns false if it is longer than a uint64_t.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream>
+  bool deserialize_varint(TStream& stream, uint64_t& value)
+  {
+    value = 0U;
+
+    for (uint_least8_t shift = 0U; shift < 64U; shift += 7U)
+    {
+      uint8_t byte;
+
+      if (!private_serialize::get(stream, byte))
+      {
+        return false;
+      }
+
+      value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+
+      if ((byte & 0x80U) == 0U)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  namespace private_serialize
+  {
+    //*************************************************************************
+    /// Reads a length, failing if it is more than 'limit'.
+    //*************************************************************************
+    template <typename TStream>
+    bool get_length(TStream& stream, size_t& length, size_t limit)
+    {
+      uint64_t value;
+
+      if (!etl::deserialize_varint(stream, value) || (value > limit))
+      {
+        return false;
+      }
+
+      length = static_cast<size_t>(value);
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes an arithmetic value.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+    serialize(TStream& stream, T value)
+  {
+    return private_serialize::put(stream, value);
+  }
+
+  //***************************************************************************
+  /// Reads an arithmetic value.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+    deserialize(TStream& stream, T& value)
+  {
+    return private_serialize::get(stream, value);
+  }
+
+  //***************************************************************************
+  /// Writes a string view as a length and characters.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream>
+  bool serialize(TStream& stream, const etl::string_view& view)
+  {
+    return etl::serialize_varint(stream, view.size()) &&
+           private_serialize::put_block(stream, view.data(), view.size());
+  }
+
+  //***************************************************************************
+  /// Reads a string as a view of the characters in the buffer, without
+  /// copying. The view is valid while the buffer is.
+  ///\ingroup serialize
+  //***************************************************************************
+  inline bool deserialize(etl::byte_stream_reader& stream, etl::string_view& view)
+  {
+    size_t length;
+
+    return private_serialize::get_length(stream, length, stream.available()) &&
+           stream.read_view(view, length);
+  }
+
+  //***************************************************************************
+  /// Writes a string as a length and characters.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  bool serialize(TStream& stream, const etl::ibasic_string<T>& text)
+  {
+    return etl::serialize_varint(stream, text.size()) &&
+           private_serialize::put_block(stream, text.data(), text.size());
+  }
+
+  //***************************************************************************
+  /// Reads a string.
+  /// Returns false if it is longer than the capacity of the string.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  bool deserialize(TStream& stream, etl::ibasic_string<T>& text)
+  {
+    size_t length;
+
+    if (!private_serialize::get_length(stream, length, text.max_size()))
+    {
+      return false;
+    }
+
+    text.resize(length);
+
+    return private_serialize::get_block(stream, text.data(), length);
+  }
+
+  namespace private_serialize
+  {
+    //*************************************************************************
+    template <typename TStream, typename T>
+    bool put_elements(TStream& stream, const T* values, size_t count, etl::true_type /*bulk*/)
+    {
+      return private_serialize::put_block(stream, values, count);
+    }
+
+    template <typename TStream, typename T>
+    bool put_elements(TStream& stream, const T* values, size_t count, etl::false_type /*bulk*/)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (!serialize(stream, values[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <typename TStream, typename T>
+    bool get_elements(TStream& stream, T* values, size_t count, etl::true_type /*bulk*/)
+    {
+      return private_serialize::get_block(stream, values, count);
+    }
+
+    template <typename TStream, typename T>
+    bool get_elements(TStream& stream, T* values, size_t count, etl::false_type /*bulk*/)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (!deserialize(stream, values[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes a vector as a length and elements.
+  /// The elements may be any type with a serialize overload.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  bool serialize(TStream& stream, const etl::ivector<T>& values)
+  {
+    return etl::serialize_varint(stream, values.size()) &&
+           private_serialize::put_elements(stream, values.data(), values.size(), private_serialize::is_bulk<T>());
+  }
+
+  //***************************************************************************
+  /// Reads a vector.
+  /// The elements must be default constructible.
+  /// Returns false if there are more elements than the capacity of the vector.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T>
+  bool deserialize(TStream& stream, etl::ivector<T>& values)
+  {
+    size_t length;
+
+    if (!private_serialize::get_length(stream, length, values.max_size()))
+    {
+      return false;
+    }
+
+    values.resize(length);
+
+    return private_serialize::get_elements(stream, values.data(), length, private_serialize::is_bulk<T>());
+  }
+
+  //***************************************************************************
+  /// Writes a map as a length and key/value pairs, in key order.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename TKey, typename TMapped, typename TKeyCompare>
+  bool serialize(TStream& stream, const etl::imap<TKey, TMapped, TKeyCompare>& map)
+  {
+    if (!etl::serialize_varint(stream, map.size()))
+    {
+      return false;
+    }
+
+    typename etl::imap<TKey, TMapped, TKeyCompare>::const_iterator itr = map.begin();
+
+    while (itr != map.end())
+    {
+      if (!serialize(stream, itr->first) || !serialize(stream, itr->second))
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Reads a map, replacing its contents.
+  /// The key and mapped types must be default constructible.
+  /// Returns false if there are more pairs than the capacity of the map.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename TKey, typename TMapped, typename TKeyCompare>
+  bool deserialize(TStream& stream, etl::imap<TKey, TMapped, TKeyCompare>& map)
+  {
+    size_t length;
+
+    if (!private_serialize::get_length(stream, length, map.max_size()))
+    {
+      return false;
+    }
+
+    map.clear();
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      TKey key;
+
+      if (!deserialize(stream, key))
+      {
+        return false;
+      }
+
+      // Read the mapped value in place, rather than copying it in.
+      TMapped& mapped = map.insert(ETL_OR_STD::make_pair(key, TMapped())).first->second;
+
+      if (!deserialize(stream, mapped))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  namespace private_serialize
+  {
+    //*************************************************************************
+    /// The index written for a variant with no value.
+    //*************************************************************************
+    static const uint8_t VARIANT_EMPTY = 0xFFU;
+
+    //*************************************************************************
+    /// Writes the value of a variant as type T.
+    //*************************************************************************
+    template <typename TStream, typename TVariant, typename T>
+    struct variant_alternative
+    {
+      static bool put(TStream& stream, const TVariant& v)
+      {
+        return serialize(stream, v.template get<T>());
+      }
+
+      static bool get(TStream& stream, TVariant& v)
+      {
+        v = T();
+        return deserialize(stream, v.template get<T>());
+      }
+    };
+
+    //*************************************************************************
+    /// The unused alternatives of a variant.
+    //*************************************************************************
+    template <typename TStream, typename TVariant, const size_t ID>
+    struct variant_alternative<TStream, TVariant, etl::private_variant::no_type<ID> >
+    {
+      static bool put(TStream&, const TVariant&)
+      {
+        return false;
+      }
+
+      static bool get(TStream&, TVariant&)
+      {
+        return false;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Writes a variant as the index of its type, followed by its value.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
+  bool serialize(TStream& stream, const etl::variant<T1, T2, T3, T4, T5, T6, T7, T8>& v)
+  {
+    typedef etl::variant<T1, T2, T3, T4, T5, T6, T7, T8> variant_t;
+
+    if (!v.is_valid())
+    {
+      return private_serialize::put(stream, private_serialize::VARIANT_EMPTY);
+    }
+
+    if (!private_serialize::put(stream, static_cast<uint8_t>(v.index())))
+    {
+      return false;
+    }
+
+    switch (v.index())
+    {
+      case 0:  return private_serialize::variant_alternative<TStream, variant_t, T1>::put(stream, v);
+      case 1:  return private_serialize::variant_alternative<TStream, variant_t, T2>::put(stream, v);
+      case 2:  return private_serialize::variant_alternative<TStream, variant_t, T3>::put(stream, v);
+      case 3:  return private_serialize::variant_alternative<TStream, variant_t, T4>::put(stream, v);
+      case 4:  return private_serialize::variant_alternative<TStream, variant_t, T5>::put(stream, v);
+      case 5:  return private_serialize::variant_alternative<TStream, variant_t, T6>::put(stream, v);
+      case 6:  return private_serialize::variant_alternative<TStream, variant_t, T7>::put(stream, v);
+      case 7:  return private_serialize::variant_alternative<TStream, variant_t, T8>::put(stream, v);
+      default: return false;
+    }
+  }
+
+  //***************************************************************************
+  /// Reads a variant.
+  /// The types of the variant must be default constructible.
+  /// Returns false if the index is not one of the variant's types.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename TStream, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
+  bool deserialize(TStream& stream, etl::variant<T1, T2, T3, T4, T5, T6, T7, T8>& v)
+  {
+    typedef etl::variant<T1, T2, T3, T4, T5, T6, T7, T8> variant_t;
+
+    uint8_t index;
+
+    if (!private_serialize::get(stream, index))
+    {
+      return false;
+    }
+
+    switch (index)
+    {
+      case 0:  return private_serialize::variant_alternative<TStream, variant_t, T1>::get(stream, v);
+      case 1:  return private_serialize::variant_alternative<TStream, variant_t, T2>::get(stream, v);
+      case 2:  return private_serialize::variant_alternative<TStream, variant_t, T3>::get(stream, v);
+      case 3:  return private_serialize::variant_alternative<TStream, variant_t, T4>::get(stream, v);
+      case 4:  return private_serialize::variant_alternative<TStream, variant_t, T5>::get(stream, v);
+      case 5:  return private_serialize::variant_alternative<TStream, variant_t, T6>::get(stream, v);
+      case 6:  return private_serialize::variant_alternative<TStream, variant_t, T7>::get(stream, v);
+      case 7:  return private_serialize::variant_alternative<TStream, variant_t, T8>::get(stream, v);
+      case private_serialize::VARIANT_EMPTY: v.clear(); return true;
+      default: return false;
+    }
+  }
+}
+
+#endif
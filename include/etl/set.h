@@ -46,6 +46,7 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "iterator.h"
 #include "utility.h"
+#include "private/node_handle.h"
 
 #include "algorithm.h"
 #include "iterator.h"
@@ -204,6 +205,9 @@ namespace etl
       Node() :
         weight(kNeither),
         dir(kNeither)
+#if defined(ETL_SET_ORDER_STATISTICS)
+        , size(1U)
+#endif
       {
       }
 
@@ -216,11 +220,17 @@ namespace etl
         dir = kNeither;
         children[0] = nullptr;
         children[1] = nullptr;
+#if defined(ETL_SET_ORDER_STATISTICS)
+        size = 1U;
+#endif
       }
 
       Node* children[2];
       uint_least8_t weight;
       uint_least8_t dir;
+#if defined(ETL_SET_ORDER_STATISTICS)
+      size_t size; ///< The number of nodes in the subtree rooted here.
+#endif
     };
 
     //*************************************************************************
@@ -278,6 +288,9 @@ namespace etl
       swap->children[kLeft] = detached->children[kLeft];
       swap->children[kRight] = detached->children[kRight];
       swap->weight = detached->weight;
+#if defined(ETL_SET_ORDER_STATISTICS)
+      swap->size = detached->size;
+#endif
     }
 
     //*************************************************************************
@@ -377,6 +390,53 @@ namespace etl
       return limit_node;
     }
 
+#if defined(ETL_SET_ORDER_STATISTICS)
+    //*************************************************************************
+    /// The number of nodes in the subtree rooted at the node provided.
+    //*************************************************************************
+    static size_t subtree_size(const Node* node)
+    {
+      return (node != nullptr) ? node->size : 0U;
+    }
+
+    //*************************************************************************
+    /// Recount the node provided from the sizes of its children.
+    //*************************************************************************
+    static void update_size(Node* node)
+    {
+      node->size = 1U + subtree_size(node->children[kLeft]) + subtree_size(node->children[kRight]);
+    }
+
+    //*************************************************************************
+    /// Find the node at the position provided, in key order.
+    //*************************************************************************
+    const Node* find_index_node(size_t index) const
+    {
+      const Node* node = root_node;
+
+      while (node != nullptr)
+      {
+        const size_t left_size = subtree_size(node->children[kLeft]);
+
+        if (index < left_size)
+        {
+          node = node->children[kLeft];
+        }
+        else if (index == left_size)
+        {
+          break;
+        }
+        else
+        {
+          index -= left_size + 1U;
+          node = node->children[kRight];
+        }
+      }
+
+      return node;
+    }
+
+#endif
     //*************************************************************************
     /// Rotate two nodes at the position provided the to balance the tree
     //*************************************************************************
@@ -399,6 +459,11 @@ namespace etl
       position->children[dir] = new_root->children[1 - dir];
       // New root now becomes parent of current position
       new_root->children[1 - dir] = position;
+#if defined(ETL_SET_ORDER_STATISTICS)
+      // Recount the moved subtrees, lowest first.
+      update_size(position);
+      update_size(new_root);
+#endif
       // Clear weight factor from current position
       position->weight = uint_least8_t(kNeither);
       // Newly detached right now becomes current position
@@ -426,6 +491,10 @@ namespace etl
 
       // Capture new root (either E or D depending on dir)
       Node* new_root = position->children[dir]->children[1 - dir];
+#if defined(ETL_SET_ORDER_STATISTICS)
+      // Capture B or C, which stays below the new root
+      Node* child = position->children[dir];
+#endif
       // Set weight factor for B or C based on F or G existing and being a different than dir
       position->children[dir]->weight = third != uint_least8_t(kNeither) && third != dir ? dir : uint_least8_t(kNeither);
 
@@ -441,6 +510,12 @@ namespace etl
       position->children[dir] = new_root->children[1 - dir];
       // Attach current root to new roots right tree
       new_root->children[1 - dir] = position;
+#if defined(ETL_SET_ORDER_STATISTICS)
+      // Recount the moved subtrees, lowest first.
+      update_size(child);
+      update_size(position);
+      update_size(new_root);
+#endif
       // Replace current position with new root
       position = new_root;
       // Clear weight factor for new current position
@@ -471,6 +546,7 @@ namespace etl
     typedef const value_type&   const_reference;
 #if ETL_CPP11_SUPPORTED
     typedef value_type&&        rvalue_reference;
+    typedef etl::node_handle<value_type, iset> node_type;
 #endif
     typedef value_type*         pointer;
     typedef const value_type*   const_pointer;
@@ -1104,6 +1180,109 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The value is constructed in place from the arguments.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The position hint is ignored.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator, Args && ... args)
+    {
+      return emplace(etl::forward<Args>(args)...).first;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the set starting at the position recommended.
     /// If asserts or exceptions are enabled, emits set_full if the set is already full.
@@ -1216,6 +1395,81 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Unlinks the element at the position from the set and returns a
+    /// handle that owns its node. The node is not destroyed or released.
+    ///\param position The position of the element to extract.
+    //*********************************************************************
+    node_type extract(const_iterator position)
+    {
+      return extract(*position);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element with the key from the set and returns a handle
+    /// that owns its node. Returns an empty handle if the key is not found.
+    ///\param key_value The key of the element to extract.
+    //*********************************************************************
+    node_type extract(key_parameter_t key_value)
+    {
+      Node* found = unlink_node(root_node, key_value);
+
+      if (found == nullptr)
+      {
+        return node_type();
+      }
+
+      ETL_DECREMENT_DEBUG_COUNT
+
+      Data_Node& node = iset::data_cast(*found);
+
+      return node_type(&node.value, &node, p_node_pool);
+    }
+
+    //*********************************************************************
+    /// Inserts the node owned by the handle.
+    /// If the node came from the pool used by this set it is relinked
+    /// without copying, otherwise its value is moved in to a new node.
+    /// If the key already exists the handle keeps its node.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param handle The node handle.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(node_type&& handle)
+    {
+      if (handle.empty())
+      {
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      iterator i_element = find(handle.value());
+
+      if (i_element != end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node* p_node;
+
+      if (handle.get_pool() == p_node_pool)
+      {
+        p_node = static_cast<Data_Node*>(handle.release());
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+      else
+      {
+        p_node = &allocate_data_node(etl::move(handle.value()));
+        handle = node_type();
+      }
+
+      Node* inserted_node = insert_node(root_node, *p_node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), true);
+    }
+#endif
+
     //*********************************************************************
     /// Returns an iterator pointing to the first element in the container
     /// whose key is not considered to go before the key provided or end()
@@ -1260,6 +1514,54 @@ namespace etl
       return const_iterator(*this, find_upper_node(root_node, key));
     }
 
+#if defined(ETL_SET_ORDER_STATISTICS)
+    //*************************************************************************
+    /// Counts the elements ordered before the key provided. O(logN)
+    ///\param key The key to rank.
+    ///\return The number of elements with keys less than the key.
+    //*************************************************************************
+    size_type rank(key_parameter_t key) const
+    {
+      size_type result = 0U;
+      const Node* node = root_node;
+
+      while (node != nullptr)
+      {
+        if (node_comp(iset::data_cast(*node), key))
+        {
+          result += 1U + subtree_size(node->children[kLeft]);
+          node = node->children[kRight];
+        }
+        else
+        {
+          node = node->children[kLeft];
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the element at the position provided, in key order. O(logN)
+    ///\param index The zero based position.
+    ///\return An iterator to the element, or end() if index >= size().
+    //*************************************************************************
+    iterator select(size_type index)
+    {
+      return iterator(*this, const_cast<Node*>(find_index_node(index)));
+    }
+
+    //*************************************************************************
+    /// Gets the element at the position provided, in key order. O(logN)
+    ///\param index The zero based position.
+    ///\return A const_iterator to the element, or end() if index >= size().
+    //*************************************************************************
+    const_iterator select(size_type index) const
+    {
+      return const_iterator(*this, find_index_node(index));
+    }
+#endif
+
     //*************************************************************************
     /// How to compare two key elements.
     //*************************************************************************
@@ -1287,6 +1589,14 @@ namespace etl
     {
     }
 
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_node_pool() const
+    {
+      return *p_node_pool;
+    }
+
     //*************************************************************************
     /// Initialise the set.
     //*************************************************************************
@@ -1702,6 +2012,17 @@ namespace etl
           }
         }
 
+#if defined(ETL_SET_ORDER_STATISTICS)
+        // Count the new node in each subtree on the path down to it
+        if (found == &node)
+        {
+          for (Node* path_node = position; path_node != found; path_node = path_node->children[path_node->dir])
+          {
+            ++path_node->size;
+          }
+        }
+
+#endif
         // Was a critical node found that should be checked for balance?
         if (critical_node)
         {
@@ -1877,6 +2198,23 @@ namespace etl
     /// provided
     //*************************************************************************
     Node* remove_node(Node*& position, key_parameter_t key)
+    {
+      Node* found = unlink_node(position, key);
+
+      if (found)
+      {
+        // Destroy the node removed
+        destroy_data_node(iset::data_cast(*found));
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Unlink the node whose key matches the key provided from the tree.
+    /// The node is neither destroyed nor released.
+    //*************************************************************************
+    Node* unlink_node(Node*& position, key_parameter_t key)
     {
       // Step 1: Find the target node that matches the key provided, the
       // replacement node (might be the same as target node), and the critical
@@ -1941,6 +2279,19 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
+#if defined(ETL_SET_ORDER_STATISTICS)
+        // Uncount the removal from each subtree on the path down to the
+        // replacement node, including the replacement itself, whose place
+        // will be taken by its only child. Sizes then already describe the
+        // final tree when the rotations below recount their nodes.
+        for (Node* path_node = position; path_node != replace; path_node = path_node->children[path_node->dir])
+        {
+          --path_node->size;
+        }
+
+        --replace->size;
+
+#endif
         // Step 2: Update weights from critical node to replacement parent node
         while (balance)
         {
@@ -2052,14 +2403,8 @@ namespace etl
           }
         }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = iset::data_cast(*found);
-
         // One less.
         --current_size;
-
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
       } // if(found)
 
         // Return node found (might be nullptr)
@@ -2208,6 +2553,193 @@ namespace etl
     etl::pool<typename etl::iset<TKey, TCompare>::Data_Node, MAX_SIZE> node_pool;
   };
 
+  //*************************************************************************
+  /// A templated set implementation that uses a pool supplied by the user.
+  /// Sets that share a pool can pass elements between each other as node
+  /// handles without reallocating them.
+  //*************************************************************************
+  template <typename TKey, typename TCompare>
+  class set<TKey, 0, TCompare> : public etl::iset<TKey, TCompare>
+  {
+  public:
+
+    typedef typename etl::iset<TKey, TCompare>::Data_Node pool_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit set(etl::ipool& node_pool)
+      : etl::iset<TKey, TCompare>(node_pool, node_pool.max_size())
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same pool as the other set.
+    //*************************************************************************
+    set(const set& other)
+      : etl::iset<TKey, TCompare>(other.get_node_pool(), other.max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    /// Uses the same pool as the other set, so the nodes are relinked.
+    //*************************************************************************
+    set(set&& other)
+      : etl::iset<TKey, TCompare>(other.get_node_pool(), other.max_size())
+    {
+      if (this != &other)
+      {
+        while (!other.empty())
+        {
+          this->insert(other.extract(other.begin()));
+        }
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    set(TIterator first, TIterator last, etl::ipool& node_pool)
+      : etl::iset<TKey, TCompare>(node_pool, node_pool.max_size())
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~set()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    set& operator = (const set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    set& operator = (set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+
+        while (!rhs.empty())
+        {
+          this->insert(rhs.extract(rhs.begin()));
+        }
+      }
+
+      return *this;
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated set implementation whose nodes are kept in a buffer
+  /// supplied by the user, so that where the set lives is decided when it
+  /// is constructed.
+  /// The buffer must be aligned to ALIGNMENT, hold buffer_size(max_size)
+  /// bytes and outlive the set.
+  //*************************************************************************
+  template <typename TKey, typename TCompare = etl::less<TKey> >
+  class set_ext : public etl::iset<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::pool_ext<typename etl::iset<TKey, TCompare>::Data_Node> pool_type;
+
+  public:
+
+    static const size_t ALIGNMENT = pool_type::ALIGNMENT;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The memory for the nodes.
+    ///\param max_size The maximum number of elements.
+    //*************************************************************************
+    set_ext(void* buffer, size_t max_size)
+      : etl::iset<TKey, TCompare>(node_pool, max_size),
+        node_pool(buffer, max_size)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    set_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : etl::iset<TKey, TCompare>(node_pool, max_size),
+        node_pool(buffer, max_size)
+    {
+      this->initialise();
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed for max_size elements.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t buffer_size(size_t max_size)
+    {
+      return pool_type::buffer_size(max_size);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~set_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    set_ext& operator = (const set_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // The buffer belongs to the user, so cannot be copied.
+    set_ext(const set_ext&);
+
+    /// The pool of data nodes, in the user's buffer.
+    pool_type node_pool;
+  };
+
   //***************************************************************************
   /// Equal operator.
   ///\param lhs Reference to the first lookup.
@@ -0,0 +1,113 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIP_INCLUDED
+#define ETL_SLIP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "private/framing_common.h"
+#include "private/escape_framing.h"
+
+///\defgroup slip SLIP framing
+/// Serial Line Internet Protocol framing (RFC 1055), with an optional frame
+/// check sequence, such as etl::crc16_x25, appended to each frame, least
+/// significant byte first. The frame check is calculated in the same pass
+/// as the escaping.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// The SLIP special bytes.
+    //*************************************************************************
+    struct slip_traits
+    {
+      enum
+      {
+        DELIMITER = 0xC0U,
+        ESCAPE    = 0xDBU
+      };
+
+      static uint8_t escape(uint8_t value)
+      {
+        return (value == DELIMITER) ? uint8_t(0xDCU) : uint8_t(0xDDU);
+      }
+
+      static bool unescape(uint8_t value, uint8_t& result)
+      {
+        result = (value == 0xDCU) ? uint8_t(DELIMITER) : uint8_t(ESCAPE);
+
+        return (value == 0xDCU) || (value == 0xDDU);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A SLIP encoder.
+  /// Each frame is begun with begin(), given data with any number of calls to
+  /// add(), and ended with end(), or encoded in one go with encode().
+  /// A delimiter is sent at the start of each frame, to flush line noise.
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup slip
+  //***************************************************************************
+  template <typename TFrameCheck = etl::no_frame_check>
+  class slip_encoder : public private_framing::escape_encoder<private_framing::slip_traits, TFrameCheck>
+  {
+  };
+
+  //***************************************************************************
+  /// A SLIP decoder.
+  /// Received data may be passed in chunks of any size to decode().
+  ///\tparam TFrameCheck The frame check sequence, or etl::no_frame_check.
+  ///\ingroup slip
+  //***************************************************************************
+  template <typename TFrameCheck = etl::no_frame_check>
+  class slip_decoder : public private_framing::escape_decoder<private_framing::slip_traits, TFrameCheck>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer for decoded frames.
+    ///\param capacity The size of the buffer, including the frame check sequence.
+    //*************************************************************************
+    slip_decoder(uint8_t* buffer, size_t capacity)
+      : private_framing::escape_decoder<private_framing::slip_traits, TFrameCheck>(buffer, capacity)
+    {
+    }
+  };
+}
+
+#endif
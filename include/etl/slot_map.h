@@ -0,0 +1,702 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLOT_MAP_INCLUDED
+#define ETL_SLOT_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "vector.h"
+#include "utility.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "66"
+
+//*****************************************************************************
+///\defgroup slot_map slot_map
+/// A fixed capacity container that returns a generational handle for each
+/// value. Insert, erase and lookup by handle are O(1). The values are held
+/// densely in an etl::vector, so iteration is over contiguous memory.
+/// Erasing a value moves the last value in to its place.
+/// A handle to an erased value is detected, even if its slot is reused.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for slot_map exceptions.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_exception : public etl::exception
+  {
+  public:
+
+    slot_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the slot_map is full.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_full : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a value.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_invalid_handle : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:invalid handle", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A handle to a value in a slot_map.
+  /// A default constructed handle does not refer to any value.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_handle
+  {
+  public:
+
+    typedef uint32_t generation_type;
+
+    //*************************************************************************
+    /// Constructs a handle that does not refer to a value.
+    //*************************************************************************
+    slot_map_handle()
+      : slot_index(etl::integral_limits<size_t>::max),
+        slot_generation(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a handle from its parts.
+    //*************************************************************************
+    slot_map_handle(size_t index_, generation_type generation_)
+      : slot_index(index_),
+        slot_generation(generation_)
+    {
+    }
+
+    //*************************************************************************
+    /// The index of the slot.
+    //*************************************************************************
+    size_t index() const
+    {
+      return slot_index;
+    }
+
+    //*************************************************************************
+    /// The generation of the slot when the handle was issued.
+    //*************************************************************************
+    generation_type generation() const
+    {
+      return slot_generation;
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    friend bool operator ==(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return (lhs.slot_index == rhs.slot_index) && (lhs.slot_generation == rhs.slot_generation);
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    friend bool operator !=(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    size_t          slot_index;
+    generation_type slot_generation;
+  };
+
+  //***************************************************************************
+  /// The base for all slot_maps that contain a particular type.
+  /// Each slot holds a generation and, while in use, the position of its
+  /// value. A free slot holds the index of the next free slot instead.
+  /// The generation is odd while the slot is in use and is incremented
+  /// whenever the slot is used or freed.
+  ///\tparam T The type of value held.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T>
+  class islot_map
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef size_t            size_type;
+    typedef etl::slot_map_handle handle_type;
+
+    typedef typename etl::ivector<T>::iterator       iterator;
+    typedef typename etl::ivector<T>::const_iterator const_iterator;
+
+    //*************************************************************************
+    /// Iterators over the values. The order changes when values are erased.
+    //*************************************************************************
+    iterator begin()
+    {
+      return values.begin();
+    }
+
+    const_iterator begin() const
+    {
+      return values.begin();
+    }
+
+    const_iterator cbegin() const
+    {
+      return values.cbegin();
+    }
+
+    iterator end()
+    {
+      return values.end();
+    }
+
+    const_iterator end() const
+    {
+      return values.end();
+    }
+
+    const_iterator cend() const
+    {
+      return values.cend();
+    }
+
+    //*************************************************************************
+    /// A pointer to the contiguous values.
+    //*************************************************************************
+    pointer data()
+    {
+      return values.data();
+    }
+
+    const_pointer data() const
+    {
+      return values.data();
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type insert(const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      const size_t slot = allocate_slot();
+      values.push_back(value);
+
+      return handle_type(slot, p_slots[slot].generation);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves in a value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      const size_t slot = allocate_slot();
+      values.push_back(etl::move(value));
+
+      return handle_type(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      const size_t slot = allocate_slot();
+      values.emplace_back(etl::forward<Args>(args)...);
+
+      return handle_type(slot, p_slots[slot].generation);
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value for the handle.
+    ///\return <b>true</b> if the handle referred to a value.
+    //*************************************************************************
+    bool erase(handle_type handle)
+    {
+      if (!contains(handle))
+      {
+        return false;
+      }
+
+      erase_at(p_slots[handle.index()].index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    ///\return An iterator to the value that took its place, or end().
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t index = size_t(position - values.cbegin());
+
+      erase_at(index);
+
+      return values.begin() + index;
+    }
+
+    //*************************************************************************
+    /// Checks if the handle refers to a value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle.index() < CAPACITY) &&
+             ((handle.generation() & 1U) != 0U) &&
+             (p_slots[handle.index()].generation == handle.generation());
+    }
+
+    //*************************************************************************
+    /// Finds the value for the handle.
+    ///\return An iterator to the value, or end().
+    //*************************************************************************
+    iterator find(handle_type handle)
+    {
+      return contains(handle) ? values.begin() + p_slots[handle.index()].index : values.end();
+    }
+
+    const_iterator find(handle_type handle) const
+    {
+      return contains(handle) ? values.cbegin() + p_slots[handle.index()].index : values.cend();
+    }
+
+    //*************************************************************************
+    /// Gets the value for the handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if the handle does not refer to a value.
+    //*************************************************************************
+    reference operator [](handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(slot_map_invalid_handle));
+
+      return values[p_slots[handle.index()].index];
+    }
+
+    const_reference operator [](handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(slot_map_invalid_handle));
+
+      return values[p_slots[handle.index()].index];
+    }
+
+    //*************************************************************************
+    /// Gets the handle for the value at the position.
+    //*************************************************************************
+    handle_type get_handle(const_iterator position) const
+    {
+      const size_t slot = p_value_slots[size_t(position - values.cbegin())];
+
+      return handle_type(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return values.size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no values.
+    //*************************************************************************
+    bool empty() const
+    {
+      return values.empty();
+    }
+
+    //*************************************************************************
+    /// Checks if no more values can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return values.size() == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - values.size();
+    }
+
+    //*************************************************************************
+    /// Erases all values. All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        ++p_slots[p_value_slots[i]].generation;
+      }
+
+      values.clear();
+      link_free_slots();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The handles of the copied values are valid for this slot_map.
+    //*************************************************************************
+    islot_map& operator =(const islot_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        clone(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A slot.
+    //*************************************************************************
+    struct slot_t
+    {
+      size_t                      index;      ///< The value position, or the next free slot.
+      handle_type::generation_type generation; ///< Odd while in use.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islot_map(etl::ivector<T>& values_, slot_t* p_slots_, size_t* p_value_slots_, size_t capacity_)
+      : values(values_),
+        p_slots(p_slots_),
+        p_value_slots(p_value_slots_),
+        free_slot(0U),
+        CAPACITY(capacity_)
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].generation = 0U;
+      }
+
+      link_free_slots();
+    }
+
+    //*************************************************************************
+    /// Makes this a copy of the other slot_map, including its slots.
+    //*************************************************************************
+    void clone(const islot_map& other)
+    {
+      ETL_ASSERT(other.CAPACITY <= CAPACITY, ETL_ERROR(slot_map_full));
+
+      values.assign(other.values.begin(), other.values.end());
+      copy_slots(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the values of the other slot_map in to this one, including its
+    /// slots. The other slot_map is left empty.
+    //*************************************************************************
+    void move_clone(islot_map& other)
+    {
+      ETL_ASSERT(other.CAPACITY <= CAPACITY, ETL_ERROR(slot_map_full));
+
+      values.clear();
+
+      for (size_t i = 0U; i < other.values.size(); ++i)
+      {
+        values.push_back(etl::move(other.values[i]));
+      }
+
+      copy_slots(other);
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Takes a slot from the free list for a value about to be pushed back.
+    //*************************************************************************
+    size_t allocate_slot()
+    {
+      const size_t slot = free_slot;
+
+      free_slot = p_slots[slot].index;
+
+      p_slots[slot].index = values.size();
+      ++p_slots[slot].generation;
+      p_value_slots[values.size()] = slot;
+
+      return slot;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position, moving the last value in to its place.
+    //*************************************************************************
+    void erase_at(size_t index)
+    {
+      const size_t slot = p_value_slots[index];
+      const size_t last = values.size() - 1U;
+
+      if (index != last)
+      {
+#if ETL_CPP11_SUPPORTED
+        values[index] = etl::move(values[last]);
+#else
+        values[index] = values[last];
+#endif
+        p_value_slots[index] = p_value_slots[last];
+        p_slots[p_value_slots[index]].index = index;
+      }
+
+      values.pop_back();
+
+      ++p_slots[slot].generation;
+      p_slots[slot].index = free_slot;
+      free_slot = slot;
+    }
+
+    //*************************************************************************
+    /// Links every slot in to the free list.
+    //*************************************************************************
+    void link_free_slots()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].index = i + 1U;
+      }
+
+      free_slot = 0U;
+    }
+
+    //*************************************************************************
+    /// Copies the slots of the other slot_map, once its values are copied.
+    //*************************************************************************
+    void copy_slots(const islot_map& other)
+    {
+      for (size_t i = 0U; i < other.CAPACITY; ++i)
+      {
+        p_slots[i] = other.p_slots[i];
+      }
+
+      for (size_t i = 0U; i < other.values.size(); ++i)
+      {
+        p_value_slots[i] = other.p_value_slots[i];
+      }
+
+      // Slots beyond the other's capacity go on the end of the free list.
+      size_t* p_next = &free_slot;
+      *p_next = other.free_slot;
+
+      while (*p_next < other.CAPACITY)
+      {
+        p_next = &p_slots[*p_next].index;
+      }
+
+      for (size_t i = other.CAPACITY; i < CAPACITY; ++i)
+      {
+        *p_next = i;
+        p_next = &p_slots[i].index;
+
+        // Stays free, but no earlier handle to it is valid.
+        p_slots[i].generation = (p_slots[i].generation | 1U) + 1U;
+      }
+
+      *p_next = CAPACITY;
+    }
+
+    // Disable copy construction.
+    islot_map(const islot_map&);
+
+    etl::ivector<T>& values;        ///< The values, densely packed.
+    slot_t*          p_slots;       ///< The slots, indexed by handle.
+    size_t*          p_value_slots; ///< The slot of each value.
+    size_t           free_slot;     ///< The first free slot. CAPACITY if there are none.
+    const size_t     CAPACITY;      ///< The maximum number of values.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SLOT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~islot_map()
+    {
+    }
+#else
+  protected:
+    ~islot_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A slot_map with the capacity defined at compile time.
+  ///\tparam T         The type of value held.
+  ///\tparam MAX_SIZE_ The maximum number of values held.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class slot_map : public etl::islot_map<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::slot_map is not valid");
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slot_map()
+      : etl::islot_map<T>(values, slots, value_slots, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    slot_map(const slot_map& other)
+      : etl::islot_map<T>(values, slots, value_slots, MAX_SIZE)
+    {
+      etl::islot_map<T>::clone(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    slot_map(slot_map&& other)
+      : etl::islot_map<T>(values, slots, value_slots, MAX_SIZE)
+    {
+      etl::islot_map<T>::move_clone(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    slot_map& operator =(const slot_map& rhs)
+    {
+      etl::islot_map<T>::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    slot_map& operator =(slot_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::islot_map<T>::move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The values.
+    etl::vector<T, MAX_SIZE_> values;
+
+    /// The slots.
+    typename etl::islot_map<T>::slot_t slots[MAX_SIZE_];
+
+    /// The slot of each value.
+    size_t value_slots[MAX_SIZE_];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,704 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_VECTOR_INCLUDED
+#define ETL_SOA_VECTOR_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "largest.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "static_assert.h"
+#include "array_view.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "67"
+
+//*****************************************************************************
+///\defgroup soa_vector soa_vector
+/// A fixed capacity vector of records that stores each field of the record
+/// in its own contiguous column (structure of arrays).
+/// A scan over one field touches only that field's memory.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_CPP11_SUPPORTED
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for soa_vector exceptions.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_exception : public etl::exception
+  {
+  public:
+
+    soa_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the soa_vector is full.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_full : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the soa_vector is empty.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_empty : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_empty(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an index is out of range.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_out_of_bounds : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:bounds", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_vector
+  {
+    //*************************************************************************
+    /// Compile time sequence of column indexes.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <size_t N, size_t... Indexes>
+    struct make_index_sequence : make_index_sequence<N - 1U, N - 1U, Indexes...>
+    {
+    };
+
+    template <size_t... Indexes>
+    struct make_index_sequence<0U, Indexes...>
+    {
+      typedef index_sequence<Indexes...> type;
+    };
+
+    //*************************************************************************
+    /// The type of column I.
+    //*************************************************************************
+    template <size_t I, typename T, typename... TRest>
+    struct nth_type
+    {
+      typedef typename nth_type<I - 1U, TRest...>::type type;
+    };
+
+    template <typename T, typename... TRest>
+    struct nth_type<0U, T, TRest...>
+    {
+      typedef T type;
+    };
+
+    //*************************************************************************
+    /// The layout of the columns in one buffer.
+    /// Each column starts at the next offset aligned for its type.
+    //*************************************************************************
+    template <typename... TTypes>
+    struct layout;
+
+    template <>
+    struct layout<>
+    {
+      static ETL_CONSTEXPR size_t size(size_t offset, size_t)
+      {
+        return offset;
+      }
+
+      static void assign(void**, char*, size_t, size_t)
+      {
+      }
+    };
+
+    template <typename T, typename... TRest>
+    struct layout<T, TRest...>
+    {
+      static ETL_CONSTEXPR size_t align(size_t offset)
+      {
+        return ((offset + etl::alignment_of<T>::value - 1U) / etl::alignment_of<T>::value) * etl::alignment_of<T>::value;
+      }
+
+      /// The buffer size needed for 'n' records.
+      static ETL_CONSTEXPR size_t size(size_t offset, size_t n)
+      {
+        return layout<TRest...>::size(align(offset) + (sizeof(T) * n), n);
+      }
+
+      /// Sets the column pointers for 'n' records.
+      static void assign(void** p_columns, char* p_buffer, size_t offset, size_t n)
+      {
+        *p_columns = p_buffer + align(offset);
+        layout<TRest...>::assign(p_columns + 1, p_buffer, align(offset) + (sizeof(T) * n), n);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base for all soa_vectors with a particular record type.
+  ///\tparam TTypes The types of the fields of a record.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <typename... TTypes>
+  class isoa_vector
+  {
+  public:
+
+    typedef size_t size_type;
+
+    /// The number of columns.
+    static const size_t COLUMNS = sizeof...(TTypes);
+
+    /// The type of column I.
+    template <size_t I>
+    using column_type = typename private_soa_vector::nth_type<I, TTypes...>::type;
+
+    //*************************************************************************
+    /// A proxy for one record.
+    //*************************************************************************
+    class row_reference
+    {
+    public:
+
+      /// Gets field I of the record.
+      template <size_t I>
+      column_type<I>& get() const
+      {
+        return p_soa->template column_data<I>()[index];
+      }
+
+    private:
+
+      friend class isoa_vector;
+
+      row_reference(isoa_vector* p_soa_, size_t index_)
+        : p_soa(p_soa_),
+          index(index_)
+      {
+      }
+
+      isoa_vector* p_soa;
+      size_t       index;
+    };
+
+    //*************************************************************************
+    /// A const proxy for one record.
+    //*************************************************************************
+    class const_row_reference
+    {
+    public:
+
+      /// Gets field I of the record.
+      template <size_t I>
+      const column_type<I>& get() const
+      {
+        return p_soa->template column_data<I>()[index];
+      }
+
+    private:
+
+      friend class isoa_vector;
+
+      const_row_reference(const isoa_vector* p_soa_, size_t index_)
+        : p_soa(p_soa_),
+          index(index_)
+      {
+      }
+
+      const isoa_vector* p_soa;
+      size_t             index;
+    };
+
+    //*************************************************************************
+    /// Gets the contiguous values of column I.
+    //*************************************************************************
+    template <size_t I>
+    etl::array_view<column_type<I> > column()
+    {
+      return etl::array_view<column_type<I> >(column_data<I>(), column_data<I>() + current_size);
+    }
+
+    template <size_t I>
+    etl::array_view<const column_type<I> > column() const
+    {
+      return etl::array_view<const column_type<I> >(column_data<I>(), column_data<I>() + current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the start of column I.
+    //*************************************************************************
+    template <size_t I>
+    column_type<I>* column_data()
+    {
+      return static_cast<column_type<I>*>(p_columns[I]);
+    }
+
+    template <size_t I>
+    const column_type<I>* column_data() const
+    {
+      return static_cast<const column_type<I>*>(p_columns[I]);
+    }
+
+    //*************************************************************************
+    /// Gets field I of record 'index'.
+    //*************************************************************************
+    template <size_t I>
+    column_type<I>& get(size_t index)
+    {
+      return column_data<I>()[index];
+    }
+
+    template <size_t I>
+    const column_type<I>& get(size_t index) const
+    {
+      return column_data<I>()[index];
+    }
+
+    //*************************************************************************
+    /// Gets a proxy for record 'index'.
+    //*************************************************************************
+    row_reference operator [](size_t index)
+    {
+      return row_reference(this, index);
+    }
+
+    const_row_reference operator [](size_t index) const
+    {
+      return const_row_reference(this, index);
+    }
+
+    //*************************************************************************
+    /// Gets a proxy for record 'index'.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    row_reference at(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return row_reference(this, index);
+    }
+
+    const_row_reference at(size_t index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return const_row_reference(this, index);
+    }
+
+    //*************************************************************************
+    /// Gets proxies for the first and last records.
+    //*************************************************************************
+    row_reference front()
+    {
+      return row_reference(this, 0U);
+    }
+
+    const_row_reference front() const
+    {
+      return const_row_reference(this, 0U);
+    }
+
+    row_reference back()
+    {
+      return row_reference(this, current_size - 1U);
+    }
+
+    const_row_reference back() const
+    {
+      return const_row_reference(this, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Adds a record.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the soa_vector is full.
+    //*************************************************************************
+    void push_back(const TTypes&... values)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+#endif
+      construct_at_end(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), values...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Moves in a record.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the soa_vector is full.
+    //*************************************************************************
+    void push_back(TTypes&&... values)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+#endif
+      construct_at_end(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), etl::move(values)...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Removes the last record.
+    /// If asserts or exceptions are enabled, emits soa_vector_empty if the soa_vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(soa_vector_empty));
+#endif
+      --current_size;
+      destroy_range(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), current_size, current_size + 1U);
+    }
+
+    //*************************************************************************
+    /// Erases record 'index', moving the later records down.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    void erase(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      move_down(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), index);
+      pop_back();
+    }
+
+    //*************************************************************************
+    /// Removes all records.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_range(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), 0U, current_size);
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of records.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of records.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of records.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no records.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if no more records can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isoa_vector& operator =(const isoa_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        clone(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    isoa_vector& operator =(isoa_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_clone(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    isoa_vector(void* p_buffer, size_t capacity_)
+      : current_size(0U),
+        CAPACITY(capacity_)
+    {
+      private_soa_vector::layout<TTypes...>::assign(p_columns, static_cast<char*>(p_buffer), 0U, CAPACITY);
+    }
+
+    //*************************************************************************
+    /// Makes this a copy of the other soa_vector.
+    //*************************************************************************
+    void clone(const isoa_vector& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(soa_vector_full));
+
+      clear();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        copy_row(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), other, i);
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the records of the other soa_vector in to this one.
+    /// The other soa_vector is left empty.
+    //*************************************************************************
+    void move_clone(isoa_vector& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(soa_vector_full));
+
+      clear();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        move_row(typename private_soa_vector::make_index_sequence<COLUMNS>::type(), other, i);
+        ++current_size;
+      }
+
+      other.clear();
+    }
+
+  private:
+
+    template <size_t... Indexes, typename... TValues>
+    void construct_at_end(private_soa_vector::index_sequence<Indexes...>, TValues&&... values)
+    {
+      int expand[] = { 0, (::new (static_cast<void*>(column_data<Indexes>() + current_size)) column_type<Indexes>(etl::forward<TValues>(values)), 0)... };
+      (void)expand;
+    }
+
+    template <size_t... Indexes>
+    void copy_row(private_soa_vector::index_sequence<Indexes...>, const isoa_vector& other, size_t index)
+    {
+      int expand[] = { 0, (::new (static_cast<void*>(column_data<Indexes>() + current_size)) column_type<Indexes>(other.template column_data<Indexes>()[index]), 0)... };
+      (void)expand;
+    }
+
+    template <size_t... Indexes>
+    void move_row(private_soa_vector::index_sequence<Indexes...>, isoa_vector& other, size_t index)
+    {
+      int expand[] = { 0, (::new (static_cast<void*>(column_data<Indexes>() + current_size)) column_type<Indexes>(etl::move(other.template column_data<Indexes>()[index])), 0)... };
+      (void)expand;
+    }
+
+    template <size_t... Indexes>
+    void move_down(private_soa_vector::index_sequence<Indexes...>, size_t index)
+    {
+      int expand[] = { 0, (etl::move(column_data<Indexes>() + index + 1U, column_data<Indexes>() + current_size, column_data<Indexes>() + index), 0)... };
+      (void)expand;
+    }
+
+    template <size_t... Indexes>
+    void destroy_range(private_soa_vector::index_sequence<Indexes...>, size_t first, size_t last)
+    {
+      int expand[] = { 0, (etl::destroy(column_data<Indexes>() + first, column_data<Indexes>() + last), 0)... };
+      (void)expand;
+    }
+
+    // Disable copy construction.
+    isoa_vector(const isoa_vector&);
+
+    void*        p_columns[sizeof...(TTypes)]; ///< The start of each column.
+    size_t       current_size;                  ///< The number of records.
+    const size_t CAPACITY;                      ///< The maximum number of records.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SOA_VECTOR) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~isoa_vector()
+    {
+    }
+#else
+  protected:
+    ~isoa_vector()
+    {
+    }
+#endif
+  };
+
+  template <typename... TTypes>
+  const size_t isoa_vector<TTypes...>::COLUMNS;
+
+  //***************************************************************************
+  /// A soa_vector with the capacity defined at compile time.
+  /// All of the columns are held in one buffer.
+  ///\tparam MAX_SIZE_ The maximum number of records.
+  ///\tparam TTypes    The types of the fields of a record.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <const size_t MAX_SIZE_, typename... TTypes>
+  class soa_vector : public etl::isoa_vector<TTypes...>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::soa_vector is not valid");
+    ETL_STATIC_ASSERT((sizeof...(TTypes) > 0U), "etl::soa_vector must have at least one column");
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_vector()
+      : etl::isoa_vector<TTypes...>(&buffer, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_vector(const soa_vector& other)
+      : etl::isoa_vector<TTypes...>(&buffer, MAX_SIZE)
+    {
+      this->clone(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_vector(soa_vector&& other)
+      : etl::isoa_vector<TTypes...>(&buffer, MAX_SIZE)
+    {
+      this->move_clone(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_vector()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(const soa_vector& rhs)
+    {
+      etl::isoa_vector<TTypes...>::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(soa_vector&& rhs)
+    {
+      etl::isoa_vector<TTypes...>::operator =(etl::move(rhs));
+
+      return *this;
+    }
+
+  private:
+
+    /// The buffer for all of the columns.
+    typename etl::aligned_storage<private_soa_vector::layout<TTypes...>::size(0U, MAX_SIZE_),
+                                  etl::largest_alignment<TTypes...>::value>::type buffer;
+  };
+
+  template <const size_t MAX_SIZE_, typename... TTypes>
+  const size_t soa_vector<MAX_SIZE_, TTypes...>::MAX_SIZE;
+}
+
+#endif
+
+#undef ETL_FILE
+
+#endif
@@ -32,10 +32,12 @@ SOFTWARE.
 #define ETL_SQRT_INCLUDED
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "platform.h"
 #include "type_traits.h"
 #include "constant.h"
+#include "binary.h"
 
 namespace etl 
 {
@@ -55,6 +57,68 @@ namespace etl
       value = type::value
     };
   };
+
+  //***************************************************************************
+  /// Calculates the integer square root of a value at run time, rounded down.
+  /// Digit by digit, so no multiplies or divides; one iteration per two bits
+  /// of the value's magnitude.
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint32_t isqrt(uint32_t value)
+  {
+    if (value == 0U)
+    {
+      return 0U;
+    }
+
+    // The highest power of four not greater than the value.
+    uint32_t bit    = uint32_t(1U) << (etl::ilog2(value) & ~1U);
+    uint32_t result = 0U;
+
+    while (bit != 0U)
+    {
+      if (value >= (result + bit))
+      {
+        value -= result + bit;
+        result = (result >> 1U) + bit;
+      }
+      else
+      {
+        result >>= 1U;
+      }
+
+      bit >>= 2U;
+    }
+
+    return result;
+  }
+
+  inline ETL_CONSTEXPR14 uint64_t isqrt(uint64_t value)
+  {
+    if (value == 0U)
+    {
+      return 0U;
+    }
+
+    uint64_t bit    = uint64_t(1U) << (etl::ilog2(value) & ~1U);
+    uint64_t result = 0U;
+
+    while (bit != 0U)
+    {
+      if (value >= (result + bit))
+      {
+        value -= result + bit;
+        result = (result >> 1U) + bit;
+      }
+      else
+      {
+        result >>= 1U;
+      }
+
+      bit >>= 2U;
+    }
+
+    return result;
+  }
 }
 
 #endif
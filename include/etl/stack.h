@@ -259,7 +259,7 @@ namespace etl
     void push(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value);
@@ -274,7 +274,7 @@ namespace etl
     void push(rvalue_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(etl::move(value));
@@ -291,7 +291,7 @@ namespace etl
     void emplace(Args && ... args)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(etl::forward<Args>(args)...);
@@ -306,7 +306,7 @@ namespace etl
     void emplace(const T1& value1)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value1);
@@ -321,7 +321,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value1, value2);
@@ -336,7 +336,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2, const T3& value3)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value1, value2, value3);
@@ -351,7 +351,7 @@ namespace etl
     void emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(stack_full));
 #endif
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value1, value2, value3, value4);
@@ -392,7 +392,7 @@ namespace etl
     void pop()
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(!empty(), ETL_ERROR(stack_empty));
+      ETL_ASSERT_CONTAINER(!empty(), ETL_ERROR(stack_empty));
 #endif
       p_buffer[top_index].~T();
       base_t::del_out();
@@ -35,6 +35,13 @@ SOFTWARE.
 #include "etl/nullptr.h"
 #include "etl/array.h"
 #include "etl/array_view.h"
+#include "etl/algorithm.h"
+#include "etl/static_assert.h"
+#include "etl/type_traits.h"
+
+#if defined(ETL_FSM_TRACE)
+  #include "etl/fsm_trace.h"
+#endif
 
 namespace etl
 {
@@ -88,11 +95,11 @@ namespace etl
     //*************************************************************************
     struct transition
     {
-      transition(const state_id_t current_state_id_,
-                 const event_id_t event_id_,
-                 const state_id_t next_state_id_,
-                 void (TObject::* const action_)() = nullptr,
-                 bool (TObject::* const guard_)()  = nullptr)
+      ETL_CONSTEXPR transition(const state_id_t current_state_id_,
+                               const event_id_t event_id_,
+                               const state_id_t next_state_id_,
+                               void (TObject::* const action_)() = nullptr,
+                               bool (TObject::* const guard_)()  = nullptr)
         : from_any_state(false),
           current_state_id(current_state_id_),
           event_id(event_id_),
@@ -102,10 +109,10 @@ namespace etl
       {
       }
 
-      transition(const event_id_t event_id_,
-                 const state_id_t next_state_id_,
-                 void (TObject::* const action_)() = nullptr,
-                 bool (TObject::* const guard_)()  = nullptr)
+      ETL_CONSTEXPR transition(const event_id_t event_id_,
+                               const state_id_t next_state_id_,
+                               void (TObject::* const action_)() = nullptr,
+                               bool (TObject::* const guard_)()  = nullptr)
           : from_any_state(true),
             current_state_id(0),
             event_id(event_id_),
@@ -128,9 +135,9 @@ namespace etl
     //*************************************************************************
     struct state
     {
-      state(const state_id_t state_id_,
-            void (TObject::* const on_entry_)() = nullptr,
-            void (TObject::* const on_exit_)()  = nullptr)
+      ETL_CONSTEXPR state(const state_id_t state_id_,
+                          void (TObject::* const on_entry_)() = nullptr,
+                          void (TObject::* const on_exit_)()  = nullptr)
         : state_id(state_id_),
           on_entry(on_entry_),
           on_exit(on_exit_)
@@ -156,7 +163,16 @@ namespace etl
       : istate_chart(state_id_),
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
+        p_transition_index(nullptr),
+        transition_index_capacity(0U),
+        p_state_index(nullptr),
+        state_index_capacity(0U),
+        transitions_indexed(false),
+        states_indexed(false),
         started(false)
+#if defined(ETL_FSM_TRACE)
+        , p_trace(nullptr)
+#endif
     {
     }
 
@@ -179,7 +195,16 @@ namespace etl
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
         state_table(state_table_begin_, state_table_end_),
+        p_transition_index(nullptr),
+        transition_index_capacity(0U),
+        p_state_index(nullptr),
+        state_index_capacity(0U),
+        transitions_indexed(false),
+        states_indexed(false),
         started(false)
+#if defined(ETL_FSM_TRACE)
+        , p_trace(nullptr)
+#endif
     {
     }
 
@@ -192,6 +217,7 @@ namespace etl
                               const transition* transition_table_end_)
     {
       transition_table.assign(transition_table_begin_, transition_table_end_);
+      build_transition_index();
     }
 
     //*************************************************************************
@@ -203,6 +229,7 @@ namespace etl
                          const state* state_table_end_)
     {
       state_table.assign(state_table_begin_, state_table_end_);
+      build_state_index();
     }
 
     //*************************************************************************
@@ -223,9 +250,43 @@ namespace etl
       return object;
     }
 
+#if defined(ETL_FSM_TRACE)
     //*************************************************************************
-    /// Gets the current state id.
-    /// \return The current state id.
+    /// Sets the trace that records state transitions.
+    //*************************************************************************
+    void set_trace(etl::ifsm_trace& trace)
+    {
+      p_trace = &trace;
+    }
+
+    //*************************************************************************
+    /// Stops recording state transitions.
+    //*************************************************************************
+    void clear_trace()
+    {
+      p_trace = nullptr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Are the transitions looked up through an index?
+    //*************************************************************************
+    bool is_transition_table_indexed() const
+    {
+      return transitions_indexed;
+    }
+
+    //*************************************************************************
+    /// Are the states looked up through an index?
+    //*************************************************************************
+    bool is_state_table_indexed() const
+    {
+      return states_indexed;
+    }
+
+    //*************************************************************************
+    /// Finds the state item for a state id.
+    /// \return A pointer to the state item, or the end of the state table.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
@@ -233,6 +294,14 @@ namespace etl
       {
         return state_table.end();
       }
+      else if (states_indexed)
+      {
+        const state** first = p_state_index;
+        const state** last  = p_state_index + state_table.size();
+        const state** itr   = etl::lower_bound(first, last, state_id, compare_state_id());
+
+        return ((itr != last) && ((*itr)->state_id == state_id)) ? *itr : state_table.end();
+      }
       else
       {
         return etl::find_if(state_table.begin(),
@@ -274,70 +343,293 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table.begin();
+#if defined(ETL_FSM_TRACE)
+        const etl::fsm_trace_timestamp_t start = (p_trace != nullptr) ? p_trace->timestamp() : 0;
+        const state_id_t                 state_from = current_state_id;
+#endif
 
-        // Keep looping until we execute a transition or reach the end of the table.
-        while (t != transition_table.end())
+        if (transitions_indexed)
+        {
+          process_event_indexed(event_id);
+        }
+        else
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t,
-                              transition_table.end(),
-                              is_transition(event_id, current_state_id));
+          process_event_linear(event_id);
+        }
+
+#if defined(ETL_FSM_TRACE)
+        if ((p_trace != nullptr) && (current_state_id != state_from))
+        {
+          p_trace->record(state_from, current_state_id, event_id, start);
+        }
+#endif
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Sets the storage used to index the tables and builds the indexes.
+    /// A table larger than its index storage is searched linearly.
+    /// \param p_transition_index_        Storage for the transition index.
+    /// \param transition_index_capacity_ The capacity of the transition index.
+    /// \param p_state_index_             Storage for the state index.
+    /// \param state_index_capacity_      The capacity of the state index.
+    //*************************************************************************
+    void set_index_storage(const transition** p_transition_index_,
+                           size_t             transition_index_capacity_,
+                           const state**      p_state_index_,
+                           size_t             state_index_capacity_)
+    {
+      p_transition_index        = p_transition_index_;
+      transition_index_capacity = transition_index_capacity_;
+      p_state_index             = p_state_index_;
+      state_index_capacity      = state_index_capacity_;
+
+      build_transition_index();
+      build_state_index();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Scans the transition table in order.
+    //*************************************************************************
+    void process_event_linear(const event_id_t event_id)
+    {
+      const transition* t = transition_table.begin();
 
-          // Found an entry?
-          if (t != transition_table.end())
+      // Keep looping until we execute a transition or reach the end of the table.
+      while (t != transition_table.end())
+      {
+        // Scan the transition table from the latest position.
+        t = etl::find_if(t,
+                         transition_table.end(),
+                         is_transition(event_id, current_state_id));
+
+        // Found an entry?
+        if (t != transition_table.end())
+        {
+          if (execute_transition(*t))
           {
-            // Shall we execute the transition?
-            if ((t->guard == nullptr) || ((object.*t->guard)()))
-            {
-              // Remember the next state.
-              next_state_id = t->next_state_id;
-
-              // Shall we execute the action?
-              if (t->action != nullptr)
-              {
-                (object.*t->action)();
-              }
-
-              // Changing state?
-              if (current_state_id != next_state_id)
-              {
-                const state* s;
-
-                // See if we have a state item for the current state.
-                s = find_state(current_state_id);
-
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table.end()) && (s->on_exit != nullptr))
-                {
-                  (object.*(s->on_exit))();
-                }
-
-                current_state_id = next_state_id;
-
-                // See if we have a state item for the next state.
-                s = find_state(next_state_id);
-
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table.end()) && (s->on_entry != nullptr))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
-
-              t = transition_table.end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
+            t = transition_table.end();
+          }
+          else
+          {
+            // Start the search from the next item in the table.
+            ++t;
           }
         }
       }
     }
 
-  private:
+    //*************************************************************************
+    /// Searches the index for the transitions from the current state and the
+    /// transitions from any state, and tries them in table order.
+    //*************************************************************************
+    void process_event_indexed(const event_id_t event_id)
+    {
+      const transition_key state_key(event_id, false, current_state_id);
+      const transition_key any_key(event_id, true, 0);
+
+      const transition** first = p_transition_index;
+      const transition** last  = p_transition_index + transition_table.size();
+
+      const transition** s = etl::lower_bound(first, last, state_key, compare_transition_key());
+      const transition** a = etl::lower_bound(first, last, any_key, compare_transition_key());
+
+      bool more_s = (s != last) && state_key.matches(**s);
+      bool more_a = (a != last) && any_key.matches(**a);
+
+      while (more_s || more_a)
+      {
+        const transition* t;
+
+        // Take whichever candidate comes first in the transition table.
+        if (more_s && (!more_a || (*s < *a)))
+        {
+          t = *s++;
+          more_s = (s != last) && state_key.matches(**s);
+        }
+        else
+        {
+          t = *a++;
+          more_a = (a != last) && any_key.matches(**a);
+        }
+
+        if (execute_transition(*t))
+        {
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Executes the transition if its guard allows.
+    /// \return <b>true</b> if the transition was executed.
+    //*************************************************************************
+    bool execute_transition(const transition& t)
+    {
+      // Shall we execute the transition?
+      if ((t.guard == nullptr) || ((object.*t.guard)()))
+      {
+        // Remember the next state.
+        next_state_id = t.next_state_id;
+
+        // Shall we execute the action?
+        if (t.action != nullptr)
+        {
+          (object.*t.action)();
+        }
+
+        // Changing state?
+        if (current_state_id != next_state_id)
+        {
+          const state* s;
+
+          // See if we have a state item for the current state.
+          s = find_state(current_state_id);
+
+          // If the current state has an 'on_exit' then call it.
+          if ((s != state_table.end()) && (s->on_exit != nullptr))
+          {
+            (object.*(s->on_exit))();
+          }
+
+          current_state_id = next_state_id;
+
+          // See if we have a state item for the next state.
+          s = find_state(next_state_id);
+
+          // If the new state has an 'on_entry' then call it.
+          if ((s != state_table.end()) && (s->on_entry != nullptr))
+          {
+            (object.*(s->on_entry))();
+          }
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Sorts the transitions by event, source and table position.
+    //*************************************************************************
+    void build_transition_index()
+    {
+      transitions_indexed = (p_transition_index != nullptr) && (transition_table.size() <= transition_index_capacity);
+
+      if (transitions_indexed)
+      {
+        for (size_t i = 0U; i < transition_table.size(); ++i)
+        {
+          p_transition_index[i] = &transition_table[i];
+        }
+
+        etl::sort(p_transition_index, p_transition_index + transition_table.size(), compare_transition());
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the states by id and table position.
+    //*************************************************************************
+    void build_state_index()
+    {
+      states_indexed = (p_state_index != nullptr) && (state_table.size() <= state_index_capacity);
+
+      if (states_indexed)
+      {
+        for (size_t i = 0U; i < state_table.size(); ++i)
+        {
+          p_state_index[i] = &state_table[i];
+        }
+
+        etl::sort(p_state_index, p_state_index + state_table.size(), compare_state());
+      }
+    }
+
+    //*************************************************************************
+    struct transition_key
+    {
+      transition_key(event_id_t event_id_, bool from_any_state_, state_id_t state_id_)
+        : event_id(event_id_),
+          from_any_state(from_any_state_),
+          state_id(state_id_)
+      {
+      }
+
+      bool matches(const transition& t) const
+      {
+        return (t.event_id == event_id) && (t.from_any_state == from_any_state) && (from_any_state || (t.current_state_id == state_id));
+      }
+
+      const event_id_t event_id;
+      const bool       from_any_state;
+      const state_id_t state_id;
+    };
+
+    //*************************************************************************
+    struct compare_transition_key
+    {
+      bool operator()(const transition* t, const transition_key& key) const
+      {
+        if (t->event_id != key.event_id)
+        {
+          return t->event_id < key.event_id;
+        }
+
+        if (t->from_any_state != key.from_any_state)
+        {
+          return !t->from_any_state;
+        }
+
+        return !key.from_any_state && (t->current_state_id < key.state_id);
+      }
+    };
+
+    //*************************************************************************
+    struct compare_transition
+    {
+      bool operator()(const transition* lhs, const transition* rhs) const
+      {
+        if (lhs->event_id != rhs->event_id)
+        {
+          return lhs->event_id < rhs->event_id;
+        }
+
+        if (lhs->from_any_state != rhs->from_any_state)
+        {
+          return !lhs->from_any_state;
+        }
+
+        if (!lhs->from_any_state && (lhs->current_state_id != rhs->current_state_id))
+        {
+          return lhs->current_state_id < rhs->current_state_id;
+        }
+
+        return lhs < rhs;
+      }
+    };
+
+    //*************************************************************************
+    struct compare_state_id
+    {
+      bool operator()(const state* s, state_id_t state_id) const
+      {
+        return s->state_id < state_id;
+      }
+    };
+
+    //*************************************************************************
+    struct compare_state
+    {
+      bool operator()(const state* lhs, const state* rhs) const
+      {
+        return (lhs->state_id != rhs->state_id) ? (lhs->state_id < rhs->state_id) : (lhs < rhs);
+      }
+    };
 
     //*************************************************************************
     struct is_transition
@@ -377,11 +669,282 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator =(const state_chart&) ETL_DELETE;
 
-    TObject&                                object;           ///< The object that supplies guard and action member functions.
-    const etl::array_view<const transition> transition_table; ///< The table of transitions.
-    etl::array_view<const state>            state_table;      ///< The table of states.
-    bool                                    started;          ///< Set if the state chart has been started.
+    TObject&                          object;                    ///< The object that supplies guard and action member functions.
+    etl::array_view<const transition> transition_table;          ///< The table of transitions.
+    etl::array_view<const state>      state_table;               ///< The table of states.
+    const transition**                p_transition_index;        ///< The transitions sorted by event and state.
+    size_t                            transition_index_capacity; ///< The capacity of the transition index.
+    const state**                     p_state_index;             ///< The states sorted by id.
+    size_t                            state_index_capacity;      ///< The capacity of the state index.
+    bool                              transitions_indexed;       ///< Set if the transition index is in use.
+    bool                              states_indexed;            ///< Set if the state index is in use.
+    bool                              started;                   ///< Set if the state chart has been started.
+#if defined(ETL_FSM_TRACE)
+    etl::ifsm_trace*                  p_trace;                   ///< The trace of state transitions, if any.
+#endif
   };
+
+  //***************************************************************************
+  /// Finite State Machine that indexes its tables.
+  /// Events are found by binary search, rather than by scanning the table.
+  /// The first transition in table order that passes its guard is executed,
+  /// as with etl::state_chart.
+  /// \tparam MAX_TRANSITIONS The maximum size of the transition table.
+  /// \tparam MAX_STATES      The maximum size of the state table.
+  //***************************************************************************
+  template <typename TObject, const size_t MAX_TRANSITIONS, const size_t MAX_STATES>
+  class indexed_state_chart : public etl::state_chart<TObject>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_TRANSITIONS > 0U), "Zero transitions");
+    ETL_STATIC_ASSERT((MAX_STATES > 0U), "Zero states");
+
+    typedef typename etl::state_chart<TObject>::transition transition;
+    typedef typename etl::state_chart<TObject>::state      state;
+    typedef typename etl::state_chart<TObject>::state_id_t state_id_t;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    indexed_state_chart(TObject& object_,
+                        const transition* transition_table_begin_,
+                        const transition* transition_table_end_,
+                        const state_id_t state_id_)
+      : etl::state_chart<TObject>(object_, transition_table_begin_, transition_table_end_, state_id_)
+    {
+      this->set_index_storage(transition_index, MAX_TRANSITIONS, state_index, MAX_STATES);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    indexed_state_chart(TObject& object_,
+                        const transition* transition_table_begin_,
+                        const transition* transition_table_end_,
+                        const state* state_table_begin_,
+                        const state* state_table_end_,
+                        const state_id_t state_id_)
+      : etl::state_chart<TObject>(object_, transition_table_begin_, transition_table_end_, state_table_begin_, state_table_end_, state_id_)
+    {
+      this->set_index_storage(transition_index, MAX_TRANSITIONS, state_index, MAX_STATES);
+    }
+
+  private:
+
+    const transition* transition_index[MAX_TRANSITIONS];
+    const state*      state_index[MAX_STATES];
+  };
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Finite State Machine with compile time tables.
+  /// The tables are template parameters and must be constexpr arrays of
+  /// etl::state_chart<TObject>::transition and etl::state_chart<TObject>::state,
+  /// so they may be placed in read only memory.
+  /// The tables are walked by template recursion, so the compiler sees each
+  /// guard, action, on_entry and on_exit as a constant and may inline them.
+  /// There are no virtual functions.
+  /// The first transition in table order that passes its guard is executed,
+  /// as with etl::state_chart.
+  ///\code
+  /// constexpr etl::state_chart<Motor>::transition transitions[] = { ... };
+  /// constexpr etl::state_chart<Motor>::state      states[]      = { ... };
+  ///
+  /// etl::state_chart_ct<Motor, transitions, ETL_ARRAY_SIZE(transitions), states, ETL_ARRAY_SIZE(states)> chart(motor, IDLE);
+  ///\endcode
+  //***************************************************************************
+  template <typename TObject,
+            const typename etl::state_chart<TObject>::transition* TRANSITIONS,
+            const size_t N_TRANSITIONS,
+            const typename etl::state_chart<TObject>::state* STATES = nullptr,
+            const size_t N_STATES = 0U>
+  class state_chart_ct
+  {
+  public:
+
+    typedef etl::istate_chart::state_id_t                  state_id_t;
+    typedef etl::istate_chart::event_id_t                  event_id_t;
+    typedef typename etl::state_chart<TObject>::transition transition;
+    typedef typename etl::state_chart<TObject>::state      state;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_   A reference to the implementation object.
+    /// \param state_id_ The initial state id.
+    //*************************************************************************
+    state_chart_ct(TObject& object_, const state_id_t state_id_)
+      : object(object_),
+        current_state_id(state_id_),
+        started(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the current state id.
+    /// \return The current state id.
+    //*************************************************************************
+    state_id_t get_state_id() const
+    {
+      return current_state_id;
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the implementation object.
+    /// \return Reference to the implementation object.
+    //*************************************************************************
+    TObject& get_object()
+    {
+      return object;
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the implementation object.
+    /// \return Const reference to the implementation object.
+    //*************************************************************************
+    const TObject& get_object() const
+    {
+      return object;
+    }
+
+    //*************************************************************************
+    ///
+    //*************************************************************************
+    void start(const bool on_entry_initial = true)
+    {
+      if (!started)
+      {
+        if (on_entry_initial)
+        {
+          enter_state(current_state_id, etl::integral_constant<size_t, 0U>());
+        }
+
+        started = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Processes the specified event.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    void process_event(const event_id_t event_id)
+    {
+      if (started)
+      {
+        process_event(event_id, etl::integral_constant<size_t, 0U>());
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Tries transition I, then the ones that follow it.
+    //*************************************************************************
+    template <size_t I>
+    void process_event(const event_id_t event_id, etl::integral_constant<size_t, I>)
+    {
+      const transition& t = TRANSITIONS[I];
+
+      if ((t.event_id == event_id) &&
+          (t.from_any_state || (t.current_state_id == current_state_id)) &&
+          ((t.guard == nullptr) || (object.*t.guard)()))
+      {
+        const state_id_t next_state_id = t.next_state_id;
+
+        if (t.action != nullptr)
+        {
+          (object.*t.action)();
+        }
+
+        if (current_state_id != next_state_id)
+        {
+          exit_state(current_state_id, etl::integral_constant<size_t, 0U>());
+          current_state_id = next_state_id;
+          enter_state(next_state_id, etl::integral_constant<size_t, 0U>());
+        }
+      }
+      else
+      {
+        process_event(event_id, etl::integral_constant<size_t, I + 1U>());
+      }
+    }
+
+    //*************************************************************************
+    void process_event(const event_id_t, etl::integral_constant<size_t, N_TRANSITIONS>)
+    {
+    }
+
+    //*************************************************************************
+    /// Calls the 'on_entry' of the first state item with the id.
+    //*************************************************************************
+    template <size_t I>
+    void enter_state(const state_id_t state_id, etl::integral_constant<size_t, I>)
+    {
+      const state& s = STATES[I];
+
+      if (s.state_id == state_id)
+      {
+        if (s.on_entry != nullptr)
+        {
+          (object.*s.on_entry)();
+        }
+      }
+      else
+      {
+        enter_state(state_id, etl::integral_constant<size_t, I + 1U>());
+      }
+    }
+
+    //*************************************************************************
+    void enter_state(const state_id_t, etl::integral_constant<size_t, N_STATES>)
+    {
+    }
+
+    //*************************************************************************
+    /// Calls the 'on_exit' of the first state item with the id.
+    //*************************************************************************
+    template <size_t I>
+    void exit_state(const state_id_t state_id, etl::integral_constant<size_t, I>)
+    {
+      const state& s = STATES[I];
+
+      if (s.state_id == state_id)
+      {
+        if (s.on_exit != nullptr)
+        {
+          (object.*s.on_exit)();
+        }
+      }
+      else
+      {
+        exit_state(state_id, etl::integral_constant<size_t, I + 1U>());
+      }
+    }
+
+    //*************************************************************************
+    void exit_state(const state_id_t, etl::integral_constant<size_t, N_STATES>)
+    {
+    }
+
+    // Disabled
+    state_chart_ct(const state_chart_ct&) ETL_DELETE;
+    state_chart_ct& operator =(const state_chart_ct&) ETL_DELETE;
+
+    TObject&   object;           ///< The object that supplies guard and action member functions.
+    state_id_t current_state_id; ///< The current state id.
+    bool       started;          ///< Set if the state chart has been started.
+  };
+#endif
 }
 
 #endif
@@ -0,0 +1,375 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_CI_INCLUDED
+#define ETL_STRING_CI_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "char_traits.h"
+#include "type_traits.h"
+#include "hash.h"
+#include "string_view.h"
+
+///\defgroup string_ci string_ci
+/// Case-insensitive comparison and hashing of text, folding the ASCII
+/// letters A to Z to lower case. Other characters are compared exactly.
+/// etl::hash_ci, etl::equal_to_ci and etl::less_ci accept any type with
+/// data() and size(), and may be used as the hash and key comparison of the
+/// unordered and sorted containers. etl::ci_char_traits gives
+/// case-insensitive string views.
+/// Byte sized text is folded eight bytes at a time in a 64 bit word. Define
+/// ETL_USE_SSE2 or ETL_USE_NEON in the profile to compare sixteen bytes at a
+/// time with SIMD instructions; they are only used when the compiler also
+/// targets that instruction set.
+///\code
+/// typedef etl::unordered_map<etl::string<16>, Handler, 32, 32, etl::hash_ci, etl::equal_to_ci> Headers;
+///\endcode
+///\ingroup string
+
+#if defined(ETL_USE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_STRING_CI_SSE2
+  #include <emmintrin.h>
+#elif defined(ETL_USE_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_STRING_CI_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_string_ci
+  {
+    //*************************************************************************
+    /// Folds an ASCII upper case letter to lower case.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR T to_lower(T c)
+    {
+      return ((c >= T('A')) && (c <= T('Z'))) ? T(c + (T('a') - T('A'))) : c;
+    }
+
+    //*************************************************************************
+    /// Folds the ASCII upper case letters in a word of characters to lower
+    /// case, all at once. Each character is a lane of LANE_BITS bits.
+    /// The low seven bits of each lane are offset so that bit seven is set
+    /// from 'A' and from past 'Z'; the lanes that differ are upper case
+    /// letters, unless a bit above the low seven is set.
+    //*************************************************************************
+    template <typename TWord, const size_t LANE_BITS>
+    ETL_CONSTEXPR14 TWord fold_word(TWord word)
+    {
+      const TWord LANE_MAX = TWord(~TWord(0)) >> ((sizeof(TWord) * CHAR_BIT) - LANE_BITS);
+      const TWord ONES     = TWord(~TWord(0)) / LANE_MAX;
+      const TWord LOW7     = ONES * 0x7FU;
+      const TWord BIT7     = ONES * 0x80U;
+      const TWord LOWS     = ONES * (LANE_MAX >> 1);
+      const TWord TOPS     = ONES * (LANE_MAX ^ (LANE_MAX >> 1));
+
+      // The top bit of each lane with a bit set above the low seven.
+      const TWord high      = word & ~LOW7;
+      const TWord non_ascii = (((high & LOWS) + LOWS) | high) & TOPS;
+
+      const TWord low   = word & LOW7;
+      const TWord ge_a  = low + (ONES * (0x80U - 'A'));
+      const TWord gt_z  = low + (ONES * (0x80U - 'Z' - 1U));
+      const TWord upper = (ge_a ^ gt_z) & BIT7 & ~(non_ascii >> (LANE_BITS - 8U));
+
+      return word | (upper >> 2);
+    }
+
+    //*************************************************************************
+    /// Folds the words of the string hash.
+    //*************************************************************************
+    template <typename TChar>
+    struct hash_fold
+    {
+      template <typename TWord>
+      ETL_CONSTEXPR14 TWord operator ()(TWord word) const
+      {
+        return fold_word<TWord, sizeof(TChar) * CHAR_BIT>(word);
+      }
+    };
+
+#if defined(ETL_STRING_CI_SSE2)
+    //*************************************************************************
+    /// Folds sixteen bytes.
+    //*************************************************************************
+    inline __m128i fold_block(__m128i bytes)
+    {
+      // Bytes from 0x80 are negative, so are never upper case.
+      const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)),
+                                          _mm_cmplt_epi8(bytes, _mm_set1_epi8('Z' + 1)));
+
+      return _mm_or_si128(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+    }
+#elif defined(ETL_STRING_CI_NEON)
+    //*************************************************************************
+    /// Folds sixteen bytes.
+    //*************************************************************************
+    inline uint8x16_t fold_block(uint8x16_t bytes)
+    {
+      const uint8x16_t upper = vandq_u8(vcgeq_u8(bytes, vdupq_n_u8('A')),
+                                        vcleq_u8(bytes, vdupq_n_u8('Z')));
+
+      return vorrq_u8(bytes, vandq_u8(upper, vdupq_n_u8(0x20)));
+    }
+#endif
+
+    //*************************************************************************
+    /// The length of the leading blocks of bytes that are equal, ignoring case.
+    /// The rest is compared one character at a time.
+    //*************************************************************************
+    inline size_t equal_blocks(const unsigned char* s1, const unsigned char* s2, size_t count)
+    {
+      size_t i = 0U;
+
+#if defined(ETL_STRING_CI_SSE2)
+      for (; (count - i) >= 16U; i += 16U)
+      {
+        const __m128i a = fold_block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s1 + i)));
+        const __m128i b = fold_block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s2 + i)));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF)
+        {
+          return i;
+        }
+      }
+#elif defined(ETL_STRING_CI_NEON)
+      for (; (count - i) >= 16U; i += 16U)
+      {
+        const uint64x2_t equal = vreinterpretq_u64_u8(vceqq_u8(fold_block(vld1q_u8(s1 + i)),
+                                                               fold_block(vld1q_u8(s2 + i))));
+
+        if ((vgetq_lane_u64(equal, 0) & vgetq_lane_u64(equal, 1)) != 0xFFFFFFFFFFFFFFFFULL)
+        {
+          return i;
+        }
+      }
+#endif
+
+      for (; (count - i) >= 8U; i += 8U)
+      {
+        uint64_t a;
+        uint64_t b;
+        memcpy(&a, s1 + i, sizeof(a));
+        memcpy(&b, s2 + i, sizeof(b));
+
+        if ((a != b) && (fold_word<uint64_t, 8U>(a) != fold_word<uint64_t, 8U>(b)))
+        {
+          return i;
+        }
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    size_t equal_blocks(const T*, const T*, size_t, etl::false_type)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    size_t equal_blocks(const T* s1, const T* s2, size_t count, etl::true_type)
+    {
+      return equal_blocks(reinterpret_cast<const unsigned char*>(s1), reinterpret_cast<const unsigned char*>(s2), count);
+    }
+
+    //*************************************************************************
+    /// Compares count characters, ignoring case.
+    //*************************************************************************
+    template <typename T>
+    int compare(const T* s1, const T* s2, size_t count)
+    {
+      size_t i = equal_blocks(s1, s2, count, etl::integral_constant<bool, sizeof(T) == 1U>());
+
+      for (; i < count; ++i)
+      {
+        const T c1 = to_lower(s1[i]);
+        const T c2 = to_lower(s2[i]);
+
+        if (c1 < c2)
+        {
+          return -1;
+        }
+        else if (c2 < c1)
+        {
+          return 1;
+        }
+      }
+
+      return 0;
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Character traits that ignore the case of ASCII letters.
+  //***************************************************************************
+  template <typename T>
+  struct ci_char_traits : public etl::char_traits<T>
+  {
+    typedef typename etl::char_traits<T>::char_type char_type;
+
+    //*************************************************************************
+    static ETL_CONSTEXPR bool eq(char_type a, char_type b)
+    {
+      return private_string_ci::to_lower(a) == private_string_ci::to_lower(b);
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR bool lt(char_type a, char_type b)
+    {
+      return private_string_ci::to_lower(a) < private_string_ci::to_lower(b);
+    }
+
+    //*************************************************************************
+    static int compare(const char_type* s1, const char_type* s2, size_t count)
+    {
+      return private_string_ci::compare(s1, s2, count);
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 const char_type* find(const char_type* p, size_t count, const char_type& ch)
+    {
+      const char_type c = private_string_ci::to_lower(ch);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (private_string_ci::to_lower(*p) == c)
+        {
+          return p;
+        }
+
+        ++p;
+      }
+
+      return 0;
+    }
+  };
+
+  typedef etl::basic_string_view<char, etl::ci_char_traits<char> >         ci_string_view;
+  typedef etl::basic_string_view<wchar_t, etl::ci_char_traits<wchar_t> >   ci_wstring_view;
+  typedef etl::basic_string_view<char16_t, etl::ci_char_traits<char16_t> > ci_u16string_view;
+  typedef etl::basic_string_view<char32_t, etl::ci_char_traits<char32_t> > ci_u32string_view;
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Compares two texts, ignoring case.
+  /// Returns a negative value, zero or a positive value, as for compare().
+  //***************************************************************************
+  template <typename TText1, typename TText2>
+  int compare_ci(const TText1& lhs, const TText2& rhs)
+  {
+    const int result = private_string_ci::compare(lhs.data(), rhs.data(), etl::min(lhs.size(), rhs.size()));
+
+    if (result != 0)
+    {
+      return result;
+    }
+
+    return (lhs.size() == rhs.size()) ? 0 : ((lhs.size() < rhs.size()) ? -1 : 1);
+  }
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Checks whether two texts are equal, ignoring case.
+  //***************************************************************************
+  template <typename TText1, typename TText2>
+  bool equal_ci(const TText1& lhs, const TText2& rhs)
+  {
+    return (lhs.size() == rhs.size()) && (private_string_ci::compare(lhs.data(), rhs.data(), lhs.size()) == 0);
+  }
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Hashes a sequence of characters, ignoring case.
+  /// Texts that are equal ignoring case have the same hash.
+  //***************************************************************************
+  template <typename TChar>
+  ETL_CONSTEXPR14 size_t hash_string_ci(const TChar* text, size_t length)
+  {
+    return etl::private_hash::string_hash(text, length, etl::private_hash::string_hash_is_64(), private_string_ci::hash_fold<TChar>());
+  }
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Transparent hash for character containers, ignoring case.
+  //***************************************************************************
+  struct hash_ci
+  {
+    typedef void is_transparent;
+
+    template <typename TText>
+    ETL_CONSTEXPR14 size_t operator ()(const TText& text) const
+    {
+      return etl::hash_string_ci(text.data(), text.size());
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Transparent equality for character containers, ignoring case.
+  //***************************************************************************
+  struct equal_to_ci
+  {
+    typedef void is_transparent;
+
+    template <typename TText1, typename TText2>
+    bool operator ()(const TText1& lhs, const TText2& rhs) const
+    {
+      return etl::equal_ci(lhs, rhs);
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string_ci
+  /// Transparent ordering for character containers, ignoring case.
+  //***************************************************************************
+  struct less_ci
+  {
+    typedef void is_transparent;
+
+    template <typename TText1, typename TText2>
+    bool operator ()(const TText1& lhs, const TText2& rhs) const
+    {
+      return etl::compare_ci(lhs, rhs) < 0;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,445 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_CONCAT_INCLUDED
+#define ETL_STRING_CONCAT_INCLUDED
+
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "char_traits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "basic_string.h"
+#include "string_view.h"
+
+///\defgroup string_concat string_concat
+/// Concatenation of strings, string views, text and characters without
+/// temporary strings. etl::concat(a, b, c) and a + b + c build an expression
+/// that refers to the pieces. The total length is known before the copy, so
+/// the destination checks its capacity once and copies every piece in a
+/// single pass.
+/// The expression refers to its pieces, so use it in the statement that
+/// creates it. A piece may be the destination string itself.
+///\code
+/// etl::string<128> line = etl::concat(level, ": ", message);
+/// line += " [" + source + ']';
+///\endcode
+///\ingroup string
+
+namespace etl
+{
+  namespace private_string_concat
+  {
+    //*************************************************************************
+    /// The text of one piece of the expression.
+    //*************************************************************************
+    template <typename T>
+    struct piece
+    {
+      const T* p_text;
+      size_t   length;
+      bool     truncated; ///< The piece is a truncated string.
+    };
+
+    //*************************************************************************
+    template <typename T>
+    piece<T> make_piece(const etl::ibasic_string<T>& text)
+    {
+      piece<T> p = { text.data(), text.size(), (text.truncated() != 0U) };
+      return p;
+    }
+
+    //*************************************************************************
+    template <typename T, typename TTraits>
+    piece<T> make_piece(const etl::basic_string_view<T, TTraits>& text)
+    {
+      piece<T> p = { text.data(), text.size(), false };
+      return p;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    piece<T> make_piece(const T* text)
+    {
+      piece<T> p = { text, etl::char_traits<T>::length(text), false };
+      return p;
+    }
+
+    //*************************************************************************
+    /// A single character.
+    /// It must be exactly T, as a converted value would be a temporary.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    typename etl::enable_if<etl::is_same<T, TChar>::value, piece<T> >::type
+      make_piece(const TChar& c)
+    {
+      piece<T> p = { &c, 1U, false };
+      return p;
+    }
+
+    //*************************************************************************
+    /// The character type of the first piece of etl::concat.
+    //*************************************************************************
+    template <typename TFirst>
+    struct char_type
+    {
+      typedef typename TFirst::value_type type;
+    };
+
+    template <typename T>
+    struct char_type<T*>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+
+    template <typename T>
+    struct char_type<T* const>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+
+    template <typename T, const size_t N>
+    struct char_type<T[N]>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+
+    template <typename T, const size_t N>
+    struct char_type<const T[N]>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup string_concat
+  /// The concatenation of N pieces of text.
+  /// Assign it to, construct or append it to a string.
+  ///\tparam T The character type.
+  ///\tparam N The number of pieces.
+  //***************************************************************************
+  template <typename T, const size_t N>
+  class basic_string_concat
+  {
+  public:
+
+    typedef T      value_type;
+    typedef size_t size_type;
+
+    typedef private_string_concat::piece<T> piece_type;
+
+    //*************************************************************************
+    /// Constructor, from the first piece.
+    //*************************************************************************
+    explicit basic_string_concat(const piece_type& first)
+      : total(first.length),
+        is_truncated(first.truncated)
+    {
+      ETL_STATIC_ASSERT(N == 1U, "Only the first piece may be used alone");
+
+      pieces[0] = first;
+    }
+
+    //*************************************************************************
+    /// Constructor, from the previous pieces and the next piece.
+    //*************************************************************************
+    basic_string_concat(const basic_string_concat<T, N - 1U>& previous, const piece_type& next)
+      : total(previous.total + next.length),
+        is_truncated(previous.is_truncated || next.truncated)
+    {
+      for (size_t i = 0U; i < (N - 1U); ++i)
+      {
+        pieces[i] = previous.pieces[i];
+      }
+
+      pieces[N - 1U] = next;
+    }
+
+    //*************************************************************************
+    /// The total length of the pieces.
+    //*************************************************************************
+    size_t size() const
+    {
+      return total;
+    }
+
+    //*************************************************************************
+    /// True if a piece is a truncated string.
+    //*************************************************************************
+    bool truncated() const
+    {
+      return is_truncated;
+    }
+
+    //*************************************************************************
+    /// Copies the pieces to p_destination, up to max_length characters.
+    /// The pieces are copied from the last, so that a piece that is the
+    /// destination string is read before the copies before it overwrite it.
+    /// No terminator is written.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_t copy(T* p_destination, size_t max_length) const
+    {
+      size_t offset = total;
+
+      for (size_t i = N; i > 0U; --i)
+      {
+        const piece_type& p = pieces[i - 1U];
+
+        offset -= p.length;
+
+        if (offset < max_length)
+        {
+          const size_t length = etl::min(p.length, max_length - offset);
+
+          memmove(p_destination + offset, p.p_text, length * sizeof(T));
+        }
+      }
+
+      return etl::min(total, max_length);
+    }
+
+  private:
+
+    template <typename U, const size_t M>
+    friend class basic_string_concat;
+
+    piece_type pieces[N];
+    size_t     total;
+    bool       is_truncated;
+  };
+
+  //***************************************************************************
+  /// Concatenation operators.
+  ///\ingroup string_concat
+  //***************************************************************************
+  template <typename T>
+  basic_string_concat<T, 2U> operator +(const etl::ibasic_string<T>& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const etl::ibasic_string<T>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T>
+  basic_string_concat<T, 2U> operator +(const etl::ibasic_string<T>& lhs, const T* rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T>
+  basic_string_concat<T, 2U> operator +(const etl::ibasic_string<T>& lhs, const T& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const etl::basic_string_view<T, TTraits>& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const etl::basic_string_view<T, TTraits>& lhs, const T* rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const etl::basic_string_view<T, TTraits>& lhs, const T& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T>
+  basic_string_concat<T, 2U> operator +(const T* lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const T* lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T>
+  basic_string_concat<T, 2U> operator +(const T& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, typename TTraits>
+  basic_string_concat<T, 2U> operator +(const T& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(lhs)), private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, const size_t N>
+  basic_string_concat<T, N + 1U> operator +(const basic_string_concat<T, N>& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return basic_string_concat<T, N + 1U>(lhs, private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, const size_t N, typename TTraits>
+  basic_string_concat<T, N + 1U> operator +(const basic_string_concat<T, N>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return basic_string_concat<T, N + 1U>(lhs, private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, const size_t N>
+  basic_string_concat<T, N + 1U> operator +(const basic_string_concat<T, N>& lhs, const T* rhs)
+  {
+    return basic_string_concat<T, N + 1U>(lhs, private_string_concat::make_piece<T>(rhs));
+  }
+
+  template <typename T, const size_t N>
+  basic_string_concat<T, N + 1U> operator +(const basic_string_concat<T, N>& lhs, const T& rhs)
+  {
+    return basic_string_concat<T, N + 1U>(lhs, private_string_concat::make_piece<T>(rhs));
+  }
+
+#if ETL_CPP11_SUPPORTED
+  namespace private_string_concat
+  {
+    //*************************************************************************
+    template <typename T, const size_t N>
+    basic_string_concat<T, N> chain(const basic_string_concat<T, N>& expression)
+    {
+      return expression;
+    }
+
+    //*************************************************************************
+    template <typename T, const size_t N, typename TNext, typename... TRest>
+    basic_string_concat<T, N + 1U + sizeof...(TRest)> chain(const basic_string_concat<T, N>& expression, const TNext& next, const TRest&... rest)
+    {
+      return chain(basic_string_concat<T, N + 1U>(expression, make_piece<T>(next)), rest...);
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup string_concat
+  /// Concatenates strings, string views, text and characters.
+  /// The first piece must be a string, string view or text.
+  //***************************************************************************
+  template <typename TFirst, typename... TRest>
+  basic_string_concat<typename private_string_concat::char_type<TFirst>::type, 1U + sizeof...(TRest)>
+    concat(const TFirst& first, const TRest&... rest)
+  {
+    typedef typename private_string_concat::char_type<TFirst>::type T;
+
+    return private_string_concat::chain(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(first)), rest...);
+  }
+#else
+  //***************************************************************************
+  ///\ingroup string_concat
+  /// Concatenates strings, string views, text and characters.
+  /// The first piece must be a string, string view or text.
+  //***************************************************************************
+  template <typename T1, typename T2>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 2U>
+    concat(const T1& t1, const T2& t2)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 2U>(basic_string_concat<T, 1U>(private_string_concat::make_piece<T>(t1)), private_string_concat::make_piece<T>(t2));
+  }
+
+  template <typename T1, typename T2, typename T3>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 3U>
+    concat(const T1& t1, const T2& t2, const T3& t3)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 3U>(etl::concat(t1, t2), private_string_concat::make_piece<T>(t3));
+  }
+
+  template <typename T1, typename T2, typename T3, typename T4>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 4U>
+    concat(const T1& t1, const T2& t2, const T3& t3, const T4& t4)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 4U>(etl::concat(t1, t2, t3), private_string_concat::make_piece<T>(t4));
+  }
+
+  template <typename T1, typename T2, typename T3, typename T4, typename T5>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 5U>
+    concat(const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 5U>(etl::concat(t1, t2, t3, t4), private_string_concat::make_piece<T>(t5));
+  }
+
+  template <typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 6U>
+    concat(const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 6U>(etl::concat(t1, t2, t3, t4, t5), private_string_concat::make_piece<T>(t6));
+  }
+
+  template <typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 7U>
+    concat(const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6, const T7& t7)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 7U>(etl::concat(t1, t2, t3, t4, t5, t6), private_string_concat::make_piece<T>(t7));
+  }
+
+  template <typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
+  basic_string_concat<typename private_string_concat::char_type<T1>::type, 8U>
+    concat(const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6, const T7& t7, const T8& t8)
+  {
+    typedef typename private_string_concat::char_type<T1>::type T;
+
+    return basic_string_concat<T, 8U>(etl::concat(t1, t2, t3, t4, t5, t6, t7), private_string_concat::make_piece<T>(t8));
+  }
+#endif
+}
+
+#endif
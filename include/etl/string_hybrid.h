@@ -0,0 +1,778 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_HYBRID_INCLUDED
+#define ETL_STRING_HYBRID_INCLUDED
+
+#include "platform.h"
+#include "basic_string.h"
+#include "cstring.h"
+#include "wstring.h"
+#include "u16string.h"
+#include "u32string.h"
+#include "pool.h"
+#include "memory.h"
+#include "algorithm.h"
+
+#include "private/minmax_push.h"
+
+///\defgroup string_hybrid string_hybrid
+/// Strings that keep short text inline and move to an overflow buffer.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base for strings that hold short text in an inline buffer and move
+  /// to an overflow buffer when the text will not fit.
+  /// The overflow buffer is either supplied by the caller or is a block taken
+  /// from an etl::ipool. No heap is used.
+  /// The string stays in the overflow buffer until shrink_to_fit is called.
+  /// If the overflow buffer is full, or the pool is empty, the string
+  /// truncates as normal.
+  ///\ingroup string_hybrid
+  //***************************************************************************
+  template <typename T>
+  class ibasic_string_overflow : public etl::ibasic_string<T>
+  {
+  public:
+
+    typedef typename etl::ibasic_string<T>::size_type size_type;
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the string is using its overflow buffer.
+    //*************************************************************************
+    bool is_overflowed() const
+    {
+      return this->data() != p_inline;
+    }
+
+    //*************************************************************************
+    /// Moves the string back to the inline buffer if the text will fit.
+    /// A block taken from the pool is released.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if (is_overflowed() && (this->size() <= inline_capacity))
+      {
+        T* p_old = this->data();
+
+        etl::copy_n(p_old, this->size() + 1U, p_inline);
+
+        if (this->is_secure())
+        {
+          etl::memory_clear_range(p_old, p_old + this->CAPACITY + 1U);
+        }
+
+        release_block();
+
+        this->repair_buffer(p_inline);
+        this->CAPACITY     = inline_capacity;
+        this->has_overflow = true;
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer supplied by the caller.
+    //*************************************************************************
+    ibasic_string_overflow(T* p_inline_, size_type inline_capacity_, T* p_overflow_, size_type overflow_capacity_)
+      : etl::ibasic_string<T>(p_inline_, inline_capacity_)
+      , p_inline(p_inline_)
+      , inline_capacity(inline_capacity_)
+      , p_overflow(p_overflow_)
+      , overflow_capacity(overflow_capacity_)
+      , p_pool(nullptr)
+      , p_block(nullptr)
+    {
+      this->has_overflow = (overflow_capacity > inline_capacity);
+      etl::private_basic_string::overflow_hook<T>::p_grow = &ibasic_string_overflow::grow_to_overflow;
+    }
+
+    //*************************************************************************
+    /// Constructor, with overflow blocks taken from a pool.
+    //*************************************************************************
+    ibasic_string_overflow(T* p_inline_, size_type inline_capacity_, etl::ipool& pool)
+      : etl::ibasic_string<T>(p_inline_, inline_capacity_)
+      , p_inline(p_inline_)
+      , inline_capacity(inline_capacity_)
+      , p_overflow(nullptr)
+      , overflow_capacity((pool.item_size() >= sizeof(T)) ? (pool.item_size() / sizeof(T)) - 1U : 0U)
+      , p_pool(&pool)
+      , p_block(nullptr)
+    {
+      this->has_overflow = (overflow_capacity > inline_capacity);
+      etl::private_basic_string::overflow_hook<T>::p_grow = &ibasic_string_overflow::grow_to_overflow;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The overflow buffer does not move.
+    //*************************************************************************
+    void repair_inline(T* p_inline_)
+    {
+      if (!is_overflowed())
+      {
+        this->repair_buffer(p_inline_);
+      }
+
+      p_inline = p_inline_;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STRINGS) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual
+#else
+  protected:
+#endif
+    ~ibasic_string_overflow()
+    {
+      if (is_overflowed())
+      {
+        if (this->is_secure())
+        {
+          etl::memory_clear_range(this->data(), this->data() + this->CAPACITY + 1U);
+        }
+
+        release_block();
+
+        // Leave the base destructor with the inline buffer.
+        this->repair_buffer(p_inline);
+        this->CAPACITY     = inline_capacity;
+        this->current_size = 0U;
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Called by etl::ibasic_string when the string needs more than its
+    /// capacity. Every overflow string of type T sets the same function.
+    //*************************************************************************
+    static bool grow_to_overflow(etl::ibasic_string<T>& text)
+    {
+      return static_cast<ibasic_string_overflow&>(text).move_to_overflow();
+    }
+
+    //*************************************************************************
+    /// Moves the text to the overflow buffer.
+    /// The inline buffer is left intact, so that a source range that refers to
+    /// the string itself is still valid.
+    ///\return <b>true</b> if the string moved.
+    //*************************************************************************
+    bool move_to_overflow()
+    {
+      T* p_new = p_overflow;
+
+      if (p_pool != nullptr)
+      {
+        void* p = nullptr;
+
+        if (p_pool->allocate_batch(&p, 1U) == 0U)
+        {
+          return false;
+        }
+
+        p_block = p;
+        p_new   = static_cast<T*>(p);
+      }
+
+      etl::copy_n(this->data(), this->size() + 1U, p_new);
+
+      this->repair_buffer(p_new);
+      this->CAPACITY     = overflow_capacity;
+      this->has_overflow = false;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns the pool block, if there is one.
+    //*************************************************************************
+    void release_block()
+    {
+      if (p_block != nullptr)
+      {
+        p_pool->release(p_block);
+        p_block = nullptr;
+      }
+    }
+
+    T*           p_inline;          ///< The inline buffer.
+    size_type    inline_capacity;   ///< The capacity of the inline buffer.
+    T*           p_overflow;        ///< The caller's overflow buffer, if there is one.
+    size_type    overflow_capacity; ///< The capacity of the overflow buffer.
+    etl::ipool*  p_pool;            ///< The pool of overflow blocks, if there is one.
+    void*        p_block;           ///< The block taken from the pool.
+
+    // Disable copy construction.
+    ibasic_string_overflow(const ibasic_string_overflow&);
+  };
+
+  //***************************************************************************
+  /// A string that holds up to MAX_INLINE_SIZE_ characters inline and moves to
+  /// an overflow buffer when the text will not fit.
+  /// The overflow buffer is supplied by the caller or is a block taken from an
+  /// etl::ipool, so strings need only be sized for the common case.
+  /// A pool block of N bytes holds a string of up to (N / sizeof(value_type)) - 1 characters.
+  /// The overflow buffer or pool must outlive the string.
+  ///\tparam MAX_INLINE_SIZE_ The maximum number of characters held inline.
+  ///\ingroup string_hybrid
+  //***************************************************************************
+  template <const size_t MAX_INLINE_SIZE_>
+  class string_hybrid : public etl::ibasic_string_overflow<char>
+  {
+  public:
+
+    typedef istring base_type;
+    typedef istring interface_type;
+
+    typedef istring::value_type value_type;
+
+    static const size_t MAX_INLINE_SIZE = MAX_INLINE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer supplied by the caller.
+    /// A buffer of N characters holds a string of up to N - 1 characters.
+    //*************************************************************************
+    string_hybrid(value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with overflow blocks taken from a pool.
+    //*************************************************************************
+    string_hybrid(etl::ipool& pool)
+      : etl::ibasic_string_overflow<char>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    string_hybrid(const value_type* text, value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    string_hybrid(const value_type* text, etl::ipool& pool)
+      : etl::ibasic_string_overflow<char>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    string_hybrid& operator = (const string_hybrid& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    string_hybrid& operator = (const istring& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    string_hybrid& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    string_hybrid& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The overflow buffer does not move.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      this->repair_inline(buffer);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Disable copy construction, as there is no overflow buffer to copy to.
+    //*************************************************************************
+    string_hybrid(const string_hybrid&);
+
+    value_type buffer[MAX_INLINE_SIZE + 1];
+  };
+
+  template <const size_t MAX_INLINE_SIZE_>
+  const size_t string_hybrid<MAX_INLINE_SIZE_>::MAX_INLINE_SIZE;
+
+  //***************************************************************************
+  /// A string that holds up to MAX_INLINE_SIZE_ characters inline and moves to
+  /// an overflow buffer when the text will not fit.
+  /// The overflow buffer is supplied by the caller or is a block taken from an
+  /// etl::ipool, so strings need only be sized for the common case.
+  /// A pool block of N bytes holds a string of up to (N / sizeof(value_type)) - 1 characters.
+  /// The overflow buffer or pool must outlive the string.
+  ///\tparam MAX_INLINE_SIZE_ The maximum number of characters held inline.
+  ///\ingroup string_hybrid
+  //***************************************************************************
+  template <const size_t MAX_INLINE_SIZE_>
+  class wstring_hybrid : public etl::ibasic_string_overflow<wchar_t>
+  {
+  public:
+
+    typedef iwstring base_type;
+    typedef iwstring interface_type;
+
+    typedef iwstring::value_type value_type;
+
+    static const size_t MAX_INLINE_SIZE = MAX_INLINE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer supplied by the caller.
+    /// A buffer of N characters holds a string of up to N - 1 characters.
+    //*************************************************************************
+    wstring_hybrid(value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<wchar_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with overflow blocks taken from a pool.
+    //*************************************************************************
+    wstring_hybrid(etl::ipool& pool)
+      : etl::ibasic_string_overflow<wchar_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    wstring_hybrid(const value_type* text, value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<wchar_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    wstring_hybrid(const value_type* text, etl::ipool& pool)
+      : etl::ibasic_string_overflow<wchar_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    wstring_hybrid& operator = (const wstring_hybrid& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    wstring_hybrid& operator = (const iwstring& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    wstring_hybrid& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    wstring_hybrid& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The overflow buffer does not move.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      this->repair_inline(buffer);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Disable copy construction, as there is no overflow buffer to copy to.
+    //*************************************************************************
+    wstring_hybrid(const wstring_hybrid&);
+
+    value_type buffer[MAX_INLINE_SIZE + 1];
+  };
+
+  template <const size_t MAX_INLINE_SIZE_>
+  const size_t wstring_hybrid<MAX_INLINE_SIZE_>::MAX_INLINE_SIZE;
+
+  //***************************************************************************
+  /// A string that holds up to MAX_INLINE_SIZE_ characters inline and moves to
+  /// an overflow buffer when the text will not fit.
+  /// The overflow buffer is supplied by the caller or is a block taken from an
+  /// etl::ipool, so strings need only be sized for the common case.
+  /// A pool block of N bytes holds a string of up to (N / sizeof(value_type)) - 1 characters.
+  /// The overflow buffer or pool must outlive the string.
+  ///\tparam MAX_INLINE_SIZE_ The maximum number of characters held inline.
+  ///\ingroup string_hybrid
+  //***************************************************************************
+  template <const size_t MAX_INLINE_SIZE_>
+  class u16string_hybrid : public etl::ibasic_string_overflow<char16_t>
+  {
+  public:
+
+    typedef iu16string base_type;
+    typedef iu16string interface_type;
+
+    typedef iu16string::value_type value_type;
+
+    static const size_t MAX_INLINE_SIZE = MAX_INLINE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer supplied by the caller.
+    /// A buffer of N characters holds a string of up to N - 1 characters.
+    //*************************************************************************
+    u16string_hybrid(value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char16_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with overflow blocks taken from a pool.
+    //*************************************************************************
+    u16string_hybrid(etl::ipool& pool)
+      : etl::ibasic_string_overflow<char16_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    u16string_hybrid(const value_type* text, value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char16_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    u16string_hybrid(const value_type* text, etl::ipool& pool)
+      : etl::ibasic_string_overflow<char16_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u16string_hybrid& operator = (const u16string_hybrid& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u16string_hybrid& operator = (const iu16string& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u16string_hybrid& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    u16string_hybrid& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The overflow buffer does not move.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      this->repair_inline(buffer);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Disable copy construction, as there is no overflow buffer to copy to.
+    //*************************************************************************
+    u16string_hybrid(const u16string_hybrid&);
+
+    value_type buffer[MAX_INLINE_SIZE + 1];
+  };
+
+  template <const size_t MAX_INLINE_SIZE_>
+  const size_t u16string_hybrid<MAX_INLINE_SIZE_>::MAX_INLINE_SIZE;
+
+  //***************************************************************************
+  /// A string that holds up to MAX_INLINE_SIZE_ characters inline and moves to
+  /// an overflow buffer when the text will not fit.
+  /// The overflow buffer is supplied by the caller or is a block taken from an
+  /// etl::ipool, so strings need only be sized for the common case.
+  /// A pool block of N bytes holds a string of up to (N / sizeof(value_type)) - 1 characters.
+  /// The overflow buffer or pool must outlive the string.
+  ///\tparam MAX_INLINE_SIZE_ The maximum number of characters held inline.
+  ///\ingroup string_hybrid
+  //***************************************************************************
+  template <const size_t MAX_INLINE_SIZE_>
+  class u32string_hybrid : public etl::ibasic_string_overflow<char32_t>
+  {
+  public:
+
+    typedef iu32string base_type;
+    typedef iu32string interface_type;
+
+    typedef iu32string::value_type value_type;
+
+    static const size_t MAX_INLINE_SIZE = MAX_INLINE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer supplied by the caller.
+    /// A buffer of N characters holds a string of up to N - 1 characters.
+    //*************************************************************************
+    u32string_hybrid(value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char32_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with overflow blocks taken from a pool.
+    //*************************************************************************
+    u32string_hybrid(etl::ipool& pool)
+      : etl::ibasic_string_overflow<char32_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    u32string_hybrid(const value_type* text, value_type* overflow_buffer, size_t overflow_buffer_size)
+      : etl::ibasic_string_overflow<char32_t>(buffer, MAX_INLINE_SIZE, overflow_buffer, overflow_buffer_size - 1U)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    u32string_hybrid(const value_type* text, etl::ipool& pool)
+      : etl::ibasic_string_overflow<char32_t>(buffer, MAX_INLINE_SIZE, pool)
+    {
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_hybrid& operator = (const u32string_hybrid& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_hybrid& operator = (const iu32string& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_hybrid& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    u32string_hybrid& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The overflow buffer does not move.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      this->repair_inline(buffer);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Disable copy construction, as there is no overflow buffer to copy to.
+    //*************************************************************************
+    u32string_hybrid(const u32string_hybrid&);
+
+    value_type buffer[MAX_INLINE_SIZE + 1];
+  };
+
+  template <const size_t MAX_INLINE_SIZE_>
+  const size_t u32string_hybrid<MAX_INLINE_SIZE_>::MAX_INLINE_SIZE;
+}
+
+#include "private/minmax_pop.h"
+
+#endif
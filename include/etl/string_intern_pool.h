@@ -0,0 +1,286 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_INTERN_POOL_INCLUDED
+#define ETL_STRING_INTERN_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "string_view.h"
+#include "hash.h"
+#include "power.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+///\defgroup string_intern_pool string_intern_pool
+/// Stores each distinct string once, and identifies it by a small integer.
+/// The characters are packed, null terminated, into a fixed size arena, and
+/// found through an open addressed hash table of ids, so equal strings may
+/// then be compared as ids. Strings are never removed, so ids and views
+/// stay valid until the pool is cleared.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// A pool of up to ENTRIES distinct strings, holding up to CHARS
+  /// characters including the terminating nulls.
+  ///\ingroup string_intern_pool
+  //***************************************************************************
+  template <const size_t CHARS, const size_t ENTRIES>
+  class string_intern_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(CHARS > 0U, "CHARS must be greater than zero");
+    ETL_STATIC_ASSERT(ENTRIES > 0U, "ENTRIES must be greater than zero");
+
+    typedef typename etl::smallest_uint_for_value<ENTRIES>::type id_type;
+    typedef typename etl::smallest_uint_for_value<CHARS>::type   offset_type;
+
+    static const size_t  MAX_CHARS   = CHARS;
+    static const size_t  MAX_ENTRIES = ENTRIES;
+    static const id_type npos        = etl::integral_limits<id_type>::max;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    string_intern_pool()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Returns the id of 'text', adding it if it is not already in the pool.
+    /// Returns npos if it must be added, and there is no room.
+    //*************************************************************************
+    id_type intern(etl::string_view text)
+    {
+      const uint32_t h    = hash_of(text);
+      size_t         slot = h & MASK;
+
+      while (table[slot] != 0U)
+      {
+        const id_type id = id_type(table[slot] - 1U);
+
+        if ((hashes[id] == h) && equal(id, text))
+        {
+          return id;
+        }
+
+        slot = (slot + 1U) & MASK;
+      }
+
+      if ((count == ENTRIES) || ((text.size() + 1U) > (CHARS - used)))
+      {
+        return npos;
+      }
+
+      const id_type id = id_type(count);
+
+      if (!text.empty())
+      {
+        memcpy(arena + used, text.data(), text.size());
+      }
+
+      arena[used + text.size()] = 0;
+
+      offsets[id] = offset_type(used);
+      hashes[id]  = h;
+      table[slot] = id_type(id + 1U);
+      used       += text.size() + 1U;
+      ++count;
+
+      return id;
+    }
+
+    //*************************************************************************
+    /// Returns the id of 'text', or npos if it is not in the pool.
+    //*************************************************************************
+    id_type find(etl::string_view text) const
+    {
+      const uint32_t h    = hash_of(text);
+      size_t         slot = h & MASK;
+
+      while (table[slot] != 0U)
+      {
+        const id_type id = id_type(table[slot] - 1U);
+
+        if ((hashes[id] == h) && equal(id, text))
+        {
+          return id;
+        }
+
+        slot = (slot + 1U) & MASK;
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Checks whether 'text' is in the pool.
+    //*************************************************************************
+    bool contains(etl::string_view text) const
+    {
+      return find(text) != npos;
+    }
+
+    //*************************************************************************
+    /// The string with the id, which must be valid.
+    //*************************************************************************
+    etl::string_view view(id_type id) const
+    {
+      return etl::string_view(arena + offsets[id], length(id));
+    }
+
+    //*************************************************************************
+    /// The string with the id, which must be valid.
+    //*************************************************************************
+    etl::string_view operator [](id_type id) const
+    {
+      return view(id);
+    }
+
+    //*************************************************************************
+    /// The null terminated string with the id, which must be valid.
+    //*************************************************************************
+    const char* c_str(id_type id) const
+    {
+      return arena + offsets[id];
+    }
+
+    //*************************************************************************
+    /// Removes every string. Ids and views from before are no longer valid.
+    //*************************************************************************
+    void clear()
+    {
+      memset(table, 0, sizeof(table));
+      count = 0U;
+      used  = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of strings.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of strings.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return ENTRIES;
+    }
+
+    //*************************************************************************
+    /// Checks whether there are no strings.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether no more strings may be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return (count == ENTRIES) || (used == CHARS);
+    }
+
+    //*************************************************************************
+    /// The number of characters used, including the terminating nulls.
+    //*************************************************************************
+    size_t chars_used() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// The number of characters free.
+    //*************************************************************************
+    size_t chars_available() const
+    {
+      return CHARS - used;
+    }
+
+  private:
+
+    // At most half full.
+    static const size_t TABLE_SIZE = etl::power_of_2_round_up<ENTRIES * 2U>::value;
+    static const size_t MASK       = TABLE_SIZE - 1U;
+
+    //*************************************************************************
+    static uint32_t hash_of(etl::string_view text)
+    {
+      return uint32_t(etl::hash_string(text.data(), text.size()));
+    }
+
+    //*************************************************************************
+    size_t length(id_type id) const
+    {
+      const size_t end = ((size_t(id) + 1U) == count) ? used : size_t(offsets[id + 1U]);
+
+      return end - offsets[id] - 1U;
+    }
+
+    //*************************************************************************
+    bool equal(id_type id, etl::string_view text) const
+    {
+      return (length(id) == text.size()) &&
+             ((text.size() == 0U) || (memcmp(arena + offsets[id], text.data(), text.size()) == 0));
+    }
+
+    char        arena[CHARS];
+    offset_type offsets[ENTRIES];
+    uint32_t    hashes[ENTRIES];
+    id_type     table[TABLE_SIZE]; ///< 0 for empty, otherwise id + 1.
+    size_t      count;
+    size_t      used;
+  };
+
+  template <const size_t CHARS, const size_t ENTRIES>
+  const size_t string_intern_pool<CHARS, ENTRIES>::MAX_CHARS;
+
+  template <const size_t CHARS, const size_t ENTRIES>
+  const size_t string_intern_pool<CHARS, ENTRIES>::MAX_ENTRIES;
+
+  template <const size_t CHARS, const size_t ENTRIES>
+  const typename string_intern_pool<CHARS, ENTRIES>::id_type string_intern_pool<CHARS, ENTRIES>::npos;
+}
+
+#endif
@@ -0,0 +1,364 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SPLIT_INCLUDED
+#define ETL_STRING_SPLIT_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "iterator.h"
+#include "char_traits.h"
+#include "string_view.h"
+#include "integral_limits.h"
+#include "private/string_search.h"
+
+///\defgroup string_split string_split
+/// Lazy splitting of a string view into string view tokens, without copies.
+/// The delimiter is a single character or a set of characters; sets of byte
+/// sized characters are looked up in a 256 bit table built once per split.
+/// Adjacent delimiters produce empty tokens, and a text with n delimiters
+/// produces n + 1 tokens, unless empty tokens are skipped.
+/// After max_splits tokens, the rest of the text is the final token.
+/// The text, and a delimiter set, must outlive the range and its iterators.
+///\code
+/// for (etl::string_view token : etl::split(line, " \t", 2, true))
+///\endcode
+///\ingroup string
+
+namespace etl
+{
+  namespace private_string_split
+  {
+    //*************************************************************************
+    /// A single delimiter character.
+    //*************************************************************************
+    template <typename T>
+    class single_delimiter
+    {
+    public:
+
+      explicit single_delimiter(T c_ = T(0))
+        : c(c_)
+      {
+      }
+
+      const T* find(const T* first, const T* last) const
+      {
+        return (first == last) ? last : private_string_search::find_char(first, last, c);
+      }
+
+      bool contains(T value) const
+      {
+        return value == c;
+      }
+
+    private:
+
+      T c;
+    };
+
+    //*************************************************************************
+    /// A set of delimiter characters.
+    //*************************************************************************
+    template <typename T>
+    class set_delimiter
+    {
+    public:
+
+      set_delimiter()
+        : set(nullptr, 0U)
+      {
+      }
+
+      set_delimiter(const T* s, size_t n)
+        : set(s, n)
+      {
+      }
+
+      const T* find(const T* first, const T* last) const
+      {
+        while ((first != last) && !set.contains(*first))
+        {
+          ++first;
+        }
+
+        return first;
+      }
+
+      bool contains(T value) const
+      {
+        return set.contains(value);
+      }
+
+    private:
+
+      private_string_search::char_set<T> set;
+    };
+  }
+
+  //***************************************************************************
+  /// A lazy range of the tokens of a string view.
+  /// Created by etl::split.
+  ///\ingroup string_split
+  //***************************************************************************
+  template <typename TDelimiter, typename T = char, typename TTraits = etl::char_traits<T> >
+  class split_range
+  {
+  public:
+
+    typedef etl::basic_string_view<T, TTraits> view_type;
+
+    //*************************************************************************
+    /// Iterates over the tokens.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const view_type>
+    {
+    public:
+
+      friend class split_range;
+
+      //***********************************
+      /// Constructs an end iterator.
+      //***********************************
+      iterator()
+        : position(nullptr)
+        , last(nullptr)
+        , splits_left(0U)
+        , skip_empty(false)
+        , more(false)
+        , finished(true)
+      {
+      }
+
+      //***********************************
+      iterator& operator ++()
+      {
+        next();
+        return *this;
+      }
+
+      //***********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        next();
+        return temp;
+      }
+
+      //***********************************
+      const view_type& operator *() const
+      {
+        return token;
+      }
+
+      //***********************************
+      const view_type* operator ->() const
+      {
+        return &token;
+      }
+
+      //***********************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.finished == rhs.finished) &&
+               (lhs.finished || ((lhs.token.data() == rhs.token.data()) && (lhs.token.size() == rhs.token.size()) && (lhs.more == rhs.more)));
+      }
+
+      //***********************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***********************************
+      iterator(const T* first, const T* last_, const TDelimiter& delimiter_, size_t max_splits, bool skip_empty_)
+        : position(first)
+        , last(last_)
+        , delimiter(delimiter_)
+        , splits_left(max_splits)
+        , skip_empty(skip_empty_)
+        , more(true)
+        , finished(false)
+      {
+        next();
+      }
+
+      //***********************************
+      /// Finds the next token.
+      //***********************************
+      void next()
+      {
+        if (!more)
+        {
+          finished = true;
+          token    = view_type();
+          return;
+        }
+
+        if (skip_empty)
+        {
+          while ((position != last) && delimiter.contains(*position))
+          {
+            ++position;
+          }
+
+          if (position == last)
+          {
+            finished = true;
+            token    = view_type();
+            return;
+          }
+        }
+
+        const T* found = (splits_left == 0U) ? last : delimiter.find(position, last);
+
+        token = view_type(position, found);
+
+        if (found == last)
+        {
+          position = last;
+          more     = false;
+        }
+        else
+        {
+          position = found + 1;
+          --splits_left;
+        }
+      }
+
+      const T*   position;
+      const T*   last;
+      TDelimiter delimiter;
+      view_type  token;
+      size_t     splits_left;
+      bool       skip_empty;
+      bool       more;
+      bool       finished;
+    };
+
+    typedef iterator const_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    split_range(view_type text_, const TDelimiter& delimiter_, size_t max_splits_, bool skip_empty_)
+      : text(text_)
+      , delimiter(delimiter_)
+      , max_splits(max_splits_)
+      , skip_empty(skip_empty_)
+    {
+    }
+
+    //*************************************************************************
+    /// An iterator to the first token.
+    //*************************************************************************
+    iterator begin() const
+    {
+      return iterator(text.data(), text.data() + text.size(), delimiter, max_splits, skip_empty);
+    }
+
+    //*************************************************************************
+    /// An iterator past the last token.
+    //*************************************************************************
+    iterator end() const
+    {
+      return iterator();
+    }
+
+    //*************************************************************************
+    /// Counts the tokens.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (iterator itr = begin(); itr != end(); ++itr)
+      {
+        ++n;
+      }
+
+      return n;
+    }
+
+  private:
+
+    view_type  text;
+    TDelimiter delimiter;
+    size_t     max_splits;
+    bool       skip_empty;
+  };
+
+  //***************************************************************************
+  /// Splits a text at a single delimiter character.
+  ///\ingroup string_split
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  split_range<private_string_split::single_delimiter<T>, T, TTraits>
+    split(etl::basic_string_view<T, TTraits> text,
+          T                                  delimiter,
+          size_t                             max_splits = etl::integral_limits<size_t>::max,
+          bool                               skip_empty = false)
+  {
+    return split_range<private_string_split::single_delimiter<T>, T, TTraits>(text, private_string_split::single_delimiter<T>(delimiter), max_splits, skip_empty);
+  }
+
+  //***************************************************************************
+  /// Splits a text at any of a set of delimiter characters.
+  ///\ingroup string_split
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  split_range<private_string_split::set_delimiter<T>, T, TTraits>
+    split(etl::basic_string_view<T, TTraits> text,
+          etl::basic_string_view<T, TTraits> delimiters,
+          size_t                             max_splits = etl::integral_limits<size_t>::max,
+          bool                               skip_empty = false)
+  {
+    return split_range<private_string_split::set_delimiter<T>, T, TTraits>(text, private_string_split::set_delimiter<T>(delimiters.data(), delimiters.size()), max_splits, skip_empty);
+  }
+
+  //***************************************************************************
+  /// Splits a text at any of a null terminated set of delimiter characters.
+  ///\ingroup string_split
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  split_range<private_string_split::set_delimiter<T>, T, TTraits>
+    split(etl::basic_string_view<T, TTraits> text,
+          const T*                           delimiters,
+          size_t                             max_splits = etl::integral_limits<size_t>::max,
+          bool                               skip_empty = false)
+  {
+    return split_range<private_string_split::set_delimiter<T>, T, TTraits>(text, private_string_split::set_delimiter<T>(delimiters, TTraits::length(delimiters)), max_splits, skip_empty);
+  }
+}
+
+#endif
@@ -119,7 +119,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    ETL_CONSTEXPR17 basic_string_view()
+    ETL_CONSTEXPR basic_string_view()
       : mbegin(nullptr),
         mend(nullptr)
     {
@@ -137,7 +137,7 @@ namespace etl
     //*************************************************************************
     /// Construct from T*.
     //*************************************************************************
-    ETL_EXPLICIT_STRING_FROM_CHAR ETL_CONSTEXPR17 basic_string_view(const T* begin_)
+    ETL_EXPLICIT_STRING_FROM_CHAR ETL_CONSTEXPR14 basic_string_view(const T* begin_)
       : mbegin(begin_),
         mend(begin_ + TTraits::length(begin_))
     {
@@ -146,7 +146,7 @@ namespace etl
     //*************************************************************************
     /// Construct from pointer range.
     //*************************************************************************
-    ETL_CONSTEXPR17 basic_string_view(const T* begin_, const T* end_)
+    ETL_CONSTEXPR basic_string_view(const T* begin_, const T* end_)
       : mbegin(begin_),
         mend(end_)
     {
@@ -156,7 +156,7 @@ namespace etl
     /// Construct from iterator/size.
     //*************************************************************************
     template <typename TSize, typename TDummy = typename etl::enable_if<etl::is_integral<TSize>::value, void>::type>
-    ETL_CONSTEXPR17 basic_string_view(const T* begin_, TSize size_)
+    ETL_CONSTEXPR basic_string_view(const T* begin_, TSize size_)
       : mbegin(begin_),
         mend(begin_ + size_)
     {
@@ -165,7 +165,7 @@ namespace etl
     //*************************************************************************
     /// Copy constructor
     //*************************************************************************
-    ETL_CONSTEXPR17 basic_string_view(const basic_string_view& other)
+    ETL_CONSTEXPR basic_string_view(const basic_string_view& other)
       : mbegin(other.mbegin),
         mend(other.mend)
     {
@@ -174,7 +174,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the first element.
     //*************************************************************************
-    const_reference front() const
+    ETL_CONSTEXPR const_reference front() const
     {
       return *mbegin;
     }
@@ -182,7 +182,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the last element.
     //*************************************************************************
-    const_reference back() const
+    ETL_CONSTEXPR const_reference back() const
     {
       return *(mend - 1);
     }
@@ -190,7 +190,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const pointer to the first element of the internal storage.
     //*************************************************************************
-    const_pointer data() const
+    ETL_CONSTEXPR const_pointer data() const
     {
       return mbegin;
     }
@@ -198,7 +198,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator begin() const
+    ETL_CONSTEXPR const_iterator begin() const
     {
       return mbegin;
     }
@@ -206,7 +206,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator cbegin() const
+    ETL_CONSTEXPR const_iterator cbegin() const
     {
       return mbegin;
     }
@@ -214,7 +214,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator end() const
+    ETL_CONSTEXPR const_iterator end() const
     {
       return mend;
     }
@@ -222,7 +222,7 @@ namespace etl
     //*************************************************************************
     // Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator cend() const
+    ETL_CONSTEXPR const_iterator cend() const
     {
       return mend;
     }
@@ -266,7 +266,7 @@ namespace etl
     //*************************************************************************
     /// Returns <b>true</b> if the array size is zero.
     //*************************************************************************
-    bool empty() const
+    ETL_CONSTEXPR bool empty() const
     {
       return (mbegin == mend);
     }
@@ -274,7 +274,7 @@ namespace etl
     //*************************************************************************
     /// Returns the size of the array.
     //*************************************************************************
-    size_t size() const
+    ETL_CONSTEXPR size_t size() const
     {
       return (mend - mbegin);
     }
@@ -282,7 +282,7 @@ namespace etl
     //*************************************************************************
     /// Returns the size of the array.
     //*************************************************************************
-    size_t length() const
+    ETL_CONSTEXPR size_t length() const
     {
       return size();
     }
@@ -290,7 +290,7 @@ namespace etl
     //*************************************************************************
     /// Returns the maximum possible size of the array.
     //*************************************************************************
-    size_t max_size() const
+    ETL_CONSTEXPR size_t max_size() const
     {
       return size();
     }
@@ -298,7 +298,7 @@ namespace etl
     //*************************************************************************
     /// Assign from a view.
     //*************************************************************************
-    etl::basic_string_view<T, TTraits>& operator=(const etl::basic_string_view<T, TTraits>& other)
+    ETL_CONSTEXPR14 etl::basic_string_view<T, TTraits>& operator=(const etl::basic_string_view<T, TTraits>& other)
     {
       mbegin = other.mbegin;
       mend = other.mend;
@@ -331,7 +331,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the indexed value.
     //*************************************************************************
-    const_reference operator[](size_t i) const
+    ETL_CONSTEXPR const_reference operator[](size_t i) const
     {
       return mbegin[i];
     }
@@ -339,7 +339,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the indexed value.
     //*************************************************************************
-    const_reference at(size_t i) const
+    ETL_CONSTEXPR14 const_reference at(size_t i) const
     {
       ETL_ASSERT((mbegin != nullptr && mend != nullptr), ETL_ERROR(string_view_uninitialised));
       ETL_ASSERT(i < size(), ETL_ERROR(string_view_bounds));
@@ -377,7 +377,7 @@ namespace etl
     //*************************************************************************
     /// Returns a substring
     //*************************************************************************
-    basic_string_view substr(size_type position = 0, size_type count = npos) const
+    ETL_CONSTEXPR14 basic_string_view substr(size_type position = 0, size_type count = npos) const
     {
       basic_string_view view;
 
@@ -394,7 +394,7 @@ namespace etl
     //*************************************************************************
     /// Shrinks the view by moving its start forward.
     //*************************************************************************
-    void remove_prefix(size_type n)
+    ETL_CONSTEXPR14 void remove_prefix(size_type n)
     {
       mbegin += n;
     }
@@ -402,7 +402,7 @@ namespace etl
     //*************************************************************************
     /// Shrinks the view by moving its end backward.
     //*************************************************************************
-    void remove_suffix(size_type n)
+    ETL_CONSTEXPR14 void remove_suffix(size_type n)
     {
       mend -= n;
     }
@@ -410,34 +410,42 @@ namespace etl
     //*************************************************************************
     /// Compares two views
     //*************************************************************************
-    int compare(basic_string_view<T, TTraits> view) const
+    ETL_CONSTEXPR14 int compare(basic_string_view<T, TTraits> view) const
     {
-      return (*this == view) ? 0 : ((*this > view) ? 1 : -1);
+      const size_t n = etl::min(size(), view.size());
+      const int    result = TTraits::compare(mbegin, view.mbegin, n);
+
+      if (result != 0)
+      {
+        return result;
+      }
+
+      return (size() == view.size()) ? 0 : ((size() < view.size()) ? -1 : 1);
     }
 
-    int compare(size_type position, size_type count, basic_string_view view) const
+    ETL_CONSTEXPR14 int compare(size_type position, size_type count, basic_string_view view) const
     {
       return substr(position, count).compare(view);
     }
 
-    int compare(size_type position1, size_type count1,
+    ETL_CONSTEXPR14 int compare(size_type position1, size_type count1,
                 basic_string_view view,
                 size_type position2, size_type count2) const
     {
       return substr(position1, count1).compare(view.substr(position2, count2));
     }
 
-    int compare(const T* text) const
+    ETL_CONSTEXPR14 int compare(const T* text) const
     {
       return compare(etl::basic_string_view<T, TTraits>(text));
     }
 
-    int compare(size_type position, size_type count, const T* text) const
+    ETL_CONSTEXPR14 int compare(size_type position, size_type count, const T* text) const
     {
       return substr(position, count).compare(etl::basic_string_view<T, TTraits>(text));
     }
 
-    int compare(size_type position, size_type count1, const T* text, size_type count2) const
+    ETL_CONSTEXPR14 int compare(size_type position, size_type count1, const T* text, size_type count2) const
     {
       return substr(position, count1).compare(etl::basic_string_view<T, TTraits>(text, count2));
     }
@@ -445,18 +453,18 @@ namespace etl
     //*************************************************************************
     /// Checks if the string view starts with the given prefix
     //*************************************************************************
-    bool starts_with(etl::basic_string_view<T, TTraits> view) const
+    ETL_CONSTEXPR14 bool starts_with(etl::basic_string_view<T, TTraits> view) const
     {
       return (size() >= view.size()) &&
              (compare(0, view.size(), view) == 0);
     }
 
-    bool starts_with(T c) const
+    ETL_CONSTEXPR14 bool starts_with(T c) const
     {
       return !empty() && (front() == c);
     }
 
-    bool starts_with(const T* text) const
+    ETL_CONSTEXPR14 bool starts_with(const T* text) const
     {
       size_t lengthtext = TTraits::length(text);
 
@@ -467,18 +475,18 @@ namespace etl
     //*************************************************************************
     /// Checks if the string view ends with the given suffix
     //*************************************************************************
-    bool ends_with(etl::basic_string_view<T, TTraits> view) const
+    ETL_CONSTEXPR14 bool ends_with(etl::basic_string_view<T, TTraits> view) const
     {
       return (size() >= view.size()) &&
              (compare(size() - view.size(), npos, view) == 0);
     }
 
-    bool ends_with(T c) const
+    ETL_CONSTEXPR14 bool ends_with(T c) const
     {
       return !empty() && (back() == c);
     }
 
-    bool ends_with(const T* text) const
+    ETL_CONSTEXPR14 bool ends_with(const T* text) const
     {
       size_t lengthtext = TTraits::length(text);
       size_t lengthview = size();
@@ -490,36 +498,36 @@ namespace etl
     //*************************************************************************
     /// Find characters in the view
     //*************************************************************************
-    size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
+    ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((position > size()) || (view.size() > (size() - position)))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const T* p = private_string_search::find_substring(mbegin + position, mend, view.data(), view.size());
 
-      if (iposition == end())
+      return (p == mend) ? npos : size_type(p - mbegin);
+    }
+
+    ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const
+    {
+      if (position >= size())
       {
         return npos;
       }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
-    }
 
-    size_type find(T c, size_type position = 0) const
-    {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      const T* p = private_string_search::find_char(mbegin + position, mend, c);
+
+      return (p == mend) ? npos : size_type(p - mbegin);
     }
 
-    size_type find(const T* text, size_type position, size_type count) const
+    ETL_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const
     {
       return find(etl::basic_string_view<T, TTraits>(text, count), position);
     }
 
-    size_type find(const T* text, size_type position = 0) const
+    ETL_CONSTEXPR14 size_type find(const T* text, size_type position = 0) const
     {
       return find(etl::basic_string_view<T, TTraits>(text), position);
     }
@@ -575,16 +583,13 @@ namespace etl
 
       if (position < lengthtext)
       {
+        const private_string_search::char_set<T> set(view.data(), view.size());
+
         for (size_t i = position; i < lengthtext; ++i)
         {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0; j < lengthview; ++j)
+          if (set.contains(mbegin[i]))
           {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
+            return i;
           }
         }
       }
@@ -617,20 +622,17 @@ namespace etl
         return npos;
       }
 
+      const private_string_search::char_set<T> set(view.data(), view.size());
+
       position = etl::min(position, size() - 1);
 
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
+        if (set.contains(mbegin[position]))
         {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
+          return position;
         }
 
         ++it;
@@ -664,21 +666,11 @@ namespace etl
 
       if (position < lengthtext)
       {
+        const private_string_search::char_set<T> set(view.data(), view.size());
+
         for (size_t i = position; i < lengthtext; ++i)
         {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
+          if (!set.contains(mbegin[i]))
           {
             return i;
           }
@@ -713,25 +705,15 @@ namespace etl
         return npos;
       }
 
+      const private_string_search::char_set<T> set(view.data(), view.size());
+
       position = etl::min(position, size() - 1);
 
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
+        if (!set.contains(mbegin[position]))
         {
           return position;
         }
@@ -761,16 +743,15 @@ namespace etl
     //*************************************************************************
     /// Equality for array views.
     //*************************************************************************
-    friend bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return (lhs.size() == rhs.size()) &&
-        etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+      return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
     }
 
     //*************************************************************************
     /// Inequality for array views.
     //*************************************************************************
-    friend bool operator != (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator != (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return !(lhs == rhs);
     }
@@ -778,15 +759,15 @@ namespace etl
     //*************************************************************************
     /// Less-than for array views.
     //*************************************************************************
-    friend bool operator < (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator < (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+      return lhs.compare(rhs) < 0;
     }
 
     //*************************************************************************
     /// Greater-than for array views.
     //*************************************************************************
-    friend bool operator > (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator > (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return rhs < lhs;
     }
@@ -794,7 +775,7 @@ namespace etl
     //*************************************************************************
     /// Less-than-equal for array views.
     //*************************************************************************
-    friend bool operator <= (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator <= (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return !(lhs > rhs);
     }
@@ -802,7 +783,7 @@ namespace etl
     //*************************************************************************
     /// Greater-than-equal for array views.
     //*************************************************************************
-    friend bool operator >= (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator >= (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return !(lhs < rhs);
     }
@@ -825,40 +806,46 @@ namespace etl
   template <>
   struct hash<etl::string_view>
   {
-    size_t operator()(const etl::string_view& text) const
+    ETL_CONSTEXPR14 size_t operator()(const etl::string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::hash_string(text.data(), text.size());
     }
   };
 
   template <>
   struct hash<etl::wstring_view>
   {
-    size_t operator()(const etl::wstring_view& text) const
+    ETL_CONSTEXPR14 size_t operator()(const etl::wstring_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::hash_string(text.data(), text.size());
     }
   };
 
   template <>
   struct hash<etl::u16string_view>
   {
-    size_t operator()(const etl::u16string_view& text) const
+    ETL_CONSTEXPR14 size_t operator()(const etl::u16string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::hash_string(text.data(), text.size());
     }
   };
 
   template <>
   struct hash<etl::u32string_view>
   {
-    size_t operator()(const etl::u32string_view& text) const
+    ETL_CONSTEXPR14 size_t operator()(const etl::u32string_view& text) const
+    {
+      return etl::hash_string(text.data(), text.size());
+    }
+  };
+
+  template <typename THasher, typename T, typename TTraits>
+  struct hash_using<THasher, etl::basic_string_view<T, TTraits> >
+  {
+    size_t operator()(const etl::basic_string_view<T, TTraits>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::hash_bytes_using<THasher>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                          reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
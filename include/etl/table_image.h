@@ -0,0 +1,270 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TABLE_IMAGE_INCLUDED
+#define ETL_TABLE_IMAGE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "array_view.h"
+
+//*****************************************************************************
+///\defgroup table_image table_image
+/// A relocatable image of an array of trivially copyable elements.
+/// The image is built offline, or at run time into a buffer, and may then be
+/// placed in flash or memory mapped and used in place, with no parsing or
+/// copying at start up. It holds no pointers, only a header followed by the
+/// raw elements, so it may be loaded at any suitably aligned address.
+/// The image uses the byte order and layout of the machine that wrote it. A
+/// reader on a machine with a different byte order, or with a different size
+/// for the element type, rejects it.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The header at the start of a table image.
+  ///\ingroup table_image
+  //***************************************************************************
+  struct table_image_header
+  {
+    static const uint32_t MAGIC   = 0x544C5445UL; ///< 'ETLT' when read in the writer's byte order.
+    static const uint16_t VERSION = 1U;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;  ///< The offset of the first element from the start of the image.
+    uint32_t element_size;
+    uint32_t count;
+    uint32_t type_id;      ///< Chosen by the user to tell tables apart.
+    uint32_t reserved;
+  };
+
+  namespace private_table_image
+  {
+    //*************************************************************************
+    /// The header padded to the alignment of the element.
+    //*************************************************************************
+    template <typename T>
+    struct layout
+    {
+      static const size_t ALIGNMENT   = etl::alignment_of<T>::value;
+      static const size_t HEADER_SIZE = ((sizeof(etl::table_image_header) + ALIGNMENT - 1U) / ALIGNMENT) * ALIGNMENT;
+    };
+  }
+
+  //***************************************************************************
+  /// Gets the number of bytes needed for an image of 'count' elements.
+  ///\ingroup table_image
+  //***************************************************************************
+  template <typename T>
+  size_t table_image_size(size_t count)
+  {
+    return private_table_image::layout<T>::HEADER_SIZE + (count * sizeof(T));
+  }
+
+  //***************************************************************************
+  /// Writes a table image into a byte buffer, one element at a time.
+  /// The buffer need not be aligned; the image must be copied to an address
+  /// aligned for T before it is viewed.
+  ///\ingroup table_image
+  //***************************************************************************
+  template <typename T>
+  class table_image_writer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Table image elements must be trivially copyable");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    table_image_writer(void* buffer_, size_t length_, uint32_t type_id_ = 0U)
+      : buffer(static_cast<char*>(buffer_))
+      , length(length_)
+      , count(0U)
+      , type_id(type_id_)
+      , overflow(length_ < private_table_image::layout<T>::HEADER_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Appends an element.
+    /// Returns false if the buffer is full.
+    //*************************************************************************
+    bool push_back(const T& element)
+    {
+      if (overflow || (table_image_size<T>(count + 1U) > length))
+      {
+        overflow = true;
+        return false;
+      }
+
+      memcpy(buffer + table_image_size<T>(count), &element, sizeof(T));
+      ++count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes the header.
+    /// Returns the size of the image, or 0 if it did not fit in the buffer.
+    //*************************************************************************
+    size_t finish()
+    {
+      if (overflow)
+      {
+        return 0U;
+      }
+
+      etl::table_image_header header;
+
+      header.magic        = etl::table_image_header::MAGIC;
+      header.version      = etl::table_image_header::VERSION;
+      header.header_size  = static_cast<uint16_t>(private_table_image::layout<T>::HEADER_SIZE);
+      header.element_size = static_cast<uint32_t>(sizeof(T));
+      header.count        = static_cast<uint32_t>(count);
+      header.type_id      = type_id;
+      header.reserved     = 0U;
+
+      memset(buffer, 0, private_table_image::layout<T>::HEADER_SIZE);
+      memcpy(buffer, &header, sizeof(header));
+
+      return table_image_size<T>(count);
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements written.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+  private:
+
+    char*    buffer;
+    size_t   length;
+    size_t   count;
+    uint32_t type_id;
+    bool     overflow;
+  };
+
+  //***************************************************************************
+  /// Writes a range of elements as a table image.
+  /// Returns the size of the image, or 0 if it did not fit in the buffer.
+  ///\ingroup table_image
+  //***************************************************************************
+  template <typename T, typename TIterator>
+  size_t write_table_image(void* buffer, size_t length, TIterator first, TIterator last, uint32_t type_id = 0U)
+  {
+    etl::table_image_writer<T> writer(buffer, length, type_id);
+
+    while (first != last)
+    {
+      if (!writer.push_back(*first++))
+      {
+        return 0U;
+      }
+    }
+
+    return writer.finish();
+  }
+
+  //***************************************************************************
+  /// Checks that an image holds a table of T with the expected type id, that
+  /// it fits in 'length' bytes, and that its elements are suitably aligned.
+  ///\ingroup table_image
+  //***************************************************************************
+  template <typename T>
+  bool is_valid_table_image(const void* image, size_t length, uint32_t type_id = 0U)
+  {
+    if ((image == nullptr) || (length < sizeof(etl::table_image_header)))
+    {
+      return false;
+    }
+
+    etl::table_image_header header;
+    memcpy(&header, image, sizeof(header));
+
+    if ((header.magic        != etl::table_image_header::MAGIC)   ||
+        (header.version      != etl::table_image_header::VERSION) ||
+        (header.element_size != sizeof(T))                        ||
+        (header.type_id      != type_id)                          ||
+        (header.header_size  <  sizeof(etl::table_image_header))  ||
+        (header.header_size  >  length)                           ||
+        ((header.header_size % etl::alignment_of<T>::value) != 0U))
+    {
+      return false;
+    }
+
+    // Written as a division so that a corrupt count cannot overflow.
+    if (header.count > ((length - header.header_size) / sizeof(T)))
+    {
+      return false;
+    }
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(image) + header.header_size;
+
+    return (address % etl::alignment_of<T>::value) == 0U;
+  }
+
+  //***************************************************************************
+  /// Gets a read only view of the elements of an image, in place.
+  /// Returns an empty view with a null data() if the image is not valid.
+  ///\ingroup table_image
+  //***************************************************************************
+  template <typename T>
+  etl::array_view<const T> table_image_view(const void* image, size_t length, uint32_t type_id = 0U)
+  {
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Table image elements must be trivially copyable");
+
+    if (!is_valid_table_image<T>(image, length, type_id))
+    {
+      return etl::array_view<const T>();
+    }
+
+    etl::table_image_header header;
+    memcpy(&header, image, sizeof(header));
+
+    const T* p_begin = reinterpret_cast<const T*>(static_cast<const char*>(image) + header.header_size);
+
+    return etl::array_view<const T>(p_begin, p_begin + header.count);
+  }
+}
+
+#endif
@@ -119,6 +119,131 @@ namespace etl
     bool task_running;
     etl::task_priority_t task_priority;
   };
+
+  //***************************************************************************
+  /// A periodic task with a deadline, for the earliest deadline first policy.
+  /// A job is released every period, and must be processed within the
+  /// relative deadline of its release.
+  /// Times are uint32_t tick counts. Wrapping is handled, as long as times
+  /// compared are within 2^31 ticks of each other.
+  //***************************************************************************
+  class deadline_task : public etl::task
+  {
+  public:
+
+    typedef uint32_t time_type;
+
+    //*******************************************
+    /// Constructor.
+    ///\param priority          Chooses between tasks with the same deadline.
+    ///\param period_           The ticks between releases. Must be greater than zero.
+    ///\param relative_deadline_ The ticks from a release to its deadline.
+    ///\param first_release     The tick of the first release.
+    //*******************************************
+    deadline_task(task_priority_t priority, time_type period_, time_type relative_deadline_, time_type first_release = 0U)
+      : task(priority),
+        period(period_),
+        relative_deadline(relative_deadline_),
+        release_time(first_release),
+        absolute_deadline(first_release + relative_deadline_),
+        deadline_misses(0U)
+    {
+    }
+
+    //*******************************************
+    /// Get the period.
+    //*******************************************
+    time_type get_period() const
+    {
+      return period;
+    }
+
+    //*******************************************
+    /// Get the deadline relative to a release.
+    //*******************************************
+    time_type get_relative_deadline() const
+    {
+      return relative_deadline;
+    }
+
+    //*******************************************
+    /// Get the release time of the current job.
+    //*******************************************
+    time_type get_release_time() const
+    {
+      return release_time;
+    }
+
+    //*******************************************
+    /// Get the deadline of the current job.
+    //*******************************************
+    time_type get_absolute_deadline() const
+    {
+      return absolute_deadline;
+    }
+
+    //*******************************************
+    /// Set the release time of the next job.
+    /// Must not be called while the task is in a running scheduler.
+    //*******************************************
+    void set_release_time(time_type release_time_)
+    {
+      release_time      = release_time_;
+      absolute_deadline = release_time_ + relative_deadline;
+    }
+
+    //*******************************************
+    /// Get the number of jobs that finished after their deadline.
+    //*******************************************
+    uint32_t get_deadline_misses() const
+    {
+      return deadline_misses;
+    }
+
+    //*******************************************
+    /// Clear the count of missed deadlines.
+    //*******************************************
+    void clear_deadline_misses()
+    {
+      deadline_misses = 0U;
+    }
+
+    //*******************************************
+    /// Is time 'a' before time 'b'?
+    //*******************************************
+    static bool is_before(time_type a, time_type b)
+    {
+      return int32_t(a - b) < 0;
+    }
+
+    //*******************************************
+    /// Called by the scheduler policy when the current job has finished.
+    /// Counts a miss if it finished after its deadline, and moves on to the
+    /// next release.
+    ///\return <b>true</b> if the deadline was missed.
+    //*******************************************
+    bool complete_job(time_type finish_time)
+    {
+      const bool missed = is_before(absolute_deadline, finish_time);
+
+      if (missed)
+      {
+        ++deadline_misses;
+      }
+
+      set_release_time(release_time + period);
+
+      return missed;
+    }
+
+  private:
+
+    time_type period;
+    time_type relative_deadline;
+    time_type release_time;
+    time_type absolute_deadline;
+    uint32_t  deadline_misses;
+  };
 }
 
 #undef ETL_FILE
@@ -0,0 +1,482 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TDIGEST_INCLUDED
+#define ETL_TDIGEST_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup tdigest tdigest
+/// A merging t-digest, for estimating quantiles of a stream of values in
+/// fixed memory. Values are summarised as weighted centroids that are small
+/// near the tails, so extreme percentiles such as p99 and p99.9 stay accurate.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A centroid. The mean of a number of values and their total weight.
+  ///\ingroup tdigest
+  //***************************************************************************
+  template <typename T>
+  struct tdigest_centroid
+  {
+    T mean;
+    T weight;
+  };
+
+  namespace private_tdigest
+  {
+    //*************************************************************************
+    /// Orders centroids by mean.
+    //*************************************************************************
+    template <typename T>
+    struct mean_less
+    {
+      bool operator ()(const etl::tdigest_centroid<T>& lhs, const etl::tdigest_centroid<T>& rhs) const
+      {
+        return lhs.mean < rhs.mean;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A merging t-digest.
+  /// New values go in to a buffer. When it is full the buffer is sorted and
+  /// merged with the centroids in one pass, so adding is O(1) amortised.
+  /// The arcsine scale function limits the number of centroids to
+  /// COMPRESSION + 2, whatever the number of values added.
+  /// Digests with the same compression may be merged, so each thread may keep
+  /// its own, combined when read.
+  ///\tparam COMPRESSION The compression factor. Larger is more accurate.
+  ///\tparam BUFFER_SIZE The number of values buffered between merges.
+  ///\tparam T           The floating point type of the values.
+  ///\ingroup tdigest
+  //***************************************************************************
+  template <const size_t COMPRESSION_, const size_t BUFFER_SIZE_ = COMPRESSION_ * 4U, typename T = double>
+  class tdigest
+  {
+  public:
+
+    ETL_STATIC_ASSERT(COMPRESSION_ >= 10U, "COMPRESSION must be at least 10");
+    ETL_STATIC_ASSERT(BUFFER_SIZE_ > 0U, "BUFFER_SIZE must be greater than zero");
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "T must be a floating point type");
+
+    static const size_t COMPRESSION = COMPRESSION_;
+    static const size_t BUFFER_SIZE = BUFFER_SIZE_;
+    static const size_t CAPACITY    = COMPRESSION_ + 2U;
+
+    typedef T                        value_type;
+    typedef etl::tdigest_centroid<T> centroid_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    tdigest()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Forgets all values.
+    //*************************************************************************
+    void clear()
+    {
+      n_centroids   = 0U;
+      n_buffered    = 0U;
+      total_weight  = T(0);
+      buffer_weight = T(0);
+      minimum       = T(0);
+      maximum       = T(0);
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    void add(T value)
+    {
+      add(value, T(1));
+    }
+
+    //*************************************************************************
+    /// Adds a value with a weight.
+    //*************************************************************************
+    void add(T value, T weight)
+    {
+      if (weight <= T(0))
+      {
+        return;
+      }
+
+      if ((total_weight + buffer_weight) == T(0))
+      {
+        minimum = value;
+        maximum = value;
+      }
+      else
+      {
+        minimum = (value < minimum) ? value : minimum;
+        maximum = (value > maximum) ? value : maximum;
+      }
+
+      if (n_buffered == BUFFER_SIZE)
+      {
+        compress();
+      }
+
+      buffer[n_buffered].mean   = value;
+      buffer[n_buffered].weight = weight;
+      ++n_buffered;
+      buffer_weight += weight;
+    }
+
+    //*************************************************************************
+    /// Merges in the values of another digest.
+    /// The result is as if all of the values had been added to this one.
+    //*************************************************************************
+    void merge(const tdigest& other)
+    {
+      if (other.empty())
+      {
+        return;
+      }
+
+      const T other_minimum = other.minimum;
+      const T other_maximum = other.maximum;
+      const bool was_empty  = empty();
+
+      for (size_t i = 0U; i < other.n_centroids; ++i)
+      {
+        add(other.centroids[i].mean, other.centroids[i].weight);
+      }
+
+      for (size_t i = 0U; i < other.n_buffered; ++i)
+      {
+        add(other.buffer[i].mean, other.buffer[i].weight);
+      }
+
+      // Centroid means lie inside the other's range, so its extremes may be lost.
+      minimum = (was_empty || (other_minimum < minimum)) ? other_minimum : minimum;
+      maximum = (was_empty || (other_maximum > maximum)) ? other_maximum : maximum;
+    }
+
+    //*************************************************************************
+    /// Estimates the value at quantile 'q', from 0 to 1.
+    /// Returns 0 if the digest is empty.
+    //*************************************************************************
+    T quantile(T q) const
+    {
+      flush();
+
+      if (n_centroids == 0U)
+      {
+        return T(0);
+      }
+
+      if (q <= T(0))
+      {
+        return minimum;
+      }
+
+      if (q >= T(1))
+      {
+        return maximum;
+      }
+
+      if (n_centroids == 1U)
+      {
+        return centroids[0].mean;
+      }
+
+      const T index = q * total_weight;
+
+      // Between the minimum and the middle of the first centroid.
+      T weight_so_far = centroids[0].weight / T(2);
+
+      if (index < weight_so_far)
+      {
+        return interpolate(minimum, centroids[0].mean, index / weight_so_far);
+      }
+
+      for (size_t i = 0U; i < (n_centroids - 1U); ++i)
+      {
+        const T step = (centroids[i].weight + centroids[i + 1U].weight) / T(2);
+
+        if ((weight_so_far + step) > index)
+        {
+          return interpolate(centroids[i].mean, centroids[i + 1U].mean, (index - weight_so_far) / step);
+        }
+
+        weight_so_far += step;
+      }
+
+      // Between the middle of the last centroid and the maximum.
+      const T last = centroids[n_centroids - 1U].weight / T(2);
+
+      return interpolate(centroids[n_centroids - 1U].mean, maximum, (index - weight_so_far) / last);
+    }
+
+    //*************************************************************************
+    /// Estimates the fraction of values that are less than or equal to 'value'.
+    //*************************************************************************
+    T cdf(T value) const
+    {
+      flush();
+
+      if (n_centroids == 0U)
+      {
+        return T(0);
+      }
+
+      if (value < minimum)
+      {
+        return T(0);
+      }
+
+      if (value >= maximum)
+      {
+        return T(1);
+      }
+
+      T weight_so_far = T(0);
+      T left          = minimum;
+      T left_weight   = T(0);
+
+      for (size_t i = 0U; i < n_centroids; ++i)
+      {
+        const T right        = centroids[i].mean;
+        const T right_weight = centroids[i].weight / T(2);
+
+        if (value < right)
+        {
+          const T span = right - left;
+          const T f    = (span > T(0)) ? (value - left) / span : T(1);
+
+          return (weight_so_far + (f * (left_weight + right_weight))) / total_weight;
+        }
+
+        weight_so_far += left_weight + right_weight;
+        left           = right;
+        left_weight    = right_weight;
+      }
+
+      const T span = maximum - left;
+      const T f    = (span > T(0)) ? (value - left) / span : T(1);
+
+      return (weight_so_far + (f * left_weight)) / total_weight;
+    }
+
+    //*************************************************************************
+    /// The total weight of the values added.
+    //*************************************************************************
+    T count() const
+    {
+      return total_weight + buffer_weight;
+    }
+
+    //*************************************************************************
+    /// True if no values have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (n_centroids == 0U) && (n_buffered == 0U);
+    }
+
+    //*************************************************************************
+    /// The smallest value added.
+    //*************************************************************************
+    T min() const
+    {
+      return minimum;
+    }
+
+    //*************************************************************************
+    /// The largest value added.
+    //*************************************************************************
+    T max() const
+    {
+      return maximum;
+    }
+
+    //*************************************************************************
+    /// The number of centroids, after merging the buffer.
+    //*************************************************************************
+    size_t size() const
+    {
+      flush();
+
+      return n_centroids;
+    }
+
+    //*************************************************************************
+    /// The centroids, in order of mean, after merging the buffer.
+    //*************************************************************************
+    const centroid_type* data() const
+    {
+      flush();
+
+      return centroids;
+    }
+
+    //*************************************************************************
+    /// Merges the buffered values in to the centroids.
+    //*************************************************************************
+    void compress()
+    {
+      flush();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Linear interpolation from 'a' to 'b'.
+    //*************************************************************************
+    static T interpolate(T a, T b, T f)
+    {
+      return a + ((b - a) * f);
+    }
+
+    //*************************************************************************
+    /// The arcsine scale function and its inverse.
+    //*************************************************************************
+    static T scale(T q)
+    {
+      return T((double(COMPRESSION) / (2.0 * pi())) * ::asin((2.0 * double(q)) - 1.0));
+    }
+
+    static T inverse_scale(T k)
+    {
+      const double limit = double(COMPRESSION) / 4.0;
+
+      if (double(k) >= limit)
+      {
+        return T(1);
+      }
+
+      return T((::sin(double(k) * (2.0 * pi()) / double(COMPRESSION)) + 1.0) / 2.0);
+    }
+
+    static double pi()
+    {
+      return 3.14159265358979323846;
+    }
+
+    //*************************************************************************
+    /// Sorts the buffer and merges it with the centroids in one pass.
+    /// Neighbours are combined while the result spans no more than one unit
+    /// of the scale function. The capacity check only guards against rounding.
+    //*************************************************************************
+    void flush() const
+    {
+      if (n_buffered == 0U)
+      {
+        return;
+      }
+
+      etl::sort(buffer, buffer + n_buffered, private_tdigest::mean_less<T>());
+
+      const T new_total = total_weight + buffer_weight;
+
+      size_t ic = 0U;
+      size_t ib = 0U;
+      size_t n  = 0U;
+
+      T weight_so_far = T(0);
+      T q_limit       = T(0);
+      centroid_type current;
+
+      while ((ic < n_centroids) || (ib < n_buffered))
+      {
+        centroid_type next;
+
+        if ((ib == n_buffered) || ((ic < n_centroids) && (centroids[ic].mean <= buffer[ib].mean)))
+        {
+          next = centroids[ic++];
+        }
+        else
+        {
+          next = buffer[ib++];
+        }
+
+        if (n == 0U)
+        {
+          current = next;
+          q_limit = inverse_scale(scale(T(0)) + T(1));
+          n       = 1U;
+        }
+        else if ((((weight_so_far + current.weight + next.weight) / new_total) <= q_limit) || (n == CAPACITY))
+        {
+          current.weight += next.weight;
+          current.mean   += (next.mean - current.mean) * (next.weight / current.weight);
+        }
+        else
+        {
+          merged[n - 1U]  = current;
+          weight_so_far  += current.weight;
+          current         = next;
+          q_limit         = inverse_scale(scale(weight_so_far / new_total) + T(1));
+          ++n;
+        }
+      }
+
+      merged[n - 1U] = current;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        centroids[i] = merged[i];
+      }
+
+      n_centroids   = n;
+      n_buffered    = 0U;
+      total_weight  = new_total;
+      buffer_weight = T(0);
+    }
+
+    // Merging changes the representation but not the values, so may be done by const readers.
+    mutable centroid_type centroids[CAPACITY];
+    mutable centroid_type merged[CAPACITY];
+    mutable centroid_type buffer[BUFFER_SIZE];
+    mutable size_t        n_centroids;
+    mutable size_t        n_buffered;
+    mutable T             total_weight;
+    mutable T             buffer_weight;
+    T                     minimum;
+    T                     maximum;
+  };
+}
+
+#endif
@@ -0,0 +1,750 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIME_SERIES_CODEC_INCLUDED
+#define ETL_TIME_SERIES_CODEC_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "binary.h"
+#include "bit_stream.h"
+#include "serialize.h"
+#include "zigzag.h"
+#include "static_assert.h"
+
+///\defgroup time_series_codec time_series_codec
+/// Streaming compression of slowly changing series into an etl::bit_stream,
+/// after the Gorilla time series database.
+/// delta_encoder writes the differences between integers as zigzag varints.
+/// delta_of_delta_encoder writes the change in the difference between
+/// timestamps, so that regular samples take a single bit each.
+/// xor_encoder writes the bits that differ between successive floating
+/// point values, so that repeated values take a single bit each.
+/// The first value of a series is written in full. A decoder must be reset
+/// whenever its encoder is, and read the values in the order written.
+/// The functions return false if the stream runs out of room or the data is
+/// malformed. Part of a value may have been written or read, so the stream
+/// is then not usable for that series.
+///\ingroup binary
+
+namespace etl
+{
+  namespace private_time_series_codec
+  {
+    //*************************************************************************
+    /// The difference between two integers, wrapping at the width of T.
+    //*************************************************************************
+    template <typename T>
+    int64_t difference(T value, T previous)
+    {
+      typedef typename etl::make_unsigned<T>::type utype;
+      typedef typename etl::make_signed<T>::type   stype;
+
+      return int64_t(stype(utype(utype(value) - utype(previous))));
+    }
+
+    //*************************************************************************
+    /// Adds a difference to an integer, wrapping at the width of T.
+    //*************************************************************************
+    template <typename T>
+    T add_difference(T previous, int64_t delta)
+    {
+      typedef typename etl::make_unsigned<T>::type utype;
+
+      return T(utype(utype(previous) + utype(delta)));
+    }
+
+    //*************************************************************************
+    /// Writes the first value of a series.
+    //*************************************************************************
+    template <typename T>
+    bool put_first(etl::bit_stream& stream, T value)
+    {
+      return stream.put(uint64_t(value), uint_least8_t(CHAR_BIT * sizeof(T)));
+    }
+
+    //*************************************************************************
+    /// Reads the first value of a series.
+    //*************************************************************************
+    template <typename T>
+    bool get_first(etl::bit_stream& stream, T& value)
+    {
+      uint64_t bits;
+
+      if (!stream.get(bits, uint_least8_t(CHAR_BIT * sizeof(T))))
+      {
+        return false;
+      }
+
+      value = T(bits);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The unsigned integral type with the same size as a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct float_bits
+    {
+      ETL_STATIC_ASSERT((sizeof(T) == sizeof(uint32_t)) || (sizeof(T) == sizeof(uint64_t)), "Unsupported floating point type");
+
+      typedef typename etl::conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+
+      enum
+      {
+        BITS        = CHAR_BIT * sizeof(T),
+        LENGTH_BITS = (BITS == 32) ? 5 : 6,
+        MAX_LEADING = 31,
+        LEADING_BITS = 5
+      };
+
+      static type to_bits(T value)
+      {
+        type bits;
+        memcpy(&bits, &value, sizeof(T));
+        return bits;
+      }
+
+      static T from_bits(type bits)
+      {
+        T value;
+        memcpy(&value, &bits, sizeof(T));
+        return value;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Writes a series of integers as zigzag varints of their differences.
+  /// Differences wrap at the width of T, so a counter rolling over from its
+  /// maximum to zero costs one byte.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class delta_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "T must be an integral type");
+
+    delta_encoder()
+      : previous(T(0))
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Writes the next value.
+    //*************************************************************************
+    bool add(etl::bit_stream& stream, T value)
+    {
+      bool success;
+
+      if (n == 0U)
+      {
+        success = private_time_series_codec::put_first(stream, value);
+      }
+      else
+      {
+        success = etl::serialize_varint(stream, etl::zigzag_encode(private_time_series_codec::difference(value, previous)));
+      }
+
+      if (success)
+      {
+        previous = value;
+        ++n;
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous = T(0);
+      n        = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values written since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    T      previous;
+    size_t n;
+  };
+
+  //***************************************************************************
+  /// Reads a series written by delta_encoder.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class delta_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "T must be an integral type");
+
+    delta_decoder()
+      : previous(T(0))
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Reads the next value.
+    //*************************************************************************
+    bool get(etl::bit_stream& stream, T& value)
+    {
+      if (n == 0U)
+      {
+        if (!private_time_series_codec::get_first(stream, value))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        uint64_t encoded;
+
+        if (!etl::deserialize_varint(stream, encoded))
+        {
+          return false;
+        }
+
+        value = private_time_series_codec::add_difference(previous, etl::zigzag_decode(encoded));
+      }
+
+      previous = value;
+      ++n;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous = T(0);
+      n        = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values read since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    T      previous;
+    size_t n;
+  };
+
+  //***************************************************************************
+  /// Writes a series of integers, typically timestamps, as the zigzag encoded
+  /// change in their difference, with a prefix code selecting the width.
+  /// '0'              No change.
+  /// '10'    + 7 bits
+  /// '110'   + 9 bits
+  /// '1110'  + 12 bits
+  /// '11110' + 32 bits
+  /// '11111' + 64 bits
+  /// A series sampled at a fixed interval costs one bit per value.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class delta_of_delta_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "T must be an integral type");
+
+    delta_of_delta_encoder()
+      : previous(T(0))
+      , previous_delta(0)
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Writes the next value.
+    //*************************************************************************
+    bool add(etl::bit_stream& stream, T value)
+    {
+      bool success;
+      int64_t delta = 0;
+
+      if (n == 0U)
+      {
+        success = private_time_series_codec::put_first(stream, value);
+      }
+      else
+      {
+        delta = private_time_series_codec::difference(value, previous);
+
+        // The change in the difference, wrapped at the width of T.
+        const T change = private_time_series_codec::add_difference(T(0), int64_t(uint64_t(delta) - uint64_t(previous_delta)));
+        const uint64_t encoded = etl::zigzag_encode(private_time_series_codec::difference(change, T(0)));
+
+        if (encoded == 0U)
+        {
+          success = stream.put(false);
+        }
+        else if (encoded < (uint64_t(1U) << 7))
+        {
+          success = stream.put((uint64_t(0x2U) << 7) | encoded, 2U + 7U);
+        }
+        else if (encoded < (uint64_t(1U) << 9))
+        {
+          success = stream.put((uint64_t(0x6U) << 9) | encoded, 3U + 9U);
+        }
+        else if (encoded < (uint64_t(1U) << 12))
+        {
+          success = stream.put((uint64_t(0xEU) << 12) | encoded, 4U + 12U);
+        }
+        else if (encoded < (uint64_t(1U) << 32))
+        {
+          success = stream.put((uint64_t(0x1EU) << 32) | encoded, 5U + 32U);
+        }
+        else
+        {
+          success = stream.put(uint32_t(0x1FU), 5U) && stream.put(encoded, 64U);
+        }
+      }
+
+      if (success)
+      {
+        previous       = value;
+        previous_delta = delta;
+        ++n;
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous       = T(0);
+      previous_delta = 0;
+      n              = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values written since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    T       previous;
+    int64_t previous_delta;
+    size_t  n;
+  };
+
+  //***************************************************************************
+  /// Reads a series written by delta_of_delta_encoder.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class delta_of_delta_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "T must be an integral type");
+
+    delta_of_delta_decoder()
+      : previous(T(0))
+      , previous_delta(0)
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Reads the next value.
+    //*************************************************************************
+    bool get(etl::bit_stream& stream, T& value)
+    {
+      int64_t delta = 0;
+
+      if (n == 0U)
+      {
+        if (!private_time_series_codec::get_first(stream, value))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        // Count the leading ones of the prefix.
+        uint_least8_t ones = 0U;
+        bool bit = true;
+
+        while (bit && (ones < 5U))
+        {
+          if (!stream.get(bit))
+          {
+            return false;
+          }
+
+          if (bit)
+          {
+            ++ones;
+          }
+        }
+
+        static const uint_least8_t widths[] = { 0U, 7U, 9U, 12U, 32U, 64U };
+
+        uint64_t encoded = 0U;
+
+        if ((ones != 0U) && !stream.get(encoded, widths[ones]))
+        {
+          return false;
+        }
+
+        const T change = T(etl::zigzag_decode(encoded));
+        delta = private_time_series_codec::difference(private_time_series_codec::add_difference(change, previous_delta), T(0));
+        value = private_time_series_codec::add_difference(previous, delta);
+      }
+
+      previous       = value;
+      previous_delta = delta;
+      ++n;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous       = T(0);
+      previous_delta = 0;
+      n              = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values read since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    T       previous;
+    int64_t previous_delta;
+    size_t  n;
+  };
+
+  //***************************************************************************
+  /// Writes a series of floating point values as the exclusive or of each
+  /// with the one before.
+  /// '0'  The same value.
+  /// '10' The meaningful bits, within the window of the previous '11'.
+  /// '11' The count of leading zeros in 5 bits, the count of meaningful bits
+  ///      less one in 5 bits (float) or 6 bits (double), then the meaningful
+  ///      bits. This sets the window.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class xor_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "T must be a floating point type");
+
+    typedef private_time_series_codec::float_bits<T> traits;
+    typedef typename traits::type                     bits_type;
+
+    xor_encoder()
+      : previous(0U)
+      , leading(0U)
+      , trailing(0U)
+      , has_window(false)
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Writes the next value.
+    //*************************************************************************
+    bool add(etl::bit_stream& stream, T value)
+    {
+      const bits_type bits = traits::to_bits(value);
+      bool success;
+
+      if (n == 0U)
+      {
+        success = stream.put(uint64_t(bits), uint_least8_t(traits::BITS));
+      }
+      else
+      {
+        const bits_type x = bits ^ previous;
+
+        if (x == 0U)
+        {
+          success = stream.put(false);
+        }
+        else
+        {
+          uint_least8_t lz = etl::count_leading_zeros(x);
+          uint_least8_t tz = etl::count_trailing_zeros(x);
+
+          if (lz > uint_least8_t(traits::MAX_LEADING))
+          {
+            lz = uint_least8_t(traits::MAX_LEADING);
+          }
+
+          if (has_window && (lz >= leading) && (tz >= trailing))
+          {
+            const uint_least8_t length = uint_least8_t(traits::BITS - leading - trailing);
+
+            success = stream.put(uint32_t(0x2U), 2U) &&
+                      stream.put(uint64_t(x >> trailing), length);
+          }
+          else
+          {
+            const uint_least8_t length = uint_least8_t(traits::BITS - lz - tz);
+            const uint32_t header = (((0x3U << traits::LEADING_BITS) | lz) << traits::LENGTH_BITS) | uint32_t(length - 1U);
+
+            success = stream.put(header, uint_least8_t(2U + traits::LEADING_BITS + traits::LENGTH_BITS)) &&
+                      stream.put(uint64_t(x >> tz), length);
+
+            if (success)
+            {
+              leading    = lz;
+              trailing   = tz;
+              has_window = true;
+            }
+          }
+        }
+      }
+
+      if (success)
+      {
+        previous = bits;
+        ++n;
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous   = 0U;
+      leading    = 0U;
+      trailing   = 0U;
+      has_window = false;
+      n          = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values written since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    bits_type     previous;
+    uint_least8_t leading;
+    uint_least8_t trailing;
+    bool          has_window;
+    size_t        n;
+  };
+
+  //***************************************************************************
+  /// Reads a series written by xor_encoder.
+  ///\ingroup time_series_codec
+  //***************************************************************************
+  template <typename T>
+  class xor_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "T must be a floating point type");
+
+    typedef private_time_series_codec::float_bits<T> traits;
+    typedef typename traits::type                     bits_type;
+
+    xor_decoder()
+      : previous(0U)
+      , leading(0U)
+      , trailing(0U)
+      , has_window(false)
+      , n(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Reads the next value.
+    //*************************************************************************
+    bool get(etl::bit_stream& stream, T& value)
+    {
+      bits_type bits;
+
+      if (n == 0U)
+      {
+        uint64_t first;
+
+        if (!stream.get(first, uint_least8_t(traits::BITS)))
+        {
+          return false;
+        }
+
+        bits = bits_type(first);
+      }
+      else
+      {
+        bool changed;
+
+        if (!stream.get(changed))
+        {
+          return false;
+        }
+
+        if (!changed)
+        {
+          bits = previous;
+        }
+        else
+        {
+          bool new_window;
+
+          if (!stream.get(new_window))
+          {
+            return false;
+          }
+
+          if (new_window)
+          {
+            uint32_t lz;
+            uint32_t length;
+
+            if (!stream.get(lz, uint_least8_t(traits::LEADING_BITS)) ||
+                !stream.get(length, uint_least8_t(traits::LENGTH_BITS)))
+            {
+              return false;
+            }
+
+            ++length;
+
+            if ((lz + length) > uint32_t(traits::BITS))
+            {
+              return false;
+            }
+
+            leading    = uint_least8_t(lz);
+            trailing   = uint_least8_t(traits::BITS - lz - length);
+            has_window = true;
+          }
+          else if (!has_window)
+          {
+            return false;
+          }
+
+          uint64_t meaningful;
+
+          if (!stream.get(meaningful, uint_least8_t(traits::BITS - leading - trailing)))
+          {
+            return false;
+          }
+
+          bits = previous ^ (bits_type(meaningful) << trailing);
+        }
+      }
+
+      previous = bits;
+      value    = traits::from_bits(bits);
+      ++n;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void reset()
+    {
+      previous   = 0U;
+      leading    = 0U;
+      trailing   = 0U;
+      has_window = false;
+      n          = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values read since the last reset.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n;
+    }
+
+  private:
+
+    bits_type     previous;
+    uint_least8_t leading;
+    uint_least8_t trailing;
+    bool          has_window;
+    size_t        n;
+  };
+}
+
+#endif
@@ -87,6 +87,18 @@ namespace etl
       typedef uint_least8_t type;
     };
 
+    // Large timer id.
+    // For timer wheels that need more than 254 timers.
+    struct large_id
+    {
+      enum
+      {
+        NO_TIMER = 0xFFFFFFFF
+      };
+
+      typedef uint32_t type;
+    };
+
     // Timer state.
     struct state
     {
@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOP_K_INCLUDED
+#define ETL_TOP_K_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "functional.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "flat_map.h"
+#include "vector.h"
+#include "indexed_priority_queue.h"
+
+///\defgroup top_k top_k
+/// Finds the most frequent keys in a stream, in bounded memory, using the
+/// Space-Saving algorithm.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A key tracked by etl::top_k, with its estimated count.
+  /// The true count is between count - error and count.
+  ///\ingroup top_k
+  //***************************************************************************
+  template <typename TKey, typename TCount>
+  struct top_k_item
+  {
+    TKey   key;
+    TCount count;
+    TCount error;
+  };
+
+  //***************************************************************************
+  /// Tracks the SIZE most frequent keys with the Space-Saving algorithm.
+  /// A new key, when all SIZE counters are in use, replaces the key with the
+  /// smallest count and inherits that count as its possible error. Any key
+  /// seen more than total / SIZE times is guaranteed to be tracked.
+  /// The counters are kept in an etl::indexed_priority_queue, smallest on
+  /// top, and found by key through an etl::flat_map of their handles, so
+  /// every update is O(log SIZE).
+  ///\tparam TKey        The key type.
+  ///\tparam SIZE        The number of keys tracked.
+  ///\tparam TKeyCompare The key ordering, for the index.
+  ///\tparam TCount      The counter type.
+  ///\ingroup top_k
+  //***************************************************************************
+  template <typename TKey, const size_t SIZE_, typename TKeyCompare = etl::less<TKey>, typename TCount = uint32_t>
+  class top_k
+  {
+  private:
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(SIZE_ > 0U, "SIZE must be greater than zero");
+
+    static const size_t SIZE = SIZE_;
+
+    typedef TKey                          key_type;
+    typedef TCount                        count_type;
+    typedef etl::top_k_item<TKey, TCount> item_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    top_k()
+      : total_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Records 'count' occurrences of the key.
+    ///\return The new estimated count of the key.
+    //*************************************************************************
+    count_type add(key_parameter_t key, count_type count = 1U)
+    {
+      total_count = saturating_add(total_count, count);
+
+      typename index_t::iterator itr = index.find(key);
+
+      item_type item;
+
+      if (itr != index.end())
+      {
+        // Already tracked.
+        item = counters[itr->second];
+        item.count = saturating_add(item.count, count);
+        counters.update(itr->second, item);
+      }
+      else if (!counters.full())
+      {
+        item.key   = key;
+        item.count = count;
+        item.error = 0U;
+        index.insert(ETL_OR_STD::make_pair(key, counters.push(item)));
+      }
+      else
+      {
+        // Replace the least frequent key.
+        const handle_t handle = counters.top_handle();
+        const item_type& least = counters.top();
+
+        index.erase(least.key);
+
+        item.key   = key;
+        item.count = saturating_add(least.count, count);
+        item.error = least.count;
+
+        counters.update(handle, item);
+        index.insert(ETL_OR_STD::make_pair(key, handle));
+      }
+
+      return item.count;
+    }
+
+    //*************************************************************************
+    /// Checks if the key is tracked.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return index.find(key) != index.end();
+    }
+
+    //*************************************************************************
+    /// Gets the estimated count of the key. 0 if not tracked.
+    //*************************************************************************
+    count_type count(key_parameter_t key) const
+    {
+      typename index_t::const_iterator itr = index.find(key);
+
+      return (itr == index.end()) ? count_type(0U) : counters[itr->second].count;
+    }
+
+    //*************************************************************************
+    /// Gets the tracked keys, most frequent first.
+    /// Replaces the contents of 'items'; at most items.max_size() are copied.
+    //*************************************************************************
+    void get(etl::ivector<item_type>& items) const
+    {
+      items.clear();
+
+      for (typename index_t::const_iterator itr = index.begin(); itr != index.end(); ++itr)
+      {
+        const item_type& item = counters[itr->second];
+
+        if (items.full())
+        {
+          if (item.count <= items.back().count)
+          {
+            continue;
+          }
+
+          items.back() = item;
+        }
+        else
+        {
+          items.push_back(item);
+        }
+
+        // Keep the vector sorted, most frequent first.
+        typename etl::ivector<item_type>::iterator position = items.end() - 1;
+
+        while ((position != items.begin()) && ((position - 1)->count < position->count))
+        {
+          using ETL_OR_STD::swap; // Allow ADL
+          swap(*(position - 1), *position);
+          --position;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The total of all counts added.
+    //*************************************************************************
+    count_type total() const
+    {
+      return total_count;
+    }
+
+    //*************************************************************************
+    /// The number of keys tracked.
+    //*************************************************************************
+    size_t size() const
+    {
+      return counters.size();
+    }
+
+    //*************************************************************************
+    /// Checks if no keys are tracked.
+    //*************************************************************************
+    bool empty() const
+    {
+      return counters.empty();
+    }
+
+    //*************************************************************************
+    /// Forgets all keys.
+    //*************************************************************************
+    void clear()
+    {
+      counters.clear();
+      index.clear();
+      total_count = 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Orders the counters so that the smallest count is on top.
+    //*************************************************************************
+    struct count_greater
+    {
+      bool operator ()(const item_type& lhs, const item_type& rhs) const
+      {
+        return lhs.count > rhs.count;
+      }
+    };
+
+    typedef etl::indexed_priority_queue<item_type, SIZE, count_greater> queue_t;
+    typedef typename queue_t::handle_type                               handle_t;
+    typedef etl::flat_map<TKey, handle_t, SIZE, TKeyCompare>            index_t;
+
+    //*************************************************************************
+    static count_type saturating_add(count_type a, count_type b)
+    {
+      const count_type sum = count_type(a + b);
+
+      return (sum < a) ? etl::integral_limits<count_type>::max : sum;
+    }
+
+    queue_t    counters;
+    index_t    index;
+    count_type total_count;
+  };
+}
+
+#endif
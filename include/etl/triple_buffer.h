@@ -0,0 +1,154 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRIPLE_BUFFER_INCLUDED
+#define ETL_TRIPLE_BUFFER_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup triple_buffer triple_buffer
+/// Hands the latest whole frame from one producer to one consumer.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup triple_buffer
+  /// Three buffers of T shared by one producer and one consumer.
+  /// The producer fills its back buffer and publishes it by swapping it with
+  /// the spare buffer. The consumer takes the latest published buffer by
+  /// swapping its front buffer with the spare. Each swap is one atomic exchange,
+  /// so neither side ever waits or fails. Frames that the consumer does not
+  /// take in time are overwritten by newer ones.
+  ///\code
+  /// // Producer
+  /// fill(buffer.back());
+  /// buffer.publish();
+  ///
+  /// // Consumer
+  /// buffer.update();
+  /// use(buffer.front());
+  ///\endcode
+  //***************************************************************************
+  template <typename T>
+  class triple_buffer
+  {
+  public:
+
+    typedef T value_type;
+
+    triple_buffer()
+      : back_index(0U),
+        front_index(1U),
+        spare(2U)
+    {
+    }
+
+    //*************************************************************************
+    /// The buffer that the producer fills.
+    /// Only to be called by the producer.
+    //*************************************************************************
+    T& back()
+    {
+      return buffers[back_index];
+    }
+
+    //*************************************************************************
+    /// Publishes the back buffer. The producer gets a new back buffer.
+    /// Only to be called by the producer.
+    //*************************************************************************
+    void publish()
+    {
+      back_index = spare.exchange(back_index | FRESH, etl::memory_order_acq_rel) & INDEX;
+    }
+
+    //*************************************************************************
+    /// Takes the latest published buffer as the front buffer, if there is one.
+    /// Only to be called by the consumer.
+    ///\return <b>true</b> if the front buffer changed.
+    //*************************************************************************
+    bool update()
+    {
+      if ((spare.load(etl::memory_order_relaxed) & FRESH) == 0U)
+      {
+        return false;
+      }
+
+      front_index = spare.exchange(front_index, etl::memory_order_acq_rel) & INDEX;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The buffer that the consumer reads.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    const T& front() const
+    {
+      return buffers[front_index];
+    }
+
+    //*************************************************************************
+    /// Checks if a buffer has been published and not yet taken.
+    //*************************************************************************
+    bool fresh() const
+    {
+      return (spare.load(etl::memory_order_acquire) & FRESH) != 0U;
+    }
+
+  private:
+
+    static const uint32_t INDEX = 0x03U; ///< The index of the spare buffer.
+    static const uint32_t FRESH = 0x04U; ///< The spare buffer has been published.
+
+    // Disabled.
+    triple_buffer(const triple_buffer&);
+    triple_buffer& operator =(const triple_buffer&);
+
+    T                     buffers[3];
+    uint32_t              back_index;  ///< Owned by the producer.
+#if ETL_CACHE_LINE_SIZE > 0
+    char                  padding1[ETL_CACHE_LINE_SIZE];
+#endif
+    uint32_t              front_index; ///< Owned by the consumer.
+#if ETL_CACHE_LINE_SIZE > 0
+    char                  padding2[ETL_CACHE_LINE_SIZE];
+#endif
+    etl::atomic<uint32_t> spare;       ///< The spare index and fresh flag.
+  };
+}
+
+#endif
+#endif
@@ -85,6 +85,122 @@ namespace etl
     typedef T2 type2;
   };
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_TYPE_LOOKUP_FORCE_CPP03)
+  namespace private_type_lookup
+  {
+    //*************************************************************************
+    /// The type for the id, or etl::null_type<0> if there is none.
+    //*************************************************************************
+    template <int ID, typename... TTypes>
+    struct type_from_id
+    {
+      typedef etl::null_type<0> type;
+    };
+
+    template <int ID, typename T1, typename... TRest>
+    struct type_from_id<ID, T1, TRest...>
+    {
+      typedef typename etl::conditional<ID == T1::ID, typename T1::type, typename type_from_id<ID, TRest...>::type>::type type;
+    };
+
+    //*************************************************************************
+    /// The id for the type, or UINT_MAX if there is none.
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct id_from_type
+    {
+      static const unsigned int value = UINT_MAX;
+    };
+
+    template <typename T, typename T1, typename... TRest>
+    struct id_from_type<T, T1, TRest...>
+    {
+      static const unsigned int value = etl::is_same<T, typename T1::type>::value ? (unsigned int)T1::ID : id_from_type<T, TRest...>::value;
+    };
+
+    //*************************************************************************
+    /// The type mapped from the type, or etl::null_type<0> if there is none.
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct type_from_type
+    {
+      typedef etl::null_type<0> type;
+    };
+
+    template <typename T, typename T1, typename... TRest>
+    struct type_from_type<T, T1, TRest...>
+    {
+      typedef typename etl::conditional<etl::is_same<T, typename T1::type1>::value, typename T1::type2, typename type_from_type<T, TRest...>::type>::type type;
+    };
+  }
+
+  //***************************************************************************
+  /// For any number of types.
+  //***************************************************************************
+  template <typename... TTypes>
+  struct type_id_lookup
+  {
+  public:
+
+    //************************************
+    template <int ID>
+    struct type_from_id
+    {
+      typedef typename private_type_lookup::type_from_id<ID, TTypes...>::type type;
+
+      ETL_STATIC_ASSERT(!(etl::is_same<etl::null_type<0>, type>::value), "Invalid id");
+    };
+
+    //************************************
+    enum
+    {
+      UNKNOWN = UINT_MAX
+    };
+
+    template <typename T>
+    struct id_from_type
+    {
+      enum
+      {
+        value = private_type_lookup::id_from_type<T, TTypes...>::value
+      };
+
+      ETL_STATIC_ASSERT(((unsigned int)value != (unsigned int)UNKNOWN), "Invalid type");
+    };
+
+    //************************************
+    template <typename T>
+    static unsigned int get_id_from_type(const T&)
+    {
+      return get_id_from_type<T>();
+    }
+
+    //************************************
+    template <typename T>
+    static unsigned int get_id_from_type()
+    {
+      return id_from_type<T>::value;
+    }
+  };
+
+  //***************************************************************************
+  /// For any number of types.
+  //***************************************************************************
+  template <typename... TTypes>
+  struct type_type_lookup
+  {
+  public:
+
+    //************************************
+    template <typename T>
+    struct type_from_type
+    {
+      typedef typename private_type_lookup::type_from_type<T, TTypes...>::type type;
+
+      ETL_STATIC_ASSERT(!(etl::is_same<etl::null_type<0>, type>::value), "Invalid type");
+    };
+  };
+#else
   /*[[[cog
   import cog
   cog.outl("//***************************************************************************")
@@ -188,6 +304,7 @@ namespace etl
   cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
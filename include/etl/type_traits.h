@@ -69,6 +69,11 @@ SOFTWARE.
   #include <type_traits>
 #endif
 
+// Compilers that can detect trivially copyable class types without the STL.
+#if !defined(ETL_NO_BUILTIN_TYPE_TRAITS) && ((defined(__GNUC__) && (__GNUC__ >= 5)) || defined(__clang__))
+  #define ETL_BUILTIN_IS_TRIVIALLY_COPYABLE
+#endif
+
 namespace etl
 {
 #if defined(ETL_NO_STL) || !ETL_CPP11_SUPPORTED
@@ -464,8 +469,12 @@ namespace etl
 
   //***************************************************************************
   /// is_trivially_copyable
-  /// Only POD types are recognised.
+  /// Uses the compiler intrinsic if available, otherwise only POD types are recognised.
+#if defined(ETL_BUILTIN_IS_TRIVIALLY_COPYABLE)
+  template <typename T> struct is_trivially_copyable : etl::integral_constant<bool, __is_trivially_copyable(T)> {};
+#else
   template <typename T> struct is_trivially_copyable : etl::is_pod<T> {};
+#endif
 
 #if ETL_CPP17_SUPPORTED
   template <typename T>
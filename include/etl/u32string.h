@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "basic_string.h"
 #include "string_view.h"
+#include "string_concat.h"
 #include "hash.h"
 
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
@@ -182,6 +183,17 @@ namespace etl
       this->assign(view.begin(), view.end());
     }
 
+    //*************************************************************************
+    /// From a concatenation.
+    ///\param expression The concatenation.
+    //*************************************************************************
+    template <const size_t N>
+    u32string(const etl::basic_string_concat<value_type, N>& expression)
+      : iu32string(reinterpret_cast<value_type*>(&buffer), MAX_SIZE)
+    {
+      this->assign(expression);
+    }
+
     //*************************************************************************
     /// Returns a sub-string.
     ///\param position The position of the first character. Default = 0.
@@ -226,6 +238,17 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    u32string& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
@@ -242,6 +265,177 @@ namespace etl
     value_type buffer[MAX_SIZE + 1];
   };
 
+  //***************************************************************************
+  /// A u32string implementation that uses a buffer supplied by the caller.
+  /// A buffer of N characters holds a string of up to N - 1 characters.
+  /// Allows strings of differing capacities to share one iu32string interface
+  /// without reserving the worst case inline, for example by taking a block
+  /// from an etl::ipool for the occasional large message.
+  /// The buffer must outlive the string.
+  /// See etl::u32string_hybrid, in string_hybrid.h, for a string that only uses the buffer on overflow.
+  ///\ingroup u32string
+  //***************************************************************************
+  class u32string_ext : public iu32string
+  {
+  public:
+
+    typedef iu32string base_type;
+    typedef iu32string interface_type;
+
+    typedef iu32string::value_type value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    u32string_ext(value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// From other iu32string.
+    ///\param other The other iu32string.
+    //*************************************************************************
+    u32string_ext(const etl::iu32string& other, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// From a concatenation.
+    ///\param expression The concatenation.
+    //*************************************************************************
+    template <const size_t N>
+    u32string_ext(const etl::basic_string_concat<value_type, N>& expression, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(expression);
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param text The initial text of the string.
+    //*************************************************************************
+    u32string_ext(const value_type* text, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(text, text + etl::char_traits<value_type>::length(text));
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text and count.
+    ///\param text  The initial text of the string.
+    ///\param count The number of characters to copy.
+    //*************************************************************************
+    u32string_ext(const value_type* text, size_t count, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(text, text + count);
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param initialSize  The initial size of the string.
+    ///\param value        The value to fill the string with.
+    //*************************************************************************
+    u32string_ext(size_t count, value_type c, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->initialise();
+      this->resize(count, c);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    u32string_ext(TIterator first, TIterator last, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// From string_view.
+    ///\param view The string_view.
+    //*************************************************************************
+    u32string_ext(const etl::u32string_view& view, value_type* buffer, size_t buffer_size)
+      : iu32string(buffer, buffer_size - 1U)
+    {
+      this->assign(view.begin(), view.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_ext& operator = (const u32string_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_ext& operator = (const iu32string& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    u32string_ext& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    template <const size_t N>
+    u32string_ext& operator = (const etl::basic_string_concat<value_type, N>& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The external buffer does not move, so there is nothing to do.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Disable copy construction, as there is no buffer to copy to.
+    //*************************************************************************
+    u32string_ext(const u32string_ext&);
+  };
+
   //*************************************************************************
   /// Hash function.
   //*************************************************************************
@@ -251,8 +445,7 @@ namespace etl
   {
     size_t operator()(const etl::iu32string& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::hash_string(text.data(), text.size());
     }
   };
 
@@ -261,8 +454,27 @@ namespace etl
   {
     size_t operator()(const etl::u32string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::hash_string(text.data(), text.size());
+    }
+  };
+
+  template <typename THasher>
+  struct hash_using<THasher, etl::iu32string>
+  {
+    size_t operator()(const etl::iu32string& text) const
+    {
+      return etl::private_hash::hash_bytes_using<THasher>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                          reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+
+  template <typename THasher, const size_t SIZE>
+  struct hash_using<THasher, etl::u32string<SIZE> >
+  {
+    size_t operator()(const etl::u32string<SIZE>& text) const
+    {
+      return etl::private_hash::hash_bytes_using<THasher>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                          reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
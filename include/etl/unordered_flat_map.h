@@ -0,0 +1,1393 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "alignment.h"
+#include "binary.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "nullptr.h"
+
+#undef ETL_FILE
+#define ETL_FILE "55"
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Elements are stored directly in the table and are found by probing groups
+/// of control bytes, each of which holds seven bits of the element's hash.
+/// Iterators and references remain valid until the element is erased.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_iterator : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:iterator", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_unordered_flat_map
+  {
+    //*************************************************************************
+    /// Control byte values.
+    /// A full slot holds the low seven bits of the hash, 0x00 to 0x7F.
+    //*************************************************************************
+    static const uint8_t CTRL_EMPTY   = 0x80U;
+    static const uint8_t CTRL_DELETED = 0xFEU;
+
+    /// The number of control bytes probed at a time.
+    static const size_t GROUP_WIDTH = 8U;
+
+    //*************************************************************************
+    /// A group of control bytes, probed as a single word.
+    /// Each match function returns a mask with the top bit set in each
+    /// matching byte.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      //*******************************
+      explicit group(const uint8_t* ctrl)
+        : word(0U)
+      {
+        // Byte 'i' of the group is always byte 'i' of the word, counting from the least significant.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        memcpy(&word, ctrl, GROUP_WIDTH);
+#else
+        for (size_t i = 0U; i < GROUP_WIDTH; ++i)
+        {
+          word |= uint64_t(ctrl[i]) << (i * 8U);
+        }
+#endif
+      }
+
+      //*******************************
+      /// May report a false positive for a full slot, but never for an
+      /// empty or deleted one.
+      uint64_t match(uint8_t h2) const
+      {
+        const uint64_t x = word ^ (LSBS * h2);
+
+        return (x - LSBS) & ~x & MSBS;
+      }
+
+      //*******************************
+      uint64_t match_empty() const
+      {
+        return (word & ~(word << 6)) & MSBS;
+      }
+
+      //*******************************
+      uint64_t match_empty_or_deleted() const
+      {
+        return (word & ~(word << 7)) & MSBS;
+      }
+
+      //*******************************
+      static size_t lowest(uint64_t mask)
+      {
+        return size_t(etl::count_trailing_zeros(mask)) >> 3;
+      }
+
+      //*******************************
+      static uint64_t clear_lowest(uint64_t mask)
+      {
+        return mask & (mask - 1U);
+      }
+
+    private:
+
+      static const uint64_t LSBS = 0x0101010101010101ULL;
+      static const uint64_t MSBS = 0x8080808080808080ULL;
+
+      uint64_t word;
+    };
+
+    //*************************************************************************
+    /// Spreads the output of the hash function over all of the bits, as many
+    /// hash functions return the integral value unchanged.
+    //*************************************************************************
+    inline size_t mix(size_t hash)
+    {
+      uint64_t h = uint64_t(hash) * 0x9E3779B97F4A7C15ULL;
+
+      return size_t(h ^ (h >> 32));
+    }
+
+    //*************************************************************************
+    /// The number of slots needed for MAX_SIZE elements.
+    /// A power of two that keeps the maximum load at 7/8.
+    //*************************************************************************
+    template <const size_t NEEDED, const size_t SLOTS = GROUP_WIDTH, const bool DONE = (SLOTS >= NEEDED)>
+    struct slots_for
+    {
+      static const size_t value = slots_for<NEEDED, SLOTS * 2U>::value;
+    };
+
+    template <const size_t NEEDED, const size_t SLOTS>
+    struct slots_for<NEEDED, SLOTS, true>
+    {
+      static const size_t value = SLOTS;
+    };
+
+    template <const size_t MAX_SIZE>
+    struct number_of_slots
+    {
+      static const size_t value = slots_for<((MAX_SIZE * 8U) + 6U) / 7U>::value;
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a specific type.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename iunordered_flat_map::value_type      value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pctrl(nullptr),
+          pslots(nullptr),
+          index(0U),
+          number_of_slots(0U)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pctrl(other.pctrl),
+          pslots(other.pslots),
+          index(other.index),
+          number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = next_full(pctrl, index + 1U, number_of_slots);
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pctrl           = other.pctrl;
+        pslots          = other.pslots;
+        index           = other.index;
+        number_of_slots = other.number_of_slots;
+
+        return *this;
+      }
+
+      //*********************************
+      reference operator *()
+      {
+        return pslots[index];
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pslots[index];
+      }
+
+      //*********************************
+      pointer operator &()
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      pointer operator ->()
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.pslots == rhs.pslots) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const uint8_t* pctrl_, pointer pslots_, size_t index_, size_t number_of_slots_)
+        : pctrl(pctrl_),
+          pslots(pslots_),
+          index(index_),
+          number_of_slots(number_of_slots_)
+      {
+      }
+
+      const uint8_t* pctrl;
+      pointer        pslots;
+      size_t         index;
+      size_t         number_of_slots;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename iunordered_flat_map::value_type      value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pctrl(nullptr),
+          pslots(nullptr),
+          index(0U),
+          number_of_slots(0U)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : pctrl(other.pctrl),
+          pslots(other.pslots),
+          index(other.index),
+          number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pctrl(other.pctrl),
+          pslots(other.pslots),
+          index(other.index),
+          number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = next_full(pctrl, index + 1U, number_of_slots);
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pctrl           = other.pctrl;
+        pslots          = other.pslots;
+        index           = other.index;
+        number_of_slots = other.number_of_slots;
+
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &pslots[index];
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.pslots == rhs.pslots) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const uint8_t* pctrl_, const_pointer pslots_, size_t index_, size_t number_of_slots_)
+        : pctrl(pctrl_),
+          pslots(pslots_),
+          index(index_),
+          number_of_slots(number_of_slots_)
+      {
+      }
+
+      const uint8_t* pctrl;
+      const_pointer  pslots;
+      size_t         index;
+      size_t         number_of_slots;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(pctrl, pslots, next_full(pctrl, 0U, number_of_slots), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(pctrl, pslots, next_full(pctrl, 0U, number_of_slots), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pctrl, pslots, number_of_slots, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pctrl, pslots, number_of_slots, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots in the table.
+    /// Each slot may be thought of as a bucket that holds one element.
+    ///\return The number of slots.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots in the table.
+    ///\return The number of slots.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if a new
+    /// element is needed and the unordered_flat_map is already full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      const size_t hash  = private_unordered_flat_map::mix(key_hash_function(key));
+      size_t       index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        index = insert_new(value_type(key, T()), hash);
+      }
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i = find(key);
+
+      ETL_ASSERT(i != end(), ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return i->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i = find(key);
+
+      ETL_ASSERT(i != end(), ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return i->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& key_value_pair)
+    {
+      const size_t hash  = private_unordered_flat_map::mix(key_hash_function(key_value_pair.first));
+      size_t       index = find_index(key_value_pair.first, hash);
+      bool         inserted = false;
+
+      if (index == number_of_slots)
+      {
+        index    = insert_new(key_value_pair, hash);
+        inserted = true;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(pctrl, pslots, index, number_of_slots), inserted);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const value_type& key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = find_index(key, private_unordered_flat_map::mix(key_hash_function(key)));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      const size_t index = ielement.index;
+
+      erase_slot(index);
+
+      return iterator(pctrl, pslots, next_full(pctrl, index + 1U, number_of_slots), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      while (first_ != last_)
+      {
+        first_ = erase(first_);
+      }
+
+      return iterator(pctrl, pslots, last_.index, number_of_slots);
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return find(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return find(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a hash that has already been calculated.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key, size_t key_hash)
+    {
+      return iterator(pctrl, pslots, find_index(key, private_unordered_flat_map::mix(key_hash)), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a hash that has already been calculated.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key, size_t key_hash) const
+    {
+      return const_iterator(pctrl, pslots, find_index(key, private_unordered_flat_map::mix(key_hash)), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return find(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return find(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type
+    /// and a hash that has already been calculated.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    iterator find(const K& key, size_t key_hash)
+    {
+      return iterator(pctrl, pslots, find_index(key, private_unordered_flat_map::mix(key_hash)), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type
+    /// and a hash that has already been calculated.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    const_iterator find(const K& key, size_t key_hash) const
+    {
+      return const_iterator(pctrl, pslots, find_index(key, private_unordered_flat_map::mix(key_hash)), number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with a key comparable with 'key'.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with a key comparable with 'key'.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_map(uint8_t* pctrl_, pointer pslots_, size_t number_of_slots_, size_t max_size_)
+      : pctrl(pctrl_),
+        pslots(pslots_),
+        number_of_slots(number_of_slots_),
+        MAX_SIZE(max_size_),
+        current_size(0U)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (is_full(pctrl[i]))
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT
+          }
+        }
+      }
+
+      memset(pctrl, private_unordered_flat_map::CTRL_EMPTY, number_of_slots);
+      current_size = 0U;
+    }
+
+  private:
+
+    //*********************************************************************
+    static bool is_full(uint8_t ctrl)
+    {
+      return (ctrl & 0x80U) == 0U;
+    }
+
+    //*********************************************************************
+    /// Returns the index of the first full slot at or after 'index'.
+    //*********************************************************************
+    static size_t next_full(const uint8_t* pctrl, size_t index, size_t number_of_slots)
+    {
+      while ((index < number_of_slots) && !is_full(pctrl[index]))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// The first group to probe.
+    //*********************************************************************
+    size_t first_group(size_t hash) const
+    {
+      return (hash >> 7) & ((number_of_slots / private_unordered_flat_map::GROUP_WIDTH) - 1U);
+    }
+
+    //*********************************************************************
+    /// Searches for the key.
+    /// Groups are probed using triangular steps, which visit every group.
+    ///\return The index of the slot, or number_of_slots if not found.
+    //*********************************************************************
+    template <typename K>
+    size_t find_index(const K& key, size_t hash) const
+    {
+      using private_unordered_flat_map::group;
+      using private_unordered_flat_map::GROUP_WIDTH;
+
+      const size_t  number_of_groups = number_of_slots / GROUP_WIDTH;
+      const uint8_t h2 = uint8_t(hash & 0x7FU);
+
+      size_t g = first_group(hash);
+
+      for (size_t step = 1U; step <= number_of_groups; ++step)
+      {
+        const size_t base = g * GROUP_WIDTH;
+        const group  grp(pctrl + base);
+
+        uint64_t mask = grp.match(h2);
+
+        while (mask != 0U)
+        {
+          const size_t index = base + group::lowest(mask);
+
+          if (key_equal_function(key, pslots[index].first))
+          {
+            return index;
+          }
+
+          mask = group::clear_lowest(mask);
+        }
+
+        // An empty slot ends the probe sequence.
+        if (grp.match_empty() != 0U)
+        {
+          break;
+        }
+
+        g = (g + step) & (number_of_groups - 1U);
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Constructs a new element in the first free slot of the probe sequence.
+    /// The key must not already exist.
+    ///\return The index of the slot.
+    //*********************************************************************
+    size_t insert_new(const value_type& key_value_pair, size_t hash)
+    {
+      using private_unordered_flat_map::group;
+      using private_unordered_flat_map::GROUP_WIDTH;
+
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+      const size_t number_of_groups = number_of_slots / GROUP_WIDTH;
+
+      size_t g = first_group(hash);
+      size_t index = number_of_slots;
+
+      // There is always a free slot, as the table is never completely full.
+      for (size_t step = 1U; step <= number_of_groups; ++step)
+      {
+        const size_t   base = g * GROUP_WIDTH;
+        const uint64_t mask = group(pctrl + base).match_empty_or_deleted();
+
+        if (mask != 0U)
+        {
+          index = base + group::lowest(mask);
+          break;
+        }
+
+        g = (g + step) & (number_of_groups - 1U);
+      }
+
+      ::new (&pslots[index]) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      pctrl[index] = uint8_t(hash & 0x7FU);
+      ++current_size;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in the slot.
+    /// If the slot's group still has an empty slot then no probe sequence
+    /// can have passed through it, so the slot may be marked as empty.
+    /// Otherwise it is marked as deleted to keep later elements reachable.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      using private_unordered_flat_map::group;
+      using private_unordered_flat_map::GROUP_WIDTH;
+
+      pslots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT
+      --current_size;
+
+      if (current_size == 0U)
+      {
+        memset(pctrl, private_unordered_flat_map::CTRL_EMPTY, number_of_slots);
+      }
+      else
+      {
+        const size_t base = index & ~(GROUP_WIDTH - 1U);
+
+        pctrl[index] = (group(pctrl + base).match_empty() != 0U) ? private_unordered_flat_map::CTRL_EMPTY
+                                                                        : private_unordered_flat_map::CTRL_DELETED;
+      }
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The control bytes.
+    uint8_t* pctrl;
+
+    /// The element slots.
+    pointer pslots;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_t MAX_SIZE;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// The maps are equal if they hold the same keys with equal mapped values.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    typedef typename etl::iunordered_flat_map<TKey, TMapped, THash, TKeyEqual>::const_iterator iterator;
+
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (iterator i = lhs.begin(); i != lhs.end(); ++i)
+    {
+      iterator j = rhs.find(i->first);
+
+      if ((j == rhs.end()) || !(i->second == j->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static const size_t MAX_SIZE        = MAX_SIZE_;
+    static const size_t NUMBER_OF_SLOTS = private_unordered_flat_map::number_of_slots<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map()
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&buffer), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&buffer), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_)
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&buffer), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (const unordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The control bytes.
+    uint8_t ctrl[NUMBER_OF_SLOTS];
+
+    /// The storage for the elements.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * NUMBER_OF_SLOTS, etl::alignment_of<typename base::value_type>::value>::type buffer;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -56,6 +56,9 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 
+#include "private/unordered_node_hash.h"
+#include "private/unordered_bucket_occupancy.h"
+
 #undef ETL_FILE
 #define ETL_FILE "25"
 
@@ -125,9 +128,10 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized unordered_multimap.
   /// Can be used as a reference type for all unordered_multimap containing a specific type.
+  /// TNodeHash selects what each node keeps of its key's hash. See etl::unordered_node_hash_none.
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
   class iunordered_multimap
   {
   public:
@@ -149,7 +153,7 @@ namespace etl
 
     typedef etl::forward_link<0> link_t; // Default link.
 
-    struct node_t : public link_t // The nodes that store the elements.
+    struct node_t : public link_t, public TNodeHash::storage // The nodes that store the elements.
     {
       node_t(const value_type& key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -163,6 +167,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy occupancy_t;
 
   public:
 
@@ -195,8 +200,9 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -209,15 +215,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -237,7 +240,8 @@ namespace etl
       //*********************************
       iterator operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -294,8 +298,9 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -325,7 +330,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -356,16 +362,18 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_multimap::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -378,16 +386,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -407,7 +411,8 @@ namespace etl
       //*********************************
       const_iterator operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -446,8 +451,9 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -477,7 +483,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -490,7 +497,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -499,7 +506,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -508,7 +515,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -544,7 +551,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -553,7 +560,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -562,7 +569,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -661,77 +668,62 @@ namespace etl
     //*********************************************************************
     iterator insert(const value_type& key_value_pair)
     {
-      iterator result = end();
-
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-      const key_type&    key = key_value_pair.first;
-
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key_value_pair.first);
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = find_insert_position(*pbucket, key_value_pair.first, hash);
 
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = *pnodepool->allocate<node_t>();
-        ::new (&node.key_value_pair) value_type(key_value_pair);
-        ETL_INCREMENT_DEBUG_COUNT
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(key_value_pair);
 
-        // Just add the pointer to the bucket;
-        bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(pbucket);
-
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
-      }
-      else
-      {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
-
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key_value_pair.first == key)
-          {
-            break;
-          }
+      return link_node(pbucket, inode_previous, node, hash);
+    }
 
-          ++inode_previous;
-          ++inode;
-        }
+    //*********************************************************************
+    /// Inserts a value to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const value_type& key_value_pair)
+    {
+      return insert(key_value_pair);
+    }
 
-        // Get a new node.
-        node_t& node = *pnodepool->allocate<node_t>();
-        ::new (&node.key_value_pair) value_type(key_value_pair);
-        ETL_INCREMENT_DEBUG_COUNT
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(value_type&& key_value_pair)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-        // Add the node to the end of the bucket;
-        bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
-        ++inode_previous;
+      const size_t hash = key_hash_function(key_value_pair.first);
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = find_insert_position(*pbucket, key_value_pair.first, hash);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
-      }
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
 
-      return result;
+      return link_node(pbucket, inode_previous, node, hash);
     }
 
     //*********************************************************************
-    /// Inserts a value to the unordered_multimap.
+    /// Moves a value in to the unordered_multimap.
     /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
     ///\param position The position to insert at.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(const_iterator, const value_type& key_value_pair)
+    iterator insert(const_iterator, value_type&& key_value_pair)
     {
-      return insert(key_value_pair);
+      return insert(etl::move(key_value_pair));
     }
+#endif
 
     //*********************************************************************
     /// Inserts a range of values to the unordered_multimap.
@@ -757,7 +749,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t bucket_id = hash % number_of_buckets;
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -766,7 +759,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (icurrent->key_value_pair.first == key)
+        if (icurrent->hash_may_match(hash) && (icurrent->key_value_pair.first == key))
         {
           bucket.erase_after(iprevious);          // Unlink from the bucket.
           icurrent->key_value_pair.~value_type(); // Destroy the value.
@@ -794,7 +787,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(pbuckets, &occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -826,7 +819,7 @@ namespace etl
     iterator erase(const_iterator first_, const_iterator last_)
     {
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(pbuckets, &occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket   = first_.get_bucket_list_iterator();
@@ -858,10 +851,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = pbuckets + occupancy.find_next(size_t(pbucket - pbuckets) + 1U);
 
             iprevious = pbucket->before_begin();
             icurrent = pbucket->begin();
@@ -913,7 +903,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -928,9 +919,9 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_may_match(hash) && key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(pbuckets, &occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -947,7 +938,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -962,9 +954,9 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_may_match(hash) && key_equal_function(key, inode->key_value_pair.first))
           {
-            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return const_iterator(pbuckets, &occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1108,15 +1100,32 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_multimap& operator = (iunordered_multimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, occupancy_t::element_t* poccupied_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        occupancy(poccupied_, number_of_buckets_)
     {
     }
 
@@ -1127,44 +1136,105 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0; i < number_of_buckets; ++i)
+        // For each occupied bucket...
+        for (size_t i = occupancy.find_next(0U); i < number_of_buckets; i = occupancy.find_next(i + 1U))
         {
           bucket_t& bucket = pbuckets[i];
 
-          if (!bucket.empty())
+          // For each item in the bucket...
+          local_iterator it = bucket.begin();
+
+          while (it != bucket.end())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
-            {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
-            }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+            // Destroy the value contents.
+            it->key_value_pair.~value_type();
+            ++it;
+            ETL_DECREMENT_DEBUG_COUNT
           }
+
+          // Now it's safe to clear the bucket.
+          bucket.clear();
         }
 
         // Now it's safe to clear the entire pool in one go.
         pnodepool->release_all();
       }
 
+      occupancy.reset();
+
       first = pbuckets;
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_multimap in to this one.
+    /// The other container is left empty.
+    //*********************************************************************
+    void move_clone(iunordered_multimap& other)
+    {
+      clear();
+
+      iterator itr = other.begin();
+
+      while (itr != other.end())
+      {
+        insert(etl::move(*itr));
+        ++itr;
+      }
+
+      other.clear();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Finds the node after which a new node for the key should be linked.
+    /// Nodes with equal keys are kept together.
+    //*********************************************************************
+    local_iterator find_insert_position(bucket_t& bucket, const key_type& key, size_t hash) const
+    {
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (inode->hash_may_match(hash) && (inode->key_value_pair.first == key))
+        {
+          break;
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      return inode_previous;
+    }
+
+    //*********************************************************************
+    /// Links a new node in to the bucket after inode_previous.
+    //*********************************************************************
+    iterator link_node(bucket_t* pbucket, local_iterator inode_previous, node_t& node, size_t hash)
+    {
+      node.store_hash(hash);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      pbucket->insert_after(inode_previous, node);
+      adjust_first_last_markers_after_insert(pbucket);
+      ++inode_previous;
+
+      return iterator(pbuckets, &occupancy, pbucket, inode_previous);
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy.set(size_t(pbucket - pbuckets));
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1188,6 +1258,11 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      if (pbucket->empty())
+      {
+        occupancy.reset(size_t(pbucket - pbuckets));
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1198,27 +1273,18 @@ namespace etl
         if (pbucket == first)
         {
           // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = pbuckets + occupancy.find_next(size_t(first - pbuckets));
         }
         else if (pbucket == last)
         {
           // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pbucket = first;
-          bucket_t* pend = last;
+          const size_t end_index = size_t(last - pbuckets);
+          size_t       index     = size_t(first - pbuckets);
 
-          last = first;
-
-          while (pbucket != pend)
+          while (index <= end_index)
           {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
-
-            ++pbucket;
+            last  = pbuckets + index;
+            index = occupancy.find_next(index + 1U);
           }
         }
         else
@@ -1240,6 +1306,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// Which buckets hold nodes.
+    occupancy_t occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1276,8 +1345,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator ==(const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -1289,8 +1358,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator !=(const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1298,12 +1367,12 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multimap implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
+  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TNodeHash>
   {
   private:
 
-    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual> base;
+    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TNodeHash> base;
 
   public:
 
@@ -1314,7 +1383,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_multimap()
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::initialise();
     }
@@ -1323,11 +1392,22 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_multimap(const unordered_multimap& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(other.cbegin(), other.cend());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_multimap(unordered_multimap&& other)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
+    {
+      base::move_clone(other);
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -1336,7 +1416,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_multimap(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1363,6 +1443,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_multimap& operator = (unordered_multimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_multimap.
@@ -1370,6 +1466,9 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The occupied bucket flags.
+    etl::private_unordered::bucket_occupancy::element_t occupied[etl::private_unordered::bucket_occupancy::elements<MAX_BUCKETS_>::value];
   };
 }
 
@@ -55,6 +55,9 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 
+#include "private/unordered_node_hash.h"
+#include "private/unordered_bucket_occupancy.h"
+
 #undef ETL_FILE
 #define ETL_FILE "26"
 
@@ -124,9 +127,10 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized unordered_multiset.
   /// Can be used as a reference type for all unordered_multiset containing a specific type.
+  /// TNodeHash selects what each node keeps of its key's hash. See etl::unordered_node_hash_none.
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
   class iunordered_multiset
   {
   public:
@@ -146,7 +150,7 @@ namespace etl
     typedef etl::forward_link<0> link_t;
 
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TNodeHash::storage
     {
       node_t(const value_type& key_)
         : key(key_)
@@ -160,6 +164,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy occupancy_t;
 
   public:
 
@@ -191,8 +196,9 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -205,15 +211,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -233,7 +236,8 @@ namespace etl
       //*********************************
       iterator operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -290,8 +294,9 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -321,7 +326,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -351,16 +357,18 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_multiset::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -373,16 +381,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -402,7 +406,8 @@ namespace etl
       //*********************************
       const_iterator operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -441,8 +446,9 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -472,7 +478,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -485,7 +492,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -494,7 +501,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -503,7 +510,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -539,7 +546,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -548,7 +555,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -557,7 +564,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -656,77 +663,62 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(const value_type& key)
     {
-      ETL_OR_STD::pair<iterator, bool> result(end(), false);
-
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
-
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = *pnodepool->allocate<node_t>();
-        ::new (&node.key) value_type(key);
-        ETL_INCREMENT_DEBUG_COUNT
+      const size_t hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = find_insert_position(*pbucket, key, hash);
 
-        // Just add the pointer to the bucket;
-        bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(key);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
-        result.second = true;
-      }
-      else
-      {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
-
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key == key)
-          {
-            break;
-          }
+      return ETL_OR_STD::pair<iterator, bool>(link_node(pbucket, inode_previous, node, hash), true);
+    }
 
-          ++inode_previous;
-          ++inode;
-        }
+    //*********************************************************************
+    /// Inserts a value to the unordered_multiset.
+    /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const value_type& key)
+    {
+      return insert(key).first;
+    }
 
-        // Get a new node.
-        node_t& node = *pnodepool->allocate<node_t>();
-        ::new (&node.key) value_type(key);
-        ETL_INCREMENT_DEBUG_COUNT
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_multiset.
+    /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& key)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
-        // Add the node to the end of the bucket;
-        bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
-        ++inode_previous;
+      const size_t hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = find_insert_position(*pbucket, key, hash);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
-        result.second = true;
-      }
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(etl::move(key));
 
-      return result;
+      return ETL_OR_STD::pair<iterator, bool>(link_node(pbucket, inode_previous, node, hash), true);
     }
 
     //*********************************************************************
-    /// Inserts a value to the unordered_multiset.
+    /// Moves a value in to the unordered_multiset.
     /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
     ///\param position The position to insert at.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(const_iterator position, const value_type& key)
+    iterator insert(const_iterator, value_type&& key)
     {
-      return insert(key).first;
+      return insert(etl::move(key)).first;
     }
+#endif
 
     //*********************************************************************
     /// Inserts a range of values to the unordered_multiset.
@@ -752,7 +744,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t bucket_id = hash % number_of_buckets;
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -761,7 +754,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (icurrent->key == key)
+        if (icurrent->hash_may_match(hash) && (icurrent->key == key))
         {
           bucket.erase_after(iprevious);  // Unlink from the bucket.
           icurrent->key.~value_type();    // Destroy the value.
@@ -789,7 +782,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(pbuckets, &occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -821,7 +814,7 @@ namespace etl
     iterator erase(const_iterator first_, const_iterator last_)
     {
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(pbuckets, &occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket   = first_.get_bucket_list_iterator();
@@ -853,10 +846,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = pbuckets + occupancy.find_next(size_t(pbucket - pbuckets) + 1U);
 
             iprevious = pbucket->before_begin();
             icurrent = pbucket->begin();
@@ -908,7 +898,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -923,9 +914,9 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_may_match(hash) && key_equal_function(key, inode->key))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(pbuckets, &occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -942,7 +933,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -957,9 +949,9 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_may_match(hash) && key_equal_function(key, inode->key))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(pbuckets, &occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1103,15 +1095,32 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_multiset& operator = (iunordered_multiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_multiset(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_multiset(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, occupancy_t::element_t* poccupied_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        occupancy(poccupied_, number_of_buckets_)
     {
     }
 
@@ -1122,44 +1131,105 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0; i < number_of_buckets; ++i)
+        // For each occupied bucket...
+        for (size_t i = occupancy.find_next(0U); i < number_of_buckets; i = occupancy.find_next(i + 1U))
         {
           bucket_t& bucket = pbuckets[i];
 
-          if (!bucket.empty())
+          // For each item in the bucket...
+          local_iterator it = bucket.begin();
+
+          while (it != bucket.end())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
-            {
-              // Destroy the value contents.
-              it->key.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
-            }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+            // Destroy the value contents.
+            it->key.~value_type();
+            ++it;
+            ETL_DECREMENT_DEBUG_COUNT
           }
+
+          // Now it's safe to clear the bucket.
+          bucket.clear();
         }
 
         // Now it's safe to clear the entire pool in one go.
         pnodepool->release_all();
       }
 
+      occupancy.reset();
+
       first = pbuckets;
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_multiset in to this one.
+    /// The other container is left empty.
+    //*********************************************************************
+    void move_clone(iunordered_multiset& other)
+    {
+      clear();
+
+      iterator itr = other.begin();
+
+      while (itr != other.end())
+      {
+        insert(etl::move(*itr));
+        ++itr;
+      }
+
+      other.clear();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Finds the node after which a new node for the key should be linked.
+    /// Nodes with equal keys are kept together.
+    //*********************************************************************
+    local_iterator find_insert_position(bucket_t& bucket, const key_type& key, size_t hash) const
+    {
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (inode->hash_may_match(hash) && (inode->key == key))
+        {
+          break;
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      return inode_previous;
+    }
+
+    //*********************************************************************
+    /// Links a new node in to the bucket after inode_previous.
+    //*********************************************************************
+    iterator link_node(bucket_t* pbucket, local_iterator inode_previous, node_t& node, size_t hash)
+    {
+      node.store_hash(hash);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      pbucket->insert_after(inode_previous, node);
+      adjust_first_last_markers_after_insert(pbucket);
+      ++inode_previous;
+
+      return iterator(pbuckets, &occupancy, pbucket, inode_previous);
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy.set(size_t(pbucket - pbuckets));
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1183,6 +1253,11 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      if (pbucket->empty())
+      {
+        occupancy.reset(size_t(pbucket - pbuckets));
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1193,27 +1268,18 @@ namespace etl
         if (pbucket == first)
         {
           // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = pbuckets + occupancy.find_next(size_t(first - pbuckets));
         }
         else if (pbucket == last)
         {
           // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pbucket = first;
-          bucket_t* pend = last;
+          const size_t end_index = size_t(last - pbuckets);
+          size_t       index     = size_t(first - pbuckets);
 
-          last = first;
-
-          while (pbucket != pend)
+          while (index <= end_index)
           {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
-
-            ++pbucket;
+            last  = pbuckets + index;
+            index = occupancy.find_next(index + 1U);
           }
         }
         else
@@ -1235,6 +1301,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// Which buckets hold nodes.
+    occupancy_t occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1271,8 +1340,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator ==(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -1284,8 +1353,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator !=(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1293,12 +1362,12 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multiset implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual>
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
+  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash>
   {
   private:
 
-    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual> base;
+    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual, TNodeHash> base;
 
   public:
 
@@ -1310,7 +1379,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_multiset()
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::initialise();
     }
@@ -1319,11 +1388,22 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_multiset(const unordered_multiset& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(other.cbegin(), other.cend());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_multiset(unordered_multiset&& other)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
+    {
+      base::move_clone(other);
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -1332,7 +1412,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_multiset(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1359,6 +1439,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_multiset& operator = (unordered_multiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_multiset.
@@ -1366,6 +1462,9 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The occupied bucket flags.
+    etl::private_unordered::bucket_occupancy::element_t occupied[etl::private_unordered::bucket_occupancy::elements<MAX_BUCKETS_>::value];
   };
 }
 
@@ -54,8 +54,13 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
+#include "static_assert.h"
 #include "iterator.h"
 
+#include "private/unordered_node_hash.h"
+#include "private/node_handle.h"
+#include "private/unordered_bucket_occupancy.h"
+
 #undef ETL_FILE
 #define ETL_FILE "23"
 
@@ -125,9 +130,10 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized unordered_set.
   /// Can be used as a reference type for all unordered_set containing a specific type.
+  /// TNodeHash selects what each node keeps of its key's hash. See etl::unordered_node_hash_none.
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
   class iunordered_set
   {
   public:
@@ -147,7 +153,7 @@ namespace etl
     typedef etl::forward_link<0> link_t;
 
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TNodeHash::storage
     {
       node_t(const value_type& key_)
         : key(key_)
@@ -161,6 +167,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy occupancy_t;
 
   public:
 
@@ -168,6 +175,14 @@ namespace etl
     typedef typename bucket_t::iterator       local_iterator;
     typedef typename bucket_t::const_iterator local_const_iterator;
 
+    // The buffer types for an unordered_set with external storage.
+    typedef bucket_t               bucket_type;
+    typedef occupancy_t::element_t occupancy_type;
+
+#if ETL_CPP11_SUPPORTED
+    typedef etl::node_handle<value_type, iunordered_set> node_type;
+#endif
+
     //*********************************************************************
     class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TKey>
     {
@@ -192,8 +207,9 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -206,15 +222,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -234,7 +247,8 @@ namespace etl
       //*********************************
       iterator operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -291,8 +305,9 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -322,7 +337,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -352,16 +368,18 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_set::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
-        pbucket(other.pbucket),
+        : pbuckets(other.pbuckets),
+          poccupancy(other.poccupancy),
+          pbucket(other.pbucket),
         inode(other.inode)
       {
       }
@@ -374,16 +392,12 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Jump to the next non-empty bucket.
+          const size_t index = poccupancy->find_next(size_t(pbucket - pbuckets) + 1U);
+          pbucket = pbuckets + index;
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (index < poccupancy->size())
           {
             inode = pbucket->begin();
           }
@@ -403,7 +417,8 @@ namespace etl
       //*********************************
       const_iterator operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pbuckets = other.pbuckets;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -442,8 +457,9 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(bucket_t* pbuckets_, const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : pbuckets(pbuckets_),
+          poccupancy(poccupancy_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -473,7 +489,8 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      bucket_t*          pbuckets;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -486,7 +503,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator(pbuckets + number_of_buckets, first, first->begin());
+      return iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -495,7 +512,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -504,7 +521,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(pbuckets, &occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -540,7 +557,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator(pbuckets + number_of_buckets, last, last->end());
+      return iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -549,7 +566,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -558,7 +575,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(pbuckets, &occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -657,81 +674,130 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(const value_type& key)
     {
-      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+      return insert_hashed(key, key_hash_function(key), false);
+    }
 
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+    //*********************************************************************
+    /// Inserts a value to the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const value_type& key)
+    {
+      return insert(key).first;
+    }
 
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& key)
+    {
+      const size_t hash = key_hash_function(key);
 
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+      return insert_hashed(etl::move(key), hash, false);
+    }
 
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = *pnodepool->allocate<node_t>();
-        ::new (&node.key) value_type(key);
-        ETL_INCREMENT_DEBUG_COUNT
+    //*********************************************************************
+    /// Moves a value in to the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, value_type&& key)
+    {
+      return insert(etl::move(key)).first;
+    }
+#endif
 
-        // Just add the pointer to the bucket;
-        bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Unlinks the element at the position from the unordered_set and returns a
+    /// handle that owns its node. The node is not destroyed or released.
+    ///\param position The position of the element to extract.
+    //*********************************************************************
+    node_type extract(const_iterator position)
+    {
+      bucket_t&      bucket    = position.get_bucket();
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent  = position.get_local_iterator();
 
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
-        result.second = true;
-      }
-      else
+      // Find the node previous to the one we're interested in.
+      while (iprevious->etl_next != &*icurrent)
       {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
+        ++iprevious;
+      }
 
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key == key)
-          {
-            break;
-          }
+      bucket.erase_after(iprevious); // Unlink from the bucket.
+      adjust_first_last_markers_after_erase(&bucket);
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT
 
-          ++inode_previous;
-          ++inode;
-        }
+      node_t& node = *icurrent;
 
-        // Not already there?
-        if (inode == bucket.end())
-        {
-          // Get a new node.
-          node_t& node = *pnodepool->allocate<node_t>();
-          ::new (&node.key) value_type(key);
-          ETL_INCREMENT_DEBUG_COUNT
-
-          // Add the node to the end of the bucket;
-          bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
-          ++inode_previous;
-
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
-          result.second = true;
-        }
+      return node_type(&node.key, &node, pnodepool);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element with the key from the unordered_set and returns a
+    /// handle that owns its node. Returns an empty handle if the key is not found.
+    ///\param key The key of the element to extract.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      const_iterator position = find(key);
+
+      if (position == end())
+      {
+        return node_type();
       }
 
-      return result;
+      return extract(position);
     }
 
     //*********************************************************************
-    /// Inserts a value to the unordered_set.
-    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
-    ///\param position The position to insert at.
-    ///\param value    The value to insert.
+    /// Inserts the node owned by the handle.
+    /// If the node came from the pool used by this unordered_set it is relinked
+    /// without copying, otherwise its value is moved in to a new node.
+    /// If the key already exists the handle keeps its node.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the value must be moved and the unordered_set is already full.
+    ///\param handle The node handle.
     //*********************************************************************
-    iterator insert(const_iterator, const value_type& key)
+    ETL_OR_STD::pair<iterator, bool> insert(node_type&& handle)
     {
-      return insert(key).first;
+      if (handle.empty())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      const key_type& key  = handle.value();
+      const size_t    hash = key_hash_function(key);
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = pbucket->before_begin();
+
+      // Already there?
+      if (!find_insert_position(*pbucket, key, hash, inode_previous))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(find(key), false);
+      }
+
+      if (handle.get_pool() == pnodepool)
+      {
+        node_t& node = *static_cast<node_t*>(handle.release());
+
+        return ETL_OR_STD::pair<iterator, bool>(link_node(pbucket, inode_previous, node, hash), true);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = insert_hashed(etl::move(handle.value()), hash, true);
+      handle = node_type();
+
+      return result;
     }
+#endif
 
     //*********************************************************************
     /// Inserts a range of values to the unordered_set.
@@ -749,6 +815,47 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_set, a batch at a time.
+    /// The keys of each batch are hashed and their buckets prefetched before
+    /// any nodes are linked.
+    /// If assume_unique is true, the caller guarantees that no key in the range
+    /// is already in the unordered_set or repeated in the range, and the buckets are
+    /// not searched for duplicates.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set does not have enough free space.
+    ///\param first         The first element to add. Must be a forward iterator.
+    ///\param last          The last + 1 element to add.
+    ///\param assume_unique Skip the duplicate key checks.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_batch(TIterator first_, TIterator last_, bool assume_unique = false)
+    {
+      static const size_t BATCH_SIZE = 16U;
+
+      size_t hashes[BATCH_SIZE];
+
+      while (first_ != last_)
+      {
+        TIterator batch_first = first_;
+        size_t    batch_size  = 0U;
+
+        // Hash the batch and start fetching the buckets.
+        while ((batch_size < BATCH_SIZE) && (first_ != last_))
+        {
+          const size_t hash = key_hash_function(*first_);
+          ETL_PREFETCH(pbuckets + (hash % number_of_buckets));
+          hashes[batch_size++] = hash;
+          ++first_;
+        }
+
+        // Link the batch.
+        for (size_t i = 0U; i < batch_size; ++i)
+        {
+          insert_hashed(*batch_first++, hashes[i], assume_unique);
+        }
+      }
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -757,7 +864,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t& bucket = pbuckets[index];
 
@@ -765,7 +873,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (icurrent->key != key))
+      while ((icurrent != bucket.end()) && (!icurrent->hash_may_match(hash) || (icurrent->key != key)))
       {
         ++iprevious;
         ++icurrent;
@@ -779,6 +887,7 @@ namespace etl
         pnodepool->release(&*icurrent); // Release it back to the pool.
         adjust_first_last_markers_after_erase(&bucket);
         n = 1;
+        --current_size;
         ETL_DECREMENT_DEBUG_COUNT
       }
 
@@ -792,7 +901,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(pbuckets, &occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -809,6 +918,7 @@ namespace etl
       icurrent->key.~value_type();    // Destroy the value.
       pnodepool->release(&*icurrent); // Release it back to the pool.
       adjust_first_last_markers_after_erase(&bucket);
+      --current_size;
       ETL_DECREMENT_DEBUG_COUNT
 
       return inext;
@@ -824,7 +934,7 @@ namespace etl
     iterator erase(const_iterator first_, const_iterator last_)
     {
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(pbuckets, &occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket   = first_.get_bucket_list_iterator();
@@ -845,6 +955,7 @@ namespace etl
         icurrent->key.~value_type();    // Destroy the value.
         pnodepool->release(&*icurrent); // Release it back to the pool.
         adjust_first_last_markers_after_erase(pbucket);
+        --current_size;
         ETL_DECREMENT_DEBUG_COUNT
 
         icurrent = inext;
@@ -856,10 +967,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = pbuckets + occupancy.find_next(size_t(pbucket - pbuckets) + 1U);
 
             iprevious = pbucket->before_begin();
             icurrent = pbucket->begin();
@@ -895,31 +1003,7 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
-
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
-
-          ++inode;
-        }
-      }
-
-      return end();
+      return find_in_bucket(key, key_hash_function(key));
     }
 
     //*********************************************************************
@@ -929,31 +1013,29 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
-
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
+      return find_in_bucket(key, key_hash_function(key));
+    }
 
-          ++inode;
-        }
-      }
+    //*********************************************************************
+    /// Finds an element, using a hash that has already been calculated.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key, size_t key_hash)
+    {
+      return find_in_bucket(key, key_hash);
+    }
 
-      return end();
+    //*********************************************************************
+    /// Finds an element, using a hash that has already been calculated.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key, size_t key_hash) const
+    {
+      return find_in_bucket(key, key_hash);
     }
 
     //*********************************************************************
@@ -998,12 +1080,119 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return find_in_bucket(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return find_in_bucket(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type
+    /// and a hash that has already been calculated.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    iterator find(const K& key, size_t key_hash)
+    {
+      return find_in_bucket(key, key_hash);
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of a type that is comparable with key_type
+    /// and a hash that has already been calculated.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key      The key to search for.
+    ///\param key_hash The hash of the key, as calculated by hash_function().
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    const_iterator find(const K& key, size_t key_hash) const
+    {
+      return find_in_bucket(key, key_hash);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with a key comparable with 'key'.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with a key comparable with 'key'.
+    /// Only available if the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KHash = THash, typename KEqual = TKeyEqual, typename etl::enable_if<etl::is_transparent<KHash>::value && etl::is_transparent<KEqual>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_set.
     //*************************************************************************
     size_type size() const
     {
-      return pnodepool->size();
+      return current_size;
     }
 
     //*************************************************************************
@@ -1019,7 +1208,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pnodepool->empty();
+      return current_size == 0U;
     }
 
     //*************************************************************************
@@ -1080,16 +1269,42 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_set& operator = (iunordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, occupancy_t::element_t* poccupied_)
       : pnodepool(&node_pool_),
+        current_size(0U),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        occupancy(poccupied_, number_of_buckets_)
+    {
+    }
+
+    //*********************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*********************************************************************
+    etl::ipool& get_node_pool() const
     {
+      return *pnodepool;
     }
 
     //*********************************************************************
@@ -1099,47 +1314,205 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0; i < number_of_buckets; ++i)
+        // Other containers may have nodes in a shared pool.
+        const bool pool_is_shared = (pnodepool->size() != current_size);
+
+        // For each occupied bucket...
+        for (size_t i = occupancy.find_next(0U); i < number_of_buckets; i = occupancy.find_next(i + 1U))
         {
           bucket_t& bucket = pbuckets[i];
 
-          if (!bucket.empty())
+          // For each item in the bucket...
+          local_iterator it = bucket.begin();
+
+          while (it != bucket.end())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
+            node_t& node = *it;
+            ++it;
 
-            while (it != bucket.end())
+            // Destroy the value contents.
+            node.key.~value_type();
+            ETL_DECREMENT_DEBUG_COUNT
+
+            if (pool_is_shared)
             {
-              // Destroy the value contents.
-              it->key.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
+              pnodepool->release(&node);
             }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
           }
+
+          // Now it's safe to clear the bucket.
+          bucket.clear();
         }
 
         // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
+        if (!pool_is_shared)
+        {
+          pnodepool->release_all();
+        }
       }
 
+      current_size = 0U;
+
+      occupancy.reset();
+
       first = pbuckets;
       last = first;
     }
 
-  private:
-
+#if ETL_CPP11_SUPPORTED
     //*********************************************************************
-    /// Adjust the first and last markers according to the new entry.
+    /// Moves the elements of another unordered_set in to this one.
+    /// The other container is left empty.
+    /// The keys are already unique, so the buckets are not searched for duplicates.
     //*********************************************************************
-    void adjust_first_last_markers_after_insert(bucket_t* pbucket)
+    void move_clone(iunordered_set& other)
     {
-      if (size() == 1)
+      clear();
+
+      iterator itr = other.begin();
+
+      while (itr != other.end())
       {
-        first = pbucket;
+        insert_hashed(etl::move(*itr), key_hash_function(*itr), true);
+        ++itr;
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Inserts a value whose key hash has already been calculated.
+    /// If assume_unique is true the bucket is not searched for an existing key.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_hashed(const value_type& key, size_t hash, bool assume_unique)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = pbucket->before_begin();
+
+      // Already there?
+      if (!assume_unique && !find_insert_position(*pbucket, key, hash, inode_previous))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(link_node(pbucket, inode_previous, node, hash), true);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves in a value whose key hash has already been calculated.
+    /// If assume_unique is true the bucket is not searched for an existing key.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_hashed(value_type&& key, size_t hash, bool assume_unique)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      local_iterator inode_previous = pbucket->before_begin();
+
+      // Already there?
+      if (!assume_unique && !find_insert_position(*pbucket, key, hash, inode_previous))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(etl::move(key));
+
+      return ETL_OR_STD::pair<iterator, bool>(link_node(pbucket, inode_previous, node, hash), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the node after which a new node for the key should be linked.
+    /// Returns false if the key is already in the bucket.
+    //*********************************************************************
+    bool find_insert_position(bucket_t& bucket, const key_type& key, size_t hash, local_iterator& inode_previous) const
+    {
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (inode->hash_may_match(hash) && (inode->key == key))
+        {
+          return false;
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Links a new node in to the bucket after inode_previous.
+    //*********************************************************************
+    iterator link_node(bucket_t* pbucket, local_iterator inode_previous, node_t& node, size_t hash)
+    {
+      node.store_hash(hash);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+
+      pbucket->insert_after(inode_previous, node);
+      adjust_first_last_markers_after_insert(pbucket);
+      ++inode_previous;
+
+      return iterator(pbuckets, &occupancy, pbucket, inode_previous);
+    }
+
+    //*********************************************************************
+    /// Searches the bucket selected by the hash for the key.
+    //*********************************************************************
+    template <typename K>
+    iterator find_in_bucket(const K& key, size_t hash) const
+    {
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (inode->hash_may_match(hash) && key_equal_function(key, inode->key))
+          {
+            return iterator(pbuckets, &occupancy, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return iterator(pbuckets, &occupancy, last, last->end());
+    }
+
+    //*********************************************************************
+    /// Adjust the first and last markers according to the new entry.
+    //*********************************************************************
+    void adjust_first_last_markers_after_insert(bucket_t* pbucket)
+    {
+      occupancy.set(size_t(pbucket - pbuckets));
+
+      if (size() == 1)
+      {
+        first = pbucket;
         last = pbucket;
       }
       else
@@ -1160,6 +1533,11 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      if (pbucket->empty())
+      {
+        occupancy.reset(size_t(pbucket - pbuckets));
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1170,27 +1548,18 @@ namespace etl
         if (pbucket == first)
         {
           // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = pbuckets + occupancy.find_next(size_t(first - pbuckets));
         }
         else if (pbucket == last)
         {
           // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pbucket = first;
-          bucket_t* pend = last;
-
-          last = first;
+          const size_t end_index = size_t(last - pbuckets);
+          size_t       index     = size_t(first - pbuckets);
 
-          while (pbucket != pend)
+          while (index <= end_index)
           {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
-
-            ++pbucket;
+            last  = pbuckets + index;
+            index = occupancy.find_next(index + 1U);
           }
         }
         else
@@ -1206,12 +1575,19 @@ namespace etl
     /// The pool of data nodes used in the list.
     pool_t* pnodepool;
 
+    /// The number of elements in this container.
+    /// The pool may be shared with other containers.
+    size_t current_size;
+
     /// The bucket list.
     bucket_t* pbuckets;
 
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// Which buckets hold nodes.
+    occupancy_t occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1248,8 +1624,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_set<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_set<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator ==(const etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -1261,8 +1637,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_set<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_set<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TNodeHash>
+  bool operator !=(const etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>& lhs, const etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1270,12 +1646,12 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_set implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_set : public etl::iunordered_set<TKey, THash, TKeyEqual>
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
+  class unordered_set : public etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>
   {
   private:
 
-    typedef etl::iunordered_set<TKey, THash, TKeyEqual> base;
+    typedef etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash> base;
 
   public:
 
@@ -1286,7 +1662,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_set()
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::initialise();
     }
@@ -1295,11 +1671,22 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_set(const unordered_set& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(other.cbegin(), other.cend());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_set(unordered_set&& other)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
+    {
+      base::move_clone(other);
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -1308,7 +1695,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_set(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1335,6 +1722,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_set& operator = (unordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_clone(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_set.
@@ -1342,6 +1745,327 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The occupied bucket flags.
+    etl::private_unordered::bucket_occupancy::element_t occupied[etl::private_unordered::bucket_occupancy::elements<MAX_BUCKETS_>::value];
+  };
+
+  //*************************************************************************
+  /// A templated unordered_set implementation that uses a pool supplied by the user.
+  /// The number of buckets must be specified.
+  /// Containers that share a pool can pass elements between each other as
+  /// node handles without reallocating them.
+  //*************************************************************************
+  template <typename TKey, size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TNodeHash>
+  class unordered_set<TKey, 0, MAX_BUCKETS_, THash, TKeyEqual, TNodeHash> : public etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>
+  {
+  private:
+
+    typedef iunordered_set<TKey, THash, TKeyEqual, TNodeHash> base;
+
+    ETL_STATIC_ASSERT(MAX_BUCKETS_ > 0U, "The number of buckets must be specified");
+
+  public:
+
+    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    typedef typename base::node_t pool_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit unordered_set(etl::ipool& node_pool)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same pool as the other unordered_set.
+    //*************************************************************************
+    unordered_set(const unordered_set& other)
+      : base(other.get_node_pool(), buckets, MAX_BUCKETS_, occupied)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    /// Uses the same pool as the other unordered_set, so the nodes are relinked.
+    //*************************************************************************
+    unordered_set(unordered_set&& other)
+      : base(other.get_node_pool(), buckets, MAX_BUCKETS_, occupied)
+    {
+      while (!other.empty())
+      {
+        base::insert(other.extract(other.begin()));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_set(TIterator first_, TIterator last_, etl::ipool& node_pool)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
+    {
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_set& operator = (const unordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_set& operator = (unordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+
+        while (!rhs.empty())
+        {
+          base::insert(rhs.extract(rhs.begin()));
+        }
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The buckets of node lists.
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The occupied bucket flags.
+    etl::private_unordered::bucket_occupancy::element_t occupied[etl::private_unordered::bucket_occupancy::elements<MAX_BUCKETS_>::value];
+  };
+  //*************************************************************************
+  /// A templated unordered_set implementation whose pool, buckets and
+  /// occupancy flags are all supplied by the user, so that the capacity may
+  /// be chosen at run time.
+  /// The buffers must outlive the unordered_set.
+  /// The occupancy buffer must have occupancy_size(number_of_buckets) elements.
+  /// unordered_set_ext provides the buffers from a single block of memory.
+  //*************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual, typename TNodeHash>
+  class unordered_set<TKey, 0, 0, THash, TKeyEqual, TNodeHash> : public etl::iunordered_set<TKey, THash, TKeyEqual, TNodeHash>
+  {
+  private:
+
+    typedef iunordered_set<TKey, THash, TKeyEqual, TNodeHash> base;
+
+  public:
+
+    typedef typename base::node_t         pool_type;
+    typedef typename base::bucket_type    bucket_type;
+    typedef typename base::occupancy_type occupancy_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param node_pool         The pool of pool_type that the nodes are allocated from.
+    ///\param pbuckets          The buckets.
+    ///\param number_of_buckets The number of buckets.
+    ///\param poccupied         The occupancy flags.
+    //*************************************************************************
+    unordered_set(etl::ipool& node_pool, bucket_type* pbuckets, size_t number_of_buckets, occupancy_type* poccupied)
+      : base(node_pool, pbuckets, number_of_buckets, poccupied)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// The number of occupancy elements needed for the number of buckets.
+    //*************************************************************************
+    static size_t occupancy_size(size_t number_of_buckets)
+    {
+      return (number_of_buckets + etl::private_unordered::bucket_occupancy::BITS_PER_ELEMENT - 1U) / etl::private_unordered::bucket_occupancy::BITS_PER_ELEMENT;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_set& operator = (const unordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // The buffers belong to the user, so cannot be copied.
+    unordered_set(const unordered_set&);
+  };
+
+  //*************************************************************************
+  /// A templated unordered_set implementation that keeps its buckets,
+  /// occupancy flags and nodes in one buffer supplied by the user, so that
+  /// where the set lives is decided when it is constructed.
+  /// It is an etl::unordered_set<TKey, 0, 0> with the pool, buckets and occupancy
+  /// flags all taken from the one buffer.
+  /// The buffer must be aligned to ALIGNMENT, hold
+  /// buffer_size(max_size, number_of_buckets) bytes and outlive the unordered_set.
+  //*************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TNodeHash = etl::unordered_node_hash_none>
+  class unordered_set_ext : public etl::unordered_set<TKey, 0, 0, THash, TKeyEqual, TNodeHash>
+  {
+  private:
+
+    typedef etl::unordered_set<TKey, 0, 0, THash, TKeyEqual, TNodeHash> base;
+    typedef typename base::pool_type   node_t;
+    typedef typename base::bucket_type bucket_type;
+    typedef etl::pool_ext<node_t>      pool_type;
+
+    typedef etl::private_unordered::buffer_layout<bucket_type, pool_type::ITEM_SIZE, pool_type::ALIGNMENT> layout_t;
+
+  public:
+
+    static const size_t ALIGNMENT = layout_t::ALIGNMENT;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer             The memory for the set.
+    ///\param max_size           The maximum number of elements.
+    ///\param number_of_buckets_ The number of buckets.
+    //*************************************************************************
+    unordered_set_ext(void* buffer, size_t max_size, size_t number_of_buckets_)
+      : base(node_pool, layout_t::buckets(buffer), number_of_buckets_, layout_t::occupancy(buffer, number_of_buckets_)),
+        node_pool(layout_t::nodes(buffer, number_of_buckets_), max_size),
+        pbuckets(layout_t::buckets(buffer)),
+        nbuckets(number_of_buckets_)
+    {
+      construct_buckets();
+    }
+
+    //*************************************************************************
+    /// Constructor, with a bucket for each element.
+    ///\param buffer   The memory for the set.
+    ///\param max_size The maximum number of elements.
+    //*************************************************************************
+    unordered_set_ext(void* buffer, size_t max_size)
+      : base(node_pool, layout_t::buckets(buffer), max_size, layout_t::occupancy(buffer, max_size)),
+        node_pool(layout_t::nodes(buffer, max_size), max_size),
+        pbuckets(layout_t::buckets(buffer)),
+        nbuckets(max_size)
+    {
+      construct_buckets();
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_set_ext(TIterator first_, TIterator last_, void* buffer, size_t max_size, size_t number_of_buckets_)
+      : base(node_pool, layout_t::buckets(buffer), number_of_buckets_, layout_t::occupancy(buffer, number_of_buckets_)),
+        node_pool(layout_t::nodes(buffer, number_of_buckets_), max_size),
+        pbuckets(layout_t::buckets(buffer)),
+        nbuckets(number_of_buckets_)
+    {
+      construct_buckets();
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_set_ext()
+    {
+      base::initialise();
+
+      for (size_t i = 0U; i < nbuckets; ++i)
+      {
+        pbuckets[i].~bucket_type();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed.
+    //*************************************************************************
+    static size_t buffer_size(size_t max_size, size_t number_of_buckets)
+    {
+      return layout_t::size(max_size, number_of_buckets);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of buffer needed, with a bucket for each element.
+    //*************************************************************************
+    static size_t buffer_size(size_t max_size)
+    {
+      return layout_t::size(max_size, max_size);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_set_ext& operator = (const unordered_set_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    //*************************************************************************
+    void construct_buckets()
+    {
+      for (size_t i = 0U; i < nbuckets; ++i)
+      {
+        ::new (&pbuckets[i]) bucket_type();
+      }
+    }
+
+    // The buffer belongs to the user, so cannot be copied.
+    unordered_set_ext(const unordered_set_ext&);
+
+    /// The pool of nodes, in the user's buffer.
+    pool_type node_pool;
+
+    bucket_type* pbuckets;
+    size_t       nbuckets;
   };
 }
 
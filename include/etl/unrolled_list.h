@@ -0,0 +1,1294 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNROLLED_LIST_INCLUDED
+#define ETL_UNROLLED_LIST_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "pool.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "75"
+
+//*****************************************************************************
+///\defgroup unrolled_list unrolled_list
+/// A doubly linked list of small arrays of elements, with the capacity
+/// defined at compile time.
+/// Iteration mostly steps through contiguous memory, so costs close to that
+/// of a vector, while insertion and erasure move at most one node's worth
+/// of elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_exception : public exception
+  {
+  public:
+
+    unrolled_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_full : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_full(string_type file_name_, numeric_type line_number_)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_empty : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_empty(string_type file_name_, numeric_type line_number_)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for unrolled_list.
+  /// Every node but the last is kept at least half full, by splitting full
+  /// nodes on insert and by borrowing from, or merging with, the next node on
+  /// erase.
+  /// Inserts and erases may move the elements of the node they change and of
+  /// its neighbours, and so invalidate iterators to those nodes. Iterators to
+  /// other nodes remain valid.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  class iunrolled_list
+  {
+  private:
+
+    //*************************************************************************
+    /// The header of a node. The elements follow it.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t* previous;
+      node_t* next;
+      size_t  count;
+    };
+
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    /// The offset of the elements from the start of a node.
+    static const size_t ELEMENT_OFFSET = ((sizeof(node_t) + etl::alignment_of<T>::value - 1U) / etl::alignment_of<T>::value) * etl::alignment_of<T>::value;
+
+    /// The alignment of a node.
+    static const size_t NODE_ALIGNMENT = (etl::alignment_of<T>::value > etl::alignment_of<node_t>::value) ? etl::alignment_of<T>::value : etl::alignment_of<node_t>::value;
+
+    //*************************************************************************
+    /// The storage for a node of ELEMENTS elements, for sizing a pool.
+    //*************************************************************************
+    template <const size_t ELEMENTS>
+    struct node_storage
+    {
+      typedef typename etl::aligned_storage<ELEMENT_OFFSET + (ELEMENTS * sizeof(T)), NODE_ALIGNMENT>::type type;
+    };
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, T>
+    {
+    public:
+
+      friend class iunrolled_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_node(nullptr),
+          index(0U)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_node->count)
+        {
+          p_node = p_node->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_node = p_node->previous;
+          index  = p_node->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return iunrolled_list::elements(p_node)[index];
+      }
+
+      pointer operator &() const
+      {
+        return &iunrolled_list::elements(p_node)[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &iunrolled_list::elements(p_node)[index];
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(node_t* p_node_, size_t index_)
+        : p_node(p_node_),
+          index(index_)
+      {
+      }
+
+      node_t* p_node;
+      size_t  index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const T>
+    {
+    public:
+
+      friend class iunrolled_list;
+
+      const_iterator()
+        : p_node(nullptr),
+          index(0U)
+      {
+      }
+
+      const_iterator(const typename iunrolled_list::iterator& other)
+        : p_node(other.p_node),
+          index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_node->count)
+        {
+          p_node = p_node->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_node = p_node->previous;
+          index  = p_node->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return iunrolled_list::elements(p_node)[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &iunrolled_list::elements(p_node)[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &iunrolled_list::elements(p_node)[index];
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(node_t* p_node_, size_t index_)
+        : p_node(p_node_),
+          index(index_)
+      {
+      }
+
+      node_t* p_node;
+      size_t  index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(&terminal, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(terminal_node(), 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(terminal_node(), 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return elements(terminal.next)[0];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return elements(terminal.next)[0];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return elements(terminal.previous)[terminal.previous->count - 1U];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return elements(terminal.previous)[terminal.previous->count - 1U];
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the list does not have enough free space.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value to the list.
+    //*************************************************************************
+    void assign(size_t n, const_reference value)
+    {
+      clear();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an element to the front.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      ::new (open_slot(begin())) T(value);
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      ::new (open_slot(end())) T(value);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves an element to the front.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+      ::new (open_slot(begin())) T(etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Moves an element to the back.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      ::new (open_slot(end())) T(etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the back.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      T* p = ::new (open_slot(end())) T(etl::forward<Args>(args)...);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Constructs an element before the position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator position, Args && ... args)
+    {
+      iterator itr;
+      ::new (open_slot(position, itr)) T(etl::forward<Args>(args)...);
+
+      return itr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the first element.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(cbegin());
+    }
+
+    //*************************************************************************
+    /// Removes the last element.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(--cend());
+    }
+
+    //*************************************************************************
+    /// Inserts a value before the position.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if the list is full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      iterator itr;
+      ::new (open_slot(position, itr)) T(value);
+
+      return itr;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value in before the position.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if the list is full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      iterator itr;
+      ::new (open_slot(position, itr)) T(etl::move(value));
+
+      return itr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a range of values before the position.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if the list is full.
+    //*************************************************************************
+    template <typename TIterator>
+    iterator insert(const_iterator position, TIterator first, TIterator last)
+    {
+      if (first == last)
+      {
+        return iterator(position.p_node, position.index);
+      }
+
+      iterator result = insert(position, *first);
+      iterator itr    = result;
+
+      while (++first != last)
+      {
+        itr = insert(++itr, *first);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Erases the element at the position.
+    ///\return An iterator to the element that followed it.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      node_t*      p_node = position.p_node;
+      const size_t index  = position.index;
+      T*           p      = elements(p_node);
+
+      // Close the gap.
+      p[index].~T();
+
+      for (size_t i = index + 1U; i < p_node->count; ++i)
+      {
+        relocate(&p[i - 1U], &p[i]);
+      }
+
+      --p_node->count;
+      --current_size;
+
+      if (rebalance(p_node))
+      {
+        // The node was released, and was the last.
+        return end();
+      }
+
+      if (index < p_node->count)
+      {
+        return iterator(p_node, index);
+      }
+
+      return iterator(p_node->next, 0U);
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    ///\return An iterator to the element that followed the range.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Erasing may move the elements that 'last' refers to, so count them first.
+      size_t n = size_t(etl::distance(first, last));
+
+      iterator itr(first.p_node, first.index);
+
+      while (n-- != 0U)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Moves all of the elements of the other list to before the position.
+    /// If the lists share a pool the nodes are relinked, so the cost does not
+    /// depend on the size of the other list. Otherwise the elements are moved
+    /// one at a time.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the list does not have room.
+    //*************************************************************************
+    void splice(const_iterator position, iunrolled_list& other)
+    {
+      if ((&other == this) || other.empty())
+      {
+        return;
+      }
+
+      ETL_ASSERT(other.size() <= available(), ETL_ERROR(unrolled_list_full));
+
+      if ((p_node_pool == other.p_node_pool) && (ELEMENTS_PER_NODE == other.ELEMENTS_PER_NODE))
+      {
+        node_t* p_after = position.p_node;
+
+        // Splice at a node boundary.
+        if (position.index != 0U)
+        {
+          p_after = split(position.p_node, position.index);
+        }
+
+        node_t* p_before = p_after->previous;
+        node_t* p_first  = other.terminal.next;
+        node_t* p_last   = other.terminal.previous;
+
+        p_before->next    = p_first;
+        p_first->previous = p_before;
+        p_last->next      = p_after;
+        p_after->previous = p_last;
+
+        current_size += other.current_size;
+
+        other.terminal.next     = &other.terminal;
+        other.terminal.previous = &other.terminal;
+        other.current_size      = 0U;
+
+        // Restore the fill of the nodes at the joins, from the back.
+        if (p_after != &terminal)
+        {
+          rebalance(p_after);
+        }
+
+        rebalance(p_last);
+
+        if (p_before != &terminal)
+        {
+          rebalance(p_before);
+        }
+      }
+      else
+      {
+        iterator itr(position.p_node, position.index);
+
+        for (iterator other_itr = other.begin(); other_itr != other.end(); ++other_itr)
+        {
+#if ETL_CPP11_SUPPORTED
+          itr = insert(itr, etl::move(*other_itr));
+#else
+          itr = insert(itr, *other_itr);
+#endif
+          ++itr;
+        }
+
+        other.clear();
+      }
+    }
+
+    //*************************************************************************
+    /// Erases all of the elements.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Is the list empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the list full?
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size >= MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The maximum number of elements.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The number of elements that may be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// The number of elements that each node holds.
+    //*************************************************************************
+    size_t elements_per_node() const
+    {
+      return ELEMENTS_PER_NODE;
+    }
+
+    //*************************************************************************
+    /// The number of nodes in use.
+    //*************************************************************************
+    size_t node_count() const
+    {
+      size_t n = 0U;
+
+      for (const node_t* p_node = terminal.next; p_node != &terminal; p_node = p_node->next)
+      {
+        ++n;
+      }
+
+      return n;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iunrolled_list(etl::ipool& node_pool, size_t max_size_, size_t elements_per_node_, bool pool_is_shared_)
+      : p_node_pool(&node_pool),
+        current_size(0U),
+        MAX_SIZE(max_size_),
+        ELEMENTS_PER_NODE(elements_per_node_),
+        pool_is_shared(pool_is_shared_)
+    {
+      terminal.previous = &terminal;
+      terminal.next     = &terminal;
+      terminal.count    = 0U;
+    }
+
+    //*************************************************************************
+    /// Destroys the elements and releases the nodes.
+    //*************************************************************************
+    void initialise()
+    {
+      node_t* p_node = terminal.next;
+
+      while (p_node != &terminal)
+      {
+        node_t* p_next = p_node->next;
+        T*      p      = elements(p_node);
+
+        for (size_t i = 0U; i < p_node->count; ++i)
+        {
+          p[i].~T();
+        }
+
+        if (pool_is_shared)
+        {
+          p_node_pool->release(p_node);
+        }
+
+        p_node = p_next;
+      }
+
+      if (!pool_is_shared)
+      {
+        p_node_pool->release_all();
+      }
+
+      terminal.previous = &terminal;
+      terminal.next     = &terminal;
+      current_size      = 0U;
+    }
+
+    /// The pool of nodes.
+    etl::ipool* p_node_pool;
+
+  private:
+
+    //*************************************************************************
+    /// The elements of a node.
+    //*************************************************************************
+    static T* elements(node_t* p_node)
+    {
+      return reinterpret_cast<T*>(reinterpret_cast<char*>(p_node) + ELEMENT_OFFSET);
+    }
+
+    //*************************************************************************
+    /// The sentinel, for the const iterators.
+    //*************************************************************************
+    node_t* terminal_node() const
+    {
+      return const_cast<node_t*>(&terminal);
+    }
+
+    //*************************************************************************
+    /// Moves an element to uninitialised storage.
+    //*************************************************************************
+    static void relocate(T* p_destination, T* p_source)
+    {
+#if ETL_CPP11_SUPPORTED
+      ::new (p_destination) T(etl::move(*p_source));
+#else
+      ::new (p_destination) T(*p_source);
+#endif
+      p_source->~T();
+    }
+
+    //*************************************************************************
+    /// Allocates an empty node and links it after p_previous.
+    //*************************************************************************
+    node_t* create_node_after(node_t* p_previous)
+    {
+      node_t* p_node = p_node_pool->template allocate<node_t>();
+
+      p_node->count            = 0U;
+      p_node->previous         = p_previous;
+      p_node->next             = p_previous->next;
+      p_previous->next->previous = p_node;
+      p_previous->next         = p_node;
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Unlinks a node and returns it to the pool.
+    //*************************************************************************
+    void release_node(node_t* p_node)
+    {
+      p_node->previous->next = p_node->next;
+      p_node->next->previous = p_node->previous;
+
+      p_node_pool->release(p_node);
+    }
+
+    //*************************************************************************
+    /// Moves the elements from 'index' onwards to a new node that follows.
+    /// Returns the new node.
+    //*************************************************************************
+    node_t* split(node_t* p_node, size_t index)
+    {
+      node_t* p_new = create_node_after(p_node);
+      T*      p     = elements(p_node);
+      T*      p_to  = elements(p_new);
+
+      for (size_t i = index; i < p_node->count; ++i)
+      {
+        relocate(p_to++, &p[i]);
+      }
+
+      p_new->count  = p_node->count - index;
+      p_node->count = index;
+
+      return p_new;
+    }
+
+    //*************************************************************************
+    /// Makes room for a new element before the position, and counts it in.
+    /// Returns the uninitialised storage for it.
+    //*************************************************************************
+    T* open_slot(const_iterator position)
+    {
+      iterator itr;
+
+      return open_slot(position, itr);
+    }
+
+    //*************************************************************************
+    /// Makes room for a new element before the position, and counts it in.
+    /// Returns the uninitialised storage for it.
+    ///\param itr Set to the iterator for the new element.
+    //*************************************************************************
+    T* open_slot(const_iterator position, iterator& itr)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      node_t* p_node = position.p_node;
+      size_t  index  = position.index;
+
+      if ((index == 0U) && (p_node->previous != &terminal) && (p_node->previous->count < ELEMENTS_PER_NODE))
+      {
+        // Append to the previous node, rather than shift this one.
+        p_node = p_node->previous;
+        index  = p_node->count;
+      }
+      else if (p_node == &terminal)
+      {
+        // Append to a new node at the end.
+        p_node = create_node_after(terminal.previous);
+        index  = 0U;
+      }
+      else if (p_node->count == ELEMENTS_PER_NODE)
+      {
+        // Split the full node in half.
+        const size_t lower = (ELEMENTS_PER_NODE + 1U) / 2U;
+        node_t*      p_new = split(p_node, lower);
+
+        if (index > lower)
+        {
+          p_node = p_new;
+          index -= lower;
+        }
+      }
+
+      // Shift up the elements after the position.
+      T* p = elements(p_node);
+
+      for (size_t i = p_node->count; i > index; --i)
+      {
+        relocate(&p[i], &p[i - 1U]);
+      }
+
+      ++p_node->count;
+      ++current_size;
+
+      itr = iterator(p_node, index);
+
+      return &p[index];
+    }
+
+    //*************************************************************************
+    /// Refills a node that is less than half full from the next node, by
+    /// borrowing elements or by merging the next node in to it.
+    /// An empty last node is released.
+    /// Returns true if the node was released.
+    //*************************************************************************
+    bool rebalance(node_t* p_node)
+    {
+      const size_t half = ELEMENTS_PER_NODE / 2U;
+
+      while (p_node->count < half)
+      {
+        node_t* p_next = p_node->next;
+
+        if (p_next == &terminal)
+        {
+          break;
+        }
+
+        T* p      = elements(p_node);
+        T* p_from = elements(p_next);
+
+        if ((p_node->count + p_next->count) <= ELEMENTS_PER_NODE)
+        {
+          // Merge.
+          for (size_t i = 0U; i < p_next->count; ++i)
+          {
+            relocate(&p[p_node->count++], &p_from[i]);
+          }
+
+          p_next->count = 0U;
+          release_node(p_next);
+        }
+        else
+        {
+          // Borrow one.
+          relocate(&p[p_node->count++], &p_from[0]);
+
+          for (size_t i = 1U; i < p_next->count; ++i)
+          {
+            relocate(&p_from[i - 1U], &p_from[i]);
+          }
+
+          --p_next->count;
+        }
+      }
+
+      if (p_node->count == 0U)
+      {
+        release_node(p_node);
+        return true;
+      }
+
+      return false;
+    }
+
+    // Disable copy construction.
+    iunrolled_list(const iunrolled_list&);
+
+    node_t       terminal;          ///< The sentinel node, that links the first and last nodes.
+    size_t       current_size;      ///< The number of elements.
+    const size_t MAX_SIZE;          ///< The maximum number of elements.
+    const size_t ELEMENTS_PER_NODE; ///< The capacity of each node.
+    const bool   pool_is_shared;    ///< Do other containers allocate from the pool?
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNROLLED_LIST) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunrolled_list()
+    {
+    }
+#else
+  protected:
+    ~iunrolled_list()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// An unrolled_list with the capacity defined at compile time.
+  /// The pool has enough nodes for MAX_SIZE elements with every node but the
+  /// last half full.
+  ///\tparam T                  The type of the elements.
+  ///\tparam MAX_SIZE_          The maximum number of elements.
+  ///\tparam ELEMENTS_PER_NODE_ The capacity of each node. At least 2.
+  ///\ingroup unrolled_list
+  //*************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE_ = 8U>
+  class unrolled_list : public etl::iunrolled_list<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ELEMENTS_PER_NODE_ >= 2U, "At least two elements per node are required");
+
+    static const size_t MAX_SIZE          = MAX_SIZE_;
+    static const size_t ELEMENTS_PER_NODE = ELEMENTS_PER_NODE_;
+    static const size_t MAX_NODES         = (MAX_SIZE_ / (ELEMENTS_PER_NODE_ / 2U)) + 1U;
+
+    typedef typename etl::iunrolled_list<T>::template node_storage<ELEMENTS_PER_NODE_>::type pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unrolled_list()
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, ELEMENTS_PER_NODE, false)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from size and value.
+    //*************************************************************************
+    explicit unrolled_list(size_t initial_size, const T& value = T())
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, ELEMENTS_PER_NODE, false)
+    {
+      this->assign(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unrolled_list(const unrolled_list& other)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, ELEMENTS_PER_NODE, false)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    template <typename TIterator>
+    unrolled_list(TIterator first, TIterator last)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, ELEMENTS_PER_NODE, false)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unrolled_list(std::initializer_list<T> init)
+      : etl::iunrolled_list<T>(node_pool, MAX_SIZE, ELEMENTS_PER_NODE, false)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unrolled_list()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unrolled_list& operator = (const unrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The pool of nodes used in the list.
+    etl::pool<pool_type, MAX_NODES> node_pool;
+  };
+
+  //*************************************************************************
+  /// An unrolled_list that uses a pool supplied by the user.
+  /// The pool's items must be of pool_type.
+  /// Lists that share a pool are spliced by relinking their nodes.
+  ///\ingroup unrolled_list
+  //*************************************************************************
+  template <typename T, const size_t ELEMENTS_PER_NODE_>
+  class unrolled_list<T, 0, ELEMENTS_PER_NODE_> : public etl::iunrolled_list<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ELEMENTS_PER_NODE_ >= 2U, "At least two elements per node are required");
+
+    static const size_t ELEMENTS_PER_NODE = ELEMENTS_PER_NODE_;
+
+    typedef typename etl::iunrolled_list<T>::template node_storage<ELEMENTS_PER_NODE_>::type pool_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param node_pool The pool of pool_type.
+    ///\param max_size_ The maximum number of elements in this list.
+    //*************************************************************************
+    unrolled_list(etl::ipool& node_pool, size_t max_size_)
+      : etl::iunrolled_list<T>(node_pool, max_size_, ELEMENTS_PER_NODE, true)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unrolled_list()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unrolled_list& operator = (const unrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // Disabled.
+    unrolled_list(const unrolled_list&);
+  };
+
+  //*************************************************************************
+  /// Equal operator.
+  ///\ingroup unrolled_list
+  //*************************************************************************
+  template <typename T>
+  bool operator ==(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //*************************************************************************
+  /// Not equal operator.
+  ///\ingroup unrolled_list
+  //*************************************************************************
+  template <typename T>
+  bool operator !=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,518 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UTF_CONVERSION_INCLUDED
+#define ETL_UTF_CONVERSION_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "string_view.h"
+#include "array_view.h"
+#include "cstring.h"
+#include "u16string.h"
+#include "u32string.h"
+
+///\defgroup utf_conversion utf_conversion
+/// Conversion between UTF-8 in char strings and UTF-16 or UTF-32 in
+/// char16_t and char32_t strings.
+/// The input is validated. Overlong UTF-8 sequences, surrogate code points,
+/// unpaired UTF-16 surrogates and values beyond U+10FFFF are rejected.
+/// Runs of ASCII are converted a word at a time.
+/// The _length functions return the number of output characters needed.
+/// Functions writing to an array_view return the number written.
+/// All return 0 if the input is invalid, or the output is too small. As
+/// valid input that is not empty always produces output, 0 is never a valid
+/// result for it. Functions appending to a string return false, leaving it
+/// unchanged, if the input is invalid or the string does not have room.
+///\ingroup string
+
+namespace etl
+{
+  namespace private_utf_conversion
+  {
+    //*************************************************************************
+    /// Checks whether the next sixteen bytes, eight char16_t or four
+    /// char32_t, are all ASCII.
+    //*************************************************************************
+    inline bool is_ascii_block(const char* p)
+    {
+      uint64_t word[2];
+      memcpy(word, p, sizeof(word));
+
+      return ((word[0] | word[1]) & 0x8080808080808080ULL) == 0U;
+    }
+
+    inline bool is_ascii_block(const char16_t* p)
+    {
+      uint64_t word[2];
+      memcpy(word, p, sizeof(word));
+
+      return ((word[0] | word[1]) & 0xFF80FF80FF80FF80ULL) == 0U;
+    }
+
+    inline bool is_ascii_block(const char32_t* p)
+    {
+      uint64_t word[2];
+      memcpy(word, p, sizeof(word));
+
+      return ((word[0] | word[1]) & 0xFFFFFF80FFFFFF80ULL) == 0U;
+    }
+
+    //*************************************************************************
+    /// Counts output characters.
+    //*************************************************************************
+    template <typename TChar>
+    class counter
+    {
+    public:
+
+      typedef TChar value_type;
+
+      counter()
+        : n(0U)
+      {
+      }
+
+      void put(TChar)
+      {
+        ++n;
+      }
+
+      template <typename TSource>
+      void put_ascii(const TSource*, size_t length)
+      {
+        n += length;
+      }
+
+      size_t size() const
+      {
+        return n;
+      }
+
+    private:
+
+      size_t n;
+    };
+
+    //*************************************************************************
+    /// Writes output characters to a buffer that is large enough.
+    //*************************************************************************
+    template <typename TChar>
+    class writer
+    {
+    public:
+
+      typedef TChar value_type;
+
+      explicit writer(TChar* p_)
+        : p(p_)
+      {
+      }
+
+      void put(TChar c)
+      {
+        *p++ = c;
+      }
+
+      template <typename TSource>
+      void put_ascii(const TSource* source, size_t length)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          *p++ = TChar(source[i]);
+        }
+      }
+
+    private:
+
+      TChar* p;
+    };
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-8, UTF-16 or UTF-32.
+    //*************************************************************************
+    template <typename TOutput>
+    void encode(TOutput& out, char32_t cp, char)
+    {
+      if (cp < 0x80U)
+      {
+        out.put(char(cp));
+      }
+      else if (cp < 0x800U)
+      {
+        out.put(char(0xC0U | (cp >> 6)));
+        out.put(char(0x80U | (cp & 0x3FU)));
+      }
+      else if (cp < 0x10000U)
+      {
+        out.put(char(0xE0U | (cp >> 12)));
+        out.put(char(0x80U | ((cp >> 6) & 0x3FU)));
+        out.put(char(0x80U | (cp & 0x3FU)));
+      }
+      else
+      {
+        out.put(char(0xF0U | (cp >> 18)));
+        out.put(char(0x80U | ((cp >> 12) & 0x3FU)));
+        out.put(char(0x80U | ((cp >> 6) & 0x3FU)));
+        out.put(char(0x80U | (cp & 0x3FU)));
+      }
+    }
+
+    template <typename TOutput>
+    void encode(TOutput& out, char32_t cp, char16_t)
+    {
+      if (cp < 0x10000U)
+      {
+        out.put(char16_t(cp));
+      }
+      else
+      {
+        cp -= 0x10000U;
+        out.put(char16_t(0xD800U | (cp >> 10)));
+        out.put(char16_t(0xDC00U | (cp & 0x3FFU)));
+      }
+    }
+
+    template <typename TOutput>
+    void encode(TOutput& out, char32_t cp, char32_t)
+    {
+      out.put(cp);
+    }
+
+    //*************************************************************************
+    /// Decodes a non-ASCII code point, advancing p.
+    /// Returns false if the sequence is invalid.
+    //*************************************************************************
+    inline bool decode(const char*& p, const char* end, char32_t& cp)
+    {
+      const uint8_t* q = reinterpret_cast<const uint8_t*>(p);
+      const size_t   available = size_t(end - p);
+      const uint8_t  lead = q[0];
+
+      size_t  length;
+      uint8_t low  = 0x80U; // The range of the second byte.
+      uint8_t high = 0xBFU;
+
+      if (lead < 0xC2U)
+      {
+        // A continuation byte, or an overlong two byte sequence.
+        return false;
+      }
+      else if (lead < 0xE0U)
+      {
+        length = 2U;
+        cp     = lead & 0x1FU;
+      }
+      else if (lead < 0xF0U)
+      {
+        length = 3U;
+        cp     = lead & 0x0FU;
+        low    = (lead == 0xE0U) ? 0xA0U : 0x80U; // Overlong.
+        high   = (lead == 0xEDU) ? 0x9FU : 0xBFU; // Surrogates.
+      }
+      else if (lead < 0xF5U)
+      {
+        length = 4U;
+        cp     = lead & 0x07U;
+        low    = (lead == 0xF0U) ? 0x90U : 0x80U; // Overlong.
+        high   = (lead == 0xF4U) ? 0x8FU : 0xBFU; // Beyond U+10FFFF.
+      }
+      else
+      {
+        return false;
+      }
+
+      if ((available < length) || (q[1] < low) || (q[1] > high))
+      {
+        return false;
+      }
+
+      for (size_t i = 1U; i < length; ++i)
+      {
+        if ((q[i] & 0xC0U) != 0x80U)
+        {
+          return false;
+        }
+
+        cp = (cp << 6) | (q[i] & 0x3FU);
+      }
+
+      p += length;
+
+      return true;
+    }
+
+    inline bool decode(const char16_t*& p, const char16_t* end, char32_t& cp)
+    {
+      const char32_t unit = *p;
+
+      if ((unit < 0xD800U) || (unit > 0xDFFFU))
+      {
+        cp = unit;
+        ++p;
+        return true;
+      }
+
+      // Must be a high surrogate followed by a low surrogate.
+      if ((unit > 0xDBFFU) || ((end - p) < 2) || (p[1] < 0xDC00U) || (p[1] > 0xDFFFU))
+      {
+        return false;
+      }
+
+      cp = 0x10000U + (((unit & 0x3FFU) << 10) | (char32_t(p[1]) & 0x3FFU));
+      p += 2;
+
+      return true;
+    }
+
+    inline bool decode(const char32_t*& p, const char32_t*, char32_t& cp)
+    {
+      cp = *p;
+
+      if ((cp > 0x10FFFFU) || ((cp >= 0xD800U) && (cp <= 0xDFFFU)))
+      {
+        return false;
+      }
+
+      ++p;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Converts [begin, end) to 'out'.
+    /// Returns false if the input is invalid.
+    //*************************************************************************
+    template <typename TSource, typename TOutput>
+    bool transcode(const TSource* begin, const TSource* end, TOutput& out)
+    {
+      const size_t BLOCK = 16U / sizeof(TSource);
+
+      while (begin != end)
+      {
+        while ((size_t(end - begin) >= BLOCK) && is_ascii_block(begin))
+        {
+          out.put_ascii(begin, BLOCK);
+          begin += BLOCK;
+        }
+
+        if (begin == end)
+        {
+          break;
+        }
+
+        if (char32_t(*begin) < 0x80U)
+        {
+          out.put(typename TOutput::value_type(*begin));
+          ++begin;
+        }
+        else
+        {
+          char32_t cp;
+
+          if (!decode(begin, end, cp))
+          {
+            return false;
+          }
+
+          encode(out, cp, typename TOutput::value_type());
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The number of output characters, or 0 if the input is invalid.
+    //*************************************************************************
+    template <typename TChar, typename TSource>
+    size_t length(const TSource* begin, const TSource* end)
+    {
+      counter<TChar> out;
+
+      return transcode(begin, end, out) ? out.size() : 0U;
+    }
+
+    //*************************************************************************
+    /// Converts to a buffer.
+    //*************************************************************************
+    template <typename TChar, typename TSource>
+    size_t convert(const TSource* begin, const TSource* end, etl::array_view<TChar> output)
+    {
+      const size_t n = length<TChar>(begin, end);
+
+      if ((n == 0U) || (n > output.size()))
+      {
+        return 0U;
+      }
+
+      writer<TChar> out(output.data());
+      transcode(begin, end, out);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Converts, appending to a string.
+    //*************************************************************************
+    template <typename TChar, typename TSource>
+    bool convert(const TSource* begin, const TSource* end, etl::ibasic_string<TChar>& output)
+    {
+      const size_t n = length<TChar>(begin, end);
+
+      if (((n == 0U) && (begin != end)) || !output.reserve_check(n))
+      {
+        return false;
+      }
+
+      const size_t start = output.size();
+
+      output.resize(start + n);
+
+      writer<TChar> out(output.data() + start);
+      transcode(begin, end, out);
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// The number of UTF-16 characters needed for UTF-8 text.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf8_to_utf16_length(etl::string_view text)
+  {
+    return private_utf_conversion::length<char16_t>(text.begin(), text.end());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 text to UTF-16.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf8_to_utf16(etl::string_view text, etl::array_view<char16_t> out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 text to UTF-16, appending to 'out'.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline bool utf8_to_utf16(etl::string_view text, etl::iu16string& out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// The number of UTF-32 characters needed for UTF-8 text.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf8_to_utf32_length(etl::string_view text)
+  {
+    return private_utf_conversion::length<char32_t>(text.begin(), text.end());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 text to UTF-32.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf8_to_utf32(etl::string_view text, etl::array_view<char32_t> out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 text to UTF-32, appending to 'out'.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline bool utf8_to_utf32(etl::string_view text, etl::iu32string& out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// The number of UTF-8 characters needed for UTF-16 text.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf16_to_utf8_length(etl::u16string_view text)
+  {
+    return private_utf_conversion::length<char>(text.begin(), text.end());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-16 text to UTF-8.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf16_to_utf8(etl::u16string_view text, etl::array_view<char> out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-16 text to UTF-8, appending to 'out'.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline bool utf16_to_utf8(etl::u16string_view text, etl::istring& out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// The number of UTF-8 characters needed for UTF-32 text.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf32_to_utf8_length(etl::u32string_view text)
+  {
+    return private_utf_conversion::length<char>(text.begin(), text.end());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-32 text to UTF-8.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline size_t utf32_to_utf8(etl::u32string_view text, etl::array_view<char> out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-32 text to UTF-8, appending to 'out'.
+  ///\ingroup utf_conversion
+  //***************************************************************************
+  inline bool utf32_to_utf8(etl::u32string_view text, etl::istring& out)
+  {
+    return private_utf_conversion::convert(text.begin(), text.end(), out);
+  }
+}
+
+#endif
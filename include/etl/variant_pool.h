@@ -103,6 +103,30 @@ namespace etl
     }
   };
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_VARIANT_POOL_FORCE_CPP03)
+  namespace private_variant_pool
+  {
+    //*************************************************************************
+    /// Is T a base of any of the types?
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct is_base_of_any : etl::integral_constant<bool, false>
+    {
+    };
+
+    template <typename T, typename T1, typename... TRest>
+    struct is_base_of_any<T, T1, TRest...>
+      : etl::integral_constant<bool, etl::is_base_of<T, T1>::value || is_base_of_any<T, TRest...>::value>
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of objects of any of the types.
+  /// Each item is sized for the largest type.
+  //***************************************************************************
+  template <const size_t MAX_SIZE_, typename T1, typename... TRest>
+#else
   //***************************************************************************
   template <const size_t MAX_SIZE_,
             typename T1,
@@ -121,6 +145,7 @@ namespace etl
             typename T14 = void,
             typename T15 = void,
             typename T16 = void>
+#endif
   class variant_pool
   {
   public:
@@ -141,12 +166,15 @@ namespace etl
     template <typename T>
     T* create()
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -168,12 +196,15 @@ namespace etl
     template <typename T, typename TP1>
     T* create(const TP1& p1)
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -195,12 +226,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2>
     T* create(const TP1& p1, const TP2& p2)
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -222,12 +256,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2, typename TP3>
     T* create(const TP1& p1, const TP2& p2, const TP3& p3)
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -249,12 +286,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
     T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -276,12 +316,15 @@ namespace etl
     template <typename T, typename... Args>
     T* create(Args&&... args)
     {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -303,6 +346,457 @@ namespace etl
     //*************************************************************************
     template <typename T>
     bool destroy(const T* const p)
+    {
+      ETL_STATIC_ASSERT((is_supported<T>::value || is_supported_base<T>::value), "Invalid type");
+
+      p->~T();
+
+      void* vp = reinterpret_cast<char*>(const_cast<T*>(p));
+
+      if (pool.is_in_pool(vp))
+      {
+        pool.release(vp);
+        return true;
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(variant_pool_did_not_create));
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the variant_pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the variant_pool.
+    //*************************************************************************
+    size_t available() const
+    {
+      return pool.available();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the variant_pool.
+    //*************************************************************************
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the variant_pool.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the variant_pool.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return pool.full();
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets a snapshot of the usage of the variant_pool.
+    //*************************************************************************
+    etl::pool_statistics get_statistics() const
+    {
+      return pool.get_statistics();
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      pool.clear_statistics();
+    }
+#endif
+
+  private:
+
+    variant_pool(const variant_pool&);
+    variant_pool& operator =(const variant_pool&);
+
+    // The supported types.
+#if ETL_CPP11_SUPPORTED && !defined(ETL_VARIANT_POOL_FORCE_CPP03)
+    template <typename T>
+    struct is_supported : etl::integral_constant<bool, etl::is_one_of<T, T1, TRest...>::value>
+    {
+    };
+
+    template <typename T>
+    struct is_supported_base : etl::integral_constant<bool, private_variant_pool::is_base_of_any<T, T1, TRest...>::value>
+    {
+    };
+
+    typedef etl::largest<T1, TRest...> largest_t;
+#else
+    template <typename T>
+    struct is_supported : etl::integral_constant<bool,
+      etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value>
+    {
+    };
+
+    template <typename T>
+    struct is_supported_base : etl::integral_constant<bool,
+      etl::is_base_of<T, T1>::value ||
+      etl::is_base_of<T, T2>::value ||
+      etl::is_base_of<T, T3>::value ||
+      etl::is_base_of<T, T4>::value ||
+      etl::is_base_of<T, T5>::value ||
+      etl::is_base_of<T, T6>::value ||
+      etl::is_base_of<T, T7>::value ||
+      etl::is_base_of<T, T8>::value ||
+      etl::is_base_of<T, T9>::value ||
+      etl::is_base_of<T, T10>::value ||
+      etl::is_base_of<T, T11>::value ||
+      etl::is_base_of<T, T12>::value ||
+      etl::is_base_of<T, T13>::value ||
+      etl::is_base_of<T, T14>::value ||
+      etl::is_base_of<T, T15>::value ||
+      etl::is_base_of<T, T16>::value>
+    {
+    };
+
+    typedef etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16> largest_t;
+#endif
+
+    // The pool.
+    etl::generic_pool<largest_t::size, largest_t::alignment, MAX_SIZE> pool;
+  };
+
+  namespace private_variant_pool
+  {
+    //*************************************************************************
+    /// A slab of objects of one type.
+    //*************************************************************************
+    template <typename T, const size_t SIZE>
+    class slab : public etl::pool<T, SIZE>
+    {
+    public:
+
+      ETL_STATIC_ASSERT((SIZE > 0U), "Zero size slab");
+
+      etl::ipool* get()
+      {
+        return this;
+      }
+    };
+
+    //*************************************************************************
+    /// An unused slab.
+    //*************************************************************************
+    template <>
+    class slab<void, 0U>
+    {
+    public:
+
+      etl::ipool* get()
+      {
+        return nullptr;
+      }
+    };
+
+    //*************************************************************************
+    /// The index of T in the type list.
+    //*************************************************************************
+    template <typename T,
+              typename T1,
+              typename T2,
+              typename T3,
+              typename T4,
+              typename T5,
+              typename T6,
+              typename T7,
+              typename T8,
+              typename T9,
+              typename T10,
+              typename T11,
+              typename T12,
+              typename T13,
+              typename T14,
+              typename T15,
+              typename T16>
+    struct type_index
+    {
+      static const size_t value =
+        etl::is_same<T, T1>::value ? 0U :
+        etl::is_same<T, T2>::value ? 1U :
+        etl::is_same<T, T3>::value ? 2U :
+        etl::is_same<T, T4>::value ? 3U :
+        etl::is_same<T, T5>::value ? 4U :
+        etl::is_same<T, T6>::value ? 5U :
+        etl::is_same<T, T7>::value ? 6U :
+        etl::is_same<T, T8>::value ? 7U :
+        etl::is_same<T, T9>::value ? 8U :
+        etl::is_same<T, T10>::value ? 9U :
+        etl::is_same<T, T11>::value ? 10U :
+        etl::is_same<T, T12>::value ? 11U :
+        etl::is_same<T, T13>::value ? 12U :
+        etl::is_same<T, T14>::value ? 13U :
+        etl::is_same<T, T15>::value ? 14U :
+        etl::is_same<T, T16>::value ? 15U :
+        16U;
+    };
+  }
+
+  //***************************************************************************
+  /// A variant pool where each type has its own slab.
+  /// A small type does not take an item sized for the largest type.
+  /// The slab for a type is chosen at compile time, so create and destroy are O(1).
+  /// If ETL_POOL_STATISTICS is defined, each slab also holds the three 32 bit
+  /// counters of its pool.
+  ///\tparam Tn The types.
+  ///\tparam Nn The maximum number of objects of type Tn.
+  //***************************************************************************
+  template <typename T1, const size_t N1,
+            typename T2 = void, const size_t N2 = 0U,
+            typename T3 = void, const size_t N3 = 0U,
+            typename T4 = void, const size_t N4 = 0U,
+            typename T5 = void, const size_t N5 = 0U,
+            typename T6 = void, const size_t N6 = 0U,
+            typename T7 = void, const size_t N7 = 0U,
+            typename T8 = void, const size_t N8 = 0U,
+            typename T9 = void, const size_t N9 = 0U,
+            typename T10 = void, const size_t N10 = 0U,
+            typename T11 = void, const size_t N11 = 0U,
+            typename T12 = void, const size_t N12 = 0U,
+            typename T13 = void, const size_t N13 = 0U,
+            typename T14 = void, const size_t N14 = 0U,
+            typename T15 = void, const size_t N15 = 0U,
+            typename T16 = void, const size_t N16 = 0U>
+  class segregated_variant_pool
+  {
+  public:
+
+    static const size_t MAX_SIZE = N1 + N2 + N3 + N4 + N5 + N6 + N7 + N8 + N9 + N10 + N11 + N12 + N13 + N14 + N15 + N16;
+
+    static const size_t NUMBER_OF_TYPES = 16U;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    segregated_variant_pool()
+    {
+      slabs[0] = slab1.get();
+      slabs[1] = slab2.get();
+      slabs[2] = slab3.get();
+      slabs[3] = slab4.get();
+      slabs[4] = slab5.get();
+      slabs[5] = slab6.get();
+      slabs[6] = slab7.get();
+      slabs[7] = slab8.get();
+      slabs[8] = slab9.get();
+      slabs[9] = slab10.get();
+      slabs[10] = slab11.get();
+      slabs[11] = slab12.get();
+      slabs[12] = slab13.get();
+      slabs[13] = slab14.get();
+      slabs[14] = slab15.get();
+      slabs[15] = slab16.get();
+    }
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Creates the object. Default constructor.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T();
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. One parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1>
+    T* create(const TP1& p1)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Two parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2>
+    T* create(const TP1& p1, const TP2& p2)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Three parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2, typename TP3>
+    T* create(const TP1& p1, const TP2& p2, const TP3& p3)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2, p3);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Four parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
+    T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2, p3, p4);
+        }
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Creates the object from a type. Variadic parameter constructor.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(etl::forward<Args>(args)...);
+        }
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// If T is a base of the created type, the slabs are searched.
+    //*************************************************************************
+    template <typename T>
+    bool destroy(const T* const p)
     {
       ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value ||
                      etl::is_base_of<T, T1>::value ||
@@ -322,13 +816,14 @@ namespace etl
                      etl::is_base_of<T, T15>::value ||
                      etl::is_base_of<T, T16>::value), "Invalid type");
 
-      p->~T();
-
       void* vp = reinterpret_cast<char*>(const_cast<T*>(p));
 
-      if (pool.is_in_pool(vp))
+      etl::ipool* p_slab = find_slab<T>(vp);
+
+      if (p_slab != nullptr)
       {
-        pool.release(vp);
+        p->~T();
+        p_slab->release(vp);
         return true;
       }
       else
@@ -346,12 +841,30 @@ namespace etl
       return MAX_SIZE;
     }
 
+    //*************************************************************************
+    /// Returns the maximum number of items of type T in the variant_pool.
+    //*************************************************************************
+    template <typename T>
+    size_t max_size() const
+    {
+      return get_slab<T>().max_size();
+    }
+
     //*************************************************************************
     /// Returns the number of free items in the variant_pool.
     //*************************************************************************
     size_t available() const
     {
-      return pool.available();
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items of type T in the variant_pool.
+    //*************************************************************************
+    template <typename T>
+    size_t available() const
+    {
+      return get_slab<T>().available();
     }
 
     //*************************************************************************
@@ -359,7 +872,17 @@ namespace etl
     //*************************************************************************
     size_t size() const
     {
-      return pool.size();
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          n += slabs[i]->size();
+        }
+      }
+
+      return n;
     }
 
     //*************************************************************************
@@ -368,7 +891,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pool.empty();
+      return size() == 0U;
     }
 
     //*************************************************************************
@@ -377,18 +900,94 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      return pool.full();
+      return size() == MAX_SIZE;
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets a snapshot of the usage of the slab for the type.
+    //*************************************************************************
+    template <typename T>
+    etl::pool_statistics get_statistics() const
+    {
+      return get_slab<T>().get_statistics();
     }
 
+    //*************************************************************************
+    /// Clears the statistics of all slabs.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          slabs[i]->clear_statistics();
+        }
+      }
+    }
+#endif
+
   private:
 
-    variant_pool(const variant_pool&);
-    variant_pool& operator =(const variant_pool&);
+    //*************************************************************************
+    /// Gets the slab for the type.
+    //*************************************************************************
+    template <typename T>
+    etl::ipool& get_slab() const
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value && !etl::is_same<T, void>::value), "Unsupported type");
 
-    // The pool.
-    etl::generic_pool<etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::size,
-                      etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment,
-                      MAX_SIZE> pool;
+      return *slabs[private_variant_pool::type_index<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value];
+    }
+
+    //*************************************************************************
+    /// Finds the slab that holds the object.
+    //*************************************************************************
+    template <typename T>
+    etl::ipool* find_slab(const void* vp) const
+    {
+      const size_t index = private_variant_pool::type_index<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value;
+
+      if (index < NUMBER_OF_TYPES)
+      {
+        return slabs[index]->is_in_pool(vp) ? slabs[index] : nullptr;
+      }
+
+      // A base type, so search.
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if ((slabs[i] != nullptr) && slabs[i]->is_in_pool(vp))
+        {
+          return slabs[i];
+        }
+      }
+
+      return nullptr;
+    }
+
+    segregated_variant_pool(const segregated_variant_pool&);
+    segregated_variant_pool& operator =(const segregated_variant_pool&);
+
+    // The slabs.
+    private_variant_pool::slab<T1, N1> slab1;
+    private_variant_pool::slab<T2, N2> slab2;
+    private_variant_pool::slab<T3, N3> slab3;
+    private_variant_pool::slab<T4, N4> slab4;
+    private_variant_pool::slab<T5, N5> slab5;
+    private_variant_pool::slab<T6, N6> slab6;
+    private_variant_pool::slab<T7, N7> slab7;
+    private_variant_pool::slab<T8, N8> slab8;
+    private_variant_pool::slab<T9, N9> slab9;
+    private_variant_pool::slab<T10, N10> slab10;
+    private_variant_pool::slab<T11, N11> slab11;
+    private_variant_pool::slab<T12, N12> slab12;
+    private_variant_pool::slab<T13, N13> slab13;
+    private_variant_pool::slab<T14, N14> slab14;
+    private_variant_pool::slab<T15, N15> slab15;
+    private_variant_pool::slab<T16, N16> slab16;
+
+    etl::ipool* slabs[16U];
   };
 }
 
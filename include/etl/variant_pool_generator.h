@@ -115,6 +115,30 @@ namespace etl
     }
   };
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_VARIANT_POOL_FORCE_CPP03)
+  namespace private_variant_pool
+  {
+    //*************************************************************************
+    /// Is T a base of any of the types?
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct is_base_of_any : etl::integral_constant<bool, false>
+    {
+    };
+
+    template <typename T, typename T1, typename... TRest>
+    struct is_base_of_any<T, T1, TRest...>
+      : etl::integral_constant<bool, etl::is_base_of<T, T1>::value || is_base_of_any<T, TRest...>::value>
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of objects of any of the types.
+  /// Each item is sized for the largest type.
+  //***************************************************************************
+  template <const size_t MAX_SIZE_, typename T1, typename... TRest>
+#else
   //***************************************************************************
   /*[[[cog
   import cog
@@ -128,6 +152,7 @@ namespace etl
   cog.outl("          typename T%s = void>" % int(NTypes))
   ]]]*/
   /*[[[end]]]*/
+#endif
   class variant_pool
   {
   public:
@@ -148,22 +173,15 @@ namespace etl
     template <typename T>
     T* create()
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -185,22 +203,15 @@ namespace etl
     template <typename T, typename TP1>
     T* create(const TP1& p1)
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -222,22 +233,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2>
     T* create(const TP1& p1, const TP2& p2)
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -259,22 +263,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2, typename TP3>
     T* create(const TP1& p1, const TP2& p2, const TP3& p3)
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -296,22 +293,15 @@ namespace etl
     template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
     T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
 
       T* p = nullptr;
 
       if (pool.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
@@ -333,31 +323,445 @@ namespace etl
     template <typename T, typename... Args>
     T* create(Args&&... args)
     {
+      ETL_STATIC_ASSERT((is_supported<T>::value), "Unsupported type");
+
+      T* p = nullptr;
+
+      if (pool.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        pool.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = pool.template allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(etl::forward<Args>(args)...);
+        }
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    //*************************************************************************
+    template <typename T>
+    bool destroy(const T* const p)
+    {
+      ETL_STATIC_ASSERT((is_supported<T>::value || is_supported_base<T>::value), "Invalid type");
+
+      p->~T();
+
+      void* vp = reinterpret_cast<char*>(const_cast<T*>(p));
+
+      if (pool.is_in_pool(vp))
+      {
+        pool.release(vp);
+        return true;
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(variant_pool_did_not_create));
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the variant_pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the variant_pool.
+    //*************************************************************************
+    size_t available() const
+    {
+      return pool.available();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the variant_pool.
+    //*************************************************************************
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the variant_pool.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the variant_pool.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return pool.full();
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets a snapshot of the usage of the variant_pool.
+    //*************************************************************************
+    etl::pool_statistics get_statistics() const
+    {
+      return pool.get_statistics();
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      pool.clear_statistics();
+    }
+#endif
+
+  private:
+
+    variant_pool(const variant_pool&);
+    variant_pool& operator =(const variant_pool&);
+
+    // The supported types.
+#if ETL_CPP11_SUPPORTED && !defined(ETL_VARIANT_POOL_FORCE_CPP03)
+    template <typename T>
+    struct is_supported : etl::integral_constant<bool, etl::is_one_of<T, T1, TRest...>::value>
+    {
+    };
+
+    template <typename T>
+    struct is_supported_base : etl::integral_constant<bool, private_variant_pool::is_base_of_any<T, T1, TRest...>::value>
+    {
+    };
+
+    typedef etl::largest<T1, TRest...> largest_t;
+#else
+    template <typename T>
+    struct is_supported : etl::integral_constant<bool,
       /*[[[cog
       import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+      cog.out("etl::is_one_of<T, ")
       for n in range(1, int(NTypes)):
           cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+      cog.outl("T%s>::value>" % int(NTypes))
+      ]]]*/
+      /*[[[end]]]*/
+    {
+    };
+
+    template <typename T>
+    struct is_supported_base : etl::integral_constant<bool,
+      /*[[[cog
+      import cog
+      for n in range(1, int(NTypes)):
+          cog.outl("etl::is_base_of<T, T%s>::value ||" % n)
+      cog.outl("etl::is_base_of<T, T%s>::value>" % int(NTypes))
+      ]]]*/
+      /*[[[end]]]*/
+    {
+    };
+
+    /*[[[cog
+    import cog
+    cog.out("typedef etl::largest<")
+    for n in range(1, int(NTypes)):
+        cog.out("T%s, " % n)
+    cog.outl("T%s> largest_t;" % int(NTypes))
+    ]]]*/
+    /*[[[end]]]*/
+#endif
+
+    // The pool.
+    etl::generic_pool<largest_t::size, largest_t::alignment, MAX_SIZE> pool;
+  };
+
+  namespace private_variant_pool
+  {
+    //*************************************************************************
+    /// A slab of objects of one type.
+    //*************************************************************************
+    template <typename T, const size_t SIZE>
+    class slab : public etl::pool<T, SIZE>
+    {
+    public:
+
+      ETL_STATIC_ASSERT((SIZE > 0U), "Zero size slab");
+
+      etl::ipool* get()
+      {
+        return this;
+      }
+    };
+
+    //*************************************************************************
+    /// An unused slab.
+    //*************************************************************************
+    template <>
+    class slab<void, 0U>
+    {
+    public:
+
+      etl::ipool* get()
+      {
+        return nullptr;
+      }
+    };
+
+    //*************************************************************************
+    /// The index of T in the type list.
+    //*************************************************************************
+    /*[[[cog
+    import cog
+    cog.outl("template <typename T,")
+    for n in range(1, int(NTypes)):
+        cog.outl("          typename T%s," % n)
+    cog.outl("          typename T%s>" % int(NTypes))
+    cog.outl("struct type_index")
+    cog.outl("{")
+    cog.outl("  static const size_t value =")
+    for n in range(1, int(NTypes) + 1):
+        cog.outl("    etl::is_same<T, T%s>::value ? %sU :" % (n, n - 1))
+    cog.outl("    %sU;" % int(NTypes))
+    cog.outl("};")
+    ]]]*/
+    /*[[[end]]]*/
+  }
+
+  //***************************************************************************
+  /// A variant pool where each type has its own slab.
+  /// A small type does not take an item sized for the largest type.
+  /// The slab for a type is chosen at compile time, so create and destroy are O(1).
+  /// If ETL_POOL_STATISTICS is defined, each slab also holds the three 32 bit
+  /// counters of its pool.
+  ///\tparam Tn The types.
+  ///\tparam Nn The maximum number of objects of type Tn.
+  //***************************************************************************
+  /*[[[cog
+  import cog
+  cog.outl("template <typename T1, const size_t N1,")
+  for n in range(2, int(NTypes)):
+      cog.outl("          typename T%s = void, const size_t N%s = 0U," % (n, n))
+  cog.outl("          typename T%s = void, const size_t N%s = 0U>" % (int(NTypes), int(NTypes)))
+  ]]]*/
+  /*[[[end]]]*/
+  class segregated_variant_pool
+  {
+  public:
+
+    /*[[[cog
+    import cog
+    cog.out("static const size_t MAX_SIZE = ")
+    for n in range(1, int(NTypes)):
+        cog.out("N%s + " % n)
+    cog.outl("N%s;" % int(NTypes))
+    cog.outl("")
+    cog.outl("static const size_t NUMBER_OF_TYPES = %sU;" % int(NTypes))
+    ]]]*/
+    /*[[[end]]]*/
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    segregated_variant_pool()
+    {
+      /*[[[cog
+      import cog
+      for n in range(1, int(NTypes) + 1):
+          cog.outl("slabs[%s] = slab%s.get();" % (n - 1, n))
       ]]]*/
       /*[[[end]]]*/
+    }
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Creates the object. Default constructor.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      etl::ipool& slab = get_slab<T>();
 
       T* p = nullptr;
 
-      if (pool.full())
+      if (slab.full())
       {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
       }
       else
       {
-        p = pool.template allocate<T>();
+        p = slab.allocate<T>();
 
         if (p != nullptr)
         {
-          new (p) T(ETL_OR_STD::forward<Args>(args)...);
+          new (p) T();
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. One parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1>
+    T* create(const TP1& p1)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Two parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2>
+    T* create(const TP1& p1, const TP2& p2)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Three parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2, typename TP3>
+    T* create(const TP1& p1, const TP2& p2, const TP3& p3)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2, p3);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates the object. Four parameter constructor.
+    //*************************************************************************
+    template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
+    T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(p1, p2, p3, p4);
+        }
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Creates the object from a type. Variadic parameter constructor.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      etl::ipool& slab = get_slab<T>();
+
+      T* p = nullptr;
+
+      if (slab.full())
+      {
+#if defined(ETL_POOL_STATISTICS)
+        slab.record_failure();
+#endif
+        ETL_ASSERT(false, ETL_ERROR(etl::variant_pool_cannot_create));
+      }
+      else
+      {
+        p = slab.allocate<T>();
+
+        if (p != nullptr)
+        {
+          new (p) T(etl::forward<Args>(args)...);
         }
       }
 
@@ -367,6 +771,7 @@ namespace etl
 
     //*************************************************************************
     /// Destroys the object.
+    /// If T is a base of the created type, the slabs are searched.
     //*************************************************************************
     template <typename T>
     bool destroy(const T* const p)
@@ -388,13 +793,14 @@ namespace etl
       ]]]*/
       /*[[[end]]]*/
 
-      p->~T();
-
       void* vp = reinterpret_cast<char*>(const_cast<T*>(p));
 
-      if (pool.is_in_pool(vp))
+      etl::ipool* p_slab = find_slab<T>(vp);
+
+      if (p_slab != nullptr)
       {
-        pool.release(vp);
+        p->~T();
+        p_slab->release(vp);
         return true;
       }
       else
@@ -412,12 +818,30 @@ namespace etl
       return MAX_SIZE;
     }
 
+    //*************************************************************************
+    /// Returns the maximum number of items of type T in the variant_pool.
+    //*************************************************************************
+    template <typename T>
+    size_t max_size() const
+    {
+      return get_slab<T>().max_size();
+    }
+
     //*************************************************************************
     /// Returns the number of free items in the variant_pool.
     //*************************************************************************
     size_t available() const
     {
-      return pool.available();
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items of type T in the variant_pool.
+    //*************************************************************************
+    template <typename T>
+    size_t available() const
+    {
+      return get_slab<T>().available();
     }
 
     //*************************************************************************
@@ -425,7 +849,17 @@ namespace etl
     //*************************************************************************
     size_t size() const
     {
-      return pool.size();
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          n += slabs[i]->size();
+        }
+      }
+
+      return n;
     }
 
     //*************************************************************************
@@ -434,7 +868,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pool.empty();
+      return size() == 0U;
     }
 
     //*************************************************************************
@@ -443,33 +877,108 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      return pool.full();
+      return size() == MAX_SIZE;
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets a snapshot of the usage of the slab for the type.
+    //*************************************************************************
+    template <typename T>
+    etl::pool_statistics get_statistics() const
+    {
+      return get_slab<T>().get_statistics();
+    }
+
+    //*************************************************************************
+    /// Clears the statistics of all slabs.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if (slabs[i] != nullptr)
+        {
+          slabs[i]->clear_statistics();
+        }
+      }
     }
+#endif
 
   private:
 
-    variant_pool(const variant_pool&);
-    variant_pool& operator =(const variant_pool&);
+    //*************************************************************************
+    /// Gets the slab for the type.
+    //*************************************************************************
+    template <typename T>
+    etl::ipool& get_slab() const
+    {
+      /*[[[cog
+      import cog
+      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+      for n in range(1, int(NTypes)):
+          cog.out("T%s, " % n)
+          if n % 16 == 0:
+              cog.outl("")
+              cog.out("                              ")
+      cog.outl("T%s>::value && !etl::is_same<T, void>::value), \"Unsupported type\");" % int(NTypes))
+      cog.outl("")
+      cog.out("return *slabs[private_variant_pool::type_index<T, ")
+      for n in range(1, int(NTypes)):
+          cog.out("T%s, " % n)
+          if n % 16 == 0:
+              cog.outl("")
+              cog.out("                                                 ")
+      cog.outl("T%s>::value];" % int(NTypes))
+      ]]]*/
+      /*[[[end]]]*/
+    }
 
-    // The pool.
+    //*************************************************************************
+    /// Finds the slab that holds the object.
+    //*************************************************************************
+    template <typename T>
+    etl::ipool* find_slab(const void* vp) const
+    {
+      /*[[[cog
+      import cog
+      cog.out("const size_t index = private_variant_pool::type_index<T, ")
+      for n in range(1, int(NTypes)):
+          cog.out("T%s, " % n)
+          if n % 16 == 0:
+              cog.outl("")
+              cog.out("                                                              ")
+      cog.outl("T%s>::value;" % int(NTypes))
+      ]]]*/
+      /*[[[end]]]*/
+
+      if (index < NUMBER_OF_TYPES)
+      {
+        return slabs[index]->is_in_pool(vp) ? slabs[index] : nullptr;
+      }
+
+      // A base type, so search.
+      for (size_t i = 0U; i < NUMBER_OF_TYPES; ++i)
+      {
+        if ((slabs[i] != nullptr) && slabs[i]->is_in_pool(vp))
+        {
+          return slabs[i];
+        }
+      }
+
+      return nullptr;
+    }
+
+    segregated_variant_pool(const segregated_variant_pool&);
+    segregated_variant_pool& operator =(const segregated_variant_pool&);
+
+    // The slabs.
     /*[[[cog
     import cog
-    cog.out("etl::generic_pool<etl::largest<")
-    for n in range(1, int(NTypes)):
-        cog.out("T%s, " % n)
-        if n % 16 == 0:
-            cog.outl("")
-            cog.out("                  ")
-    cog.outl("T%s>::size," % int(NTypes))
-
-    cog.out("                  etl::largest<")
-    for n in range(1, int(NTypes)):
-        cog.out("T%s, " % n)
-        if n % 16 == 0:
-            cog.outl("")
-            cog.out("                  ")
-    cog.outl("T%s>::alignment," % int(NTypes))
-    cog.outl("                  MAX_SIZE> pool;")
+    for n in range(1, int(NTypes) + 1):
+        cog.outl("private_variant_pool::slab<T%s, N%s> slab%s;" % (n, n, n))
+    cog.outl("")
+    cog.outl("etl::ipool* slabs[%sU];" % int(NTypes))
     ]]]*/
     /*[[[end]]]*/
   };
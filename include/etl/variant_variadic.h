@@ -0,0 +1,667 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_VARIANT_VARIADIC_INCLUDED
+#define ETL_VARIANT_VARIADIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "alignment.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#if ETL_CPP11_SUPPORTED == 0
+#error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "71"
+
+//*****************************************************************************
+///\defgroup variadic_variant variadic_variant
+/// A type safe union of any number of types.
+/// Visitors are dispatched through a table of functions indexed by the type
+/// index, in one indirect call, rather than through a chain of comparisons.
+/// When every type is trivially destructible the variant is too, and nothing
+/// is called when it is destroyed or changes type. When every type is
+/// trivially copyable the variant is too, and copies are a plain memory copy.
+/// etl::variant remains for C++03, and for its reader_type visitors.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The index returned by a variadic_variant that holds no value.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  static const size_t variant_npos = ~size_t(0);
+
+  //***************************************************************************
+  /// Base exception for variadic_variant.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  class variadic_variant_exception : public etl::exception
+  {
+  public:
+
+    variadic_variant_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception raised when accessing a type that is not held, or
+  /// visiting a variant that holds no value.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  class variadic_variant_bad_access : public etl::variadic_variant_exception
+  {
+  public:
+
+    variadic_variant_bad_access(string_type file_name_, numeric_type line_number_)
+      : variadic_variant_exception(ETL_ERROR_TEXT("variadic_variant:bad access", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  template <typename... TTypes>
+  class variadic_variant;
+
+  namespace private_variant_variadic
+  {
+    //*************************************************************************
+    /// The index of T in TTypes, or sizeof...(TTypes) if it is not there.
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct index_of;
+
+    template <typename T>
+    struct index_of<T> : etl::integral_constant<size_t, 0U>
+    {
+    };
+
+    template <typename T, typename THead, typename... TTail>
+    struct index_of<T, THead, TTail...>
+      : etl::integral_constant<size_t, etl::is_same<T, THead>::value ? 0U : 1U + index_of<T, TTail...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The type at index I of TTypes.
+    //*************************************************************************
+    template <size_t I, typename THead, typename... TTail>
+    struct type_at
+    {
+      typedef typename type_at<I - 1U, TTail...>::type type;
+    };
+
+    template <typename THead, typename... TTail>
+    struct type_at<0U, THead, TTail...>
+    {
+      typedef THead type;
+    };
+
+    //*************************************************************************
+    /// True if all of the values are true.
+    //*************************************************************************
+    template <bool... BValues>
+    struct bool_pack;
+
+    template <bool... BValues>
+    struct all_of : etl::is_same<bool_pack<true, BValues...>, bool_pack<BValues..., true> >
+    {
+    };
+
+    //*************************************************************************
+    /// The largest of a list of sizes.
+    //*************************************************************************
+    inline ETL_CONSTEXPR size_t max_of(size_t value)
+    {
+      return value;
+    }
+
+    template <typename... TSizes>
+    inline ETL_CONSTEXPR size_t max_of(size_t first, size_t second, TSizes... rest)
+    {
+      return max_of((first > second) ? first : second, rest...);
+    }
+
+    //*************************************************************************
+    /// The operations on one type, through untyped pointers, for the tables.
+    //*************************************************************************
+    template <typename T>
+    void destroy(void* p)
+    {
+      static_cast<T*>(p)->~T();
+    }
+
+    template <typename T>
+    void copy_construct(void* p, const void* p_other)
+    {
+      ::new (p) T(*static_cast<const T*>(p_other));
+    }
+
+    template <typename T>
+    void move_construct(void* p, void* p_other)
+    {
+      ::new (p) T(etl::move(*static_cast<T*>(p_other)));
+    }
+
+    template <typename T>
+    void copy_assign(void* p, const void* p_other)
+    {
+      *static_cast<T*>(p) = *static_cast<const T*>(p_other);
+    }
+
+    template <typename T>
+    void move_assign(void* p, void* p_other)
+    {
+      *static_cast<T*>(p) = etl::move(*static_cast<T*>(p_other));
+    }
+
+    template <typename TResult, typename TVisitor, typename T>
+    TResult invoke(TVisitor& visitor, void* p)
+    {
+      return visitor(*static_cast<T*>(p));
+    }
+
+    template <typename TResult, typename TVisitor, typename T>
+    TResult invoke_const(TVisitor& visitor, const void* p)
+    {
+      return visitor(*static_cast<const T*>(p));
+    }
+
+    //*************************************************************************
+    /// The raw storage and the type index.
+    /// The primary template is for types that are trivially destructible.
+    //*************************************************************************
+    template <bool TRIVIAL_DESTRUCTOR, typename... TTypes>
+    class storage
+    {
+    public:
+
+      static const size_t COUNT = sizeof...(TTypes);
+
+      typedef typename etl::smallest_uint_for_value<COUNT>::type index_t;
+
+      //***********************************************************************
+      /// Forgets the current value. Nothing needs to be destroyed.
+      //***********************************************************************
+      void reset()
+      {
+        type_index = COUNT;
+      }
+
+      typename etl::aligned_storage<max_of(sizeof(TTypes)...), max_of(etl::alignment_of<TTypes>::value...)>::type data;
+      index_t type_index;
+    };
+
+    //*************************************************************************
+    /// The raw storage and the type index.
+    /// For types that need their destructor calling.
+    //*************************************************************************
+    template <typename... TTypes>
+    class storage<false, TTypes...>
+    {
+    public:
+
+      static const size_t COUNT = sizeof...(TTypes);
+
+      typedef typename etl::smallest_uint_for_value<COUNT>::type index_t;
+
+      storage() = default;
+      storage(const storage&) = default;
+      storage& operator =(const storage&) = default;
+
+      //***********************************************************************
+      ~storage()
+      {
+        reset();
+      }
+
+      //***********************************************************************
+      /// Destroys the current value.
+      //***********************************************************************
+      void reset()
+      {
+        if (type_index != COUNT)
+        {
+          static void (* const table[])(void*) = { &private_variant_variadic::destroy<TTypes>... };
+
+          table[type_index](&data);
+          type_index = COUNT;
+        }
+      }
+
+      typename etl::aligned_storage<max_of(sizeof(TTypes)...), max_of(etl::alignment_of<TTypes>::value...)>::type data;
+      index_t type_index;
+    };
+
+    //*************************************************************************
+    /// Copy and move for types that are all trivially copyable.
+    /// The defaults are a memory copy.
+    //*************************************************************************
+    template <bool TRIVIAL_COPY, typename... TTypes>
+    class copy_base : public storage<all_of<etl::is_trivially_destructible<TTypes>::value...>::value, TTypes...>
+    {
+    };
+
+    //*************************************************************************
+    /// Copy and move for types that are not all trivially copyable.
+    //*************************************************************************
+    template <typename... TTypes>
+    class copy_base<false, TTypes...> : public storage<all_of<etl::is_trivially_destructible<TTypes>::value...>::value, TTypes...>
+    {
+    private:
+
+      typedef storage<all_of<etl::is_trivially_destructible<TTypes>::value...>::value, TTypes...> base_t;
+
+    public:
+
+      copy_base() = default;
+
+      //***********************************************************************
+      copy_base(const copy_base& other)
+      {
+        this->type_index = base_t::COUNT;
+        construct_from(other);
+      }
+
+      //***********************************************************************
+      copy_base(copy_base&& other)
+      {
+        this->type_index = base_t::COUNT;
+        construct_from(etl::move(other));
+      }
+
+      //***********************************************************************
+      copy_base& operator =(const copy_base& other)
+      {
+        if (this != &other)
+        {
+          if ((this->type_index == other.type_index) && (this->type_index != base_t::COUNT))
+          {
+            static void (* const table[])(void*, const void*) = { &private_variant_variadic::copy_assign<TTypes>... };
+
+            table[this->type_index](&this->data, &other.data);
+          }
+          else
+          {
+            this->reset();
+            construct_from(other);
+          }
+        }
+
+        return *this;
+      }
+
+      //***********************************************************************
+      copy_base& operator =(copy_base&& other)
+      {
+        if (this != &other)
+        {
+          if ((this->type_index == other.type_index) && (this->type_index != base_t::COUNT))
+          {
+            static void (* const table[])(void*, void*) = { &private_variant_variadic::move_assign<TTypes>... };
+
+            table[this->type_index](&this->data, &other.data);
+          }
+          else
+          {
+            this->reset();
+            construct_from(etl::move(other));
+          }
+        }
+
+        return *this;
+      }
+
+    private:
+
+      //***********************************************************************
+      void construct_from(const copy_base& other)
+      {
+        if (other.type_index != base_t::COUNT)
+        {
+          static void (* const table[])(void*, const void*) = { &private_variant_variadic::copy_construct<TTypes>... };
+
+          table[other.type_index](&this->data, &other.data);
+          this->type_index = other.type_index;
+        }
+      }
+
+      //***********************************************************************
+      void construct_from(copy_base&& other)
+      {
+        if (other.type_index != base_t::COUNT)
+        {
+          static void (* const table[])(void*, void*) = { &private_variant_variadic::move_construct<TTypes>... };
+
+          table[other.type_index](&this->data, &other.data);
+          this->type_index = other.type_index;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Gives the free functions access to the storage.
+    //*************************************************************************
+    struct access
+    {
+      template <typename... TTypes>
+      static void* data(etl::variadic_variant<TTypes...>& v)
+      {
+        return &v.data;
+      }
+
+      template <typename... TTypes>
+      static const void* data(const etl::variadic_variant<TTypes...>& v)
+      {
+        return &v.data;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A type safe union of any number of types.
+  /// Default constructs to the first type.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename... TTypes>
+  class variadic_variant
+    : private private_variant_variadic::copy_base<private_variant_variadic::all_of<etl::is_trivially_copyable<TTypes>::value...>::value, TTypes...>
+  {
+  private:
+
+    typedef private_variant_variadic::copy_base<private_variant_variadic::all_of<etl::is_trivially_copyable<TTypes>::value...>::value, TTypes...> base_t;
+
+    friend struct private_variant_variadic::access;
+
+    template <typename T>
+    struct index_of : private_variant_variadic::index_of<typename etl::decay<T>::type, TTypes...>
+    {
+    };
+
+    template <typename T>
+    struct is_alternative : etl::integral_constant<bool, (index_of<T>::value < sizeof...(TTypes))>
+    {
+    };
+
+    using base_t::COUNT;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) > 0U, "variadic_variant must have at least one type");
+
+    //*************************************************************************
+    /// The type at index I.
+    //*************************************************************************
+    template <size_t I>
+    struct alternative
+    {
+      typedef typename private_variant_variadic::type_at<I, TTypes...>::type type;
+    };
+
+    //*************************************************************************
+    /// Default constructor. Holds a default constructed first type.
+    //*************************************************************************
+    variadic_variant()
+    {
+      this->type_index = COUNT;
+      emplace<0U>();
+    }
+
+    //*************************************************************************
+    /// Constructs from a value of one of the types.
+    //*************************************************************************
+    template <typename T, typename = typename etl::enable_if<is_alternative<T>::value>::type>
+    variadic_variant(T&& value)
+    {
+      this->type_index = COUNT;
+      emplace<typename etl::decay<T>::type>(etl::forward<T>(value));
+    }
+
+    variadic_variant(const variadic_variant&) = default;
+    variadic_variant(variadic_variant&&) = default;
+    variadic_variant& operator =(const variadic_variant&) = default;
+    variadic_variant& operator =(variadic_variant&&) = default;
+
+    //*************************************************************************
+    /// Assigns a value of one of the types.
+    /// Assigns in place if the variant already holds that type.
+    //*************************************************************************
+    template <typename T, typename = typename etl::enable_if<is_alternative<T>::value>::type>
+    variadic_variant& operator =(T&& value)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      if (this->type_index == index_of<T>::value)
+      {
+        *static_cast<type*>(static_cast<void*>(&this->data)) = etl::forward<T>(value);
+      }
+      else
+      {
+        emplace<type>(etl::forward<T>(value));
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Replaces the value with a T constructed from the arguments.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    T& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(is_alternative<T>::value, "Unsupported type");
+
+      return emplace<index_of<T>::value>(etl::forward<TArgs>(args)...);
+    }
+
+    //*************************************************************************
+    /// Replaces the value with the type at index I, constructed from the arguments.
+    //*************************************************************************
+    template <size_t I, typename... TArgs>
+    typename alternative<I>::type& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(I < sizeof...(TTypes), "Index out of range");
+
+      typedef typename alternative<I>::type type;
+
+      this->reset();
+      type* p = ::new (static_cast<void*>(&this->data)) type(etl::forward<TArgs>(args)...);
+      this->type_index = static_cast<typename base_t::index_t>(I);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// The index of the type held, or etl::variant_npos if the constructor
+    /// of a new value threw.
+    //*************************************************************************
+    size_t index() const
+    {
+      return (this->type_index == COUNT) ? etl::variant_npos : this->type_index;
+    }
+
+    //*************************************************************************
+    /// True if the constructor of a new value threw.
+    //*************************************************************************
+    bool valueless_by_exception() const
+    {
+      return this->type_index == COUNT;
+    }
+
+    //*************************************************************************
+    /// True if the variant holds a T.
+    //*************************************************************************
+    template <typename T>
+    bool is_type() const
+    {
+      return this->type_index == index_of<T>::value;
+    }
+
+    //*************************************************************************
+    /// Gets the value as a T.
+    /// Asserts etl::variadic_variant_bad_access if it is not a T.
+    //*************************************************************************
+    template <typename T>
+    T& get()
+    {
+      ETL_STATIC_ASSERT(is_alternative<T>::value, "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variadic_variant_bad_access));
+
+      return *static_cast<T*>(static_cast<void*>(&this->data));
+    }
+
+    //*************************************************************************
+    /// Gets the value as a T.
+    /// Asserts etl::variadic_variant_bad_access if it is not a T.
+    //*************************************************************************
+    template <typename T>
+    const T& get() const
+    {
+      ETL_STATIC_ASSERT(is_alternative<T>::value, "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variadic_variant_bad_access));
+
+      return *static_cast<const T*>(static_cast<const void*>(&this->data));
+    }
+  };
+
+  //***************************************************************************
+  /// True if the variant holds a T.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  bool holds_alternative(const etl::variadic_variant<TTypes...>& v)
+  {
+    return v.template is_type<T>();
+  }
+
+  //***************************************************************************
+  /// Gets the value as a T.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  T& get(etl::variadic_variant<TTypes...>& v)
+  {
+    return v.template get<T>();
+  }
+
+  template <typename T, typename... TTypes>
+  const T& get(const etl::variadic_variant<TTypes...>& v)
+  {
+    return v.template get<T>();
+  }
+
+  //***************************************************************************
+  /// Gets the value as the type at index I.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <size_t I, typename... TTypes>
+  typename etl::variadic_variant<TTypes...>::template alternative<I>::type& get(etl::variadic_variant<TTypes...>& v)
+  {
+    return v.template get<typename etl::variadic_variant<TTypes...>::template alternative<I>::type>();
+  }
+
+  template <size_t I, typename... TTypes>
+  const typename etl::variadic_variant<TTypes...>::template alternative<I>::type& get(const etl::variadic_variant<TTypes...>& v)
+  {
+    return v.template get<typename etl::variadic_variant<TTypes...>::template alternative<I>::type>();
+  }
+
+  //***************************************************************************
+  /// Gets a pointer to the value if it is a T, otherwise nullptr.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  T* get_if(etl::variadic_variant<TTypes...>* p_v)
+  {
+    return ((p_v != nullptr) && p_v->template is_type<T>()) ? &p_v->template get<T>() : nullptr;
+  }
+
+  template <typename T, typename... TTypes>
+  const T* get_if(const etl::variadic_variant<TTypes...>* p_v)
+  {
+    return ((p_v != nullptr) && p_v->template is_type<T>()) ? &p_v->template get<T>() : nullptr;
+  }
+
+  //***************************************************************************
+  /// Calls the visitor with the value held.
+  /// The visitor must accept every type, and return the same type for each.
+  /// Dispatch is a single indirect call through a table indexed by the type.
+  /// Asserts etl::variadic_variant_bad_access if the variant holds no value.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename TVisitor, typename T1, typename... TTypes>
+  auto visit(TVisitor&& visitor, etl::variadic_variant<T1, TTypes...>& v) -> decltype(visitor(etl::declval<T1&>()))
+  {
+    typedef decltype(visitor(etl::declval<T1&>())) result_t;
+    typedef result_t (*function_t)(TVisitor&, void*);
+
+    static const function_t table[] = { &private_variant_variadic::invoke<result_t, TVisitor, T1>,
+                                        &private_variant_variadic::invoke<result_t, TVisitor, TTypes>... };
+
+    ETL_ASSERT(!v.valueless_by_exception(), ETL_ERROR(variadic_variant_bad_access));
+
+    return table[v.index()](visitor, private_variant_variadic::access::data(v));
+  }
+
+  //***************************************************************************
+  /// Calls the visitor with the value held.
+  ///\ingroup variadic_variant
+  //***************************************************************************
+  template <typename TVisitor, typename T1, typename... TTypes>
+  auto visit(TVisitor&& visitor, const etl::variadic_variant<T1, TTypes...>& v) -> decltype(visitor(etl::declval<const T1&>()))
+  {
+    typedef decltype(visitor(etl::declval<const T1&>())) result_t;
+    typedef result_t (*function_t)(TVisitor&, const void*);
+
+    static const function_t table[] = { &private_variant_variadic::invoke_const<result_t, TVisitor, T1>,
+                                        &private_variant_variadic::invoke_const<result_t, TVisitor, TTypes>... };
+
+    ETL_ASSERT(!v.valueless_by_exception(), ETL_ERROR(variadic_variant_bad_access));
+
+    return table[v.index()](visitor, private_variant_variadic::access::data(v));
+  }
+}
+
+#undef ETL_FILE
+
+#endif
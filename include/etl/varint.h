@@ -0,0 +1,447 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_VARINT_INCLUDED
+#define ETL_VARINT_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "array_view.h"
+#include "binary.h"
+#include "bit_stream.h"
+#include "serialize.h"
+#include "zigzag.h"
+#include "static_assert.h"
+
+///\defgroup varint varint
+/// Unsigned LEB128 varints, as used by protobuf and MQTT lengths.
+/// Seven bits are stored per byte, least significant first, with the top
+/// bit set on every byte but the last. Signed values should be zigzag
+/// encoded first; see etl/zigzag.h.
+/// Varints are encoded to and decoded from raw buffers, single values or
+/// arrays of values, and an etl::bit_stream.
+/// The array decoder examines sixteen bytes at a time. A mask of the
+/// continuation bits locates the end of every varint in the block, and a
+/// block of single byte varints is widened in one step. Define ETL_USE_SSE2
+/// or ETL_USE_NEON in the profile to build the mask with SIMD instructions;
+/// they are only used when the compiler also targets that instruction set.
+///\ingroup binary
+
+#if defined(ETL_USE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_VARINT_SSE2
+  #include <emmintrin.h>
+#elif defined(ETL_USE_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_VARINT_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The maximum number of bytes in the varint of a T.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  struct varint_max_size
+  {
+    static const size_t value = ((CHAR_BIT * sizeof(T)) + 6U) / 7U;
+  };
+
+  template <typename T>
+  const size_t varint_max_size<T>::value;
+
+  //***************************************************************************
+  /// The number of bytes in the varint of a value.
+  ///\ingroup varint
+  //***************************************************************************
+  inline size_t varint_size(uint64_t value)
+  {
+    // One byte per started group of seven bits.
+    const uint_least8_t used_bits = uint_least8_t(64U - etl::count_leading_zeros(uint64_t(value | 1U)));
+
+    return (used_bits + 6U) / 7U;
+  }
+
+  namespace private_varint
+  {
+    //*************************************************************************
+    /// Loads eight bytes, the first as the least significant.
+    //*************************************************************************
+    inline uint64_t load_le64(const uint8_t* p)
+    {
+      return  uint64_t(p[0])        | (uint64_t(p[1]) << 8)  | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+             (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
+
+    //*************************************************************************
+    /// Gathers the seven bit groups of a varint of up to eight bytes,
+    /// loaded by load_le64, into its value.
+    //*************************************************************************
+    inline uint64_t compact(uint64_t word, size_t length)
+    {
+      if (length < 8U)
+      {
+        word &= (uint64_t(1U) << (length * 8U)) - 1U;
+      }
+
+      word &= 0x7F7F7F7F7F7F7F7F;
+      word  = (word & 0x007F007F007F007F) | ((word & 0x7F007F007F007F00) >> 1);
+      word  = (word & 0x00003FFF00003FFF) | ((word & 0x3FFF00003FFF0000) >> 2);
+      word  = (word & 0x000000000FFFFFFF) | ((word & 0x0FFFFFFF00000000) >> 4);
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Decodes one varint byte by byte.
+    /// Returns the number of bytes read, or 0 if the varint is incomplete or
+    /// its value does not fit a T.
+    //*************************************************************************
+    template <typename T>
+    size_t decode_one(const uint8_t* p, size_t length, T& value)
+    {
+      const size_t max_length = etl::varint_max_size<uint64_t>::value;
+
+      uint64_t result = 0U;
+
+      for (size_t i = 0U; (i < length) && (i < max_length); ++i)
+      {
+        const uint64_t group = p[i] & 0x7FU;
+
+        // The tenth byte may only hold the top bit of a uint64_t.
+        if ((i == (max_length - 1U)) && (group > 1U))
+        {
+          return 0U;
+        }
+
+        result |= group << (7U * i);
+
+        if ((p[i] & 0x80U) == 0U)
+        {
+          if (result > uint64_t(etl::integral_limits<T>::max))
+          {
+            return 0U;
+          }
+
+          value = T(result);
+
+          return i + 1U;
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The continuation bits of sixteen bytes, byte i at bit i.
+    //*************************************************************************
+#if defined(ETL_VARINT_SSE2)
+    inline uint32_t continuation_mask(const uint8_t* p)
+    {
+      return uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+    }
+#elif defined(ETL_VARINT_NEON)
+    inline uint32_t continuation_mask(const uint8_t* p)
+    {
+      static const int8_t shifts[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      // Move each top bit to the bit position of its byte, then add across each half.
+      const uint8x16_t bits   = vshlq_u8(vshrq_n_u8(vld1q_u8(p), 7), vld1q_s8(shifts));
+      const uint64x2_t halves = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(bits)));
+
+      return uint32_t(vgetq_lane_u64(halves, 0)) | (uint32_t(vgetq_lane_u64(halves, 1)) << 8);
+    }
+#else
+    inline uint32_t continuation_mask(const uint8_t* p)
+    {
+      // The multiply gathers the eight top bits into the most significant byte.
+      const uint64_t low  = (load_le64(p)      >> 7) & 0x0101010101010101;
+      const uint64_t high = (load_le64(p + 8U) >> 7) & 0x0101010101010101;
+
+      return uint32_t((low  * 0x0102040810204080) >> 56) |
+            (uint32_t((high * 0x0102040810204080) >> 56) << 8);
+    }
+#endif
+
+    //*************************************************************************
+    /// Widens sixteen single byte varints.
+    //*************************************************************************
+    template <typename T>
+    void widen(const uint8_t* p, T* p_out)
+    {
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        p_out[i] = T(p[i]);
+      }
+    }
+
+#if defined(ETL_VARINT_SSE2)
+    inline void widen(const uint8_t* p, uint32_t* p_out)
+    {
+      const __m128i zero  = _mm_setzero_si128();
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i low   = _mm_unpacklo_epi8(bytes, zero);
+      const __m128i high  = _mm_unpackhi_epi8(bytes, zero);
+
+      __m128i* out = reinterpret_cast<__m128i*>(p_out);
+      _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(low, zero));
+      _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+      _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+      _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(ETL_VARINT_NEON)
+    inline void widen(const uint8_t* p, uint32_t* p_out)
+    {
+      const uint8x16_t bytes = vld1q_u8(p);
+      const uint16x8_t low   = vmovl_u8(vget_low_u8(bytes));
+      const uint16x8_t high  = vmovl_u8(vget_high_u8(bytes));
+
+      vst1q_u32(p_out + 0U,  vmovl_u16(vget_low_u16(low)));
+      vst1q_u32(p_out + 4U,  vmovl_u16(vget_high_u16(low)));
+      vst1q_u32(p_out + 8U,  vmovl_u16(vget_low_u16(high)));
+      vst1q_u32(p_out + 12U, vmovl_u16(vget_high_u16(high)));
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Encodes a value to a buffer.
+  /// Returns the number of bytes written, or 0 if there is not enough room.
+  ///\ingroup varint
+  //***************************************************************************
+  inline size_t varint_encode(uint64_t value, etl::array_view<uint8_t> destination)
+  {
+    const size_t length = etl::varint_size(value);
+
+    if (length > destination.size())
+    {
+      return 0U;
+    }
+
+    uint8_t* p = destination.data();
+
+    for (size_t i = 1U; i < length; ++i)
+    {
+      *p++ = uint8_t(value | 0x80U);
+      value >>= 7;
+    }
+
+    *p = uint8_t(value);
+
+    return length;
+  }
+
+  //***************************************************************************
+  /// Encodes an array of unsigned values to a buffer.
+  /// Returns the number of bytes written, or 0 if there is not enough room
+  /// for all of them.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_unsigned<typename etl::remove_cv<T>::type>::value, size_t>::type
+    varint_encode(etl::array_view<T> values, etl::array_view<uint8_t> destination)
+  {
+    uint8_t* p     = destination.data();
+    uint8_t* p_end = p + destination.size();
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      uint64_t value = values[i];
+
+      // Most values take one byte.
+      if ((value < 0x80U) && (p != p_end))
+      {
+        *p++ = uint8_t(value);
+      }
+      else
+      {
+        const size_t length = etl::varint_encode(value, etl::array_view<uint8_t>(p, size_t(p_end - p)));
+
+        if (length == 0U)
+        {
+          return 0U;
+        }
+
+        p += length;
+      }
+    }
+
+    return size_t(p - destination.data());
+  }
+
+  //***************************************************************************
+  /// Decodes a value from the start of a buffer.
+  /// Returns the number of bytes read, or 0 if the varint is incomplete or
+  /// its value does not fit a T.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_unsigned<T>::value, size_t>::type
+    varint_decode(etl::array_view<const uint8_t> source, T& value)
+  {
+    return private_varint::decode_one(source.data(), source.size(), value);
+  }
+
+  //***************************************************************************
+  /// Decodes consecutive varints from a buffer into an array.
+  /// Stops when the destination is full, the source is exhausted, or at a
+  /// varint that is incomplete or does not fit a T.
+  /// Returns the number of values decoded. 'used' is set to the number of
+  /// bytes that they occupied, which is where decoding should resume.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_unsigned<T>::value, size_t>::type
+    varint_decode(etl::array_view<const uint8_t> source, etl::array_view<T> destination, size_t& used)
+  {
+    const uint8_t* p     = source.data();
+    const uint8_t* p_end = p + source.size();
+    T*             q     = destination.data();
+    T*             q_end = q + destination.size();
+
+    // Blocks of sixteen bytes, while a varint starting in the block may be
+    // loaded as eight bytes without reading past the end.
+    while ((p_end - p) >= 24)
+    {
+      uint32_t terminators = ~private_varint::continuation_mask(p) & 0xFFFFU;
+
+      if ((terminators == 0xFFFFU) && ((q_end - q) >= 16))
+      {
+        private_varint::widen(p, q);
+        p += 16;
+        q += 16;
+        continue;
+      }
+
+      size_t position = 0U;
+
+      while ((terminators != 0U) && (q != q_end))
+      {
+        const size_t end    = etl::count_trailing_zeros(terminators);
+        const size_t length = end + 1U - position;
+
+        if (length > 8U)
+        {
+          break;
+        }
+
+        const uint64_t value = private_varint::compact(private_varint::load_le64(p + position), length);
+
+        if (value > uint64_t(etl::integral_limits<T>::max))
+        {
+          used = size_t(p + position - source.data());
+          return size_t(q - destination.data());
+        }
+
+        *q++         = T(value);
+        position     = end + 1U;
+        terminators &= terminators - 1U;
+      }
+
+      if (q == q_end)
+      {
+        p += position;
+        break;
+      }
+
+      if (position == 0U)
+      {
+        // A varint longer than eight bytes.
+        const size_t length = private_varint::decode_one(p, size_t(p_end - p), *q);
+
+        if (length == 0U)
+        {
+          used = size_t(p - source.data());
+          return size_t(q - destination.data());
+        }
+
+        ++q;
+        position = length;
+      }
+
+      p += position;
+    }
+
+    // The tail.
+    while ((p != p_end) && (q != q_end))
+    {
+      const size_t length = private_varint::decode_one(p, size_t(p_end - p), *q);
+
+      if (length == 0U)
+      {
+        break;
+      }
+
+      p += length;
+      ++q;
+    }
+
+    used = size_t(p - source.data());
+
+    return size_t(q - destination.data());
+  }
+
+  //***************************************************************************
+  /// Writes a value to a bit stream.
+  /// Returns false if the stream runs out of room.
+  ///\ingroup varint
+  //***************************************************************************
+  inline bool varint_encode(etl::bit_stream& stream, uint64_t value)
+  {
+    return etl::serialize_varint(stream, value);
+  }
+
+  //***************************************************************************
+  /// Reads a value from a bit stream.
+  /// Returns false if the stream runs out, or the value does not fit a T.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_unsigned<T>::value, bool>::type
+    varint_decode(etl::bit_stream& stream, T& value)
+  {
+    uint64_t result;
+
+    if (!etl::deserialize_varint(stream, result) || (result > uint64_t(etl::integral_limits<T>::max)))
+    {
+      return false;
+    }
+
+    value = T(result);
+
+    return true;
+  }
+}
+
+#endif
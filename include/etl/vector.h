@@ -231,7 +231,7 @@ namespace etl
     //*********************************************************************
     void resize(size_t new_size, T value)
     {
-      ETL_ASSERT(new_size <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(new_size <= CAPACITY, ETL_ERROR(vector_full));
 
       const size_t current_size = size();
       size_t delta = (current_size < new_size) ? new_size - current_size : current_size - new_size;
@@ -285,7 +285,7 @@ namespace etl
     //*********************************************************************
     reference at(size_t i)
     {
-      ETL_ASSERT(i < size(), ETL_ERROR(vector_out_of_bounds));
+      ETL_ASSERT_CONTAINER(i < size(), ETL_ERROR(vector_out_of_bounds));
       return p_buffer[i];
     }
 
@@ -297,7 +297,7 @@ namespace etl
     //*********************************************************************
     const_reference at(size_t i) const
     {
-      ETL_ASSERT(i < size(), ETL_ERROR(vector_out_of_bounds));
+      ETL_ASSERT_CONTAINER(i < size(), ETL_ERROR(vector_out_of_bounds));
       return p_buffer[i];
     }
 
@@ -369,7 +369,7 @@ namespace etl
 
 #if defined(ETL_DEBUG)
       difference_type d = etl::distance(first, last);
-      ETL_ASSERT(static_cast<size_t>(d) <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(static_cast<size_t>(d) <= CAPACITY, ETL_ERROR(vector_full));
 #endif
 
       initialise();
@@ -386,7 +386,7 @@ namespace etl
     //*********************************************************************
     void assign(size_t n, parameter_t value)
     {
-      ETL_ASSERT(n <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(n <= CAPACITY, ETL_ERROR(vector_full));
 
       initialise();
 
@@ -410,9 +410,9 @@ namespace etl
     void push_back(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      create_back(value);
+      push_back_unchecked(value);
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -424,9 +424,9 @@ namespace etl
     void push_back(rvalue_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      create_back(etl::move(value));
+      push_back_unchecked(etl::move(value));
     }
 #endif
 
@@ -440,11 +440,9 @@ namespace etl
     void emplace_back(Args && ... args)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      ::new (p_end) T(etl::forward<Args>(args)...);
-      ++p_end;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(etl::forward<Args>(args)...);
     }
 #else
     //*********************************************************************
@@ -456,11 +454,9 @@ namespace etl
     void emplace_back(const T1& value1)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      ::new (p_end) T(value1);
-      ++p_end;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1);
     }
 
     //*********************************************************************
@@ -472,11 +468,9 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      ::new (p_end) T(value1, value2);
-      ++p_end;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1, value2);
     }
 
     //*********************************************************************
@@ -488,11 +482,9 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
-      ::new (p_end) T(value1, value2, value3);
-      ++p_end;
-      ETL_INCREMENT_DEBUG_COUNT
+      emplace_back_unchecked(value1, value2, value3);
     }
 
     //*********************************************************************
@@ -504,14 +496,131 @@ namespace etl
     void emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+      emplace_back_unchecked(value1, value2, value3, value4);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(const_reference value)
+    {
+      create_back(value);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(rvalue_reference value)
+    {
+      create_back(etl::move(value));
+    }
 #endif
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_VECTOR_FORCE_CPP03)
+    //*********************************************************************
+    /// Constructs a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename ... Args>
+    void emplace_back_unchecked(Args && ... args)
+    {
+      ::new (p_end) T(etl::forward<Args>(args)...);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename T1>
+    void emplace_back_unchecked(const T1& value1)
+    {
+      ::new (p_end) T(value1);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    void emplace_back_unchecked(const T1& value1, const T2& value2)
+    {
+      ::new (p_end) T(value1, value2);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    void emplace_back_unchecked(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ::new (p_end) T(value1, value2, value3);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector without checking the capacity.
+    /// The vector must not be full. See reserve_check.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    void emplace_back_unchecked(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
       ::new (p_end) T(value1, value2, value3, value4);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
     }
 #endif
 
+    //*********************************************************************
+    /// Appends a range of values to the end of the vector without checking the capacity.
+    /// The vector must have room for the values. See reserve_check.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void append_unchecked(TIterator first, TIterator last)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<typename etl::remove_cv<T>::type, typename etl::remove_cv<typename etl::iterator_traits<TIterator>::value_type>::type>::value), "Iterator type does not match container type");
+
+      ETL_ADD_DEBUG_COUNT(uint32_t(etl::distance(first, last)))
+      p_end = etl::uninitialized_copy(first, last, p_end);
+    }
+
+    //*********************************************************************
+    /// Checks once that n more values will fit, so that the unchecked
+    /// functions may be used to add them.
+    /// If asserts or exceptions are enabled, emits vector_full if they will not fit.
+    ///\param n The number of values to be added.
+    ///\return <b>true</b> if the values will fit.
+    //*********************************************************************
+    bool reserve_check(size_t n) const
+    {
+      const bool fits = (n <= available());
+      ETL_ASSERT_CONTAINER(fits, ETL_ERROR(vector_full));
+
+      return fits;
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the vector.
     /// Does nothing if the vector is empty.
@@ -519,7 +628,7 @@ namespace etl
     void pop_back()
     {
 #if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() > 0, ETL_ERROR(vector_empty));
+      ETL_ASSERT_CONTAINER(size() > 0, ETL_ERROR(vector_empty));
 #endif
       destroy_back();
     }
@@ -532,7 +641,7 @@ namespace etl
     //*********************************************************************
     iterator insert(iterator position, const_reference value)
     {
-      ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
       if (position == end())
       {
@@ -557,7 +666,7 @@ namespace etl
     //*********************************************************************
     iterator insert(iterator position, rvalue_reference value)
     {
-      ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
       if (position == end())
       {
@@ -581,7 +690,7 @@ namespace etl
     template <typename ... Args>
     iterator emplace(iterator position, Args && ... args)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(vector_full));
 
       void* p;
 
@@ -606,7 +715,7 @@ namespace etl
     template <typename T1>
     iterator emplace(iterator position, const T1& value1)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(vector_full));
 
       void* p;
 
@@ -631,7 +740,7 @@ namespace etl
     template <typename T1, typename T2>
     iterator emplace(iterator position, const T1& value1, const T2& value2)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(vector_full));
 
       void* p;
 
@@ -656,7 +765,7 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     iterator emplace(iterator position, const T1& value1, const T2& value2, const T3& value3)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(vector_full));
 
       void* p;
 
@@ -681,7 +790,7 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER(!full(), ETL_ERROR(vector_full));
 
       void* p;
 
@@ -713,7 +822,7 @@ namespace etl
     //*********************************************************************
     void insert(iterator position, size_t n, parameter_t value)
     {
-      ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
       size_t insert_n = n;
       size_t insert_begin = etl::distance(begin(), position);
@@ -770,7 +879,7 @@ namespace etl
     {
       size_t count = etl::distance(first, last);
 
-      ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
+      ETL_ASSERT_CONTAINER((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
       size_t insert_n = count;
       size_t insert_begin = etl::distance(begin(), position);
@@ -939,7 +1048,7 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    ivector(T* p_buffer_, size_t MAX_SIZE)
+    ETL_CONSTEXPR ivector(T* p_buffer_, size_t MAX_SIZE)
       : vector_base(MAX_SIZE),
       p_buffer(p_buffer_),
       p_end(p_buffer_)
@@ -1153,11 +1262,11 @@ namespace etl
 
     //*************************************************************************
     /// Constructor.
+    /// The vector is empty without any code to run, so may be constant initialised.
     //*************************************************************************
-    vector()
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    ETL_CONSTEXPR vector()
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
-      this->initialise();
     }
 
     //*************************************************************************
@@ -1165,7 +1274,7 @@ namespace etl
     ///\param initial_size The initial size of the vector.
     //*************************************************************************
     explicit vector(size_t initial_size)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       this->initialise();
       this->resize(initial_size);
@@ -1177,7 +1286,7 @@ namespace etl
     ///\param value        The value to fill the vector with.
     //*************************************************************************
     vector(size_t initial_size, typename etl::ivector<T>::parameter_t value)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       this->initialise();
       this->resize(initial_size, value);
@@ -1191,7 +1300,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     vector(TIterator first, TIterator last)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       this->assign(first, last);
     }
@@ -1201,7 +1310,7 @@ namespace etl
     /// Constructor, from an initializer_list.
     //*************************************************************************
     vector(std::initializer_list<T> init)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       this->assign(init.begin(), init.end());
     }
@@ -1211,7 +1320,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     vector(const vector& other)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       this->assign(other.begin(), other.end());
     }
@@ -1234,7 +1343,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     vector(vector&& other)
-      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+      : etl::ivector<T>(buffer_t::get(buffer), MAX_SIZE)
     {
       if (this != &other)
       {
@@ -1290,15 +1399,17 @@ namespace etl
     void repair()
     {
       #if ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
-      ETL_ASSERT(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::vector_incompatible_type));
+      ETL_ASSERT_CONTAINER(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::vector_incompatible_type));
       #endif
 
-      etl::ivector<T>::repair_buffer(buffer);
+      etl::ivector<T>::repair_buffer(buffer_t::get(buffer));
     }
 
   private:
 
-    typename etl::aligned_storage<sizeof(T) * MAX_SIZE, etl::alignment_of<T>::value>::type buffer;
+    typedef etl::uninitialized_buffer_of<T, MAX_SIZE> buffer_t;
+
+    buffer_t buffer;
   };
 
   //***************************************************************************
@@ -1445,7 +1556,7 @@ namespace etl
       void repair()
     {
 #if ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
-      ETL_ASSERT(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::vector_incompatible_type));
+      ETL_ASSERT_CONTAINER(etl::is_trivially_copyable<T>::value, ETL_ERROR(etl::vector_incompatible_type));
 #endif
 
       etl::ivector<T>::repair_buffer(this->p_buffer);
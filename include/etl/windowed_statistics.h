@@ -0,0 +1,415 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WINDOWED_STATISTICS_INCLUDED
+#define ETL_WINDOWED_STATISTICS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup windowed_statistics windowed_statistics
+/// Exact mean, variance, minimum and maximum over the last SAMPLE_SIZE samples,
+/// updated in O(1) per sample.
+/// Integral samples keep exact running sums in a 64 bit accumulator.
+/// Floating point samples keep a sliding Welford mean and sum of squared
+/// deviations, which avoids the cancellation of running sums.
+/// The minimum and maximum are tracked with monotonic queues.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_windowed_statistics
+  {
+    //*************************************************************************
+    /// Running moments.
+    //*************************************************************************
+    template <typename T, const bool IS_FLOAT = etl::is_floating_point<T>::value>
+    class moments;
+
+    //*************************************************************************
+    /// Integral samples. Exact sums.
+    //*************************************************************************
+    template <typename T>
+    class moments<T, false>
+    {
+    public:
+
+      typedef typename etl::conditional<etl::is_signed<T>::value, int64_t, uint64_t>::type accumulator_type;
+
+      void clear()
+      {
+        sum            = 0;
+        sum_of_squares = 0;
+      }
+
+      void add(T value, size_t)
+      {
+        sum            += accumulator_type(value);
+        sum_of_squares += accumulator_type(value) * accumulator_type(value);
+      }
+
+      void replace(T old_value, T value, size_t)
+      {
+        sum            += accumulator_type(value) - accumulator_type(old_value);
+        sum_of_squares += (accumulator_type(value) * accumulator_type(value)) - (accumulator_type(old_value) * accumulator_type(old_value));
+      }
+
+      accumulator_type get_sum() const
+      {
+        return sum;
+      }
+
+      accumulator_type mean(size_t n) const
+      {
+        return (n == 0U) ? accumulator_type(0) : accumulator_type(sum / accumulator_type(n));
+      }
+
+      /// The sum of squared deviations from the mean, truncated.
+      accumulator_type deviations(size_t n) const
+      {
+        return (n == 0U) ? accumulator_type(0) : accumulator_type(sum_of_squares - ((sum * sum) / accumulator_type(n)));
+      }
+
+    private:
+
+      accumulator_type sum;
+      accumulator_type sum_of_squares;
+    };
+
+    //*************************************************************************
+    /// Floating point samples. Sliding Welford.
+    //*************************************************************************
+    template <typename T>
+    class moments<T, true>
+    {
+    public:
+
+      typedef T accumulator_type;
+
+      void clear()
+      {
+        running_mean = T(0);
+        m2           = T(0);
+        sum          = T(0);
+      }
+
+      void add(T value, size_t n)
+      {
+        const T delta = value - running_mean;
+        running_mean += delta / T(n);
+        m2           += delta * (value - running_mean);
+        sum          += value;
+      }
+
+      void replace(T old_value, T value, size_t n)
+      {
+        const T delta    = value - old_value;
+        const T old_mean = running_mean;
+        running_mean += delta / T(n);
+        m2           += delta * ((value - running_mean) + (old_value - old_mean));
+        sum          += delta;
+
+        // Rounding may leave a tiny negative value for a constant window.
+        if (m2 < T(0))
+        {
+          m2 = T(0);
+        }
+      }
+
+      accumulator_type get_sum() const
+      {
+        return sum;
+      }
+
+      accumulator_type mean(size_t) const
+      {
+        return running_mean;
+      }
+
+      accumulator_type deviations(size_t) const
+      {
+        return m2;
+      }
+
+    private:
+
+      T running_mean;
+      T m2;
+      T sum;
+    };
+
+    //*************************************************************************
+    /// A monotonic queue of the window's candidate extremes.
+    /// Holds at most SIZE entries in a ring.
+    //*************************************************************************
+    template <typename T, const size_t SIZE, typename TCompare>
+    class monotonic_queue
+    {
+    public:
+
+      void clear()
+      {
+        head  = 0U;
+        count = 0U;
+      }
+
+      /// Adds a sample, discarding the entries that it supersedes.
+      void push(T value, size_t sequence)
+      {
+        TCompare compare;
+
+        while ((count != 0U) && !compare(entries[back_index()].value, value))
+        {
+          --count;
+        }
+
+        entry& e = entries[(head + count) % SIZE];
+        e.value    = value;
+        e.sequence = sequence;
+        ++count;
+      }
+
+      /// Discards the front entry if it leaves the window when 'sequence' is added.
+      void expire(size_t sequence)
+      {
+        if ((count != 0U) && ((sequence - entries[head].sequence) >= SIZE))
+        {
+          head = (head + 1U) % SIZE;
+          --count;
+        }
+      }
+
+      T front() const
+      {
+        return (count == 0U) ? T() : entries[head].value;
+      }
+
+    private:
+
+      size_t back_index() const
+      {
+        return (head + count - 1U) % SIZE;
+      }
+
+      struct entry
+      {
+        T      value;
+        size_t sequence;
+      };
+
+      entry  entries[SIZE];
+      size_t head;
+      size_t count;
+    };
+
+    template <typename T>
+    struct less
+    {
+      bool operator ()(const T& lhs, const T& rhs) const
+      {
+        return lhs < rhs;
+      }
+    };
+
+    template <typename T>
+    struct greater
+    {
+      bool operator ()(const T& lhs, const T& rhs) const
+      {
+        return rhs < lhs;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Windowed statistics.
+  /// \tparam T           The sample value type.
+  /// \tparam SAMPLE_SIZE The number of samples in the window.
+  //***************************************************************************
+  template <typename T, const size_t SAMPLE_SIZE_>
+  class windowed_statistics
+  {
+  private:
+
+    typedef private_windowed_statistics::moments<T> moments_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(SAMPLE_SIZE_ > 0U, "Sample size must be greater than zero");
+    ETL_STATIC_ASSERT(etl::is_arithmetic<T>::value, "Samples must be arithmetic");
+
+    static const size_t SAMPLE_SIZE = SAMPLE_SIZE_; ///< The number of samples in the window.
+
+    /// The type of the sums, mean and variance.
+    /// int64_t or uint64_t for integral samples, otherwise T.
+    typedef typename moments_t::accumulator_type accumulator_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    windowed_statistics()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void clear()
+    {
+      moments.clear();
+      minimums.clear();
+      maximums.clear();
+      next         = 0U;
+      sample_count = 0U;
+      sequence     = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a new sample, replacing the oldest if the window is full.
+    /// \param value The value to add.
+    //*************************************************************************
+    void add(T value)
+    {
+      if (sample_count == SAMPLE_SIZE)
+      {
+        moments.replace(samples[next], value, SAMPLE_SIZE);
+      }
+      else
+      {
+        ++sample_count;
+        moments.add(value, sample_count);
+      }
+
+      samples[next] = value;
+      next = (next + 1U) % SAMPLE_SIZE;
+
+      // Expire first, so that the queues never hold more than SAMPLE_SIZE entries.
+      minimums.expire(sequence);
+      maximums.expire(sequence);
+
+      minimums.push(value, sequence);
+      maximums.push(value, sequence);
+
+      ++sequence;
+    }
+
+    //*************************************************************************
+    /// The number of samples in the window.
+    //*************************************************************************
+    size_t count() const
+    {
+      return sample_count;
+    }
+
+    //*************************************************************************
+    /// True if the window holds SAMPLE_SIZE samples.
+    //*************************************************************************
+    bool full() const
+    {
+      return sample_count == SAMPLE_SIZE;
+    }
+
+    //*************************************************************************
+    /// True if there are no samples.
+    //*************************************************************************
+    bool empty() const
+    {
+      return sample_count == 0U;
+    }
+
+    //*************************************************************************
+    /// The sum of the samples in the window.
+    //*************************************************************************
+    accumulator_type sum() const
+    {
+      return moments.get_sum();
+    }
+
+    //*************************************************************************
+    /// The mean of the samples in the window.
+    /// Truncated for integral samples.
+    //*************************************************************************
+    accumulator_type mean() const
+    {
+      return moments.mean(sample_count);
+    }
+
+    //*************************************************************************
+    /// The population variance of the samples in the window.
+    /// Truncated for integral samples.
+    //*************************************************************************
+    accumulator_type variance() const
+    {
+      return (sample_count == 0U) ? accumulator_type(0) : accumulator_type(moments.deviations(sample_count) / accumulator_type(sample_count));
+    }
+
+    //*************************************************************************
+    /// The sample variance of the samples in the window.
+    /// Truncated for integral samples.
+    //*************************************************************************
+    accumulator_type sample_variance() const
+    {
+      return (sample_count < 2U) ? accumulator_type(0) : accumulator_type(moments.deviations(sample_count) / accumulator_type(sample_count - 1U));
+    }
+
+    //*************************************************************************
+    /// The smallest sample in the window, or T() if empty.
+    //*************************************************************************
+    T minimum() const
+    {
+      return minimums.front();
+    }
+
+    //*************************************************************************
+    /// The largest sample in the window, or T() if empty.
+    //*************************************************************************
+    T maximum() const
+    {
+      return maximums.front();
+    }
+
+  private:
+
+    moments_t moments;
+    private_windowed_statistics::monotonic_queue<T, SAMPLE_SIZE, private_windowed_statistics::less<T> >    minimums;
+    private_windowed_statistics::monotonic_queue<T, SAMPLE_SIZE, private_windowed_statistics::greater<T> > maximums;
+    T         samples[SAMPLE_SIZE];
+    size_t    next;
+    size_t    sample_count;
+    size_t    sequence;
+  };
+}
+
+#endif
@@ -0,0 +1,262 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_DEQUE_INCLUDED
+#define ETL_WORK_STEALING_DEQUE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+///\defgroup work_stealing_deque work_stealing_deque
+/// A fixed capacity Chase-Lev work stealing deque.
+/// The owning thread pushes and pops at the bottom; any other thread may
+/// steal from the top.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup work_stealing_deque
+  /// The base of the work stealing deque.
+  /// The values are held in etl::atomic, so T must be an integral or pointer
+  /// type, such as a pointer to a task.
+  ///\tparam T The type of value that the deque holds.
+  //***************************************************************************
+  template <typename T>
+  class iwork_stealing_deque
+  {
+  public:
+
+    typedef T      value_type; ///< The type stored in the deque.
+    typedef size_t size_type;  ///< The type used for determining the size of the deque.
+
+    //*************************************************************************
+    /// Push a value to the bottom.
+    /// Call from the owner.
+    /// Returns false if the deque is full.
+    //*************************************************************************
+    bool push(T value)
+    {
+      const size_type b = bottom.load(etl::memory_order_relaxed);
+      const size_type t = top.load(etl::memory_order_acquire);
+
+      if ((b - t) > mask)
+      {
+        return false;
+      }
+
+      p_buffer[b & mask].store(value, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+      bottom.store(b + 1U, etl::memory_order_relaxed);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop the most recently pushed value from the bottom.
+    /// Call from the owner.
+    /// Returns false if the deque is empty, or the last value was stolen.
+    //*************************************************************************
+    bool pop(T& value)
+    {
+      const size_type b = bottom.load(etl::memory_order_relaxed) - 1U;
+
+      bottom.store(b, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+
+      size_type t = top.load(etl::memory_order_relaxed);
+
+      if (difference(b, t) < 0)
+      {
+        // Empty.
+        bottom.store(b + 1U, etl::memory_order_relaxed);
+
+        return false;
+      }
+
+      value = p_buffer[b & mask].load(etl::memory_order_relaxed);
+
+      if (b != t)
+      {
+        // More than one value, so no thief can reach this one.
+        return true;
+      }
+
+      // The last value. Race the thieves for it.
+      const bool won = top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst);
+
+      bottom.store(b + 1U, etl::memory_order_relaxed);
+
+      return won;
+    }
+
+    //*************************************************************************
+    /// Steal the least recently pushed value from the top.
+    /// Call from any thread other than the owner.
+    /// Returns false if the deque is empty, or another thread took the value first.
+    //*************************************************************************
+    bool steal(T& value)
+    {
+      size_type t = top.load(etl::memory_order_acquire);
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+      const size_type b = bottom.load(etl::memory_order_acquire);
+
+      if (difference(b, t) <= 0)
+      {
+        return false;
+      }
+
+      const T item = p_buffer[t & mask].load(etl::memory_order_relaxed);
+
+      if (!top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst))
+      {
+        return false;
+      }
+
+      value = item;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// How many values are in the deque?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_type t = top.load(etl::memory_order_acquire);
+      const size_type b = bottom.load(etl::memory_order_acquire);
+
+      return (difference(b, t) > 0) ? (b - t) : 0U;
+    }
+
+    //*************************************************************************
+    /// Is the deque empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// How many values can the deque hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return mask + 1U;
+    }
+
+    //*************************************************************************
+    /// How many values can the deque hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return mask + 1U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iwork_stealing_deque(etl::atomic<T>* p_buffer_, size_type max_size_)
+      : p_buffer(p_buffer_),
+        mask(max_size_ - 1U),
+        top(0U),
+        bottom(0U)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The signed distance from 'from' to 'to'.
+    /// The positions may wrap.
+    //*************************************************************************
+    static ptrdiff_t difference(size_type to, size_type from)
+    {
+      return ptrdiff_t(to - from);
+    }
+
+    // Disable copy construction and assignment.
+    iwork_stealing_deque(const iwork_stealing_deque&) ETL_DELETE;
+    iwork_stealing_deque& operator =(const iwork_stealing_deque&) ETL_DELETE;
+
+    etl::atomic<T>*        p_buffer; ///< The values.
+    const size_type        mask;     ///< The size of the buffer minus one.
+    etl::atomic<size_type> top;      ///< The position that thieves steal from.
+#if ETL_CACHE_LINE_SIZE > 0
+    char                   padding[ETL_CACHE_LINE_SIZE];
+#endif
+    etl::atomic<size_type> bottom;   ///< The position that the owner pushes to.
+  };
+
+  //***************************************************************************
+  ///\ingroup work_stealing_deque
+  /// A work stealing deque with a fixed capacity.
+  ///\tparam T    The type this deque should support. An integral or pointer type.
+  ///\tparam SIZE The maximum capacity of the deque. Must be a power of two.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class work_stealing_deque : public etl::iwork_stealing_deque<T>
+  {
+  private:
+
+    typedef etl::iwork_stealing_deque<T> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(((SIZE != 0U) && ((SIZE & (SIZE - 1U)) == 0U)), "Size must be a power of two");
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    work_stealing_deque()
+      : base_t(buffer, SIZE)
+    {
+    }
+
+  private:
+
+    etl::atomic<T> buffer[SIZE]; ///< The values.
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,327 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup wyhash wyhash 64 bit hash calculation
+/// Based on wyhash 'final 4'. See https://github.com/wangyi-fudan/wyhash for more details.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// 64 x 64 -> 128 bit multiply. Returns the low half, high half in 'b'.
+    //*************************************************************************
+    inline void mum(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __uint128_t r = a;
+      r *= b;
+      a = uint64_t(r);
+      b = uint64_t(r >> 64);
+#else
+      const uint64_t ha = a >> 32;
+      const uint64_t hb = b >> 32;
+      const uint64_t la = uint32_t(a);
+      const uint64_t lb = uint32_t(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+      const uint64_t t   = rl + (rm0 << 32);
+
+      uint64_t c = (t < rl) ? 1U : 0U;
+
+      const uint64_t lo = t + (rm1 << 32);
+
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+    }
+
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      mum(a, b);
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+      return  uint64_t(p[0])        | (uint64_t(p[1]) << 8)  |
+             (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+             (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) |
+             (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
+
+    //*************************************************************************
+    inline uint64_t read32(const uint8_t* p)
+    {
+      return uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24);
+    }
+
+    //*************************************************************************
+    inline uint64_t read3(const uint8_t* p, size_t k)
+    {
+      return (uint64_t(p[0]) << 16) | (uint64_t(p[k >> 1]) << 8) | uint64_t(p[k - 1]);
+    }
+
+    static const uint64_t SECRET0 = 0x2D358DCCAA6C78A5ULL;
+    static const uint64_t SECRET1 = 0x8BB84B93962EACC9ULL;
+    static const uint64_t SECRET2 = 0x4B33A62ED433D4A3ULL;
+    static const uint64_t SECRET3 = 0x4D5A2DA51DE1AA47ULL;
+  }
+
+  //***************************************************************************
+  /// wyhash policy.
+  /// wyhash treats the final 16 bytes specially, so the most recent bytes are
+  /// kept until the hash is finalised.
+  //***************************************************************************
+  class wyhash_policy : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    wyhash_policy()
+      : seed(0U)
+    {
+      initial();
+    }
+
+    //*************************************************************************
+    void set_seed(uint64_t seed_)
+    {
+      seed = seed_;
+    }
+
+    //*************************************************************************
+    uint64_t initial()
+    {
+      using namespace etl::private_wyhash;
+
+      state[0] = seed ^ mix(seed ^ SECRET0, SECRET1);
+      state[1] = state[0];
+      state[2] = state[0];
+      length   = 0U;
+      pending  = 0U;
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    uint64_t add(uint64_t hash, uint8_t value)
+    {
+      buffer[HISTORY + pending++] = value;
+      ++length;
+
+      if (pending == (CHUNK + 1U))
+      {
+        // More data follows a full chunk, so it can be mixed in.
+        add_chunk(buffer + HISTORY);
+        memmove(buffer, buffer + CHUNK, HISTORY + 1U);
+        pending = 1U;
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    uint64_t add_block(uint64_t hash, TIterator begin, const TIterator end)
+    {
+      while (begin != end)
+      {
+        add(hash, static_cast<uint8_t>(*begin++));
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    uint64_t add_block(uint64_t hash, const uint8_t* begin, const uint8_t* end)
+    {
+      // Only take the direct path with an empty buffer and enough data to
+      // leave a full history behind.
+      if ((pending == 0U) && (size_t(end - begin) > (CHUNK + HISTORY)))
+      {
+        const uint8_t* const start = begin;
+
+        while (size_t(end - begin) > CHUNK)
+        {
+          add_chunk(begin);
+          begin += CHUNK;
+        }
+
+        length += size_t(begin - start);
+
+        // Keep the history and the remaining bytes.
+        memcpy(buffer, begin - HISTORY, HISTORY);
+        pending = size_t(end - begin);
+        memcpy(buffer + HISTORY, begin, pending);
+        length += pending;
+
+        return hash;
+      }
+
+      return add_block<const uint8_t*>(hash, begin, end);
+    }
+
+    //*************************************************************************
+    uint64_t final(uint64_t) const
+    {
+      using namespace etl::private_wyhash;
+
+      const uint8_t* p = buffer + HISTORY;
+      uint64_t a;
+      uint64_t b;
+      uint64_t s = state[0];
+
+      if (length <= 16U)
+      {
+        if (length >= 4U)
+        {
+          a = (read32(p) << 32) | read32(p + ((length >> 3) << 2));
+          b = (read32(p + length - 4U) << 32) | read32(p + length - 4U - ((length >> 3) << 2));
+        }
+        else if (length > 0U)
+        {
+          a = read3(p, size_t(length));
+          b = 0U;
+        }
+        else
+        {
+          a = 0U;
+          b = 0U;
+        }
+      }
+      else
+      {
+        size_t i = pending;
+
+        if (length > CHUNK)
+        {
+          s ^= state[1] ^ state[2];
+        }
+
+        while (i > 16U)
+        {
+          s  = mix(read64(p) ^ SECRET1, read64(p + 8) ^ s);
+          i -= 16U;
+          p += 16U;
+        }
+
+        a = read64(p + i - 16U);
+        b = read64(p + i - 8U);
+      }
+
+      a ^= SECRET1;
+      b ^= s;
+      mum(a, b);
+
+      return mix(a ^ SECRET0 ^ length, b ^ SECRET1);
+    }
+
+  private:
+
+    //*************************************************************************
+    void add_chunk(const uint8_t* p)
+    {
+      using namespace etl::private_wyhash;
+
+      state[0] = mix(read64(p)      ^ SECRET1, read64(p + 8)  ^ state[0]);
+      state[1] = mix(read64(p + 16) ^ SECRET2, read64(p + 24) ^ state[1]);
+      state[2] = mix(read64(p + 32) ^ SECRET3, read64(p + 40) ^ state[2]);
+    }
+
+    static const size_t CHUNK   = 48U;
+    static const size_t HISTORY = 16U;
+
+    uint64_t seed;
+    uint64_t state[3];
+    uint64_t length;
+    uint8_t  buffer[HISTORY + CHUNK + 1U];
+    size_t   pending;
+  };
+
+  //***************************************************************************
+  /// Calculates the wyhash hash.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash : public etl::frame_check_sequence<etl::wyhash_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(uint64_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    wyhash(TIterator begin, const TIterator end, uint64_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
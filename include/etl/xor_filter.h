@@ -0,0 +1,364 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_XOR_FILTER_INCLUDED
+#define ETL_XOR_FILTER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "bloom_filter.h"
+
+///\defgroup xor_filter xor_filter
+/// A static filter for a set of keys, built once and then only queried.
+/// Each query reads three fingerprints and uses about 1.23 fingerprints of
+/// storage per key. With 8 bit fingerprints that is about 9.9 bits per key,
+/// for a false positive rate of 1 in 256. A Bloom filter needs about 12 bits
+/// per key and seven probes for the same rate.
+/// See Graf and Lemire, "Xor Filters: Faster and Smaller Than Bloom and
+/// Cuckoo Filters".
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// An xor filter, built from a range of keys.
+  /// Keys with the same hash are counted once.
+  ///\tparam MAX_KEYS     The maximum number of keys.
+  ///\tparam THash        The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam TFingerprint The fingerprint type. Each extra bit halves the false positive rate.
+  ///\ingroup xor_filter
+  //***************************************************************************
+  template <const size_t MAX_KEYS,
+            typename     THash,
+            typename     TFingerprint = uint8_t>
+  class xor_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    static const size_t MAX_ATTEMPTS = 100U;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_KEYS > 0, "At least one key is required");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TFingerprint>::value, "The fingerprint must be unsigned");
+
+    enum
+    {
+      MAX_SIZE       = MAX_KEYS,
+      SEGMENT_LENGTH = (32U + ((123U * MAX_KEYS) + 99U) / 100U + 2U) / 3U,
+      CAPACITY       = 3U * SEGMENT_LENGTH
+    };
+
+    //*************************************************************************
+    /// The working memory used while the filter is built.
+    /// It is not needed once the filter is built, so may be shared or reused.
+    //*************************************************************************
+    class workspace
+    {
+    private:
+
+      friend class xor_filter;
+
+      uint64_t hashes[MAX_KEYS];
+      uint64_t slot_hashes[CAPACITY]; ///< The xor of the hashes of the keys in each slot.
+      uint32_t slot_counts[CAPACITY];
+      uint32_t queue[CAPACITY];
+      uint32_t stack_slots[MAX_KEYS];
+      uint64_t stack_hashes[MAX_KEYS];
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    xor_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Builds the filter from a range of keys, replacing any previous keys.
+    /// Returns false, leaving the filter empty, if there are more than
+    /// MAX_KEYS keys or the keys could not be placed.
+    ///\param first     The first key.
+    ///\param last      One past the last key.
+    ///\param work_area The working memory for the build.
+    //*************************************************************************
+    template <typename TIterator>
+    bool build(TIterator first, TIterator last, workspace& work_area)
+    {
+      clear();
+
+      size_t n = 0U;
+
+      while (first != last)
+      {
+        if (n == MAX_KEYS)
+        {
+          return false;
+        }
+
+        work_area.hashes[n++] = uint64_t(THash()(*first));
+        ++first;
+      }
+
+      // Keys with the same hash can never be separated, so keep one of each.
+      etl::sort(work_area.hashes, work_area.hashes + n);
+
+      size_t unique = 0U;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if ((unique == 0U) || (work_area.hashes[i] != work_area.hashes[unique - 1U]))
+        {
+          work_area.hashes[unique++] = work_area.hashes[i];
+        }
+      }
+
+      if (unique == 0U)
+      {
+        return true;
+      }
+
+      uint64_t next_seed = 0x9E3779B97F4A7C15ULL;
+
+      for (size_t attempt = 0U; attempt < MAX_ATTEMPTS; ++attempt)
+      {
+        next_seed = private_bloom_filter::mix_hash64(next_seed + attempt);
+
+        if (try_build(unique, next_seed, work_area))
+        {
+          seed      = next_seed;
+          key_count = unique;
+          return true;
+        }
+      }
+
+      clear();
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Builds the filter from a range of keys, with the working memory on the stack.
+    //*************************************************************************
+    template <typename TIterator>
+    bool build(TIterator first, TIterator last)
+    {
+      workspace work_area;
+
+      return build(first, last, work_area);
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may be one of the keys the filter was built from.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      if (key_count == 0U)
+      {
+        return false;
+      }
+
+      const uint64_t hash = get_hash(uint64_t(THash()(key)), seed);
+
+      return get_fingerprint(hash) == TFingerprint(fingerprints[get_slot(hash, 0U)] ^
+                                                   fingerprints[get_slot(hash, 1U)] ^
+                                                   fingerprints[get_slot(hash, 2U)]);
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all keys.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(fingerprints, size_t(CAPACITY), TFingerprint(0U));
+      seed      = 0U;
+      key_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of distinct key hashes in the filter.
+    //*************************************************************************
+    size_t size() const
+    {
+      return key_count;
+    }
+
+    //*************************************************************************
+    /// Returns true if the filter has no keys.
+    //*************************************************************************
+    bool empty() const
+    {
+      return key_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of keys.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprints.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return CAPACITY;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Places the keys by peeling: a slot used by only one key is given to
+    /// that key, which is then removed from its other two slots, until every
+    /// key has a slot. The fingerprints are then assigned in reverse order,
+    /// so that each key's slot is written after its other two are final.
+    //*************************************************************************
+    bool try_build(size_t n, uint64_t seed_, workspace& work_area)
+    {
+      etl::fill_n(work_area.slot_hashes, size_t(CAPACITY), uint64_t(0U));
+      etl::fill_n(work_area.slot_counts, size_t(CAPACITY), uint32_t(0U));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const uint64_t hash = get_hash(work_area.hashes[i], seed_);
+
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+          const size_t slot = get_slot(hash, j);
+
+          work_area.slot_hashes[slot] ^= hash;
+          ++work_area.slot_counts[slot];
+        }
+      }
+
+      size_t queue_size = 0U;
+
+      for (size_t slot = 0U; slot < CAPACITY; ++slot)
+      {
+        if (work_area.slot_counts[slot] == 1U)
+        {
+          work_area.queue[queue_size++] = uint32_t(slot);
+        }
+      }
+
+      size_t stack_size = 0U;
+
+      while (queue_size != 0U)
+      {
+        const size_t slot = work_area.queue[--queue_size];
+
+        if (work_area.slot_counts[slot] == 1U)
+        {
+          const uint64_t hash = work_area.slot_hashes[slot];
+
+          work_area.stack_slots[stack_size]  = uint32_t(slot);
+          work_area.stack_hashes[stack_size] = hash;
+          ++stack_size;
+
+          for (size_t j = 0U; j < 3U; ++j)
+          {
+            const size_t other = get_slot(hash, j);
+
+            work_area.slot_hashes[other] ^= hash;
+
+            if (--work_area.slot_counts[other] == 1U)
+            {
+              work_area.queue[queue_size++] = uint32_t(other);
+            }
+          }
+        }
+      }
+
+      if (stack_size != n)
+      {
+        return false;
+      }
+
+      while (stack_size != 0U)
+      {
+        --stack_size;
+
+        const uint64_t hash = work_area.stack_hashes[stack_size];
+
+        // The key's own slot is still zero, so may be included in the xor.
+        fingerprints[work_area.stack_slots[stack_size]] = TFingerprint(get_fingerprint(hash) ^
+                                                                       fingerprints[get_slot(hash, 0U)] ^
+                                                                       fingerprints[get_slot(hash, 1U)] ^
+                                                                       fingerprints[get_slot(hash, 2U)]);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    static uint64_t get_hash(uint64_t key_hash, uint64_t seed_)
+    {
+      return private_bloom_filter::mix_hash64(key_hash + seed_);
+    }
+
+    //*************************************************************************
+    /// The slot of the hash in segment 'index'.
+    /// Each segment uses a different 32 bits of the hash.
+    //*************************************************************************
+    static size_t get_slot(uint64_t hash, size_t index)
+    {
+      const uint64_t rotated = (index == 0U) ? hash : ((hash << (21U * index)) | (hash >> (64U - (21U * index))));
+
+      return (index * SEGMENT_LENGTH) + size_t((uint64_t(uint32_t(rotated)) * uint64_t(SEGMENT_LENGTH)) >> 32);
+    }
+
+    //*************************************************************************
+    static TFingerprint get_fingerprint(uint64_t hash)
+    {
+      return TFingerprint(hash ^ (hash >> 32));
+    }
+
+    TFingerprint fingerprints[CAPACITY];
+    uint64_t     seed;
+    size_t       key_count;
+  };
+}
+
+#endif
@@ -0,0 +1,478 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_XXHASH_INCLUDED
+#define ETL_XXHASH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "binary.h"
+#include "frame_check_sequence.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup xxhash xxHash32 & xxHash64 hash calculations
+/// See https://github.com/Cyan4973/xxHash for more details.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_xxhash
+  {
+    //*************************************************************************
+    /// Reads four bytes, little endian.
+    //*************************************************************************
+    inline uint32_t read32(const uint8_t* p)
+    {
+      return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    //*************************************************************************
+    /// Reads eight bytes, little endian.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+      return uint64_t(read32(p)) | (uint64_t(read32(p + 4)) << 32);
+    }
+  }
+
+  //***************************************************************************
+  /// xxHash32 policy.
+  /// Holds the accumulators and the partial stripe.
+  //***************************************************************************
+  class xxhash32_policy : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    xxhash32_policy()
+      : seed(0U)
+    {
+      initial();
+    }
+
+    //*************************************************************************
+    void set_seed(uint32_t seed_)
+    {
+      seed = seed_;
+    }
+
+    //*************************************************************************
+    uint32_t initial()
+    {
+      v[0]         = seed + PRIME1 + PRIME2;
+      v[1]         = seed + PRIME2;
+      v[2]         = seed;
+      v[3]         = seed - PRIME1;
+      length       = 0U;
+      buffer_count = 0U;
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    uint32_t add(uint32_t hash, uint8_t value)
+    {
+      buffer[buffer_count++] = value;
+      ++length;
+
+      if (buffer_count == STRIPE)
+      {
+        add_stripe(buffer);
+        buffer_count = 0U;
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t add_block(uint32_t hash, TIterator begin, const TIterator end)
+    {
+      while (begin != end)
+      {
+        add(hash, static_cast<uint8_t>(*begin++));
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    uint32_t add_block(uint32_t hash, const uint8_t* begin, const uint8_t* end)
+    {
+      // Complete any partial stripe.
+      while ((buffer_count != 0U) && (begin != end))
+      {
+        add(hash, *begin++);
+      }
+
+      while (size_t(end - begin) >= STRIPE)
+      {
+        add_stripe(begin);
+        begin  += STRIPE;
+        length += STRIPE;
+      }
+
+      return add_block<const uint8_t*>(hash, begin, end);
+    }
+
+    //*************************************************************************
+    uint32_t final(uint32_t) const
+    {
+      uint32_t h;
+
+      if (length >= STRIPE)
+      {
+        h = etl::rotate_left(v[0], 1U) + etl::rotate_left(v[1], 7U) + etl::rotate_left(v[2], 12U) + etl::rotate_left(v[3], 18U);
+      }
+      else
+      {
+        h = seed + PRIME5;
+      }
+
+      h += uint32_t(length);
+
+      const uint8_t* p = buffer;
+      size_t remaining = buffer_count;
+
+      while (remaining >= 4U)
+      {
+        h += etl::private_xxhash::read32(p) * PRIME3;
+        h  = etl::rotate_left(h, 17U) * PRIME4;
+        p += 4U;
+        remaining -= 4U;
+      }
+
+      while (remaining > 0U)
+      {
+        h += (*p++) * PRIME5;
+        h  = etl::rotate_left(h, 11U) * PRIME1;
+        --remaining;
+      }
+
+      h ^= h >> 15;
+      h *= PRIME2;
+      h ^= h >> 13;
+      h *= PRIME3;
+      h ^= h >> 16;
+
+      return h;
+    }
+
+  private:
+
+    //*************************************************************************
+    static uint32_t round(uint32_t accumulator, uint32_t input)
+    {
+      accumulator += input * PRIME2;
+      accumulator  = etl::rotate_left(accumulator, 13U);
+      accumulator *= PRIME1;
+
+      return accumulator;
+    }
+
+    //*************************************************************************
+    void add_stripe(const uint8_t* p)
+    {
+      v[0] = round(v[0], etl::private_xxhash::read32(p));
+      v[1] = round(v[1], etl::private_xxhash::read32(p + 4));
+      v[2] = round(v[2], etl::private_xxhash::read32(p + 8));
+      v[3] = round(v[3], etl::private_xxhash::read32(p + 12));
+    }
+
+    static const uint32_t PRIME1 = 0x9E3779B1UL;
+    static const uint32_t PRIME2 = 0x85EBCA77UL;
+    static const uint32_t PRIME3 = 0xC2B2AE3DUL;
+    static const uint32_t PRIME4 = 0x27D4EB2FUL;
+    static const uint32_t PRIME5 = 0x165667B1UL;
+    static const size_t   STRIPE = 16U;
+
+    uint32_t seed;
+    uint32_t v[4];
+    uint64_t length;
+    uint8_t  buffer[STRIPE];
+    size_t   buffer_count;
+  };
+
+  //***************************************************************************
+  /// Calculates the xxHash32 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash32 : public etl::frame_check_sequence<etl::xxhash32_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash32(uint32_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash32(TIterator begin, const TIterator end, uint32_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// xxHash64 policy.
+  /// Holds the accumulators and the partial stripe.
+  //***************************************************************************
+  class xxhash64_policy : public etl::frame_check_sequence_block_tag
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    xxhash64_policy()
+      : seed(0U)
+    {
+      initial();
+    }
+
+    //*************************************************************************
+    void set_seed(uint64_t seed_)
+    {
+      seed = seed_;
+    }
+
+    //*************************************************************************
+    uint64_t initial()
+    {
+      v[0]         = seed + PRIME1 + PRIME2;
+      v[1]         = seed + PRIME2;
+      v[2]         = seed;
+      v[3]         = seed - PRIME1;
+      length       = 0U;
+      buffer_count = 0U;
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    uint64_t add(uint64_t hash, uint8_t value)
+    {
+      buffer[buffer_count++] = value;
+      ++length;
+
+      if (buffer_count == STRIPE)
+      {
+        add_stripe(buffer);
+        buffer_count = 0U;
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    uint64_t add_block(uint64_t hash, TIterator begin, const TIterator end)
+    {
+      while (begin != end)
+      {
+        add(hash, static_cast<uint8_t>(*begin++));
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    uint64_t add_block(uint64_t hash, const uint8_t* begin, const uint8_t* end)
+    {
+      // Complete any partial stripe.
+      while ((buffer_count != 0U) && (begin != end))
+      {
+        add(hash, *begin++);
+      }
+
+      while (size_t(end - begin) >= STRIPE)
+      {
+        add_stripe(begin);
+        begin  += STRIPE;
+        length += STRIPE;
+      }
+
+      return add_block<const uint8_t*>(hash, begin, end);
+    }
+
+    //*************************************************************************
+    uint64_t final(uint64_t) const
+    {
+      uint64_t h;
+
+      if (length >= STRIPE)
+      {
+        h = etl::rotate_left(v[0], 1U) + etl::rotate_left(v[1], 7U) + etl::rotate_left(v[2], 12U) + etl::rotate_left(v[3], 18U);
+        h = merge_round(h, v[0]);
+        h = merge_round(h, v[1]);
+        h = merge_round(h, v[2]);
+        h = merge_round(h, v[3]);
+      }
+      else
+      {
+        h = seed + PRIME5;
+      }
+
+      h += length;
+
+      const uint8_t* p = buffer;
+      size_t remaining = buffer_count;
+
+      while (remaining >= 8U)
+      {
+        h ^= round(0U, etl::private_xxhash::read64(p));
+        h  = (etl::rotate_left(h, 27U) * PRIME1) + PRIME4;
+        p += 8U;
+        remaining -= 8U;
+      }
+
+      if (remaining >= 4U)
+      {
+        h ^= uint64_t(etl::private_xxhash::read32(p)) * PRIME1;
+        h  = (etl::rotate_left(h, 23U) * PRIME2) + PRIME3;
+        p += 4U;
+        remaining -= 4U;
+      }
+
+      while (remaining > 0U)
+      {
+        h ^= (*p++) * PRIME5;
+        h  = etl::rotate_left(h, 11U) * PRIME1;
+        --remaining;
+      }
+
+      h ^= h >> 33;
+      h *= PRIME2;
+      h ^= h >> 29;
+      h *= PRIME3;
+      h ^= h >> 32;
+
+      return h;
+    }
+
+  private:
+
+    //*************************************************************************
+    static uint64_t round(uint64_t accumulator, uint64_t input)
+    {
+      accumulator += input * PRIME2;
+      accumulator  = etl::rotate_left(accumulator, 31U);
+      accumulator *= PRIME1;
+
+      return accumulator;
+    }
+
+    //*************************************************************************
+    static uint64_t merge_round(uint64_t accumulator, uint64_t value)
+    {
+      accumulator ^= round(0U, value);
+      accumulator  = (accumulator * PRIME1) + PRIME4;
+
+      return accumulator;
+    }
+
+    //*************************************************************************
+    void add_stripe(const uint8_t* p)
+    {
+      v[0] = round(v[0], etl::private_xxhash::read64(p));
+      v[1] = round(v[1], etl::private_xxhash::read64(p + 8));
+      v[2] = round(v[2], etl::private_xxhash::read64(p + 16));
+      v[3] = round(v[3], etl::private_xxhash::read64(p + 24));
+    }
+
+    static const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    static const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+    static const size_t   STRIPE = 32U;
+
+    uint64_t seed;
+    uint64_t v[4];
+    uint64_t length;
+    uint8_t  buffer[STRIPE];
+    size_t   buffer_count;
+  };
+
+  //***************************************************************************
+  /// Calculates the xxHash64 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash64 : public etl::frame_check_sequence<etl::xxhash64_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash64(uint64_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, uint64_t seed = 0U)
+    {
+      this->get_policy().set_seed(seed);
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,84 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ZIGZAG_INCLUDED
+#define ETL_ZIGZAG_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+
+///\defgroup zigzag zigzag
+/// Zigzag encoding maps signed integers to unsigned ones so that values of
+/// small magnitude, positive or negative, have small codes:
+/// 0, -1, 1, -2, 2 ... become 0, 1, 2, 3, 4 ...
+/// Used before varint or narrow bit width encodings.
+///\ingroup binary
+
+namespace etl
+{
+  //***************************************************************************
+  /// Zigzag encodes a 32 bit value.
+  ///\ingroup zigzag
+  //***************************************************************************
+  inline ETL_CONSTEXPR uint32_t zigzag_encode(int32_t value)
+  {
+    return (uint32_t(value) << 1) ^ (0U - (uint32_t(value) >> 31));
+  }
+
+  //***************************************************************************
+  /// Zigzag encodes a 64 bit value.
+  ///\ingroup zigzag
+  //***************************************************************************
+  inline ETL_CONSTEXPR uint64_t zigzag_encode(int64_t value)
+  {
+    return (uint64_t(value) << 1) ^ (0U - (uint64_t(value) >> 63));
+  }
+
+  //***************************************************************************
+  /// Zigzag decodes a 32 bit value.
+  ///\ingroup zigzag
+  //***************************************************************************
+  inline ETL_CONSTEXPR int32_t zigzag_decode(uint32_t value)
+  {
+    return int32_t((value >> 1) ^ (0U - (value & 1U)));
+  }
+
+  //***************************************************************************
+  /// Zigzag decodes a 64 bit value.
+  ///\ingroup zigzag
+  //***************************************************************************
+  inline ETL_CONSTEXPR int64_t zigzag_decode(uint64_t value)
+  {
+    return int64_t((value >> 1) ^ (0U - (value & 1U)));
+  }
+}
+
+#endif
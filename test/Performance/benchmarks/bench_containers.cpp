@@ -0,0 +1,247 @@
+// bench_containers.cpp : Container benchmarks, ETL against the STL.
+
+#include <stdint.h>
+
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/map.h"
+#include "etl/unordered_map.h"
+#include "etl/unordered_flat_map.h"
+
+namespace
+{
+  const size_t SIZE = 256U;
+
+  //***************************************************************************
+  template <typename TVector>
+  void vector_push_back(benchmark::state& state, TVector& vector)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        vector.push_back(int(i));
+      }
+
+      benchmark::do_not_optimise(vector.back());
+      vector.clear();
+    }
+  }
+
+  //***************************************************************************
+  template <typename TVector>
+  void vector_iterate(benchmark::state& state, TVector& vector)
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      vector.push_back(int(i));
+    }
+
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      int sum = 0;
+
+      for (typename TVector::const_iterator itr = vector.begin(); itr != vector.end(); ++itr)
+      {
+        sum += *itr;
+      }
+
+      benchmark::do_not_optimise(sum);
+    }
+  }
+
+  //***************************************************************************
+  template <typename TDeque>
+  void deque_push_pop(benchmark::state& state, TDeque& deque)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        deque.push_back(int(i));
+      }
+
+      while (!deque.empty())
+      {
+        benchmark::do_not_optimise(deque.front());
+        deque.pop_front();
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Inserts, finds and erases every key.
+  //***************************************************************************
+  template <typename TMap>
+  void map_insert_find_erase(benchmark::state& state, TMap& map)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        map.insert(typename TMap::value_type(i * 2654435761U, i));
+      }
+
+      size_t found = 0U;
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        found += map.count(i * 2654435761U);
+      }
+
+      benchmark::do_not_optimise(found);
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        map.erase(i * 2654435761U);
+      }
+    }
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void map_find(benchmark::state& state, TMap& map)
+  {
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      map.insert(typename TMap::value_type(i * 2654435761U, i));
+    }
+
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      uint32_t sum = 0U;
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        sum += map.find(i * 2654435761U)->second;
+      }
+
+      benchmark::do_not_optimise(sum);
+    }
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, vector_push_back, etl)
+{
+  etl::vector<int, SIZE> vector;
+  vector_push_back(state, vector);
+}
+
+ETL_BENCHMARK(containers, vector_push_back, std)
+{
+  std::vector<int> vector;
+  vector.reserve(SIZE);
+  vector_push_back(state, vector);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, vector_iterate, etl)
+{
+  etl::vector<int, SIZE> vector;
+  vector_iterate(state, vector);
+}
+
+ETL_BENCHMARK(containers, vector_iterate, std)
+{
+  std::vector<int> vector;
+  vector_iterate(state, vector);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, deque_push_pop, etl)
+{
+  etl::deque<int, SIZE> deque;
+  deque_push_pop(state, deque);
+}
+
+ETL_BENCHMARK(containers, deque_push_pop, std)
+{
+  std::deque<int> deque;
+  deque_push_pop(state, deque);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, map_insert_find_erase, etl)
+{
+  static etl::map<uint32_t, uint32_t, SIZE> map;
+  map_insert_find_erase(state, map);
+}
+
+ETL_BENCHMARK(containers, map_insert_find_erase, std)
+{
+  std::map<uint32_t, uint32_t> map;
+  map_insert_find_erase(state, map);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, map_find, etl)
+{
+  static etl::map<uint32_t, uint32_t, SIZE> map;
+  map.clear();
+  map_find(state, map);
+}
+
+ETL_BENCHMARK(containers, map_find, std)
+{
+  std::map<uint32_t, uint32_t> map;
+  map_find(state, map);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, unordered_map_insert_find_erase, etl)
+{
+  static etl::unordered_map<uint32_t, uint32_t, SIZE> map;
+  map_insert_find_erase(state, map);
+}
+
+ETL_BENCHMARK(containers, unordered_map_insert_find_erase, etl_flat)
+{
+  static etl::unordered_flat_map<uint32_t, uint32_t, SIZE> map;
+  map_insert_find_erase(state, map);
+}
+
+ETL_BENCHMARK(containers, unordered_map_insert_find_erase, std)
+{
+  std::unordered_map<uint32_t, uint32_t> map;
+  map.reserve(SIZE);
+  map_insert_find_erase(state, map);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(containers, unordered_map_find, etl)
+{
+  static etl::unordered_map<uint32_t, uint32_t, SIZE> map;
+  map.clear();
+  map_find(state, map);
+}
+
+ETL_BENCHMARK(containers, unordered_map_find, etl_flat)
+{
+  static etl::unordered_flat_map<uint32_t, uint32_t, SIZE> map;
+  map.clear();
+  map_find(state, map);
+}
+
+ETL_BENCHMARK(containers, unordered_map_find, std)
+{
+  std::unordered_map<uint32_t, uint32_t> map;
+  map_find(state, map);
+}
@@ -0,0 +1,138 @@
+// bench_hashes.cpp : Hash and CRC benchmarks over a 1 KiB buffer.
+// The STL only has std::hash, so that is the comparison for etl::hash.
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+#include "benchmark.h"
+
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/fnv_1.h"
+#include "etl/murmur3.h"
+#include "etl/xxhash.h"
+#include "etl/hash.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  const size_t SIZE = 1024U;
+
+  //***************************************************************************
+  struct buffer
+  {
+    buffer()
+    {
+      uint32_t seed = 1U;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        seed     = (seed * 1664525U) + 1013904223U;
+        data[i]  = uint8_t(seed >> 24);
+        text[i]  = char('a' + (data[i] % 26U));
+      }
+    }
+
+    uint8_t data[SIZE];
+    char    text[SIZE];
+  };
+
+  const buffer input;
+
+  //***************************************************************************
+  template <typename THash>
+  void hash_buffer(benchmark::state& state)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      THash hash(input.data, input.data + SIZE);
+      benchmark::do_not_optimise(hash.value());
+    }
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(hashes, crc16_ccitt_1k, etl)
+{
+  hash_buffer<etl::crc16_ccitt>(state);
+}
+
+ETL_BENCHMARK(hashes, crc32_1k, etl)
+{
+  hash_buffer<etl::crc32>(state);
+}
+
+ETL_BENCHMARK(hashes, crc32_c_1k, etl)
+{
+  hash_buffer<etl::crc32_c>(state);
+}
+
+ETL_BENCHMARK(hashes, fnv_1a_32_1k, etl)
+{
+  hash_buffer<etl::fnv_1a_32>(state);
+}
+
+ETL_BENCHMARK(hashes, murmur3_32_1k, etl)
+{
+  hash_buffer<etl::murmur3<uint32_t> >(state);
+}
+
+ETL_BENCHMARK(hashes, xxhash32_1k, etl)
+{
+  hash_buffer<etl::xxhash32>(state);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(hashes, string_hash_1k, etl)
+{
+  const etl::string_view text(input.text, SIZE);
+  etl::hash<etl::string_view> hasher;
+
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    benchmark::do_not_optimise(hasher(text));
+  }
+}
+
+ETL_BENCHMARK(hashes, string_hash_1k, std)
+{
+  const std::string text(input.text, SIZE);
+  std::hash<std::string> hasher;
+
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    benchmark::do_not_optimise(hasher(text));
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(hashes, integer_hash, etl)
+{
+  etl::hash<uint32_t> hasher;
+  uint32_t            key = 0U;
+
+  while (state.keep_running())
+  {
+    benchmark::do_not_optimise(hasher(++key));
+  }
+}
+
+ETL_BENCHMARK(hashes, integer_hash, std)
+{
+  std::hash<uint32_t> hasher;
+  uint32_t            key = 0U;
+
+  while (state.keep_running())
+  {
+    benchmark::do_not_optimise(hasher(++key));
+  }
+}
@@ -0,0 +1,148 @@
+// bench_latency.cpp : Single call latency, measured in cycles with
+// etl::benchmark. These are the same measurements that would be made on
+// target hardware, so desktop and MCU numbers may be compared.
+
+#include <stdint.h>
+
+#include <unordered_map>
+
+#include "benchmark.h"
+
+#include "etl/benchmark.h"
+
+#if ETL_HAS_DEFAULT_CYCLE_COUNTER
+
+#include "etl/unordered_map.h"
+#include "etl/unordered_flat_map.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/crc32.h"
+
+namespace
+{
+  const size_t SAMPLES = 1000U;
+  const size_t WARM_UP = 100U;
+  const size_t SIZE    = 256U;
+
+  //***************************************************************************
+  /// Finds a different key on each call.
+  //***************************************************************************
+  template <typename TMap>
+  struct find_next
+  {
+    find_next(const TMap& map_)
+      : map(map_)
+      , key(0U)
+    {
+    }
+
+    void operator()()
+    {
+      benchmark::do_not_optimise(map.find((key % SIZE) * 2654435761U)->second);
+      ++key;
+    }
+
+    const TMap& map;
+    uint32_t    key;
+  };
+
+  //***************************************************************************
+  template <typename TMap>
+  void find_latency(benchmark::latency_result& result, TMap& map)
+  {
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      map.insert(typename TMap::value_type(i * 2654435761U, i));
+    }
+
+    etl::benchmark<SAMPLES> bench;
+    bench.run(find_next<TMap>(map), WARM_UP);
+    result.set(bench);
+  }
+
+  //***************************************************************************
+  typedef etl::queue_spsc_atomic<int, 16> spsc_queue;
+
+  struct spsc_push_pop
+  {
+    spsc_push_pop(spsc_queue& queue_)
+      : queue(queue_)
+    {
+    }
+
+    void operator()()
+    {
+      int value = 0;
+      queue.push(1);
+      queue.pop(value);
+      benchmark::do_not_optimise(value);
+    }
+
+    spsc_queue& queue;
+  };
+
+  //***************************************************************************
+  struct crc32_range
+  {
+    crc32_range(const uint8_t* begin_, const uint8_t* end_)
+      : begin(begin_)
+      , end(end_)
+    {
+    }
+
+    void operator()()
+    {
+      benchmark::do_not_optimise(etl::crc32(begin, end).value());
+    }
+
+    const uint8_t* begin;
+    const uint8_t* end;
+  };
+}
+
+//*****************************************************************************
+ETL_LATENCY_BENCHMARK(containers, unordered_map_find, etl)
+{
+  static etl::unordered_map<uint32_t, uint32_t, SIZE> map;
+  map.clear();
+  find_latency(result, map);
+}
+
+ETL_LATENCY_BENCHMARK(containers, unordered_map_find, etl_flat)
+{
+  static etl::unordered_flat_map<uint32_t, uint32_t, SIZE> map;
+  map.clear();
+  find_latency(result, map);
+}
+
+ETL_LATENCY_BENCHMARK(containers, unordered_map_find, std)
+{
+  std::unordered_map<uint32_t, uint32_t> map;
+  find_latency(result, map);
+}
+
+//*****************************************************************************
+ETL_LATENCY_BENCHMARK(queues, queue_spsc_atomic_push_pop, etl)
+{
+  spsc_queue queue;
+
+  etl::benchmark<SAMPLES> bench;
+  bench.run(spsc_push_pop(queue), WARM_UP);
+  result.set(bench);
+}
+
+//*****************************************************************************
+ETL_LATENCY_BENCHMARK(hashes, crc32_64_bytes, etl)
+{
+  uint8_t data[64];
+
+  for (size_t i = 0U; i < sizeof(data); ++i)
+  {
+    data[i] = uint8_t(i * 37U);
+  }
+
+  etl::benchmark<SAMPLES> bench;
+  bench.run(crc32_range(data, data + sizeof(data)), WARM_UP);
+  result.set(bench);
+}
+
+#endif
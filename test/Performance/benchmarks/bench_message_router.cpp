@@ -0,0 +1,96 @@
+// bench_message_router.cpp : Message dispatch benchmarks.
+// etl::message_router is compared with a table of std::function handlers
+// indexed by message id, the usual STL way of routing by id.
+
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+#include "benchmark.h"
+
+#include "etl/message.h"
+#include "etl/message_router.h"
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3,
+    MESSAGE4
+  };
+
+  struct Message1 : public etl::message<MESSAGE1> { int value; };
+  struct Message2 : public etl::message<MESSAGE2> { int value; };
+  struct Message3 : public etl::message<MESSAGE3> { int value; };
+  struct Message4 : public etl::message<MESSAGE4> { int value; };
+
+  Message1 message1;
+  Message2 message2;
+  Message3 message3;
+  Message4 message4;
+
+  const etl::imessage* const messages[4] = { &message1, &message2, &message3, &message4 };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3, Message4>
+  {
+  public:
+
+    Router()
+      : message_router(0)
+      , sum(0)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message1& msg) { sum += msg.value; }
+    void on_receive(etl::imessage_router&, const Message2& msg) { sum += msg.value; }
+    void on_receive(etl::imessage_router&, const Message3& msg) { sum += msg.value; }
+    void on_receive(etl::imessage_router&, const Message4& msg) { sum += msg.value; }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    int sum;
+  };
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(messages, route_4_types, etl)
+{
+  Router router;
+  size_t index = 0U;
+
+  while (state.keep_running())
+  {
+    router.receive(*messages[index & 3U]);
+    ++index;
+  }
+
+  benchmark::do_not_optimise(router.sum);
+}
+
+ETL_BENCHMARK(messages, route_4_types, std)
+{
+  int sum = 0;
+
+  std::vector<std::function<void(const etl::imessage&)> > handlers(4);
+  handlers[MESSAGE1] = [&sum](const etl::imessage& msg) { sum += static_cast<const Message1&>(msg).value; };
+  handlers[MESSAGE2] = [&sum](const etl::imessage& msg) { sum += static_cast<const Message2&>(msg).value; };
+  handlers[MESSAGE3] = [&sum](const etl::imessage& msg) { sum += static_cast<const Message3&>(msg).value; };
+  handlers[MESSAGE4] = [&sum](const etl::imessage& msg) { sum += static_cast<const Message4&>(msg).value; };
+
+  size_t index = 0U;
+
+  while (state.keep_running())
+  {
+    const etl::imessage& msg = *messages[index & 3U];
+    handlers[msg.message_id](msg);
+    ++index;
+  }
+
+  benchmark::do_not_optimise(sum);
+}
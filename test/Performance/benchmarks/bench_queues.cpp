@@ -0,0 +1,112 @@
+// bench_queues.cpp : Queue benchmarks, ETL against the STL.
+// The lock free queues are exercised from one thread, which measures the cost
+// of their atomic operations without contention.
+
+#include <stdint.h>
+
+#include <queue>
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/circular_buffer.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+namespace
+{
+  const size_t SIZE = 256U;
+
+  //***************************************************************************
+  template <typename TQueue>
+  void queue_push_pop(benchmark::state& state, TQueue& queue)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        queue.push(int(i));
+      }
+
+      while (!queue.empty())
+      {
+        benchmark::do_not_optimise(queue.front());
+        queue.pop();
+      }
+    }
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void concurrent_queue_push_pop(benchmark::state& state, TQueue& queue)
+  {
+    state.set_items_per_iteration(SIZE);
+
+    while (state.keep_running())
+    {
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        queue.push(int(i));
+      }
+
+      int value = 0;
+
+      while (queue.pop(value))
+      {
+        benchmark::do_not_optimise(value);
+      }
+    }
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(queues, queue_push_pop, etl)
+{
+  etl::queue<int, SIZE> queue;
+  queue_push_pop(state, queue);
+}
+
+ETL_BENCHMARK(queues, queue_push_pop, std)
+{
+  std::queue<int> queue;
+  queue_push_pop(state, queue);
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(queues, circular_buffer_push_pop, etl)
+{
+  etl::circular_buffer<int, SIZE> buffer;
+
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      buffer.push(int(i));
+    }
+
+    while (!buffer.empty())
+    {
+      benchmark::do_not_optimise(buffer.front());
+      buffer.pop();
+    }
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(queues, queue_spsc_atomic_push_pop, etl)
+{
+  static etl::queue_spsc_atomic<int, SIZE> queue;
+  concurrent_queue_push_pop(state, queue);
+}
+
+#if ETL_HAS_MUTEX
+ETL_BENCHMARK(queues, queue_mpmc_mutex_push_pop, etl)
+{
+  static etl::queue_mpmc_mutex<int, SIZE> queue;
+  concurrent_queue_push_pop(state, queue);
+}
+#endif
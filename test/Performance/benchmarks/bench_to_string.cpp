@@ -0,0 +1,99 @@
+// bench_to_string.cpp : Number formatting benchmarks, etl::to_string against
+// std::to_string.
+
+#include <stdint.h>
+
+#include <string>
+
+#include "benchmark.h"
+
+#include "etl/cstring.h"
+#include "etl/to_string.h"
+
+namespace
+{
+  const size_t SIZE = 64U;
+
+  //***************************************************************************
+  struct values
+  {
+    values()
+    {
+      uint32_t seed = 7U;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        seed        = (seed * 1664525U) + 1013904223U;
+        integers[i] = int32_t(seed);
+        doubles[i]  = double(int32_t(seed)) / 1000.0;
+      }
+    }
+
+    int32_t integers[SIZE];
+    double  doubles[SIZE];
+  };
+
+  const values input;
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(to_string, int32, etl)
+{
+  etl::string<32> text;
+
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      etl::to_string(input.integers[i], text);
+      benchmark::do_not_optimise(text);
+    }
+  }
+}
+
+ETL_BENCHMARK(to_string, int32, std)
+{
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      std::string text = std::to_string(input.integers[i]);
+      benchmark::do_not_optimise(text);
+    }
+  }
+}
+
+//*****************************************************************************
+ETL_BENCHMARK(to_string, double, etl)
+{
+  etl::string<32> text;
+
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      etl::to_string(input.doubles[i], text);
+      benchmark::do_not_optimise(text);
+    }
+  }
+}
+
+ETL_BENCHMARK(to_string, double, std)
+{
+  state.set_items_per_iteration(SIZE);
+
+  while (state.keep_running())
+  {
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      std::string text = std::to_string(input.doubles[i]);
+      benchmark::do_not_optimise(text);
+    }
+  }
+}
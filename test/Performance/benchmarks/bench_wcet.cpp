@@ -0,0 +1,499 @@
+// bench_wcet.cpp : Worst case execution time characterisation.
+//
+// Each scenario drives a container at capacity into the state that is most
+// expensive for one operation, then times that single operation. The setup is
+// repeated before every sample and is not included in the measurement.
+// The 'max' column is the figure of interest; the other columns show how far
+// typical calls are from it.
+//
+// Run with 'etl_benchmarks --wcet'. These are measured maxima on the host, not
+// proven bounds; run the same scenarios on the target for deadline budgets.
+
+#include <stdint.h>
+
+#include "benchmark.h"
+
+#include "etl/benchmark.h"
+
+#if ETL_HAS_DEFAULT_CYCLE_COUNTER
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/map.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/algorithm.h"
+
+namespace
+{
+  const size_t SAMPLES = 500U;
+  const size_t SIZE    = 64U;
+
+  //***************************************************************************
+  /// Runs the scenario's setup before each sample and times one operation.
+  //***************************************************************************
+  template <typename TScenario>
+  void measure_wcet(benchmark::latency_result& result)
+  {
+    static TScenario scenario;
+
+    // Warm up.
+    for (size_t i = 0U; i < 10U; ++i)
+    {
+      scenario.setup();
+      scenario.operation();
+    }
+
+    etl::benchmark<SAMPLES> bench;
+
+    while (!bench.full())
+    {
+      scenario.setup();
+
+      ETL_BENCHMARK_BARRIER();
+      etl::benchmark<SAMPLES>::value_type begin = bench.start();
+      scenario.operation();
+      bench.stop(begin);
+      ETL_BENCHMARK_BARRIER();
+    }
+
+    result.set(bench);
+  }
+
+  //***************************************************************************
+  /// A hash that sends every key to the same bucket.
+  //***************************************************************************
+  struct colliding_hash
+  {
+    size_t operator()(uint32_t) const
+    {
+      return 0U;
+    }
+  };
+
+  //***************************************************************************
+  // vector
+  //***************************************************************************
+  typedef etl::vector<uint32_t, SIZE> vector_t;
+
+  /// Fills all but the last slot, so push_back takes the last free space.
+  struct vector_push_back
+  {
+    void setup()
+    {
+      vector.clear();
+      for (uint32_t i = 0U; i < SIZE - 1U; ++i)
+      {
+        vector.push_back(i);
+      }
+    }
+
+    void operation()
+    {
+      vector.push_back(uint32_t(SIZE));
+    }
+
+    vector_t vector;
+  };
+
+  /// Inserting at the front moves every element.
+  struct vector_insert_front : vector_push_back
+  {
+    void operation()
+    {
+      vector.insert(vector.begin(), uint32_t(SIZE));
+    }
+  };
+
+  /// Erasing the front of a full vector moves every element.
+  struct vector_erase_front
+  {
+    void setup()
+    {
+      vector.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        vector.push_back(i);
+      }
+    }
+
+    void operation()
+    {
+      vector.erase(vector.begin());
+    }
+
+    vector_t vector;
+  };
+
+  /// Searching a full vector for a missing value visits every element.
+  struct vector_find_missing : vector_erase_front
+  {
+    void operation()
+    {
+      benchmark::do_not_optimise(etl::find(vector.begin(), vector.end(), uint32_t(SIZE)));
+    }
+  };
+
+  //***************************************************************************
+  // deque
+  //***************************************************************************
+  typedef etl::deque<uint32_t, SIZE> deque_t;
+
+  /// Inserting into the middle moves half of the elements, with the
+  /// ring buffer wrapped so the moves cross the end of the storage.
+  struct deque_insert_middle
+  {
+    void setup()
+    {
+      deque.clear();
+      for (uint32_t i = 0U; i < SIZE / 2U; ++i)
+      {
+        deque.push_back(i);
+      }
+      for (uint32_t i = 0U; i < (SIZE / 2U) - 1U; ++i)
+      {
+        deque.push_front(i);
+      }
+    }
+
+    void operation()
+    {
+      deque.insert(deque.begin() + (deque.size() / 2U), uint32_t(SIZE));
+    }
+
+    deque_t deque;
+  };
+
+  struct deque_erase_middle
+  {
+    void setup()
+    {
+      deque.clear();
+      for (uint32_t i = 0U; i < SIZE / 2U; ++i)
+      {
+        deque.push_back(i);
+        deque.push_front(i);
+      }
+    }
+
+    void operation()
+    {
+      deque.erase(deque.begin() + (deque.size() / 2U));
+    }
+
+    deque_t deque;
+  };
+
+  struct deque_push_back : deque_insert_middle
+  {
+    void operation()
+    {
+      deque.push_back(uint32_t(SIZE));
+    }
+  };
+
+  //***************************************************************************
+  // map
+  //***************************************************************************
+  typedef etl::map<uint32_t, uint32_t, SIZE> map_t;
+
+  /// Ascending inserts keep the tree at its maximum height for the size,
+  /// and the final insert triggers a rebalance along the longest path.
+  struct map_insert
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 0U; i < SIZE - 1U; ++i)
+      {
+        map.insert(map_t::value_type(i, i));
+      }
+    }
+
+    void operation()
+    {
+      map.insert(map_t::value_type(uint32_t(SIZE), 0U));
+    }
+
+    map_t map;
+  };
+
+  /// Erasing an interior node of a full tree needs a successor search and a rebalance.
+  struct map_erase_middle
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        map.insert(map_t::value_type(i, i));
+      }
+
+      key = SIZE / 2U;
+    }
+
+    void operation()
+    {
+      map.erase(key);
+    }
+
+    map_t    map;
+    uint32_t key;
+  };
+
+  /// A missing key beyond the largest descends the full height of the tree.
+  struct map_find_missing : map_erase_middle
+  {
+    void operation()
+    {
+      benchmark::do_not_optimise(map.find(uint32_t(SIZE)));
+    }
+  };
+
+  //***************************************************************************
+  // flat_map
+  //***************************************************************************
+  typedef etl::flat_map<uint32_t, uint32_t, SIZE> flat_map_t;
+
+  /// Inserting the smallest key moves every element.
+  struct flat_map_insert_front
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 1U; i < SIZE; ++i)
+      {
+        map.insert(flat_map_t::value_type(i, i));
+      }
+    }
+
+    void operation()
+    {
+      map.insert(flat_map_t::value_type(0U, 0U));
+    }
+
+    flat_map_t map;
+  };
+
+  /// Erasing the smallest key of a full map moves every element.
+  struct flat_map_erase_front
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        map.insert(flat_map_t::value_type(i, i));
+      }
+    }
+
+    void operation()
+    {
+      map.erase(0U);
+    }
+
+    flat_map_t map;
+  };
+
+  struct flat_map_find_missing : flat_map_erase_front
+  {
+    void operation()
+    {
+      benchmark::do_not_optimise(map.find(uint32_t(SIZE)));
+    }
+  };
+
+  //***************************************************************************
+  // unordered_map
+  //***************************************************************************
+  typedef etl::unordered_map<uint32_t, uint32_t, SIZE, SIZE, colliding_hash> unordered_map_t;
+
+  /// Every key collides, so an insert into the full table first searches
+  /// the one chain for a duplicate.
+  struct unordered_map_insert
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 0U; i < SIZE - 1U; ++i)
+      {
+        map.insert(unordered_map_t::value_type(i, i));
+      }
+    }
+
+    void operation()
+    {
+      map.insert(unordered_map_t::value_type(uint32_t(SIZE), 0U));
+    }
+
+    unordered_map_t map;
+  };
+
+  /// A missing key walks the whole chain.
+  struct unordered_map_find_missing
+  {
+    void setup()
+    {
+      if (map.empty())
+      {
+        for (uint32_t i = 0U; i < SIZE; ++i)
+        {
+          map.insert(unordered_map_t::value_type(i, i));
+        }
+      }
+    }
+
+    void operation()
+    {
+      benchmark::do_not_optimise(map.find(uint32_t(SIZE)));
+    }
+
+    unordered_map_t map;
+  };
+
+  /// Erasing the key at the far end of the chain.
+  struct unordered_map_erase
+  {
+    void setup()
+    {
+      map.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        map.insert(unordered_map_t::value_type(i, i));
+      }
+
+      // Find the key at the end of the chain, wherever insertion placed it.
+      unordered_map_t::const_iterator itr = map.begin();
+      for (size_t i = 1U; i < map.size(); ++i)
+      {
+        ++itr;
+      }
+
+      last = itr->first;
+    }
+
+    void operation()
+    {
+      map.erase(last);
+    }
+
+    unordered_map_t map;
+    uint32_t        last;
+  };
+
+  //***************************************************************************
+  // Queues
+  //***************************************************************************
+  typedef etl::queue<uint32_t, SIZE> queue_t;
+
+  /// The write index wraps at the end of the storage.
+  struct queue_push
+  {
+    void setup()
+    {
+      queue.clear();
+      for (uint32_t i = 0U; i < SIZE - 1U; ++i)
+      {
+        queue.push(i);
+      }
+    }
+
+    void operation()
+    {
+      queue.push(uint32_t(SIZE));
+    }
+
+    queue_t queue;
+  };
+
+  struct queue_pop
+  {
+    void setup()
+    {
+      queue.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        queue.push(i);
+      }
+    }
+
+    void operation()
+    {
+      queue.pop();
+    }
+
+    queue_t queue;
+  };
+
+  typedef etl::queue_spsc_atomic<uint32_t, SIZE> queue_spsc_t;
+
+  struct queue_spsc_atomic_push
+  {
+    void setup()
+    {
+      queue.clear();
+      for (uint32_t i = 0U; i < SIZE - 1U; ++i)
+      {
+        queue.push(i);
+      }
+    }
+
+    void operation()
+    {
+      benchmark::do_not_optimise(queue.push(uint32_t(SIZE)));
+    }
+
+    queue_spsc_t queue;
+  };
+
+  struct queue_spsc_atomic_pop
+  {
+    void setup()
+    {
+      queue.clear();
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        queue.push(i);
+      }
+    }
+
+    void operation()
+    {
+      uint32_t value;
+      benchmark::do_not_optimise(queue.pop(value));
+    }
+
+    queue_spsc_t queue;
+  };
+}
+
+//*****************************************************************************
+ETL_LATENCY_BENCHMARK(wcet, vector_push_back, etl)           { measure_wcet<vector_push_back>(result); }
+ETL_LATENCY_BENCHMARK(wcet, vector_insert_front, etl)        { measure_wcet<vector_insert_front>(result); }
+ETL_LATENCY_BENCHMARK(wcet, vector_erase_front, etl)         { measure_wcet<vector_erase_front>(result); }
+ETL_LATENCY_BENCHMARK(wcet, vector_find_missing, etl)        { measure_wcet<vector_find_missing>(result); }
+
+ETL_LATENCY_BENCHMARK(wcet, deque_push_back, etl)            { measure_wcet<deque_push_back>(result); }
+ETL_LATENCY_BENCHMARK(wcet, deque_insert_middle, etl)        { measure_wcet<deque_insert_middle>(result); }
+ETL_LATENCY_BENCHMARK(wcet, deque_erase_middle, etl)         { measure_wcet<deque_erase_middle>(result); }
+
+ETL_LATENCY_BENCHMARK(wcet, map_insert, etl)                 { measure_wcet<map_insert>(result); }
+ETL_LATENCY_BENCHMARK(wcet, map_erase_middle, etl)           { measure_wcet<map_erase_middle>(result); }
+ETL_LATENCY_BENCHMARK(wcet, map_find_missing, etl)           { measure_wcet<map_find_missing>(result); }
+
+ETL_LATENCY_BENCHMARK(wcet, flat_map_insert_front, etl)      { measure_wcet<flat_map_insert_front>(result); }
+ETL_LATENCY_BENCHMARK(wcet, flat_map_erase_front, etl)       { measure_wcet<flat_map_erase_front>(result); }
+ETL_LATENCY_BENCHMARK(wcet, flat_map_find_missing, etl)      { measure_wcet<flat_map_find_missing>(result); }
+
+ETL_LATENCY_BENCHMARK(wcet, unordered_map_insert, etl)       { measure_wcet<unordered_map_insert>(result); }
+ETL_LATENCY_BENCHMARK(wcet, unordered_map_erase, etl)        { measure_wcet<unordered_map_erase>(result); }
+ETL_LATENCY_BENCHMARK(wcet, unordered_map_find_missing, etl) { measure_wcet<unordered_map_find_missing>(result); }
+
+ETL_LATENCY_BENCHMARK(wcet, queue_push, etl)                 { measure_wcet<queue_push>(result); }
+ETL_LATENCY_BENCHMARK(wcet, queue_pop, etl)                  { measure_wcet<queue_pop>(result); }
+ETL_LATENCY_BENCHMARK(wcet, queue_spsc_atomic_push, etl)     { measure_wcet<queue_spsc_atomic_push>(result); }
+ETL_LATENCY_BENCHMARK(wcet, queue_spsc_atomic_pop, etl)      { measure_wcet<queue_spsc_atomic_pop>(result); }
+
+#endif
@@ -0,0 +1,244 @@
+// benchmark.h : A small portable micro-benchmark harness for etl_benchmarks.
+//
+// A benchmark is a function taking a benchmark::state. The body to be timed
+// goes in a 'while (state.keep_running())' loop; the harness runs it until
+// the minimum time has passed, checking the clock after 1, 2, 4, 8... passes
+// so that the clock is read rarely.
+//
+//   ETL_BENCHMARK(containers, vector_push_back, etl)
+//   {
+//     state.set_items_per_iteration(1024);
+//
+//     while (state.keep_running())
+//     {
+//       ...
+//     }
+//   }
+//
+// Benchmarks with the same group and name, but a different library, are
+// compared with each other in the text report.
+//
+// Latency benchmarks report the distribution of single call costs, measured
+// in cycles with etl::benchmark, the same harness used on target hardware.
+//
+//   ETL_LATENCY_BENCHMARK(containers, unordered_map_find, etl)
+//   {
+//     etl::benchmark<1000> bench;
+//     bench.run(...);
+//     result.set(bench);
+//   }
+
+#ifndef ETL_BENCHMARKS_HARNESS_INCLUDED
+#define ETL_BENCHMARKS_HARNESS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+namespace benchmark
+{
+  //***************************************************************************
+  /// The state of one benchmark run.
+  //***************************************************************************
+  class state
+  {
+  public:
+
+    typedef std::chrono::steady_clock clock;
+
+    explicit state(double min_seconds_)
+      : min_time(std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(min_seconds_)))
+      , iterations(0U)
+      , next_check(0U)
+      , items_per_iteration(1U)
+      , elapsed(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns true while the benchmark body should run again.
+    //*************************************************************************
+    bool keep_running()
+    {
+      if (iterations != next_check)
+      {
+        ++iterations;
+        return true;
+      }
+
+      return check();
+    }
+
+    //*************************************************************************
+    /// Sets the number of items processed by one pass of the body.
+    //*************************************************************************
+    void set_items_per_iteration(uint64_t items)
+    {
+      items_per_iteration = items;
+    }
+
+    uint64_t iteration_count() const
+    {
+      return iterations;
+    }
+
+    uint64_t item_count() const
+    {
+      return iterations * items_per_iteration;
+    }
+
+    double elapsed_ns() const
+    {
+      return double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+  private:
+
+    bool check()
+    {
+      const clock::time_point now = clock::now();
+
+      if (iterations == 0U)
+      {
+        start      = now;
+        next_check = 1U;
+        iterations = 1U;
+        return true;
+      }
+
+      elapsed = now - start;
+
+      if (elapsed >= min_time)
+      {
+        return false;
+      }
+
+      next_check *= 2U;
+      ++iterations;
+
+      return true;
+    }
+
+    clock::duration   min_time;
+    uint64_t          iterations;
+    uint64_t          next_check;
+    uint64_t          items_per_iteration;
+    clock::time_point start;
+    clock::duration   elapsed;
+  };
+
+  //***************************************************************************
+  /// Stops the compiler from discarding a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// The registered benchmarks.
+  //***************************************************************************
+  typedef void (*function_type)(state&);
+
+  struct entry
+  {
+    const char*   group;
+    const char*   name;
+    const char*   library;
+    function_type function;
+  };
+
+  inline std::vector<entry>& registry()
+  {
+    static std::vector<entry> entries;
+    return entries;
+  }
+
+  struct registrar
+  {
+    registrar(const char* group, const char* name, const char* library, function_type function)
+    {
+      entry e = { group, name, library, function };
+      registry().push_back(e);
+    }
+  };
+
+  //***************************************************************************
+  /// The result of a latency benchmark.
+  //***************************************************************************
+  struct latency_result
+  {
+    latency_result()
+      : unit("")
+      , samples(0U)
+      , min(0U)
+      , median(0U)
+      , p99(0U)
+      , max(0U)
+    {
+    }
+
+    template <typename TBenchmark>
+    void set(const TBenchmark& bench)
+    {
+      unit    = bench.unit();
+      samples = bench.size();
+      min     = bench.min();
+      median  = bench.median();
+      p99     = bench.percentile(99U);
+      max     = bench.max();
+    }
+
+    const char* unit;
+    uint64_t    samples;
+    uint64_t    min;
+    uint64_t    median;
+    uint64_t    p99;
+    uint64_t    max;
+  };
+
+  typedef void (*latency_function_type)(latency_result&);
+
+  struct latency_entry
+  {
+    const char*           group;
+    const char*           name;
+    const char*           library;
+    latency_function_type function;
+  };
+
+  inline std::vector<latency_entry>& latency_registry()
+  {
+    static std::vector<latency_entry> entries;
+    return entries;
+  }
+
+  struct latency_registrar
+  {
+    latency_registrar(const char* group, const char* name, const char* library, latency_function_type function)
+    {
+      latency_entry e = { group, name, library, function };
+      latency_registry().push_back(e);
+    }
+  };
+}
+
+#define ETL_BENCHMARK(group, name, library) \
+  static void benchmark_##group##_##name##_##library(benchmark::state& state); \
+  static benchmark::registrar registrar_##group##_##name##_##library(#group, #name, #library, benchmark_##group##_##name##_##library); \
+  static void benchmark_##group##_##name##_##library(benchmark::state& state)
+
+#define ETL_LATENCY_BENCHMARK(group, name, library) \
+  static void latency_##group##_##name##_##library(benchmark::latency_result& result); \
+  static benchmark::latency_registrar latency_registrar_##group##_##name##_##library(#group, #name, #library, latency_##group##_##name##_##library); \
+  static void latency_##group##_##name##_##library(benchmark::latency_result& result)
+
+#endif
@@ -0,0 +1,120 @@
+// footprint.cpp : Prints the memory footprint of common container instantiations.
+//
+//   etl_footprint [--format=text|csv]
+//
+// The figures come from etl::footprint and are fixed at compile time, so the
+// report describes the target that this is built for. Build it with the
+// target's compiler and profile to compare containers for a workload.
+//
+// storage   The bytes taken by the container.
+// payload   The bytes needed for the elements alone.
+// per elem  The overhead for each element, such as node links.
+// fixed     The overhead that does not depend on the capacity.
+// padding   The estimated alignment padding for each element in a node.
+// eff %     The percentage of the storage that holds elements.
+
+#include <stdio.h>
+#include <string.h>
+
+#include <stdint.h>
+
+#include "etl/footprint.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/queue.h"
+#include "etl/map.h"
+#include "etl/set.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/pool.h"
+#include "etl/cstring.h"
+
+namespace
+{
+  bool csv = false;
+
+  struct small_struct
+  {
+    uint32_t a;
+    uint8_t  b;
+  };
+
+  //***************************************************************************
+  void print_header()
+  {
+    if (csv)
+    {
+      printf("container,capacity,element,storage,payload,overhead_per_element,fixed_overhead,node_padding,efficiency\n");
+    }
+    else
+    {
+      printf("%-48s %8s %8s %10s %10s %9s %8s %8s %6s\n",
+             "container", "capacity", "element", "storage", "payload", "per elem", "fixed", "padding", "eff %");
+    }
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  void print(const char* name)
+  {
+    typedef etl::footprint<TContainer> fp;
+
+    const char* format = csv ? "\"%s\",%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n"
+                             : "%-48s %8lu %8lu %10lu %10lu %9lu %8lu %8lu %6lu\n";
+
+    printf(format, name,
+           static_cast<unsigned long>(fp::CAPACITY),
+           static_cast<unsigned long>(fp::ELEMENT_SIZE),
+           static_cast<unsigned long>(fp::STORAGE),
+           static_cast<unsigned long>(fp::PAYLOAD),
+           static_cast<unsigned long>(fp::OVERHEAD_PER_ELEMENT),
+           static_cast<unsigned long>(fp::FIXED_OVERHEAD),
+           static_cast<unsigned long>(fp::NODE_PADDING),
+           static_cast<unsigned long>(fp::EFFICIENCY));
+  }
+}
+
+#define ETL_FOOTPRINT(...) print<__VA_ARGS__ >(#__VA_ARGS__)
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "--format=csv") == 0)
+    {
+      csv = true;
+    }
+    else if (strcmp(argv[i], "--format=text") != 0)
+    {
+      fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+      return 1;
+    }
+  }
+
+  print_header();
+
+  ETL_FOOTPRINT(etl::vector<uint8_t, 16>);
+  ETL_FOOTPRINT(etl::vector<uint32_t, 16>);
+  ETL_FOOTPRINT(etl::vector<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::vector<small_struct, 256>);
+  ETL_FOOTPRINT(etl::deque<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::queue<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::list<uint8_t, 256>);
+  ETL_FOOTPRINT(etl::list<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::list<small_struct, 256>);
+  ETL_FOOTPRINT(etl::forward_list<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::set<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::map<uint32_t, uint32_t, 256>);
+  ETL_FOOTPRINT(etl::flat_map<uint32_t, uint32_t, 256>);
+  ETL_FOOTPRINT(etl::unordered_map<uint32_t, uint32_t, 256>);
+  ETL_FOOTPRINT(etl::unordered_map<uint32_t, uint32_t, 256, 64>);
+  ETL_FOOTPRINT(etl::pool<uint8_t, 256>);
+  ETL_FOOTPRINT(etl::pool<uint32_t, 256>);
+  ETL_FOOTPRINT(etl::pool<small_struct, 256>);
+  ETL_FOOTPRINT(etl::string<16>);
+  ETL_FOOTPRINT(etl::string<256>);
+
+  return 0;
+}
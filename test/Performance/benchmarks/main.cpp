@@ -0,0 +1,334 @@
+// main.cpp : Runs the etl_benchmarks micro-benchmarks.
+//
+//   etl_benchmarks [--format=text|csv|json] [--filter=<text>] [--min-time=<seconds>]
+//                  [--quick] [--wcet] [--output=<file>]
+//
+// --format   text (default) prints a table comparing each ETL result with the
+//            STL result of the same name. csv and json are for tracking
+//            results across releases.
+// --filter   Only runs benchmarks whose "group/name/library" contains the text.
+// --min-time The minimum time to run each benchmark for. Default 0.1 seconds.
+// --quick    Runs each benchmark briefly. Used as a smoke test by ctest.
+// --wcet     Runs only the worst case execution time scenarios (the 'wcet'
+//            latency group), which are otherwise skipped.
+// --output   Writes the report to a file instead of stdout.
+//
+// Times are nanoseconds per item, where an item is one element, one byte or
+// one call, as set by each benchmark.
+// Latency benchmarks report the minimum, median, 99th percentile and maximum
+// cost of single calls, in the units of the etl::benchmark cycle counter.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+#include "etl/platform.h"
+#include "etl/version.h"
+
+namespace
+{
+  struct result
+  {
+    benchmark::entry entry;
+    uint64_t         iterations;
+    uint64_t         items;
+    double           ns_per_item;
+  };
+
+  struct latency
+  {
+    benchmark::latency_entry  entry;
+    benchmark::latency_result result;
+  };
+
+  //***************************************************************************
+  const char* compiler_name()
+  {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+  }
+
+  //***************************************************************************
+  template <typename TEntry>
+  std::string full_name(const TEntry& e)
+  {
+    return std::string(e.group) + "/" + e.name + "/" + e.library;
+  }
+
+  //***************************************************************************
+  template <typename TEntry>
+  bool entry_less(const TEntry& lhs, const TEntry& rhs)
+  {
+    return full_name(lhs) < full_name(rhs);
+  }
+
+  //***************************************************************************
+  void report_text(FILE* file, const std::vector<result>& results, const std::vector<latency>& latencies)
+  {
+    fprintf(file, "ETL %s, %s\n", ETL_VERSION, compiler_name());
+
+    if (!results.empty())
+    {
+      fprintf(file, "\n%-12s %-36s %-10s %12s %10s\n", "group", "name", "library", "ns/item", "vs std");
+    }
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      // Find the STL result of the same name to compare against.
+      double reference = 0.0;
+
+      for (size_t j = 0U; j < results.size(); ++j)
+      {
+        if ((strcmp(results[j].entry.group, r.entry.group) == 0) &&
+            (strcmp(results[j].entry.name,  r.entry.name)  == 0) &&
+            (strcmp(results[j].entry.library, "std") == 0))
+        {
+          reference = results[j].ns_per_item;
+        }
+      }
+
+      if ((reference > 0.0) && (strcmp(r.entry.library, "std") != 0))
+      {
+        fprintf(file, "%-12s %-36s %-10s %12.3f %9.2fx\n", r.entry.group, r.entry.name, r.entry.library, r.ns_per_item, reference / r.ns_per_item);
+      }
+      else
+      {
+        fprintf(file, "%-12s %-36s %-10s %12.3f\n", r.entry.group, r.entry.name, r.entry.library, r.ns_per_item);
+      }
+    }
+
+    if (!latencies.empty())
+    {
+      fprintf(file, "\nLatency per call, in %s\n", latencies[0].result.unit);
+      fprintf(file, "%-12s %-36s %-10s %8s %8s %8s %8s\n", "group", "name", "library", "min", "median", "p99", "max");
+
+      for (size_t i = 0U; i < latencies.size(); ++i)
+      {
+        const latency& l = latencies[i];
+
+        fprintf(file, "%-12s %-36s %-10s %8llu %8llu %8llu %8llu\n", l.entry.group, l.entry.name, l.entry.library,
+                (unsigned long long)l.result.min, (unsigned long long)l.result.median,
+                (unsigned long long)l.result.p99, (unsigned long long)l.result.max);
+      }
+    }
+  }
+
+  //***************************************************************************
+  void report_csv(FILE* file, const std::vector<result>& results, const std::vector<latency>& latencies)
+  {
+    // One schema for both kinds of result; unused fields are left empty.
+    fprintf(file, "etl_version,kind,group,name,library,iterations,items,ns_per_item,unit,samples,min,median,p99,max\n");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      fprintf(file, "%s,throughput,%s,%s,%s,%llu,%llu,%.4f,,,,,,\n",
+              ETL_VERSION, r.entry.group, r.entry.name, r.entry.library,
+              (unsigned long long)r.iterations, (unsigned long long)r.items, r.ns_per_item);
+    }
+
+    for (size_t i = 0U; i < latencies.size(); ++i)
+    {
+      const latency& l = latencies[i];
+
+      fprintf(file, "%s,latency,%s,%s,%s,,,,%s,%llu,%llu,%llu,%llu,%llu\n",
+              ETL_VERSION, l.entry.group, l.entry.name, l.entry.library, l.result.unit,
+              (unsigned long long)l.result.samples, (unsigned long long)l.result.min, (unsigned long long)l.result.median,
+              (unsigned long long)l.result.p99, (unsigned long long)l.result.max);
+    }
+  }
+
+  //***************************************************************************
+  void report_json(FILE* file, const std::vector<result>& results, const std::vector<latency>& latencies)
+  {
+    fprintf(file, "{\n  \"etl_version\": \"%s\",\n  \"compiler\": \"%s\",\n  \"results\": [\n", ETL_VERSION, compiler_name());
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      fprintf(file, "    { \"group\": \"%s\", \"name\": \"%s\", \"library\": \"%s\", \"iterations\": %llu, \"items\": %llu, \"ns_per_item\": %.4f }%s\n",
+              r.entry.group, r.entry.name, r.entry.library,
+              (unsigned long long)r.iterations, (unsigned long long)r.items, r.ns_per_item,
+              (i + 1U < results.size()) ? "," : "");
+    }
+
+    fprintf(file, "  ],\n  \"latency\": [\n");
+
+    for (size_t i = 0U; i < latencies.size(); ++i)
+    {
+      const latency& l = latencies[i];
+
+      fprintf(file, "    { \"group\": \"%s\", \"name\": \"%s\", \"library\": \"%s\", \"unit\": \"%s\", \"samples\": %llu, \"min\": %llu, \"median\": %llu, \"p99\": %llu, \"max\": %llu }%s\n",
+              l.entry.group, l.entry.name, l.entry.library, l.result.unit,
+              (unsigned long long)l.result.samples, (unsigned long long)l.result.min, (unsigned long long)l.result.median,
+              (unsigned long long)l.result.p99, (unsigned long long)l.result.max,
+              (i + 1U < latencies.size()) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+  }
+
+  //***************************************************************************
+  bool starts_with(const char* text, const char* prefix, const char*& rest)
+  {
+    const size_t length = strlen(prefix);
+
+    if (strncmp(text, prefix, length) == 0)
+    {
+      rest = text + length;
+      return true;
+    }
+
+    return false;
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  std::string format   = "text";
+  std::string filter;
+  std::string output;
+  double      min_time = 0.1;
+  bool        wcet     = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const char* value = NULL;
+
+    if (starts_with(argv[i], "--format=", value))
+    {
+      format = value;
+    }
+    else if (starts_with(argv[i], "--filter=", value))
+    {
+      filter = value;
+    }
+    else if (starts_with(argv[i], "--min-time=", value))
+    {
+      min_time = atof(value);
+    }
+    else if (starts_with(argv[i], "--output=", value))
+    {
+      output = value;
+    }
+    else if (strcmp(argv[i], "--quick") == 0)
+    {
+      min_time = 0.001;
+    }
+    else if (strcmp(argv[i], "--wcet") == 0)
+    {
+      wcet = true;
+    }
+    else
+    {
+      fprintf(stderr, "Unknown argument '%s'\n", argv[i]);
+      return 1;
+    }
+  }
+
+  if ((format != "text") && (format != "csv") && (format != "json"))
+  {
+    fprintf(stderr, "Unknown format '%s'\n", format.c_str());
+    return 1;
+  }
+
+  std::vector<result> results;
+
+  // Registration order depends on static initialisation, so sort by name.
+  std::vector<benchmark::entry> entries = benchmark::registry();
+  std::sort(entries.begin(), entries.end(), entry_less<benchmark::entry>);
+
+  for (size_t i = 0U; (i < entries.size()) && !wcet; ++i)
+  {
+    if (!filter.empty() && (full_name(entries[i]).find(filter) == std::string::npos))
+    {
+      continue;
+    }
+
+    benchmark::state state(min_time);
+    entries[i].function(state);
+
+    result r;
+    r.entry       = entries[i];
+    r.iterations  = state.iteration_count();
+    r.items       = state.item_count();
+    r.ns_per_item = (r.items != 0U) ? (state.elapsed_ns() / double(r.items)) : 0.0;
+
+    results.push_back(r);
+  }
+
+  std::vector<latency> latencies;
+
+  std::vector<benchmark::latency_entry> latency_entries = benchmark::latency_registry();
+  std::sort(latency_entries.begin(), latency_entries.end(), entry_less<benchmark::latency_entry>);
+
+  for (size_t i = 0U; i < latency_entries.size(); ++i)
+  {
+    if (!filter.empty() && (full_name(latency_entries[i]).find(filter) == std::string::npos))
+    {
+      continue;
+    }
+
+    if ((strcmp(latency_entries[i].group, "wcet") == 0) != wcet)
+    {
+      continue;
+    }
+
+    latency l;
+    l.entry = latency_entries[i];
+    l.entry.function(l.result);
+
+    latencies.push_back(l);
+  }
+
+  FILE* file = stdout;
+
+  if (!output.empty())
+  {
+    file = fopen(output.c_str(), "w");
+
+    if (file == NULL)
+    {
+      fprintf(stderr, "Cannot open '%s'\n", output.c_str());
+      return 1;
+    }
+  }
+
+  if (format == "csv")
+  {
+    report_csv(file, results, latencies);
+  }
+  else if (format == "json")
+  {
+    report_json(file, results, latencies);
+  }
+  else
+  {
+    report_text(file, results, latencies);
+  }
+
+  if (file != stdout)
+  {
+    fclose(file);
+  }
+
+  return 0;
+}
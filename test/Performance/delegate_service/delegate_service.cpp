@@ -0,0 +1,123 @@
+// delegate_service.cpp : Compares the dispatch cost of etl::delegate_service
+// (run time delegate table) with etl::static_delegate_service (compile time table).
+//
+// Build with optimisation, e.g.
+//   g++ -std=c++11 -O2 -I../../../include -I../.. delegate_service.cpp
+//
+// On Cortex-M define PERF_USE_DWT to count cycles with the DWT cycle counter.
+// On x86 the time stamp counter is used. Otherwise std::chrono nanoseconds.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "etl/delegate.h"
+#include "etl/delegate_service.h"
+
+#if defined(PERF_USE_DWT)
+  #define DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+  #define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+  #define DEM_CR     (*(volatile uint32_t*)0xE000EDFC)
+
+  static void start_counter()
+  {
+    DEM_CR    |= (1UL << 24);
+    DWT_CYCCNT = 0;
+    DWT_CTRL  |= 1UL;
+  }
+
+  static uint64_t read_counter()
+  {
+    return DWT_CYCCNT;
+  }
+
+  static const char* unit = "cycles";
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+
+  static void start_counter()
+  {
+  }
+
+  static uint64_t read_counter()
+  {
+    return __rdtsc();
+  }
+
+  static const char* unit = "TSC ticks";
+#else
+  #include <chrono>
+
+  static void start_counter()
+  {
+  }
+
+  static uint64_t read_counter()
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  static const char* unit = "ns";
+#endif
+
+const size_t ITERATIONS = 1000000;
+const size_t OFFSET     = 0;
+
+// The handlers only store, so that no dependency chain runs through the loop.
+volatile size_t sink;
+
+void handler0(size_t id) { sink = id; }
+void handler1(size_t id) { sink = id; }
+void handler2(size_t id) { sink = id; }
+void handler3(size_t id) { sink = id; }
+void unhandled(size_t)   { }
+
+typedef etl::delegate_service<4, OFFSET> RuntimeService;
+typedef etl::static_delegate_service<OFFSET, unhandled, handler0, handler1, handler2, handler3> StaticService;
+
+RuntimeService runtime_service;
+
+// Stops the compiler from treating the id as a constant.
+volatile size_t runtime_id = 2;
+
+//*****************************************************************************
+template <typename TFunction>
+void report(const char* name, TFunction function)
+{
+  start_counter();
+
+  uint64_t begin = read_counter();
+
+  for (size_t i = 0; i < ITERATIONS; ++i)
+  {
+    function();
+  }
+
+  uint64_t end = read_counter();
+
+  printf("%-40s %8.2f %s/call\n", name, double(end - begin) / ITERATIONS, unit);
+}
+
+//*****************************************************************************
+// Functors, so that each call is inlined in to the timing loop.
+struct runtime_compile_time_id { void operator()() const { runtime_service.call<2>(); } };
+struct runtime_run_time_id     { void operator()() const { runtime_service.call(runtime_id); } };
+struct static_compile_time_id  { void operator()() const { StaticService::call<2>(); } };
+struct static_run_time_id      { void operator()() const { StaticService::call(runtime_id); } };
+struct static_vector           { void operator()() const { StaticService::vector<2>(); } };
+
+//*****************************************************************************
+int main()
+{
+  runtime_service.register_delegate<0>(etl::delegate<void(size_t)>::create<handler0>());
+  runtime_service.register_delegate<1>(etl::delegate<void(size_t)>::create<handler1>());
+  runtime_service.register_delegate<2>(etl::delegate<void(size_t)>::create<handler2>());
+  runtime_service.register_delegate<3>(etl::delegate<void(size_t)>::create<handler3>());
+
+  report("delegate_service::call<ID>()",        runtime_compile_time_id());
+  report("delegate_service::call(id)",          runtime_run_time_id());
+  report("static_delegate_service::call<ID>()", static_compile_time_id());
+  report("static_delegate_service::call(id)",   static_run_time_id());
+  report("static_delegate_service::vector<ID>", static_vector());
+
+  return 0;
+}
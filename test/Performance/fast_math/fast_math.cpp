@@ -0,0 +1,205 @@
+// fast_math.cpp : Compares the throughput and accuracy of the etl::fast_math
+// table based functions with the standard library, and etl::isqrt / etl::ilog2
+// with their floating point equivalents.
+//
+// Build with optimisation, e.g.
+//   g++ -std=c++14 -O2 -I../../../include -I../.. fast_math.cpp
+//
+// On Cortex-M define PERF_USE_DWT to count cycles with the DWT cycle counter.
+// On x86 the time stamp counter is used. Otherwise std::chrono nanoseconds.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "etl/fast_math.h"
+#include "etl/sqrt.h"
+#include "etl/binary.h"
+
+#if defined(PERF_USE_DWT)
+  #define DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+  #define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+  #define DEM_CR     (*(volatile uint32_t*)0xE000EDFC)
+
+  static void start_counter()
+  {
+    DEM_CR    |= (1UL << 24);
+    DWT_CYCCNT = 0;
+    DWT_CTRL  |= 1UL;
+  }
+
+  static uint64_t read_counter()
+  {
+    return DWT_CYCCNT;
+  }
+
+  static const char* unit = "cycles";
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+
+  static void start_counter()
+  {
+  }
+
+  static uint64_t read_counter()
+  {
+    return __rdtsc();
+  }
+
+  static const char* unit = "TSC ticks";
+#else
+  #include <chrono>
+
+  static void start_counter()
+  {
+  }
+
+  static uint64_t read_counter()
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  static const char* unit = "ns";
+#endif
+
+const size_t SAMPLES = 1024;
+const size_t PASSES  = 1000;
+
+float    inputs[SAMPLES];
+float    positive[SAMPLES];
+uint32_t integers[SAMPLES];
+
+// Keeps the results alive.
+volatile float    float_sink;
+volatile uint32_t integer_sink;
+
+//*****************************************************************************
+template <typename TFunction>
+void time_float(const char* name, TFunction function, const float* values)
+{
+  start_counter();
+
+  float    sum   = 0.0f;
+  uint64_t begin = read_counter();
+
+  for (size_t pass = 0; pass < PASSES; ++pass)
+  {
+    for (size_t i = 0; i < SAMPLES; ++i)
+    {
+      sum += function(values[i]);
+    }
+  }
+
+  uint64_t end = read_counter();
+
+  float_sink = sum;
+
+  printf("%-24s %8.2f %s/call\n", name, double(end - begin) / (PASSES * SAMPLES), unit);
+}
+
+//*****************************************************************************
+template <typename TFunction>
+void time_integer(const char* name, TFunction function)
+{
+  start_counter();
+
+  uint32_t sum   = 0;
+  uint64_t begin = read_counter();
+
+  for (size_t pass = 0; pass < PASSES; ++pass)
+  {
+    for (size_t i = 0; i < SAMPLES; ++i)
+    {
+      sum += function(integers[i]);
+    }
+  }
+
+  uint64_t end = read_counter();
+
+  integer_sink = sum;
+
+  printf("%-24s %8.2f %s/call\n", name, double(end - begin) / (PASSES * SAMPLES), unit);
+}
+
+//*****************************************************************************
+void accuracy(const char* name, float (*fast)(float), double (*reference)(double), float low, float high, bool relative)
+{
+  double max_error = 0.0;
+
+  for (int i = 0; i <= 1000000; ++i)
+  {
+    const float  x     = low + ((high - low) * float(i) / 1000000.0f);
+    const double exact = reference(double(x));
+    double       error = fabs(double(fast(x)) - exact);
+
+    if (relative)
+    {
+      error /= fabs(exact);
+    }
+
+    max_error = (error > max_error) ? error : max_error;
+  }
+
+  printf("%-24s %10.3g %s\n", name, max_error, relative ? "relative" : "absolute");
+}
+
+//*****************************************************************************
+// Functors, so that each call is inlined in to the timing loop.
+struct fast_sin   { float operator()(float x) const { return etl::fast_sin(x); } };
+struct std_sin    { float operator()(float x) const { return sinf(x); } };
+struct fast_cos   { float operator()(float x) const { return etl::fast_cos(x); } };
+struct std_cos    { float operator()(float x) const { return cosf(x); } };
+struct fast_atan2 { float operator()(float x) const { return etl::fast_atan2(x, 0.7f); } };
+struct std_atan2  { float operator()(float x) const { return atan2f(x, 0.7f); } };
+struct fast_exp   { float operator()(float x) const { return etl::fast_exp(x); } };
+struct std_exp    { float operator()(float x) const { return expf(x); } };
+struct fast_log2  { float operator()(float x) const { return etl::fast_log2(x); } };
+struct std_log2   { float operator()(float x) const { return log2f(x); } };
+
+struct etl_isqrt  { uint32_t operator()(uint32_t x) const { return etl::isqrt(x); } };
+struct std_isqrt  { uint32_t operator()(uint32_t x) const { return uint32_t(sqrt(double(x))); } };
+struct etl_ilog2  { uint32_t operator()(uint32_t x) const { return etl::ilog2(x); } };
+struct std_ilog2  { uint32_t operator()(uint32_t x) const { return uint32_t(log2(double(x))); } };
+
+double atan2_reference(double x) { return atan2(x, double(0.7f)); }
+float  atan2_fast(float x)       { return etl::fast_atan2(x, 0.7f); }
+
+//*****************************************************************************
+int main()
+{
+  uint32_t seed = 12345;
+
+  for (size_t i = 0; i < SAMPLES; ++i)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+
+    inputs[i]   = (float(seed >> 8) / 16777216.0f - 0.5f) * 20.0f;
+    positive[i] = (float(seed >> 8) / 16777216.0f) * 1000.0f + 0.001f;
+    integers[i] = seed | 1U;
+  }
+
+  printf("Throughput\n");
+  time_float("etl::fast_sin",   fast_sin(),   inputs);
+  time_float("sinf",            std_sin(),    inputs);
+  time_float("etl::fast_cos",   fast_cos(),   inputs);
+  time_float("cosf",            std_cos(),    inputs);
+  time_float("etl::fast_atan2", fast_atan2(), inputs);
+  time_float("atan2f",          std_atan2(),  inputs);
+  time_float("etl::fast_exp",   fast_exp(),   inputs);
+  time_float("expf",            std_exp(),    inputs);
+  time_float("etl::fast_log2",  fast_log2(),  positive);
+  time_float("log2f",           std_log2(),   positive);
+  time_integer("etl::isqrt",    etl_isqrt());
+  time_integer("(uint32_t)sqrt", std_isqrt());
+  time_integer("etl::ilog2",    etl_ilog2());
+  time_integer("(uint32_t)log2", std_ilog2());
+
+  printf("\nMaximum error\n");
+  accuracy("etl::fast_sin",   etl::fast_sin,   sin,             -10.0f,  10.0f,   false);
+  accuracy("etl::fast_cos",   etl::fast_cos,   cos,             -10.0f,  10.0f,   false);
+  accuracy("etl::fast_atan2", atan2_fast,      atan2_reference, -100.0f, 100.0f,  false);
+  accuracy("etl::fast_exp",   etl::fast_exp,   exp,             -80.0f,  80.0f,   true);
+  accuracy("etl::fast_log2",  etl::fast_log2,  log2,            0.001f,  1000.0f, false);
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_FEATURE_TEST_PROFILE_H_INCLUDED
+#define ETL_FEATURE_TEST_PROFILE_H_INCLUDED
+
+// The profile for etl_feature_tests.
+// The unit test profile, with the optional features enabled.
+
+#define ETL_FSM_TRACE
+#define ETL_MESSAGE_ROUTER_STATISTICS
+#define ETL_MESSAGE_TRACE
+#define ETL_POOL_STATISTICS
+#define ETL_MAP_ORDER_STATISTICS
+#define ETL_SET_ORDER_STATISTICS
+
+// The SIMD paths, where the target has them. etl_tests covers the scalar paths.
+#define ETL_USE_SSE2
+#define ETL_USE_NEON
+
+#include "../etl_profile.h"
+
+#endif
@@ -30,6 +30,12 @@ SOFTWARE.
 
 #include "etl/algorithm.h"
 #include "etl/container.h"
+#include "etl/array_view.h"
+#include "etl/vector.h"
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/map.h"
+#include "etl/unordered_map.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
@@ -632,6 +638,86 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(branchless_lower_bound)
+    {
+      // Duplicates, and every length up to 17.
+      int data[] = { 1, 2, 2, 2, 4, 5, 5, 7, 8, 9, 9, 9, 9, 12, 13, 15, 16 };
+
+      for (size_t length = 0U; length <= 17U; ++length)
+      {
+        for (int i = 0; i < 18; ++i)
+        {
+          int* lb1 = std::lower_bound(data, data + length, i);
+          int* lb2 = etl::branchless_lower_bound(data, data + length, i);
+          int* lb3 = etl::branchless_lower_bound(data, data + length, i, std::less<int>());
+
+          CHECK_EQUAL(lb1, lb2);
+          CHECK_EQUAL(lb1, lb3);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(branchless_upper_bound)
+    {
+      int data[] = { 1, 2, 2, 2, 4, 5, 5, 7, 8, 9, 9, 9, 9, 12, 13, 15, 16 };
+
+      for (size_t length = 0U; length <= 17U; ++length)
+      {
+        for (int i = 0; i < 18; ++i)
+        {
+          int* ub1 = std::upper_bound(data, data + length, i);
+          int* ub2 = etl::branchless_upper_bound(data, data + length, i);
+
+          CHECK_EQUAL(ub1, ub2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(eytzinger_lower_bound)
+    {
+      int sorted[40];
+      int layout[40];
+
+      for (int i = 0; i < 40; ++i)
+      {
+        sorted[i] = 2 * i;
+      }
+
+      for (size_t length = 0U; length <= 40U; ++length)
+      {
+        CHECK(etl::eytzinger_layout(sorted, sorted + length, layout) == layout + length);
+
+        // Every slot is filled with each value once.
+        CHECK(std::is_permutation(sorted, sorted + length, layout));
+
+        // Left children are smaller and right children are larger.
+        for (size_t j = 0U; j < length; ++j)
+        {
+          CHECK(((2U * j) + 1U >= length) || (layout[(2U * j) + 1U] < layout[j]));
+          CHECK(((2U * j) + 2U >= length) || (layout[(2U * j) + 2U] > layout[j]));
+        }
+
+        for (int i = -1; i < 82; ++i)
+        {
+          int* lb1 = std::lower_bound(sorted, sorted + length, i);
+          int* lb2 = etl::eytzinger_lower_bound(layout, layout + length, i);
+
+          if (lb1 == sorted + length)
+          {
+            CHECK(lb2 == layout + length);
+          }
+          else
+          {
+            CHECK(lb2 != layout + length);
+            CHECK_EQUAL(*lb1, *lb2);
+          }
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(equal_range_random_iterator)
     {
@@ -684,6 +770,19 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(fill_char_into_non_char)
+    {
+      int data1[10];
+      int data2[10];
+
+      std::fill(std::begin(data1), std::end(data1), char(0x12));
+      etl::fill(std::begin(data2), std::end(data2), char(0x12));
+
+      bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST(iter_swap)
     {
@@ -726,6 +825,37 @@ namespace
       CHECK(t1 == t2);
     }
 
+    //*************************************************************************
+    TEST(lexicographical_compare_bytes)
+    {
+      const uint8_t data1[] = { 1, 2, 3, 200, 5 };
+      const uint8_t data2[] = { 1, 2, 3, 4,   5, 6 };
+
+      for (size_t i = 0U; i <= 5U; ++i)
+      {
+        for (size_t j = 0U; j <= 6U; ++j)
+        {
+          bool t1 = std::lexicographical_compare(data1, data1 + i, data2, data2 + j);
+          bool t2 = etl::lexicographical_compare(data1, data1 + i, data2, data2 + j);
+          CHECK_EQUAL(t1, t2);
+
+          t1 = std::lexicographical_compare(data2, data2 + j, data1, data1 + i);
+          t2 = etl::lexicographical_compare(data2, data2 + j, data1, data1 + i);
+          CHECK_EQUAL(t1, t2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(equal_floating_point)
+    {
+      const double data1[] = { 1.0, 0.0 };
+      const double data2[] = { 1.0, -0.0 };
+
+      // Equal values with different representations.
+      CHECK(etl::equal(std::begin(data1), std::end(data1), std::begin(data2)));
+    }
+
     //*************************************************************************
     TEST(search)
     {
@@ -849,6 +979,24 @@ namespace
       CHECK(itr1 == itr2);
     }
 
+    //*************************************************************************
+    TEST(find_bytes)
+    {
+      const uint8_t data[] = { 1, 2, 3, 200, 5, 44 };
+
+      CHECK(etl::find(std::begin(data), std::end(data), 200) == data + 3);
+      CHECK(etl::find(std::begin(data), std::end(data), uint8_t(5)) == data + 4);
+      CHECK(etl::find(std::begin(data), std::end(data), 6) == std::end(data));
+      CHECK(etl::find(data, data, 1) == data);
+
+      // 300 is not 44, when truncated to a byte.
+      CHECK(etl::find(std::begin(data), std::end(data), 300) == std::end(data));
+
+      const char text[] = "Hello World";
+
+      CHECK(etl::find(std::begin(text), std::end(text), 'W') == text + 6);
+    }
+
     //*************************************************************************
     TEST(find_if)
     {
@@ -875,6 +1023,17 @@ namespace
       CHECK(c1 == c2);
     }
 
+    //*************************************************************************
+    TEST(count_integral)
+    {
+      const uint16_t data[] = { 1, 2, 1, 65535, 1, 3 };
+
+      CHECK_EQUAL(3, etl::count(std::begin(data), std::end(data), 1));
+      CHECK_EQUAL(1, etl::count(std::begin(data), std::end(data), 65535));
+      CHECK_EQUAL(0, etl::count(std::begin(data), std::end(data), -1));
+      CHECK_EQUAL(0, etl::count(data, data, 1));
+    }
+
     //*************************************************************************
     TEST(count_if)
     {
@@ -904,6 +1063,22 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(fill_n_char)
+    {
+      char data1[10];
+      char data2[10];
+
+      char* p1 = std::fill_n(std::begin(data1), 10, 'A');
+      char* p2 = etl::fill_n(std::begin(data2), 10, 'A');
+
+      CHECK(p2 == std::end(data2));
+      CHECK(p1 == std::end(data1));
+
+      bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST(transform1)
     {
@@ -1486,6 +1661,85 @@ namespace
       CHECK(are_equal);
     }
 
+    //*************************************************************************
+    TEST(for_each_prefetch)
+    {
+      struct Collect
+      {
+        void operator()(int i)
+        {
+          values.push_back(i);
+        }
+
+        void operator()(const std::pair<const int, int>& p)
+        {
+          values.push_back(p.first + p.second);
+        }
+
+        std::vector<int> values;
+      };
+
+      etl::list<int, 20>          list(data.begin(), data.end());
+      etl::forward_list<int, 20>  forward_list(data.begin(), data.end());
+      etl::map<int, int, 20>      map;
+      etl::unordered_map<int, int, 20, 10> unordered_map;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        map[data[i]] = data[i];
+        unordered_map[data[i]] = data[i];
+      }
+
+      std::vector<int> map_values;
+      std::vector<int> unordered_map_values;
+
+      for (etl::map<int, int, 20>::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        map_values.push_back(itr->first + itr->second);
+      }
+
+      for (etl::unordered_map<int, int, 20, 10>::const_iterator itr = unordered_map.begin(); itr != unordered_map.end(); ++itr)
+      {
+        unordered_map_values.push_back(itr->first + itr->second);
+      }
+
+      const size_t lookaheads[] = { 0U, 1U, 4U, 9U, 10U, 100U };
+
+      for (size_t i = 0U; i < (sizeof(lookaheads) / sizeof(lookaheads[0])); ++i)
+      {
+        const size_t lookahead = lookaheads[i];
+
+        CHECK(data == etl::for_each_prefetch(list, Collect(), lookahead).values);
+        CHECK(data == etl::for_each_prefetch(forward_list, Collect(), lookahead).values);
+        CHECK(data == etl::for_each_prefetch(data.begin(), data.end(), Collect(), lookahead).values);
+        CHECK(map_values == etl::for_each_prefetch(map, Collect(), lookahead).values);
+        CHECK(unordered_map_values == etl::for_each_prefetch(unordered_map, Collect(), lookahead).values);
+      }
+
+      // Default look ahead and an empty range.
+      CHECK(data == etl::for_each_prefetch(list, Collect()).values);
+      list.clear();
+      CHECK(etl::for_each_prefetch(list, Collect()).values.empty());
+
+      // Modify through the function.
+      struct Double
+      {
+        void operator()(int& i)
+        {
+          i *= 2;
+        }
+      };
+
+      etl::for_each_prefetch(forward_list, Double(), 2U);
+
+      std::vector<int> doubled(forward_list.begin(), forward_list.end());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(data[i] * 2, doubled[i]);
+      }
+    }
+
     //*************************************************************************
     TEST(transform_4_parameter)
     {
@@ -1886,6 +2140,441 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      // Sizes either side of the insertion sort threshold.
+      for (int size = 0; size < 1000; size = (size * 2) + 1)
+      {
+        std::vector<int> data(size, 0);
+        std::iota(data.begin(), data.end(), 1);
+
+        for (int i = 0; i < 20; ++i)
+        {
+          std::shuffle(data.begin(), data.end(), urng);
+
+          std::vector<int> data1 = data;
+          std::vector<int> data2 = data;
+
+          std::sort(data1.begin(), data1.end());
+          etl::intro_sort(data2.begin(), data2.end());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater_with_duplicates)
+    {
+      std::vector<int> data(1000, 0);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = int(i % 7);
+      }
+
+      std::shuffle(data.begin(), data.end(), urng);
+
+      std::vector<int> data1 = data;
+      std::vector<int> data2 = data;
+
+      std::sort(data1.begin(), data1.end(), std::greater<int>());
+      etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_adversarial_patterns)
+    {
+      std::vector<int> data(1000, 0);
+
+      // Sorted, reversed, organ pipe and all equal.
+      for (int pattern = 0; pattern < 4; ++pattern)
+      {
+        for (int i = 0; i < 1000; ++i)
+        {
+          switch (pattern)
+          {
+            case 0:  data[i] = i;                         break;
+            case 1:  data[i] = 1000 - i;                  break;
+            case 2:  data[i] = (i < 500) ? i : 1000 - i;  break;
+            default: data[i] = 42;                        break;
+          }
+        }
+
+        std::vector<int> data1 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data.begin(), data.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_is_stable)
+    {
+      std::vector<NDC> data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.push_back(NDC(int(urng() % 10U), i));
+      }
+
+      std::vector<NDC> buffer(data.size() / 2, NDC(0, 0));
+      std::vector<NDC> data1(data);
+      std::vector<NDC> data2(data);
+      std::vector<NDC> data3(data);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::merge_sort(data2.begin(), data2.end(), buffer.begin());
+      etl::stable_sort(data3.begin(), data3.end(), buffer.begin(), std::less<NDC>());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical));
+      CHECK(std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      std::vector<int> data(333, 0);
+      std::iota(data.begin(), data.end(), 1);
+      std::shuffle(data.begin(), data.end(), urng);
+
+      int buffer[333 / 2];
+
+      std::vector<int> data1 = data;
+
+      std::sort(data1.begin(), data1.end(), std::greater<int>());
+      etl::merge_sort(data.begin(), data.end(), buffer, std::greater<int>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(sort_indices_and_apply_permutation)
+    {
+      std::vector<int> data(333, 0);
+      std::iota(data.begin(), data.end(), 1);
+      std::shuffle(data.begin(), data.end(), urng);
+
+      std::vector<int> original(data);
+      std::vector<uint16_t> indices(data.size(), 0U);
+
+      std::vector<uint16_t>::iterator index_last = etl::sort_indices(data.begin(), data.end(), indices.begin(), std::greater<int>());
+      CHECK(index_last == indices.end());
+
+      // The elements have not moved.
+      CHECK(std::equal(original.begin(), original.end(), data.begin()));
+
+      for (size_t i = 1U; i < indices.size(); ++i)
+      {
+        CHECK(data[indices[i - 1U]] > data[indices[i]]);
+      }
+
+      etl::apply_permutation(data.begin(), data.end(), indices.begin());
+
+      std::sort(original.begin(), original.end(), std::greater<int>());
+      CHECK(std::equal(original.begin(), original.end(), data.begin()));
+
+      // The indices are left in order.
+      for (size_t i = 0U; i < indices.size(); ++i)
+      {
+        CHECK_EQUAL(i, indices[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_indices_is_stable)
+    {
+      std::vector<NDC> data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.push_back(NDC(int(urng() % 10U), i));
+      }
+
+      std::vector<NDC>    data1(data);
+      std::vector<size_t> indices(data.size(), 0U);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort_indices(data.begin(), data.end(), indices.begin());
+      etl::apply_permutation(data.begin(), data.end(), indices.begin());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(apply_permutation_cycles)
+    {
+      int      data[]    = { 10, 11, 12, 13, 14, 15 };
+      uint8_t  indices[] = { 2, 0, 1, 5, 4, 3 };
+      int      expected[] = { 12, 10, 11, 15, 14, 13 };
+
+      etl::apply_permutation(data, data + 6, indices);
+
+      CHECK(std::equal(expected, expected + 6, data));
+
+      etl::apply_permutation(data, data, indices);
+    }
+
+    //*************************************************************************
+    template <size_t N>
+    static bool static_sort_sorts()
+    {
+      for (int pass = 0; pass < 100; ++pass)
+      {
+        int data[N + 1];
+        int expected[N + 1];
+
+        for (size_t i = 0U; i < N; ++i)
+        {
+          data[i]     = int(urng() % 8U);
+          expected[i] = data[i];
+        }
+
+        etl::static_sort<N>(data);
+        std::sort(expected, expected + N);
+
+        if (!std::equal(expected, expected + N, data))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(static_sort_all_sizes)
+    {
+      CHECK(static_sort_sorts<0>());
+      CHECK(static_sort_sorts<1>());
+      CHECK(static_sort_sorts<2>());
+      CHECK(static_sort_sorts<3>());
+      CHECK(static_sort_sorts<4>());
+      CHECK(static_sort_sorts<5>());
+      CHECK(static_sort_sorts<6>());
+      CHECK(static_sort_sorts<7>());
+      CHECK(static_sort_sorts<8>());
+      CHECK(static_sort_sorts<9>());
+      CHECK(static_sort_sorts<10>());
+      CHECK(static_sort_sorts<11>());
+      CHECK(static_sort_sorts<12>());
+      CHECK(static_sort_sorts<13>());
+      CHECK(static_sort_sorts<14>());
+      CHECK(static_sort_sorts<15>());
+      CHECK(static_sort_sorts<16>());
+    }
+
+    //*************************************************************************
+    TEST(static_sort_non_arithmetic_greater)
+    {
+      std::vector<NDC> data;
+
+      for (int i = 0; i < 12; ++i)
+      {
+        data.push_back(NDC(int(urng() % 5U), i));
+      }
+
+      std::vector<NDC> data1(data);
+
+      std::sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::static_sort<12>(data.begin(), std::greater<NDC>());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_small_partitions)
+    {
+      for (size_t n = 0U; n < 100U; ++n)
+      {
+        std::vector<int> data(n, 0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          data[i] = int(urng() % 20U);
+        }
+
+        std::vector<int> data1(data);
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data.begin(), data.end());
+
+        CHECK(std::equal(data1.begin(), data1.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      std::vector<uint32_t> data(1000, 0);
+      std::vector<uint32_t> scratch(data.size(), 0);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint32_t(urng());
+      }
+
+      std::vector<uint32_t> data1 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data.begin(), data.end(), scratch.begin());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      std::vector<int16_t> data(1000, 0);
+      int16_t scratch[1000];
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = int16_t(urng());
+      }
+
+      data[0] = std::numeric_limits<int16_t>::min();
+      data[1] = std::numeric_limits<int16_t>::max();
+
+      std::vector<int16_t> data1 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data.begin(), data.end(), scratch);
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_key_function_is_stable)
+    {
+      struct Record
+      {
+        uint32_t timestamp;
+        int      sequence;
+      };
+
+      struct Timestamp
+      {
+        typedef uint32_t result_type;
+
+        uint32_t operator ()(const Record& record) const
+        {
+          return record.timestamp;
+        }
+      };
+
+      std::vector<Record> data(500);
+      std::vector<Record> scratch(data.size());
+
+      // Few distinct timestamps, differing only in the low byte.
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i].timestamp = 0x12345600U + (urng() % 16U);
+        data[i].sequence  = int(i);
+      }
+
+      std::vector<Record> data1 = data;
+
+      std::stable_sort(data1.begin(), data1.end(), [](const Record& lhs, const Record& rhs) { return lhs.timestamp < rhs.timestamp; });
+      etl::radix_sort(data.begin(), data.end(), scratch.begin(), Timestamp());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data.begin(),
+                                [](const Record& lhs, const Record& rhs) { return (lhs.timestamp == rhs.timestamp) && (lhs.sequence == rhs.sequence); });
+      CHECK(is_same);
+
+      // A lambda key.
+      std::shuffle(data.begin(), data.end(), urng);
+      etl::radix_sort(data.begin(), data.end(), scratch.begin(), [](const Record& record) { return record.timestamp; });
+
+      CHECK(std::is_sorted(data.begin(), data.end(), [](const Record& lhs, const Record& rhs) { return lhs.timestamp < rhs.timestamp; }));
+    }
+
+    //*************************************************************************
+    TEST(merge_k_is_stable)
+    {
+      std::vector<NDC> ranges[5];
+      std::vector<NDC> all;
+
+      // Range 3 is empty.
+      const size_t sizes[5] = { 40, 1, 73, 0, 25 };
+      int index = 0;
+
+      for (size_t r = 0U; r < 5U; ++r)
+      {
+        for (size_t i = 0U; i < sizes[r]; ++i)
+        {
+          ranges[r].push_back(NDC(int(urng() % 10U), index++));
+        }
+
+        std::stable_sort(ranges[r].begin(), ranges[r].end());
+        all.insert(all.end(), ranges[r].begin(), ranges[r].end());
+      }
+
+      std::stable_sort(all.begin(), all.end());
+
+      std::vector<NDC> output(all.size() + 1, NDC(0, 0));
+
+      std::vector<NDC>::iterator end = etl::merge_k(ranges, output.begin(), output.end());
+
+      CHECK(end == output.begin() + all.size());
+      CHECK(std::equal(all.begin(), all.end(), output.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(merge_k_array_view_to_vector)
+    {
+      const int data1[] = { 1, 4, 7, 10 };
+      const int data2[] = { 2, 5, 8 };
+      const int data3[] = { 3, 6, 9, 11, 12 };
+
+      const etl::array_view<const int> ranges[3] = { etl::array_view<const int>(data1), etl::array_view<const int>(data2), etl::array_view<const int>(data3) };
+
+      etl::vector<int, 12> output;
+
+      CHECK(etl::merge_k(ranges, output));
+      CHECK_EQUAL(12U, output.size());
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 1U), output[i]);
+      }
+
+      // Not enough room.
+      etl::vector<int, 5> small;
+
+      CHECK(!etl::merge_k(ranges, small));
+      CHECK_EQUAL(5U, small.size());
+      CHECK_EQUAL(5, small.back());
+
+      // Bounded output range.
+      int buffer[4];
+
+      CHECK(etl::merge_k(ranges, buffer, buffer + 4) == buffer + 4);
+      CHECK_EQUAL(4, buffer[3]);
+    }
+
+    //*************************************************************************
+    TEST(merge_k_greater_single_range)
+    {
+      const std::vector<int> ranges[1] = { { 9, 7, 7, 3 } };
+
+      etl::vector<int, 4> output;
+
+      CHECK(etl::merge_k(ranges, output, std::greater<int>()));
+      CHECK(std::equal(ranges[0].begin(), ranges[0].end(), output.begin()));
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
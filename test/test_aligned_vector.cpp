@@ -0,0 +1,157 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/aligned_vector.h"
+
+#include <stdint.h>
+#include <vector>
+#include <numeric>
+
+namespace
+{
+  template <typename T>
+  bool is_aligned_to(const T* p, size_t alignment)
+  {
+    return (reinterpret_cast<uintptr_t>(p) % alignment) == 0U;
+  }
+
+  SUITE(test_aligned_vector)
+  {
+    //*************************************************************************
+    TEST(test_data_alignment)
+    {
+      char offset1;
+      etl::aligned_vector<float, 10, 16> data16;
+      char offset2;
+      etl::aligned_vector<float, 10, 32> data32;
+      char offset3;
+      etl::aligned_vector<double, 10, 64> data64;
+
+      (void)offset1;
+      (void)offset2;
+      (void)offset3;
+
+      CHECK(is_aligned_to(data16.data(), 16));
+      CHECK(is_aligned_to(data32.data(), 32));
+      CHECK(is_aligned_to(data64.data(), 64));
+    }
+
+    //*************************************************************************
+    TEST(test_padded_capacity)
+    {
+      typedef etl::aligned_vector<float, 10, 32> Data;
+
+      CHECK_EQUAL(8U,  Data::BLOCK_SIZE);
+      CHECK_EQUAL(16U, Data::PADDED_SIZE);
+      CHECK_EQUAL(10U, Data().max_size());
+      CHECK(sizeof(Data) >= (16U * sizeof(float)));
+
+      typedef etl::aligned_vector<int32_t, 8, 16> Exact;
+      CHECK_EQUAL(8U, Exact::PADDED_SIZE);
+    }
+
+    //*************************************************************************
+    TEST(test_padded_size)
+    {
+      etl::aligned_vector<float, 20, 16> data;
+
+      CHECK_EQUAL(0U, data.padded_size());
+
+      data.push_back(1.0f);
+      CHECK_EQUAL(4U, data.padded_size());
+
+      data.resize(4);
+      CHECK_EQUAL(4U, data.padded_size());
+
+      data.resize(5);
+      CHECK_EQUAL(8U, data.padded_size());
+
+      data.resize(20);
+      CHECK_EQUAL(20U, data.padded_size());
+    }
+
+    //*************************************************************************
+    TEST(test_fill_padding)
+    {
+      etl::aligned_vector<int32_t, 10, 32> data;
+
+      for (int32_t i = 0; i < 10; ++i)
+      {
+        data.push_back(i + 1);
+      }
+
+      data.fill_padding(0);
+
+      // Sum whole blocks, including the padded tail.
+      int32_t sum = 0;
+      const int32_t* p = data.data();
+
+      for (size_t block = 0U; block < data.padded_size(); block += 8U)
+      {
+        for (size_t lane = 0U; lane < 8U; ++lane)
+        {
+          sum += p[block + lane];
+        }
+      }
+
+      CHECK_EQUAL(16U, data.padded_size());
+      CHECK_EQUAL(55, sum);
+      CHECK_EQUAL(10U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_vector_interface)
+    {
+      std::vector<int32_t> compare(6);
+      std::iota(compare.begin(), compare.end(), 0);
+
+      etl::aligned_vector<int32_t, 6, 64> data(compare.begin(), compare.end());
+      etl::ivector<int32_t>& idata = data;
+
+      CHECK(std::equal(compare.begin(), compare.end(), idata.begin()));
+      CHECK(data.full());
+
+      etl::aligned_vector<int32_t, 6, 64> copy(data);
+      CHECK(std::equal(compare.begin(), compare.end(), copy.begin()));
+      CHECK(is_aligned_to(copy.data(), 64));
+
+      copy.erase(copy.begin());
+      copy = data;
+      CHECK_EQUAL(6U, copy.size());
+      CHECK(copy == data);
+
+      etl::aligned_vector<int32_t, 6, 64> moved(etl::move(copy));
+      CHECK_EQUAL(6U, moved.size());
+      CHECK(copy.empty());
+    }
+  };
+}
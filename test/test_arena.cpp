@@ -0,0 +1,223 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <string>
+
+#include "etl/arena.h"
+#include "etl/vector.h"
+#include "etl/indirect_vector.h"
+
+namespace
+{
+  //***********************************
+  struct Data
+  {
+    Data()
+      : a(0),
+        b(0.0)
+    {
+    }
+
+    Data(int a_, double b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int    a;
+    double b;
+  };
+
+  bool is_aligned(const void* p, size_t alignment)
+  {
+    return (reinterpret_cast<uintptr_t>(p) % alignment) == 0U;
+  }
+
+  typedef etl::arena<256> Arena;
+
+  SUITE(test_arena)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Arena arena;
+
+      CHECK(arena.empty());
+      CHECK_EQUAL(0U, arena.size());
+      CHECK_EQUAL(256U, arena.max_size());
+      CHECK_EQUAL(256U, arena.capacity());
+      CHECK_EQUAL(256U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_aligned)
+    {
+      Arena arena;
+
+      void* p1 = arena.allocate(1U, 1U);
+      CHECK(p1 != nullptr);
+      CHECK_EQUAL(1U, arena.size());
+
+      void* p2 = arena.allocate(8U, 8U);
+      CHECK(is_aligned(p2, 8U));
+      CHECK_EQUAL(16U, arena.size());
+
+      void* p3 = arena.allocate(1U, 32U);
+      CHECK(is_aligned(p3, 32U));
+      CHECK(arena.is_in_arena(p3));
+
+      uint16_t* p4 = arena.allocate<uint16_t>(3U);
+      CHECK(is_aligned(p4, etl::alignment_of<uint16_t>::value));
+      CHECK_EQUAL(reinterpret_cast<char*>(p3) + 2, reinterpret_cast<char*>(p4));
+    }
+
+    //*************************************************************************
+    TEST(test_create)
+    {
+      Arena arena;
+
+      Data* p1 = arena.create<Data>();
+      Data* p2 = arena.create<Data>(1, 2.0);
+
+      CHECK(is_aligned(p1, etl::alignment_of<Data>::value));
+      CHECK(is_aligned(p2, etl::alignment_of<Data>::value));
+      CHECK_EQUAL(0, p1->a);
+      CHECK_EQUAL(1, p2->a);
+      CHECK_CLOSE(2.0, p2->b, 0.01);
+      CHECK_EQUAL(2U * sizeof(Data), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_space)
+    {
+      Arena arena;
+
+      CHECK(arena.allocate(250U, 1U) != nullptr);
+      CHECK_THROW(arena.allocate(7U, 1U), etl::arena_no_allocation);
+      CHECK_THROW(arena.allocate(1U, 64U), etl::arena_no_allocation);
+      CHECK_EQUAL(250U, arena.size());
+
+      CHECK(arena.allocate(6U, 1U) != nullptr);
+      CHECK_EQUAL(0U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_mark_rewind_reset)
+    {
+      Arena arena;
+
+      arena.allocate(10U, 1U);
+      etl::iarena::marker_type marker = arena.mark();
+
+      void* p1 = arena.allocate(20U, 1U);
+      arena.allocate(30U, 1U);
+      CHECK_EQUAL(60U, arena.size());
+
+      arena.rewind(marker);
+      CHECK_EQUAL(10U, arena.size());
+
+      // The same storage is handed out again.
+      CHECK(arena.allocate(20U, 1U) == p1);
+
+      CHECK_THROW(arena.rewind(100U), etl::arena_invalid_mark);
+      CHECK_EQUAL(30U, arena.size());
+
+      arena.reset();
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_scope)
+    {
+      Arena arena;
+
+      arena.allocate(10U, 1U);
+
+      {
+        etl::arena_scope scope(arena);
+        arena.allocate(100U, 1U);
+        CHECK_EQUAL(110U, arena.size());
+
+        {
+          etl::arena_scope inner(arena);
+          arena.allocate(100U, 1U);
+          CHECK_EQUAL(210U, arena.size());
+        }
+
+        CHECK_EQUAL(110U, arena.size());
+      }
+
+      CHECK_EQUAL(10U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_external_buffer_vector)
+    {
+      Arena arena;
+
+      etl::vector<int, 0> data(arena.allocate<int>(8U), 8U);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.full());
+      CHECK(arena.is_in_arena(&data[0]));
+      CHECK(arena.is_in_arena(&data[7]));
+      CHECK_EQUAL(8U * sizeof(int), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_indirect_vector)
+    {
+      etl::arena<1024> arena;
+
+      etl::vector<std::string*, 0> lookup(arena.allocate<std::string*>(4U), 4U);
+      etl::arena_pool<std::string> pool(arena, 4U);
+      CHECK_EQUAL(4U, pool.max_size());
+
+      {
+        etl::indirect_vector<std::string, 0> data(lookup, pool);
+
+        data.push_back("1");
+        data.push_back("2");
+        data.push_back("3");
+
+        CHECK_EQUAL(std::string("2"), data[1]);
+        CHECK(arena.is_in_arena(&data[0]));
+        CHECK_EQUAL(3U, pool.size());
+      }
+
+      CHECK(pool.empty());
+    }
+  };
+}
@@ -335,6 +335,19 @@ namespace
       CHECK(std::equal(swap_data.begin(), swap_data.end(), data2.begin()));
     }
 
+    //*************************************************************************
+    TEST(test_static_sort)
+    {
+      Data data1 = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+      Data data2 = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::static_sort(data1);
+      etl::static_sort(data2, std::greater<int>());
+
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), data1.begin()));
+      CHECK(std::equal(swap_data.begin(), swap_data.end(), data2.begin()));
+    }
+
     //*************************************************************************
     TEST(test_get)
     {
@@ -633,5 +646,35 @@ namespace
       CHECK(data     >= data);
       CHECK(!(lesser >= data));
     }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    static constexpr etl::array<int, 4> make_constexpr_array()
+    {
+      etl::array<int, 4> data = { 1, 2, 3, 4 };
+
+      data[0]     = 10;
+      data.back() = 40;
+      etl::get<1>(data) = 20;
+
+      return data;
+    }
+
+    TEST(test_constexpr)
+    {
+      static constexpr etl::array<int, 4> data = make_constexpr_array();
+
+      static_assert(data.size() == 4U, "size");
+      static_assert(!data.empty(), "empty");
+      static_assert(data[0] == 10, "operator[]");
+      static_assert(data.at(1) == 20, "at");
+      static_assert(data.front() == 10, "front");
+      static_assert(data.back() == 40, "back");
+      static_assert(etl::get<2>(data) == 3, "get");
+      static_assert(*(data.begin() + 2) == 3, "begin");
+
+      CHECK_EQUAL(3, data[2]);
+    }
+#endif
   };
 }
@@ -0,0 +1,270 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/atomic_pool.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  //***********************************
+  struct Item
+  {
+    Item()
+      : a(0),
+        s()
+    {
+    }
+
+    Item(int a_, const std::string& s_)
+      : a(a_),
+        s(s_)
+    {
+    }
+
+    ~Item()
+    {
+      ++destroyed;
+    }
+
+    int         a;
+    std::string s;
+
+    static int destroyed;
+  };
+
+  int Item::destroyed = 0;
+
+  typedef etl::atomic_pool<Item, 4> Pool;
+
+  SUITE(test_atomic_pool)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Pool pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.capacity());
+      CHECK_EQUAL(4U, pool.available());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK(pool.empty());
+      CHECK(!pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      Pool pool;
+
+      Item* p1 = pool.allocate<Item>();
+      Item* p2 = pool.allocate<Item>();
+      Item* p3 = pool.allocate<Item>();
+      Item* p4 = pool.allocate<Item>();
+
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p1 != p4);
+      CHECK(p2 != p3);
+      CHECK(p2 != p4);
+      CHECK(p3 != p4);
+
+      CHECK(pool.full());
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(0U, pool.available());
+      CHECK_THROW(pool.allocate<Item>(), etl::pool_no_allocation);
+
+      pool.release(p2);
+      CHECK(!pool.full());
+      CHECK_EQUAL(3U, pool.size());
+
+      // The last released item is the next allocated.
+      CHECK(pool.allocate<Item>() == p2);
+
+      pool.release(p1);
+      pool.release(p2);
+      pool.release(p3);
+      pool.release(p4);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      Pool pool;
+      Item::destroyed = 0;
+
+      Item* p1 = pool.create<Item>();
+      Item* p2 = pool.create<Item>(2, "2");
+
+      CHECK_EQUAL(0, p1->a);
+      CHECK_EQUAL(2, p2->a);
+      CHECK_EQUAL(std::string("2"), p2->s);
+
+      pool.destroy<Item>(p1);
+      pool.destroy<Item>(p2);
+
+      CHECK_EQUAL(2, Item::destroyed);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_in_pool)
+    {
+      Pool pool1;
+      Pool pool2;
+      Item item;
+
+      Item* p = pool2.allocate<Item>();
+
+      CHECK(pool2.is_in_pool(p));
+      CHECK(!pool1.is_in_pool(p));
+      CHECK(!pool1.is_in_pool(&item));
+      CHECK_THROW(pool1.release(p), etl::pool_object_not_in_pool);
+      CHECK_THROW(pool1.release(&item), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      Pool pool;
+
+      pool.allocate<Item>();
+      pool.allocate<Item>();
+      pool.allocate<Item>();
+      pool.allocate<Item>();
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(pool.allocate<Item>() != nullptr);
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release_batch)
+    {
+      Pool pool;
+      Item item;
+
+      void* items[6];
+
+      CHECK_EQUAL(3U, pool.allocate_batch(items, 3U));
+      CHECK_EQUAL(3U, pool.size());
+
+      // Only one left.
+      CHECK_EQUAL(1U, pool.allocate_batch(&items[3], 3U));
+      CHECK(pool.full());
+      CHECK_EQUAL(0U, pool.allocate_batch(items, 3U));
+
+      // All different.
+      for (int i = 0; i < 4; ++i)
+      {
+        for (int j = i + 1; j < 4; ++j)
+        {
+          CHECK(items[i] != items[j]);
+        }
+      }
+
+      // Nothing is released if one item is not from the pool.
+      items[4] = &item;
+      CHECK_THROW(pool.release_batch(&items[2], 3U), etl::pool_object_not_in_pool);
+      CHECK(pool.full());
+
+      pool.release_batch(items, 4U);
+      CHECK(pool.empty());
+
+      // All of them are linked back in to the free list.
+      CHECK_EQUAL(4U, pool.allocate_batch(items, 6U));
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::atomic_pool<int, 8> pool;
+      const int N_THREADS = 4;
+      const int N_LOOPS   = 1000000;
+
+      bool ok[N_THREADS];
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        ok[t] = true;
+
+        threads.push_back(std::thread([t, &ok]()
+        {
+          for (int i = 0; i < N_LOOPS; ++i)
+          {
+            int* p1 = pool.allocate<int>();
+            int* p2 = pool.allocate<int>();
+
+            *p1 = t;
+            *p2 = t;
+
+            std::this_thread::yield();
+
+            // No other thread should have been given the same items.
+            ok[t] = ok[t] && (p1 != p2) && (*p1 == t) && (*p2 == t);
+
+            pool.release(p2);
+            pool.release(p1);
+          }
+        }));
+      }
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        threads[t].join();
+        CHECK(ok[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+#endif
+  };
+}
+
+#endif
@@ -32,6 +32,7 @@ SOFTWARE.
 #include "etl/atomic/atomic_std.h"
 
 #include <atomic>
+#include <thread>
 
 namespace
 {
@@ -480,5 +481,54 @@ namespace
       CHECK_EQUAL(compare_expected, test_expected);
       CHECK_EQUAL(compare.load(), test.load());
     }
+
+    //=========================================================================
+    TEST(test_atomic_flag)
+    {
+      etl::atomic_flag flag;
+
+      CHECK(!flag.test());
+      CHECK(!flag.test_and_set(etl::memory_order_acquire));
+      CHECK(flag.test());
+      CHECK(flag.test_and_set());
+
+      flag.clear(etl::memory_order_release);
+      CHECK(!flag.test());
+    }
+
+    //=========================================================================
+    TEST(test_atomic_wait_returns_when_value_differs)
+    {
+      etl::atomic<int> test(1);
+
+      test.wait(0);
+      test.notify_one();
+      test.notify_all();
+
+      CHECK_EQUAL(1, test.load());
+    }
+
+    //=========================================================================
+    TEST(test_atomic_wait_notify_threads)
+    {
+      etl::atomic<int>  value(0);
+      etl::atomic_flag  flag;
+
+      std::thread t([&]()
+      {
+        value.store(1, etl::memory_order_release);
+        value.notify_one();
+        flag.test_and_set(etl::memory_order_release);
+        flag.notify_all();
+      });
+
+      value.wait(0, etl::memory_order_acquire);
+      flag.wait(false, etl::memory_order_acquire);
+
+      t.join();
+
+      CHECK_EQUAL(1, value.load());
+      CHECK(flag.test());
+    }
   };
 }
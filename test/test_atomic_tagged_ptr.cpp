@@ -0,0 +1,183 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/atomic_tagged_ptr.h"
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+
+#include <thread>
+
+namespace
+{
+  struct Node
+  {
+    // Atomic, as a losing pop may read 'next' while a push writes it.
+    etl::atomic<Node*> next;
+  };
+
+  //***************************************************************************
+  // A minimal lock free free-list.
+  //***************************************************************************
+  class FreeList
+  {
+  public:
+
+    void push(Node* node)
+    {
+      etl::tagged_ptr<Node> head = top.load();
+
+      do
+      {
+        node->next.store(head.pointer, etl::memory_order_relaxed);
+      } while (!top.compare_exchange(head, node));
+    }
+
+    Node* pop()
+    {
+      etl::tagged_ptr<Node> head = top.load();
+
+      while (head.pointer != nullptr)
+      {
+        if (top.compare_exchange(head, head.pointer->next.load(etl::memory_order_relaxed)))
+        {
+          return head.pointer;
+        }
+      }
+
+      return nullptr;
+    }
+
+  private:
+
+    etl::atomic_tagged_ptr<Node> top;
+  };
+
+  SUITE(test_atomic_tagged_ptr)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::atomic_tagged_ptr<int> test;
+
+      etl::tagged_ptr<int> value = test.load();
+
+      CHECK(value.pointer == nullptr);
+      CHECK_EQUAL(0U, value.tag);
+      CHECK(test.is_lock_free());
+    }
+
+    //*************************************************************************
+    TEST(test_store_increments_tag)
+    {
+      int i;
+      int j;
+
+      etl::atomic_tagged_ptr<int> test(&i);
+
+      test.store(&j);
+      CHECK(test.load() == etl::tagged_ptr<int>(&j, 1U));
+
+      test.store(&i);
+      CHECK(test.load() == etl::tagged_ptr<int>(&i, 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_compare_exchange_detects_aba)
+    {
+      int a;
+      int b;
+
+      etl::atomic_tagged_ptr<int> test(&a);
+
+      etl::tagged_ptr<int> stale = test.load();
+
+      // A -> B -> A
+      test.store(&b);
+      test.store(&a);
+
+      // The pointer matches, but the tag does not.
+      etl::tagged_ptr<int> expected = stale;
+      CHECK(!test.compare_exchange(expected, &b));
+      CHECK(expected.pointer == &a);
+      CHECK_EQUAL(2U, expected.tag);
+
+      CHECK(test.compare_exchange(expected, &b));
+      CHECK(test.load() == etl::tagged_ptr<int>(&b, 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_free_list_threads)
+    {
+      static const size_t Nodes      = 64U;
+      static const size_t Iterations = 10000U;
+
+      Node nodes[Nodes];
+      FreeList free_list;
+
+      for (size_t i = 0U; i < Nodes; ++i)
+      {
+        free_list.push(&nodes[i]);
+      }
+
+      auto worker = [&]()
+      {
+        for (size_t i = 0U; i < Iterations; ++i)
+        {
+          Node* node = free_list.pop();
+
+          if (node != nullptr)
+          {
+            free_list.push(node);
+          }
+        }
+      };
+
+      std::thread t1(worker);
+      std::thread t2(worker);
+      std::thread t3(worker);
+
+      t1.join();
+      t2.join();
+      t3.join();
+
+      size_t count = 0U;
+
+      while (free_list.pop() != nullptr)
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(Nodes, count);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,173 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/base64.h"
+#include "etl/cstring.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+namespace
+{
+  const char* plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+  const char* coded[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+
+  const uint8_t* bytes(const char* text)
+  {
+    return reinterpret_cast<const uint8_t*>(text);
+  }
+
+  SUITE(test_base64)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      CHECK_EQUAL(0U,  etl::base64_encoded_size(0U));
+      CHECK_EQUAL(4U,  etl::base64_encoded_size(1U));
+      CHECK_EQUAL(4U,  etl::base64_encoded_size(3U));
+      CHECK_EQUAL(8U,  etl::base64_encoded_size(4U));
+      CHECK_EQUAL(8U,  (etl::base64_encoded_length<6>::value));
+      CHECK_EQUAL(12U, etl::base64_max_decoded_size(16U));
+
+#if ETL_CPP11_SUPPORTED
+      char buffer[etl::base64_encoded_size(10U)];
+      CHECK_EQUAL(16U, sizeof(buffer));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_encode_rfc4648_vectors_to_array_view)
+    {
+      for (size_t i = 0U; i < sizeof(plain) / sizeof(plain[0]); ++i)
+      {
+        char buffer[16];
+        size_t n = etl::base64_encode(bytes(plain[i]), bytes(plain[i]) + strlen(plain[i]), etl::array_view<char>(buffer));
+
+        CHECK_EQUAL(std::string(coded[i]), std::string(buffer, n));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encode_to_string_appends)
+    {
+      etl::string<20> text("data=");
+
+      CHECK(etl::base64_encode(bytes("foobar"), bytes("foobar") + 6, text));
+      CHECK_EQUAL(std::string("data=Zm9vYmFy"), std::string(text.c_str()));
+
+      // No room, so unchanged.
+      CHECK(!etl::base64_encode(bytes("foobar"), bytes("foobar") + 6, text));
+      CHECK_EQUAL(std::string("data=Zm9vYmFy"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_output_too_small)
+    {
+      char buffer[7];
+
+      CHECK_EQUAL(0U, etl::base64_encode(bytes("foobar"), bytes("foobar") + 6, etl::array_view<char>(buffer)));
+    }
+
+    //*************************************************************************
+    TEST(test_decode_rfc4648_vectors)
+    {
+      for (size_t i = 1U; i < sizeof(coded) / sizeof(coded[0]); ++i)
+      {
+        uint8_t buffer[16];
+        size_t n = etl::base64_decode(coded[i], coded[i] + strlen(coded[i]), etl::array_view<uint8_t>(buffer));
+
+        CHECK_EQUAL(strlen(plain[i]), n);
+        CHECK_EQUAL(std::string(plain[i]), std::string(reinterpret_cast<const char*>(buffer), n));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decode_invalid)
+    {
+      const char* invalid[] = { "Zm9", "Zm9v!mFy", "Zm=v", "Z===", "Zm9vY=Fy", "Zm9vYm\xC0y" };
+
+      for (size_t i = 0U; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+      {
+        uint8_t buffer[16];
+        CHECK_EQUAL(0U, etl::base64_decode(invalid[i], invalid[i] + strlen(invalid[i]), etl::array_view<uint8_t>(buffer)));
+      }
+
+      // Output too small.
+      uint8_t buffer[5];
+      CHECK_EQUAL(0U, etl::base64_decode("Zm9vYmFy", "Zm9vYmFy" + 8, etl::array_view<uint8_t>(buffer)));
+    }
+
+    //*************************************************************************
+    TEST(test_decode_to_vector)
+    {
+      etl::vector<uint8_t, 8> data;
+      data.push_back(0xAAU);
+
+      CHECK(etl::base64_decode("Zm9vYg==", "Zm9vYg==" + 8, data));
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(0xAAU, data[0]);
+      CHECK_EQUAL('b', data[4]);
+
+      // Invalid, so unchanged.
+      CHECK(!etl::base64_decode("Zm9!", "Zm9!" + 4, data));
+      CHECK_EQUAL(5U, data.size());
+
+      // No room, so unchanged.
+      CHECK(!etl::base64_decode("Zm9vYmFy", "Zm9vYmFy" + 8, data));
+      CHECK_EQUAL(5U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_all_byte_values)
+    {
+      uint8_t data[256];
+
+      for (int i = 0; i < 256; ++i)
+      {
+        data[i] = uint8_t(255 - i);
+      }
+
+      for (size_t length = 0U; length <= 256U; length += 37U)
+      {
+        char    text[etl::base64_encoded_length<256>::value];
+        uint8_t decoded[256];
+
+        size_t n = etl::base64_encode(etl::array_view<const uint8_t>(data, length), etl::array_view<char>(text));
+        CHECK_EQUAL(etl::base64_encoded_size(length), n);
+
+        size_t m = etl::base64_decode(etl::array_view<const char>(text, n), etl::array_view<uint8_t>(decoded));
+        CHECK_EQUAL(length, m);
+        CHECK_ARRAY_EQUAL(data, decoded, length);
+      }
+    }
+  }
+}
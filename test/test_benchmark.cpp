@@ -0,0 +1,226 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#if defined(__linux__)
+  #define ETL_BENCHMARK_USE_LINUX_PERF
+#endif
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/benchmark.h"
+
+#include <stdint.h>
+
+namespace
+{
+  // A simulated counter. Every read costs 'read_cost' counts.
+  uint32_t mock_time      = 0U;
+  uint32_t mock_read_cost = 0U;
+
+  uint32_t read_mock()
+  {
+    const uint32_t value = mock_time;
+    mock_time += mock_read_cost;
+    return value;
+  }
+
+  typedef etl::cycle_counter_function<uint32_t, read_mock> MockCounter;
+
+  // A routine whose cost is set by the test.
+  uint32_t routine_cost  = 0U;
+  int      routine_calls = 0;
+
+  void routine()
+  {
+    mock_time += routine_cost;
+    ++routine_calls;
+  }
+
+  // A routine whose cost rises on each call: 1, 2, 3...
+  struct Ramp
+  {
+    Ramp(uint32_t& cost_)
+      : cost(cost_)
+    {
+    }
+
+    void operator()() const
+    {
+      ++cost;
+      mock_time += cost;
+    }
+
+    uint32_t& cost;
+  };
+
+  SUITE(test_benchmark)
+  {
+    //*************************************************************************
+    TEST(test_overhead_is_removed)
+    {
+      mock_time      = 0xFFFFFF00U; // Check that the counter wrapping is handled.
+      mock_read_cost = 7U;
+      routine_cost   = 100U;
+      routine_calls  = 0;
+
+      etl::benchmark<10, MockCounter> bench;
+
+      CHECK_EQUAL(7U, bench.overhead());
+      CHECK(bench.empty());
+
+      bench.run(routine, 5U);
+
+      CHECK_EQUAL(15, routine_calls);
+      CHECK(bench.full());
+      CHECK_EQUAL(10U, bench.size());
+      CHECK_EQUAL(100U, bench.min());
+      CHECK_EQUAL(100U, bench.max());
+      CHECK_EQUAL(100U, bench.mean());
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      mock_time      = 0U;
+      mock_read_cost = 0U;
+
+      uint32_t cost = 0U;
+
+      etl::benchmark<100, MockCounter> bench;
+
+      CHECK_EQUAL(0U, bench.median());
+
+      bench.run(Ramp(cost));
+
+      CHECK_EQUAL(1U,   bench.min());
+      CHECK_EQUAL(100U, bench.max());
+      CHECK_EQUAL(51U,  bench.median());
+      CHECK_EQUAL(90U,  bench.percentile(90U));
+      CHECK_EQUAL(99U,  bench.percentile(99U));
+      CHECK_EQUAL(100U, bench.percentile(200U));
+      CHECK_EQUAL(50U,  bench.mean());
+
+      bench.clear();
+      CHECK(bench.empty());
+      CHECK_EQUAL(0U, bench.max());
+    }
+
+    //*************************************************************************
+    TEST(test_samples_kept_in_order_until_sorted)
+    {
+      mock_time      = 0U;
+      mock_read_cost = 0U;
+
+      etl::benchmark<3, MockCounter> bench;
+
+      routine_cost = 30U;
+      bench.measure(routine);
+      routine_cost = 10U;
+      bench.measure(routine);
+      routine_cost = 20U;
+      bench.measure(routine);
+
+      // Full, so this is discarded.
+      routine_cost = 5U;
+      bench.measure(routine);
+
+      CHECK_EQUAL(30U, bench.data()[0]);
+      CHECK_EQUAL(10U, bench.data()[1]);
+      CHECK_EQUAL(20U, bench.data()[2]);
+
+      CHECK_EQUAL(10U, bench.min());
+
+      CHECK_EQUAL(10U, bench.data()[0]);
+      CHECK_EQUAL(20U, bench.data()[1]);
+      CHECK_EQUAL(30U, bench.data()[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_start_stop)
+    {
+      mock_time      = 0U;
+      mock_read_cost = 3U;
+
+      etl::benchmark<4, MockCounter> bench;
+
+      MockCounter::value_type begin = bench.start();
+      mock_time += 42U;
+      bench.stop(begin);
+
+      CHECK_EQUAL(1U, bench.size());
+      CHECK_EQUAL(42U, bench.max());
+    }
+
+#if defined(ETL_CPU_HAS_RDTSC)
+    //*************************************************************************
+    TEST(test_rdtsc)
+    {
+      etl::benchmark<64, etl::cycle_counter_rdtsc> bench;
+
+      volatile int sink = 0;
+      struct Work
+      {
+        Work(volatile int& sink_) : sink(sink_) {}
+        void operator()() const { for (int i = 0; i < 100; ++i) { sink = sink + i; } }
+        volatile int& sink;
+      };
+
+      bench.run(Work(sink), 8U);
+
+      CHECK(bench.full());
+      CHECK(bench.min() > 0U);
+      CHECK(bench.min() <= bench.median());
+      CHECK(bench.median() <= bench.max());
+    }
+#endif
+
+#if defined(ETL_BENCHMARK_USE_LINUX_PERF)
+    //*************************************************************************
+    TEST(test_linux_perf)
+    {
+      etl::benchmark<16, etl::cycle_counter_linux_perf> bench;
+
+      volatile int sink = 0;
+      struct Work
+      {
+        Work(volatile int& sink_) : sink(sink_) {}
+        void operator()() const { for (int i = 0; i < 1000; ++i) { sink = sink + i; } }
+        volatile int& sink;
+      };
+
+      bench.run(Work(sink));
+
+      // The counter may not be available to unprivileged processes.
+      CHECK(bench.full());
+      CHECK(bench.min() <= bench.max());
+    }
+#endif
+  };
+}
@@ -64,6 +64,44 @@ size_t test_parity(T value)
   return count & 1;
 }
 
+// Count trailing zeros the easy way.
+template <typename T>
+size_t test_trailing_zeros(T value)
+{
+  size_t count = 0;
+
+  for (int i = 0; i < etl::integral_limits<T>::bits; ++i)
+  {
+    if ((value & (T(1) << i)) != 0)
+    {
+      break;
+    }
+
+    ++count;
+  }
+
+  return count;
+}
+
+// Count leading zeros the easy way.
+template <typename T>
+size_t test_leading_zeros(T value)
+{
+  size_t count = 0;
+
+  for (int i = etl::integral_limits<T>::bits - 1; i >= 0; --i)
+  {
+    if ((value & (T(1) << i)) != 0)
+    {
+      break;
+    }
+
+    ++count;
+  }
+
+  return count;
+}
+
 // Power of 2.
 uint64_t test_power_of_2(int power)
 {
@@ -799,6 +837,90 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_trailing_and_leading_zeros_8)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint8_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint8_t(i)), etl::count_trailing_zeros(uint8_t(i)));
+        CHECK_EQUAL(test_trailing_zeros(uint8_t(i)), etl::count_trailing_zeros(int8_t(i)));
+        CHECK_EQUAL(test_leading_zeros(uint8_t(i)),  etl::count_leading_zeros(uint8_t(i)));
+        CHECK_EQUAL(test_leading_zeros(uint8_t(i)),  etl::count_leading_zeros(int8_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_and_leading_zeros_16)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint16_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint16_t(i)), etl::count_trailing_zeros(uint16_t(i)));
+        CHECK_EQUAL(test_trailing_zeros(uint16_t(i)), etl::count_trailing_zeros(int16_t(i)));
+        CHECK_EQUAL(test_leading_zeros(uint16_t(i)),  etl::count_leading_zeros(uint16_t(i)));
+        CHECK_EQUAL(test_leading_zeros(uint16_t(i)),  etl::count_leading_zeros(int16_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_and_leading_zeros_32)
+    {
+      CHECK_EQUAL(32U, etl::count_trailing_zeros(uint32_t(0U)));
+      CHECK_EQUAL(32U, etl::count_leading_zeros(uint32_t(0U)));
+
+      etl::fnv_1a_32 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        // Shift by a varying amount so that the long runs of zeros get tested.
+        uint32_t value = hash.value() >> (i % 32);
+        value <<= (i / 32) % 32;
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(int32_t(value)));
+        CHECK_EQUAL(test_leading_zeros(value),  etl::count_leading_zeros(value));
+        CHECK_EQUAL(test_leading_zeros(value),  etl::count_leading_zeros(int32_t(value)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_and_leading_zeros_64)
+    {
+      CHECK_EQUAL(64U, etl::count_trailing_zeros(uint64_t(0U)));
+      CHECK_EQUAL(64U, etl::count_leading_zeros(uint64_t(0U)));
+
+      etl::fnv_1a_64 hash;
+
+      for (size_t i = 0; i < 100000; ++i)
+      {
+        hash.add(1);
+
+        // Shift by a varying amount so that the long runs of zeros get tested.
+        uint64_t value = hash.value() >> (i % 64);
+        value <<= (i / 64) % 64;
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(int64_t(value)));
+        CHECK_EQUAL(test_leading_zeros(value),  etl::count_leading_zeros(value));
+        CHECK_EQUAL(test_leading_zeros(value),  etl::count_leading_zeros(int64_t(value)));
+      }
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_bit_operations_constexpr)
+    {
+      static_assert(etl::count_bits(uint32_t(0xF0F0F0F0UL)) == 16, "count_bits");
+      static_assert(etl::parity(uint64_t(0x8000000000000001ULL)) == 0, "parity");
+      static_assert(etl::count_trailing_zeros(uint16_t(0x0100U)) == 8, "count_trailing_zeros");
+      static_assert(etl::count_leading_zeros(uint64_t(0x0000000100000000ULL)) == 31, "count_leading_zeros");
+      static_assert(etl::first_set_bit_position(uint32_t(0x00100000UL)) == 20, "first_set_bit_position");
+      static_assert(etl::reverse_bits(uint32_t(0x00000001UL)) == 0x80000000UL, "reverse_bits");
+      static_assert(etl::reverse_bits(uint8_t(0x12U)) == 0x48U, "reverse_bits");
+    }
+#endif
+
     //*************************************************************************
     TEST(test_fold_bits)
     {
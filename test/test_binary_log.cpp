@@ -0,0 +1,196 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+
+#include "etl/binary_log.h"
+
+#if ETL_HAS_ATOMIC && ETL_CPP11_SUPPORTED
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  enum
+  {
+    ID_VALUES,
+    ID_TEXT,
+    ID_COUNTER
+  };
+
+  const char* formats[] =
+  {
+    "a={} b={:x} c={} d={} e={}",
+    "{}: '{:>6}' {}",
+    "{}"
+  };
+
+  SUITE(test_binary_log)
+  {
+    //*************************************************************************
+    TEST(test_write_read_format)
+    {
+      etl::binary_log<256> log;
+      uint8_t record[64];
+      etl::string<64> str;
+
+      CHECK(log.empty());
+      CHECK_EQUAL(256U, log.capacity());
+
+      CHECK(log.write(ID_VALUES, -12, 255U, 1.5, true, 'z'));
+      CHECK(log.write(ID_TEXT, "name", etl::string_view("abc"), int64_t(-9223372036854775807LL - 1)));
+      CHECK(!log.empty());
+
+      size_t length = log.read(record, sizeof(record));
+      CHECK(length != 0U);
+      CHECK_EQUAL(int(ID_VALUES), int(etl::binary_log_id(record)));
+      CHECK(etl::binary_log_format(str, formats[etl::binary_log_id(record)], record, length));
+      CHECK(str == "a=-12 b=ff c=1.5 d=true e=z");
+
+      str.clear();
+      length = log.read(record, sizeof(record));
+      CHECK(length != 0U);
+      CHECK(etl::binary_log_format(str, formats[etl::binary_log_id(record)], record, length));
+      CHECK(str == "name: '   abc' -9223372036854775808");
+
+      CHECK(log.empty());
+      CHECK_EQUAL(0U, log.read(record, sizeof(record)));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::binary_log<20> log;
+      uint8_t record[20];
+
+      // Each record is the 4 byte header plus 5 bytes for the argument.
+      CHECK(log.write(ID_COUNTER, int32_t(1)));
+      CHECK(log.write(ID_COUNTER, int32_t(2)));
+      CHECK(!log.write(ID_COUNTER, int32_t(3)));
+      CHECK_EQUAL(18U, log.size());
+      CHECK_EQUAL(2U, log.available());
+
+      // A record too large for the caller's buffer is left in the log.
+      CHECK_EQUAL(9U, log.next_size());
+      CHECK_EQUAL(0U, log.read(record, 8U));
+      CHECK_EQUAL(9U, log.read(record, sizeof(record)));
+
+      CHECK(log.write(ID_COUNTER, int32_t(3)));
+
+      log.clear();
+      CHECK(log.empty());
+      CHECK_EQUAL(0U, log.next_size());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::binary_log<30> log;
+      uint8_t record[32];
+      etl::string<32> str;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        CHECK(log.write(ID_TEXT, "abcdefg", i, uint8_t(i)));
+
+        size_t length = log.read(record, sizeof(record));
+        CHECK(length != 0U);
+
+        str.clear();
+        CHECK(etl::binary_log_format(str, formats[etl::binary_log_id(record)], record, length));
+
+        etl::string<32> expected;
+        etl::format_to(expected, "abcdefg: '{:>6}' {}", i, uint8_t(i));
+        CHECK(str == expected);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_malformed)
+    {
+      etl::binary_log<64> log;
+      uint8_t record[64];
+      etl::string<32> str;
+
+      CHECK(log.write(ID_COUNTER, 42));
+      size_t length = log.read(record, sizeof(record));
+
+      CHECK(!etl::binary_log_format(str, formats[ID_COUNTER], record, length - 1U));
+      CHECK(!etl::binary_log_format(str, formats[ID_COUNTER], record, 2U));
+
+      record[4] = 0xFF;
+      CHECK(!etl::binary_log_format(str, formats[ID_COUNTER], record, length));
+      CHECK(str.empty());
+    }
+
+    //*************************************************************************
+#if REALTIME_TEST
+    TEST(test_concurrent)
+    {
+      etl::binary_log<64> log;
+      const uint32_t count = 10000U;
+
+      std::thread producer([&log]()
+      {
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+          while (!log.write(ID_COUNTER, i))
+          {
+          }
+        }
+      });
+
+      uint8_t record[16];
+      uint32_t expected = 0U;
+      bool in_order = true;
+      while (expected < count)
+      {
+        size_t length = log.read(record, sizeof(record));
+
+        if (length != 0U)
+        {
+          uint32_t value;
+          memcpy(&value, record + 5U, sizeof(value));
+          in_order = in_order && (value == expected);
+          ++expected;
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(log.empty());
+    }
+#endif
+  };
+}
+
+#endif
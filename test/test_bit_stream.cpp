@@ -1041,5 +1041,67 @@ namespace
       CHECK_EQUAL(object1, object1a);
       CHECK_EQUAL(object2, object2a);
     }
+
+    //*************************************************************************
+    TEST(put_get_array)
+    {
+      std::array<unsigned char, 16> storage;
+      std::array<unsigned char, 16> compare;
+
+      const int16_t values[] = { -16, -1, 0, 1, 15, -7, 9, 3, -12, 6 };
+      const size_t  count    = sizeof(values) / sizeof(values[0]);
+
+      // The array is encoded the same as the individual values.
+      etl::bit_stream expected(compare.data(), compare.size());
+      CHECK(expected.put(true));
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        CHECK(expected.put(values[i], 5));
+      }
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+      CHECK(bit_stream.put(true));
+      CHECK(bit_stream.put(values, count, 5));
+
+      CHECK_EQUAL(expected.bits(), bit_stream.bits());
+      CHECK(std::equal(expected.begin(), expected.end(), bit_stream.begin()));
+
+      bit_stream.restart();
+
+      bool    flag;
+      int16_t result[count];
+
+      CHECK(bit_stream.get(flag));
+      CHECK(bit_stream.get(result, count, 5));
+      CHECK(flag);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        CHECK_EQUAL(values[i], result[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(put_get_array_no_room)
+    {
+      std::array<unsigned char, 4> storage;
+
+      const uint32_t values[] = { 0x12345678UL, 0x9ABCDEF0UL };
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      CHECK(!bit_stream.put(values, 2));
+      CHECK_EQUAL(0U, bit_stream.bits());
+
+      CHECK(bit_stream.put(values, 1, 28));
+
+      bit_stream.restart();
+
+      uint32_t result[2];
+      CHECK(!bit_stream.get(result, 2, 28));
+      CHECK(bit_stream.get(result, 1, 28));
+      CHECK_EQUAL(0x02345678UL, result[0]);
+    }
   };
 }
@@ -1012,6 +1012,46 @@ namespace
       CHECK_EQUAL(4U, data.find_next(true,  1));
     }
 
+    //*************************************************************************
+    TEST(test_find_next_big_bitset)
+    {
+      etl::bitset<4100> data;
+
+      // Sparse set bits, straddling element boundaries.
+      const size_t positions[] = { 0, 7, 8, 63, 64, 65, 1000, 4095, 4096, 4099 };
+      const size_t n_positions = sizeof(positions) / sizeof(positions[0]);
+
+      for (size_t i = 0; i < n_positions; ++i)
+      {
+        data.set(positions[i]);
+      }
+
+      CHECK_EQUAL(n_positions, data.count());
+
+      size_t position = data.find_first(true);
+
+      for (size_t i = 0; i < n_positions; ++i)
+      {
+        CHECK_EQUAL(positions[i], position);
+        position = data.find_next(true, position + 1);
+      }
+
+      CHECK_EQUAL(etl::ibitset::npos, position);
+
+      // Now look for the clear bits of the inverse.
+      data.flip();
+
+      CHECK_EQUAL(4100U - n_positions, data.count());
+      CHECK_EQUAL(63U, data.find_next(false, 9));
+      CHECK_EQUAL(1000U, data.find_next(false, 66));
+      CHECK_EQUAL(4099U, data.find_next(false, 4097));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next(false, 4100));
+
+      data.set();
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
+      CHECK_EQUAL(4100U, data.count());
+    }
+
 
     //*************************************************************************
     TEST(test_swap)
@@ -1027,5 +1067,75 @@ namespace
       CHECK(data1 == compare2);
       CHECK(data2 == compare1);
     }
+
+#if ETL_CPP14_SUPPORTED && !defined(ETL_POLYMORPHIC_BITSET) && !defined(ETL_POLYMORPHIC_CONTAINERS)
+    //*************************************************************************
+    static constexpr unsigned long long constexpr_bitset_count()
+    {
+      etl::bitset<40> data(0x0000000F00ULL);
+
+      data.set(1U);
+      data.set(39U);
+      data.reset(8U);
+
+      return (data.test(1U) && data.test(39U) && !data.test(8U)) ? data.count() : 0U;
+    }
+
+    TEST(test_constexpr)
+    {
+      static constexpr etl::bitset<40> data(0x0000000F00ULL);
+
+      static_assert(data.size() == 40U, "size");
+      static_assert(data.count() == 4U, "count");
+      static_assert(data.test(8), "test");
+      static_assert(!data[7], "operator[]");
+      static_assert(constexpr_bitset_count() == 5U, "set/reset");
+
+      CHECK_EQUAL(0x0000000F00ULL, data.value<unsigned long long>());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_bitset_ext)
+    {
+      typedef etl::bitset_ext Data;
+
+      Data::element_type buffer[4];
+      CHECK(Data::buffer_size(70U) <= sizeof(buffer));
+
+      Data data(buffer, 70U);
+
+      CHECK_EQUAL(70U, data.size());
+      CHECK_EQUAL(0U, data.count());
+
+      data.set(2U);
+      data.set(69U);
+      CHECK_EQUAL(2U, data.count());
+      CHECK(data.test(69U));
+      CHECK_EQUAL(2U,  data.find_first(true));
+      CHECK_EQUAL(69U, data.find_next(true, 3U));
+
+      data.set();
+      CHECK_EQUAL(70U, data.count());
+      CHECK(data.all());
+
+      Data::element_type buffer2[4];
+      Data data2("1011", buffer2, 70U);
+      CHECK_EQUAL(3U, data2.count());
+      CHECK(data2.test(0U));
+      CHECK(!data2.test(2U));
+
+      // Shares the ibitset interface with etl::bitset.
+      etl::bitset<70> other("1011");
+      etl::ibitset& iother = other;
+      iother = data2;
+      CHECK_EQUAL(3U, other.count());
+
+      data2 = data;
+      CHECK_EQUAL(70U, data2.count());
+
+      Data data3(0x0FULL, buffer2, 70U);
+      CHECK_EQUAL(4U, data3.count());
+    }
   };
 }
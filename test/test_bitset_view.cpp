@@ -0,0 +1,181 @@
+﻿/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <bitset>
+
+#include "etl/bitset_view.h"
+
+namespace
+{
+  typedef etl::bitset_view<uint32_t> View32;
+  typedef etl::bitset_view<uint64_t> View64;
+
+  SUITE(test_bitset_view)
+  {
+    //*************************************************************************
+    TEST(test_set_reset_test)
+    {
+      uint32_t words[3] = { 0U, 0U, 0xFFFFFF00U };
+
+      View32 view(words, 72U);
+      std::bitset<72> compare;
+
+      CHECK_EQUAL(72U, view.size());
+      CHECK_EQUAL(3U, view.words());
+
+      // The bits beyond the view are ignored.
+      CHECK_EQUAL(0U, view.count());
+      CHECK(view.none());
+
+      view.set(0U);
+      view.set(33U);
+      view.set(71U);
+      view.set(40U, false);
+      compare.set(0U);
+      compare.set(33U);
+      compare.set(71U);
+
+      for (size_t i = 0U; i < 72U; ++i)
+      {
+        CHECK_EQUAL(compare.test(i), view.test(i));
+      }
+
+      CHECK_EQUAL(compare.count(), view.count());
+      CHECK_EQUAL(0x00000001U, words[0]);
+      CHECK_EQUAL(0x00000002U, words[1]);
+      CHECK_EQUAL(0xFFFFFF80U, words[2]);
+
+      view.reset(33U);
+      CHECK(!view[33U]);
+
+      view.set();
+      CHECK(view.all());
+      CHECK_EQUAL(72U, view.count());
+      CHECK_EQUAL(0xFFFFFFFFU, words[2]);
+
+      view.reset();
+      CHECK(view.none());
+      CHECK_EQUAL(0xFFFFFF00U, words[2]);
+
+      view.flip();
+      CHECK(view.all());
+      view.flip(5U);
+      CHECK(!view.test(5U));
+      CHECK_EQUAL(71U, view.count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_next)
+    {
+      uint64_t words[2] = { 0x8000000000000010ULL, 0xFFFFFFFFFFFFF001ULL };
+
+      View64 view(words, 76U);
+
+      CHECK_EQUAL(4U,  view.find_first(true));
+      CHECK_EQUAL(63U, view.find_next(true, 5U));
+      CHECK_EQUAL(64U, view.find_next(true, 64U));
+      CHECK_EQUAL(0U,  view.find_first(false));
+      CHECK_EQUAL(65U, view.find_next(false, 63U));
+      CHECK_EQUAL(75U, view.find_next(false, 75U));
+
+      // The set bits beyond the view are not found.
+      CHECK_EQUAL(size_t(View64::npos), view.find_next(true, 65U));
+      CHECK_EQUAL(size_t(View64::npos), view.find_next(false, 76U));
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_operations)
+    {
+      uint64_t a_words[3] = { 0x00000000FFFFFFFFULL, 0x0F0F0F0F0F0F0F0FULL, 0xFFFFFFFFFFFFFF0FULL };
+      uint64_t b_words[3] = { 0xFFFF0000FFFF0000ULL, 0x00FF00FF00FF00FFULL, 0x0000000000000005ULL };
+
+      View64 a(a_words, 132U);
+      View64 b(b_words, 132U);
+
+      a.and_assign(b);
+      CHECK_EQUAL(0x00000000FFFF0000ULL, a_words[0]);
+      CHECK_EQUAL(0x000F000F000F000FULL, a_words[1]);
+      CHECK_EQUAL(0xFFFFFFFFFFFFFF05ULL, a_words[2]); // Bits beyond the view are untouched.
+
+      a.or_assign(b);
+      CHECK_EQUAL(0xFFFF0000FFFF0000ULL, a_words[0]);
+      CHECK_EQUAL(0x00FF00FF00FF00FFULL, a_words[1]);
+      CHECK_EQUAL(0xFFFFFFFFFFFFFF05ULL, a_words[2]);
+
+      a.xor_assign(b);
+      CHECK(a.none());
+      CHECK_EQUAL(0xFFFFFFFFFFFFFF00ULL, a_words[2]);
+
+      a.set();
+      a.andnot_assign(b);
+      CHECK_EQUAL(0x0000FFFF0000FFFFULL, a_words[0]);
+      CHECK_EQUAL(0xFF00FF00FF00FF00ULL, a_words[1]);
+      CHECK_EQUAL(0xFFFFFFFFFFFFFF0AULL, a_words[2]);
+      CHECK_EQUAL(132U - b.count(), a.count());
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_operations_different_sizes)
+    {
+      uint32_t a_words[3] = { 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
+      uint32_t b_words[2] = { 0x0000FFFFU, 0x00000000U };
+
+      View32 a(a_words, 96U);
+      View32 b(b_words, 40U);
+
+      // Only the first 40 bits are combined.
+      a.and_assign(b);
+      CHECK_EQUAL(0x0000FFFFU, a_words[0]);
+      CHECK_EQUAL(0xFFFFFF00U, a_words[1]);
+      CHECK_EQUAL(0xFFFFFFFFU, a_words[2]);
+
+      b.or_assign(a);
+      CHECK_EQUAL(0x0000FFFFU, b_words[0]);
+      CHECK_EQUAL(0x00000000U, b_words[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      uint32_t a_words[2] = { 0x12345678U, 0xAAAAAA01U };
+      uint32_t b_words[2] = { 0x12345678U, 0x55555501U };
+
+      View32 a(a_words, 40U);
+      View32 b(b_words, 40U);
+      View32 c(b_words, 41U);
+
+      CHECK(a == b);
+      CHECK(a != c);
+
+      b.flip(1U);
+      CHECK(a != b);
+    }
+  };
+}
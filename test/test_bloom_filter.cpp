@@ -260,6 +260,118 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_exists)
+    {
+      etl::blocked_bloom_filter<1000, 4, hash1_t> bloom;
+
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(2U, size_t(bloom.NUMBER_OF_BLOCKS));
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // No false negatives.
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      CHECK(bloom.count() <= (4U * exist_text.size()));
+      CHECK(bloom.count() > 0U);
+
+      bloom.clear();
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(exist_text[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_two_hashes)
+    {
+      etl::blocked_bloom_filter<4096, 3, hash1_t, hash2_t> bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      // With a sparse filter the unknown keys should be rejected.
+      size_t false_positives = 0;
+
+      for (size_t i = 0; i < not_exist_text.size(); ++i)
+      {
+        false_positives += bloom.exists(not_exist_text[i]) ? 1 : 0;
+      }
+
+      CHECK(false_positives < not_exist_text.size());
+    }
+
+    //*************************************************************************
+    TEST(test_counting_add_remove)
+    {
+      etl::counting_bloom_filter<256, 4, hash1_t> bloom;
+
+      CHECK_EQUAL(256U, bloom.width());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      // Removing half of the keys leaves the rest.
+      for (size_t i = 0; i < exist_text.size(); i += 2)
+      {
+        CHECK(bloom.remove(exist_text[i]));
+      }
+
+      for (size_t i = 1; i < exist_text.size(); i += 2)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      for (size_t i = 1; i < exist_text.size(); i += 2)
+      {
+        CHECK(bloom.remove(exist_text[i]));
+      }
+
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK(!bloom.remove(exist_text[0]));
+    }
+
+    //*************************************************************************
+    TEST(test_counting_saturation)
+    {
+      etl::counting_bloom_filter<64, 2, hash1_t> bloom;
+
+      for (size_t i = 0; i < 300; ++i)
+      {
+        bloom.add(exist_text[0]);
+      }
+
+      // Saturated counters are never decremented.
+      for (size_t i = 0; i < 300; ++i)
+      {
+        bloom.remove(exist_text[0]);
+      }
+
+      CHECK(bloom.exists(exist_text[0]));
+    }
   };
 }
-
@@ -0,0 +1,212 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <string>
+
+#include "etl/broadcast_ring.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  SUITE(test_broadcast_ring)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::broadcast_ring<int, 4, 3> ring;
+
+      CHECK_EQUAL(4U, ring.capacity());
+      CHECK_EQUAL(4U, ring.max_size());
+      CHECK_EQUAL(3U, ring.consumers());
+      CHECK(!ring.full());
+      CHECK(ring.empty(0));
+      CHECK(ring.empty(1));
+      CHECK(ring.empty(2));
+    }
+
+    //*************************************************************************
+    TEST(test_every_consumer_sees_every_value)
+    {
+      etl::broadcast_ring<std::string, 4, 2> ring;
+
+      CHECK(ring.push("one"));
+      CHECK(ring.push("two"));
+      CHECK_EQUAL(2U, ring.size(0));
+      CHECK_EQUAL(2U, ring.size(1));
+
+      std::string value;
+
+      CHECK(ring.pop(0, value));
+      CHECK(value == "one");
+      CHECK(ring.pop(0, value));
+      CHECK(value == "two");
+      CHECK(!ring.pop(0, value));
+      CHECK(ring.empty(0));
+
+      // Consumer 1 reads in place.
+      const std::string* p_value = ring.front(1);
+      CHECK(p_value != nullptr);
+      CHECK(*p_value == "one");
+      CHECK(ring.pop(1));
+      CHECK(*ring.front(1) == "two");
+      CHECK(ring.pop(1));
+      CHECK(ring.front(1) == nullptr);
+      CHECK(!ring.pop(1));
+    }
+
+    //*************************************************************************
+    TEST(test_producer_gated_by_slowest_consumer)
+    {
+      etl::broadcast_ring<int, 4, 2> ring;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(ring.push(i));
+      }
+
+      CHECK(ring.full());
+      CHECK(!ring.push(4));
+
+      // Only the fast consumer reads, so the ring stays full.
+      int value;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(ring.pop(0, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(!ring.push(4));
+
+      // The slow consumer frees one slot.
+      CHECK(ring.pop(1, value));
+      CHECK_EQUAL(0, value);
+      CHECK(!ring.full());
+      CHECK(ring.push(4));
+      CHECK(!ring.push(5));
+
+      CHECK(ring.pop(0, value));
+      CHECK_EQUAL(4, value);
+
+      for (int i = 1; i < 5; ++i)
+      {
+        CHECK(ring.pop(1, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(ring.empty(0));
+      CHECK(ring.empty(1));
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::broadcast_ring<int, 4, 3> ring;
+
+      int next = 0;
+      int value;
+
+      for (int lap = 0; lap < 100; ++lap)
+      {
+        CHECK(ring.push(next));
+        CHECK(ring.push(next + 1));
+        CHECK(ring.push(next + 2));
+
+        for (size_t consumer = 0U; consumer < ring.consumers(); ++consumer)
+        {
+          for (int i = 0; i < 3; ++i)
+          {
+            CHECK(ring.pop(consumer, value));
+            CHECK_EQUAL(next + i, value);
+          }
+        }
+
+        next += 3;
+      }
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::broadcast_ring<int, 16, 3> ring;
+      static const int count = 100000;
+      static bool in_order[3];
+
+      std::thread producer([]()
+      {
+        for (int i = 0; i < count;)
+        {
+          if (ring.push(i))
+          {
+            ++i;
+          }
+        }
+      });
+
+      std::thread consumers[3];
+
+      for (size_t c = 0U; c < 3U; ++c)
+      {
+        consumers[c] = std::thread([c]()
+        {
+          in_order[c] = true;
+
+          for (int expected = 0; expected < count;)
+          {
+            int value;
+
+            if (ring.pop(c, value))
+            {
+              in_order[c] = in_order[c] && (value == expected);
+              ++expected;
+            }
+          }
+        });
+      }
+
+      producer.join();
+
+      for (size_t c = 0U; c < 3U; ++c)
+      {
+        consumers[c].join();
+        CHECK(in_order[c]);
+      }
+    }
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,360 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/btree_map.h"
+
+namespace
+{
+  static const size_t SIZE = 100;
+
+  // Small nodes, so that the tests exercise splits, borrows and merges.
+  typedef etl::btree_map<int, std::string, SIZE, 4>  Data;
+  typedef etl::ibtree_map<int, std::string, 4>       IData;
+  typedef etl::btree_map<int, int, 1000, 3>          DataInt3;
+  typedef etl::btree_map<int, int, 1000>             DataInt16;
+  typedef std::map<int, std::string>                 Compare_Data;
+  typedef std::map<int, int>                         Compare_DataInt;
+  typedef ETL_OR_STD::pair<int, std::string>         Element;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  // A repeatable pseudo random sequence.
+  struct Random
+  {
+    Random()
+      : state(12345U)
+    {
+    }
+
+    int operator()(int range)
+    {
+      state = (state * 1103515245U) + 12345U;
+      return int((state >> 8) % unsigned(range));
+    }
+
+    unsigned state;
+  };
+
+  //*************************************************************************
+  template <typename TData>
+  void Test_Random_Operations(TData& data, int key_range)
+  {
+    Compare_DataInt compare_data;
+    Random random;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      int key = random(key_range);
+
+      if ((random(3) != 0) && !data.full())
+      {
+        bool inserted = data.insert(std::make_pair(key, i)).second;
+        bool compare_inserted = compare_data.insert(std::make_pair(key, i)).second;
+        CHECK_EQUAL(compare_inserted, inserted);
+      }
+      else
+      {
+        CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+    }
+
+    CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    CHECK(Check_Equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+
+    for (int key = -1; key <= key_range; ++key)
+    {
+      CHECK_EQUAL(compare_data.count(key), data.count(key));
+
+      typename TData::iterator i_lower = data.lower_bound(key);
+      Compare_DataInt::iterator i_compare_lower = compare_data.lower_bound(key);
+      CHECK_EQUAL(std::distance(compare_data.begin(), i_compare_lower), std::distance(data.begin(), i_lower));
+
+      typename TData::iterator i_upper = data.upper_bound(key);
+      Compare_DataInt::iterator i_compare_upper = compare_data.upper_bound(key);
+      CHECK_EQUAL(std::distance(compare_data.begin(), i_compare_upper), std::distance(data.begin(), i_upper));
+    }
+
+    while (!compare_data.empty())
+    {
+      int key = compare_data.begin()->first;
+      CHECK_EQUAL(1U, data.erase(key));
+      compare_data.erase(key);
+    }
+
+    CHECK(data.empty());
+    CHECK(data.begin() == data.end());
+  }
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_iterate)
+    {
+      Data data;
+      Compare_Data compare_data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        int key = (i * 37) % int(SIZE);
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Element(key, std::to_string(key)));
+        compare_data.insert(Element(key, std::to_string(key)));
+
+        CHECK(result.second);
+        CHECK_EQUAL(key, result.first->first);
+        CHECK_EQUAL(std::to_string(key), result.first->second);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(Check_Equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_existing)
+    {
+      Data data;
+
+      data.insert(Element(1, "one"));
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Element(1, "uno"));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("one"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(Element(i, std::to_string(i)));
+      }
+
+      CHECK(!data.insert(Element(0, "zero")).second);
+      CHECK_THROW(data.insert(Element(int(SIZE), "excess")), etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data[3] = "three";
+      data[1] = "one";
+      data[3] = "THREE";
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("THREE"), data.at(3));
+      CHECK_EQUAL(std::string("one"), cdata.at(1));
+      CHECK_THROW(data.at(2), etl::btree_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Data data;
+
+      for (int i = 0; i < 40; i += 2)
+      {
+        data.insert(Element(i, std::to_string(i)));
+      }
+
+      CHECK(data.find(5) == data.end());
+      CHECK_EQUAL(6, data.find(6)->first);
+      CHECK_EQUAL(6, data.lower_bound(5)->first);
+      CHECK_EQUAL(6, data.lower_bound(6)->first);
+      CHECK_EQUAL(8, data.upper_bound(6)->first);
+      CHECK(data.lower_bound(39) == data.end());
+      CHECK(data.upper_bound(38) == data.end());
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = static_cast<const Data&>(data).equal_range(10);
+      CHECK_EQUAL(10, range.first->first);
+      CHECK_EQUAL(12, range.second->first);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+      Compare_Data compare_data;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        data.insert(Element(i, std::to_string(i)));
+        compare_data.insert(Element(i, std::to_string(i)));
+      }
+
+      // Erase every other element, walking with the returned iterators.
+      Data::iterator i_data = data.begin();
+      Compare_Data::iterator i_compare = compare_data.begin();
+
+      while (i_data != data.end())
+      {
+        i_data = data.erase(i_data);
+        i_compare = compare_data.erase(i_compare);
+
+        if (i_data != data.end())
+        {
+          CHECK_EQUAL(i_compare->first, i_data->first);
+          ++i_data;
+          ++i_compare;
+        }
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data;
+      Compare_Data compare_data;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        data.insert(Element(i, std::to_string(i)));
+        compare_data.insert(Element(i, std::to_string(i)));
+      }
+
+      Data::iterator i_data = data.erase(data.find(10), data.find(40));
+      Compare_Data::iterator i_compare = compare_data.erase(compare_data.find(10), compare_data.find(40));
+
+      CHECK_EQUAL(i_compare->first, i_data->first);
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      Data data;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        data.insert(Element(i, std::to_string(i)));
+      }
+
+      Data data2(data);
+      CHECK(data2 == data);
+
+      data2[5] = "five";
+      CHECK(data2 != data);
+
+      Data data3;
+      data3[1] = "one";
+      IData& idata3 = data3;
+      idata3 = data;
+      CHECK(data3 == data);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_refill)
+    {
+      Data data;
+
+      for (int pass = 0; pass < 3; ++pass)
+      {
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          data.insert(Element(int(SIZE) - i, std::to_string(i)));
+        }
+
+        CHECK(data.full());
+        data.clear();
+        CHECK(data.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_node_keys_3)
+    {
+      DataInt3 data;
+      Test_Random_Operations(data, 1500);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_node_keys_16)
+    {
+      DataInt16 data;
+      Test_Random_Operations(data, 1500);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_full)
+    {
+      // Keys densely packed so that the map repeatedly fills.
+      DataInt3 data;
+      Test_Random_Operations(data, 1100);
+    }
+  };
+}
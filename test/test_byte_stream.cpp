@@ -0,0 +1,169 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/byte_stream.h"
+
+#include <array>
+#include <string.h>
+
+namespace
+{
+  SUITE(test_byte_stream)
+  {
+    //*************************************************************************
+    TEST(test_write_big_endian)
+    {
+      std::array<uint8_t, 16> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(writer.write(uint8_t(0x01U)));
+      CHECK(writer.write(uint16_t(0x0203U)));
+      CHECK(writer.write(int32_t(0x04050607L)));
+      CHECK(writer.write(uint64_t(0x08090A0B0C0D0E0FULL)));
+
+      CHECK_EQUAL(15U, writer.size_bytes());
+      CHECK_EQUAL(1U,  writer.available());
+
+      for (uint8_t i = 0U; i < 15U; ++i)
+      {
+        CHECK_EQUAL(int(i + 1), int(storage[i]));
+      }
+
+      // Not enough room.
+      CHECK(!writer.write(uint16_t(0xFFFFU)));
+      CHECK_EQUAL(15U, writer.size_bytes());
+
+      CHECK(writer.write(uint8_t(0x10U)));
+      CHECK(writer.full());
+    }
+
+    //*************************************************************************
+    TEST(test_write_little_endian)
+    {
+      std::array<uint8_t, 6> storage;
+
+      etl::byte_stream_writer writer(etl::array_view<uint8_t>(storage), etl::endian::little);
+
+      CHECK(writer.write(uint16_t(0x0201U)));
+      CHECK(writer.write(uint32_t(0x06050403UL)));
+
+      for (uint8_t i = 0U; i < 6U; ++i)
+      {
+        CHECK_EQUAL(int(i + 1), int(storage[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_round_trip)
+    {
+      std::array<char, 64> storage;
+
+      const int16_t array[] = { -1, 2, -3, 4 };
+
+      etl::byte_stream_writer writer(storage.data(), storage.size());
+
+      CHECK(writer.write(int8_t(-5)));
+      CHECK(writer.write(3.25f));
+      CHECK(writer.write(-1.5));
+      CHECK(writer.write(array, 4U));
+      CHECK(writer.write(uint8_t(5U)));
+      CHECK(writer.write(etl::string_view("Hello")));
+
+      etl::byte_stream_reader reader(storage.data(), writer.size_bytes());
+
+      int8_t  c;
+      float   f;
+      double  d;
+      int16_t a[4];
+      uint8_t n;
+
+      CHECK(reader.read(c));
+      CHECK(reader.read(f));
+      CHECK(reader.read(d));
+      CHECK(reader.read(a, 4U));
+      CHECK(reader.read(n));
+
+      CHECK_EQUAL(-5, int(c));
+      CHECK_EQUAL(3.25f, f);
+      CHECK_EQUAL(-1.5, d);
+      CHECK_EQUAL(-1, a[0]);
+      CHECK_EQUAL(2,  a[1]);
+      CHECK_EQUAL(-3, a[2]);
+      CHECK_EQUAL(4,  a[3]);
+
+      // The string is a view into the buffer.
+      etl::string_view text;
+      CHECK(reader.read_view(text, n));
+      CHECK(text == etl::string_view("Hello"));
+      CHECK(text.data() == storage.data() + reader.size_bytes() - 5U);
+
+      CHECK(reader.empty());
+      CHECK(!reader.read(c));
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_and_read_view)
+    {
+      std::array<uint8_t, 8> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size());
+
+      CHECK(writer.write(uint16_t(3U)));
+
+      etl::array_view<uint8_t> blob = writer.reserve(3U);
+      CHECK_EQUAL(3U, blob.size());
+      blob[0] = 0xAAU;
+      blob[1] = 0xBBU;
+      blob[2] = 0xCCU;
+
+      CHECK(writer.reserve(4U).empty());
+      CHECK_EQUAL(5U, writer.size_bytes());
+
+      etl::byte_stream_reader reader(writer.used_data().data(), writer.used_data().size());
+
+      uint16_t length;
+      etl::array_view<const uint8_t> view;
+
+      CHECK(reader.read(length));
+      CHECK(!reader.read_view(view, length + 1U));
+      CHECK(reader.read_view(view, length));
+
+      CHECK_EQUAL(3U, view.size());
+      CHECK(view.data() == storage.data() + 2U);
+      CHECK_EQUAL(0xBBU, view[1]);
+
+      reader.restart();
+      CHECK(reader.skip(2U));
+      CHECK_EQUAL(3U, reader.free_data().size());
+      CHECK(!reader.skip(4U));
+    }
+  };
+}
@@ -677,6 +677,131 @@ namespace
         CHECK(test_obj.called == 1);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_tick_from_isr_deferred_process)
+    {
+      etl::callback_timer<1> timer_controller;
+
+      etl::timer::id::type id = timer_controller.register_timer(free_callback2, 5, etl::timer::mode::REPEATING);
+      timer_controller.start(id);
+
+      free_tick_list2.clear();
+      ticks = 0;
+
+      // Disabled, so the ticks are kept.
+      timer_controller.tick_from_isr(3);
+      CHECK(!timer_controller.process());
+      CHECK_EQUAL(0U, free_tick_list2.size());
+
+      timer_controller.enable(true);
+
+      // Recording ticks does not call the callbacks.
+      timer_controller.tick_from_isr(4);
+      timer_controller.tick_from_isr(4);
+      CHECK_EQUAL(0U, free_tick_list2.size());
+
+      // 11 ticks have elapsed, so the timer has expired twice.
+      CHECK(timer_controller.process());
+      CHECK_EQUAL(2U, free_tick_list2.size());
+
+      // Nothing pending.
+      CHECK(timer_controller.process());
+      CHECK_EQUAL(2U, free_tick_list2.size());
+
+      timer_controller.tick_from_isr(4);
+      CHECK(timer_controller.process());
+      CHECK_EQUAL(3U, free_tick_list2.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_time)
+    {
+      etl::callback_timer<1> timer_controller;
+
+      CHECK_EQUAL(0U, timer_controller.time());
+
+      // Not counted while disabled.
+      CHECK(!timer_controller.tick(5));
+      CHECK_EQUAL(0U, timer_controller.time());
+
+      timer_controller.enable(true);
+
+      // Counted with or without active timers.
+      CHECK(timer_controller.tick(5));
+      CHECK_EQUAL(5U, timer_controller.time());
+
+      etl::timer::id::type id = timer_controller.register_timer(free_callback2, 3, etl::timer::mode::REPEATING);
+      timer_controller.start(id);
+
+      CHECK(timer_controller.tick(7));
+      CHECK_EQUAL(12U, timer_controller.time());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_slack_coalesces_expiries)
+    {
+      etl::callback_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(free_function_callback, 10, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_callback2,          8, etl::timer::mode::REPEATING);
+
+      CHECK(timer_controller.set_slack(id2, 3));
+      CHECK(!timer_controller.set_slack(etl::timer::id::NO_TIMER, 3));
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      // id2 expires with id1, within its slack.
+      CHECK_EQUAL(10U, timer_controller.time_to_next());
+
+      ticks = 0;
+
+      while (ticks < 30U)
+      {
+        ++ticks;
+        timer_controller.tick(1);
+      }
+
+      std::vector<uint64_t> compare1 = { 10, 20, 30 };
+      std::vector<uint64_t> compare2 = { 10, 20, 30 };
+
+      CHECK(compare1 == free_tick_list1);
+      CHECK(compare2 == free_tick_list2);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_slack_time_to_next)
+    {
+      etl::callback_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(free_function_callback, 20, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_callback2,          5, etl::timer::mode::SINGLE_SHOT);
+
+      timer_controller.set_slack(id2, 10);
+      timer_controller.enable(true);
+
+      // Without slack, the next expiry.
+      timer_controller.start(id1);
+      CHECK_EQUAL(20U, timer_controller.time_to_next());
+
+      // Expiry 5 with slack 10, so the timers need not be processed until 15.
+      timer_controller.start(id2);
+      CHECK_EQUAL(15U, timer_controller.time_to_next());
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      // One wake-up processes id2, late but within its slack.
+      timer_controller.tick(15);
+      CHECK_EQUAL(1U, free_tick_list2.size());
+      CHECK_EQUAL(0U, free_tick_list1.size());
+      CHECK_EQUAL(5U, timer_controller.time_to_next());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
@@ -0,0 +1,283 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "etl/circular_buffer.h"
+
+#include "data.h"
+
+namespace
+{
+  typedef TestDataNDC<std::string> ItemNDC;
+
+  const size_t SIZE = 5;
+
+  typedef etl::circular_buffer<int, SIZE>    Data;
+  typedef etl::icircular_buffer<int>         IData;
+  typedef etl::circular_buffer<ItemNDC, SIZE> DataNDC;
+  typedef etl::circular_buffer<int, 0>       DataExt;
+
+  std::vector<int> to_vector(const IData& data)
+  {
+    return std::vector<int>(data.begin(), data.end());
+  }
+
+  SUITE(test_circular_buffer)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(0U, data.array_one().size());
+      CHECK_EQUAL(0U, data.array_two().size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_front_back)
+    {
+      Data data;
+
+      data.push(1);
+      CHECK_EQUAL(1, data.front());
+      CHECK_EQUAL(1, data.back());
+
+      data.push(2);
+      data.push(3);
+      CHECK_EQUAL(1, data.front());
+      CHECK_EQUAL(3, data.back());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_overwrites_oldest)
+    {
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(3, data.front());
+      CHECK_EQUAL(7, data.back());
+
+      std::vector<int> expected = { 3, 4, 5, 6, 7 };
+      CHECK(expected == to_vector(data));
+    }
+
+    //*************************************************************************
+    TEST(test_random_access)
+    {
+      Data data;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.push(i);
+      }
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 2), data[i]);
+      }
+
+      data[1] = 99;
+      CHECK_EQUAL(99, *(data.begin() + 1));
+      CHECK_EQUAL(int(SIZE), std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(6, *data.rbegin());
+      CHECK_EQUAL(6, data.begin()[4]);
+      CHECK(data.begin() < data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_pop)
+    {
+      Data data;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.push(i);
+      }
+
+      data.pop();
+      CHECK_EQUAL(3, data.front());
+      CHECK_EQUAL(4U, data.size());
+
+      data.pop(2);
+      CHECK_EQUAL(5, data.front());
+      CHECK_EQUAL(6, data.back());
+      CHECK_EQUAL(2U, data.size());
+
+      data.pop(2);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_empty)
+    {
+      Data data;
+
+      CHECK_THROW(data.pop(), etl::circular_buffer_empty);
+
+      data.push(1);
+      CHECK_THROW(data.pop(2), etl::circular_buffer_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_array_one_array_two)
+    {
+      Data data;
+
+      data.push(0);
+      data.push(1);
+      data.push(2);
+
+      CHECK_EQUAL(3U, data.array_one().size());
+      CHECK_EQUAL(0U, data.array_two().size());
+
+      // Wrap around the end of the buffer memory.
+      data.pop(2);
+      data.push(3);
+      data.push(4);
+      data.push(5);
+      data.push(6);
+
+      etl::array_view<int> one = data.array_one();
+      etl::array_view<int> two = data.array_two();
+
+      CHECK_EQUAL(3U, one.size());
+      CHECK_EQUAL(2U, two.size());
+
+      std::vector<int> joined(one.begin(), one.end());
+      joined.insert(joined.end(), two.begin(), two.end());
+
+      CHECK(to_vector(data) == joined);
+
+      const Data& cdata = data;
+      CHECK_EQUAL(2, cdata.array_one()[0]);
+      CHECK_EQUAL(6, cdata.array_two()[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_push_range)
+    {
+      std::vector<int> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      Data data(input.begin(), input.begin() + 3);
+      CHECK_EQUAL(3U, data.size());
+
+      data.push(input.begin() + 3, input.end());
+
+      std::vector<int> expected = { 5, 6, 7, 8, 9 };
+      CHECK(expected == to_vector(data));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_assign)
+    {
+      Data data;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.push(i);
+      }
+
+      Data copy(data);
+      CHECK(to_vector(data) == to_vector(copy));
+
+      Data other;
+      other.push(42);
+      other = data;
+      CHECK(to_vector(data) == to_vector(other));
+
+      IData& idata = other;
+      idata.clear();
+      CHECK(idata.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_non_default_constructible)
+    {
+      DataNDC data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push(ItemNDC(std::to_string(i)));
+      }
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(data.front() == ItemNDC("3"));
+      CHECK(data.back() == ItemNDC("7"));
+
+      data.pop();
+      CHECK(data.front() == ItemNDC("4"));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_external_buffer)
+    {
+      etl::aligned_storage<sizeof(int) * 4, etl::alignment_of<int>::value>::type buffer;
+
+      DataExt data(&buffer, 4);
+
+      CHECK_EQUAL(4U, data.capacity());
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data.push(i);
+      }
+
+      std::vector<int> expected = { 2, 3, 4, 5 };
+      CHECK(expected == to_vector(data));
+
+      CHECK_EQUAL(2U, data.array_one().size());
+      CHECK_EQUAL(2U, data.array_two().size());
+      CHECK_EQUAL(4, data.array_two()[0]);
+    }
+  };
+}
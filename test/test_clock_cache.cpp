@@ -0,0 +1,167 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/clock_cache.h"
+#include "etl/delegate.h"
+
+#include <map>
+
+namespace
+{
+  //***************************************************************************
+  struct Store
+  {
+    Store()
+      : writes(0)
+    {
+    }
+
+    bool read(const int& key, int& value)
+    {
+      std::map<int, int>::const_iterator itr = data.find(key);
+
+      if (itr == data.end())
+      {
+        return false;
+      }
+
+      value = itr->second;
+      return true;
+    }
+
+    void write(const int& key, const int& value)
+    {
+      ++writes;
+      data[key] = value;
+    }
+
+    std::map<int, int> data;
+    int writes;
+  };
+
+  typedef etl::clock_cache<int, int, 4> Cache;
+  typedef etl::icache<int, int>         ICache;
+
+  SUITE(test_clock_cache)
+  {
+    //*************************************************************************
+    TEST(test_write_then_read)
+    {
+      Cache cache;
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(4U, cache.capacity());
+
+      cache.write(1, 10);
+      cache.write(2, 20);
+
+      CHECK_EQUAL(2U, cache.size());
+      CHECK_EQUAL(10, *cache.read(1));
+      CHECK_EQUAL(20, *cache.read(2));
+      CHECK(cache.read(3) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_referenced_entries_get_a_second_chance)
+    {
+      Cache cache;
+
+      cache.write(1, 10);
+      cache.write(2, 20);
+      cache.write(3, 30);
+      cache.write(4, 40);
+
+      cache.read(1);
+      cache.read(3);
+
+      cache.write(5, 50); // 2 is the first unreferenced entry.
+
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(4));
+      CHECK(cache.contains(5));
+      CHECK_EQUAL(1U, cache.get_statistics().evictions);
+    }
+
+    //*************************************************************************
+    TEST(test_scan_does_not_flush_hot_entries)
+    {
+      Cache cache;
+
+      cache.write(1, 10);
+      cache.write(2, 20);
+
+      // A scan of keys that are never read again.
+      for (int i = 100; i < 120; ++i)
+      {
+        cache.read(1);
+        cache.read(2);
+        cache.write(i, i);
+      }
+
+      CHECK(cache.contains(1));
+      CHECK(cache.contains(2));
+      CHECK_EQUAL(4U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_and_load)
+    {
+      Store store;
+      store.data[7] = 70;
+
+      {
+        Cache cache;
+        cache.set_read_function(ICache::read_delegate_t::create<Store, &Store::read>(store));
+        cache.set_write_function(ICache::write_delegate_t::create<Store, &Store::write>(store));
+        cache.set_write_through(false);
+
+        CHECK_EQUAL(70, *cache.read(7));
+        CHECK_EQUAL(1U, cache.get_statistics().loads);
+
+        for (int i = 0; i < 4; ++i)
+        {
+          cache.write(i, i * 10);
+        }
+
+        CHECK_EQUAL(0, store.writes); // 7 was clean when evicted.
+        CHECK_EQUAL(4U, cache.dirty_size());
+
+        CHECK(cache.erase(0));
+        CHECK_EQUAL(1, store.writes);
+      }
+
+      CHECK_EQUAL(4, store.writes);
+      CHECK_EQUAL(30, store.data[3]);
+    }
+  };
+}
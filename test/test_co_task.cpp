@@ -0,0 +1,418 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/co_task.h"
+
+#if defined(ETL_HAS_COROUTINES)
+
+#include "etl/queue_spsc_atomic.h"
+#include "etl/callback_timer.h"
+#include "etl/message_inbox.h"
+#include "etl/message_router.h"
+#include "etl/scheduler.h"
+#include "etl/function.h"
+#include "etl/vector.h"
+
+namespace
+{
+  typedef etl::generic_pool<512, etl::ico_frame_allocator::FRAME_ALIGNMENT, 8> frame_pool_t;
+
+  //***************************************************************************
+  etl::co_task count_up(etl::ico_frame_allocator&, etl::vector<int, 32>& log, int id, int steps)
+  {
+    for (int i = 0; i < steps; ++i)
+    {
+      log.push_back((id * 10) + i);
+      co_await etl::co_suspend();
+    }
+  }
+
+  //***************************************************************************
+  etl::co_task consume(etl::ico_frame_allocator&, etl::queue_spsc_atomic<int, 4>& queue, int& sum, int count)
+  {
+    for (int i = 0; i < count; ++i)
+    {
+      sum += co_await etl::co_pop(queue);
+    }
+  }
+
+  //***************************************************************************
+  etl::co_task wait_ticks(etl::ico_frame_allocator&, etl::icallback_timer& timers, uint32_t ticks, int& state)
+  {
+    state = 1;
+    const bool ok = co_await etl::co_delay(timers, ticks);
+    state = ok ? 2 : 3;
+  }
+
+  //***************************************************************************
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message1&)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message2&)
+    {
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+  };
+
+  typedef etl::message_inbox<Router, 4> inbox_t;
+
+  etl::co_task protocol(etl::ico_frame_allocator&, inbox_t& inbox, int& sum)
+  {
+    for (;;)
+    {
+      inbox_t::item_type item = co_await etl::co_receive(inbox);
+
+      if (item.get().message_id == MESSAGE2)
+      {
+        break;
+      }
+
+      sum += static_cast<const Message1&>(item.get()).value;
+    }
+  }
+
+  //***************************************************************************
+  struct Handler
+  {
+    etl::co_task run(etl::ico_frame_allocator&, int& value)
+    {
+      value = base;
+      co_return;
+    }
+
+    int base = 42;
+  };
+
+  SUITE(test_co_task)
+  {
+    //*************************************************************************
+    TEST(test_tasks_interleave)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+      etl::vector<int, 32> log;
+
+      CHECK(scheduler.spawn(count_up(frames, log, 1, 3)));
+      CHECK(scheduler.spawn(count_up(frames, log, 2, 2)));
+      CHECK_EQUAL(2U, scheduler.size());
+      CHECK_EQUAL(2U, pool.size());
+      CHECK(log.empty()); // Tasks start suspended.
+
+      CHECK_EQUAL(2U, scheduler.task_request_work());
+      scheduler.task_process_work();
+
+      CHECK_EQUAL(2U, log.size());
+      CHECK_EQUAL(10, log[0]);
+      CHECK_EQUAL(20, log[1]);
+
+      scheduler.run_until_idle();
+
+      const int expected[] = { 10, 20, 11, 21, 12 };
+      CHECK_EQUAL(5U, log.size());
+      CHECK_ARRAY_EQUAL(expected, log.data(), 5U);
+
+      CHECK(scheduler.empty());
+      CHECK_EQUAL(0U, pool.size()); // Frames returned to the pool.
+    }
+
+    //*************************************************************************
+    TEST(test_allocation_failure)
+    {
+      etl::generic_pool<512, etl::ico_frame_allocator::FRAME_ALIGNMENT, 1> pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+      etl::vector<int, 32> log;
+
+      etl::co_task first  = count_up(frames, log, 1, 1);
+      etl::co_task second = count_up(frames, log, 2, 1);
+
+      CHECK(first.valid());
+      CHECK(!second.valid());
+      CHECK(!scheduler.spawn(etl::move(second)));
+      CHECK(scheduler.spawn(etl::move(first)));
+      CHECK(!first.valid());
+
+      scheduler.run_until_idle();
+      CHECK_EQUAL(1U, log.size());
+
+      // Frames too large for the pool's items are not allocated.
+      etl::generic_pool<16, etl::ico_frame_allocator::FRAME_ALIGNMENT, 4> tiny_pool;
+      etl::co_pool_allocator tiny(tiny_pool);
+      CHECK(!count_up(tiny, log, 3, 1).valid());
+      CHECK_EQUAL(0U, tiny_pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_unspawned_task_is_destroyed)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::vector<int, 32> log;
+
+      {
+        etl::co_task task = count_up(frames, log, 1, 1);
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+      CHECK(log.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_allocator)
+    {
+      etl::arena<2048> arena;
+      etl::co_arena_allocator frames(arena);
+      etl::co_scheduler scheduler;
+      etl::vector<int, 32> log;
+
+      CHECK(scheduler.spawn(count_up(frames, log, 1, 2)));
+      CHECK(arena.size() > 0U);
+
+      scheduler.run_until_idle();
+      CHECK_EQUAL(2U, log.size());
+      CHECK(scheduler.empty());
+
+      arena.reset();
+    }
+
+    //*************************************************************************
+    TEST(test_member_coroutine)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+
+      Handler handler;
+      int value = 0;
+
+      CHECK(scheduler.spawn(handler.run(frames, value)));
+      scheduler.run_until_idle();
+
+      CHECK_EQUAL(42, value);
+    }
+
+    //*************************************************************************
+    TEST(test_queue_pop)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int sum = 0;
+
+      queue.push(1);
+      CHECK(scheduler.spawn(consume(frames, queue, sum, 3)));
+
+      scheduler.run_until_idle();
+      CHECK_EQUAL(1, sum); // Waiting for the second value.
+      CHECK_EQUAL(0U, scheduler.task_request_work());
+      CHECK_EQUAL(1U, scheduler.size());
+
+      queue.push(2);
+      queue.push(3);
+      scheduler.run_until_idle();
+
+      CHECK_EQUAL(6, sum);
+      CHECK(scheduler.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_delay)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+      etl::callback_timer<1> timers;
+      timers.enable(true);
+
+      int state1 = 0;
+      int state2 = 0;
+
+      CHECK(scheduler.spawn(wait_ticks(frames, timers, 10U, state1)));
+      CHECK(scheduler.spawn(wait_ticks(frames, timers, 5U, state2)));
+
+      scheduler.run_until_idle();
+      CHECK_EQUAL(1, state1);
+      CHECK_EQUAL(3, state2); // No timer was free.
+
+      timers.tick(9U);
+      scheduler.run_until_idle();
+      CHECK_EQUAL(1, state1);
+
+      timers.tick(1U);
+      scheduler.run_until_idle();
+      CHECK_EQUAL(2, state1);
+      CHECK(scheduler.empty());
+
+      // The timer was released.
+      int state3 = 0;
+      CHECK(scheduler.spawn(wait_ticks(frames, timers, 0U, state3)));
+      scheduler.run_until_idle();
+      CHECK_EQUAL(2, state3);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_releases_waiting_timers_and_frames)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::callback_timer<1> timers;
+      timers.enable(true);
+
+      int state = 0;
+
+      {
+        etl::co_scheduler scheduler;
+        CHECK(scheduler.spawn(wait_ticks(frames, timers, 10U, state)));
+        scheduler.run_until_idle();
+        CHECK_EQUAL(1, state);
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+
+      // The timer is free again.
+      etl::co_scheduler scheduler;
+      CHECK(scheduler.spawn(wait_ticks(frames, timers, 1U, state)));
+      scheduler.run_until_idle();
+      timers.tick(1U);
+      scheduler.run_until_idle();
+      CHECK_EQUAL(2, state);
+    }
+
+    //*************************************************************************
+    TEST(test_message_receive)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler scheduler;
+      Router router;
+      inbox_t inbox(router);
+
+      int sum = 0;
+
+      CHECK(scheduler.spawn(protocol(frames, inbox, sum)));
+      scheduler.run_until_idle();
+
+      inbox.receive(Message1(5));
+      inbox.receive(Message1(7));
+      scheduler.run_until_idle();
+      CHECK_EQUAL(12, sum);
+      CHECK_EQUAL(1U, scheduler.size());
+
+      inbox.receive(Message2());
+      scheduler.run_until_idle();
+      CHECK(scheduler.empty());
+    }
+
+    //*************************************************************************
+    struct Exit
+    {
+      Exit(etl::ischeduler& scheduler_, etl::co_scheduler& tasks_)
+        : scheduler(scheduler_)
+        , tasks(tasks_)
+      {
+      }
+
+      void idle()
+      {
+        if (tasks.empty())
+        {
+          scheduler.exit_scheduler();
+        }
+      }
+
+      etl::ischeduler&   scheduler;
+      etl::co_scheduler& tasks;
+    };
+
+    TEST(test_driven_by_etl_scheduler)
+    {
+      frame_pool_t pool;
+      etl::co_pool_allocator frames(pool);
+      etl::co_scheduler tasks;
+      etl::vector<int, 32> log;
+
+      etl::scheduler<etl::scheduler_policy_sequencial_single, 1> scheduler;
+      scheduler.add_task(tasks);
+
+      Exit exit(scheduler, tasks);
+      etl::function<Exit, void> idle(exit, &Exit::idle);
+      scheduler.set_idle_callback(idle);
+
+      CHECK(tasks.spawn(count_up(frames, log, 1, 3)));
+      CHECK(tasks.spawn(count_up(frames, log, 2, 3)));
+
+      scheduler.start();
+
+      CHECK_EQUAL(6U, log.size());
+      CHECK(tasks.empty());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,223 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/cobs.h"
+#include "etl/crc16_x25.h"
+
+#include <stdint.h>
+#include <vector>
+#include <iterator>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  template <typename TEncoder>
+  Bytes encode(const Bytes& data)
+  {
+    TEncoder encoder;
+    Bytes    result;
+
+    encoder.encode(data.data(), data.data() + data.size(), std::back_inserter(result));
+
+    CHECK(result.size() <= TEncoder::max_encoded_size(data.size()));
+
+    return result;
+  }
+
+  SUITE(test_cobs)
+  {
+    //*************************************************************************
+    TEST(test_encode_reference_vectors)
+    {
+      CHECK((Bytes{ 0x01, 0x01, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes{ 0x00 }));
+      CHECK((Bytes{ 0x01, 0x01, 0x01, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes{ 0x00, 0x00 }));
+      CHECK((Bytes{ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes{ 0x11, 0x22, 0x00, 0x33 }));
+      CHECK((Bytes{ 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes{ 0x11, 0x22, 0x33, 0x44 }));
+      CHECK((Bytes{ 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes{ 0x11, 0x00, 0x00, 0x00 }));
+      CHECK((Bytes{ 0x01, 0x00 }) == encode<etl::cobs_encoder<> >(Bytes()));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_full_blocks)
+    {
+      Bytes data;
+
+      for (int i = 1; i <= 254; ++i)
+      {
+        data.push_back(uint8_t(i));
+      }
+
+      // A full block at the end needs no empty block after it.
+      Bytes expected;
+      expected.push_back(0xFF);
+      expected.insert(expected.end(), data.begin(), data.end());
+      expected.push_back(0x00);
+
+      CHECK(expected == encode<etl::cobs_encoder<> >(data));
+
+      // A zero after a full block.
+      data.push_back(0x00);
+      expected.pop_back();
+      expected.push_back(0x01);
+      expected.push_back(0x01);
+      expected.push_back(0x00);
+
+      CHECK(expected == encode<etl::cobs_encoder<> >(data));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_in_chunks_matches_whole)
+    {
+      Bytes data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(uint8_t((i * 7) % 23));
+      }
+
+      etl::cobs_encoder<etl::crc16_x25> encoder;
+      Bytes chunked;
+
+      std::back_insert_iterator<Bytes> out = encoder.begin(std::back_inserter(chunked));
+
+      for (size_t i = 0U; i < data.size(); i += 37U)
+      {
+        size_t n = (data.size() - i < 37U) ? data.size() - i : 37U;
+        out = encoder.add(data.data() + i, data.data() + i + n, out);
+      }
+
+      encoder.end(out);
+
+      CHECK(chunked == encode<etl::cobs_encoder<etl::crc16_x25> >(data));
+
+      // No zeros, except the delimiter.
+      for (size_t i = 0U; i < chunked.size() - 1U; ++i)
+      {
+        CHECK(chunked[i] != 0U);
+      }
+
+      CHECK_EQUAL(0U, chunked.back());
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_with_fcs_byte_by_byte)
+    {
+      Bytes data;
+
+      for (int i = 0; i < 600; ++i)
+      {
+        data.push_back(uint8_t(i % 5 == 0 ? 0 : i));
+      }
+
+      Bytes encoded = encode<etl::cobs_encoder<etl::crc16_x25> >(data);
+
+      uint8_t buffer[700];
+      etl::cobs_decoder<etl::crc16_x25> decoder(buffer, sizeof(buffer));
+
+      for (size_t i = 0U; i < encoded.size(); ++i)
+      {
+        CHECK_EQUAL(etl::framing_status::INCOMPLETE, decoder.status());
+        const uint8_t* p = decoder.decode(&encoded[i], &encoded[i] + 1U);
+        CHECK(p == &encoded[i] + 1U);
+      }
+
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(data.size(), decoder.size());
+      CHECK_ARRAY_EQUAL(data.data(), decoder.data(), data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_decode_several_frames_in_one_chunk)
+    {
+      Bytes stream;
+      stream.push_back(0x00); // Idle
+
+      Bytes a = encode<etl::cobs_encoder<> >(Bytes{ 0x01, 0x00, 0x02 });
+      Bytes b = encode<etl::cobs_encoder<> >(Bytes{ 0x00 });
+      stream.insert(stream.end(), a.begin(), a.end());
+      stream.insert(stream.end(), b.begin(), b.end());
+
+      uint8_t buffer[16];
+      etl::cobs_decoder<> decoder(buffer, sizeof(buffer));
+
+      const uint8_t* p   = stream.data();
+      const uint8_t* end = stream.data() + stream.size();
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK((Bytes{ 0x01, 0x00, 0x02 }) == Bytes(decoder.data(), decoder.data() + decoder.size()));
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK((Bytes{ 0x00 }) == Bytes(decoder.data(), decoder.data() + decoder.size()));
+      CHECK(p == end);
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::INCOMPLETE, decoder.status());
+    }
+
+    //*************************************************************************
+    TEST(test_decode_errors)
+    {
+      uint8_t buffer[8];
+      etl::cobs_decoder<etl::crc16_x25> decoder(buffer, sizeof(buffer));
+
+      // Corrupt data.
+      Bytes encoded = encode<etl::cobs_encoder<etl::crc16_x25> >(Bytes{ 0x10, 0x20, 0x30 });
+      encoded[2] ^= 0x01;
+      decoder.decode(encoded.data(), encoded.data() + encoded.size());
+      CHECK_EQUAL(etl::framing_status::FCS_ERROR, decoder.status());
+
+      // Truncated block.
+      const uint8_t truncated[] = { 0x05, 0x11, 0x22, 0x00 };
+      decoder.decode(truncated, truncated + sizeof(truncated));
+      CHECK_EQUAL(etl::framing_status::FORMAT_ERROR, decoder.status());
+
+      // Shorter than the frame check sequence.
+      const uint8_t short_frame[] = { 0x02, 0x11, 0x00 };
+      decoder.decode(short_frame, short_frame + sizeof(short_frame));
+      CHECK_EQUAL(etl::framing_status::FORMAT_ERROR, decoder.status());
+
+      // Too large for the buffer.
+      Bytes large = encode<etl::cobs_encoder<etl::crc16_x25> >(Bytes(20U, uint8_t(0x55U)));
+      decoder.decode(large.data(), large.data() + large.size());
+      CHECK_EQUAL(etl::framing_status::BUFFER_FULL, decoder.status());
+
+      // Recovers for the next frame.
+      Bytes good = encode<etl::cobs_encoder<etl::crc16_x25> >(Bytes{ 0x00, 0x01 });
+      decoder.decode(good.data(), good.data() + good.size());
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(2U, decoder.size());
+    }
+  }
+}
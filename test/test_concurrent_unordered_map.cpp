@@ -0,0 +1,255 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include "etl/concurrent_unordered_map.h"
+#include "etl/mutex.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Every key has the same home slot, in the one stripe.
+  struct collide_hash
+  {
+    size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  // The fields are always written as a pair, so a torn read shows as a mismatch.
+  struct Value
+  {
+    uint32_t a;
+    uint64_t b;
+  };
+
+  typedef etl::concurrent_unordered_map<int, int, 16, 4>                           Map;
+  typedef etl::concurrent_unordered_map<int, int, 8, 1, collide_hash>              CollideMap;
+  typedef etl::concurrent_unordered_map<int, Value, 256, 8, etl::hash<int>, etl::equal_to<int>, etl::ticket_lock> SharedMap;
+
+  const int KEYS_PER_WRITER = 64;
+  const int ROUNDS          = 200;
+
+  SharedMap         shared;
+  std::atomic<bool> done;
+  std::atomic<int>  mismatches;
+
+  void writer(int first_key)
+  {
+    for (int round = 1; round <= ROUNDS; ++round)
+    {
+      for (int key = first_key; key < (first_key + KEYS_PER_WRITER); ++key)
+      {
+        Value v = { uint32_t(round), ~uint64_t(round) };
+        shared.insert_or_assign(key, v);
+
+        if ((round % 7) == 0)
+        {
+          shared.erase(key);
+        }
+      }
+    }
+  }
+
+  void reader()
+  {
+    while (!done)
+    {
+      for (int key = 0; key < (2 * KEYS_PER_WRITER); ++key)
+      {
+        Value v;
+
+        if (shared.find(key, v) && (v.b != ~uint64_t(v.a)))
+        {
+          ++mismatches;
+        }
+      }
+    }
+  }
+
+  SUITE(test_concurrent_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(16U, map.max_size());
+
+      CHECK(map.insert(1, 10));
+      CHECK(map.insert(2, 20));
+      CHECK(!map.insert(1, 11));
+      CHECK_EQUAL(2U, map.size());
+
+      int value = 0;
+      CHECK(map.find(1, value));
+      CHECK_EQUAL(10, value);
+      CHECK(!map.find(3, value));
+      CHECK(map.contains(2));
+
+      CHECK(map.insert_or_assign(1, 12));
+      CHECK(map.find(1, value));
+      CHECK_EQUAL(12, value);
+
+      CHECK(map.erase(1));
+      CHECK(!map.erase(1));
+      CHECK(!map.contains(1));
+      CHECK_EQUAL(1U, map.size());
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(!map.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      Map map;
+
+      map.insert(5, 1);
+
+      struct Doubler
+      {
+        void operator()(int& v) const
+        {
+          v *= 2;
+        }
+      };
+
+      CHECK(map.update(5, Doubler()));
+      CHECK(!map.update(6, Doubler()));
+
+      int value = 0;
+      map.find(5, value);
+      CHECK_EQUAL(2, value);
+    }
+
+    //*************************************************************************
+    TEST(test_version)
+    {
+      Map map;
+
+      const uint32_t v0 = map.version(1);
+      map.insert(1, 1);
+      CHECK_EQUAL(v0 + 1U, map.version(1));
+
+      // A failed insert writes nothing.
+      map.insert(1, 2);
+      CHECK_EQUAL(v0 + 1U, map.version(1));
+    }
+
+    //*************************************************************************
+    TEST(test_full_stripe)
+    {
+      CollideMap map;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(map.insert(i, i));
+      }
+
+      CHECK(!map.insert(8, 8));
+      CHECK(!map.insert_or_assign(8, 8));
+      CHECK(map.insert_or_assign(7, 70));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_shifts_back_probe_sequence)
+    {
+      CollideMap map;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        map.insert(i, i * 10);
+      }
+
+      // Erase from the start, middle and end of the chain.
+      CHECK(map.erase(0));
+      CHECK(map.erase(4));
+      CHECK(map.erase(7));
+
+      int expected[] = { 1, 2, 3, 5, 6 };
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        int value = 0;
+        CHECK(map.find(expected[i], value));
+        CHECK_EQUAL(expected[i] * 10, value);
+      }
+
+      CHECK(!map.contains(0));
+      CHECK(!map.contains(4));
+      CHECK(!map.contains(7));
+      CHECK_EQUAL(5U, map.size());
+
+      // The slots are reusable.
+      CHECK(map.insert(10, 100));
+      CHECK(map.insert(11, 110));
+      CHECK(map.insert(12, 120));
+      CHECK(!map.insert(13, 130));
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      done       = false;
+      mismatches = 0;
+
+      std::thread r1(reader);
+      std::thread r2(reader);
+      std::thread w1(writer, 0);
+      std::thread w2(writer, KEYS_PER_WRITER);
+
+      w1.join();
+      w2.join();
+      done = true;
+      r1.join();
+      r2.join();
+
+      CHECK_EQUAL(0, mismatches.load());
+      CHECK_EQUAL(size_t(2 * KEYS_PER_WRITER), shared.size());
+
+      for (int key = 0; key < (2 * KEYS_PER_WRITER); ++key)
+      {
+        Value v;
+        CHECK(shared.find(key, v));
+        CHECK_EQUAL(uint32_t(ROUNDS), v.a);
+      }
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,101 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/vector.h"
+#include "etl/map.h"
+#include "etl/pool.h"
+#include "etl/queue_spsc_atomic.h"
+
+namespace
+{
+  //***************************************************************************
+  // Records the state of the containers below during dynamic initialisation.
+  // Constant initialisation is done before any dynamic initialisation, so
+  // the containers must already be set up, even though they are defined later.
+  //***************************************************************************
+  struct Early
+  {
+    Early();
+
+    size_t vector_capacity;
+    size_t map_max_size;
+    size_t pool_max_size;
+    size_t queue_max_size;
+  };
+
+  Early early;
+
+  ETL_CONSTINIT etl::vector<int, 4>              static_vector;
+  ETL_CONSTINIT etl::map<int, int, 4>            static_map;
+  ETL_CONSTINIT etl::pool<int, 4>                static_pool;
+  ETL_CONSTINIT etl::queue_spsc_atomic<int, 4>   static_queue;
+
+  Early::Early()
+    : vector_capacity(static_vector.capacity())
+    , map_max_size(static_map.max_size())
+    , pool_max_size(static_pool.max_size())
+    , queue_max_size(static_queue.max_size())
+  {
+  }
+
+  SUITE(test_constinit)
+  {
+    //*************************************************************************
+    TEST(test_initialised_before_dynamic_initialisation)
+    {
+      CHECK_EQUAL(4U, early.vector_capacity);
+      CHECK_EQUAL(4U, early.map_max_size);
+      CHECK_EQUAL(4U, early.pool_max_size);
+      CHECK_EQUAL(4U, early.queue_max_size);
+    }
+
+    //*************************************************************************
+    TEST(test_usable)
+    {
+      static_vector.push_back(1);
+      CHECK_EQUAL(1, static_vector.front());
+      static_vector.clear();
+
+      static_map[1] = 10;
+      CHECK_EQUAL(10, static_map[1]);
+      static_map.clear();
+
+      int* p = static_pool.allocate<int>();
+      CHECK(p != nullptr);
+      CHECK_EQUAL(1U, static_pool.size());
+      static_pool.release(p);
+
+      CHECK(static_queue.push(1));
+      int i = 0;
+      CHECK(static_queue.pop(i));
+      CHECK_EQUAL(1, i);
+    }
+  };
+}
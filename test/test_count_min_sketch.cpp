@@ -0,0 +1,147 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/count_min_sketch.h"
+#include "etl/fnv_1.h"
+
+#include <stdint.h>
+#include <map>
+
+namespace
+{
+  struct hash_t
+  {
+    typedef uint32_t argument_type;
+
+    uint64_t operator ()(argument_type value) const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+      return etl::fnv_1a_64(p, p + sizeof(value));
+    }
+  };
+
+  typedef etl::count_min_sketch<256, 4, hash_t> Sketch;
+
+  SUITE(test_count_min_sketch)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      Sketch sketch;
+
+      CHECK_EQUAL(0U, sketch.estimate(1U));
+      CHECK_EQUAL(0U, sketch.total());
+    }
+
+    //*************************************************************************
+    TEST(test_exact_when_sparse)
+    {
+      Sketch sketch;
+
+      CHECK_EQUAL(1U, sketch.add(7U));
+      CHECK_EQUAL(4U, sketch.add(7U, 3U));
+      sketch.add(9U, 10U);
+
+      CHECK_EQUAL(4U,  sketch.estimate(7U));
+      CHECK_EQUAL(10U, sketch.estimate(9U));
+      CHECK_EQUAL(14U, sketch.total());
+    }
+
+    //*************************************************************************
+    TEST(test_never_under_estimates)
+    {
+      Sketch sketch;
+      std::map<uint32_t, uint32_t> actual;
+
+      // A skewed stream over many more keys than counters.
+      for (uint32_t i = 0U; i < 20000U; ++i)
+      {
+        const uint32_t key = (i % 7U == 0U) ? (i % 5U) : (i * 2654435761U) % 3000U;
+        sketch.add(key);
+        ++actual[key];
+      }
+
+      uint32_t total_error = 0U;
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = actual.begin(); itr != actual.end(); ++itr)
+      {
+        const uint32_t estimate = sketch.estimate(itr->first);
+        CHECK(estimate >= itr->second);
+        total_error += estimate - itr->second;
+      }
+
+      // The heavy keys are near exact.
+      for (uint32_t key = 0U; key < 5U; ++key)
+      {
+        CHECK(sketch.estimate(key) <= (actual[key] + 200U));
+      }
+
+      // On average, well within e.N / WIDTH.
+      CHECK((total_error / actual.size()) < (20000U * 272U / 100U / 256U));
+    }
+
+    //*************************************************************************
+    TEST(test_merge_and_decay)
+    {
+      Sketch a;
+      Sketch b;
+
+      a.add(1U, 10U);
+      b.add(1U, 5U);
+      b.add(2U, 4U);
+
+      a.merge(b);
+
+      CHECK_EQUAL(15U, a.estimate(1U));
+      CHECK_EQUAL(4U,  a.estimate(2U));
+      CHECK_EQUAL(19U, a.total());
+
+      a.decay();
+      CHECK_EQUAL(7U, a.estimate(1U));
+      CHECK_EQUAL(2U, a.estimate(2U));
+
+      a.clear();
+      CHECK_EQUAL(0U, a.estimate(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_saturation)
+    {
+      etl::count_min_sketch<16, 2, hash_t, uint8_t> sketch;
+
+      sketch.add(1U, 200U);
+      sketch.add(1U, 200U);
+
+      CHECK_EQUAL(255U, sketch.estimate(1U));
+      CHECK_EQUAL(255U, sketch.total());
+    }
+  };
+}
@@ -0,0 +1,97 @@
+﻿/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/cpu_features.h"
+
+namespace
+{
+  int portable()  { return 1; }
+  int with_sse42() { return 2; }
+  int with_avx2()  { return 3; }
+
+  typedef int (*function_t)();
+  typedef etl::cpu_dispatch<function_t> Dispatch;
+
+  const Dispatch::candidate_type candidates[] =
+  {
+    { etl::cpu_features::AVX2 | etl::cpu_features::BMI2, &with_avx2 },
+    { etl::cpu_features::SSE42,                          &with_sse42 },
+    { etl::cpu_features::NONE,                           &portable }
+  };
+
+  SUITE(test_cpu_features)
+  {
+    //*************************************************************************
+    TEST(test_features_include_compile_time)
+    {
+      const uint32_t compile_time = etl::cpu_features::compile_time();
+
+      CHECK_EQUAL(compile_time, etl::cpu_features::get() & compile_time);
+      CHECK_EQUAL(etl::cpu_features::detect(), etl::cpu_features::get());
+      CHECK(etl::cpu_features::has(compile_time));
+      CHECK(etl::cpu_features::has(etl::cpu_features::NONE));
+
+#if defined(ETL_NO_CPU_DISPATCH)
+      CHECK_EQUAL(compile_time, etl::cpu_features::get());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_select)
+    {
+      CHECK(&portable   == Dispatch(candidates, etl::cpu_features::NONE).get());
+      CHECK(&portable   == Dispatch(candidates, etl::cpu_features::AVX2).get());
+      CHECK(&with_sse42 == Dispatch(candidates, etl::cpu_features::SSE42 | etl::cpu_features::AVX2).get());
+      CHECK(&with_avx2  == Dispatch(candidates, etl::cpu_features::SSE42 | etl::cpu_features::AVX2 | etl::cpu_features::BMI2).get());
+
+      // No portable candidate.
+      CHECK(Dispatch::select(candidates, 2U, etl::cpu_features::NONE) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_dispatch_uses_processor_features)
+    {
+      static const Dispatch dispatch(candidates);
+
+      int expected = 1;
+
+      if (etl::cpu_features::has(etl::cpu_features::AVX2 | etl::cpu_features::BMI2))
+      {
+        expected = 3;
+      }
+      else if (etl::cpu_features::has(etl::cpu_features::SSE42))
+      {
+        expected = 2;
+      }
+
+      CHECK_EQUAL(expected, dispatch.get()());
+    }
+  };
+}
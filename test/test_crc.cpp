@@ -49,6 +49,9 @@ SOFTWARE.
 #include "etl/crc32_mpeg2.h"
 #include "etl/crc32_posix.h"
 #include "etl/crc64_ecma.h"
+#include "etl/crc.h"
+#include "etl/crc24_openpgp.h"
+#include "etl/crc32_autosar.h"
 
 //*****************************************************************************
 // The results for these tests were created from https://crccalc.com/
@@ -958,6 +961,228 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc16_ccitt_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0x29B1, int(etl::crc16_ccitt_slice4(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x29B1, int(etl::crc16_ccitt_slice8(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x29B1, int(etl::crc16_ccitt_slice16(data.begin(), data.end()).value()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_kermit_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0x2189, int(etl::crc16_kermit_slice4(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x2189, int(etl::crc16_kermit_slice8(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x2189, int(etl::crc16_kermit_slice16(data.begin(), data.end()).value()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xCBF43926, etl::crc32_slice4(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xCBF43926, etl::crc32_slice8(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xCBF43926, etl::crc32_slice16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_bzip2_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xFC891918, etl::crc32_bzip2_slice4(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xFC891918, etl::crc32_bzip2_slice8(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xFC891918, etl::crc32_bzip2_slice16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xE3069283, etl::crc32_c_slice4(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xE3069283, etl::crc32_c_slice8(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xE3069283, etl::crc32_c_slice16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_slicing)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0x6C40DF5F0B497347U, etl::crc64_ecma_slice4(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x6C40DF5F0B497347U, etl::crc64_ecma_slice8(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x6C40DF5F0B497347U, etl::crc64_ecma_slice16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slicing_matches_byte_wise_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        data.push_back(uint8_t(i * 37));
+
+        uint32_t expected = etl::crc32(data.begin(), data.end());
+
+        CHECK_EQUAL(expected, etl::crc32_slice4(data.begin(), data.end()).value());
+        CHECK_EQUAL(expected, etl::crc32_slice8(data.begin(), data.end()).value());
+        CHECK_EQUAL(expected, etl::crc32_slice16(data.begin(), data.end()).value());
+
+        etl::crc32_slice8 crc_calculator;
+        crc_calculator.add(data.begin(), data.begin() + (i / 2));
+        crc_calculator.add(data[i / 2]);
+        crc_calculator.add(data.begin() + (i / 2) + 1, data.end());
+        CHECK_EQUAL(expected, crc_calculator.value());
+      }
+    }
+
+#if defined(ETL_HAS_HARDWARE_CRC32_C)
+    //*************************************************************************
+    TEST(test_crc32_c_hardware_matches_table)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        data.push_back(uint8_t(i * 37));
+
+        uint32_t expected = etl::crc32_c_table(data.begin(), data.end());
+
+        CHECK_EQUAL(expected, etl::crc32_c_hardware(data.begin(), data.end()).value());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_c_dispatch_matches_table)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        data.push_back(uint8_t(i * 37));
+
+        uint32_t expected = etl::crc32_c_table(data.begin(), data.end());
+
+        CHECK_EQUAL(expected, etl::crc32_c_dispatch(data.begin(), data.end()).value());
+        CHECK_EQUAL(expected, etl::crc32_c_dispatch(data.data(), data.data() + data.size()).value());
+      }
+
+      std::string text("123456789");
+      CHECK_EQUAL(0xE3069283U, etl::crc32_c_dispatch(text.begin(), text.end()).value());
+    }
+
+#if defined(ETL_HAS_HARDWARE_CRC32)
+    //*************************************************************************
+    TEST(test_crc32_hardware_matches_table)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        data.push_back(uint8_t(i * 37));
+
+        uint32_t expected = etl::crc32_table(data.begin(), data.end());
+
+        CHECK_EQUAL(expected, etl::crc32_hardware(data.begin(), data.end()).value());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc24_openpgp)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0x21CF02U, etl::crc24_openpgp(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x21CF02U, etl::crc24_openpgp_t16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_autosar)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0x1697D06AU, etl::crc32_autosar(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x1697D06AU, etl::crc32_autosar_t16(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_generic_matches_existing)
+    {
+      typedef etl::crc<8U,  0x07U,   0xFFU,   true,  true,  0x00U>        crc8_rohc;
+      typedef etl::crc<16U, 0x1021U, 0xFFFFU, false, false, 0x0000U>      crc16_ccitt;
+      typedef etl::crc<16U, 0x8005U, 0xFFFFU, true,  true,  0x0000U, 16U> crc16_modbus_t16;
+      typedef etl::crc<32U, 0x04C11DB7U, 0xFFFFFFFFU, true,  true,  0xFFFFFFFFU>      crc32;
+      typedef etl::crc<32U, 0x04C11DB7U, 0xFFFFFFFFU, false, false, 0xFFFFFFFFU, 16U> crc32_bzip2_t16;
+      typedef etl::crc<64U, 0x42F0E1EBA9EA3693U, 0U, false, false, 0U>               crc64_ecma;
+
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xD0,   int(crc8_rohc(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x29B1, int(crc16_ccitt(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0x4B37, int(crc16_modbus_t16(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0xCBF43926U, crc32(data.begin(), data.end()).value());
+      CHECK_EQUAL(0xFC891918U, crc32_bzip2_t16(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x6C40DF5F0B497347U, crc64_ecma(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_generic_reflect_out_only)
+    {
+      // CRC-12/UMTS
+      typedef etl::crc<12U, 0x80FU, 0x000U, false, true, 0x000U>      crc12_umts;
+      typedef etl::crc<12U, 0x80FU, 0x000U, false, true, 0x000U, 16U> crc12_umts_t16;
+
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xDAF, int(crc12_umts(data.begin(), data.end()).value()));
+      CHECK_EQUAL(0xDAF, int(crc12_umts_t16(data.begin(), data.end()).value()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_add_multi)
+    {
+      // Six buffers of different lengths: one group of four, then two singly.
+      const size_t lengths[6] = { 9, 100, 1, 33, 0, 64 };
+
+      std::vector<uint8_t> data[6];
+      const uint8_t*       buffers[6];
+
+      for (size_t i = 0; i < 6; ++i)
+      {
+        for (size_t j = 0; j < lengths[i]; ++j)
+        {
+          data[i].push_back(uint8_t((i * 37) + (j * 151) + 3));
+        }
+
+        buffers[i] = data[i].data();
+      }
+
+      uint32_t results[6];
+      etl::crc32::add_multi(buffers, lengths, results);
+
+      for (size_t i = 0; i < 6; ++i)
+      {
+        CHECK_EQUAL(uint32_t(etl::crc32(data[i].begin(), data[i].end())), results[i]);
+      }
+
+      uint16_t results16[6];
+      etl::crc16_ccitt::add_multi(buffers, lengths, results16, 6U);
+
+      for (size_t i = 0; i < 6; ++i)
+      {
+        CHECK_EQUAL(uint16_t(etl::crc16_ccitt(data[i].begin(), data[i].end())), results16[i]);
+      }
+    }
   };
 }
-
@@ -0,0 +1,144 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc_combine.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_modbus.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_mpeg2.h"
+#include "etl/crc64_ecma.h"
+#include "etl/crc.h"
+
+namespace
+{
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_combine(const std::vector<uint8_t>& data)
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const value_type expected = TCrc(data.begin(), data.end()).value();
+
+    for (size_t split = 0; split <= data.size(); ++split)
+    {
+      value_type crc_a = TCrc(data.begin(), data.begin() + split).value();
+      value_type crc_b = TCrc(data.begin() + split, data.end()).value();
+
+      if (etl::crc_combine<TCrc>(crc_a, crc_b, data.size() - split) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+      data.push_back(uint8_t((i * 131) + 17));
+    }
+
+    return data;
+  }
+
+  SUITE(test_crc_combine)
+  {
+    //*************************************************************************
+    TEST(test_crc_combine_reflected)
+    {
+      std::vector<uint8_t> data = make_data(70);
+
+      CHECK(check_combine<etl::crc16_modbus>(data));
+      CHECK(check_combine<etl::crc32>(data));
+      CHECK(check_combine<etl::crc32_c>(data));
+      CHECK(check_combine<etl::crc32_slice8>(data));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_not_reflected)
+    {
+      std::vector<uint8_t> data = make_data(70);
+
+      CHECK(check_combine<etl::crc8_ccitt>(data));
+      CHECK(check_combine<etl::crc16_ccitt>(data));
+      CHECK(check_combine<etl::crc32_mpeg2>(data));
+      CHECK(check_combine<etl::crc64_ecma>(data));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_generic)
+    {
+      typedef etl::crc<24U, 0x864CFBU, 0xB704CEU, false, false, 0x000000U> crc24_openpgp;
+      typedef etl::crc<12U, 0x80FU, 0x000U, false, true, 0x000U, 16U>     crc12_umts_t16;
+
+      std::vector<uint8_t> data = make_data(70);
+
+      CHECK(check_combine<crc24_openpgp>(data));
+      CHECK(check_combine<crc12_umts_t16>(data));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_long_block)
+    {
+      std::vector<uint8_t> data = make_data(100000);
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      uint32_t crc_a = etl::crc32(data.begin(), data.begin() + 12345);
+      uint32_t crc_b = etl::crc32(data.begin() + 12345, data.end());
+
+      CHECK_EQUAL(expected, etl::crc_combine<etl::crc32>(crc_a, crc_b, data.size() - 12345));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_gather)
+    {
+      std::string data("123456789");
+
+      std::vector<std::string> fragments;
+      fragments.push_back("123");
+      fragments.push_back("");
+      fragments.push_back("45678");
+      fragments.push_back("9");
+
+      CHECK_EQUAL(0xCBF43926U, etl::crc_gather<etl::crc32>(fragments.begin(), fragments.end()));
+    }
+  };
+}
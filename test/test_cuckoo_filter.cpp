@@ -0,0 +1,258 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+
+#include <vector>
+
+#include "etl/cuckoo_filter.h"
+
+#include "etl/fnv_1.h"
+#include "etl/char_traits.h"
+
+namespace
+{
+  struct text_hash_t
+  {
+    typedef const char* argument_type;
+
+    size_t operator ()(argument_type text) const
+    {
+      return etl::fnv_1a_32(text, text + etl::char_traits<char>::length(text));
+    }
+  };
+
+  struct integer_hash_t
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return size_t(value) * 0x9E3779B1UL;
+    }
+  };
+
+  const char* exist_text[]     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
+  const char* not_exist_text[] = { "My", "hovercraft", "is", "full", "of", "eels" };
+
+  SUITE(test_cuckoo_filter)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::cuckoo_filter<16, text_hash_t> filter;
+
+      CHECK(filter.empty());
+      CHECK(!filter.full());
+      CHECK_EQUAL(0U, filter.size());
+      CHECK_EQUAL(16U, filter.max_size());
+      CHECK(filter.capacity() >= 16U);
+      CHECK_EQUAL(0U, filter.usage());
+      CHECK(!filter.exists("The"));
+    }
+
+    //*************************************************************************
+    TEST(test_add_text)
+    {
+      etl::cuckoo_filter<16, text_hash_t> filter;
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(exist_text); ++i)
+      {
+        CHECK(filter.add(exist_text[i]));
+      }
+
+      CHECK_EQUAL(9U, filter.size());
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(exist_text); ++i)
+      {
+        CHECK(filter.exists(exist_text[i]));
+      }
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(not_exist_text); ++i)
+      {
+        CHECK(!filter.exists(not_exist_text[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_many_keys)
+    {
+      typedef etl::cuckoo_filter<10000, integer_hash_t> Filter;
+
+      static Filter filter;
+      filter.clear();
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        CHECK(filter.add(i * 2U));
+      }
+
+      CHECK_EQUAL(10000U, filter.size());
+      CHECK(!filter.full());
+
+      // No false negatives.
+      size_t found = 0U;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        found += filter.exists(i * 2U) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(10000U, found);
+
+      // About 3% false positives for 8 bit fingerprints and this load.
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 0U; i < 100000U; ++i)
+      {
+        false_positives += filter.exists((i * 2U) + 1U) ? 1U : 0U;
+      }
+
+      CHECK(false_positives > 0U);
+      CHECK(false_positives < 4000U);
+    }
+
+    //*************************************************************************
+    TEST(test_remove)
+    {
+      typedef etl::cuckoo_filter<1000, integer_hash_t> Filter;
+
+      Filter filter;
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        filter.add(i);
+      }
+
+      for (uint32_t i = 0U; i < 1000U; i += 2U)
+      {
+        CHECK(filter.remove(i));
+      }
+
+      CHECK_EQUAL(500U, filter.size());
+
+      // The remaining keys are still found.
+      size_t found = 0U;
+
+      for (uint32_t i = 1U; i < 1000U; i += 2U)
+      {
+        found += filter.exists(i) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(500U, found);
+
+      for (uint32_t i = 1U; i < 1000U; i += 2U)
+      {
+        CHECK(filter.remove(i));
+      }
+
+      CHECK(filter.empty());
+      CHECK(!filter.remove(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_add_twice_remove_twice)
+    {
+      etl::cuckoo_filter<16, text_hash_t> filter;
+
+      filter.add("rain");
+      filter.add("rain");
+      CHECK_EQUAL(2U, filter.size());
+
+      CHECK(filter.remove("rain"));
+      CHECK(filter.exists("rain"));
+      CHECK(filter.remove("rain"));
+      CHECK(!filter.exists("rain"));
+      CHECK(!filter.remove("rain"));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      typedef etl::cuckoo_filter<64, integer_hash_t> Filter;
+
+      Filter filter;
+
+      uint32_t added = 0U;
+
+      while (filter.add(added))
+      {
+        ++added;
+      }
+
+      CHECK(filter.full());
+      CHECK_EQUAL(added, filter.size());
+      CHECK(added >= 64U);
+      CHECK(added <= filter.capacity());
+
+      // Every key that was added, including the one kept aside, is found.
+      size_t found = 0U;
+
+      for (uint32_t i = 0U; i < added; ++i)
+      {
+        found += filter.exists(i) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(added, found);
+
+      // Removing a key makes room again.
+      CHECK(filter.remove(0U));
+      CHECK(!filter.full());
+
+      found = 0U;
+
+      for (uint32_t i = 1U; i < added; ++i)
+      {
+        found += filter.exists(i) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(added - 1U, found);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::cuckoo_filter<16, text_hash_t> filter;
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(exist_text); ++i)
+      {
+        filter.add(exist_text[i]);
+      }
+
+      filter.clear();
+
+      CHECK(filter.empty());
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(exist_text); ++i)
+      {
+        CHECK(!filter.exists(exist_text[i]));
+      }
+    }
+  };
+}
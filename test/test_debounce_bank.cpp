@@ -0,0 +1,174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <stdint.h>
+
+#include "etl/debounce_bank.h"
+#include "etl/debounce.h"
+#include "etl/random.h"
+
+namespace
+{
+  //***************************************************************************
+  // Runs the bank against one etl::debounce per line, with samples that
+  // bounce on some ticks and stay stable for long runs on others.
+  //***************************************************************************
+  template <const size_t N, const uint16_t VALID_COUNT, const uint16_t HOLD_COUNT>
+  bool compare_with_debounce(uint64_t initial_state)
+  {
+    typedef etl::debounce_bank<N, VALID_COUNT, HOLD_COUNT> Bank;
+    typedef typename Bank::mask_type mask_type;
+
+    Bank bank(static_cast<mask_type>(initial_state));
+    etl::debounce<VALID_COUNT, HOLD_COUNT, 0> lines[N];
+
+    for (size_t line = 0; line < N; ++line)
+    {
+      lines[line] = etl::debounce<VALID_COUNT, HOLD_COUNT, 0>(((initial_state >> line) & 1U) != 0);
+    }
+
+    etl::random_xoshiro256 random(N);
+
+    mask_type sample = 0;
+
+    for (int tick = 0; tick < 20000; ++tick)
+    {
+      // Flip a few lines on each tick, fewer on quiet ticks.
+      mask_type flips = mask_type(random() & random());
+
+      if ((tick / 100) % 2 == 0)
+      {
+        flips &= mask_type(random());
+        flips &= mask_type(random());
+      }
+
+      sample ^= flips;
+
+      mask_type changed = bank.add(sample);
+
+      if (changed != bank.changed())
+      {
+        return false;
+      }
+
+      for (size_t line = 0; line < N; ++line)
+      {
+        const mask_type bit = mask_type(mask_type(1) << line);
+
+        const bool was_held = lines[line].is_held();
+        const bool change   = lines[line].add((sample & bit) != 0);
+        const bool now_held = lines[line].is_held();
+
+        const bool bank_set     = (bank.state() & bit) != 0;
+        const bool bank_changed = (bank.changed() & bit) != 0;
+        const bool bank_held    = (bank.held() & bit) != 0;
+        const bool bank_newly   = (bank.newly_held() & bit) != 0;
+
+        if ((lines[line].is_set() != bank_set) ||
+            (now_held != bank_held) ||
+            ((!was_held && now_held) != bank_newly) ||
+            ((change && !(!was_held && now_held)) != bank_changed))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_debounce_bank)
+  {
+    //*************************************************************************
+    TEST(test_basic)
+    {
+      etl::debounce_bank<8, 3, 5> bank;
+
+      CHECK_EQUAL(0U, bank.state());
+
+      // Bounce on line 0.
+      bank.add(0x01);
+      bank.add(0x00);
+      bank.add(0x01);
+      bank.add(0x01);
+      CHECK_EQUAL(0U, bank.state());
+
+      CHECK_EQUAL(0x01U, bank.add(0x01));
+      CHECK_EQUAL(0x01U, bank.state());
+      CHECK_EQUAL(0x01U, bank.pressed());
+      CHECK_EQUAL(0x00U, bank.released());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(0U, bank.add(0x01));
+        CHECK_EQUAL(0U, bank.held());
+      }
+
+      bank.add(0x01);
+      CHECK_EQUAL(0x01U, bank.held());
+      CHECK_EQUAL(0x01U, bank.newly_held());
+
+      bank.add(0x01);
+      CHECK_EQUAL(0x01U, bank.held());
+      CHECK_EQUAL(0x00U, bank.newly_held());
+
+      bank.add(0x00);
+      bank.add(0x00);
+      CHECK_EQUAL(0x01U, bank.add(0x00));
+      CHECK_EQUAL(0x01U, bank.released());
+      CHECK_EQUAL(0x00U, bank.state());
+      CHECK_EQUAL(0x00U, bank.held());
+    }
+
+    //*************************************************************************
+    TEST(test_initial_state_and_unused_lines)
+    {
+      etl::debounce_bank<4, 2> bank(0xFF);
+
+      CHECK_EQUAL(0x0FU, bank.state());
+
+      bank.add(0xF0);
+      CHECK_EQUAL(0x0FU, bank.add(0xF0));
+      CHECK_EQUAL(0x00U, bank.state());
+    }
+
+    //*************************************************************************
+    TEST(test_matches_debounce)
+    {
+      CHECK((compare_with_debounce<8,  1, 0>(0x00)));
+      CHECK((compare_with_debounce<13, 3, 7>(0x1234)));
+      CHECK((compare_with_debounce<32, 4, 1>(0xFFFF0000)));
+      CHECK((compare_with_debounce<64, 5, 20>(0x0123456789ABCDEFULL)));
+      CHECK((compare_with_debounce<64, 8, 0>(0)));
+    }
+  };
+}
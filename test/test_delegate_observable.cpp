@@ -0,0 +1,205 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/delegate_observable.h"
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  //***************************************************************************
+  class Observable : public etl::delegate_observable<void(int, int&), 4>
+  {
+  };
+
+  //***************************************************************************
+  struct Observer
+  {
+    Observer()
+      : total(0)
+      , calls(0)
+    {
+    }
+
+    void notification(int value, int& calls_made)
+    {
+      total += value;
+      ++calls;
+      ++calls_made;
+    }
+
+    int total;
+    int calls;
+  };
+
+  typedef Observable::delegate_type delegate_type;
+
+  SUITE(test_delegate_observable)
+  {
+    //*************************************************************************
+    TEST(test_notify)
+    {
+      Observable observable;
+      Observer observer1;
+      Observer observer2;
+
+      delegate_type d1 = delegate_type::create<Observer, &Observer::notification>(observer1);
+      delegate_type d2 = delegate_type::create<Observer, &Observer::notification>(observer2);
+
+      int calls_made = 0;
+      observable.notify_observers(1, calls_made);
+      CHECK_EQUAL(0, calls_made);
+
+      observable.add_observer(d1);
+      observable.notify_observers(1, calls_made);
+      CHECK_EQUAL(1, calls_made);
+
+      observable.add_observer(d2);
+      observable.notify_observers(2, calls_made);
+      CHECK_EQUAL(3, calls_made);
+
+      CHECK_EQUAL(3, observer1.total);
+      CHECK_EQUAL(2, observer2.total);
+    }
+
+    //*************************************************************************
+    TEST(test_add_remove_clear)
+    {
+      Observable observable;
+      Observer observer1;
+      Observer observer2;
+
+      delegate_type d1 = delegate_type::create<Observer, &Observer::notification>(observer1);
+      delegate_type d2 = delegate_type::create<Observer, &Observer::notification>(observer2);
+
+      observable.add_observer(d1);
+      observable.add_observer(d1);
+      CHECK_EQUAL(1U, observable.number_of_observers());
+
+      observable.add_observer(d2);
+      CHECK_EQUAL(2U, observable.number_of_observers());
+
+      CHECK(observable.remove_observer(d1));
+      CHECK(!observable.remove_observer(d1));
+      CHECK_EQUAL(1U, observable.number_of_observers());
+
+      int calls_made = 0;
+      observable.notify_observers(5, calls_made);
+      CHECK_EQUAL(0, observer1.calls);
+      CHECK_EQUAL(1, observer2.calls);
+
+      observable.clear_observers();
+      CHECK_EQUAL(0U, observable.number_of_observers());
+
+      observable.notify_observers(5, calls_made);
+      CHECK_EQUAL(1, calls_made);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Observable observable;
+      Observer observers[5];
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        observable.add_observer(delegate_type::create<Observer, &Observer::notification>(observers[i]));
+      }
+
+      CHECK_THROW(observable.add_observer(delegate_type::create<Observer, &Observer::notification>(observers[4])), etl::observer_list_full);
+
+      // Still usable after the error.
+      CHECK(observable.remove_observer(delegate_type::create<Observer, &Observer::notification>(observers[0])));
+      observable.add_observer(delegate_type::create<Observer, &Observer::notification>(observers[4]));
+      CHECK_EQUAL(4U, observable.number_of_observers());
+    }
+
+    //*************************************************************************
+    TEST(test_lambda_observer)
+    {
+      Observable observable;
+
+      int sum = 0;
+      auto lambda = [&sum](int value, int&) { sum += value; };
+
+      observable.add_observer(delegate_type(lambda));
+      observable.notify_observers(7, sum);
+
+      CHECK_EQUAL(7, sum);
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_subscribe_while_notifying)
+    {
+      static Observable observable;
+      static Observer   stable;
+      static Observer   transient[3];
+
+      observable.add_observer(delegate_type::create<Observer, &Observer::notification>(stable));
+
+      std::atomic<bool> stop(false);
+
+      std::thread notifier([&stop]()
+      {
+        int calls_made = 0;
+
+        while (!stop.load())
+        {
+          observable.notify_observers(1, calls_made);
+        }
+      });
+
+      std::thread subscriber([]()
+      {
+        for (int i = 0; i < 100000; ++i)
+        {
+          delegate_type d = delegate_type::create<Observer, &Observer::notification>(transient[i % 3]);
+          observable.add_observer(d);
+          observable.remove_observer(d);
+        }
+      });
+
+      subscriber.join();
+      stop.store(true);
+      notifier.join();
+
+      CHECK_EQUAL(1U, observable.number_of_observers());
+      CHECK(stable.calls > 0);
+      CHECK_EQUAL(stable.calls, stable.total);
+    }
+#endif
+  };
+}
@@ -102,6 +102,16 @@ namespace
   // Callback for 'unhandled'.
   etl::delegate<void(size_t)> unhandled_callback = etl::delegate<void(size_t)>::create<unhandled>();
 
+  //*****************************************************************************
+  // A static wrapper for 'member2', for the compile time service.
+  //*****************************************************************************
+  void static_member2(size_t id)
+  {
+    test.member2(id);
+  }
+
+  using StaticService = etl::static_delegate_service<OFFSET, unhandled, global, unhandled, static_member2>;
+
   //*****************************************************************************
   // Initialises the test results.
   //*****************************************************************************
@@ -329,5 +339,58 @@ namespace
       CHECK(!member2_called);
       CHECK(unhandled_called);
     }
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_static_delegate_service_compile_time)
+    {
+      CHECK_EQUAL(SIZE, StaticService::RANGE);
+
+      StaticService::call<GLOBAL>();
+
+      CHECK_EQUAL(GLOBAL, called_id);
+      CHECK(global_called);
+      CHECK(!member2_called);
+
+      StaticService::call<MEMBER2>();
+
+      CHECK_EQUAL(MEMBER2, called_id);
+      CHECK(member2_called);
+      CHECK(!unhandled_called);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_static_delegate_service_run_time)
+    {
+      StaticService::call(GLOBAL);
+
+      CHECK_EQUAL(GLOBAL, called_id);
+      CHECK(global_called);
+
+      StaticService::call(MEMBER1);
+
+      CHECK_EQUAL(MEMBER1, called_id);
+      CHECK(unhandled_called);
+
+      unhandled_called = false;
+
+      StaticService::call(OUT_OF_RANGE);
+
+      CHECK_EQUAL(OUT_OF_RANGE, called_id);
+      CHECK(unhandled_called);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_static_delegate_service_vector)
+    {
+      // The vectors are plain functions that can go in an interrupt vector table.
+      void (*vectors[])() = { StaticService::vector<GLOBAL>, StaticService::vector<MEMBER2> };
+
+      vectors[0]();
+      CHECK(global_called);
+      CHECK_EQUAL(GLOBAL, called_id);
+
+      vectors[1]();
+      CHECK(member2_called);
+      CHECK_EQUAL(MEMBER2, called_id);
+    }
   };
 }
@@ -1885,5 +1885,160 @@ namespace
       CHECK(data2.empty());
       CHECK_EQUAL(ACTUAL_SIZE, data3.size());
     }
+    //*************************************************************************
+    TEST(test_insert_range_into_empty_at_begin)
+    {
+      DataNDC data;
+      std::vector<NDC> values = { N1, N2, N3 };
+
+      data.insert(data.begin(), values.begin(), values.end());
+
+      CHECK_EQUAL(values.size(), data.size());
+      CHECK(std::equal(values.begin(), values.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_two_buffer_wrapping)
+    {
+      // A buffer of 16 elements, so indexes are masked.
+      typedef etl::deque<int, 15> DataInt15;
+      typedef std::deque<int>     Compare_DataInt;
+
+      DataInt15 data;
+      Compare_DataInt compare_data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        if (data.full())
+        {
+          data.pop_front();
+          compare_data.pop_front();
+        }
+
+        if ((i % 3) == 0)
+        {
+          data.push_front(i);
+          compare_data.push_front(i);
+        }
+        else
+        {
+          data.push_back(i);
+          compare_data.push_back(i);
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        CHECK(std::equal(compare_data.rbegin(), compare_data.rend(), data.rbegin()));
+
+        for (size_t j = 0U; j < data.size(); ++j)
+        {
+          CHECK_EQUAL(compare_data[j], data[j]);
+          CHECK_EQUAL(int(j), std::distance(data.begin(), data.begin() + j));
+          CHECK_EQUAL(compare_data[j], *(data.end() - (data.size() - j)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_insert_and_assign_trivially_copyable)
+    {
+      typedef std::deque<int> Compare_DataInt;
+
+      const int values[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+      // Move the start of the buffer so that the copies wrap.
+      for (size_t offset = 0U; offset < SIZE; ++offset)
+      {
+        DataInt data;
+        Compare_DataInt compare_data;
+
+        for (size_t i = 0U; i < offset; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        data.push_back(100);
+        compare_data.push_back(100);
+
+        data.insert(data.end(), values, values + 6);
+        compare_data.insert(compare_data.end(), values, values + 6);
+
+        data.insert(data.begin(), values + 6, values + 10);
+        compare_data.insert(compare_data.begin(), values + 6, values + 10);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        data.assign(values, values + 10);
+        CHECK_EQUAL(10U, data.size());
+        CHECK(std::equal(values, values + 10, data.begin()));
+      }
+
+      const int too_many[SIZE + 1] = { 0 };
+      DataInt data;
+      CHECK_THROW(data.assign(too_many, too_many + SIZE + 1), etl::deque_full);
+    }
+
+    //*************************************************************************
+    TEST(test_unchecked)
+    {
+      DataInt data;
+
+      CHECK(data.reserve_check(3U));
+      data.push_back_unchecked(1);
+      data.emplace_back_unchecked(2);
+      data.push_back_unchecked(3);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data[0]);
+      CHECK_EQUAL(2, data[1]);
+      CHECK_EQUAL(3, data[2]);
+
+      CHECK(data.reserve_check(SIZE - 3U));
+      CHECK_THROW(data.reserve_check(SIZE - 2U), etl::deque_full);
+    }
+
+
+    //*************************************************************************
+    TEST(test_deque_ext)
+    {
+      typedef etl::deque_ext<std::string> Data;
+
+      static const size_t MAX = 4U;
+
+      etl::aligned_storage<(MAX + 1U) * sizeof(std::string), etl::alignment_of<std::string>::value>::type buffer;
+      CHECK_EQUAL(sizeof(buffer), Data::buffer_size(MAX));
+
+      Data data(&buffer, MAX);
+      etl::ideque<std::string>& idata = data;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+      CHECK(idata.empty());
+
+      idata.push_back("2");
+      idata.push_front("1");
+      idata.push_back("3");
+      idata.push_back("4");
+      CHECK(idata.full());
+      CHECK_THROW(idata.push_back("5"), etl::deque_full);
+
+      idata.pop_front();
+      idata.push_back("5");
+
+      std::vector<std::string> expected = { "2", "3", "4", "5" };
+      CHECK(std::equal(expected.begin(), expected.end(), idata.begin()));
+
+      // The elements are in the supplied buffer.
+      CHECK(reinterpret_cast<char*>(&idata.front()) >= reinterpret_cast<char*>(&buffer));
+      CHECK(reinterpret_cast<char*>(&idata.front()) <  reinterpret_cast<char*>(&buffer) + sizeof(buffer));
+
+      etl::aligned_storage<(MAX + 1U) * sizeof(std::string), etl::alignment_of<std::string>::value>::type buffer2;
+      Data data2(expected.begin(), expected.begin() + 2, &buffer2, MAX);
+      CHECK_EQUAL(2U, data2.size());
+
+      data2 = data;
+      CHECK(std::equal(expected.begin(), expected.end(), data2.begin()));
+    }
   };
 }
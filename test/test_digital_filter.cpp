@@ -0,0 +1,263 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/digital_filter.h"
+
+#include <math.h>
+
+namespace
+{
+  typedef etl::fixed_point<0, 15> q15;
+  typedef etl::fixed_point<1, 14> q14;
+
+  SUITE(test_digital_filter)
+  {
+    //*************************************************************************
+    TEST(test_fir_impulse_response)
+    {
+      const float h[] = { 0.5f, 0.25f, 0.125f, 0.0625f };
+
+      etl::fir_filter<float, 4> filter(h);
+
+      CHECK_EQUAL(3U, (etl::fir_filter<float, 4>::ORDER));
+      CHECK_EQUAL(0.5f,    filter.process(1.0f));
+      CHECK_EQUAL(0.25f,   filter.process(0.0f));
+      CHECK_EQUAL(0.125f,  filter.process(0.0f));
+      CHECK_EQUAL(0.0625f, filter.process(0.0f));
+      CHECK_EQUAL(0.0f,    filter.process(0.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_fir_matches_direct_convolution)
+    {
+      const double h[] = { 0.1, -0.2, 0.3, 0.4, -0.5 };
+
+      double x[40];
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        x[i] = sin(double(i) * 0.7) + (double(i % 3U) * 0.25);
+      }
+
+      etl::fir_filter<double, 5> filter(h);
+
+      for (size_t n = 0U; n < 40U; ++n)
+      {
+        double expected = 0.0;
+
+        for (size_t k = 0U; (k < 5U) && (k <= n); ++k)
+        {
+          expected += h[k] * x[n - k];
+        }
+
+        CHECK_CLOSE(expected, filter.process(x[n]), 1e-12);
+      }
+
+      filter.reset();
+      CHECK_EQUAL(0.1, filter.process(1.0));
+    }
+
+    //*************************************************************************
+    TEST(test_fir_block_and_circular_buffer)
+    {
+      const float h[] = { 1.0f, 2.0f, 3.0f };
+
+      etl::fir_filter<float, 3> reference(h);
+      etl::fir_filter<float, 3> filter(h);
+
+      // Wrap the buffer so that the contents are in two segments.
+      etl::circular_buffer<float, 8> buffer;
+
+      for (int i = 0; i < 13; ++i)
+      {
+        buffer.push(float(i));
+      }
+
+      CHECK(buffer.array_two().size() != 0U);
+
+      float output[10];
+      size_t n = filter.process(buffer, etl::array_view<float>(output, 10U));
+
+      CHECK_EQUAL(8U, n);
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(reference.process(buffer[i]), output[i]);
+      }
+
+      // Output shorter than input.
+      filter.reset();
+      reference.reset();
+
+      n = filter.process(buffer, etl::array_view<float>(output, 5U));
+      CHECK_EQUAL(5U, n);
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(reference.process(buffer[i]), output[i]);
+      }
+
+      // In place block.
+      float block[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+      filter.reset();
+      n = filter.process(etl::array_view<const float>(block, 4U), etl::array_view<float>(block, 4U));
+      CHECK_EQUAL(4U, n);
+      CHECK_EQUAL(1.0f, block[0]);
+      CHECK_EQUAL(2.0f, block[1]);
+      CHECK_EQUAL(3.0f, block[2]);
+      CHECK_EQUAL(0.0f, block[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_fir_fixed_point)
+    {
+      const q15 h[] = { q15(0.5), q15(0.25), q15(0.25) };
+
+      etl::fir_filter<q15, 3> filter(h);
+
+      CHECK_EQUAL(q15(0.25).raw(),  filter.process(q15(0.5)).raw());
+      CHECK_EQUAL(q15(0.375).raw(), filter.process(q15(0.5)).raw());
+      CHECK_EQUAL(q15(0.5).raw(),   filter.process(q15(0.5)).raw());
+
+      // Saturates rather than wrapping.
+      const q15 g[] = { q15::max(), q15::max(), q15::max() };
+      etl::fir_filter<q15, 3> gain(g);
+
+      gain.process(q15::max());
+      gain.process(q15::max());
+      CHECK_EQUAL(q15::max().raw(), gain.process(q15::max()).raw());
+
+      gain.process(q15::min());
+      gain.process(q15::min());
+      CHECK_EQUAL(q15::min().raw(), gain.process(q15::min()).raw());
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_matches_difference_equation)
+    {
+      // Second order low pass.
+      etl::biquad_coefficients<double> c = { 0.0675, 0.1349, 0.0675, -1.1430, 0.4128 };
+
+      etl::biquad_filter<double> filter(&c);
+
+      CHECK_EQUAL(2U, (etl::biquad_filter<double>::ORDER));
+
+      double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+      for (int n = 0; n < 50; ++n)
+      {
+        const double x = (n % 7) < 3 ? 1.0 : -0.5;
+        const double y = (c.b0 * x) + (c.b1 * x1) + (c.b2 * x2) - (c.a1 * y1) - (c.a2 * y2);
+
+        x2 = x1; x1 = x;
+        y2 = y1; y1 = y;
+
+        CHECK_CLOSE(y, filter.process(x), 1e-12);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_cascade)
+    {
+      etl::biquad_coefficients<float> c[2] = { { 0.5f, 0.0f, 0.0f, -0.5f, 0.0f },
+                                               { 2.0f, 1.0f, 0.0f, 0.0f,  0.0f } };
+
+      etl::biquad_filter<float, 2> cascade(c);
+      etl::biquad_filter<float>    first(&c[0]);
+      etl::biquad_filter<float>    second(&c[1]);
+
+      CHECK_EQUAL(4U, (etl::biquad_filter<float, 2>::ORDER));
+
+      for (int n = 0; n < 20; ++n)
+      {
+        const float x = (n == 0) ? 1.0f : 0.0f;
+        CHECK_EQUAL(second.process(first.process(x)), cascade.process(x));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_fixed_point_with_wider_coefficients)
+    {
+      // Coefficients with magnitudes above 1 need integral bits.
+      const double b0 = 0.0675, b1 = 0.1349, b2 = 0.0675, a1 = -1.1430, a2 = 0.4128;
+
+      etl::biquad_coefficients<q14> c = { q14(b0), q14(b1), q14(b2), q14(a1), q14(a2) };
+      etl::biquad_coefficients<double> cd = { c.b0.to_double(), c.b1.to_double(), c.b2.to_double(), c.a1.to_double(), c.a2.to_double() };
+
+      etl::biquad_filter<q15, 1, q14> filter(&c);
+      etl::biquad_filter<double>      reference(&cd);
+
+      for (int n = 0; n < 100; ++n)
+      {
+        const q15 x = ((n % 16) < 8) ? q15(0.5) : q15(-0.5);
+
+        CHECK_CLOSE(reference.process(x.to_double()), filter.process(x).to_double(), 0.002);
+      }
+
+      // Step response settles at the DC gain.
+      filter.reset();
+
+      q15 y;
+
+      for (int n = 0; n < 200; ++n)
+      {
+        y = filter.process(q15(0.25));
+      }
+
+      const double dc_gain = (b0 + b1 + b2) / (1.0 + a1 + a2);
+      CHECK_CLOSE(0.25 * dc_gain, y.to_double(), 0.002);
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_circular_buffer)
+    {
+      etl::biquad_coefficients<float> c = { 0.25f, 0.5f, 0.25f, -0.5f, 0.125f };
+
+      etl::biquad_filter<float> filter(&c);
+      etl::biquad_filter<float> reference(&c);
+
+      etl::circular_buffer<float, 5> buffer;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        buffer.push(float(i) - 3.0f);
+      }
+
+      float output[5];
+      CHECK_EQUAL(5U, filter.process(buffer, etl::array_view<float>(output, 5U)));
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(reference.process(buffer[i]), output[i]);
+      }
+    }
+  }
+}
@@ -0,0 +1,159 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/double_buffer.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Every element of a frame holds the frame number, so a torn frame shows as a mismatch.
+  struct Frame
+  {
+    uint32_t values[16];
+  };
+
+  const uint32_t FRAMES = 5000U;
+
+  etl::double_buffer<Frame> frames;
+  std::atomic<bool>         done;
+  std::atomic<int>          mismatches;
+  std::atomic<uint32_t>     last_frame;
+
+  void producer()
+  {
+    for (uint32_t f = 1U; f <= FRAMES; ++f)
+    {
+      Frame& frame = frames.back();
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        frame.values[i] = f;
+      }
+
+      while (!frames.publish())
+      {
+      }
+    }
+
+    done = true;
+  }
+
+  void consumer()
+  {
+    uint32_t previous = 0U;
+
+    while (!done || frames.fresh())
+    {
+      const Frame* p_frame = frames.acquire();
+
+      if (p_frame != nullptr)
+      {
+        for (size_t i = 1U; i < 16U; ++i)
+        {
+          if (p_frame->values[i] != p_frame->values[0])
+          {
+            ++mismatches;
+          }
+        }
+
+        // Frames arrive in order.
+        if (p_frame->values[0] <= previous)
+        {
+          ++mismatches;
+        }
+
+        previous = p_frame->values[0];
+        frames.release();
+      }
+    }
+
+    last_frame = previous;
+  }
+
+  SUITE(test_double_buffer)
+  {
+    //*************************************************************************
+    TEST(test_publish_acquire)
+    {
+      etl::double_buffer<int> buffer;
+
+      CHECK(!buffer.fresh());
+      CHECK(buffer.acquire() == nullptr);
+
+      buffer.back() = 1;
+      CHECK(buffer.publish());
+      CHECK(buffer.fresh());
+
+      const int* p = buffer.acquire();
+      CHECK(p != nullptr);
+      CHECK_EQUAL(1, *p);
+      CHECK(!buffer.fresh());
+
+      // Can't publish while the consumer is reading.
+      buffer.back() = 2;
+      CHECK(!buffer.publish());
+      CHECK_EQUAL(1, *p);
+      buffer.release();
+
+      CHECK(buffer.acquire() == nullptr);
+      CHECK(buffer.publish());
+
+      p = buffer.acquire();
+      CHECK(p != nullptr);
+      CHECK_EQUAL(2, *p);
+      buffer.release();
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      done       = false;
+      mismatches = 0;
+      last_frame = 0U;
+
+      std::thread t1(consumer);
+      std::thread t2(producer);
+
+      t2.join();
+      t1.join();
+
+      CHECK_EQUAL(0, mismatches.load());
+      CHECK_EQUAL(FRAMES, last_frame.load());
+    }
+  };
+}
+
+#endif
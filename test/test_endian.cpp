@@ -31,6 +31,9 @@ SOFTWARE.
 
 #include "etl/endianness.h"
 
+#include <stdint.h>
+#include <string.h>
+
 namespace 
 {		
   SUITE(test_endian)
@@ -45,5 +48,94 @@ namespace
       CHECK(etl::endianness::value() == etl::endian::little);
       CHECK(etl::endianness::value() != etl::endian::big);
     }
+
+    //*************************************************************************
+    TEST(test_byteswap_range)
+    {
+      uint16_t data16[5] = { 0x0102, 0x0304, 0x0506, 0x0708, 0x090A };
+      uint32_t data32[3] = { 0x01020304, 0x05060708, 0x090A0B0C };
+      uint64_t data64[2] = { 0x0102030405060708ULL, 0x090A0B0C0D0E0F10ULL };
+
+      etl::byteswap_range(data16, data16 + 5);
+      CHECK_EQUAL(0x0201, data16[0]);
+      CHECK_EQUAL(0x0A09, data16[4]);
+
+      etl::byteswap_range(etl::array_view<uint32_t>(data32, data32 + 3));
+      CHECK_EQUAL(0x04030201U, data32[0]);
+      CHECK_EQUAL(0x0C0B0A09U, data32[2]);
+
+      uint64_t result64[2];
+      etl::byteswap_range(data64, data64 + 2, result64);
+      CHECK(result64[0] == 0x0807060504030201ULL);
+      CHECK(result64[1] == 0x100F0E0D0C0B0A09ULL);
+    }
+
+    //*************************************************************************
+    TEST(test_hton_ntoh_range)
+    {
+      uint32_t data[33];
+      uint32_t network[33];
+
+      for (uint32_t i = 0U; i < 33U; ++i)
+      {
+        data[i] = 0x01020304U * (i + 1U);
+      }
+
+      etl::hton_range(data, data + 33, network);
+
+      for (size_t i = 0U; i < 33U; ++i)
+      {
+        CHECK_EQUAL(etl::hton(data[i]), network[i]);
+      }
+
+      etl::ntoh_range(etl::array_view<uint32_t>(network, network + 33));
+
+      CHECK(memcmp(data, network, sizeof(data)) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_endian_integer)
+    {
+      etl::be_uint32_t be32(0x01020304U);
+      etl::le_uint32_t le32(0x01020304U);
+      etl::be_int16_t  be16 = int16_t(-2);
+
+      CHECK_EQUAL(0x01, be32.data()[0]);
+      CHECK_EQUAL(0x04, be32.data()[3]);
+      CHECK_EQUAL(0x04, le32.data()[0]);
+      CHECK_EQUAL(0x01, le32.data()[3]);
+      CHECK_EQUAL(0xFF, be16.data()[0]);
+      CHECK_EQUAL(0xFE, be16.data()[1]);
+
+      CHECK_EQUAL(0x01020304U, uint32_t(be32));
+      CHECK_EQUAL(0x01020304U, le32.value());
+      CHECK_EQUAL(-2, be16);
+
+      be32 = 0xAABBCCDDU;
+      CHECK_EQUAL(0xAA, be32.data()[0]);
+      CHECK_EQUAL(0xAABBCCDDU, be32.value());
+    }
+
+    //*************************************************************************
+    TEST(test_endian_integer_overlay)
+    {
+      struct header
+      {
+        uint8_t          type;
+        etl::be_uint16_t length;
+        etl::be_uint32_t sequence;
+      };
+
+      CHECK_EQUAL(7U, sizeof(header));
+
+      const unsigned char buffer[] = { 0x05, 0x12, 0x34, 0xDE, 0xAD, 0xBE, 0xEF };
+
+      header h;
+      memcpy(&h, buffer, sizeof(h));
+
+      CHECK_EQUAL(5, h.type);
+      CHECK_EQUAL(0x1234, h.length);
+      CHECK_EQUAL(0xDEADBEEFU, h.sequence);
+    }
   };
 }
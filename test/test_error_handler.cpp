@@ -35,6 +35,7 @@ SOFTWARE.
 #include "etl/exception.h"
 
 bool error_received;
+int  exceptions_constructed;
 
 //*****************************************************************************
 // An exception.
@@ -47,6 +48,7 @@ public:
     : exception(ETL_ERROR_TEXT("test_exception", "123"), file_name_, line_number_)
   {
     error_received = false;
+    ++exceptions_constructed;
   }
 };
 
@@ -74,6 +76,16 @@ public:
   }
 };
 
+//*****************************************************************************
+// An assert callback function.
+//*****************************************************************************
+int assert_line;
+
+void receive_assert(const char*, int line)
+{
+  assert_line = line;
+}
+
 namespace
 {
   SUITE(test_error_handler)
@@ -110,5 +122,82 @@ namespace
 
       CHECK(error_received);
     }
+
+    //*************************************************************************
+    TEST(test_assert_level_none)
+    {
+      exceptions_constructed = 0;
+      etl::error_handler::clear_assert_failures();
+
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_NONE, false, ETL_ERROR(test_exception));
+      ETL_ALWAYS_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_NONE, ETL_ERROR(test_exception));
+
+      CHECK_EQUAL(0U, etl::error_handler::assert_failures());
+      CHECK_EQUAL(0, exceptions_constructed);
+    }
+
+    //*************************************************************************
+    TEST(test_assert_level_count)
+    {
+      exceptions_constructed = 0;
+      etl::error_handler::clear_assert_failures();
+
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_COUNT, true, ETL_ERROR(test_exception));
+      CHECK_EQUAL(0U, etl::error_handler::assert_failures());
+
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_COUNT, false, ETL_ERROR(test_exception));
+      ETL_ALWAYS_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_COUNT, ETL_ERROR(test_exception));
+      CHECK_EQUAL(2U, etl::error_handler::assert_failures());
+      CHECK_EQUAL(0, exceptions_constructed);
+
+      etl::error_handler::clear_assert_failures();
+      CHECK_EQUAL(0U, etl::error_handler::assert_failures());
+    }
+
+    //*************************************************************************
+    TEST(test_assert_level_callback)
+    {
+      exceptions_constructed = 0;
+      assert_line = 0;
+      etl::error_handler::clear_assert_failures();
+
+      // Counted without a callback.
+      etl::error_handler::set_assert_callback(nullptr);
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_CALLBACK, false, ETL_ERROR(test_exception));
+      CHECK_EQUAL(1U, etl::error_handler::assert_failures());
+
+      etl::error_handler::set_assert_callback(receive_assert);
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_CALLBACK, true, ETL_ERROR(test_exception));
+      CHECK_EQUAL(0, assert_line);
+
+      const int line = __LINE__ + 1;
+      ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_CALLBACK, false, ETL_ERROR(test_exception));
+      CHECK_EQUAL(line, assert_line);
+      CHECK_EQUAL(2U, etl::error_handler::assert_failures());
+      CHECK_EQUAL(0, exceptions_constructed);
+
+      etl::error_handler::set_assert_callback(nullptr);
+      etl::error_handler::clear_assert_failures();
+    }
+
+    //*************************************************************************
+    TEST(test_assert_level_error)
+    {
+      exceptions_constructed = 0;
+
+      CHECK_NO_THROW(ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_ERROR, true, ETL_ERROR(test_exception)));
+      CHECK_EQUAL(0, exceptions_constructed);
+
+      CHECK_THROW(ETL_ASSERT_AT_LEVEL(ETL_ASSERT_LEVEL_ERROR, false, ETL_ERROR(test_exception)), test_exception);
+      CHECK_EQUAL(1, exceptions_constructed);
+    }
+
+    //*************************************************************************
+    TEST(test_assert_default_level)
+    {
+      CHECK_EQUAL(ETL_ASSERT_LEVEL_ERROR, ETL_ASSERT_LEVEL);
+      CHECK_EQUAL(ETL_ASSERT_LEVEL, ETL_CONTAINER_ASSERT_LEVEL);
+      CHECK_THROW(ETL_ASSERT(false, ETL_ERROR(test_exception)), test_exception);
+    }
   };
 }
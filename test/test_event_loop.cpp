@@ -0,0 +1,293 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <vector>
+
+#include "etl/event_loop.h"
+#include "etl/callback_timer.h"
+#include "etl/callback_timer_wheel.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/function.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::event_loop<4, 2> EventLoop;
+
+  std::vector<int> calls;
+
+  //***************************************************************************
+  struct Handler
+  {
+    Handler(int id_)
+      : id(id_)
+    {
+    }
+
+    void handle()
+    {
+      calls.push_back(id);
+    }
+
+    int id;
+  };
+
+  //***************************************************************************
+  struct QueueHandler
+  {
+    QueueHandler(etl::iqueue_spsc_atomic<int>& queue_)
+      : queue(queue_)
+    {
+    }
+
+    void handle()
+    {
+      int value;
+
+      // Take one at a time, to check that the handler is called again.
+      if (queue.pop(value))
+      {
+        calls.push_back(value);
+      }
+    }
+
+    etl::iqueue_spsc_atomic<int>& queue;
+  };
+
+  //***************************************************************************
+  /// Records the sleep requests and simulates the time passing.
+  struct Sleeper
+  {
+    Sleeper(EventLoop& loop_, etl::icallback_timer& timer_)
+      : loop(loop_)
+      , timer(timer_)
+    {
+    }
+
+    void sleep(uint32_t ticks)
+    {
+      requests.push_back(ticks);
+
+      if (ticks == etl::timer::state::INACTIVE)
+      {
+        loop.exit();
+      }
+      else
+      {
+        timer.tick_from_isr(ticks);
+      }
+    }
+
+    EventLoop&            loop;
+    etl::icallback_timer& timer;
+    std::vector<uint32_t> requests;
+  };
+
+  struct TimerCallback
+  {
+    TimerCallback(EventLoop& loop_, size_t index_)
+      : loop(loop_)
+      , index(index_)
+    {
+    }
+
+    void expired()
+    {
+      calls.push_back(100);
+      loop.set_event(index);
+    }
+
+    EventLoop& loop;
+    size_t     index;
+  };
+
+  SUITE(test_event_loop)
+  {
+    //*************************************************************************
+    TEST(test_priority_order)
+    {
+      calls.clear();
+
+      EventLoop loop;
+
+      Handler h0(0);
+      Handler h1(1);
+      Handler h2(2);
+
+      etl::function_mv<Handler, &Handler::handle> f0(h0);
+      etl::function_mv<Handler, &Handler::handle> f1(h1);
+      etl::function_mv<Handler, &Handler::handle> f2(h2);
+
+      CHECK_EQUAL(0U, loop.add_handler(f0));
+      CHECK_EQUAL(1U, loop.add_handler(f1));
+      CHECK_EQUAL(2U, loop.add_handler(f2));
+
+      CHECK(!loop.has_ready_handlers());
+      CHECK(!loop.run_once());
+
+      loop.set_event(2);
+      loop.set_event(0);
+      loop.set_event(1);
+      loop.set_event(7); // Ignored.
+
+      CHECK_EQUAL(0x07U, loop.get_ready_mask());
+
+      CHECK(loop.run_once());
+      CHECK(loop.run_once());
+      CHECK(loop.run_once());
+      CHECK(!loop.run_once());
+
+      CHECK_EQUAL(3U, calls.size());
+      CHECK_EQUAL(0, calls[0]);
+      CHECK_EQUAL(1, calls[1]);
+      CHECK_EQUAL(2, calls[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_queue_readiness)
+    {
+      calls.clear();
+
+      EventLoop loop;
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      QueueHandler qh(queue);
+      Handler      h1(1);
+
+      etl::function_mv<QueueHandler, &QueueHandler::handle> fq(qh);
+      etl::function_mv<Handler, &Handler::handle>           f1(h1);
+
+      loop.add_queue_handler(queue, fq);
+      loop.add_handler(f1);
+
+      queue.push(10);
+      queue.push(11);
+      loop.set_event(1);
+
+      // The queue handler has priority and stays ready until the queue is empty.
+      CHECK_EQUAL(0x03U, loop.get_ready_mask());
+      CHECK(loop.run_once());
+      CHECK(loop.run_once());
+      CHECK(loop.run_once());
+      CHECK(!loop.run_once());
+
+      CHECK_EQUAL(3U, calls.size());
+      CHECK_EQUAL(10, calls[0]);
+      CHECK_EQUAL(11, calls[1]);
+      CHECK_EQUAL(1,  calls[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_tickless_sleep)
+    {
+      calls.clear();
+
+      EventLoop loop;
+      etl::callback_timer<2> timer;
+
+      Handler h0(0);
+      etl::function_mv<Handler, &Handler::handle> f0(h0);
+      const size_t index = loop.add_handler(f0);
+
+      TimerCallback callback(loop, index);
+      etl::function_mv<TimerCallback, &TimerCallback::expired> timer_function(callback);
+
+      etl::timer::id::type id = timer.register_timer(timer_function, 25, etl::timer::mode::SINGLE_SHOT);
+      timer.enable(true);
+
+      loop.add_timer(timer);
+
+      Sleeper sleeper(loop, timer);
+      etl::function_mp<Sleeper, uint32_t, &Sleeper::sleep> sleep_function(sleeper);
+      loop.set_sleep_callback(sleep_function);
+
+      CHECK_EQUAL(etl::timer::state::INACTIVE, loop.time_to_next());
+
+      timer.start(id);
+      CHECK_EQUAL(25U, loop.time_to_next());
+
+      timer.tick_from_isr(5);
+      CHECK_EQUAL(20U, loop.time_to_next());
+
+      loop.run();
+
+      // Slept until the deadline, then ran the handler, then slept forever.
+      CHECK_EQUAL(2U, sleeper.requests.size());
+      CHECK_EQUAL(20U, sleeper.requests[0]);
+      CHECK_EQUAL(etl::timer::state::INACTIVE, sleeper.requests[1]);
+
+      CHECK_EQUAL(2U, calls.size());
+      CHECK_EQUAL(100, calls[0]);
+      CHECK_EQUAL(0,   calls[1]);
+      CHECK_EQUAL(25U, timer.time());
+    }
+
+    //*************************************************************************
+    TEST(test_timer_wheel_deadline)
+    {
+      EventLoop loop;
+      etl::callback_timer_wheel<2, 8> wheel;
+      etl::callback_timer<1> timer;
+
+      Handler h0(0);
+      etl::function_mv<Handler, &Handler::handle> f0(h0);
+
+      etl::timer::id::type id1 = wheel.register_timer(f0, 5, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id2 = wheel.register_timer(f0, 100, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id3 = timer.register_timer(f0, 3, etl::timer::mode::SINGLE_SHOT);
+      wheel.enable(true);
+      timer.enable(true);
+
+      loop.add_timer(wheel);
+      loop.add_timer(timer);
+
+      CHECK_EQUAL(etl::timer::state::INACTIVE, loop.time_to_next());
+
+      wheel.start(id2);
+
+      // Level 2 slots are 64 ticks wide, so 100 is cascaded at 64.
+      CHECK_EQUAL(64U, loop.time_to_next());
+
+      wheel.start(id1);
+      CHECK_EQUAL(5U, loop.time_to_next());
+
+      timer.start(id3);
+      CHECK_EQUAL(3U, loop.time_to_next());
+
+      timer.stop(id3);
+      wheel.stop(id1);
+      wheel.tick(96);
+      CHECK_EQUAL(4U, loop.time_to_next());
+    }
+  };
+}
+
+#endif
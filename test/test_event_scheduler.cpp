@@ -0,0 +1,201 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <vector>
+
+#include "etl/event_scheduler.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  std::vector<int> task_log;
+
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority, int id_)
+      : etl::task(priority),
+        id(id_),
+        work(0),
+        requests(0)
+    {
+    }
+
+    uint32_t task_request_work() const
+    {
+      ++requests;
+      return work;
+    }
+
+    void task_process_work()
+    {
+      task_log.push_back(id);
+      --work;
+    }
+
+    int id;
+    uint32_t work;
+    mutable int requests;
+  };
+
+  etl::event_scheduler<4>* p_scheduler;
+
+  //***************************************************************************
+  struct Idle : public etl::ifunction<void>
+  {
+    Idle()
+      : count(0)
+    {
+    }
+
+    void operator ()() const
+    {
+      ++count;
+      p_scheduler->exit_scheduler();
+    }
+
+    mutable int count;
+  };
+
+  SUITE(test_event_scheduler)
+  {
+    //*************************************************************************
+    TEST(test_task_index)
+    {
+      Task low(1, 1);
+      Task high(3, 3);
+      Task other(2, 2);
+
+      etl::event_scheduler<4> scheduler;
+      scheduler.add_task(low);
+      scheduler.add_task(high);
+
+      CHECK_EQUAL(0U, scheduler.get_task_index(high));
+      CHECK_EQUAL(1U, scheduler.get_task_index(low));
+      CHECK_EQUAL(4U, scheduler.get_task_index(other));
+    }
+
+    //*************************************************************************
+    TEST(test_ready_mask)
+    {
+      Task low(1, 1);
+      Task high(3, 3);
+
+      etl::event_scheduler<4> scheduler;
+      scheduler.add_task(low);
+      scheduler.add_task(high);
+
+      CHECK(!scheduler.has_ready_tasks());
+
+      scheduler.set_task_ready(low);
+      CHECK(scheduler.has_ready_tasks());
+      CHECK_EQUAL(0x02U, scheduler.get_ready_mask());
+
+      scheduler.set_task_ready(0U);
+      CHECK_EQUAL(0x03U, scheduler.get_ready_mask());
+
+      // Out of range indexes are ignored.
+      scheduler.set_task_ready(4U);
+      CHECK_EQUAL(0x03U, scheduler.get_ready_mask());
+    }
+
+    //*************************************************************************
+    TEST(test_runs_ready_tasks_in_priority_order)
+    {
+      task_log.clear();
+
+      Task low(1, 1);
+      Task high(3, 3);
+      Task middle(2, 2);
+      Task not_ready(4, 4);
+
+      etl::event_scheduler<4> scheduler;
+      p_scheduler = &scheduler;
+
+      scheduler.add_task(low);
+      scheduler.add_task(high);
+      scheduler.add_task(middle);
+      scheduler.add_task(not_ready);
+
+      Idle idle;
+      scheduler.set_idle_callback(idle);
+
+      low.work       = 1;
+      high.work      = 2;
+      middle.work    = 1;
+      not_ready.work = 1;
+
+      scheduler.set_task_ready(low);
+      scheduler.set_task_ready(middle);
+      scheduler.set_task_ready(high);
+
+      scheduler.start();
+
+      int expected[] = { 3, 3, 2, 1 };
+      CHECK_EQUAL(4U, task_log.size());
+      CHECK_ARRAY_EQUAL(expected, task_log.data(), 4);
+      CHECK_EQUAL(1, idle.count);
+      CHECK(!scheduler.has_ready_tasks());
+
+      // The task that was never signalled was never asked for work.
+      CHECK_EQUAL(0, not_ready.requests);
+      CHECK_EQUAL(1U, not_ready.work);
+    }
+
+    //*************************************************************************
+    TEST(test_spurious_ready_is_cleared)
+    {
+      task_log.clear();
+
+      Task task(1, 1);
+
+      etl::event_scheduler<4> scheduler;
+      p_scheduler = &scheduler;
+      scheduler.add_task(task);
+
+      Idle idle;
+      scheduler.set_idle_callback(idle);
+
+      scheduler.set_task_ready(task);
+      scheduler.start();
+
+      CHECK_EQUAL(0U, task_log.size());
+      CHECK_EQUAL(1, task.requests);
+      CHECK_EQUAL(1, idle.count);
+      CHECK(!scheduler.has_ready_tasks());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,140 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/fast_math.h"
+
+#include <cmath>
+
+namespace
+{
+  SUITE(test_fast_math)
+  {
+    //*************************************************************************
+    TEST(test_sin_cos)
+    {
+      double max_error = 0.0;
+
+      for (int i = -20000; i <= 20000; ++i)
+      {
+        const float x = float(i) * 0.001f;
+
+        max_error = std::max(max_error, std::fabs(double(etl::fast_sin(x)) - std::sin(double(x))));
+        max_error = std::max(max_error, std::fabs(double(etl::fast_cos(x)) - std::cos(double(x))));
+      }
+
+      CHECK(max_error < 8e-5);
+    }
+
+    //*************************************************************************
+    TEST(test_atan2)
+    {
+      double max_error = 0.0;
+
+      for (int i = -50; i <= 50; ++i)
+      {
+        for (int j = -50; j <= 50; ++j)
+        {
+          const float y = float(i) * 0.37f;
+          const float x = float(j) * 0.53f;
+
+          max_error = std::max(max_error, std::fabs(double(etl::fast_atan2(y, x)) - std::atan2(double(y), double(x))));
+        }
+      }
+
+      CHECK(max_error < 6e-6);
+      CHECK_EQUAL(0.0f, etl::fast_atan2(0.0f, 0.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_exp2_exp)
+    {
+      double max_error = 0.0;
+
+      for (int i = -12000; i <= 12000; ++i)
+      {
+        const float x = float(i) * 0.01f;
+
+        max_error = std::max(max_error, std::fabs(double(etl::fast_exp2(x)) / std::exp2(double(x)) - 1.0));
+      }
+
+      for (int i = -8000; i <= 8000; ++i)
+      {
+        const float x = float(i) * 0.01f;
+
+        max_error = std::max(max_error, std::fabs(double(etl::fast_exp(x)) / std::exp(double(x)) - 1.0));
+      }
+
+      CHECK(max_error < 2e-5);
+      CHECK_EQUAL(0.0f, etl::fast_exp2(-200.0f));
+      CHECK_EQUAL(1024.0f, etl::fast_exp2(10.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_log2)
+    {
+      double max_error = 0.0;
+
+      for (int i = 1; i <= 100000; ++i)
+      {
+        const float x = float(i) * 0.0137f;
+
+        max_error = std::max(max_error, std::fabs(double(etl::fast_log2(x)) - std::log2(double(x))));
+      }
+
+      CHECK(max_error < 2e-5);
+      CHECK_EQUAL(10.0f, etl::fast_log2(1024.0f));
+      CHECK_EQUAL(-3.0f, etl::fast_log2(0.125f));
+    }
+
+    //*************************************************************************
+    TEST(test_lookup_table)
+    {
+      struct Local
+      {
+        static constexpr double square(double x)
+        {
+          return x * x;
+        }
+      };
+
+      constexpr etl::lookup_table<double, 11> table(0.0, 10.0, Local::square);
+
+      static_assert(table[3] == 9.0, "Built at compile time");
+      static_assert(table(2.5) == 6.5, "Interpolated at compile time");
+
+      CHECK_EQUAL(11U, table.size());
+      CHECK_EQUAL(0.0,   table(-1.0));
+      CHECK_EQUAL(100.0, table(11.0));
+      CHECK_CLOSE(30.5, table(5.5), 1e-12);
+    }
+  };
+}
@@ -0,0 +1,193 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/fft.h"
+
+#include <math.h>
+
+namespace
+{
+  //***************************************************************************
+  // Reference DFT.
+  template <size_t N>
+  void dft(const etl::array<double, N>& real, const etl::array<double, N>& imag,
+           etl::array<double, N>& out_real, etl::array<double, N>& out_imag)
+  {
+    const double pi = 3.14159265358979323846;
+
+    for (size_t k = 0U; k < N; ++k)
+    {
+      double sr = 0.0;
+      double si = 0.0;
+
+      for (size_t n = 0U; n < N; ++n)
+      {
+        const double angle = -2.0 * pi * double(k * n) / double(N);
+        sr += (real[n] * cos(angle)) - (imag[n] * ::sin(angle));
+        si += (real[n] * ::sin(angle)) + (imag[n] * cos(angle));
+      }
+
+      out_real[k] = sr;
+      out_imag[k] = si;
+    }
+  }
+
+  template <size_t N>
+  void check_against_dft()
+  {
+    etl::array<double, N> real;
+    etl::array<double, N> imag;
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      real[i] = ::sin(double(i) * 0.37) + double(i % 5U) * 0.1;
+      imag[i] = cos(double(i) * 1.3) - 0.2;
+    }
+
+    etl::array<double, N> expected_real;
+    etl::array<double, N> expected_imag;
+    dft(real, imag, expected_real, expected_imag);
+
+    etl::array<double, N> original_real = real;
+    etl::array<double, N> original_imag = imag;
+
+    etl::fft(real, imag);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(expected_real[i], real[i], 1e-9);
+      CHECK_CLOSE(expected_imag[i], imag[i], 1e-9);
+    }
+
+    etl::ifft(real, imag);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(original_real[i], real[i], 1e-12);
+      CHECK_CLOSE(original_imag[i], imag[i], 1e-12);
+    }
+  }
+
+  SUITE(test_fft)
+  {
+    //*************************************************************************
+    TEST(test_twiddle_table_is_compile_time)
+    {
+      typedef etl::private_fft::quarter_sine_table<double, 16> table;
+
+      static_assert(table::values[0] == 0.0, "sin(0)");
+      static_assert((table::values[4] > 0.9999999999999) && (table::values[4] < 1.0000000000001), "sin(pi/2)");
+
+      CHECK_CLOSE(::sin(3.14159265358979323846 / 8.0), table::values[1], 1e-15);
+      CHECK_CLOSE(::sin(3.14159265358979323846 / 4.0), table::values[2], 1e-15);
+    }
+
+    //*************************************************************************
+    TEST(test_sizes_against_dft)
+    {
+      check_against_dft<4>();    // One radix-4 stage.
+      check_against_dft<8>();    // Radix-2 then radix-4.
+      check_against_dft<16>();
+      check_against_dft<32>();
+      check_against_dft<64>();
+      check_against_dft<256>();
+      check_against_dft<512>();
+    }
+
+    //*************************************************************************
+    TEST(test_impulse_and_tone)
+    {
+      etl::array<float, 64> real;
+      etl::array<float, 64> imag;
+      real.fill(0.0f);
+      imag.fill(0.0f);
+      real[0] = 1.0f;
+
+      etl::fft(real, imag);
+
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        CHECK_CLOSE(1.0f, real[i], 1e-6f);
+        CHECK_CLOSE(0.0f, imag[i], 1e-6f);
+      }
+
+      // A cosine at bin 5 puts N/2 in bins 5 and N - 5.
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        real[i] = float(cos(2.0 * 3.14159265358979323846 * 5.0 * double(i) / 64.0));
+        imag[i] = 0.0f;
+      }
+
+      etl::fft(real, imag);
+
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        const float expected = ((i == 5U) || (i == 59U)) ? 32.0f : 0.0f;
+        CHECK_CLOSE(expected, real[i], 1e-4f);
+        CHECK_CLOSE(0.0f, imag[i], 1e-4f);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_large)
+    {
+      static etl::array<double, 4096> real;
+      static etl::array<double, 4096> imag;
+
+      for (size_t i = 0U; i < 4096U; ++i)
+      {
+        real[i] = double(i % 17U);
+        imag[i] = 0.0;
+      }
+
+      const etl::array<double, 4096> original = real;
+
+      etl::fft(real, imag);
+
+      double sum = 0.0;
+
+      for (size_t i = 0U; i < 4096U; ++i)
+      {
+        sum += original[i];
+      }
+
+      CHECK_CLOSE(sum, real[0], 1e-6);
+
+      etl::ifft(real, imag);
+
+      for (size_t i = 0U; i < 4096U; ++i)
+      {
+        CHECK_CLOSE(original[i], real[i], 1e-9);
+        CHECK_CLOSE(0.0, imag[i], 1e-9);
+      }
+    }
+  }
+}
@@ -0,0 +1,216 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/fixed_point.h"
+
+#include <stdint.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  typedef etl::fixed_point<15, 16> Q15_16;
+  typedef etl::fixed_point<0, 15>  Q15;
+  typedef etl::fixed_point<3, 4>   Q3_4;
+  typedef etl::fixed_point<5, 4>   Q5_4;
+
+  int16_t reference_mul_sat(int16_t a, int16_t b)
+  {
+    int32_t product = int32_t(a) * b;
+    int32_t result  = (product >= 0) ? ((product + 16384) >> 15) : -((-product + 16384) >> 15);
+
+    return int16_t((result > 32767) ? 32767 : ((result < -32768) ? -32768 : result));
+  }
+
+  SUITE(test_fixed_point)
+  {
+    //*************************************************************************
+    TEST(test_types_and_limits)
+    {
+      CHECK_EQUAL(4U, sizeof(Q15_16));
+      CHECK_EQUAL(2U, sizeof(Q15));
+      CHECK_EQUAL(1U, sizeof(Q3_4));
+      CHECK_EQUAL(2U, sizeof(Q5_4));
+
+      CHECK_EQUAL(32767,  int(Q15::max().raw()));
+      CHECK_EQUAL(-32768, int(Q15::min().raw()));
+      CHECK_EQUAL(511,    int(Q5_4::max().raw()));
+      CHECK_EQUAL(-512,   int(Q5_4::min().raw()));
+    }
+
+    //*************************************************************************
+    TEST(test_construction_and_conversion)
+    {
+      Q15_16 a(3);
+      Q15_16 b(-2.25);
+      Q15    c(0.5);
+
+      CHECK_EQUAL(3 * 65536, a.raw());
+      CHECK_EQUAL(-2.25, b.to_double());
+      CHECK_EQUAL(16384, c.raw());
+      CHECK_EQUAL(-147456, b.raw());
+      CHECK_CLOSE(0.5f, c.to_float(), 0.0001f);
+
+      CHECK_EQUAL(3,  Q15_16(2.5).to_int());
+      CHECK_EQUAL(-3, Q15_16(-2.5).to_int());
+      CHECK_EQUAL(2,  Q15_16(2.49).to_int());
+
+      CHECK(Q15_16::from_raw(65536) == Q15_16(1));
+    }
+
+    //*************************************************************************
+    TEST(test_arithmetic)
+    {
+      Q15_16 a(1.5);
+      Q15_16 b(-0.25);
+
+      CHECK_EQUAL(1.25,   (a + b).to_double());
+      CHECK_EQUAL(1.75,   (a - b).to_double());
+      CHECK_EQUAL(-0.375, (a * b).to_double());
+      CHECK_EQUAL(-6.0,   (a / b).to_double());
+      CHECK_EQUAL(-1.5,   (-a).to_double());
+
+      a += b;
+      CHECK_EQUAL(1.25, a.to_double());
+      a *= Q15_16(2);
+      CHECK_EQUAL(2.5, a.to_double());
+      a /= Q15_16(5);
+      CHECK_EQUAL(0.5, a.to_double());
+      a -= Q15_16(1);
+      CHECK_EQUAL(-0.5, a.to_double());
+
+      CHECK(Q15_16(1) < Q15_16(2));
+      CHECK(Q15_16(2) >= Q15_16(2));
+      CHECK(Q15_16(-1) != Q15_16(1));
+    }
+
+    //*************************************************************************
+    TEST(test_rounding)
+    {
+      // 1/16 * 1/2 = 1/32, half of the last place: rounds away from zero.
+      Q3_4 sixteenth = Q3_4::from_raw(1);
+      Q3_4 half(0.5);
+
+      CHECK_EQUAL(1,  int((sixteenth * half).raw()));
+      CHECK_EQUAL(-1, int((-sixteenth * half).raw()));
+
+      // 1/3 in Q.16 rounds to nearest.
+      CHECK_EQUAL(21845, (Q15_16(1) / Q15_16(3)).raw());
+      CHECK_EQUAL(43691, (Q15_16(2) / Q15_16(3)).raw());
+      CHECK_EQUAL(-43691, (Q15_16(-2) / Q15_16(3)).raw());
+    }
+
+    //*************************************************************************
+    TEST(test_saturation)
+    {
+      CHECK(etl::add_sat(Q5_4(30), Q5_4(10)) == Q5_4::max());
+      CHECK(etl::sub_sat(Q5_4(-30), Q5_4(10)) == Q5_4::min());
+      CHECK(etl::mul_sat(Q5_4(10), Q5_4(10)) == Q5_4::max());
+      CHECK(etl::mul_sat(Q5_4(-10), Q5_4(10)) == Q5_4::min());
+      CHECK(etl::add_sat(Q5_4(3), Q5_4(4)) == Q5_4(7));
+
+      // -1 * -1 does not fit Q15.
+      CHECK(etl::mul_sat(Q15::min(), Q15::min()) == Q15::max());
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr Q15_16 a(1.5);
+      constexpr Q15_16 b(2);
+      constexpr Q15_16 sum     = a + b;
+      constexpr Q15_16 product = a * b;
+      constexpr Q15_16 clamped = etl::add_sat(Q15_16::max(), b);
+
+      static_assert(sum.raw() == (7 * 32768), "Sum");
+      static_assert(product.raw() == (3 * 65536), "Product");
+      static_assert(clamped == Q15_16::max(), "Saturation");
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_array_kernels)
+    {
+      const size_t Size = 37U;
+
+      std::vector<Q15> a(Size);
+      std::vector<Q15> b(Size);
+      std::vector<Q15> out(Size);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        a[i] = Q15::from_raw(int16_t((int(i) * 1777) % 65536 - 32768));
+        b[i] = Q15::from_raw(int16_t((int(i) * 5003 + 99) % 65536 - 32768));
+      }
+
+      a[0] = Q15::min();
+      b[0] = Q15::min();
+
+      etl::array_view<Q15> va(a.data(), a.size());
+      etl::array_view<Q15> vb(b.data(), b.size());
+      etl::array_view<Q15> vout(out.data(), out.size());
+
+      CHECK_EQUAL(Size, etl::mul_sat(va, vb, vout));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        CHECK_EQUAL(reference_mul_sat(a[i].raw(), b[i].raw()), out[i].raw());
+        CHECK(out[i] == etl::mul_sat(a[i], b[i]));
+      }
+
+      CHECK_EQUAL(Size, etl::add_sat(va, vb, vout));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        CHECK(out[i] == etl::add_sat(a[i], b[i]));
+      }
+
+      CHECK_EQUAL(Size, etl::sub_sat(va, vb, vout));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        CHECK(out[i] == etl::sub_sat(a[i], b[i]));
+      }
+
+      // A format narrower than its storage clamps at the format range.
+      Q5_4 c[] = { Q5_4(30), Q5_4(-30), Q5_4(1) };
+      Q5_4 d[] = { Q5_4(10), Q5_4(-10), Q5_4(2) };
+      Q5_4 e[3];
+
+      etl::add_sat(etl::array_view<Q5_4>(c), etl::array_view<Q5_4>(d), etl::array_view<Q5_4>(e));
+      CHECK(e[0] == Q5_4::max());
+      CHECK(e[1] == Q5_4::min());
+      CHECK(e[2] == Q5_4(3));
+    }
+  };
+}
@@ -781,6 +781,53 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.begin() + 5);
+      compare_data.insert(initial_data.begin(), initial_data.begin() + 5);
+
+      // Overlaps the existing elements, which are not added again.
+      data.insert_sorted(initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_sorted(excess_data.begin(), excess_data.end()), etl::flat_map_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data1(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data2(initial_data.begin() + 3, initial_data.end());
+
+      data1.merge(data2);
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data1.size());
+      CHECK_EQUAL(size_t(7), data2.size());
+
+      bool isEqual = Check_Equal(data1.begin(), data1.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -1238,5 +1285,41 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_flat_map_ext)
+    {
+      typedef etl::flat_map_ext<int, std::string> Data;
+
+      static const size_t MAX = 4U;
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX) <= sizeof(buffer));
+
+      Data data(&buffer, MAX);
+      etl::iflat_map<int, std::string>& idata = data;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+
+      idata[3] = "3";
+      idata[1] = "1";
+      idata[2] = "2";
+      idata[4] = "4";
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert(std::make_pair(5, std::string("5"))), etl::flat_map_full);
+
+      const char* p = reinterpret_cast<const char*>(&*idata.find(2));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX));
+
+      idata.erase(1);
+      idata[5] = "5";
+      CHECK_EQUAL(2, idata.begin()->first);
+      CHECK_EQUAL(5, (--idata.end())->first);
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer2;
+      Data data2(data.begin(), data.end(), &buffer2, MAX);
+      CHECK(data2 == data);
+    }
   };
 }
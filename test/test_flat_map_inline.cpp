@@ -0,0 +1,277 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/flat_map_inline.h"
+
+namespace
+{
+  static const size_t SIZE = 10;
+
+  typedef etl::flat_map_inline<int, std::string, SIZE> Data;
+  typedef etl::iflat_map_inline<int, std::string>       IData;
+  typedef std::map<int, std::string>                    Compare_Data;
+  typedef ETL_OR_STD::pair<int, std::string>            Element;
+
+  std::vector<Element> initial_data;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  SUITE(test_flat_map_inline)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        initial_data.clear();
+
+        const char* words[] = { "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine" };
+        const int   order[] = { 5, 2, 8, 0, 9, 1, 7, 3, 6, 4 };
+
+        for (size_t i = 0U; i < SIZE; ++i)
+        {
+          initial_data.push_back(Element(order[i], words[order[i]]));
+        }
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      Data data = { Element(2, "two"), Element(0, "zero"), Element(1, "one") };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, data.keys()[0]);
+      CHECK_EQUAL(1, data.keys()[1]);
+      CHECK_EQUAL(2, data.keys()[2]);
+      CHECK_EQUAL(std::string("one"), data.values()[1]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor_and_assignment)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data copy(data);
+
+      CHECK(data == copy);
+
+      Data other;
+      other[42] = "forty two";
+      other = data;
+
+      CHECK(data == other);
+
+      IData& idata = other;
+      idata.erase(5);
+      CHECK(data != other);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_keys_are_contiguous_and_sorted)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(std::is_sorted(data.keys(), data.keys() + data.size()));
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), data.keys()[i]);
+        CHECK(&data.begin()[i].second == &data.values()[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_and_at)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL(std::string("three"), data[3]);
+      CHECK_EQUAL(std::string("seven"), data.at(7));
+      CHECK_EQUAL(std::string("seven"), cdata.at(7));
+
+      data[3] = "THREE";
+      CHECK_EQUAL(std::string("THREE"), data.at(3));
+
+      CHECK_THROW(data.at(10), etl::flat_map_inline_out_of_bounds);
+      CHECK_THROW(cdata.at(10), etl::flat_map_inline_out_of_bounds);
+      CHECK_THROW(data[10], etl::flat_map_inline_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Compare_Data compare_data;
+      Data data;
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(initial_data[i]);
+        compare_data.insert(initial_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(initial_data[i].first, result.first->first);
+        CHECK_EQUAL(initial_data[i].second, result.first->second);
+      }
+
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      // Duplicate.
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Element(5, "FIVE"));
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("five"), result.first->second);
+
+      CHECK_THROW(data.insert(Element(10, "ten")), etl::flat_map_inline_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_and_bounds)
+    {
+      Data data;
+      data.insert(Element(10, "ten"));
+      data.insert(Element(20, "twenty"));
+      data.insert(Element(30, "thirty"));
+
+      const Data& cdata = data;
+
+      CHECK(data.find(20) == data.begin() + 1);
+      CHECK(data.find(25) == data.end());
+      CHECK(cdata.find(30) == cdata.begin() + 2);
+      CHECK_EQUAL(1U, data.count(10));
+      CHECK_EQUAL(0U, data.count(15));
+
+      CHECK(data.lower_bound(15) == data.begin() + 1);
+      CHECK(data.lower_bound(20) == data.begin() + 1);
+      CHECK(data.upper_bound(20) == data.begin() + 2);
+      CHECK(cdata.upper_bound(30) == cdata.end());
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(20);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(20, range.first->first);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(5));
+      CHECK_EQUAL(0U, data.erase(5));
+      compare_data.erase(5);
+
+      Data::iterator i = data.erase(data.find(2));
+      compare_data.erase(2);
+      CHECK_EQUAL(3, i->first);
+
+      i = data.erase(data.find(6), data.find(9));
+      compare_data.erase(compare_data.find(6), compare_data.find(9));
+      CHECK_EQUAL(9, i->first);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterators)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK(Check_Equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+      CHECK(Check_Equal(cdata.cbegin(), cdata.cend(), compare_data.begin()));
+      CHECK(Check_Equal(cdata.crbegin(), cdata.crend(), compare_data.rbegin()));
+      CHECK_EQUAL(int(SIZE), data.end() - data.begin());
+
+      Data::iterator itr = data.begin();
+      itr += 4;
+      CHECK_EQUAL(4, (*itr).first);
+      CHECK_EQUAL(6, itr[2].first);
+
+      (*itr).second = "FOUR";
+      CHECK_EQUAL(std::string("FOUR"), data[4]);
+
+      Data::const_iterator citr = itr;
+      CHECK(citr == cdata.begin() + 4);
+      CHECK(citr < cdata.end());
+    }
+  };
+}
@@ -0,0 +1,177 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/flat_map_view.h"
+#include "etl/flat_map.h"
+
+#include <stdint.h>
+#include <map>
+
+namespace
+{
+  typedef etl::flat_map_view<int, uint32_t> View;
+
+  // A table that may be placed in read only memory.
+  const View::value_type table[] =
+  {
+    { 2, 20U }, { 3, 30U }, { 5, 50U }, { 7, 70U }, { 11, 110U }
+  };
+
+  union Buffer
+  {
+    uint64_t align;
+    char     data[256];
+  };
+
+  SUITE(test_flat_map_view)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      View view;
+
+      CHECK(!view.is_valid());
+      CHECK(view.empty());
+      CHECK_EQUAL(0U, view.size());
+      CHECK(view.find(1) == view.end());
+    }
+
+    //*************************************************************************
+    TEST(test_lookup)
+    {
+      View view(table);
+
+      CHECK(view.is_valid());
+      CHECK(view.is_sorted());
+      CHECK_EQUAL(5U, view.size());
+
+      CHECK_EQUAL(50U, view.at(5));
+      CHECK_EQUAL(110U, view.find(11)->second);
+      CHECK(view.find(4) == view.end());
+      CHECK(view.contains(7));
+      CHECK(!view.contains(1));
+      CHECK_EQUAL(1U, view.count(2));
+      CHECK_EQUAL(0U, view.count(12));
+
+      CHECK_EQUAL(5, view.lower_bound(4)->first);
+      CHECK_EQUAL(5, view.lower_bound(5)->first);
+      CHECK_EQUAL(7, view.upper_bound(5)->first);
+      CHECK(view.upper_bound(11) == view.end());
+
+      ETL_OR_STD::pair<View::const_iterator, View::const_iterator> range = view.equal_range(3);
+      CHECK_EQUAL(1, range.second - range.first);
+      CHECK_EQUAL(3, range.first->first);
+
+      CHECK_THROW(view.at(4), etl::flat_map_view_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_iteration)
+    {
+      View view(table, 3U);
+
+      int keys = 0;
+
+      for (View::const_iterator itr = view.begin(); itr != view.end(); ++itr)
+      {
+        keys += itr->first;
+      }
+
+      CHECK_EQUAL(10, keys);
+      CHECK_EQUAL(5, view.rbegin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_lookup_matches_std_map)
+    {
+      std::map<int, uint32_t> compare;
+
+      for (size_t i = 0U; i < (sizeof(table) / sizeof(table[0])); ++i)
+      {
+        compare[table[i].first] = table[i].second;
+      }
+
+      View view(table);
+
+      for (int key = 0; key < 13; ++key)
+      {
+        CHECK_EQUAL(compare.count(key), view.count(key));
+        CHECK_EQUAL(compare.lower_bound(key) == compare.end(), view.lower_bound(key) == view.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_image_from_flat_map)
+    {
+      etl::flat_map<int, uint32_t, 8> source;
+      source[9]  = 90U;
+      source[1]  = 10U;
+      source[4]  = 40U;
+
+      Buffer buffer;
+      size_t length = View::write_image(buffer.data, sizeof(buffer.data), source.begin(), source.end(), 0x1234U);
+
+      CHECK_EQUAL(etl::table_image_size<View::value_type>(3U), length);
+
+      View view = View::from_image(buffer.data, length, 0x1234U);
+
+      CHECK(view.is_valid());
+      CHECK(view.is_sorted());
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(1, view.begin()->first);
+      CHECK_EQUAL(40U, view.at(4));
+      CHECK_EQUAL(90U, view.at(9));
+    }
+
+    //*************************************************************************
+    TEST(test_write_image_rejects_unsorted)
+    {
+      std::map<int, uint32_t, std::greater<int> > source;
+      source[1] = 10U;
+      source[2] = 20U;
+
+      Buffer buffer;
+      CHECK_EQUAL(0U, View::write_image(buffer.data, sizeof(buffer.data), source.begin(), source.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_from_invalid_image)
+    {
+      Buffer buffer;
+      size_t length = View::write_image(buffer.data, sizeof(buffer.data), table, table + 5, 1U);
+
+      View view = View::from_image(buffer.data, length, 2U);
+
+      CHECK(!view.is_valid());
+      CHECK(view.empty());
+    }
+  };
+}
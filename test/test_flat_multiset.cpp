@@ -559,6 +559,53 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.begin() + 5);
+      compare_data.insert(initial_data.begin(), initial_data.begin() + 5);
+
+      // Equal elements go after the existing ones.
+      data.insert_sorted(initial_data.begin() + 5, initial_data.end());
+      compare_data.insert(initial_data.begin() + 5, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_sorted(excess_data.begin(), excess_data.end()), etl::flat_multiset_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data1(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data2(initial_data.begin() + 5, initial_data.end());
+
+      data1.merge(data2);
+      compare_data.insert(initial_data.begin() + 5, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data1.size());
+      CHECK_EQUAL(size_t(5), data2.size());
+
+      bool isEqual = std::equal(data1.begin(), data1.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
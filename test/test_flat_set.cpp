@@ -563,6 +563,53 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.begin() + 5);
+      compare_data.insert(initial_data.begin(), initial_data.begin() + 5);
+
+      // Overlaps the existing elements, which are not added again.
+      data.insert_sorted(initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_sorted(excess_data.begin(), excess_data.end()), etl::flat_set_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data1(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data2(initial_data.begin() + 3, initial_data.end());
+
+      data1.merge(data2);
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data1.size());
+      CHECK_EQUAL(size_t(7), data2.size());
+
+      bool isEqual = std::equal(data1.begin(), data1.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -949,5 +996,41 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_flat_set_ext)
+    {
+      typedef etl::flat_set_ext<std::string> Data;
+
+      static const size_t MAX = 4U;
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX) <= sizeof(buffer));
+
+      Data data(&buffer, MAX);
+      etl::iflat_set<std::string>& idata = data;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+
+      idata.insert("C");
+      idata.insert("A");
+      idata.insert("B");
+      idata.insert("D");
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert("E"), etl::flat_set_full);
+
+      const char* p = reinterpret_cast<const char*>(&*idata.find("B"));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX));
+
+      idata.erase("A");
+      idata.insert("E");
+      CHECK_EQUAL(std::string("B"), *idata.begin());
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer2;
+      Data data2(&buffer2, MAX);
+      data2 = data;
+      CHECK(data2 == data);
+    }
   };
 }
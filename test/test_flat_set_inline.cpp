@@ -0,0 +1,178 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "etl/flat_set_inline.h"
+
+namespace
+{
+  static const size_t SIZE = 10;
+
+  typedef etl::flat_set_inline<std::string, SIZE> Data;
+  typedef etl::iflat_set_inline<std::string>      IData;
+  typedef std::set<std::string>                   Compare_Data;
+
+  std::vector<std::string> initial_data;
+
+  SUITE(test_flat_set_inline)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        const char* words[] = { "five", "two", "eight", "zero", "nine", "one", "seven", "three", "six", "four" };
+
+        initial_data.assign(words, words + SIZE);
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+      CHECK(data.data() == &*data.begin());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      Data data = { "b", "c", "a", "b" };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("a"), data.data()[0]);
+      CHECK_EQUAL(std::string("c"), data.data()[2]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_assignment)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data copy(data);
+
+      CHECK(data == copy);
+
+      Data other;
+      other.insert("ten");
+      other = data;
+      CHECK(data == other);
+
+      IData& idata = other;
+      idata.erase("one");
+      CHECK(data != other);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(initial_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(initial_data[i], *result.first);
+        CHECK(std::is_sorted(data.begin(), data.end()));
+      }
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert("six");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("six"), *result.first);
+
+      CHECK_THROW(data.insert("ten"), etl::flat_set_inline_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_and_bounds)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(std::string("seven"), *data.find("seven"));
+      CHECK(data.find("ten") == data.end());
+      CHECK_EQUAL(1U, data.count("two"));
+      CHECK_EQUAL(0U, data.count("ten"));
+
+      CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound("p")),
+                  std::distance(data.begin(), data.lower_bound("p")));
+      CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound("six")),
+                  std::distance(data.begin(), data.upper_bound("six")));
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range("six");
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase("five"));
+      CHECK_EQUAL(0U, data.erase("five"));
+      compare_data.erase("five");
+
+      data.erase(data.find("nine"));
+      compare_data.erase("nine");
+
+      data.erase(data.find("seven"), data.find("two"));
+      compare_data.erase(compare_data.find("seven"), compare_data.find("two"));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+  };
+}
@@ -262,6 +262,29 @@ namespace
       uint64_t hash3 = etl::fnv_1a_64(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_fnv_1a_32_add_multi)
+    {
+      const std::string data[5] = { "ABCDEFGH", "", "0123456789", "xyz", "The quick brown fox" };
+
+      const uint8_t* buffers[5];
+      size_t         lengths[5];
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        buffers[i] = reinterpret_cast<const uint8_t*>(data[i].data());
+        lengths[i] = data[i].size();
+      }
+
+      uint32_t results[5];
+      etl::fnv_1a_32::add_multi(buffers, lengths, results);
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(uint32_t(etl::fnv_1a_32(data[i].begin(), data[i].end())), results[i]);
+      }
+    }
   };
 }
 
@@ -0,0 +1,156 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/footprint.h"
+#include "etl/vector.h"
+#include "etl/list.h"
+#include "etl/unordered_map.h"
+#include "etl/pool.h"
+#include "etl/cstring.h"
+#include "etl/queue.h"
+
+namespace
+{
+  typedef etl::vector<int, 10>                  Vector;
+  typedef etl::list<char, 10>                   List;
+  typedef etl::unordered_map<int, int, 10, 5>   UnorderedMap;
+  typedef etl::pool<double, 10>                 Pool;
+  typedef etl::string<10>                       String;
+
+  // A container with a form that footprint does not know.
+  struct Unknown
+  {
+    typedef int value_type;
+    static const size_t MAX_SIZE = 4;
+    int values[4];
+    int count;
+  };
+
+  SUITE(test_footprint)
+  {
+    //*************************************************************************
+    TEST(test_vector)
+    {
+      typedef etl::footprint<Vector> Footprint;
+
+      CHECK_EQUAL(sizeof(Vector),                Footprint::STORAGE);
+      CHECK_EQUAL(10U,                           Footprint::CAPACITY);
+      CHECK_EQUAL(sizeof(int),                   Footprint::ELEMENT_SIZE);
+      CHECK_EQUAL(10U * sizeof(int),             Footprint::PAYLOAD);
+      CHECK_EQUAL(sizeof(Vector) - Footprint::PAYLOAD, Footprint::OVERHEAD);
+      CHECK_EQUAL(0U,                            Footprint::OVERHEAD_PER_ELEMENT);
+      CHECK_EQUAL(Footprint::OVERHEAD,           Footprint::FIXED_OVERHEAD);
+      CHECK_EQUAL(0U,                            Footprint::NODE_PADDING);
+      CHECK_EQUAL(Footprint::OVERHEAD, (Footprint::OVERHEAD_PER_ELEMENT * Footprint::CAPACITY) + Footprint::FIXED_OVERHEAD);
+      CHECK_EQUAL((Footprint::PAYLOAD * 100U) / Footprint::STORAGE, Footprint::EFFICIENCY);
+    }
+
+    //*************************************************************************
+    TEST(test_list)
+    {
+      typedef etl::footprint<List> Footprint;
+
+      CHECK_EQUAL(10U, Footprint::CAPACITY);
+      CHECK_EQUAL(1U,  Footprint::ELEMENT_SIZE);
+
+      // Each node has two links.
+      CHECK(Footprint::OVERHEAD_PER_ELEMENT >= (2U * sizeof(void*)));
+      CHECK_EQUAL(sizeof(void*) - 1U, Footprint::NODE_PADDING);
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map)
+    {
+      typedef etl::footprint<UnorderedMap> Footprint;
+
+      CHECK_EQUAL(10U, Footprint::CAPACITY);
+      CHECK_EQUAL(sizeof(UnorderedMap::value_type), Footprint::ELEMENT_SIZE);
+
+      // Each node has a link, plus a share of the buckets.
+      CHECK(Footprint::OVERHEAD_PER_ELEMENT >= (2U * sizeof(void*)));
+      CHECK(Footprint::EFFICIENCY < 100U);
+    }
+
+    //*************************************************************************
+    TEST(test_pool)
+    {
+      typedef etl::footprint<Pool> Footprint;
+
+      CHECK_EQUAL(10U,            Footprint::CAPACITY);
+      CHECK_EQUAL(sizeof(double), Footprint::ELEMENT_SIZE);
+      CHECK_EQUAL(sizeof(Pool),   Footprint::STORAGE);
+
+      // The free list is held in the unused items.
+      CHECK_EQUAL(0U, Footprint::OVERHEAD_PER_ELEMENT);
+      CHECK_EQUAL(Footprint::OVERHEAD, Footprint::FIXED_OVERHEAD);
+    }
+
+    //*************************************************************************
+    TEST(test_string)
+    {
+      typedef etl::footprint<String> Footprint;
+
+      CHECK_EQUAL(10U, Footprint::CAPACITY);
+      CHECK_EQUAL(1U,  Footprint::ELEMENT_SIZE);
+      CHECK_EQUAL(10U, Footprint::PAYLOAD);
+
+      // The terminator is part of the fixed overhead.
+      CHECK_EQUAL(0U, Footprint::OVERHEAD_PER_ELEMENT);
+      CHECK(Footprint::FIXED_OVERHEAD >= 1U);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_unknown_form)
+    {
+      typedef etl::queue<int, 10> Queue; // Known form.
+
+      typedef etl::footprint<Unknown> Footprint;
+
+      // All of the overhead is shared between the elements.
+      CHECK_EQUAL(4U,          Footprint::CAPACITY);
+      CHECK_EQUAL(sizeof(int), Footprint::OVERHEAD);
+      CHECK_EQUAL(sizeof(Unknown) / 4U - sizeof(int), Footprint::OVERHEAD_PER_ELEMENT);
+
+      CHECK_EQUAL(0U, etl::footprint<Queue>::OVERHEAD_PER_ELEMENT);
+    }
+
+    //*************************************************************************
+    TEST(test_compile_time)
+    {
+      static_assert(etl::footprint<Vector>::CAPACITY == 10U, "Not a constant");
+      static_assert(etl::footprint<Vector>::STORAGE  == sizeof(Vector), "Not a constant");
+      static_assert(etl::footprint<Pool>::PAYLOAD    == 10U * sizeof(double), "Not a constant");
+    }
+#endif
+  };
+}
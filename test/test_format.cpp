@@ -0,0 +1,134 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/format.h"
+
+namespace
+{
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_integrals)
+    {
+      etl::string<64> str;
+
+      etl::format_to(str, "x={} y={:x} z={:X}", 123, 255U, uint16_t(0xABCD));
+      CHECK(str == "x=123 y=ff z=ABCD");
+
+      str.clear();
+      etl::format_to(str, "[{:5}] [{:<5}] [{:*>5}] [{:05}]", -12, 34, 56, 78);
+      CHECK(str == "[  -12] [34   ] [***56] [00078]");
+
+      str.clear();
+      etl::format_to(str, "{:b} {:o} {}", 5, 8, int64_t(-9223372036854775807LL - 1));
+      CHECK(str == "101 10 -9223372036854775808");
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      etl::string<64> str;
+
+      etl::format_to(str, "{} {} {:.2f} {:f} {:8.3}", 0.1, -2.5f, 3.14159, 1.5, 2.0);
+      CHECK(str == "0.1 -2.5 3.14 1.500000    2.000");
+    }
+
+    //*************************************************************************
+    TEST(test_text_bool_char)
+    {
+      etl::string<64> str;
+      etl::string<10> name("etl");
+      const char*     text = "text";
+
+      etl::format_to(str, "{} {} {} {} {}", "literal", name, text, etl::string_view("view"), true);
+      CHECK(str == "literal etl text view true");
+
+      str.clear();
+      etl::format_to(str, "[{:6}] [{:>6}] [{:.2}] [{}] [{:d}] [{:d}]", name, "abc", text, 'c', 'A', false);
+      CHECK(str == "[etl   ] [   abc] [te] [c] [65] [0]");
+    }
+
+    //*************************************************************************
+    TEST(test_positional_and_escapes)
+    {
+      etl::string<64> str("Start ");
+
+      etl::format_to(str, "{1} {0} {{}} {0}}}", "a", "b");
+      CHECK(str == "Start b a {} a}");
+    }
+
+    //*************************************************************************
+    TEST(test_format_string)
+    {
+      static ETL_CONSTEXPR14 etl::format_string<4> format("x={} y={:x}!");
+
+      CHECK(format.is_valid());
+      CHECK_EQUAL(3U, format.size());
+
+      etl::string<64> str;
+      etl::format_to(str, format, 10, 10);
+      etl::format_to(str, format, 11, 11);
+
+      CHECK(str == "x=10 y=a!x=11 y=b!");
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_format_string_constexpr)
+    {
+      constexpr etl::format_string<2> format("{:>4}|");
+
+      static_assert(format.is_valid(), "Should be valid");
+      static_assert(format.size() == 2U, "Wrong number of segments");
+      static_assert(format[0].width == 4U, "Wrong width");
+      static_assert(format[0].align == '>', "Wrong alignment");
+
+      etl::string<16> str;
+      etl::format_to(str, format, 7);
+
+      CHECK(str == "   7|");
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::string<64> str;
+
+      CHECK(!etl::format_string<4>("x={").is_valid());
+      CHECK(!etl::format_string<4>("x=}").is_valid());
+      CHECK(!etl::format_string<4>("{:q}").is_valid());
+      CHECK(!etl::format_string<1>("{}{}").is_valid());
+
+      CHECK_THROW(etl::format_to(str, "{} {}", 1), etl::format_argument);
+      CHECK_THROW(etl::format_to(str, "{:.}", 1), etl::format_invalid);
+    }
+  };
+}
@@ -0,0 +1,235 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "etl/from_chars.h"
+#include "etl/to_string.h"
+
+namespace
+{
+  SUITE(test_from_chars)
+  {
+    //*************************************************************************
+    TEST(test_integral_decimal)
+    {
+      int32_t  i = 0;
+      uint64_t u = 0;
+
+      etl::string_view text("-123456789xyz");
+      etl::from_chars_result result = etl::from_chars(text, i);
+
+      CHECK(result.status == etl::from_chars_status::valid);
+      CHECK_EQUAL(-123456789, i);
+      CHECK(result.ptr == text.data() + 10);
+
+      result = etl::from_chars(etl::string_view("18446744073709551615"), u);
+      CHECK(result.status == etl::from_chars_status::valid);
+      CHECK_EQUAL(18446744073709551615ULL, u);
+
+      result = etl::from_chars(etl::string_view("0000000000000000000000012"), u);
+      CHECK(result.status == etl::from_chars_status::valid);
+      CHECK_EQUAL(12U, u);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_limits)
+    {
+      int8_t   i8;
+      uint8_t  u8;
+      int64_t  i64;
+      uint64_t u64;
+
+      CHECK(etl::from_chars(etl::string_view("-128"), i8).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(-128, int(i8));
+      CHECK(etl::from_chars(etl::string_view("127"), i8).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(127, int(i8));
+
+      i8 = 5;
+      CHECK(etl::from_chars(etl::string_view("128"), i8).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("-129"), i8).status == etl::from_chars_status::result_out_of_range);
+      CHECK_EQUAL(5, int(i8));
+
+      CHECK(etl::from_chars(etl::string_view("255"), u8).status == etl::from_chars_status::valid);
+      CHECK(etl::from_chars(etl::string_view("256"), u8).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("-1"), u8).status == etl::from_chars_status::invalid_argument);
+
+      CHECK(etl::from_chars(etl::string_view("-9223372036854775808"), i64).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(-9223372036854775807LL - 1, i64);
+      CHECK(etl::from_chars(etl::string_view("9223372036854775808"), i64).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("18446744073709551616"), u64).status == etl::from_chars_status::result_out_of_range);
+
+      // The whole number is consumed, even when out of range.
+      etl::string_view text("99999999999999999999999,");
+      CHECK(etl::from_chars(text, u64).ptr == text.data() + 23);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_all_digit_counts)
+    {
+      uint64_t value = 0U;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        value = (value * 10U) + uint64_t(i % 10);
+
+        const std::string text = std::to_string(value);
+
+        uint64_t result = 0U;
+        CHECK(etl::from_chars(etl::string_view(text.c_str()), result).status == etl::from_chars_status::valid);
+        CHECK_EQUAL(value, result);
+
+        const std::string negative = "-" + std::to_string(value / 2U);
+
+        int64_t sresult = 0;
+        CHECK(etl::from_chars(etl::string_view(negative.c_str()), sresult).status == etl::from_chars_status::valid);
+        CHECK_EQUAL(-int64_t(value / 2U), sresult);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_integral_bases)
+    {
+      uint32_t u;
+
+      CHECK(etl::from_chars(etl::string_view("1E240"), u, 16U).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(123456U, u);
+
+      CHECK(etl::from_chars(etl::string_view("ffffffff"), u, etl::format_spec().hex()).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(0xFFFFFFFFU, u);
+
+      CHECK(etl::from_chars(etl::string_view("11110001001000000"), u, etl::format_spec().binary()).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(123456U, u);
+
+      CHECK(etl::from_chars(etl::string_view("361100"), u, 8U).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(123456U, u);
+
+      CHECK(etl::from_chars(etl::string_view("z"), u, 36U).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(35U, u);
+
+      etl::string_view text("129");
+      etl::from_chars_result result = etl::from_chars(text, u, 2U);
+      CHECK(result.status == etl::from_chars_status::valid);
+      CHECK_EQUAL(1U, u);
+      CHECK(result.ptr == text.data() + 1);
+
+      CHECK(etl::from_chars(etl::string_view("10"), u, 1U).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(etl::string_view("10"), u, 37U).status == etl::from_chars_status::invalid_argument);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_invalid)
+    {
+      int32_t i = 42;
+
+      etl::string_view text(" 1");
+      etl::from_chars_result result = etl::from_chars(text, i);
+
+      CHECK(result.status == etl::from_chars_status::invalid_argument);
+      CHECK(result.ptr == text.data());
+      CHECK_EQUAL(42, i);
+
+      CHECK(etl::from_chars(etl::string_view(""), i).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(etl::string_view("-"), i).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(etl::string_view("+1"), i).status == etl::from_chars_status::invalid_argument);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      double d;
+      float  f;
+
+      CHECK(etl::from_chars(etl::string_view("123.456"), d).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(123.456, d);
+
+      CHECK(etl::from_chars(etl::string_view("-1.5e3"), d).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(-1500.0, d);
+
+      CHECK(etl::from_chars(etl::string_view(".25"), d).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(0.25, d);
+
+      CHECK(etl::from_chars(etl::string_view("0.1"), f).status == etl::from_chars_status::valid);
+      CHECK_EQUAL(0.1f, f);
+
+      // An exponent without digits is not part of the number.
+      etl::string_view text("2e+x");
+      etl::from_chars_result result = etl::from_chars(text, d);
+      CHECK(result.status == etl::from_chars_status::valid);
+      CHECK_EQUAL(2.0, d);
+      CHECK(result.ptr == text.data() + 1);
+
+      CHECK(etl::from_chars(etl::string_view("inf"), d).status == etl::from_chars_status::valid);
+      CHECK(std::isinf(d));
+      CHECK(etl::from_chars(etl::string_view("-Infinity"), d).status == etl::from_chars_status::valid);
+      CHECK(std::isinf(d) && (d < 0.0));
+      CHECK(etl::from_chars(etl::string_view("nan"), d).status == etl::from_chars_status::valid);
+      CHECK(std::isnan(d));
+
+      d = 1.0;
+      CHECK(etl::from_chars(etl::string_view("1e400"), d).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("1e-400"), d).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("1e39"), f).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(etl::string_view("."), d).status == etl::from_chars_status::invalid_argument);
+      CHECK_EQUAL(1.0, d);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_close_to_strtod)
+    {
+      etl::string<32> str;
+
+      uint64_t seed = 0x0123456789ABCDEFULL;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        // xorshift64
+        seed ^= seed << 13U;
+        seed ^= seed >> 7U;
+        seed ^= seed << 17U;
+
+        double expected;
+        memcpy(&expected, &seed, sizeof(expected));
+
+        if (std::isfinite(expected) && (std::fabs(expected) > 1e-300))
+        {
+          etl::to_string(expected, str, etl::format_spec().shortest(true));
+
+          double result;
+          CHECK(etl::from_chars(etl::string_view(str.c_str()), result).status == etl::from_chars_status::valid);
+          CHECK_CLOSE(1.0, result / expected, 1e-14);
+        }
+      }
+    }
+  };
+}
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "etl/queue.h"
 
 #include <iostream>
+#include <string>
 
 
 namespace
@@ -331,6 +332,23 @@ namespace
 
   MotorControl motorControl;
 
+#if defined(ETL_FSM_TRACE)
+  //***************************************************************************
+  // Ticks once per reading.
+  //***************************************************************************
+  struct TraceClock
+  {
+    static etl::fsm_trace_timestamp_t now()
+    {
+      return ++time;
+    }
+
+    static etl::fsm_trace_timestamp_t time;
+  };
+
+  etl::fsm_trace_timestamp_t TraceClock::time;
+#endif
+
   SUITE(test_map)
   {
     //*************************************************************************
@@ -574,5 +592,428 @@ namespace
       CHECK(motorControl.accepts(Stopped()));
       CHECK(motorControl.accepts(Unsupported()));
     }
+
+#if defined(ETL_FSM_TRACE)
+    //*************************************************************************
+    TEST(test_fsm_trace)
+    {
+      etl::null_message_router nmr;
+      etl::fsm_trace<2> trace(TraceClock::now);
+      etl::fsm_trace_record records[3];
+
+      TraceClock::time = 0U;
+
+      motorControl.Initialise(stateList, etl::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.set_trace(trace);
+      motorControl.start(false);
+
+      // Not a transition.
+      motorControl.receive(nmr, Stop());
+      CHECK(trace.empty());
+
+      motorControl.receive(nmr, Start());
+      motorControl.receive(nmr, SetSpeed(100));
+      motorControl.receive(nmr, Stop(true));
+
+      CHECK_EQUAL(2U, trace.written());
+      CHECK_EQUAL(2U, trace.copy(records, 3U));
+
+      CHECK_EQUAL(StateId::IDLE,    records[0].state_from);
+      CHECK_EQUAL(StateId::RUNNING, records[0].state_to);
+      CHECK_EQUAL(EventId::START,   records[0].message_id);
+      CHECK_EQUAL(2U,               records[0].timestamp);
+      CHECK_EQUAL(1U,               records[0].duration);
+
+      // The emergency stop passes through Idle on the way to Locked.
+      CHECK_EQUAL(StateId::RUNNING, records[1].state_from);
+      CHECK_EQUAL(StateId::LOCKED,  records[1].state_to);
+      CHECK_EQUAL(EventId::STOP,    records[1].message_id);
+      CHECK_EQUAL(5U,               records[1].timestamp);
+      CHECK_EQUAL(1U,               records[1].duration);
+
+      // The oldest record is overwritten.
+      motorControl.reset();
+      motorControl.start(false);
+      motorControl.receive(nmr, Start());
+
+      CHECK_EQUAL(3U, trace.written());
+      CHECK_EQUAL(2U, trace.copy(records, 3U));
+      CHECK_EQUAL(StateId::LOCKED,  records[0].state_to);
+      CHECK_EQUAL(StateId::RUNNING, records[1].state_to);
+
+      motorControl.clear_trace();
+      motorControl.receive(nmr, Stop());
+      CHECK_EQUAL(3U, trace.written());
+    }
+#endif
   };
+
+  //***************************************************************************
+  // A link layer, to test parent states and deferred events.
+  //***************************************************************************
+  const etl::message_router_id_t LINK = 1;
+
+  struct LinkEventId
+  {
+    enum
+    {
+      CONNECT,
+      DISCONNECT,
+      SEND,
+      ACK,
+      PING
+    };
+  };
+
+  struct LinkStateId
+  {
+    enum
+    {
+      DISCONNECTED,
+      CONNECTED,
+      READY,
+      BUSY,
+      NUMBER_OF_STATES
+    };
+  };
+
+  struct Connect    : public etl::message<LinkEventId::CONNECT> {};
+  struct Disconnect : public etl::message<LinkEventId::DISCONNECT> {};
+  struct Ack        : public etl::message<LinkEventId::ACK> {};
+  struct Ping       : public etl::message<LinkEventId::PING> {};
+
+  struct Send : public etl::message<LinkEventId::SEND>
+  {
+    Send(const std::string& data_)
+      : data(data_)
+    {
+    }
+
+    std::string data;
+  };
+
+  // Only used to supply the packet type for deferred events.
+  class LinkRouter;
+  typedef etl::message_router<LinkRouter, Send, Ping>::message_packet LinkPacket;
+
+  //***********************************
+  class Link : public etl::fsm
+  {
+  public:
+
+    Link()
+      : fsm(LINK),
+        pings(0),
+        unknown(0)
+    {
+    }
+
+    etl::fsm_deferred_queue<LinkPacket, 3> deferred;
+    std::string sent;
+    int pings;
+    int unknown;
+  };
+
+  //***********************************
+  class LinkDisconnected : public etl::fsm_state<Link, LinkDisconnected, LinkStateId::DISCONNECTED, Connect, Send>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router& source, const Send& event)
+    {
+      get_fsm_context().defer(source, event);
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Connect&)
+    {
+      return LinkStateId::READY;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++get_fsm_context().unknown;
+      return STATE_ID;
+    }
+  };
+
+  //***********************************
+  // The parent of Ready and Busy.
+  class LinkConnected : public etl::fsm_state<Link, LinkConnected, LinkStateId::CONNECTED, Disconnect, Ping>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Disconnect&)
+    {
+      return LinkStateId::DISCONNECTED;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Ping&)
+    {
+      ++get_fsm_context().pings;
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++get_fsm_context().unknown;
+      return STATE_ID;
+    }
+  };
+
+  //***********************************
+  class LinkReady : public etl::fsm_state<Link, LinkReady, LinkStateId::READY, Send>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Send& event)
+    {
+      get_fsm_context().sent += event.data;
+      return LinkStateId::BUSY;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  //***********************************
+  class LinkBusy : public etl::fsm_state<Link, LinkBusy, LinkStateId::BUSY, Send, Ack>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router& source, const Send& event)
+    {
+      get_fsm_context().defer(source, event);
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Ack&)
+    {
+      return LinkStateId::READY;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  //***********************************
+  struct LinkStates
+  {
+    LinkStates(Link& link)
+    {
+      ready.set_parent(connected);
+      busy.set_parent(connected);
+
+      etl::ifsm_state* states[LinkStateId::NUMBER_OF_STATES] = { &disconnected, &connected, &ready, &busy };
+
+      for (size_t i = 0U; i < LinkStateId::NUMBER_OF_STATES; ++i)
+      {
+        list[i] = states[i];
+      }
+
+      link.set_states(list, LinkStateId::NUMBER_OF_STATES);
+      link.set_deferred_queue(link.deferred);
+      link.start();
+    }
+
+    LinkDisconnected disconnected;
+    LinkConnected    connected;
+    LinkReady        ready;
+    LinkBusy         busy;
+    etl::ifsm_state* list[LinkStateId::NUMBER_OF_STATES];
+  };
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_STATE_FORCE_CPP03)
+  //***************************************************************************
+  // A state with more than 16 events.
+  //***************************************************************************
+  template <etl::message_id_t ID>
+  struct Numbered : public etl::message<ID>
+  {
+  };
+
+  //***********************************
+  class Counter : public etl::fsm
+  {
+  public:
+
+    Counter()
+      : fsm(2),
+        total(0)
+    {
+    }
+
+    int total;
+  };
+
+  //***********************************
+  class Counting : public etl::fsm_state<Counter, Counting, 0,
+                                         Numbered<0>,  Numbered<1>,  Numbered<2>,  Numbered<3>,  Numbered<4>,  Numbered<5>,
+                                         Numbered<6>,  Numbered<7>,  Numbered<8>,  Numbered<9>,  Numbered<10>, Numbered<11>,
+                                         Numbered<12>, Numbered<13>, Numbered<14>, Numbered<15>, Numbered<16>, Numbered<17>>
+  {
+  public:
+
+    template <etl::message_id_t ID>
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Numbered<ID>&)
+    {
+      get_fsm_context().total += ID;
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      get_fsm_context().total = -1;
+      return STATE_ID;
+    }
+  };
+#endif
+
+  SUITE(test_fsm_hierarchy)
+  {
+    //*************************************************************************
+    TEST(test_unhandled_events_go_to_parent)
+    {
+      Link link;
+      LinkStates states(link);
+
+      CHECK(!states.disconnected.has_parent());
+      CHECK(states.ready.has_parent());
+      CHECK(&states.busy.get_parent() == &states.connected);
+
+      link.receive(Connect());
+      CHECK_EQUAL(int(LinkStateId::READY), int(link.get_state_id()));
+
+      // Handled by the parent, staying in the child state.
+      link.receive(Ping());
+      CHECK_EQUAL(int(LinkStateId::READY), int(link.get_state_id()));
+      CHECK_EQUAL(1, link.pings);
+
+      link.receive(Send("a"));
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+
+      link.receive(Ping());
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+      CHECK_EQUAL(2, link.pings);
+
+      // Unknown to both go to the parent's on_event_unknown.
+      link.receive(Connect());
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+      CHECK_EQUAL(1, link.unknown);
+
+      // Transition from the parent's handler.
+      link.receive(Disconnect());
+      CHECK_EQUAL(int(LinkStateId::DISCONNECTED), int(link.get_state_id()));
+
+      // No parent.
+      link.receive(Ping());
+      CHECK_EQUAL(2, link.pings);
+      CHECK_EQUAL(2, link.unknown);
+    }
+
+    //*************************************************************************
+    TEST(test_deferred_events_are_replayed_after_state_change)
+    {
+      Link link;
+      LinkStates states(link);
+
+      CHECK_EQUAL(3U, link.deferred.max_size());
+
+      // Deferred while disconnected.
+      link.receive(Send("a"));
+      link.receive(Send("b"));
+      CHECK_EQUAL(2U, link.deferred.size());
+      CHECK_EQUAL(std::string(""), link.sent);
+
+      // 'a' is sent on connection, 'b' is deferred again by Busy.
+      link.receive(Connect());
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+      CHECK_EQUAL(std::string("a"), link.sent);
+      CHECK_EQUAL(1U, link.deferred.size());
+
+      link.receive(Send("c"));
+      CHECK_EQUAL(2U, link.deferred.size());
+
+      // Each Ack releases the next deferred send, in order.
+      link.receive(Ack());
+      CHECK_EQUAL(std::string("ab"), link.sent);
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+
+      link.receive(Ack());
+      CHECK_EQUAL(std::string("abc"), link.sent);
+      CHECK(link.deferred.empty());
+
+      link.receive(Ack());
+      CHECK_EQUAL(int(LinkStateId::READY), int(link.get_state_id()));
+      CHECK_EQUAL(std::string("abc"), link.sent);
+    }
+
+    //*************************************************************************
+    TEST(test_receive_batch)
+    {
+      Link link;
+      LinkStates states(link);
+
+      typedef etl::message_router<LinkRouter, Connect, Send, Ack, Ping>::message_packet Packet;
+
+      const Packet packets[] = { Packet(Send("a")), Packet(Connect()), Packet(Send("b")), Packet(Ping()), Packet(Ack()) };
+
+      // Handled in order, with the deferred events replayed between them.
+      link.receive_batch(packets, 5U);
+      CHECK_EQUAL(std::string("ab"), link.sent);
+      CHECK_EQUAL(1, link.pings);
+      CHECK_EQUAL(int(LinkStateId::BUSY), int(link.get_state_id()));
+      CHECK(link.deferred.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_deferred_queue_full)
+    {
+      Link link;
+      LinkStates states(link);
+
+      CHECK(link.defer(etl::null_message_router::instance(), Send("a")));
+      CHECK(link.defer(etl::null_message_router::instance(), Send("b")));
+      CHECK(link.defer(etl::null_message_router::instance(), Send("c")));
+      CHECK(!link.defer(etl::null_message_router::instance(), Send("d")));
+      CHECK_EQUAL(3U, link.deferred.size());
+
+      link.reset();
+      CHECK(link.deferred.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_defer_without_queue)
+    {
+      Link link;
+
+      CHECK(!link.defer(etl::null_message_router::instance(), Send("a")));
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_STATE_FORCE_CPP03)
+    //*************************************************************************
+    TEST(test_more_than_16_events)
+    {
+      Counter  counter;
+      Counting counting;
+
+      etl::ifsm_state* list[] = { &counting };
+      counter.set_states(list, 1U);
+      counter.start();
+
+      counter.receive(Numbered<17>());
+      counter.receive(Numbered<3>());
+      CHECK_EQUAL(20, counter.total);
+
+      counter.receive(Numbered<18>());
+      CHECK_EQUAL(-1, counter.total);
+    }
+#endif
+  }
 }
@@ -0,0 +1,162 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+
+#include "etl/fsm_trace.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  etl::fsm_trace_timestamp_t clock_time;
+
+  etl::fsm_trace_timestamp_t clock_now()
+  {
+    return clock_time;
+  }
+
+  SUITE(test_fsm_trace)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::fsm_trace<4> trace(clock_now);
+
+      CHECK_EQUAL(4U, trace.capacity());
+      CHECK_EQUAL(0U, trace.size());
+      CHECK_EQUAL(0U, trace.written());
+      CHECK(trace.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_record)
+    {
+      etl::fsm_trace<4> trace(clock_now);
+      etl::fsm_trace_record records[4];
+
+      clock_time = 25U;
+      trace.record(1, 2, 3, 10U);
+
+      CHECK_EQUAL(1U, trace.size());
+      CHECK(!trace.empty());
+      CHECK_EQUAL(1U, trace.copy(records, 4U));
+
+      CHECK_EQUAL(1,   records[0].state_from);
+      CHECK_EQUAL(2,   records[0].state_to);
+      CHECK_EQUAL(3,   records[0].message_id);
+      CHECK_EQUAL(10U, records[0].timestamp);
+      CHECK_EQUAL(15U, records[0].duration);
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::fsm_trace<4> trace(clock_now);
+      etl::fsm_trace_record records[4];
+
+      for (int i = 0; i < 10; ++i)
+      {
+        trace.record(i, i + 1, 0, 0U);
+      }
+
+      CHECK_EQUAL(10U, trace.written());
+      CHECK_EQUAL(4U, trace.size());
+
+      // The latest four, oldest first.
+      CHECK_EQUAL(4U, trace.copy(records, 4U));
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(6 + i, records[i].state_from);
+      }
+
+      // The latest two.
+      CHECK_EQUAL(2U, trace.copy(records, 2U));
+      CHECK_EQUAL(8, records[0].state_from);
+      CHECK_EQUAL(9, records[1].state_from);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::fsm_trace<4> trace(clock_now);
+      etl::fsm_trace_record records[4];
+
+      trace.record(1, 2, 3, 0U);
+      trace.record(2, 3, 4, 0U);
+      trace.clear();
+
+      CHECK(trace.empty());
+      CHECK_EQUAL(0U, trace.copy(records, 4U));
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::fsm_trace<16> trace(clock_now);
+      const int N_RECORDS = 1000000;
+
+      std::thread writer([]()
+      {
+        for (int i = 0; i < N_RECORDS; ++i)
+        {
+          trace.record(i, i + 1, i + 2, 0U);
+        }
+      });
+
+      // Every copy must be a run of consecutive, untorn records.
+      bool ok = true;
+      etl::fsm_trace_record records[16];
+
+      while (trace.written() < size_t(N_RECORDS))
+      {
+        size_t n = trace.copy(records, 16U);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          ok = ok && (records[i].state_to   == records[i].state_from + 1);
+          ok = ok && (records[i].message_id == records[i].state_from + 2);
+          ok = ok && ((i == 0U) || (records[i].state_from == records[i - 1U].state_from + 1));
+        }
+      }
+
+      writer.join();
+
+      CHECK(ok);
+    }
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,382 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/future.h"
+#include "etl/scheduler.h"
+#include "etl/function.h"
+
+namespace
+{
+  //***************************************************************************
+  struct Idle
+  {
+    Idle(etl::ischeduler& scheduler_)
+      : scheduler(scheduler_)
+    {
+    }
+
+    void idle()
+    {
+      scheduler.exit_scheduler();
+    }
+
+    etl::ischeduler& scheduler;
+  };
+
+  SUITE(test_future)
+  {
+    //*************************************************************************
+    TEST(test_set_value_get)
+    {
+      etl::future_pool<int, 2> pool;
+
+      etl::promise<int> p(pool);
+      etl::future<int>  f = p.get_future();
+
+      CHECK(p.valid());
+      CHECK(f.valid());
+      CHECK(!f.is_ready());
+      CHECK(!f.is_broken());
+      CHECK_EQUAL(1U, pool.size());
+
+      CHECK(p.set_value(42));
+      CHECK(!p.set_value(43));
+      CHECK(f.is_ready());
+      CHECK_EQUAL(42, f.get());
+    }
+
+    //*************************************************************************
+    TEST(test_state_returned_to_pool)
+    {
+      etl::future_pool<int, 1> pool;
+
+      {
+        etl::promise<int> p(pool);
+        etl::future<int>  f = p.get_future();
+        CHECK(pool.full());
+      }
+
+      CHECK(pool.empty());
+
+      etl::promise<int> p(pool);
+      CHECK(p.valid());
+    }
+
+    //*************************************************************************
+    TEST(test_get_future_once)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::promise<int> p(pool);
+      etl::future<int>  f1 = p.get_future();
+      etl::future<int>  f2 = p.get_future();
+
+      CHECK(f1.valid());
+      CHECK(!f2.valid());
+    }
+
+    //*************************************************************************
+    TEST(test_get_not_ready)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::promise<int> p(pool);
+      etl::future<int>  f = p.get_future();
+
+      CHECK_THROW(f.get(), etl::future_not_ready);
+    }
+
+    //*************************************************************************
+    TEST(test_pool_full)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::promise<int> p1(pool);
+
+      CHECK_THROW(etl::promise<int> p2(pool), etl::future_pool_full);
+    }
+
+    //*************************************************************************
+    TEST(test_broken_promise)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::future<int> f;
+
+      {
+        etl::promise<int> p(pool);
+        f = p.get_future();
+      }
+
+      CHECK(f.is_broken());
+      CHECK(!f.is_ready());
+      CHECK_THROW(f.get(), etl::future_not_ready);
+    }
+
+    //*************************************************************************
+    TEST(test_then_inline)
+    {
+      etl::future_pool<int, 1> pool;
+
+      int result = 0;
+
+      etl::promise<int> p(pool);
+      p.get_future().then([&result](int value) { result = value; });
+
+      CHECK_EQUAL(0, result);
+      p.set_value(7);
+      CHECK_EQUAL(7, result);
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_then_after_ready)
+    {
+      etl::future_pool<int, 1> pool;
+
+      int result = 0;
+
+      {
+        etl::promise<int> p(pool);
+        etl::future<int>  f = p.get_future();
+        p.set_value(9);
+
+        f.then([&result](int value) { result = value; });
+        CHECK(!f.valid());
+        CHECK_EQUAL(9, result);
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_then_not_called_when_broken)
+    {
+      etl::future_pool<int, 1> pool;
+
+      bool called = false;
+
+      {
+        etl::promise<int> p(pool);
+        p.get_future().then([&called](int) { called = true; });
+      }
+
+      CHECK(!called);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_then_on_executor)
+    {
+      etl::future_pool<int, 1> pool;
+      etl::future_executor     executor;
+
+      int result = 0;
+
+      {
+        etl::promise<int> p(pool);
+        p.get_future().then([&result](int value) { result = value; }, &executor);
+        p.set_value(5);
+      }
+
+      CHECK_EQUAL(0, result);
+      CHECK_EQUAL(1U, executor.size());
+      CHECK_EQUAL(1U, executor.task_request_work());
+      CHECK(pool.full());
+
+      executor.task_process_work();
+
+      CHECK_EQUAL(5, result);
+      CHECK(executor.empty());
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_then_on_scheduler)
+    {
+      typedef etl::scheduler<etl::scheduler_policy_sequencial_single, 1> Scheduler;
+
+      etl::future_pool<int, 2> pool;
+      etl::future_executor     executor;
+      Scheduler                scheduler;
+
+      Idle idle(scheduler);
+      etl::function<Idle, void> idle_callback(idle, &Idle::idle);
+      scheduler.set_idle_callback(idle_callback);
+      scheduler.add_task(executor);
+
+      int sum = 0;
+
+      etl::promise<int> p1(pool);
+      etl::promise<int> p2(pool);
+      p1.get_future().then([&sum](int value) { sum += value; }, &executor);
+      p2.get_future().then([&sum](int value) { sum += value; }, &executor);
+      p1.set_value(1);
+      p2.set_value(2);
+
+      CHECK_EQUAL(0, sum);
+
+      scheduler.start();
+
+      CHECK_EQUAL(3, sum);
+      CHECK(executor.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_then_chained)
+    {
+      etl::future_pool<int, 1>    int_pool;
+      etl::future_pool<double, 1> double_pool;
+      etl::future_executor        executor;
+
+      etl::promise<int>   p(int_pool);
+      etl::future<double> f = p.get_future().then(double_pool, [](int value) { return value * 1.5; }, &executor);
+
+      CHECK(f.valid());
+      CHECK(!f.is_ready());
+
+      p.set_value(4);
+      CHECK(!f.is_ready());
+
+      executor.run_all();
+
+      CHECK(f.is_ready());
+      CHECK_CLOSE(6.0, f.get(), 0.0001);
+      CHECK(executor.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_then_chained_continues)
+    {
+      etl::future_pool<int, 2> pool;
+
+      int result = 0;
+
+      etl::promise<int> p(pool);
+      p.get_future().then(pool, [](int value) { return value + 1; })
+                    .then([&result](int value) { result = value; });
+
+      p.set_value(10);
+
+      CHECK_EQUAL(11, result);
+    }
+
+    //*************************************************************************
+    TEST(test_then_chained_broken)
+    {
+      etl::future_pool<int, 2> pool;
+
+      bool called = false;
+
+      etl::future<int> f;
+
+      {
+        etl::promise<int> p(pool);
+        f = p.get_future().then(pool, [&called](int value) { called = true; return value; });
+      }
+
+      CHECK(!called);
+      CHECK(f.is_broken());
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_when_all)
+    {
+      typedef etl::array<int, 3> Result;
+
+      etl::future_pool<int, 3>    pool;
+      etl::future_pool<Result, 1> result_pool;
+
+      etl::promise<int> p0(pool);
+      etl::promise<int> p1(pool);
+      etl::promise<int> p2(pool);
+
+      etl::array<etl::future<int>, 3> futures;
+      futures[0] = p0.get_future();
+      futures[1] = p1.get_future();
+      futures[2] = p2.get_future();
+
+      etl::future<Result> all = etl::when_all(futures, result_pool);
+
+      CHECK(!futures[0].valid());
+      CHECK(all.valid());
+
+      p2.set_value(30);
+      p0.set_value(10);
+      CHECK(!all.is_ready());
+
+      p1.set_value(20);
+      CHECK(all.is_ready());
+      CHECK_EQUAL(10, all.get()[0]);
+      CHECK_EQUAL(20, all.get()[1]);
+      CHECK_EQUAL(30, all.get()[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_when_all_broken)
+    {
+      typedef etl::array<int, 2> Result;
+
+      etl::future_pool<int, 2>    pool;
+      etl::future_pool<Result, 1> result_pool;
+
+      etl::promise<int> p0(pool);
+
+      etl::array<etl::future<int>, 2> futures;
+      futures[0] = p0.get_future();
+
+      {
+        etl::promise<int> p1(pool);
+        futures[1] = p1.get_future();
+      }
+
+      etl::future<Result> all = etl::when_all(futures, result_pool);
+
+      CHECK(!all.is_broken());
+      p0.set_value(1);
+      CHECK(all.is_broken());
+    }
+
+    //*************************************************************************
+    TEST(test_when_all_invalid_input)
+    {
+      typedef etl::array<int, 1> Result;
+
+      etl::future_pool<Result, 1>     result_pool;
+      etl::array<etl::future<int>, 1> futures;
+
+      etl::future<Result> all = etl::when_all(futures, result_pool);
+
+      CHECK(all.is_broken());
+    }
+  }
+}
@@ -0,0 +1,259 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <set>
+#include <string>
+
+#include "etl/growable_unordered_map.h"
+#include "etl/unordered_map.h"
+
+namespace
+{
+  typedef etl::growable_unordered_map<int, std::string> Map;
+  typedef Map::storage<8, 4>   SmallStorage;
+  typedef Map::storage<32, 16> LargeStorage;
+
+  //*************************************************************************
+  std::set<int> keys_of(const Map& map)
+  {
+    std::set<int> keys;
+
+    for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      keys.insert(itr->first);
+    }
+
+    return keys;
+  }
+
+  SUITE(test_growable_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_external_storage_unordered_map)
+    {
+      typedef etl::unordered_map<int, int, 0, 0> ExtMap;
+
+      etl::pool<ExtMap::pool_type, 10> pool;
+      ExtMap::bucket_type              buckets[40];
+      ExtMap::occupancy_type           occupied[2];
+
+      CHECK_EQUAL(2U, ExtMap::occupancy_size(40));
+      CHECK_EQUAL(1U, ExtMap::occupancy_size(32));
+
+      ExtMap map(pool, buckets, 40, occupied);
+
+      CHECK_EQUAL(40U, map.bucket_count());
+      CHECK_EQUAL(10U, map.max_size());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        map.insert(ExtMap::value_type(i * 7, i));
+      }
+
+      CHECK(map.full());
+      CHECK_EQUAL(4, map.at(28));
+      CHECK_EQUAL(10, std::distance(map.begin(), map.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      SmallStorage small;
+      Map map(small.get());
+
+      CHECK(map.empty());
+      CHECK_EQUAL(8U, map.max_size());
+      CHECK_EQUAL(4U, map.bucket_count());
+
+      CHECK(map.insert(Map::value_type(1, "1")).second);
+      CHECK(map.insert(Map::value_type(2, "2")).second);
+      CHECK(!map.insert(Map::value_type(1, "x")).second);
+
+      CHECK_EQUAL(2U, map.size());
+      CHECK_EQUAL(std::string("1"), map.at(1));
+      CHECK(map.find(3) == map.end());
+      CHECK(!map.is_migrating());
+    }
+
+    //*************************************************************************
+    TEST(test_migrate_by_steps)
+    {
+      SmallStorage small;
+      LargeStorage large;
+
+      Map map(small.get());
+
+      for (int i = 0; i < 8; ++i)
+      {
+        map[i] = std::to_string(i);
+      }
+
+      CHECK(map.full());
+      CHECK(map.migrate_to(large.get()));
+      CHECK(map.is_migrating());
+      CHECK(!map.migrate_to(small.get()));
+
+      CHECK_EQUAL(16U, map.bucket_count());
+      CHECK_EQUAL(32U, map.max_size());
+      CHECK_EQUAL(8U, map.size());
+
+      // Every element is visible from either table.
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), map.at(i));
+      }
+
+      CHECK_EQUAL(8U, keys_of(map).size());
+
+      // One of the four buckets at a time.
+      size_t steps = 0U;
+
+      while (map.migrate_step(1U))
+      {
+        ++steps;
+        CHECK_EQUAL(8U, map.size());
+        CHECK_EQUAL(8U, keys_of(map).size());
+      }
+
+      CHECK_EQUAL(3U, steps);
+      CHECK(!map.is_migrating());
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), map.at(i));
+      }
+
+      // The small buffers are free again.
+      CHECK_EQUAL(8U, small.get().pnode_pool->available());
+      CHECK_EQUAL(24U, large.get().pnode_pool->available());
+    }
+
+    //*************************************************************************
+    TEST(test_migrate_amortised_into_inserts)
+    {
+      SmallStorage small;
+      LargeStorage large;
+
+      Map map(small.get(), 2U);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        map.insert(Map::value_type(i, std::to_string(i)));
+      }
+
+      CHECK(map.migrate_to(large.get()));
+
+      // Room is kept for the elements still to migrate.
+      CHECK_EQUAL(24U, map.available());
+
+      // Each insert migrates two of the four buckets.
+      // An existing key in the previous table is not duplicated.
+      CHECK(!map.insert(Map::value_type(7, "x")).second);
+      CHECK(map.is_migrating());
+      CHECK(map.insert(Map::value_type(8, "8")).second);
+      CHECK(!map.is_migrating());
+      CHECK(map.insert(Map::value_type(9, "9")).second);
+
+      CHECK_EQUAL(10U, map.size());
+      CHECK_EQUAL(std::string("7"), map.at(7));
+      CHECK_EQUAL(std::string("9"), map.at(9));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_migrating)
+    {
+      SmallStorage small;
+      LargeStorage large;
+
+      Map map(small.get());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        map.insert(Map::value_type(i, std::to_string(i)));
+      }
+
+      map.migrate_to(large.get());
+      map.migrate_step(1U);
+
+      CHECK_EQUAL(1U, map.erase(0));
+      CHECK_EQUAL(1U, map.erase(3));
+      CHECK_EQUAL(0U, map.erase(3));
+      CHECK_EQUAL(2U, map.size());
+      CHECK_EQUAL(0U, map.count(0));
+      CHECK_EQUAL(1U, map.count(1));
+
+      map.insert(Map::value_type(10, "10"));
+      map.migrate_all();
+
+      CHECK(!map.is_migrating());
+      CHECK_EQUAL(3U, map.size());
+      CHECK(map.contains(10));
+    }
+
+    //*************************************************************************
+    TEST(test_migrate_empty_and_clear)
+    {
+      SmallStorage small;
+      LargeStorage large;
+
+      Map map(small.get());
+
+      CHECK(map.migrate_to(large.get()));
+      CHECK(!map.is_migrating());
+
+      map.insert(Map::value_type(1, "1"));
+      CHECK(map.migrate_to(small.get()));
+      CHECK(map.is_migrating());
+
+      map.clear();
+      CHECK(!map.is_migrating());
+      CHECK(map.empty());
+      CHECK_EQUAL(4U, map.bucket_count());
+    }
+
+    //*************************************************************************
+    TEST(test_migrate_to_too_small)
+    {
+      SmallStorage small;
+      LargeStorage large;
+
+      Map map(large.get());
+
+      for (int i = 0; i < 9; ++i)
+      {
+        map.insert(Map::value_type(i, std::to_string(i)));
+      }
+
+      CHECK(!map.migrate_to(small.get()));
+      CHECK(!map.is_migrating());
+      CHECK_EQUAL(16U, map.bucket_count());
+    }
+  };
+}
@@ -32,11 +32,76 @@ SOFTWARE.
 #include <string>
 #include <vector>
 #include <stdint.h>
+#include <string.h>
 
 #include "etl/hash.h"
+#include "etl/cstring.h"
+#include "etl/u16string.h"
+#include "etl/string_view.h"
 
 namespace
 {
+  //***************************************************************************
+  // Reference MurmurHash2 and MurmurHash64A, little endian.
+  //***************************************************************************
+  uint32_t murmur_hash2(const void* key, size_t len, uint32_t seed)
+  {
+    const uint32_t m = 0x5bd1e995;
+    uint32_t h = seed ^ uint32_t(len);
+    const uint8_t* data = (const uint8_t*)key;
+
+    while (len >= 4)
+    {
+      uint32_t k;
+      memcpy(&k, data, 4);
+      k *= m; k ^= k >> 24; k *= m;
+      h *= m; h ^= k;
+      data += 4; len -= 4;
+    }
+
+    switch (len)
+    {
+      case 3: h ^= data[2] << 16; // fall through
+      case 2: h ^= data[1] << 8;  // fall through
+      case 1: h ^= data[0]; h *= m;
+    };
+
+    h ^= h >> 13; h *= m; h ^= h >> 15;
+
+    return h;
+  }
+
+  uint64_t murmur_hash64a(const void* key, size_t len, uint64_t seed)
+  {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    uint64_t h = seed ^ (len * m);
+    const uint8_t* data = (const uint8_t*)key;
+
+    while (len >= 8)
+    {
+      uint64_t k;
+      memcpy(&k, data, 8);
+      k *= m; k ^= k >> 47; k *= m;
+      h ^= k; h *= m;
+      data += 8; len -= 8;
+    }
+
+    switch (len)
+    {
+      case 7: h ^= uint64_t(data[6]) << 48; // fall through
+      case 6: h ^= uint64_t(data[5]) << 40; // fall through
+      case 5: h ^= uint64_t(data[4]) << 32; // fall through
+      case 4: h ^= uint64_t(data[3]) << 24; // fall through
+      case 3: h ^= uint64_t(data[2]) << 16; // fall through
+      case 2: h ^= uint64_t(data[1]) << 8;  // fall through
+      case 1: h ^= uint64_t(data[0]); h *= m;
+    };
+
+    h ^= h >> 47; h *= m; h ^= h >> 47;
+
+    return h;
+  }
+
   SUITE(test_hash)
   {
     //*************************************************************************
@@ -213,6 +278,75 @@ namespace
 
       CHECK_EQUAL(size_t(&i), hash);
     }
+
+    //*************************************************************************
+    TEST(test_hash_string_word_sizes)
+    {
+      const char text[] = "The quick brown fox jumps over the lazy dog";
+
+      for (size_t length = 0U; length < sizeof(text); ++length)
+      {
+        CHECK_EQUAL(murmur_hash2(text, length, 0x9747B28CUL), etl::private_hash::string_hash_32(text, length));
+        CHECK_EQUAL(murmur_hash64a(text, length, 0x9747B28CULL), etl::private_hash::string_hash_64(text, length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hash_string_wide_characters)
+    {
+      const char16_t text[] = u"The quick brown fox";
+
+      for (size_t length = 0U; length < (sizeof(text) / sizeof(char16_t)); ++length)
+      {
+        // Little endian platform, so the byte order matches memory.
+        CHECK_EQUAL(murmur_hash2(text, length * sizeof(char16_t), 0x9747B28CUL), etl::private_hash::string_hash_32(text, length));
+        CHECK_EQUAL(murmur_hash64a(text, length * sizeof(char16_t), 0x9747B28CULL), etl::private_hash::string_hash_64(text, length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hash_string_types_agree)
+    {
+      etl::string<20>    text("ABCDEFHIJKL");
+      etl::string_view   view(text.data(), text.size());
+      etl::u16string<20> u16text(u"ABCDEFHIJKL");
+
+      size_t expected = etl::hash_string("ABCDEFHIJKL");
+
+      CHECK_EQUAL(expected, etl::hash<etl::string<20> >()(text));
+      CHECK_EQUAL(expected, etl::hash<etl::istring>()(text));
+      CHECK_EQUAL(expected, etl::hash<etl::string_view>()(view));
+      CHECK_EQUAL(etl::hash_string(u"ABCDEFHIJKL"), etl::hash<etl::iu16string>()(u16text));
+      CHECK(etl::hash_string("ABCDEFHIJKL") != etl::hash_string("ABCDEFHIJKM"));
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_hash_string_constexpr)
+    {
+      constexpr size_t hash = etl::hash_string("ABCDEFHIJKL");
+      constexpr size_t view_hash = etl::hash<etl::string_view>()(etl::string_view("ABCDEFHIJKL", 11));
+
+      etl::string<20> text("ABCDEFHIJKL");
+
+      CHECK_EQUAL(hash, etl::hash<etl::string<20> >()(text));
+      CHECK_EQUAL(hash, view_hash);
+    }
+
+    //*************************************************************************
+    TEST(test_hash_integral_constexpr)
+    {
+      constexpr size_t hash_char  = etl::hash<char>()('A');
+      constexpr size_t hash_int   = etl::hash<int>()(0x1234);
+      constexpr size_t hash_ulong = etl::hash<unsigned long>()(0x12345678UL);
+      constexpr size_t hash_ll    = etl::hash<long long>()(0x123456789ALL);
+
+      CHECK_EQUAL(etl::hash<char>()('A'), hash_char);
+      CHECK_EQUAL(etl::hash<int>()(0x1234), hash_int);
+      CHECK_EQUAL(etl::hash<unsigned long>()(0x12345678UL), hash_ulong);
+      CHECK_EQUAL(etl::hash<long long>()(0x123456789ALL), hash_ll);
+    }
+#endif
   };
 }
 
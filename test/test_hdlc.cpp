@@ -0,0 +1,174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/hdlc.h"
+
+#include <stdint.h>
+#include <vector>
+#include <iterator>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  template <typename TEncoder>
+  Bytes encode(const Bytes& data)
+  {
+    TEncoder encoder;
+    Bytes    result;
+
+    encoder.encode(data.data(), data.data() + data.size(), std::back_inserter(result));
+
+    CHECK(result.size() <= TEncoder::max_encoded_size(data.size()));
+
+    return result;
+  }
+
+  SUITE(test_hdlc)
+  {
+    //*************************************************************************
+    TEST(test_encode_without_fcs)
+    {
+      CHECK((Bytes{ 0x7E, 0x01, 0x7D, 0x5E, 0x7D, 0x5D, 0x02, 0x7E }) == encode<etl::hdlc_encoder<etl::no_frame_check> >(Bytes{ 0x01, 0x7E, 0x7D, 0x02 }));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_with_default_fcs)
+    {
+      // The 16 bit FCS of "123456789" is 0x906E.
+      const Bytes data = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+      Bytes expected = { 0x7E, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x6E, 0x90, 0x7E };
+
+      CHECK(expected == encode<etl::hdlc_encoder<> >(data));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_escapes_fcs)
+    {
+      // Find data whose FCS starts with a flag byte.
+      bool found = false;
+
+      for (int i = 0; (i < 65536) && !found; ++i)
+      {
+        Bytes data = { uint8_t(i), uint8_t(i >> 8) };
+
+        etl::crc16_x25 crc(data.begin(), data.end());
+        uint16_t fcs = crc.value();
+
+        if (((fcs & 0xFFU) == 0x7EU) && (data[0] < 0x7DU) && (data[1] < 0x7DU) && ((fcs >> 8) < 0x7DU))
+        {
+          Bytes encoded = encode<etl::hdlc_encoder<> >(data);
+
+          CHECK_EQUAL(7U, encoded.size());
+          CHECK_EQUAL(0x7DU, encoded[3]);
+          CHECK_EQUAL(0x5EU, encoded[4]);
+          found = true;
+        }
+      }
+
+      CHECK(found);
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_byte_by_byte)
+    {
+      Bytes data;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.push_back(uint8_t(0x7C + (i % 4)));
+      }
+
+      Bytes encoded = encode<etl::hdlc_encoder<> >(data);
+
+      uint8_t buffer[302];
+      etl::hdlc_decoder<> decoder(buffer, sizeof(buffer));
+
+      for (size_t i = 0U; i < encoded.size(); ++i)
+      {
+        decoder.decode(&encoded[i], &encoded[i] + 1U);
+      }
+
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(data.size(), decoder.size());
+      CHECK_ARRAY_EQUAL(data.data(), decoder.data(), data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_flags_and_abort)
+    {
+      Bytes a = encode<etl::hdlc_encoder<> >(Bytes{ 0x01, 0x02 });
+      Bytes b = encode<etl::hdlc_encoder<> >(Bytes{ 0x03 });
+
+      // Frames may share a flag.
+      Bytes stream(a);
+      stream.insert(stream.end(), b.begin() + 1, b.end());
+
+      // An aborted frame.
+      const uint8_t aborted[] = { 0x04, 0x05, 0x7D, 0x7E };
+      stream.insert(stream.end(), aborted, aborted + sizeof(aborted));
+
+      uint8_t buffer[16];
+      etl::hdlc_decoder<> decoder(buffer, sizeof(buffer));
+
+      const uint8_t* p   = stream.data();
+      const uint8_t* end = stream.data() + stream.size();
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(2U, decoder.size());
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(1U, decoder.size());
+      CHECK_EQUAL(0x03U, decoder.data()[0]);
+
+      p = decoder.decode(p, end);
+      CHECK_EQUAL(etl::framing_status::FORMAT_ERROR, decoder.status());
+      CHECK(p == end);
+    }
+
+    //*************************************************************************
+    TEST(test_fcs_error)
+    {
+      Bytes encoded = encode<etl::hdlc_encoder<> >(Bytes{ 0x10, 0x20, 0x30 });
+      encoded[3] ^= 0x01;
+
+      uint8_t buffer[16];
+      etl::hdlc_decoder<> decoder(buffer, sizeof(buffer));
+
+      decoder.decode(encoded.data(), encoded.data() + encoded.size());
+      CHECK_EQUAL(etl::framing_status::FCS_ERROR, decoder.status());
+    }
+  }
+}
@@ -0,0 +1,151 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/hex.h"
+#include "etl/cstring.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+namespace
+{
+  const uint8_t data[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x00, 0xFF };
+
+  SUITE(test_hex)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      CHECK_EQUAL(20U, etl::hex_encoded_size(10U));
+      CHECK_EQUAL(20U, (etl::hex_encoded_length<10>::value));
+      CHECK_EQUAL(5U,  etl::hex_decoded_size(10U));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_to_array_view)
+    {
+      char buffer[20];
+
+      size_t n = etl::hex_encode(data, data + sizeof(data), etl::array_view<char>(buffer));
+      CHECK_EQUAL(std::string("0123456789abcdef00ff"), std::string(buffer, n));
+
+      n = etl::hex_encode(etl::array_view<const uint8_t>(data), etl::array_view<char>(buffer), true);
+      CHECK_EQUAL(std::string("0123456789ABCDEF00FF"), std::string(buffer, n));
+
+      char small[19];
+      CHECK_EQUAL(0U, etl::hex_encode(data, data + sizeof(data), etl::array_view<char>(small)));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_to_string_appends)
+    {
+      etl::string<12> text("id:");
+
+      CHECK(etl::hex_encode(data, data + 4, text, true));
+      CHECK_EQUAL(std::string("id:01234567"), std::string(text.c_str()));
+
+      CHECK(!etl::hex_encode(data, data + 1, text));
+      CHECK_EQUAL(std::string("id:01234567"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_decode_either_case)
+    {
+      const char* text = "0123456789abcdefABCDEF00ff";
+      uint8_t buffer[13];
+
+      size_t n = etl::hex_decode(text, text + strlen(text), etl::array_view<uint8_t>(buffer));
+
+      const uint8_t expected[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xAB, 0xCD, 0xEF, 0x00, 0xFF };
+
+      CHECK_EQUAL(13U, n);
+      CHECK_ARRAY_EQUAL(expected, buffer, 13U);
+    }
+
+    //*************************************************************************
+    TEST(test_decode_invalid)
+    {
+      uint8_t buffer[8];
+
+      const char* odd = "abc";
+      CHECK_EQUAL(0U, etl::hex_decode(odd, odd + 3, etl::array_view<uint8_t>(buffer)));
+
+      // In the four byte path and in the tail.
+      const char* bad1 = "0011223g44";
+      CHECK_EQUAL(0U, etl::hex_decode(bad1, bad1 + 10, etl::array_view<uint8_t>(buffer)));
+
+      const char* bad2 = "00112233 4";
+      CHECK_EQUAL(0U, etl::hex_decode(bad2, bad2 + 10, etl::array_view<uint8_t>(buffer)));
+
+      const char* large = "001122334455667788";
+      CHECK_EQUAL(0U, etl::hex_decode(large, large + 18, etl::array_view<uint8_t>(buffer)));
+    }
+
+    //*************************************************************************
+    TEST(test_decode_to_vector)
+    {
+      etl::vector<uint8_t, 4> bytes;
+
+      CHECK(etl::hex_decode("beef", "beef" + 4, bytes));
+      CHECK_EQUAL(2U, bytes.size());
+      CHECK_EQUAL(0xBEU, bytes[0]);
+      CHECK_EQUAL(0xEFU, bytes[1]);
+
+      CHECK(!etl::hex_decode("zz", "zz" + 2, bytes));
+      CHECK_EQUAL(2U, bytes.size());
+
+      CHECK(!etl::hex_decode("010203", "010203" + 6, bytes));
+      CHECK_EQUAL(2U, bytes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      uint8_t all[256];
+
+      for (int i = 0; i < 256; ++i)
+      {
+        all[i] = uint8_t(i);
+      }
+
+      char    text[etl::hex_encoded_length<256>::value];
+      uint8_t decoded[256];
+
+      size_t n = etl::hex_encode(etl::array_view<const uint8_t>(all, 256U), etl::array_view<char>(text));
+      CHECK_EQUAL(512U, n);
+
+      size_t m = etl::hex_decode(etl::array_view<const char>(text, n), etl::array_view<uint8_t>(decoded));
+      CHECK_EQUAL(256U, m);
+      CHECK_ARRAY_EQUAL(all, decoded, 256U);
+    }
+  }
+}
@@ -0,0 +1,206 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <bitset>
+
+#include "etl/hierarchical_bitset.h"
+
+namespace
+{
+  SUITE(test_hierarchical_bitset)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::hierarchical_bitset<100> data;
+
+      CHECK_EQUAL(100U, data.size());
+      CHECK_EQUAL(0U, data.count());
+      CHECK(data.none());
+      CHECK(!data.any());
+      CHECK(!data.all());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK(!data.test(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_set_reset_flip)
+    {
+      std::bitset<300> compare;
+      etl::hierarchical_bitset<300> data;
+
+      for (size_t i = 0; i < data.size(); i += 7)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      compare.reset(14);
+      data.reset(14);
+      compare.flip(15);
+      data.flip(15);
+      compare.set(16, false);
+      data.set(16, false);
+
+      CHECK_EQUAL(compare.count(), data.count());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare.test(i), data.test(i));
+        CHECK_EQUAL(compare.test(i), data[i]);
+      }
+
+      compare.flip();
+      data.flip();
+
+      CHECK_EQUAL(compare.count(), data.count());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare.test(i), data.test(i));
+      }
+
+      data.set();
+      CHECK(data.all());
+      CHECK_EQUAL(300U, data.count());
+
+      data.reset();
+      CHECK(data.none());
+
+      // Out of range positions are ignored.
+      data.set(300);
+      CHECK(data.none());
+      CHECK(!data.test(300));
+    }
+
+    //*************************************************************************
+    TEST(test_find_first)
+    {
+      etl::hierarchical_bitset<100> data;
+
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_first(true));
+      CHECK_EQUAL(0U, data.find_first(false));
+
+      data.set(70);
+      CHECK_EQUAL(70U, data.find_first(true));
+
+      data.set();
+      CHECK_EQUAL(0U, data.find_first(true));
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_first(false));
+
+      data.reset(99);
+      CHECK_EQUAL(99U, data.find_first(false));
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_big_bitset)
+    {
+      // More than one summary element.
+      etl::hierarchical_bitset<10000> data;
+
+      const size_t positions[] = { 0, 63, 64, 4095, 4096, 4097, 8191, 9999 };
+      const size_t n_positions = sizeof(positions) / sizeof(positions[0]);
+
+      for (size_t i = 0; i < n_positions; ++i)
+      {
+        data.set(positions[i]);
+      }
+
+      CHECK_EQUAL(n_positions, data.count());
+
+      size_t position = data.find_first(true);
+
+      for (size_t i = 0; i < n_positions; ++i)
+      {
+        CHECK_EQUAL(positions[i], position);
+        position = data.find_next(true, position + 1);
+      }
+
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, position);
+
+      // Search the inverse for clear bits.
+      data.flip();
+
+      position = data.find_first(false);
+
+      for (size_t i = 0; i < n_positions; ++i)
+      {
+        CHECK_EQUAL(positions[i], position);
+        position = data.find_next(false, position + 1);
+      }
+
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, position);
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, data.find_next(true, 10000));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_all)
+    {
+      // Use as a free map, claiming the lowest free slot each time.
+      etl::hierarchical_bitset<200> used;
+
+      for (size_t i = 0; i < used.size(); ++i)
+      {
+        size_t slot = used.find_first(false);
+        CHECK_EQUAL(i, slot);
+        used.set(slot);
+      }
+
+      CHECK(used.all());
+      CHECK_EQUAL(etl::ihierarchical_bitset::npos, used.find_first(false));
+
+      used.reset(130);
+      used.reset(5);
+      CHECK_EQUAL(5U, used.find_first(false));
+      CHECK_EQUAL(130U, used.find_next(false, 6));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      etl::hierarchical_bitset<100> data1;
+      data1.set(3).set(64).set(99);
+
+      etl::hierarchical_bitset<100> data2(data1);
+      CHECK(data1 == data2);
+      CHECK_EQUAL(64U, data2.find_next(true, 4));
+
+      data2.reset(64);
+      CHECK(data1 != data2);
+
+      data2 = data1;
+      CHECK(data1 == data2);
+      CHECK_EQUAL(99U, data2.find_next(true, 65));
+    }
+  };
+}
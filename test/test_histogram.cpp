@@ -0,0 +1,273 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/histogram.h"
+#include "etl/benchmark.h"
+
+namespace
+{
+  //***************************************************************************
+  /// A counter that steps by a programmed amount on each read pair.
+  //***************************************************************************
+  struct mock_counter
+  {
+    typedef uint32_t value_type;
+
+    void start()
+    {
+    }
+
+    value_type read() const
+    {
+      value_type value = now;
+      now += step;
+      return value;
+    }
+
+    static const char* unit()
+    {
+      return "ticks";
+    }
+
+    static value_type now;
+    static value_type step;
+  };
+
+  mock_counter::value_type mock_counter::now  = 0U;
+  mock_counter::value_type mock_counter::step = 0U;
+
+  SUITE(test_histogram)
+  {
+    //*************************************************************************
+    TEST(test_geometry)
+    {
+      typedef etl::histogram<1000U, 3U> histogram_t;
+
+      CHECK_EQUAL(8U, histogram_t::SUB_BUCKETS);
+      CHECK_EQUAL(8U, histogram_t::GROUPS);
+      CHECK_EQUAL(64U, histogram_t::BUCKETS);
+
+      // Values below 2^PRECISION have their own bucket.
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(i, histogram_t::index_of(i));
+        CHECK_EQUAL(i, histogram_t::lowest_in_bucket(i));
+        CHECK_EQUAL(i, histogram_t::highest_in_bucket(i));
+      }
+
+      CHECK_EQUAL(8U,  histogram_t::index_of(8U));
+      CHECK_EQUAL(15U, histogram_t::index_of(15U));
+      CHECK_EQUAL(16U, histogram_t::index_of(16U));
+      CHECK_EQUAL(16U, histogram_t::index_of(17U));
+      CHECK_EQUAL(17U, histogram_t::index_of(18U));
+    }
+
+    //*************************************************************************
+    TEST(test_every_value_is_within_its_bucket)
+    {
+      typedef etl::histogram<100000U, 4U> histogram_t;
+
+      for (uint32_t value = 0U; value <= 100000U; ++value)
+      {
+        const size_t index = histogram_t::index_of(value);
+
+        CHECK(index < histogram_t::BUCKETS);
+        CHECK(histogram_t::lowest_in_bucket(index) <= value);
+        CHECK(histogram_t::highest_in_bucket(index) >= value);
+
+        // Within 1 part in 2^PRECISION.
+        CHECK((histogram_t::highest_in_bucket(index) - histogram_t::lowest_in_bucket(index)) <= (value / 16U));
+
+        if ((histogram_t::lowest_in_bucket(index) > value) || (histogram_t::highest_in_bucket(index) < value))
+        {
+          break;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_64_bit_values)
+    {
+      typedef etl::histogram<UINT64_MAX, 3U> histogram_t;
+
+      CHECK_EQUAL(8U, sizeof(histogram_t::value_type));
+      CHECK_EQUAL(62U * 8U, histogram_t::BUCKETS);
+
+      const uint64_t big = UINT64_C(0x123456789ABCDEF0);
+      const size_t   index = histogram_t::index_of(big);
+
+      CHECK(histogram_t::lowest_in_bucket(index) <= big);
+      CHECK(histogram_t::highest_in_bucket(index) >= big);
+      CHECK_EQUAL(histogram_t::BUCKETS - 1U, histogram_t::index_of(UINT64_MAX));
+      CHECK_EQUAL(UINT64_MAX, histogram_t::highest_in_bucket(histogram_t::BUCKETS - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::histogram<1000U> histogram;
+
+      CHECK(histogram.empty());
+      CHECK_EQUAL(0U, histogram.count());
+      CHECK_EQUAL(0U, histogram.min());
+      CHECK_EQUAL(0U, histogram.max());
+      CHECK_EQUAL(0U, histogram.percentile(50U));
+    }
+
+    //*************************************************************************
+    TEST(test_record_and_percentiles)
+    {
+      etl::histogram<10000U, 7U> histogram;
+
+      for (uint32_t i = 1U; i <= 1000U; ++i)
+      {
+        histogram.record(i);
+      }
+
+      CHECK_EQUAL(1000U, histogram.count());
+      CHECK_EQUAL(500500U, histogram.sum());
+      CHECK_EQUAL(1U, histogram.min());
+
+      // The highest value in the same bucket as 1000.
+      CHECK_EQUAL(1003U, histogram.max());
+
+      // 7 bits of precision, so within 1%.
+      CHECK_EQUAL(100U, histogram.percentile(10U));
+      CHECK_CLOSE(500.0, double(histogram.percentile(50U)), 5.0);
+      CHECK_CLOSE(990.0, double(histogram.percentile(99U)), 10.0);
+      CHECK_CLOSE(999.0, double(histogram.quantile(999U, 1000U)), 10.0);
+      CHECK_EQUAL(1003U, histogram.percentile(100U));
+      CHECK_EQUAL(1U, histogram.percentile(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_values_above_max_are_clamped)
+    {
+      etl::histogram<1000U> histogram;
+
+      histogram.record(5000U);
+
+      CHECK_EQUAL(1U, histogram.count());
+      CHECK_EQUAL(1000U, histogram.max());
+      CHECK_EQUAL(1000U, histogram.sum());
+    }
+
+    //*************************************************************************
+    TEST(test_merge_and_reset)
+    {
+      etl::histogram<1000U> a;
+      etl::histogram<1000U> b;
+
+      a.record(1U);
+      a.record(100U);
+      b.record(500U);
+
+      etl::histogram<1000U> snapshot;
+      snapshot.merge(a);
+      snapshot.merge(b);
+
+      CHECK_EQUAL(3U, snapshot.count());
+      CHECK_EQUAL(601U, snapshot.sum());
+      CHECK_EQUAL(1U, snapshot.min());
+      CHECK(snapshot.max() >= 500U);
+
+      a.reset();
+      CHECK(a.empty());
+      CHECK_EQUAL(0U, a.sum());
+      CHECK_EQUAL(3U, snapshot.count());
+    }
+
+    //*************************************************************************
+    TEST(test_record_benchmark_samples)
+    {
+      mock_counter::now  = 0U;
+      mock_counter::step = 10U;
+
+      etl::benchmark<100, mock_counter> bench;
+
+      mock_counter::step = 25U;
+
+      for (size_t i = 0U; i < bench.max_size(); ++i)
+      {
+        bench.stop(bench.start());
+      }
+
+      etl::histogram<1000U> histogram;
+      histogram.record(bench.data(), bench.data() + bench.size());
+
+      CHECK_EQUAL(100U, histogram.count());
+      CHECK_EQUAL(15U, histogram.min());
+      CHECK_EQUAL(15U, histogram.max());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_record)
+    {
+      const size_t THREADS = 4U;
+      const size_t COUNT   = 50000U;
+
+      etl::histogram<1000000U> histogram;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread([&histogram]()
+        {
+          for (uint32_t i = 0U; i < COUNT; ++i)
+          {
+            histogram.record(i % 1000U);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(THREADS * COUNT, histogram.count());
+
+      uint64_t total = 0U;
+
+      for (size_t i = 0U; i < histogram.buckets(); ++i)
+      {
+        total += histogram.bucket(i);
+      }
+
+      CHECK_EQUAL(THREADS * COUNT, total);
+    }
+  };
+}
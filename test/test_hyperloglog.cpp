@@ -0,0 +1,191 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/hyperloglog.h"
+#include "etl/fnv_1.h"
+#include "etl/murmur3.h"
+
+#include <stdint.h>
+#include <math.h>
+
+namespace
+{
+  struct fnv_hash
+  {
+    typedef uint32_t argument_type;
+
+    uint64_t operator ()(argument_type value) const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+      return etl::fnv_1a_64(p, p + sizeof(value));
+    }
+  };
+
+  struct murmur_hash
+  {
+    typedef uint32_t argument_type;
+
+    uint32_t operator ()(argument_type value) const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+      return etl::murmur3<uint32_t>(p, p + sizeof(value));
+    }
+  };
+
+  // Weak on purpose, to show that the hash is spread.
+  struct identity_hash
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return value;
+    }
+  };
+
+  typedef etl::hyperloglog<12, fnv_hash> Sketch;
+
+  bool within(double estimate, double actual, double error)
+  {
+    return fabs(estimate - actual) <= (actual * error);
+  }
+
+  SUITE(test_hyperloglog)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      Sketch sketch;
+
+      CHECK(sketch.empty());
+      CHECK_EQUAL(0U, sketch.count());
+      CHECK_EQUAL(4096U, Sketch::size_bytes());
+      CHECK_CLOSE(0.01625, Sketch::standard_error(), 0.0001);
+    }
+
+    //*************************************************************************
+    TEST(test_small_counts_are_near_exact)
+    {
+      Sketch sketch;
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        sketch.add(i);
+        sketch.add(i); // Duplicates are not counted.
+      }
+
+      CHECK(!sketch.empty());
+      CHECK_EQUAL(10U, sketch.count());
+    }
+
+    //*************************************************************************
+    TEST(test_large_counts)
+    {
+      Sketch sketch;
+
+      for (uint32_t i = 0U; i < 200000U; ++i)
+      {
+        sketch.add(i * 2654435761U);
+      }
+
+      // Four standard errors.
+      CHECK(within(sketch.estimate(), 200000.0, 4.0 * Sketch::standard_error()));
+    }
+
+    //*************************************************************************
+    TEST(test_other_hashes)
+    {
+      etl::hyperloglog<10, murmur_hash>   murmur;
+      etl::hyperloglog<10, identity_hash> identity;
+
+      for (uint32_t i = 0U; i < 50000U; ++i)
+      {
+        murmur.add(i);
+        identity.add(i);
+      }
+
+      CHECK(within(murmur.estimate(),   50000.0, 4.0 * murmur.standard_error()));
+      CHECK(within(identity.estimate(), 50000.0, 4.0 * identity.standard_error()));
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      Sketch core1;
+      Sketch core2;
+      Sketch all;
+
+      for (uint32_t i = 0U; i < 30000U; ++i)
+      {
+        core1.add(i);
+        all.add(i);
+      }
+
+      // Overlaps the first half.
+      for (uint32_t i = 15000U; i < 60000U; ++i)
+      {
+        core2.add(i);
+        all.add(i);
+      }
+
+      core1.merge(core2);
+
+      // Identical to adding everything to one sketch.
+      CHECK_EQUAL(all.estimate(), core1.estimate());
+      CHECK(within(core1.estimate(), 60000.0, 4.0 * Sketch::standard_error()));
+    }
+
+    //*************************************************************************
+    TEST(test_restore_from_data)
+    {
+      Sketch source;
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        source.add(i);
+      }
+
+      Sketch copy;
+      const uint8_t* p = source.data();
+      uint8_t*       q = copy.data();
+
+      for (size_t i = 0U; i < Sketch::size_bytes(); ++i)
+      {
+        q[i] = p[i];
+      }
+
+      CHECK_EQUAL(source.count(), copy.count());
+
+      copy.clear();
+      CHECK(copy.empty());
+    }
+  };
+}
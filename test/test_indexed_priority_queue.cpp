@@ -0,0 +1,258 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "etl/indexed_priority_queue.h"
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::indexed_priority_queue<int, 8>                     Data;
+  typedef etl::indexed_priority_queue<int, 8, etl::greater<int> > DataMin;
+
+  SUITE(test_indexed_priority_queue)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(8U, data.max_size());
+      CHECK_EQUAL(8U, data.available());
+      CHECK(!data.contains(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data;
+
+      int values[] = { 5, 1, 7, 3, 8, 2, 6, 4 };
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        Data::handle_type handle = data.push(values[i]);
+        CHECK(data.contains(handle));
+        CHECK_EQUAL(values[i], data[handle]);
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push(9), etl::indexed_priority_queue_full);
+
+      for (int expected = 8; expected > 0; --expected)
+      {
+        CHECK_EQUAL(expected, data.top());
+        CHECK_EQUAL(expected, data[data.top_handle()]);
+        data.pop();
+      }
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_handles_are_stable_and_reused)
+    {
+      Data data;
+
+      Data::handle_type h1 = data.push(10);
+      Data::handle_type h2 = data.push(20);
+      Data::handle_type h3 = data.push(30);
+
+      CHECK(h1 != h2);
+      CHECK(h2 != h3);
+
+      data.pop();
+      CHECK(!data.contains(h3));
+      CHECK_EQUAL(10, data[h1]);
+      CHECK_EQUAL(20, data[h2]);
+
+      Data::handle_type h4 = data.push(5);
+      CHECK(data.contains(h4));
+      CHECK_EQUAL(5, data[h4]);
+      CHECK_EQUAL(20, data.top());
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      DataMin timers;
+
+      DataMin::handle_type t1 = timers.push(100);
+      DataMin::handle_type t2 = timers.push(200);
+      DataMin::handle_type t3 = timers.push(300);
+
+      CHECK_EQUAL(t1, timers.top_handle());
+
+      // Decrease key.
+      timers.update(t3, 50);
+      CHECK_EQUAL(t3, timers.top_handle());
+      CHECK_EQUAL(50, timers.top());
+
+      // Increase key.
+      timers.update(t3, 250);
+      CHECK_EQUAL(t1, timers.top_handle());
+
+      timers.update(t1, 400);
+      CHECK_EQUAL(t2, timers.top_handle());
+
+      timers.pop();
+      CHECK_EQUAL(t3, timers.top_handle());
+      timers.pop();
+      CHECK_EQUAL(t1, timers.top_handle());
+      CHECK_EQUAL(400, timers.top());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      DataMin timers;
+
+      DataMin::handle_type t1 = timers.push(100);
+      DataMin::handle_type t2 = timers.push(200);
+      DataMin::handle_type t3 = timers.push(300);
+
+      timers.erase(t2);
+      CHECK(!timers.contains(t2));
+      CHECK_EQUAL(2U, timers.size());
+      CHECK_THROW(timers.erase(t2), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(timers.update(t2, 1), etl::indexed_priority_queue_invalid_handle);
+
+      timers.erase(t1);
+      CHECK_EQUAL(t3, timers.top_handle());
+      CHECK_EQUAL(1U, timers.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_reference)
+    {
+      typedef etl::indexed_priority_queue<int, 32, etl::less<int>, 4> Data4;
+
+      Data4 data;
+      std::vector<std::pair<Data4::handle_type, int> > reference;
+
+      unsigned seed = 12345U;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int value      = int((seed >> 8) % 1000U);
+        const unsigned operation = (seed >> 20) % 4U;
+
+        if ((operation == 0U) && !data.full())
+        {
+          reference.push_back(std::make_pair(data.push(value), value));
+        }
+        else if ((operation == 1U) && !reference.empty())
+        {
+          std::pair<Data4::handle_type, int>& entry = reference[size_t(value) % reference.size()];
+          entry.second = value;
+          data.update(entry.first, value);
+        }
+        else if ((operation == 2U) && !reference.empty())
+        {
+          const size_t index = size_t(value) % reference.size();
+          data.erase(reference[index].first);
+          reference.erase(reference.begin() + index);
+        }
+        else if (!reference.empty())
+        {
+          int largest = reference[0].second;
+
+          for (size_t r = 1U; r < reference.size(); ++r)
+          {
+            largest = std::max(largest, reference[r].second);
+          }
+
+          CHECK_EQUAL(largest, data.top());
+
+          for (size_t r = 0U; r < reference.size(); ++r)
+          {
+            if (reference[r].first == data.top_handle())
+            {
+              reference.erase(reference.begin() + r);
+              break;
+            }
+          }
+
+          data.pop();
+        }
+
+        CHECK_EQUAL(reference.size(), data.size());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move_keep_handles)
+    {
+      typedef etl::indexed_priority_queue<TestDataM<int>, 4> DataM;
+
+      Data data;
+      Data::handle_type h1 = data.push(1);
+      Data::handle_type h2 = data.push(2);
+
+      Data copy(data);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(1, copy[h1]);
+      CHECK_EQUAL(2, copy[h2]);
+
+      copy.update(h1, 3);
+      CHECK_EQUAL(h1, copy.top_handle());
+      CHECK_EQUAL(h2, data.top_handle());
+
+      Data assigned;
+      assigned.push(7);
+      assigned = data;
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL(h2, assigned.top_handle());
+
+      DataM moveonly;
+      DataM::handle_type m1 = moveonly.push(TestDataM<int>(1));
+      DataM::handle_type m2 = moveonly.push(TestDataM<int>(2));
+
+      DataM moved(std::move(moveonly));
+      CHECK(moveonly.empty());
+      CHECK_EQUAL(m2, moved.top_handle());
+      CHECK_EQUAL(1, moved[m1].value);
+
+      TestDataM<int> item(0);
+      moved.pop_into(item);
+      CHECK_EQUAL(2, item.value);
+      CHECK_EQUAL(1U, moved.size());
+    }
+  };
+}
@@ -0,0 +1,205 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+
+#include "etl/inplace_function.h"
+
+namespace
+{
+  int free_function(int a, int b)
+  {
+    return a + b;
+  }
+
+  //***************************************************************************
+  // Counts live instances to check copy, move and destruction.
+  struct Counted
+  {
+    Counted(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+      ++copies;
+    }
+
+    Counted(Counted&& other)
+      : value(other.value)
+    {
+      ++instances;
+      ++moves;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int operator()(int a, int b) const
+    {
+      return value + a + b;
+    }
+
+    int value;
+
+    static int instances;
+    static int copies;
+    static int moves;
+  };
+
+  int Counted::instances = 0;
+  int Counted::copies    = 0;
+  int Counted::moves     = 0;
+
+  typedef etl::inplace_function<int(int, int)> Function;
+
+  SUITE(test_inplace_function)
+  {
+    //*************************************************************************
+    TEST(test_default_is_empty)
+    {
+      Function f;
+
+      CHECK(!f);
+      CHECK(!f.is_valid());
+      CHECK(f == nullptr);
+      CHECK_THROW(f(1, 2), etl::inplace_function_uninitialised);
+
+      Function f2(nullptr);
+      CHECK(f2 == nullptr);
+
+      int (*p)(int, int) = nullptr;
+      Function f3(p);
+      CHECK(f3 == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_free_function)
+    {
+      Function f1(free_function);
+      Function f2(&free_function);
+
+      CHECK(f1 != nullptr);
+      CHECK_EQUAL(3, f1(1, 2));
+      CHECK_EQUAL(7, f2(3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_lambda_with_captures)
+    {
+      int     offset = 10;
+      int64_t scale  = 3;
+
+      Function f = [offset, scale](int a, int b) { return int((a + b) * scale) + offset; };
+
+      offset = 0;
+
+      CHECK_EQUAL(19, f(1, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_mutable_state)
+    {
+      int count = 0;
+      etl::inplace_function<int()> f = [count]() mutable { return ++count; };
+
+      CHECK_EQUAL(1, f());
+      CHECK_EQUAL(2, f());
+
+      // The copy owns its own state.
+      etl::inplace_function<int()> f2 = f;
+      CHECK_EQUAL(3, f2());
+      CHECK_EQUAL(3, f());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_destroy)
+    {
+      Counted::instances = 0;
+      Counted::copies    = 0;
+      Counted::moves     = 0;
+
+      {
+        Counted c(100);
+
+        Function f1(c);
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(1, Counted::copies);
+
+        Function f2(f1);
+        CHECK_EQUAL(3, Counted::instances);
+        CHECK_EQUAL(2, Counted::copies);
+
+        Function f3(etl::move(f1));
+        CHECK_EQUAL(3, Counted::instances);
+        CHECK_EQUAL(1, Counted::moves);
+        CHECK(f1 == nullptr);
+        CHECK_EQUAL(103, f3(1, 2));
+
+        f2 = nullptr;
+        CHECK_EQUAL(2, Counted::instances);
+
+        f2 = f3;
+        CHECK_EQUAL(3, Counted::instances);
+        CHECK_EQUAL(103, f2(1, 2));
+
+        f2 = free_function;
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(3, f2(1, 2));
+
+        f2.swap(f3);
+        CHECK_EQUAL(3, f3(1, 2));
+        CHECK_EQUAL(103, f2(1, 2));
+        CHECK_EQUAL(2, Counted::instances);
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_reference_parameters)
+    {
+      etl::inplace_function<void(int&, const std::string&)> f = [](int& out, const std::string& text) { out = int(text.size()); };
+
+      int length = 0;
+      f(length, std::string("hello"));
+
+      CHECK_EQUAL(5, length);
+    }
+  };
+}
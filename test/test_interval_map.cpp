@@ -0,0 +1,225 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/interval_map.h"
+#include "etl/random.h"
+
+#include <vector>
+
+namespace
+{
+  typedef etl::interval_map<uint32_t, int, 32> Map;
+
+  //*************************************************************************
+  struct collector
+  {
+    explicit collector(std::vector<int>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator ()(const Map::value_type& entry)
+    {
+      values.push_back(entry.value);
+    }
+
+    std::vector<int>& values;
+  };
+
+  //*************************************************************************
+  struct ignore
+  {
+    template <typename T>
+    void operator ()(const T&) const
+    {
+    }
+  };
+
+  //*************************************************************************
+  std::vector<int> containing(const Map& map, uint32_t key)
+  {
+    std::vector<int> values;
+    CHECK_EQUAL(map.for_each_containing(key, collector(values)), values.size());
+    return values;
+  }
+
+  //*************************************************************************
+  std::vector<int> overlapping(const Map& map, uint32_t low, uint32_t high)
+  {
+    std::vector<int> values;
+    CHECK_EQUAL(map.for_each_overlapping(low, high, collector(values)), values.size());
+    return values;
+  }
+
+  //*************************************************************************
+  std::vector<int> list(int a, int b = -1, int c = -1)
+  {
+    std::vector<int> values;
+    values.push_back(a);
+    if (b != -1) values.push_back(b);
+    if (c != -1) values.push_back(c);
+    return values;
+  }
+
+  SUITE(test_interval_map)
+  {
+    //*************************************************************************
+    TEST(test_address_map)
+    {
+      Map map;
+
+      // Flash, RAM and a peripheral window inside a wider bus region.
+      map.insert(0x08000000U, 0x08100000U, 1);
+      map.insert(0x20000000U, 0x20020000U, 2);
+      map.insert(0x40000000U, 0x60000000U, 3);
+      map.insert(0x40011000U, 0x40011400U, 4);
+
+      CHECK_EQUAL(4U, map.size());
+
+      CHECK_EQUAL(1, map.find(0x08000000U)->value);
+      CHECK_EQUAL(1, map.find(0x080FFFFFU)->value);
+      CHECK(map.find(0x08100000U) == map.end());
+      CHECK_EQUAL(2, map.find(0x20001234U)->value);
+      CHECK_EQUAL(3, map.find(0x40011004U)->value);
+      CHECK(!map.contains(0x10000000U));
+
+      CHECK(list(3, 4) == containing(map, 0x40011004U));
+      CHECK_EQUAL(2U, map.count(0x40011004U));
+      CHECK(list(3) == containing(map, 0x40011400U));
+      CHECK(containing(map, 0x00000000U).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_overlapping)
+    {
+      Map map;
+
+      map.insert(10U, 20U, 1);
+      map.insert(15U, 25U, 2);
+      map.insert(30U, 40U, 3);
+      map.insert(0U, 100U, 4);
+
+      CHECK(list(4, 1, 2) == overlapping(map, 12U, 17U));
+      CHECK(list(4, 2) == overlapping(map, 20U, 30U));
+      CHECK(list(4, 3) == overlapping(map, 39U, 41U));
+      CHECK(overlapping(map, 100U, 200U).empty());
+      CHECK(map.overlaps(99U, 100U));
+      CHECK(!map.overlaps(100U, 101U));
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_and_erase)
+    {
+      Map map;
+
+      map.insert(5U, 6U, 1);
+      map.insert(1U, 9U, 2);
+      map.insert(5U, 7U, 3);
+      map.insert(5U, 6U, 4);
+
+      // Ordered by low key, then insertion.
+      Map::const_iterator itr = map.begin();
+      CHECK_EQUAL(2, itr->value); ++itr;
+      CHECK_EQUAL(1, itr->value); ++itr;
+      CHECK_EQUAL(3, itr->value); ++itr;
+      CHECK_EQUAL(4, itr->value); ++itr;
+      CHECK(itr == map.end());
+
+      CHECK_EQUAL(2U, map.erase(5U, 6U));
+      CHECK_EQUAL(0U, map.erase(5U, 6U));
+      CHECK(list(2, 3) == containing(map, 5U));
+
+      itr = map.erase(map.begin());
+      CHECK_EQUAL(3, itr->value);
+      CHECK(list(3) == containing(map, 5U));
+      CHECK(containing(map, 1U).empty());
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(map.find(5U) == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::interval_map<int, int, 2> map;
+
+      CHECK_THROW(map.insert(5, 5, 1), etl::interval_map_empty_interval);
+      CHECK_THROW(map.insert(6, 5, 1), etl::interval_map_empty_interval);
+
+      map.insert(1, 2, 1);
+      map.insert(1, 2, 2);
+      CHECK(map.full());
+      CHECK_THROW(map.insert(3, 4, 3), etl::interval_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_brute_force)
+    {
+      etl::interval_map<int, int, 200> map;
+      std::vector<std::pair<int, int> > intervals;
+      etl::random_xorshift random(3U);
+
+      for (int i = 0; i < 200; ++i)
+      {
+        const int low  = int(random.range(0U, 1000U));
+        const int high = low + 1 + int(random.range(0U, (i % 10 == 0) ? 500U : 30U));
+
+        map.insert(low, high, i);
+        intervals.push_back(std::make_pair(low, high));
+
+        if ((i % 20) != 19)
+        {
+          continue;
+        }
+
+        for (int j = 0; j < 200; ++j)
+        {
+          const int ql = int(random.range(0U, 1100U));
+          const int qh = ql + 1 + int(random.range(0U, 50U));
+
+          size_t expected_stab    = 0U;
+          size_t expected_overlap = 0U;
+
+          for (size_t k = 0U; k < intervals.size(); ++k)
+          {
+            expected_stab    += ((intervals[k].first <= ql) && (ql < intervals[k].second)) ? 1U : 0U;
+            expected_overlap += ((intervals[k].first < qh) && (ql < intervals[k].second)) ? 1U : 0U;
+          }
+
+          CHECK_EQUAL(expected_stab, map.count(ql));
+          CHECK_EQUAL(expected_overlap, map.for_each_overlapping(ql, qh, ignore()));
+          CHECK_EQUAL(expected_overlap != 0U, map.overlaps(ql, qh));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,215 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/intrusive_lockfree_stack.h"
+#include "etl/intrusive_links.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  typedef etl::forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    Data(int i_ = 0)
+      : i(i_)
+    {
+      link0::clear();
+    }
+
+    int i;
+  };
+
+  typedef etl::intrusive_lockfree_stack<Data, link0> Stack;
+
+  SUITE(test_intrusive_lockfree_stack)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Stack stack;
+
+      CHECK(stack.empty());
+      CHECK(stack.pop_all() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_all)
+    {
+      Data data[3] = { Data(1), Data(2), Data(3) };
+
+      Stack stack;
+
+      stack.push(data[0]);
+      stack.push(data[1]);
+      stack.push(data[2]);
+
+      CHECK(!stack.empty());
+
+      link0* p_link = stack.pop_all();
+
+      CHECK(stack.empty());
+
+      // Last in, first out.
+      CHECK_EQUAL(3, static_cast<Data*>(p_link)->i);
+      p_link = p_link->etl_next;
+      CHECK_EQUAL(2, static_cast<Data*>(p_link)->i);
+      p_link = p_link->etl_next;
+      CHECK_EQUAL(1, static_cast<Data*>(p_link)->i);
+      CHECK(p_link->etl_next == nullptr);
+    }
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data[3] = { Data(1), Data(2), Data(3) };
+
+      Stack stack;
+
+      stack.push(data[0]);
+      stack.push(data[1]);
+      stack.push(data[2]);
+
+      CHECK(stack.pop() == &data[2]);
+      CHECK(stack.pop() == &data[1]);
+
+      stack.push(data[2]);
+
+      CHECK(stack.pop() == &data[2]);
+      CHECK(!data[2].is_linked());
+      CHECK(stack.pop() == &data[0]);
+      CHECK(stack.pop() == nullptr);
+      CHECK(stack.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_push_pop)
+    {
+      static const size_t Elements   = 64U;
+      static const size_t Threads    = 4U;
+      static const size_t Iterations = 10000U;
+
+      std::vector<Data> data(Elements);
+
+      Stack stack;
+
+      for (size_t i = 0U; i < Elements; ++i)
+      {
+        stack.push(data[i]);
+      }
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&]()
+        {
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            Data* p = stack.pop();
+
+            if (p != nullptr)
+            {
+              ++p->i;
+              stack.push(*p);
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      size_t count = 0U;
+      int    total = 0;
+
+      while (Data* p = stack.pop())
+      {
+        total += p->i;
+        ++count;
+      }
+
+      CHECK_EQUAL(Elements, count);
+      CHECK_EQUAL(int(Threads * Iterations), total);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_concurrent_push_pop_all)
+    {
+      static const int Producers   = 4;
+      static const int PerProducer = 1000;
+
+      std::vector<Data> data(Producers * PerProducer);
+
+      Stack stack;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&, p]()
+        {
+          for (int i = 0; i < PerProducer; ++i)
+          {
+            stack.push(data[p * PerProducer + i]);
+          }
+        }));
+      }
+
+      int received = 0;
+
+      while (received < (Producers * PerProducer))
+      {
+        link0* p_link = stack.pop_all();
+
+        while (p_link != nullptr)
+        {
+          ++received;
+          p_link = p_link->etl_next;
+        }
+      }
+
+      for (size_t i = 0U; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      CHECK_EQUAL(Producers * PerProducer, received);
+      CHECK(stack.empty());
+    }
+  };
+}
@@ -0,0 +1,160 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/intrusive_map.h"
+
+#include <vector>
+
+namespace
+{
+  typedef etl::tree_link<0> deadline_link;
+  typedef etl::tree_link<1> id_link;
+
+  struct Timer : public deadline_link, public id_link
+  {
+    Timer(unsigned id_, unsigned deadline_)
+      : id(id_)
+      , deadline(deadline_)
+    {
+      deadline_link::clear();
+      id_link::clear();
+    }
+
+    unsigned id;
+    unsigned deadline;
+  };
+
+  struct DeadlineOf
+  {
+    unsigned operator()(const Timer& timer) const
+    {
+      return timer.deadline;
+    }
+  };
+
+  struct IdOf
+  {
+    const unsigned& operator()(const Timer& timer) const
+    {
+      return timer.id;
+    }
+  };
+
+  typedef etl::intrusive_multimap<unsigned, Timer, deadline_link, DeadlineOf> ByDeadline;
+  typedef etl::intrusive_map<unsigned, Timer, id_link, IdOf>                  ById;
+
+  SUITE(test_intrusive_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      ById by_id;
+
+      CHECK(by_id.empty());
+      CHECK(by_id.find(1U) == by_id.end());
+    }
+
+    //*************************************************************************
+    TEST(test_map_unique_keys)
+    {
+      Timer t1(1U, 100U);
+      Timer t2(2U, 50U);
+      Timer t3(1U, 75U);
+
+      ById by_id;
+
+      CHECK(by_id.insert(t1).second);
+      CHECK(by_id.insert(t2).second);
+      CHECK(!by_id.insert(t3).second);
+
+      CHECK_EQUAL(2U, by_id.size());
+      CHECK(&*by_id.find(1U) == &t1);
+      CHECK(&*by_id.find(2U) == &t2);
+      CHECK_EQUAL(1U, by_id.front().id);
+    }
+
+    //*************************************************************************
+    TEST(test_timer_queue)
+    {
+      std::vector<Timer> timers;
+
+      timers.push_back(Timer(1U, 300U));
+      timers.push_back(Timer(2U, 100U));
+      timers.push_back(Timer(3U, 200U));
+      timers.push_back(Timer(4U, 100U));
+      timers.push_back(Timer(5U, 400U));
+
+      ByDeadline by_deadline(timers.begin(), timers.end());
+      ById       by_id(timers.begin(), timers.end());
+
+      // Cancel timer 3 through its id.
+      Timer& cancelled = *by_id.find(3U);
+      by_id.remove(cancelled);
+      by_deadline.remove(cancelled);
+
+      // Expire everything due by 300.
+      std::vector<unsigned> expired;
+
+      while (!by_deadline.empty() && (by_deadline.front().deadline <= 300U))
+      {
+        Timer& timer = by_deadline.front();
+        expired.push_back(timer.id);
+        by_deadline.erase(by_deadline.begin());
+        by_id.remove(timer);
+      }
+
+      CHECK_EQUAL(3U, expired.size());
+      CHECK_EQUAL(2U, expired[0]);
+      CHECK_EQUAL(4U, expired[1]);
+      CHECK_EQUAL(1U, expired[2]);
+
+      CHECK_EQUAL(1U, by_deadline.size());
+      CHECK_EQUAL(1U, by_id.size());
+      CHECK_EQUAL(5U, by_id.front().id);
+    }
+
+    //*************************************************************************
+    TEST(test_multimap_bounds)
+    {
+      Timer timers[] = { Timer(1U, 10U), Timer(2U, 20U), Timer(3U, 20U), Timer(4U, 30U) };
+
+      ByDeadline by_deadline(timers, timers + 4);
+
+      CHECK_EQUAL(2U, by_deadline.count(20U));
+      CHECK_EQUAL(2U, by_deadline.lower_bound(15U)->id);
+      CHECK_EQUAL(4U, by_deadline.upper_bound(20U)->id);
+
+      CHECK_EQUAL(2U, by_deadline.erase(20U));
+      CHECK_EQUAL(2U, by_deadline.size());
+      CHECK(!timers[1].deadline_link::is_linked());
+    }
+  };
+}
@@ -0,0 +1,187 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/intrusive_mpsc_queue.h"
+#include "etl/intrusive_stack.h"
+#include "etl/intrusive_links.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  typedef etl::forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    Data(int i_ = 0)
+      : i(i_)
+    {
+      link0::clear();
+    }
+
+    int i;
+  };
+
+  typedef etl::intrusive_mpsc_queue<Data, link0> Queue;
+
+  SUITE(test_intrusive_mpsc_queue)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_fifo)
+    {
+      Data data[4] = { Data(1), Data(2), Data(3), Data(4) };
+
+      Queue queue;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        queue.push(data[i]);
+      }
+
+      CHECK(!queue.empty());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        Data* p = queue.pop();
+        CHECK(p == &data[i]);
+        CHECK(!p->is_linked());
+      }
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_push_pop)
+    {
+      Data data[3] = { Data(1), Data(2), Data(3) };
+
+      Queue queue;
+
+      queue.push(data[0]);
+      CHECK(queue.pop() == &data[0]);
+      CHECK(queue.empty());
+
+      queue.push(data[1]);
+      queue.push(data[2]);
+      CHECK(queue.pop() == &data[1]);
+
+      // Re-use a popped element.
+      queue.push(data[0]);
+      CHECK(queue.pop() == &data[2]);
+      CHECK(queue.pop() == &data[0]);
+      CHECK(queue.pop() == nullptr);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into_another_intrusive_container)
+    {
+      Data data[2] = { Data(1), Data(2) };
+
+      Queue queue;
+      etl::intrusive_stack<Data, link0> stack;
+
+      queue.push(data[0]);
+      queue.push(data[1]);
+
+      stack.push(*queue.pop());
+      stack.push(*queue.pop());
+
+      CHECK_EQUAL(2, stack.top().i);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      static const int Producers = 4;
+      static const int PerProducer = 2000;
+
+      std::vector<Data> data(Producers * PerProducer);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i].i = int(i);
+      }
+
+      Queue queue;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&, p]()
+        {
+          for (int i = 0; i < PerProducer; ++i)
+          {
+            queue.push(data[p * PerProducer + i]);
+          }
+        }));
+      }
+
+      // Each producer's values must arrive in the order they were pushed.
+      std::vector<int> last(Producers, -1);
+      int received = 0;
+
+      while (received < (Producers * PerProducer))
+      {
+        Data* p = queue.pop();
+
+        if (p != nullptr)
+        {
+          int producer = p->i / PerProducer;
+          CHECK(p->i > last[producer]);
+          last[producer] = p->i;
+          ++received;
+        }
+      }
+
+      for (size_t i = 0U; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      CHECK_EQUAL(Producers * PerProducer, received);
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+  };
+}
@@ -0,0 +1,181 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+
+#include "etl/intrusive_ptr.h"
+#include "etl/pool.h"
+
+namespace
+{
+  //***************************************************************************
+  struct Base : public etl::intrusive_reference_counted<Base>
+  {
+    Base(etl::ipool& pool_, int value_)
+      : pool(pool_)
+      , value(value_)
+    {
+    }
+
+    virtual ~Base()
+    {
+    }
+
+    void on_last_release()
+    {
+      ++released;
+      pool.destroy<Base>(this);
+    }
+
+    etl::ipool& pool;
+    int         value;
+
+    static int released;
+  };
+
+  int Base::released = 0;
+
+  //***************************************************************************
+  struct Derived : public Base
+  {
+    Derived(etl::ipool& pool_, int value_, const std::string& text_)
+      : Base(pool_, value_)
+      , text(text_)
+    {
+    }
+
+    std::string text;
+  };
+
+  typedef etl::intrusive_ptr<Base>    BasePtr;
+  typedef etl::intrusive_ptr<Derived> DerivedPtr;
+
+  SUITE(test_intrusive_ptr)
+  {
+    //*************************************************************************
+    TEST(test_shared_ownership)
+    {
+      Base::released = 0;
+
+      etl::pool<Derived, 2> pool;
+
+      BasePtr empty;
+      CHECK(!empty);
+      CHECK(empty.get() == nullptr);
+
+      {
+        DerivedPtr p1(pool.create<Derived>(pool, 1, "one"));
+        CHECK(p1);
+        CHECK_EQUAL(1U, p1->use_count());
+
+        BasePtr p2(p1);
+        CHECK_EQUAL(2U, p1->use_count());
+        CHECK(p1 == p2);
+        CHECK_EQUAL(1, (*p2).value);
+
+        BasePtr p3;
+        p3 = p2;
+        CHECK_EQUAL(3U, p3->use_count());
+
+        p2.reset();
+        CHECK(!p2);
+        CHECK_EQUAL(2U, p3->use_count());
+        CHECK_EQUAL(0, Base::released);
+      }
+
+      CHECK_EQUAL(1, Base::released);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_move_swap_detach)
+    {
+      Base::released = 0;
+
+      etl::pool<Derived, 2> pool;
+
+      BasePtr p1(pool.create<Derived>(pool, 1, "one"));
+      BasePtr p2(pool.create<Derived>(pool, 2, "two"));
+
+      swap(p1, p2);
+      CHECK_EQUAL(2, p1->value);
+      CHECK_EQUAL(1, p2->value);
+
+      BasePtr p3(etl::move(p1));
+      CHECK(!p1);
+      CHECK_EQUAL(1U, p3->use_count());
+
+      // Detach and adopt, without changing the count.
+      Base* raw = p3.detach();
+      CHECK(!p3);
+      CHECK_EQUAL(1U, raw->use_count());
+
+      p3.reset(raw, false);
+      CHECK_EQUAL(1U, p3->use_count());
+
+      p3 = p2;
+      CHECK_EQUAL(1, Base::released);
+      CHECK_EQUAL(2U, p2->use_count());
+
+      p2.reset();
+      p3.reset();
+      CHECK_EQUAL(2, Base::released);
+      CHECK(pool.empty());
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    struct Shared : public etl::intrusive_reference_counted<Shared, etl::atomic_reference_counter>
+    {
+      void on_last_release()
+      {
+        released = true;
+      }
+
+      bool released = false;
+    };
+
+    TEST(test_atomic_counter)
+    {
+      Shared shared;
+
+      {
+        etl::intrusive_ptr<Shared> p1(&shared);
+        etl::intrusive_ptr<Shared> p2(p1);
+        CHECK_EQUAL(2U, shared.use_count());
+      }
+
+      CHECK(shared.released);
+      CHECK_EQUAL(0U, shared.use_count());
+    }
+#endif
+  };
+}
@@ -0,0 +1,362 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/intrusive_set.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+namespace
+{
+  typedef etl::tree_link<0> link0;
+  typedef etl::tree_link<1> link1;
+
+  struct Data : public link0, public link1
+  {
+    Data(int value_ = 0)
+      : value(value_)
+    {
+      link0::clear();
+      link1::clear();
+    }
+
+    int value;
+  };
+
+  bool operator <(const Data& lhs, const Data& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  struct Greater
+  {
+    bool operator()(const Data& lhs, const Data& rhs) const
+    {
+      return rhs.value < lhs.value;
+    }
+  };
+
+  typedef etl::intrusive_set<Data, link0>               Set;
+  typedef etl::intrusive_multiset<Data, link0>          MultiSet;
+  typedef etl::intrusive_set<Data, link1, Greater>      ReverseSet;
+
+  //***************************************************************************
+  // Checks the parent links and balance factors of the subtree.
+  // Returns the height, or -1000 if the subtree is invalid.
+  //***************************************************************************
+  int check_subtree(const link0* p_link, const link0* p_parent)
+  {
+    if (p_link == nullptr)
+    {
+      return 0;
+    }
+
+    if (p_link->etl_parent != p_parent)
+    {
+      return -1000;
+    }
+
+    int left  = check_subtree(p_link->etl_left, p_link);
+    int right = check_subtree(p_link->etl_right, p_link);
+
+    if ((left < 0) || (right < 0) || ((right - left) != p_link->etl_balance) || (std::abs(right - left) > 1))
+    {
+      return -1000;
+    }
+
+    return 1 + std::max(left, right);
+  }
+
+  template <typename TTree>
+  bool is_valid_avl(TTree& tree)
+  {
+    if (tree.empty())
+    {
+      return true;
+    }
+
+    const link0* p_root = &static_cast<const link0&>(tree.front());
+
+    while (p_root->etl_parent != nullptr)
+    {
+      p_root = p_root->etl_parent;
+    }
+
+    return check_subtree(p_root, nullptr) >= 0;
+  }
+
+  SUITE(test_intrusive_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK(set.begin() == set.end());
+      CHECK(set.rbegin() == set.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_ordered)
+    {
+      Data data[] = { Data(5), Data(3), Data(8), Data(1), Data(4), Data(7), Data(9) };
+
+      Set set(data, data + 7);
+
+      CHECK_EQUAL(7U, set.size());
+      CHECK(is_valid_avl(set));
+
+      std::vector<int> values;
+
+      for (Set::const_iterator itr = set.cbegin(); itr != set.cend(); ++itr)
+      {
+        values.push_back(itr->value);
+      }
+
+      int expected[] = { 1, 3, 4, 5, 7, 8, 9 };
+      CHECK_ARRAY_EQUAL(expected, values.data(), 7);
+
+      CHECK_EQUAL(1, set.front().value);
+      CHECK_EQUAL(9, set.back().value);
+      CHECK_EQUAL(9, set.rbegin()->value);
+      CHECK_EQUAL(9, (--set.end())->value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate)
+    {
+      Data a(1);
+      Data b(1);
+
+      Set set;
+
+      CHECK(set.insert(a).second);
+
+      ETL_OR_STD::pair<Set::iterator, bool> result = set.insert(b);
+
+      CHECK(!result.second);
+      CHECK(&*result.first == &a);
+      CHECK_EQUAL(1U, set.size());
+      CHECK(!b.link0::is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Data data[] = { Data(10), Data(20), Data(30), Data(40) };
+
+      Set set(data, data + 4);
+
+      CHECK(&*set.find(Data(30)) == &data[2]);
+      CHECK(set.find(Data(25)) == set.end());
+      CHECK_EQUAL(1U, set.count(Data(20)));
+      CHECK_EQUAL(0U, set.count(Data(21)));
+
+      CHECK_EQUAL(30, set.lower_bound(Data(25))->value);
+      CHECK_EQUAL(30, set.lower_bound(Data(30))->value);
+      CHECK_EQUAL(40, set.upper_bound(Data(30))->value);
+      CHECK(set.upper_bound(Data(40)) == set.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data[] = { Data(10), Data(20), Data(30), Data(40), Data(50) };
+
+      Set set(data, data + 5);
+
+      CHECK_EQUAL(1U, set.erase(Data(30)));
+      CHECK_EQUAL(0U, set.erase(Data(30)));
+      CHECK(!data[2].link0::is_linked());
+
+      Set::iterator itr = set.erase(set.find(Data(10)));
+      CHECK_EQUAL(20, itr->value);
+
+      set.remove(data[4]);
+
+      CHECK_EQUAL(2U, set.size());
+      CHECK(is_valid_avl(set));
+      CHECK_EQUAL(20, set.front().value);
+      CHECK_EQUAL(40, set.back().value);
+
+      set.erase(set.begin(), set.end());
+      CHECK(set.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iterator_to)
+    {
+      Data data[] = { Data(1), Data(2), Data(3) };
+
+      Set set(data, data + 3);
+
+      Set::iterator itr = set.iterator_to(data[1]);
+
+      CHECK_EQUAL(2, (itr++)->value);
+      CHECK_EQUAL(3, (itr--)->value);
+      CHECK_EQUAL(2, itr->value);
+    }
+
+    //*************************************************************************
+    TEST(test_one_element_in_two_sets)
+    {
+      Data data[] = { Data(1), Data(2), Data(3) };
+
+      Set        ascending(data, data + 3);
+      ReverseSet descending(data, data + 3);
+
+      CHECK_EQUAL(1, ascending.front().value);
+      CHECK_EQUAL(3, descending.front().value);
+
+      descending.remove(data[2]);
+
+      CHECK_EQUAL(3U, ascending.size());
+      CHECK_EQUAL(2U, descending.size());
+      CHECK_EQUAL(2, descending.front().value);
+    }
+
+    //*************************************************************************
+    TEST(test_multiset_keeps_insertion_order)
+    {
+      Data data[] = { Data(2), Data(1), Data(2), Data(2), Data(3) };
+
+      MultiSet set(data, data + 5);
+
+      CHECK_EQUAL(3U, set.count(Data(2)));
+
+      ETL_OR_STD::pair<MultiSet::iterator, MultiSet::iterator> range = set.equal_range(Data(2));
+
+      CHECK(&*range.first == &data[0]);
+      ++range.first;
+      CHECK(&*range.first == &data[2]);
+      ++range.first;
+      CHECK(&*range.first == &data[3]);
+      ++range.first;
+      CHECK(range.first == range.second);
+
+      // Remove a specific element with an equal key.
+      set.remove(data[2]);
+      CHECK_EQUAL(2U, set.count(Data(2)));
+      CHECK(is_valid_avl(set));
+
+      CHECK_EQUAL(2U, set.erase(Data(2)));
+      CHECK_EQUAL(2U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std_multiset)
+    {
+      static const size_t Elements = 500U;
+
+      std::vector<Data> data(Elements);
+
+      MultiSet           set;
+      std::multiset<int> compare;
+      std::vector<bool>  linked(Elements, false);
+
+      std::srand(1);
+
+      for (size_t step = 0U; step < 20000U; ++step)
+      {
+        size_t i = size_t(std::rand()) % Elements;
+
+        if (linked[i])
+        {
+          set.remove(data[i]);
+          compare.erase(compare.find(data[i].value));
+          linked[i] = false;
+        }
+        else
+        {
+          data[i].value = std::rand() % 100;
+          set.insert(data[i]);
+          compare.insert(data[i].value);
+          linked[i] = true;
+        }
+
+        if ((step % 500U) == 0U)
+        {
+          CHECK(is_valid_avl(set));
+        }
+      }
+
+      CHECK(is_valid_avl(set));
+      CHECK_EQUAL(compare.size(), set.size());
+
+      std::vector<int> values;
+
+      for (MultiSet::iterator itr = set.begin(); itr != set.end(); ++itr)
+      {
+        values.push_back(itr->value);
+      }
+
+      CHECK(std::equal(compare.begin(), compare.end(), values.begin()));
+
+      std::vector<int> reversed;
+
+      for (MultiSet::reverse_iterator itr = set.rbegin(); itr != set.rend(); ++itr)
+      {
+        reversed.push_back(itr->value);
+      }
+
+      CHECK(std::equal(compare.rbegin(), compare.rend(), reversed.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_sequential_inserts_stay_balanced)
+    {
+      std::vector<Data> data;
+
+      for (int i = 0; i < 1024; ++i)
+      {
+        data.push_back(Data(i));
+      }
+
+      Set set(data.begin(), data.end());
+
+      CHECK(is_valid_avl(set));
+
+      // An AVL tree of 1024 elements has a height of at most 1.44 log2(n).
+      const link0* p_root = &static_cast<link0&>(data[0]);
+
+      while (p_root->etl_parent != nullptr)
+      {
+        p_root = p_root->etl_parent;
+      }
+
+      CHECK(check_subtree(p_root, nullptr) <= 14);
+    }
+  };
+}
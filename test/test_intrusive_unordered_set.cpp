@@ -0,0 +1,264 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/intrusive_unordered_set.h"
+#include "etl/hash.h"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+  typedef etl::forward_link<0> id_link;
+  typedef etl::forward_link<1> port_link;
+
+  struct Session : public id_link, public port_link
+  {
+    Session(int id_, int port_)
+      : id(id_)
+      , port(port_)
+    {
+      id_link::clear();
+      port_link::clear();
+    }
+
+    int id;
+    int port;
+  };
+
+  struct IdOf
+  {
+    typedef int key_type;
+
+    int operator()(const Session& session) const
+    {
+      return session.id;
+    }
+  };
+
+  struct PortOf
+  {
+    typedef int key_type;
+
+    int operator()(const Session& session) const
+    {
+      return session.port;
+    }
+  };
+
+  typedef etl::intrusive_unordered_set<Session, id_link,   etl::hash<int>, IdOf,   7>  ById;
+  typedef etl::intrusive_unordered_set<Session, port_link, etl::hash<int>, PortOf, 13> ByPort;
+
+  typedef etl::iintrusive_unordered_set<Session, id_link, etl::hash<int>, IdOf> IById;
+
+  SUITE(test_intrusive_unordered_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      ById by_id;
+
+      CHECK(by_id.empty());
+      CHECK_EQUAL(0U, by_id.size());
+      CHECK_EQUAL(7U, by_id.bucket_count());
+      CHECK(by_id.begin() == by_id.end());
+      CHECK(by_id.find(1) == by_id.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Session s1(1, 8080);
+      Session s2(2, 8081);
+      Session s3(3, 8082);
+
+      ById by_id;
+
+      CHECK(by_id.insert(s1).second);
+      CHECK(by_id.insert(s2).second);
+      CHECK(by_id.insert(s3).second);
+
+      CHECK_EQUAL(3U, by_id.size());
+      CHECK(&*by_id.find(1) == &s1);
+      CHECK(&*by_id.find(2) == &s2);
+      CHECK(&*by_id.find(3) == &s3);
+      CHECK(by_id.find(4) == by_id.end());
+      CHECK_EQUAL(1U, by_id.count(2));
+      CHECK_EQUAL(0U, by_id.count(4));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate_key)
+    {
+      Session s1(1, 8080);
+      Session s2(1, 8081);
+
+      ById by_id;
+
+      by_id.insert(s1);
+      ETL_OR_STD::pair<ById::iterator, bool> result = by_id.insert(s2);
+
+      CHECK(!result.second);
+      CHECK(&*result.first == &s1);
+      CHECK_EQUAL(1U, by_id.size());
+    }
+
+    //*************************************************************************
+    TEST(test_one_object_in_several_indexes)
+    {
+      Session sessions[] = { Session(1, 8080), Session(2, 8081), Session(3, 8082), Session(4, 8083) };
+
+      ById   by_id(sessions, sessions + 4);
+      ByPort by_port(sessions, sessions + 4);
+
+      CHECK_EQUAL(4U, by_id.size());
+      CHECK_EQUAL(4U, by_port.size());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(&*by_id.find(sessions[i].id) == &*by_port.find(sessions[i].port));
+      }
+
+      // Removing from one index leaves the other intact.
+      CHECK_EQUAL(1U, by_id.erase(2));
+      CHECK(by_id.find(2) == by_id.end());
+      CHECK(&*by_port.find(8081) == &sessions[1]);
+      CHECK_EQUAL(3U, by_id.size());
+      CHECK_EQUAL(4U, by_port.size());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      std::vector<Session> sessions;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        sessions.push_back(Session(i, 9000 + i));
+      }
+
+      ById by_id(sessions.begin(), sessions.end());
+
+      std::set<int> ids;
+
+      for (ById::const_iterator itr = by_id.cbegin(); itr != by_id.cend(); ++itr)
+      {
+        ids.insert(itr->id);
+      }
+
+      CHECK_EQUAL(20U, ids.size());
+      CHECK_EQUAL(0, *ids.begin());
+      CHECK_EQUAL(19, *ids.rbegin());
+
+      size_t in_buckets = 0U;
+
+      for (size_t i = 0U; i < by_id.bucket_count(); ++i)
+      {
+        for (ById::local_iterator itr = by_id.begin(i); itr != by_id.end(i); ++itr)
+        {
+          CHECK_EQUAL(i, by_id.get_bucket_index(itr->id));
+          ++in_buckets;
+        }
+      }
+
+      CHECK_EQUAL(20U, in_buckets);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      std::vector<Session> sessions;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        sessions.push_back(Session(i, 9000 + i));
+      }
+
+      ById by_id(sessions.begin(), sessions.end());
+
+      // Erase every even id while iterating.
+      ById::iterator itr = by_id.begin();
+
+      while (itr != by_id.end())
+      {
+        if ((itr->id % 2) == 0)
+        {
+          itr = by_id.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(10U, by_id.size());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL((i % 2) == 0 ? 0U : 1U, by_id.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_reuse)
+    {
+      Session s1(1, 8080);
+      Session s2(2, 8081);
+
+      ById by_id;
+
+      by_id.insert(s1);
+      by_id.insert(s2);
+      by_id.clear();
+
+      CHECK(by_id.empty());
+      CHECK(by_id.find(1) == by_id.end());
+
+      CHECK(by_id.insert(s2).second);
+      CHECK_EQUAL(1U, by_id.size());
+    }
+
+    //*************************************************************************
+    TEST(test_interface_reference)
+    {
+      Session s1(1, 8080);
+
+      ById by_id;
+      IById& iby_id = by_id;
+
+      iby_id.insert(s1);
+
+      CHECK(&*by_id.find(1) == &s1);
+      CHECK_EQUAL(1U, iby_id.size());
+      CHECK(iby_id.load_factor() > 0.0f);
+    }
+  };
+}
@@ -84,6 +84,45 @@ namespace
 
 namespace
 {
+  //***************************************************************************
+  // A DMA engine that records the transfers it is offered.
+  //***************************************************************************
+  struct MockDma
+  {
+    MockDma(bool accept_)
+      : accept(accept_)
+      , reads(0)
+      , writes(0)
+      , last_n(0)
+    {
+    }
+
+    bool read(volatile const uint8_t*, uint8_t* buffer, size_t n)
+    {
+      ++reads;
+      last_n = n;
+
+      if (accept)
+      {
+        std::fill_n(buffer, n, uint8_t(0xDD));
+      }
+
+      return accept;
+    }
+
+    bool write(volatile uint8_t*, const uint8_t*, size_t n)
+    {
+      ++writes;
+      last_n = n;
+      return accept;
+    }
+
+    bool   accept;
+    int    reads;
+    int    writes;
+    size_t last_n;
+  };
+
   SUITE(test_io_ports)
   {
     //*************************************************************************
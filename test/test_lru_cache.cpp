@@ -0,0 +1,323 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/lru_cache.h"
+#include "etl/delegate.h"
+
+#include <map>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  // A backing store that counts its accesses.
+  //***************************************************************************
+  struct Store
+  {
+    Store()
+      : reads(0)
+      , writes(0)
+    {
+    }
+
+    bool read(const int& key, std::string& value)
+    {
+      ++reads;
+      std::map<int, std::string>::const_iterator itr = data.find(key);
+
+      if (itr == data.end())
+      {
+        return false;
+      }
+
+      value = itr->second;
+      return true;
+    }
+
+    void write(const int& key, const std::string& value)
+    {
+      ++writes;
+      data[key] = value;
+    }
+
+    std::map<int, std::string> data;
+    int reads;
+    int writes;
+  };
+
+  typedef etl::lru_cache<int, std::string, 3> Cache;
+  typedef etl::icache<int, std::string>       ICache;
+
+  //***************************************************************************
+  void attach(ICache& cache, Store& store)
+  {
+    cache.set_read_function(ICache::read_delegate_t::create<Store, &Store::read>(store));
+    cache.set_write_function(ICache::write_delegate_t::create<Store, &Store::write>(store));
+  }
+
+  SUITE(test_lru_cache)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Cache cache;
+
+      CHECK(cache.empty());
+      CHECK(!cache.full());
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(3U, cache.capacity());
+      CHECK(cache.is_write_through());
+      CHECK(cache.read(1) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_write_then_read_hits)
+    {
+      Cache cache;
+
+      cache.write(1, "one");
+      cache.write(2, "two");
+
+      CHECK_EQUAL(2U, cache.size());
+      CHECK(cache.contains(1));
+      CHECK_EQUAL(std::string("one"), *cache.read(1));
+      CHECK_EQUAL(std::string("two"), *cache.read(2));
+
+      etl::cache_statistics statistics = cache.get_statistics();
+      CHECK_EQUAL(2U, statistics.hits);
+      CHECK_EQUAL(2U, statistics.misses);
+      CHECK_EQUAL(0U, statistics.evictions);
+    }
+
+    //*************************************************************************
+    TEST(test_read_miss_loads_from_store)
+    {
+      Store store;
+      store.data[1] = "one";
+
+      Cache cache;
+      attach(cache, store);
+
+      CHECK_EQUAL(std::string("one"), *cache.read(1));
+      CHECK_EQUAL(std::string("one"), *cache.read(1));
+      CHECK(cache.read(2) == nullptr);
+
+      CHECK_EQUAL(2, store.reads);
+
+      etl::cache_statistics statistics = cache.get_statistics();
+      CHECK_EQUAL(1U, statistics.hits);
+      CHECK_EQUAL(2U, statistics.misses);
+      CHECK_EQUAL(1U, statistics.loads);
+
+      cache.clear_statistics();
+      statistics = cache.get_statistics();
+      CHECK_EQUAL(0U, statistics.hits);
+      CHECK_EQUAL(0U, statistics.misses);
+      CHECK_EQUAL(0U, statistics.loads);
+    }
+
+    //*************************************************************************
+    TEST(test_evicts_least_recently_used)
+    {
+      Cache cache;
+
+      cache.write(1, "one");
+      cache.write(2, "two");
+      cache.write(3, "three");
+      CHECK(cache.full());
+
+      cache.read(1); // 2 is now the least recently used.
+      cache.write(4, "four");
+
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(4));
+      CHECK_EQUAL(1U, cache.get_statistics().evictions);
+
+      cache.write(3, "THREE"); // 1 is now the least recently used.
+      cache.write(5, "five");
+
+      CHECK(!cache.contains(1));
+      CHECK_EQUAL(std::string("THREE"), *cache.read(3));
+    }
+
+    //*************************************************************************
+    TEST(test_write_through)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+
+      cache.write(1, "one");
+      cache.write(1, "uno");
+
+      CHECK_EQUAL(2, store.writes);
+      CHECK_EQUAL(std::string("uno"), store.data[1]);
+      CHECK_EQUAL(0U, cache.dirty_size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_on_flush)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.write(1, "uno");
+      cache.write(2, "two");
+
+      CHECK_EQUAL(0, store.writes);
+      CHECK_EQUAL(2U, cache.dirty_size());
+
+      cache.flush();
+
+      CHECK_EQUAL(2, store.writes);
+      CHECK_EQUAL(std::string("uno"), store.data[1]);
+      CHECK_EQUAL(std::string("two"), store.data[2]);
+      CHECK_EQUAL(0U, cache.dirty_size());
+      CHECK_EQUAL(2U, cache.get_statistics().write_backs);
+
+      cache.flush();
+      CHECK_EQUAL(2, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_on_evict)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.write(2, "two");
+      cache.write(3, "three");
+      cache.write(4, "four");
+
+      CHECK_EQUAL(1, store.writes);
+      CHECK_EQUAL(std::string("one"), store.data[1]);
+      CHECK_EQUAL(3U, cache.dirty_size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_batch_limit)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+      cache.set_write_back_limit(2U);
+
+      cache.write(1, "one");
+      CHECK_EQUAL(0, store.writes);
+
+      cache.write(2, "two");
+      CHECK_EQUAL(2, store.writes);
+      CHECK_EQUAL(0U, cache.dirty_size());
+
+      cache.write(1, "uno");
+      CHECK_EQUAL(2, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_switch_to_write_through_flushes)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.set_write_through(true);
+
+      CHECK_EQUAL(1, store.writes);
+      CHECK_EQUAL(0U, cache.dirty_size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.write(2, "two");
+
+      CHECK(cache.erase(1));
+      CHECK(!cache.erase(1));
+      CHECK(!cache.contains(1));
+      CHECK_EQUAL(1U, cache.size());
+      CHECK_EQUAL(std::string("one"), store.data[1]);
+
+      // The freed entry is reused.
+      cache.write(3, "three");
+      cache.write(4, "four");
+      CHECK(cache.full());
+      CHECK(cache.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Store store;
+      Cache cache;
+      attach(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.write(2, "two");
+      cache.clear();
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(2, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_writes_back)
+    {
+      Store store;
+
+      {
+        Cache cache;
+        attach(cache, store);
+        cache.set_write_through(false);
+        cache.write(1, "one");
+      }
+
+      CHECK_EQUAL(std::string("one"), store.data[1]);
+    }
+  };
+}
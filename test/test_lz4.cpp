@@ -0,0 +1,303 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/lz4.h"
+#include "etl/vector.h"
+#include "etl/random.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <string>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  etl::lz4_hash_table<> work;
+
+  //*************************************************************************
+  etl::array_view<const uint8_t> view(const Bytes& data)
+  {
+    return data.empty() ? etl::array_view<const uint8_t>() : etl::array_view<const uint8_t>(data.data(), data.size());
+  }
+
+  //*************************************************************************
+  Bytes compress(const Bytes& data)
+  {
+    Bytes compressed(etl::lz4_compress_bound(data.size()));
+
+    size_t n = etl::lz4_compress(view(data), etl::array_view<uint8_t>(compressed.data(), compressed.size()), work);
+
+    compressed.resize(n);
+
+    return compressed;
+  }
+
+  //*************************************************************************
+  Bytes round_trip(const Bytes& data)
+  {
+    Bytes compressed = compress(data);
+    Bytes decompressed(data.size() + 16U);
+
+    size_t n = etl::lz4_decompress(etl::array_view<const uint8_t>(compressed.data(), compressed.size()),
+                                   etl::array_view<uint8_t>(decompressed.data(), decompressed.size()));
+
+    decompressed.resize(n);
+
+    return decompressed;
+  }
+
+  //*************************************************************************
+  Bytes text_log(size_t lines)
+  {
+    std::string text;
+
+    for (size_t i = 0U; i < lines; ++i)
+    {
+      text += "[" + std::to_string(1000 + i * 10) + "] sensor " + std::to_string(i % 4) + " temperature=" + std::to_string(20 + (i % 7)) + " status=OK\n";
+    }
+
+    return Bytes(text.begin(), text.end());
+  }
+
+  SUITE(test_lz4)
+  {
+    //*************************************************************************
+    TEST(test_decompress_reference_block)
+    {
+      // 3 literals, a match of 9 at offset 3, then 5 literals.
+      const uint8_t block[] = { 0x35, 'a', 'b', 'c', 0x03, 0x00, 0x50, 'x', 'y', 'z', 'z', 'y' };
+
+      uint8_t output[32];
+      size_t n = etl::lz4_decompress(etl::array_view<const uint8_t>(block, sizeof(block)), etl::array_view<uint8_t>(output));
+
+      CHECK_EQUAL(std::string("abcabcabcabcxyzzy"), std::string(reinterpret_cast<const char*>(output), n));
+    }
+
+    //*************************************************************************
+    TEST(test_decompress_long_lengths)
+    {
+      // 20 literals, then a match of 4 + 15 + 255 + 10 = 284 at offset 1, then 5 literals.
+      Bytes block;
+      block.push_back(0xFF);
+      block.push_back(20 - 15);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        block.push_back(uint8_t('A' + i));
+      }
+
+      block.push_back(0x01);
+      block.push_back(0x00);
+      block.push_back(255);
+      block.push_back(10);
+      block.push_back(0x50);
+      block.insert(block.end(), 5U, uint8_t('z'));
+
+      uint8_t output[400];
+      size_t n = etl::lz4_decompress(etl::array_view<const uint8_t>(block.data(), block.size()), etl::array_view<uint8_t>(output));
+
+      CHECK_EQUAL(20U + 284U + 5U, n);
+      CHECK_EQUAL('T', output[19]);
+      CHECK_EQUAL('T', output[20]);
+      CHECK_EQUAL('T', output[303]);
+      CHECK_EQUAL('z', output[304]);
+    }
+
+    //*************************************************************************
+    TEST(test_decompress_malformed)
+    {
+      uint8_t output[64];
+      etl::array_view<uint8_t> out(output);
+
+      // Offset before the start of the output.
+      const uint8_t bad_offset[] = { 0x10, 'a', 0x02, 0x00, 0x50, 'x', 'y', 'z', 'z', 'y' };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(bad_offset, sizeof(bad_offset)), out));
+
+      // Zero offset.
+      const uint8_t zero_offset[] = { 0x10, 'a', 0x00, 0x00, 0x50, 'x', 'y', 'z', 'z', 'y' };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(zero_offset, sizeof(zero_offset)), out));
+
+      // Literals run past the input.
+      const uint8_t short_literals[] = { 0x50, 'a', 'b' };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(short_literals, sizeof(short_literals)), out));
+
+      // Truncated offset.
+      const uint8_t short_offset[] = { 0x10, 'a', 0x01 };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(short_offset, sizeof(short_offset)), out));
+
+      // Truncated length.
+      const uint8_t short_length[] = { 0xF0, 255 };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(short_length, sizeof(short_length)), out));
+
+      // Output too small.
+      const uint8_t block[] = { 0x35, 'a', 'b', 'c', 0x03, 0x00, 0x50, 'x', 'y', 'z', 'z', 'y' };
+      uint8_t small[16];
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::array_view<const uint8_t>(block, sizeof(block)), etl::array_view<uint8_t>(small)));
+    }
+
+    //*************************************************************************
+    TEST(test_compress_small_inputs_as_literals)
+    {
+      for (size_t length = 0U; length <= 13U; ++length)
+      {
+        Bytes data(length, uint8_t('q'));
+        Bytes compressed = compress(data);
+
+        CHECK_EQUAL(length + 1U, compressed.size());
+        CHECK_EQUAL(length << 4, compressed[0]);
+        CHECK(data == round_trip(data));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compress_repetitive_telemetry)
+    {
+      Bytes data = text_log(200U);
+
+      Bytes compressed = compress(data);
+
+      CHECK(compressed.size() * 2U < data.size());
+      CHECK(data == round_trip(data));
+    }
+
+    //*************************************************************************
+    TEST(test_compress_runs)
+    {
+      Bytes data(10000U, uint8_t(0));
+      data.insert(data.end(), 300U, uint8_t(1));
+
+      Bytes compressed = compress(data);
+
+      CHECK(compressed.size() < 100U);
+      CHECK(data == round_trip(data));
+    }
+
+    //*************************************************************************
+    TEST(test_compress_random_data_fits_bound)
+    {
+      etl::random_xorshift random(7U);
+
+      for (size_t length = 0U; length < 5000U; length += 499U)
+      {
+        Bytes data;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          data.push_back(uint8_t(random()));
+        }
+
+        Bytes compressed = compress(data);
+
+        CHECK(compressed.size() <= etl::lz4_compress_bound(length));
+        CHECK(data == round_trip(data));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compress_mixed_data_and_small_table)
+    {
+      etl::random_xorshift random(11U);
+      Bytes data;
+
+      for (int block = 0; block < 50; ++block)
+      {
+        Bytes log = text_log(size_t(block % 5) + 1U);
+        data.insert(data.end(), log.begin(), log.end());
+
+        for (int i = 0; i < 100; ++i)
+        {
+          data.push_back(uint8_t(random()));
+        }
+      }
+
+      etl::lz4_hash_table<8> small_work;
+
+      Bytes compressed(etl::lz4_compress_bound(data.size()));
+
+      size_t n = etl::lz4_compress(etl::array_view<const uint8_t>(data.data(), data.size()),
+                                   etl::array_view<uint8_t>(compressed.data(), compressed.size()),
+                                   small_work);
+
+      CHECK(n != 0U);
+      CHECK(n < data.size());
+
+      Bytes decompressed(data.size());
+
+      size_t m = etl::lz4_decompress(etl::array_view<const uint8_t>(compressed.data(), n),
+                                     etl::array_view<uint8_t>(decompressed.data(), decompressed.size()));
+
+      CHECK_EQUAL(data.size(), m);
+      CHECK(data == decompressed);
+    }
+
+    //*************************************************************************
+    TEST(test_compress_destination_too_small)
+    {
+      Bytes data = text_log(50U);
+      Bytes compressed = compress(data);
+
+      Bytes small(compressed.size() - 1U);
+
+      CHECK_EQUAL(0U, etl::lz4_compress(etl::array_view<const uint8_t>(data.data(), data.size()),
+                                        etl::array_view<uint8_t>(small.data(), small.size()),
+                                        work));
+
+      Bytes exact(compressed.size());
+
+      CHECK_EQUAL(compressed.size(), etl::lz4_compress(etl::array_view<const uint8_t>(data.data(), data.size()),
+                                                       etl::array_view<uint8_t>(exact.data(), exact.size()),
+                                                       work));
+    }
+
+    //*************************************************************************
+    TEST(test_compress_from_etl_vector)
+    {
+      etl::vector<uint8_t, 512> telemetry;
+
+      for (size_t i = 0U; i < telemetry.capacity(); ++i)
+      {
+        telemetry.push_back(uint8_t(i / 64U));
+      }
+
+      uint8_t compressed[etl::lz4_compress_bound(512U)];
+      uint8_t decompressed[512];
+
+      size_t n = etl::lz4_compress(etl::array_view<const uint8_t>(telemetry.data(), telemetry.size()), etl::array_view<uint8_t>(compressed), work);
+      CHECK(n < 64U);
+
+      size_t m = etl::lz4_decompress(etl::array_view<const uint8_t>(compressed, n), etl::array_view<uint8_t>(decompressed));
+      CHECK_EQUAL(512U, m);
+      CHECK_ARRAY_EQUAL(telemetry.data(), decompressed, 512U);
+    }
+  }
+}
@@ -1288,5 +1288,219 @@ namespace
             }
         }
     }
+
+#if defined(ETL_MAP_ORDER_STATISTICS)
+    //*************************************************************************
+    TEST(test_rank_and_select)
+    {
+      typedef etl::map<int, int, 200> OS_Data;
+      typedef std::map<int, int>      OS_Compare_Data;
+
+      OS_Data data;
+      OS_Compare_Data compare_data;
+      unsigned state = 1U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        state = (state * 1103515245U) + 12345U;
+        int key = int((state >> 8) % 400U);
+
+        if (((state >> 4) % 3U) != 0U)
+        {
+          if (!data.full())
+          {
+            data.insert(std::make_pair(key, i));
+            compare_data.insert(std::make_pair(key, i));
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+        }
+
+        for (int k = key - 2; k <= key + 2; ++k)
+        {
+          CHECK_EQUAL(size_t(std::distance(compare_data.begin(), compare_data.lower_bound(k))), data.rank(k));
+        }
+      }
+
+      OS_Compare_Data::const_iterator i_compare = compare_data.begin();
+
+      for (size_t k = 0U; k < data.size(); ++k)
+      {
+        CHECK_EQUAL((*i_compare).first, (*data.select(k)).first);
+        ++i_compare;
+      }
+
+      CHECK(data.select(data.size()) == data.end());
+
+      const OS_Data& cdata = data;
+      CHECK(cdata.select(0U) == cdata.begin());
+      CHECK_EQUAL(0U, cdata.rank(-1));
+      CHECK_EQUAL(data.size(), cdata.rank(400));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::map<int, std::string, 4> Data;
+
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.emplace(1, 3U, 'a');
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL(std::string("aaa"), result.first->second);
+
+      // Duplicate key.
+      result = data.emplace(1, 2U, 'b');
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("aaa"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.emplace_hint(data.end(), 2, "bb");
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(std::string("bb"), itr->second);
+
+      result = data.emplace(Data::value_type(3, "ccc"));
+      CHECK(result.second);
+
+      // The node used by the duplicate was returned to the pool.
+      data.emplace(4, "dddd");
+      CHECK(data.full());
+      CHECK_EQUAL(std::string("dddd"), data[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_move_only)
+    {
+      typedef etl::map<int, TestDataM<int>, 4> Data;
+
+      Data data;
+
+      data.emplace(2, 20);
+      data.emplace(1, 10);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(10, data.begin()->second.value);
+      CHECK(bool(data.begin()->second));
+    }
+
+    //*************************************************************************
+    TEST(test_extract_and_insert_node_shared_pool)
+    {
+      typedef etl::map<int, TestDataM<int>, 0> Data;
+
+      etl::pool<Data::pool_type, 5> pool;
+
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.emplace(1, 10);
+      data1.emplace(2, 20);
+      data1.emplace(3, 30);
+      data2.emplace(4, 40);
+
+      CHECK_EQUAL(4U, pool.size());
+      CHECK(data1.max_size() == 5U);
+
+      Data::node_type handle = data1.extract(2);
+
+      CHECK(!handle.empty());
+      CHECK_EQUAL(2, handle.key());
+      CHECK_EQUAL(20, handle.mapped().value);
+      CHECK_EQUAL(2U, data1.size());
+      CHECK(data1.find(2) == data1.end());
+      CHECK_EQUAL(4U, pool.size());
+
+      const TestDataM<int>* p_mapped = &handle.mapped();
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(etl::move(handle));
+
+      CHECK(result.second);
+      CHECK(handle.empty());
+      CHECK_EQUAL(2, result.first->first);
+      CHECK(&result.first->second == p_mapped);
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      // Duplicate keys leave the node in the handle.
+      data1.emplace(4, 41);
+      handle = data1.extract(data1.find(4));
+      result = data2.insert(etl::move(handle));
+
+      CHECK(!result.second);
+      CHECK(!handle.empty());
+      CHECK_EQUAL(40, result.first->second.value);
+
+      // Destroying the handle releases the node.
+      handle = Data::node_type();
+      CHECK_EQUAL(4U, pool.size());
+
+      // A missing key gives an empty handle.
+      CHECK(data1.extract(99).empty());
+      CHECK(!data1.insert(Data::node_type()).second);
+
+      data1.clear();
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(20, data2.find(2)->second.value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_node_from_other_pool)
+    {
+      typedef etl::map<int, TestDataM<int>, 4> Data;
+
+      Data data1;
+      Data data2;
+
+      data1.emplace(1, 10);
+      data1.emplace(2, 20);
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(data1.extract(1));
+
+      CHECK(result.second);
+      CHECK_EQUAL(10, result.first->second.value);
+      CHECK_EQUAL(1U, data1.size());
+      CHECK_EQUAL(1U, data2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_map_ext)
+    {
+      typedef etl::map_ext<int, std::string> Data;
+
+      static const size_t MAX = 4U;
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX) <= sizeof(buffer));
+
+      Data data(&buffer, MAX);
+      etl::imap<int, std::string>& idata = data;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+
+      idata[3] = "3";
+      idata[1] = "1";
+      idata[2] = "2";
+      idata[4] = "4";
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert(std::make_pair(5, std::string("5"))), etl::map_full);
+
+      // The nodes are in the supplied buffer.
+      const char* p = reinterpret_cast<const char*>(&*idata.find(2));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX));
+
+      idata.erase(1);
+      idata[5] = "5";
+      CHECK_EQUAL(2, idata.begin()->first);
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer2;
+      Data data2(data.begin(), data.end(), &buffer2, MAX);
+      CHECK(data2 == data);
+    }
   };
 }
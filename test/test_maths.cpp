@@ -35,6 +35,9 @@ SOFTWARE.
 #include "etl/sqrt.h"
 #include "etl/permutations.h"
 #include "etl/combinations.h"
+#include "etl/binary.h"
+
+#include <stdint.h>
 
 namespace
 {
@@ -445,5 +448,47 @@ namespace
       CHECK_EQUAL((combinations(13,  9)), (actual = etl::combinations<13,  9>::value));
       CHECK_EQUAL((combinations(14, 10)), (actual = etl::combinations<14, 10>::value));
     }
+    //*************************************************************************
+    TEST(test_isqrt)
+    {
+      CHECK_EQUAL(0U, etl::isqrt(uint32_t(0U)));
+      CHECK_EQUAL(1U, etl::isqrt(uint32_t(1U)));
+      CHECK_EQUAL(1U, etl::isqrt(uint32_t(3U)));
+      CHECK_EQUAL(2U, etl::isqrt(uint32_t(4U)));
+      CHECK_EQUAL(65535U, etl::isqrt(uint32_t(0xFFFFFFFFU)));
+      CHECK(etl::isqrt(uint64_t(0xFFFFFFFFFFFFFFFFULL)) == 0xFFFFFFFFULL);
+      CHECK(etl::isqrt(uint64_t(0xFFFFFFFE00000001ULL)) == 0xFFFFFFFFULL);
+      CHECK(etl::isqrt(uint64_t(0xFFFFFFFE00000000ULL)) == 0xFFFFFFFEULL);
+
+      for (uint32_t i = 1U; i < 65536U; ++i)
+      {
+        const uint32_t square = i * i;
+
+        CHECK_EQUAL(i,      etl::isqrt(square));
+        CHECK_EQUAL(i - 1U, etl::isqrt(square - 1U));
+        CHECK(etl::isqrt(uint64_t(square)) == i);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ilog2)
+    {
+      CHECK_EQUAL(0, etl::ilog2(uint32_t(0U)));
+      CHECK_EQUAL(0, etl::ilog2(uint64_t(0U)));
+
+      for (uint32_t i = 0U; i < 32U; ++i)
+      {
+        CHECK_EQUAL(i, etl::ilog2(uint32_t(1U) << i));
+        CHECK_EQUAL(i, etl::ilog2((uint32_t(2U) << i) - 1U));
+      }
+
+      for (uint32_t i = 0U; i < 64U; ++i)
+      {
+        CHECK_EQUAL(i, etl::ilog2(uint64_t(1U) << i));
+        CHECK_EQUAL(i, etl::ilog2((uint64_t(1U) << i) | 1U));
+      }
+
+      CHECK_EQUAL(int(etl::log2<100>::value), etl::ilog2(uint32_t(100U)));
+    }
   };
 }
@@ -0,0 +1,331 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/matrix.h"
+#include "etl/multi_array.h"
+
+#include <math.h>
+
+namespace
+{
+  template <typename TMatrix>
+  bool close(const TMatrix& lhs, const TMatrix& rhs, double tolerance)
+  {
+    for (size_t i = 0U; i < TMatrix::SIZE; ++i)
+    {
+      if (fabs(double(lhs.data()[i]) - double(rhs.data()[i])) > tolerance)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_matrix)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      etl::matrix<float, 2, 3> zero;
+
+      for (size_t i = 0U; i < zero.size(); ++i)
+      {
+        CHECK_EQUAL(0.0f, zero.data()[i]);
+      }
+
+      const float values[] = { 1, 2, 3, 4, 5, 6 };
+      etl::matrix<float, 2, 3> m(values);
+
+      CHECK_EQUAL(2U, m.rows());
+      CHECK_EQUAL(3U, m.columns());
+      CHECK_EQUAL(3.0f, m(0, 2));
+      CHECK_EQUAL(4.0f, m(1, 0));
+
+      etl::matrix<int, 3, 3> identity = etl::matrix<int, 3, 3>::identity();
+      CHECK_EQUAL(1, identity(1, 1));
+      CHECK_EQUAL(0, identity(1, 2));
+
+      etl::matrix<int, 2, 2> filled = etl::matrix<int, 2, 2>::filled(7);
+      CHECK_EQUAL(7, filled(1, 0));
+    }
+
+    //*************************************************************************
+    TEST(test_alignment)
+    {
+      CHECK_EQUAL(16U, (etl::matrix<float, 4, 4>::ALIGNMENT));
+      CHECK_EQUAL(16U, (etl::matrix<float, 2, 2>::ALIGNMENT));
+      CHECK_EQUAL(size_t(etl::alignment_of<float>::value), (etl::matrix<float, 3, 3>::ALIGNMENT));
+
+      etl::matrix<float, 4, 4> m;
+      CHECK_EQUAL(0U, reinterpret_cast<size_t>(m.data()) % 16U);
+    }
+
+    //*************************************************************************
+    TEST(test_multi_array_interop)
+    {
+      etl::multi_array<float, 2, 2> a;
+      a[0][0] = 1.0f; a[0][1] = 2.0f;
+      a[1][0] = 3.0f; a[1][1] = 4.0f;
+
+      etl::matrix<float, 2, 2> m(a);
+      CHECK_EQUAL(2.0f, m(0, 1));
+      CHECK_EQUAL(3.0f, m(1, 0));
+
+      m *= 2.0f;
+
+      etl::multi_array<float, 2, 2> b;
+      m.copy_to(b);
+      CHECK_EQUAL(8.0f, b[1][1]);
+    }
+
+    //*************************************************************************
+    TEST(test_elementwise)
+    {
+      const float va[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      const float vb[] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+
+      etl::matrix<float, 2, 4> a(va);
+      etl::matrix<float, 2, 4> b(vb);
+
+      CHECK((etl::matrix<float, 2, 4>::filled(9.0f) == (a + b)));
+      CHECK_EQUAL(-7.0f, (a - b)(0, 0));
+      CHECK_EQUAL(16.0f, (a * 2.0f)(1, 3));
+      CHECK_EQUAL(16.0f, (2.0f * a)(1, 3));
+      CHECK_EQUAL(-5.0f, (-a)(1, 0));
+      CHECK(a != b);
+
+      const int vc[] = { 1, 2, 3 };
+      etl::matrix<int, 1, 3> c(vc);
+      c += c;
+      CHECK_EQUAL(6, c(0, 2));
+      c -= etl::matrix<int, 1, 3>::filled(1);
+      CHECK_EQUAL(5, c(0, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_multiply)
+    {
+      const int va[] = { 1, 2, 3,
+                         4, 5, 6 };
+      const int vb[] = { 7,  8,
+                         9,  10,
+                         11, 12 };
+      const int vr[] = { 58,  64,
+                         139, 154 };
+
+      etl::matrix<int, 2, 3> a(va);
+      etl::matrix<int, 3, 2> b(vb);
+
+      CHECK((etl::matrix<int, 2, 2>(vr) == (a * b)));
+    }
+
+    //*************************************************************************
+    TEST(test_multiply_float_4x4)
+    {
+      float va[16];
+      float vb[16];
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        va[i] = float(i) * 0.5f - 3.0f;
+        vb[i] = float(15U - i) * 0.25f + 1.0f;
+      }
+
+      etl::matrix<float, 4, 4> a(va);
+      etl::matrix<float, 4, 4> b(vb);
+      etl::matrix<float, 4, 4> product = a * b;
+
+      for (size_t r = 0U; r < 4U; ++r)
+      {
+        for (size_t c = 0U; c < 4U; ++c)
+        {
+          float expected = 0.0f;
+
+          for (size_t k = 0U; k < 4U; ++k)
+          {
+            expected += va[(r * 4U) + k] * vb[(k * 4U) + c];
+          }
+
+          CHECK_EQUAL(expected, product(r, c));
+        }
+      }
+
+      CHECK(a == (a * etl::matrix<float, 4, 4>::identity()));
+      CHECK(a == (etl::matrix<float, 4, 4>::identity() * a));
+    }
+
+    //*************************************************************************
+    TEST(test_multiply_non_square_float)
+    {
+      float va[6];
+      float vb[24];
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        va[i] = float(i) + 1.0f;
+      }
+
+      for (size_t i = 0U; i < 24U; ++i)
+      {
+        vb[i] = float(i) - 10.0f;
+      }
+
+      etl::matrix<float, 2, 3> a(va);
+      etl::matrix<float, 3, 8> b(vb);
+      etl::matrix<float, 2, 8> product = a * b;
+
+      for (size_t r = 0U; r < 2U; ++r)
+      {
+        for (size_t c = 0U; c < 8U; ++c)
+        {
+          float expected = 0.0f;
+
+          for (size_t k = 0U; k < 3U; ++k)
+          {
+            expected += va[(r * 3U) + k] * vb[(k * 8U) + c];
+          }
+
+          CHECK_EQUAL(expected, product(r, c));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_matrix_vector)
+    {
+      etl::matrix<float, 4, 4> translate = etl::matrix<float, 4, 4>::identity();
+      translate(0, 3) = 10.0f;
+      translate(1, 3) = 20.0f;
+      translate(2, 3) = 30.0f;
+
+      etl::vec<float, 4> p(1.0f, 2.0f, 3.0f, 1.0f);
+      etl::vec<float, 4> q = translate * p;
+
+      CHECK_EQUAL(11.0f, q[0]);
+      CHECK_EQUAL(22.0f, q[1]);
+      CHECK_EQUAL(33.0f, q[2]);
+      CHECK_EQUAL(1.0f,  q[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_transpose)
+    {
+      const int va[] = { 1, 2, 3,
+                         4, 5, 6 };
+
+      etl::matrix<int, 2, 3> a(va);
+      etl::matrix<int, 3, 2> t = etl::transpose(a);
+
+      CHECK_EQUAL(1, t(0, 0));
+      CHECK_EQUAL(4, t(0, 1));
+      CHECK_EQUAL(3, t(2, 0));
+      CHECK_EQUAL(6, t(2, 1));
+      CHECK(a == etl::transpose(t));
+    }
+
+    //*************************************************************************
+    TEST(test_vec)
+    {
+      etl::vec<int, 3> x(1, 0, 0);
+      etl::vec<int, 3> y(0, 1, 0);
+
+      CHECK_EQUAL(0, etl::dot(x, y));
+      CHECK_EQUAL(1, etl::dot(x, x));
+
+      etl::vec<int, 3> z = etl::cross(x, y);
+      CHECK_EQUAL(0, z[0]);
+      CHECK_EQUAL(0, z[1]);
+      CHECK_EQUAL(1, z[2]);
+
+      etl::vec<int, 3> sum = x + y + z;
+      CHECK_EQUAL(1, sum[0]);
+      CHECK_EQUAL(1, sum[1]);
+      CHECK_EQUAL(1, sum[2]);
+
+      etl::vec<double, 2> v2(3.0, 4.0);
+      CHECK_EQUAL(25.0, etl::dot(v2, v2));
+    }
+
+    //*************************************************************************
+    TEST(test_determinant)
+    {
+      const double v2[] = { 3, 8,
+                            4, 6 };
+      const double v3[] = { 6, 1, 1,
+                            4, -2, 5,
+                            2, 8, 7 };
+      const double v4[] = { 1, 0, 2, -1,
+                            3, 0, 0, 5,
+                            2, 1, 4, -3,
+                            1, 0, 5, 0 };
+
+      CHECK_EQUAL(5.0, etl::determinant(etl::matrix<double, 1, 1>::filled(5.0)));
+      CHECK_EQUAL(-14.0, etl::determinant(etl::matrix<double, 2, 2>(v2)));
+      CHECK_EQUAL(-306.0, etl::determinant(etl::matrix<double, 3, 3>(v3)));
+      CHECK_CLOSE(30.0, etl::determinant(etl::matrix<double, 4, 4>(v4)), 1e-9);
+      CHECK_EQUAL(0.0, etl::determinant(etl::matrix<double, 4, 4>()));
+    }
+
+    //*************************************************************************
+    TEST(test_inverse)
+    {
+      const double v2[] = { 4, 7,
+                            2, 6 };
+
+      etl::matrix<double, 2, 2> m2(v2);
+      etl::matrix<double, 2, 2> i2;
+
+      CHECK(etl::inverse(m2, i2));
+      CHECK(close(etl::matrix<double, 2, 2>::identity(), m2 * i2, 1e-12));
+
+      const double v4[] = { 0, 2, 0, 1,
+                            1, 0, 3, 0,
+                            2, 1, 0, 4,
+                            0, 5, 1, 0 };
+
+      etl::matrix<double, 4, 4> m4(v4);
+      etl::matrix<double, 4, 4> i4;
+
+      CHECK(etl::inverse(m4, i4));
+      CHECK(close(etl::matrix<double, 4, 4>::identity(), m4 * i4, 1e-12));
+      CHECK(close(etl::matrix<double, 4, 4>::identity(), i4 * m4, 1e-12));
+
+      etl::matrix<float, 3, 3> singular = etl::matrix<float, 3, 3>::filled(1.0f);
+      etl::matrix<float, 3, 3> unused;
+      CHECK(!etl::inverse(singular, unused));
+
+      etl::matrix<float, 2, 2> singular2 = etl::matrix<float, 2, 2>::filled(2.0f);
+      etl::matrix<float, 2, 2> unused2;
+      CHECK(!etl::inverse(singular2, unused2));
+    }
+  }
+}
@@ -0,0 +1,266 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/mdspan.h"
+#include "etl/multi_array.h"
+
+namespace
+{
+  SUITE(test_mdspan)
+  {
+    //*************************************************************************
+    TEST(test_extents_static_and_dynamic)
+    {
+      typedef etl::extents<3, etl::dynamic_extent, 4, etl::dynamic_extent> extents_t;
+
+      CHECK_EQUAL(4U, extents_t::rank());
+      CHECK_EQUAL(2U, extents_t::rank_dynamic());
+      CHECK_EQUAL(3U, extents_t::static_extent(0));
+      CHECK_EQUAL(etl::dynamic_extent, extents_t::static_extent(1));
+      CHECK_EQUAL(4U, (extents_t::static_extent_of<2>::value));
+
+      extents_t e(5, 6);
+
+      CHECK_EQUAL(3U, e.extent(0));
+      CHECK_EQUAL(5U, e.extent(1));
+      CHECK_EQUAL(4U, e.extent(2));
+      CHECK_EQUAL(6U, e.extent(3));
+      CHECK_EQUAL(360U, e.size());
+
+      CHECK(e == (etl::dextents<4>(3, 5, 4, 6)));
+      CHECK(e != (etl::dextents<4>(3, 5, 4, 7)));
+    }
+
+    //*************************************************************************
+    TEST(test_layout_right_over_raw_buffer)
+    {
+      int buffer[12];
+
+      for (int i = 0; i < 12; ++i)
+      {
+        buffer[i] = i;
+      }
+
+      etl::mdspan<int, etl::extents<etl::dynamic_extent, 4> > m(buffer, 3);
+
+      CHECK_EQUAL(2U, m.rank());
+      CHECK_EQUAL(3U, m.extent(0));
+      CHECK_EQUAL(4U, m.extent(1));
+      CHECK_EQUAL(4U, m.stride(0));
+      CHECK_EQUAL(1U, m.stride(1));
+      CHECK_EQUAL(12U, m.size());
+      CHECK(m.is_contiguous());
+
+      for (size_t r = 0U; r < 3U; ++r)
+      {
+        for (size_t c = 0U; c < 4U; ++c)
+        {
+          CHECK_EQUAL(int(r * 4U + c), m(r, c));
+        }
+      }
+
+      m(2, 3) = 100;
+      CHECK_EQUAL(100, buffer[11]);
+
+      etl::array<size_t, 2> idx = { 1U, 2U };
+      CHECK_EQUAL(6, m[idx]);
+    }
+
+    //*************************************************************************
+    TEST(test_layout_left)
+    {
+      int buffer[6] = { 0, 1, 2, 3, 4, 5 };
+
+      etl::mdspan<int, etl::extents<2, 3>, etl::layout_left> m(buffer);
+
+      CHECK_EQUAL(1U, m.stride(0));
+      CHECK_EQUAL(2U, m.stride(1));
+      CHECK_EQUAL(0, m(0, 0));
+      CHECK_EQUAL(1, m(1, 0));
+      CHECK_EQUAL(2, m(0, 1));
+      CHECK_EQUAL(5, m(1, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_make_mdspan_from_multi_array)
+    {
+      etl::multi_array<int, 2, 3, 4> data;
+
+      for (size_t i = 0U; i < 2U; ++i)
+      {
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+          for (size_t k = 0U; k < 4U; ++k)
+          {
+            data[i][j][k] = int(i * 100U + j * 10U + k);
+          }
+        }
+      }
+
+      etl::mdspan<int, etl::extents<2, 3, 4> > m = etl::make_mdspan(data);
+
+      CHECK_EQUAL(3U, m.rank());
+      CHECK_EQUAL(0U, m.rank_dynamic());
+      CHECK_EQUAL(24U, m.size());
+      CHECK_EQUAL(123, m(1, 2, 3));
+      CHECK_EQUAL(12, m(0, 1, 2));
+
+      m(1, 0, 2) = -1;
+      CHECK_EQUAL(-1, data[1][0][2]);
+
+      const etl::multi_array<int, 2, 3, 4>& cdata = data;
+      etl::mdspan<const int, etl::extents<2, 3, 4> > cm = etl::make_mdspan(cdata);
+      CHECK_EQUAL(123, cm(1, 2, 3));
+
+      etl::mdspan<const int, etl::extents<2, 3, 4> > converted(m);
+      CHECK_EQUAL(-1, converted(1, 0, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_row_and_column)
+    {
+      etl::multi_array<int, 3, 4> data;
+
+      for (size_t r = 0U; r < 3U; ++r)
+      {
+        for (size_t c = 0U; c < 4U; ++c)
+        {
+          data[r][c] = int(r * 10U + c);
+        }
+      }
+
+      etl::mdspan<int, etl::extents<3, 4> > m = etl::make_mdspan(data);
+
+      etl::mdspan<int, etl::extents<4>, etl::layout_stride> row1 = etl::row(m, 1);
+      CHECK_EQUAL(4U, row1.extent(0));
+      CHECK_EQUAL(1U, row1.stride(0));
+      CHECK(row1.is_contiguous());
+
+      for (size_t c = 0U; c < 4U; ++c)
+      {
+        CHECK_EQUAL(int(10U + c), row1(c));
+      }
+
+      etl::mdspan<int, etl::extents<3>, etl::layout_stride> col2 = etl::column(m, 2);
+      CHECK_EQUAL(3U, col2.extent(0));
+      CHECK_EQUAL(4U, col2.stride(0));
+      CHECK(!col2.is_contiguous());
+
+      for (size_t r = 0U; r < 3U; ++r)
+      {
+        CHECK_EQUAL(int(r * 10U + 2U), col2(r));
+      }
+
+      col2(1) = 99;
+      CHECK_EQUAL(99, data[1][2]);
+    }
+
+    //*************************************************************************
+    TEST(test_row_and_column_dynamic)
+    {
+      int buffer[15];
+
+      for (int i = 0; i < 15; ++i)
+      {
+        buffer[i] = i;
+      }
+
+      etl::mdspan<int, etl::dextents<2> > m(buffer, 3, 5);
+
+      etl::mdspan<int, etl::dextents<1>, etl::layout_stride> row2 = etl::row(m, 2);
+      CHECK_EQUAL(5U, row2.extent(0));
+      CHECK_EQUAL(10, row2(0));
+      CHECK_EQUAL(14, row2(4));
+
+      etl::mdspan<int, etl::dextents<1>, etl::layout_stride> col4 = etl::column(m, 4);
+      CHECK_EQUAL(3U, col4.extent(0));
+      CHECK_EQUAL(4, col4(0));
+      CHECK_EQUAL(9, col4(1));
+      CHECK_EQUAL(14, col4(2));
+    }
+
+    //*************************************************************************
+    TEST(test_subspan_block)
+    {
+      etl::multi_array<int, 4, 5> data;
+
+      for (size_t r = 0U; r < 4U; ++r)
+      {
+        for (size_t c = 0U; c < 5U; ++c)
+        {
+          data[r][c] = int(r * 10U + c);
+        }
+      }
+
+      etl::mdspan<int, etl::extents<4, 5> > m = etl::make_mdspan(data);
+
+      etl::array<size_t, 2> offsets = { 1U, 2U };
+      etl::array<size_t, 2> sizes   = { 2U, 3U };
+
+      etl::mdspan<int, etl::dextents<2>, etl::layout_stride> block = etl::subspan(m, offsets, sizes);
+
+      CHECK_EQUAL(2U, block.extent(0));
+      CHECK_EQUAL(3U, block.extent(1));
+      CHECK_EQUAL(5U, block.stride(0));
+      CHECK_EQUAL(1U, block.stride(1));
+      CHECK_EQUAL(6U, block.size());
+      CHECK_EQUAL(8U, block.mapping().required_span_size());
+      CHECK(!block.is_contiguous());
+
+      for (size_t r = 0U; r < 2U; ++r)
+      {
+        for (size_t c = 0U; c < 3U; ++c)
+        {
+          CHECK_EQUAL(int((r + 1U) * 10U + (c + 2U)), block(r, c));
+        }
+      }
+
+      // A column of the block.
+      etl::mdspan<int, etl::dextents<1>, etl::layout_stride> col = etl::column(block, 1);
+      CHECK_EQUAL(2U, col.extent(0));
+      CHECK_EQUAL(13, col(0));
+      CHECK_EQUAL(23, col(1));
+
+      block(1, 2) = -5;
+      CHECK_EQUAL(-5, data[2][4]);
+    }
+
+    //*************************************************************************
+    TEST(test_default_and_empty)
+    {
+      etl::mdspan<int, etl::dextents<2> > m;
+
+      CHECK(m.data() == nullptr);
+      CHECK(m.empty());
+      CHECK_EQUAL(0U, m.size());
+    }
+  }
+}
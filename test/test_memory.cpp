@@ -323,6 +323,57 @@ namespace
       CHECK_EQUAL(0U, count);
     }
 
+    //*************************************************************************
+    TEST(test_uninitialized_copy_and_move_trivially_copyable_struct)
+    {
+      struct Item
+      {
+        uint32_t a;
+        uint32_t b;
+        uint64_t c;
+      };
+
+      CHECK(etl::is_trivially_copyable<Item>::value);
+
+      Item input[SIZE];
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        input[i].a = uint32_t(i);
+        input[i].b = uint32_t(i * 2U);
+        input[i].c = uint64_t(i * 3U);
+      }
+
+      Item  output[SIZE];
+      Item* p = output;
+
+      std::fill(reinterpret_cast<char*>(p), reinterpret_cast<char*>(p + SIZE), 0);
+
+      Item* result = etl::uninitialized_copy(input, input + SIZE, p);
+      CHECK(result == p + SIZE);
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(input[i].a, p[i].a);
+        CHECK_EQUAL(input[i].b, p[i].b);
+        CHECK_EQUAL(input[i].c, p[i].c);
+      }
+
+      std::fill(reinterpret_cast<char*>(p), reinterpret_cast<char*>(p + SIZE), 0);
+
+      size_t count = 0U;
+      result = etl::uninitialized_move(input, input + SIZE, p, count);
+      CHECK(result == p + SIZE);
+      CHECK_EQUAL(SIZE, count);
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(input[i].a, p[i].a);
+        CHECK_EQUAL(input[i].b, p[i].b);
+        CHECK_EQUAL(input[i].c, p[i].c);
+      }
+    }
+
     //*************************************************************************
     TEST(test_uninitialized_move)
     {
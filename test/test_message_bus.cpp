@@ -722,5 +722,136 @@ namespace
       CHECK_EQUAL(3, router4a.order);
       CHECK_EQUAL(4, router3.order);
     }
+
+    //*************************************************************************
+    TEST(message_bus_receive_batch)
+    {
+      etl::message_bus<2> bus;
+
+      RouterA routerA(ROUTER1);
+      RouterB routerB(ROUTER2);
+      RouterA sender(ROUTER5);
+
+      bus.subscribe(routerA);
+      bus.subscribe(routerB);
+
+      typedef RouterA::message_packet Packet;
+
+      const Packet packets[] = { Packet(message1), Packet(message3), Packet(message3), Packet(message2) };
+
+      // RouterB does not accept Message3.
+      bus.receive_batch(sender, etl::message_batch(packets, 4U));
+      CHECK_EQUAL(1, routerA.message1_count);
+      CHECK_EQUAL(1, routerA.message2_count);
+      CHECK_EQUAL(2, routerA.message3_count);
+      CHECK_EQUAL(1, routerB.message1_count);
+      CHECK_EQUAL(1, routerB.message2_count);
+      CHECK_EQUAL(0, routerB.message_unknown_count);
+      CHECK_EQUAL(6, sender.message5_count);
+
+      // Through the interface.
+      etl::imessage_router& ibus = bus;
+      ibus.receive_batch(packets, 1U);
+      CHECK_EQUAL(2, routerA.message1_count);
+      CHECK_EQUAL(2, routerB.message1_count);
+    }
+
+    //*************************************************************************
+    class CountingRouterB : public RouterB
+    {
+    public:
+
+      CountingRouterB(etl::message_router_id_t id)
+        : RouterB(id),
+          accepts_count(0)
+      {
+      }
+
+      using RouterB::accepts;
+
+      bool accepts(etl::message_id_t id) const
+      {
+        ++accepts_count;
+        return RouterB::accepts(id);
+      }
+
+      mutable int accepts_count;
+    };
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      // Index message ids 0 to 3. Message5 is not indexed.
+      etl::message_bus<40, 4> bus;
+
+      static RouterA routerA[20] = { { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 }, { 8 }, { 9 }, { 10 }, { 11 },
+                                     { 12 }, { 13 }, { 14 }, { 15 }, { 16 }, { 17 }, { 18 }, { 19 }, { 20 } };
+      static CountingRouterB routerB[20] = { { 21 }, { 22 }, { 23 }, { 24 }, { 25 }, { 26 }, { 27 }, { 28 }, { 29 }, { 30 },
+                                            { 31 }, { 32 }, { 33 }, { 34 }, { 35 }, { 36 }, { 37 }, { 38 }, { 39 }, { 40 } };
+
+      for (int i = 0; i < 20; ++i)
+      {
+        bus.subscribe(routerA[i]);
+        bus.subscribe(routerB[i]);
+      }
+
+      CHECK_EQUAL(40U, bus.size());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        routerB[i].accepts_count = 0;
+      }
+
+      // Only routers A accept message 3.
+      bus.receive(message3);
+      bus.receive(message1);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(1, routerA[i].message3_count);
+        CHECK_EQUAL(1, routerA[i].message1_count);
+        CHECK_EQUAL(0, routerB[i].message_unknown_count);
+        CHECK_EQUAL(1, routerB[i].message1_count);
+
+        // Delivery used the index.
+        CHECK_EQUAL(0, routerB[i].accepts_count);
+      }
+
+      // Not indexed, so delivered by asking each router.
+      bus.receive(message5);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(1, routerA[i].message5_count);
+        CHECK_EQUAL(1, routerB[i].message5_count);
+        CHECK_EQUAL(1, routerB[i].accepts_count);
+      }
+
+      // The index follows unsubscription.
+      bus.unsubscribe(routerA[0]);
+      bus.unsubscribe(ROUTER2);
+      bus.unsubscribe(routerB[19]);
+      CHECK_EQUAL(37U, bus.size());
+
+      bus.receive(message4);
+
+      CHECK_EQUAL(0, routerA[0].message4_count);
+      CHECK_EQUAL(0, routerA[1].message4_count);
+      CHECK_EQUAL(0, routerB[19].message4_count);
+
+      for (int i = 2; i < 20; ++i)
+      {
+        CHECK_EQUAL(1, routerA[i].message4_count);
+      }
+
+      for (int i = 0; i < 19; ++i)
+      {
+        CHECK_EQUAL(1, routerB[i].message4_count);
+      }
+
+      bus.clear();
+      bus.receive(message4);
+      CHECK_EQUAL(1, routerA[2].message4_count);
+    }
   };
 }
@@ -0,0 +1,346 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <string>
+#include <atomic>
+
+#include "etl/message_inbox.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  // A message that owns memory, to check that packets are copied properly.
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+    Message2(const std::string& text_)
+      : text(text_)
+    {
+    }
+
+    std::string text;
+  };
+
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id),
+        message1_count(0),
+        message2_count(0),
+        unknown_count(0),
+        sum(0),
+        p_last_sender(nullptr)
+    {
+    }
+
+    void on_receive(etl::imessage_router& sender, const Message1& msg)
+    {
+      ++message1_count;
+      sum += msg.value;
+      p_last_sender = &sender;
+    }
+
+    void on_receive(etl::imessage_router& sender, const Message2& msg)
+    {
+      ++message2_count;
+      text += msg.text;
+      p_last_sender = &sender;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++unknown_count;
+    }
+
+    int   message1_count;
+    int   message2_count;
+    int   unknown_count;
+    long  sum;
+    std::string text;
+    etl::imessage_router* p_last_sender;
+  };
+
+  //***************************************************************************
+  class Sender : public etl::message_router<Sender, Message3>
+  {
+  public:
+
+    Sender()
+      : message_router(ROUTER2)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message3&)
+    {
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+  };
+
+  SUITE(test_message_inbox)
+  {
+    //*************************************************************************
+    TEST(test_messages_are_delivered_on_process)
+    {
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 4> inbox(router);
+
+      CHECK_EQUAL(ROUTER1, inbox.get_message_router_id());
+      CHECK(inbox.empty());
+
+      etl::send_message(inbox, Message1(1));
+      etl::send_message(inbox, Message1(2));
+      etl::send_message(inbox, Message2("abc"));
+
+      CHECK(!inbox.empty());
+      CHECK_EQUAL(0, router.message1_count);
+      CHECK_EQUAL(0, router.message2_count);
+
+      CHECK_EQUAL(3U, inbox.process());
+
+      CHECK(inbox.empty());
+      CHECK_EQUAL(2, router.message1_count);
+      CHECK_EQUAL(1, router.message2_count);
+      CHECK_EQUAL(3, router.sum);
+      CHECK_EQUAL(std::string("abc"), router.text);
+      CHECK(router.p_last_sender == &etl::null_message_router::instance());
+
+      CHECK_EQUAL(0U, inbox.process());
+    }
+
+    //*************************************************************************
+    TEST(test_process_one_preserves_order)
+    {
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 4> inbox(router);
+
+      etl::send_message(inbox, Message2("a"));
+      etl::send_message(inbox, Message2("b"));
+      etl::send_message(inbox, Message2("c"));
+
+      CHECK(inbox.process_one());
+      CHECK_EQUAL(std::string("a"), router.text);
+      CHECK(inbox.process_one());
+      CHECK_EQUAL(std::string("ab"), router.text);
+      CHECK(inbox.process_one());
+      CHECK_EQUAL(std::string("abc"), router.text);
+      CHECK(!inbox.process_one());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_removes_without_delivering)
+    {
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 4> inbox(router);
+
+      etl::send_message(inbox, Message1(3));
+      etl::send_message(inbox, Message2("b"));
+
+      etl::message_inbox<Router, 4>::item_type item;
+
+      CHECK(inbox.pop(item));
+      CHECK_EQUAL(int(MESSAGE1), int(item.get().message_id));
+      CHECK_EQUAL(3, static_cast<const Message1&>(item.get()).value);
+      CHECK_EQUAL(0, router.message1_count);
+
+      CHECK(inbox.pop(item));
+      CHECK_EQUAL(int(MESSAGE2), int(item.get().message_id));
+      CHECK(!inbox.pop(item));
+      CHECK(inbox.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_sender_is_passed_on)
+    {
+      Router router(ROUTER1);
+      Sender sender;
+      etl::message_inbox<Router, 4> inbox(router);
+
+      etl::send_message(sender, inbox, Message1(1));
+      inbox.process();
+
+      CHECK(router.p_last_sender == &sender);
+    }
+
+    //*************************************************************************
+    TEST(test_unaccepted_messages_are_not_queued)
+    {
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 4> inbox(router);
+
+      CHECK(inbox.accepts(MESSAGE1));
+      CHECK(!inbox.accepts(MESSAGE3));
+
+      CHECK(inbox.post(etl::null_message_router::instance(), Message3()));
+      CHECK(inbox.empty());
+      CHECK_EQUAL(0U, inbox.get_overflow_count());
+    }
+
+    //*************************************************************************
+    TEST(test_full_inbox_does_not_block)
+    {
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 2> inbox(router);
+
+      CHECK_EQUAL(2U, inbox.capacity());
+
+      CHECK(inbox.post(etl::null_message_router::instance(), Message1(1)));
+      CHECK(inbox.post(etl::null_message_router::instance(), Message1(2)));
+      CHECK(!inbox.post(etl::null_message_router::instance(), Message1(4)));
+      CHECK(!inbox.post(etl::null_message_router::instance(), Message2("lost")));
+
+      CHECK_EQUAL(2U, inbox.get_overflow_count());
+      CHECK_EQUAL(2U, inbox.process());
+      CHECK_EQUAL(3, router.sum);
+      CHECK_EQUAL(std::string(""), router.text);
+    }
+
+    //*************************************************************************
+    TEST(test_destination_router_id)
+    {
+      Router router(ROUTER1);
+      Sender sender;
+      etl::message_inbox<Router, 4> inbox(router);
+
+      inbox.receive(sender, ROUTER2, Message1(1));
+      inbox.receive(sender, ROUTER1, Message1(2));
+      inbox.receive(sender, etl::imessage_router::ALL_MESSAGE_ROUTERS, Message1(4));
+
+      CHECK_EQUAL(2U, inbox.process());
+      CHECK_EQUAL(6, router.sum);
+    }
+
+    //*************************************************************************
+    TEST(test_subscribed_to_bus)
+    {
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+      etl::message_inbox<Router, 4> inbox1(router1);
+      etl::message_inbox<Router, 4, etl::message_inbox_mpsc> inbox2(router2);
+
+      etl::message_bus<2> bus;
+
+      bus.subscribe(inbox1);
+      bus.subscribe(inbox2);
+
+      bus.receive(Message1(1));
+      bus.receive(ROUTER2, Message2("two"));
+
+      CHECK_EQUAL(0, router1.message1_count);
+      CHECK_EQUAL(0, router2.message1_count);
+
+      CHECK_EQUAL(1U, inbox1.process());
+      CHECK_EQUAL(2U, inbox2.process());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router1.message2_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(std::string("two"), router2.text);
+    }
+
+    //*************************************************************************
+#if REALTIME_TEST
+    TEST(test_multiple_threads_post_to_mpsc_inbox)
+    {
+      const int PER_THREAD = 100000;
+
+      Router router(ROUTER1);
+      etl::message_inbox<Router, 64, etl::message_inbox_mpsc> inbox(router);
+
+      std::atomic<int> running(2);
+
+      auto poster = [&](int value)
+      {
+        for (int i = 0; i < PER_THREAD; ++i)
+        {
+          while (!inbox.post(etl::null_message_router::instance(), Message1(value)))
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        --running;
+      };
+
+      std::thread t1(poster, 1);
+      std::thread t2(poster, 2);
+
+      while ((running.load() != 0) || !inbox.empty())
+      {
+        inbox.process();
+      }
+
+      t1.join();
+      t2.join();
+
+      inbox.process();
+
+      CHECK_EQUAL(2 * PER_THREAD, router.message1_count);
+      CHECK_EQUAL(3L * PER_THREAD, router.sum);
+    }
+#endif
+  }
+}
@@ -0,0 +1,277 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/message_pool.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/queue.h"
+
+namespace
+{
+  enum
+  {
+    SMALL,
+    LARGE
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  int live_messages;
+
+  //***********************************
+  struct Small : public etl::message<SMALL>
+  {
+    Small(int value_)
+      : value(value_)
+    {
+      ++live_messages;
+    }
+
+    Small(const Small& other)
+      : etl::message<SMALL>(),
+        value(other.value)
+    {
+      ++live_messages;
+    }
+
+    ~Small()
+    {
+      --live_messages;
+    }
+
+    int value;
+  };
+
+  //***********************************
+  struct Large : public etl::message<LARGE>
+  {
+    Large()
+    {
+      ++live_messages;
+
+      for (int i = 0; i < 32; ++i)
+      {
+        data[i] = i;
+      }
+    }
+
+    ~Large()
+    {
+      --live_messages;
+    }
+
+    int data[32];
+  };
+
+  typedef etl::message_pool<sizeof(Small), 2, sizeof(Large), 2> Pool;
+
+  //***********************************
+  // Keeps the messages that it receives, without copying them.
+  //***********************************
+  class Keeper : public etl::message_router<Keeper, Small, Large>
+  {
+  public:
+
+    Keeper(etl::message_router_id_t id, etl::imessage_pool& pool_)
+      : message_router(id),
+        pool(pool_)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Small& message)
+    {
+      kept.push(pool.share(message));
+    }
+
+    void on_receive(etl::imessage_router&, const Large& message)
+    {
+      kept.push(pool.share(message));
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    etl::imessage_pool& pool;
+    etl::queue<etl::message_ptr, 4> kept;
+  };
+
+  SUITE(test_message_pool)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Pool pool;
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.available(sizeof(Small)));
+      CHECK_EQUAL(2U, pool.available(sizeof(Large)));
+      CHECK_EQUAL(sizeof(void*), sizeof(etl::message_ptr));
+    }
+
+    //*************************************************************************
+    TEST(test_create_and_release)
+    {
+      Pool pool;
+      live_messages = 0;
+
+      {
+        etl::message_ptr p = pool.create<Small>(42);
+
+        CHECK(p.is_valid());
+        CHECK_EQUAL(1U, p.use_count());
+        CHECK_EQUAL(SMALL, p->message_id);
+        CHECK_EQUAL(42, static_cast<const Small&>(*p).value);
+        CHECK_EQUAL(1, live_messages);
+        CHECK_EQUAL(1U, pool.size());
+
+        // Small messages use the small slab first.
+        CHECK_EQUAL(3U, pool.available(sizeof(Small)));
+        CHECK_EQUAL(2U, pool.available(sizeof(Large)));
+      }
+
+      CHECK_EQUAL(0, live_messages);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_handles)
+    {
+      Pool pool;
+      live_messages = 0;
+
+      etl::message_ptr p1 = pool.create<Large>();
+      etl::message_ptr p2(p1);
+      etl::message_ptr p3;
+
+      CHECK(!p3.is_valid());
+      CHECK_EQUAL(0U, p3.use_count());
+
+      p3 = p2;
+      CHECK_EQUAL(3U, p1.use_count());
+      CHECK(&p1.get() == &p3.get());
+
+      // Self assignment.
+      p3 = p3;
+      CHECK_EQUAL(3U, p1.use_count());
+
+      p1.reset();
+      p2.reset();
+      CHECK_EQUAL(1, live_messages);
+      CHECK_EQUAL(1U, p3.use_count());
+
+      p3.reset();
+      CHECK_EQUAL(0, live_messages);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_larger_slab)
+    {
+      Pool pool;
+      live_messages = 0;
+
+      etl::message_ptr p1 = pool.create<Small>(1);
+      etl::message_ptr p2 = pool.create<Small>(2);
+      etl::message_ptr p3 = pool.create<Small>(3);
+
+      CHECK_EQUAL(3U, pool.size());
+      CHECK_EQUAL(1U, pool.available(sizeof(Large)));
+      CHECK_EQUAL(3, static_cast<const Small&>(*p3).value);
+
+      etl::message_ptr p4 = pool.create<Small>(4);
+      CHECK_EQUAL(0U, pool.available(sizeof(Small)));
+
+      CHECK_THROW(pool.create<Small>(5), etl::message_pool_cannot_create);
+      CHECK_EQUAL(4, live_messages);
+
+      p1.reset();
+      CHECK_THROW(pool.create<Large>(), etl::message_pool_cannot_create);
+      CHECK(pool.create<Small>(6).is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_and_broadcast_without_copying)
+    {
+      Pool pool;
+      etl::message_bus<2> bus;
+      Keeper keeper1(ROUTER1, pool);
+      Keeper keeper2(ROUTER2, pool);
+      live_messages = 0;
+
+      bus.subscribe(keeper1);
+      bus.subscribe(keeper2);
+
+      etl::queue<etl::message_ptr, 4> queue;
+
+      queue.push(pool.create<Small>(1));
+      queue.push(pool.create<Large>());
+      CHECK_EQUAL(2, live_messages);
+
+      while (!queue.empty())
+      {
+        bus.receive(*queue.front());
+        queue.pop();
+      }
+
+      // Both routers hold the same two messages.
+      CHECK_EQUAL(2, live_messages);
+      CHECK_EQUAL(2U, keeper1.kept.size());
+      CHECK_EQUAL(2U, keeper2.kept.size());
+      CHECK(&keeper1.kept.front().get() == &keeper2.kept.front().get());
+      CHECK_EQUAL(2U, keeper1.kept.front().use_count());
+
+      keeper1.kept.clear();
+      keeper2.kept.clear();
+
+      CHECK_EQUAL(0, live_messages);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_share_message_not_in_pool)
+    {
+      Pool pool;
+      Small message(1);
+
+      CHECK(!pool.is_in_pool(message));
+      CHECK_THROW(pool.share(message), etl::message_pool_not_in_pool);
+
+      etl::message_ptr p = pool.create<Small>(2);
+      CHECK(pool.is_in_pool(*p));
+    }
+  };
+}
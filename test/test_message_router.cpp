@@ -474,5 +474,270 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+    //*************************************************************************
+    TEST(message_router_receive_batch)
+    {
+      Router1 r1;
+      Router2 r2;
+
+      typedef Router1::message_packet Packet;
+
+      const Packet packets[] = { Packet(message1), Packet(message1), Packet(message3), Packet(message4), Packet(message1) };
+
+      // Router2 does not handle Message3.
+      r2.receive_batch(r1, etl::message_batch(packets, 5U));
+      CHECK_EQUAL(3, r2.message1_count);
+      CHECK_EQUAL(0, r2.message2_count);
+      CHECK_EQUAL(1, r2.message4_count);
+      CHECK_EQUAL(1, r2.message_unknown_count);
+      CHECK_EQUAL(5, r1.callback_count);
+
+      // Forwarded to the successor.
+      r2.set_successor(r1);
+      r2.receive_batch(packets + 2U, 2U);
+      CHECK_EQUAL(1, r1.message3_count);
+      CHECK_EQUAL(2, r2.message4_count);
+      CHECK_EQUAL(1, r2.message_unknown_count);
+
+      // Through the interface.
+      etl::imessage_router& ir1 = r1;
+      ir1.receive_batch(packets, 5U);
+      CHECK_EQUAL(3, r1.message1_count);
+      CHECK_EQUAL(2, r1.message3_count);
+      CHECK_EQUAL(1, r1.message4_count);
+
+      r1.receive_batch(packets, 0U);
+      CHECK_EQUAL(3, r1.message1_count);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+    //*************************************************************************
+    template <int N>
+    struct MessageN : public etl::message<100 + N>
+    {
+    };
+
+    class RouterMany : public etl::message_router<RouterMany,
+                                                  MessageN<1>,  MessageN<2>,  MessageN<3>,  MessageN<4>,  MessageN<5>,
+                                                  MessageN<6>,  MessageN<7>,  MessageN<8>,  MessageN<9>,  MessageN<10>,
+                                                  MessageN<11>, MessageN<12>, MessageN<13>, MessageN<14>, MessageN<15>,
+                                                  MessageN<16>, MessageN<17>, MessageN<18>, MessageN<19>, MessageN<20>>
+    {
+    public:
+
+      RouterMany()
+        : message_router(ROUTER1),
+          sum(0),
+          unknown_count(0)
+      {
+      }
+
+      template <int N>
+      void on_receive(etl::imessage_router&, const MessageN<N>&)
+      {
+        sum += N;
+      }
+
+      void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+      {
+        ++unknown_count;
+      }
+
+      int sum;
+      int unknown_count;
+    };
+
+    TEST(message_router_more_than_16_types)
+    {
+      RouterMany router;
+
+      router.receive(MessageN<1>());
+      router.receive(MessageN<17>());
+      router.receive(MessageN<20>());
+      router.receive(message1);
+
+      CHECK_EQUAL(38, router.sum);
+      CHECK_EQUAL(1, router.unknown_count);
+
+      CHECK(router.accepts(101));
+      CHECK(router.accepts(120));
+      CHECK(!router.accepts(100));
+      CHECK(!router.accepts(121));
+
+      RouterMany::message_packet packet(static_cast<const etl::imessage&>(MessageN<19>()));
+      CHECK_EQUAL(119, packet.get().message_id);
+    }
+
+    //*************************************************************************
+    class RouterSpread : public etl::message_router<RouterSpread, MessageN<150>, Message2, MessageN<-95>>
+    {
+    public:
+
+      RouterSpread()
+        : message_router(ROUTER1),
+          sum(0),
+          unknown_count(0)
+      {
+      }
+
+      template <int N>
+      void on_receive(etl::imessage_router&, const MessageN<N>&)
+      {
+        sum += N;
+      }
+
+      void on_receive(etl::imessage_router&, const Message2&)
+      {
+        sum += 1000;
+      }
+
+      void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+      {
+        ++unknown_count;
+      }
+
+      int sum;
+      int unknown_count;
+    };
+
+    TEST(message_router_spread_ids)
+    {
+      RouterSpread router;
+
+      router.receive(MessageN<-95>());
+      router.receive(MessageN<150>());
+      router.receive(message2);
+      router.receive(message1);
+      router.receive(MessageN<50>());
+
+      CHECK_EQUAL(1055, router.sum);
+      CHECK_EQUAL(2, router.unknown_count);
+
+      CHECK(router.accepts(5));
+      CHECK(router.accepts(MESSAGE2));
+      CHECK(router.accepts(250));
+      CHECK(!router.accepts(MESSAGE1));
+      CHECK(!router.accepts(MESSAGE3));
+      CHECK(!router.accepts(251));
+    }
+
+    //*************************************************************************
+    template <int N>
+    struct MessageL : public etl::message<10 + N>
+    {
+      char payload[N];
+    };
+
+    class RouterLarge : public etl::message_router<RouterLarge,
+      MessageL<1>,  MessageL<2>,  MessageL<3>,  MessageL<4>,  MessageL<5>,  MessageL<6>,  MessageL<7>,  MessageL<8>,
+      MessageL<9>,  MessageL<10>, MessageL<11>, MessageL<12>, MessageL<13>, MessageL<14>, MessageL<15>, MessageL<16>,
+      MessageL<17>, MessageL<18>, MessageL<19>, MessageL<20>, MessageL<21>, MessageL<22>, MessageL<23>, MessageL<24>,
+      MessageL<25>, MessageL<26>, MessageL<27>, MessageL<28>, MessageL<29>, MessageL<30>, MessageL<31>, MessageL<32>,
+      MessageL<33>, MessageL<34>, MessageL<35>, MessageL<36>, MessageL<37>, MessageL<38>, MessageL<39>, MessageL<40>,
+      MessageL<41>, MessageL<42>, MessageL<43>, MessageL<44>>
+    {
+    public:
+
+      RouterLarge()
+        : message_router(ROUTER1),
+          last(0)
+      {
+      }
+
+      template <int N>
+      void on_receive(etl::imessage_router&, const MessageL<N>&)
+      {
+        last = N;
+      }
+
+      void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+      {
+        last = -1;
+      }
+
+      int last;
+    };
+
+    TEST(message_router_44_types)
+    {
+      RouterLarge router;
+
+      router.receive(MessageL<1>());
+      CHECK_EQUAL(1, router.last);
+
+      router.receive(MessageL<44>());
+      CHECK_EQUAL(44, router.last);
+
+      router.receive(MessageL<23>());
+      CHECK_EQUAL(23, router.last);
+
+      router.receive(message1);
+      CHECK_EQUAL(-1, router.last);
+
+      // The packet is sized for the largest message.
+      CHECK(size_t(RouterLarge::message_packet::SIZE) >= sizeof(MessageL<44>));
+
+      const MessageL<44> message44 = MessageL<44>();
+      RouterLarge::message_packet packet(static_cast<const etl::imessage&>(message44));
+      CHECK_EQUAL(54, packet.get().message_id);
+
+      router.receive(packet.get());
+      CHECK_EQUAL(44, router.last);
+    }
+
+    //*************************************************************************
+    int destructed = 0;
+
+    struct MessageD : public etl::message<200>
+    {
+      ~MessageD()
+      {
+        ++destructed;
+      }
+    };
+
+    class RouterD : public etl::message_router<RouterD, MessageD, MessageN<1>>
+    {
+    public:
+
+      RouterD()
+        : message_router(ROUTER1)
+      {
+      }
+
+      void on_receive(etl::imessage_router&, const MessageD&)
+      {
+      }
+
+      void on_receive(etl::imessage_router&, const MessageN<1>&)
+      {
+      }
+
+      void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+      {
+      }
+    };
+
+    TEST(message_router_packet_destruction)
+    {
+#if !defined(ETL_MESSAGES_ARE_VIRTUAL) && !defined(ETL_POLYMORPHIC_MESSAGES)
+      // Packets of trivially destructible messages skip the destructor look up.
+      CHECK(RouterMany::message_packet::TRIVIALLY_DESTRUCTIBLE);
+#endif
+      CHECK(!RouterD::message_packet::TRIVIALLY_DESTRUCTIBLE);
+
+      {
+        const MessageD message;
+        destructed = 0;
+
+        {
+          RouterD::message_packet packet(static_cast<const etl::imessage&>(message));
+        }
+
+        CHECK_EQUAL(1, destructed);
+      }
+    }
+#endif
   };
 }
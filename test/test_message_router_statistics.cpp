@@ -0,0 +1,283 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/fsm.h"
+
+#if defined(ETL_MESSAGE_ROUTER_STATISTICS)
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3,
+    MESSAGE4 = 10
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2,
+    FSM1    = 3
+  };
+
+  struct Message1 : public etl::message<MESSAGE1> {};
+  struct Message2 : public etl::message<MESSAGE2> {};
+  struct Message3 : public etl::message<MESSAGE3> {};
+  struct Message4 : public etl::message<MESSAGE4> {};
+
+  //***************************************************************************
+  // Advances by the 'cost' of each handler.
+  //***************************************************************************
+  struct Clock
+  {
+    static etl::message_router_timestamp_t now()
+    {
+      return time;
+    }
+
+    static etl::message_router_timestamp_t time;
+  };
+
+  etl::message_router_timestamp_t Clock::time;
+
+  //***************************************************************************
+  class Router1 : public etl::message_router<Router1, Message1, Message2, Message4>
+  {
+  public:
+
+    Router1()
+      : message_router(ROUTER1)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message1&)
+    {
+      Clock::time += 10U;
+    }
+
+    void on_receive(etl::imessage_router&, const Message2&)
+    {
+      Clock::time += 3U;
+    }
+
+    void on_receive(etl::imessage_router&, const Message4&)
+    {
+      Clock::time += 1U;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      Clock::time += 1U;
+    }
+  };
+
+  //***************************************************************************
+  class Router2 : public etl::message_router<Router2, Message3>
+  {
+  public:
+
+    Router2()
+      : message_router(ROUTER2)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message3&)
+    {
+      Clock::time += 5U;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+  };
+
+  //***************************************************************************
+  class Fsm : public etl::fsm
+  {
+  public:
+
+    Fsm()
+      : fsm(FSM1)
+    {
+    }
+  };
+
+  class State : public etl::fsm_state<Fsm, State, 0, Message1>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Message1&)
+    {
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  SUITE(test_message_router_statistics)
+  {
+    //*************************************************************************
+    TEST(test_router_counts_and_times)
+    {
+      etl::null_message_router nmr;
+      etl::message_router_statistics<4> statistics(Clock::now);
+      Router1 router;
+
+      Clock::time = 0U;
+
+      CHECK(router.get_statistics() == nullptr);
+      router.set_statistics(statistics);
+      CHECK(router.get_statistics() == &statistics);
+
+      router.receive(nmr, Message1());
+      router.receive(nmr, Message1());
+      router.receive(nmr, Message2());
+      router.receive(nmr, Message3());
+      router.receive(nmr, Message4());
+
+      CHECK_EQUAL(2U,  statistics.received(MESSAGE1));
+      CHECK_EQUAL(20U, statistics.time(MESSAGE1));
+      CHECK_EQUAL(1U,  statistics.received(MESSAGE2));
+      CHECK_EQUAL(3U,  statistics.time(MESSAGE2));
+
+      // Unknown messages are counted and timed too.
+      CHECK_EQUAL(1U, statistics.received(MESSAGE3));
+      CHECK_EQUAL(1U, statistics.time(MESSAGE3));
+      CHECK_EQUAL(1U, statistics.unknown());
+
+      // Beyond the table.
+      CHECK_EQUAL(0U, statistics.received(MESSAGE4));
+      CHECK_EQUAL(1U, statistics.overflow());
+
+      statistics.clear();
+      CHECK_EQUAL(0U, statistics.received(MESSAGE1));
+      CHECK_EQUAL(0U, statistics.time(MESSAGE1));
+      CHECK_EQUAL(0U, statistics.unknown());
+      CHECK_EQUAL(0U, statistics.overflow());
+
+      router.clear_statistics();
+      router.receive(nmr, Message1());
+      CHECK(router.get_statistics() == nullptr);
+      CHECK_EQUAL(0U, statistics.received(MESSAGE1));
+    }
+
+    //*************************************************************************
+    TEST(test_forwarded_messages_are_counted_by_the_successor)
+    {
+      etl::null_message_router nmr;
+      etl::message_router_statistics<4> statistics1(Clock::now);
+      etl::message_router_statistics<4> statistics2(Clock::now);
+      Router1 router1;
+      Router2 router2;
+
+      Clock::time = 0U;
+
+      router1.set_successor(router2);
+      router1.set_statistics(statistics1);
+      router2.set_statistics(statistics2);
+
+      router1.receive(nmr, Message1());
+      router1.receive(nmr, Message3());
+
+      CHECK_EQUAL(1U, statistics1.received(MESSAGE1));
+      CHECK_EQUAL(0U, statistics1.received(MESSAGE3));
+      CHECK_EQUAL(0U, statistics1.unknown());
+
+      CHECK_EQUAL(1U, statistics2.received(MESSAGE3));
+      CHECK_EQUAL(5U, statistics2.time(MESSAGE3));
+      CHECK_EQUAL(0U, statistics2.unknown());
+    }
+
+    //*************************************************************************
+    TEST(test_message_bus)
+    {
+      etl::message_router_statistics<4> bus_statistics(Clock::now);
+      etl::message_router_statistics<4> router_statistics(Clock::now);
+      etl::message_bus<2> bus;
+      Router1 router1;
+      Router2 router2;
+
+      Clock::time = 0U;
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+      bus.set_statistics(bus_statistics);
+      router1.set_statistics(router_statistics);
+
+      bus.receive(Message1());
+      bus.receive(ROUTER2, Message3());
+
+      // The bus time includes the time of the subscribers.
+      CHECK_EQUAL(1U,  bus_statistics.received(MESSAGE1));
+      CHECK_EQUAL(10U, bus_statistics.time(MESSAGE1));
+      CHECK_EQUAL(1U,  bus_statistics.received(MESSAGE3));
+      CHECK_EQUAL(5U,  bus_statistics.time(MESSAGE3));
+
+      CHECK_EQUAL(1U,  router_statistics.received(MESSAGE1));
+      CHECK_EQUAL(10U, router_statistics.time(MESSAGE1));
+      CHECK_EQUAL(0U,  router_statistics.received(MESSAGE3));
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_unknown_events)
+    {
+      etl::null_message_router nmr;
+      etl::message_router_statistics<4> statistics(Clock::now);
+      Fsm fsm;
+      State state;
+      etl::ifsm_state* states[] = { &state };
+
+      Clock::time = 0U;
+
+      fsm.set_states(states, 1U);
+      fsm.set_statistics(statistics);
+      fsm.start(false);
+
+      fsm.receive(nmr, Message1());
+      fsm.receive(nmr, Message2());
+      fsm.receive(nmr, Message2());
+
+      CHECK_EQUAL(1U, statistics.received(MESSAGE1));
+      CHECK_EQUAL(2U, statistics.received(MESSAGE2));
+      CHECK_EQUAL(2U, statistics.unknown());
+    }
+  }
+}
+
+#endif
@@ -556,6 +556,40 @@ namespace
       CHECK_ARRAY_EQUAL(compare2.data(), router1.message2.data(), compare2.size());
     }
 
+    //*************************************************************************
+    TEST(message_timer_slack_coalesces_expiries)
+    {
+      etl::message_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 10, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1,  8, etl::timer::mode::REPEATING);
+
+      CHECK(timer_controller.set_slack(id2, 3));
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      // id2 expires with id1, within its slack.
+      CHECK_EQUAL(10U, timer_controller.time_to_next());
+
+      ticks = 0;
+
+      while (ticks < 30U)
+      {
+        ++ticks;
+        timer_controller.tick(1);
+      }
+
+      std::vector<uint64_t> compare = { 10, 20, 30 };
+
+      CHECK(compare == router1.message1);
+      CHECK(compare == router1.message2);
+    }
+
     //*************************************************************************
     TEST(callback_timer_one_shot_empty_list_huge_tick_before_insert)
     {
@@ -0,0 +1,303 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/message_trace.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/message_inbox.h"
+#include "etl/message_timer.h"
+#include "etl/fsm.h"
+#include "etl/histogram.h"
+#include "etl/vector.h"
+
+#if defined(ETL_MESSAGE_TRACE)
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    FSM1    = 2,
+    BUS1    = 3
+  };
+
+  struct Message1 : public etl::message<MESSAGE1> {};
+  struct Message2 : public etl::message<MESSAGE2> {};
+
+  //***************************************************************************
+  // Advances by one for each timestamp.
+  //***************************************************************************
+  struct Clock
+  {
+    static etl::message_trace_timestamp_t now()
+    {
+      return time++;
+    }
+
+    static etl::message_trace_timestamp_t time;
+  };
+
+  etl::message_trace_timestamp_t Clock::time;
+
+  //***************************************************************************
+  // Keeps every trace event.
+  //***************************************************************************
+  struct Hook : public etl::ifunction<const etl::message_trace_event&>
+  {
+    void operator ()(const etl::message_trace_event& event) const
+    {
+      events.push_back(event);
+    }
+
+    mutable etl::vector<etl::message_trace_event, 16> events;
+  };
+
+  //***************************************************************************
+  class Router1 : public etl::message_router<Router1, Message1, Message2>
+  {
+  public:
+
+    Router1()
+      : message_router(ROUTER1)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message1& message)
+    {
+      trace_id = message.trace.id;
+    }
+
+    void on_receive(etl::imessage_router&, const Message2&)
+    {
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    etl::message_trace_id_t trace_id;
+  };
+
+  //***************************************************************************
+  class Fsm : public etl::fsm
+  {
+  public:
+
+    Fsm()
+      : fsm(FSM1)
+    {
+    }
+  };
+
+  class State : public etl::fsm_state<Fsm, State, 0, Message1>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Message1&)
+    {
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  //***************************************************************************
+  struct SetUp
+  {
+    SetUp()
+    {
+      Clock::time = 0U;
+      etl::message_trace::set_timestamp(Clock::now);
+      etl::message_trace::set_hook(hook);
+    }
+
+    ~SetUp()
+    {
+      etl::message_trace::clear_hook();
+      etl::message_trace::set_timestamp(nullptr);
+    }
+
+    Hook hook;
+  };
+
+  SUITE(test_message_trace)
+  {
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_begin_and_dispatch)
+    {
+      Router1  router;
+      Message1 message;
+
+      CHECK_EQUAL(0U, message.trace.id);
+
+      etl::message_trace::begin(message);
+      router.receive(message);
+
+      CHECK(message.trace.id != 0U);
+      CHECK_EQUAL(message.trace.id, router.trace_id);
+
+      CHECK_EQUAL(2U, hook.events.size());
+      CHECK_EQUAL(etl::message_trace_point::Begin, hook.events[0].point);
+      CHECK_EQUAL(size_t(etl::message_trace::NO_ROUTER), size_t(hook.events[0].router_id));
+      CHECK_EQUAL(etl::message_trace_point::Dispatch, hook.events[1].point);
+      CHECK_EQUAL(size_t(ROUTER1), size_t(hook.events[1].router_id));
+      CHECK_EQUAL(message.trace.id, hook.events[1].id);
+      CHECK_EQUAL(1U, hook.events[1].since_begin());
+      CHECK(hook.events[1].p_message == &message);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_begins_at_first_point)
+    {
+      Router1  router;
+      Message1 message1;
+      Message1 message2;
+
+      router.receive(message1);
+      router.receive(message2);
+
+      CHECK(message1.trace.id != 0U);
+      CHECK(message2.trace.id != 0U);
+      CHECK(message1.trace.id != message2.trace.id);
+
+      CHECK_EQUAL(4U, hook.events.size());
+      CHECK_EQUAL(etl::message_trace_point::Begin,    hook.events[0].point);
+      CHECK_EQUAL(etl::message_trace_point::Dispatch, hook.events[1].point);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_through_bus_inbox_and_fsm)
+    {
+      Router1 router;
+      etl::message_inbox<Router1, 4> inbox(router);
+
+      Fsm   fsm;
+      State state;
+      etl::ifsm_state* states[] = { &state };
+      fsm.set_states(states, 1U);
+      fsm.start(false);
+
+      etl::message_bus<2> bus;
+      bus.subscribe(inbox);
+      bus.subscribe(fsm);
+
+      Message1 message;
+      etl::message_trace::begin(message);
+      bus.receive(message);
+
+      // Queued, but not dispatched, to the router.
+      CHECK_EQUAL(4U, hook.events.size());
+      CHECK_EQUAL(etl::message_trace_point::Begin,    hook.events[0].point);
+      CHECK_EQUAL(etl::message_trace_point::Publish,  hook.events[1].point);
+
+      // The bus sends to routers in id order.
+      CHECK_EQUAL(etl::message_trace_point::Enqueue,  hook.events[2].point);
+      CHECK_EQUAL(size_t(ROUTER1), size_t(hook.events[2].router_id));
+      CHECK_EQUAL(etl::message_trace_point::Dispatch, hook.events[3].point);
+      CHECK_EQUAL(size_t(FSM1), size_t(hook.events[3].router_id));
+
+      Clock::time += 100U;
+      inbox.process();
+
+      CHECK_EQUAL(6U, hook.events.size());
+      CHECK_EQUAL(etl::message_trace_point::Dequeue,  hook.events[4].point);
+      CHECK_EQUAL(etl::message_trace_point::Dispatch, hook.events[5].point);
+      CHECK_EQUAL(size_t(ROUTER1), size_t(hook.events[5].router_id));
+
+      // The queued copy kept the trace.
+      CHECK_EQUAL(message.trace.id, router.trace_id);
+      CHECK_EQUAL(message.trace.id, hook.events[4].id);
+
+      // The time in the queue.
+      CHECK(hook.events[4].since_previous() > 100U);
+      CHECK_EQUAL(1U, hook.events[5].since_previous());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_timer_begins_a_new_trace)
+    {
+      Router1 router;
+      Message1 message;
+
+      etl::message_timer<1> timers;
+      etl::timer::id::type id = timers.register_timer(message, router, 10U, etl::timer::mode::REPEATING);
+      timers.start(id);
+      timers.enable(true);
+
+      timers.tick(10U);
+      const etl::message_trace_id_t first = router.trace_id;
+
+      timers.tick(10U);
+      const etl::message_trace_id_t second = router.trace_id;
+
+      CHECK(first != 0U);
+      CHECK(second != first);
+
+      CHECK_EQUAL(4U, hook.events.size());
+      CHECK_EQUAL(etl::message_trace_point::Begin,    hook.events[0].point);
+      CHECK_EQUAL(size_t(ROUTER1), size_t(hook.events[0].router_id));
+      CHECK_EQUAL(etl::message_trace_point::Dispatch, hook.events[1].point);
+      CHECK_EQUAL(etl::message_trace_point::Begin,    hook.events[2].point);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_latency_histogram)
+    {
+      typedef etl::histogram<1000> Histogram;
+
+      Histogram histogram;
+      etl::message_trace_latency<Histogram> latency(histogram);
+      etl::message_trace::set_hook(latency);
+
+      Router1 router;
+      etl::message_inbox<Router1, 4> inbox(router);
+
+      Message1 message;
+      etl::message_trace::begin(message);
+      inbox.receive(message);
+      Clock::time += 50U;
+      inbox.process();
+
+      CHECK_EQUAL(1U, histogram.count());
+      CHECK(histogram.max() >= 50U);
+    }
+  };
+}
+
+#endif
@@ -1256,5 +1256,27 @@ namespace
 
       CHECK(pass);
     }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::multimap<int, std::string, 4> Data;
+
+      Data data;
+
+      Data::iterator itr = data.emplace(1, 3U, 'a');
+      CHECK_EQUAL(1, itr->first);
+      CHECK_EQUAL(std::string("aaa"), itr->second);
+
+      data.emplace(1, 2U, 'b');
+      CHECK_EQUAL(2U, data.count(1));
+
+      itr = data.emplace_hint(data.end(), 2, "cc");
+      CHECK_EQUAL(std::string("cc"), itr->second);
+
+      data.emplace(Data::value_type(0, "d"));
+      CHECK(data.full());
+      CHECK_EQUAL(0, data.begin()->first);
+    }
   };
 }
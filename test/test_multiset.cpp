@@ -1217,5 +1217,26 @@ namespace
 
       CHECK(pass);
     }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::multiset<std::string, 4> Data;
+
+      Data data;
+
+      Data::iterator itr = data.emplace(3U, 'b');
+      CHECK_EQUAL(std::string("bbb"), *itr);
+
+      data.emplace("bbb");
+      CHECK_EQUAL(2U, data.count("bbb"));
+
+      itr = data.emplace_hint(data.end(), 2U, 'a');
+      CHECK_EQUAL(std::string("aa"), *itr);
+      CHECK(itr == data.begin());
+
+      data.emplace("c");
+      CHECK(data.full());
+    }
   };
 }
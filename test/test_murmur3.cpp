@@ -110,6 +110,105 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_contiguous_range_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        data.push_back(uint8_t((i * 151) + 3));
+
+        uint32_t compare;
+        MurmurHash3_x86_32(data.data(), int(data.size()), 0, &compare);
+
+        // Contiguous.
+        CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.data(), data.data() + data.size())));
+
+        // Iterator.
+        CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.begin(), data.end())));
+
+        // Mixed, starting with a partially filled block.
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+        murmur3_32_calculator.add(data[0]);
+        murmur3_32_calculator.add(data.data() + 1, data.data() + data.size());
+        CHECK_EQUAL(compare, uint32_t(murmur3_32_calculator));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_high_bit_chars)
+    {
+      std::string data("\x80\xFF\x7F\xC0\x01");
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.c_str(), int(data.size()), 0, &compare);
+
+      CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.begin(), data.end())));
+      CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.c_str(), data.c_str() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 100; ++i)
+      {
+        uint64_t compare[2];
+        MurmurHash3_x64_128(data.data(), int(data.size()), 42, compare);
+
+        etl::murmur3_128::value_type hash = etl::murmur3_128(data.data(), data.data() + data.size(), 42);
+        CHECK_EQUAL(compare[0], hash.h1);
+        CHECK_EQUAL(compare[1], hash.h2);
+
+        hash = etl::murmur3_128(data.begin(), data.end(), 42);
+        CHECK_EQUAL(compare[0], hash.h1);
+        CHECK_EQUAL(compare[1], hash.h2);
+
+        etl::murmur3_128 murmur3_128_calculator(42);
+
+        for (size_t j = 0; j < data.size(); ++j)
+        {
+          murmur3_128_calculator.add(data[j]);
+        }
+
+        CHECK(murmur3_128_calculator.value() == hash);
+
+        data.push_back(uint8_t((i * 151) + 3));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_multi)
+    {
+      // Seven buffers of different lengths: one group of four, then three singly.
+      const size_t lengths[7] = { 13, 4, 0, 29, 8, 3, 17 };
+
+      std::vector<uint8_t> data[7];
+      const uint8_t*       buffers[7];
+
+      for (size_t i = 0; i < 7; ++i)
+      {
+        for (size_t j = 0; j < lengths[i]; ++j)
+        {
+          data[i].push_back(uint8_t((i * 37) + (j * 151) + 3));
+        }
+
+        buffers[i] = data[i].data();
+      }
+
+      uint32_t results[7];
+      etl::murmur3<uint32_t>::add_multi(buffers, lengths, results, 0x1234U);
+
+      for (size_t i = 0; i < 7; ++i)
+      {
+        uint32_t compare;
+        MurmurHash3_x86_32(data[i].data(), int(data[i].size()), 0x1234U, &compare);
+
+        CHECK_EQUAL(compare, results[i]);
+      }
+    }
   };
 }
-
@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/numa_pool_set.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  struct Item
+  {
+    Item()
+      : a(0), b(0)
+    {
+    }
+
+    Item(int a_, int b_)
+      : a(a_), b(b_)
+    {
+    }
+
+    ~Item()
+    {
+      ++destroyed;
+    }
+
+    int a;
+    int b;
+
+    static int destroyed;
+  };
+
+  int Item::destroyed = 0;
+
+  SUITE(test_numa_pool_set)
+  {
+    //*************************************************************************
+    TEST(test_allocate_local_then_remote)
+    {
+      etl::numa_pool_set<Item, 3, 2> pools;
+
+      CHECK_EQUAL(6U, pools.max_size());
+      CHECK_EQUAL(3U, pools.max_size_per_node());
+      CHECK_EQUAL(6U, pools.available());
+
+      Item* p[6];
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        p[i] = pools.allocate(1U);
+        CHECK_EQUAL(1U, pools.node_of(p[i]));
+      }
+
+      CHECK_EQUAL(0U, pools.available(1U));
+      CHECK_EQUAL(0U, pools.lent(0U));
+
+      // Node 1 is exhausted, so node 0 lends.
+      for (size_t i = 3U; i < 6U; ++i)
+      {
+        p[i] = pools.allocate(1U);
+        CHECK_EQUAL(0U, pools.node_of(p[i]));
+      }
+
+      CHECK_EQUAL(3U, pools.lent(0U));
+      CHECK_EQUAL(0U, pools.lent(1U));
+      CHECK_EQUAL(6U, pools.size());
+      CHECK(pools.allocate(0U) == nullptr);
+
+      // Releases go back to the owning node.
+      pools.release(p[4]);
+      CHECK_EQUAL(1U, pools.available(0U));
+      CHECK_EQUAL(0U, pools.available(1U));
+
+      pools.release(p[0]);
+      CHECK(pools.allocate(1U) == p[0]);
+
+      int not_in_set;
+      CHECK_EQUAL(size_t(pools.NUMBER_OF_NODES), pools.node_of(&not_in_set));
+      pools.release(&not_in_set);
+      CHECK_EQUAL(5U, pools.size());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::numa_pool_set<Item, 2, 2> pools;
+
+      Item::destroyed = 0;
+
+      Item* p = pools.create(1, 2);
+      CHECK(p != nullptr);
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(2, p->b);
+      CHECK_EQUAL(2U, size_t(pools.NUMBER_OF_NODES));
+      CHECK(pools.node_of(p) < 2U);
+
+      pools.destroy(p);
+      CHECK_EQUAL(1, Item::destroyed);
+      CHECK_EQUAL(0U, pools.size());
+    }
+
+    //*************************************************************************
+    TEST(test_external_regions)
+    {
+      typedef etl::numa_pool_set<Item, 0, 2> Pools;
+
+      static const size_t ITEMS = 4U;
+      static const size_t BYTES = Pools::HEADER_SIZE + (ITEMS * etl::pool_ext<Item>::ITEM_SIZE);
+
+      etl::aligned_storage<BYTES, Pools::ALIGNMENT>::type region0;
+      etl::aligned_storage<BYTES, Pools::ALIGNMENT>::type region1;
+      CHECK_EQUAL(size_t(BYTES), Pools::buffer_size(ITEMS));
+
+      void* const regions[2] = { &region0, &region1 };
+      Pools pools(regions, ITEMS);
+
+      CHECK_EQUAL(8U, pools.max_size());
+
+      Item* p0 = pools.allocate(0U);
+      Item* p1 = pools.allocate(1U);
+
+      // The items are in the region of their node, after the control block.
+      CHECK(reinterpret_cast<char*>(p0) >= reinterpret_cast<char*>(&region0) + Pools::HEADER_SIZE);
+      CHECK(reinterpret_cast<char*>(p0) <  reinterpret_cast<char*>(&region0) + BYTES);
+      CHECK(reinterpret_cast<char*>(p1) >= reinterpret_cast<char*>(&region1) + Pools::HEADER_SIZE);
+      CHECK(reinterpret_cast<char*>(p1) <  reinterpret_cast<char*>(&region1) + BYTES);
+
+      pools.release(p0);
+      pools.release(p1);
+      CHECK_EQUAL(0U, pools.size());
+    }
+
+    //*************************************************************************
+    TEST(test_current_node)
+    {
+      etl::numa_pool_set<Item, 4, 2> pools;
+
+      Item* p = pools.allocate();
+      CHECK_EQUAL(etl::numa_current_node() % 2U, pools.node_of(p));
+      pools.release(p);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static const size_t THREADS = 4U;
+      static const size_t ROUNDS  = 2000U;
+
+      static etl::numa_pool_set<Item, 8, 2> pools;
+
+      struct worker
+      {
+        static void run(size_t node)
+        {
+          Item* held[3];
+
+          for (size_t round = 0U; round < ROUNDS; ++round)
+          {
+            for (size_t i = 0U; i < 3U; ++i)
+            {
+              held[i] = pools.allocate(node);
+            }
+
+            for (size_t i = 0U; i < 3U; ++i)
+            {
+              pools.release(held[i]);
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (size_t i = 0U; i < THREADS; ++i)
+      {
+        threads.push_back(std::thread(worker::run, i % 2U));
+      }
+
+      for (size_t i = 0U; i < THREADS; ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0U, pools.size());
+      CHECK_EQUAL(16U, pools.available());
+    }
+  };
+}
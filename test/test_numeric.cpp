@@ -32,6 +32,7 @@ SOFTWARE.
 
 #include <algorithm>
 #include <numeric>
+#include <functional>
 
 namespace
 {		
@@ -49,5 +50,41 @@ namespace
 
       CHECK(are_same);
     }
+
+    //*************************************************************************
+    TEST(test_accumulate)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+      CHECK_EQUAL(std::accumulate(std::begin(data), std::end(data), 5), etl::accumulate(std::begin(data), std::end(data), 5));
+      CHECK_EQUAL(std::accumulate(std::begin(data), std::end(data), 1, std::multiplies<int>()),
+                  etl::accumulate(std::begin(data), std::end(data), 1, std::multiplies<int>()));
+    }
+
+    //*************************************************************************
+    TEST(test_inner_product)
+    {
+      int data1[] = { 1, 2, 3, 4, 5 };
+      int data2[] = { 5, 4, 3, 2, 1 };
+
+      CHECK_EQUAL(std::inner_product(std::begin(data1), std::end(data1), std::begin(data2), 0),
+                  etl::inner_product(std::begin(data1), std::end(data1), std::begin(data2), 0));
+      CHECK_EQUAL(std::inner_product(std::begin(data1), std::end(data1), std::begin(data2), 0, std::plus<int>(), std::minus<int>()),
+                  etl::inner_product(std::begin(data1), std::end(data1), std::begin(data2), 0, std::plus<int>(), std::minus<int>()));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_reduce)
+    {
+      int data1[] = { 1, 2, 3, 4, 5 };
+      int data2[] = { 5, 4, 3, 2, 1 };
+
+      int squares = etl::transform_reduce(std::begin(data1), std::end(data1), 0, std::plus<int>(), [](int i) { return i * i; });
+      CHECK_EQUAL(55, squares);
+
+      int maximum = etl::transform_reduce(std::begin(data1), std::end(data1), std::begin(data2), 0,
+                                          [](int a, int b) { return std::max(a, b); }, std::multiplies<int>());
+      CHECK_EQUAL(9, maximum);
+    }
   };
 }
@@ -0,0 +1,269 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/numeric_kernels.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <limits>
+
+namespace
+{
+  // An odd length so the SIMD kernels have a scalar tail.
+  const size_t Size = 37U;
+
+  std::vector<int16_t> make_int16(int seed)
+  {
+    std::vector<int16_t> data(Size);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      data[i] = int16_t(((int(i) * 7919 + seed) % 2001) - 1000);
+    }
+
+    return data;
+  }
+
+  std::vector<int32_t> make_int32(int seed)
+  {
+    std::vector<int32_t> data(Size);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      data[i] = ((int32_t(i) * 104729 + seed) % 60001) - 30000;
+    }
+
+    return data;
+  }
+
+  std::vector<float> make_float(int seed)
+  {
+    std::vector<float> data(Size);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      data[i] = float(((int(i) * 31 + seed) % 101) - 50) * 0.25f;
+    }
+
+    return data;
+  }
+
+  SUITE(test_numeric_kernels)
+  {
+    //*************************************************************************
+    TEST(test_accumulate)
+    {
+      std::vector<int16_t> i16 = make_int16(1);
+      std::vector<int32_t> i32 = make_int32(2);
+      std::vector<float>   f   = make_float(3);
+
+      etl::array_view<const int16_t> v16(i16.data(), i16.size());
+      etl::array_view<const int32_t> v32(i32.data(), i32.size());
+      etl::array_view<const float>   vf(f.data(), f.size());
+
+      CHECK_EQUAL(std::accumulate(i16.begin(), i16.end(), int32_t(10)), etl::accumulate(v16, int32_t(10)));
+      CHECK_EQUAL(std::accumulate(i32.begin(), i32.end(), int32_t(10)), etl::accumulate(v32, int32_t(10)));
+      CHECK_CLOSE(std::accumulate(f.begin(), f.end(), 1.5f), etl::accumulate(vf, 1.5f), 0.001f);
+
+      // Non vectorised combinations use the portable loop.
+      CHECK_EQUAL(std::accumulate(i32.begin(), i32.end(), int64_t(0)), etl::accumulate(v32, int64_t(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_short_and_empty)
+    {
+      int16_t data[] = { 1, 2, 3 };
+
+      CHECK_EQUAL(6,  etl::accumulate(etl::array_view<int16_t>(data), int32_t(0)));
+      CHECK_EQUAL(42, etl::accumulate(etl::array_view<int16_t>(), int32_t(42)));
+    }
+
+    //*************************************************************************
+    TEST(test_inner_product)
+    {
+      std::vector<int16_t> a16 = make_int16(1);
+      std::vector<int16_t> b16 = make_int16(5);
+      std::vector<int32_t> a32 = make_int32(2);
+      std::vector<int32_t> b32 = make_int32(6);
+      std::vector<float>   af  = make_float(3);
+      std::vector<float>   bf  = make_float(7);
+
+      CHECK_EQUAL(std::inner_product(a16.begin(), a16.end(), b16.begin(), int32_t(0)),
+                  etl::inner_product(etl::array_view<int16_t>(a16.data(), a16.size()), etl::array_view<int16_t>(b16.data(), b16.size()), int32_t(0)));
+
+      CHECK_EQUAL(std::inner_product(a32.begin(), a32.end(), b32.begin(), int64_t(0)),
+                  etl::inner_product(etl::array_view<int32_t>(a32.data(), a32.size()), etl::array_view<int32_t>(b32.data(), b32.size()), int64_t(0)));
+
+      CHECK_CLOSE(std::inner_product(af.begin(), af.end(), bf.begin(), 0.0f),
+                  etl::inner_product(etl::array_view<float>(af.data(), af.size()), etl::array_view<float>(bf.data(), bf.size()), 0.0f), 0.01f);
+
+      // The shorter view sets the length.
+      CHECK_EQUAL(std::inner_product(a16.begin(), a16.begin() + 10, b16.begin(), int32_t(0)),
+                  etl::inner_product(etl::array_view<int16_t>(a16.data(), 10U), etl::array_view<int16_t>(b16.data(), b16.size()), int32_t(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_reduce)
+    {
+      std::vector<int16_t> i16 = make_int16(1);
+
+      int64_t expected = 0;
+      for (size_t i = 0U; i < i16.size(); ++i)
+      {
+        expected += int64_t(i16[i]) * i16[i];
+      }
+
+      int64_t result = etl::transform_reduce(etl::array_view<int16_t>(i16.data(), i16.size()), int64_t(0),
+                                             std::plus<int64_t>(),
+                                             [](int16_t v) { return int64_t(v) * v; });
+
+      CHECK_EQUAL(expected, result);
+    }
+
+    //*************************************************************************
+    TEST(test_minmax_value)
+    {
+      std::vector<int16_t> i16 = make_int16(1);
+      std::vector<int32_t> i32 = make_int32(2);
+      std::vector<float>   f   = make_float(3);
+
+      // Put the extremes in the tails.
+      i16[Size - 1U] = -30000;
+      i32[Size - 2U] = 2000000;
+
+      std::pair<int16_t, int16_t> r16 = etl::minmax_value(etl::array_view<int16_t>(i16.data(), i16.size()));
+      CHECK_EQUAL(*std::min_element(i16.begin(), i16.end()), r16.first);
+      CHECK_EQUAL(*std::max_element(i16.begin(), i16.end()), r16.second);
+
+      std::pair<int32_t, int32_t> r32 = etl::minmax_value(etl::array_view<int32_t>(i32.data(), i32.size()));
+      CHECK_EQUAL(*std::min_element(i32.begin(), i32.end()), r32.first);
+      CHECK_EQUAL(*std::max_element(i32.begin(), i32.end()), r32.second);
+
+      std::pair<float, float> rf = etl::minmax_value(etl::array_view<float>(f.data(), f.size()));
+      CHECK_EQUAL(*std::min_element(f.begin(), f.end()), rf.first);
+      CHECK_EQUAL(*std::max_element(f.begin(), f.end()), rf.second);
+
+      std::pair<int32_t, int32_t> empty = etl::minmax_value(etl::array_view<int32_t>());
+      CHECK_EQUAL(0, empty.first);
+      CHECK_EQUAL(0, empty.second);
+    }
+
+    //*************************************************************************
+    TEST(test_add_sat)
+    {
+      std::vector<int16_t> a16(Size);
+      std::vector<int16_t> b16(Size);
+      std::vector<int16_t> out16(Size);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        a16[i] = int16_t((i % 3U == 0U) ? 30000 : ((i % 3U == 1U) ? -30000 : int(i)));
+        b16[i] = int16_t((i % 3U == 0U) ? 10000 : ((i % 3U == 1U) ? -10000 : int(i)));
+      }
+
+      size_t n = etl::add_sat(etl::array_view<int16_t>(a16.data(), a16.size()),
+                              etl::array_view<int16_t>(b16.data(), b16.size()),
+                              etl::array_view<int16_t>(out16.data(), out16.size()));
+
+      CHECK_EQUAL(Size, n);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        int expected = std::min(32767, std::max(-32768, int(a16[i]) + int(b16[i])));
+        CHECK_EQUAL(expected, out16[i]);
+      }
+
+      int32_t a32[]   = { std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), 5, -5, 100 };
+      int32_t b32[]   = { 1, -1, 6, -6, -200 };
+      int32_t out32[] = { 0, 0, 0 };
+
+      n = etl::add_sat(etl::array_view<int32_t>(a32), etl::array_view<int32_t>(b32), etl::array_view<int32_t>(out32));
+
+      CHECK_EQUAL(3U, n);
+      CHECK_EQUAL(std::numeric_limits<int32_t>::max(), out32[0]);
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(), out32[1]);
+      CHECK_EQUAL(11, out32[2]);
+
+      uint8_t au8[]   = { 250, 10 };
+      uint8_t bu8[]   = { 10, 10 };
+      uint8_t outu8[] = { 0, 0 };
+
+      etl::add_sat(etl::array_view<uint8_t>(au8), etl::array_view<uint8_t>(bu8), etl::array_view<uint8_t>(outu8));
+      CHECK_EQUAL(255, outu8[0]);
+      CHECK_EQUAL(20,  outu8[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_sub_sat)
+    {
+      std::vector<int16_t> a16(Size);
+      std::vector<int16_t> b16(Size);
+      std::vector<int16_t> out16(Size);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        a16[i] = int16_t((i % 3U == 0U) ? 30000 : ((i % 3U == 1U) ? -30000 : int(i)));
+        b16[i] = int16_t((i % 3U == 0U) ? -10000 : ((i % 3U == 1U) ? 10000 : int(i)));
+      }
+
+      etl::sub_sat(etl::array_view<int16_t>(a16.data(), a16.size()),
+                   etl::array_view<int16_t>(b16.data(), b16.size()),
+                   etl::array_view<int16_t>(out16.data(), out16.size()));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        int expected = std::min(32767, std::max(-32768, int(a16[i]) - int(b16[i])));
+        CHECK_EQUAL(expected, out16[i]);
+      }
+
+      int32_t a32[]   = { std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 5 };
+      int32_t b32[]   = { 1, -1, 6 };
+      int32_t out32[] = { 0, 0, 0 };
+
+      etl::sub_sat(etl::array_view<int32_t>(a32), etl::array_view<int32_t>(b32), etl::array_view<int32_t>(out32));
+
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(), out32[0]);
+      CHECK_EQUAL(std::numeric_limits<int32_t>::max(), out32[1]);
+      CHECK_EQUAL(-1, out32[2]);
+
+      uint8_t au8[]   = { 5, 10 };
+      uint8_t bu8[]   = { 10, 10 };
+      uint8_t outu8[] = { 1, 1 };
+
+      etl::sub_sat(etl::array_view<uint8_t>(au8), etl::array_view<uint8_t>(bu8), etl::array_view<uint8_t>(outu8));
+      CHECK_EQUAL(0, outu8[0]);
+      CHECK_EQUAL(0, outu8[1]);
+    }
+  };
+}
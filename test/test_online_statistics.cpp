@@ -0,0 +1,117 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/online_statistics.h"
+
+namespace
+{
+  SUITE(test_online_statistics)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::online_statistics<double> stats;
+
+      CHECK_EQUAL(0U, stats.count());
+      CHECK_EQUAL(0.0, stats.mean());
+      CHECK_EQUAL(0.0, stats.variance());
+      CHECK_EQUAL(0.0, stats.sample_variance());
+    }
+
+    //*************************************************************************
+    TEST(test_add)
+    {
+      etl::online_statistics<double> stats;
+
+      double values[] = { 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 };
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        stats.add(values[i]);
+      }
+
+      CHECK_EQUAL(8U, stats.count());
+      CHECK_CLOSE(5.0,        stats.mean(),            1.0e-12);
+      CHECK_CLOSE(4.0,        stats.variance(),        1.0e-12);
+      CHECK_CLOSE(32.0 / 7.0, stats.sample_variance(), 1.0e-12);
+      CHECK_EQUAL(2.0, stats.minimum());
+      CHECK_EQUAL(9.0, stats.maximum());
+
+      stats.clear();
+      CHECK_EQUAL(0U, stats.count());
+    }
+
+    //*************************************************************************
+    TEST(test_stability)
+    {
+      etl::online_statistics<double> stats;
+
+      // Var(1e9 + {4, 7, 13, 16}) == 22.5
+      stats.add(1.0e9 + 4.0);
+      stats.add(1.0e9 + 7.0);
+      stats.add(1.0e9 + 13.0);
+      stats.add(1.0e9 + 16.0);
+
+      CHECK_CLOSE(22.5, stats.variance(), 1.0e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::online_statistics<float> all;
+      etl::online_statistics<float> first;
+      etl::online_statistics<float> second;
+      etl::online_statistics<float> empty;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        const float value = float((i * 13) % 17) - 3.5f;
+
+        all.add(value);
+        ((i < 7) ? first : second).add(value);
+      }
+
+      first.merge(second);
+      first.merge(empty);
+
+      CHECK_EQUAL(all.count(), first.count());
+      CHECK_CLOSE(all.mean(),     first.mean(),     1.0e-4f);
+      CHECK_CLOSE(all.variance(), first.variance(), 1.0e-4f);
+      CHECK_EQUAL(all.minimum(),  first.minimum());
+      CHECK_EQUAL(all.maximum(),  first.maximum());
+
+      empty.merge(all);
+      CHECK_EQUAL(all.count(), empty.count());
+      CHECK_EQUAL(all.mean(),  empty.mean());
+    }
+  };
+}
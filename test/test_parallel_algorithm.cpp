@@ -0,0 +1,211 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <string>
+
+#include "etl/parallel_algorithm.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  std::vector<int> make_data(size_t size)
+  {
+    std::vector<int> data(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      data[i] = int((i * 7919U) % 1009U) - 500;
+    }
+
+    return data;
+  }
+
+  bool is_even(int i)
+  {
+    return (i % 2) == 0;
+  }
+
+  // With no worker threads running, the caller of run() processes every chunk.
+  etl::parallel_executor<3> executor;
+
+  SUITE(test_parallel_algorithm)
+  {
+    //*************************************************************************
+    TEST(test_executor_runs_every_chunk)
+    {
+      struct Job : public etl::ifunction<size_t>
+      {
+        void operator ()(size_t i) const
+        {
+          hits[i] += 1;
+        }
+
+        mutable int hits[10] = {};
+      };
+
+      Job job;
+      executor.run(job, 10U);
+
+      for (size_t i = 0U; i < 10U; ++i)
+      {
+        CHECK_EQUAL(1, job.hits[i]);
+      }
+
+      CHECK_EQUAL(3U, executor.number_of_workers());
+      CHECK(executor.run_once());
+    }
+
+    //*************************************************************************
+    TEST(test_for_each)
+    {
+      std::vector<int> data(101, 1);
+
+      etl::for_each(etl::execution::par(executor), data.begin(), data.end(), [](int& i) { i *= 3; });
+      CHECK(std::all_of(data.begin(), data.end(), [](int i) { return i == 3; }));
+
+      etl::for_each(etl::execution::seq, data.begin(), data.end(), [](int& i) { i += 1; });
+      CHECK(std::all_of(data.begin(), data.end(), [](int i) { return i == 4; }));
+    }
+
+    //*************************************************************************
+    TEST(test_transform)
+    {
+      std::vector<int> data = make_data(57);
+      std::vector<int> output(data.size());
+      std::vector<int> compare(data.size());
+
+      std::transform(data.begin(), data.end(), compare.begin(), [](int i) { return i * i; });
+      std::vector<int>::iterator end = etl::transform(etl::execution::par(executor, 5), data.begin(), data.end(), output.begin(), [](int i) { return i * i; });
+
+      CHECK(end == output.end());
+      CHECK(compare == output);
+    }
+
+    //*************************************************************************
+    TEST(test_reduce)
+    {
+      std::vector<int> data = make_data(1000);
+
+      CHECK_EQUAL(std::accumulate(data.begin(), data.end(), 7), etl::reduce(etl::execution::par(executor), data.begin(), data.end(), 7));
+      CHECK_EQUAL(std::accumulate(data.begin(), data.end(), 7), etl::reduce(etl::execution::seq, data.begin(), data.end(), 7));
+
+      // Associative but not commutative; the order of the chunks is kept.
+      std::vector<std::string> words;
+      for (size_t i = 0U; i < 26U; ++i)
+      {
+        words.push_back(std::string(1, char('a' + i)));
+      }
+
+      std::string joined = etl::reduce(etl::execution::par(executor, 7), words.begin(), words.end(), std::string(">"), std::plus<std::string>());
+      CHECK_EQUAL(">abcdefghijklmnopqrstuvwxyz", joined);
+
+      // Fewer elements than chunks, and empty.
+      CHECK_EQUAL(3, etl::reduce(etl::execution::par(executor, 16), data.begin(), data.begin(), 3));
+      CHECK_EQUAL(3 + data[0] + data[1], etl::reduce(etl::execution::par(executor, 16), data.begin(), data.begin() + 2, 3));
+    }
+
+    //*************************************************************************
+    TEST(test_count_if)
+    {
+      std::vector<int> data = make_data(333);
+
+      CHECK_EQUAL(std::count_if(data.begin(), data.end(), is_even), etl::count_if(etl::execution::par(executor), data.begin(), data.end(), is_even));
+      CHECK_EQUAL(std::count_if(data.begin(), data.end(), is_even), etl::count_if(etl::execution::seq, data.begin(), data.end(), is_even));
+    }
+
+    //*************************************************************************
+    TEST(test_sort)
+    {
+      for (size_t chunks = 1U; chunks <= 9U; ++chunks)
+      {
+        std::vector<int> data    = make_data(250);
+        std::vector<int> compare = data;
+
+        std::sort(compare.begin(), compare.end());
+        etl::sort(etl::execution::par(executor, chunks), data.begin(), data.end());
+
+        CHECK(compare == data);
+      }
+
+      std::vector<int> data    = make_data(100);
+      std::vector<int> compare = data;
+
+      std::sort(compare.begin(), compare.end(), std::greater<int>());
+      etl::sort(etl::execution::par(executor), data.begin(), data.end(), std::greater<int>());
+      CHECK(compare == data);
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::parallel_executor<3> threaded;
+
+      std::thread workers[3];
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        workers[i] = std::thread([]() { threaded.worker(); });
+      }
+
+      for (int pass = 0; pass < 100; ++pass)
+      {
+        std::vector<int> data    = make_data(10000);
+        std::vector<int> compare = data;
+
+        std::sort(compare.begin(), compare.end());
+        etl::sort(etl::execution::par(threaded, 16), data.begin(), data.end());
+        CHECK(compare == data);
+
+        CHECK_EQUAL(std::accumulate(data.begin(), data.end(), 0), etl::reduce(etl::execution::par(threaded), data.begin(), data.end(), 0));
+      }
+
+      threaded.exit_executor();
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        workers[i].join();
+      }
+    }
+#endif
+  };
+}
+
+#endif
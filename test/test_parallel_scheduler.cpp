@@ -0,0 +1,286 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "etl/parallel_scheduler.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority, int id_, std::vector<int>* p_log_ = nullptr)
+      : etl::task(priority),
+        id(id_),
+        work(0),
+        processed(0),
+        p_log(p_log_)
+    {
+    }
+
+    uint32_t task_request_work() const
+    {
+      return work.load();
+    }
+
+    void task_process_work()
+    {
+      if (p_log != nullptr)
+      {
+        p_log->push_back(id);
+      }
+
+      ++processed;
+      --work;
+    }
+
+    int id;
+    std::atomic<uint32_t> work;
+    std::atomic<uint32_t> processed;
+    std::vector<int>* p_log;
+  };
+
+  //***************************************************************************
+  struct Callback : public etl::ifunction<size_t>
+  {
+    Callback()
+      : count(0),
+        last_index(99)
+    {
+    }
+
+    void operator ()(size_t index) const
+    {
+      ++count;
+      last_index = index;
+    }
+
+    mutable int    count;
+    mutable size_t last_index;
+  };
+
+  SUITE(test_parallel_scheduler)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::parallel_scheduler<4, 2> scheduler;
+
+      CHECK_EQUAL(2U, scheduler.number_of_workers());
+      CHECK_EQUAL(0U, scheduler.number_of_tasks());
+      CHECK(!scheduler.scheduler_is_running());
+
+      etl::parallel_scheduler_statistics statistics = scheduler.get_statistics(1U);
+      CHECK_EQUAL(0U, statistics.busy_count);
+      CHECK_EQUAL(0U, statistics.idle_count);
+      CHECK_EQUAL(0U, statistics.steal_count);
+      CHECK_EQUAL(0U, scheduler.get_utilisation(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_single_worker_honours_priority)
+    {
+      std::vector<int> log;
+
+      Task low(1, 1, &log);
+      Task high(3, 3, &log);
+      Task middle(2, 2, &log);
+
+      etl::task* tasks[] = { &low, &high, &middle };
+
+      etl::parallel_scheduler<3, 1> scheduler;
+      scheduler.add_task_list(tasks, 3);
+      CHECK_EQUAL(3U, scheduler.number_of_tasks());
+
+      low.work    = 1;
+      high.work   = 1;
+      middle.work = 1;
+
+      CHECK(!scheduler.run_once(0U));
+      CHECK(!scheduler.run_once(0U));
+      CHECK(!scheduler.run_once(0U));
+      CHECK(scheduler.run_once(0U));
+
+      int expected[] = { 3, 2, 1 };
+      CHECK_EQUAL(3U, log.size());
+      CHECK_ARRAY_EQUAL(expected, log.data(), 3);
+
+      etl::parallel_scheduler_statistics statistics = scheduler.get_statistics(0U);
+      CHECK_EQUAL(3U, statistics.busy_count);
+      CHECK_EQUAL(1U, statistics.idle_count);
+      CHECK_EQUAL(0U, statistics.steal_count);
+      CHECK_EQUAL(75U, scheduler.get_utilisation(0U));
+
+      scheduler.clear_statistics();
+      CHECK_EQUAL(0U, scheduler.get_statistics(0U).busy_count);
+    }
+
+    //*************************************************************************
+    TEST(test_idle_worker_steals)
+    {
+      Task task1(2, 1);
+      Task task2(1, 2);
+
+      etl::parallel_scheduler<2, 2> scheduler;
+      scheduler.add_task(task1);
+      scheduler.add_task(task2);
+
+      task1.work = 1;
+      task2.work = 1;
+
+      // Worker 0 claims both tasks and runs the highest priority one.
+      CHECK(!scheduler.run_once(0U));
+      CHECK_EQUAL(1U, task1.processed);
+      CHECK_EQUAL(0U, task2.processed);
+
+      // Worker 1 finds nothing unclaimed, so steals the other.
+      CHECK(!scheduler.run_once(1U));
+      CHECK_EQUAL(1U, task2.processed);
+
+      CHECK_EQUAL(0U, scheduler.get_statistics(0U).steal_count);
+      CHECK_EQUAL(1U, scheduler.get_statistics(1U).steal_count);
+
+      CHECK(scheduler.run_once(0U));
+      CHECK(scheduler.run_once(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_task_is_reclaimed_after_processing)
+    {
+      Task task(1, 1);
+
+      etl::parallel_scheduler<1, 2> scheduler;
+      scheduler.add_task(task);
+
+      task.work = 3;
+
+      CHECK(!scheduler.run_once(0U));
+      CHECK(!scheduler.run_once(1U));
+      CHECK(!scheduler.run_once(0U));
+      CHECK(scheduler.run_once(1U));
+
+      CHECK_EQUAL(3U, task.processed);
+      CHECK_EQUAL(2U, scheduler.get_statistics(0U).busy_count);
+      CHECK_EQUAL(1U, scheduler.get_statistics(1U).busy_count);
+    }
+
+    //*************************************************************************
+    TEST(test_callbacks)
+    {
+      Task task(1, 1);
+
+      Callback idle;
+      Callback watchdog;
+
+      etl::parallel_scheduler<1, 2> scheduler;
+      scheduler.add_task(task);
+      scheduler.set_idle_callback(idle);
+      scheduler.set_watchdog_callback(watchdog);
+
+      task.work = 1;
+
+      scheduler.run_once(1U);
+      CHECK_EQUAL(0, idle.count);
+      CHECK_EQUAL(1, watchdog.count);
+      CHECK_EQUAL(1U, watchdog.last_index);
+
+      scheduler.run_once(0U);
+      CHECK_EQUAL(1, idle.count);
+      CHECK_EQUAL(0U, idle.last_index);
+      CHECK_EQUAL(2, watchdog.count);
+      CHECK_EQUAL(0U, watchdog.last_index);
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static const uint32_t work = 1000;
+
+      Task task1(3, 1);
+      Task task2(2, 2);
+      Task task3(1, 3);
+
+      task1.work = work;
+      task2.work = work;
+      task3.work = work;
+
+      static etl::parallel_scheduler<3, 3> scheduler;
+      scheduler.add_task(task1);
+      scheduler.add_task(task2);
+      scheduler.add_task(task3);
+
+      std::thread workers[3];
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        workers[i] = std::thread([i]() { scheduler.worker(i); });
+      }
+
+      while ((task1.work + task2.work + task3.work) != 0U)
+      {
+        std::this_thread::yield();
+      }
+
+      scheduler.exit_scheduler();
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        workers[i].join();
+      }
+
+      CHECK_EQUAL(work, task1.processed);
+      CHECK_EQUAL(work, task2.processed);
+      CHECK_EQUAL(work, task3.processed);
+
+      uint32_t busy = 0U;
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        busy += scheduler.get_statistics(i).busy_count;
+      }
+
+      CHECK_EQUAL(3U * work, busy);
+    }
+#endif
+  };
+}
+
+#endif
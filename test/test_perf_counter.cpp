@@ -0,0 +1,278 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <memory>
+
+#define ETL_PERF_COUNTERS
+#include "etl/perf_counter.h"
+
+namespace
+{
+  typedef etl::iperf_metric::value_type value_type;
+
+  //***************************************************************************
+  /// Writes the metrics in a Prometheus like text format.
+  //***************************************************************************
+  struct exporter
+  {
+    void operator()(const etl::iperf_counter& counter)
+    {
+      text += counter.name();
+      text += " ";
+      text += std::to_string(counter.value());
+      text += "\n";
+    }
+
+    void operator()(const etl::iperf_histogram& histogram)
+    {
+      value_type cumulative = 0U;
+
+      for (size_t i = 0U; i < histogram.bounds(); ++i)
+      {
+        cumulative += histogram.bucket(i);
+        text += histogram.name();
+        text += "_bucket{le=\"" + std::to_string(histogram.bound(i)) + "\"} " + std::to_string(cumulative) + "\n";
+      }
+
+      text += histogram.name();
+      text += "_count " + std::to_string(histogram.count()) + "\n";
+      text += histogram.name();
+      text += "_sum " + std::to_string(histogram.sum()) + "\n";
+    }
+
+    std::string text;
+  };
+
+  SUITE(test_perf_counter)
+  {
+    //*************************************************************************
+    TEST(test_counter)
+    {
+      etl::perf_counter<> counter("allocations");
+
+      CHECK_EQUAL(std::string("allocations"), std::string(counter.name()));
+      CHECK_EQUAL(etl::iperf_metric::COUNTER, counter.kind());
+      CHECK_EQUAL(0U, counter.value());
+
+      counter.increment();
+      counter.increment();
+      counter.add(10U);
+      CHECK_EQUAL(12U, counter.value());
+
+      ETL_PERF_COUNTER_INCREMENT(counter);
+      ETL_PERF_COUNTER_ADD(counter, 3U);
+      CHECK_EQUAL(16U, counter.value());
+
+      counter.reset();
+      CHECK_EQUAL(0U, counter.value());
+    }
+
+    //*************************************************************************
+    TEST(test_counter_shards)
+    {
+      etl::perf_counter<4> counter("events");
+
+      CHECK_EQUAL(4U, counter.shards());
+
+      counter.increment(0U);
+      counter.increment(1U);
+      counter.add(5U, 3U);
+      counter.increment(5U); // Wraps to shard 1.
+
+      CHECK_EQUAL(1U, counter.value(0U));
+      CHECK_EQUAL(2U, counter.value(1U));
+      CHECK_EQUAL(0U, counter.value(2U));
+      CHECK_EQUAL(5U, counter.value(3U));
+      CHECK_EQUAL(8U, counter.value());
+    }
+
+#if ETL_CACHE_LINE_SIZE > 0
+    //*************************************************************************
+    TEST(test_counter_shards_on_separate_cache_lines)
+    {
+      CHECK(sizeof(etl::perf_counter<2>) >= (2U * ETL_CACHE_LINE_SIZE));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_counter_concurrent)
+    {
+      const size_t THREADS = 4U;
+      const size_t COUNT   = 100000U;
+
+      etl::perf_counter<THREADS> counter("concurrent");
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread([&counter, t]()
+        {
+          for (size_t i = 0U; i < COUNT; ++i)
+          {
+            counter.increment(t);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(THREADS * COUNT, counter.value());
+    }
+
+    //*************************************************************************
+    TEST(test_histogram)
+    {
+      static const value_type bounds[] = { 10U, 100U, 1000U };
+
+      etl::perf_histogram<3> histogram("latency", bounds);
+
+      CHECK_EQUAL(etl::iperf_metric::HISTOGRAM, histogram.kind());
+      CHECK_EQUAL(3U, histogram.bounds());
+      CHECK_EQUAL(100U, histogram.bound(1U));
+
+      histogram.record(0U);
+      histogram.record(10U);
+      histogram.record(11U);
+      histogram.record(1000U);
+      histogram.record(5000U);
+      ETL_PERF_HISTOGRAM_RECORD(histogram, 50U);
+
+      CHECK_EQUAL(2U, histogram.bucket(0U));
+      CHECK_EQUAL(2U, histogram.bucket(1U));
+      CHECK_EQUAL(1U, histogram.bucket(2U));
+      CHECK_EQUAL(1U, histogram.bucket(3U));
+      CHECK_EQUAL(6U, histogram.count());
+      CHECK_EQUAL(6071U, histogram.sum());
+
+      histogram.reset();
+      CHECK_EQUAL(0U, histogram.count());
+      CHECK_EQUAL(0U, histogram.sum());
+    }
+
+    //*************************************************************************
+    TEST(test_histogram_shards)
+    {
+      static const value_type bounds[] = { 10U };
+
+      etl::perf_histogram<1, 2> histogram("sharded", bounds);
+
+      histogram.record(5U, 0U);
+      histogram.record(20U, 1U);
+      histogram.record(7U, 1U);
+
+      CHECK_EQUAL(2U, histogram.bucket(0U));
+      CHECK_EQUAL(1U, histogram.bucket(1U));
+      CHECK_EQUAL(32U, histogram.sum());
+    }
+
+    //*************************************************************************
+    TEST(test_registry_export)
+    {
+      static const value_type bounds[] = { 10U, 100U };
+
+      etl::perf_counter<>    counter("messages_total");
+      etl::perf_histogram<2> histogram("latency_cycles", bounds);
+
+      etl::perf_registry registry;
+      CHECK(registry.first() == nullptr);
+
+      registry.add(counter);
+      registry.add(histogram);
+
+      counter.add(3U);
+      histogram.record(5U);
+      histogram.record(50U);
+      histogram.record(500U);
+
+      exporter e;
+      registry.for_each(e);
+
+      std::string expected = "latency_cycles_bucket{le=\"10\"} 1\n"
+                             "latency_cycles_bucket{le=\"100\"} 2\n"
+                             "latency_cycles_count 3\n"
+                             "latency_cycles_sum 555\n"
+                             "messages_total 3\n";
+
+      CHECK_EQUAL(expected, e.text);
+    }
+
+    //*************************************************************************
+    TEST(test_registry_concurrent_add)
+    {
+      const size_t THREADS = 4U;
+      const size_t COUNT   = 64U;
+
+      std::vector<std::unique_ptr<etl::perf_counter<> > > counters;
+
+      for (size_t i = 0U; i < (THREADS * COUNT); ++i)
+      {
+        counters.push_back(std::unique_ptr<etl::perf_counter<> >(new etl::perf_counter<>("counter")));
+      }
+
+      etl::perf_registry registry;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread([&registry, &counters, t]()
+        {
+          for (size_t i = 0U; i < COUNT; ++i)
+          {
+            registry.add(*counters[(t * COUNT) + i]);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < THREADS; ++t)
+      {
+        threads[t].join();
+      }
+
+      size_t n = 0U;
+
+      for (const etl::iperf_metric* p = registry.first(); p != nullptr; p = p->next())
+      {
+        ++n;
+      }
+
+      CHECK_EQUAL(THREADS * COUNT, n);
+    }
+  };
+}
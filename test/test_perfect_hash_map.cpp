@@ -0,0 +1,197 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/perfect_hash_map.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+  enum Command
+  {
+    Start,
+    Stop,
+    Reset,
+    Status,
+    Version
+  };
+
+  typedef etl::perfect_hash_map<const char*, Command, 5> CommandMap;
+
+  const CommandMap::value_type command_list[] =
+  {
+    { "start",   Start },
+    { "stop",    Stop },
+    { "reset",   Reset },
+    { "status",  Status },
+    { "version", Version }
+  };
+
+#if ETL_CPP14_SUPPORTED
+  constexpr CommandMap commands({ { "start",   Start },
+                                  { "stop",    Stop },
+                                  { "reset",   Reset },
+                                  { "status",  Status },
+                                  { "version", Version } });
+
+  static_assert(commands.at("reset") == Reset,  "Compile time lookup");
+  static_assert(!commands.contains("halt"),     "Compile time lookup");
+#endif
+
+  SUITE(test_perfect_hash_map)
+  {
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      CommandMap map(command_list);
+
+      CHECK_EQUAL(5U, map.size());
+      CHECK(!map.empty());
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CommandMap::const_iterator itr = map.find(command_list[i].first);
+
+        CHECK(itr != map.end());
+        CHECK_EQUAL(command_list[i].second, itr->second);
+      }
+
+      // Lookups compare content, not pointers.
+      char text[8];
+      strcpy(text, "status");
+      CHECK_EQUAL(Status, map.at(text));
+
+      CHECK(map.find("stat") == map.end());
+      CHECK(map.find("statuses") == map.end());
+      CHECK(map.find("") == map.end());
+      CHECK(!map.contains("STOP"));
+    }
+
+    //*************************************************************************
+    TEST(test_at_missing_key)
+    {
+      CommandMap map(command_list);
+
+      CHECK_THROW(map.at("halt"), etl::perfect_hash_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_each_slot_used_once)
+    {
+      CommandMap map(command_list);
+
+      int found[5] = { 0, 0, 0, 0, 0 };
+
+      for (CommandMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        ++found[itr->second];
+      }
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(1, found[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_integer_keys)
+    {
+      typedef etl::perfect_hash_map<uint32_t, uint32_t, 200> Map;
+
+      Map::value_type list[200];
+
+      for (uint32_t i = 0U; i < 200U; ++i)
+      {
+        list[i].first  = i * 7919U + 13U;
+        list[i].second = i;
+      }
+
+      Map map(list);
+
+      for (uint32_t i = 0U; i < 200U; ++i)
+      {
+        Map::const_iterator itr = map.find(i * 7919U + 13U);
+
+        CHECK(itr != map.end());
+        CHECK_EQUAL(i, itr->second);
+        CHECK(!map.contains(i * 7919U + 14U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_keys)
+    {
+      typedef etl::perfect_hash_map<etl::string_view, int, 3> Map;
+
+      const Map::value_type list[] =
+      {
+        { etl::string_view("red"),   1 },
+        { etl::string_view("green"), 2 },
+        { etl::string_view("blue"),  3 }
+      };
+
+      Map map(list);
+
+      const char* text = "greenish";
+
+      CHECK_EQUAL(2, map.at(etl::string_view(text, 5U)));
+      CHECK(!map.contains(etl::string_view(text, 4U)));
+      CHECK(!map.contains(etl::string_view(text)));
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_key)
+    {
+      typedef etl::perfect_hash_map<int, int, 3> Map;
+
+      const Map::value_type list[] =
+      {
+        { 1, 1 },
+        { 2, 2 },
+        { 1, 3 }
+      };
+
+      CHECK_THROW(Map map(list), etl::perfect_hash_map_duplicate_key);
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      CHECK_EQUAL(Start,   commands.at("start"));
+      CHECK_EQUAL(Version, commands.at("version"));
+      CHECK(!commands.contains("versions"));
+    }
+#endif
+  };
+}
@@ -0,0 +1,300 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/pipeline.h"
+#include "etl/scheduler.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //***************************************************************************
+  struct Decode : public etl::pipeline_stage<int, long>
+  {
+    Decode()
+      : calls(0)
+    {
+    }
+
+    bool operator()(const int& in, long& out)
+    {
+      ++calls;
+      out = long(in) * 10;
+      return true;
+    }
+
+    int calls;
+  };
+
+  //***************************************************************************
+  struct DropOdd : public etl::pipeline_stage<long, long>
+  {
+    bool operator()(const long& in, long& out)
+    {
+      out = in;
+      return ((in / 10) % 2) == 0;
+    }
+  };
+
+  //***************************************************************************
+  struct Encode : public etl::pipeline_stage<long, double>
+  {
+    bool operator()(const long& in, double& out)
+    {
+      out = double(in) + 0.5;
+      return true;
+    }
+  };
+
+  typedef etl::pipeline<8, 4, Decode, DropOdd, Encode> Pipeline;
+
+  //***************************************************************************
+  struct Idle
+  {
+    Idle(etl::ischeduler& scheduler_)
+      : scheduler(scheduler_)
+    {
+    }
+
+    void idle()
+    {
+      scheduler.exit_scheduler();
+    }
+
+    etl::ischeduler& scheduler;
+  };
+
+  SUITE(test_pipeline)
+  {
+    //*************************************************************************
+    TEST(test_types)
+    {
+      CHECK_EQUAL(3U, Pipeline::STAGES);
+      CHECK((etl::is_same<int, Pipeline::input_type>::value));
+      CHECK((etl::is_same<double, Pipeline::output_type>::value));
+      CHECK((etl::is_same<DropOdd, Pipeline::stage_type<1>::type>::value));
+      CHECK((etl::is_same<long, Pipeline::queue_type<2>::type::value_type>::value));
+      CHECK((etl::is_same<double, Pipeline::queue_type<3>::type::value_type>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_stage_by_stage)
+    {
+      Pipeline pipeline;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(pipeline.push(i));
+      }
+
+      CHECK_EQUAL(4U, pipeline.process<0>());
+      CHECK_EQUAL(4U, pipeline.queue<1>().size());
+      CHECK_EQUAL(4U, pipeline.process<1>());
+      CHECK_EQUAL(2U, pipeline.queue<2>().size());
+      CHECK_EQUAL(2U, pipeline.process<2>());
+      CHECK_EQUAL(0U, pipeline.process<2>());
+
+      double value;
+
+      CHECK(pipeline.pop(value));
+      CHECK_CLOSE(0.5, value, 0.001);
+      CHECK(pipeline.pop(value));
+      CHECK_CLOSE(20.5, value, 0.001);
+      CHECK(!pipeline.pop(value));
+    }
+
+    //*************************************************************************
+    TEST(test_fused)
+    {
+      Pipeline pipeline;
+
+      const int inputs[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      CHECK_EQUAL(8U, pipeline.push(inputs, 8U));
+
+      // One batch of four.
+      CHECK_EQUAL(4U, (pipeline.process<0, 2>()));
+      CHECK_EQUAL(4U, (pipeline.drain<0, 2>()));
+      CHECK_EQUAL(8, pipeline.stage<0>().calls);
+
+      // The intermediate queues are bypassed.
+      CHECK(pipeline.queue<1>().empty());
+      CHECK(pipeline.queue<2>().empty());
+
+      double outputs[8];
+
+      CHECK_EQUAL(4U, pipeline.pop(outputs, 8U));
+      CHECK_CLOSE(0.5,  outputs[0], 0.001);
+      CHECK_CLOSE(20.5, outputs[1], 0.001);
+      CHECK_CLOSE(40.5, outputs[2], 0.001);
+      CHECK_CLOSE(60.5, outputs[3], 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_back_pressure)
+    {
+      Pipeline pipeline;
+
+      int i = 0;
+
+      // Fill the output queue, leaving stage 0 and 1 unfused.
+      while (pipeline.push(i))
+      {
+        i += 2;
+        pipeline.drain<0>();
+        pipeline.drain<1, 2>();
+      }
+
+      // All queues are full and nothing has been lost.
+      CHECK(pipeline.output_queue().full());
+      CHECK(pipeline.queue<1>().full());
+      CHECK(pipeline.input_queue().full());
+      CHECK_EQUAL(0U, (pipeline.process<1, 2>()));
+      CHECK_EQUAL(0U, pipeline.process<0>());
+      CHECK_EQUAL(24, i / 2);
+
+      double value;
+      int    expected = 0;
+
+      while (i != 0)
+      {
+        pipeline.drain<0>();
+        pipeline.drain<1, 2>();
+
+        while (pipeline.pop(value))
+        {
+          CHECK_CLOSE(double(expected * 10) + 0.5, value, 0.001);
+          expected += 2;
+          i -= 2;
+        }
+      }
+
+      CHECK_EQUAL(48, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_pipeline_task)
+    {
+      Pipeline pipeline;
+
+      etl::pipeline_task<Pipeline, 0>    task0(pipeline, 1);
+      etl::pipeline_task<Pipeline, 1, 2> task1(pipeline, 0);
+
+      etl::scheduler<etl::scheduler_policy_most_work, 2> scheduler;
+
+      Idle idle_handler(scheduler);
+      etl::function_mv<Idle, &Idle::idle> idle_callback(idle_handler);
+      scheduler.set_idle_callback(idle_callback);
+
+      scheduler.add_task(task0);
+      scheduler.add_task(task1);
+
+      for (int i = 0; i < 6; ++i)
+      {
+        pipeline.push(i);
+      }
+
+      CHECK_EQUAL(6U, task0.task_request_work());
+      CHECK_EQUAL(0U, task1.task_request_work());
+
+      scheduler.start();
+
+      CHECK_EQUAL(3U, pipeline.output_queue().size());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static Pipeline pipeline;
+
+      const int LENGTH = 10000;
+
+      std::thread producer([]()
+      {
+        int i = 0;
+
+        while (i < LENGTH)
+        {
+          if (pipeline.push(i))
+          {
+            ++i;
+          }
+        }
+      });
+
+      std::thread decoder([]()
+      {
+        size_t count = 0U;
+
+        while (count < size_t(LENGTH))
+        {
+          count += pipeline.process<0>();
+        }
+      });
+
+      std::vector<double> results;
+      size_t count = 0U;
+
+      while (count < size_t(LENGTH))
+      {
+        count += pipeline.process<1, 2>();
+
+        double value;
+
+        while (pipeline.pop(value))
+        {
+          results.push_back(value);
+        }
+      }
+
+      double value;
+
+      while (pipeline.pop(value))
+      {
+        results.push_back(value);
+      }
+
+      producer.join();
+      decoder.join();
+
+      CHECK_EQUAL(size_t(LENGTH / 2), results.size());
+
+      for (size_t i = 0U; i < results.size(); ++i)
+      {
+        CHECK_CLOSE(double(i * 20U) + 0.5, results[i], 0.001);
+      }
+    }
+  };
+}
+
+#endif
@@ -413,6 +413,135 @@ namespace
       CHECK_NO_THROW(p3 = pool.allocate<double>());
       CHECK_NO_THROW(p4 = pool.allocate<Test_Data>());
     }
+
+    //*************************************************************************
+    TEST(test_allocate_release_batch)
+    {
+      etl::pool<Test_Data, 4> pool;
+
+      void* items[6];
+
+      CHECK_EQUAL(3U, pool.allocate_batch(items, 3U));
+      CHECK_EQUAL(3U, pool.size());
+
+      // Only one left.
+      CHECK_EQUAL(1U, pool.allocate_batch(&items[3], 3U));
+      CHECK(pool.full());
+      CHECK_EQUAL(0U, pool.allocate_batch(items, 3U));
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(pool.is_in_pool(items[i]));
+      }
+
+      pool.release_batch(items, 4U);
+      CHECK(pool.empty());
+    }
+
+#if ETL_CACHE_LINE_SIZE > 0
+    //*************************************************************************
+    TEST(test_cache_line_layout)
+    {
+      etl::pool<uint32_t, 5, etl::pool_layout::Cache_Line> pool;
+
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), pool.item_size());
+
+      std::set<uintptr_t> lines;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        uint32_t* p = pool.allocate<uint32_t>();
+
+        CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p) % ETL_CACHE_LINE_SIZE);
+        CHECK(pool.is_in_pool(p));
+        lines.insert(reinterpret_cast<uintptr_t>(p) / ETL_CACHE_LINE_SIZE);
+      }
+
+      CHECK_EQUAL(5U, lines.size());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_striped_layout)
+    {
+      const size_t ITEMS_PER_LINE = ETL_CACHE_LINE_SIZE / sizeof(char*);
+      const size_t LINES          = 3U;
+      const size_t SIZE           = (ITEMS_PER_LINE * (LINES - 1U)) + 1U;
+
+      etl::pool<uint8_t, SIZE, etl::pool_layout::Striped> pool;
+
+      CHECK_EQUAL(sizeof(char*), pool.item_size());
+
+      std::vector<uintptr_t> addresses;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        addresses.push_back(reinterpret_cast<uintptr_t>(pool.allocate<uint8_t>()));
+      }
+
+      CHECK(pool.full());
+
+      // Consecutive allocations are on different lines, until all lines are used.
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        CHECK(pool.is_in_pool(reinterpret_cast<void*>(addresses[i])));
+
+        const uintptr_t line = addresses[i] / ETL_CACHE_LINE_SIZE;
+
+        CHECK_EQUAL(line, (addresses[i] + pool.item_size() - 1U) / ETL_CACHE_LINE_SIZE);
+
+        for (size_t j = (i / LINES) * LINES; j < i; ++j)
+        {
+          CHECK(line != (addresses[j] / ETL_CACHE_LINE_SIZE));
+        }
+      }
+
+      CHECK_EQUAL(SIZE, std::set<uintptr_t>(addresses.begin(), addresses.end()).size());
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        pool.release(reinterpret_cast<void*>(addresses[i]));
+      }
+
+      CHECK(pool.empty());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_pool_ext)
+    {
+      typedef etl::pool_ext<Test_Data> Pool;
+
+      static const size_t SIZE = 4U;
+
+      etl::aligned_storage<SIZE * Pool::ITEM_SIZE, Pool::ALIGNMENT>::type buffer;
+      CHECK_EQUAL(sizeof(buffer), Pool::buffer_size(SIZE));
+
+      Pool pool(&buffer, SIZE);
+
+      CHECK_EQUAL(SIZE, pool.max_size());
+      CHECK(pool.empty());
+
+      Test_Data* p[SIZE];
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        p[i] = pool.allocate<Test_Data>();
+        CHECK(pool.is_in_pool(p[i]));
+        CHECK(reinterpret_cast<char*>(p[i]) >= reinterpret_cast<char*>(&buffer));
+        CHECK(reinterpret_cast<char*>(p[i]) <  reinterpret_cast<char*>(&buffer) + sizeof(buffer));
+      }
+
+      CHECK(pool.full());
+      CHECK_THROW(pool.allocate<Test_Data>(), etl::pool_no_allocation);
+
+      pool.release(p[1]);
+      CHECK_EQUAL(1U, pool.available());
+      CHECK(pool.allocate<Test_Data>() == p[1]);
+
+      pool.release_all();
+      CHECK(pool.empty());
+    }
   };
 
   //*************************************************************************
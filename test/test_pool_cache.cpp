@@ -0,0 +1,266 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/pool_cache.h"
+#include "etl/atomic_pool.h"
+#include "etl/function.h"
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  //***********************************
+  struct Item
+  {
+    Item(int a_ = 0)
+      : a(a_)
+    {
+    }
+
+    int a;
+  };
+
+  //***********************************
+  struct Access
+  {
+    void lock()
+    {
+      ++locks;
+    }
+
+    void unlock()
+    {
+      ++unlocks;
+    }
+
+    int locks;
+    int unlocks;
+  };
+
+  Access access;
+
+  etl::function_imv<Access, access, &Access::lock>   lock;
+  etl::function_imv<Access, access, &Access::unlock> unlock;
+
+  typedef etl::pool<Item, 8>       Pool;
+  typedef etl::pool_cache<Pool, 2> Cache;
+
+  SUITE(test_pool_cache)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Pool  pool;
+      Cache cache(pool, lock, unlock);
+
+      CHECK_EQUAL(0U, cache.cached());
+      CHECK_EQUAL(4U, cache.max_size());
+      CHECK(&cache.get_pool() == &pool);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_in_batches)
+    {
+      Pool  pool;
+      Cache cache(pool, lock, unlock);
+      access.locks   = 0;
+      access.unlocks = 0;
+
+      // The first allocation takes a batch from the shared pool.
+      Item* p1 = cache.create<Item>(1);
+      CHECK_EQUAL(1, p1->a);
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(1U, cache.cached());
+      CHECK_EQUAL(1, access.locks);
+      CHECK_EQUAL(1, access.unlocks);
+
+      // The second does not touch the shared pool.
+      Item* p2 = cache.create<Item>(2);
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(0U, cache.cached());
+      CHECK_EQUAL(1, access.locks);
+
+      Item* p3 = cache.create<Item>(3);
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(2, access.locks);
+
+      cache.destroy<Item>(p1);
+      cache.destroy<Item>(p2);
+      cache.destroy<Item>(p3);
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(4U, cache.cached());
+      CHECK_EQUAL(2, access.locks);
+
+      cache.flush();
+      CHECK(pool.empty());
+      CHECK_EQUAL(0U, cache.cached());
+      CHECK_EQUAL(3, access.locks);
+      CHECK_EQUAL(3, access.unlocks);
+    }
+
+    //*************************************************************************
+    TEST(test_release_when_full)
+    {
+      Pool  pool;
+      Cache cache(pool, lock, unlock);
+
+      Item* items[6];
+
+      for (int i = 0; i < 6; ++i)
+      {
+        items[i] = cache.allocate<Item>();
+      }
+
+      CHECK_EQUAL(6U, pool.size());
+      CHECK_EQUAL(0U, cache.cached());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        cache.release(items[i]);
+      }
+
+      // The oldest half went back to the shared pool.
+      CHECK_EQUAL(3U, cache.cached());
+      CHECK_EQUAL(4U, pool.size());
+
+      // The most recently released is reused first.
+      CHECK(cache.allocate<Item>() == items[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_flushes)
+    {
+      Pool pool;
+
+      {
+        Cache cache(pool, lock, unlock);
+        cache.release(cache.allocate<Item>());
+        CHECK_EQUAL(2U, pool.size());
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      Pool  pool;
+      Pool  other;
+      Cache cache(pool, lock, unlock);
+
+      Item* p = other.allocate<Item>();
+      CHECK_THROW(cache.release(p), etl::pool_object_not_in_pool);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        cache.allocate<Item>();
+      }
+
+      CHECK_THROW(cache.allocate<Item>(), etl::pool_no_allocation);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_atomic_pool_without_lock)
+    {
+      typedef etl::atomic_pool<Item, 8> AtomicPool;
+
+      AtomicPool pool;
+      etl::pool_cache<AtomicPool, 4> cache1(pool);
+      etl::pool_cache<AtomicPool, 4> cache2(pool);
+
+      Item* p1 = cache1.create<Item>(1);
+      Item* p2 = cache2.create<Item>(2);
+
+      CHECK(p1 != p2);
+      CHECK_EQUAL(8U, pool.size());
+
+      // Items may be released to a different cache.
+      cache2.destroy<Item>(p1);
+      cache1.destroy<Item>(p2);
+
+      cache1.flush();
+      cache2.flush();
+      CHECK(pool.empty());
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      typedef etl::atomic_pool<int, 64> AtomicPool;
+
+      static AtomicPool pool;
+      const int N_THREADS = 8;
+      const int N_LOOPS   = 1000000;
+
+      bool ok[N_THREADS];
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        ok[t] = true;
+
+        threads.push_back(std::thread([t, &ok]()
+        {
+          etl::pool_cache<AtomicPool, 4> cache(pool);
+
+          for (int i = 0; i < N_LOOPS; ++i)
+          {
+            int* p1 = cache.allocate<int>();
+            int* p2 = cache.allocate<int>();
+
+            *p1 = t;
+            *p2 = t;
+
+            ok[t] = ok[t] && (p1 != p2) && (*p1 == t) && (*p2 == t);
+
+            cache.release(p1);
+            cache.release(p2);
+          }
+        }));
+      }
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        threads[t].join();
+        CHECK(ok[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+#endif
+#endif
+  };
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/pool_shared_ptr.h"
+#include "etl/message.h"
+#include "etl/largest.h"
+
+namespace
+{
+  int destructed = 0;
+
+  //***************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    ~Message1()
+    {
+      ++destructed;
+    }
+
+    int value;
+  };
+
+  //***************************************************************************
+  struct Message2 : public etl::message<2>
+  {
+    Message2(const std::string& text_, int count_)
+      : text(text_)
+      , count(count_)
+    {
+    }
+
+    ~Message2()
+    {
+      ++destructed;
+    }
+
+    std::string text;
+    int         count;
+  };
+
+  typedef etl::pool_shared_ptr<Message1>::block_type Block1;
+  typedef etl::pool_shared_ptr<Message2>::block_type Block2;
+
+  typedef etl::largest<Block1, Block2> Largest;
+
+  typedef etl::generic_pool<Largest::size, Largest::alignment, 2> Pool;
+
+  typedef etl::pool_shared_ptr<const etl::imessage> MessagePtr;
+
+  SUITE(test_pool_shared_ptr)
+  {
+    //*************************************************************************
+    TEST(test_one_allocation)
+    {
+      destructed = 0;
+
+      Pool pool;
+
+      {
+        etl::pool_shared_ptr<Message1> p1 = etl::make_pool_shared<Message1>(pool, 42);
+        CHECK(p1);
+        CHECK_EQUAL(1U, p1.use_count());
+        CHECK_EQUAL(42, p1->value);
+
+        // The object and the count share one item.
+        CHECK_EQUAL(1U, pool.size());
+
+        etl::pool_shared_ptr<Message1> p2(p1);
+        etl::pool_shared_ptr<Message1> p3;
+        p3 = p2;
+        CHECK_EQUAL(3U, p1.use_count());
+        CHECK(p1 == p3);
+
+        p2.reset();
+        CHECK(!p2);
+        CHECK_EQUAL(0U, p2.use_count());
+        CHECK_EQUAL(2U, p1.use_count());
+        CHECK_EQUAL(0, destructed);
+      }
+
+      CHECK_EQUAL(1, destructed);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_messages)
+    {
+      destructed = 0;
+
+      Pool pool;
+
+      MessagePtr m1 = etl::make_pool_shared<Message1>(pool, 1);
+      MessagePtr m2 = etl::make_pool_shared<Message2>(pool, std::string("two"), 2);
+
+      // The pool is full.
+      etl::pool_shared_ptr<Message1> m3 = etl::make_pool_shared<Message1>(pool, 3);
+      CHECK(!m3);
+
+      std::vector<MessagePtr> router1;
+      std::vector<MessagePtr> router2;
+
+      router1.push_back(m1);
+      router1.push_back(m2);
+      router2.push_back(m2);
+
+      CHECK_EQUAL(1U, router1[0]->message_id);
+      CHECK_EQUAL(std::string("two"), static_cast<const Message2&>(*router2[0]).text);
+      CHECK_EQUAL(3U, m2.use_count());
+
+      m1.reset();
+      m2.reset();
+      router1.clear();
+      CHECK_EQUAL(1, destructed);
+      CHECK_EQUAL(1U, pool.size());
+
+      router2.clear();
+      CHECK_EQUAL(2, destructed);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_item_too_small)
+    {
+      etl::pool<int, 2> pool;
+
+      CHECK(!etl::make_pool_shared<Message2>(pool, std::string("two"), 2));
+      CHECK(pool.empty());
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_atomic_counter)
+    {
+      destructed = 0;
+
+      typedef etl::pool_shared_ptr<Message1, etl::atomic_reference_counter> Ptr;
+
+      etl::pool<Ptr::block_type, 1> pool;
+
+      {
+        Ptr p = etl::make_pool_shared<Message1, etl::atomic_reference_counter>(pool, 1);
+
+        std::thread t1([p]() { for (int i = 0; i < 10000; ++i) { Ptr copy(p); } });
+        std::thread t2([p]() { for (int i = 0; i < 10000; ++i) { Ptr copy(p); } });
+
+        t1.join();
+        t2.join();
+
+        CHECK_EQUAL(1U, p.use_count());
+      }
+
+      CHECK_EQUAL(1, destructed);
+      CHECK(pool.empty());
+    }
+#endif
+  };
+}
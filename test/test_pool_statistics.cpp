@@ -0,0 +1,164 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/pool.h"
+#include "etl/variant_pool.h"
+
+#include <stdint.h>
+
+#if defined(ETL_POOL_STATISTICS)
+
+namespace
+{
+  struct Small
+  {
+    Small(int i_ = 0)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  struct Large
+  {
+    char c[64];
+  };
+
+  const size_t SIZE = 5;
+
+  typedef etl::variant_pool<SIZE, Small, Large, int> Factory;
+  typedef etl::segregated_variant_pool<Small, 4, Large, 1, int, 3> SegregatedFactory;
+
+  SUITE(test_pool_statistics)
+  {
+    //*************************************************************************
+    TEST(test_pool)
+    {
+      etl::pool<Small, 4> pool;
+
+      etl::pool_statistics statistics = pool.get_statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.max_size);
+      CHECK_EQUAL(0U, statistics.high_water);
+      CHECK_EQUAL(0U, statistics.allocations);
+      CHECK_EQUAL(0U, statistics.failures);
+
+      Small* p1 = pool.allocate<Small>();
+      Small* p2 = pool.allocate<Small>();
+      Small* p3 = pool.allocate<Small>();
+      pool.release(p2);
+      pool.release(p3);
+      p2 = pool.allocate<Small>();
+
+      statistics = pool.get_statistics();
+      CHECK_EQUAL(2U, statistics.size);
+      CHECK_EQUAL(3U, statistics.high_water);
+      CHECK_EQUAL(4U, statistics.allocations);
+      CHECK_EQUAL(0U, statistics.failures);
+
+      pool.allocate<Small>();
+      pool.allocate<Small>();
+      CHECK_THROW(pool.allocate<Small>(), etl::pool_no_allocation);
+
+      statistics = pool.get_statistics();
+      CHECK_EQUAL(4U, statistics.high_water);
+      CHECK_EQUAL(6U, statistics.allocations);
+      CHECK_EQUAL(1U, statistics.failures);
+
+      // The history is kept.
+      pool.release_all();
+      CHECK_EQUAL(4U, pool.get_statistics().high_water);
+
+      pool.allocate<Small>();
+      pool.clear_statistics();
+
+      statistics = pool.get_statistics();
+      CHECK_EQUAL(1U, statistics.high_water);
+      CHECK_EQUAL(0U, statistics.allocations);
+      CHECK_EQUAL(0U, statistics.failures);
+
+      (void)p1;
+    }
+
+    //*************************************************************************
+    TEST(test_variant_pool)
+    {
+      Factory variant_pool;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        variant_pool.create<int>(1);
+      }
+
+      CHECK_THROW(variant_pool.create<Small>(), etl::variant_pool_cannot_create);
+
+      etl::pool_statistics statistics = variant_pool.get_statistics();
+      CHECK_EQUAL(SIZE, statistics.size);
+      CHECK_EQUAL(SIZE, statistics.max_size);
+      CHECK_EQUAL(SIZE, statistics.high_water);
+      CHECK_EQUAL(SIZE, statistics.allocations);
+      CHECK_EQUAL(1U, statistics.failures);
+
+      variant_pool.clear_statistics();
+      CHECK_EQUAL(0U, variant_pool.get_statistics().failures);
+    }
+
+    //*************************************************************************
+    TEST(test_segregated_variant_pool)
+    {
+      SegregatedFactory variant_pool;
+
+      Small* p = variant_pool.create<Small>();
+      variant_pool.destroy(p);
+      variant_pool.create<Large>();
+      CHECK_THROW(variant_pool.create<Large>(), etl::variant_pool_cannot_create);
+
+      etl::pool_statistics statistics = variant_pool.get_statistics<Small>();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.max_size);
+      CHECK_EQUAL(1U, statistics.high_water);
+      CHECK_EQUAL(1U, statistics.allocations);
+      CHECK_EQUAL(0U, statistics.failures);
+
+      statistics = variant_pool.get_statistics<Large>();
+      CHECK_EQUAL(1U, statistics.size);
+      CHECK_EQUAL(1U, statistics.allocations);
+      CHECK_EQUAL(1U, statistics.failures);
+
+      variant_pool.clear_statistics();
+      CHECK_EQUAL(0U, variant_pool.get_statistics<Large>().failures);
+      CHECK_EQUAL(0U, variant_pool.get_statistics<Small>().high_water);
+    }
+  };
+}
+
+#endif
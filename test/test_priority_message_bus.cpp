@@ -0,0 +1,265 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+
+#include "etl/priority_message_bus.h"
+#include "etl/message_router.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  enum
+  {
+    CONTROL,
+    TELEMETRY
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  struct Control : public etl::message<CONTROL>
+  {
+    Control(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  // A message that owns memory, to check that packets are copied properly.
+  struct Telemetry : public etl::message<TELEMETRY>
+  {
+    Telemetry(const std::string& text_)
+      : text(text_)
+    {
+    }
+
+    std::string text;
+  };
+
+  std::vector<std::string> log;
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Control, Telemetry>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id)
+      , p_last_sender(nullptr)
+    {
+    }
+
+    void on_receive(etl::imessage_router& sender, const Control& msg)
+    {
+      log.push_back(std::to_string(get_message_router_id()) + "C" + std::to_string(msg.value));
+      p_last_sender = &sender;
+    }
+
+    void on_receive(etl::imessage_router& sender, const Telemetry& msg)
+    {
+      log.push_back(std::to_string(get_message_router_id()) + "T" + msg.text);
+      p_last_sender = &sender;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    etl::imessage_router* p_last_sender;
+  };
+
+  //***************************************************************************
+  // Control messages in lane 0, telemetry in lane 1.
+  struct Priority
+  {
+    size_t operator()(const etl::imessage& msg) const
+    {
+      return (msg.message_id == CONTROL) ? 0U : 1U;
+    }
+  };
+
+  typedef etl::priority_message_bus<Router::message_packet, 4, 2, 8, etl::message_inbox_spsc, Priority> Bus;
+
+  SUITE(test_priority_message_bus)
+  {
+    //*************************************************************************
+    TEST(test_strict_priority)
+    {
+      log.clear();
+
+      Bus    bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+
+      bus.receive(Telemetry("a"));
+      bus.receive(Telemetry("b"));
+      bus.receive(Control(1));
+      bus.receive(Telemetry("c"));
+      bus.receive(Control(2));
+
+      // Nothing is delivered until processed.
+      CHECK(log.empty());
+      CHECK_EQUAL(2U, bus.lane_size(0));
+      CHECK_EQUAL(3U, bus.lane_size(1));
+
+      CHECK_EQUAL(5U, bus.process());
+      CHECK(bus.empty());
+
+      CHECK_EQUAL(5U, log.size());
+      CHECK_EQUAL(std::string("1C1"), log[0]);
+      CHECK_EQUAL(std::string("1C2"), log[1]);
+      CHECK_EQUAL(std::string("1Ta"), log[2]);
+      CHECK_EQUAL(std::string("1Tb"), log[3]);
+      CHECK_EQUAL(std::string("1Tc"), log[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_weighted_fair)
+    {
+      log.clear();
+
+      Bus    bus(Bus::Weighted_Fair);
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+      bus.set_lane_weight(0, 2);
+
+      for (int i = 0; i < 5; ++i)
+      {
+        bus.receive(Control(i));
+        bus.receive(Telemetry(std::string(1, char('a' + i))));
+      }
+
+      CHECK_EQUAL(4U, bus.process(4));
+      CHECK_EQUAL(6U, bus.process());
+
+      const char* expected[] = { "1C0", "1C1", "1Ta", "1C2", "1C3", "1Tb", "1C4", "1Tc", "1Td", "1Te" };
+
+      CHECK_EQUAL(10U, log.size());
+
+      for (size_t i = 0U; i < log.size(); ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), log[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_receive_batch)
+    {
+      log.clear();
+
+      Bus    bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+
+      const Router::message_packet packets[] = { Router::message_packet(Telemetry("a")),
+                                                 Router::message_packet(Control(1)),
+                                                 Router::message_packet(Telemetry("b")),
+                                                 Router::message_packet(Control(2)) };
+
+      // Queued, not delivered.
+      bus.receive_batch(packets, 4U);
+      CHECK(log.empty());
+      CHECK_EQUAL(2U, bus.lane_size(0));
+      CHECK_EQUAL(2U, bus.lane_size(1));
+
+      CHECK_EQUAL(4U, bus.process());
+
+      const char* expected[] = { "1C1", "1C2", "1Ta", "1Tb" };
+
+      CHECK_EQUAL(4U, log.size());
+
+      for (size_t i = 0U; i < log.size(); ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), log[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_lane_limit)
+    {
+      log.clear();
+
+      Bus    bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+      bus.set_lane_limit(1, 2);
+
+      bus.receive(Telemetry("a"));
+      bus.receive(Telemetry("b"));
+      bus.receive(Telemetry("c"));
+      CHECK(bus.post(Control(1), 0));
+      CHECK(!bus.post(Telemetry("d"), 1));
+
+      CHECK_EQUAL(0U, bus.get_overflow_count(0));
+      CHECK_EQUAL(2U, bus.get_overflow_count(1));
+      CHECK_EQUAL(3U, bus.process());
+      CHECK_EQUAL(std::string("1C1"), log[0]);
+      CHECK_EQUAL(std::string("1Tb"), log[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_addressed_and_sender)
+    {
+      log.clear();
+
+      Bus    bus;
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      bus.receive(ROUTER2, Control(1));
+      bus.receive(router1, Telemetry("x"));
+
+      CHECK_EQUAL(2U, bus.process());
+      CHECK_EQUAL(std::string("2C1"), log[0]);
+      CHECK_EQUAL(std::string("1Tx"), log[1]);
+      CHECK_EQUAL(std::string("2Tx"), log[2]);
+
+      CHECK(router2.p_last_sender == &router1);
+      CHECK(router1.p_last_sender == &router1);
+    }
+  };
+}
+
+#endif
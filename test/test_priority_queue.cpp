@@ -33,6 +33,8 @@ SOFTWARE.
 #include "etl/priority_queue.h"
 #include <functional>
 
+#include "data.h"
+
 namespace
 {
   struct Item
@@ -545,5 +547,97 @@ namespace
         priority_queue2.pop();
       }
     }
+
+    //*************************************************************************
+    TEST(test_move_only)
+    {
+      typedef TestDataM<int> ItemM;
+      typedef etl::priority_queue<ItemM, SIZE> Data;
+
+      Data data;
+
+      data.push(ItemM(3));
+      data.push(ItemM(1));
+      data.push(ItemM(4));
+      data.emplace(2);
+
+      Data moved(std::move(data));
+      CHECK_EQUAL(4U, moved.size());
+      CHECK(data.empty());
+
+      Data assigned;
+      assigned.push(ItemM(9));
+      assigned = std::move(moved);
+      CHECK_EQUAL(4U, assigned.size());
+
+      ItemM item(0);
+
+      assigned.pop_into(item);
+      CHECK_EQUAL(4, item.value);
+      CHECK_EQUAL(3, assigned.top().value);
+      CHECK(bool(assigned.top()));
+
+      assigned.pop();
+      CHECK_EQUAL(2, assigned.top().value);
+    }
+
+    //*************************************************************************
+    TEST(test_four_ary_heap)
+    {
+      typedef etl::priority_queue<int, 64, etl::vector<int, 64>, etl::less<int>, 4> Data;
+
+      Data data;
+      std::priority_queue<int> compare_data;
+
+      CHECK_EQUAL(4U, Data::HEAP_ARITY);
+
+      for (int i = 0; i < 64; ++i)
+      {
+        const int value = (i * 37) % 61;
+        data.push(value);
+        compare_data.push(value);
+      }
+
+      CHECK(data.full());
+
+      while (!compare_data.empty())
+      {
+        CHECK_EQUAL(compare_data.top(), data.top());
+        data.pop();
+        compare_data.pop();
+      }
+
+      CHECK(data.empty());
+
+      int values[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+      Data from_range(etl::begin(values), etl::end(values));
+
+      for (int expected = 9; expected >= 0; --expected)
+      {
+        CHECK_EQUAL(expected, from_range.top());
+        from_range.pop();
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_four_ary_heap_move_only)
+    {
+      typedef TestDataM<int> ItemM;
+      typedef etl::priority_queue<ItemM, 8, etl::vector<ItemM, 8>, etl::less<ItemM>, 4> Data;
+
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push(ItemM((i * 5) % 8));
+      }
+
+      for (int expected = 7; expected >= 0; --expected)
+      {
+        CHECK_EQUAL(expected, data.top().value);
+        CHECK(bool(data.top()));
+        data.pop();
+      }
+    }
   };
 }
@@ -550,5 +550,57 @@ namespace
       CHECK_EQUAL(4, queue.front());
       queue.pop();
     }
+
+    //*************************************************************************
+    TEST(test_unchecked)
+    {
+      etl::queue<int, 4> queue;
+
+      CHECK(queue.reserve_check(4U));
+      queue.push_unchecked(1);
+      queue.push_unchecked(2);
+
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(2, queue.back());
+
+      CHECK_THROW(queue.reserve_check(3U), etl::queue_full);
+    }
+
+
+    //*************************************************************************
+    TEST(test_queue_ext)
+    {
+      typedef etl::queue_ext<int> Queue;
+
+      int buffer[4];
+      CHECK_EQUAL(sizeof(buffer), Queue::buffer_size(4U));
+
+      Queue queue(buffer, 4U);
+      etl::iqueue<int>& iqueue = queue;
+
+      CHECK_EQUAL(4U, iqueue.max_size());
+
+      iqueue.push(1);
+      iqueue.push(2);
+      iqueue.push(3);
+      iqueue.push(4);
+      CHECK(iqueue.full());
+      CHECK_THROW(iqueue.push(5), etl::queue_full);
+
+      CHECK(&iqueue.front() == &buffer[0]);
+      CHECK_EQUAL(1, iqueue.front());
+      iqueue.pop();
+      iqueue.push(5);
+      CHECK_EQUAL(2, iqueue.front());
+      CHECK_EQUAL(5, iqueue.back());
+
+      int buffer2[4];
+      Queue queue2(buffer2, 4U);
+      queue2 = queue;
+      CHECK_EQUAL(4U, queue2.size());
+      CHECK_EQUAL(2, queue2.front());
+      CHECK(&queue2.front() != &queue.front());
+    }
   };
 }
@@ -0,0 +1,211 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+
+#include "etl/queue_blocking.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/function.h"
+
+namespace
+{
+  typedef etl::queue_spsc_atomic<int, 4> SpscQueue;
+  typedef etl::queue_mpmc_atomic<int, 4> MpmcQueue;
+
+  //***************************************************************************
+  // Records the calls made through the delegate policy.
+  //***************************************************************************
+  struct Hooks
+  {
+    void clear()
+    {
+      wait_data    = 0;
+      notify_data  = 0;
+      wait_space   = 0;
+      notify_space = 0;
+    }
+
+    void on_wait_data()
+    {
+      ++wait_data;
+    }
+
+    void on_notify_data()
+    {
+      ++notify_data;
+    }
+
+    void on_wait_space();
+
+    void on_notify_space()
+    {
+      ++notify_space;
+    }
+
+    int wait_data;
+    int notify_data;
+    int wait_space;
+    int notify_space;
+  };
+
+  Hooks hooks;
+
+  etl::queue_blocking<MpmcQueue, etl::queue_wait_delegate>* p_delegate_queue = nullptr;
+
+  // Acts as the consumer when the producer has to wait.
+  void Hooks::on_wait_space()
+  {
+    ++wait_space;
+
+    int value;
+    p_delegate_queue->MpmcQueue::pop(value);
+  }
+
+  etl::function_imv<Hooks, hooks, &Hooks::on_wait_data>    wait_data;
+  etl::function_imv<Hooks, hooks, &Hooks::on_notify_data>  notify_data;
+  etl::function_imv<Hooks, hooks, &Hooks::on_wait_space>   wait_space;
+  etl::function_imv<Hooks, hooks, &Hooks::on_notify_space> notify_space;
+
+  int yields = 0;
+
+  void yield()
+  {
+    ++yields;
+  }
+
+  SUITE(test_queue_blocking)
+  {
+    //*************************************************************************
+    TEST(test_spin_yield)
+    {
+      etl::queue_blocking<SpscQueue, etl::queue_wait_spin_yield<8U, yield> > queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.push(1));
+      CHECK(queue.emplace(2));
+      queue.push_wait(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      int value;
+      queue.pop_wait(value);
+      CHECK_EQUAL(1, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK(queue.pop());
+      CHECK(!queue.pop());
+      CHECK_EQUAL(0, yields);
+    }
+
+    //*************************************************************************
+    TEST(test_delegate)
+    {
+      hooks.clear();
+
+      etl::queue_wait_delegate policy(wait_data, notify_data, wait_space, notify_space);
+      etl::queue_blocking<MpmcQueue, etl::queue_wait_delegate> queue(policy);
+      p_delegate_queue = &queue;
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+      CHECK_EQUAL(4, hooks.notify_data);
+
+      // The queue is full, so the wait hook has to make room.
+      queue.push_wait(5);
+      CHECK_EQUAL(1, hooks.wait_space);
+      CHECK_EQUAL(5, hooks.notify_data);
+
+      int value;
+      queue.pop_wait(value);
+      CHECK_EQUAL(2, value);
+      CHECK_EQUAL(0, hooks.wait_data);
+      CHECK_EQUAL(1, hooks.notify_space);
+
+      CHECK(queue.pop(value));
+      CHECK(queue.pop(value));
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(5, value);
+      CHECK(!queue.pop(value));
+      CHECK_EQUAL(4, hooks.notify_space);
+    }
+
+    //*************************************************************************
+    TEST(test_mpmc_mutex)
+    {
+      etl::queue_blocking<etl::queue_mpmc_mutex<int, 4> > queue;
+
+      queue.push_wait(1);
+      CHECK(queue.emplace(2));
+
+      int value;
+      queue.pop_wait(value);
+      CHECK_EQUAL(1, value);
+      queue.pop_wait(value);
+      CHECK_EQUAL(2, value);
+      CHECK(queue.empty());
+    }
+
+#if !defined(ETL_NO_STL) && defined(__cpp_lib_atomic_wait)
+    //*************************************************************************
+    TEST(test_atomic_wait)
+    {
+      static etl::queue_blocking<SpscQueue, etl::queue_wait_atomic> queue;
+      const int count = 1000;
+
+      std::thread producer([]()
+      {
+        for (int i = 0; i < count; ++i)
+        {
+          queue.push_wait(i);
+        }
+      });
+
+      bool in_order = true;
+
+      for (int i = 0; i < count; ++i)
+      {
+        int value;
+        queue.pop_wait(value);
+        in_order = in_order && (value == i);
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+#endif
+  };
+}
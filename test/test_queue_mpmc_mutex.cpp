@@ -49,6 +49,23 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  /// A time source for the telemetry tests.
+  //***************************************************************************
+  struct manual_clock
+  {
+    typedef uint32_t value_type;
+
+    value_type read() const
+    {
+      return now;
+    }
+
+    static value_type now;
+  };
+
+  manual_clock::value_type manual_clock::now = 0U;
+
   struct Data
   {
     Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
@@ -350,6 +367,48 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_telemetry)
+    {
+      etl::queue_mpmc_mutex<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_telemetry> queue;
+
+      const etl::queue_telemetry& telemetry = queue.telemetry();
+
+      queue.push(1);
+      queue.push(2);
+      queue.pop();
+      queue.push(3);
+      queue.push(4);
+      queue.emplace(5);
+      CHECK(!queue.push(6));
+
+      CHECK_EQUAL(4U, telemetry.high_water_mark());
+      CHECK_EQUAL(1U, telemetry.push_failures());
+      CHECK_EQUAL(5U, telemetry.pushes());
+      CHECK_EQUAL(1U, telemetry.pops());
+    }
+
+    //*************************************************************************
+    TEST(test_telemetry_latency)
+    {
+      typedef etl::queue_telemetry_latency<4, manual_clock> telemetry_t;
+
+      etl::queue_mpmc_mutex<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, telemetry_t> queue;
+
+      manual_clock::now = 0U;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        queue.push(i);
+        manual_clock::now += uint32_t(i);
+        queue.pop();
+      }
+
+      CHECK_EQUAL(9U, queue.telemetry().max_latency());
+      CHECK_EQUAL(45U, queue.telemetry().total_latency());
+      CHECK_EQUAL(1U, queue.telemetry().high_water_mark());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -503,6 +562,37 @@ namespace
       }
     }
 #endif
+
+    //*************************************************************************
+    TEST(test_queue_ext)
+    {
+      typedef etl::queue_mpmc_mutex_ext<int> Queue;
+
+      int buffer[4];
+      CHECK_EQUAL(sizeof(buffer), Queue::buffer_size(4U));
+
+      Queue queue(buffer, 4U);
+
+      CHECK_EQUAL(4U, queue.max_size());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.push(5));
+      CHECK_EQUAL(4U, queue.size());
+
+      for (int expected = 2; expected <= 5; ++expected)
+      {
+        CHECK(queue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+    }
   };
 }
 
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <string>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -46,6 +47,23 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  /// A time source for the telemetry tests.
+  //***************************************************************************
+  struct manual_clock
+  {
+    typedef uint32_t value_type;
+
+    value_type read() const
+    {
+      return now;
+    }
+
+    static value_type now;
+  };
+
+  manual_clock::value_type manual_clock::now = 0U;
+
   struct Data
   {
     Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
@@ -139,6 +157,43 @@ namespace
       CHECK(!queue.pop(i));
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_wrapping_power_of_two_buffer)
+    {
+      // 7 items use a buffer of 8, so the indexes are masked.
+      etl::queue_spsc_atomic<int, 7> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int pass = 0; pass < 20; ++pass)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK_EQUAL(7U, queue.size());
+
+        // Leave a varying number behind so that the indexes wrap at every offset.
+        for (int i = 0; i <= (pass % 7); ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop++, value);
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop++, value);
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
     //*************************************************************************
     TEST(test_move_push_pop)
     {
@@ -340,6 +395,187 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_batch_push_pop)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      const int input[6] = { 0, 1, 2, 3, 4, 5 };
+      int output[6] = { 0 };
+
+      // Only 4 values fit.
+      CHECK_EQUAL(4U, queue.push(input, 6U));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1U));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(0, output[0]);
+      CHECK_EQUAL(1, output[1]);
+      CHECK_EQUAL(2, output[2]);
+
+      // These wrap around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(input + 3, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+
+      // Non trivially copyable.
+      etl::queue_spsc_atomic<std::string, 4> item_queue;
+      const std::string items[3] = { "one", "two", "three" };
+      std::string popped[3];
+
+      CHECK_EQUAL(3U, item_queue.push(items, 3U));
+      CHECK_EQUAL(3U, item_queue.pop(popped, 3U));
+      CHECK(popped[0] == "one");
+      CHECK(popped[2] == "three");
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_acquire_release)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      // Reserve more than will fit.
+      etl::array_view<int> span = queue.write_reserve(6U);
+      CHECK_EQUAL(4U, span.size());
+
+      span[0] = 0;
+      span[1] = 1;
+      span[2] = 2;
+      CHECK(queue.empty());
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::array_view<const int> values = queue.read_acquire();
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(0, values[0]);
+      CHECK_EQUAL(2, values[2]);
+      queue.read_release(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      // The free slots wrap, so only those up to the end are contiguous.
+      span = queue.write_reserve(3U);
+      CHECK_EQUAL(2U, span.size());
+      span[0] = 3;
+      queue.write_commit(1U);
+
+      span = queue.write_reserve(3U);
+      CHECK(span.size() != 0U);
+      span[0] = 4;
+      queue.write_commit(1U);
+
+      int value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(4, value);
+
+      values = queue.read_acquire();
+      CHECK_EQUAL(0U, values.size());
+    }
+
+    //*************************************************************************
+    TEST(test_telemetry_none_is_free)
+    {
+      CHECK_EQUAL(sizeof(etl::queue_spsc_atomic<int, 4>), sizeof(etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_telemetry_none>));
+    }
+
+    //*************************************************************************
+    TEST(test_telemetry)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_telemetry> queue;
+
+      const etl::queue_telemetry& telemetry = queue.telemetry();
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK_EQUAL(3U, telemetry.high_water_mark());
+
+      CHECK(queue.pop());
+      CHECK(queue.pop());
+      CHECK(queue.push(4));
+      CHECK(queue.emplace(5));
+      CHECK(queue.push(6));
+      CHECK(!queue.push(7));
+      CHECK(!queue.emplace(8));
+
+      CHECK_EQUAL(4U, telemetry.high_water_mark());
+      CHECK_EQUAL(2U, telemetry.push_failures());
+      CHECK_EQUAL(6U, telemetry.pushes());
+      CHECK_EQUAL(2U, telemetry.pops());
+
+      // Batches count each item, and one failure for a short push.
+      int values[4];
+      CHECK_EQUAL(4U, queue.pop(values, 4U));
+      CHECK_EQUAL(6U, telemetry.pops());
+
+      const int more[] = { 1, 2, 3, 4, 5 };
+      CHECK_EQUAL(4U, queue.push(more, 5U));
+      CHECK_EQUAL(10U, telemetry.pushes());
+      CHECK_EQUAL(3U, telemetry.push_failures());
+
+      queue.telemetry().reset();
+      CHECK_EQUAL(0U, telemetry.high_water_mark());
+      CHECK_EQUAL(0U, telemetry.pushes());
+    }
+
+    //*************************************************************************
+    TEST(test_telemetry_latency)
+    {
+      typedef etl::queue_telemetry_latency<4, manual_clock> telemetry_t;
+
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, telemetry_t> queue;
+
+      const telemetry_t& telemetry = queue.telemetry();
+
+      manual_clock::now = 100U;
+      queue.push(1);
+      manual_clock::now = 110U;
+      queue.push(2);
+
+      manual_clock::now = 130U;
+      queue.pop();  // Waited 30.
+      manual_clock::now = 140U;
+      queue.pop();  // Waited 30.
+
+      // Wrap around the buffer.
+      for (int i = 0; i < 10; ++i)
+      {
+        queue.push(i);
+        manual_clock::now += 5U;
+        queue.pop();
+      }
+
+      CHECK_EQUAL(30U, telemetry.max_latency());
+      CHECK_EQUAL(110U, telemetry.total_latency());
+      CHECK_EQUAL(9U, telemetry.mean_latency());
+      CHECK_EQUAL(0U, telemetry.push_failures());
+
+      // Zero copy access.
+      manual_clock::now = 1000U;
+      etl::array_view<int> span = queue.write_reserve(2U);
+      span[0] = 1;
+      span[1] = 2;
+      queue.write_commit(2U);
+
+      manual_clock::now = 1100U;
+      queue.read_acquire();
+      queue.read_release(2U);
+
+      CHECK_EQUAL(100U, telemetry.max_latency());
+      CHECK_EQUAL(14U, telemetry.pops());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -402,6 +638,39 @@ namespace
       }
     }
 #endif
+
+    //*************************************************************************
+    TEST(test_queue_ext)
+    {
+      typedef etl::queue_spsc_atomic_ext<int> Queue;
+
+      int buffer[5];
+      CHECK_EQUAL(sizeof(buffer), Queue::buffer_size(4U));
+
+      Queue queue(buffer, 4U);
+
+      CHECK_EQUAL(4U, queue.max_size());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+      CHECK(queue.full());
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.push(5));
+
+      for (int expected = 2; expected <= 5; ++expected)
+      {
+        CHECK(queue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(queue.empty());
+    }
   };
 }
 
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <string>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -570,6 +571,109 @@ namespace
       CHECK(!Access::called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_batch_push_pop)
+    {
+      Access::clear();
+
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      const int input[6] = { 0, 1, 2, 3, 4, 5 };
+      int output[6] = { 0 };
+
+      // Only 4 values fit.
+      CHECK_EQUAL(4U, queue.push(input, 6U));
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1U));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(0, output[0]);
+      CHECK_EQUAL(1, output[1]);
+      CHECK_EQUAL(2, output[2]);
+
+      // These wrap around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(input + 3, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+
+      Access::clear();
+
+      CHECK_EQUAL(2U, queue.push_from_isr(input, 2U));
+      CHECK_EQUAL(2U, queue.pop_from_isr(output, 2U));
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+
+      // Non trivially copyable.
+      etl::queue_spsc_isr<std::string, 4, Access> item_queue;
+      const std::string items[3] = { "one", "two", "three" };
+      std::string popped[3];
+
+      CHECK_EQUAL(3U, item_queue.push(items, 3U));
+      CHECK_EQUAL(3U, item_queue.pop(popped, 3U));
+      CHECK(popped[0] == "one");
+      CHECK(popped[2] == "three");
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_acquire_release)
+    {
+      Access::clear();
+
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      // Reserve more than will fit.
+      etl::array_view<int> span = queue.write_reserve(6U);
+      CHECK_EQUAL(4U, span.size());
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+
+      span[0] = 0;
+      span[1] = 1;
+      span[2] = 2;
+      CHECK(queue.empty());
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::array_view<const int> values = queue.read_acquire();
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(0, values[0]);
+      CHECK_EQUAL(2, values[2]);
+      queue.read_release(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      // The free slots wrap, so only those up to the end are contiguous.
+      span = queue.write_reserve(3U);
+      CHECK_EQUAL(1U, span.size());
+      span[0] = 3;
+      queue.write_commit(1U);
+
+      span = queue.write_reserve_from_isr(3U);
+      CHECK(span.size() != 0U);
+      span[0] = 4;
+      queue.write_commit_from_isr(1U);
+
+      int value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(4, value);
+
+      values = queue.read_acquire_from_isr();
+      CHECK_EQUAL(0U, values.size());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -657,5 +761,34 @@ namespace
       }
     }
 #endif
+
+    //*************************************************************************
+    TEST(test_queue_ext)
+    {
+      typedef etl::queue_spsc_isr_ext<int, Access> Queue;
+
+      int buffer[4];
+      CHECK_EQUAL(sizeof(buffer), Queue::buffer_size(4U));
+
+      Queue queue(buffer, 4U);
+
+      CHECK_EQUAL(4U, queue.max_size());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+
+      int i;
+
+      for (int expected = 1; expected <= 4; ++expected)
+      {
+        CHECK(queue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(queue.empty());
+    }
   };
 }
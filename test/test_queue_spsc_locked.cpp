@@ -34,6 +34,7 @@ SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <string>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -573,6 +574,59 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_batch_push_pop)
+    {
+      access.clear();
+
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      const int input[6] = { 0, 1, 2, 3, 4, 5 };
+      int output[6] = { 0 };
+
+      // Only 4 values fit.
+      CHECK_EQUAL(4U, queue.push(input, 6U));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1U));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(0, output[0]);
+      CHECK_EQUAL(1, output[1]);
+      CHECK_EQUAL(2, output[2]);
+
+      // These wrap around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(input + 3, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+
+      access.clear();
+
+      CHECK_EQUAL(2U, queue.push_from_unlocked(input, 2U));
+      CHECK_EQUAL(2U, queue.pop_from_unlocked(output, 2U));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+
+      // Non trivially copyable.
+      etl::queue_spsc_locked<std::string, 4> item_queue(lock, unlock);
+      const std::string items[3] = { "one", "two", "three" };
+      std::string popped[3];
+
+      CHECK_EQUAL(3U, item_queue.push(items, 3U));
+      CHECK_EQUAL(3U, item_queue.pop(popped, 3U));
+      CHECK(popped[0] == "one");
+      CHECK(popped[2] == "three");
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -663,5 +717,38 @@ namespace
       }
     }
 #endif
+
+    //*************************************************************************
+    TEST(test_queue_ext)
+    {
+      typedef etl::queue_spsc_locked_ext<int> Queue;
+
+      int buffer[4];
+      CHECK_EQUAL(sizeof(buffer), Queue::buffer_size(4U));
+
+      Queue queue(buffer, 4U, lock, unlock);
+
+      CHECK_EQUAL(4U, queue.max_size());
+
+      access.clear();
+      CHECK(queue.push(1));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+
+      int i;
+
+      for (int expected = 1; expected <= 4; ++expected)
+      {
+        CHECK(queue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(queue.empty());
+    }
   };
 }
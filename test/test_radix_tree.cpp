@@ -0,0 +1,373 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/radix_tree.h"
+#include "etl/random.h"
+
+#include <stdio.h>
+#include <string>
+#include <map>
+#include <vector>
+
+namespace
+{
+  typedef etl::radix_tree<int, 64, 256>          Tree;
+  typedef etl::bit_radix_tree<int, 64, 32>       Tree4;
+  typedef etl::bit_radix_tree<std::string, 16, 128> Tree6;
+
+  //*************************************************************************
+  struct ipv4
+  {
+    ipv4(int a, int b, int c, int d)
+    {
+      bytes[0] = uint8_t(a);
+      bytes[1] = uint8_t(b);
+      bytes[2] = uint8_t(c);
+      bytes[3] = uint8_t(d);
+    }
+
+    uint8_t bytes[4];
+  };
+
+  SUITE(test_radix_tree)
+  {
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Tree tree;
+
+      CHECK(tree.empty());
+      CHECK(tree.insert("sensors/temperature", 1));
+      CHECK(tree.insert("sensors/humidity", 2));
+      CHECK(tree.insert("sensors", 3));
+      CHECK(tree.insert("status", 4));
+      CHECK(tree.insert("s", 5));
+      CHECK_EQUAL(5U, tree.size());
+
+      CHECK_EQUAL(1, *tree.find("sensors/temperature"));
+      CHECK_EQUAL(2, *tree.find("sensors/humidity"));
+      CHECK_EQUAL(3, *tree.find("sensors"));
+      CHECK_EQUAL(4, *tree.find("status"));
+      CHECK_EQUAL(5, *tree.find("s"));
+      CHECK(tree.find("sensors/") == nullptr);
+      CHECK(tree.find("sensor") == nullptr);
+      CHECK(tree.find("sensors/temperatures") == nullptr);
+      CHECK(tree.find("") == nullptr);
+      CHECK(!tree.contains("x"));
+
+      // Edge labels are shared, not stored per key.
+      CHECK(tree.chars_used() < (19U + 16U + 7U + 6U + 1U));
+
+      // Replace.
+      CHECK(tree.insert("sensors", 30));
+      CHECK_EQUAL(30, *tree.find("sensors"));
+      CHECK_EQUAL(5U, tree.size());
+    }
+
+    //*************************************************************************
+    TEST(test_longest_prefix_match)
+    {
+      Tree tree;
+
+      tree.insert("a/", 1);
+      tree.insert("a/b/", 2);
+      tree.insert("a/b/c", 3);
+
+      size_t length;
+      CHECK_EQUAL(3, *tree.longest_prefix_match("a/b/c/d", length));
+      CHECK_EQUAL(5U, length);
+      CHECK_EQUAL(2, *tree.longest_prefix_match("a/b/x", length));
+      CHECK_EQUAL(4U, length);
+      CHECK_EQUAL(1, *tree.longest_prefix_match("a/bc"));
+      CHECK(tree.longest_prefix_match("a") == nullptr);
+      CHECK(tree.longest_prefix_match("b/") == nullptr);
+
+      // The empty key matches everything.
+      tree.insert("", 0);
+      CHECK_EQUAL(0, *tree.longest_prefix_match("zzz", length));
+      CHECK_EQUAL(0U, length);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Tree tree;
+
+      tree.insert("abc", 1);
+      tree.insert("abd", 2);
+      tree.insert("ab", 3);
+
+      CHECK(!tree.erase("a"));
+      CHECK(tree.erase("abc"));
+      CHECK(!tree.erase("abc"));
+      CHECK(tree.find("abc") == nullptr);
+      CHECK_EQUAL(2, *tree.find("abd"));
+      CHECK_EQUAL(3, *tree.find("ab"));
+
+      CHECK(tree.erase("abd"));
+      CHECK(tree.erase("ab"));
+      CHECK(tree.empty());
+      CHECK_EQUAL(0U, tree.nodes_used());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::radix_tree<int, 3, 8> tree;
+
+      CHECK(tree.insert("abcd", 1));
+      CHECK(!tree.insert("abcdefghi", 2)); // Too many characters.
+      CHECK(tree.insert("abxy", 2));       // Splits "abcd".
+      CHECK_EQUAL(3U, tree.nodes_used());
+      CHECK(!tree.insert("q", 3));         // No nodes.
+      CHECK(!tree.insert("a", 3));         // No node to split "ab".
+      CHECK_EQUAL(2U, tree.size());
+      CHECK(tree.insert("ab", 4));         // Uses the split node.
+      CHECK_EQUAL(1, *tree.find("abcd"));
+      CHECK_EQUAL(2, *tree.find("abxy"));
+      CHECK_EQUAL(4, *tree.find("ab"));
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_map)
+    {
+      static etl::radix_tree<int, 2000, 20000> tree;
+      std::map<std::string, int> reference;
+      etl::random_xorshift random(99U);
+      const char alphabet[] = "ab/c";
+
+      for (int i = 0; i < 3000; ++i)
+      {
+        std::string key;
+        const uint32_t length = random.range(0U, 8U);
+
+        for (uint32_t j = 0U; j < length; ++j)
+        {
+          key += alphabet[random.range(0U, 3U)];
+        }
+
+        if (random.range(0U, 3U) == 0U)
+        {
+          CHECK_EQUAL(reference.erase(key) == 1U, tree.erase(etl::string_view(key.data(), key.size())));
+        }
+        else
+        {
+          CHECK(tree.insert(etl::string_view(key.data(), key.size()), i));
+          reference[key] = i;
+        }
+      }
+
+      CHECK_EQUAL(reference.size(), tree.size());
+
+      for (int i = 0; i < 500; ++i)
+      {
+        std::string key;
+
+        for (uint32_t j = 0U; j < 10U; ++j)
+        {
+          key += alphabet[random.range(0U, 3U)];
+        }
+
+        // The longest stored prefix, by brute force.
+        const int* expected = nullptr;
+
+        for (size_t n = 0U; n <= key.size(); ++n)
+        {
+          std::map<std::string, int>::const_iterator itr = reference.find(key.substr(0U, n));
+
+          if (itr != reference.end())
+          {
+            expected = &itr->second;
+          }
+        }
+
+        const int* actual = tree.longest_prefix_match(etl::string_view(key.data(), key.size()));
+        CHECK_EQUAL(expected == nullptr, actual == nullptr);
+
+        if ((expected != nullptr) && (actual != nullptr))
+        {
+          CHECK_EQUAL(*expected, *actual);
+        }
+      }
+
+      tree.clear();
+      CHECK_EQUAL(0U, tree.nodes_used());
+    }
+
+    //*************************************************************************
+    TEST(test_ipv4_routes)
+    {
+      Tree4 routes;
+
+      CHECK(routes.insert(ipv4(0, 0, 0, 0).bytes, 0, 0));
+      CHECK(routes.insert(ipv4(10, 0, 0, 0).bytes, 8, 1));
+      CHECK(routes.insert(ipv4(10, 1, 0, 0).bytes, 16, 2));
+      CHECK(routes.insert(ipv4(10, 1, 2, 0).bytes, 24, 3));
+      CHECK(routes.insert(ipv4(10, 1, 2, 3).bytes, 32, 4));
+      CHECK(routes.insert(ipv4(192, 168, 0, 0).bytes, 16, 5));
+      CHECK(routes.insert(ipv4(10, 128, 0, 0).bytes, 9, 6));
+      CHECK(!routes.insert(ipv4(1, 2, 3, 4).bytes, 33, 7));
+      CHECK_EQUAL(7U, routes.size());
+
+      size_t length;
+      CHECK_EQUAL(4, *routes.longest_prefix_match(ipv4(10, 1, 2, 3).bytes, length));
+      CHECK_EQUAL(32U, length);
+      CHECK_EQUAL(3, *routes.longest_prefix_match(ipv4(10, 1, 2, 4).bytes, length));
+      CHECK_EQUAL(24U, length);
+      CHECK_EQUAL(2, *routes.longest_prefix_match(ipv4(10, 1, 3, 1).bytes));
+      CHECK_EQUAL(1, *routes.longest_prefix_match(ipv4(10, 2, 0, 1).bytes));
+      CHECK_EQUAL(6, *routes.longest_prefix_match(ipv4(10, 200, 0, 1).bytes));
+      CHECK_EQUAL(5, *routes.longest_prefix_match(ipv4(192, 168, 7, 7).bytes));
+      CHECK_EQUAL(0, *routes.longest_prefix_match(ipv4(8, 8, 8, 8).bytes, length));
+      CHECK_EQUAL(0U, length);
+
+      // Only the bits within the prefix length matter.
+      CHECK_EQUAL(1, *routes.find(ipv4(10, 99, 99, 99).bytes, 8));
+      CHECK(routes.find(ipv4(10, 0, 0, 0).bytes, 12) == nullptr);
+
+      CHECK(routes.erase(ipv4(0, 0, 0, 0).bytes, 0));
+      CHECK(routes.longest_prefix_match(ipv4(8, 8, 8, 8).bytes) == nullptr);
+      CHECK(!routes.erase(ipv4(0, 0, 0, 0).bytes, 0));
+      CHECK(routes.erase(ipv4(10, 1, 2, 0).bytes, 24));
+      CHECK_EQUAL(2, *routes.longest_prefix_match(ipv4(10, 1, 2, 4).bytes));
+      CHECK_EQUAL(4, *routes.longest_prefix_match(ipv4(10, 1, 2, 3).bytes));
+    }
+
+    //*************************************************************************
+    TEST(test_ipv6)
+    {
+      Tree6 routes;
+
+      const uint8_t documentation[16] = { 0x20, 0x01, 0x0D, 0xB8 };
+      const uint8_t host[16]          = { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+      const uint8_t other[16]         = { 0x20, 0x01, 0x0D, 0xB9 };
+
+      CHECK(routes.insert(documentation, 32, std::string("doc")));
+      CHECK(routes.insert(host, 128, std::string("host")));
+
+      CHECK_EQUAL(std::string("host"), *routes.longest_prefix_match(host));
+      CHECK_EQUAL(std::string("doc"), *routes.longest_prefix_match(documentation));
+      CHECK(routes.longest_prefix_match(other) == nullptr);
+
+      routes.clear();
+      CHECK(routes.empty());
+      CHECK_EQUAL(0U, routes.nodes_used());
+    }
+
+    //*************************************************************************
+    TEST(test_bit_random_against_brute_force)
+    {
+      static etl::bit_radix_tree<int, 1000, 32> routes;
+      std::vector<std::pair<uint32_t, size_t> > prefixes;
+      std::vector<int> values;
+      etl::random_xorshift random(7U);
+
+      for (int i = 0; i < 400; ++i)
+      {
+        const size_t   length  = random.range(0U, 32U);
+        const uint32_t address = (random() & 0xF0F0F0F0U) & ((length == 0U) ? 0U : (0xFFFFFFFFU << (32U - length)));
+        const uint8_t  bytes[4] = { uint8_t(address >> 24), uint8_t(address >> 16), uint8_t(address >> 8), uint8_t(address) };
+
+        bool found = false;
+
+        for (size_t j = 0U; j < prefixes.size(); ++j)
+        {
+          if ((prefixes[j].first == address) && (prefixes[j].second == length))
+          {
+            if (random.range(0U, 1U) == 0U)
+            {
+              CHECK(routes.erase(bytes, length));
+              prefixes.erase(prefixes.begin() + j);
+              values.erase(values.begin() + j);
+            }
+            else
+            {
+              CHECK(routes.insert(bytes, length, i));
+              values[j] = i;
+            }
+
+            found = true;
+            break;
+          }
+        }
+
+        if (!found)
+        {
+          CHECK(routes.insert(bytes, length, i));
+          prefixes.push_back(std::make_pair(address, length));
+          values.push_back(i);
+        }
+      }
+
+      CHECK_EQUAL(prefixes.size(), routes.size());
+      CHECK(routes.nodes_used() < (2U * prefixes.size()));
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        const uint32_t address  = random() & 0xF0F0F0F0U;
+        const uint8_t  bytes[4] = { uint8_t(address >> 24), uint8_t(address >> 16), uint8_t(address >> 8), uint8_t(address) };
+
+        int    expected        = -1;
+        size_t expected_length = 0U;
+
+        for (size_t j = 0U; j < prefixes.size(); ++j)
+        {
+          const size_t   length = prefixes[j].second;
+          const uint32_t mask   = (length == 0U) ? 0U : (0xFFFFFFFFU << (32U - length));
+
+          if (((address & mask) == prefixes[j].first) && ((expected == -1) || (length > expected_length)))
+          {
+            expected        = values[j];
+            expected_length = length;
+          }
+        }
+
+        size_t length;
+        const int* actual = routes.longest_prefix_match(bytes, length);
+
+        if (expected == -1)
+        {
+          CHECK(actual == nullptr);
+        }
+        else
+        {
+          CHECK(actual != nullptr);
+
+          if (actual != nullptr)
+          {
+            CHECK_EQUAL(expected, *actual);
+            CHECK_EQUAL(expected_length, length);
+          }
+        }
+      }
+    }
+  }
+}
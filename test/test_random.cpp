@@ -412,5 +412,149 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_random_splitmix64_sequence)
+    {
+      etl::random_splitmix64 r(0U);
+
+      CHECK_EQUAL(0xE220A8397B1DCDAFULL, r());
+      CHECK_EQUAL(0x6E789E6AA1B965F4ULL, r());
+      CHECK_EQUAL(0x06C45D188009454FULL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro256_sequence)
+    {
+      etl::random_xoshiro256 r(12345U);
+
+      CHECK_EQUAL(0xBE6A36374160D49BULL, r());
+      CHECK_EQUAL(0x214AAA0637A688C6ULL, r());
+      CHECK_EQUAL(0xF69D16DE9954D388ULL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro256_jump)
+    {
+      etl::random_xoshiro256 r1(12345U);
+      etl::random_xoshiro256 r2(12345U);
+
+      r2.jump();
+
+      std::vector<uint64_t> out1(1000);
+      std::vector<uint64_t> out2(1000);
+
+      r1.generate(out1.data(), out1.size());
+      r2.generate(out2.data(), out2.size());
+
+      CHECK(out1 != out2);
+    }
+
+    //*************************************************************************
+    TEST(test_random_pcg64_sequence)
+    {
+      etl::random_pcg64 r(12345U);
+
+      CHECK_EQUAL(0xD11B1D37BFF50104ULL, r());
+      CHECK_EQUAL(0x92E63E7AE540560CULL, r());
+      CHECK_EQUAL(0xC8C14150EF8DEFAFULL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_64_generate)
+    {
+      etl::random_pcg64 r1(1U);
+      etl::random_pcg64 r2(1U);
+
+      // 64 bit values are one per output.
+      uint64_t out64[5];
+      r1.generate(out64, 5U);
+
+      for (size_t i = 0; i < 5U; ++i)
+      {
+        CHECK_EQUAL(r2(), out64[i]);
+      }
+
+      // 16 bit values are unpacked from each output, lowest first.
+      uint16_t out16[6];
+      r1.generate(out16, 6U);
+
+      uint64_t value = r2();
+      CHECK_EQUAL(uint16_t(value),       out16[0]);
+      CHECK_EQUAL(uint16_t(value >> 16), out16[1]);
+      CHECK_EQUAL(uint16_t(value >> 32), out16[2]);
+      CHECK_EQUAL(uint16_t(value >> 48), out16[3]);
+
+      value = r2();
+      CHECK_EQUAL(uint16_t(value),       out16[4]);
+      CHECK_EQUAL(uint16_t(value >> 16), out16[5]);
+
+      // The engines are in step again.
+      CHECK_EQUAL(r2(), r1());
+    }
+
+    //*************************************************************************
+    TEST(test_random_64_range)
+    {
+      etl::random_xoshiro256 r(1U);
+
+      uint32_t low  = 1234;
+      uint32_t high = 9876;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+
+      uint64_t low64  = 0x100000000ULL;
+      uint64_t high64 = 0x100000009ULL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t n = r.range64(low64, high64);
+
+        CHECK(n >= low64);
+        CHECK(n <= high64);
+      }
+
+      uint32_t out[1000];
+      r.generate(out, 1000U, low, high);
+
+      for (size_t i = 0; i < 1000U; ++i)
+      {
+        CHECK(out[i] >= low);
+        CHECK(out[i] <= high);
+      }
+
+      // Full range.
+      r.range(0U, 0xFFFFFFFFUL);
+      r.range64(0U, 0xFFFFFFFFFFFFFFFFULL);
+    }
+
+    //*************************************************************************
+    TEST(test_random_range_is_unbiased)
+    {
+      etl::random_splitmix64 r(42U);
+
+      // A range that does not divide 2^32 evenly.
+      size_t counts[3] = { 0, 0, 0 };
+
+      for (int i = 0; i < 300000; ++i)
+      {
+        ++counts[r.range(0U, 2U)];
+      }
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        CHECK(counts[i] > 99000);
+        CHECK(counts[i] < 101000);
+      }
+
+      // A single value range.
+      CHECK_EQUAL(7U, r.range(7U, 7U));
+    }
+
   };
 }
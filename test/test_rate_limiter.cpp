@@ -0,0 +1,205 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/rate_limiter.h"
+#include "etl/callback_timer.h"
+
+#include <stdint.h>
+
+namespace
+{
+  SUITE(test_rate_limiter)
+  {
+    //*************************************************************************
+    TEST(test_token_bucket_burst_then_limit)
+    {
+      // 2 tokens every 10 ticks, bursts of 5.
+      etl::token_bucket bucket(5U, 2U, 10U, 0U);
+
+      CHECK_EQUAL(5U, bucket.capacity());
+      CHECK_EQUAL(5U, bucket.available(0U));
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK(bucket.try_consume(1U));
+      }
+
+      CHECK(!bucket.try_consume(9U));
+      CHECK_EQUAL(0U, bucket.available(9U));
+
+      // One period has elapsed.
+      CHECK_EQUAL(2U, bucket.available(10U));
+      CHECK(bucket.try_consume(10U, 2U));
+      CHECK(!bucket.try_consume(19U));
+
+      // The part period since tick 10 is not lost.
+      CHECK_EQUAL(2U, bucket.available(20U));
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_lazy_refill_is_capped)
+    {
+      etl::token_bucket bucket(5U, 2U, 10U, 0U);
+
+      CHECK(bucket.try_consume(0U, 5U));
+
+      // Idle for a long time.
+      CHECK_EQUAL(5U, bucket.available(1000000U));
+      CHECK(bucket.try_consume(1000000U, 5U));
+      CHECK(!bucket.try_consume(1000000U));
+      CHECK_EQUAL(2U, bucket.available(1000010U));
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_ticks_until)
+    {
+      etl::token_bucket bucket(4U, 1U, 10U, 0U);
+
+      CHECK_EQUAL(0U, bucket.ticks_until(0U, 4U));
+      CHECK(bucket.try_consume(0U, 4U));
+
+      CHECK_EQUAL(10U, bucket.ticks_until(0U));
+      CHECK_EQUAL(7U,  bucket.ticks_until(3U));
+      CHECK_EQUAL(27U, bucket.ticks_until(3U, 3U));
+      CHECK_EQUAL(UINT32_MAX, bucket.ticks_until(3U, 5U));
+
+      CHECK(!bucket.try_consume(29U, 3U));
+      CHECK(bucket.try_consume(30U, 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_tick_wrap)
+    {
+      const uint32_t start = UINT32_MAX - 5U;
+
+      etl::token_bucket bucket(2U, 1U, 10U, start);
+
+      CHECK(bucket.try_consume(start, 2U));
+      CHECK(!bucket.try_consume(start + 9U));
+      CHECK(bucket.try_consume(start + 10U)); // Wrapped to 4
+      CHECK(!bucket.try_consume(start + 10U));
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_reset)
+    {
+      etl::token_bucket bucket(3U, 1U, 100U, 0U);
+
+      CHECK(bucket.try_consume(0U, 3U));
+      bucket.reset(1U);
+      CHECK_EQUAL(3U, bucket.available(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_rate_limiter_bank_buckets_are_independent)
+    {
+      etl::rate_limiter_bank<4> bank(2U, 1U, 10U, 0U);
+
+      CHECK_EQUAL(4U, bank.size());
+      CHECK_EQUAL(2U, bank.capacity());
+
+      CHECK(bank.try_consume(0U, 0U, 2U));
+      CHECK(!bank.try_consume(0U, 0U));
+
+      // The others are untouched.
+      CHECK(bank.try_consume(1U, 0U));
+      CHECK_EQUAL(2U, bank.available(3U, 5U));
+
+      CHECK_EQUAL(10U, bank.ticks_until(0U, 0U));
+      CHECK(bank.try_consume(0U, 10U));
+
+      bank.reset(0U, 11U);
+      CHECK_EQUAL(2U, bank.available(0U, 11U));
+
+      bank.reset_all(12U);
+      CHECK_EQUAL(2U, bank.available(1U, 12U));
+    }
+
+    //*************************************************************************
+    TEST(test_rate_limiter_bank_with_callback_timer_time)
+    {
+      etl::callback_timer<1> timer;
+      timer.enable(true);
+
+      etl::rate_limiter_bank<8> bank(1U, 1U, 100U, timer.time());
+
+      CHECK(bank.try_consume(7U, timer.time()));
+      CHECK(!bank.try_consume(7U, timer.time()));
+
+      timer.tick(60U);
+      CHECK(!bank.try_consume(7U, timer.time()));
+
+      timer.tick(40U);
+      CHECK(bank.try_consume(7U, timer.time()));
+    }
+
+    //*************************************************************************
+    TEST(test_sliding_window_limiter)
+    {
+      // 10 per 100 ticks.
+      etl::sliding_window_limiter limiter(10U, 100U, 0U);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(limiter.try_acquire(uint32_t(i)));
+      }
+
+      CHECK(!limiter.try_acquire(50U));
+      CHECK_EQUAL(10U, limiter.count(50U));
+
+      // Half way through the next window, half of the previous one still counts.
+      CHECK_EQUAL(5U, limiter.count(150U));
+      CHECK(limiter.try_acquire(150U, 5U));
+      CHECK(!limiter.try_acquire(150U));
+
+      // Further on, less of the previous window overlaps.
+      CHECK_EQUAL(7U, limiter.count(180U));
+      CHECK(limiter.try_acquire(180U, 3U));
+      CHECK(!limiter.try_acquire(180U));
+
+      // Two windows on, nothing counts.
+      CHECK_EQUAL(0U, limiter.count(400U));
+      CHECK(limiter.try_acquire(400U, 10U));
+    }
+
+    //*************************************************************************
+    TEST(test_sliding_window_limiter_reset)
+    {
+      etl::sliding_window_limiter limiter(2U, 10U, 0U);
+
+      CHECK(limiter.try_acquire(0U, 2U));
+      CHECK(!limiter.try_acquire(1U));
+
+      limiter.reset(2U);
+      CHECK(limiter.try_acquire(2U, 2U));
+    }
+  }
+}
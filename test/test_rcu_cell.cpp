@@ -0,0 +1,234 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/rcu_cell.h"
+#include "etl/flat_map.h"
+#include "etl/array.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::flat_map<int, int, 8> Routes;
+
+  // Every element of a published table has the same value, so a table that
+  // is read while being rebuilt shows as a mismatch.
+  typedef etl::array<uint32_t, 16> Table;
+
+  const uint32_t UPDATES = 5000U;
+
+  etl::rcu_cell<Table, 3> shared;
+  std::atomic<bool>       done;
+  std::atomic<int>        mismatches;
+  std::atomic<int>        regressions;
+
+  //*************************************************************************
+  void writer()
+  {
+    for (uint32_t i = 1U; i <= UPDATES; ++i)
+    {
+      Table& table = shared.begin_update();
+      table.fill(i);
+      shared.publish();
+    }
+
+    done = true;
+  }
+
+  //*************************************************************************
+  void reader()
+  {
+    uint32_t last = 0U;
+
+    while (!done)
+    {
+      etl::rcu_cell<Table, 3>::read_guard guard(shared);
+
+      const uint32_t first = guard->front();
+
+      for (size_t i = 1U; i < guard->size(); ++i)
+      {
+        if ((*guard)[i] != first)
+        {
+          ++mismatches;
+        }
+      }
+
+      if (first < last)
+      {
+        ++regressions;
+      }
+
+      last = first;
+    }
+  }
+
+  //*************************************************************************
+  struct AddRoute
+  {
+    AddRoute(int key_, int value_)
+      : key(key_)
+      , value(value_)
+    {
+    }
+
+    void operator()(Routes& routes) const
+    {
+      routes[key] = value;
+    }
+
+    int key;
+    int value;
+  };
+
+  //*************************************************************************
+  struct SumRoutes
+  {
+    SumRoutes(int& sum_)
+      : sum(sum_)
+    {
+    }
+
+    void operator()(const Routes& routes) const
+    {
+      sum = 0;
+
+      for (Routes::const_iterator itr = routes.begin(); itr != routes.end(); ++itr)
+      {
+        sum += itr->second;
+      }
+    }
+
+    int& sum;
+  };
+
+  SUITE(test_rcu_cell)
+  {
+    //*************************************************************************
+    TEST(test_publish)
+    {
+      Routes initial;
+      initial[1] = 10;
+
+      etl::rcu_cell<Routes> cell(initial);
+
+      CHECK_EQUAL(0U, cell.version());
+      CHECK_EQUAL(1U, cell.published_value().size());
+
+      // Rebuilt from the published value.
+      cell.update(AddRoute(2, 20), true);
+
+      CHECK_EQUAL(1U, cell.version());
+
+      {
+        etl::rcu_cell<Routes>::read_guard guard(cell);
+        CHECK_EQUAL(2U, guard->size());
+        CHECK_EQUAL(10, guard->at(1));
+        CHECK_EQUAL(20, guard->at(2));
+        CHECK_EQUAL(1U, cell.reader_count());
+      }
+
+      CHECK_EQUAL(0U, cell.reader_count());
+
+      // Rebuilt from the stale copy, which holds the initial value.
+      cell.update(AddRoute(3, 30));
+
+      int sum = 0;
+      cell.read(SumRoutes(sum));
+      CHECK_EQUAL(40, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_reader_holds_old_copy)
+    {
+      etl::rcu_cell<Routes, 2> cell;
+
+      etl::rcu_cell<Routes, 2>::read_guard old_guard(cell);
+
+      // The unpublished copy is free.
+      Routes* p = cell.try_begin_update();
+      CHECK(p != nullptr);
+      (*p)[1] = 1;
+      cell.publish();
+
+      // The reader still sees the copy it holds.
+      CHECK(old_guard->empty());
+
+      // The only unpublished copy is held by the reader.
+      CHECK(cell.try_begin_update() == nullptr);
+
+      {
+        etl::rcu_cell<Routes, 2>::read_guard new_guard(cell);
+        CHECK_EQUAL(1U, new_guard->size());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_reader_released_copy_is_reused)
+    {
+      etl::rcu_cell<Routes, 2> cell;
+
+      {
+        etl::rcu_cell<Routes, 2>::read_guard guard(cell);
+        cell.update(AddRoute(1, 1));
+      }
+
+      CHECK(cell.try_begin_update() != nullptr);
+      cell.cancel_update();
+      CHECK_EQUAL(1U, cell.version());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      done        = false;
+      mismatches  = 0;
+      regressions = 0;
+
+      std::thread r1(reader);
+      std::thread r2(reader);
+      std::thread w(writer);
+
+      w.join();
+      r1.join();
+      r2.join();
+
+      CHECK_EQUAL(0, mismatches.load());
+      CHECK_EQUAL(0, regressions.load());
+      CHECK_EQUAL(UPDATES, shared.published_value().front());
+      CHECK_EQUAL(0U, shared.reader_count());
+    }
+  };
+}
+
+#endif
@@ -531,6 +531,53 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.begin() + 5);
+      compare_data.insert(initial_data.begin(), initial_data.begin() + 5);
+
+      // Overlaps the existing elements, which are not added again.
+      data.insert_sorted(initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_sorted(excess_data.begin(), excess_data.end()), etl::flat_map_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data1(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data2(initial_data.begin() + 3, initial_data.end());
+
+      data1.merge(data2);
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data1.size());
+      CHECK_EQUAL(size_t(7), data2.size());
+
+      bool isEqual = Check_Equal(data1.begin(), data1.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -0,0 +1,148 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/reservoir_sampler.h"
+#include "etl/random.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace
+{
+  SUITE(test_reservoir_sampler)
+  {
+    //*************************************************************************
+    TEST(test_fills_before_replacing)
+    {
+      etl::reservoir_sampler<int, 4> sampler(1U);
+
+      CHECK(sampler.empty());
+      CHECK_EQUAL(4U, sampler.capacity());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(sampler.add(i));
+      }
+
+      CHECK_EQUAL(4U, sampler.size());
+      CHECK_EQUAL(4U, sampler.seen());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(i, sampler[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_size_is_fixed)
+    {
+      etl::reservoir_sampler<int, 8> sampler(2U);
+
+      size_t kept = 0U;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        kept += sampler.add(i) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(8U, sampler.size());
+      CHECK_EQUAL(10000U, sampler.seen());
+
+      // Expected number kept is SIZE * (1 + ln(N / SIZE)), about 65.
+      CHECK(kept > 30U);
+      CHECK(kept < 130U);
+
+      for (etl::reservoir_sampler<int, 8>::const_iterator itr = sampler.begin(); itr != sampler.end(); ++itr)
+      {
+        CHECK((*itr >= 0) && (*itr < 10000));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_uniform)
+    {
+      const int N      = 100;
+      const int TRIALS = 20000;
+
+      std::vector<int> hits(N, 0);
+
+      etl::reservoir_sampler<int, 10, etl::random_mwc> sampler(3U);
+
+      for (int t = 0; t < TRIALS; ++t)
+      {
+        sampler.clear();
+
+        for (int i = 0; i < N; ++i)
+        {
+          sampler.add(i);
+        }
+
+        for (size_t i = 0U; i < sampler.size(); ++i)
+        {
+          ++hits[sampler[i]];
+        }
+      }
+
+      // Each value should be in the sample TRIALS * 10 / N = 2000 times.
+      int first_half  = 0;
+      int second_half = 0;
+
+      for (int i = 0; i < N; ++i)
+      {
+        CHECK(hits[i] > 1700);
+        CHECK(hits[i] < 2300);
+
+        ((i < (N / 2)) ? first_half : second_half) += hits[i];
+      }
+
+      CHECK_CLOSE(1.0, double(first_half) / double(second_half), 0.03);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::reservoir_sampler<int, 4> sampler(4U);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sampler.add(i);
+      }
+
+      sampler.clear();
+
+      CHECK(sampler.empty());
+      CHECK_EQUAL(0U, sampler.seen());
+
+      sampler.add(7);
+      CHECK_EQUAL(7, sampler[0]);
+    }
+  }
+}
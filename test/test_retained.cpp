@@ -0,0 +1,233 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/retained.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/crc16_ccitt.h"
+
+#include <string.h>
+
+namespace
+{
+  typedef etl::unordered_map<int, int, 8> Map;
+  typedef etl::retained<Map>              RetainedMap;
+
+  //***************************************************************************
+  /// Memory that is not cleared by a reset.
+  //***************************************************************************
+  template <typename TRetained>
+  struct RetainedMemory
+  {
+    RetainedMemory()
+    {
+      // Power on contents.
+      memset(&memory, 0xA5, sizeof(memory));
+    }
+
+    /// Gets the retained object, as after a reset.
+    TRetained& reset()
+    {
+      return *reinterpret_cast<TRetained*>(&memory);
+    }
+
+    typename etl::aligned_storage<sizeof(TRetained), etl::alignment_of<TRetained>::value>::type memory;
+  };
+
+  SUITE(test_retained)
+  {
+    //*************************************************************************
+    TEST(test_trivial)
+    {
+      CHECK(etl::is_trivially_constructible<RetainedMap>::value);
+      CHECK(etl::is_trivially_destructible<RetainedMap>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_survives_reset)
+    {
+      RetainedMemory<RetainedMap> ram;
+
+      // Power on. Nothing to adopt.
+      RetainedMap& before = ram.reset();
+      CHECK(!before.is_valid());
+      CHECK(!before.validate_and_adopt());
+      CHECK(before->empty());
+      CHECK(before.is_valid());
+
+      before->insert(Map::value_type(1, 10));
+      before->insert(Map::value_type(2, 20));
+      before.seal();
+
+      // Warm reset.
+      RetainedMap& after = ram.reset();
+      CHECK(after.validate_and_adopt());
+      CHECK_EQUAL(2U, after->size());
+      CHECK_EQUAL(10, (*after)[1]);
+      CHECK_EQUAL(20, (*after)[2]);
+
+      // The adopted map is fully usable.
+      after->insert(Map::value_type(3, 30));
+      after->erase(1);
+      after.seal();
+
+      RetainedMap& again = ram.reset();
+      CHECK(again.validate_and_adopt());
+      CHECK_EQUAL(2U, again->size());
+      CHECK(again->find(1) == again->end());
+      CHECK_EQUAL(30, (*again)[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_change_without_seal_is_rebuilt)
+    {
+      RetainedMemory<RetainedMap> ram;
+
+      RetainedMap& before = ram.reset();
+      before.validate_and_adopt();
+      before->insert(Map::value_type(1, 10));
+      before.seal();
+
+      // Reset part way through a change.
+      before->insert(Map::value_type(2, 20));
+
+      RetainedMap& after = ram.reset();
+      CHECK(!after.validate_and_adopt());
+      CHECK(after->empty());
+    }
+
+    //*************************************************************************
+    TEST(test_corruption_is_rebuilt)
+    {
+      RetainedMemory<RetainedMap> ram;
+
+      RetainedMap& before = ram.reset();
+      before.validate_and_adopt();
+      before->insert(Map::value_type(1, 10));
+      before.seal();
+
+      reinterpret_cast<char*>(&ram.memory)[sizeof(RetainedMap) - 1U] ^= 0x01;
+
+      RetainedMap& after = ram.reset();
+      CHECK(!after.validate_and_adopt());
+      CHECK(after->empty());
+    }
+
+    //*************************************************************************
+    TEST(test_type_id_and_unseal)
+    {
+      RetainedMemory<RetainedMap> ram;
+
+      RetainedMap& before = ram.reset();
+      before.validate_and_adopt(1U);
+      before->insert(Map::value_type(1, 10));
+      before.seal();
+
+      CHECK(before.is_valid(1U));
+      CHECK(!before.is_valid(2U));
+
+      before.unseal();
+      CHECK(!before.is_valid(1U));
+      before.seal();
+
+      // A different build does not adopt the state.
+      RetainedMap& after = ram.reset();
+      CHECK(!after.validate_and_adopt(2U));
+      CHECK(after->empty());
+      after.destroy();
+      CHECK(!after.is_valid(2U));
+    }
+
+    //*************************************************************************
+    TEST(test_moved_state_is_not_adopted)
+    {
+      RetainedMemory<RetainedMap> ram1;
+      RetainedMemory<RetainedMap> ram2;
+
+      RetainedMap& before = ram1.reset();
+      before.validate_and_adopt();
+      before->insert(Map::value_type(1, 10));
+      before.seal();
+
+      memcpy(&ram2.memory, &ram1.memory, sizeof(RetainedMap));
+
+      // The map's pointers refer to the old address.
+      CHECK(!ram2.reset().is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_other_containers)
+    {
+      typedef etl::retained<etl::vector<int, 4>, etl::crc16_ccitt> RetainedVector;
+      typedef etl::retained<etl::deque<int, 4> >                   RetainedDeque;
+      typedef etl::retained<etl::flat_map<int, int, 4> >           RetainedFlatMap;
+
+      RetainedMemory<RetainedVector>  vector_ram;
+      RetainedMemory<RetainedDeque>   deque_ram;
+      RetainedMemory<RetainedFlatMap> flat_map_ram;
+
+      RetainedVector&  v = vector_ram.reset();
+      RetainedDeque&   d = deque_ram.reset();
+      RetainedFlatMap& f = flat_map_ram.reset();
+
+      CHECK(!v.validate_and_adopt());
+      CHECK(!d.validate_and_adopt());
+      CHECK(!f.validate_and_adopt());
+
+      v->push_back(1);
+      v->push_back(2);
+      d->push_back(3);
+      d->push_front(2);
+      (*f)[5] = 50;
+      (*f)[4] = 40;
+
+      v.seal();
+      d.seal();
+      f.seal();
+
+      RetainedVector&  v2 = vector_ram.reset();
+      RetainedDeque&   d2 = deque_ram.reset();
+      RetainedFlatMap& f2 = flat_map_ram.reset();
+
+      CHECK(v2.validate_and_adopt());
+      CHECK(d2.validate_and_adopt());
+      CHECK(f2.validate_and_adopt());
+
+      CHECK_EQUAL(2U, v2->size());
+      CHECK_EQUAL(2, v2->back());
+      CHECK_EQUAL(2, d2->front());
+      CHECK_EQUAL(3, d2->back());
+      CHECK_EQUAL(4, f2->begin()->first);
+      CHECK_EQUAL(50, (*f2)[5]);
+    }
+  };
+}
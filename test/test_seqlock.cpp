@@ -0,0 +1,131 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/mutex.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // The fields are always written with the same value, so a torn read shows as a mismatch.
+  struct Data
+  {
+    uint32_t first;
+    uint16_t second;
+    uint64_t third;
+  };
+
+  const uint32_t WRITES = 20000U;
+
+  etl::seqlock<Data> data;
+  std::atomic<bool>  done;
+  std::atomic<int>   mismatches;
+
+  void writer()
+  {
+    for (uint32_t i = 1U; i <= WRITES; ++i)
+    {
+      Data d = { i, uint16_t(i), i };
+      data.write(d);
+    }
+
+    done = true;
+  }
+
+  void reader()
+  {
+    while (!done)
+    {
+      const Data d = data.read();
+
+      if ((d.first != d.third) || (uint16_t(d.first) != d.second))
+      {
+        ++mismatches;
+      }
+    }
+  }
+
+  SUITE(test_seqlock)
+  {
+    //*************************************************************************
+    TEST(test_read_write)
+    {
+      etl::seqlock<Data> lock;
+
+      Data d = lock.read();
+      CHECK_EQUAL(0U, d.first);
+      CHECK_EQUAL(0U, d.second);
+      CHECK_EQUAL(0U, d.third);
+      CHECK_EQUAL(0U, lock.sequence_number());
+
+      Data w = { 1U, 2U, 3U };
+      lock.write(w);
+      CHECK_EQUAL(2U, lock.sequence_number());
+
+      CHECK(lock.try_read(d));
+      CHECK_EQUAL(1U, d.first);
+      CHECK_EQUAL(2U, d.second);
+      CHECK_EQUAL(3U, d.third);
+    }
+
+    //*************************************************************************
+    TEST(test_initial_value)
+    {
+      etl::seqlock<int> lock(42);
+
+      CHECK_EQUAL(42, lock.read());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      done       = false;
+      mismatches = 0;
+
+      std::thread t1(reader);
+      std::thread t2(reader);
+      std::thread t3(writer);
+
+      t1.join();
+      t2.join();
+      t3.join();
+
+      CHECK_EQUAL(WRITES, data.read().first);
+      CHECK_EQUAL(0, mismatches.load());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,147 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/seqlocked.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Config
+  {
+    uint32_t id;
+    uint32_t check; // Always ~id.
+    uint16_t rate;
+  };
+
+  const uint32_t UPDATES = 10000U;
+
+  etl::seqlocked<Config> shared_config;
+  std::atomic<bool>      done;
+  std::atomic<int>       mismatches;
+
+  void writer()
+  {
+    for (uint32_t i = 1U; i <= UPDATES; ++i)
+    {
+      Config c = { i, ~i, uint16_t(i) };
+      shared_config.store(c);
+    }
+  }
+
+  struct increment_id
+  {
+    void operator()(Config& c) const
+    {
+      ++c.id;
+      c.check = ~c.id;
+    }
+  };
+
+  void modifier()
+  {
+    for (uint32_t i = 0U; i < UPDATES; ++i)
+    {
+      shared_config.modify(increment_id());
+    }
+  }
+
+  void reader()
+  {
+    while (!done)
+    {
+      const Config c = shared_config.load();
+
+      if (c.check != ~c.id)
+      {
+        ++mismatches;
+      }
+    }
+  }
+
+  SUITE(test_seqlocked)
+  {
+    //*************************************************************************
+    TEST(test_store_load)
+    {
+      const Config initial = { 1U, ~1U, 10U };
+
+      etl::seqlocked<Config> config(initial);
+
+      CHECK_EQUAL(0U, config.version());
+      CHECK_EQUAL(1U, config.load().id);
+
+      Config c = { 2U, ~2U, 20U };
+      config.store(c);
+      CHECK_EQUAL(1U, config.version());
+
+      Config result;
+      CHECK(config.try_load(result));
+      CHECK_EQUAL(2U,  result.id);
+      CHECK_EQUAL(20U, result.rate);
+
+      config.modify(increment_id());
+      CHECK_EQUAL(2U, config.version());
+      CHECK_EQUAL(3U, config.load().id);
+      CHECK_EQUAL(20U, config.load().rate);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      const Config initial = { 0U, ~0U, 0U };
+      shared_config.store(initial);
+
+      done       = false;
+      mismatches = 0;
+
+      std::thread r1(reader);
+      std::thread r2(reader);
+      std::thread w1(writer);
+      std::thread w2(modifier);
+
+      w1.join();
+      w2.join();
+      done = true;
+      r1.join();
+      r2.join();
+
+      CHECK_EQUAL(0, mismatches.load());
+      CHECK_EQUAL(UPDATES * 2U, shared_config.version() - 1U);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,346 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/serialize.h"
+#include "etl/cstring.h"
+#include "etl/vector.h"
+#include "etl/map.h"
+#include "etl/variant.h"
+
+#include <stdint.h>
+
+namespace
+{
+  //***************************************************************************
+  // A user type, serialised through its own overloads.
+  //***************************************************************************
+  struct Point
+  {
+    Point()
+      : x(0)
+      , y(0)
+    {
+    }
+
+    Point(int16_t x_, int16_t y_)
+      : x(x_)
+      , y(y_)
+    {
+    }
+
+    int16_t x;
+    int16_t y;
+  };
+
+  template <typename TStream>
+  bool serialize(TStream& stream, const Point& point)
+  {
+    return etl::serialize(stream, point.x) && etl::serialize(stream, point.y);
+  }
+
+  template <typename TStream>
+  bool deserialize(TStream& stream, Point& point)
+  {
+    return etl::deserialize(stream, point.x) && etl::deserialize(stream, point.y);
+  }
+
+  typedef etl::variant<int32_t, etl::string<8>, double> Variant;
+
+  SUITE(test_serialize)
+  {
+    //*************************************************************************
+    TEST(test_varint_encoding)
+    {
+      uint8_t buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+
+      CHECK(etl::serialize_varint(writer, 1U));
+      CHECK(etl::serialize_varint(writer, 300U));
+      CHECK_EQUAL(3U, writer.size_bytes());
+      CHECK_EQUAL(0x01U, buffer[0]);
+      CHECK_EQUAL(0xACU, buffer[1]);
+      CHECK_EQUAL(0x02U, buffer[2]);
+
+      CHECK(etl::serialize_varint(writer, 0xFFFFFFFFFFFFFFFFULL));
+      CHECK_EQUAL(13U, writer.size_bytes());
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      uint64_t value;
+
+      CHECK(etl::deserialize_varint(reader, value));
+      CHECK_EQUAL(1U, value);
+      CHECK(etl::deserialize_varint(reader, value));
+      CHECK_EQUAL(300U, value);
+      CHECK(etl::deserialize_varint(reader, value));
+      CHECK(value == 0xFFFFFFFFFFFFFFFFULL);
+      CHECK(!etl::deserialize_varint(reader, value));
+    }
+
+    //*************************************************************************
+    TEST(test_varint_too_long)
+    {
+      const uint8_t buffer[11] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+      etl::byte_stream_reader reader(buffer, sizeof(buffer));
+      uint64_t value;
+
+      CHECK(!etl::deserialize_varint(reader, value));
+    }
+
+    //*************************************************************************
+    TEST(test_scalars_are_fixed_endian)
+    {
+      uint8_t buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      CHECK(etl::serialize(writer, uint16_t(0x1234U)));
+      CHECK(etl::serialize(writer, true));
+      CHECK_EQUAL(0x12U, buffer[0]);
+      CHECK_EQUAL(0x34U, buffer[1]);
+      CHECK_EQUAL(0x01U, buffer[2]);
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::big);
+      uint16_t u;
+      bool     b;
+      CHECK(etl::deserialize(reader, u));
+      CHECK(etl::deserialize(reader, b));
+      CHECK_EQUAL(0x1234U, u);
+      CHECK(b);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_of_arithmetic)
+    {
+      etl::vector<uint32_t, 8> source;
+      source.push_back(1U);
+      source.push_back(0x01020304U);
+      source.push_back(0xFFFFFFFFU);
+
+      uint8_t buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::little);
+      CHECK(etl::serialize(writer, source));
+      CHECK_EQUAL(1U + (3U * 4U), writer.size_bytes());
+
+      etl::vector<uint32_t, 8> destination;
+      destination.push_back(99U);
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::little);
+      CHECK(etl::deserialize(reader, destination));
+      CHECK(source == destination);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_too_small)
+    {
+      etl::vector<uint8_t, 4> source(size_t(4U), uint8_t(7U));
+
+      uint8_t buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(etl::serialize(writer, source));
+
+      etl::vector<uint8_t, 3> destination;
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      CHECK(!etl::deserialize(reader, destination));
+    }
+
+    //*************************************************************************
+    TEST(test_vector_of_strings_and_user_types)
+    {
+      etl::vector<etl::string<8>, 4> names;
+      names.push_back("alpha");
+      names.push_back("");
+      names.push_back("omega");
+
+      etl::vector<Point, 4> points;
+      points.push_back(Point(1, -2));
+      points.push_back(Point(-300, 400));
+
+      uint8_t buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(etl::serialize(writer, names));
+      CHECK(etl::serialize(writer, points));
+
+      etl::vector<etl::string<8>, 4> names2;
+      etl::vector<Point, 4> points2;
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      CHECK(etl::deserialize(reader, names2));
+      CHECK(etl::deserialize(reader, points2));
+
+      CHECK(names == names2);
+      CHECK_EQUAL(2U, points2.size());
+      CHECK_EQUAL(-300, points2[1].x);
+      CHECK_EQUAL(400,  points2[1].y);
+    }
+
+    //*************************************************************************
+    TEST(test_string_too_long)
+    {
+      etl::string<8> source("abcdefgh");
+
+      uint8_t buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(etl::serialize(writer, source));
+
+      etl::string<4> destination;
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      CHECK(!etl::deserialize(reader, destination));
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_zero_copy)
+    {
+      uint8_t buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(etl::serialize(writer, etl::string_view("hello")));
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      etl::string_view view;
+      CHECK(etl::deserialize(reader, view));
+      CHECK(view == etl::string_view("hello"));
+      CHECK(reinterpret_cast<const uint8_t*>(view.data()) == buffer + 1);
+
+      // A length longer than the buffer.
+      etl::byte_stream_reader truncated(buffer, 4U);
+      CHECK(!etl::deserialize(truncated, view));
+    }
+
+    //*************************************************************************
+    TEST(test_map)
+    {
+      etl::map<int32_t, etl::vector<int16_t, 4>, 4> source;
+      source[3].push_back(30);
+      source[1].push_back(10);
+      source[1].push_back(11);
+      source[2];
+
+      uint8_t buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(etl::serialize(writer, source));
+
+      etl::map<int32_t, etl::vector<int16_t, 4>, 4> destination;
+      destination[9].push_back(90);
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+      CHECK(etl::deserialize(reader, destination));
+
+      CHECK_EQUAL(3U, destination.size());
+      CHECK(destination.find(9) == destination.end());
+      CHECK_EQUAL(2U, destination[1].size());
+      CHECK_EQUAL(11, destination[1][1]);
+      CHECK(destination[2].empty());
+      CHECK_EQUAL(30, destination[3][0]);
+    }
+
+    //*************************************************************************
+    TEST(test_variant)
+    {
+      Variant values[4];
+      values[0] = int32_t(-5);
+      values[1] = etl::string<8>("text");
+      values[2] = 2.5;
+
+      uint8_t buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(etl::serialize(writer, values[i]));
+      }
+
+      Variant results[4];
+      results[3] = int32_t(1);
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(etl::deserialize(reader, results[i]));
+      }
+
+      CHECK_EQUAL(-5, results[0].get<int32_t>());
+      CHECK(results[1].get<etl::string<8> >() == etl::string<8>("text"));
+      CHECK_EQUAL(2.5, results[2].get<double>());
+      CHECK(!results[3].is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_variant_bad_index)
+    {
+      const uint8_t buffer[] = { 5U, 0U, 0U, 0U, 0U };
+      etl::byte_stream_reader reader(buffer, sizeof(buffer));
+
+      Variant result;
+      CHECK(!etl::deserialize(reader, result));
+    }
+
+    //*************************************************************************
+    TEST(test_bit_stream)
+    {
+      etl::vector<int16_t, 4> numbers;
+      numbers.push_back(-1);
+      numbers.push_back(1000);
+
+      etl::vector<float, 2> floats;
+      floats.push_back(1.5f);
+
+      unsigned char storage[64];
+      etl::bit_stream stream(storage, sizeof(storage));
+
+      CHECK(etl::serialize(stream, true));
+      CHECK(etl::serialize(stream, numbers));
+      CHECK(etl::serialize(stream, floats));
+      CHECK(etl::serialize(stream, etl::string<8>("bits")));
+
+      stream.restart();
+
+      bool flag = false;
+      etl::vector<int16_t, 4> numbers2;
+      etl::vector<float, 2> floats2;
+      etl::string<8> text;
+
+      CHECK(etl::deserialize(stream, flag));
+      CHECK(etl::deserialize(stream, numbers2));
+      CHECK(etl::deserialize(stream, floats2));
+      CHECK(etl::deserialize(stream, text));
+
+      CHECK(flag);
+      CHECK(numbers == numbers2);
+      CHECK(floats == floats2);
+      CHECK(text == etl::string<8>("bits"));
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_room)
+    {
+      etl::vector<uint32_t, 4> source(size_t(4U), uint32_t(1U));
+
+      uint8_t buffer[8];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+      CHECK(!etl::serialize(writer, source));
+    }
+  };
+}
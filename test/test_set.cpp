@@ -1163,5 +1163,167 @@ namespace
             }
         }
     }
+
+#if defined(ETL_SET_ORDER_STATISTICS)
+    //*************************************************************************
+    TEST(test_rank_and_select)
+    {
+      typedef etl::set<int, 200> OS_Data;
+      typedef std::set<int>      OS_Compare_Data;
+
+      OS_Data data;
+      OS_Compare_Data compare_data;
+      unsigned state = 1U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        state = (state * 1103515245U) + 12345U;
+        int key = int((state >> 8) % 400U);
+
+        if (((state >> 4) % 3U) != 0U)
+        {
+          if (!data.full())
+          {
+            data.insert(key);
+            compare_data.insert(key);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+        }
+
+        for (int k = key - 2; k <= key + 2; ++k)
+        {
+          CHECK_EQUAL(size_t(std::distance(compare_data.begin(), compare_data.lower_bound(k))), data.rank(k));
+        }
+      }
+
+      OS_Compare_Data::const_iterator i_compare = compare_data.begin();
+
+      for (size_t k = 0U; k < data.size(); ++k)
+      {
+        CHECK_EQUAL(*i_compare, *data.select(k));
+        ++i_compare;
+      }
+
+      CHECK(data.select(data.size()) == data.end());
+
+      const OS_Data& cdata = data;
+      CHECK(cdata.select(0U) == cdata.begin());
+      CHECK_EQUAL(0U, cdata.rank(-1));
+      CHECK_EQUAL(data.size(), cdata.rank(400));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::set<std::string, 4> Data;
+
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.emplace(3U, 'b');
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("bbb"), *result.first);
+
+      // Duplicate.
+      result = data.emplace("bbb");
+      CHECK(!result.second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.emplace_hint(data.begin(), 2U, 'a');
+      CHECK_EQUAL(std::string("aa"), *itr);
+      CHECK(itr == data.begin());
+
+      data.emplace("c");
+      data.emplace("d");
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_extract_and_insert_node_shared_pool)
+    {
+      typedef etl::set<std::string, 0> Data;
+
+      etl::pool<Data::pool_type, 4> pool;
+
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.insert("a");
+      data1.insert("b");
+      data1.insert("c");
+
+      Data::node_type handle = data1.extract("b");
+
+      CHECK(!handle.empty());
+      CHECK_EQUAL(std::string("b"), handle.value());
+      CHECK_EQUAL(2U, data1.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      const std::string* p_value = &handle.value();
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(etl::move(handle));
+
+      CHECK(result.second);
+      CHECK(handle.empty());
+      CHECK(&*result.first == p_value);
+      CHECK_EQUAL(1U, data2.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      // The value may be changed while it is out of a set.
+      handle = data1.extract(data1.begin());
+      handle.value() = "d";
+      data2.insert(etl::move(handle));
+
+      CHECK_EQUAL(std::string("c"), *data1.begin());
+      CHECK_EQUAL(std::string("d"), *data2.rbegin());
+      CHECK_EQUAL(3U, pool.size());
+
+      Data moved(etl::move(data2));
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, moved.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      moved.clear();
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_set_ext)
+    {
+      typedef etl::set_ext<std::string> Data;
+
+      static const size_t MAX = 4U;
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX) <= sizeof(buffer));
+
+      Data data(&buffer, MAX);
+      etl::iset<std::string>& idata = data;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+
+      idata.insert("C");
+      idata.insert("A");
+      idata.insert("B");
+      idata.insert("D");
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert("E"), etl::set_full);
+
+      const char* p = reinterpret_cast<const char*>(&*idata.find("B"));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX));
+
+      idata.erase("A");
+      idata.insert("E");
+      CHECK_EQUAL(std::string("B"), *idata.begin());
+
+      etl::aligned_storage<MAX * 128U, Data::ALIGNMENT>::type buffer2;
+      Data data2(&buffer2, MAX);
+      data2 = data;
+      CHECK(data2 == data);
+    }
   };
 }
@@ -0,0 +1,136 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "etl/mutex.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  const int READERS = 3;
+  const int WRITES  = 5000;
+
+  etl::shared_mutex lock;
+  int               a;
+  int               b;
+  std::atomic<bool> done;
+  std::atomic<int>  mismatches;
+
+  // Keeps a == b.
+  void writer()
+  {
+    for (int i = 0; i < WRITES; ++i)
+    {
+      lock.lock();
+      ++a;
+      ++b;
+      lock.unlock();
+    }
+
+    done = true;
+  }
+
+  void reader()
+  {
+    while (!done)
+    {
+      lock.lock_shared();
+
+      if (a != b)
+      {
+        ++mismatches;
+      }
+
+      lock.unlock_shared();
+    }
+  }
+
+  SUITE(test_shared_mutex)
+  {
+    //*************************************************************************
+    TEST(test_try_lock)
+    {
+      etl::shared_mutex mutex;
+
+      // Shared with readers.
+      CHECK(mutex.try_lock_shared());
+      CHECK(mutex.try_lock_shared());
+      CHECK(!mutex.try_lock());
+      mutex.unlock_shared();
+      CHECK(!mutex.try_lock());
+      mutex.unlock_shared();
+
+      // Exclusive to a writer.
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      CHECK(!mutex.try_lock_shared());
+      mutex.unlock();
+
+      CHECK(mutex.try_lock_shared());
+      mutex.unlock_shared();
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      a          = 0;
+      b          = 0;
+      done       = false;
+      mismatches = 0;
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < READERS; ++i)
+      {
+        threads.push_back(std::thread(reader));
+      }
+
+      // The writer is not starved by the readers.
+      threads.push_back(std::thread(writer));
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(WRITES, a);
+      CHECK_EQUAL(WRITES, b);
+      CHECK_EQUAL(0, mismatches.load());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,135 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/slip.h"
+#include "etl/crc16_x25.h"
+
+#include <stdint.h>
+#include <vector>
+#include <iterator>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  template <typename TEncoder>
+  Bytes encode(const Bytes& data)
+  {
+    TEncoder encoder;
+    Bytes    result;
+
+    encoder.encode(data.data(), data.data() + data.size(), std::back_inserter(result));
+
+    CHECK(result.size() <= TEncoder::max_encoded_size(data.size()));
+
+    return result;
+  }
+
+  SUITE(test_slip)
+  {
+    //*************************************************************************
+    TEST(test_encode)
+    {
+      CHECK((Bytes{ 0xC0, 0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0x03, 0xC0 }) == encode<etl::slip_encoder<> >(Bytes{ 0x01, 0xC0, 0x02, 0xDB, 0x03 }));
+      CHECK((Bytes{ 0xC0, 0xC0 }) == encode<etl::slip_encoder<> >(Bytes()));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_with_fcs)
+    {
+      // The CRC16 X25 of "123456789" is 0x906E.
+      const Bytes data = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+      Bytes expected = { 0xC0, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x6E, 0x90, 0xC0 };
+
+      CHECK(expected == encode<etl::slip_encoder<etl::crc16_x25> >(data));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_in_chunks)
+    {
+      Bytes data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data.push_back(uint8_t(i * 31));
+      }
+
+      Bytes encoded = encode<etl::slip_encoder<etl::crc16_x25> >(data);
+
+      uint8_t buffer[512];
+      etl::slip_decoder<etl::crc16_x25> decoder(buffer, sizeof(buffer));
+
+      const uint8_t* p   = encoded.data();
+      const uint8_t* end = encoded.data() + encoded.size();
+
+      while (p != end)
+      {
+        const uint8_t* chunk_end = (end - p > 7) ? p + 7 : end;
+        p = decoder.decode(p, chunk_end);
+      }
+
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK_EQUAL(data.size(), decoder.size());
+      CHECK_ARRAY_EQUAL(data.data(), decoder.data(), data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_decode_errors)
+    {
+      uint8_t buffer[8];
+      etl::slip_decoder<etl::crc16_x25> decoder(buffer, sizeof(buffer));
+
+      // Corrupt data.
+      Bytes encoded = encode<etl::slip_encoder<etl::crc16_x25> >(Bytes{ 0x10, 0x20, 0x30 });
+      encoded[1] ^= 0x01;
+      decoder.decode(encoded.data(), encoded.data() + encoded.size());
+      CHECK_EQUAL(etl::framing_status::FCS_ERROR, decoder.status());
+
+      // Invalid escape.
+      const uint8_t bad_escape[] = { 0xC0, 0x01, 0xDB, 0x02, 0x03, 0x04, 0xC0 };
+      decoder.decode(bad_escape, bad_escape + sizeof(bad_escape));
+      CHECK_EQUAL(etl::framing_status::FORMAT_ERROR, decoder.status());
+
+      // Too large for the buffer.
+      Bytes large = encode<etl::slip_encoder<etl::crc16_x25> >(Bytes(20U, uint8_t(0xC0U)));
+      decoder.decode(large.data(), large.data() + large.size());
+      CHECK_EQUAL(etl::framing_status::BUFFER_FULL, decoder.status());
+
+      // Recovers for the next frame.
+      Bytes good = encode<etl::slip_encoder<etl::crc16_x25> >(Bytes{ 0xC0, 0xDB });
+      decoder.decode(good.data(), good.data() + good.size());
+      CHECK_EQUAL(etl::framing_status::COMPLETE, decoder.status());
+      CHECK((Bytes{ 0xC0, 0xDB }) == Bytes(decoder.data(), decoder.data() + decoder.size()));
+    }
+  }
+}
@@ -0,0 +1,265 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/slot_map.h"
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::slot_map<std::string, 4> Data;
+
+  SUITE(test_slot_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(4U, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(!data.contains(Data::handle_type()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_lookup)
+    {
+      Data data;
+
+      Data::handle_type a = data.insert("a");
+      Data::handle_type b = data.insert(std::string("b"));
+      Data::handle_type c = data.emplace(2U, 'c');
+
+      CHECK(a != b);
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.contains(a));
+      CHECK_EQUAL(std::string("a"),  data[a]);
+      CHECK_EQUAL(std::string("b"),  data[b]);
+      CHECK_EQUAL(std::string("cc"), *data.find(c));
+
+      // The values are contiguous.
+      CHECK_EQUAL(std::string("a"),  data.data()[0]);
+      CHECK_EQUAL(std::string("cc"), data.data()[2]);
+
+      data[b] = "B";
+      CHECK_EQUAL(std::string("B"), data[b]);
+
+      data.insert("d");
+      CHECK(data.full());
+      CHECK_THROW(data.insert("e"), etl::slot_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_keeps_other_handles)
+    {
+      Data data;
+
+      Data::handle_type a = data.insert("a");
+      Data::handle_type b = data.insert("b");
+      Data::handle_type c = data.insert("c");
+
+      CHECK(data.erase(a));
+      CHECK(!data.erase(a));
+      CHECK(!data.contains(a));
+      CHECK(data.find(a) == data.end());
+      CHECK_THROW(data[a], etl::slot_map_invalid_handle);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("b"), data[b]);
+      CHECK_EQUAL(std::string("c"), data[c]);
+
+      // The last value filled the hole.
+      CHECK_EQUAL(std::string("c"), data.data()[0]);
+      CHECK(data.get_handle(data.begin()) == c);
+    }
+
+    //*************************************************************************
+    TEST(test_reused_slot_rejects_stale_handle)
+    {
+      Data data;
+
+      Data::handle_type a = data.insert("a");
+      data.erase(a);
+
+      Data::handle_type d = data.insert("d");
+
+      CHECK_EQUAL(a.index(), d.index());
+      CHECK(a != d);
+      CHECK(!data.contains(a));
+      CHECK(data.contains(d));
+      CHECK_EQUAL(std::string("d"), data[d]);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+
+      data.insert("a");
+      Data::handle_type b = data.insert("b");
+      data.insert("c");
+
+      Data::iterator itr = data.erase(data.begin());
+      CHECK_EQUAL(std::string("c"), *itr);
+      CHECK_EQUAL(std::string("b"), data[b]);
+
+      while (!data.empty())
+      {
+        data.erase(data.begin());
+      }
+
+      CHECK(!data.contains(b));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data;
+
+      Data::handle_type a = data.insert("a");
+      Data::handle_type b = data.insert("b");
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(!data.contains(a));
+      CHECK(!data.contains(b));
+
+      for (int i = 0; i < 4; ++i)
+      {
+        Data::handle_type handle = data.insert("x");
+        CHECK(handle != a);
+        CHECK(handle != b);
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      typedef etl::slot_map<int, 16> DataInt;
+
+      DataInt data;
+      std::vector<std::pair<DataInt::handle_type, int> > live;
+      std::vector<DataInt::handle_type> dead;
+
+      unsigned seed = 1U;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const unsigned r = seed >> 8;
+
+        if (((r % 3U) != 0U) && !data.full())
+        {
+          live.push_back(std::make_pair(data.insert(int(r)), int(r)));
+        }
+        else if (!live.empty())
+        {
+          const size_t index = r % live.size();
+          CHECK(data.erase(live[index].first));
+          dead.push_back(live[index].first);
+          live.erase(live.begin() + index);
+        }
+
+        CHECK_EQUAL(live.size(), data.size());
+      }
+
+      for (size_t i = 0U; i < live.size(); ++i)
+      {
+        CHECK_EQUAL(live[i].second, data[live[i].first]);
+      }
+
+      for (size_t i = 0U; i < dead.size(); ++i)
+      {
+        CHECK(!data.contains(dead[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Data data;
+
+      Data::handle_type a = data.insert("a");
+      Data::handle_type b = data.insert("b");
+      data.erase(a);
+      Data::handle_type c = data.insert("c");
+
+      Data copy(data);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(std::string("b"), copy[b]);
+      CHECK_EQUAL(std::string("c"), copy[c]);
+      CHECK(!copy.contains(a));
+
+      Data assigned;
+      assigned.insert("z");
+      assigned = data;
+      CHECK_EQUAL(std::string("c"), assigned[c]);
+
+      typedef etl::slot_map<TestDataM<int>, 4> DataM;
+
+      DataM moveonly;
+      DataM::handle_type m = moveonly.insert(TestDataM<int>(1));
+      DataM::handle_type n = moveonly.emplace(2);
+      moveonly.erase(m);
+
+      DataM moved(std::move(moveonly));
+      CHECK(moveonly.empty());
+      CHECK(!moveonly.contains(n));
+      CHECK_EQUAL(2, moved[n].value);
+      CHECK(!moved.contains(m));
+
+      // The capacity of the copy of a smaller slot_map is all usable.
+      etl::slot_map<std::string, 8> larger;
+      etl::islot_map<std::string>& ilarger = larger;
+      ilarger = data;
+
+      CHECK_EQUAL(std::string("b"), larger[b]);
+
+      for (int i = 0; i < 6; ++i)
+      {
+        larger.insert("x");
+      }
+
+      CHECK(larger.full());
+      CHECK_EQUAL(std::string("c"), larger[c]);
+    }
+  };
+}
@@ -0,0 +1,173 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <numeric>
+#include <stdint.h>
+
+#include "etl/soa_vector.h"
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::soa_vector<8, int, double, char> Data;
+
+  SUITE(test_soa_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(8U, data.max_size());
+      CHECK_EQUAL(3U, Data::COLUMNS);
+      CHECK_EQUAL(0U, data.column<0>().size());
+    }
+
+    //*************************************************************************
+    TEST(test_columns_are_contiguous_and_aligned)
+    {
+      Data data;
+
+      CHECK(reinterpret_cast<uintptr_t>(data.column_data<1>()) % etl::alignment_of<double>::value == 0U);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push_back(i, i * 0.5, char('a' + i));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(0, 0.0, 'z'), etl::soa_vector_full);
+
+      etl::array_view<int>    ids    = data.column<0>();
+      etl::array_view<double> values = data.column<1>();
+
+      CHECK_EQUAL(8U, ids.size());
+      CHECK_EQUAL(28, std::accumulate(ids.begin(), ids.end(), 0));
+      CHECK_CLOSE(14.0, std::accumulate(values.begin(), values.end(), 0.0), 0.001);
+
+      CHECK_EQUAL(data.column_data<0>() + 1, &data.get<0>(1));
+      CHECK_EQUAL(data.column_data<2>() + 7, &data.get<2>(7));
+
+      // Columns do not overlap.
+      CHECK(static_cast<const void*>(data.column_data<0>() + 8) <= static_cast<const void*>(data.column_data<1>()));
+      CHECK(static_cast<const void*>(data.column_data<1>() + 8) <= static_cast<const void*>(data.column_data<2>()));
+    }
+
+    //*************************************************************************
+    TEST(test_row_proxies)
+    {
+      Data data;
+
+      data.push_back(1, 1.5, 'a');
+      data.push_back(2, 2.5, 'b');
+
+      Data::row_reference row = data[1];
+      CHECK_EQUAL(2, row.get<0>());
+      CHECK_EQUAL('b', row.get<2>());
+
+      row.get<1>() = 9.0;
+      CHECK_CLOSE(9.0, data.get<1>(1), 0.001);
+
+      const Data& cdata = data;
+      CHECK_EQUAL(1, cdata.front().get<0>());
+      CHECK_EQUAL('b', cdata.back().get<2>());
+      CHECK_EQUAL(1U, cdata.column<2>().size() - 1U);
+      CHECK_THROW(data.at(2), etl::soa_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_and_pop_back)
+    {
+      typedef etl::soa_vector<4, std::string, int> DataS;
+
+      DataS data;
+
+      data.push_back(std::string("a"), 1);
+      data.push_back(std::string("b"), 2);
+      data.push_back(std::string("c"), 3);
+
+      data.erase(0U);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("b"), data.get<0>(0));
+      CHECK_EQUAL(3, data.get<1>(1));
+
+      data.pop_back();
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(std::string("b"), data.back().get<0>());
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK_THROW(data.pop_back(), etl::soa_vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      typedef etl::soa_vector<4, TestDataM<int>, std::string> DataM;
+      typedef etl::soa_vector<4, std::string, int> DataS;
+
+      DataS data;
+      data.push_back(std::string("a"), 1);
+      data.push_back(std::string("b"), 2);
+
+      DataS copy(data);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(std::string("b"), copy.get<0>(1));
+
+      DataS assigned;
+      assigned.push_back(std::string("z"), 26);
+      assigned = data;
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL(1, assigned.get<1>(0));
+
+      DataM moveonly;
+      moveonly.push_back(TestDataM<int>(1), std::string("one"));
+      moveonly.push_back(TestDataM<int>(2), std::string("two"));
+
+      DataM moved(std::move(moveonly));
+      CHECK(moveonly.empty());
+      CHECK_EQUAL(2U, moved.size());
+      CHECK_EQUAL(2, moved.get<0>(1).value);
+      CHECK_EQUAL(std::string("two"), moved.get<1>(1));
+
+      etl::isoa_vector<TestDataM<int>, std::string>& imoved = moved;
+      DataM target;
+      target = std::move(moved);
+      CHECK(imoved.empty());
+      CHECK_EQUAL(1, target.front().get<0>().value);
+    }
+  };
+}
@@ -0,0 +1,124 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/mutex.h"
+#include "etl/queue_mpmc_mutex.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  const int THREADS    = 4;
+  const int INCREMENTS = 20000;
+
+  etl::spinlock lock;
+  int           counter;
+
+  void increment()
+  {
+    for (int i = 0; i < INCREMENTS; ++i)
+    {
+      lock.lock();
+      ++counter;
+      lock.unlock();
+    }
+  }
+
+  SUITE(test_spinlock)
+  {
+    //*************************************************************************
+    TEST(test_try_lock)
+    {
+      etl::spinlock spinlock;
+
+      CHECK(spinlock.try_lock());
+      CHECK(!spinlock.try_lock());
+      spinlock.unlock();
+      CHECK(spinlock.try_lock());
+      spinlock.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_backoff)
+    {
+      etl::spin_backoff<4> backoff;
+
+      backoff.pause();
+      backoff.pause();
+      backoff.pause();
+      backoff.pause();
+      backoff.reset();
+      backoff.pause();
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      counter = 0;
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < THREADS; ++i)
+      {
+        threads.push_back(std::thread(increment));
+      }
+
+      for (int i = 0; i < THREADS; ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(THREADS * INCREMENTS, counter);
+    }
+
+#if ETL_HAS_MUTEX
+    //*************************************************************************
+    TEST(test_queue_mpmc_mutex_with_spinlock)
+    {
+      etl::queue_mpmc_mutex<int, 4, etl::memory_model::MEMORY_MODEL_SMALL, etl::queue_telemetry_none, etl::spinlock> queue;
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+
+      int i = 0;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(1U, queue.size());
+    }
+#endif
+  };
+}
+
+#endif
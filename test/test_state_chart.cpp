@@ -32,8 +32,11 @@ SOFTWARE.
 #include "etl/enum_type.h"
 #include "etl/queue.h"
 #include "etl/array.h"
+#include "etl/container.h"
 
 #include <iostream>
+#include <vector>
+#include <random>
 
 namespace
 {
@@ -232,6 +235,23 @@ namespace
 
   MotorControl motorControl;
 
+#if defined(ETL_FSM_TRACE)
+  //***************************************************************************
+  // Ticks once per reading.
+  //***************************************************************************
+  struct TraceClock
+  {
+    static etl::fsm_trace_timestamp_t now()
+    {
+      return ++time;
+    }
+
+    static etl::fsm_trace_timestamp_t time;
+  };
+
+  etl::fsm_trace_timestamp_t TraceClock::time;
+#endif
+
   SUITE(test_state_chart_class)
   {
     //*************************************************************************
@@ -462,5 +482,349 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+#if defined(ETL_FSM_TRACE)
+    //*************************************************************************
+    TEST(test_state_chart_trace)
+    {
+      etl::fsm_trace<4> trace(TraceClock::now);
+      etl::fsm_trace_record records[4];
+
+      TraceClock::time = 0U;
+      motorControl.ClearStatistics();
+      motorControl.set_trace(trace);
+
+      // Now in Idle state.
+      motorControl.process_event(EventId::START);
+      motorControl.process_event(EventId::SET_SPEED); // Not a change of state.
+      motorControl.process_event(EventId::STOP);
+      motorControl.process_event(EventId::ABORT);
+
+      motorControl.clear_trace();
+      motorControl.process_event(EventId::START);
+
+      CHECK_EQUAL(3U, trace.written());
+
+      // Only the latest two.
+      CHECK_EQUAL(2U, trace.copy(records, 2U));
+
+      CHECK_EQUAL(StateId::RUNNING,      records[0].state_from);
+      CHECK_EQUAL(StateId::WINDING_DOWN, records[0].state_to);
+      CHECK_EQUAL(EventId::STOP,         records[0].message_id);
+      CHECK_EQUAL(4U,                    records[0].timestamp);
+      CHECK_EQUAL(1U,                    records[0].duration);
+
+      CHECK_EQUAL(StateId::WINDING_DOWN, records[1].state_from);
+      CHECK_EQUAL(StateId::IDLE,         records[1].state_to);
+      CHECK_EQUAL(EventId::ABORT,        records[1].message_id);
+      CHECK_EQUAL(6U,                    records[1].timestamp);
+
+      CHECK_EQUAL(3U, trace.copy(records, 4U));
+      CHECK_EQUAL(StateId::IDLE,    records[0].state_from);
+      CHECK_EQUAL(StateId::RUNNING, records[0].state_to);
+
+      // Leave the chart as the other tests expect.
+      motorControl.process_event(EventId::ABORT);
+    }
+#endif
   };
+
+  //***************************************************************************
+  // Records the calls made by a state chart.
+  //***************************************************************************
+  struct Recorder
+  {
+    Recorder()
+      : guard_calls(0)
+    {
+    }
+
+    void Action0() { log.push_back(0); }
+    void Action1() { log.push_back(1); }
+    void Action2() { log.push_back(2); }
+    void Entry()   { log.push_back(10); }
+    void Exit()    { log.push_back(11); }
+
+    bool GuardTrue()  { return true; }
+    bool GuardFalse() { return false; }
+    bool GuardEvery3rd() { return (++guard_calls % 3) == 0; }
+
+    int guard_calls;
+    std::vector<int> log;
+  };
+
+  typedef etl::state_chart<Recorder> RecorderChart;
+
+  SUITE(test_indexed_state_chart_class)
+  {
+    //*************************************************************************
+    TEST(test_indexed_state_chart_motor_control_tables)
+    {
+      Recorder recorder;
+
+      const RecorderChart::transition transitions[] =
+      {
+        RecorderChart::transition(StateId::IDLE,         EventId::START,   StateId::RUNNING,      &Recorder::Action0, &Recorder::GuardFalse),
+        RecorderChart::transition(StateId::IDLE,         EventId::START,   StateId::IDLE,         &Recorder::Action1),
+        RecorderChart::transition(StateId::RUNNING,      EventId::STOP,    StateId::WINDING_DOWN, &Recorder::Action2),
+        RecorderChart::transition(                       EventId::ABORT,   StateId::IDLE,         &Recorder::Action0),
+        RecorderChart::transition(StateId::IDLE,         EventId::ABORT,   StateId::RUNNING,      &Recorder::Action1)
+      };
+
+      const RecorderChart::state states[] =
+      {
+        RecorderChart::state(StateId::WINDING_DOWN, &Recorder::Entry, &Recorder::Exit),
+        RecorderChart::state(StateId::IDLE,         &Recorder::Entry, nullptr)
+      };
+
+      etl::indexed_state_chart<Recorder, 5, 2> chart(recorder,
+                                                     etl::begin(transitions), etl::end(transitions),
+                                                     etl::begin(states), etl::end(states),
+                                                     StateId::RUNNING);
+
+      CHECK(chart.is_transition_table_indexed());
+      CHECK(chart.is_state_table_indexed());
+
+      chart.start();
+      CHECK(recorder.log.empty());
+
+      chart.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::WINDING_DOWN, chart.get_state_id());
+
+      // The 'any state' transition comes before the idle specific one.
+      chart.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+      chart.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+      // The first transition's guard fails.
+      chart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+      const int expected[] = { 2, 10, 0, 11, 10, 0, 1 };
+      CHECK_EQUAL(sizeof(expected) / sizeof(int), recorder.log.size());
+      CHECK_ARRAY_EQUAL(expected, recorder.log.data(), recorder.log.size());
+    }
+
+    //*************************************************************************
+    TEST(test_indexed_state_chart_too_small_falls_back)
+    {
+      Recorder recorder;
+
+      const RecorderChart::transition transitions[] =
+      {
+        RecorderChart::transition(0, 0, 1, &Recorder::Action0),
+        RecorderChart::transition(1, 0, 0, &Recorder::Action1)
+      };
+
+      const RecorderChart::state states[] =
+      {
+        RecorderChart::state(0, &Recorder::Entry),
+        RecorderChart::state(1, &Recorder::Entry)
+      };
+
+      etl::indexed_state_chart<Recorder, 1, 1> chart(recorder,
+                                                     etl::begin(transitions), etl::end(transitions),
+                                                     etl::begin(states), etl::end(states),
+                                                     0);
+
+      CHECK(!chart.is_transition_table_indexed());
+      CHECK(!chart.is_state_table_indexed());
+
+      chart.start(false);
+      chart.process_event(0);
+      chart.process_event(0);
+
+      const int expected[] = { 0, 10, 1, 10 };
+      CHECK_EQUAL(sizeof(expected) / sizeof(int), recorder.log.size());
+      CHECK_ARRAY_EQUAL(expected, recorder.log.data(), recorder.log.size());
+    }
+
+    //*************************************************************************
+    TEST(test_indexed_state_chart_matches_state_chart)
+    {
+      const int N_STATES      = 8;
+      const int N_EVENTS      = 12;
+      const int N_TRANSITIONS = 120;
+
+      std::mt19937 generator(1234);
+      std::uniform_int_distribution<int> random_state(0, N_STATES - 1);
+      std::uniform_int_distribution<int> random_event(0, N_EVENTS - 1);
+      std::uniform_int_distribution<int> random_choice(0, 5);
+
+      void (Recorder::* const actions[])() = { nullptr, &Recorder::Action0, &Recorder::Action1, &Recorder::Action2 };
+      bool (Recorder::* const guards[])()  = { nullptr, &Recorder::GuardTrue, &Recorder::GuardFalse, &Recorder::GuardEvery3rd };
+
+      std::vector<RecorderChart::transition> transitions;
+      transitions.reserve(N_TRANSITIONS);
+
+      for (int i = 0; i < N_TRANSITIONS; ++i)
+      {
+        void (Recorder::* action)() = actions[random_choice(generator) % 4];
+        bool (Recorder::* guard)()  = guards[random_choice(generator) % 4];
+
+        if (random_choice(generator) == 0)
+        {
+          transitions.push_back(RecorderChart::transition(random_event(generator), random_state(generator), action, guard));
+        }
+        else
+        {
+          transitions.push_back(RecorderChart::transition(random_state(generator), random_event(generator), random_state(generator), action, guard));
+        }
+      }
+
+      std::vector<RecorderChart::state> states;
+      states.reserve(N_STATES);
+
+      for (int i = N_STATES - 1; i >= 0; i -= 2)
+      {
+        states.push_back(RecorderChart::state(i, &Recorder::Entry, &Recorder::Exit));
+      }
+
+      Recorder linear_recorder;
+      Recorder indexed_recorder;
+
+      RecorderChart linear_chart(linear_recorder,
+                                 transitions.data(), transitions.data() + transitions.size(),
+                                 states.data(), states.data() + states.size(),
+                                 0);
+
+      etl::indexed_state_chart<Recorder, N_TRANSITIONS, N_STATES> indexed_chart(indexed_recorder,
+                                                                                transitions.data(), transitions.data() + transitions.size(),
+                                                                                states.data(), states.data() + states.size(),
+                                                                                0);
+
+      CHECK(indexed_chart.is_transition_table_indexed());
+      CHECK(indexed_chart.is_state_table_indexed());
+
+      linear_chart.start();
+      indexed_chart.start();
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        const int event_id = random_event(generator);
+
+        linear_chart.process_event(event_id);
+        indexed_chart.process_event(event_id);
+
+        CHECK_EQUAL(linear_chart.get_state_id(), indexed_chart.get_state_id());
+      }
+
+      CHECK_EQUAL(linear_recorder.guard_calls, indexed_recorder.guard_calls);
+      CHECK(linear_recorder.log == indexed_recorder.log);
+      CHECK(linear_recorder.log.size() > 1000U);
+    }
+  }
+
+  //***************************************************************************
+  constexpr RecorderChart::transition ctTransitions[] =
+  {
+    RecorderChart::transition(0, 0, 1, &Recorder::Action0, &Recorder::GuardEvery3rd),
+    RecorderChart::transition(0, 0, 2, &Recorder::Action1),
+    RecorderChart::transition(1, 1, 2, &Recorder::Action2),
+    RecorderChart::transition(1, 2, 1, nullptr, &Recorder::GuardFalse),
+    RecorderChart::transition(2, 2, 0, &Recorder::Action0, &Recorder::GuardTrue),
+    RecorderChart::transition(   3, 2, &Recorder::Action1, &Recorder::GuardEvery3rd),
+    RecorderChart::transition(2, 3, 1),
+    RecorderChart::transition(   1, 0, &Recorder::Action2),
+    RecorderChart::transition(2, 1, 3, &Recorder::Action0),
+    RecorderChart::transition(3, 0, 0)
+  };
+
+  constexpr RecorderChart::state ctStates[] =
+  {
+    RecorderChart::state(0, &Recorder::Entry, nullptr),
+    RecorderChart::state(2, &Recorder::Entry, &Recorder::Exit),
+    RecorderChart::state(3, nullptr,          &Recorder::Exit),
+    RecorderChart::state(2, nullptr,          nullptr)
+  };
+
+  typedef etl::state_chart_ct<Recorder, ctTransitions, ETL_ARRAY_SIZE(ctTransitions), ctStates, ETL_ARRAY_SIZE(ctStates)> RecorderChartCt;
+
+  SUITE(test_state_chart_ct_class)
+  {
+    //*************************************************************************
+    TEST(test_state_chart_ct_start)
+    {
+      Recorder recorder;
+      RecorderChartCt chart(recorder, 0);
+
+      CHECK_EQUAL(0, chart.get_state_id());
+      CHECK(&chart.get_object() == &recorder);
+
+      // Not started.
+      chart.process_event(0);
+      CHECK_EQUAL(0, chart.get_state_id());
+      CHECK(recorder.log.empty());
+
+      chart.start();
+      chart.start();
+      CHECK_EQUAL(1U, recorder.log.size());
+      CHECK_EQUAL(10, recorder.log[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_ct_transitions)
+    {
+      Recorder recorder;
+      RecorderChartCt chart(recorder, 0);
+
+      chart.start(false);
+
+      // First guard fails, the second transition is taken.
+      chart.process_event(0);
+      CHECK_EQUAL(2, chart.get_state_id());
+
+      // The first matching state item is used for on_exit.
+      chart.process_event(2);
+      CHECK_EQUAL(0, chart.get_state_id());
+
+      // 'Any state' transition to the current state.
+      chart.process_event(1);
+      CHECK_EQUAL(0, chart.get_state_id());
+
+      // 'Any state' transition, guard passes on the third call.
+      chart.process_event(3);
+      CHECK_EQUAL(0, chart.get_state_id());
+      chart.process_event(3);
+      CHECK_EQUAL(2, chart.get_state_id());
+
+      const int expected[] = { 1, 10, 0, 11, 10, 2, 1, 10 };
+      CHECK_EQUAL(sizeof(expected) / sizeof(int), recorder.log.size());
+      CHECK_ARRAY_EQUAL(expected, recorder.log.data(), recorder.log.size());
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_ct_matches_state_chart)
+    {
+      std::mt19937 generator(5678);
+      std::uniform_int_distribution<int> random_event(0, 4);
+
+      Recorder runtime_recorder;
+      Recorder ct_recorder;
+
+      RecorderChart runtime_chart(runtime_recorder,
+                                  etl::begin(ctTransitions), etl::end(ctTransitions),
+                                  etl::begin(ctStates), etl::end(ctStates),
+                                  0);
+
+      RecorderChartCt ct_chart(ct_recorder, 0);
+
+      runtime_chart.start();
+      ct_chart.start();
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        const int event_id = random_event(generator);
+
+        runtime_chart.process_event(event_id);
+        ct_chart.process_event(event_id);
+
+        CHECK_EQUAL(runtime_chart.get_state_id(), ct_chart.get_state_id());
+      }
+
+      CHECK_EQUAL(runtime_recorder.guard_calls, ct_recorder.guard_calls);
+      CHECK(runtime_recorder.log == ct_recorder.log);
+    }
+  }
 }
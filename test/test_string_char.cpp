@@ -2685,6 +2685,41 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_partial_matches)
+    {
+      const value_t* the_haystack = STR("aab abab ababc abca abcabcd cd d");
+
+      std::string compare_haystack(the_haystack);
+      etl::string<50> haystack(the_haystack);
+
+      const value_t* needles[] = { STR("a"), STR("ab"), STR("abc"), STR("abcd"), STR("cd d"), STR("d"), STR("dd"), STR("") };
+
+      for (size_t i = 0; i < (sizeof(needles) / sizeof(needles[0])); ++i)
+      {
+        for (size_t position = 0; position <= compare_haystack.size(); ++position)
+        {
+          if (etl::strlen(needles[i]) != 0)
+          {
+            CHECK_EQUAL(compare_haystack.find(needles[i], position), haystack.find(needles[i], position));
+          }
+
+          CHECK_EQUAL(compare_haystack.find(needles[i][0], position), haystack.find(needles[i][0], position));
+        }
+      }
+
+      // Characters with the top bit set are found by the character set lookup.
+      const value_t set[] = { value_t(0xE9), STR('c'), 0 };
+      haystack.assign(STR("abd"));
+      haystack += value_t(0xE9);
+      compare_haystack.assign(haystack.begin(), haystack.end());
+
+      CHECK_EQUAL(compare_haystack.find_first_of(set), haystack.find_first_of(set));
+      CHECK_EQUAL(compare_haystack.find_last_of(set), haystack.find_last_of(set));
+      CHECK_EQUAL(compare_haystack.find_first_not_of(STR("abd")), haystack.find_first_not_of(STR("abd")));
+      CHECK_EQUAL(compare_haystack.find_last_not_of(set), haystack.find_last_not_of(set));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_rfind_string)
     {
@@ -3577,7 +3612,7 @@ namespace
       // Test with actual string type.
       Text text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::hash_string(text.data(), text.size());
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
@@ -3802,5 +3837,25 @@ namespace
       // Check there no non-zero values in the remainder of the string.
       CHECK(std::find_if(pb, pe, [](Text::value_type x) { return x != 0; }) == pe);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_unchecked)
+    {
+      const value_t* abc = STR("ABC");
+
+      Text text;
+
+      CHECK(text.reserve_check(4U));
+      text.push_back_unchecked(STR('Z'));
+      text.append_unchecked(abc, 3U);
+
+      CHECK(text == STR("ZABC"));
+      CHECK_EQUAL(4U, text.size());
+      CHECK(!text.truncated());
+
+      CHECK(text.reserve_check(SIZE - 4U));
+      CHECK(!text.reserve_check(SIZE - 3U));
+    }
+
   };
 }
@@ -0,0 +1,146 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <array>
+#include <algorithm>
+
+#include "etl/cstring.h"
+#include "etl/pool.h"
+
+namespace
+{
+  SUITE(test_string_char_ext)
+  {
+    static const size_t SIZE = 11;
+
+    typedef etl::string_ext Text;
+    typedef etl::istring    IText;
+    typedef std::string     Compare_Text;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      char buffer[SIZE + 1];
+      Text text(buffer, SIZE + 1);
+
+      CHECK(text.empty());
+      CHECK_EQUAL(SIZE, text.capacity());
+      CHECK_EQUAL(SIZE, text.max_size());
+      CHECK(text.data() == buffer);
+    }
+
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      char buffer1[SIZE + 1];
+      char buffer2[SIZE + 1];
+      char buffer3[SIZE + 1];
+      char buffer4[SIZE + 1];
+      char buffer5[SIZE + 1];
+
+      Compare_Text compare(5, 'A');
+
+      Text text1("Hello World", buffer1, SIZE + 1);
+      Text text2("Hello World", 5, buffer2, SIZE + 1);
+      Text text3(5, 'A', buffer3, SIZE + 1);
+      Text text4(text1.begin(), text1.begin() + 5, buffer4, SIZE + 1);
+      Text text5(etl::string_view("World"), buffer5, SIZE + 1);
+
+      CHECK(text1 == "Hello World");
+      CHECK(text2 == "Hello");
+      CHECK(Compare_Text(text3.begin(), text3.end()) == compare);
+      CHECK(text4 == "Hello");
+      CHECK(text5 == "World");
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      char buffer[SIZE + 1];
+      Text text("Hello World and more", buffer, SIZE + 1);
+
+      CHECK_EQUAL(SIZE, text.size());
+      CHECK(text.truncated());
+      CHECK(text == "Hello World");
+
+      text.clear();
+      text.append("Hello");
+      CHECK(!text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_share_interface_with_string)
+    {
+      char buffer[64];
+      Text large(buffer, sizeof(buffer));
+
+      etl::string<SIZE> small("Hello");
+
+      IText& ilarge = large;
+      ilarge.assign(small);
+      ilarge.append(" World, from a larger buffer");
+
+      CHECK(large == "Hello World, from a larger buffer");
+
+      small = large;
+      CHECK(small.truncated());
+      CHECK(small == "Hello World");
+
+      char buffer2[64];
+      Text copy(large, buffer2, sizeof(buffer2));
+      CHECK(copy == large);
+
+      copy = "Assigned";
+      CHECK(copy == "Assigned");
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_from_pool)
+    {
+      typedef std::array<char, 4096> block_t;
+
+      etl::pool<block_t, 2> pool;
+
+      block_t* pblock = pool.allocate<block_t>();
+
+      {
+        Text text(pblock->data(), pblock->size());
+
+        text.assign(4000, 'x');
+        CHECK_EQUAL(4000U, text.size());
+        CHECK(!text.truncated());
+      }
+
+      pool.release(pblock);
+      CHECK_EQUAL(2U, pool.available());
+    }
+  };
+}
@@ -0,0 +1,268 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/string_ci.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/u16string.h"
+#include "etl/unordered_map.h"
+
+#include <string>
+
+namespace
+{
+  //*************************************************************************
+  template <typename T>
+  int reference_compare(const T* s1, const T* s2, size_t count)
+  {
+    for (size_t i = 0U; i < count; ++i)
+    {
+      const T c1 = ((s1[i] >= 'A') && (s1[i] <= 'Z')) ? T(s1[i] + 32) : s1[i];
+      const T c2 = ((s2[i] >= 'A') && (s2[i] <= 'Z')) ? T(s2[i] + 32) : s2[i];
+
+      if (c1 != c2)
+      {
+        return (c1 < c2) ? -1 : 1;
+      }
+    }
+
+    return 0;
+  }
+
+  SUITE(test_string_ci)
+  {
+    //*************************************************************************
+    TEST(test_fold_word_bytes)
+    {
+      // Every byte value, in every lane.
+      for (int value = 0; value < 256; ++value)
+      {
+        for (size_t lane = 0U; lane < 8U; ++lane)
+        {
+          const uint64_t word   = (uint64_t(value) << (lane * 8U)) | (lane == 0U ? 0U : 0x5AULL);
+          const uint64_t folded = etl::private_string_ci::fold_word<uint64_t, 8U>(word);
+
+          const unsigned char expected = etl::private_string_ci::to_lower((unsigned char)(value));
+          CHECK_EQUAL(int(expected), int((folded >> (lane * 8U)) & 0xFFU));
+
+          if (lane != 0U)
+          {
+            CHECK_EQUAL(int('z'), int(folded & 0xFFU));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fold_word_wide)
+    {
+      const uint32_t values[] = { 0x0041U, 0x005AU, 0x0040U, 0x005BU, 0x00C1U, 0x0141U, 0x015AU, 0xFF41U, 0x8041U, 0x10041U, 0x80000041U };
+
+      for (size_t i = 0U; i < (sizeof(values) / sizeof(values[0])); ++i)
+      {
+        const uint32_t value = values[i];
+
+        if (value <= 0xFFFFU)
+        {
+          const uint64_t word   = (uint64_t(value) << 16) | (uint64_t(value) << 48) | 0x0000004D0000004DULL;
+          const uint64_t folded = etl::private_string_ci::fold_word<uint64_t, 16U>(word);
+          const uint64_t lower  = etl::private_string_ci::to_lower(value);
+
+          CHECK_EQUAL(lower, (folded >> 16) & 0xFFFFU);
+          CHECK_EQUAL(lower, (folded >> 48) & 0xFFFFU);
+          CHECK_EQUAL(uint64_t('m'), folded & 0xFFFFU);
+        }
+
+        const uint64_t word   = (uint64_t(value) << 32) | 0x4DU;
+        const uint64_t folded = etl::private_string_ci::fold_word<uint64_t, 32U>(word);
+
+        CHECK_EQUAL(uint64_t(etl::private_string_ci::to_lower(value)), folded >> 32);
+        CHECK_EQUAL(uint64_t('m'), folded & 0xFFFFFFFFU);
+        CHECK_EQUAL(etl::private_string_ci::to_lower(value), (etl::private_string_ci::fold_word<uint32_t, 32U>(value)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compare_lengths_and_positions)
+    {
+      const char base[] = "Content-Type: Application/JSON; Charset=UTF-8 @[`{";
+
+      for (size_t length = 0U; length < sizeof(base); ++length)
+      {
+        std::string lhs(base, length);
+        std::string rhs(base, length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          rhs[i] = char(etl::private_string_ci::to_lower(rhs[i]));
+        }
+
+        CHECK_EQUAL(0, etl::private_string_ci::compare(lhs.data(), rhs.data(), length));
+
+        // A difference at each position.
+        for (size_t i = 0U; i < length; ++i)
+        {
+          std::string other(rhs);
+          other[i] = char(other[i] + 1);
+
+          CHECK_EQUAL(reference_compare(lhs.data(), other.data(), length), etl::private_string_ci::compare(lhs.data(), other.data(), length));
+          CHECK_EQUAL(reference_compare(other.data(), lhs.data(), length), etl::private_string_ci::compare(other.data(), lhs.data(), length));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_case_only_differs_in_bit_five)
+    {
+      // '@' and '`', '[' and '{' differ only in bit five, but are not letters.
+      const etl::string_view a("@@@@@@@@[[[[[[[[@");
+      const etl::string_view b("````````{{{{{{{{`");
+
+      CHECK(!etl::equal_ci(a, b));
+      CHECK(etl::compare_ci(a, b) < 0);
+      CHECK(etl::hash_ci()(a) != etl::hash_ci()(b));
+
+      // Bytes from 0x80.
+      const char high1[] = "\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1\xC1";
+      const char high2[] = "\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1\xE1";
+
+      CHECK(!etl::equal_ci(etl::string_view(high1), etl::string_view(high2)));
+    }
+
+    //*************************************************************************
+    TEST(test_equal_and_compare)
+    {
+      const etl::string<32> text("Accept-Encoding");
+
+      CHECK(etl::equal_ci(text, etl::string_view("ACCEPT-ENCODING")));
+      CHECK(etl::equal_ci(text, etl::string_view("accept-encoding")));
+      CHECK(!etl::equal_ci(text, etl::string_view("accept-encodin")));
+      CHECK(!etl::equal_ci(text, etl::string_view("accept-encodinh")));
+
+      CHECK_EQUAL(0,  etl::compare_ci(text, etl::string_view("ACCEPT-encoding")));
+      CHECK_EQUAL(-1, etl::compare_ci(text, etl::string_view("ACCEPT-encodinh")));
+      CHECK_EQUAL(1,  etl::compare_ci(text, etl::string_view("ACCEPT-encodinf")));
+      CHECK_EQUAL(1,  etl::compare_ci(text, etl::string_view("ACCEPT")));
+      CHECK_EQUAL(-1, etl::compare_ci(etl::string_view("ACCEPT"), text));
+
+      CHECK(etl::less_ci()(etl::string_view("alpha"), etl::string_view("BETA")));
+      CHECK(!etl::less_ci()(etl::string_view("BETA"), etl::string_view("alpha")));
+      CHECK(etl::equal_to_ci()(text, etl::string_view("accept-ENCODING")));
+    }
+
+    //*************************************************************************
+    TEST(test_hash)
+    {
+      const etl::string<32> text("Content-Length: 12345678");
+      const etl::string_view lower("content-length: 12345678");
+      const etl::string_view upper("CONTENT-LENGTH: 12345678");
+
+      const size_t h = etl::hash_ci()(text);
+
+      CHECK_EQUAL(h, etl::hash_ci()(lower));
+      CHECK_EQUAL(h, etl::hash_ci()(upper));
+      CHECK_EQUAL(h, etl::hash_string_ci(lower.data(), lower.size()));
+
+      // Folding is the only difference from etl::hash.
+      CHECK_EQUAL(etl::hash_string(lower.data(), lower.size()), h);
+
+      CHECK(h != etl::hash_ci()(etl::string_view("content-length: 12345679")));
+
+      for (size_t length = 0U; length <= upper.size(); ++length)
+      {
+        CHECK_EQUAL(etl::hash_string(lower.data(), length), etl::hash_string_ci(upper.data(), length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hash_wide)
+    {
+      const etl::wstring<16> wide(L"Hello World");
+      const etl::u16string<16> u16(u"Hello World");
+
+      CHECK_EQUAL(etl::hash_ci()(etl::wstring_view(L"HELLO world")), etl::hash_ci()(wide));
+      CHECK_EQUAL(etl::hash_string(L"hello world", 11U), etl::hash_ci()(wide));
+      CHECK_EQUAL(etl::hash_ci()(etl::u16string_view(u"hello WORLD")), etl::hash_ci()(u16));
+      CHECK_EQUAL(etl::hash_string(u"hello world", 11U), etl::hash_ci()(u16));
+
+      CHECK(etl::equal_ci(wide, etl::wstring_view(L"HELLO WORLD")));
+      CHECK(etl::equal_ci(u16, etl::u16string_view(u"hello world")));
+      CHECK(!etl::equal_ci(u16, etl::u16string_view(u"hello\x0141world")));
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr_hash)
+    {
+      constexpr size_t h = etl::hash_string_ci("ACCEPT", 6U);
+
+      CHECK_EQUAL(etl::hash_string("accept", 6U), h);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_unordered_map)
+    {
+      typedef etl::unordered_map<etl::string<16>, int, 8, 8, etl::hash_ci, etl::equal_to_ci> Headers;
+
+      Headers headers;
+
+      headers[etl::string<16>("Content-Type")]   = 1;
+      headers[etl::string<16>("content-length")] = 2;
+      headers[etl::string<16>("CONTENT-TYPE")]   = 3;
+
+      CHECK_EQUAL(2U, headers.size());
+      CHECK_EQUAL(3, headers[etl::string<16>("content-type")]);
+      CHECK_EQUAL(2, headers.find(etl::string<16>("Content-Length"))->second);
+      CHECK(headers.find(etl::string<16>("Content-Lengths")) == headers.end());
+    }
+
+    //*************************************************************************
+    TEST(test_ci_string_view)
+    {
+      const etl::ci_string_view a("Transfer-Encoding: Chunked");
+      const etl::ci_string_view b("TRANSFER-ENCODING: chunked");
+      const etl::ci_string_view c("transfer-encoding: gzip");
+
+      CHECK(a == b);
+      CHECK(a != c);
+      CHECK(a < c);
+      CHECK_EQUAL(0, a.compare(b));
+      CHECK(a.starts_with(etl::ci_string_view("transfer")));
+      CHECK(a.ends_with(etl::ci_string_view("CHUNKED")));
+      CHECK(etl::ci_char_traits<char>::find(a.data(), a.size(), 'K') == (a.data() + 23));
+      CHECK(etl::ci_char_traits<char>::eq('Q', 'q'));
+      CHECK(etl::ci_char_traits<char>::lt('a', 'B'));
+      CHECK_EQUAL(etl::hash_ci()(a), etl::hash_ci()(b));
+    }
+  };
+}
@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/string_concat.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+
+#include <string>
+
+namespace
+{
+  SUITE(test_string_concat)
+  {
+    //*************************************************************************
+    TEST(test_operator_plus_construct)
+    {
+      const etl::string<8> level("WARN");
+      const etl::string_view source("net");
+      const char* message = "link down";
+
+      etl::string<32> line = level + ": " + message + " [" + source + ']';
+
+      CHECK(std::string("WARN: link down [net]") == std::string(line.c_str()));
+      CHECK_EQUAL(line.size(), (level + ": " + message + " [" + source + ']').size());
+      CHECK(!line.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_concat)
+    {
+      const etl::string<8> level("INFO");
+      const etl::string_view source("io");
+      const char colon = ':';
+
+      etl::string<32> line = etl::concat(level, colon, ' ', "started ", source);
+
+      CHECK(std::string("INFO: started io") == std::string(line.c_str()));
+
+      line = etl::concat("a", source);
+      CHECK(std::string("aio") == std::string(line.c_str()));
+
+      line = etl::concat(source, level);
+      CHECK(std::string("ioINFO") == std::string(line.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_append)
+    {
+      etl::string<16> text("ab");
+      const etl::string<4> cd("cd");
+
+      text += cd + "ef" + 'g';
+
+      CHECK(std::string("abcdefg") == std::string(text.c_str()));
+
+      text.append(etl::concat("h", cd));
+
+      CHECK(std::string("abcdefghcd") == std::string(text.c_str()));
+      CHECK(!text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<6> text;
+      const etl::string<8> abcd("abcd");
+
+      text = abcd + "efgh";
+
+      CHECK(std::string("abcdef") == std::string(text.c_str()));
+      CHECK(text.truncated());
+
+      text = abcd + "e";
+
+      CHECK(std::string("abcde") == std::string(text.c_str()));
+      CHECK(!text.truncated());
+
+      text += abcd + "xy";
+
+      CHECK(std::string("abcdea") == std::string(text.c_str()));
+      CHECK(text.truncated());
+
+      // A truncated piece truncates the result.
+      etl::string<3> short_text("abcd");
+      CHECK(short_text.truncated());
+
+      text = short_text + "d";
+
+      CHECK(std::string("abcd") == std::string(text.c_str()));
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_destination_is_a_piece)
+    {
+      etl::string<16> text("abc");
+
+      text = text + "def";
+      CHECK(std::string("abcdef") == std::string(text.c_str()));
+
+      text = "12" + text;
+      CHECK(std::string("12abcdef") == std::string(text.c_str()));
+
+      text = etl::concat("x", text, text);
+      CHECK(std::string("x12abcdef12abcde") == std::string(text.c_str()));
+      CHECK(text.truncated());
+
+      text = "ab";
+      text += text + text;
+      CHECK(std::string("ababab") == std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_string_ext)
+    {
+      char buffer[8];
+      etl::string_ext text(buffer, 8U);
+      const etl::string_view view("bc");
+
+      text = "a" + view + 'd';
+
+      CHECK(std::string("abcd") == std::string(text.c_str()));
+
+      char buffer2[4];
+      etl::string_ext text2(etl::concat(view, view), buffer2, 4U);
+
+      CHECK(std::string("bcb") == std::string(text2.c_str()));
+      CHECK(text2.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_wide)
+    {
+      const etl::wstring<8> hello(L"hello");
+      const etl::wstring_view world(L"world");
+
+      etl::wstring<16> text = hello + L' ' + world + L"!";
+
+      CHECK(std::wstring(L"hello world!") == std::wstring(text.c_str()));
+
+      text = etl::concat(world, L", ", hello);
+
+      CHECK(std::wstring(L"world, hello") == std::wstring(text.c_str()));
+    }
+  };
+}
@@ -0,0 +1,345 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <array>
+
+#include "etl/string_hybrid.h"
+#include "etl/pool.h"
+#include "etl/container.h"
+
+namespace
+{
+  SUITE(test_string_hybrid)
+  {
+    static const size_t SIZE = 11;
+
+    typedef etl::istring IText;
+    typedef std::string  Compare_Text;
+
+    //*************************************************************************
+    TEST(test_stays_inline)
+    {
+      char overflow[64];
+      etl::string_hybrid<SIZE> text("Hello", overflow, sizeof(overflow));
+
+      text.append(" World");
+
+      CHECK(text == "Hello World");
+      CHECK(!text.is_overflowed());
+      CHECK(!text.truncated());
+      CHECK_EQUAL(SIZE, text.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_buffer)
+    {
+      char overflow[64];
+      etl::string_hybrid<SIZE> text("Hello World", overflow, sizeof(overflow));
+
+      IText& itext = text;
+      itext.append(", from the overflow buffer");
+
+      CHECK(text == "Hello World, from the overflow buffer");
+      CHECK(text.is_overflowed());
+      CHECK(!text.truncated());
+      CHECK(text.data() == overflow);
+      CHECK_EQUAL(sizeof(overflow) - 1U, text.capacity());
+
+      // Truncates at the overflow capacity.
+      text.assign(100U, 'x');
+      CHECK_EQUAL(sizeof(overflow) - 1U, text.size());
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_on_each_modifier)
+    {
+      const Compare_Text compare("Hello World, Hello World");
+
+      char overflow1[64];
+      char overflow2[64];
+      char overflow3[64];
+      char overflow4[64];
+      char overflow5[64];
+      char overflow6[64];
+
+      etl::string_hybrid<SIZE> text1(overflow1, sizeof(overflow1));
+      etl::string_hybrid<SIZE> text2(overflow2, sizeof(overflow2));
+      etl::string_hybrid<SIZE> text3("Hello World", overflow3, sizeof(overflow3));
+      etl::string_hybrid<SIZE> text4("Hello World", overflow4, sizeof(overflow4));
+      etl::string_hybrid<SIZE> text5("Hello World", overflow5, sizeof(overflow5));
+      etl::string_hybrid<SIZE> text6(overflow6, sizeof(overflow6));
+
+      text1 = compare.c_str();
+      text2.assign(compare.begin(), compare.end());
+      text3.insert(0U, "Hello World, ");
+      text4.append(text4.c_str()).insert(11U, ", ");
+
+      for (size_t i = 11U; i < compare.size(); ++i)
+      {
+        text5.push_back(compare[i]);
+      }
+
+      text6.resize(compare.size(), 'x');
+
+      CHECK(Compare_Text(text1.begin(), text1.end()) == compare);
+      CHECK(Compare_Text(text2.begin(), text2.end()) == compare);
+      CHECK(Compare_Text(text3.begin(), text3.end()) == compare);
+      CHECK(Compare_Text(text4.begin(), text4.end()) == compare);
+      CHECK(Compare_Text(text5.begin(), text5.end()) == compare);
+      CHECK_EQUAL(compare.size(), text6.size());
+
+      CHECK(text1.is_overflowed());
+      CHECK(text2.is_overflowed());
+      CHECK(text3.is_overflowed());
+      CHECK(text4.is_overflowed());
+      CHECK(text5.is_overflowed());
+      CHECK(text6.is_overflowed());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_pool)
+    {
+      typedef std::array<char, 4096> block_t;
+
+      etl::pool<block_t, 1> pool;
+
+      {
+        etl::string_hybrid<SIZE> text1("Hello", pool);
+        etl::string_hybrid<SIZE> text2("Hello", pool);
+        CHECK_EQUAL(1U, pool.available());
+
+        text1.assign(4000U, 'x');
+        CHECK(text1.is_overflowed());
+        CHECK_EQUAL(4000U, text1.size());
+        CHECK(!text1.truncated());
+        CHECK_EQUAL(0U, pool.available());
+
+        // The pool is empty, so the second string truncates.
+        text2.assign(4000U, 'x');
+        CHECK(!text2.is_overflowed());
+        CHECK_EQUAL(SIZE, text2.size());
+        CHECK(text2.truncated());
+
+        // Moving back inline returns the block.
+        text1 = "Short";
+        text1.shrink_to_fit();
+        CHECK(!text1.is_overflowed());
+        CHECK(text1 == "Short");
+        CHECK_EQUAL(1U, pool.available());
+
+        text2.assign(4000U, 'y');
+        CHECK(text2.is_overflowed());
+        CHECK_EQUAL(0U, pool.available());
+      }
+
+      // The destructor returns the block.
+      CHECK_EQUAL(1U, pool.available());
+    }
+  };
+
+  SUITE(test_wstring_hybrid)
+  {
+    static const size_t SIZE = 11;
+
+    //*************************************************************************
+    TEST(test_overflow_to_buffer)
+    {
+      wchar_t overflow[64];
+      etl::wstring_hybrid<SIZE> text(L"Hello", overflow, etl::size(overflow));
+
+      text.append(L" World");
+      CHECK(!text.is_overflowed());
+      CHECK_EQUAL(SIZE, text.capacity());
+
+      etl::iwstring& itext = text;
+      itext.append(L", from the overflow buffer");
+
+      CHECK(text == L"Hello World, from the overflow buffer");
+      CHECK(text.is_overflowed());
+      CHECK(!text.truncated());
+      CHECK(text.data() == overflow);
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.capacity());
+
+      text.assign(100U, L'x');
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.size());
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_pool)
+    {
+      typedef std::array<wchar_t, 1024> block_t;
+
+      etl::pool<block_t, 1> pool;
+
+      {
+        etl::wstring_hybrid<SIZE> text(L"Hello", pool);
+
+        text.insert(text.begin(), 1000U, L'x');
+        CHECK(text.is_overflowed());
+        CHECK_EQUAL(1005U, text.size());
+        CHECK(!text.truncated());
+        CHECK_EQUAL(0U, pool.available());
+
+        text.erase(0U, 1000U);
+        text.shrink_to_fit();
+        CHECK(!text.is_overflowed());
+        CHECK(text == L"Hello");
+        CHECK_EQUAL(1U, pool.available());
+
+        text.resize(1000U, L'y');
+        CHECK(text.is_overflowed());
+      }
+
+      // The destructor returns the block.
+      CHECK_EQUAL(1U, pool.available());
+    }
+  };
+
+  SUITE(test_u16string_hybrid)
+  {
+    static const size_t SIZE = 11;
+
+    //*************************************************************************
+    TEST(test_overflow_to_buffer)
+    {
+      char16_t overflow[64];
+      etl::u16string_hybrid<SIZE> text(u"Hello", overflow, etl::size(overflow));
+
+      text.append(u" World");
+      CHECK(!text.is_overflowed());
+      CHECK_EQUAL(SIZE, text.capacity());
+
+      etl::iu16string& itext = text;
+      itext.append(u", from the overflow buffer");
+
+      CHECK(text == u"Hello World, from the overflow buffer");
+      CHECK(text.is_overflowed());
+      CHECK(!text.truncated());
+      CHECK(text.data() == overflow);
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.capacity());
+
+      text.assign(100U, u'x');
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.size());
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_pool)
+    {
+      typedef std::array<char16_t, 1024> block_t;
+
+      etl::pool<block_t, 1> pool;
+
+      {
+        etl::u16string_hybrid<SIZE> text(u"Hello", pool);
+
+        text.insert(text.begin(), 1000U, u'x');
+        CHECK(text.is_overflowed());
+        CHECK_EQUAL(1005U, text.size());
+        CHECK(!text.truncated());
+        CHECK_EQUAL(0U, pool.available());
+
+        text.erase(0U, 1000U);
+        text.shrink_to_fit();
+        CHECK(!text.is_overflowed());
+        CHECK(text == u"Hello");
+        CHECK_EQUAL(1U, pool.available());
+
+        text.resize(1000U, u'y');
+        CHECK(text.is_overflowed());
+      }
+
+      // The destructor returns the block.
+      CHECK_EQUAL(1U, pool.available());
+    }
+  };
+
+  SUITE(test_u32string_hybrid)
+  {
+    static const size_t SIZE = 11;
+
+    //*************************************************************************
+    TEST(test_overflow_to_buffer)
+    {
+      char32_t overflow[64];
+      etl::u32string_hybrid<SIZE> text(U"Hello", overflow, etl::size(overflow));
+
+      text.append(U" World");
+      CHECK(!text.is_overflowed());
+      CHECK_EQUAL(SIZE, text.capacity());
+
+      etl::iu32string& itext = text;
+      itext.append(U", from the overflow buffer");
+
+      CHECK(text == U"Hello World, from the overflow buffer");
+      CHECK(text.is_overflowed());
+      CHECK(!text.truncated());
+      CHECK(text.data() == overflow);
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.capacity());
+
+      text.assign(100U, U'x');
+      CHECK_EQUAL(etl::size(overflow) - 1U, text.size());
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_pool)
+    {
+      typedef std::array<char32_t, 1024> block_t;
+
+      etl::pool<block_t, 1> pool;
+
+      {
+        etl::u32string_hybrid<SIZE> text(U"Hello", pool);
+
+        text.insert(text.begin(), 1000U, U'x');
+        CHECK(text.is_overflowed());
+        CHECK_EQUAL(1005U, text.size());
+        CHECK(!text.truncated());
+        CHECK_EQUAL(0U, pool.available());
+
+        text.erase(0U, 1000U);
+        text.shrink_to_fit();
+        CHECK(!text.is_overflowed());
+        CHECK(text == U"Hello");
+        CHECK_EQUAL(1U, pool.available());
+
+        text.resize(1000U, U'y');
+        CHECK(text.is_overflowed());
+      }
+
+      // The destructor returns the block.
+      CHECK_EQUAL(1U, pool.available());
+    }
+  };
+}
@@ -0,0 +1,164 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/string_intern_pool.h"
+#include "etl/cstring.h"
+
+#include <stdio.h>
+#include <string>
+
+namespace
+{
+  typedef etl::string_intern_pool<256, 16> Pool;
+
+  SUITE(test_string_intern_pool)
+  {
+    //*************************************************************************
+    TEST(test_intern_and_find)
+    {
+      Pool pool;
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(1U, sizeof(Pool::id_type));
+
+      const Pool::id_type temperature = pool.intern("sensors/temperature");
+      const Pool::id_type humidity    = pool.intern("sensors/humidity");
+
+      CHECK_EQUAL(0U, temperature);
+      CHECK_EQUAL(1U, humidity);
+      CHECK_EQUAL(2U, pool.size());
+
+      // The same string gives the same id, without storing it again.
+      const size_t used = pool.chars_used();
+      CHECK_EQUAL(temperature, pool.intern(etl::string<32>("sensors/temperature")));
+      CHECK_EQUAL(used, pool.chars_used());
+      CHECK_EQUAL(2U, pool.size());
+
+      CHECK_EQUAL(humidity, pool.find("sensors/humidity"));
+      CHECK_EQUAL(Pool::npos, pool.find("sensors/pressure"));
+      CHECK(pool.contains("sensors/temperature"));
+      CHECK(!pool.contains("sensors/temp"));
+
+      CHECK(pool[temperature] == etl::string_view("sensors/temperature"));
+      CHECK(pool.view(humidity) == etl::string_view("sensors/humidity"));
+      CHECK_EQUAL(std::string("sensors/humidity"), std::string(pool.c_str(humidity)));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_and_prefix_strings)
+    {
+      Pool pool;
+
+      const Pool::id_type empty = pool.intern("");
+      const Pool::id_type a     = pool.intern("a");
+      const Pool::id_type ab    = pool.intern("ab");
+
+      CHECK(empty != a);
+      CHECK(a != ab);
+      CHECK_EQUAL(empty, pool.intern(etl::string_view()));
+      CHECK_EQUAL(0U, pool.view(empty).size());
+      CHECK_EQUAL(1U, pool.view(a).size());
+      CHECK_EQUAL(2U, pool.view(ab).size());
+      CHECK_EQUAL(1U + 2U + 3U, pool.chars_used());
+    }
+
+    //*************************************************************************
+    TEST(test_full_entries)
+    {
+      Pool pool;
+      char text[8];
+
+      for (int i = 0; i < 16; ++i)
+      {
+        snprintf(text, sizeof(text), "t%d", i);
+        CHECK_EQUAL(i, int(pool.intern(text)));
+      }
+
+      CHECK(pool.full());
+      CHECK_EQUAL(Pool::npos, pool.intern("new"));
+
+      // Existing strings are still found.
+      for (int i = 0; i < 16; ++i)
+      {
+        snprintf(text, sizeof(text), "t%d", i);
+        CHECK_EQUAL(i, int(pool.intern(text)));
+        CHECK(pool.view(Pool::id_type(i)) == etl::string_view(text));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_full_chars)
+    {
+      etl::string_intern_pool<10, 8> pool;
+
+      CHECK_EQUAL(0U, pool.intern("abcd"));
+      CHECK_EQUAL(1U, pool.intern("efgh"));
+      CHECK_EQUAL(0U, pool.chars_available());
+      CHECK(pool.full());
+      CHECK_EQUAL((etl::string_intern_pool<10, 8>::npos), pool.intern("i"));
+      CHECK_EQUAL(1U, pool.intern("efgh"));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Pool pool;
+
+      pool.intern("one");
+      pool.intern("two");
+      pool.clear();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(0U, pool.chars_used());
+      CHECK_EQUAL(Pool::npos, pool.find("one"));
+      CHECK_EQUAL(0U, pool.intern("two"));
+    }
+
+    //*************************************************************************
+    TEST(test_many)
+    {
+      static etl::string_intern_pool<20000, 1000> pool;
+      char text[32];
+
+      for (int round = 0; round < 2; ++round)
+      {
+        for (int i = 0; i < 1000; ++i)
+        {
+          snprintf(text, sizeof(text), "topic/%d/value", i * 7919);
+          CHECK_EQUAL(i, int(pool.intern(text)));
+        }
+      }
+
+      CHECK_EQUAL(2U, sizeof(etl::string_intern_pool<20000, 1000>::id_type));
+      CHECK_EQUAL(1000U, pool.size());
+    }
+  }
+}
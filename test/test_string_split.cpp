@@ -0,0 +1,166 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/string_split.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef std::vector<std::string> Tokens;
+
+  //*************************************************************************
+  template <typename TRange>
+  Tokens collect(const TRange& range)
+  {
+    Tokens tokens;
+
+    for (typename TRange::iterator itr = range.begin(); itr != range.end(); ++itr)
+    {
+      tokens.push_back(std::string(itr->data(), itr->size()));
+    }
+
+    return tokens;
+  }
+
+  //*************************************************************************
+  Tokens make(const char* a, const char* b = nullptr, const char* c = nullptr, const char* d = nullptr, const char* e = nullptr)
+  {
+    const char* all[] = { a, b, c, d, e };
+    Tokens tokens;
+
+    for (size_t i = 0U; (i < 5U) && (all[i] != nullptr); ++i)
+    {
+      tokens.push_back(all[i]);
+    }
+
+    return tokens;
+  }
+
+  SUITE(test_string_split)
+  {
+    //*************************************************************************
+    TEST(test_single_delimiter)
+    {
+      const etl::string_view text("a,bc,,d");
+
+      CHECK(make("a", "bc", "", "d") == collect(etl::split(text, ',')));
+      CHECK_EQUAL(4U, etl::split(text, ',').count());
+
+      // The tokens refer to the text.
+      etl::split_range<etl::private_string_split::single_delimiter<char> > range = etl::split(text, ',');
+      CHECK(text.data() == (*range.begin()).data());
+      CHECK((text.data() + 2) == (*++range.begin()).data());
+    }
+
+    //*************************************************************************
+    TEST(test_edges)
+    {
+      CHECK(make("") == collect(etl::split(etl::string_view(""), ',')));
+      CHECK(make("") == collect(etl::split(etl::string_view(), ',')));
+      CHECK(make("", "") == collect(etl::split(etl::string_view(","), ',')));
+      CHECK(make("", "a", "") == collect(etl::split(etl::string_view(",a,"), ',')));
+      CHECK(make("abc") == collect(etl::split(etl::string_view("abc"), ',')));
+    }
+
+    //*************************************************************************
+    TEST(test_delimiter_set)
+    {
+      const etl::string_view text("set x=1;\ty=2");
+
+      CHECK(make("set", "x", "1", "", "y=2") == collect(etl::split(text, " =;\t", 4U)));
+      CHECK(make("set x", "1;\ty", "2") == collect(etl::split(text, etl::string_view("="))));
+      CHECK(make("set", "x", "1", "y", "2") == collect(etl::split(text, " =;\t", etl::integral_limits<size_t>::max, true)));
+
+      // Bytes with the top bit set.
+      const etl::string_view high("a\xF0" "b\x80" "c");
+      CHECK(make("a", "b", "c") == collect(etl::split(high, "\x80\xF0")));
+    }
+
+    //*************************************************************************
+    TEST(test_max_splits)
+    {
+      const etl::string_view text("cmd arg1 arg2 arg3");
+
+      CHECK(make("cmd arg1 arg2 arg3") == collect(etl::split(text, ' ', 0U)));
+      CHECK(make("cmd", "arg1 arg2 arg3") == collect(etl::split(text, ' ', 1U)));
+      CHECK(make("cmd", "arg1", "arg2 arg3") == collect(etl::split(text, ' ', 2U)));
+      CHECK(make("cmd", "arg1", "arg2", "arg3") == collect(etl::split(text, ' ', 10U)));
+    }
+
+    //*************************************************************************
+    TEST(test_skip_empty)
+    {
+      const etl::string_view text("  set   speed  100  ");
+
+      CHECK(make("set", "speed", "100") == collect(etl::split(text, ' ', etl::integral_limits<size_t>::max, true)));
+      CHECK(make("set", "speed  100  ") == collect(etl::split(text, ' ', 1U, true)));
+      CHECK(collect(etl::split(etl::string_view("   "), ' ', etl::integral_limits<size_t>::max, true)).empty());
+      CHECK(collect(etl::split(etl::string_view(""), ' ', etl::integral_limits<size_t>::max, true)).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      etl::string<32> line("one two");
+      etl::split_range<etl::private_string_split::single_delimiter<char> > range = etl::split(etl::string_view(line), ' ');
+
+      etl::split_range<etl::private_string_split::single_delimiter<char> >::iterator itr = range.begin();
+      etl::split_range<etl::private_string_split::single_delimiter<char> >::iterator copy = itr++;
+
+      CHECK(copy == range.begin());
+      CHECK(itr != copy);
+      CHECK(*itr == etl::string_view("two"));
+      CHECK(++itr == range.end());
+      CHECK(itr == range.end());
+    }
+
+    //*************************************************************************
+    TEST(test_wide)
+    {
+      const etl::wstring_view text(L"a;b,c");
+      size_t n = 0U;
+
+      for (etl::split_range<etl::private_string_split::set_delimiter<wchar_t>, wchar_t>::iterator itr = etl::split(text, L";,").begin();
+           itr != etl::split_range<etl::private_string_split::set_delimiter<wchar_t>, wchar_t>::iterator();
+           ++itr)
+      {
+        CHECK_EQUAL(1U, itr->size());
+        ++n;
+      }
+
+      CHECK_EQUAL(3U, n);
+    }
+  }
+}
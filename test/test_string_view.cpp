@@ -879,5 +879,29 @@ namespace
       CHECK_EQUAL(etl::hash<U16Text>()(u16text), etl::hash<U16View>()(u16view));
       CHECK_EQUAL(etl::hash<U32Text>()(u32text), etl::hash<U32View>()(u32view));
     }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr etl::string_view view("Hello World");
+      constexpr etl::string_view hello = view.substr(0, 5);
+
+      static_assert(view.size() == 11U, "size");
+      static_assert(view.front() == 'H', "front");
+      static_assert(view[6] == 'W', "operator[]");
+      static_assert(view.find('W') == 6U, "find char");
+      static_assert(view.find("World") == 6U, "find text");
+      static_assert(view.find("Earth") == etl::string_view::npos, "find text");
+      static_assert(view.starts_with(hello), "starts_with");
+      static_assert(view.ends_with("World"), "ends_with");
+      static_assert(hello.compare("Hello") == 0, "compare");
+      static_assert(hello.compare("Help") < 0, "compare");
+      static_assert(hello == etl::string_view("Hello"), "operator ==");
+      static_assert(hello < view, "operator <");
+
+      CHECK_EQUAL(5U, hello.size());
+    }
+#endif
   };
 }
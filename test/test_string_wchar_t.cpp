@@ -3577,7 +3577,7 @@ namespace
       // Test with actual string type.
       Text text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::hash_string(text.data(), text.size());
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
@@ -3802,5 +3802,22 @@ namespace
       // Check there no non-zero values in the remainder of the string.
       CHECK(std::find_if(pb, pe, [](Text::value_type x) { return x != 0; }) == pe);
     }
+
+    //*************************************************************************
+    TEST(test_wstring_ext)
+    {
+      etl::wstring_ext::value_type buffer[8];
+
+      etl::wstring_ext text(L"Hello", buffer, 8U);
+      etl::iwstring& itext = text;
+
+      CHECK_EQUAL(7U, itext.max_size());
+      CHECK(itext.data() == buffer);
+      CHECK(itext == etl::wstring<8>(L"Hello"));
+
+      itext.append(L"World");
+      CHECK(itext.truncated());
+      CHECK(itext == etl::wstring<8>(L"HelloWo"));
+    }
 };
 }
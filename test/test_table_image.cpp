@@ -0,0 +1,173 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/table_image.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  struct Record
+  {
+    uint16_t id;
+    uint32_t value;
+  };
+
+  //***************************************************************************
+  // Storage aligned for any of the element types.
+  //***************************************************************************
+  union Buffer
+  {
+    uint64_t align;
+    char     data[256];
+  };
+
+  SUITE(test_table_image)
+  {
+    //*************************************************************************
+    TEST(test_size)
+    {
+      CHECK_EQUAL(sizeof(etl::table_image_header), etl::table_image_size<char>(0U));
+      CHECK_EQUAL(sizeof(etl::table_image_header) + (3U * sizeof(Record)), etl::table_image_size<Record>(3U));
+      CHECK_EQUAL(0U, etl::table_image_size<uint64_t>(0U) % 8U);
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      const Record records[] = { { 1U, 10U }, { 2U, 20U }, { 3U, 30U } };
+
+      Buffer buffer;
+      size_t length = etl::write_table_image<Record>(buffer.data, sizeof(buffer.data), records, records + 3, 42U);
+
+      CHECK_EQUAL(etl::table_image_size<Record>(3U), length);
+      CHECK(etl::is_valid_table_image<Record>(buffer.data, length, 42U));
+
+      etl::array_view<const Record> view = etl::table_image_view<Record>(buffer.data, length, 42U);
+
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(2U,  view[1].id);
+      CHECK_EQUAL(30U, view[2].value);
+
+      // Used in place, not copied.
+      CHECK(static_cast<const void*>(view.data()) > static_cast<const void*>(buffer.data));
+      CHECK(static_cast<const void*>(view.data()) < static_cast<const void*>(buffer.data + length));
+    }
+
+    //*************************************************************************
+    TEST(test_relocatable)
+    {
+      const uint32_t values[] = { 5U, 6U, 7U };
+
+      Buffer buffer;
+      size_t length = etl::write_table_image<uint32_t>(buffer.data, sizeof(buffer.data), values, values + 3);
+
+      std::vector<uint64_t> moved((length / sizeof(uint64_t)) + 1U);
+      memcpy(&moved[0], buffer.data, length);
+
+      etl::array_view<const uint32_t> view = etl::table_image_view<uint32_t>(&moved[0], length);
+
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(7U, view[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_empty_image)
+    {
+      Buffer buffer;
+      const uint32_t* none = nullptr;
+      size_t length = etl::write_table_image<uint32_t>(buffer.data, sizeof(buffer.data), none, none);
+
+      CHECK_EQUAL(sizeof(etl::table_image_header), length);
+
+      etl::array_view<const uint32_t> view = etl::table_image_view<uint32_t>(buffer.data, length);
+      CHECK(view.data() != nullptr);
+      CHECK(view.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_too_small)
+    {
+      const uint32_t values[] = { 5U, 6U, 7U };
+
+      Buffer buffer;
+      CHECK_EQUAL(0U, etl::write_table_image<uint32_t>(buffer.data, etl::table_image_size<uint32_t>(2U), values, values + 3));
+      CHECK_EQUAL(0U, etl::write_table_image<uint32_t>(buffer.data, 4U, values, values));
+
+      etl::table_image_writer<uint32_t> writer(buffer.data, etl::table_image_size<uint32_t>(1U));
+      CHECK(writer.push_back(1U));
+      CHECK(!writer.push_back(2U));
+      CHECK_EQUAL(1U, writer.size());
+      CHECK_EQUAL(0U, writer.finish());
+    }
+
+    //*************************************************************************
+    TEST(test_rejects_invalid_images)
+    {
+      const uint32_t values[] = { 5U, 6U, 7U };
+
+      Buffer buffer;
+      size_t length = etl::write_table_image<uint32_t>(buffer.data, sizeof(buffer.data), values, values + 3, 1U);
+
+      // Wrong type id.
+      CHECK(!etl::is_valid_table_image<uint32_t>(buffer.data, length, 2U));
+      CHECK(etl::table_image_view<uint32_t>(buffer.data, length, 2U).data() == nullptr);
+
+      // Wrong element type.
+      CHECK(!etl::is_valid_table_image<uint16_t>(buffer.data, length, 1U));
+
+      // Truncated.
+      CHECK(!etl::is_valid_table_image<uint32_t>(buffer.data, length - 1U, 1U));
+      CHECK(!etl::is_valid_table_image<uint32_t>(buffer.data, 4U, 1U));
+      CHECK(!etl::is_valid_table_image<uint32_t>(nullptr, length, 1U));
+
+      // Misaligned.
+      Buffer moved;
+      memcpy(moved.data + 1, buffer.data, length);
+      CHECK(!etl::is_valid_table_image<uint32_t>(moved.data + 1, length, 1U));
+
+      // Corrupt count.
+      etl::table_image_header header;
+      memcpy(&header, buffer.data, sizeof(header));
+      header.count = 0xFFFFFFFFUL;
+      memcpy(buffer.data, &header, sizeof(header));
+      CHECK(!etl::is_valid_table_image<uint32_t>(buffer.data, length, 1U));
+
+      // Byte swapped magic, as written by a machine of the other byte order.
+      header.count = 3U;
+      header.magic = 0x45544C54UL;
+      memcpy(buffer.data, &header, sizeof(header));
+      CHECK(!etl::is_valid_table_image<uint32_t>(buffer.data, length, 1U));
+    }
+  };
+}
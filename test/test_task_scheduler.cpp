@@ -156,6 +156,92 @@ typedef etl::scheduler<etl::scheduler_policy_sequencial_multiple, sizeof(etl::ar
 typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
 typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
 
+//*****************************************************************************
+// A simulated clock for the earliest deadline first policy.
+//*****************************************************************************
+struct Clock
+{
+  static uint32_t now()
+  {
+    return ticks;
+  }
+
+  static uint32_t ticks;
+};
+
+uint32_t Clock::ticks = 0U;
+
+typedef etl::scheduler<etl::scheduler_policy_earliest_deadline_first<Clock>, 4> SchedulerEarliestDeadlineFirst;
+
+//*****************************************************************************
+class DeadlineTask : public etl::deadline_task
+{
+public:
+
+  //*********************************************
+  DeadlineTask(char name_, uint32_t period_, uint32_t cost_, std::string& log_)
+    : deadline_task(0, period_, period_),
+      name(name_),
+      cost(cost_),
+      jobs(0U),
+      log(log_)
+  {
+  }
+
+  //*********************************************
+  uint32_t task_request_work() const
+  {
+    return 1U;
+  }
+
+  //*********************************************
+  void task_process_work()
+  {
+    log += name;
+    ++jobs;
+    Clock::ticks += cost;
+  }
+
+  char         name;
+  uint32_t     cost;
+  uint32_t     jobs;
+  std::string& log;
+};
+
+//*****************************************************************************
+// Runs the scheduler until the clock reaches the horizon.
+//*****************************************************************************
+struct DeadlineRunner
+{
+  DeadlineRunner(etl::ischeduler& scheduler_, uint32_t horizon_)
+    : idle_callback(*this, &DeadlineRunner::Idle),
+      watchdog_callback(*this, &DeadlineRunner::Watchdog),
+      scheduler(scheduler_),
+      horizon(horizon_)
+  {
+    scheduler.set_idle_callback(idle_callback);
+    scheduler.set_watchdog_callback(watchdog_callback);
+  }
+
+  void Idle()
+  {
+    ++Clock::ticks;
+  }
+
+  void Watchdog()
+  {
+    if (Clock::ticks >= horizon)
+    {
+      scheduler.exit_scheduler();
+    }
+  }
+
+  etl::function<DeadlineRunner, void> idle_callback;
+  etl::function<DeadlineRunner, void> watchdog_callback;
+  etl::ischeduler& scheduler;
+  uint32_t horizon;
+};
+
 namespace
 {
   SUITE(test_task_scheduler)
@@ -259,5 +345,64 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //*************************************************************************
+    TEST(test_scheduler_earliest_deadline_first)
+    {
+      SchedulerEarliestDeadlineFirst s;
+      std::string log;
+
+      Clock::ticks = 0U;
+
+      // Utilisation 1/4 + 2/6 + 4/12 = 11/12
+      DeadlineTask a('A', 4, 1, log);
+      DeadlineTask b('B', 6, 2, log);
+      DeadlineTask c('C', 12, 4, log);
+
+      // Added in an order unrelated to the deadlines.
+      s.add_task(c);
+      s.add_task(a);
+      s.add_task(b);
+
+      DeadlineRunner runner(s, 120U);
+      s.start();
+
+      // The earliest deadlines run first.
+      CHECK_EQUAL(std::string("ABC"), log.substr(0, 3));
+
+      // Every release before the horizon, and A's at the horizon, which runs before the exit check.
+      CHECK_EQUAL(31U, a.jobs);
+      CHECK_EQUAL(20U, b.jobs);
+      CHECK_EQUAL(10U, c.jobs);
+
+      CHECK_EQUAL(0U, a.get_deadline_misses());
+      CHECK_EQUAL(0U, b.get_deadline_misses());
+      CHECK_EQUAL(0U, c.get_deadline_misses());
+      CHECK_EQUAL(0U, s.get_policy().get_deadline_misses());
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_earliest_deadline_first_overload)
+    {
+      SchedulerEarliestDeadlineFirst s;
+      std::string log;
+
+      Clock::ticks = 0U;
+
+      // Utilisation 2/4 + 4/6 > 1
+      DeadlineTask a('A', 4, 2, log);
+      DeadlineTask b('B', 6, 4, log);
+
+      s.add_task(a);
+      s.add_task(b);
+
+      DeadlineRunner runner(s, 120U);
+      s.start();
+
+      const uint32_t misses = a.get_deadline_misses() + b.get_deadline_misses();
+
+      CHECK(misses > 0U);
+      CHECK_EQUAL(misses, s.get_policy().get_deadline_misses());
+    }
   };
 }
@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/tdigest.h"
+#include "etl/random.h"
+
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  typedef etl::tdigest<200> Digest;
+
+  //*************************************************************************
+  double exact_quantile(std::vector<double> values, double q)
+  {
+    std::sort(values.begin(), values.end());
+    size_t i = size_t(q * double(values.size()));
+    i = (i >= values.size()) ? values.size() - 1U : i;
+
+    return values[i];
+  }
+
+  SUITE(test_tdigest)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      Digest digest;
+
+      CHECK(digest.empty());
+      CHECK_EQUAL(0.0, digest.count());
+      CHECK_EQUAL(0.0, digest.quantile(0.5));
+      CHECK_EQUAL(0U, digest.size());
+    }
+
+    //*************************************************************************
+    TEST(test_single_value)
+    {
+      Digest digest;
+
+      digest.add(42.0);
+
+      CHECK(!digest.empty());
+      CHECK_EQUAL(1.0, digest.count());
+      CHECK_EQUAL(42.0, digest.quantile(0.0));
+      CHECK_EQUAL(42.0, digest.quantile(0.5));
+      CHECK_EQUAL(42.0, digest.quantile(1.0));
+      CHECK_EQUAL(42.0, digest.min());
+      CHECK_EQUAL(42.0, digest.max());
+    }
+
+    //*************************************************************************
+    TEST(test_uniform_quantiles)
+    {
+      Digest digest;
+      etl::random_xorshift random(1234U);
+      std::vector<double> values;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        double value = double(random.range(0U, 1000000U)) / 1000.0;
+        digest.add(value);
+        values.push_back(value);
+      }
+
+      CHECK_EQUAL(100000.0, digest.count());
+      CHECK(digest.size() <= Digest::CAPACITY);
+
+      const double qs[] = { 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 };
+
+      for (size_t i = 0U; i < sizeof(qs) / sizeof(qs[0]); ++i)
+      {
+        CHECK_CLOSE(exact_quantile(values, qs[i]), digest.quantile(qs[i]), 10.0); // 1% of the range
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_tail_accuracy_for_skewed_latencies)
+    {
+      Digest digest;
+      etl::random_xorshift random(42U);
+      std::vector<double> values;
+
+      // Exponentially distributed latencies with a mean of 100.
+      for (int i = 0; i < 50000; ++i)
+      {
+        double u     = (double(random.range(1U, 1000000U))) / 1000001.0;
+        double value = -100.0 * ::log(u);
+        digest.add(value);
+        values.push_back(value);
+      }
+
+      double p99  = exact_quantile(values, 0.99);
+      double p999 = exact_quantile(values, 0.999);
+
+      CHECK_CLOSE(p99,  digest.quantile(0.99),  p99 * 0.02);
+      CHECK_CLOSE(p999, digest.quantile(0.999), p999 * 0.05);
+    }
+
+    //*************************************************************************
+    TEST(test_centroids_stay_bounded)
+    {
+      Digest digest;
+
+      for (int i = 0; i < 200000; ++i)
+      {
+        digest.add(double(i % 977));
+      }
+
+      CHECK(digest.size() <= Digest::CAPACITY);
+
+      const Digest::centroid_type* centroids = digest.data();
+
+      double total = 0.0;
+
+      for (size_t i = 0U; i < digest.size(); ++i)
+      {
+        total += centroids[i].weight;
+
+        if (i > 0U)
+        {
+          CHECK(centroids[i - 1U].mean <= centroids[i].mean);
+        }
+      }
+
+      CHECK_EQUAL(200000.0, total);
+      CHECK_EQUAL(0.0,   digest.min());
+      CHECK_EQUAL(976.0, digest.max());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      Digest low;
+      Digest high;
+      Digest all;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        low.add(double(i));
+        high.add(double(i + 10000));
+        all.add(double(i));
+        all.add(double(i + 10000));
+      }
+
+      low.merge(high);
+
+      CHECK_EQUAL(20000.0, low.count());
+      CHECK_EQUAL(0.0,     low.min());
+      CHECK_EQUAL(19999.0, low.max());
+
+      const double qs[] = { 0.01, 0.25, 0.5, 0.75, 0.99 };
+
+      for (size_t i = 0U; i < sizeof(qs) / sizeof(qs[0]); ++i)
+      {
+        CHECK_CLOSE(all.quantile(qs[i]), low.quantile(qs[i]), 200.0); // 1% of the range
+        CHECK_CLOSE(qs[i] * 20000.0, low.quantile(qs[i]), 200.0);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_in_to_empty)
+    {
+      Digest empty;
+      Digest other;
+
+      other.add(-5.0);
+      other.add(7.0);
+
+      empty.merge(other);
+
+      CHECK_EQUAL(2.0,  empty.count());
+      CHECK_EQUAL(-5.0, empty.min());
+      CHECK_EQUAL(7.0,  empty.max());
+    }
+
+    //*************************************************************************
+    TEST(test_weighted_add)
+    {
+      Digest digest;
+
+      digest.add(1.0, 99.0);
+      digest.add(1000.0, 1.0);
+      digest.add(5.0, 0.0); // Ignored
+
+      CHECK_EQUAL(100.0, digest.count());
+      CHECK_CLOSE(1.0, digest.quantile(0.25), 1e-9);
+      CHECK_EQUAL(1000.0, digest.max());
+    }
+
+    //*************************************************************************
+    TEST(test_cdf)
+    {
+      Digest digest;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        digest.add(double(i));
+      }
+
+      CHECK_EQUAL(0.0, digest.cdf(-1.0));
+      CHECK_EQUAL(1.0, digest.cdf(10000.0));
+      CHECK_CLOSE(0.25, digest.cdf(2500.0), 0.01);
+      CHECK_CLOSE(0.5,  digest.cdf(5000.0), 0.01);
+      CHECK_CLOSE(0.99, digest.cdf(9900.0), 0.002);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Digest digest;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        digest.add(double(i));
+      }
+
+      digest.clear();
+
+      CHECK(digest.empty());
+      CHECK_EQUAL(0.0, digest.count());
+
+      digest.add(3.0);
+      CHECK_EQUAL(3.0, digest.quantile(0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_float_values)
+    {
+      etl::tdigest<50, 64, float> digest;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        digest.add(float(i));
+      }
+
+      CHECK_CLOSE(500.0f, digest.quantile(0.5f), 10.0f);
+      CHECK_CLOSE(990.0f, digest.quantile(0.99f), 5.0f);
+    }
+  }
+}
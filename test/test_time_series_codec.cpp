@@ -0,0 +1,284 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/time_series_codec.h"
+#include "etl/zigzag.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+namespace
+{
+  //*************************************************************************
+  template <typename TEncoder, typename T>
+  size_t encode(etl::bit_stream& stream, const std::vector<T>& values)
+  {
+    TEncoder encoder;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      if (!encoder.add(stream, values[i]))
+      {
+        return 0U;
+      }
+    }
+
+    return stream.bits();
+  }
+
+  //*************************************************************************
+  template <typename TEncoder, typename TDecoder, typename T>
+  bool round_trip(const std::vector<T>& values, size_t& bits)
+  {
+    std::vector<unsigned char> buffer(values.size() * 16U + 16U);
+    etl::bit_stream stream(buffer.data(), buffer.size());
+
+    bits = encode<TEncoder>(stream, values);
+
+    if (bits == 0U)
+    {
+      return false;
+    }
+
+    stream.restart();
+
+    TDecoder decoder;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      T value;
+
+      if (!decoder.get(stream, value) || (memcmp(&value, &values[i], sizeof(T)) != 0))
+      {
+        return false;
+      }
+    }
+
+    return (stream.bits() == bits) && (decoder.count() == values.size());
+  }
+
+  SUITE(test_time_series_codec)
+  {
+    //*************************************************************************
+    TEST(test_zigzag)
+    {
+      CHECK_EQUAL(0U, etl::zigzag_encode(int32_t(0)));
+      CHECK_EQUAL(1U, etl::zigzag_encode(int32_t(-1)));
+      CHECK_EQUAL(2U, etl::zigzag_encode(int32_t(1)));
+      CHECK_EQUAL(3U, etl::zigzag_encode(int32_t(-2)));
+      CHECK_EQUAL(0xFFFFFFFEUL, etl::zigzag_encode(int32_t(INT32_MAX)));
+      CHECK_EQUAL(0xFFFFFFFFUL, etl::zigzag_encode(int32_t(INT32_MIN)));
+      CHECK(UINT64_MAX == etl::zigzag_encode(int64_t(INT64_MIN)));
+
+      const int64_t values[] = { 0, 1, -1, 1000, -1000, INT64_MAX, INT64_MIN };
+
+      for (size_t i = 0U; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        CHECK(values[i] == etl::zigzag_decode(etl::zigzag_encode(values[i])));
+        CHECK_EQUAL(int32_t(values[i]), etl::zigzag_decode(etl::zigzag_encode(int32_t(values[i]))));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_delta_round_trip)
+    {
+      std::vector<int32_t> values;
+      int32_t value = -5000;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        value += (i % 7) - 3;
+        values.push_back(value);
+      }
+
+      size_t bits;
+      CHECK((round_trip<etl::delta_encoder<int32_t>, etl::delta_decoder<int32_t> >(values, bits)));
+
+      // 32 bits for the first, then a byte each.
+      CHECK_EQUAL(32U + (999U * 8U), bits);
+    }
+
+    //*************************************************************************
+    TEST(test_delta_wraps_at_width)
+    {
+      std::vector<uint16_t> values;
+      values.push_back(65534U);
+      values.push_back(65535U);
+      values.push_back(0U);
+      values.push_back(1U);
+      values.push_back(65535U);
+
+      size_t bits;
+      CHECK((round_trip<etl::delta_encoder<uint16_t>, etl::delta_decoder<uint16_t> >(values, bits)));
+      CHECK_EQUAL(16U + (4U * 8U), bits);
+
+      std::vector<int64_t> extremes;
+      extremes.push_back(INT64_MIN);
+      extremes.push_back(INT64_MAX);
+      extremes.push_back(0);
+      extremes.push_back(INT64_MIN);
+
+      CHECK((round_trip<etl::delta_encoder<int64_t>, etl::delta_decoder<int64_t> >(extremes, bits)));
+    }
+
+    //*************************************************************************
+    TEST(test_delta_of_delta_regular_timestamps)
+    {
+      std::vector<uint64_t> values;
+
+      for (uint64_t i = 0U; i < 1000U; ++i)
+      {
+        values.push_back(1700000000000ULL + (i * 1000U));
+      }
+
+      size_t bits;
+      CHECK((round_trip<etl::delta_of_delta_encoder<uint64_t>, etl::delta_of_delta_decoder<uint64_t> >(values, bits)));
+
+      // 64 bits for the first, 16 bits for the first delta, then one bit each.
+      CHECK_EQUAL(64U + 16U + 998U, bits);
+    }
+
+    //*************************************************************************
+    TEST(test_delta_of_delta_every_bucket)
+    {
+      std::vector<int64_t> values;
+      values.push_back(0);
+
+      const int64_t changes[] = { 0, 1, -1, 63, -64, 64, 255, -256, 256, 2047, -2048, 2048,
+                                  INT32_MAX, INT32_MIN, int64_t(INT32_MAX) + 1, INT64_MAX, INT64_MIN, 0 };
+
+      int64_t delta = 0;
+
+      for (size_t i = 0U; i < sizeof(changes) / sizeof(changes[0]); ++i)
+      {
+        delta = int64_t(uint64_t(delta) + uint64_t(changes[i]));
+        values.push_back(int64_t(uint64_t(values.back()) + uint64_t(delta)));
+      }
+
+      size_t bits;
+      CHECK((round_trip<etl::delta_of_delta_encoder<int64_t>, etl::delta_of_delta_decoder<int64_t> >(values, bits)));
+
+      std::vector<uint8_t> bytes;
+
+      for (int i = 0; i < 600; ++i)
+      {
+        bytes.push_back(uint8_t((i * i) ^ (i >> 3)));
+      }
+
+      CHECK((round_trip<etl::delta_of_delta_encoder<uint8_t>, etl::delta_of_delta_decoder<uint8_t> >(bytes, bits)));
+    }
+
+    //*************************************************************************
+    TEST(test_xor_double_slowly_changing)
+    {
+      std::vector<double> values;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        values.push_back(20.0 + double((i / 10) % 8) * 0.5);
+      }
+
+      size_t bits;
+      CHECK((round_trip<etl::xor_encoder<double>, etl::xor_decoder<double> >(values, bits)));
+
+      // Mostly repeated values.
+      CHECK(bits < (values.size() * 64U) / 10U);
+    }
+
+    //*************************************************************************
+    TEST(test_xor_special_values)
+    {
+      std::vector<double> values;
+      values.push_back(0.0);
+      values.push_back(-0.0);
+      values.push_back(1.0);
+      values.push_back(HUGE_VAL);
+      values.push_back(-HUGE_VAL);
+      values.push_back(1e-310);
+      values.push_back(3.14159);
+      values.push_back(3.14159);
+      values.push_back(-1e300);
+
+      size_t bits;
+      CHECK((round_trip<etl::xor_encoder<double>, etl::xor_decoder<double> >(values, bits)));
+
+      std::vector<float> floats;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        floats.push_back(float(sin(i * 0.01)) * 100.0f);
+      }
+
+      floats.push_back(-0.0f);
+      floats.push_back(1e-40f);
+
+      CHECK((round_trip<etl::xor_encoder<float>, etl::xor_decoder<float> >(floats, bits)));
+    }
+
+    //*************************************************************************
+    TEST(test_stream_full)
+    {
+      unsigned char buffer[4];
+      etl::bit_stream stream(buffer, sizeof(buffer));
+
+      etl::delta_of_delta_encoder<uint32_t> encoder;
+
+      CHECK(encoder.add(stream, 1000U));
+      CHECK(!encoder.add(stream, 1000000U));
+      CHECK_EQUAL(1U, encoder.count());
+
+      encoder.reset();
+      CHECK_EQUAL(0U, encoder.count());
+
+      stream.restart();
+      etl::xor_decoder<double> decoder;
+      double value;
+      CHECK(!decoder.get(stream, value));
+    }
+
+    //*************************************************************************
+    TEST(test_xor_malformed)
+    {
+      // '10' with no window set.
+      unsigned char buffer[16] = { 0 };
+      buffer[4] = 0x80U;
+
+      etl::bit_stream stream(buffer, sizeof(buffer));
+      etl::xor_decoder<float> decoder;
+      float value;
+
+      CHECK(decoder.get(stream, value));
+      CHECK(!decoder.get(stream, value));
+    }
+  }
+}
@@ -31,6 +31,10 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #include "etl/to_string.h"
 #include "etl/cstring.h"
@@ -313,6 +317,97 @@ namespace
       CHECK_EQUAL(etl::string<20>(STR("20.0")),    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_digit_counts)
+    {
+      etl::string<24> str;
+
+      // Every digit count, with values either side of each power of ten.
+      uint64_t power = 1U;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        const uint64_t values[] = { power - 1U, power, power + 1U };
+
+        for (size_t j = 0; j < 3U; ++j)
+        {
+          CHECK_EQUAL(etl::string<24>(std::to_string(values[j]).c_str()), etl::to_string(values[j], str));
+          CHECK_EQUAL(etl::string<24>(std::to_string(-int64_t(values[j] / 2U)).c_str()), etl::to_string(-int64_t(values[j] / 2U), str));
+        }
+
+        if (i < 19)
+        {
+          power *= 10U;
+        }
+      }
+
+      CHECK_EQUAL(etl::string<24>(STR("18446744073709551615")), etl::to_string(uint64_t(18446744073709551615ULL), str));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<32> str;
+
+      Format format = Format().shortest(true);
+
+      CHECK_EQUAL(etl::string<32>(STR("0")),                       etl::to_string(0.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("-0")),                      etl::to_string(-0.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.1")),                     etl::to_string(0.1, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.3333333333333333")),      etl::to_string(1.0 / 3.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("123.456")),                 etl::to_string(123.456, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("-1.5")),                    etl::to_string(-1.5, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("100")),                     etl::to_string(100.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.000001")),                etl::to_string(0.000001, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1e-7")),                    etl::to_string(1e-7, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1e+21")),                   etl::to_string(1e21, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("5e-324")),                  etl::to_string(5e-324, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1.7976931348623157e+308")), etl::to_string(1.7976931348623157e308, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.1")),                     etl::to_string(0.1f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("16777216")),                etl::to_string(16777216.0f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("3.4028235e+38")),           etl::to_string(3.4028235e38f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1e-45")),                   etl::to_string(1e-45f, str, format));
+
+      CHECK_EQUAL(etl::string<32>(STR("   2.5")), etl::to_string(2.5, str, Format().shortest(true).width(6).right()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<32> str;
+
+      Format format = Format().shortest(true);
+
+      uint64_t seed = 0x0123456789ABCDEFULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        // xorshift64
+        seed ^= seed << 13U;
+        seed ^= seed >> 7U;
+        seed ^= seed << 17U;
+
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+
+        if (std::isfinite(d))
+        {
+          etl::to_string(d, str, format);
+          CHECK_EQUAL(d, strtod(str.c_str(), nullptr));
+        }
+
+        float f;
+        uint32_t bits = uint32_t(seed >> 32U);
+        memcpy(&f, &bits, sizeof(f));
+
+        if (std::isfinite(f))
+        {
+          etl::to_string(f, str, format);
+          CHECK_EQUAL(f, strtof(str.c_str(), nullptr));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
@@ -0,0 +1,140 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/top_k.h"
+#include "etl/vector.h"
+
+#include <stdint.h>
+#include <map>
+
+namespace
+{
+  typedef etl::top_k<uint32_t, 4> TopK;
+
+  SUITE(test_top_k)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      TopK top;
+
+      CHECK(top.empty());
+      CHECK_EQUAL(0U, top.size());
+      CHECK_EQUAL(0U, top.count(1U));
+      CHECK(!top.contains(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_exact_while_not_full)
+    {
+      TopK top;
+
+      top.add(10U);
+      top.add(20U, 5U);
+      top.add(10U);
+      top.add(30U, 3U);
+
+      CHECK_EQUAL(3U, top.size());
+      CHECK_EQUAL(2U, top.count(10U));
+      CHECK_EQUAL(5U, top.count(20U));
+      CHECK_EQUAL(10U, top.total());
+
+      etl::vector<TopK::item_type, 4> items;
+      top.get(items);
+
+      CHECK_EQUAL(3U, items.size());
+      CHECK_EQUAL(20U, items[0].key);
+      CHECK_EQUAL(30U, items[1].key);
+      CHECK_EQUAL(10U, items[2].key);
+      CHECK_EQUAL(0U, items[0].error);
+    }
+
+    //*************************************************************************
+    TEST(test_replaces_least_frequent)
+    {
+      TopK top;
+
+      top.add(1U, 10U);
+      top.add(2U, 8U);
+      top.add(3U, 6U);
+      top.add(4U, 1U);
+
+      CHECK_EQUAL(2U, top.add(5U));
+
+      CHECK(!top.contains(4U));
+      CHECK(top.contains(5U));
+      CHECK_EQUAL(2U, top.count(5U));
+
+      etl::vector<TopK::item_type, 2> items;
+      top.get(items);
+
+      CHECK_EQUAL(2U, items.size());
+      CHECK_EQUAL(1U, items[0].key);
+      CHECK_EQUAL(2U, items[1].key);
+
+      etl::vector<TopK::item_type, 4> all;
+      top.get(all);
+      CHECK_EQUAL(5U, all[3].key);
+      CHECK_EQUAL(1U, all[3].error);
+    }
+
+    //*************************************************************************
+    TEST(test_finds_heavy_hitters)
+    {
+      etl::top_k<uint32_t, 16> top;
+      std::map<uint32_t, uint32_t> actual;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        // Keys 0 to 2 are a third of the stream; the rest are noise.
+        const uint32_t key = (i % 3U == 0U) ? (i % 9U) / 3U : 100U + ((i * 2654435761U) % 5000U);
+        top.add(key);
+        ++actual[key];
+      }
+
+      etl::vector<etl::top_k<uint32_t, 16>::item_type, 3> items;
+      top.get(items);
+
+      CHECK_EQUAL(3U, items.size());
+
+      for (size_t i = 0U; i < items.size(); ++i)
+      {
+        CHECK(items[i].key < 3U);
+        CHECK(items[i].count >= actual[items[i].key]);
+        CHECK((items[i].count - items[i].error) <= actual[items[i].key]);
+      }
+
+      top.clear();
+      CHECK(top.empty());
+      CHECK_EQUAL(0U, top.total());
+    }
+  };
+}
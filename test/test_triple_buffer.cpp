@@ -0,0 +1,152 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/triple_buffer.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Every element of a frame holds the frame number, so a torn frame shows as a mismatch.
+  struct Frame
+  {
+    uint32_t values[16];
+  };
+
+  const uint32_t FRAMES = 5000U;
+
+  etl::triple_buffer<Frame> frames;
+  std::atomic<bool>         done;
+  std::atomic<int>          mismatches;
+  std::atomic<uint32_t>     last_frame;
+
+  void producer()
+  {
+    for (uint32_t f = 1U; f <= FRAMES; ++f)
+    {
+      Frame& frame = frames.back();
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        frame.values[i] = f;
+      }
+
+      frames.publish();
+    }
+
+    done = true;
+  }
+
+  void consumer()
+  {
+    uint32_t previous = 0U;
+
+    while (!done || frames.fresh())
+    {
+      if (frames.update())
+      {
+        const Frame& frame = frames.front();
+
+        for (size_t i = 1U; i < 16U; ++i)
+        {
+          if (frame.values[i] != frame.values[0])
+          {
+            ++mismatches;
+          }
+        }
+
+        // Frames may be skipped, but never go backwards.
+        if (frame.values[0] <= previous)
+        {
+          ++mismatches;
+        }
+
+        previous = frame.values[0];
+      }
+    }
+
+    last_frame = previous;
+  }
+
+  SUITE(test_triple_buffer)
+  {
+    //*************************************************************************
+    TEST(test_publish_update)
+    {
+      etl::triple_buffer<int> buffer;
+
+      CHECK(!buffer.fresh());
+      CHECK(!buffer.update());
+
+      buffer.back() = 1;
+      buffer.publish();
+      CHECK(buffer.fresh());
+
+      CHECK(buffer.update());
+      CHECK_EQUAL(1, buffer.front());
+      CHECK(!buffer.fresh());
+      CHECK(!buffer.update());
+      CHECK_EQUAL(1, buffer.front());
+
+      // The consumer gets the latest.
+      buffer.back() = 2;
+      buffer.publish();
+      buffer.back() = 3;
+      buffer.publish();
+
+      CHECK(buffer.update());
+      CHECK_EQUAL(3, buffer.front());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      done       = false;
+      mismatches = 0;
+      last_frame = 0U;
+
+      std::thread t1(consumer);
+      std::thread t2(producer);
+
+      t2.join();
+      t1.join();
+
+      CHECK_EQUAL(0, mismatches.load());
+      CHECK_EQUAL(FRAMES, last_frame.load());
+    }
+  };
+}
+
+#endif
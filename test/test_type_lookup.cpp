@@ -287,5 +287,26 @@ namespace
     {
       CHECK((etl::is_same<Type2, typename Type_Type_Lookup1::type_from_type<Type1>::type>::value));
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_TYPE_LOOKUP_FORCE_CPP03)
+    //*************************************************************************
+    TEST(test_more_than_16_types)
+    {
+      typedef etl::type_id_lookup<TypeId1,  TypeId2,  TypeId3,  TypeId4,  TypeId5,  TypeId6,  TypeId7,  TypeId8,
+                                  TypeId9,  TypeId10, TypeId11, TypeId12, TypeId13, TypeId14, TypeId15, TypeId16,
+                                  etl::type_id_pair<Type<17>, 17>, etl::type_id_pair<Type<18>, 18>> Type_Id_Lookup18;
+
+      typedef etl::type_type_lookup<TypeType12,  TypeType21,  TypeType34,   TypeType43,   TypeType56,   TypeType65,   TypeType78,   TypeType87,
+                                    TypeType910, TypeType109, TypeType1112, TypeType1211, TypeType1314, TypeType1413, TypeType1516, TypeType1615,
+                                    etl::type_type_pair<Type<17>, Type<18>>> Type_Type_Lookup17;
+
+      CHECK((etl::is_same<Type<18>, typename Type_Id_Lookup18::type_from_id<18>::type>::value));
+      CHECK((etl::is_same<Type1,    typename Type_Id_Lookup18::type_from_id<1>::type>::value));
+      CHECK_EQUAL(17U, (unsigned int) Type_Id_Lookup18::id_from_type<Type<17>>::value);
+      CHECK_EQUAL(17U, Type_Id_Lookup18::get_id_from_type(Type<17>()));
+      CHECK((etl::is_same<Type<18>, typename Type_Type_Lookup17::type_from_type<Type<17>>::type>::value));
+      CHECK((etl::is_same<Type15,   typename Type_Type_Lookup17::type_from_type<Type16>::type>::value));
+    }
+#endif
   };
 }
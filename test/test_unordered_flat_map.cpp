@@ -0,0 +1,441 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <stdint.h>
+
+#include "data.h"
+
+#include "etl/unordered_flat_map.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Sends every key to the same group.
+  struct collision_hash
+  {
+    size_t operator ()(uint32_t) const
+    {
+      return 0x1234U;
+    }
+  };
+
+  SUITE(test_unordered_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef TestDataNDC<std::string> NDC;
+
+    typedef etl::unordered_flat_map<std::string, NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iunordered_flat_map<std::string, NDC, simple_hash>      IDataNDC;
+    typedef std::map<std::string, NDC>                                   Compare_Data;
+
+    typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+
+    std::vector<ElementNDC> make_initial_data()
+    {
+      std::vector<ElementNDC> data;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        data.push_back(ElementNDC(std::string("F") + char('A' + i), NDC(std::string(1, char('a' + i)))));
+      }
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.bucket_count() >= SIZE);
+    }
+
+    //*************************************************************************
+    TEST(test_slot_count)
+    {
+      CHECK_EQUAL(8U, size_t(etl::unordered_flat_map<int, int, 1>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(8U, size_t(etl::unordered_flat_map<int, int, 7>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(16U, size_t(etl::unordered_flat_map<int, int, 8>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(16U, size_t(etl::unordered_flat_map<int, int, 14>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(32U, size_t(etl::unordered_flat_map<int, int, 15>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(8192U, size_t(etl::unordered_flat_map<int, int, 4096>::NUMBER_OF_SLOTS));
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(data.full());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator it = data.find(initial_data[i].first);
+        CHECK(it != data.end());
+        CHECK_EQUAL(initial_data[i].second, it->second);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_assignment)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC copy(data);
+
+      CHECK(data == copy);
+
+      DataNDC other;
+      other = data;
+      CHECK(data == other);
+
+      IDataNDC& idata = other;
+      idata = idata;
+      CHECK(data == other);
+
+      other.erase(initial_data[0].first);
+      CHECK(data != other);
+    }
+
+    //*************************************************************************
+    TEST(test_index)
+    {
+      etl::unordered_flat_map<std::string, int, SIZE, simple_hash> data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+      data["A"] += 10;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(11, data["A"]);
+      CHECK_EQUAL(2,  data["B"]);
+      CHECK_EQUAL(0,  data["C"]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(initial_data[3].second, data.at(initial_data[3].first));
+      CHECK_EQUAL(initial_data[3].second, cdata.at(initial_data[3].first));
+      CHECK_THROW(data.at("ZZ"), etl::unordered_flat_map_out_of_range);
+      CHECK_THROW(cdata.at("ZZ"), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC("A", NDC("a")));
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("A"), result.first->first);
+
+      result = data.insert(ElementNDC("A", NDC("b")));
+      CHECK(!result.second);
+      CHECK_EQUAL(NDC("a"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(ElementNDC("ZZ", NDC("z"))), etl::unordered_flat_map_full);
+
+      // An existing key is not an error.
+      CHECK(!data.insert(initial_data[0]).second);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(initial_data[5].first));
+      CHECK_EQUAL(0U, data.erase(initial_data[5].first));
+      CHECK_EQUAL(initial_data.size() - 1, data.size());
+      CHECK(data.find(initial_data[5].first) == data.end());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        if (i != 5)
+        {
+          CHECK(data.find(initial_data[i].first) != data.end());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterators)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      // Erase every other element while iterating.
+      size_t visited = 0U;
+      DataNDC::iterator it = data.begin();
+
+      while (it != data.end())
+      {
+        if ((visited++ % 2U) == 0U)
+        {
+          it = data.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+
+      CHECK_EQUAL(SIZE, visited);
+      CHECK_EQUAL(SIZE / 2U, data.size());
+
+      DataNDC::iterator last = data.erase(data.begin(), data.end());
+      CHECK(last == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iteration)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      size_t n = 0U;
+
+      for (DataNDC::const_iterator it = data.cbegin(); it != data.cend(); ++it)
+      {
+        CHECK(compare_data.find(it->first) != compare_data.end());
+        ++n;
+      }
+
+      CHECK_EQUAL(compare_data.size(), n);
+      CHECK_EQUAL(compare_data.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(initial_data[0].first) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_count_and_equal_range)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(1U, data.count(initial_data[2].first));
+      CHECK_EQUAL(0U, data.count("ZZ"));
+
+      ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> range = cdata.equal_range(initial_data[2].first);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(initial_data[2].second, range.first->second);
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> missing = data.equal_range("ZZ");
+      CHECK(missing.first == data.end());
+      CHECK(missing.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_find_precomputed_hash)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        size_t key_hash = data.hash_function()(initial_data[i].first);
+        CHECK(data.find(initial_data[i].first) == data.find(initial_data[i].first, key_hash));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_flat_map<etl::string<10>, int, 10, etl::string_hash, etl::equal_to<> > Transparent;
+
+      Transparent data;
+
+      data[etl::string<10>("one")] = 1;
+      data[etl::string<10>("two")] = 2;
+
+      CHECK_EQUAL(1, data.find(etl::string_view("one"))->second);
+      CHECK_EQUAL(1U, data.count(etl::string_view("two")));
+      CHECK(data.find(etl::string_view("three")) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_collisions_and_reuse)
+    {
+      // All keys share a control byte, so every lookup compares keys and
+      // probing moves through the groups.
+      typedef etl::unordered_flat_map<uint32_t, uint32_t, 40, collision_hash> Data;
+
+      Data data;
+
+      for (uint32_t i = 0U; i < 40U; ++i)
+      {
+        CHECK(data.insert(Data::value_type(i, i * 2U)).second);
+      }
+
+      CHECK(data.full());
+
+      for (uint32_t cycle = 0U; cycle < 10U; ++cycle)
+      {
+        // Erase some, leaving deleted slots, then insert new keys.
+        for (uint32_t i = 0U; i < 40U; i += 3U)
+        {
+          CHECK_EQUAL(1U, data.erase(i + (cycle * 100U)));
+        }
+
+        for (uint32_t i = 0U; i < 40U; i += 3U)
+        {
+          CHECK(data.insert(Data::value_type(i + ((cycle + 1U) * 100U), i)).second);
+        }
+
+        CHECK(data.full());
+
+        for (uint32_t i = 0U; i < 40U; ++i)
+        {
+          uint32_t key = ((i % 3U) == 0U) ? i + ((cycle + 1U) * 100U) : i;
+          CHECK(data.find(key) != data.end());
+        }
+
+        // The replacements hold their values.
+        for (uint32_t i = 0U; i < 40U; i += 3U)
+        {
+          uint32_t value = data[i + ((cycle + 1U) * 100U)];
+          CHECK_EQUAL(i, value);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std)
+    {
+      typedef etl::unordered_flat_map<uint32_t, uint32_t, 100> Data;
+
+      Data data;
+      std::unordered_map<uint32_t, uint32_t> compare;
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 20000U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        uint32_t key = (seed >> 16) % 200U;
+
+        if ((seed & 0x100U) && (compare.size() < 100U))
+        {
+          bool inserted = data.insert(Data::value_type(key, i)).second;
+          CHECK_EQUAL(compare.insert(std::make_pair(key, uint32_t(i))).second, inserted);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+      }
+
+      for (std::unordered_map<uint32_t, uint32_t>::const_iterator it = compare.begin(); it != compare.end(); ++it)
+      {
+        Data::const_iterator found = data.find(it->first);
+        CHECK(found != data.end());
+        CHECK_EQUAL(it->second, found->second);
+      }
+
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_load_factor)
+    {
+      std::vector<ElementNDC> initial_data = make_initial_data();
+
+      DataNDC data;
+      CHECK_CLOSE(0.0, data.load_factor(), 0.01);
+
+      data.assign(initial_data.begin(), initial_data.end());
+      CHECK_CLOSE(float(SIZE) / float(size_t(DataNDC::NUMBER_OF_SLOTS)), data.load_factor(), 0.01);
+    }
+  };
+}
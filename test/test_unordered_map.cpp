@@ -42,9 +42,25 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_map.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
 
 namespace
 {
+  //*************************************************************************
+  struct counting_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs == rhs;
+    }
+
+    static int count;
+  };
+
+  int counting_equal::count = 0;
+
   //*************************************************************************
   struct simple_hash
   {
@@ -469,6 +485,51 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::unordered_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch)
+    {
+      DataNDC data;
+
+      // The second batch repeats the first half.
+      data.insert_batch(initial_data.begin(), initial_data.begin() + 5);
+      data.insert_batch(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator idata = data.find(initial_data[i].first);
+        CHECK(idata != data.end());
+        CHECK(idata->second == initial_data[i].second);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch_assume_unique)
+    {
+      DataNDC data;
+
+      data.insert_batch(initial_data.begin(), initial_data.end(), true);
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK_EQUAL(initial_data.size(), size_t(std::distance(data.begin(), data.end())));
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator idata = data.find(initial_data[i].first);
+        CHECK(idata != data.end());
+        CHECK(idata->second == initial_data[i].second);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_batch(excess_data.begin(), excess_data.end()), etl::unordered_map_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -719,5 +780,326 @@ namespace
       CHECK_EQUAL('c', map[2]);
       CHECK_EQUAL('d', map[3]);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_precomputed_hash)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        const std::string& key = initial_data[i].first;
+        size_t key_hash = data.hash_function()(key);
+
+        CHECK(data.find(key) == data.find(key, key_hash));
+
+        const DataNDC& cdata = data;
+        CHECK(cdata.find(key) == cdata.find(key, key_hash));
+      }
+
+      std::string missing("ZZ");
+      CHECK(data.find(missing, data.hash_function()(missing)) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_map<etl::string<10>, int, 10, 10, etl::string_hash, etl::equal_to<> > Transparent;
+
+      Transparent map;
+
+      map[etl::string<10>("one")] = 1;
+      map[etl::string<10>("two")] = 2;
+      map[etl::string<10>("three")] = 3;
+
+      etl::string_view one("one");
+      etl::string_view four("four");
+
+      CHECK(map.find(one) != map.end());
+      CHECK(map.find(one) == map.find(etl::string<10>("one")));
+      CHECK(map.find(four) == map.end());
+      CHECK_EQUAL(1U, map.count(one));
+      CHECK_EQUAL(0U, map.count(four));
+      CHECK(map.find(one, etl::string_hash()(one)) == map.find(one));
+
+      const Transparent& cmap = map;
+      CHECK(cmap.find(one) == cmap.find(etl::string<10>("one")));
+
+      Transparent::const_iterator f = cmap.equal_range(one).first;
+      Transparent::const_iterator l = cmap.equal_range(one).second;
+      CHECK_EQUAL(1, std::distance(f, l));
+
+      CHECK(map.equal_range(four).first == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_node_hash_full)
+    {
+      // One bucket, so every lookup walks past every other key.
+      typedef etl::unordered_map<int, int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_full> Data;
+
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      counting_equal::count = 0;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+        CHECK(data.find(i) != data.end());
+      }
+
+      CHECK(data.find(8) == data.end());
+      CHECK_EQUAL(16, counting_equal::count);
+
+      CHECK_EQUAL(1U, data.erase(3));
+      CHECK(data.find(3) == data.end());
+      CHECK(!data.insert(Data::value_type(4, 0)).second);
+      CHECK_EQUAL(7U, data.size());
+
+      Data other(data);
+      CHECK(other == data);
+      CHECK_EQUAL(50, other[5]);
+    }
+
+    //*************************************************************************
+    TEST(test_node_hash_tag)
+    {
+      typedef etl::unordered_map<int, int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_tag> Data;
+
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(Data::value_type(i, i * 10));
+      }
+
+      counting_equal::count = 0;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(i * 10, data[i]);
+      }
+
+      CHECK_EQUAL(0U, data.count(8));
+      CHECK_EQUAL(8, counting_equal::count);
+
+      // Keys whose tags collide are still told apart by the key comparison.
+      CHECK_EQUAL(etl::unordered_node_hash_tag::storage::make_tag(1), etl::unordered_node_hash_tag::storage::make_tag(0x10000));
+      data.erase(7);
+      data[0x10000] = 3;
+      CHECK_EQUAL(10, data[1]);
+      CHECK_EQUAL(3, data[0x10000]);
+      CHECK_EQUAL(8U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_sparse_iteration)
+    {
+      // Few elements spread over many buckets, crossing occupancy word boundaries.
+      typedef etl::unordered_map<int, int, 8, 100> Data;
+
+      Data data;
+
+      const int keys[] = { 99, 0, 31, 32, 63, 64, 65, 98 };
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        data[keys[i]] = keys[i];
+      }
+
+      int sum = 0;
+      size_t n = 0;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->first, itr->second);
+        sum += itr->second;
+        ++n;
+      }
+
+      CHECK_EQUAL(8U, n);
+      CHECK_EQUAL(452, sum);
+
+      // Remove the first and last occupied buckets.
+      data.erase(0);
+      data.erase(99);
+      CHECK_EQUAL(31, data.begin()->first);
+      CHECK_EQUAL(6, std::distance(data.begin(), data.end()));
+
+      data.erase(data.find(32), data.find(98));
+      CHECK_EQUAL(2, std::distance(data.begin(), data.end()));
+
+      data.clear();
+      CHECK(data.begin() == data.end());
+
+      data[50] = 1;
+      CHECK_EQUAL(1, std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(50, data.begin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move_and_move_construct)
+    {
+      typedef TestDataM<int> Item;
+      typedef etl::unordered_map<int, Item, 8, 4> Data;
+
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type(1, Item(10)));
+      CHECK(result.second);
+      CHECK_EQUAL(10, result.first->second.value);
+
+      data.insert(data.begin(), Data::value_type(2, Item(20)));
+      data.insert(Data::value_type(5, Item(50)));
+
+      // Duplicate key.
+      result = data.insert(Data::value_type(1, Item(11)));
+      CHECK(!result.second);
+      CHECK_EQUAL(3U, data.size());
+
+      Data moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(10, moved.find(1)->second.value);
+      CHECK_EQUAL(20, moved.find(2)->second.value);
+      CHECK_EQUAL(50, moved.find(5)->second.value);
+
+      etl::unordered_map<int, Item, 16, 8> larger;
+      etl::iunordered_map<int, Item>& ilarger = larger;
+      ilarger = std::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, larger.size());
+      CHECK(bool(larger.find(5)->second));
+    }
+
+    //*************************************************************************
+    TEST(test_extract_and_insert_node_shared_pool)
+    {
+      typedef TestDataM<int> Item;
+      typedef etl::unordered_map<int, Item, 0, 4> Data;
+
+      etl::pool<Data::pool_type, 5> pool;
+
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.insert(Data::value_type(1, Item(10)));
+      data1.insert(Data::value_type(2, Item(20)));
+      data1.insert(Data::value_type(5, Item(50)));
+      data2.insert(Data::value_type(3, Item(30)));
+
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(1U, data2.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      Data::node_type handle = data1.extract(5);
+
+      CHECK(!handle.empty());
+      CHECK_EQUAL(5, handle.key());
+      CHECK_EQUAL(50, handle.mapped().value);
+      CHECK_EQUAL(2U, data1.size());
+      CHECK(data1.find(5) == data1.end());
+      CHECK_EQUAL(4U, pool.size());
+
+      const Item* p_mapped = &handle.mapped();
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(etl::move(handle));
+
+      CHECK(result.second);
+      CHECK(handle.empty());
+      CHECK(&result.first->second == p_mapped);
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      // Duplicate keys leave the node in the handle.
+      data1.insert(Data::value_type(3, Item(31)));
+      result = data2.insert(data1.extract(data1.find(3)));
+      CHECK(!result.second);
+      CHECK_EQUAL(30, result.first->second.value);
+      CHECK_EQUAL(4U, pool.size());
+
+      CHECK(data1.extract(99).empty());
+
+      // Clearing one container leaves the nodes of the other.
+      data1.clear();
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(50, data2.find(5)->second.value);
+      CHECK_EQUAL(30, data2.find(3)->second.value);
+
+      Data moved(std::move(data2));
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, moved.size());
+      CHECK_EQUAL(2U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_node_from_other_pool)
+    {
+      typedef TestDataM<int> Item;
+      typedef etl::unordered_map<int, Item, 4> Data;
+
+      Data data1;
+      Data data2;
+
+      data1.insert(Data::value_type(1, Item(10)));
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(data1.extract(1));
+
+      CHECK(result.second);
+      CHECK_EQUAL(10, result.first->second.value);
+      CHECK(data1.empty());
+      CHECK_EQUAL(1U, data2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_ext)
+    {
+      typedef etl::unordered_map_ext<int, std::string> Data;
+
+      static const size_t MAX     = 6U;
+      static const size_t BUCKETS = 3U;
+
+      etl::aligned_storage<1024U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX, BUCKETS) <= sizeof(buffer));
+      CHECK(Data::buffer_size(MAX) >= Data::buffer_size(MAX, BUCKETS));
+
+      Data data(&buffer, MAX, BUCKETS);
+      etl::unordered_map<int, std::string, 0, 0>& external = data;
+      etl::iunordered_map<int, std::string>& idata = external;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+      CHECK_EQUAL(BUCKETS, idata.bucket_count());
+
+      for (int i = 0; i < int(MAX); ++i)
+      {
+        idata[i] = std::to_string(i);
+      }
+
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert(std::make_pair(10, std::string("10"))), etl::unordered_map_full);
+
+      const char* p = reinterpret_cast<const char*>(&*idata.find(3));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX, BUCKETS));
+
+      idata.erase(3);
+      CHECK(idata.find(3) == idata.end());
+      CHECK_EQUAL(std::string("4"), idata[4]);
+      CHECK_EQUAL(MAX - 1U, idata.size());
+
+      etl::aligned_storage<1024U, Data::ALIGNMENT>::type buffer2;
+      Data data2(data.begin(), data.end(), &buffer2, MAX, BUCKETS);
+      CHECK(data2 == data);
+
+      data2.clear();
+      data2 = data;
+      CHECK(data2 == data);
+    }
   };
 }
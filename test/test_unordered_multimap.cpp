@@ -43,6 +43,20 @@ SOFTWARE.
 
 namespace
 {
+  //*************************************************************************
+  struct counting_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs == rhs;
+    }
+
+    static int count;
+  };
+
+  int counting_equal::count = 0;
+
   //*************************************************************************
   struct simple_hash
   {
@@ -644,5 +658,66 @@ namespace
       CHECK_EQUAL("map[2] = c", s[0]);
       CHECK_EQUAL("map[3] = d", s[1]);
     }
+
+    //*************************************************************************
+    TEST(test_node_hash_tag)
+    {
+      // One bucket, so every lookup walks past every other key.
+      typedef etl::unordered_multimap<int, int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_tag> Data;
+
+      Data data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.insert(Data::value_type(i, i));
+        data.insert(Data::value_type(i, i + 10));
+      }
+
+      counting_equal::count = 0;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(data.find(i) != data.end());
+        CHECK_EQUAL(2U, data.count(i));
+      }
+
+      CHECK(data.find(4) == data.end());
+      CHECK_EQUAL(8, counting_equal::count);
+
+      CHECK_EQUAL(2U, data.erase(2));
+      CHECK(data.find(2) == data.end());
+      CHECK_EQUAL(6U, data.size());
+
+      Data other(data);
+      CHECK_EQUAL(6U, other.size());
+      CHECK_EQUAL(2U, other.count(3));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move_and_move_construct)
+    {
+      typedef TestDataM<int> Item;
+      typedef etl::unordered_multimap<int, Item, 8, 4> Data;
+
+      Data data;
+
+      Data::iterator itr = data.insert(Data::value_type(1, Item(10)));
+      CHECK_EQUAL(10, itr->second.value);
+
+      data.insert(data.begin(), Data::value_type(1, Item(11)));
+      data.insert(Data::value_type(2, Item(20)));
+      CHECK_EQUAL(2U, data.count(1));
+
+      Data moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(2U, moved.count(1));
+
+      Data assigned;
+      assigned = std::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, assigned.size());
+      CHECK_EQUAL(20, assigned.find(2)->second.value);
+    }
   };
 }
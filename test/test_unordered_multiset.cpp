@@ -44,6 +44,20 @@ SOFTWARE.
 
 namespace
 {
+  //*************************************************************************
+  struct counting_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs == rhs;
+    }
+
+    static int count;
+  };
+
+  int counting_equal::count = 0;
+
   SUITE(test_unordered_multiset)
   {
     static const size_t SIZE = 10;
@@ -538,5 +552,98 @@ namespace
       data.assign(initial_data.begin(), initial_data.end());
       CHECK_CLOSE(2.0, data.load_factor(), 0.01);
     }
+
+    //*************************************************************************
+    TEST(test_node_hash_full)
+    {
+      // One bucket, so every lookup walks past every other key.
+      typedef etl::unordered_multiset<int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_full> Data;
+
+      Data data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.insert(i);
+        data.insert(i);
+      }
+
+      counting_equal::count = 0;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(data.find(i) != data.end());
+        CHECK_EQUAL(2U, data.count(i));
+      }
+
+      CHECK(data.find(4) == data.end());
+      CHECK_EQUAL(8, counting_equal::count);
+
+      CHECK_EQUAL(2U, data.erase(2));
+      CHECK(data.find(2) == data.end());
+      CHECK_EQUAL(6U, data.size());
+
+      Data other(data);
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_sparse_iteration)
+    {
+      // Few elements spread over many buckets, crossing occupancy word boundaries.
+      typedef etl::unordered_multiset<int, 8, 70> Data;
+
+      Data data;
+
+      data.insert(69);
+      data.insert(0);
+      data.insert(0);
+      data.insert(33);
+      data.insert(64);
+      data.insert(64);
+
+      CHECK_EQUAL(6, std::distance(data.begin(), data.end()));
+
+      CHECK_EQUAL(2U, data.erase(64));
+      CHECK_EQUAL(4, std::distance(data.begin(), data.end()));
+
+      CHECK_EQUAL(1U, data.erase(69));
+      CHECK_EQUAL(3, std::distance(data.begin(), data.end()));
+
+      CHECK_EQUAL(2U, data.erase(0));
+      CHECK_EQUAL(33, *data.begin());
+      CHECK_EQUAL(1, std::distance(data.begin(), data.end()));
+
+      data.clear();
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move_and_move_construct)
+    {
+      typedef etl::unordered_multiset<std::string, 8, 4, std::hash<std::string> > Data;
+
+      const std::string long_text("a string that is too long for the small string buffer");
+
+      Data data;
+
+      std::string text(long_text);
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(std::move(text));
+      CHECK_EQUAL(long_text, *result.first);
+      CHECK(text.empty());
+
+      data.insert(data.begin(), std::string(long_text));
+      data.insert(std::string("b"));
+      CHECK_EQUAL(2U, data.count(long_text));
+
+      Data moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(2U, moved.count(long_text));
+
+      Data assigned;
+      assigned = std::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, assigned.size());
+    }
   };
 }
@@ -39,10 +39,26 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_set.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
 #include "etl/checksum.h"
 
 namespace
 {
+  //*************************************************************************
+  struct counting_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs == rhs;
+    }
+
+    static int count;
+  };
+
+  int counting_equal::count = 0;
+
   SUITE(test_unordered_set)
   {
     static const size_t SIZE = 10;
@@ -287,6 +303,49 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::unordered_set_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch)
+    {
+      DataNDC data;
+
+      // The second batch repeats the first half.
+      data.insert_batch(initial_data.begin(), initial_data.begin() + 5);
+      data.insert_batch(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator idata = data.find(initial_data[i]);
+        CHECK(idata != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch_assume_unique)
+    {
+      DataNDC data;
+
+      data.insert_batch(initial_data.begin(), initial_data.end(), true);
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK_EQUAL(initial_data.size(), size_t(std::distance(data.begin(), data.end())));
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator idata = data.find(initial_data[i]);
+        CHECK(idata != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_batch_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert_batch(excess_data.begin(), excess_data.end()), etl::unordered_set_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -483,5 +542,247 @@ namespace
       CHECK_EQUAL("set = 2", s[0]);
       CHECK_EQUAL("set = 3", s[1]);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_precomputed_hash)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        const NDC& key = initial_data[i];
+        size_t key_hash = data.hash_function()(key);
+
+        CHECK(data.find(key) == data.find(key, key_hash));
+
+        const DataNDC& cdata = data;
+        CHECK(cdata.find(key) == cdata.find(key, key_hash));
+      }
+
+      NDC missing("ZZ");
+      CHECK(data.find(missing, data.hash_function()(missing)) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_set<etl::string<10>, 10, 10, etl::string_hash, etl::equal_to<> > Transparent;
+
+      Transparent map;
+
+      map.insert(etl::string<10>("one"));
+      map.insert(etl::string<10>("two"));
+      map.insert(etl::string<10>("three"));
+
+      etl::string_view one("one");
+      etl::string_view four("four");
+
+      CHECK(map.find(one) != map.end());
+      CHECK(map.find(one) == map.find(etl::string<10>("one")));
+      CHECK(map.find(four) == map.end());
+      CHECK_EQUAL(1U, map.count(one));
+      CHECK_EQUAL(0U, map.count(four));
+      CHECK(map.find(one, etl::string_hash()(one)) == map.find(one));
+
+      const Transparent& cmap = map;
+      CHECK(cmap.find(one) == cmap.find(etl::string<10>("one")));
+
+      Transparent::const_iterator f = cmap.equal_range(one).first;
+      Transparent::const_iterator l = cmap.equal_range(one).second;
+      CHECK_EQUAL(1, std::distance(f, l));
+
+      CHECK(map.equal_range(four).first == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_node_hash_full)
+    {
+      // One bucket, so every lookup walks past every other key.
+      typedef etl::unordered_set<int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_full> Data;
+
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(i);
+      }
+
+      counting_equal::count = 0;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(data.find(i) != data.end());
+      }
+
+      CHECK_EQUAL(0U, data.count(8));
+      CHECK_EQUAL(8, counting_equal::count);
+
+      CHECK_EQUAL(1U, data.erase(3));
+      CHECK(data.find(3) == data.end());
+      CHECK(!data.insert(4).second);
+      CHECK_EQUAL(7U, data.size());
+
+      Data other(data);
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_node_hash_tag)
+    {
+      typedef etl::unordered_set<int, 8, 1, etl::hash<int>, counting_equal, etl::unordered_node_hash_tag> Data;
+
+      Data data;
+
+      // 1 and 0x10000 have the same tag.
+      data.insert(1);
+      data.insert(0x10000);
+      data.insert(2);
+
+      counting_equal::count = 0;
+
+      CHECK(data.find(2) != data.end());
+      CHECK_EQUAL(1, counting_equal::count);
+
+      CHECK(data.find(1) != data.end());
+      CHECK(data.find(0x10000) != data.end());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1U, data.erase(0x10000));
+      CHECK(data.find(1) != data.end());
+      CHECK(data.find(0x10000) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move_and_move_construct)
+    {
+      typedef etl::unordered_set<std::string, 8, 4, std::hash<std::string> > Data;
+
+      const std::string long_text("a string that is too long for the small string buffer");
+
+      Data data;
+
+      std::string text(long_text);
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(std::move(text));
+      CHECK(result.second);
+      CHECK_EQUAL(long_text, *result.first);
+      CHECK(text.empty());
+
+      data.insert(data.begin(), std::string("b"));
+      CHECK(!data.insert(std::string("b")).second);
+      CHECK_EQUAL(2U, data.size());
+
+      Data moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(2U, moved.size());
+      CHECK(moved.find(long_text) != moved.end());
+
+      Data assigned;
+      assigned.insert(std::string("c"));
+      assigned = std::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK(assigned.find("c") == assigned.end());
+      CHECK(assigned.find("b") != assigned.end());
+    }
+
+    //*************************************************************************
+    TEST(test_extract_and_insert_node_shared_pool)
+    {
+      typedef etl::unordered_set<int, 0, 4> Data;
+
+      etl::pool<Data::pool_type, 4> pool;
+
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.insert(1);
+      data1.insert(2);
+      data1.insert(3);
+
+      Data::node_type handle = data1.extract(2);
+
+      CHECK(!handle.empty());
+      CHECK_EQUAL(2, handle.value());
+      CHECK_EQUAL(2U, data1.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      const int* p_value = &handle.value();
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data2.insert(etl::move(handle));
+
+      CHECK(result.second);
+      CHECK(handle.empty());
+      CHECK(&*result.first == p_value);
+      CHECK_EQUAL(1U, data2.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      data1.clear();
+      CHECK_EQUAL(1U, pool.size());
+      CHECK(data2.find(2) != data2.end());
+    }
+
+    //*************************************************************************
+    TEST(test_external_storage_unordered_set)
+    {
+      typedef etl::unordered_set<int, 0, 0> ExtSet;
+
+      etl::pool<ExtSet::pool_type, 10> pool;
+      ExtSet::bucket_type              buckets[40];
+      ExtSet::occupancy_type           occupied[2];
+
+      CHECK_EQUAL(2U, ExtSet::occupancy_size(40));
+      CHECK_EQUAL(1U, ExtSet::occupancy_size(32));
+
+      ExtSet set(pool, buckets, 40, occupied);
+
+      CHECK_EQUAL(40U, set.bucket_count());
+      CHECK_EQUAL(10U, set.max_size());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        set.insert(i * 7);
+      }
+
+      CHECK(set.full());
+      CHECK(set.find(28) != set.end());
+      CHECK_EQUAL(10, std::distance(set.begin(), set.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_set_ext)
+    {
+      typedef etl::unordered_set_ext<int> Data;
+
+      static const size_t MAX = 6U;
+
+      etl::aligned_storage<1024U, Data::ALIGNMENT>::type buffer;
+      CHECK(Data::buffer_size(MAX) <= sizeof(buffer));
+
+      Data data(&buffer, MAX);
+      etl::unordered_set<int, 0, 0>& external = data;
+      etl::iunordered_set<int>& idata = external;
+
+      CHECK_EQUAL(MAX, idata.max_size());
+      CHECK_EQUAL(MAX, idata.bucket_count());
+
+      for (int i = 0; i < int(MAX); ++i)
+      {
+        idata.insert(i);
+      }
+
+      CHECK(idata.full());
+      CHECK_THROW(idata.insert(10), etl::unordered_set_full);
+
+      const char* p = reinterpret_cast<const char*>(&*idata.find(3));
+      CHECK(p >= reinterpret_cast<const char*>(&buffer));
+      CHECK(p <  reinterpret_cast<const char*>(&buffer) + Data::buffer_size(MAX));
+
+      idata.erase(3);
+      CHECK(idata.find(3) == idata.end());
+      CHECK_EQUAL(MAX - 1U, idata.size());
+
+      etl::aligned_storage<1024U, Data::ALIGNMENT>::type buffer2;
+      Data data2(data.begin(), data.end(), &buffer2, MAX, MAX);
+      CHECK(data2 == data);
+    }
   };
 }
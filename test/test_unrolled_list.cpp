@@ -0,0 +1,314 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <list>
+#include <vector>
+#include <string>
+
+#include "etl/unrolled_list.h"
+
+namespace
+{
+  typedef etl::unrolled_list<int, 40, 4> List;
+  typedef std::list<int>                 Compare;
+
+  //***************************************************************************
+  bool are_equal(const List& data, const Compare& compare)
+  {
+    return (data.size() == compare.size()) && std::equal(compare.begin(), compare.end(), data.begin());
+  }
+
+  SUITE(test_unrolled_list)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      List data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(40U, data.max_size());
+      CHECK_EQUAL(4U, data.elements_per_node());
+      CHECK_EQUAL(0U, data.node_count());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_push_and_iterate)
+    {
+      List    data;
+      Compare compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+      }
+
+      for (int i = 10; i < 15; ++i)
+      {
+        data.push_front(i);
+        compare.push_front(i);
+      }
+
+      CHECK(are_equal(data, compare));
+      CHECK_EQUAL(compare.front(), data.front());
+      CHECK_EQUAL(compare.back(), data.back());
+      CHECK(std::equal(compare.rbegin(), compare.rend(), data.rbegin()));
+
+      // Nodes hold more than one element.
+      CHECK(data.node_count() < data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_against_std_list)
+    {
+      List    data;
+      Compare compare;
+
+      unsigned seed = 12345U;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const size_t r = (seed >> 8);
+
+        if ((data.size() < data.max_size()) && ((r & 1U) || data.empty()))
+        {
+          const size_t offset = (r >> 1) % (data.size() + 1U);
+
+          List::iterator    itr = data.begin();
+          Compare::iterator citr = compare.begin();
+          std::advance(itr, offset);
+          std::advance(citr, offset);
+
+          List::iterator result = data.insert(itr, i);
+          compare.insert(citr, i);
+
+          CHECK_EQUAL(i, *result);
+        }
+        else
+        {
+          const size_t offset = (r >> 1) % data.size();
+
+          List::iterator    itr = data.begin();
+          Compare::iterator citr = compare.begin();
+          std::advance(itr, offset);
+          std::advance(citr, offset);
+
+          List::iterator result = data.erase(itr);
+          citr = compare.erase(citr);
+
+          if (citr == compare.end())
+          {
+            CHECK(result == data.end());
+          }
+          else
+          {
+            CHECK_EQUAL(*citr, *result);
+          }
+        }
+
+        CHECK(are_equal(data, compare));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_pop_and_clear)
+    {
+      int initial[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      List    data(initial, initial + 10);
+      Compare compare(initial, initial + 10);
+
+      data.pop_front();
+      compare.pop_front();
+      data.pop_back();
+      compare.pop_back();
+
+      CHECK(are_equal(data, compare));
+
+      data.erase(++data.begin(), --data.end());
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.front());
+      CHECK_EQUAL(8, data.back());
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.node_count());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      List data;
+
+      data.assign(40U, 1);
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK_THROW(data.push_back(2), etl::unrolled_list_full);
+
+      data.clear();
+      CHECK_THROW(data.pop_back(), etl::unrolled_list_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_fills_at_worst_case_layout)
+    {
+      List data;
+
+      // Inserting in the middle of full nodes leaves them half full.
+      for (int i = 0; i < 40; ++i)
+      {
+        List::iterator itr = data.begin();
+        std::advance(itr, data.size() / 2U);
+        data.insert(itr, i);
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      etl::unrolled_list<std::string, 20, 3> data;
+      std::list<std::string>                 compare;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        const std::string text(size_t(i + 20), char('a' + i));
+
+        if (i & 1)
+        {
+          data.push_back(text);
+          compare.push_back(text);
+        }
+        else
+        {
+          data.insert(++data.begin(), text);
+          std::list<std::string>::iterator itr = compare.begin();
+
+          if (itr != compare.end())
+          {
+            ++itr;
+          }
+
+          compare.insert(itr, text);
+        }
+      }
+
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+#if ETL_CPP11_SUPPORTED
+      data.erase(data.begin());
+      compare.erase(compare.begin());
+      data.emplace(data.begin(), 5U, 'z');
+      compare.emplace(compare.begin(), 5U, 'z');
+
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      int initial[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      List data1(initial, initial + 10);
+      List data2(data1);
+
+      CHECK(data1 == data2);
+
+      data2.back() = 99;
+      CHECK(data1 != data2);
+
+      data2 = data1;
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_splice_shared_pool)
+    {
+      typedef etl::unrolled_list<int, 0, 4> SharedList;
+
+      etl::pool<SharedList::pool_type, 20> pool;
+
+      SharedList data1(pool, 40U);
+      SharedList data2(pool, 40U);
+      Compare    compare1;
+      Compare    compare2;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data1.push_back(i);
+        compare1.push_back(i);
+        data2.push_back(i + 100);
+        compare2.push_back(i + 100);
+      }
+
+      SharedList::iterator itr = data1.begin();
+      Compare::iterator    citr = compare1.begin();
+      std::advance(itr, 5);
+      std::advance(citr, 5);
+
+      const size_t used = pool.size();
+
+      data1.splice(itr, data2);
+      compare1.splice(citr, compare2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(20U, data1.size());
+      CHECK(std::equal(compare1.begin(), compare1.end(), data1.begin()));
+
+      // The nodes were moved, not copied.
+      CHECK(pool.size() <= (used + 1U));
+
+      data1.clear();
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_splice_separate_pools)
+    {
+      int initial1[] = { 0, 1, 2, 3, 4 };
+      int initial2[] = { 10, 11, 12 };
+
+      List    data1(initial1, initial1 + 5);
+      List    data2(initial2, initial2 + 3);
+      Compare compare1(initial1, initial1 + 5);
+      Compare compare2(initial2, initial2 + 3);
+
+      data1.splice(++data1.begin(), data2);
+      compare1.splice(++compare1.begin(), compare2);
+
+      CHECK(data2.empty());
+      CHECK(are_equal(data1, compare1));
+    }
+  };
+}
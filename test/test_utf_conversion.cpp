@@ -0,0 +1,232 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/utf_conversion.h"
+#include "etl/random.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  const char*     utf8_text  = "Temp 21\xC2\xB0" "C \xE2\x82\xAC" "5 \xF0\x9F\x98\x80 ok";
+  const char16_t* utf16_text = u"Temp 21°C €5 \U0001F600 ok";
+  const char32_t* utf32_text = U"Temp 21°C €5 \U0001F600 ok";
+
+  //*************************************************************************
+  bool is_invalid_utf8(const char* text, size_t length)
+  {
+    char16_t buffer16[16];
+    char32_t buffer32[16];
+    etl::u16string<16> s16;
+
+    return (etl::utf8_to_utf16_length(etl::string_view(text, length)) == 0U) &&
+           (etl::utf8_to_utf16(etl::string_view(text, length), etl::array_view<char16_t>(buffer16)) == 0U) &&
+           (etl::utf8_to_utf32(etl::string_view(text, length), etl::array_view<char32_t>(buffer32)) == 0U) &&
+           !etl::utf8_to_utf16(etl::string_view(text, length), s16) && s16.empty();
+  }
+
+  SUITE(test_utf_conversion)
+  {
+    //*************************************************************************
+    TEST(test_utf8_to_utf16)
+    {
+      const etl::string_view text(utf8_text);
+      const etl::u16string_view expected(utf16_text);
+
+      CHECK_EQUAL(expected.size(), etl::utf8_to_utf16_length(text));
+
+      etl::u16string<32> s(u">");
+      CHECK(etl::utf8_to_utf16(text, s));
+      CHECK(etl::u16string_view(s).substr(1) == expected);
+
+      char16_t buffer[32];
+      CHECK_EQUAL(expected.size(), etl::utf8_to_utf16(text, etl::array_view<char16_t>(buffer)));
+      CHECK(etl::u16string_view(buffer, expected.size()) == expected);
+
+      // Too small.
+      etl::u16string<16> small;
+      CHECK(!etl::utf8_to_utf16(text, small));
+      CHECK(small.empty());
+      CHECK_EQUAL(0U, etl::utf8_to_utf16(text, etl::array_view<char16_t>(buffer, expected.size() - 1U)));
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf32)
+    {
+      const etl::string_view text(utf8_text);
+      const etl::u32string_view expected(utf32_text);
+
+      CHECK_EQUAL(expected.size(), etl::utf8_to_utf32_length(text));
+
+      etl::u32string<32> s;
+      CHECK(etl::utf8_to_utf32(text, s));
+      CHECK(etl::u32string_view(s) == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_to_utf8)
+    {
+      const etl::string_view expected(utf8_text);
+
+      CHECK_EQUAL(expected.size(), etl::utf16_to_utf8_length(etl::u16string_view(utf16_text)));
+      CHECK_EQUAL(expected.size(), etl::utf32_to_utf8_length(etl::u32string_view(utf32_text)));
+
+      etl::string<40> s16;
+      etl::string<40> s32;
+      CHECK(etl::utf16_to_utf8(etl::u16string_view(utf16_text), s16));
+      CHECK(etl::utf32_to_utf8(etl::u32string_view(utf32_text), s32));
+      CHECK(etl::string_view(s16) == expected);
+      CHECK(etl::string_view(s32) == expected);
+
+      char buffer[40];
+      CHECK_EQUAL(expected.size(), etl::utf16_to_utf8(etl::u16string_view(utf16_text), etl::array_view<char>(buffer)));
+      CHECK(etl::string_view(buffer, expected.size()) == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::u16string<4> s16;
+      etl::string<4> s8;
+
+      CHECK_EQUAL(0U, etl::utf8_to_utf16_length(etl::string_view()));
+      CHECK(etl::utf8_to_utf16(etl::string_view(), s16));
+      CHECK(etl::utf16_to_utf8(etl::u16string_view(), s8));
+      CHECK(s16.empty());
+      CHECK(s8.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_long_ascii)
+    {
+      std::string ascii;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        ascii += char(32 + (i % 95));
+      }
+
+      ascii += "\xC3\xA9";
+
+      etl::u16string<1001> s16;
+      CHECK(etl::utf8_to_utf16(etl::string_view(ascii.data(), ascii.size()), s16));
+      CHECK_EQUAL(1001U, s16.size());
+      CHECK(s16[999] == char16_t(ascii[999]));
+      CHECK(s16[1000] == char16_t(0xE9));
+
+      etl::string<1002> s8;
+      CHECK(etl::utf16_to_utf8(etl::u16string_view(s16), s8));
+      CHECK(std::string(s8.data(), s8.size()) == ascii);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf8)
+    {
+      CHECK(is_invalid_utf8("\x80", 1U));                 // Lone continuation.
+      CHECK(is_invalid_utf8("\xC0\xAF", 2U));             // Overlong.
+      CHECK(is_invalid_utf8("\xE0\x80\xAF", 3U));         // Overlong.
+      CHECK(is_invalid_utf8("\xF0\x80\x80\xAF", 4U));     // Overlong.
+      CHECK(is_invalid_utf8("\xED\xA0\x80", 3U));         // Surrogate.
+      CHECK(is_invalid_utf8("\xF4\x90\x80\x80", 4U));     // Beyond U+10FFFF.
+      CHECK(is_invalid_utf8("\xF5\x80\x80\x80", 4U));
+      CHECK(is_invalid_utf8("\xE2\x82", 2U));             // Truncated.
+      CHECK(is_invalid_utf8("abc\xE2\x28\xA1", 6U));      // Bad continuation.
+      CHECK(is_invalid_utf8("0123456789abcdef\xFF", 17U));
+
+      // The extremes are valid.
+      CHECK_EQUAL(1U, etl::utf8_to_utf32_length(etl::string_view("\xEF\xBF\xBF", 3U)));
+      CHECK_EQUAL(2U, etl::utf8_to_utf16_length(etl::string_view("\xF4\x8F\xBF\xBF", 4U)));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf16_utf32)
+    {
+      const char16_t lone_high[] = { u'a', 0xD800, u'b' };
+      const char16_t lone_low[]  = { 0xDC00 };
+      const char16_t truncated[] = { u'a', 0xDBFF };
+      const char32_t surrogate[] = { 0xDFFF };
+      const char32_t too_big[]   = { 0x110000 };
+
+      CHECK_EQUAL(0U, etl::utf16_to_utf8_length(etl::u16string_view(lone_high, 3U)));
+      CHECK_EQUAL(0U, etl::utf16_to_utf8_length(etl::u16string_view(lone_low, 1U)));
+      CHECK_EQUAL(0U, etl::utf16_to_utf8_length(etl::u16string_view(truncated, 2U)));
+      CHECK_EQUAL(0U, etl::utf32_to_utf8_length(etl::u32string_view(surrogate, 1U)));
+      CHECK_EQUAL(0U, etl::utf32_to_utf8_length(etl::u32string_view(too_big, 1U)));
+
+      etl::string<8> s("x");
+      CHECK(!etl::utf16_to_utf8(etl::u16string_view(lone_high, 3U), s));
+      CHECK(etl::string_view(s) == etl::string_view("x"));
+    }
+
+    //*************************************************************************
+    TEST(test_random_round_trip)
+    {
+      etl::random_xorshift random(12345U);
+
+      for (int round = 0; round < 50; ++round)
+      {
+        std::u32string text;
+
+        for (int i = 0; i < 200; ++i)
+        {
+          char32_t cp;
+
+          switch (random.range(0U, 3U))
+          {
+            case 0:  cp = random.range(0U, 0x7FU); break;
+            case 1:  cp = random.range(0x80U, 0x7FFU); break;
+            case 2:  cp = random.range(0x800U, 0xFFFFU); break;
+            default: cp = random.range(0x10000U, 0x10FFFFU); break;
+          }
+
+          if ((cp >= 0xD800U) && (cp <= 0xDFFFU))
+          {
+            cp = U'?';
+          }
+
+          text += cp;
+        }
+
+        etl::string<1000> s8;
+        etl::u16string<400> s16;
+        etl::string<1000> s8_again;
+        etl::u32string<200> s32;
+
+        CHECK(etl::utf32_to_utf8(etl::u32string_view(text.data(), text.size()), s8));
+        CHECK(etl::utf8_to_utf16(etl::string_view(s8), s16));
+        CHECK(etl::utf16_to_utf8(etl::u16string_view(s16), s8_again));
+        CHECK(etl::utf8_to_utf32(etl::string_view(s8_again), s32));
+        CHECK(std::u32string(s32.data(), s32.size()) == text);
+      }
+    }
+  }
+}
@@ -167,6 +167,12 @@ namespace
     std::string s;
   };
 
+  //***************************************************************************
+  struct Large
+  {
+    char data[512];
+  };
+
   const size_t SIZE = 5;
 
   // Notice that the type declaration order is not important.
@@ -311,5 +317,125 @@ namespace
       p = variant_pool2.create<Derived1>();
       CHECK_THROW(variant_pool1.destroy(p), etl::variant_pool_did_not_create);
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_VARIANT_POOL_FORCE_CPP03)
+    //*************************************************************************
+    TEST(test_more_than_16_types)
+    {
+      typedef etl::variant_pool<2, char, short, int, long, float, double, Derived1, Derived2, Derived3, NonDerived,
+                                   signed char, unsigned char, unsigned short, unsigned int, unsigned long, long double, Large> LargeFactory;
+
+      LargeFactory variant_pool;
+
+      Large*    p1 = variant_pool.create<Large>();
+      Derived1* p2 = variant_pool.create<Derived1>();
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(variant_pool.full());
+      CHECK(sizeof(LargeFactory) >= 2U * sizeof(Large));
+
+      CHECK(variant_pool.destroy(p1));
+      CHECK(variant_pool.destroy(static_cast<Base*>(p2)));
+      CHECK(variant_pool.empty());
+    }
+#endif
+  };
+
+  typedef etl::segregated_variant_pool<Derived1, 4, Large, 1, Derived3, 2, int, 3> SegregatedFactory;
+
+  SUITE(test_segregated_variant_pool)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      SegregatedFactory variant_pool;
+
+      size_t ms = SegregatedFactory::MAX_SIZE;
+      CHECK_EQUAL(10U, ms);
+      CHECK_EQUAL(10U, variant_pool.max_size());
+      CHECK_EQUAL(4U, variant_pool.max_size<Derived1>());
+      CHECK_EQUAL(10U, variant_pool.available());
+      CHECK_EQUAL(0U, variant_pool.size());
+      CHECK(variant_pool.empty());
+      CHECK(!variant_pool.full());
+
+      // Only one item is sized for the large type.
+#if defined(ETL_POOL_STATISTICS)
+      // Each of the four slabs also has three 32 bit counters, padded to the pool's alignment.
+      CHECK(sizeof(SegregatedFactory) < ((2U * sizeof(Large)) + (4U * 4U * sizeof(uint32_t))));
+#else
+      CHECK(sizeof(SegregatedFactory) < (2U * sizeof(Large)));
+#endif
+
+      variant_pool.create<Derived1>();
+      CHECK_EQUAL(9U, variant_pool.available());
+      CHECK_EQUAL(3U, variant_pool.available<Derived1>());
+      CHECK_EQUAL(1U, variant_pool.available<Large>());
+      CHECK_EQUAL(1U, variant_pool.size());
+
+      variant_pool.create<Derived1>();
+      variant_pool.create<Derived1>();
+      variant_pool.create<Derived1>();
+      CHECK_EQUAL(0U, variant_pool.available<Derived1>());
+      CHECK(!variant_pool.full());
+
+      // Each type has its own slab.
+      CHECK_THROW(variant_pool.create<Derived1>(), etl::variant_pool_cannot_create);
+      CHECK(variant_pool.create<int>(1) != nullptr);
+      CHECK(variant_pool.create<Large>() != nullptr);
+      CHECK_THROW(variant_pool.create<Large>(), etl::variant_pool_cannot_create);
+
+      variant_pool.create<int>(2);
+      variant_pool.create<int>(3);
+      variant_pool.create<Derived3>();
+      variant_pool.create<Derived3>();
+      CHECK(variant_pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      SegregatedFactory variant_pool;
+
+      Derived1* pd1 = variant_pool.create<Derived1>();
+      pd1->Set();
+      CHECK_EQUAL(1, pd1->i);
+      variant_pool.destroy(pd1);
+      CHECK(destructor);
+      CHECK_EQUAL(4U, variant_pool.available<Derived1>());
+
+      // Destroy through the base type.
+      Base* p = variant_pool.create<Derived3>("1", "2");
+      CHECK_EQUAL("constructed12", static_cast<Derived3*>(p)->s);
+      CHECK_EQUAL(1U, variant_pool.available<Derived3>());
+      variant_pool.destroy(p);
+      CHECK(destructor);
+      CHECK_EQUAL(2U, variant_pool.available<Derived3>());
+
+      int* pi = variant_pool.create<int>(42);
+      CHECK_EQUAL(42, *pi);
+      variant_pool.destroy(pi);
+
+      CHECK(variant_pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_did_not_create)
+    {
+      SegregatedFactory variant_pool1;
+      SegregatedFactory variant_pool2;
+
+      Base* p;
+
+      p = variant_pool1.create<Derived1>();
+      CHECK_NO_THROW(variant_pool1.destroy(p));
+
+      p = variant_pool2.create<Derived1>();
+      CHECK_THROW(variant_pool1.destroy(p), etl::variant_pool_did_not_create);
+
+      Derived1* pd1 = variant_pool2.create<Derived1>();
+      CHECK_THROW(variant_pool1.destroy(pd1), etl::variant_pool_did_not_create);
+    }
   };
 }
@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/variant_variadic.h"
+
+#include <string>
+#include <type_traits>
+
+namespace
+{
+  //***************************************************************************
+  // Counts live instances.
+  //***************************************************************************
+  struct Counted
+  {
+    Counted()
+      : value(0)
+    {
+      ++instances;
+    }
+
+    explicit Counted(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    Counted& operator =(const Counted& other)
+    {
+      value = other.value;
+      ++assignments;
+      return *this;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+    static int assignments;
+  };
+
+  int Counted::instances   = 0;
+  int Counted::assignments = 0;
+
+  //***************************************************************************
+  struct Sizer
+  {
+    size_t operator()(char)               const { return 1U; }
+    size_t operator()(int)                const { return 4U; }
+    size_t operator()(const std::string& s) const { return s.size(); }
+    size_t operator()(const Counted&)     const { return 100U; }
+  };
+
+  struct Doubler
+  {
+    void operator()(char& c)        { c = char(c * 2); }
+    void operator()(int& i)         { i *= 2; }
+    void operator()(std::string& s) { s += s; }
+    void operator()(Counted& c)     { c.value *= 2; }
+  };
+
+  struct A { int a; };
+  struct B { double b; };
+
+  typedef etl::variadic_variant<char, int, std::string, Counted> Variant;
+  typedef etl::variadic_variant<char, int, A, B>                 Trivial;
+
+  // Many types, more than etl::variant supports.
+  typedef etl::variadic_variant<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
+                                int64_t, uint64_t, float, double, char, bool> Wide;
+
+  SUITE(test_variant_variadic)
+  {
+    //*************************************************************************
+    TEST(test_trivial_types_give_a_trivial_variant)
+    {
+      CHECK(std::is_trivially_destructible<Trivial>::value);
+      CHECK(std::is_trivially_copy_constructible<Trivial>::value);
+      CHECK(std::is_trivially_copy_assignable<Trivial>::value);
+      CHECK(std::is_trivially_copyable<Trivial>::value);
+
+      CHECK(!std::is_trivially_destructible<Variant>::value);
+      CHECK(!std::is_trivially_copy_constructible<Variant>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Variant v;
+
+      CHECK_EQUAL(0U, v.index());
+      CHECK(etl::holds_alternative<char>(v));
+      CHECK_EQUAL(char(0), etl::get<char>(v));
+      CHECK(!v.valueless_by_exception());
+    }
+
+    //*************************************************************************
+    TEST(test_construct_and_get)
+    {
+      Variant v(std::string("hello"));
+
+      CHECK_EQUAL(2U, v.index());
+      CHECK(etl::holds_alternative<std::string>(v));
+      CHECK_EQUAL(std::string("hello"), etl::get<std::string>(v));
+      CHECK_EQUAL(std::string("hello"), etl::get<2>(v));
+      CHECK(etl::get_if<int>(&v) == nullptr);
+      CHECK(etl::get_if<std::string>(&v) != nullptr);
+
+      CHECK_THROW(etl::get<int>(v), etl::variadic_variant_bad_access);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_changes_type)
+    {
+      Counted::instances = 0;
+
+      {
+        Variant v(Counted(3));
+        CHECK_EQUAL(1, Counted::instances);
+
+        v = 5;
+        CHECK_EQUAL(0, Counted::instances);
+        CHECK_EQUAL(5, etl::get<int>(v));
+
+        v = std::string("text");
+        CHECK_EQUAL(std::string("text"), etl::get<std::string>(v));
+
+        v.emplace<Counted>(7);
+        CHECK_EQUAL(1, Counted::instances);
+        CHECK_EQUAL(7, etl::get<Counted>(v).value);
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_same_type_assigns_in_place)
+    {
+      Counted::instances   = 0;
+      Counted::assignments = 0;
+
+      {
+        Variant v(Counted(1));
+        Variant w(Counted(2));
+
+        v = w;
+        CHECK_EQUAL(1, Counted::assignments);
+        CHECK_EQUAL(2, etl::get<Counted>(v).value);
+        CHECK_EQUAL(2, Counted::instances);
+
+        v = Counted(4);
+        CHECK_EQUAL(2, Counted::assignments);
+        CHECK_EQUAL(4, etl::get<Counted>(v).value);
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Variant v(std::string("copy"));
+      Variant copied(v);
+      CHECK_EQUAL(std::string("copy"), etl::get<std::string>(copied));
+
+      Variant moved(std::move(copied));
+      CHECK_EQUAL(std::string("copy"), etl::get<std::string>(moved));
+
+      Variant assigned;
+      assigned = moved;
+      CHECK_EQUAL(std::string("copy"), etl::get<std::string>(assigned));
+
+      Variant move_assigned(1);
+      move_assigned = std::move(assigned);
+      CHECK_EQUAL(std::string("copy"), etl::get<std::string>(move_assigned));
+    }
+
+    //*************************************************************************
+    TEST(test_visit)
+    {
+      Variant v('a');
+      CHECK_EQUAL(1U, etl::visit(Sizer(), v));
+
+      v = 10;
+      CHECK_EQUAL(4U, etl::visit(Sizer(), v));
+      etl::visit(Doubler(), v);
+      CHECK_EQUAL(20, etl::get<int>(v));
+
+      v = std::string("abc");
+      etl::visit(Doubler(), v);
+      CHECK_EQUAL(6U, etl::visit(Sizer(), static_cast<const Variant&>(v)));
+
+      v = Counted(1);
+      CHECK_EQUAL(100U, etl::visit(Sizer(), v));
+    }
+
+    //*************************************************************************
+    TEST(test_visit_lambda)
+    {
+      Trivial t(B{ 2.5 });
+
+      double result = etl::visit([](const auto& value) { return sizeof(value) * 1.0; }, t);
+      CHECK_EQUAL(sizeof(B) * 1.0, result);
+    }
+
+    //*************************************************************************
+    TEST(test_many_types)
+    {
+      Wide w(true);
+
+      CHECK_EQUAL(11U, w.index());
+      CHECK(etl::get<bool>(w));
+
+      w = 1.5;
+      CHECK_EQUAL(9U, w.index());
+      CHECK_EQUAL(1.5, etl::visit([](auto value) { return double(value); }, w));
+
+      CHECK(sizeof(Wide) <= (2U * sizeof(uint64_t)));
+    }
+
+    //*************************************************************************
+    TEST(test_trivial_copy)
+    {
+      Trivial t1(A{ 42 });
+      Trivial t2(t1);
+
+      CHECK_EQUAL(42, etl::get<A>(t2).a);
+
+      t2 = 'x';
+      t1 = t2;
+      CHECK_EQUAL('x', etl::get<char>(t1));
+    }
+  };
+}
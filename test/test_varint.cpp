@@ -0,0 +1,297 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/varint.h"
+#include "etl/random.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  Bytes encode_all(const std::vector<uint64_t>& values)
+  {
+    Bytes encoded(values.size() * 10U);
+
+    size_t n = etl::varint_encode(etl::array_view<const uint64_t>(values.data(), values.size()),
+                                  etl::array_view<uint8_t>(encoded.data(), encoded.size()));
+    encoded.resize(n);
+
+    return encoded;
+  }
+
+  //*************************************************************************
+  // A mix of lengths, mostly single bytes, as seen in typical payloads.
+  std::vector<uint64_t> mixed_values(size_t count, uint32_t seed)
+  {
+    etl::random_xorshift random(seed);
+    std::vector<uint64_t> values;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      const uint32_t kind = random.range(0U, 9U);
+      uint64_t value = (uint64_t(random()) << 32) | random();
+
+      if (kind < 6U)
+      {
+        value &= 0x7FU;
+      }
+      else if (kind < 8U)
+      {
+        value >>= (random.range(1U, 63U));
+      }
+
+      values.push_back(value);
+    }
+
+    return values;
+  }
+
+  SUITE(test_varint)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      CHECK_EQUAL(5U, etl::varint_max_size<uint32_t>::value);
+      CHECK_EQUAL(10U, etl::varint_max_size<uint64_t>::value);
+      CHECK_EQUAL(1U, etl::varint_size(0U));
+      CHECK_EQUAL(1U, etl::varint_size(127U));
+      CHECK_EQUAL(2U, etl::varint_size(128U));
+      CHECK_EQUAL(5U, etl::varint_size(UINT32_MAX));
+      CHECK_EQUAL(9U, etl::varint_size(UINT64_MAX >> 1));
+      CHECK_EQUAL(10U, etl::varint_size(UINT64_MAX));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_decode_single)
+    {
+      uint8_t buffer[10];
+
+      CHECK_EQUAL(2U, etl::varint_encode(300U, etl::array_view<uint8_t>(buffer)));
+      CHECK_EQUAL(0xACU, buffer[0]);
+      CHECK_EQUAL(0x02U, buffer[1]);
+
+      uint32_t value32 = 0U;
+      CHECK_EQUAL(2U, etl::varint_decode(etl::array_view<const uint8_t>(buffer, 10U), value32));
+      CHECK_EQUAL(300U, value32);
+
+      CHECK_EQUAL(10U, etl::varint_encode(UINT64_MAX, etl::array_view<uint8_t>(buffer)));
+      CHECK_EQUAL(0x01U, buffer[9]);
+
+      uint64_t value64 = 0U;
+      CHECK_EQUAL(10U, etl::varint_decode(etl::array_view<const uint8_t>(buffer, 10U), value64));
+      CHECK(UINT64_MAX == value64);
+
+      // Too big for the type.
+      CHECK_EQUAL(0U, etl::varint_decode(etl::array_view<const uint8_t>(buffer, 10U), value32));
+
+      uint8_t value8;
+      CHECK_EQUAL(0U, etl::varint_decode(etl::array_view<const uint8_t>(buffer, 2U), value8));
+
+      // No room.
+      CHECK_EQUAL(0U, etl::varint_encode(UINT64_MAX, etl::array_view<uint8_t>(buffer, 9U)));
+    }
+
+    //*************************************************************************
+    TEST(test_decode_malformed)
+    {
+      const uint8_t incomplete[] = { 0x80U, 0x80U };
+      const uint8_t too_long[]   = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x01U };
+      const uint8_t overflow[]   = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x02U };
+      uint64_t value;
+
+      CHECK_EQUAL(0U, etl::varint_decode(etl::array_view<const uint8_t>(incomplete), value));
+      CHECK_EQUAL(0U, etl::varint_decode(etl::array_view<const uint8_t>(too_long), value));
+      CHECK_EQUAL(0U, etl::varint_decode(etl::array_view<const uint8_t>(overflow), value));
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_round_trip)
+    {
+      for (uint32_t seed = 1U; seed < 20U; ++seed)
+      {
+        const std::vector<uint64_t> values = mixed_values(1000U, seed);
+        const Bytes encoded = encode_all(values);
+
+        std::vector<uint64_t> decoded(values.size() + 5U);
+        size_t used = 0U;
+
+        size_t n = etl::varint_decode(etl::array_view<const uint8_t>(encoded.data(), encoded.size()),
+                                      etl::array_view<uint64_t>(decoded.data(), decoded.size()),
+                                      used);
+
+        CHECK_EQUAL(values.size(), n);
+        CHECK_EQUAL(encoded.size(), used);
+        decoded.resize(n);
+        CHECK(values == decoded);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_single_bytes_uint32)
+    {
+      std::vector<uint64_t> values;
+
+      for (uint64_t i = 0U; i < 1000U; ++i)
+      {
+        values.push_back(i % 128U);
+      }
+
+      const Bytes encoded = encode_all(values);
+      CHECK_EQUAL(values.size(), encoded.size());
+
+      std::vector<uint32_t> decoded(values.size());
+      size_t used = 0U;
+
+      CHECK_EQUAL(values.size(), etl::varint_decode(etl::array_view<const uint8_t>(encoded.data(), encoded.size()),
+                                                    etl::array_view<uint32_t>(decoded.data(), decoded.size()),
+                                                    used));
+      CHECK_EQUAL(encoded.size(), used);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        CHECK_EQUAL(uint32_t(values[i]), decoded[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_small_destination_resumes)
+    {
+      const std::vector<uint64_t> values = mixed_values(500U, 42U);
+      const Bytes encoded = encode_all(values);
+
+      std::vector<uint64_t> decoded;
+      size_t offset = 0U;
+
+      // Seven at a time.
+      while (offset < encoded.size())
+      {
+        uint64_t chunk[7];
+        size_t used = 0U;
+
+        size_t n = etl::varint_decode(etl::array_view<const uint8_t>(encoded.data() + offset, encoded.size() - offset),
+                                      etl::array_view<uint64_t>(chunk),
+                                      used);
+
+        CHECK(n != 0U);
+
+        if (n == 0U)
+        {
+          break;
+        }
+
+        decoded.insert(decoded.end(), chunk, chunk + n);
+        offset += used;
+      }
+
+      CHECK(values == decoded);
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_stops_at_error)
+    {
+      std::vector<uint64_t> values = mixed_values(100U, 7U);
+      values[60] = uint64_t(UINT32_MAX) + 1U;
+
+      const Bytes encoded = encode_all(values);
+
+      std::vector<uint32_t> decoded(values.size());
+      size_t used = 0U;
+
+      size_t n = etl::varint_decode(etl::array_view<const uint8_t>(encoded.data(), encoded.size()),
+                                    etl::array_view<uint32_t>(decoded.data(), decoded.size()),
+                                    used);
+
+      // Stops at the first value that is too big for a uint32_t.
+      size_t expected = 0U;
+      size_t expected_used = 0U;
+
+      while ((expected < values.size()) && (values[expected] <= UINT32_MAX))
+      {
+        expected_used += etl::varint_size(values[expected]);
+        ++expected;
+      }
+
+      CHECK_EQUAL(expected, n);
+      CHECK_EQUAL(expected_used, used);
+
+      // A truncated final varint is left for the next call.
+      Bytes truncated = encode_all(mixed_values(100U, 8U));
+      truncated.push_back(0x81U);
+
+      std::vector<uint64_t> decoded64(200U);
+      n = etl::varint_decode(etl::array_view<const uint8_t>(truncated.data(), truncated.size()),
+                             etl::array_view<uint64_t>(decoded64.data(), decoded64.size()),
+                             used);
+
+      CHECK_EQUAL(100U, n);
+      CHECK_EQUAL(truncated.size() - 1U, used);
+    }
+
+    //*************************************************************************
+    TEST(test_encode_bulk_no_room)
+    {
+      const uint32_t values[] = { 1U, 2U, 300U };
+      uint8_t buffer[3];
+
+      CHECK_EQUAL(0U, etl::varint_encode(etl::array_view<const uint32_t>(values), etl::array_view<uint8_t>(buffer)));
+    }
+
+    //*************************************************************************
+    TEST(test_bit_stream)
+    {
+      unsigned char buffer[32];
+      etl::bit_stream stream(buffer, sizeof(buffer));
+
+      CHECK(stream.put(true));
+      CHECK(etl::varint_encode(stream, 300U));
+      CHECK(etl::varint_encode(stream, etl::zigzag_encode(int64_t(-70000))));
+      CHECK(etl::varint_encode(stream, 70000U));
+
+      stream.restart();
+
+      bool bit;
+      uint16_t value16;
+      uint64_t value64;
+      uint16_t too_small;
+
+      CHECK(stream.get(bit));
+      CHECK(etl::varint_decode(stream, value16));
+      CHECK_EQUAL(300U, value16);
+      CHECK(etl::varint_decode(stream, value64));
+      CHECK(-70000 == etl::zigzag_decode(value64));
+      CHECK(!etl::varint_decode(stream, too_small));
+    }
+  }
+}
@@ -1126,5 +1126,83 @@ namespace
       CHECK_EQUAL(raw[4].i, dest[6].i);
       CHECK_EQUAL(raw[5].i, dest[7].i);
     }
+
+    //*************************************************************************
+    TEST(test_trivially_copyable_struct_operations)
+    {
+      struct S
+      {
+        int32_t i;
+        int32_t j;
+        int64_t k;
+      };
+
+      typedef etl::vector<S, 20> Data;
+      typedef std::vector<S>     Compare;
+
+      Data    data;
+      Compare compare;
+
+      for (int32_t n = 0; n < 10; ++n)
+      {
+        S s = { n, -n, n * 10 };
+        data.push_back(s);
+        compare.push_back(s);
+      }
+
+      S value = { 100, 200, 300 };
+      data.insert(data.begin() + 3, value);
+      compare.insert(compare.begin() + 3, value);
+
+      data.insert(data.begin() + 1, 3, value);
+      compare.insert(compare.begin() + 1, 3, value);
+
+      const Compare source(compare.begin(), compare.begin() + 4);
+      data.insert(data.begin() + 5, source.begin(), source.end());
+      compare.insert(compare.begin() + 5, source.begin(), source.end());
+
+      data.erase(data.begin() + 2);
+      compare.erase(compare.begin() + 2);
+
+      data.erase(data.begin() + 4, data.begin() + 9);
+      compare.erase(compare.begin() + 4, compare.begin() + 9);
+
+      Data copy(data);
+
+      CHECK_EQUAL(compare.size(), copy.size());
+
+      for (size_t n = 0U; n < compare.size(); ++n)
+      {
+        CHECK_EQUAL(compare[n].i, copy[n].i);
+        CHECK_EQUAL(compare[n].j, copy[n].j);
+        CHECK_EQUAL(compare[n].k, copy[n].k);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_unchecked)
+    {
+      const int values[] = { 3, 4, 5, 6 };
+
+      Data data;
+
+      CHECK(data.reserve_check(2U));
+      data.push_back_unchecked(1);
+      data.emplace_back_unchecked(2);
+
+      CHECK(data.reserve_check(4U));
+      data.append_unchecked(values, values + 4);
+
+      CHECK_EQUAL(6U, data.size());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 1), data[i]);
+      }
+
+      CHECK(data.reserve_check(SIZE - 6U));
+      CHECK_THROW(data.reserve_check(SIZE - 5U), etl::vector_full);
+    }
+
   };
 }
@@ -1805,5 +1805,24 @@ namespace
       CHECK(i1 == *i2);
       CHECK(&i1 == i2);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_unchecked)
+    {
+      int i1 = 1;
+      int i2 = 2;
+      Data data;
+
+      CHECK(data.reserve_check(2U));
+      data.push_back_unchecked(&i1);
+      data.push_back_unchecked(&i2);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK(data[0] == &i1);
+      CHECK(data[1] == &i2);
+
+      CHECK_THROW(data.reserve_check(SIZE - 1U), etl::vector_full);
+    }
+
   };
 }
@@ -0,0 +1,193 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include "etl/windowed_statistics.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace
+{
+  // Recomputes the statistics of the last 'size' samples from scratch.
+  template <typename T>
+  struct Reference
+  {
+    explicit Reference(size_t size_)
+      : size(size_)
+    {
+    }
+
+    void add(T value)
+    {
+      window.push_back(value);
+
+      if (window.size() > size)
+      {
+        window.pop_front();
+      }
+    }
+
+    double mean() const
+    {
+      double sum = 0.0;
+      for (size_t i = 0U; i < window.size(); ++i) { sum += double(window[i]); }
+      return sum / double(window.size());
+    }
+
+    double variance() const
+    {
+      const double m = mean();
+      double sum = 0.0;
+      for (size_t i = 0U; i < window.size(); ++i) { sum += (double(window[i]) - m) * (double(window[i]) - m); }
+      return sum / double(window.size());
+    }
+
+    T minimum() const { return *std::min_element(window.begin(), window.end()); }
+    T maximum() const { return *std::max_element(window.begin(), window.end()); }
+
+    size_t        size;
+    std::deque<T> window;
+  };
+
+  SUITE(test_windowed_statistics)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::windowed_statistics<int16_t, 8> stats;
+
+      CHECK(stats.empty());
+      CHECK(!stats.full());
+      CHECK_EQUAL(0U, stats.count());
+      CHECK_EQUAL(0, stats.mean());
+      CHECK_EQUAL(0, stats.variance());
+      CHECK_EQUAL(0, stats.minimum());
+      CHECK_EQUAL(0, stats.maximum());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_window)
+    {
+      etl::windowed_statistics<int16_t, 4> stats;
+
+      stats.add(2);
+      stats.add(4);
+      stats.add(4);
+      stats.add(6);
+
+      CHECK(stats.full());
+      CHECK_EQUAL(16, stats.sum());
+      CHECK_EQUAL(4,  stats.mean());
+      CHECK_EQUAL(2,  stats.variance());        // 8 / 4
+      CHECK_EQUAL(2,  stats.sample_variance()); // 8 / 3, truncated
+      CHECK_EQUAL(2,  stats.minimum());
+      CHECK_EQUAL(6,  stats.maximum());
+
+      // The 2 leaves the window.
+      stats.add(10);
+
+      CHECK_EQUAL(4U, stats.count());
+      CHECK_EQUAL(24, stats.sum());
+      CHECK_EQUAL(6,  stats.mean());
+      CHECK_EQUAL(4,  stats.minimum());
+      CHECK_EQUAL(10, stats.maximum());
+
+      stats.clear();
+      CHECK(stats.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_against_reference)
+    {
+      etl::windowed_statistics<int32_t, 7> stats;
+      Reference<int32_t> reference(7);
+
+      for (int i = 0; i < 500; ++i)
+      {
+        const int32_t value = ((i * 7919) % 2001) - 1000;
+
+        stats.add(value);
+        reference.add(value);
+
+        CHECK_EQUAL(reference.minimum(), stats.minimum());
+        CHECK_EQUAL(reference.maximum(), stats.maximum());
+
+        int64_t sum = 0;
+        for (size_t j = 0U; j < reference.window.size(); ++j) { sum += reference.window[j]; }
+        CHECK_EQUAL(sum, stats.sum());
+
+        CHECK_CLOSE(reference.variance(), double(stats.variance()), 1.0);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_against_reference)
+    {
+      etl::windowed_statistics<double, 16> stats;
+      Reference<double> reference(16);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        // A large offset, where naive running sums of squares lose precision.
+        const double value = 1.0e6 + double((i * 37) % 101) * 0.01;
+
+        stats.add(value);
+        reference.add(value);
+
+        CHECK_CLOSE(reference.mean(),     stats.mean(),     1.0e-6);
+        CHECK_CLOSE(reference.variance(), stats.variance(), 1.0e-6);
+        CHECK_EQUAL(reference.minimum(),  stats.minimum());
+        CHECK_EQUAL(reference.maximum(),  stats.maximum());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_monotonic_extremes)
+    {
+      etl::windowed_statistics<int, 3> stats;
+
+      // Descending, then ascending; each extreme must expire on time.
+      int values[]   = { 9, 8, 7, 6, 5, 6, 7, 8, 9 };
+      int minimums[] = { 9, 8, 7, 6, 5, 5, 5, 6, 7 };
+      int maximums[] = { 9, 9, 9, 8, 7, 6, 7, 8, 9 };
+
+      for (size_t i = 0U; i < 9U; ++i)
+      {
+        stats.add(values[i]);
+        CHECK_EQUAL(minimums[i], stats.minimum());
+        CHECK_EQUAL(maximums[i], stats.maximum());
+      }
+    }
+  };
+}
@@ -0,0 +1,232 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+
+#include "etl/work_stealing_deque.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  SUITE(test_work_stealing_deque)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::work_stealing_deque<int, 8> deque;
+
+      CHECK_EQUAL(8U, deque.capacity());
+      CHECK_EQUAL(8U, deque.max_size());
+      CHECK_EQUAL(0U, deque.size());
+      CHECK(deque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_owner_is_lifo_thief_is_fifo)
+    {
+      etl::work_stealing_deque<int, 8> deque;
+
+      CHECK(deque.push(1));
+      CHECK(deque.push(2));
+      CHECK(deque.push(3));
+      CHECK(deque.push(4));
+      CHECK_EQUAL(4U, deque.size());
+
+      int value;
+
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(4, value);
+
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(1, value);
+
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(3, value);
+
+      // The last value.
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(2, value);
+
+      CHECK(!deque.pop(value));
+      CHECK(!deque.steal(value));
+      CHECK(deque.empty());
+
+      CHECK(deque.push(5));
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(5, value);
+      CHECK(!deque.pop(value));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      CHECK(deque.push(0));
+      CHECK(deque.push(1));
+      CHECK(deque.push(2));
+      CHECK(deque.push(3));
+      CHECK(!deque.push(4));
+
+      int value;
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(0, value);
+      CHECK(deque.push(4));
+      CHECK(!deque.push(5));
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      int next_steal = 0;
+      int value;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK(deque.push(i));
+        CHECK(deque.push(-1));
+
+        CHECK(deque.pop(value));
+        CHECK_EQUAL(-1, value);
+
+        if ((i % 2) == 1)
+        {
+          CHECK(deque.steal(value));
+          CHECK_EQUAL(next_steal++, value);
+          CHECK(deque.steal(value));
+          CHECK_EQUAL(next_steal++, value);
+        }
+      }
+
+      CHECK(deque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_pointers)
+    {
+      int items[3] = { 10, 20, 30 };
+
+      etl::work_stealing_deque<int*, 4> deque;
+
+      CHECK(deque.push(&items[0]));
+      CHECK(deque.push(&items[1]));
+      CHECK(deque.push(&items[2]));
+
+      int* p_item = nullptr;
+
+      CHECK(deque.steal(p_item));
+      CHECK_EQUAL(10, *p_item);
+      CHECK(deque.pop(p_item));
+      CHECK_EQUAL(30, *p_item);
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::work_stealing_deque<int, 64> deque;
+      static const int count = 100000;
+      static std::vector<int> taken[3];
+
+      std::thread thieves[2];
+
+      static std::atomic<bool> done(false);
+
+      for (int t = 0; t < 2; ++t)
+      {
+        thieves[t] = std::thread([t]()
+        {
+          int value;
+
+          while (!done || !deque.empty())
+          {
+            if (deque.steal(value))
+            {
+              taken[t + 1].push_back(value);
+            }
+          }
+        });
+      }
+
+      int value;
+
+      for (int i = 0; i < count;)
+      {
+        if (deque.push(i))
+        {
+          ++i;
+        }
+
+        if (((i % 3) == 0) && deque.pop(value))
+        {
+          taken[0].push_back(value);
+        }
+      }
+
+      while (deque.pop(value))
+      {
+        taken[0].push_back(value);
+      }
+
+      done = true;
+
+      thieves[0].join();
+      thieves[1].join();
+
+      std::vector<int> all;
+
+      for (int t = 0; t < 3; ++t)
+      {
+        all.insert(all.end(), taken[t].begin(), taken[t].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(count), all.size());
+
+      for (int i = 0; i < count; ++i)
+      {
+        CHECK_EQUAL(i, all[i]);
+      }
+    }
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,227 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <list>
+#include <string.h>
+#include <stdint.h>
+
+#include "etl/wyhash.h"
+#include "etl/hash.h"
+#include "etl/cstring.h"
+
+namespace
+{
+  //***************************************************************************
+  // One shot version of the algorithm, used to check the streaming version.
+  //***************************************************************************
+  namespace reference
+  {
+    const uint64_t secret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+    void mum(uint64_t* a, uint64_t* b)
+    {
+      __uint128_t r = *a;
+      r *= *b;
+      *a = uint64_t(r);
+      *b = uint64_t(r >> 64);
+    }
+
+    uint64_t mix(uint64_t a, uint64_t b)
+    {
+      mum(&a, &b);
+      return a ^ b;
+    }
+
+    uint64_t r8(const uint8_t* p) { uint64_t v; memcpy(&v, p, 8); return v; }
+    uint64_t r4(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+    uint64_t r3(const uint8_t* p, size_t k) { return (uint64_t(p[0]) << 16) | (uint64_t(p[k >> 1]) << 8) | p[k - 1]; }
+
+    uint64_t wyhash(const void* key, size_t len, uint64_t seed)
+    {
+      const uint8_t* p = (const uint8_t*)key;
+      seed ^= mix(seed ^ secret[0], secret[1]);
+      uint64_t a, b;
+
+      if (len <= 16)
+      {
+        if (len >= 4)
+        {
+          a = (r4(p) << 32) | r4(p + ((len >> 3) << 2));
+          b = (r4(p + len - 4) << 32) | r4(p + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0)
+        {
+          a = r3(p, len);
+          b = 0;
+        }
+        else
+        {
+          a = b = 0;
+        }
+      }
+      else
+      {
+        size_t i = len;
+
+        if (i > 48)
+        {
+          uint64_t see1 = seed, see2 = seed;
+
+          do
+          {
+            seed = mix(r8(p) ^ secret[1], r8(p + 8) ^ seed);
+            see1 = mix(r8(p + 16) ^ secret[2], r8(p + 24) ^ see1);
+            see2 = mix(r8(p + 32) ^ secret[3], r8(p + 40) ^ see2);
+            p += 48;
+            i -= 48;
+          } while (i > 48);
+
+          seed ^= see1 ^ see2;
+        }
+
+        while (i > 16)
+        {
+          seed = mix(r8(p) ^ secret[1], r8(p + 8) ^ seed);
+          i -= 16;
+          p += 16;
+        }
+
+        a = r8(p + i - 16);
+        b = r8(p + i - 8);
+      }
+
+      a ^= secret[1];
+      b ^= seed;
+      mum(&a, &b);
+
+      return mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+  }
+
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+      data[i] = uint8_t((i * 131U) + 7U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_matches_one_shot)
+    {
+      for (size_t length = 0U; length < 200U; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        uint64_t compare = reference::wyhash(data.data(), data.size(), 0U);
+
+        CHECK_EQUAL(compare, uint64_t(etl::wyhash(data.data(), data.data() + data.size())));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_values)
+    {
+      for (size_t length = 0U; length < 200U; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        etl::wyhash hash;
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          hash.add(data[i]);
+        }
+
+        std::list<uint8_t> list_data(data.begin(), data.end());
+
+        uint64_t compare = reference::wyhash(data.data(), data.size(), 0U);
+
+        CHECK_EQUAL(compare, hash.value());
+        CHECK_EQUAL(compare, uint64_t(etl::wyhash(list_data.begin(), list_data.end())));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_split_ranges)
+    {
+      std::vector<uint8_t> data = make_data(300U);
+
+      uint64_t compare = reference::wyhash(data.data(), data.size(), 0U);
+
+      for (size_t split = 0U; split <= data.size(); ++split)
+      {
+        etl::wyhash hash;
+        hash.add(data.data(), data.data() + split);
+        hash.add(data.data() + split, data.data() + data.size());
+
+        CHECK_EQUAL(compare, hash.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_seed)
+    {
+      std::string data("123456789");
+
+      uint64_t hash0 = etl::wyhash(data.begin(), data.end(), 0U);
+      uint64_t hash1 = etl::wyhash(data.begin(), data.end(), 1U);
+
+      CHECK(hash0 != hash1);
+      CHECK_EQUAL(reference::wyhash(data.data(), data.size(), 1U), hash1);
+
+      etl::wyhash hash(1U);
+      hash.add(data.begin(), data.end());
+      CHECK_EQUAL(hash1, hash.value());
+
+      hash.reset();
+      hash.add(data.begin(), data.end());
+      CHECK_EQUAL(hash1, hash.value());
+    }
+
+    //*************************************************************************
+    TEST(test_hash_using_wyhash)
+    {
+      typedef etl::hash_using<etl::wyhash, etl::string<20> > string_hash;
+
+      etl::string<20> text("123456789");
+
+      CHECK_EQUAL(size_t(reference::wyhash(text.data(), text.size(), 0U)), string_hash()(text));
+    }
+  };
+}
@@ -144,6 +144,35 @@ namespace
       CHECK_EQUAL(hash1, hash2);
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_checksum_contiguous_block_matches_byte_wise)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < 1200; ++i)
+      {
+        data.push_back(uint8_t((i * 89) + 7));
+      }
+
+      // Every alignment and tail length, plus blocks longer than the lane fold limit.
+      for (size_t offset = 0; offset < 8; ++offset)
+      {
+        for (size_t length = 0; length < 1200 - offset; length += (length < 64) ? 1 : 97)
+        {
+          etl::xor_checksum<uint32_t> byte_wise;
+
+          for (size_t i = offset; i < offset + length; ++i)
+          {
+            byte_wise.add(data[i]);
+          }
+
+          const uint8_t* begin = data.data() + offset;
+          etl::xor_checksum<uint32_t> block(begin, begin + length);
+
+          CHECK_EQUAL(byte_wise.value(), block.value());
+        }
+      }
+    }
   };
 }
-
@@ -0,0 +1,219 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+
+#include <vector>
+
+#include "etl/xor_filter.h"
+
+#include "etl/fnv_1.h"
+#include "etl/char_traits.h"
+
+namespace
+{
+  struct text_hash_t
+  {
+    typedef const char* argument_type;
+
+    size_t operator ()(argument_type text) const
+    {
+      return etl::fnv_1a_32(text, text + etl::char_traits<char>::length(text));
+    }
+  };
+
+  struct integer_hash_t
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return size_t(value) * 0x9E3779B1UL;
+    }
+  };
+
+  const char* exist_text[]     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
+  const char* not_exist_text[] = { "My", "hovercraft", "is", "full", "of", "eels" };
+
+  SUITE(test_xor_filter)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::xor_filter<16, text_hash_t> filter;
+
+      CHECK(filter.empty());
+      CHECK_EQUAL(0U, filter.size());
+      CHECK_EQUAL(16U, filter.max_size());
+      CHECK(filter.capacity() >= 16U);
+      CHECK(!filter.exists("The"));
+    }
+
+    //*************************************************************************
+    TEST(test_build_text)
+    {
+      etl::xor_filter<16, text_hash_t> filter;
+
+      CHECK(filter.build(etl::begin(exist_text), etl::end(exist_text)));
+      CHECK_EQUAL(9U, filter.size());
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(exist_text); ++i)
+      {
+        CHECK(filter.exists(exist_text[i]));
+      }
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(not_exist_text); ++i)
+      {
+        CHECK(!filter.exists(not_exist_text[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_build_many_keys_with_workspace)
+    {
+      typedef etl::xor_filter<10000, integer_hash_t> Filter;
+
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        keys.push_back(i * 2U);
+      }
+
+      static Filter            filter;
+      static Filter::workspace work_area;
+
+      CHECK(filter.build(keys.begin(), keys.end(), work_area));
+      CHECK_EQUAL(10000U, filter.size());
+
+      // No false negatives.
+      size_t found = 0U;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        found += filter.exists(keys[i]) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(keys.size(), found);
+
+      // About 1 in 256 false positives for 8 bit fingerprints.
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 0U; i < 100000U; ++i)
+      {
+        false_positives += filter.exists((i * 2U) + 1U) ? 1U : 0U;
+      }
+
+      CHECK(false_positives > 0U);
+      CHECK(false_positives < 800U);
+    }
+
+    //*************************************************************************
+    TEST(test_wider_fingerprint)
+    {
+      typedef etl::xor_filter<10000, integer_hash_t, uint16_t> Filter;
+
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        keys.push_back(i * 2U);
+      }
+
+      static Filter filter;
+
+      CHECK(filter.build(keys.begin(), keys.end()));
+
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 0U; i < 100000U; ++i)
+      {
+        false_positives += filter.exists((i * 2U) + 1U) ? 1U : 0U;
+      }
+
+      // About 1 in 65536.
+      CHECK(false_positives < 20U);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_keys)
+    {
+      etl::xor_filter<16, text_hash_t> filter;
+
+      const char* text[] = { "rain", "Spain", "rain", "plain", "Spain" };
+
+      CHECK(filter.build(etl::begin(text), etl::end(text)));
+      CHECK_EQUAL(3U, filter.size());
+      CHECK(filter.exists("rain"));
+      CHECK(filter.exists("Spain"));
+      CHECK(filter.exists("plain"));
+    }
+
+    //*************************************************************************
+    TEST(test_too_many_keys)
+    {
+      etl::xor_filter<8, text_hash_t> filter;
+
+      CHECK(!filter.build(etl::begin(exist_text), etl::end(exist_text)));
+      CHECK(filter.empty());
+      CHECK(!filter.exists("The"));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_range)
+    {
+      etl::xor_filter<16, text_hash_t> filter;
+
+      CHECK(filter.build(etl::begin(exist_text), etl::end(exist_text)));
+      CHECK(filter.build(etl::begin(exist_text), etl::begin(exist_text)));
+      CHECK(filter.empty());
+      CHECK(!filter.exists("The"));
+    }
+
+    //*************************************************************************
+    TEST(test_rebuild_and_clear)
+    {
+      etl::xor_filter<16, text_hash_t> filter;
+
+      CHECK(filter.build(etl::begin(exist_text), etl::end(exist_text)));
+      CHECK(filter.build(etl::begin(not_exist_text), etl::end(not_exist_text)));
+      CHECK_EQUAL(6U, filter.size());
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(not_exist_text); ++i)
+      {
+        CHECK(filter.exists(not_exist_text[i]));
+      }
+
+      filter.clear();
+
+      CHECK(filter.empty());
+      CHECK(!filter.exists("eels"));
+    }
+  };
+}
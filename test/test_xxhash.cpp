@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2020 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++/UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <list>
+#include <stdint.h>
+
+#include "etl/xxhash.h"
+#include "etl/hash.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
+#include "etl/unordered_map.h"
+
+namespace
+{
+  // Sample data that covers the stripe, tail and 4 byte tail paths.
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+      data[i] = uint8_t((i * 131U) + 7U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_xxhash)
+  {
+    //*************************************************************************
+    TEST(test_xxhash32_known_values)
+    {
+      std::string empty;
+      std::string abc("abc");
+
+      CHECK_EQUAL(0x02CC5D05UL, uint32_t(etl::xxhash32(empty.begin(), empty.end())));
+      CHECK_EQUAL(0x32D153FFUL, uint32_t(etl::xxhash32(abc.begin(), abc.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_known_values)
+    {
+      std::string empty;
+      std::string abc("abc");
+
+      CHECK_EQUAL(0xEF46DB3751D8E999ULL, uint64_t(etl::xxhash64(empty.begin(), empty.end())));
+      CHECK_EQUAL(0x44BC2CF5AD770999ULL, uint64_t(etl::xxhash64(abc.begin(), abc.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_values_matches_range)
+    {
+      for (size_t length = 0U; length < 100U; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        etl::xxhash32 hash;
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          hash.add(data[i]);
+        }
+
+        std::list<uint8_t> list_data(data.begin(), data.end());
+
+        uint32_t pointer_hash  = etl::xxhash32(data.data(), data.data() + data.size());
+        uint32_t iterator_hash = etl::xxhash32(list_data.begin(), list_data.end());
+
+        CHECK_EQUAL(pointer_hash, hash.value());
+        CHECK_EQUAL(pointer_hash, iterator_hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_values_matches_range)
+    {
+      for (size_t length = 0U; length < 150U; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        etl::xxhash64 hash;
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          hash.add(data[i]);
+        }
+
+        std::list<uint8_t> list_data(data.begin(), data.end());
+
+        uint64_t pointer_hash  = etl::xxhash64(data.data(), data.data() + data.size());
+        uint64_t iterator_hash = etl::xxhash64(list_data.begin(), list_data.end());
+
+        CHECK_EQUAL(pointer_hash, hash.value());
+        CHECK_EQUAL(pointer_hash, iterator_hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_split_ranges)
+    {
+      std::vector<uint8_t> data = make_data(200U);
+
+      uint32_t expected32 = etl::xxhash32(data.data(), data.data() + data.size());
+      uint64_t expected64 = etl::xxhash64(data.data(), data.data() + data.size());
+
+      for (size_t split = 0U; split <= data.size(); split += 7U)
+      {
+        etl::xxhash32 hash32;
+        hash32.add(data.data(), data.data() + split);
+        hash32.add(data.data() + split, data.data() + data.size());
+
+        etl::xxhash64 hash64;
+        hash64.add(data.data(), data.data() + split);
+        hash64.add(data.data() + split, data.data() + data.size());
+
+        CHECK_EQUAL(expected32, hash32.value());
+        CHECK_EQUAL(expected64, hash64.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_seed)
+    {
+      std::string data("123456789");
+
+      uint32_t hash32a = etl::xxhash32(data.begin(), data.end(), 0U);
+      uint32_t hash32b = etl::xxhash32(data.begin(), data.end(), 1U);
+      uint64_t hash64a = etl::xxhash64(data.begin(), data.end(), 0U);
+      uint64_t hash64b = etl::xxhash64(data.begin(), data.end(), 1U);
+
+      CHECK(hash32a != hash32b);
+      CHECK(hash64a != hash64b);
+
+      etl::xxhash32 hash32(1U);
+      hash32.add(data.begin(), data.end());
+      CHECK_EQUAL(hash32b, hash32.value());
+
+      // Reset keeps the seed.
+      hash32.reset();
+      hash32.add(data.begin(), data.end());
+      CHECK_EQUAL(hash32b, hash32.value());
+    }
+
+    //*************************************************************************
+    TEST(test_hash_using)
+    {
+      typedef etl::hash_using<etl::xxhash64, etl::istring>     istring_hash;
+      typedef etl::hash_using<etl::xxhash64, etl::string<20> > string_hash;
+      typedef etl::hash_using<etl::xxhash64, etl::string_view> view_hash;
+      typedef etl::hash_using<etl::xxhash32, uint32_t>         int_hash;
+
+      etl::string<20> text("123456789");
+      etl::string_view view(text.data(), text.size());
+
+      size_t expected = size_t(etl::xxhash64(text.begin(), text.end()));
+
+      CHECK_EQUAL(expected, istring_hash()(text));
+      CHECK_EQUAL(expected, string_hash()(text));
+      CHECK_EQUAL(expected, view_hash()(view));
+
+      uint32_t value = 0x12345678UL;
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+      CHECK_EQUAL(size_t(etl::xxhash32(p, p + sizeof(value))), int_hash()(value));
+    }
+
+    //*************************************************************************
+    TEST(test_hash_using_unordered_map)
+    {
+      typedef etl::string<20> key_t;
+      typedef etl::hash_using<etl::xxhash64, key_t> key_hash;
+      typedef etl::unordered_map<key_t, int, 10, 10, key_hash> map_t;
+
+      map_t map;
+
+      map[key_t("one")]   = 1;
+      map[key_t("two")]   = 2;
+      map[key_t("three")] = 3;
+
+      CHECK_EQUAL(1, map[key_t("one")]);
+      CHECK_EQUAL(2, map[key_t("two")]);
+      CHECK_EQUAL(3, map[key_t("three")]);
+      CHECK(map.find(key_t("four")) == map.end());
+    }
+  };
+}